@@ -0,0 +1,106 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/asset_access_profile.h"
+
+#include <string_view>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/paths.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+// The profile is a header line followed by one asset name per line.
+static constexpr std::string_view kProfileHeader =
+    "flutter-asset-access-profile-1";
+
+// The smallest page size of the supported platforms. Pages past the end of a
+// mapping are ignored by |fml::PrefetchPages|, so assuming small pages covers
+// every mapping on platforms with larger pages as well.
+static constexpr size_t kMinimumPageSize = 4096;
+
+std::vector<std::string> AssetAccessProfile::Read(const std::string& path) {
+  TRACE_EVENT0("flutter", "AssetAccessProfile::Read");
+  auto profile = fml::FileMapping::CreateReadOnly(path);
+  if (!profile || profile->GetSize() == 0) {
+    return {};
+  }
+
+  std::string_view contents(
+      reinterpret_cast<const char*>(profile->GetMapping()),
+      profile->GetSize());
+  size_t line_end = contents.find('\n');
+  if (contents.substr(0, line_end) != kProfileHeader) {
+    FML_LOG(ERROR) << "Ignoring asset access profile " << path
+                   << " with an unknown format.";
+    return {};
+  }
+
+  std::vector<std::string> asset_names;
+  while (line_end != std::string_view::npos) {
+    const size_t line_start = line_end + 1;
+    line_end = contents.find('\n', line_start);
+    // The count is clamped to the end of the profile for its last line.
+    std::string_view asset_name =
+        contents.substr(line_start, line_end - line_start);
+    if (!asset_name.empty()) {
+      asset_names.emplace_back(asset_name);
+    }
+  }
+  return asset_names;
+}
+
+bool AssetAccessProfile::Write(const std::string& path,
+                               const std::vector<std::string>& asset_names) {
+  TRACE_EVENT0("flutter", "AssetAccessProfile::Write");
+  std::string contents(kProfileHeader);
+  contents.push_back('\n');
+  for (const std::string& asset_name : asset_names) {
+    if (asset_name.find('\n') != std::string::npos) {
+      continue;
+    }
+    contents.append(asset_name);
+    contents.push_back('\n');
+  }
+
+  const std::string directory_name = fml::paths::GetDirectoryName(path);
+  auto directory = fml::OpenDirectory(directory_name.c_str(), false,
+                                      fml::FilePermission::kReadWrite);
+  if (!directory.is_valid() || directory_name.size() >= path.size()) {
+    return false;
+  }
+  const std::string file_name = path.substr(directory_name.size() + 1);
+  fml::DataMapping mapping(contents);
+  if (!fml::WriteAtomically(directory, file_name.c_str(), mapping)) {
+    FML_LOG(ERROR) << "Could not write the asset access profile to " << path;
+    return false;
+  }
+  return true;
+}
+
+size_t AssetAccessProfile::Prefetch(
+    const AssetManager& asset_manager,
+    const std::vector<std::string>& asset_names) {
+  TRACE_EVENT1("flutter", "AssetAccessProfile::Prefetch", "count",
+               std::to_string(asset_names.size()).c_str());
+  size_t found_count = 0;
+  for (const std::string& asset_name : asset_names) {
+    auto mapping = asset_manager.GetAsMapping(asset_name);
+    if (!mapping || mapping->GetSize() == 0) {
+      continue;
+    }
+    found_count++;
+    // The pages stay in the page cache after the mapping is released, so
+    // the later lookup of the asset does not wait for the disk.
+    fml::PrefetchPages(
+        *mapping,
+        std::vector<bool>(mapping->GetSize() / kMinimumPageSize + 1, true));
+  }
+  return found_count;
+}
+
+}  // namespace flutter
@@ -0,0 +1,70 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_ASSETS_ASSET_ACCESS_PROFILE_H_
+#define FLUTTER_ASSETS_ASSET_ACCESS_PROFILE_H_
+
+#include <string>
+#include <vector>
+
+#include "flutter/assets/asset_manager.h"
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Persists the names of the assets that are loaded before the
+///             first frame, in the order in which they are loaded, and
+///             prefetches those assets on later cold starts so that they are
+///             read from disk in the background instead of being faulted in
+///             one after the other when they are used.
+///
+///             Asset names that no longer exist, for example after an update
+///             of the application, are skipped when prefetching.
+///
+class AssetAccessProfile {
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      Reads the asset names of the profile at `path`.
+  ///
+  /// @param[in]  path  The path of the profile.
+  ///
+  /// @return     The asset names in the order in which they were recorded, or
+  ///             an empty list if there is no valid profile at `path`.
+  ///
+  static std::vector<std::string> Read(const std::string& path);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Writes a profile of `asset_names` to `path`, replacing any
+  ///             existing profile.
+  ///
+  /// @param[in]  path         The path of the profile.
+  /// @param[in]  asset_names  The asset names in the order in which they were
+  ///                          loaded.
+  ///
+  /// @return     If the profile was written.
+  ///
+  static bool Write(const std::string& path,
+                    const std::vector<std::string>& asset_names);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Maps each of `asset_names` and asks the system to read its
+  ///             pages into memory in the background. This blocks on the
+  ///             lookups of the assets, so it should run on a worker thread.
+  ///
+  /// @param[in]  asset_manager  The asset manager to load the assets from.
+  /// @param[in]  asset_names    The asset names to prefetch.
+  ///
+  /// @return     The number of assets that were found.
+  ///
+  static size_t Prefetch(const AssetManager& asset_manager,
+                         const std::vector<std::string>& asset_names);
+
+ private:
+  FML_DISALLOW_IMPLICIT_CONSTRUCTORS(AssetAccessProfile);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_ASSETS_ASSET_ACCESS_PROFILE_H_
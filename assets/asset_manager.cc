@@ -19,6 +19,7 @@ bool AssetManager::PushFront(std::unique_ptr<AssetResolver> resolver) {
   }
 
   resolvers_.push_front(std::move(resolver));
+  ClearLookupIndex();
   return true;
 }
 
@@ -28,6 +29,7 @@ bool AssetManager::PushBack(std::unique_ptr<AssetResolver> resolver) {
   }
 
   resolvers_.push_back(std::move(resolver));
+  ClearLookupIndex();
   return true;
 }
 
@@ -53,12 +55,54 @@ void AssetManager::UpdateResolverByType(
     new_resolvers.push_back(std::move(updated_asset_resolver));
   }
   resolvers_.swap(new_resolvers);
+  ClearLookupIndex();
 }
 
 std::deque<std::unique_ptr<AssetResolver>> AssetManager::TakeResolvers() {
+  ClearLookupIndex();
   return std::move(resolvers_);
 }
 
+void AssetManager::EnableLookupIndex() {
+  std::scoped_lock lock(lookup_index_mutex_);
+  lookup_index_enabled_ = true;
+}
+
+void AssetManager::ClearLookupIndex() {
+  std::scoped_lock lock(lookup_index_mutex_);
+  lookup_index_.clear();
+}
+
+void AssetManager::StartRecordingAccesses(size_t max_count) {
+  std::scoped_lock lock(access_recording_mutex_);
+  max_recorded_accesses_ = max_count;
+  recorded_accesses_.clear();
+  recorded_access_names_.clear();
+  recording_accesses_ = max_count > 0;
+}
+
+std::vector<std::string> AssetManager::StopRecordingAccesses() {
+  std::scoped_lock lock(access_recording_mutex_);
+  recording_accesses_ = false;
+  recorded_access_names_.clear();
+  return std::move(recorded_accesses_);
+}
+
+void AssetManager::RecordAccess(const std::string& asset_name) const {
+  if (!recording_accesses_) {
+    return;
+  }
+  std::scoped_lock lock(access_recording_mutex_);
+  if (!recording_accesses_ ||
+      !recorded_access_names_.insert(asset_name).second) {
+    return;
+  }
+  recorded_accesses_.push_back(asset_name);
+  if (recorded_accesses_.size() >= max_recorded_accesses_) {
+    recording_accesses_ = false;
+  }
+}
+
 // |AssetResolver|
 std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
     const std::string& asset_name) const {
@@ -67,12 +111,43 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   }
   TRACE_EVENT1("flutter", "AssetManager::GetAsMapping", "name",
                asset_name.c_str());
+  bool use_lookup_index = false;
+  {
+    std::scoped_lock lock(lookup_index_mutex_);
+    use_lookup_index = lookup_index_enabled_;
+    auto found = lookup_index_.find(asset_name);
+    if (found != lookup_index_.end()) {
+      if (found->second == nullptr) {
+        return nullptr;
+      }
+      auto mapping = found->second->GetAsMapping(asset_name);
+      if (mapping != nullptr) {
+        RecordAccess(asset_name);
+        return mapping;
+      }
+      // The resolver no longer has the asset, so search all of them again.
+      lookup_index_.erase(found);
+    }
+  }
   for (const auto& resolver : resolvers_) {
     auto mapping = resolver->GetAsMapping(asset_name);
     if (mapping != nullptr) {
+      if (use_lookup_index) {
+        std::scoped_lock lock(lookup_index_mutex_);
+        if (lookup_index_.size() < kMaxLookupIndexSize) {
+          lookup_index_[asset_name] = resolver.get();
+        }
+      }
+      RecordAccess(asset_name);
       return mapping;
     }
   }
+  if (use_lookup_index) {
+    std::scoped_lock lock(lookup_index_mutex_);
+    if (lookup_index_.size() < kMaxLookupIndexSize) {
+      lookup_index_[asset_name] = nullptr;
+    }
+  }
   FML_DLOG(WARNING) << "Could not find asset: " << asset_name;
   return nullptr;
 }
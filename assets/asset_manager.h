@@ -5,9 +5,14 @@
 #ifndef FLUTTER_ASSETS_ASSET_MANAGER_H_
 #define FLUTTER_ASSETS_ASSET_MANAGER_H_
 
+#include <atomic>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <optional>
 #include "flutter/assets/asset_resolver.h"
@@ -70,6 +75,36 @@ class AssetManager final : public AssetResolver {
 
   std::deque<std::unique_ptr<AssetResolver>> TakeResolvers();
 
+  //--------------------------------------------------------------------------
+  /// @brief      Remembers which resolver provided each asset, and which
+  ///             assets no resolver has, so that repeated lookups of an asset
+  ///             probe at most one resolver instead of every resolver in
+  ///             order.
+  ///
+  ///             The index is cleared whenever the resolvers change. It must
+  ///             only be enabled if the assets of the resolvers do not change
+  ///             while they are in use, which is not the case for assets
+  ///             synced to a development file system, for example.
+  void EnableLookupIndex();
+
+  //--------------------------------------------------------------------------
+  /// @brief      Starts recording the names of the assets that are found, in
+  ///             the order in which they are first looked up.
+  ///
+  /// @param[in]  max_count  The number of asset names after which recording
+  ///                        stops on its own.
+  ///
+  void StartRecordingAccesses(size_t max_count);
+
+  //--------------------------------------------------------------------------
+  /// @brief      Stops recording asset accesses.
+  ///
+  /// @return     The names of the assets found since
+  ///             |StartRecordingAccesses| was called, in the order in which
+  ///             they were first looked up.
+  ///
+  std::vector<std::string> StopRecordingAccesses();
+
   // |AssetResolver|
   bool IsValid() const override;
 
@@ -89,8 +124,32 @@ class AssetManager final : public AssetResolver {
       const std::optional<std::string>& subdir) const override;
 
  private:
+  // The number of asset names the lookup index remembers at most.
+  static constexpr size_t kMaxLookupIndexSize = 4096;
+
+  // Forgets the resolvers recorded in |lookup_index_|.
+  void ClearLookupIndex();
+
+  // Appends |asset_name| to |recorded_accesses_| if accesses are recorded and
+  // the asset was not recorded before.
+  void RecordAccess(const std::string& asset_name) const;
+
   std::deque<std::unique_ptr<AssetResolver>> resolvers_;
 
+  mutable std::mutex lookup_index_mutex_;
+  bool lookup_index_enabled_ = false;
+  // A map from asset names to the resolver that provided them, or nullptr if
+  // none of the resolvers has the asset.
+  mutable std::unordered_map<std::string, const AssetResolver*> lookup_index_;
+
+  // Checked before taking |access_recording_mutex_|, so that lookups do not
+  // contend for the mutex when nothing is recorded.
+  mutable std::atomic_bool recording_accesses_ = false;
+  mutable std::mutex access_recording_mutex_;
+  size_t max_recorded_accesses_ = 0;
+  mutable std::vector<std::string> recorded_accesses_;
+  mutable std::unordered_set<std::string> recorded_access_names_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(AssetManager);
 };
 
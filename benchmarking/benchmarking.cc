@@ -4,6 +4,11 @@
 
 #include "benchmarking.h"
 
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#include "flutter/benchmarking/results_reporter.h"
 #include "flutter/fml/backtrace.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/command_line.h"
@@ -13,15 +18,32 @@ namespace benchmarking {
 
 int Main(int argc, char** argv) {
   fml::InstallCrashHandler();
-#if !defined(FML_OS_ANDROID)
   fml::CommandLine cmd = fml::CommandLineFromPlatformOrArgcArgv(argc, argv);
+#if !defined(FML_OS_ANDROID)
   std::string icudtl_path =
       cmd.GetOptionValueWithDefault("icu-data-file-path", "icudtl.dat");
   fml::icu::InitializeICU(icudtl_path);
 #endif
   benchmark::Initialize(&argc, argv);
-  ::benchmark::RunSpecifiedBenchmarks();
-  return 0;
+
+  // The results of all benchmark executables are written in the same schema,
+  // see |ResultsReporter|. Run with --benchmark_repetitions to get more than
+  // one sample of each benchmark.
+  std::string results_path;
+  if (!cmd.GetOptionValue("benchmark_results_out", &results_path)) {
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+  }
+  std::ofstream results_stream(results_path);
+  if (!results_stream) {
+    std::cerr << "Could not open " << results_path << " for writing."
+              << std::endl;
+    return 1;
+  }
+  ::benchmark::ConsoleReporter display_reporter;
+  ResultsReporter reporter(&display_reporter, &results_stream);
+  ::benchmark::RunSpecifiedBenchmarks(&reporter);
+  return results_stream ? 0 : 1;
 }
 
 }  // namespace benchmarking
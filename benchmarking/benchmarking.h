@@ -9,6 +9,16 @@
 
 namespace benchmarking {
 
+// The name of the counter in which a benchmark reports the number of heap
+// allocations of an iteration, for the "allocations" metric of the results
+// written with --benchmark_results_out.
+constexpr char kAllocationsCounter[] = "allocations";
+
+// The name of the counter in which a benchmark reports the GPU time of an
+// iteration in microseconds, for the "gpu_time" metric of the results
+// written with --benchmark_results_out.
+constexpr char kGpuTimeCounter[] = "gpu_time_us";
+
 class ScopedPauseTiming {
  public:
   explicit ScopedPauseTiming(::benchmark::State& state, bool enabled = true)
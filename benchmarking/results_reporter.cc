@@ -0,0 +1,188 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/results_reporter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+#include <utility>
+
+#include "flutter/benchmarking/benchmarking.h"
+
+namespace benchmarking {
+
+namespace {
+
+constexpr int kSchemaVersion = 1;
+
+// The times measured by Google Benchmark.
+constexpr char kRealTimeMetric[] = "real_time";
+constexpr char kCpuTimeMetric[] = "cpu_time";
+
+// The metrics read from counters, and the names of their counters.
+constexpr std::pair<const char*, const char*> kCounterMetrics[] = {
+    {"allocations", kAllocationsCounter},
+    {"gpu_time", kGpuTimeCounter},
+};
+
+void WriteString(std::ostream& out, const std::string& value) {
+  out << '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[7];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          out << escaped;
+        } else {
+          out << c;
+        }
+    }
+  }
+  out << '"';
+}
+
+void WriteNumber(std::ostream& out, double value) {
+  // JSON has no representation for infinities and NaNs.
+  if (!std::isfinite(value)) {
+    out << "null";
+    return;
+  }
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+  out << buffer;
+}
+
+// Returns the nearest-rank percentile of the sorted |samples|.
+double Percentile(const std::vector<double>& sorted_samples, double percent) {
+  const size_t rank = static_cast<size_t>(
+      std::ceil(percent / 100.0 * sorted_samples.size()));
+  return sorted_samples[std::max<size_t>(rank, 1) - 1];
+}
+
+void WriteMetric(std::ostream& out, const std::vector<double>& samples) {
+  std::vector<double> sorted = samples;
+  std::sort(sorted.begin(), sorted.end());
+  const size_t count = sorted.size();
+
+  const double mean =
+      std::accumulate(sorted.begin(), sorted.end(), 0.0) / count;
+  const double median = count % 2 == 1
+                            ? sorted[count / 2]
+                            : (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+  double squared_deviations = 0;
+  for (double sample : sorted) {
+    squared_deviations += (sample - mean) * (sample - mean);
+  }
+  // The sample standard deviation, since the repetitions are a sample of all
+  // possible runs.
+  const double stddev =
+      count > 1 ? std::sqrt(squared_deviations / (count - 1)) : 0;
+
+  out << "{\"mean\": ";
+  WriteNumber(out, mean);
+  out << ", \"median\": ";
+  WriteNumber(out, median);
+  out << ", \"p90\": ";
+  WriteNumber(out, Percentile(sorted, 90));
+  out << ", \"stddev\": ";
+  WriteNumber(out, stddev);
+  out << ", \"min\": ";
+  WriteNumber(out, sorted.front());
+  out << ", \"max\": ";
+  WriteNumber(out, sorted.back());
+  out << ", \"samples\": [";
+  for (size_t i = 0; i < samples.size(); i++) {
+    if (i > 0) {
+      out << ", ";
+    }
+    WriteNumber(out, samples[i]);
+  }
+  out << "]}";
+}
+
+}  // namespace
+
+ResultsReporter::ResultsReporter(
+    ::benchmark::BenchmarkReporter* display_reporter,
+    std::ostream* results_stream)
+    : display_reporter_(display_reporter), results_stream_(results_stream) {}
+
+ResultsReporter::~ResultsReporter() = default;
+
+bool ResultsReporter::ReportContext(const Context& context) {
+  return display_reporter_->ReportContext(context);
+}
+
+void ResultsReporter::ReportRuns(const std::vector<Run>& reports) {
+  display_reporter_->ReportRuns(reports);
+  for (const Run& run : reports) {
+    // Aggregates are computed again from the individual repetitions.
+    if (run.error_occurred || run.run_type != Run::RT_Iteration) {
+      continue;
+    }
+    const std::string name = run.benchmark_name();
+    auto found = results_.find(name);
+    if (found == results_.end()) {
+      names_.push_back(name);
+      found = results_.emplace(name, Results{}).first;
+      found->second.time_unit = ::benchmark::GetTimeUnitString(run.time_unit);
+    }
+    auto& samples = found->second.samples;
+    samples[kRealTimeMetric].push_back(run.GetAdjustedRealTime());
+    samples[kCpuTimeMetric].push_back(run.GetAdjustedCPUTime());
+    for (const auto& [metric, counter] : kCounterMetrics) {
+      auto value = run.counters.find(counter);
+      if (value != run.counters.end()) {
+        samples[metric].push_back(value->second.value);
+      }
+    }
+  }
+}
+
+void ResultsReporter::Finalize() {
+  display_reporter_->Finalize();
+
+  std::ostream& out = *results_stream_;
+  out << "{\n  \"schema_version\": " << kSchemaVersion
+      << ",\n  \"benchmarks\": [";
+  for (size_t i = 0; i < names_.size(); i++) {
+    const Results& results = results_[names_[i]];
+    const auto& samples = results.samples;
+    out << (i > 0 ? ",\n" : "\n") << "    {\"name\": ";
+    WriteString(out, names_[i]);
+    out << ", \"time_unit\": ";
+    WriteString(out, results.time_unit);
+    out << ", \"repetitions\": " << samples.at(kRealTimeMetric).size()
+        << ", \"metrics\": {";
+    std::vector<const char*> metrics = {kRealTimeMetric, kCpuTimeMetric};
+    for (const auto& [metric, counter] : kCounterMetrics) {
+      // Only metrics reported by every repetition can be compared.
+      auto found = samples.find(metric);
+      if (found != samples.end() &&
+          found->second.size() == samples.at(kRealTimeMetric).size()) {
+        metrics.push_back(metric);
+      }
+    }
+    for (size_t j = 0; j < metrics.size(); j++) {
+      out << (j > 0 ? ", " : "");
+      WriteString(out, metrics[j]);
+      out << ": ";
+      WriteMetric(out, samples.at(metrics[j]));
+    }
+    out << "}}";
+  }
+  out << "\n  ]\n}\n";
+  out.flush();
+}
+
+}  // namespace benchmarking
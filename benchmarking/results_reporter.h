@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_BENCHMARKING_RESULTS_REPORTER_H_
+#define FLUTTER_BENCHMARKING_RESULTS_REPORTER_H_
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "flutter/fml/macros.h"
+
+namespace benchmarking {
+
+// Summarizes the repetitions of each benchmark in the results schema that is
+// shared by all engine benchmarks, so that the results of different
+// benchmark executables and of different runs can be compared with
+// testing/benchmark/compare_benchmark_results.py.
+//
+// The schema is a JSON object with a "schema_version" and a list of
+// "benchmarks". Each benchmark has a "name", a "time_unit", the number of
+// "repetitions" and a "metrics" object. Each metric holds the "mean",
+// "median", "p90", "stddev", "min", "max" and "samples" of its repetitions.
+// The "real_time" and "cpu_time" metrics are always present. The
+// "allocations" and "gpu_time" metrics are present for benchmarks that
+// report the |kAllocationsCounter| and |kGpuTimeCounter| counters. The GPU
+// time is in microseconds regardless of the "time_unit".
+//
+// The reporter also forwards the runs to |display_reporter|, so that the
+// usual console output is kept.
+class ResultsReporter : public ::benchmark::BenchmarkReporter {
+ public:
+  ResultsReporter(::benchmark::BenchmarkReporter* display_reporter,
+                  std::ostream* results_stream);
+
+  ~ResultsReporter() override;
+
+  // |benchmark::BenchmarkReporter|
+  bool ReportContext(const Context& context) override;
+
+  // |benchmark::BenchmarkReporter|
+  void ReportRuns(const std::vector<Run>& reports) override;
+
+  // |benchmark::BenchmarkReporter|
+  void Finalize() override;
+
+ private:
+  struct Results {
+    std::string time_unit;
+    std::map<std::string, std::vector<double>> samples;
+  };
+
+  ::benchmark::BenchmarkReporter* display_reporter_;
+  std::ostream* results_stream_;
+  // The names of the benchmarks in the order in which they ran.
+  std::vector<std::string> names_;
+  std::map<std::string, Results> results_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ResultsReporter);
+};
+
+}  // namespace benchmarking
+
+#endif  // FLUTTER_BENCHMARKING_RESULTS_REPORTER_H_
@@ -2,6 +2,17 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#ifndef FLUTTER_COMMON_CONSTANTS_H_
+#define FLUTTER_COMMON_CONSTANTS_H_
+
+#include <cstdint>
+
 namespace flutter {
 constexpr double kMegaByteSizeInBytes = (1 << 20);
+
+// The ID of the view that the engine renders to when the framework doesn't
+// specify one, which is the only view of most embedders.
+constexpr int64_t kFlutterImplicitViewId = 0;
 }  // namespace flutter
+
+#endif  // FLUTTER_COMMON_CONSTANTS_H_
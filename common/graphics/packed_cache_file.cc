@@ -0,0 +1,543 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/common/graphics/packed_cache_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+// The layout of the file is a FileHeader, followed by |entry_count|
+// IndexEntries, the keys and values that they point to, and finally the
+// records that have been appended since. Each record is a RecordHeader
+// followed by the key and the value of the record.
+struct FileHeader {
+  static constexpr uint32_t kSignature = 0x4B435046;  // FPCK
+  static constexpr uint32_t kVersion1 = 1;
+
+  uint32_t signature = kSignature;
+  uint32_t version = kVersion1;
+  uint32_t entry_count = 0;
+  uint32_t reserved = 0;
+  uint64_t records_offset = 0;
+};
+
+struct IndexEntry {
+  uint32_t flags = 0;
+  uint32_t key_size = 0;
+  uint32_t stored_size = 0;
+  uint32_t value_size = 0;
+  uint64_t offset = 0;
+};
+
+struct RecordHeader {
+  static constexpr uint32_t kSignature = 0x52435046;  // FPCR
+
+  uint32_t signature = kSignature;
+  uint32_t flags = 0;
+  uint32_t key_size = 0;
+  uint32_t stored_size = 0;
+  uint32_t value_size = 0;
+  uint32_t checksum = 0;
+};
+
+constexpr uint32_t kCompressedFlag = 1 << 0;
+
+// The compression is a byte oriented LZ77 in the style of the LZ4 block
+// format. Each sequence starts with a token whose high nibble is the number
+// of literals and whose low nibble is the length of the match minus
+// |kMinMatch|, both extended by additional bytes when they are 15. The
+// literals follow, then the 16 bit offset of the match and the extension of
+// the match length. The last sequence only has literals.
+constexpr size_t kMinMatch = 4;
+constexpr size_t kMaxOffset = 0xFFFF;
+constexpr size_t kHashBits = 12;
+// A value can't expand more than this when it is decompressed, which bounds
+// the allocations for corrupt entries.
+constexpr size_t kMaxCompressionRatio = 255;
+
+void WriteLength(std::vector<uint8_t>& output, size_t length) {
+  while (length >= 255) {
+    output.push_back(255);
+    length -= 255;
+  }
+  output.push_back(static_cast<uint8_t>(length));
+}
+
+bool ReadLength(const uint8_t*& input, const uint8_t* end, size_t& length) {
+  uint8_t byte;
+  do {
+    if (input == end) {
+      return false;
+    }
+    byte = *input++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+void WriteSequence(std::vector<uint8_t>& output,
+                   const uint8_t* literals,
+                   size_t literal_length,
+                   size_t offset,
+                   size_t match_length) {
+  const bool has_match = match_length >= kMinMatch;
+  const size_t match_code = has_match ? match_length - kMinMatch : 0;
+  output.push_back(
+      static_cast<uint8_t>((std::min<size_t>(literal_length, 15) << 4) |
+                           std::min<size_t>(match_code, 15)));
+  if (literal_length >= 15) {
+    WriteLength(output, literal_length - 15);
+  }
+  output.insert(output.end(), literals, literals + literal_length);
+  if (!has_match) {
+    return;
+  }
+  output.push_back(static_cast<uint8_t>(offset & 0xFF));
+  output.push_back(static_cast<uint8_t>(offset >> 8));
+  if (match_code >= 15) {
+    WriteLength(output, match_code - 15);
+  }
+}
+
+std::vector<uint8_t> Compress(const uint8_t* input, size_t size) {
+  std::vector<uint8_t> output;
+  output.reserve(size);
+  // The positions of the last occurrences of hashed sequences, plus one.
+  std::vector<uint32_t> table(1 << kHashBits, 0);
+  size_t anchor = 0;
+  size_t position = 0;
+  while (position + kMinMatch <= size) {
+    uint32_t sequence;
+    memcpy(&sequence, input + position, sizeof(sequence));
+    const uint32_t hash = (sequence * 2654435761u) >> (32 - kHashBits);
+    const size_t candidate = table[hash];
+    table[hash] = static_cast<uint32_t>(position + 1);
+    if (candidate == 0 || position - (candidate - 1) > kMaxOffset ||
+        memcmp(input + candidate - 1, input + position, kMinMatch) != 0) {
+      position++;
+      continue;
+    }
+    const size_t match = candidate - 1;
+    size_t match_length = kMinMatch;
+    while (position + match_length < size &&
+           input[match + match_length] == input[position + match_length]) {
+      match_length++;
+    }
+    WriteSequence(output, input + anchor, position - anchor, position - match,
+                  match_length);
+    position += match_length;
+    anchor = position;
+  }
+  WriteSequence(output, input + anchor, size - anchor, 0, 0);
+  return output;
+}
+
+bool Decompress(const uint8_t* input,
+                size_t size,
+                uint8_t* output,
+                size_t output_size) {
+  const uint8_t* const input_end = input + size;
+  size_t written = 0;
+  while (input < input_end) {
+    const uint8_t token = *input++;
+    size_t literal_length = token >> 4;
+    if (literal_length == 15 && !ReadLength(input, input_end, literal_length)) {
+      return false;
+    }
+    if (static_cast<size_t>(input_end - input) < literal_length ||
+        output_size - written < literal_length) {
+      return false;
+    }
+    memcpy(output + written, input, literal_length);
+    input += literal_length;
+    written += literal_length;
+    if (input == input_end) {
+      break;
+    }
+
+    if (input_end - input < 2) {
+      return false;
+    }
+    const size_t offset = input[0] | (input[1] << 8);
+    input += 2;
+    size_t match_length = token & 0xF;
+    if (match_length == 15 && !ReadLength(input, input_end, match_length)) {
+      return false;
+    }
+    match_length += kMinMatch;
+    if (offset == 0 || offset > written ||
+        output_size - written < match_length) {
+      return false;
+    }
+    // The match may overlap the bytes that it produces.
+    for (size_t i = 0; i < match_length; i++) {
+      output[written + i] = output[written - offset + i];
+    }
+    written += match_length;
+  }
+  return written == output_size;
+}
+
+// FNV-1a, which is enough to detect records that were torn by a crash.
+uint32_t Checksum(const uint8_t* data, size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+std::string KeyString(const SkData& key) {
+  return std::string(static_cast<const char*>(key.data()), key.size());
+}
+
+// Wraps bytes of the mapping in SkData that keeps the mapping alive.
+sk_sp<SkData> MakeMappedData(const std::shared_ptr<fml::Mapping>& mapping,
+                             const uint8_t* data,
+                             size_t size) {
+  return SkData::MakeWithProc(
+      data, size,
+      [](const void* ptr, void* context) {
+        delete static_cast<std::shared_ptr<fml::Mapping>*>(context);
+      },
+      new std::shared_ptr<fml::Mapping>(mapping));
+}
+
+}  // namespace
+
+PackedCacheFile::PackedCacheFile(std::shared_ptr<fml::UniqueFD> directory,
+                                 std::string file_name,
+                                 bool read_only,
+                                 bool compress)
+    : directory_(std::move(directory)),
+      file_name_(std::move(file_name)),
+      read_only_(read_only),
+      compress_(compress) {
+  Load();
+}
+
+PackedCacheFile::~PackedCacheFile() = default;
+
+void PackedCacheFile::Load() {
+  TRACE_EVENT0("flutter", "PackedCacheFile::Load");
+  if (!directory_ || !directory_->is_valid()) {
+    return;
+  }
+  auto file = fml::OpenFileReadOnly(*directory_, file_name_.c_str());
+  if (!file.is_valid()) {
+    return;
+  }
+  std::shared_ptr<fml::Mapping> mapping =
+      std::make_shared<fml::FileMapping>(file);
+  const uint8_t* data = mapping->GetMapping();
+  const size_t size = mapping->GetSize();
+
+  FileHeader header;
+  if (data == nullptr || size < sizeof(FileHeader)) {
+    return;
+  }
+  memcpy(&header, data, sizeof(FileHeader));
+  if (header.signature != FileHeader::kSignature ||
+      header.version != FileHeader::kVersion1 ||
+      header.entry_count > (size - sizeof(FileHeader)) / sizeof(IndexEntry) ||
+      header.records_offset > size ||
+      header.records_offset <
+          sizeof(FileHeader) + header.entry_count * sizeof(IndexEntry)) {
+    FML_LOG(INFO) << "Persistent cache header is corrupt: " << file_name_;
+    return;
+  }
+
+  auto add_entry = [this, &mapping](const uint8_t* payload, uint32_t flags,
+                                    uint32_t key_size, uint32_t stored_size,
+                                    uint32_t value_size) {
+    if (key_size == 0 || ((flags & kCompressedFlag) == 0
+                              ? value_size != stored_size
+                              : value_size / kMaxCompressionRatio >
+                                    stored_size)) {
+      return false;
+    }
+    StoredEntry entry;
+    entry.key = MakeMappedData(mapping, payload, key_size);
+    entry.stored_value =
+        MakeMappedData(mapping, payload + key_size, stored_size);
+    entry.flags = flags;
+    entry.value_size = value_size;
+    entry.persisted = true;
+    entries_[KeyString(*entry.key)] = std::move(entry);
+    return true;
+  };
+
+  std::scoped_lock lock(file_mutex_, entries_mutex_);
+  const uint8_t* index = data + sizeof(FileHeader);
+  for (uint32_t i = 0; i < header.entry_count; i++) {
+    IndexEntry index_entry;
+    memcpy(&index_entry, index + i * sizeof(IndexEntry), sizeof(IndexEntry));
+    const uint64_t payload_size =
+        static_cast<uint64_t>(index_entry.key_size) + index_entry.stored_size;
+    if (index_entry.offset > header.records_offset ||
+        header.records_offset - index_entry.offset < payload_size ||
+        !add_entry(data + index_entry.offset, index_entry.flags,
+                   index_entry.key_size, index_entry.stored_size,
+                   index_entry.value_size)) {
+      FML_LOG(INFO) << "Persistent cache index is corrupt: " << file_name_;
+      entries_.clear();
+      return;
+    }
+  }
+
+  // Stop at the first record that is incomplete. The following appends
+  // overwrite it.
+  size_t offset = header.records_offset;
+  size_t record_count = 0;
+  while (size - offset >= sizeof(RecordHeader)) {
+    RecordHeader record;
+    memcpy(&record, data + offset, sizeof(RecordHeader));
+    const uint64_t payload_size =
+        static_cast<uint64_t>(record.key_size) + record.stored_size;
+    const uint8_t* payload = data + offset + sizeof(RecordHeader);
+    if (record.signature != RecordHeader::kSignature ||
+        size - offset - sizeof(RecordHeader) < payload_size ||
+        Checksum(payload, payload_size) != record.checksum ||
+        !add_entry(payload, record.flags, record.key_size, record.stored_size,
+                   record.value_size)) {
+      break;
+    }
+    offset += sizeof(RecordHeader) + payload_size;
+    record_count++;
+  }
+  file_size_ = offset;
+  appended_record_count_ = record_count;
+}
+
+sk_sp<SkData> PackedCacheFile::Get(const SkData& key) {
+  std::scoped_lock lock(entries_mutex_);
+  auto found = entries_.find(KeyString(key));
+  if (found == entries_.end()) {
+    return nullptr;
+  }
+  return GetValueLocked(found->second);
+}
+
+sk_sp<SkData> PackedCacheFile::GetValueLocked(StoredEntry& entry) {
+  if (entry.value) {
+    return entry.value;
+  }
+  if ((entry.flags & kCompressedFlag) == 0) {
+    entry.value = entry.stored_value;
+    return entry.value;
+  }
+  sk_sp<SkData> value = SkData::MakeUninitialized(entry.value_size);
+  if (!Decompress(entry.stored_value->bytes(), entry.stored_value->size(),
+                  static_cast<uint8_t*>(value->writable_data()),
+                  value->size())) {
+    FML_LOG(ERROR) << "Persistent cache entry is corrupt: " << file_name_;
+    return nullptr;
+  }
+  entry.value = std::move(value);
+  return entry.value;
+}
+
+void PackedCacheFile::Put(const SkData& key, const SkData& value) {
+  if (key.size() == 0) {
+    return;
+  }
+  StoredEntry entry;
+  entry.key = SkData::MakeWithCopy(key.data(), key.size());
+  entry.value = SkData::MakeWithCopy(value.data(), value.size());
+  entry.value_size = value.size();
+  entry.stored_value = entry.value;
+  if (compress_) {
+    std::vector<uint8_t> compressed = Compress(value.bytes(), value.size());
+    if (compressed.size() < value.size()) {
+      entry.stored_value =
+          SkData::MakeWithCopy(compressed.data(), compressed.size());
+      entry.flags |= kCompressedFlag;
+    }
+  }
+
+  std::string key_string = KeyString(key);
+  std::scoped_lock lock(entries_mutex_);
+  entries_[key_string] = std::move(entry);
+  unpersisted_keys_.push_back(std::move(key_string));
+}
+
+std::vector<PackedCacheFile::Entry> PackedCacheFile::GetEntries() {
+  TRACE_EVENT0("flutter", "PackedCacheFile::GetEntries");
+  std::vector<Entry> result;
+  std::scoped_lock lock(entries_mutex_);
+  result.reserve(entries_.size());
+  for (auto& [key, entry] : entries_) {
+    sk_sp<SkData> value = GetValueLocked(entry);
+    if (value) {
+      result.push_back({entry.key, std::move(value)});
+    }
+  }
+  return result;
+}
+
+bool PackedCacheFile::Persist() {
+  TRACE_EVENT0("flutter", "PackedCacheFile::Persist");
+  if (read_only_ || !directory_ || !directory_->is_valid()) {
+    return false;
+  }
+  std::scoped_lock file_lock(file_mutex_);
+  std::vector<uint8_t> records;
+  size_t record_count = 0;
+  bool compact = false;
+  {
+    std::scoped_lock lock(entries_mutex_);
+    if (unpersisted_keys_.empty()) {
+      return true;
+    }
+    compact = file_size_ == 0 ||
+              appended_record_count_ + unpersisted_keys_.size() >
+                  kMaxAppendedRecords;
+    if (!compact) {
+      for (const std::string& key : unpersisted_keys_) {
+        auto found = entries_.find(key);
+        if (found == entries_.end() || found->second.persisted) {
+          continue;
+        }
+        StoredEntry& entry = found->second;
+        RecordHeader record;
+        record.flags = entry.flags;
+        record.key_size = entry.key->size();
+        record.stored_size = entry.stored_value->size();
+        record.value_size = entry.value_size;
+        const size_t header_offset = records.size();
+        records.resize(header_offset + sizeof(RecordHeader));
+        records.insert(records.end(), entry.key->bytes(),
+                       entry.key->bytes() + entry.key->size());
+        const uint8_t* stored_value = entry.stored_value->bytes();
+        records.insert(records.end(), stored_value,
+                       stored_value + entry.stored_value->size());
+        record.checksum =
+            Checksum(records.data() + header_offset + sizeof(RecordHeader),
+                     records.size() - header_offset - sizeof(RecordHeader));
+        memcpy(records.data() + header_offset, &record, sizeof(RecordHeader));
+        entry.persisted = true;
+        record_count++;
+      }
+      unpersisted_keys_.clear();
+    }
+  }
+  if (compact) {
+    return CompactLocked();
+  }
+  if (records.empty()) {
+    return true;
+  }
+  return AppendLocked(records, record_count);
+}
+
+bool PackedCacheFile::AppendLocked(const std::vector<uint8_t>& records,
+                                   size_t record_count) {
+  TRACE_EVENT0("flutter", "PackedCacheFile::Append");
+  auto file = fml::OpenFile(*directory_, file_name_.c_str(), false,
+                            fml::FilePermission::kReadWrite);
+  const size_t new_size = file_size_ + records.size();
+  if (file.is_valid() && fml::TruncateFile(file, new_size)) {
+    fml::FileMapping mapping(file, {fml::FileMapping::Protection::kRead,
+                                    fml::FileMapping::Protection::kWrite});
+    if (mapping.GetMutableMapping() != nullptr &&
+        mapping.GetSize() == new_size) {
+      memcpy(mapping.GetMutableMapping() + file_size_, records.data(),
+             records.size());
+      file_size_ = new_size;
+      appended_record_count_ += record_count;
+      return true;
+    }
+  }
+  FML_LOG(WARNING) << "Could not append to the persistent cache: "
+                   << file_name_;
+  // Rewrite the whole file the next time around.
+  file_size_ = 0;
+  return false;
+}
+
+bool PackedCacheFile::Compact() {
+  if (read_only_ || !directory_ || !directory_->is_valid()) {
+    return false;
+  }
+  std::scoped_lock file_lock(file_mutex_);
+  return CompactLocked();
+}
+
+bool PackedCacheFile::CompactLocked() {
+  TRACE_EVENT0("flutter", "PackedCacheFile::Compact");
+  std::vector<uint8_t> contents;
+  {
+    std::scoped_lock lock(entries_mutex_);
+    FileHeader header;
+    header.entry_count = entries_.size();
+    size_t offset = sizeof(FileHeader) + entries_.size() * sizeof(IndexEntry);
+    size_t total_size = offset;
+    for (const auto& [key, entry] : entries_) {
+      total_size += entry.key->size() + entry.stored_value->size();
+    }
+    header.records_offset = total_size;
+    contents.resize(total_size);
+    memcpy(contents.data(), &header, sizeof(FileHeader));
+
+    uint8_t* index = contents.data() + sizeof(FileHeader);
+    for (auto& [key, entry] : entries_) {
+      IndexEntry index_entry;
+      index_entry.flags = entry.flags;
+      index_entry.key_size = entry.key->size();
+      index_entry.stored_size = entry.stored_value->size();
+      index_entry.value_size = entry.value_size;
+      index_entry.offset = offset;
+      memcpy(index, &index_entry, sizeof(IndexEntry));
+      index += sizeof(IndexEntry);
+      memcpy(contents.data() + offset, entry.key->data(), entry.key->size());
+      offset += entry.key->size();
+      memcpy(contents.data() + offset, entry.stored_value->data(),
+             entry.stored_value->size());
+      offset += entry.stored_value->size();
+      entry.persisted = true;
+    }
+    unpersisted_keys_.clear();
+  }
+
+  fml::DataMapping mapping(std::move(contents));
+  if (!fml::WriteAtomically(*directory_, file_name_.c_str(), mapping)) {
+    FML_LOG(WARNING) << "Could not write the persistent cache: " << file_name_;
+    file_size_ = 0;
+    return false;
+  }
+  file_size_ = mapping.GetSize();
+  appended_record_count_ = 0;
+  return true;
+}
+
+void PackedCacheFile::Clear() {
+  std::scoped_lock lock(file_mutex_, entries_mutex_);
+  entries_.clear();
+  unpersisted_keys_.clear();
+  file_size_ = 0;
+  appended_record_count_ = 0;
+}
+
+size_t PackedCacheFile::GetEntryCount() const {
+  std::scoped_lock lock(entries_mutex_);
+  return entries_.size();
+}
+
+size_t PackedCacheFile::GetAppendedRecordCount() const {
+  std::scoped_lock lock(file_mutex_);
+  return appended_record_count_;
+}
+
+}  // namespace flutter
@@ -0,0 +1,122 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_COMMON_GRAPHICS_PACKED_CACHE_FILE_H_
+#define FLUTTER_COMMON_GRAPHICS_PACKED_CACHE_FILE_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/unique_fd.h"
+#include "third_party/skia/include/core/SkData.h"
+
+namespace flutter {
+
+/// A key-value store of SkData that is kept in a single file.
+///
+/// The file starts with an index of the entries it was compacted with,
+/// followed by their keys and values and by the records that have been
+/// appended to it since. The whole file is mapped into memory when the store
+/// is opened, so loading all the entries is a single sequential read instead
+/// of a file system lookup per entry.
+///
+/// Values are optionally compressed. New entries are kept in memory until
+/// |Persist| appends them to the file. Appended records carry a checksum, so
+/// a record that was torn by a crash is dropped along with the records after
+/// it the next time the file is opened. Once enough records have been
+/// appended, the file is compacted by atomically replacing it with a freshly
+/// indexed one.
+///
+/// All methods are thread-safe.
+class PackedCacheFile {
+ public:
+  // The number of appended records after which |Persist| compacts the file.
+  static constexpr size_t kMaxAppendedRecords = 64;
+
+  struct Entry {
+    sk_sp<SkData> key;
+    sk_sp<SkData> value;
+  };
+
+  PackedCacheFile(std::shared_ptr<fml::UniqueFD> directory,
+                  std::string file_name,
+                  bool read_only,
+                  bool compress);
+
+  ~PackedCacheFile();
+
+  /// Returns the value stored for |key|, or null if there is none.
+  sk_sp<SkData> Get(const SkData& key);
+
+  /// Stores |value| for |key| in memory. The entry is written to the file by
+  /// the next call to |Persist|.
+  void Put(const SkData& key, const SkData& value);
+
+  /// Returns all the entries of the store.
+  std::vector<Entry> GetEntries();
+
+  /// Writes the entries that have been put since the last call to the file.
+  /// This does file IO and should be called on a worker thread.
+  ///
+  /// @return     Whether the file is up to date.
+  bool Persist();
+
+  /// Replaces the file with one that indexes all the entries of the store.
+  /// This does file IO and should be called on a worker thread.
+  bool Compact();
+
+  /// Forgets all entries. This is used after the file has been removed.
+  void Clear();
+
+  size_t GetEntryCount() const;
+
+  size_t GetAppendedRecordCount() const;
+
+ private:
+  struct StoredEntry {
+    sk_sp<SkData> key;
+    // The value as it is stored in the file, which may be compressed.
+    sk_sp<SkData> stored_value;
+    uint32_t flags = 0;
+    uint32_t value_size = 0;
+    // The uncompressed value, which is only decompressed when it's needed.
+    sk_sp<SkData> value;
+    bool persisted = false;
+  };
+
+  void Load();
+
+  sk_sp<SkData> GetValueLocked(StoredEntry& entry);
+
+  bool CompactLocked();
+
+  bool AppendLocked(const std::vector<uint8_t>& records,
+                    size_t record_count);
+
+  const std::shared_ptr<fml::UniqueFD> directory_;
+  const std::string file_name_;
+  const bool read_only_;
+  const bool compress_;
+
+  mutable std::mutex entries_mutex_;
+  std::map<std::string, StoredEntry> entries_;
+  std::vector<std::string> unpersisted_keys_;
+
+  // Serializes the file IO.
+  mutable std::mutex file_mutex_;
+  // The end of the valid contents of the file, or 0 if the file must be
+  // rewritten before records can be appended to it.
+  size_t file_size_ = 0;
+  size_t appended_record_count_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PackedCacheFile);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_COMMON_GRAPHICS_PACKED_CACHE_FILE_H_
@@ -14,7 +14,6 @@
 #include "flutter/fml/file.h"
 #include "flutter/fml/hex_codec.h"
 #include "flutter/fml/logging.h"
-#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
@@ -28,6 +27,8 @@ namespace flutter {
 
 std::string PersistentCache::cache_base_path_;
 
+bool PersistentCache::use_packed_cache_ = false;
+
 std::shared_ptr<AssetManager> PersistentCache::asset_manager_;
 
 std::mutex PersistentCache::instance_mutex_;
@@ -78,6 +79,10 @@ void PersistentCache::SetCacheDirectoryPath(std::string path) {
   cache_base_path_ = std::move(path);
 }
 
+void PersistentCache::SetUsePackedCache(bool value) {
+  use_packed_cache_ = value;
+}
+
 bool PersistentCache::Purge() {
   // Make sure that this is called after the worker task runner setup so all the
   // file system modifications would happen on that single thread to avoid
@@ -86,7 +91,9 @@ bool PersistentCache::Purge() {
 
   std::promise<bool> removed;
   GetWorkerTaskRunner()->PostTask([&removed,
-                                   cache_directory = cache_directory_]() {
+                                   cache_directory = cache_directory_,
+                                   packed_cache = packed_cache_,
+                                   packed_sksl_cache = packed_sksl_cache_]() {
     if (cache_directory->is_valid()) {
       // Only remove files but not directories.
       FML_LOG(INFO) << "Purge persistent cache.";
@@ -98,7 +105,13 @@ bool PersistentCache::Purge() {
         }
         return fml::UnlinkFile(directory, filename.c_str());
       };
-      removed.set_value(VisitFilesRecursively(*cache_directory, delete_file));
+      bool success = VisitFilesRecursively(*cache_directory, delete_file);
+      for (const auto& packed : {packed_cache, packed_sksl_cache}) {
+        if (packed) {
+          packed->Clear();
+        }
+      }
+      removed.set_value(success);
     } else {
       removed.set_value(false);
     }
@@ -129,17 +142,20 @@ static void FreeOldCacheDirectory(const fml::UniqueFD& cache_base_dir) {
   });
 }
 
+static fml::UniqueFD OpenCacheBaseDirectory(
+    const std::string& global_cache_base_path) {
+  if (global_cache_base_path.length()) {
+    return fml::OpenDirectory(global_cache_base_path.c_str(), false,
+                              fml::FilePermission::kRead);
+  }
+  return fml::paths::GetCachesDirectory();
+}
+
 static std::shared_ptr<fml::UniqueFD> MakeCacheDirectory(
     const std::string& global_cache_base_path,
     bool read_only,
     bool cache_sksl) {
-  fml::UniqueFD cache_base_dir;
-  if (global_cache_base_path.length()) {
-    cache_base_dir = fml::OpenDirectory(global_cache_base_path.c_str(), false,
-                                        fml::FilePermission::kRead);
-  } else {
-    cache_base_dir = fml::paths::GetCachesDirectory();
-  }
+  fml::UniqueFD cache_base_dir = OpenCacheBaseDirectory(global_cache_base_path);
 
   if (cache_base_dir.is_valid()) {
     FreeOldCacheDirectory(cache_base_dir);
@@ -158,6 +174,19 @@ static std::shared_ptr<fml::UniqueFD> MakeCacheDirectory(
 }
 }  // namespace
 
+fml::UniqueFD PersistentCache::MakeImpellerCacheDirectory() {
+  fml::UniqueFD cache_base_dir = OpenCacheBaseDirectory(cache_base_path_);
+  if (!cache_base_dir.is_valid()) {
+    return {};
+  }
+  FreeOldCacheDirectory(cache_base_dir);
+  std::vector<std::string> components = {
+      kEngineComponent, GetFlutterEngineVersion(), "impeller"};
+  return CreateDirectory(cache_base_dir, components,
+                         gIsReadOnly ? fml::FilePermission::kRead
+                                     : fml::FilePermission::kReadWrite);
+}
+
 sk_sp<SkData> ParseBase32(const std::string& input) {
   std::pair<bool, std::string> decode_result = fml::Base32Decode(input);
   if (!decode_result.first) {
@@ -235,7 +264,11 @@ std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
   // Only visit sksl_cache_directory_ if this persistent cache is valid.
   // However, we'd like to continue visit the asset dir even if this persistent
   // cache is invalid.
-  if (IsValid()) {
+  if (packed_sksl_cache_) {
+    for (auto& entry : packed_sksl_cache_->GetEntries()) {
+      result.push_back({std::move(entry.key), std::move(entry.value)});
+    }
+  } else if (IsValid()) {
     // In case `rewinddir` doesn't work reliably, load SkSLs from a freshly
     // opened directory (https://github.com/flutter/flutter/issues/65258).
     fml::UniqueFD fresh_dir =
@@ -275,11 +308,29 @@ std::vector<PersistentCache::SkSLCache> PersistentCache::LoadSkSLs() const {
   return result;
 }
 
+static std::shared_ptr<PackedCacheFile> MakePackedCacheFile(
+    const std::shared_ptr<fml::UniqueFD>& directory,
+    bool read_only) {
+  if (!directory || !directory->is_valid()) {
+    return nullptr;
+  }
+  return std::make_shared<PackedCacheFile>(
+      directory, PersistentCache::kPackedCacheFileName, read_only,
+      /*compress=*/true);
+}
+
 PersistentCache::PersistentCache(bool read_only)
     : is_read_only_(read_only),
       cache_directory_(MakeCacheDirectory(cache_base_path_, read_only, false)),
       sksl_cache_directory_(
-          MakeCacheDirectory(cache_base_path_, read_only, true)) {
+          MakeCacheDirectory(cache_base_path_, read_only, true)),
+      packed_cache_(use_packed_cache_
+                        ? MakePackedCacheFile(cache_directory_, read_only)
+                        : nullptr),
+      packed_sksl_cache_(
+          use_packed_cache_
+              ? MakePackedCacheFile(sksl_cache_directory_, read_only)
+              : nullptr) {
   if (!IsValid()) {
     FML_LOG(WARNING) << "Could not acquire the persistent cache directory. "
                         "Caching of GPU resources on disk is disabled.";
@@ -332,12 +383,17 @@ sk_sp<SkData> PersistentCache::load(const SkData& key) {
   if (!IsValid()) {
     return nullptr;
   }
-  auto file_name = SkKeyToFilePath(key);
-  if (file_name.empty()) {
-    return nullptr;
+  sk_sp<SkData> result;
+  if (packed_cache_) {
+    result = packed_cache_->Get(key);
+  } else {
+    auto file_name = SkKeyToFilePath(key);
+    if (file_name.empty()) {
+      return nullptr;
+    }
+    result =
+        PersistentCache::LoadFile(*cache_directory_, file_name, false).value;
   }
-  auto result =
-      PersistentCache::LoadFile(*cache_directory_, file_name, false).value;
   if (result != nullptr) {
     TRACE_EVENT0("flutter", "PersistentCacheLoadHit");
   }
@@ -349,20 +405,43 @@ static void PersistentCacheStore(
     const std::shared_ptr<fml::UniqueFD>& cache_directory,
     std::string key,
     std::unique_ptr<fml::Mapping> value) {
-  // The static leak checker gets confused by the use of fml::MakeCopyable.
-  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
-  auto task = fml::MakeCopyable([cache_directory,             //
-                                 file_name = std::move(key),  //
-                                 mapping = std::move(value)   //
-  ]() mutable {
+  if (!worker) {
+    FML_LOG(WARNING)
+        << "The persistent cache has no available workers. Performing the task "
+           "on the current thread. This slow operation is going to occur on a "
+           "frame workload.";
     TRACE_EVENT0("flutter", "PersistentCacheStore");
-    if (!fml::WriteAtomically(*cache_directory,   //
-                              file_name.c_str(),  //
-                              *mapping)           //
-    ) {
+    if (!fml::WriteAtomically(*cache_directory, key.c_str(), *value)) {
       FML_LOG(WARNING) << "Could not write cache contents to persistent store.";
     }
-  });
+    return;
+  }
+
+  fml::WriteAtomicallyAsync(
+      worker.get(), cache_directory, std::move(key), std::move(value),
+      [](bool success) {
+        if (!success) {
+          FML_LOG(WARNING)
+              << "Could not write cache contents to persistent store.";
+        }
+      });
+}
+
+static void PersistentCachePackedStore(
+    const fml::RefPtr<fml::TaskRunner>& worker,
+    const std::shared_ptr<PackedCacheFile>& packed_cache,
+    const SkData& key,
+    const SkData& value) {
+  // The entry can be loaded right away, only writing the file is deferred.
+  packed_cache->Put(key, value);
+  // Stores that happen before the worker gets to the task are persisted by
+  // the same append.
+  auto task = [packed_cache]() {
+    TRACE_EVENT0("flutter", "PersistentCacheStore");
+    if (!packed_cache->Persist()) {
+      FML_LOG(WARNING) << "Could not write cache contents to persistent store.";
+    }
+  };
 
   if (!worker) {
     FML_LOG(WARNING)
@@ -407,6 +486,12 @@ void PersistentCache::store(const SkData& key, const SkData& data) {
     return;
   }
 
+  const auto& packed_cache = cache_sksl_ ? packed_sksl_cache_ : packed_cache_;
+  if (packed_cache) {
+    PersistentCachePackedStore(GetWorkerTaskRunner(), packed_cache, key, data);
+    return;
+  }
+
   auto file_name = SkKeyToFilePath(key);
 
   if (file_name.empty()) {
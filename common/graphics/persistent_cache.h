@@ -10,6 +10,7 @@
 #include <set>
 
 #include "flutter/assets/asset_manager.h"
+#include "flutter/common/graphics/packed_cache_file.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_runner.h"
 #include "flutter/fml/unique_fd.h"
@@ -41,6 +42,18 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   // affect the cache directory returned by |GetCacheForProcess|.
   static void SetCacheDirectoryPath(std::string path);
 
+  // Store all the entries of each cache directory in a single packed file
+  // instead of a file per entry. This must be called before
+  // |GetCacheForProcess|. Otherwise, it won't affect the cache returned by
+  // |GetCacheForProcess|.
+  static void SetUsePackedCache(bool value);
+
+  // Open the directory that the Impeller backends persist their pipeline
+  // caches in, creating it if necessary. The directory is picked the same way
+  // as the Skia cache directory, so it follows |SetCacheDirectoryPath| and is
+  // discarded when the engine version changes.
+  static fml::UniqueFD MakeImpellerCacheDirectory();
+
   // Convert a binary SkData key into a Base32 encoded string.
   //
   // This is used to specify persistent cache filenames and service protocol
@@ -129,10 +142,13 @@ class PersistentCache : public GrContextOptions::PersistentCache {
 
   static constexpr char kSkSLSubdirName[] = "sksl";
   static constexpr char kAssetFileName[] = "io.flutter.shaders.json";
+  static constexpr char kPackedCacheFileName[] = "io.flutter.cache.pack";
 
  private:
   static std::string cache_base_path_;
 
+  static bool use_packed_cache_;
+
   static std::shared_ptr<AssetManager> asset_manager_;
 
   static std::mutex instance_mutex_;
@@ -151,6 +167,9 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   const bool is_read_only_;
   const std::shared_ptr<fml::UniqueFD> cache_directory_;
   const std::shared_ptr<fml::UniqueFD> sksl_cache_directory_;
+  // Only set if the cache uses packed files.
+  const std::shared_ptr<PackedCacheFile> packed_cache_;
+  const std::shared_ptr<PackedCacheFile> packed_sksl_cache_;
   mutable std::mutex worker_task_runners_mutex_;
   std::multiset<fml::RefPtr<fml::TaskRunner>> worker_task_runners_;
 
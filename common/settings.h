@@ -50,6 +50,10 @@ class FrameTiming {
   uint64_t GetLayerCacheBytes() const { return layer_cache_bytes_; }
   uint64_t GetPictureCacheCount() const { return picture_cache_count_; }
   uint64_t GetPictureCacheBytes() const { return picture_cache_bytes_; }
+  fml::TimeDelta GetRasterGPUTime() const { return raster_gpu_time_; }
+  void SetRasterGPUTime(fml::TimeDelta raster_gpu_time) {
+    raster_gpu_time_ = raster_gpu_time;
+  }
   void SetRasterCacheStatistics(size_t layer_cache_count,
                                 size_t layer_cache_bytes,
                                 size_t picture_cache_count,
@@ -67,6 +71,7 @@ class FrameTiming {
   size_t layer_cache_bytes_;
   size_t picture_cache_count_;
   size_t picture_cache_bytes_;
+  fml::TimeDelta raster_gpu_time_;
 };
 
 using TaskObserverAdd =
@@ -107,6 +112,22 @@ struct Settings {
   std::string isolate_snapshot_instr_path;  // deprecated
   MappingCallback isolate_snapshot_instr;
 
+  // Path to a profile of the snapshot pages that are used during startup. If
+  // the profile exists, those pages are prefetched when the VM is created.
+  // Otherwise, the profile is recorded after the first frame is rasterized.
+  std::string snapshot_prefetch_profile_path;
+
+  // Path to a profile of the assets that are loaded during startup. If the
+  // profile exists, those assets are prefetched once the asset manager is
+  // configured. Otherwise, the profile is recorded after the first frame is
+  // rasterized.
+  std::string asset_prefetch_profile_path;
+
+  // Path to a file that persists the fallback fonts found by the platform font
+  // manager, so that later launches can try them before scanning the platform
+  // fonts again. Disabled when empty.
+  std::string font_fallback_cache_path;
+
   std::string route;
 
   // Returns the Mapping to a kernel buffer which contains sources for dart:*
@@ -140,6 +161,9 @@ struct Settings {
   bool dump_skp_on_shader_compilation = false;
   bool cache_sksl = false;
   bool purge_persistent_cache = false;
+  // Store the persistent cache in a single packed file per cache directory
+  // instead of a file per entry.
+  bool packed_persistent_cache = false;
   bool endless_trace_buffer = false;
   bool enable_dart_profiling = false;
   bool disable_dart_asserts = false;
@@ -187,6 +211,12 @@ struct Settings {
   // after failing to bind to a specified port.
   bool enable_service_port_fallback = false;
 
+  // Whether to defer the startup of the Dart VM service until the first frame
+  // has been rasterized, or at most a few seconds, so that it doesn't add to
+  // the time to first frame of debug and profile builds. The deferred startup
+  // runs at background priority. Ignored when |start_paused| is set.
+  bool defer_vm_service_startup = false;
+
   // Font settings
   bool use_test_fonts = false;
 
@@ -278,6 +308,10 @@ struct Settings {
   fml::UniqueFD::element_type assets_dir =
       fml::UniqueFD::traits_type::InvalidValue();
   std::string assets_path;
+  // Whether the asset manager remembers which resolver has each asset, and
+  // which assets are missing, instead of probing every resolver for each
+  // lookup. Must not be used with assets that change while the app runs.
+  bool enable_asset_lookup_index = false;
 
   // Callback to handle the timings of a rasterized frame. This is called as
   // soon as a frame is rasterized.
@@ -301,6 +335,87 @@ struct Settings {
   // Max bytes threshold of resource cache, or 0 for unlimited.
   size_t resource_cache_max_bytes_threshold = 0;
 
+  // The number of frames of an animated image that are decoded ahead of the
+  // frame that is shown, or 0 to decode frames only when they are requested.
+  size_t animated_image_decode_ahead_frame_count = 2;
+
+  // The bytes that the frames decoded ahead of all animated images may take
+  // up. Those bytes are taken out of the resource cache max bytes threshold.
+  size_t animated_image_decode_ahead_byte_budget = 16 * 1024 * 1024;
+
+  // Whether the raster cache keeps entries through frames that do not use
+  // them, evicting the least recently used ones when its images exceed the
+  // resource cache limit. Otherwise entries are evicted by the first frame
+  // that does not use them.
+  bool raster_cache_lru_eviction = false;
+
+  // Whether the raster cache converts the images of opaque entries that have
+  // been kept for a while to RGB565, which halves the memory they take up at
+  // the cost of color precision.
+  bool raster_cache_compression = false;
+
+  // Whether the raster cache rasterizes DisplayList entries on the
+  // concurrent worker threads instead of stalling the frame that first
+  // caches them. Those frames draw the DisplayList until the entry is ready.
+  bool raster_cache_background_rasterization = false;
+
+  // Experimental. Whether the background rasterization of the raster cache
+  // records SkDeferredDisplayLists on the worker threads and replays them
+  // into GPU surfaces on the raster thread, instead of rasterizing on the
+  // CPU. Has no effect unless |raster_cache_background_rasterization| is set.
+  bool raster_cache_deferred_display_lists = false;
+
+  // The number of bytes of GPU textures that the images created by
+  // Picture.toImageSync may take up before the framework is notified of
+  // memory pressure. 0 disables the notification.
+  size_t snapshot_texture_budget_bytes = 0;
+
+  // Whether the animator replaces the oldest frame that is still waiting to
+  // be rasterized when the rasterizer falls behind, instead of skipping the
+  // vsync. This trades dropped frames for lower latency.
+  bool drop_stale_frames = false;
+
+  // Whether the animator predicts frame build durations from the recent
+  // frames, starting the builds that are predicted to miss their vsync right
+  // away and giving the Dart VM idle deadlines at the predicted next vsync.
+  bool predictive_frame_scheduling = false;
+
+  // Whether the packets of moves, hovers and pan/zoom updates that arrive
+  // while the pointer data of the current frame is still being handled are
+  // coalesced into a single packet dispatched at the next vsync. All the
+  // pointer data is kept, in order.
+  bool coalesce_pointer_data = false;
+
+  // The number of frames that may wait to be presented on a dedicated present
+  // thread while the raster thread moves on to the next frame. Only surfaces
+  // that can present off the raster thread make use of it. 0 presents every
+  // frame on the raster thread.
+  size_t max_pending_presents = 0;
+
+  // The bit masks of the CPUs the UI, raster and IO threads may run on, where
+  // bit N stands for CPU N. This allows pinning the UI and raster threads to
+  // the big cores of big.LITTLE SoCs. 0 lets the thread run on any CPU. Only
+  // the threads created by the engine are pinned.
+  uint64_t ui_thread_cpu_affinity = 0;
+  uint64_t raster_thread_cpu_affinity = 0;
+  uint64_t io_thread_cpu_affinity = 0;
+
+  // Whether the engines spawned from an engine render with the Impeller
+  // pipelines and glyph atlas of that engine instead of their own. The
+  // spawned engines already share its rendering context and raster thread,
+  // which is what makes sharing those safe.
+  bool spawned_engines_share_rendering_resources = false;
+
+  // Whether the Metal surfaces on iOS acquire the drawable of their
+  // CAMetalLayer only once the frame has been recorded, and present it from
+  // the command buffer instead of waiting for the GPU work to be scheduled.
+  // This shortens the time the drawables are held for.
+  bool defer_metal_drawable_acquisition = false;
+
+  // The maximum number of drawables of the CAMetalLayers on iOS. Must be 2 or
+  // 3. Setting this value to 0 keeps the system default, which is 3.
+  size_t metal_maximum_drawable_count = 0;
+
   /// The minimum number of samples to require in multipsampled anti-aliasing.
   ///
   /// Setting this value to 0 or 1 disables MSAA.
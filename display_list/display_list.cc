@@ -7,6 +7,7 @@
 #include "flutter/display_list/display_list.h"
 #include "flutter/display_list/display_list_canvas_dispatcher.h"
 #include "flutter/display_list/display_list_ops.h"
+#include "flutter/display_list/display_list_skia_object_cache.h"
 #include "flutter/display_list/display_list_utils.h"
 #include "flutter/fml/trace_event.h"
 
@@ -17,10 +18,12 @@ const SaveLayerOptions SaveLayerOptions::kWithAttributes =
     kNoAttributes.with_renders_with_attributes();
 
 DisplayList::DisplayList()
-    : byte_count_(0),
+    : storage_capacity_(0),
+      byte_count_(0),
       op_count_(0),
       nested_byte_count_(0),
       nested_op_count_(0),
+      content_hash_(0),
       unique_id_(0),
       bounds_({0, 0, 0, 0}),
       bounds_cull_({0, 0, 0, 0}),
@@ -31,13 +34,19 @@ DisplayList::DisplayList(uint8_t* ptr,
                          unsigned int op_count,
                          size_t nested_byte_count,
                          unsigned int nested_op_count,
+                         uint64_t content_hash,
                          const SkRect& cull_rect,
-                         bool can_apply_group_opacity)
+                         bool can_apply_group_opacity,
+                         std::shared_ptr<DisplayListStoragePool> storage_pool,
+                         size_t storage_capacity)
     : storage_(ptr),
+      storage_pool_(std::move(storage_pool)),
+      storage_capacity_(storage_capacity),
       byte_count_(byte_count),
       op_count_(op_count),
       nested_byte_count_(nested_byte_count),
       nested_op_count_(nested_op_count),
+      content_hash_(content_hash),
       bounds_({0, 0, -1, -1}),
       bounds_cull_(cull_rect),
       can_apply_group_opacity_(can_apply_group_opacity) {
@@ -50,6 +59,9 @@ DisplayList::DisplayList(uint8_t* ptr,
 DisplayList::~DisplayList() {
   uint8_t* ptr = storage_.get();
   DisposeOps(ptr, ptr + byte_count_);
+  if (storage_pool_) {
+    storage_pool_->Recycle(storage_.release(), storage_capacity_);
+  }
 }
 
 void DisplayList::ComputeBounds() {
@@ -196,7 +208,10 @@ void DisplayList::RenderTo(DisplayListBuilder* builder,
 }
 
 void DisplayList::RenderTo(SkCanvas* canvas, SkScalar opacity) const {
-  DisplayListCanvasDispatcher dispatcher(canvas, opacity);
+  std::call_once(skia_objects_once_, [this] {
+    skia_objects_ = std::make_unique<DlSkiaObjectCache>();
+  });
+  DisplayListCanvasDispatcher dispatcher(canvas, opacity, skia_objects_.get());
   Dispatch(dispatcher);
 }
 
@@ -204,7 +219,8 @@ bool DisplayList::Equals(const DisplayList* other) const {
   if (this == other) {
     return true;
   }
-  if (byte_count_ != other->byte_count_ || op_count_ != other->op_count_) {
+  if (byte_count_ != other->byte_count_ || op_count_ != other->op_count_ ||
+      content_hash_ != other->content_hash_) {
     return false;
   }
   uint8_t* ptr = storage_.get();
@@ -6,10 +6,12 @@
 #define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_H_
 
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include "flutter/display_list/display_list_rtree.h"
 #include "flutter/display_list/display_list_sampling_options.h"
+#include "flutter/display_list/display_list_storage_pool.h"
 #include "flutter/display_list/types.h"
 #include "flutter/fml/logging.h"
 
@@ -164,6 +166,7 @@ enum class DisplayListOpType { FOR_EACH_DISPLAY_LIST_OP(DL_OP_TO_ENUM_VALUE) };
 
 class Dispatcher;
 class DisplayListBuilder;
+class DlSkiaObjectCache;
 
 class SaveLayerOptions {
  public:
@@ -248,6 +251,14 @@ class DisplayList : public SkRefCnt {
 
   uint32_t unique_id() const { return unique_id_; }
 
+  // A hash of the ops, including those of nested DisplayLists, that is
+  // computed while the DisplayList is recorded. DisplayLists that are
+  // |Equals()| always have the same hash, so lists with different hashes
+  // can be told apart without comparing their ops.
+  uint64_t content_hash() const { return content_hash_; }
+
+  const SkRect& cull_rect() const { return bounds_cull_; }
+
   const SkRect& bounds() {
     if (bounds_.width() < 0.0) {
       // ComputeBounds() will leave the variable with a
@@ -257,10 +268,10 @@ class DisplayList : public SkRefCnt {
     return bounds_;
   }
 
+  // The RTree is only needed when the DisplayList is culled, so it is not
+  // built until it is first requested, on whichever thread requests it.
   sk_sp<const DlRTree> rtree() {
-    if (!rtree_) {
-      ComputeRTree();
-    }
+    std::call_once(rtree_once_, [this] { ComputeRTree(); });
     return rtree_;
   }
 
@@ -280,22 +291,36 @@ class DisplayList : public SkRefCnt {
               unsigned int op_count,
               size_t nested_byte_count,
               unsigned int nested_op_count,
+              uint64_t content_hash,
               const SkRect& cull_rect,
-              bool can_apply_group_opacity);
+              bool can_apply_group_opacity,
+              std::shared_ptr<DisplayListStoragePool> storage_pool = nullptr,
+              size_t storage_capacity = 0);
 
   struct SkFreeDeleter {
     void operator()(uint8_t* p) { sk_free(p); }
   };
   std::unique_ptr<uint8_t, SkFreeDeleter> storage_;
+  // The pool the storage is returned to, if it was obtained from one.
+  std::shared_ptr<DisplayListStoragePool> storage_pool_;
+  size_t storage_capacity_;
   size_t byte_count_;
   unsigned int op_count_;
 
   size_t nested_byte_count_;
   unsigned int nested_op_count_;
 
+  uint64_t content_hash_;
+
   uint32_t unique_id_;
   SkRect bounds_;
   sk_sp<const DlRTree> rtree_;
+  std::once_flag rtree_once_;
+
+  // The Skia objects of the attributes, which are reused every time the
+  // DisplayList is rendered to an SkCanvas. Created by the first render.
+  mutable std::unique_ptr<DlSkiaObjectCache> skia_objects_;
+  mutable std::once_flag skia_objects_once_;
 
   // Only used for drawPaint() and drawColor()
   SkRect bounds_cull_;
@@ -3,7 +3,11 @@
 // found in the LICENSE file.
 
 #include "flutter/display_list/display_list_benchmarks.h"
+
+#include <cmath>
+
 #include "flutter/display_list/display_list_builder.h"
+#include "flutter/display_list/display_list_color_filter.h"
 #include "flutter/display_list/display_list_flags.h"
 
 #include "third_party/skia/include/core/SkPoint.h"
@@ -25,6 +29,10 @@ std::unique_ptr<CanvasProvider> CreateCanvasProvider(BackendType backend_type) {
 #ifdef ENABLE_METAL_BENCHMARKS
     case kMetal_Backend:
       return std::make_unique<MetalCanvasProvider>();
+#endif
+#ifdef ENABLE_VULKAN_BENCHMARKS
+    case kVulkan_Backend:
+      return std::make_unique<VulkanCanvasProvider>();
 #endif
     default:
       return nullptr;
@@ -1328,5 +1336,87 @@ void BM_SaveLayer(benchmark::State& state,
   canvas_provider->Snapshot(filename);
 }
 
+// Draws N cards of two overlapping rects each and fades every card, either
+// by folding the alpha into the draw calls of the card or by drawing the
+// card into a saveLayer that applies the alpha, as an OpacityLayer does when
+// its children cannot inherit the opacity.
+//
+// The cards are laid out on a grid so that they do not overlap each other.
+void BM_DrawFade(benchmark::State& state,
+                 BackendType backend_type,
+                 unsigned attributes,
+                 FadeMode mode) {
+  auto canvas_provider = CreateCanvasProvider(backend_type);
+  DisplayListBuilder builder;
+  builder.setAttributesFromPaint(GetPaintForRun(attributes),
+                                 DisplayListOpFlags::kDrawRectFlags);
+  AnnotateAttributes(attributes, state, DisplayListOpFlags::kDrawRectFlags);
+
+  size_t length = kFixedCanvasSize;
+  canvas_provider->InitializeSurface(length, length);
+  auto canvas = canvas_provider->GetSurface()->getCanvas();
+
+  size_t card_count = state.range(0);
+  size_t columns = std::ceil(std::sqrt(card_count));
+  SkScalar card_size = static_cast<SkScalar>(length) / columns;
+  SkRect card_bounds = SkRect::MakeWH(card_size, card_size);
+  SkRect rect1 = SkRect::MakeWH(0.75f * card_size, 0.75f * card_size);
+  SkRect rect2 = SkRect::MakeLTRB(0.25f * card_size, 0.25f * card_size,
+                                  card_size, card_size);
+
+  DlColor fade_color = DlColor::kBlack().withAlpha(0x7F);
+  DlBlendColorFilter color_filter(DlColor::kRed(), DlBlendMode::kModulate);
+
+  state.counters["DrawCallCount_Varies"] = card_count * 2;
+  for (size_t i = 0; i < card_count; i++) {
+    builder.save();
+    builder.translate((i % columns) * card_size, (i / columns) * card_size);
+    builder.setColor(fade_color);
+    if (mode == FadeMode::kInherited) {
+      builder.drawRect(rect1);
+      builder.drawRect(rect2);
+    } else {
+      if (mode == FadeMode::kColorFilterSaveLayer) {
+        builder.setColorFilter(&color_filter);
+      }
+      builder.saveLayer(&card_bounds, true);
+      builder.setColor(DlColor::kBlack());
+      builder.setColorFilter(nullptr);
+      builder.drawRect(rect1);
+      builder.drawRect(rect2);
+      builder.restore();
+    }
+    builder.restore();
+  }
+  auto display_list = builder.Build();
+
+  // We only want to time the actual rasterization.
+  for ([[maybe_unused]] auto _ : state) {
+    display_list->RenderTo(canvas);
+    canvas_provider->GetSurface()->flushAndSubmit(true);
+  }
+
+  auto filename = canvas_provider->BackendName() + "-Fade-" +
+                  std::to_string(static_cast<int>(mode)) + "-" +
+                  std::to_string(card_count) + ".png";
+  canvas_provider->Snapshot(filename);
+}
+
+#ifdef ENABLE_SOFTWARE_BENCHMARKS
+RUN_DISPLAYLIST_BENCHMARKS(Software)
+#endif
+
+#ifdef ENABLE_OPENGL_BENCHMARKS
+RUN_DISPLAYLIST_BENCHMARKS(OpenGL)
+#endif
+
+#ifdef ENABLE_METAL_BENCHMARKS
+RUN_DISPLAYLIST_BENCHMARKS(Metal)
+#endif
+
+#ifdef ENABLE_VULKAN_BENCHMARKS
+RUN_DISPLAYLIST_BENCHMARKS(Vulkan)
+#endif
+
 }  // namespace testing
 }  // namespace flutter
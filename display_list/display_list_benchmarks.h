@@ -26,10 +26,19 @@
 #include "flutter/display_list/display_list_benchmarks_metal.h"
 #endif
 
+#ifdef ENABLE_VULKAN_BENCHMARKS
+#include "flutter/display_list/display_list_benchmarks_vulkan.h"
+#endif
+
 namespace flutter {
 namespace testing {
 
-typedef enum { kSoftware_Backend, kOpenGL_Backend, kMetal_Backend } BackendType;
+typedef enum {
+  kSoftware_Backend,
+  kOpenGL_Backend,
+  kMetal_Backend,
+  kVulkan_Backend,
+} BackendType;
 
 enum BenchmarkAttributes {
   kEmpty_Flag = 0,
@@ -107,6 +116,22 @@ void BM_SaveLayer(benchmark::State& state,
                   BackendType backend_type,
                   unsigned attributes,
                   size_t save_depth);
+
+// The ways in which a group of overlapping draws can be faded.
+enum class FadeMode {
+  // The alpha is folded into every draw call of the group.
+  kInherited,
+  // The group is drawn into a saveLayer that applies the alpha.
+  kSaveLayer,
+  // The group is drawn into a saveLayer that applies the alpha and a
+  // color filter.
+  kColorFilterSaveLayer,
+};
+
+void BM_DrawFade(benchmark::State& state,
+                 BackendType backend_type,
+                 unsigned attributes,
+                 FadeMode mode);
 // clang-format off
 
 // DrawLine
@@ -544,6 +569,35 @@ void BM_SaveLayer(benchmark::State& state,
       ->UseRealTime()                                                   \
       ->Unit(benchmark::kMillisecond);
 
+// Fades
+#define DRAW_FADE_BENCHMARKS(BACKEND, ATTRIBUTES)                       \
+  BENCHMARK_CAPTURE(BM_DrawFade, Inherited/BACKEND,                     \
+                    BackendType::k##BACKEND##_Backend,                  \
+                    ATTRIBUTES,                                         \
+                    FadeMode::kInherited)                               \
+      ->RangeMultiplier(2)                                              \
+      ->Range(1, 256)                                                   \
+      ->UseRealTime()                                                   \
+      ->Unit(benchmark::kMillisecond);                                  \
+                                                                        \
+  BENCHMARK_CAPTURE(BM_DrawFade, SaveLayer/BACKEND,                     \
+                    BackendType::k##BACKEND##_Backend,                  \
+                    ATTRIBUTES,                                         \
+                    FadeMode::kSaveLayer)                               \
+      ->RangeMultiplier(2)                                              \
+      ->Range(1, 256)                                                   \
+      ->UseRealTime()                                                   \
+      ->Unit(benchmark::kMillisecond);                                  \
+                                                                        \
+  BENCHMARK_CAPTURE(BM_DrawFade, ColorFilterSaveLayer/BACKEND,          \
+                    BackendType::k##BACKEND##_Backend,                  \
+                    ATTRIBUTES,                                         \
+                    FadeMode::kColorFilterSaveLayer)                    \
+      ->RangeMultiplier(2)                                              \
+      ->Range(1, 256)                                                   \
+      ->UseRealTime()                                                   \
+      ->Unit(benchmark::kMillisecond);
+
 // Applies stroke style and antialiasing
 #define STROKE_BENCHMARKS(BACKEND, ATTRIBUTES)                           \
   DRAW_LINE_BENCHMARKS(BACKEND, ATTRIBUTES)                              \
@@ -578,7 +632,8 @@ void BM_SaveLayer(benchmark::State& state,
   DRAW_IMAGE_NINE_BENCHMARKS(BACKEND, ATTRIBUTES)                        \
   DRAW_VERTICES_BENCHMARKS(BACKEND, ATTRIBUTES)                          \
   DRAW_SHADOW_BENCHMARKS(BACKEND, ATTRIBUTES)                            \
-  SAVE_LAYER_BENCHMARKS(BACKEND, ATTRIBUTES)
+  SAVE_LAYER_BENCHMARKS(BACKEND, ATTRIBUTES)                             \
+  DRAW_FADE_BENCHMARKS(BACKEND, ATTRIBUTES)
 
 #define RUN_DISPLAYLIST_BENCHMARKS(BACKEND)                              \
   STROKE_BENCHMARKS(BACKEND, kStrokedStyle_Flag)                         \
@@ -3,7 +3,6 @@
 // found in the LICENSE file.
 
 #include "flutter/display_list/display_list_benchmarks_gl.h"
-#include "flutter/display_list/display_list_benchmarks.h"
 
 #include "third_party/skia/include/core/SkCanvas.h"
 
@@ -45,7 +44,5 @@ sk_sp<SkSurface> OpenGLCanvasProvider::MakeOffscreenSurface(
   return offscreen_surface;
 }
 
-RUN_DISPLAYLIST_BENCHMARKS(OpenGL)
-
 }  // namespace testing
 }  // namespace flutter
@@ -3,7 +3,6 @@
 // found in the LICENSE file.
 
 #include "flutter/display_list/display_list_benchmarks_metal.h"
-#include "flutter/display_list/display_list_benchmarks.h"
 
 #include "third_party/skia/include/core/SkCanvas.h"
 
@@ -33,7 +32,5 @@ sk_sp<SkSurface> MetalCanvasProvider::MakeOffscreenSurface(
   return metal_offscreen_surface_->GetSurface();
 }
 
-RUN_DISPLAYLIST_BENCHMARKS(Metal)
-
 }  // namespace testing
 }  // namespace flutter
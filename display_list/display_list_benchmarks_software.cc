@@ -3,7 +3,8 @@
 // found in the LICENSE file.
 
 #include "flutter/display_list/display_list_benchmarks_software.h"
-#include "flutter/display_list/display_list_benchmarks.h"
+
+#include "third_party/skia/include/core/SkCanvas.h"
 
 namespace flutter {
 namespace testing {
@@ -22,7 +23,5 @@ sk_sp<SkSurface> SoftwareCanvasProvider::MakeOffscreenSurface(
   return surface;
 }
 
-RUN_DISPLAYLIST_BENCHMARKS(Software)
-
 }  // namespace testing
 }  // namespace flutter
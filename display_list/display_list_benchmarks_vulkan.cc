@@ -0,0 +1,36 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_benchmarks_vulkan.h"
+
+#include "third_party/skia/include/core/SkCanvas.h"
+
+namespace flutter {
+namespace testing {
+
+void VulkanCanvasProvider::InitializeSurface(const size_t width,
+                                             const size_t height) {
+  vulkan_context_ = fml::MakeRefCounted<TestVulkanContext>();
+  surface_ = MakeOffscreenSurface(width, height);
+}
+
+sk_sp<SkSurface> VulkanCanvasProvider::GetSurface() {
+  return surface_;
+}
+
+sk_sp<SkSurface> VulkanCanvasProvider::MakeOffscreenSurface(
+    const size_t width,
+    const size_t height) {
+  const auto image_info = SkImageInfo::MakeN32Premul(width, height);
+
+  auto offscreen_surface = SkSurface::MakeRenderTarget(
+      vulkan_context_->GetGrDirectContext().get(), SkBudgeted::kNo,
+      image_info, 1, kTopLeft_GrSurfaceOrigin, nullptr, false);
+
+  offscreen_surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+  return offscreen_surface;
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,34 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_DISPLAY_LIST_BENCHMARKS_VULKAN_H_
+#define FLUTTER_FLOW_DISPLAY_LIST_BENCHMARKS_VULKAN_H_
+
+#include "flutter/display_list/display_list_benchmarks_canvas_provider.h"
+#include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/testing/test_vulkan_context.h"
+
+namespace flutter {
+namespace testing {
+
+// Renders with Skia's Vulkan backend. The device is the SwiftShader ICD
+// if it is present and the system Vulkan driver otherwise.
+class VulkanCanvasProvider : public CanvasProvider {
+ public:
+  virtual ~VulkanCanvasProvider() = default;
+  void InitializeSurface(const size_t width, const size_t height) override;
+  sk_sp<SkSurface> GetSurface() override;
+  sk_sp<SkSurface> MakeOffscreenSurface(const size_t width,
+                                        const size_t height) override;
+  const std::string BackendName() override { return "Vulkan"; }
+
+ private:
+  fml::RefPtr<TestVulkanContext> vulkan_context_;
+  sk_sp<SkSurface> surface_;
+};
+
+}  // namespace testing
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_DISPLAY_LIST_BENCHMARKS_VULKAN_H_
@@ -25,18 +25,69 @@ static void CopyV(void* dst, const S* src, int n, Rest&&... rest) {
   CopyV(SkTAddOffset<void>(dst, n * sizeof(S)), std::forward<Rest>(rest)...);
 }
 
-template <typename T, typename... Args>
-void* DisplayListBuilder::Push(size_t pod, int op_inc, Args&&... args) {
-  size_t size = SkAlignPtr(sizeof(T) + pod);
-  FML_DCHECK(size < (1 << 24));
-  if (used_ + size > allocated_) {
+void DisplayListBuilder::GrowStorage(size_t required) {
+  if (!storage_pool_) {
     static_assert(SkIsPow2(DL_BUILDER_PAGE),
                   "This math needs updating for non-pow2.");
     // Next greater multiple of DL_BUILDER_PAGE.
-    allocated_ = (used_ + size + DL_BUILDER_PAGE) & ~(DL_BUILDER_PAGE - 1);
+    allocated_ = (required + DL_BUILDER_PAGE) & ~(DL_BUILDER_PAGE - 1);
     storage_.realloc(allocated_);
     FML_DCHECK(storage_.get());
     memset(storage_.get() + used_, 0, allocated_ - used_);
+    return;
+  }
+
+  // Blocks from the pool can't be reallocated in place, so the ops recorded
+  // so far are moved to a block of the next size class that fits.
+  size_t capacity;
+  uint8_t* block =
+      storage_pool_->Obtain(std::max(required, storage_hint_), &capacity);
+  if (used_ > 0) {
+    memcpy(block, storage_.get(), used_);
+  }
+  memset(block + used_, 0, capacity - used_);
+  storage_pool_->Recycle(storage_.release(), allocated_);
+  storage_ = SkAutoTMalloc<uint8_t>(block);
+  allocated_ = capacity;
+}
+
+void DisplayListBuilder::HashRecordedOps() {
+  if (hashed_ == used_) {
+    return;
+  }
+  uint8_t* ptr = storage_.get() + hashed_;
+  uint8_t* end = storage_.get() + used_;
+  while (ptr < end) {
+    auto op = reinterpret_cast<const DLOp*>(ptr);
+    uint64_t op_hash;
+    switch (op->type) {
+#define DL_OP_HASH(name)                                \
+  case DisplayListOpType::k##name:                      \
+    op_hash = static_cast<const name##Op*>(op)->hash(); \
+    break;
+
+      FOR_EACH_DISPLAY_LIST_OP(DL_OP_HASH)
+
+#undef DL_OP_HASH
+
+      default:
+        FML_DCHECK(false);
+        op_hash = 0;
+        break;
+    }
+    content_hash_ = DlHashCombine(content_hash_, op_hash);
+    ptr += op->size;
+  }
+  hashed_ = used_;
+}
+
+template <typename T, typename... Args>
+void* DisplayListBuilder::Push(size_t pod, int op_inc, Args&&... args) {
+  size_t size = SkAlignPtr(sizeof(T) + pod);
+  FML_DCHECK(size < (1 << 24));
+  HashRecordedOps();
+  if (used_ + size > allocated_) {
+    GrowStorage(used_ + size);
   }
   FML_DCHECK(used_ + size <= allocated_);
   auto op = reinterpret_cast<T*>(storage_.get() + used_);
@@ -52,21 +103,35 @@ sk_sp<DisplayList> DisplayListBuilder::Build() {
   while (layer_stack_.size() > 1) {
     restore();
   }
+  HashRecordedOps();
+  uint64_t hash = content_hash_;
+  content_hash_ = hashed_ = 0;
   size_t bytes = used_;
+  size_t capacity = allocated_;
   int count = op_count_;
   size_t nested_bytes = nested_bytes_;
   int nested_count = nested_op_count_;
   used_ = allocated_ = op_count_ = 0;
   nested_bytes_ = nested_op_count_ = 0;
-  storage_.realloc(bytes);
   bool compatible = layer_stack_.back().is_group_opacity_compatible();
+  if (storage_pool_) {
+    // The block keeps its size class so that it can be reused once the
+    // DisplayList is gone.
+    storage_hint_ = bytes;
+    return sk_sp<DisplayList>(new DisplayList(
+        storage_.release(), bytes, count, nested_bytes, nested_count, hash,
+        cull_rect_, compatible, storage_pool_, capacity));
+  }
+  storage_.realloc(bytes);
   return sk_sp<DisplayList>(new DisplayList(storage_.release(), bytes, count,
-                                            nested_bytes, nested_count,
+                                            nested_bytes, nested_count, hash,
                                             cull_rect_, compatible));
 }
 
-DisplayListBuilder::DisplayListBuilder(const SkRect& cull_rect)
-    : cull_rect_(cull_rect) {
+DisplayListBuilder::DisplayListBuilder(
+    const SkRect& cull_rect,
+    std::shared_ptr<DisplayListStoragePool> storage_pool)
+    : storage_pool_(std::move(storage_pool)), cull_rect_(cull_rect) {
   layer_stack_.emplace_back(SkM44(), cull_rect);
   current_layer_ = &layer_stack_.back();
 }
@@ -75,6 +140,9 @@ DisplayListBuilder::~DisplayListBuilder() {
   uint8_t* ptr = storage_.get();
   if (ptr) {
     DisplayList::DisposeOps(ptr, ptr + used_);
+    if (storage_pool_) {
+      storage_pool_->Recycle(storage_.release(), allocated_);
+    }
   }
 }
 
@@ -367,6 +435,29 @@ void DisplayListBuilder::setAttributesFromDlPaint(
   }
 }
 
+void DisplayListBuilder::setAttributes(const DlPaint& paint,
+                                       const sk_sp<SkBlender>& blender) {
+  setAntiAlias(paint.isAntiAlias());
+  setDither(paint.isDither());
+  setColor(paint.getColor().argb);
+  if (blender) {
+    setBlender(blender);
+  } else {
+    setBlendMode(paint.getBlendMode());
+  }
+  setStyle(paint.getDrawStyle());
+  setStrokeWidth(paint.getStrokeWidth());
+  setStrokeMiter(paint.getStrokeMiter());
+  setStrokeCap(paint.getStrokeCap());
+  setStrokeJoin(paint.getStrokeJoin());
+  setColorSource(paint.getColorSource().get());
+  setInvertColors(paint.isInvertColors());
+  setColorFilter(paint.getColorFilter().get());
+  setImageFilter(paint.getImageFilter().get());
+  setPathEffect(paint.getPathEffect().get());
+  setMaskFilter(paint.getMaskFilter().get());
+}
+
 void DisplayListBuilder::setAttributesFromPaint(
     const SkPaint& paint,
     const DisplayListAttributeFlags flags) {
@@ -1054,6 +1145,12 @@ void DisplayListBuilder::drawPicture(const sk_sp<SkPicture> picture,
 }
 void DisplayListBuilder::drawDisplayList(
     const sk_sp<DisplayList> display_list) {
+  if (max_inlined_op_count_ > 0 &&
+      display_list->op_count(true) <=
+          static_cast<unsigned int>(max_inlined_op_count_)) {
+    InlineDisplayList(*display_list);
+    return;
+  }
   Push<DrawDisplayListOp>(0, 1, display_list);
   // The non-nested op count accumulated in the |Push| method will include
   // this call to |drawDisplayList| for non-nested op count metrics.
@@ -1065,6 +1162,23 @@ void DisplayListBuilder::drawDisplayList(
   nested_bytes_ += display_list->bytes(true);
   UpdateLayerOpacityCompatibility(display_list->can_apply_group_opacity());
 }
+void DisplayListBuilder::InlineDisplayList(const DisplayList& display_list) {
+  // The nested ops were recorded against the default attributes and
+  // the current attributes are put back afterwards.
+  DlPaint attributes = current_;
+  sk_sp<SkBlender> blender = current_blender_;
+  setAttributes(DlPaint(), nullptr);
+  save();
+  display_list.Dispatch(*this);
+  // The nested ops inherit an opacity as a group, just like the op that
+  // would otherwise have been recorded.
+  current_layer_->cannot_inherit_opacity = false;
+  current_layer_->has_compatible_op = false;
+  UpdateLayerOpacityCompatibility(display_list.can_apply_group_opacity());
+  restore();
+  setAttributes(attributes, blender);
+  inlined_display_list_count_++;
+}
 void DisplayListBuilder::drawTextBlob(const sk_sp<SkTextBlob> blob,
                                       SkScalar x,
                                       SkScalar y) {
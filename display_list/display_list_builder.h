@@ -14,6 +14,7 @@
 #include "flutter/display_list/display_list_paint.h"
 #include "flutter/display_list/display_list_path_effect.h"
 #include "flutter/display_list/display_list_sampling_options.h"
+#include "flutter/display_list/display_list_storage_pool.h"
 #include "flutter/display_list/types.h"
 #include "flutter/fml/macros.h"
 
@@ -28,10 +29,26 @@ class DisplayListBuilder final : public virtual Dispatcher,
                                  public SkRefCnt,
                                  DisplayListOpFlags {
  public:
-  explicit DisplayListBuilder(const SkRect& cull_rect = kMaxCullRect_);
+  explicit DisplayListBuilder(
+      const SkRect& cull_rect = kMaxCullRect_,
+      std::shared_ptr<DisplayListStoragePool> storage_pool = nullptr);
 
   ~DisplayListBuilder();
 
+  // A reasonable threshold for |setMaxInlinedOpCount| when nesting many
+  // small pictures, below which inlining a nested DisplayList is cheaper
+  // than the save, restore and cull check of recursing into it.
+  static constexpr int kDefaultMaxInlinedOpCount = 8;
+
+  // Sets the op count below which |drawDisplayList| inlines nested
+  // DisplayLists. A value of 0, the default, disables inlining.
+  void setMaxInlinedOpCount(int op_count) { max_inlined_op_count_ = op_count; }
+  int getMaxInlinedOpCount() const { return max_inlined_op_count_; }
+
+  // The number of nested DisplayLists that have been inlined since the
+  // builder was created.
+  int getInlinedDisplayListCount() const { return inlined_display_list_count_; }
+
   void setAntiAlias(bool aa) override {
     if (current_.isAntiAlias() != aa) {
       onSetAntiAlias(aa);
@@ -330,6 +347,10 @@ class DisplayListBuilder final : public virtual Dispatcher,
   void drawPicture(const sk_sp<SkPicture> picture,
                    const SkMatrix* matrix,
                    bool render_with_attributes) override;
+  // Nested DisplayLists with no more than |getMaxInlinedOpCount()| ops,
+  // including their own nested ops, are dispatched directly into this
+  // builder rather than recorded as a single op that recurses when the
+  // list is rendered.
   void drawDisplayList(const sk_sp<DisplayList> display_list) override;
   void drawTextBlob(const sk_sp<SkTextBlob> blob,
                     SkScalar x,
@@ -354,10 +375,31 @@ class DisplayListBuilder final : public virtual Dispatcher,
   size_t allocated_ = 0;
   int op_count_ = 0;
 
+  // When set, storage is obtained from the pool in size classes instead of
+  // being reallocated, and the first block of each recording is sized to fit
+  // the previous recording.
+  std::shared_ptr<DisplayListStoragePool> storage_pool_;
+  size_t storage_hint_ = 0;
+
+  void GrowStorage(size_t required);
+
   // bytes and ops from |drawPicture| and |drawDisplayList|
   size_t nested_bytes_ = 0;
   int nested_op_count_ = 0;
 
+  int max_inlined_op_count_ = 0;
+  int inlined_display_list_count_ = 0;
+
+  void InlineDisplayList(const DisplayList& display_list);
+  void setAttributes(const DlPaint& paint, const sk_sp<SkBlender>& blender);
+
+  // The hash of the ops before |hashed_|. Ops are hashed once the next op
+  // is pushed, since the data that follows an op is written after Push.
+  uint64_t content_hash_ = 0;
+  size_t hashed_ = 0;
+
+  void HashRecordedOps();
+
   SkRect cull_rect_;
   static constexpr SkRect kMaxCullRect_ =
       SkRect::MakeLTRB(-1E9F, -1E9F, 1E9F, 1E9F);
@@ -62,8 +62,7 @@ void DisplayListCanvasDispatcher::saveLayer(const SkRect* bounds,
   } else {
     TRACE_EVENT0("flutter", "Canvas::saveLayer");
     const SkPaint* paint = safe_paint(options.renders_with_attributes());
-    const sk_sp<SkImageFilter> sk_backdrop =
-        backdrop ? backdrop->skia_object() : nullptr;
+    const sk_sp<SkImageFilter> sk_backdrop = skia_image_filter(backdrop);
     canvas_->saveLayer(
         SkCanvas::SaveLayerRec(bounds, paint, sk_backdrop.get(), 0));
     // saveLayer will apply the current opacity on behalf of the children
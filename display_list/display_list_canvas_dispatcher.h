@@ -22,9 +22,11 @@ namespace flutter {
 class DisplayListCanvasDispatcher : public virtual Dispatcher,
                                     public SkPaintDispatchHelper {
  public:
-  explicit DisplayListCanvasDispatcher(SkCanvas* canvas,
-                                       SkScalar opacity = SK_Scalar1)
-      : SkPaintDispatchHelper(opacity), canvas_(canvas) {}
+  explicit DisplayListCanvasDispatcher(
+      SkCanvas* canvas,
+      SkScalar opacity = SK_Scalar1,
+      DlSkiaObjectCache* skia_objects = nullptr)
+      : SkPaintDispatchHelper(opacity, skia_objects), canvas_(canvas) {}
 
   const SkPaint* safe_paint(bool use_attributes);
 
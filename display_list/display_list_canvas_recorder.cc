@@ -19,9 +19,12 @@ namespace flutter {
     }                                                                     \
   } while (0)
 
-DisplayListCanvasRecorder::DisplayListCanvasRecorder(const SkRect& bounds)
+DisplayListCanvasRecorder::DisplayListCanvasRecorder(
+    const SkRect& bounds,
+    std::shared_ptr<DisplayListStoragePool> storage_pool)
     : SkCanvasVirtualEnforcer(bounds.width(), bounds.height()),
-      builder_(sk_make_sp<DisplayListBuilder>(bounds)) {}
+      builder_(
+          sk_make_sp<DisplayListBuilder>(bounds, std::move(storage_pool))) {}
 
 sk_sp<DisplayList> DisplayListCanvasRecorder::Build() {
   CHECK_DISPOSE(nullptr);
@@ -26,7 +26,9 @@ class DisplayListCanvasRecorder
       public SkRefCnt,
       DisplayListOpFlags {
  public:
-  explicit DisplayListCanvasRecorder(const SkRect& bounds);
+  explicit DisplayListCanvasRecorder(
+      const SkRect& bounds,
+      std::shared_ptr<DisplayListStoragePool> storage_pool = nullptr);
 
   const sk_sp<DisplayListBuilder> builder() { return builder_; }
 
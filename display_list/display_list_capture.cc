@@ -0,0 +1,149 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_capture.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/display_list/display_list_image.h"
+#include "flutter/display_list/display_list_serialization.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+
+namespace {
+
+// "FDLC" in little endian byte order.
+constexpr uint32_t kMagic = 0x434c4446;
+
+// Placeholders larger than this are not allocated, so that a malformed
+// capture can't exhaust the memory of the replay.
+constexpr uint32_t kMaxImageDimension = 16384;
+
+struct Header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t frame_width;
+  uint32_t frame_height;
+  uint32_t image_count;
+};
+
+struct ImageEntry {
+  uint32_t id;
+  uint32_t width;
+  uint32_t height;
+  uint32_t opaque;
+};
+
+sk_sp<DlImage> MakePlaceholderImage(const ImageEntry& entry) {
+  if (entry.width == 0 || entry.height == 0 ||
+      entry.width > kMaxImageDimension || entry.height > kMaxImageDimension) {
+    return nullptr;
+  }
+  auto info = SkImageInfo::MakeN32(
+      entry.width, entry.height,
+      entry.opaque ? kOpaque_SkAlphaType : kPremul_SkAlphaType);
+  auto surface = SkSurface::MakeRaster(info);
+  if (!surface) {
+    return nullptr;
+  }
+  surface->getCanvas()->clear(entry.opaque ? SK_ColorGRAY : 0x80808080);
+  return DlImage::Make(surface->makeImageSnapshot());
+}
+
+}  // namespace
+
+std::unique_ptr<fml::Mapping> DisplayListCapture::Serialize(
+    const DisplayList& display_list,
+    const SkISize& frame_size) {
+  if (frame_size.isEmpty()) {
+    return nullptr;
+  }
+
+  // Images are identified by their index in the table.
+  std::vector<ImageEntry> images;
+  std::unordered_map<const DlImage*, uint32_t> ids;
+  auto image_to_id = [&images, &ids](const DlImage& image) -> uint64_t {
+    auto found = ids.find(&image);
+    if (found != ids.end()) {
+      return found->second;
+    }
+    uint32_t id = images.size();
+    SkISize dimensions = image.dimensions();
+    images.push_back({id, static_cast<uint32_t>(dimensions.width()),
+                      static_cast<uint32_t>(dimensions.height()),
+                      image.isOpaque() ? 1u : 0u});
+    ids[&image] = id;
+    return id;
+  };
+  auto display_list_data =
+      DisplayListSerializer::Serialize(display_list, image_to_id);
+  if (!display_list_data) {
+    return nullptr;
+  }
+
+  Header header = {kMagic, kVersion, static_cast<uint32_t>(frame_size.width()),
+                   static_cast<uint32_t>(frame_size.height()),
+                   static_cast<uint32_t>(images.size())};
+  size_t images_size = images.size() * sizeof(ImageEntry);
+  std::vector<uint8_t> data(sizeof(header) + images_size +
+                            display_list_data->GetSize());
+  memcpy(data.data(), &header, sizeof(header));
+  if (images_size > 0) {
+    memcpy(data.data() + sizeof(header), images.data(), images_size);
+  }
+  memcpy(data.data() + sizeof(header) + images_size,
+         display_list_data->GetMapping(), display_list_data->GetSize());
+  return std::make_unique<fml::DataMapping>(std::move(data));
+}
+
+sk_sp<DisplayList> DisplayListCapture::Deserialize(const fml::Mapping& mapping,
+                                                   SkISize* frame_size) {
+  const uint8_t* data = mapping.GetMapping();
+  size_t size = mapping.GetSize();
+  Header header;
+  if (data == nullptr || size < sizeof(header)) {
+    return nullptr;
+  }
+  memcpy(&header, data, sizeof(header));
+  if (header.magic != kMagic || header.version != kVersion ||
+      header.frame_width == 0 || header.frame_height == 0 ||
+      header.frame_width > kMaxImageDimension ||
+      header.frame_height > kMaxImageDimension) {
+    return nullptr;
+  }
+  size_t offset = sizeof(header);
+  if (header.image_count > (size - offset) / sizeof(ImageEntry)) {
+    return nullptr;
+  }
+
+  std::unordered_map<uint64_t, sk_sp<DlImage>> images;
+  for (uint32_t i = 0; i < header.image_count; i++) {
+    ImageEntry entry;
+    memcpy(&entry, data + offset, sizeof(entry));
+    offset += sizeof(entry);
+    auto image = MakePlaceholderImage(entry);
+    if (!image) {
+      return nullptr;
+    }
+    images[entry.id] = std::move(image);
+  }
+
+  fml::NonOwnedMapping display_list_data(data + offset, size - offset);
+  auto display_list = DisplayListSerializer::Deserialize(
+      display_list_data, [&images](uint64_t id) -> sk_sp<DlImage> {
+        auto found = images.find(id);
+        return found != images.end() ? found->second : nullptr;
+      });
+  if (display_list && frame_size) {
+    *frame_size = SkISize::Make(header.frame_width, header.frame_height);
+  }
+  return display_list;
+}
+
+}  // namespace flutter
@@ -0,0 +1,47 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_CAPTURE_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_CAPTURE_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/fml/mapping.h"
+#include "third_party/skia/include/core/SkSize.h"
+
+// A capture of a rendered frame that can be replayed offline, for example to
+// compare the cost of rasterizing it with different backends.
+//
+// A capture is the flattened DisplayList of the frame in the format of
+// |DisplayListSerializer|, preceded by the size of the frame and a table
+// with the dimensions and opacity of every image it draws. The pixels of the
+// images are not captured. They are replaced with placeholders of the same
+// size when the capture is read, which costs about the same to draw.
+
+namespace flutter {
+
+class DisplayListCapture {
+ public:
+  // The version of the format, which is stored in the header. Captures of
+  // other versions are rejected.
+  static constexpr uint32_t kVersion = 1;
+
+  // Returns the capture of a frame of |frame_size| pixels that was rendered
+  // from |display_list|, or nullptr if the DisplayList can't be serialized.
+  static std::unique_ptr<fml::Mapping> Serialize(
+      const DisplayList& display_list,
+      const SkISize& frame_size);
+
+  // Returns the DisplayList of the capture and stores the size of the frame
+  // in |frame_size|, or returns nullptr if the capture is malformed or of a
+  // different version.
+  static sk_sp<DisplayList> Deserialize(const fml::Mapping& mapping,
+                                        SkISize* frame_size);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_CAPTURE_H_
@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstring>
+#include <vector>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/display_list/display_list_capture.h"
+#include "flutter/display_list/display_list_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(DisplayListCapture, RoundTripsTheFrame) {
+  auto dl = GetSampleNestedDisplayList();
+  auto capture = DisplayListCapture::Serialize(*dl, SkISize::Make(800, 600));
+  ASSERT_NE(capture, nullptr);
+
+  SkISize frame_size;
+  auto copy = DisplayListCapture::Deserialize(*capture, &frame_size);
+  ASSERT_NE(copy, nullptr);
+  ASSERT_EQ(frame_size, SkISize::Make(800, 600));
+  ASSERT_TRUE(copy->Equals(*dl));
+}
+
+TEST(DisplayListCapture, ReplacesImagesWithPlaceholders) {
+  DisplayListBuilder builder;
+  builder.drawImage(TestImage1, {10, 10}, kNearestSampling, false);
+  builder.drawImage(TestImage2, {20, 20}, kNearestSampling, false);
+  builder.drawImage(TestImage1, {30, 30}, kNearestSampling, false);
+  auto dl = builder.Build();
+  auto capture = DisplayListCapture::Serialize(*dl, SkISize::Make(100, 100));
+  ASSERT_NE(capture, nullptr);
+
+  SkISize frame_size;
+  auto copy = DisplayListCapture::Deserialize(*capture, &frame_size);
+  ASSERT_NE(copy, nullptr);
+  ASSERT_EQ(copy->op_count(), dl->op_count());
+  ASSERT_EQ(copy->bounds(), dl->bounds());
+  // The pixels of the images are not captured.
+  ASSERT_FALSE(copy->Equals(*dl));
+}
+
+TEST(DisplayListCapture, RejectsMalformedCaptures) {
+  DisplayListBuilder builder;
+  builder.drawImage(TestImage1, {10, 10}, kNearestSampling, false);
+  auto dl = builder.Build();
+  auto capture = DisplayListCapture::Serialize(*dl, SkISize::Make(100, 100));
+  ASSERT_NE(capture, nullptr);
+  std::vector<uint8_t> bytes(capture->GetMapping(),
+                             capture->GetMapping() + capture->GetSize());
+
+  SkISize frame_size;
+  for (size_t size = 0; size < bytes.size(); size += 4) {
+    fml::NonOwnedMapping truncated(bytes.data(), size);
+    ASSERT_EQ(DisplayListCapture::Deserialize(truncated, &frame_size), nullptr)
+        << size;
+  }
+
+  auto versioned = bytes;
+  uint32_t version = DisplayListCapture::kVersion + 1;
+  memcpy(versioned.data() + sizeof(uint32_t), &version, sizeof(version));
+  fml::NonOwnedMapping other_version(versioned.data(), versioned.size());
+  ASSERT_EQ(DisplayListCapture::Deserialize(other_version, &frame_size),
+            nullptr);
+
+  ASSERT_EQ(DisplayListCapture::Serialize(*dl, SkISize::MakeEmpty()), nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
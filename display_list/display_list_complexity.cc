@@ -27,11 +27,23 @@ DisplayListComplexityCalculator* DisplayListComplexityCalculator::GetForBackend(
       return DisplayListMetalComplexityCalculator::GetInstance();
     case GrBackendApi::kOpenGL:
       return DisplayListGLComplexityCalculator::GetInstance();
+    // Skia's Vulkan backend records the same GrOps as the GL backend, so the
+    // GL weightings are the closest fit until Vulkan device data is fitted
+    // with displaylist_benchmark_parser.py.
+    case GrBackendApi::kVulkan:
+      return DisplayListGLComplexityCalculator::GetInstance();
     default:
       return DisplayListNaiveComplexityCalculator::GetInstance();
   }
 }
 
+DisplayListComplexityCalculator*
+DisplayListComplexityCalculator::GetForImpeller() {
+  // Impeller currently only ships on Metal, where the relative costs of
+  // saveLayer and text are closest to those measured for Skia on Metal.
+  return DisplayListMetalComplexityCalculator::GetInstance();
+}
+
 DisplayListComplexityCalculator*
 DisplayListComplexityCalculator::GetForSoftware() {
   return DisplayListNaiveComplexityCalculator::GetInstance();
@@ -41,6 +41,22 @@ std::vector<SkPoint> GetTestPoints() {
 
 }  // namespace
 
+TEST(DisplayListComplexity, CalculatorsForBackends) {
+  ASSERT_EQ(
+      DisplayListComplexityCalculator::GetForBackend(GrBackendApi::kMetal),
+      DisplayListMetalComplexityCalculator::GetInstance());
+  ASSERT_EQ(
+      DisplayListComplexityCalculator::GetForBackend(GrBackendApi::kOpenGL),
+      DisplayListGLComplexityCalculator::GetInstance());
+  ASSERT_EQ(
+      DisplayListComplexityCalculator::GetForBackend(GrBackendApi::kVulkan),
+      DisplayListGLComplexityCalculator::GetInstance());
+  ASSERT_EQ(DisplayListComplexityCalculator::GetForImpeller(),
+            DisplayListMetalComplexityCalculator::GetInstance());
+  ASSERT_EQ(DisplayListComplexityCalculator::GetForSoftware(),
+            DisplayListNaiveComplexityCalculator::GetInstance());
+}
+
 TEST(DisplayListComplexity, EmptyDisplayList) {
   auto display_list = GetSampleDisplayList(0);
 
@@ -37,6 +37,32 @@ enum class DisplayListCompare {
   kEqual,
 };
 
+// Ops are hashed to match the way that they are compared. The hash of a
+// bulk-comparable op covers all of its bytes, including any data recorded
+// after it. A DLOp that overrides DLOp::equals() must also override
+// DLOp::hash() so that it only hashes values that its equals() method
+// compares.
+inline uint64_t DlHashCombine(uint64_t hash, uint64_t value) {
+  return hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+}
+
+inline uint64_t DlHashBytes(const void* data, size_t length) {
+  FML_DCHECK(length % sizeof(uint32_t) == 0);
+  const uint32_t* words = static_cast<const uint32_t*>(data);
+  uint64_t hash = length;
+  for (size_t i = 0; i < length / sizeof(uint32_t); i++) {
+    hash = DlHashCombine(hash, words[i]);
+  }
+  return hash;
+}
+
+// SkPath::operator== compares the verbs, points and fill type of the paths.
+inline uint64_t DlHashPath(const SkPath& path) {
+  uint64_t hash = DlHashCombine(path.countVerbs(), path.countPoints());
+  hash = DlHashCombine(hash, static_cast<uint64_t>(path.getFillType()));
+  return DlHashCombine(hash, DlHashBytes(&path.getBounds(), sizeof(SkRect)));
+}
+
 // "DLOpPackLabel" is just a label for the pack pragma so it can be popped
 // later.
 #pragma pack(push, DLOpPackLabel, 8)
@@ -58,6 +84,8 @@ struct DLOp {
   DisplayListCompare equals(const DLOp* other) const {
     return DisplayListCompare::kUseBulkCompare;
   }
+
+  uint64_t hash() const { return DlHashBytes(this, size); }
 };
 
 // 4 byte header + 4 byte payload packs into minimum 8 bytes
@@ -267,6 +295,8 @@ struct SetRuntimeEffectColorSourceOp : DLOp {
     return (source == other->source) ? DisplayListCompare::kEqual
                                      : DisplayListCompare::kNotEqual;
   }
+
+  uint64_t hash() const { return static_cast<uint64_t>(kType); }
 };
 
 // 4 byte header + 16 byte payload uses 24 total bytes (4 bytes unused)
@@ -286,6 +316,11 @@ struct SetSharedImageFilterOp : DLOp {
     return Equals(filter, other->filter) ? DisplayListCompare::kEqual
                                          : DisplayListCompare::kNotEqual;
   }
+
+  uint64_t hash() const {
+    return DlHashCombine(static_cast<uint64_t>(kType),
+                         static_cast<uint64_t>(filter->type()));
+  }
 };
 
 // 4 byte header + no payload uses minimum 8 bytes (4 bytes unused)
@@ -307,6 +342,13 @@ struct SaveLayerOp final : DLOp {
   void dispatch(Dispatcher& dispatcher) const {
     dispatcher.saveLayer(nullptr, options);
   }
+
+  // The options are updated at the matching restore, which may be after
+  // the op was hashed.
+  uint64_t hash() const {
+    return DlHashCombine(static_cast<uint64_t>(kType),
+                         options.renders_with_attributes());
+  }
 };
 // 4 byte header + 20 byte payload packs evenly into 24 bytes
 struct SaveLayerBoundsOp final : DLOp {
@@ -321,6 +363,12 @@ struct SaveLayerBoundsOp final : DLOp {
   void dispatch(Dispatcher& dispatcher) const {
     dispatcher.saveLayer(&rect, options);
   }
+
+  uint64_t hash() const {
+    uint64_t hash = DlHashCombine(static_cast<uint64_t>(kType),
+                                  options.renders_with_attributes());
+    return DlHashCombine(hash, DlHashBytes(&rect, sizeof(rect)));
+  }
 };
 // 4 byte header + 20 byte payload packs into minimum 24 bytes
 struct SaveLayerBackdropOp final : DLOp {
@@ -342,6 +390,12 @@ struct SaveLayerBackdropOp final : DLOp {
                ? DisplayListCompare::kEqual
                : DisplayListCompare::kNotEqual;
   }
+
+  uint64_t hash() const {
+    uint64_t hash = DlHashCombine(static_cast<uint64_t>(kType),
+                                  options.renders_with_attributes());
+    return DlHashCombine(hash, static_cast<uint64_t>(backdrop->type()));
+  }
 };
 // 4 byte header + 36 byte payload packs evenly into 36 bytes
 struct SaveLayerBackdropBoundsOp final : DLOp {
@@ -366,6 +420,13 @@ struct SaveLayerBackdropBoundsOp final : DLOp {
                ? DisplayListCompare::kEqual
                : DisplayListCompare::kNotEqual;
   }
+
+  uint64_t hash() const {
+    uint64_t hash = DlHashCombine(static_cast<uint64_t>(kType),
+                                  options.renders_with_attributes());
+    hash = DlHashCombine(hash, DlHashBytes(&rect, sizeof(rect)));
+    return DlHashCombine(hash, static_cast<uint64_t>(backdrop->type()));
+  }
 };
 // 4 byte header + no payload uses minimum 8 bytes (4 bytes unused)
 struct RestoreOp final : DLOp {
@@ -528,6 +589,12 @@ DEFINE_CLIP_SHAPE_OP(RRect, Difference)
       return is_aa == other->is_aa && path == other->path                \
                  ? DisplayListCompare::kEqual                            \
                  : DisplayListCompare::kNotEqual;                        \
+    }                                                                    \
+                                                                         \
+    uint64_t hash() const {                                              \
+      uint64_t type = static_cast<uint64_t>(kType);                      \
+      uint64_t hash = DlHashCombine(type, is_aa);                        \
+      return DlHashCombine(hash, DlHashPath(path));                      \
     }                                                                    \
   };
 DEFINE_CLIP_PATH_OP(Intersect)
@@ -594,6 +661,10 @@ struct DrawPathOp final : DLOp {
     return path == other->path ? DisplayListCompare::kEqual
                                : DisplayListCompare::kNotEqual;
   }
+
+  uint64_t hash() const {
+    return DlHashCombine(static_cast<uint64_t>(kType), DlHashPath(path));
+  }
 };
 
 // The common data is a 4 byte header with an unused 4 bytes
@@ -971,6 +1042,11 @@ struct DrawDisplayListOp final : DLOp {
                ? DisplayListCompare::kEqual
                : DisplayListCompare::kNotEqual;
   }
+
+  uint64_t hash() const {
+    return DlHashCombine(static_cast<uint64_t>(kType),
+                         display_list->content_hash());
+  }
 };
 
 // 4 byte header + 8 payload bytes + an aligned pointer take 24 bytes
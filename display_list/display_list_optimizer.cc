@@ -0,0 +1,691 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_optimizer.h"
+
+#include <vector>
+
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/display_list/display_list_dispatcher.h"
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+namespace {
+
+// Replays a DisplayList into a DisplayListBuilder while removing redundant
+// ops.
+//
+// The DisplayList is dispatched twice. The first pass only counts the
+// children of every saveLayer to find the layers that can be folded into
+// their child. The second pass records the optimized DisplayList.
+//
+// Transforms, clips and saves are deferred until a rendering op depends on
+// them, and are dropped if the save depth they belong to is restored first.
+class OptimizingDispatcher final : public Dispatcher {
+ public:
+  OptimizingDispatcher(const SkRect& cull_rect,
+                       DisplayListOptimizer::Stats& stats)
+      : builder_(cull_rect), stats_(stats) {}
+
+  void StartRecording() {
+    FML_DCHECK(analyzing_);
+    analyzing_ = false;
+    frames_.clear();
+    next_layer_ = 0;
+  }
+
+  sk_sp<DisplayList> Build() {
+    FlushRects();
+    DropDeferredOps(0);
+    return builder_.Build();
+  }
+
+  void setAntiAlias(bool aa) override {
+    if (!analyzing_ && aa != anti_alias_) {
+      FlushRects();
+      anti_alias_ = aa;
+      builder_.setAntiAlias(aa);
+    }
+  }
+  void setDither(bool dither) override {
+    if (!analyzing_) {
+      FlushRects();
+      builder_.setDither(dither);
+    }
+  }
+  void setInvertColors(bool invert) override {
+    if (!analyzing_) {
+      FlushRects();
+      builder_.setInvertColors(invert);
+    }
+  }
+  void setStyle(DlDrawStyle style) override {
+    if (!analyzing_ && style != style_) {
+      FlushRects();
+      style_ = style;
+      builder_.setStyle(style);
+    }
+  }
+  void setColor(DlColor color) override {
+    if (!analyzing_ && color != color_) {
+      FlushRects();
+      color_ = color;
+      builder_.setColor(color);
+    }
+  }
+  void setStrokeWidth(float width) override {
+    if (!analyzing_) {
+      FlushRects();
+      builder_.setStrokeWidth(width);
+    }
+  }
+  void setStrokeMiter(float limit) override {
+    if (!analyzing_) {
+      FlushRects();
+      builder_.setStrokeMiter(limit);
+    }
+  }
+  void setStrokeCap(DlStrokeCap cap) override {
+    if (!analyzing_) {
+      FlushRects();
+      builder_.setStrokeCap(cap);
+    }
+  }
+  void setStrokeJoin(DlStrokeJoin join) override {
+    if (!analyzing_) {
+      FlushRects();
+      builder_.setStrokeJoin(join);
+    }
+  }
+  void setBlendMode(DlBlendMode mode) override {
+    if (!analyzing_ && mode != blend_mode_) {
+      FlushRects();
+      blend_mode_ = mode;
+      builder_.setBlendMode(mode);
+    }
+  }
+  void setBlender(sk_sp<SkBlender> blender) override {
+    if (!analyzing_) {
+      FlushRects();
+      has_blender_ = blender != nullptr;
+      builder_.setBlender(std::move(blender));
+    }
+  }
+  void setColorSource(const DlColorSource* source) override {
+    if (!analyzing_) {
+      FlushRects();
+      has_color_source_ = source != nullptr;
+      builder_.setColorSource(source);
+    }
+  }
+  void setColorFilter(const DlColorFilter* filter) override {
+    if (!analyzing_) {
+      FlushRects();
+      has_color_filter_ = filter != nullptr;
+      builder_.setColorFilter(filter);
+    }
+  }
+  void setPathEffect(const DlPathEffect* effect) override {
+    if (!analyzing_) {
+      FlushRects();
+      has_path_effect_ = effect != nullptr;
+      builder_.setPathEffect(effect);
+    }
+  }
+  void setMaskFilter(const DlMaskFilter* filter) override {
+    if (!analyzing_) {
+      FlushRects();
+      has_mask_filter_ = filter != nullptr;
+      builder_.setMaskFilter(filter);
+    }
+  }
+  void setImageFilter(const DlImageFilter* filter) override {
+    if (!analyzing_) {
+      FlushRects();
+      has_image_filter_ = filter != nullptr;
+      builder_.setImageFilter(filter);
+    }
+  }
+
+  void save() override {
+    if (analyzing_) {
+      frames_.emplace_back();
+      return;
+    }
+    FlushRects();
+    frames_.emplace_back();
+    frames_.back().deferred_save_index = deferred_ops_.size();
+    Defer(DeferredOp::kSave);
+  }
+  void saveLayer(const SkRect* bounds,
+                 const SaveLayerOptions options,
+                 const DlImageFilter* backdrop) override {
+    if (analyzing_) {
+      // A layer is not a child that can take an opacity.
+      AddChild(false);
+      frames_.emplace_back();
+      frames_.back().layer = layers_.size();
+      layers_.emplace_back();
+      return;
+    }
+    FlushRects();
+    const Layer& layer = layers_[next_layer_++];
+    if (bounds == nullptr && backdrop == nullptr &&
+        options.can_distribute_opacity() && layer.child_count == 1 &&
+        layer.child_takes_opacity) {
+      stats_.folded_layers++;
+      frames_.emplace_back();
+      frames_.back().deferred_save_index = deferred_ops_.size();
+      if (options.renders_with_attributes()) {
+        frames_.back().opacity = color_.getAlphaF();
+      }
+      Defer(DeferredOp::kSave);
+      return;
+    }
+    FlushDeferredOps();
+    frames_.emplace_back();
+    builder_.saveLayer(bounds, options, backdrop);
+  }
+  void restore() override {
+    if (frames_.empty()) {
+      return;
+    }
+    Frame frame = frames_.back();
+    frames_.pop_back();
+    if (analyzing_) {
+      return;
+    }
+    FlushRects();
+    if (frame.deferred_save_index != kNotDeferred) {
+      // Nothing rendered since the save, so it is dropped together with
+      // everything that followed it.
+      DropDeferredOps(frame.deferred_save_index);
+      return;
+    }
+    DropDeferredOps(0);
+    builder_.restore();
+  }
+
+  void translate(SkScalar tx, SkScalar ty) override {
+    DeferTransform(SkM44::Translate(tx, ty));
+  }
+  void scale(SkScalar sx, SkScalar sy) override {
+    DeferTransform(SkM44::Scale(sx, sy));
+  }
+  void rotate(SkScalar degrees) override {
+    DeferTransform(SkM44(SkMatrix::RotateDeg(degrees)));
+  }
+  void skew(SkScalar sx, SkScalar sy) override {
+    DeferTransform(SkM44(SkMatrix::Skew(sx, sy)));
+  }
+  // clang-format off
+  void transform2DAffine(SkScalar mxx, SkScalar mxy, SkScalar mxt,
+                         SkScalar myx, SkScalar myy, SkScalar myt) override {
+    DeferTransform(SkM44(mxx, mxy,  0,  mxt,
+                         myx, myy,  0,  myt,
+                          0,   0,   1,   0,
+                          0,   0,   0,   1));
+  }
+  void transformFullPerspective(
+      SkScalar mxx, SkScalar mxy, SkScalar mxz, SkScalar mxt,
+      SkScalar myx, SkScalar myy, SkScalar myz, SkScalar myt,
+      SkScalar mzx, SkScalar mzy, SkScalar mzz, SkScalar mzt,
+      SkScalar mwx, SkScalar mwy, SkScalar mwz, SkScalar mwt) override {
+    DeferTransform(SkM44(mxx, mxy, mxz, mxt,
+                         myx, myy, myz, myt,
+                         mzx, mzy, mzz, mzt,
+                         mwx, mwy, mwz, mwt));
+  }
+  // clang-format on
+  void transformReset() override {
+    if (analyzing_) {
+      return;
+    }
+    FlushRects();
+    Defer(DeferredOp::kTransformReset);
+  }
+
+  void clipRect(const SkRect& rect, SkClipOp clip_op, bool is_aa) override {
+    if (analyzing_) {
+      return;
+    }
+    FlushRects();
+    DeferredOp& op = Defer(DeferredOp::kClipRect);
+    op.rect = rect;
+    op.clip_op = clip_op;
+    op.is_aa = is_aa;
+  }
+  void clipRRect(const SkRRect& rrect, SkClipOp clip_op, bool is_aa) override {
+    if (analyzing_) {
+      return;
+    }
+    FlushRects();
+    DeferredOp& op = Defer(DeferredOp::kClipRRect);
+    op.rrect = rrect;
+    op.clip_op = clip_op;
+    op.is_aa = is_aa;
+  }
+  void clipPath(const SkPath& path, SkClipOp clip_op, bool is_aa) override {
+    if (analyzing_) {
+      return;
+    }
+    FlushRects();
+    DeferredOp& op = Defer(DeferredOp::kClipPath);
+    op.path = path;
+    op.clip_op = clip_op;
+    op.is_aa = is_aa;
+  }
+
+  void drawColor(DlColor color, DlBlendMode mode) override {
+    if (BeginDraw(false)) {
+      builder_.drawColor(color, mode);
+    }
+  }
+  void drawPaint() override {
+    if (BeginDraw(true)) {
+      builder_.drawPaint();
+      EndDraw();
+    }
+  }
+  void drawLine(const SkPoint& p0, const SkPoint& p1) override {
+    if (BeginDraw(true)) {
+      builder_.drawLine(p0, p1);
+      EndDraw();
+    }
+  }
+  void drawRect(const SkRect& rect) override {
+    if (analyzing_) {
+      AddChild(true);
+      return;
+    }
+    if (CanMergeRects()) {
+      FlushDeferredOps();
+      pending_rects_.push_back(rect);
+      return;
+    }
+    if (BeginDraw(true)) {
+      builder_.drawRect(rect);
+      EndDraw();
+    }
+  }
+  void drawOval(const SkRect& bounds) override {
+    if (BeginDraw(true)) {
+      builder_.drawOval(bounds);
+      EndDraw();
+    }
+  }
+  void drawCircle(const SkPoint& center, SkScalar radius) override {
+    if (BeginDraw(true)) {
+      builder_.drawCircle(center, radius);
+      EndDraw();
+    }
+  }
+  void drawRRect(const SkRRect& rrect) override {
+    if (BeginDraw(true)) {
+      builder_.drawRRect(rrect);
+      EndDraw();
+    }
+  }
+  void drawDRRect(const SkRRect& outer, const SkRRect& inner) override {
+    if (BeginDraw(true)) {
+      builder_.drawDRRect(outer, inner);
+      EndDraw();
+    }
+  }
+  void drawPath(const SkPath& path) override {
+    if (BeginDraw(true)) {
+      builder_.drawPath(path);
+      EndDraw();
+    }
+  }
+  void drawArc(const SkRect& oval_bounds,
+               SkScalar start_degrees,
+               SkScalar sweep_degrees,
+               bool use_center) override {
+    if (BeginDraw(true)) {
+      builder_.drawArc(oval_bounds, start_degrees, sweep_degrees, use_center);
+      EndDraw();
+    }
+  }
+  void drawPoints(SkCanvas::PointMode mode,
+                  uint32_t count,
+                  const SkPoint points[]) override {
+    if (BeginDraw(true)) {
+      builder_.drawPoints(mode, count, points);
+      EndDraw();
+    }
+  }
+  void drawSkVertices(const sk_sp<SkVertices> vertices,
+                      SkBlendMode mode) override {
+    if (BeginDraw(false)) {
+      builder_.drawSkVertices(vertices, mode);
+    }
+  }
+  void drawVertices(const DlVertices* vertices, DlBlendMode mode) override {
+    if (BeginDraw(false)) {
+      builder_.drawVertices(vertices, mode);
+    }
+  }
+  void drawImage(const sk_sp<DlImage> image,
+                 const SkPoint point,
+                 DlImageSampling sampling,
+                 bool render_with_attributes) override {
+    if (BeginDraw(render_with_attributes)) {
+      builder_.drawImage(image, point, sampling, render_with_attributes);
+      EndDraw();
+    }
+  }
+  void drawImageRect(const sk_sp<DlImage> image,
+                     const SkRect& src,
+                     const SkRect& dst,
+                     DlImageSampling sampling,
+                     bool render_with_attributes,
+                     SkCanvas::SrcRectConstraint constraint) override {
+    if (BeginDraw(render_with_attributes)) {
+      builder_.drawImageRect(image, src, dst, sampling, render_with_attributes,
+                             constraint);
+      EndDraw();
+    }
+  }
+  void drawImageNine(const sk_sp<DlImage> image,
+                     const SkIRect& center,
+                     const SkRect& dst,
+                     DlFilterMode filter,
+                     bool render_with_attributes) override {
+    if (BeginDraw(render_with_attributes)) {
+      builder_.drawImageNine(image, center, dst, filter,
+                             render_with_attributes);
+      EndDraw();
+    }
+  }
+  void drawImageLattice(const sk_sp<DlImage> image,
+                        const SkCanvas::Lattice& lattice,
+                        const SkRect& dst,
+                        DlFilterMode filter,
+                        bool render_with_attributes) override {
+    if (BeginDraw(render_with_attributes)) {
+      builder_.drawImageLattice(image, lattice, dst, filter,
+                                render_with_attributes);
+      EndDraw();
+    }
+  }
+  void drawAtlas(const sk_sp<DlImage> atlas,
+                 const SkRSXform xform[],
+                 const SkRect tex[],
+                 const DlColor colors[],
+                 int count,
+                 DlBlendMode mode,
+                 DlImageSampling sampling,
+                 const SkRect* cull_rect,
+                 bool render_with_attributes) override {
+    if (BeginDraw(false)) {
+      builder_.drawAtlas(atlas, xform, tex, colors, count, mode, sampling,
+                         cull_rect, render_with_attributes);
+    }
+  }
+  void drawPicture(const sk_sp<SkPicture> picture,
+                   const SkMatrix* matrix,
+                   bool render_with_attributes) override {
+    if (BeginDraw(false)) {
+      builder_.drawPicture(picture, matrix, render_with_attributes);
+    }
+  }
+  void drawDisplayList(const sk_sp<DisplayList> display_list) override {
+    if (BeginDraw(false)) {
+      builder_.drawDisplayList(display_list);
+    }
+  }
+  void drawTextBlob(const sk_sp<SkTextBlob> blob,
+                    SkScalar x,
+                    SkScalar y) override {
+    if (BeginDraw(true)) {
+      builder_.drawTextBlob(blob, x, y);
+      EndDraw();
+    }
+  }
+  void drawShadow(const SkPath& path,
+                  const DlColor color,
+                  const SkScalar elevation,
+                  bool transparent_occluder,
+                  SkScalar dpr) override {
+    if (BeginDraw(false)) {
+      builder_.drawShadow(path, color, elevation, transparent_occluder, dpr);
+    }
+  }
+
+ private:
+  static constexpr size_t kNotALayer = static_cast<size_t>(-1);
+  static constexpr size_t kNotDeferred = static_cast<size_t>(-1);
+
+  struct Frame {
+    // The index of the saveLayer in |layers_| during the first pass.
+    size_t layer = kNotALayer;
+    // The index of the save in |deferred_ops_| while it is deferred.
+    size_t deferred_save_index = kNotDeferred;
+    // The opacity of a folded saveLayer that its child is rendered with.
+    SkScalar opacity = SK_Scalar1;
+  };
+
+  struct Layer {
+    unsigned int child_count = 0;
+    bool child_takes_opacity = true;
+  };
+
+  struct DeferredOp {
+    enum Type {
+      kSave,
+      kTransform,
+      kTransformReset,
+      kClipRect,
+      kClipRRect,
+      kClipPath,
+    };
+    explicit DeferredOp(Type type) : type(type) {}
+
+    Type type;
+    SkM44 matrix;
+    SkRect rect;
+    SkRRect rrect;
+    SkPath path;
+    SkClipOp clip_op = SkClipOp::kIntersect;
+    bool is_aa = false;
+    // The number of transform ops that were folded into |matrix|.
+    unsigned int transform_count = 0;
+  };
+
+  DisplayListBuilder builder_;
+  DisplayListOptimizer::Stats& stats_;
+  bool analyzing_ = true;
+
+  std::vector<Frame> frames_;
+  std::vector<Layer> layers_;
+  size_t next_layer_ = 0;
+
+  std::vector<DeferredOp> deferred_ops_;
+  std::vector<SkRect> pending_rects_;
+
+  // The attributes that decide whether rects can be merged and what opacity
+  // a folded saveLayer applies.
+  bool anti_alias_ = false;
+  DlDrawStyle style_ = DlDrawStyle::kDefaultStyle;
+  DlColor color_ = DlPaint::kDefaultColor;
+  DlBlendMode blend_mode_ = DlBlendMode::kDefaultMode;
+  bool has_blender_ = false;
+  bool has_color_source_ = false;
+  bool has_color_filter_ = false;
+  bool has_path_effect_ = false;
+  bool has_mask_filter_ = false;
+  bool has_image_filter_ = false;
+
+  // Counts a rendering op as a child of the innermost saveLayer during the
+  // first pass.
+  void AddChild(bool takes_opacity) {
+    for (auto it = frames_.rbegin(); it != frames_.rend(); ++it) {
+      if (it->layer != kNotALayer) {
+        Layer& layer = layers_[it->layer];
+        layer.child_count++;
+        layer.child_takes_opacity &= takes_opacity;
+        return;
+      }
+    }
+  }
+
+  // The opacity that a folded saveLayer applies to the current op.
+  SkScalar InheritedOpacity() const {
+    SkScalar opacity = SK_Scalar1;
+    for (const auto& frame : frames_) {
+      opacity *= frame.opacity;
+    }
+    return opacity;
+  }
+
+  // Prepares for a rendering op that applies an inherited opacity through
+  // the color attribute if |takes_opacity| is true. Returns false during
+  // the first pass.
+  bool BeginDraw(bool takes_opacity) {
+    if (analyzing_) {
+      AddChild(takes_opacity);
+      return false;
+    }
+    FlushRects();
+    FlushDeferredOps();
+    SkScalar opacity = InheritedOpacity();
+    if (opacity < SK_Scalar1) {
+      FML_DCHECK(takes_opacity);
+      builder_.setColor(color_.modulateOpacity(opacity));
+    }
+    return true;
+  }
+
+  void EndDraw() { builder_.setColor(color_); }
+
+  DeferredOp& Defer(DeferredOp::Type type) {
+    deferred_ops_.emplace_back(type);
+    return deferred_ops_.back();
+  }
+
+  void DeferTransform(const SkM44& matrix) {
+    if (analyzing_) {
+      return;
+    }
+    FlushRects();
+    if (!deferred_ops_.empty() &&
+        deferred_ops_.back().type == DeferredOp::kTransform) {
+      deferred_ops_.back().matrix.preConcat(matrix);
+      deferred_ops_.back().transform_count++;
+      return;
+    }
+    DeferredOp& op = Defer(DeferredOp::kTransform);
+    op.matrix = matrix;
+    op.transform_count = 1;
+  }
+
+  // Records the deferred ops now that a rendering op depends on them.
+  void FlushDeferredOps() {
+    for (const auto& op : deferred_ops_) {
+      switch (op.type) {
+        case DeferredOp::kSave:
+          builder_.save();
+          break;
+        case DeferredOp::kTransform:
+          stats_.removed_transforms += op.transform_count - 1;
+          builder_.transform(op.matrix);
+          break;
+        case DeferredOp::kTransformReset:
+          builder_.transformReset();
+          break;
+        case DeferredOp::kClipRect:
+          builder_.clipRect(op.rect, op.clip_op, op.is_aa);
+          break;
+        case DeferredOp::kClipRRect:
+          builder_.clipRRect(op.rrect, op.clip_op, op.is_aa);
+          break;
+        case DeferredOp::kClipPath:
+          builder_.clipPath(op.path, op.clip_op, op.is_aa);
+          break;
+      }
+    }
+    deferred_ops_.clear();
+    for (auto& frame : frames_) {
+      frame.deferred_save_index = kNotDeferred;
+    }
+  }
+
+  // Drops the deferred ops from |index| on, which no rendering op depends
+  // on.
+  void DropDeferredOps(size_t index) {
+    for (size_t i = index; i < deferred_ops_.size(); i++) {
+      switch (deferred_ops_[i].type) {
+        case DeferredOp::kSave:
+          stats_.removed_saves++;
+          break;
+        case DeferredOp::kTransform:
+          stats_.removed_transforms += deferred_ops_[i].transform_count;
+          break;
+        case DeferredOp::kTransformReset:
+          stats_.removed_transforms++;
+          break;
+        case DeferredOp::kClipRect:
+        case DeferredOp::kClipRRect:
+        case DeferredOp::kClipPath:
+          stats_.removed_clips++;
+          break;
+      }
+    }
+    deferred_ops_.erase(deferred_ops_.begin() + index, deferred_ops_.end());
+  }
+
+  // Overlapping rects only render the same as their union when the fill is
+  // opaque and does not depend on the geometry. Without anti-aliasing, the
+  // pixels covered by the union are exactly those covered by the rects.
+  bool CanMergeRects() const {
+    return !anti_alias_ && style_ == DlDrawStyle::kFill &&
+           color_.isOpaque() && blend_mode_ == DlBlendMode::kSrcOver &&
+           !has_blender_ && !has_color_source_ && !has_color_filter_ &&
+           !has_path_effect_ && !has_mask_filter_ && !has_image_filter_ &&
+           InheritedOpacity() == SK_Scalar1;
+  }
+
+  void FlushRects() {
+    if (pending_rects_.empty()) {
+      return;
+    }
+    if (pending_rects_.size() == 1) {
+      builder_.drawRect(pending_rects_.front());
+    } else {
+      SkPath path;
+      for (const auto& rect : pending_rects_) {
+        path.addRect(rect);
+      }
+      builder_.drawPath(path);
+      stats_.merged_rects += pending_rects_.size() - 1;
+    }
+    pending_rects_.clear();
+  }
+
+  FML_DISALLOW_COPY_AND_ASSIGN(OptimizingDispatcher);
+};
+
+}  // namespace
+
+sk_sp<DisplayList> DisplayListOptimizer::Optimize(
+    const sk_sp<DisplayList>& display_list,
+    Stats* stats) {
+  Stats local_stats;
+  Stats& result = stats ? *stats : local_stats;
+  result = Stats();
+
+  OptimizingDispatcher dispatcher(display_list->cull_rect(), result);
+  display_list->Dispatch(dispatcher);
+  dispatcher.StartRecording();
+  display_list->Dispatch(dispatcher);
+  auto optimized = dispatcher.Build();
+
+  result.original_op_count = display_list->op_count();
+  result.optimized_op_count = optimized->op_count();
+  return optimized;
+}
+
+}  // namespace flutter
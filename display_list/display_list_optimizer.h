@@ -0,0 +1,55 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_OPTIMIZER_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_OPTIMIZER_H_
+
+#include "flutter/display_list/display_list.h"
+
+namespace flutter {
+
+// Rewrites a DisplayList into an equivalent one with fewer ops.
+//
+// The optimizer removes work that the DisplayListBuilder records verbatim
+// from the framework:
+// - save/restore pairs, transforms and clips that no rendering op within
+//   their save depth depends on are removed.
+// - runs of consecutive transforms are folded into a single transform.
+// - a saveLayer without bounds or a backdrop whose only child can take its
+//   opacity is replaced by rendering the child with the combined opacity,
+//   the same way that DisplayListCanvasDispatcher does for Skia at render
+//   time.
+// - runs of consecutive drawRect calls with identical, opaque, non
+//   anti-aliased fill attributes are merged into a single drawPath call.
+//
+// Nested DisplayLists are left as they are.
+class DisplayListOptimizer {
+ public:
+  struct Stats {
+    // The number of ops, excluding nested DisplayLists, before and after
+    // the optimization.
+    unsigned int original_op_count = 0;
+    unsigned int optimized_op_count = 0;
+
+    // The number of save/restore pairs that were removed.
+    unsigned int removed_saves = 0;
+    // The number of transform ops that were removed or folded into others.
+    unsigned int removed_transforms = 0;
+    // The number of clip ops that were removed.
+    unsigned int removed_clips = 0;
+    // The number of saveLayers whose opacity was applied to their child.
+    unsigned int folded_layers = 0;
+    // The number of drawRect calls that were merged into other draws.
+    unsigned int merged_rects = 0;
+  };
+
+  // Returns the optimized form of |display_list|, and fills in |stats| if it
+  // is not null.
+  static sk_sp<DisplayList> Optimize(const sk_sp<DisplayList>& display_list,
+                                     Stats* stats = nullptr);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_OPTIMIZER_H_
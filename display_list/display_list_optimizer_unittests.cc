@@ -0,0 +1,194 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <functional>
+#include <string>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/display_list/display_list_optimizer.h"
+#include "flutter/display_list/display_list_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(DisplayListOptimizer, RemovesUnusedSaveTransformAndClip) {
+  DisplayListBuilder builder;
+  builder.save();
+  builder.translate(10, 10);
+  builder.clipRect({0, 0, 50, 50}, SkClipOp::kIntersect, false);
+  builder.restore();
+  builder.drawRect({10, 10, 20, 20});
+  auto dl = builder.Build();
+
+  DisplayListBuilder expected_builder;
+  expected_builder.drawRect({10, 10, 20, 20});
+  auto expected = expected_builder.Build();
+
+  DisplayListOptimizer::Stats stats;
+  auto optimized = DisplayListOptimizer::Optimize(dl, &stats);
+  ASSERT_TRUE(optimized->Equals(*expected));
+  ASSERT_EQ(optimized->bounds(), dl->bounds());
+  ASSERT_EQ(stats.removed_saves, 1u);
+  ASSERT_EQ(stats.removed_transforms, 1u);
+  ASSERT_EQ(stats.removed_clips, 1u);
+  ASSERT_EQ(stats.original_op_count, dl->op_count());
+  ASSERT_EQ(stats.optimized_op_count, 1u);
+}
+
+TEST(DisplayListOptimizer, KeepsStateThatIsUsed) {
+  DisplayListBuilder builder;
+  builder.setAntiAlias(true);
+  builder.save();
+  builder.translate(10, 10);
+  builder.clipRect({0, 0, 50, 50}, SkClipOp::kIntersect, true);
+  builder.drawOval({10, 10, 20, 20});
+  builder.restore();
+  auto dl = builder.Build();
+
+  DisplayListOptimizer::Stats stats;
+  auto optimized = DisplayListOptimizer::Optimize(dl, &stats);
+  ASSERT_TRUE(optimized->Equals(*dl));
+  ASSERT_EQ(stats.removed_saves, 0u);
+  ASSERT_EQ(stats.removed_transforms, 0u);
+  ASSERT_EQ(stats.removed_clips, 0u);
+}
+
+TEST(DisplayListOptimizer, FoldsConsecutiveTransforms) {
+  DisplayListBuilder builder;
+  builder.translate(10, 10);
+  builder.scale(2, 2);
+  builder.rotate(45);
+  builder.drawOval({10, 10, 20, 20});
+  auto dl = builder.Build();
+
+  SkM44 matrix = SkM44::Translate(10, 10);
+  matrix.preConcat(SkM44::Scale(2, 2));
+  matrix.preConcat(SkM44(SkMatrix::RotateDeg(45)));
+  DisplayListBuilder expected_builder;
+  expected_builder.transform(matrix);
+  expected_builder.drawOval({10, 10, 20, 20});
+  auto expected = expected_builder.Build();
+
+  DisplayListOptimizer::Stats stats;
+  auto optimized = DisplayListOptimizer::Optimize(dl, &stats);
+  ASSERT_TRUE(optimized->Equals(*expected));
+  ASSERT_EQ(optimized->bounds(), dl->bounds());
+  ASSERT_EQ(stats.removed_transforms, 2u);
+}
+
+TEST(DisplayListOptimizer, FoldsSaveLayerIntoSingleChild) {
+  DlColor layer_color = DlColor::kBlack().withAlpha(0x80);
+  DisplayListBuilder builder;
+  builder.setColor(layer_color);
+  builder.saveLayer(nullptr, true);
+  builder.setColor(DlColor::kRed());
+  builder.drawRect({10, 10, 20, 20});
+  builder.restore();
+  auto dl = builder.Build();
+
+  DisplayListBuilder expected_builder;
+  expected_builder.setColor(layer_color);
+  expected_builder.save();
+  expected_builder.setColor(
+      DlColor::kRed().modulateOpacity(layer_color.getAlphaF()));
+  expected_builder.drawRect({10, 10, 20, 20});
+  expected_builder.setColor(DlColor::kRed());
+  expected_builder.restore();
+  auto expected = expected_builder.Build();
+
+  DisplayListOptimizer::Stats stats;
+  auto optimized = DisplayListOptimizer::Optimize(dl, &stats);
+  ASSERT_TRUE(optimized->Equals(*expected));
+  ASSERT_EQ(optimized->bounds(), dl->bounds());
+  ASSERT_EQ(stats.folded_layers, 1u);
+}
+
+TEST(DisplayListOptimizer, KeepsSaveLayerWithSeveralChildren) {
+  DisplayListBuilder builder;
+  builder.setColor(DlColor::kBlack().withAlpha(0x80));
+  builder.saveLayer(nullptr, true);
+  builder.drawOval({10, 10, 20, 20});
+  builder.drawOval({15, 15, 25, 25});
+  builder.restore();
+  auto dl = builder.Build();
+
+  DisplayListOptimizer::Stats stats;
+  auto optimized = DisplayListOptimizer::Optimize(dl, &stats);
+  ASSERT_TRUE(optimized->Equals(*dl));
+  ASSERT_EQ(stats.folded_layers, 0u);
+}
+
+TEST(DisplayListOptimizer, KeepsSaveLayerWithBounds) {
+  SkRect bounds = {0, 0, 50, 50};
+  DisplayListBuilder builder;
+  builder.setColor(DlColor::kBlack().withAlpha(0x80));
+  builder.saveLayer(&bounds, true);
+  builder.drawOval({10, 10, 20, 20});
+  builder.restore();
+  auto dl = builder.Build();
+
+  DisplayListOptimizer::Stats stats;
+  auto optimized = DisplayListOptimizer::Optimize(dl, &stats);
+  ASSERT_TRUE(optimized->Equals(*dl));
+  ASSERT_EQ(stats.folded_layers, 0u);
+}
+
+TEST(DisplayListOptimizer, MergesOpaqueRects) {
+  DisplayListBuilder builder;
+  builder.drawRect({0, 0, 10, 10});
+  builder.drawRect({20, 0, 30, 10});
+  builder.drawRect({40, 0, 50, 10});
+  auto dl = builder.Build();
+
+  SkPath path;
+  path.addRect({0, 0, 10, 10});
+  path.addRect({20, 0, 30, 10});
+  path.addRect({40, 0, 50, 10});
+  DisplayListBuilder expected_builder;
+  expected_builder.drawPath(path);
+  auto expected = expected_builder.Build();
+
+  DisplayListOptimizer::Stats stats;
+  auto optimized = DisplayListOptimizer::Optimize(dl, &stats);
+  ASSERT_TRUE(optimized->Equals(*expected));
+  ASSERT_EQ(optimized->bounds(), dl->bounds());
+  ASSERT_EQ(stats.merged_rects, 2u);
+  ASSERT_EQ(stats.optimized_op_count, 1u);
+}
+
+TEST(DisplayListOptimizer, DoesNotMergeBlendedRects) {
+  auto check = [](const std::string& desc,
+                  const std::function<void(DisplayListBuilder&)>& setup) {
+    DisplayListBuilder builder;
+    setup(builder);
+    builder.drawRect({0, 0, 10, 10});
+    builder.drawRect({5, 5, 15, 15});
+    auto dl = builder.Build();
+
+    DisplayListOptimizer::Stats stats;
+    auto optimized = DisplayListOptimizer::Optimize(dl, &stats);
+    ASSERT_TRUE(optimized->Equals(*dl)) << desc;
+    ASSERT_EQ(stats.merged_rects, 0u) << desc;
+  };
+  check("anti-aliased", [](DisplayListBuilder& b) { b.setAntiAlias(true); });
+  check("stroked",
+        [](DisplayListBuilder& b) { b.setStyle(DlDrawStyle::kStroke); });
+  check("translucent", [](DisplayListBuilder& b) {
+    b.setColor(DlColor::kBlack().withAlpha(0x80));
+  });
+  check("blend mode",
+        [](DisplayListBuilder& b) { b.setBlendMode(DlBlendMode::kXor); });
+}
+
+TEST(DisplayListOptimizer, SampleDisplayListsKeepBounds) {
+  for (auto& dl : {GetSampleDisplayList(), GetSampleNestedDisplayList()}) {
+    auto optimized = DisplayListOptimizer::Optimize(dl);
+    ASSERT_EQ(optimized->bounds(), dl->bounds());
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -167,7 +167,7 @@ class DlPaint {
   }
   const DlColorFilter* getColorFilterPtr() const { return colorFilter_.get(); }
   DlPaint& setColorFilter(std::shared_ptr<const DlColorFilter> filter) {
-    colorFilter_ = filter ? filter->shared() : nullptr;
+    colorFilter_ = filter;
     return *this;
   }
   DlPaint& setColorFilter(const DlColorFilter* filter) {
@@ -0,0 +1,180 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Replays a frame captured with the _flutter.screenshotDisplayList service
+// protocol extension with every backend that is available on the host, and
+// reports how long each one takes to rasterize it.
+//
+// The extension returns the capture encoded in Base 64, which must be decoded
+// before it is replayed:
+//
+//   base64 --decode capture.b64 > frame.dlcapture
+//   display_list_replay --capture=frame.dlcapture --iterations=100
+//
+// Options:
+//   --capture=<path>    The capture to replay.
+//   --iterations=<n>    The number of timed replays per backend. Defaults
+//                       to 100.
+//   --backend=<name>    Only replay with this backend, for example OpenGL.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_benchmarks_canvas_provider.h"
+#include "flutter/display_list/display_list_capture.h"
+#include "flutter/fml/command_line.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/time/time_point.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+
+#ifdef ENABLE_SOFTWARE_BENCHMARKS
+#include "flutter/display_list/display_list_benchmarks_software.h"
+#endif
+#ifdef ENABLE_OPENGL_BENCHMARKS
+#include "flutter/display_list/display_list_benchmarks_gl.h"
+#endif
+#ifdef ENABLE_METAL_BENCHMARKS
+#include "flutter/display_list/display_list_benchmarks_metal.h"
+#endif
+#ifdef ENABLE_VULKAN_BENCHMARKS
+#include "flutter/display_list/display_list_benchmarks_vulkan.h"
+#endif
+
+namespace flutter {
+namespace testing {
+namespace {
+
+constexpr size_t kDefaultIterations = 100;
+
+std::vector<std::unique_ptr<CanvasProvider>> CreateCanvasProviders() {
+  std::vector<std::unique_ptr<CanvasProvider>> providers;
+#ifdef ENABLE_SOFTWARE_BENCHMARKS
+  providers.push_back(std::make_unique<SoftwareCanvasProvider>());
+#endif
+#ifdef ENABLE_OPENGL_BENCHMARKS
+  providers.push_back(std::make_unique<OpenGLCanvasProvider>());
+#endif
+#ifdef ENABLE_METAL_BENCHMARKS
+  providers.push_back(std::make_unique<MetalCanvasProvider>());
+#endif
+#ifdef ENABLE_VULKAN_BENCHMARKS
+  providers.push_back(std::make_unique<VulkanCanvasProvider>());
+#endif
+  return providers;
+}
+
+// Renders the frame as the rasterizer does, and waits for the GPU to finish
+// so that the time includes the work of the backend.
+void RenderFrame(CanvasProvider& provider, const DisplayList& display_list) {
+  auto surface = provider.GetSurface();
+  SkCanvas* canvas = surface->getCanvas();
+  canvas->clear(SK_ColorTRANSPARENT);
+  display_list.RenderTo(canvas);
+  surface->flushAndSubmit(true);
+}
+
+// Returns the time of each replay in milliseconds, in ascending order.
+std::vector<double> ReplayFrame(CanvasProvider& provider,
+                                const DisplayList& display_list,
+                                const SkISize& frame_size,
+                                size_t iterations) {
+  provider.InitializeSurface(frame_size.width(), frame_size.height());
+
+  // The first frame uploads the images and compiles the shaders, which the
+  // engine does once for many frames.
+  RenderFrame(provider, display_list);
+
+  std::vector<double> times;
+  times.reserve(iterations);
+  for (size_t i = 0; i < iterations; i++) {
+    auto start = fml::TimePoint::Now();
+    RenderFrame(provider, display_list);
+    times.push_back((fml::TimePoint::Now() - start).ToMillisecondsF());
+  }
+  std::sort(times.begin(), times.end());
+  return times;
+}
+
+void PrintTimes(const std::string& backend, const std::vector<double>& times) {
+  double sum = 0;
+  for (double time : times) {
+    sum += time;
+  }
+  std::cout << std::left << std::setw(10) << backend << std::right
+            << std::fixed << std::setprecision(3) << " mean "
+            << sum / times.size() << " ms  median " << times[times.size() / 2]
+            << " ms  p90 " << times[times.size() * 9 / 10] << " ms  min "
+            << times.front() << " ms  max " << times.back() << " ms"
+            << std::endl;
+}
+
+int Main(int argc, char** argv) {
+  auto command_line = fml::CommandLineFromArgcArgv(argc, argv);
+  std::string capture_path;
+  if (!command_line.GetOptionValue("capture", &capture_path)) {
+    std::cerr << "Usage: " << argv[0]
+              << " --capture=<path> [--iterations=<n>] [--backend=<name>]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  size_t iterations = kDefaultIterations;
+  std::string iterations_value;
+  if (command_line.GetOptionValue("iterations", &iterations_value)) {
+    iterations = std::strtoul(iterations_value.c_str(), nullptr, 10);
+    if (iterations == 0) {
+      std::cerr << "--iterations must be a positive number." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::string backend_filter;
+  command_line.GetOptionValue("backend", &backend_filter);
+
+  auto mapping = fml::FileMapping::CreateReadOnly(capture_path);
+  if (!mapping) {
+    std::cerr << "Could not open " << capture_path << "." << std::endl;
+    return EXIT_FAILURE;
+  }
+  SkISize frame_size;
+  auto display_list = DisplayListCapture::Deserialize(*mapping, &frame_size);
+  if (!display_list) {
+    std::cerr << capture_path << " is not a valid capture." << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Replaying a " << frame_size.width() << "x"
+            << frame_size.height() << " frame of "
+            << display_list->op_count(true) << " ops " << iterations
+            << " times." << std::endl;
+
+  bool replayed = false;
+  for (auto& provider : CreateCanvasProviders()) {
+    const std::string backend = provider->BackendName();
+    if (!backend_filter.empty() && backend != backend_filter) {
+      continue;
+    }
+    PrintTimes(backend,
+               ReplayFrame(*provider, *display_list, frame_size, iterations));
+    replayed = true;
+  }
+  if (!replayed) {
+    std::cerr << "No backend was available to replay the capture."
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace flutter
+
+int main(int argc, char** argv) {
+  return flutter::testing::Main(argc, argv);
+}
@@ -15,10 +15,10 @@ void DlRTree::insert(const SkRect boundsArray[],
                      int N) {
   FML_DCHECK(0 == all_ops_count_);
   bbh_->insert(boundsArray, metadata, N);
+  rects_.assign(boundsArray, boundsArray + N);
+  is_draw_.resize(N);
   for (int i = 0; i < N; i++) {
-    if (metadata == nullptr || metadata[i].isDraw) {
-      draw_op_[i] = boundsArray[i];
-    }
+    is_draw_[i] = metadata == nullptr || metadata[i].isDraw;
   }
   all_ops_count_ = N;
 }
@@ -39,12 +39,11 @@ std::list<SkRect> DlRTree::searchNonOverlappingDrawnRects(
 
   std::list<SkRect> final_results;
   for (int index : intermediary_results) {
-    auto draw_op = draw_op_.find(index);
     // Ignore records that don't draw anything.
-    if (draw_op == draw_op_.end()) {
+    if (!is_draw_[index]) {
       continue;
     }
-    auto current_record_rect = draw_op->second;
+    auto current_record_rect = rects_[index];
     auto replaced_existing_rect = false;
     // // If the current record rect intersects with any of the rects in the
     // // result list, then join them, and update the rect in final_results.
@@ -79,7 +78,8 @@ std::list<SkRect> DlRTree::searchNonOverlappingDrawnRects(
 }
 
 size_t DlRTree::bytesUsed() const {
-  return bbh_->bytesUsed();
+  return bbh_->bytesUsed() + rects_.capacity() * sizeof(SkRect) +
+         is_draw_.capacity() / 8;
 }
 
 DlRTreeFactory::DlRTreeFactory() {
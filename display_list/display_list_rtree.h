@@ -6,7 +6,7 @@
 #define FLUTTER_DISPLAY_LIST_RTREE_H_
 
 #include <list>
-#include <map>
+#include <vector>
 
 #include "third_party/skia/include/core/SkBBHFactory.h"
 #include "third_party/skia/include/core/SkRect.h"
@@ -44,9 +44,11 @@ class DlRTree : public SkBBoxHierarchy {
   int getCount() const { return all_ops_count_; }
 
  private:
-  // A map containing the draw operation rects keyed off the operation index
-  // in the insert call.
-  std::map<int, SkRect> draw_op_;
+  // The rects from the insert call, and whether each of them is for a draw
+  // operation, indexed by their position in the call. These are much smaller
+  // than a map for the large lists that are worth culling.
+  std::vector<SkRect> rects_;
+  std::vector<bool> is_draw_;
   sk_sp<SkBBoxHierarchy> bbh_;
   int all_ops_count_;
 };
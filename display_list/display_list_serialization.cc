@@ -0,0 +1,1719 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_serialization.h"
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/display_list/display_list_dispatcher.h"
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkSerialProcs.h"
+#include "third_party/skia/include/core/SkTextBlob.h"
+
+namespace flutter {
+
+namespace {
+
+// "FDLS" in little endian byte order.
+constexpr uint32_t kMagic = 0x534c4446;
+
+// Nested DisplayLists and image filters are read recursively, so their depth
+// is limited to protect against malformed data.
+constexpr int kMaxNestingDepth = 64;
+
+// Written in place of an attribute object that is not set.
+constexpr uint32_t kNoAttribute = 0xffffffff;
+
+struct Header {
+  uint32_t magic;
+  uint32_t version;
+};
+
+// The tags that identify each Dispatcher call in the data. Changes to these
+// values, or to the values of the attribute type enums that are written with
+// the attributes, require a new |DisplayListSerializer::kVersion|.
+enum class Tag : uint32_t {
+  kEnd,
+
+  kSetAntiAlias,
+  kSetDither,
+  kSetInvertColors,
+  kSetStyle,
+  kSetColor,
+  kSetStrokeWidth,
+  kSetStrokeMiter,
+  kSetStrokeCap,
+  kSetStrokeJoin,
+  kSetBlendMode,
+  kClearBlender,
+  kSetColorSource,
+  kSetColorFilter,
+  kSetPathEffect,
+  kSetMaskFilter,
+  kSetImageFilter,
+
+  kSave,
+  kSaveLayer,
+  kRestore,
+
+  kTranslate,
+  kScale,
+  kRotate,
+  kSkew,
+  kTransform2DAffine,
+  kTransformFullPerspective,
+  kTransformReset,
+
+  kClipRect,
+  kClipRRect,
+  kClipPath,
+
+  kDrawColor,
+  kDrawPaint,
+  kDrawLine,
+  kDrawRect,
+  kDrawOval,
+  kDrawCircle,
+  kDrawRRect,
+  kDrawDRRect,
+  kDrawPath,
+  kDrawArc,
+  kDrawPoints,
+  kDrawVertices,
+  kDrawImage,
+  kDrawImageRect,
+  kDrawImageNine,
+  kDrawImageLattice,
+  kDrawAtlas,
+  kDrawDisplayList,
+  kDrawTextBlob,
+  kDrawShadow,
+
+  kLast = kDrawShadow,
+};
+
+constexpr size_t Align4(size_t size) {
+  return (size + 3) & ~static_cast<size_t>(3);
+}
+
+// Records Dispatcher calls into the data. Any call that can't be serialized
+// invalidates the writer.
+class SerializingDispatcher final : public Dispatcher {
+ public:
+  SerializingDispatcher(std::vector<uint8_t>& buffer,
+                        const DisplayListSerializer::ImageToId& image_to_id)
+      : buffer_(buffer), image_to_id_(image_to_id) {}
+
+  bool is_valid() const { return valid_; }
+
+  void WriteHeader() {
+    Header header = {kMagic, DisplayListSerializer::kVersion};
+    Write(header);
+  }
+
+  void WriteDisplayList(const DisplayList& display_list) {
+    Write(display_list.cull_rect());
+    display_list.Dispatch(*this);
+    WriteTag(Tag::kEnd);
+  }
+
+  void setAntiAlias(bool aa) override {
+    WriteTag(Tag::kSetAntiAlias);
+    WriteBool(aa);
+  }
+  void setDither(bool dither) override {
+    WriteTag(Tag::kSetDither);
+    WriteBool(dither);
+  }
+  void setInvertColors(bool invert) override {
+    WriteTag(Tag::kSetInvertColors);
+    WriteBool(invert);
+  }
+  void setStyle(DlDrawStyle style) override {
+    WriteTag(Tag::kSetStyle);
+    WriteEnum(style);
+  }
+  void setColor(DlColor color) override {
+    WriteTag(Tag::kSetColor);
+    Write(color);
+  }
+  void setStrokeWidth(float width) override {
+    WriteTag(Tag::kSetStrokeWidth);
+    Write(width);
+  }
+  void setStrokeMiter(float limit) override {
+    WriteTag(Tag::kSetStrokeMiter);
+    Write(limit);
+  }
+  void setStrokeCap(DlStrokeCap cap) override {
+    WriteTag(Tag::kSetStrokeCap);
+    WriteEnum(cap);
+  }
+  void setStrokeJoin(DlStrokeJoin join) override {
+    WriteTag(Tag::kSetStrokeJoin);
+    WriteEnum(join);
+  }
+  void setBlendMode(DlBlendMode mode) override {
+    WriteTag(Tag::kSetBlendMode);
+    WriteEnum(mode);
+  }
+  void setBlender(sk_sp<SkBlender> blender) override {
+    if (blender) {
+      valid_ = false;
+      return;
+    }
+    WriteTag(Tag::kClearBlender);
+  }
+  void setColorSource(const DlColorSource* source) override {
+    WriteTag(Tag::kSetColorSource);
+    WriteColorSource(source);
+  }
+  void setColorFilter(const DlColorFilter* filter) override {
+    WriteTag(Tag::kSetColorFilter);
+    WriteColorFilter(filter);
+  }
+  void setPathEffect(const DlPathEffect* effect) override {
+    WriteTag(Tag::kSetPathEffect);
+    WritePathEffect(effect);
+  }
+  void setMaskFilter(const DlMaskFilter* filter) override {
+    WriteTag(Tag::kSetMaskFilter);
+    WriteMaskFilter(filter);
+  }
+  void setImageFilter(const DlImageFilter* filter) override {
+    WriteTag(Tag::kSetImageFilter);
+    WriteImageFilter(filter);
+  }
+
+  void save() override { WriteTag(Tag::kSave); }
+  void saveLayer(const SkRect* bounds,
+                 const SaveLayerOptions options,
+                 const DlImageFilter* backdrop) override {
+    WriteTag(Tag::kSaveLayer);
+    WriteBool(bounds != nullptr);
+    if (bounds) {
+      Write(*bounds);
+    }
+    // The remaining options are computed anew by the builder.
+    WriteBool(options.renders_with_attributes());
+    WriteImageFilter(backdrop);
+  }
+  void restore() override { WriteTag(Tag::kRestore); }
+
+  void translate(SkScalar tx, SkScalar ty) override {
+    WriteTag(Tag::kTranslate);
+    Write(SkPoint::Make(tx, ty));
+  }
+  void scale(SkScalar sx, SkScalar sy) override {
+    WriteTag(Tag::kScale);
+    Write(SkPoint::Make(sx, sy));
+  }
+  void rotate(SkScalar degrees) override {
+    WriteTag(Tag::kRotate);
+    Write(degrees);
+  }
+  void skew(SkScalar sx, SkScalar sy) override {
+    WriteTag(Tag::kSkew);
+    Write(SkPoint::Make(sx, sy));
+  }
+  // clang-format off
+  void transform2DAffine(SkScalar mxx, SkScalar mxy, SkScalar mxt,
+                         SkScalar myx, SkScalar myy, SkScalar myt) override {
+    WriteTag(Tag::kTransform2DAffine);
+    const SkScalar values[] = {mxx, mxy, mxt,
+                               myx, myy, myt};
+    Write(values);
+  }
+  void transformFullPerspective(
+      SkScalar mxx, SkScalar mxy, SkScalar mxz, SkScalar mxt,
+      SkScalar myx, SkScalar myy, SkScalar myz, SkScalar myt,
+      SkScalar mzx, SkScalar mzy, SkScalar mzz, SkScalar mzt,
+      SkScalar mwx, SkScalar mwy, SkScalar mwz, SkScalar mwt) override {
+    WriteTag(Tag::kTransformFullPerspective);
+    const SkScalar values[] = {mxx, mxy, mxz, mxt,
+                               myx, myy, myz, myt,
+                               mzx, mzy, mzz, mzt,
+                               mwx, mwy, mwz, mwt};
+    Write(values);
+  }
+  // clang-format on
+  void transformReset() override { WriteTag(Tag::kTransformReset); }
+
+  void clipRect(const SkRect& rect, SkClipOp clip_op, bool is_aa) override {
+    WriteTag(Tag::kClipRect);
+    Write(rect);
+    WriteEnum(clip_op);
+    WriteBool(is_aa);
+  }
+  void clipRRect(const SkRRect& rrect, SkClipOp clip_op, bool is_aa) override {
+    WriteTag(Tag::kClipRRect);
+    WriteRRect(rrect);
+    WriteEnum(clip_op);
+    WriteBool(is_aa);
+  }
+  void clipPath(const SkPath& path, SkClipOp clip_op, bool is_aa) override {
+    WriteTag(Tag::kClipPath);
+    WritePath(path);
+    WriteEnum(clip_op);
+    WriteBool(is_aa);
+  }
+
+  void drawColor(DlColor color, DlBlendMode mode) override {
+    WriteTag(Tag::kDrawColor);
+    Write(color);
+    WriteEnum(mode);
+  }
+  void drawPaint() override { WriteTag(Tag::kDrawPaint); }
+  void drawLine(const SkPoint& p0, const SkPoint& p1) override {
+    WriteTag(Tag::kDrawLine);
+    Write(p0);
+    Write(p1);
+  }
+  void drawRect(const SkRect& rect) override {
+    WriteTag(Tag::kDrawRect);
+    Write(rect);
+  }
+  void drawOval(const SkRect& bounds) override {
+    WriteTag(Tag::kDrawOval);
+    Write(bounds);
+  }
+  void drawCircle(const SkPoint& center, SkScalar radius) override {
+    WriteTag(Tag::kDrawCircle);
+    Write(center);
+    Write(radius);
+  }
+  void drawRRect(const SkRRect& rrect) override {
+    WriteTag(Tag::kDrawRRect);
+    WriteRRect(rrect);
+  }
+  void drawDRRect(const SkRRect& outer, const SkRRect& inner) override {
+    WriteTag(Tag::kDrawDRRect);
+    WriteRRect(outer);
+    WriteRRect(inner);
+  }
+  void drawPath(const SkPath& path) override {
+    WriteTag(Tag::kDrawPath);
+    WritePath(path);
+  }
+  void drawArc(const SkRect& oval_bounds,
+               SkScalar start_degrees,
+               SkScalar sweep_degrees,
+               bool use_center) override {
+    WriteTag(Tag::kDrawArc);
+    Write(oval_bounds);
+    Write(start_degrees);
+    Write(sweep_degrees);
+    WriteBool(use_center);
+  }
+  void drawPoints(SkCanvas::PointMode mode,
+                  uint32_t count,
+                  const SkPoint points[]) override {
+    WriteTag(Tag::kDrawPoints);
+    WriteEnum(mode);
+    WriteArray(points, count);
+  }
+  void drawSkVertices(const sk_sp<SkVertices> vertices,
+                      SkBlendMode mode) override {
+    valid_ = false;
+  }
+  void drawVertices(const DlVertices* vertices, DlBlendMode mode) override {
+    WriteTag(Tag::kDrawVertices);
+    WriteEnum(vertices->mode());
+    uint32_t count = vertices->vertex_count();
+    WriteArray(vertices->vertices(), count);
+    WriteOptionalArray(vertices->texture_coordinates(), count);
+    WriteOptionalArray(vertices->colors(), count);
+    WriteArray(vertices->indices(), vertices->index_count());
+    WriteEnum(mode);
+  }
+  void drawImage(const sk_sp<DlImage> image,
+                 const SkPoint point,
+                 DlImageSampling sampling,
+                 bool render_with_attributes) override {
+    WriteTag(Tag::kDrawImage);
+    WriteImage(image.get());
+    Write(point);
+    WriteEnum(sampling);
+    WriteBool(render_with_attributes);
+  }
+  void drawImageRect(const sk_sp<DlImage> image,
+                     const SkRect& src,
+                     const SkRect& dst,
+                     DlImageSampling sampling,
+                     bool render_with_attributes,
+                     SkCanvas::SrcRectConstraint constraint) override {
+    WriteTag(Tag::kDrawImageRect);
+    WriteImage(image.get());
+    Write(src);
+    Write(dst);
+    WriteEnum(sampling);
+    WriteBool(render_with_attributes);
+    WriteEnum(constraint);
+  }
+  void drawImageNine(const sk_sp<DlImage> image,
+                     const SkIRect& center,
+                     const SkRect& dst,
+                     DlFilterMode filter,
+                     bool render_with_attributes) override {
+    WriteTag(Tag::kDrawImageNine);
+    WriteImage(image.get());
+    Write(center);
+    Write(dst);
+    WriteEnum(filter);
+    WriteBool(render_with_attributes);
+  }
+  void drawImageLattice(const sk_sp<DlImage> image,
+                        const SkCanvas::Lattice& lattice,
+                        const SkRect& dst,
+                        DlFilterMode filter,
+                        bool render_with_attributes) override {
+    WriteTag(Tag::kDrawImageLattice);
+    WriteImage(image.get());
+    WriteArray(lattice.fXDivs, lattice.fXCount);
+    WriteArray(lattice.fYDivs, lattice.fYCount);
+    uint32_t cell_count = (lattice.fXCount + 1) * (lattice.fYCount + 1);
+    WriteOptionalArray(lattice.fRectTypes, cell_count);
+    WriteOptionalArray(lattice.fColors, cell_count);
+    WriteBool(lattice.fBounds != nullptr);
+    if (lattice.fBounds) {
+      Write(*lattice.fBounds);
+    }
+    Write(dst);
+    WriteEnum(filter);
+    WriteBool(render_with_attributes);
+  }
+  void drawAtlas(const sk_sp<DlImage> atlas,
+                 const SkRSXform xform[],
+                 const SkRect tex[],
+                 const DlColor colors[],
+                 int count,
+                 DlBlendMode mode,
+                 DlImageSampling sampling,
+                 const SkRect* cull_rect,
+                 bool render_with_attributes) override {
+    WriteTag(Tag::kDrawAtlas);
+    WriteImage(atlas.get());
+    WriteArray(xform, count);
+    WriteArray(tex, count);
+    WriteOptionalArray(colors, count);
+    WriteEnum(mode);
+    WriteEnum(sampling);
+    WriteBool(cull_rect != nullptr);
+    if (cull_rect) {
+      Write(*cull_rect);
+    }
+    WriteBool(render_with_attributes);
+  }
+  void drawPicture(const sk_sp<SkPicture> picture,
+                   const SkMatrix* matrix,
+                   bool render_with_attributes) override {
+    valid_ = false;
+  }
+  void drawDisplayList(const sk_sp<DisplayList> display_list) override {
+    WriteTag(Tag::kDrawDisplayList);
+    WriteDisplayList(*display_list);
+  }
+  void drawTextBlob(const sk_sp<SkTextBlob> blob,
+                    SkScalar x,
+                    SkScalar y) override {
+    WriteTag(Tag::kDrawTextBlob);
+    auto data = blob->serialize(SkSerialProcs());
+    if (!data) {
+      valid_ = false;
+      return;
+    }
+    WriteArray(data->bytes(), data->size());
+    Write(SkPoint::Make(x, y));
+  }
+  void drawShadow(const SkPath& path,
+                  const DlColor color,
+                  const SkScalar elevation,
+                  bool transparent_occluder,
+                  SkScalar dpr) override {
+    WriteTag(Tag::kDrawShadow);
+    WritePath(path);
+    Write(color);
+    Write(elevation);
+    WriteBool(transparent_occluder);
+    Write(dpr);
+  }
+
+ private:
+  std::vector<uint8_t>& buffer_;
+  const DisplayListSerializer::ImageToId& image_to_id_;
+  bool valid_ = true;
+
+  // Appends the bytes followed by zeros up to the next multiple of 4.
+  uint8_t* Append(const void* data, size_t length) {
+    auto offset = buffer_.size();
+    buffer_.resize(offset + Align4(length));
+    auto* dst = buffer_.data() + offset;
+    if (data && length > 0) {
+      memcpy(dst, data, length);
+    }
+    return dst;
+  }
+
+  template <typename T>
+  void Write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    Append(&value, sizeof(T));
+  }
+
+  void WriteTag(Tag tag) { Write(static_cast<uint32_t>(tag)); }
+
+  void WriteBool(bool value) { Write<uint32_t>(value ? 1u : 0u); }
+
+  template <typename E>
+  void WriteEnum(E value) {
+    Write(static_cast<uint32_t>(value));
+  }
+
+  template <typename T>
+  void WriteArray(const T* values, uint32_t count) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    Write(count);
+    Append(values, sizeof(T) * count);
+  }
+
+  template <typename T>
+  void WriteOptionalArray(const T* values, uint32_t count) {
+    WriteBool(values != nullptr);
+    if (values) {
+      WriteArray(values, count);
+    }
+  }
+
+  void WriteMatrix(const SkMatrix& matrix) {
+    SkScalar values[9];
+    matrix.get9(values);
+    Write(values);
+  }
+
+  void WriteRRect(const SkRRect& rrect) {
+    rrect.writeToMemory(Append(nullptr, SkRRect::kSizeInMemory));
+  }
+
+  void WritePath(const SkPath& path) {
+    uint32_t size = path.writeToMemory(nullptr);
+    Write(size);
+    path.writeToMemory(Append(nullptr, size));
+  }
+
+  void WriteImage(const DlImage* image) {
+    if (!image || !image_to_id_) {
+      valid_ = false;
+      return;
+    }
+    Write<uint64_t>(image_to_id_(*image));
+  }
+
+  void WriteGradient(const DlGradientColorSourceBase* gradient) {
+    uint32_t count = gradient->stop_count();
+    WriteArray(gradient->colors(), count);
+    WriteArray(gradient->stops(), count);
+    WriteEnum(gradient->tile_mode());
+    WriteMatrix(gradient->matrix());
+  }
+
+  void WriteColorSource(const DlColorSource* source) {
+    if (!source) {
+      Write(kNoAttribute);
+      return;
+    }
+    WriteEnum(source->type());
+    switch (source->type()) {
+      case DlColorSourceType::kColor:
+        Write(source->asColor()->color());
+        return;
+      case DlColorSourceType::kImage: {
+        auto image = source->asImage();
+        WriteImage(image->image().get());
+        WriteEnum(image->horizontal_tile_mode());
+        WriteEnum(image->vertical_tile_mode());
+        WriteEnum(image->sampling());
+        WriteMatrix(image->matrix());
+        return;
+      }
+      case DlColorSourceType::kLinearGradient: {
+        auto linear = source->asLinearGradient();
+        Write(linear->start_point());
+        Write(linear->end_point());
+        WriteGradient(linear);
+        return;
+      }
+      case DlColorSourceType::kRadialGradient: {
+        auto radial = source->asRadialGradient();
+        Write(radial->center());
+        Write(radial->radius());
+        WriteGradient(radial);
+        return;
+      }
+      case DlColorSourceType::kConicalGradient: {
+        auto conical = source->asConicalGradient();
+        Write(conical->start_center());
+        Write(conical->start_radius());
+        Write(conical->end_center());
+        Write(conical->end_radius());
+        WriteGradient(conical);
+        return;
+      }
+      case DlColorSourceType::kSweepGradient: {
+        auto sweep = source->asSweepGradient();
+        Write(sweep->center());
+        Write(sweep->start());
+        Write(sweep->end());
+        WriteGradient(sweep);
+        return;
+      }
+      case DlColorSourceType::kRuntimeEffect:
+      case DlColorSourceType::kUnknown:
+        valid_ = false;
+        return;
+    }
+  }
+
+  void WriteColorFilter(const DlColorFilter* filter) {
+    if (!filter) {
+      Write(kNoAttribute);
+      return;
+    }
+    WriteEnum(filter->type());
+    switch (filter->type()) {
+      case DlColorFilterType::kBlend:
+        Write(filter->asBlend()->color());
+        WriteEnum(filter->asBlend()->mode());
+        return;
+      case DlColorFilterType::kMatrix: {
+        float matrix[20];
+        filter->asMatrix()->get_matrix(matrix);
+        Write(matrix);
+        return;
+      }
+      case DlColorFilterType::kSrgbToLinearGamma:
+      case DlColorFilterType::kLinearToSrgbGamma:
+        return;
+      case DlColorFilterType::kUnknown:
+        valid_ = false;
+        return;
+    }
+  }
+
+  void WriteImageFilter(const DlImageFilter* filter) {
+    if (!filter) {
+      Write(kNoAttribute);
+      return;
+    }
+    WriteEnum(filter->type());
+    switch (filter->type()) {
+      case DlImageFilterType::kBlur: {
+        auto blur = filter->asBlur();
+        Write(blur->sigma_x());
+        Write(blur->sigma_y());
+        WriteEnum(blur->tile_mode());
+        return;
+      }
+      case DlImageFilterType::kDilate:
+        Write(filter->asDilate()->radius_x());
+        Write(filter->asDilate()->radius_y());
+        return;
+      case DlImageFilterType::kErode:
+        Write(filter->asErode()->radius_x());
+        Write(filter->asErode()->radius_y());
+        return;
+      case DlImageFilterType::kMatrix:
+        WriteMatrix(filter->asMatrix()->matrix());
+        WriteEnum(filter->asMatrix()->sampling());
+        return;
+      case DlImageFilterType::kComposeFilter:
+        WriteImageFilter(filter->asCompose()->outer().get());
+        WriteImageFilter(filter->asCompose()->inner().get());
+        return;
+      case DlImageFilterType::kColorFilter:
+        WriteColorFilter(filter->asColorFilter()->color_filter().get());
+        return;
+      case DlImageFilterType::kLocalMatrixFilter:
+        WriteMatrix(filter->asLocalMatrix()->matrix());
+        WriteImageFilter(filter->asLocalMatrix()->image_filter().get());
+        return;
+      case DlImageFilterType::kUnknown:
+        valid_ = false;
+        return;
+    }
+  }
+
+  void WriteMaskFilter(const DlMaskFilter* filter) {
+    if (!filter) {
+      Write(kNoAttribute);
+      return;
+    }
+    WriteEnum(filter->type());
+    switch (filter->type()) {
+      case DlMaskFilterType::kBlur:
+        WriteEnum(filter->asBlur()->style());
+        Write(filter->asBlur()->sigma());
+        WriteBool(filter->asBlur()->respectCTM());
+        return;
+      case DlMaskFilterType::kUnknown:
+        valid_ = false;
+        return;
+    }
+  }
+
+  void WritePathEffect(const DlPathEffect* effect) {
+    if (!effect) {
+      Write(kNoAttribute);
+      return;
+    }
+    WriteEnum(effect->type());
+    switch (effect->type()) {
+      case DlPathEffectType::kDash:
+        WriteArray(effect->asDash()->intervals(), effect->asDash()->count());
+        Write(effect->asDash()->phase());
+        return;
+      case DlPathEffectType::kUnknown:
+        valid_ = false;
+        return;
+    }
+  }
+
+  FML_DISALLOW_COPY_AND_ASSIGN(SerializingDispatcher);
+};
+
+// Replays the calls in the data into DisplayListBuilders. Every read is
+// bounds checked, and any malformed value fails the whole read.
+class DisplayListReader {
+ public:
+  DisplayListReader(const uint8_t* data,
+                    size_t size,
+                    const DisplayListSerializer::IdToImage& id_to_image)
+      : ptr_(data), end_(data + size), id_to_image_(id_to_image) {}
+
+  bool ReadHeader() {
+    Header header;
+    return Read(&header) && header.magic == kMagic &&
+           header.version == DisplayListSerializer::kVersion;
+  }
+
+  bool AtEnd() const { return ptr_ == end_; }
+
+  sk_sp<DisplayList> ReadDisplayList(int depth) {
+    SkRect cull_rect;
+    if (depth > kMaxNestingDepth || !Read(&cull_rect)) {
+      return nullptr;
+    }
+    DisplayListBuilder builder(cull_rect);
+    while (true) {
+      uint32_t tag;
+      if (!Read(&tag) || tag > static_cast<uint32_t>(Tag::kLast)) {
+        return nullptr;
+      }
+      if (static_cast<Tag>(tag) == Tag::kEnd) {
+        return builder.Build();
+      }
+      if (!ReadOp(builder, static_cast<Tag>(tag), depth)) {
+        return nullptr;
+      }
+    }
+  }
+
+ private:
+  const uint8_t* ptr_;
+  const uint8_t* const end_;
+  const DisplayListSerializer::IdToImage& id_to_image_;
+
+  bool Skip(size_t length) {
+    if (static_cast<size_t>(end_ - ptr_) < Align4(length)) {
+      return false;
+    }
+    ptr_ += Align4(length);
+    return true;
+  }
+
+  template <typename T>
+  bool Read(T* value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto src = ptr_;
+    if (!Skip(sizeof(T))) {
+      return false;
+    }
+    memcpy(value, src, sizeof(T));
+    return true;
+  }
+
+  bool ReadBool(bool* value) {
+    uint32_t raw;
+    if (!Read(&raw) || raw > 1u) {
+      return false;
+    }
+    *value = raw == 1u;
+    return true;
+  }
+
+  template <typename E>
+  bool ReadEnum(E* value, E last) {
+    uint32_t raw;
+    if (!Read(&raw) || raw > static_cast<uint32_t>(last)) {
+      return false;
+    }
+    *value = static_cast<E>(raw);
+    return true;
+  }
+
+  // Points |values| at the array in the data without copying it.
+  template <typename T>
+  bool ReadArray(const T** values, uint32_t* count) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    static_assert(alignof(T) <= 4);
+    if (!Read(count) ||
+        *count > static_cast<size_t>(end_ - ptr_) / sizeof(T)) {
+      return false;
+    }
+    *values = reinterpret_cast<const T*>(ptr_);
+    return Skip(sizeof(T) * *count);
+  }
+
+  // Reads an array that must have |expected_count| entries if it is present.
+  template <typename T>
+  bool ReadOptionalArray(const T** values, uint32_t expected_count) {
+    bool present;
+    if (!ReadBool(&present)) {
+      return false;
+    }
+    if (!present) {
+      *values = nullptr;
+      return true;
+    }
+    uint32_t count;
+    return ReadArray(values, &count) && count == expected_count;
+  }
+
+  bool ReadMatrix(SkMatrix* matrix) {
+    SkScalar values[9];
+    if (!Read(&values)) {
+      return false;
+    }
+    matrix->set9(values);
+    return true;
+  }
+
+  bool ReadRRect(SkRRect* rrect) {
+    auto src = ptr_;
+    return Skip(SkRRect::kSizeInMemory) &&
+           rrect->readFromMemory(src, SkRRect::kSizeInMemory) ==
+               SkRRect::kSizeInMemory;
+  }
+
+  bool ReadPath(SkPath* path) {
+    uint32_t size;
+    if (!Read(&size)) {
+      return false;
+    }
+    auto src = ptr_;
+    return Skip(size) && path->readFromMemory(src, size) == size;
+  }
+
+  bool ReadImage(sk_sp<DlImage>* image) {
+    uint64_t id;
+    if (!Read(&id) || !id_to_image_) {
+      return false;
+    }
+    *image = id_to_image_(id);
+    return *image != nullptr;
+  }
+
+  // Reads the type of an attribute object, which is |kNoAttribute| if it is
+  // not set.
+  template <typename E>
+  bool ReadAttributeType(E* type, bool* present) {
+    uint32_t raw;
+    if (!Read(&raw)) {
+      return false;
+    }
+    *present = raw != kNoAttribute;
+    if (!*present) {
+      return true;
+    }
+    // The kUnknown types are never written.
+    if (raw >= static_cast<uint32_t>(E::kUnknown)) {
+      return false;
+    }
+    *type = static_cast<E>(raw);
+    return true;
+  }
+
+  struct Gradient {
+    uint32_t stop_count;
+    const DlColor* colors;
+    const float* stops;
+    DlTileMode tile_mode;
+    SkMatrix matrix;
+  };
+
+  bool ReadGradient(Gradient* gradient) {
+    uint32_t stop_count;
+    return ReadArray(&gradient->colors, &gradient->stop_count) &&
+           ReadArray(&gradient->stops, &stop_count) &&
+           stop_count == gradient->stop_count &&
+           ReadEnum(&gradient->tile_mode, DlTileMode::kDecal) &&
+           ReadMatrix(&gradient->matrix);
+  }
+
+  bool ReadColorSource(std::shared_ptr<DlColorSource>* source) {
+    DlColorSourceType type;
+    bool present;
+    if (!ReadAttributeType(&type, &present)) {
+      return false;
+    }
+    if (!present) {
+      *source = nullptr;
+      return true;
+    }
+    switch (type) {
+      case DlColorSourceType::kColor: {
+        DlColor color;
+        if (!Read(&color)) {
+          return false;
+        }
+        *source = std::make_shared<DlColorColorSource>(color);
+        return true;
+      }
+      case DlColorSourceType::kImage: {
+        sk_sp<DlImage> image;
+        DlTileMode horizontal_tile_mode;
+        DlTileMode vertical_tile_mode;
+        DlImageSampling sampling;
+        SkMatrix matrix;
+        if (!ReadImage(&image) ||
+            !ReadEnum(&horizontal_tile_mode, DlTileMode::kDecal) ||
+            !ReadEnum(&vertical_tile_mode, DlTileMode::kDecal) ||
+            !ReadEnum(&sampling, DlImageSampling::kCubic) ||
+            !ReadMatrix(&matrix)) {
+          return false;
+        }
+        *source = std::make_shared<DlImageColorSource>(
+            image, horizontal_tile_mode, vertical_tile_mode, sampling, &matrix);
+        return true;
+      }
+      case DlColorSourceType::kLinearGradient: {
+        SkPoint start_point;
+        SkPoint end_point;
+        Gradient gradient;
+        if (!Read(&start_point) || !Read(&end_point) ||
+            !ReadGradient(&gradient)) {
+          return false;
+        }
+        *source = DlColorSource::MakeLinear(
+            start_point, end_point, gradient.stop_count, gradient.colors,
+            gradient.stops, gradient.tile_mode, &gradient.matrix);
+        return true;
+      }
+      case DlColorSourceType::kRadialGradient: {
+        SkPoint center;
+        SkScalar radius;
+        Gradient gradient;
+        if (!Read(&center) || !Read(&radius) || !ReadGradient(&gradient)) {
+          return false;
+        }
+        *source = DlColorSource::MakeRadial(
+            center, radius, gradient.stop_count, gradient.colors,
+            gradient.stops, gradient.tile_mode, &gradient.matrix);
+        return true;
+      }
+      case DlColorSourceType::kConicalGradient: {
+        SkPoint start_center;
+        SkScalar start_radius;
+        SkPoint end_center;
+        SkScalar end_radius;
+        Gradient gradient;
+        if (!Read(&start_center) || !Read(&start_radius) ||
+            !Read(&end_center) || !Read(&end_radius) ||
+            !ReadGradient(&gradient)) {
+          return false;
+        }
+        *source = DlColorSource::MakeConical(
+            start_center, start_radius, end_center, end_radius,
+            gradient.stop_count, gradient.colors, gradient.stops,
+            gradient.tile_mode, &gradient.matrix);
+        return true;
+      }
+      case DlColorSourceType::kSweepGradient: {
+        SkPoint center;
+        SkScalar start;
+        SkScalar end;
+        Gradient gradient;
+        if (!Read(&center) || !Read(&start) || !Read(&end) ||
+            !ReadGradient(&gradient)) {
+          return false;
+        }
+        *source = DlColorSource::MakeSweep(
+            center, start, end, gradient.stop_count, gradient.colors,
+            gradient.stops, gradient.tile_mode, &gradient.matrix);
+        return true;
+      }
+      case DlColorSourceType::kRuntimeEffect:
+      case DlColorSourceType::kUnknown:
+        return false;
+    }
+    return false;
+  }
+
+  bool ReadColorFilter(std::shared_ptr<DlColorFilter>* filter) {
+    DlColorFilterType type;
+    bool present;
+    if (!ReadAttributeType(&type, &present)) {
+      return false;
+    }
+    if (!present) {
+      *filter = nullptr;
+      return true;
+    }
+    switch (type) {
+      case DlColorFilterType::kBlend: {
+        DlColor color;
+        DlBlendMode mode;
+        if (!Read(&color) || !ReadEnum(&mode, DlBlendMode::kLastMode)) {
+          return false;
+        }
+        *filter = std::make_shared<DlBlendColorFilter>(color, mode);
+        return true;
+      }
+      case DlColorFilterType::kMatrix: {
+        float matrix[20];
+        if (!Read(&matrix)) {
+          return false;
+        }
+        *filter = std::make_shared<DlMatrixColorFilter>(matrix);
+        return true;
+      }
+      case DlColorFilterType::kSrgbToLinearGamma:
+        *filter = DlSrgbToLinearGammaColorFilter::instance;
+        return true;
+      case DlColorFilterType::kLinearToSrgbGamma:
+        *filter = DlLinearToSrgbGammaColorFilter::instance;
+        return true;
+      case DlColorFilterType::kUnknown:
+        return false;
+    }
+    return false;
+  }
+
+  bool ReadImageFilter(std::shared_ptr<DlImageFilter>* filter, int depth) {
+    DlImageFilterType type;
+    bool present;
+    if (depth > kMaxNestingDepth || !ReadAttributeType(&type, &present)) {
+      return false;
+    }
+    if (!present) {
+      *filter = nullptr;
+      return true;
+    }
+    switch (type) {
+      case DlImageFilterType::kBlur: {
+        SkScalar sigma_x;
+        SkScalar sigma_y;
+        DlTileMode tile_mode;
+        if (!Read(&sigma_x) || !Read(&sigma_y) ||
+            !ReadEnum(&tile_mode, DlTileMode::kDecal)) {
+          return false;
+        }
+        *filter =
+            std::make_shared<DlBlurImageFilter>(sigma_x, sigma_y, tile_mode);
+        return true;
+      }
+      case DlImageFilterType::kDilate: {
+        SkScalar radius_x;
+        SkScalar radius_y;
+        if (!Read(&radius_x) || !Read(&radius_y)) {
+          return false;
+        }
+        *filter = std::make_shared<DlDilateImageFilter>(radius_x, radius_y);
+        return true;
+      }
+      case DlImageFilterType::kErode: {
+        SkScalar radius_x;
+        SkScalar radius_y;
+        if (!Read(&radius_x) || !Read(&radius_y)) {
+          return false;
+        }
+        *filter = std::make_shared<DlErodeImageFilter>(radius_x, radius_y);
+        return true;
+      }
+      case DlImageFilterType::kMatrix: {
+        SkMatrix matrix;
+        DlImageSampling sampling;
+        if (!ReadMatrix(&matrix) ||
+            !ReadEnum(&sampling, DlImageSampling::kCubic)) {
+          return false;
+        }
+        *filter = std::make_shared<DlMatrixImageFilter>(matrix, sampling);
+        return true;
+      }
+      case DlImageFilterType::kComposeFilter: {
+        std::shared_ptr<DlImageFilter> outer;
+        std::shared_ptr<DlImageFilter> inner;
+        if (!ReadImageFilter(&outer, depth + 1) || !outer ||
+            !ReadImageFilter(&inner, depth + 1) || !inner) {
+          return false;
+        }
+        *filter = std::make_shared<DlComposeImageFilter>(outer, inner);
+        return true;
+      }
+      case DlImageFilterType::kColorFilter: {
+        std::shared_ptr<DlColorFilter> color_filter;
+        if (!ReadColorFilter(&color_filter) || !color_filter) {
+          return false;
+        }
+        *filter = std::make_shared<DlColorFilterImageFilter>(color_filter);
+        return true;
+      }
+      case DlImageFilterType::kLocalMatrixFilter: {
+        SkMatrix matrix;
+        std::shared_ptr<DlImageFilter> image_filter;
+        if (!ReadMatrix(&matrix) ||
+            !ReadImageFilter(&image_filter, depth + 1) || !image_filter) {
+          return false;
+        }
+        *filter =
+            std::make_shared<DlLocalMatrixImageFilter>(matrix, image_filter);
+        return true;
+      }
+      case DlImageFilterType::kUnknown:
+        return false;
+    }
+    return false;
+  }
+
+  bool ReadMaskFilter(std::shared_ptr<DlMaskFilter>* filter) {
+    DlMaskFilterType type;
+    bool present;
+    if (!ReadAttributeType(&type, &present)) {
+      return false;
+    }
+    if (!present) {
+      *filter = nullptr;
+      return true;
+    }
+    switch (type) {
+      case DlMaskFilterType::kBlur: {
+        SkBlurStyle style;
+        SkScalar sigma;
+        bool respect_ctm;
+        if (!ReadEnum(&style, kLastEnum_SkBlurStyle) || !Read(&sigma) ||
+            !ReadBool(&respect_ctm)) {
+          return false;
+        }
+        *filter = std::make_shared<DlBlurMaskFilter>(style, sigma, respect_ctm);
+        return true;
+      }
+      case DlMaskFilterType::kUnknown:
+        return false;
+    }
+    return false;
+  }
+
+  bool ReadPathEffect(std::shared_ptr<DlPathEffect>* effect) {
+    DlPathEffectType type;
+    bool present;
+    if (!ReadAttributeType(&type, &present)) {
+      return false;
+    }
+    if (!present) {
+      *effect = nullptr;
+      return true;
+    }
+    switch (type) {
+      case DlPathEffectType::kDash: {
+        const SkScalar* intervals;
+        uint32_t count;
+        SkScalar phase;
+        if (!ReadArray(&intervals, &count) || !Read(&phase)) {
+          return false;
+        }
+        *effect = DlDashPathEffect::Make(intervals, count, phase);
+        return true;
+      }
+      case DlPathEffectType::kUnknown:
+        return false;
+    }
+    return false;
+  }
+
+  bool ReadOp(DisplayListBuilder& builder, Tag tag, int depth) {
+    switch (tag) {
+      case Tag::kEnd:
+        return false;
+
+      case Tag::kSetAntiAlias: {
+        bool aa;
+        if (!ReadBool(&aa)) {
+          return false;
+        }
+        builder.setAntiAlias(aa);
+        return true;
+      }
+      case Tag::kSetDither: {
+        bool dither;
+        if (!ReadBool(&dither)) {
+          return false;
+        }
+        builder.setDither(dither);
+        return true;
+      }
+      case Tag::kSetInvertColors: {
+        bool invert;
+        if (!ReadBool(&invert)) {
+          return false;
+        }
+        builder.setInvertColors(invert);
+        return true;
+      }
+      case Tag::kSetStyle: {
+        DlDrawStyle style;
+        if (!ReadEnum(&style, DlDrawStyle::kLastStyle)) {
+          return false;
+        }
+        builder.setStyle(style);
+        return true;
+      }
+      case Tag::kSetColor: {
+        DlColor color;
+        if (!Read(&color)) {
+          return false;
+        }
+        builder.setColor(color);
+        return true;
+      }
+      case Tag::kSetStrokeWidth: {
+        float width;
+        if (!Read(&width)) {
+          return false;
+        }
+        builder.setStrokeWidth(width);
+        return true;
+      }
+      case Tag::kSetStrokeMiter: {
+        float limit;
+        if (!Read(&limit)) {
+          return false;
+        }
+        builder.setStrokeMiter(limit);
+        return true;
+      }
+      case Tag::kSetStrokeCap: {
+        DlStrokeCap cap;
+        if (!ReadEnum(&cap, DlStrokeCap::kLastCap)) {
+          return false;
+        }
+        builder.setStrokeCap(cap);
+        return true;
+      }
+      case Tag::kSetStrokeJoin: {
+        DlStrokeJoin join;
+        if (!ReadEnum(&join, DlStrokeJoin::kLastJoin)) {
+          return false;
+        }
+        builder.setStrokeJoin(join);
+        return true;
+      }
+      case Tag::kSetBlendMode: {
+        DlBlendMode mode;
+        if (!ReadEnum(&mode, DlBlendMode::kLastMode)) {
+          return false;
+        }
+        builder.setBlendMode(mode);
+        return true;
+      }
+      case Tag::kClearBlender:
+        builder.setBlender(nullptr);
+        return true;
+      case Tag::kSetColorSource: {
+        std::shared_ptr<DlColorSource> source;
+        if (!ReadColorSource(&source)) {
+          return false;
+        }
+        builder.setColorSource(source.get());
+        return true;
+      }
+      case Tag::kSetColorFilter: {
+        std::shared_ptr<DlColorFilter> filter;
+        if (!ReadColorFilter(&filter)) {
+          return false;
+        }
+        builder.setColorFilter(filter.get());
+        return true;
+      }
+      case Tag::kSetPathEffect: {
+        std::shared_ptr<DlPathEffect> effect;
+        if (!ReadPathEffect(&effect)) {
+          return false;
+        }
+        builder.setPathEffect(effect.get());
+        return true;
+      }
+      case Tag::kSetMaskFilter: {
+        std::shared_ptr<DlMaskFilter> filter;
+        if (!ReadMaskFilter(&filter)) {
+          return false;
+        }
+        builder.setMaskFilter(filter.get());
+        return true;
+      }
+      case Tag::kSetImageFilter: {
+        std::shared_ptr<DlImageFilter> filter;
+        if (!ReadImageFilter(&filter, depth)) {
+          return false;
+        }
+        builder.setImageFilter(filter.get());
+        return true;
+      }
+
+      case Tag::kSave:
+        builder.save();
+        return true;
+      case Tag::kSaveLayer: {
+        bool has_bounds;
+        SkRect bounds;
+        bool renders_with_attributes;
+        std::shared_ptr<DlImageFilter> backdrop;
+        if (!ReadBool(&has_bounds) || (has_bounds && !Read(&bounds)) ||
+            !ReadBool(&renders_with_attributes) ||
+            !ReadImageFilter(&backdrop, depth)) {
+          return false;
+        }
+        builder.saveLayer(has_bounds ? &bounds : nullptr,
+                          renders_with_attributes
+                              ? SaveLayerOptions::kWithAttributes
+                              : SaveLayerOptions::kNoAttributes,
+                          backdrop.get());
+        return true;
+      }
+      case Tag::kRestore:
+        builder.restore();
+        return true;
+
+      case Tag::kTranslate: {
+        SkPoint t;
+        if (!Read(&t)) {
+          return false;
+        }
+        builder.translate(t.fX, t.fY);
+        return true;
+      }
+      case Tag::kScale: {
+        SkPoint s;
+        if (!Read(&s)) {
+          return false;
+        }
+        builder.scale(s.fX, s.fY);
+        return true;
+      }
+      case Tag::kRotate: {
+        SkScalar degrees;
+        if (!Read(&degrees)) {
+          return false;
+        }
+        builder.rotate(degrees);
+        return true;
+      }
+      case Tag::kSkew: {
+        SkPoint s;
+        if (!Read(&s)) {
+          return false;
+        }
+        builder.skew(s.fX, s.fY);
+        return true;
+      }
+      case Tag::kTransform2DAffine: {
+        SkScalar m[6];
+        if (!Read(&m)) {
+          return false;
+        }
+        builder.transform2DAffine(m[0], m[1], m[2], m[3], m[4], m[5]);
+        return true;
+      }
+      case Tag::kTransformFullPerspective: {
+        SkScalar m[16];
+        if (!Read(&m)) {
+          return false;
+        }
+        // clang-format off
+        builder.transformFullPerspective(m[0],  m[1],  m[2],  m[3],
+                                         m[4],  m[5],  m[6],  m[7],
+                                         m[8],  m[9],  m[10], m[11],
+                                         m[12], m[13], m[14], m[15]);
+        // clang-format on
+        return true;
+      }
+      case Tag::kTransformReset:
+        builder.transformReset();
+        return true;
+
+      case Tag::kClipRect: {
+        SkRect rect;
+        SkClipOp clip_op;
+        bool is_aa;
+        if (!Read(&rect) || !ReadEnum(&clip_op, SkClipOp::kMax_EnumValue) ||
+            !ReadBool(&is_aa)) {
+          return false;
+        }
+        builder.clipRect(rect, clip_op, is_aa);
+        return true;
+      }
+      case Tag::kClipRRect: {
+        SkRRect rrect;
+        SkClipOp clip_op;
+        bool is_aa;
+        if (!ReadRRect(&rrect) ||
+            !ReadEnum(&clip_op, SkClipOp::kMax_EnumValue) ||
+            !ReadBool(&is_aa)) {
+          return false;
+        }
+        builder.clipRRect(rrect, clip_op, is_aa);
+        return true;
+      }
+      case Tag::kClipPath: {
+        SkPath path;
+        SkClipOp clip_op;
+        bool is_aa;
+        if (!ReadPath(&path) ||
+            !ReadEnum(&clip_op, SkClipOp::kMax_EnumValue) ||
+            !ReadBool(&is_aa)) {
+          return false;
+        }
+        builder.clipPath(path, clip_op, is_aa);
+        return true;
+      }
+
+      case Tag::kDrawColor: {
+        DlColor color;
+        DlBlendMode mode;
+        if (!Read(&color) || !ReadEnum(&mode, DlBlendMode::kLastMode)) {
+          return false;
+        }
+        builder.drawColor(color, mode);
+        return true;
+      }
+      case Tag::kDrawPaint:
+        builder.drawPaint();
+        return true;
+      case Tag::kDrawLine: {
+        SkPoint p0;
+        SkPoint p1;
+        if (!Read(&p0) || !Read(&p1)) {
+          return false;
+        }
+        builder.drawLine(p0, p1);
+        return true;
+      }
+      case Tag::kDrawRect: {
+        SkRect rect;
+        if (!Read(&rect)) {
+          return false;
+        }
+        builder.drawRect(rect);
+        return true;
+      }
+      case Tag::kDrawOval: {
+        SkRect bounds;
+        if (!Read(&bounds)) {
+          return false;
+        }
+        builder.drawOval(bounds);
+        return true;
+      }
+      case Tag::kDrawCircle: {
+        SkPoint center;
+        SkScalar radius;
+        if (!Read(&center) || !Read(&radius)) {
+          return false;
+        }
+        builder.drawCircle(center, radius);
+        return true;
+      }
+      case Tag::kDrawRRect: {
+        SkRRect rrect;
+        if (!ReadRRect(&rrect)) {
+          return false;
+        }
+        builder.drawRRect(rrect);
+        return true;
+      }
+      case Tag::kDrawDRRect: {
+        SkRRect outer;
+        SkRRect inner;
+        if (!ReadRRect(&outer) || !ReadRRect(&inner)) {
+          return false;
+        }
+        builder.drawDRRect(outer, inner);
+        return true;
+      }
+      case Tag::kDrawPath: {
+        SkPath path;
+        if (!ReadPath(&path)) {
+          return false;
+        }
+        builder.drawPath(path);
+        return true;
+      }
+      case Tag::kDrawArc: {
+        SkRect bounds;
+        SkScalar start_degrees;
+        SkScalar sweep_degrees;
+        bool use_center;
+        if (!Read(&bounds) || !Read(&start_degrees) || !Read(&sweep_degrees) ||
+            !ReadBool(&use_center)) {
+          return false;
+        }
+        builder.drawArc(bounds, start_degrees, sweep_degrees, use_center);
+        return true;
+      }
+      case Tag::kDrawPoints: {
+        SkCanvas::PointMode mode;
+        const SkPoint* points;
+        uint32_t count;
+        if (!ReadEnum(&mode, SkCanvas::kPolygon_PointMode) ||
+            !ReadArray(&points, &count) ||
+            count > static_cast<uint32_t>(Dispatcher::kMaxDrawPointsCount)) {
+          return false;
+        }
+        builder.drawPoints(mode, count, points);
+        return true;
+      }
+      case Tag::kDrawVertices: {
+        DlVertexMode vertex_mode;
+        const SkPoint* vertices;
+        uint32_t vertex_count;
+        const SkPoint* texture_coordinates;
+        const DlColor* colors;
+        const uint16_t* indices;
+        uint32_t index_count;
+        DlBlendMode mode;
+        if (!ReadEnum(&vertex_mode, DlVertexMode::kTriangleFan) ||
+            !ReadArray(&vertices, &vertex_count) ||
+            !ReadOptionalArray(&texture_coordinates, vertex_count) ||
+            !ReadOptionalArray(&colors, vertex_count) ||
+            !ReadArray(&indices, &index_count) ||
+            !ReadEnum(&mode, DlBlendMode::kLastMode)) {
+          return false;
+        }
+        auto dl_vertices =
+            DlVertices::Make(vertex_mode, vertex_count, vertices,
+                             texture_coordinates, colors, index_count, indices);
+        builder.drawVertices(dl_vertices.get(), mode);
+        return true;
+      }
+      case Tag::kDrawImage: {
+        sk_sp<DlImage> image;
+        SkPoint point;
+        DlImageSampling sampling;
+        bool render_with_attributes;
+        if (!ReadImage(&image) || !Read(&point) ||
+            !ReadEnum(&sampling, DlImageSampling::kCubic) ||
+            !ReadBool(&render_with_attributes)) {
+          return false;
+        }
+        builder.drawImage(image, point, sampling, render_with_attributes);
+        return true;
+      }
+      case Tag::kDrawImageRect: {
+        sk_sp<DlImage> image;
+        SkRect src;
+        SkRect dst;
+        DlImageSampling sampling;
+        bool render_with_attributes;
+        SkCanvas::SrcRectConstraint constraint;
+        if (!ReadImage(&image) || !Read(&src) || !Read(&dst) ||
+            !ReadEnum(&sampling, DlImageSampling::kCubic) ||
+            !ReadBool(&render_with_attributes) ||
+            !ReadEnum(&constraint, SkCanvas::kFast_SrcRectConstraint)) {
+          return false;
+        }
+        builder.drawImageRect(image, src, dst, sampling,
+                              render_with_attributes, constraint);
+        return true;
+      }
+      case Tag::kDrawImageNine: {
+        sk_sp<DlImage> image;
+        SkIRect center;
+        SkRect dst;
+        DlFilterMode filter;
+        bool render_with_attributes;
+        if (!ReadImage(&image) || !Read(&center) || !Read(&dst) ||
+            !ReadEnum(&filter, DlFilterMode::kLast) ||
+            !ReadBool(&render_with_attributes)) {
+          return false;
+        }
+        builder.drawImageNine(image, center, dst, filter,
+                              render_with_attributes);
+        return true;
+      }
+      case Tag::kDrawImageLattice: {
+        sk_sp<DlImage> image;
+        const int* x_divs;
+        uint32_t x_count;
+        const int* y_divs;
+        uint32_t y_count;
+        if (!ReadImage(&image) || !ReadArray(&x_divs, &x_count) ||
+            !ReadArray(&y_divs, &y_count)) {
+          return false;
+        }
+        uint64_t cells = (x_count + 1ull) * (y_count + 1ull);
+        if (cells > UINT32_MAX) {
+          return false;
+        }
+        uint32_t cell_count = static_cast<uint32_t>(cells);
+        const SkCanvas::Lattice::RectType* rect_types;
+        const SkColor* colors;
+        bool has_bounds;
+        SkIRect bounds;
+        SkRect dst;
+        DlFilterMode filter;
+        bool render_with_attributes;
+        if (!ReadOptionalArray(&rect_types, cell_count) ||
+            !ReadOptionalArray(&colors, cell_count) ||
+            !ReadBool(&has_bounds) || (has_bounds && !Read(&bounds)) ||
+            !Read(&dst) || !ReadEnum(&filter, DlFilterMode::kLast) ||
+            !ReadBool(&render_with_attributes)) {
+          return false;
+        }
+        if (rect_types) {
+          for (uint32_t i = 0; i < cell_count; i++) {
+            if (rect_types[i] > SkCanvas::Lattice::kFixedColor) {
+              return false;
+            }
+          }
+        }
+        SkCanvas::Lattice lattice;
+        lattice.fXDivs = x_divs;
+        lattice.fYDivs = y_divs;
+        lattice.fRectTypes = rect_types;
+        lattice.fXCount = static_cast<int>(x_count);
+        lattice.fYCount = static_cast<int>(y_count);
+        lattice.fBounds = has_bounds ? &bounds : nullptr;
+        lattice.fColors = colors;
+        builder.drawImageLattice(image, lattice, dst, filter,
+                                 render_with_attributes);
+        return true;
+      }
+      case Tag::kDrawAtlas: {
+        sk_sp<DlImage> atlas;
+        const SkRSXform* xforms;
+        uint32_t count;
+        const SkRect* tex;
+        uint32_t tex_count;
+        const DlColor* colors;
+        DlBlendMode mode;
+        DlImageSampling sampling;
+        bool has_cull_rect;
+        SkRect cull_rect;
+        bool render_with_attributes;
+        if (!ReadImage(&atlas) || !ReadArray(&xforms, &count) ||
+            !ReadArray(&tex, &tex_count) || tex_count != count ||
+            !ReadOptionalArray(&colors, count) ||
+            !ReadEnum(&mode, DlBlendMode::kLastMode) ||
+            !ReadEnum(&sampling, DlImageSampling::kCubic) ||
+            !ReadBool(&has_cull_rect) ||
+            (has_cull_rect && !Read(&cull_rect)) ||
+            !ReadBool(&render_with_attributes)) {
+          return false;
+        }
+        builder.drawAtlas(atlas, xforms, tex, colors, count, mode, sampling,
+                          has_cull_rect ? &cull_rect : nullptr,
+                          render_with_attributes);
+        return true;
+      }
+      case Tag::kDrawDisplayList: {
+        auto display_list = ReadDisplayList(depth + 1);
+        if (!display_list) {
+          return false;
+        }
+        builder.drawDisplayList(display_list);
+        return true;
+      }
+      case Tag::kDrawTextBlob: {
+        const uint8_t* data;
+        uint32_t size;
+        SkPoint origin;
+        if (!ReadArray(&data, &size) || !Read(&origin)) {
+          return false;
+        }
+        auto blob = SkTextBlob::Deserialize(data, size, SkDeserialProcs());
+        if (!blob) {
+          return false;
+        }
+        builder.drawTextBlob(blob, origin.fX, origin.fY);
+        return true;
+      }
+      case Tag::kDrawShadow: {
+        SkPath path;
+        DlColor color;
+        SkScalar elevation;
+        bool transparent_occluder;
+        SkScalar dpr;
+        if (!ReadPath(&path) || !Read(&color) || !Read(&elevation) ||
+            !ReadBool(&transparent_occluder) || !Read(&dpr)) {
+          return false;
+        }
+        builder.drawShadow(path, color, elevation, transparent_occluder, dpr);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DisplayListReader);
+};
+
+}  // namespace
+
+std::unique_ptr<fml::Mapping> DisplayListSerializer::Serialize(
+    const DisplayList& display_list,
+    const ImageToId& image_to_id) {
+  std::vector<uint8_t> buffer;
+  // The serialized form is usually smaller than the ops, which hold pointers
+  // and padding.
+  buffer.reserve(display_list.bytes());
+  SerializingDispatcher writer(buffer, image_to_id);
+  writer.WriteHeader();
+  writer.WriteDisplayList(display_list);
+  if (!writer.is_valid()) {
+    return nullptr;
+  }
+  return std::make_unique<fml::DataMapping>(std::move(buffer));
+}
+
+sk_sp<DisplayList> DisplayListSerializer::Deserialize(
+    const fml::Mapping& mapping,
+    const IdToImage& id_to_image) {
+  const uint8_t* data = mapping.GetMapping();
+  size_t size = mapping.GetSize();
+  if (!data) {
+    return nullptr;
+  }
+
+  // Arrays are read in place, which requires the data to be 4-byte aligned
+  // like it was when it was written.
+  std::vector<uint32_t> aligned_copy;
+  if (reinterpret_cast<uintptr_t>(data) % 4 != 0) {
+    aligned_copy.resize(Align4(size) / 4);
+    memcpy(aligned_copy.data(), data, size);
+    data = reinterpret_cast<const uint8_t*>(aligned_copy.data());
+  }
+
+  DisplayListReader reader(data, size, id_to_image);
+  if (!reader.ReadHeader()) {
+    return nullptr;
+  }
+  auto display_list = reader.ReadDisplayList(0);
+  if (!display_list || !reader.AtEnd()) {
+    return nullptr;
+  }
+  return display_list;
+}
+
+}  // namespace flutter
@@ -0,0 +1,65 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SERIALIZATION_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SERIALIZATION_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_image.h"
+#include "flutter/fml/mapping.h"
+
+// A binary format for persisting and transporting DisplayLists.
+//
+// The format is a header followed by the sequence of Dispatcher calls that
+// make up the DisplayList. Every call is written as a 32-bit tag followed by
+// its arguments, and attribute objects such as DlColorSource or DlImageFilter
+// are written inline by value. All values are 4-byte aligned and stored in
+// the byte order of the host. The data contains no pointers, so it can be
+// loaded from any address, such as a memory mapped file.
+//
+// Images are not written. Each image is replaced with an ID provided by the
+// caller, which must be resolved back to an image when the data is read.
+//
+// Content that wraps opaque Skia objects (SkPicture, SkVertices, SkBlender,
+// the kUnknown attribute types) and runtime effects can't be serialized.
+
+namespace flutter {
+
+class DisplayListSerializer {
+ public:
+  // The version of the format, which is stored in the header. Data from
+  // other versions is rejected.
+  static constexpr uint32_t kVersion = 1;
+
+  // Returns the ID that an image is stored as.
+  using ImageToId = std::function<uint64_t(const DlImage& image)>;
+
+  // Returns the image for an ID that was stored, or nullptr if it is not
+  // known.
+  using IdToImage = std::function<sk_sp<DlImage>(uint64_t id)>;
+
+  // Returns the serialized form of the DisplayList, or nullptr if it contains
+  // content that can't be serialized. The |image_to_id| callback may only be
+  // omitted if the DisplayList contains no images.
+  static std::unique_ptr<fml::Mapping> Serialize(
+      const DisplayList& display_list,
+      const ImageToId& image_to_id = nullptr);
+
+  // Returns the DisplayList read from the mapping, or nullptr if the data is
+  // malformed, of a different version, or refers to an unknown image.
+  //
+  // The ops are read directly from the mapping without copying it first.
+  // Arrays such as point lists and vertex data are handed to the recording
+  // DisplayListBuilder in place.
+  static sk_sp<DisplayList> Deserialize(const fml::Mapping& mapping,
+                                        const IdToImage& id_to_image = nullptr);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SERIALIZATION_H_
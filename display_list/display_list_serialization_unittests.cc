@@ -0,0 +1,142 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstring>
+#include <vector>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/display_list/display_list_serialization.h"
+#include "flutter/display_list/display_list_test_utils.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+// Hands out the index of each image in a list as its ID.
+class TestImageRegistry {
+ public:
+  uint64_t IdFor(const DlImage& image) {
+    for (size_t i = 0; i < images_.size(); i++) {
+      if (images_[i].get() == &image) {
+        return i;
+      }
+    }
+    images_.push_back(sk_ref_sp(const_cast<DlImage*>(&image)));
+    return images_.size() - 1;
+  }
+
+  sk_sp<DlImage> ImageFor(uint64_t id) const {
+    return id < images_.size() ? images_[id] : nullptr;
+  }
+
+  DisplayListSerializer::ImageToId image_to_id() {
+    return [this](const DlImage& image) { return IdFor(image); };
+  }
+
+  DisplayListSerializer::IdToImage id_to_image() const {
+    return [this](uint64_t id) { return ImageFor(id); };
+  }
+
+ private:
+  std::vector<sk_sp<DlImage>> images_;
+};
+
+TEST(DisplayListSerialization, SingleOpDisplayListsRoundTrip) {
+  TestImageRegistry registry;
+  for (auto& group : CreateAllGroups()) {
+    for (size_t i = 0; i < group.variants.size(); i++) {
+      auto desc = group.op_name + "(variant " + std::to_string(i + 1) + ")";
+      sk_sp<DisplayList> dl = group.variants[i].Build();
+      auto data = DisplayListSerializer::Serialize(*dl, registry.image_to_id());
+      if (!data) {
+        // Blenders and SkPictures are opaque Skia objects.
+        EXPECT_TRUE(group.op_name == "SetBlendModeOrBlender" ||
+                    group.op_name == "DrawPicture")
+            << desc;
+        continue;
+      }
+      auto copy =
+          DisplayListSerializer::Deserialize(*data, registry.id_to_image());
+      ASSERT_NE(copy, nullptr) << desc;
+      ASSERT_EQ(copy->op_count(true), dl->op_count(true)) << desc;
+      ASSERT_EQ(copy->bytes(true), dl->bytes(true)) << desc;
+      ASSERT_EQ(copy->bounds(), dl->bounds()) << desc;
+      // Text blobs are compared by reference and are recreated when read.
+      if (group.op_name != "DrawTextBlob") {
+        ASSERT_TRUE(copy->Equals(*dl)) << desc;
+      }
+    }
+  }
+}
+
+TEST(DisplayListSerialization, NestedDisplayListsRoundTrip) {
+  auto dl = GetSampleNestedDisplayList();
+  auto data = DisplayListSerializer::Serialize(*dl);
+  ASSERT_NE(data, nullptr);
+  auto copy = DisplayListSerializer::Deserialize(*data);
+  ASSERT_NE(copy, nullptr);
+  ASSERT_EQ(copy->op_count(true), dl->op_count(true));
+  ASSERT_TRUE(copy->Equals(*dl));
+}
+
+TEST(DisplayListSerialization, ImagesRequireIds) {
+  DisplayListBuilder builder;
+  builder.drawImage(TestImage1, {10, 10}, kNearestSampling, false);
+  auto dl = builder.Build();
+  ASSERT_EQ(DisplayListSerializer::Serialize(*dl), nullptr);
+
+  TestImageRegistry registry;
+  auto data = DisplayListSerializer::Serialize(*dl, registry.image_to_id());
+  ASSERT_NE(data, nullptr);
+  ASSERT_EQ(DisplayListSerializer::Deserialize(*data), nullptr);
+  ASSERT_EQ(DisplayListSerializer::Deserialize(
+                *data, [](uint64_t id) { return nullptr; }),
+            nullptr);
+  auto copy = DisplayListSerializer::Deserialize(*data, registry.id_to_image());
+  ASSERT_NE(copy, nullptr);
+  ASSERT_TRUE(copy->Equals(*dl));
+}
+
+TEST(DisplayListSerialization, RejectsMalformedData) {
+  auto dl = GetSampleDisplayList();
+  auto data = DisplayListSerializer::Serialize(*dl);
+  ASSERT_NE(data, nullptr);
+  std::vector<uint8_t> bytes(data->GetMapping(),
+                             data->GetMapping() + data->GetSize());
+
+  // Every truncation fails instead of reading past the end.
+  for (size_t size = 0; size < bytes.size(); size += 4) {
+    fml::NonOwnedMapping truncated(bytes.data(), size);
+    ASSERT_EQ(DisplayListSerializer::Deserialize(truncated), nullptr) << size;
+  }
+
+  // Data written by another version is rejected.
+  auto versioned = bytes;
+  uint32_t version = DisplayListSerializer::kVersion + 1;
+  memcpy(versioned.data() + sizeof(uint32_t), &version, sizeof(version));
+  fml::NonOwnedMapping other_version(versioned.data(), versioned.size());
+  ASSERT_EQ(DisplayListSerializer::Deserialize(other_version), nullptr);
+
+  // As is data with trailing garbage.
+  auto padded = bytes;
+  padded.resize(padded.size() + 4, 0xff);
+  fml::NonOwnedMapping trailing(padded.data(), padded.size());
+  ASSERT_EQ(DisplayListSerializer::Deserialize(trailing), nullptr);
+}
+
+TEST(DisplayListSerialization, CanReadUnalignedData) {
+  auto dl = GetSampleDisplayList();
+  auto data = DisplayListSerializer::Serialize(*dl);
+  ASSERT_NE(data, nullptr);
+  std::vector<uint8_t> bytes(data->GetSize() + 1);
+  memcpy(bytes.data() + 1, data->GetMapping(), data->GetSize());
+  fml::NonOwnedMapping unaligned(bytes.data() + 1, data->GetSize());
+  auto copy = DisplayListSerializer::Deserialize(unaligned);
+  ASSERT_NE(copy, nullptr);
+  ASSERT_TRUE(copy->Equals(*dl));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,79 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_skia_object_cache.h"
+
+namespace flutter {
+
+template <class D, class S>
+sk_sp<S> DlSkiaObjectCache::Get(
+    std::unordered_map<const D*, sk_sp<S>>& objects,
+    const D* attribute) {
+  {
+    std::scoped_lock lock(mutex_);
+    auto found = objects.find(attribute);
+    if (found != objects.end()) {
+      return found->second;
+    }
+  }
+  // Converting some attributes, such as gradients, is expensive, so it is
+  // done without holding the lock.
+  sk_sp<S> object = attribute->skia_object();
+  if (!object) {
+    return nullptr;
+  }
+  std::scoped_lock lock(mutex_);
+  return objects.try_emplace(attribute, std::move(object)).first->second;
+}
+
+sk_sp<SkShader> DlSkiaObjectCache::GetShader(const DlColorSource* source) {
+  switch (source->type()) {
+    case DlColorSourceType::kImage:
+    case DlColorSourceType::kRuntimeEffect:
+    case DlColorSourceType::kUnknown:
+      return source->skia_object();
+    default:
+      return Get(shaders_, source);
+  }
+}
+
+sk_sp<SkColorFilter> DlSkiaObjectCache::GetColorFilter(
+    const DlColorFilter* filter) {
+  if (filter->type() == DlColorFilterType::kUnknown) {
+    return filter->skia_object();
+  }
+  return Get(color_filters_, filter);
+}
+
+sk_sp<SkImageFilter> DlSkiaObjectCache::GetImageFilter(
+    const DlImageFilter* filter) {
+  if (filter->type() == DlImageFilterType::kUnknown) {
+    return filter->skia_object();
+  }
+  return Get(image_filters_, filter);
+}
+
+sk_sp<SkPathEffect> DlSkiaObjectCache::GetPathEffect(
+    const DlPathEffect* effect) {
+  if (effect->type() == DlPathEffectType::kUnknown) {
+    return effect->skia_object();
+  }
+  return Get(path_effects_, effect);
+}
+
+sk_sp<SkMaskFilter> DlSkiaObjectCache::GetMaskFilter(
+    const DlMaskFilter* filter) {
+  if (filter->type() == DlMaskFilterType::kUnknown) {
+    return filter->skia_object();
+  }
+  return Get(mask_filters_, filter);
+}
+
+size_t DlSkiaObjectCache::size() const {
+  std::scoped_lock lock(mutex_);
+  return shaders_.size() + color_filters_.size() + image_filters_.size() +
+         path_effects_.size() + mask_filters_.size();
+}
+
+}  // namespace flutter
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SKIA_OBJECT_CACHE_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SKIA_OBJECT_CACHE_H_
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+#include "flutter/display_list/display_list_color_filter.h"
+#include "flutter/display_list/display_list_color_source.h"
+#include "flutter/display_list/display_list_image_filter.h"
+#include "flutter/display_list/display_list_mask_filter.h"
+#include "flutter/display_list/display_list_path_effect.h"
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+// A cache of the Skia objects that the attributes of a DisplayList convert
+// to, so that a DisplayList that is rendered with Skia every frame does not
+// create its shaders and filters again every frame.
+//
+// Attributes are identified by their address, so the cache must only be used
+// with attributes that live in the storage of a single DisplayList and are
+// not moved or modified for the lifetime of the cache. Attributes that wrap
+// a Skia object, and color sources with images that may only become
+// available later, are converted every time. Thread safe.
+class DlSkiaObjectCache {
+ public:
+  DlSkiaObjectCache() = default;
+
+  sk_sp<SkShader> GetShader(const DlColorSource* source);
+  sk_sp<SkColorFilter> GetColorFilter(const DlColorFilter* filter);
+  sk_sp<SkImageFilter> GetImageFilter(const DlImageFilter* filter);
+  sk_sp<SkPathEffect> GetPathEffect(const DlPathEffect* effect);
+  sk_sp<SkMaskFilter> GetMaskFilter(const DlMaskFilter* filter);
+
+  // The number of cached Skia objects.
+  size_t size() const;
+
+ private:
+  template <class D, class S>
+  sk_sp<S> Get(std::unordered_map<const D*, sk_sp<S>>& objects,
+               const D* attribute);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<const DlColorSource*, sk_sp<SkShader>> shaders_;
+  std::unordered_map<const DlColorFilter*, sk_sp<SkColorFilter>>
+      color_filters_;
+  std::unordered_map<const DlImageFilter*, sk_sp<SkImageFilter>>
+      image_filters_;
+  std::unordered_map<const DlPathEffect*, sk_sp<SkPathEffect>> path_effects_;
+  std::unordered_map<const DlMaskFilter*, sk_sp<SkMaskFilter>> mask_filters_;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(DlSkiaObjectCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_SKIA_OBJECT_CACHE_H_
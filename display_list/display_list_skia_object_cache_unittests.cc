@@ -0,0 +1,78 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_skia_object_cache.h"
+
+#include "flutter/display_list/display_list_image.h"
+#include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkColorFilter.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+namespace testing {
+
+static constexpr DlColor kTestColors[2] = {0xFF00FF00, 0xFF0000FF};
+static constexpr float kTestStops[2] = {0.0f, 1.0f};
+
+TEST(DlSkiaObjectCache, ReusesConvertedGradients) {
+  auto gradient = DlColorSource::MakeLinear(
+      SkPoint::Make(0, 0), SkPoint::Make(10, 10), 2, kTestColors, kTestStops,
+      DlTileMode::kClamp);
+  auto other_gradient = gradient->shared();
+  DlSkiaObjectCache cache;
+
+  sk_sp<SkShader> shader = cache.GetShader(gradient.get());
+  ASSERT_NE(shader, nullptr);
+  EXPECT_EQ(cache.GetShader(gradient.get()), shader);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // Attributes are told apart by their address, not their contents.
+  EXPECT_NE(cache.GetShader(other_gradient.get()), shader);
+  EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST(DlSkiaObjectCache, ReusesConvertedFilters) {
+  DlBlendColorFilter color_filter(DlColor::kRed(), DlBlendMode::kDstIn);
+  DlBlurImageFilter image_filter(5.0, 5.0, DlTileMode::kClamp);
+  DlBlurMaskFilter mask_filter(kNormal_SkBlurStyle, 5.0);
+  const SkScalar dashes[] = {4.0, 2.0};
+  auto path_effect = DlDashPathEffect::Make(dashes, 2, 0.0);
+  DlSkiaObjectCache cache;
+
+  auto sk_color_filter = cache.GetColorFilter(&color_filter);
+  auto sk_image_filter = cache.GetImageFilter(&image_filter);
+  auto sk_mask_filter = cache.GetMaskFilter(&mask_filter);
+  auto sk_path_effect = cache.GetPathEffect(path_effect.get());
+  EXPECT_EQ(cache.size(), 4u);
+
+  EXPECT_EQ(cache.GetColorFilter(&color_filter), sk_color_filter);
+  EXPECT_EQ(cache.GetImageFilter(&image_filter), sk_image_filter);
+  EXPECT_EQ(cache.GetMaskFilter(&mask_filter), sk_mask_filter);
+  EXPECT_EQ(cache.GetPathEffect(path_effect.get()), sk_path_effect);
+  EXPECT_EQ(cache.size(), 4u);
+}
+
+TEST(DlSkiaObjectCache, DoesNotCacheWrappedSkiaObjects) {
+  // DisplayLists dispatch wrapped Skia objects through temporary attributes.
+  DlUnknownColorFilter color_filter(
+      SkColorFilters::Blend(SK_ColorRED, SkBlendMode::kDstIn));
+  DlSkiaObjectCache cache;
+
+  EXPECT_NE(cache.GetColorFilter(&color_filter), nullptr);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(DlSkiaObjectCache, DoesNotCacheImageColorSources) {
+  sk_sp<SkSurface> surface = SkSurface::MakeRasterN32Premul(10, 10);
+  surface->getCanvas()->drawColor(SK_ColorGREEN);
+  DlImageColorSource source(DlImage::Make(surface->makeImageSnapshot()),
+                            DlTileMode::kClamp, DlTileMode::kClamp);
+  DlSkiaObjectCache cache;
+
+  EXPECT_NE(cache.GetShader(&source), nullptr);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,82 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/display_list/display_list_storage_pool.h"
+
+#include "flutter/fml/logging.h"
+#include "third_party/skia/include/private/SkMalloc.h"
+
+namespace flutter {
+
+DisplayListStoragePool::DisplayListStoragePool(size_t max_pooled_bytes)
+    : max_pooled_bytes_(max_pooled_bytes) {}
+
+DisplayListStoragePool::~DisplayListStoragePool() {
+  for (auto& blocks : free_blocks_) {
+    for (auto* block : blocks) {
+      sk_free(block);
+    }
+  }
+}
+
+size_t DisplayListStoragePool::SizeClassFor(size_t size) {
+  size_t size_class = 0;
+  while ((kMinBlockSize << size_class) < size) {
+    size_class++;
+  }
+  return size_class;
+}
+
+uint8_t* DisplayListStoragePool::Obtain(size_t size, size_t* capacity) {
+  if (size > kMaxBlockSize) {
+    *capacity = size;
+    return static_cast<uint8_t*>(sk_malloc_throw(size));
+  }
+  auto size_class = SizeClassFor(size);
+  *capacity = kMinBlockSize << size_class;
+  {
+    std::scoped_lock lock(mutex_);
+    auto& blocks = free_blocks_[size_class];
+    if (!blocks.empty()) {
+      auto* block = blocks.back();
+      blocks.pop_back();
+      pooled_bytes_ -= *capacity;
+      return block;
+    }
+  }
+  return static_cast<uint8_t*>(sk_malloc_throw(*capacity));
+}
+
+void DisplayListStoragePool::Recycle(uint8_t* block, size_t capacity) {
+  if (!block) {
+    return;
+  }
+  if (capacity <= kMaxBlockSize) {
+    auto size_class = SizeClassFor(capacity);
+    FML_DCHECK((kMinBlockSize << size_class) == capacity);
+    std::scoped_lock lock(mutex_);
+    if (pooled_bytes_ + capacity <= max_pooled_bytes_) {
+      free_blocks_[size_class].push_back(block);
+      pooled_bytes_ += capacity;
+      return;
+    }
+  }
+  sk_free(block);
+}
+
+size_t DisplayListStoragePool::pooled_bytes() const {
+  std::scoped_lock lock(mutex_);
+  return pooled_bytes_;
+}
+
+size_t DisplayListStoragePool::pooled_block_count() const {
+  std::scoped_lock lock(mutex_);
+  size_t count = 0;
+  for (const auto& blocks : free_blocks_) {
+    count += blocks.size();
+  }
+  return count;
+}
+
+}  // namespace flutter
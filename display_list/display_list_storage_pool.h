@@ -0,0 +1,69 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_DISPLAY_LIST_DISPLAY_LIST_STORAGE_POOL_H_
+#define FLUTTER_DISPLAY_LIST_DISPLAY_LIST_STORAGE_POOL_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+// A pool of the memory blocks that hold the ops of DisplayLists.
+//
+// Blocks are handed out in power of two size classes. A |DisplayListBuilder|
+// that is given a pool obtains its storage from the pool and hands it over
+// to the |DisplayList| it builds. The block is returned to the pool when the
+// DisplayList is destroyed, which may happen on a different thread than the
+// one that built it.
+//
+// Blocks are allocated with sk_malloc and may be freed with sk_free.
+class DisplayListStoragePool {
+ public:
+  static constexpr size_t kMinBlockSize = 4096;
+  static constexpr size_t kSizeClassCount = 13;
+  // Larger blocks are allocated and freed without being pooled.
+  static constexpr size_t kMaxBlockSize = kMinBlockSize
+                                          << (kSizeClassCount - 1);
+  static constexpr size_t kDefaultMaxPooledBytes = 32 * 1024 * 1024;
+
+  explicit DisplayListStoragePool(
+      size_t max_pooled_bytes = kDefaultMaxPooledBytes);
+
+  ~DisplayListStoragePool();
+
+  // Returns a block of at least |size| bytes and stores its actual size in
+  // |capacity|.
+  uint8_t* Obtain(size_t size, size_t* capacity);
+
+  // Returns a block of the given capacity that was obtained from this pool.
+  // The block is freed instead if the pool is full. Thread safe.
+  void Recycle(uint8_t* block, size_t capacity);
+
+  // The number of bytes held by blocks that are ready for reuse.
+  size_t pooled_bytes() const;
+
+  // The number of blocks that are ready for reuse.
+  size_t pooled_block_count() const;
+
+ private:
+  const size_t max_pooled_bytes_;
+  mutable std::mutex mutex_;
+  std::array<std::vector<uint8_t*>, kSizeClassCount> free_blocks_;
+  size_t pooled_bytes_ = 0;
+
+  static size_t SizeClassFor(size_t size);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DisplayListStoragePool);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_DISPLAY_LIST_DISPLAY_LIST_STORAGE_POOL_H_
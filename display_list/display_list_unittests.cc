@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -86,6 +87,7 @@ TEST(DisplayList, SingleOpDisplayListsRecapturedAreEqual) {
       ASSERT_EQ(copy->bounds(), dl->bounds()) << desc;
       ASSERT_TRUE(copy->Equals(*dl)) << desc;
       ASSERT_TRUE(dl->Equals(*copy)) << desc;
+      ASSERT_EQ(copy->content_hash(), dl->content_hash()) << desc;
     }
   }
 }
@@ -153,6 +155,7 @@ TEST(DisplayList, SingleOpDisplayListsCompareToEachOther) {
           ASSERT_EQ(listA->bounds(), listB->bounds()) << desc;
           ASSERT_TRUE(listA->Equals(*listB)) << desc;
           ASSERT_TRUE(listB->Equals(*listA)) << desc;
+          ASSERT_EQ(listA->content_hash(), listB->content_hash()) << desc;
         } else {
           // No assertion on op/byte counts or bounds
           // they may or may not be equal between variants
@@ -164,6 +167,28 @@ TEST(DisplayList, SingleOpDisplayListsCompareToEachOther) {
   }
 }
 
+TEST(DisplayList, ContentHashCoversAttributesAndNestedDisplayLists) {
+  auto build = [](DlColor color, const SkRect& nested_rect) {
+    DisplayListBuilder nested_builder;
+    nested_builder.drawRect(nested_rect);
+    DisplayListBuilder builder;
+    builder.setColor(color);
+    builder.drawDisplayList(nested_builder.Build());
+    return builder.Build();
+  };
+  auto dl = build(DlColor::kRed(), {10, 10, 20, 20});
+  auto same = build(DlColor::kRed(), {10, 10, 20, 20});
+  auto other_color = build(DlColor::kBlue(), {10, 10, 20, 20});
+  auto other_nested = build(DlColor::kRed(), {10, 10, 20, 30});
+
+  ASSERT_EQ(dl->content_hash(), same->content_hash());
+  ASSERT_TRUE(dl->Equals(*same));
+  ASSERT_NE(dl->content_hash(), other_color->content_hash());
+  ASSERT_FALSE(dl->Equals(*other_color));
+  ASSERT_NE(dl->content_hash(), other_nested->content_hash());
+  ASSERT_FALSE(dl->Equals(*other_nested));
+}
+
 TEST(DisplayList, FullRotationsAreNop) {
   DisplayListBuilder builder;
   builder.rotate(0);
@@ -410,6 +435,87 @@ TEST(DisplayList, DisplayListSaveLayerBoundsWithAlphaFilter) {
   }
 }
 
+TEST(DisplayList, SmallNestedDisplayListsAreInlined) {
+  DisplayListBuilder nested_builder;
+  nested_builder.translate(5, 5);
+  nested_builder.drawRect({0, 0, 10, 10});
+  auto nested = nested_builder.Build();
+
+  DisplayListBuilder builder;
+  builder.setMaxInlinedOpCount(DisplayListBuilder::kDefaultMaxInlinedOpCount);
+  builder.setColor(DlColor::kRed());
+  builder.setStrokeWidth(2);
+  builder.drawDisplayList(nested);
+  builder.drawOval({0, 0, 10, 10});
+  auto display_list = builder.Build();
+  ASSERT_EQ(builder.getInlinedDisplayListCount(), 1);
+
+  // The nested ops are drawn with the default attributes, and the
+  // attributes of the outer list are set again after them.
+  DisplayListBuilder expected_builder;
+  expected_builder.setColor(DlColor::kRed());
+  expected_builder.setStrokeWidth(2);
+  expected_builder.setColor(DlColor::kBlack());
+  expected_builder.setStrokeWidth(0);
+  expected_builder.save();
+  expected_builder.translate(5, 5);
+  expected_builder.drawRect({0, 0, 10, 10});
+  expected_builder.restore();
+  expected_builder.setColor(DlColor::kRed());
+  expected_builder.setStrokeWidth(2);
+  expected_builder.drawOval({0, 0, 10, 10});
+  auto expected = expected_builder.Build();
+  ASSERT_TRUE(display_list->Equals(*expected));
+
+  DisplayListBuilder recursing_builder;
+  recursing_builder.setColor(DlColor::kRed());
+  recursing_builder.setStrokeWidth(2);
+  recursing_builder.drawDisplayList(nested);
+  recursing_builder.drawOval({0, 0, 10, 10});
+  auto recursing = recursing_builder.Build();
+  ASSERT_EQ(display_list->bounds(), recursing->bounds());
+  ASSERT_EQ(recursing_builder.getInlinedDisplayListCount(), 0);
+}
+
+TEST(DisplayList, LargeNestedDisplayListsAreNotInlined) {
+  DisplayListBuilder nested_builder;
+  for (int i = 0; i <= DisplayListBuilder::kDefaultMaxInlinedOpCount; i++) {
+    nested_builder.drawRect({i * 10.0f, 0, i * 10.0f + 5, 5});
+  }
+  auto nested = nested_builder.Build();
+
+  DisplayListBuilder builder;
+  builder.setMaxInlinedOpCount(DisplayListBuilder::kDefaultMaxInlinedOpCount);
+  builder.drawDisplayList(nested);
+  auto display_list = builder.Build();
+  ASSERT_EQ(builder.getInlinedDisplayListCount(), 0);
+  ASSERT_EQ(display_list->op_count(), 1u);
+}
+
+TEST(DisplayList, InlinedDisplayListKeepsGroupOpacity) {
+  DisplayListBuilder nested_builder;
+  nested_builder.drawRect({0, 0, 10, 10});
+  nested_builder.drawRect({20, 20, 30, 30});
+  auto nested = nested_builder.Build();
+  ASSERT_FALSE(nested->can_apply_group_opacity());
+
+  DisplayListBuilder compatible_builder;
+  compatible_builder.drawRect({0, 0, 10, 10});
+  auto compatible = compatible_builder.Build();
+  ASSERT_TRUE(compatible->can_apply_group_opacity());
+
+  for (auto& dl : {nested, compatible}) {
+    DisplayListBuilder builder;
+    builder.setMaxInlinedOpCount(
+        DisplayListBuilder::kDefaultMaxInlinedOpCount);
+    builder.drawDisplayList(dl);
+    auto display_list = builder.Build();
+    ASSERT_EQ(builder.getInlinedDisplayListCount(), 1);
+    ASSERT_EQ(display_list->can_apply_group_opacity(),
+              dl->can_apply_group_opacity());
+  }
+}
+
 TEST(DisplayList, NestedOpCountMetricsSameAsSkPicture) {
   SkPictureRecorder recorder;
   recorder.beginRecording(SkRect::MakeWH(150, 100));
@@ -1559,6 +1665,55 @@ static void test_rtree(const sk_sp<const DlRTree>& rtree,
   }
 }
 
+TEST(DisplayList, BoundsOfManyPointsAndSprites) {
+  // More points and sprites than are bounded in a single batch.
+  const int count = 150;
+  std::vector<SkPoint> points;
+  std::vector<SkRSXform> xforms;
+  std::vector<SkRect> texs;
+  for (int i = 0; i < count; i++) {
+    points.push_back(SkPoint::Make(i * 2, 100 - i));
+    xforms.push_back(SkRSXform::Make(1, 0, i * 2, 100 - i));
+    texs.push_back(SkRect::MakeWH(10, 10));
+  }
+  {
+    DisplayListBuilder builder;
+    builder.setStrokeWidth(2);
+    builder.drawPoints(SkCanvas::kPoints_PointMode, count, points.data());
+    auto display_list = builder.Build();
+    ASSERT_EQ(display_list->bounds(), SkRect::MakeLTRB(-1, -50, 299, 101));
+  }
+  {
+    DisplayListBuilder builder;
+    builder.drawAtlas(TestImage1, xforms.data(), texs.data(), nullptr, count,
+                      DlBlendMode::kSrcOver, kNearestSampling, nullptr, false);
+    auto display_list = builder.Build();
+    ASSERT_EQ(display_list->bounds(), SkRect::MakeLTRB(0, -49, 308, 110));
+  }
+}
+
+TEST(DisplayList, RTreeIsBuiltOnceAcrossThreads) {
+  DisplayListBuilder builder;
+  for (int i = 0; i < 100; i++) {
+    builder.drawRect(SkRect::MakeXYWH(i * 10, 0, 5, 5));
+  }
+  auto display_list = builder.Build();
+
+  std::vector<sk_sp<const DlRTree>> rtrees(4);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < rtrees.size(); i++) {
+    threads.emplace_back(
+        [&display_list, &rtrees, i] { rtrees[i] = display_list->rtree(); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& rtree : rtrees) {
+    ASSERT_EQ(rtree, rtrees[0]);
+  }
+  ASSERT_EQ(rtrees[0]->getCount(), 100);
+}
+
 TEST(DisplayList, RTreeOfSimpleScene) {
   DisplayListBuilder builder;
   builder.drawRect({10, 10, 20, 20});
@@ -2251,5 +2406,31 @@ TEST(DisplayList, RTreeOfClippedSaveLayerFilterScene) {
   test_rtree(rtree, {19, 19, 51, 51}, rects, {0, 1});
 }
 
+TEST(DisplayList, StorageIsRecycledThroughPool) {
+  auto pool = std::make_shared<DisplayListStoragePool>();
+  DisplayListBuilder builder(SkRect::MakeLTRB(0, 0, 100, 100), pool);
+  auto record = [&builder]() {
+    for (int i = 0; i < 1000; i++) {
+      builder.drawRect(SkRect::MakeXYWH(i % 90, i % 90, 10, 10));
+    }
+    return builder.Build();
+  };
+
+  auto first = record();
+  ASSERT_EQ(first->op_count(), 1000u);
+  // The smaller blocks outgrown while recording were returned to the pool.
+  size_t outgrown_blocks = pool->pooled_block_count();
+  ASSERT_GT(outgrown_blocks, 0u);
+
+  first.reset();
+  ASSERT_EQ(pool->pooled_block_count(), outgrown_blocks + 1);
+
+  // The next recording is sized to fit the previous one from the start, so
+  // it reuses the block of the first DisplayList without growing.
+  auto second = record();
+  ASSERT_EQ(second->op_count(), 1000u);
+  ASSERT_EQ(pool->pooled_block_count(), outgrown_blocks);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -4,12 +4,14 @@
 
 #include "flutter/display_list/display_list_utils.h"
 
+#include <algorithm>
 #include <math.h>
 #include <optional>
 #include <type_traits>
 
 #include "flutter/display_list/display_list_blend_mode.h"
 #include "flutter/display_list/display_list_canvas_dispatcher.h"
+#include "flutter/display_list/display_list_skia_object_cache.h"
 #include "flutter/fml/logging.h"
 #include "third_party/skia/include/core/SkMaskFilter.h"
 #include "third_party/skia/include/core/SkPath.h"
@@ -79,30 +81,65 @@ void SkPaintDispatchHelper::setBlender(sk_sp<SkBlender> blender) {
   paint_.setBlender(blender);
 }
 void SkPaintDispatchHelper::setColorSource(const DlColorSource* source) {
-  paint_.setShader(source ? source->skia_object() : nullptr);
+  if (!source) {
+    paint_.setShader(nullptr);
+  } else if (skia_objects_) {
+    paint_.setShader(skia_objects_->GetShader(source));
+  } else {
+    paint_.setShader(source->skia_object());
+  }
 }
 void SkPaintDispatchHelper::setImageFilter(const DlImageFilter* filter) {
-  paint_.setImageFilter(filter ? filter->skia_object() : nullptr);
+  paint_.setImageFilter(skia_image_filter(filter));
 }
 void SkPaintDispatchHelper::setColorFilter(const DlColorFilter* filter) {
-  color_filter_ = filter ? filter->shared() : nullptr;
+  if (!filter) {
+    sk_color_filter_ = nullptr;
+  } else if (skia_objects_) {
+    sk_color_filter_ = skia_objects_->GetColorFilter(filter);
+  } else {
+    sk_color_filter_ = filter->skia_object();
+  }
   paint_.setColorFilter(makeColorFilter());
 }
 void SkPaintDispatchHelper::setPathEffect(const DlPathEffect* effect) {
-  paint_.setPathEffect(effect ? effect->skia_object() : nullptr);
+  if (!effect) {
+    paint_.setPathEffect(nullptr);
+  } else if (skia_objects_) {
+    paint_.setPathEffect(skia_objects_->GetPathEffect(effect));
+  } else {
+    paint_.setPathEffect(effect->skia_object());
+  }
 }
 void SkPaintDispatchHelper::setMaskFilter(const DlMaskFilter* filter) {
-  paint_.setMaskFilter(filter ? filter->skia_object() : nullptr);
+  if (!filter) {
+    paint_.setMaskFilter(nullptr);
+  } else if (skia_objects_) {
+    paint_.setMaskFilter(skia_objects_->GetMaskFilter(filter));
+  } else {
+    paint_.setMaskFilter(filter->skia_object());
+  }
+}
+
+sk_sp<SkImageFilter> SkPaintDispatchHelper::skia_image_filter(
+    const DlImageFilter* filter) const {
+  if (!filter) {
+    return nullptr;
+  }
+  if (skia_objects_) {
+    return skia_objects_->GetImageFilter(filter);
+  }
+  return filter->skia_object();
 }
 
 sk_sp<SkColorFilter> SkPaintDispatchHelper::makeColorFilter() const {
   if (!invert_colors_) {
-    return color_filter_ ? color_filter_->skia_object() : nullptr;
+    return sk_color_filter_;
   }
   sk_sp<SkColorFilter> invert_filter =
       SkColorFilters::Matrix(kInvertColorMatrix);
-  if (color_filter_) {
-    invert_filter = invert_filter->makeComposed(color_filter_->skia_object());
+  if (sk_color_filter_) {
+    invert_filter = invert_filter->makeComposed(sk_color_filter_);
   }
   return invert_filter;
 }
@@ -559,11 +596,7 @@ void DisplayListBoundsCalculator::drawPoints(SkCanvas::PointMode mode,
                                              uint32_t count,
                                              const SkPoint pts[]) {
   if (count > 0) {
-    RectBoundsAccumulator pt_bounds;
-    for (size_t i = 0; i < count; i++) {
-      pt_bounds.accumulate(pts[i]);
-    }
-    SkRect point_bounds = pt_bounds.bounds();
+    SkRect point_bounds = PointBounds(pts, count);
     switch (mode) {
       case SkCanvas::kPoints_PointMode:
         AccumulateOpBounds(point_bounds, kDrawPointsAsPointsFlags);
@@ -639,14 +672,19 @@ void DisplayListBoundsCalculator::drawAtlas(const sk_sp<DlImage> atlas,
                                             DlImageSampling sampling,
                                             const SkRect* cullRect,
                                             bool render_with_attributes) {
-  SkPoint quad[4];
+  // The corners of the sprites are bounded a batch at a time.
+  constexpr int kSpritesPerBatch = 64;
+  SkPoint quads[kSpritesPerBatch * 4];
   RectBoundsAccumulator atlas_bounds;
-  for (int i = 0; i < count; i++) {
-    const SkRect& src = tex[i];
-    xform[i].toQuad(src.width(), src.height(), quad);
-    for (int j = 0; j < 4; j++) {
-      atlas_bounds.accumulate(quad[j]);
+  for (int start = 0; start < count; start += kSpritesPerBatch) {
+    int sprites = std::min(count - start, kSpritesPerBatch);
+    for (int i = 0; i < sprites; i++) {
+      const SkRect& src = tex[start + i];
+      xform[start + i].toQuad(src.width(), src.height(), &quads[i * 4]);
     }
+    SkRect batch_bounds = PointBounds(quads, sprites * 4);
+    atlas_bounds.accumulate(batch_bounds.fLeft, batch_bounds.fTop);
+    atlas_bounds.accumulate(batch_bounds.fRight, batch_bounds.fBottom);
   }
   if (atlas_bounds.is_not_empty()) {
     DisplayListAttributeFlags flags = render_with_attributes  //
@@ -705,6 +743,19 @@ void DisplayListBoundsCalculator::drawShadow(const SkPath& path,
   AccumulateOpBounds(shadow_bounds, kDrawShadowFlags);
 }
 
+SkRect DisplayListBoundsCalculator::PointBounds(const SkPoint points[],
+                                                size_t count) {
+  SkRect bounds;
+  if (bounds.setBoundsCheck(points, count)) {
+    return bounds;
+  }
+  RectBoundsAccumulator accumulator;
+  for (size_t i = 0; i < count; i++) {
+    accumulator.accumulate(points[i]);
+  }
+  return accumulator.bounds();
+}
+
 bool DisplayListBoundsCalculator::ComputeFilteredBounds(SkRect& bounds,
                                                         DlImageFilter* filter) {
   if (filter) {
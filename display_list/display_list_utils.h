@@ -167,8 +167,14 @@ class IgnoreDrawDispatchHelper : public virtual Dispatcher {
 // which can be accessed at any time via paint().
 class SkPaintDispatchHelper : public virtual Dispatcher {
  public:
-  SkPaintDispatchHelper(SkScalar opacity = SK_Scalar1)
-      : current_color_(SK_ColorBLACK), opacity_(opacity) {
+  // The Skia objects of the attributes are obtained from |skia_objects| if it
+  // is not null, which must only be done while dispatching the DisplayList
+  // that owns the cache.
+  SkPaintDispatchHelper(SkScalar opacity = SK_Scalar1,
+                        DlSkiaObjectCache* skia_objects = nullptr)
+      : current_color_(SK_ColorBLACK),
+        opacity_(opacity),
+        skia_objects_(skia_objects) {
     if (opacity < SK_Scalar1) {
       paint_.setAlphaf(opacity);
     }
@@ -209,10 +215,12 @@ class SkPaintDispatchHelper : public virtual Dispatcher {
   void save_opacity(SkScalar opacity_for_children);
   void restore_opacity();
 
+  sk_sp<SkImageFilter> skia_image_filter(const DlImageFilter* filter) const;
+
  private:
   SkPaint paint_;
   bool invert_colors_ = false;
-  std::shared_ptr<const DlColorFilter> color_filter_;
+  sk_sp<SkColorFilter> sk_color_filter_;
 
   sk_sp<SkColorFilter> makeColorFilter() const;
 
@@ -232,6 +240,7 @@ class SkPaintDispatchHelper : public virtual Dispatcher {
 
   SkColor current_color_;
   SkScalar opacity_;
+  DlSkiaObjectCache* skia_objects_;
 };
 
 class SkMatrixSource {
@@ -671,6 +680,10 @@ class DisplayListBoundsCalculator final
 
   bool paint_nops_on_transparency();
 
+  // Computes the bounds of a list of points, several points at a time
+  // when they are all finite.
+  static SkRect PointBounds(const SkPoint points[], size_t count);
+
   // Computes the bounds of an operation adjusted for a given ImageFilter
   static bool ComputeFilteredBounds(SkRect& bounds, DlImageFilter* filter);
 
@@ -8,6 +8,7 @@
 #include <utility>
 #include "flutter/flow/layers/layer_tree.h"
 #include "third_party/skia/include/core/SkCanvas.h"
+#include "third_party/skia/include/core/SkPath.h"
 
 namespace flutter {
 
@@ -153,6 +154,16 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
   if (canvas()) {
     if (clip_rect) {
       canvas()->clipRect(*clip_rect);
+      // Damage that is spread over several rects is only repainted within
+      // them rather than within their bounds.
+      std::vector<SkIRect> damage_rects = frame_damage->GetBufferDamageRects();
+      if (damage_rects.size() > 1) {
+        SkPath damage_path;
+        for (const auto& rect : damage_rects) {
+          damage_path.addRect(SkRect::Make(rect));
+        }
+        canvas()->clipPath(damage_path);
+      }
     }
 
     if (needs_save_layer) {
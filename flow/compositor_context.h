@@ -94,6 +94,16 @@ class FrameDamage {
     return damage_ ? std::make_optional(damage_->buffer_damage) : std::nullopt;
   }
 
+  // See Damage::frame_damage_rects. Empty if there is no frame damage.
+  std::vector<SkIRect> GetFrameDamageRects() const {
+    return damage_ ? damage_->frame_damage_rects : std::vector<SkIRect>();
+  }
+
+  // See Damage::buffer_damage_rects. Empty if there is no buffer damage.
+  std::vector<SkIRect> GetBufferDamageRects() const {
+    return damage_ ? damage_->buffer_damage_rects : std::vector<SkIRect>();
+  }
+
  private:
   SkIRect additional_damage_ = SkIRect::MakeEmpty();
   std::optional<Damage> damage_;
@@ -191,12 +201,17 @@ class CompositorContext {
 
   LayerSnapshotStore& snapshot_store() { return layer_snapshot_store_; }
 
+  LayerRasterTimingStore& layer_raster_timing_store() {
+    return layer_raster_timing_store_;
+  }
+
  private:
   RasterCache raster_cache_;
   std::shared_ptr<TextureRegistry> texture_registry_;
   Stopwatch raster_time_;
   Stopwatch ui_time_;
   LayerSnapshotStore layer_snapshot_store_;
+  LayerRasterTimingStore layer_raster_timing_store_;
 
   /// Only used by default constructor of `CompositorContext`.
   FixedRefreshRateUpdater fixed_refresh_rate_updater_;
@@ -0,0 +1,108 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/damage_region.h"
+
+#include <limits>
+
+namespace flutter {
+
+namespace {
+
+int64_t Area(const SkIRect& rect) {
+  return static_cast<int64_t>(rect.width()) * rect.height();
+}
+
+// The number of pixels outside of both rects that are painted when they are
+// replaced by their bounds.
+int64_t MergeCost(const SkIRect& a, const SkIRect& b) {
+  SkIRect bounds = a;
+  bounds.join(b);
+  SkIRect overlap;
+  int64_t overlap_area = overlap.intersect(a, b) ? Area(overlap) : 0;
+  return Area(bounds) - Area(a) - Area(b) + overlap_area;
+}
+
+bool ShouldMerge(const SkIRect& a, const SkIRect& b) {
+  return SkIRect::Intersects(a, b) ||
+         MergeCost(a, b) <= DamageRegion::kRectCost;
+}
+
+}  // namespace
+
+void DamageRegion::AddRect(const SkIRect& rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+
+  // A merged rect can reach rects that the original one didn't, so this
+  // keeps merging until there is nothing left to merge with.
+  SkIRect merged = rect;
+  for (auto it = rects_.begin(); it != rects_.end();) {
+    if (ShouldMerge(merged, *it)) {
+      merged.join(*it);
+      rects_.erase(it);
+      it = rects_.begin();
+    } else {
+      ++it;
+    }
+  }
+  rects_.push_back(merged);
+
+  if (rects_.size() > kMaxRects) {
+    size_t best_i = 0;
+    size_t best_j = 1;
+    int64_t best_cost = std::numeric_limits<int64_t>::max();
+    for (size_t i = 0; i < rects_.size(); i++) {
+      for (size_t j = i + 1; j < rects_.size(); j++) {
+        int64_t cost = MergeCost(rects_[i], rects_[j]);
+        if (cost < best_cost) {
+          best_i = i;
+          best_j = j;
+          best_cost = cost;
+        }
+      }
+    }
+    SkIRect combined = rects_[best_i];
+    combined.join(rects_[best_j]);
+    rects_.erase(rects_.begin() + best_j);
+    rects_.erase(rects_.begin() + best_i);
+    AddRect(combined);
+  }
+}
+
+void DamageRegion::AddRegion(const DamageRegion& region) {
+  for (const auto& rect : region.rects_) {
+    AddRect(rect);
+  }
+}
+
+void DamageRegion::Intersect(const SkIRect& clip) {
+  for (auto it = rects_.begin(); it != rects_.end();) {
+    if (it->intersect(clip)) {
+      ++it;
+    } else {
+      it = rects_.erase(it);
+    }
+  }
+}
+
+bool DamageRegion::Intersects(const SkIRect& rect) const {
+  for (const auto& r : rects_) {
+    if (SkIRect::Intersects(r, rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+SkIRect DamageRegion::GetBounds() const {
+  SkIRect bounds = SkIRect::MakeEmpty();
+  for (const auto& r : rects_) {
+    bounds.join(r);
+  }
+  return bounds;
+}
+
+}  // namespace flutter
@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_DAMAGE_REGION_H_
+#define FLUTTER_FLOW_DAMAGE_REGION_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "third_party/skia/include/core/SkRect.h"
+
+namespace flutter {
+
+// A damaged area of the screen, kept as a short list of disjoint rects so
+// that small changes far apart from each other, such as a clock and a badge
+// in opposite corners, don't have to be repainted together with everything
+// in between.
+//
+// A rect is merged into the rects that it overlaps and into the rects that
+// are so close to it that painting the pixels between them costs less than
+// keeping them apart. When there are more than |kMaxRects| rects, the pair
+// that wastes the fewest pixels when merged is merged.
+class DamageRegion {
+ public:
+  // The maximum number of rects in a region.
+  static constexpr size_t kMaxRects = 4;
+
+  // The number of pixels that painting one more rect is considered to cost,
+  // i.e. the number of pixels that may be repainted needlessly to save a
+  // rect.
+  static constexpr int64_t kRectCost = 64 * 64;
+
+  DamageRegion() = default;
+
+  void AddRect(const SkIRect& rect);
+
+  void AddRegion(const DamageRegion& region);
+
+  // Clips all rects to |clip|.
+  void Intersect(const SkIRect& clip);
+
+  // Whether |rect| overlaps any of the rects of the region.
+  bool Intersects(const SkIRect& rect) const;
+
+  bool IsEmpty() const { return rects_.empty(); }
+
+  SkIRect GetBounds() const;
+
+  const std::vector<SkIRect>& rects() const { return rects_; }
+
+ private:
+  std::vector<SkIRect> rects_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_DAMAGE_REGION_H_
@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/damage_region.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(DamageRegion, EmptyRectsAreIgnored) {
+  DamageRegion region;
+  region.AddRect(SkIRect::MakeEmpty());
+  region.AddRect(SkIRect::MakeLTRB(10, 10, 10, 20));
+  EXPECT_TRUE(region.IsEmpty());
+  EXPECT_EQ(region.GetBounds(), SkIRect::MakeEmpty());
+}
+
+TEST(DamageRegion, DistantRectsAreKeptApart) {
+  DamageRegion region;
+  region.AddRect(SkIRect::MakeLTRB(0, 0, 20, 20));
+  region.AddRect(SkIRect::MakeLTRB(500, 500, 520, 520));
+  EXPECT_EQ(region.rects(),
+            std::vector<SkIRect>({SkIRect::MakeLTRB(0, 0, 20, 20),
+                                  SkIRect::MakeLTRB(500, 500, 520, 520)}));
+  EXPECT_EQ(region.GetBounds(), SkIRect::MakeLTRB(0, 0, 520, 520));
+}
+
+TEST(DamageRegion, OverlappingAndNearbyRectsAreMerged) {
+  DamageRegion region;
+  region.AddRect(SkIRect::MakeLTRB(0, 0, 100, 100));
+  region.AddRect(SkIRect::MakeLTRB(50, 50, 150, 150));
+  EXPECT_EQ(region.rects(),
+            std::vector<SkIRect>({SkIRect::MakeLTRB(0, 0, 150, 150)}));
+
+  // The gap between these rects is too small to be worth keeping them apart.
+  region.AddRect(SkIRect::MakeLTRB(0, 160, 150, 170));
+  EXPECT_EQ(region.rects(),
+            std::vector<SkIRect>({SkIRect::MakeLTRB(0, 0, 150, 170)}));
+}
+
+TEST(DamageRegion, MergedRectsAreMergedWithTheRectsTheyReach) {
+  DamageRegion region;
+  region.AddRect(SkIRect::MakeLTRB(0, 0, 100, 100));
+  region.AddRect(SkIRect::MakeLTRB(300, 0, 400, 100));
+  ASSERT_EQ(region.rects().size(), 2u);
+
+  region.AddRect(SkIRect::MakeLTRB(50, 0, 350, 100));
+  EXPECT_EQ(region.rects(),
+            std::vector<SkIRect>({SkIRect::MakeLTRB(0, 0, 400, 100)}));
+}
+
+TEST(DamageRegion, NumberOfRectsIsBounded) {
+  DamageRegion region;
+  for (int i = 0; i < 10; i++) {
+    region.AddRect(SkIRect::MakeXYWH(i * 200, i * 200, 10, 10));
+  }
+  EXPECT_EQ(region.rects().size(), DamageRegion::kMaxRects);
+  EXPECT_EQ(region.GetBounds(), SkIRect::MakeLTRB(0, 0, 1810, 1810));
+  for (size_t i = 0; i < region.rects().size(); i++) {
+    for (size_t j = i + 1; j < region.rects().size(); j++) {
+      EXPECT_FALSE(SkIRect::Intersects(region.rects()[i], region.rects()[j]));
+    }
+  }
+}
+
+TEST(DamageRegion, IntersectClipsAllRects) {
+  DamageRegion region;
+  region.AddRect(SkIRect::MakeLTRB(0, 0, 20, 20));
+  region.AddRect(SkIRect::MakeLTRB(500, 500, 520, 520));
+  ASSERT_TRUE(region.Intersects(SkIRect::MakeLTRB(510, 510, 600, 600)));
+  ASSERT_FALSE(region.Intersects(SkIRect::MakeLTRB(100, 100, 200, 200)));
+
+  region.Intersect(SkIRect::MakeLTRB(10, 10, 100, 100));
+  EXPECT_EQ(region.rects(),
+            std::vector<SkIRect>({SkIRect::MakeLTRB(10, 10, 20, 20)}));
+}
+
+}  // namespace testing
+}  // namespace flutter
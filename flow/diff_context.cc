@@ -97,33 +97,45 @@ void DiffContext::AlignRect(SkIRect& rect,
 Damage DiffContext::ComputeDamage(const SkIRect& accumulated_buffer_damage,
                                   int horizontal_clip_alignment,
                                   int vertical_clip_alignment) const {
-  SkRect buffer_damage = SkRect::Make(accumulated_buffer_damage);
-  buffer_damage.join(damage_);
-  SkRect frame_damage(damage_);
+  DamageRegion buffer_damage = damage_;
+  buffer_damage.AddRect(accumulated_buffer_damage);
+  DamageRegion frame_damage = damage_;
 
   for (const auto& r : readbacks_) {
-    SkRect rect = SkRect::Make(r.rect);
-    if (rect.intersects(frame_damage)) {
-      frame_damage.join(rect);
+    if (frame_damage.Intersects(r.rect)) {
+      frame_damage.AddRect(r.rect);
     }
-    if (rect.intersects(buffer_damage)) {
-      buffer_damage.join(rect);
+    if (buffer_damage.Intersects(r.rect)) {
+      buffer_damage.AddRect(r.rect);
     }
   }
 
-  Damage res;
-  buffer_damage.roundOut(&res.buffer_damage);
-  frame_damage.roundOut(&res.frame_damage);
-
   SkIRect frame_clip = SkIRect::MakeSize(frame_size_);
-  res.buffer_damage.intersect(frame_clip);
-  res.frame_damage.intersect(frame_clip);
+  buffer_damage.Intersect(frame_clip);
+  frame_damage.Intersect(frame_clip);
 
   if (horizontal_clip_alignment > 1 || vertical_clip_alignment > 1) {
-    AlignRect(res.buffer_damage, horizontal_clip_alignment,
-              vertical_clip_alignment);
-    AlignRect(res.frame_damage, horizontal_clip_alignment,
-              vertical_clip_alignment);
+    buffer_damage = AlignRegion(buffer_damage, horizontal_clip_alignment,
+                                vertical_clip_alignment);
+    frame_damage = AlignRegion(frame_damage, horizontal_clip_alignment,
+                               vertical_clip_alignment);
+  }
+
+  Damage res;
+  res.buffer_damage = buffer_damage.GetBounds();
+  res.frame_damage = frame_damage.GetBounds();
+  res.buffer_damage_rects = buffer_damage.rects();
+  res.frame_damage_rects = frame_damage.rects();
+  return res;
+}
+
+DamageRegion DiffContext::AlignRegion(const DamageRegion& region,
+                                      int horizontal_alignment,
+                                      int vertical_alignment) const {
+  DamageRegion res;
+  for (auto rect : region.rects()) {
+    AlignRect(rect, horizontal_alignment, vertical_alignment);
+    res.AddRect(rect);
   }
   return res;
 }
@@ -216,12 +228,12 @@ PaintRegion DiffContext::CurrentSubtreeRegion() const {
 void DiffContext::AddDamage(const PaintRegion& damage) {
   FML_DCHECK(damage.is_valid());
   for (const auto& r : damage) {
-    damage_.join(r);
+    damage_.AddRect(r.roundOut());
   }
 }
 
 void DiffContext::AddDamage(const SkRect& rect) {
-  damage_.join(rect);
+  damage_.AddRect(rect.roundOut());
 }
 
 void DiffContext::SetLayerPaintRegion(const Layer* layer,
@@ -9,6 +9,7 @@
 #include <map>
 #include <optional>
 #include <vector>
+#include "flutter/flow/damage_region.h"
 #include "flutter/flow/paint_region.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/macros.h"
@@ -34,6 +35,14 @@ struct Damage {
   // upfront may be useful for tile based GPUs.
   // Corresponds to "buffer damage" from EGL_KHR_partial_update.
   SkIRect buffer_damage;
+
+  // Disjoint rects that cover the changed parts of frame_damage, which is
+  // their bounds.
+  std::vector<SkIRect> frame_damage_rects;
+
+  // Disjoint rects that cover the changed parts of buffer_damage, which is
+  // their bounds.
+  std::vector<SkIRect> buffer_damage_rects;
 };
 
 // Layer Unique Id to PaintRegion
@@ -234,7 +243,7 @@ class DiffContext {
   // Rect must be in device coordinates.
   SkRect ApplyFilterBoundsAdjustment(SkRect rect) const;
 
-  SkRect damage_ = SkRect::MakeEmpty();
+  DamageRegion damage_;
 
   PaintRegionMap& this_frame_paint_region_map_;
   const PaintRegionMap& last_frame_paint_region_map_;
@@ -246,6 +255,12 @@ class DiffContext {
                  int horizontal_alignment,
                  int vertical_clip_alignment) const;
 
+  // Aligns all rects of |region|, merging the ones that overlap once they
+  // are aligned.
+  DamageRegion AlignRegion(const DamageRegion& region,
+                           int horizontal_alignment,
+                           int vertical_alignment) const;
+
   struct Readback {
     // Index of rects_ entry that this readback belongs to. Used to
     // determine if subtree has any readback
@@ -32,5 +32,24 @@ TEST_F(DiffContextTest, ClipAlignment) {
   EXPECT_EQ(damage.buffer_damage, SkIRect::MakeLTRB(16, 16, 64, 64));
 }
 
+TEST_F(DiffContextTest, DistantChangesAreKeptApart) {
+  MockLayerTree t1(SkISize::Make(1000, 1000));
+  t1.root()->Add(CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(10, 10, 50, 30), 1)));
+  t1.root()->Add(CreateDisplayListLayer(
+      CreateDisplayList(SkRect::MakeLTRB(950, 970, 990, 990), 1)));
+  auto damage = DiffLayerTree(t1, MockLayerTree(SkISize::Make(1000, 1000)),
+                              SkIRect::MakeLTRB(500, 500, 510, 510));
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(10, 10, 990, 990));
+  EXPECT_EQ(damage.frame_damage_rects,
+            std::vector<SkIRect>({SkIRect::MakeLTRB(10, 10, 50, 30),
+                                  SkIRect::MakeLTRB(950, 970, 990, 990)}));
+  EXPECT_EQ(damage.buffer_damage, SkIRect::MakeLTRB(10, 10, 990, 990));
+  EXPECT_EQ(damage.buffer_damage_rects,
+            std::vector<SkIRect>({SkIRect::MakeLTRB(10, 10, 50, 30),
+                                  SkIRect::MakeLTRB(950, 970, 990, 990),
+                                  SkIRect::MakeLTRB(500, 500, 510, 510)}));
+}
+
 }  // namespace testing
 }  // namespace flutter
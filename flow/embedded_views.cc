@@ -74,37 +74,61 @@ void ExternalViewEmbedder::SubmitFrame(GrDirectContext* context,
   frame->Submit();
 };
 
+MutatorsStack::MutatorsStack(const MutatorsStack& other) {
+  *this = other;
+}
+
+MutatorsStack& MutatorsStack::operator=(const MutatorsStack& other) {
+  if (this == &other) {
+    return *this;
+  }
+  arena_ = nullptr;
+  if (!other.arena_) {
+    vector_ = other.vector_;
+    return *this;
+  }
+  vector_.clear();
+  vector_.reserve(other.vector_.size());
+  for (const auto& mutator : other.vector_) {
+    vector_.push_back(std::make_shared<Mutator>(*mutator));
+  }
+  return *this;
+}
+
+template <typename... Args>
+void MutatorsStack::Push(Args&&... args) {
+  if (arena_) {
+    vector_.push_back(std::allocate_shared<Mutator>(
+        fml::ArenaAllocator<Mutator>(arena_), std::forward<Args>(args)...));
+  } else {
+    vector_.push_back(std::make_shared<Mutator>(std::forward<Args>(args)...));
+  }
+}
+
 void MutatorsStack::PushClipRect(const SkRect& rect) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(rect);
-  vector_.push_back(element);
+  Push(rect);
 };
 
 void MutatorsStack::PushClipRRect(const SkRRect& rrect) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(rrect);
-  vector_.push_back(element);
+  Push(rrect);
 };
 
 void MutatorsStack::PushClipPath(const SkPath& path) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(path);
-  vector_.push_back(element);
+  Push(path);
 };
 
 void MutatorsStack::PushTransform(const SkMatrix& matrix) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(matrix);
-  vector_.push_back(element);
+  Push(matrix);
 };
 
 void MutatorsStack::PushOpacity(const int& alpha) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(alpha);
-  vector_.push_back(element);
+  Push(alpha);
 };
 
 void MutatorsStack::PushBackdropFilter(
     const std::shared_ptr<const DlImageFilter>& filter,
     const SkRect& filter_rect) {
-  std::shared_ptr<Mutator> element =
-      std::make_shared<Mutator>(filter, filter_rect);
-  vector_.push_back(element);
+  Push(filter, filter_rect);
 };
 
 void MutatorsStack::Pop() {
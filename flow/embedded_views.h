@@ -10,6 +10,7 @@
 #include "flutter/display_list/display_list_builder.h"
 #include "flutter/flow/rtree.h"
 #include "flutter/flow/surface_frame.h"
+#include "flutter/fml/memory/arena.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/raster_thread_merger.h"
 #include "third_party/skia/include/core/SkCanvas.h"
@@ -180,6 +181,17 @@ class MutatorsStack {
  public:
   MutatorsStack() = default;
 
+  // Allocates the mutators from |arena|, which must outlive the stack. This
+  // is meant for the stacks that only live for a frame.
+  //
+  // Copies of the stack allocate their mutators on the heap, so they may
+  // outlive the arena.
+  explicit MutatorsStack(fml::Arena* arena) : arena_(arena) {}
+
+  MutatorsStack(const MutatorsStack& other);
+
+  MutatorsStack& operator=(const MutatorsStack& other);
+
   void PushClipRect(const SkRect& rect);
   void PushClipRRect(const SkRRect& rrect);
   void PushClipPath(const SkPath& path);
@@ -244,6 +256,10 @@ class MutatorsStack {
   }
 
  private:
+  template <typename... Args>
+  void Push(Args&&... args);
+
+  fml::Arena* arena_ = nullptr;
   std::vector<std::shared_ptr<Mutator>> vector_;
 };  // MutatorsStack
 
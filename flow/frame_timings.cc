@@ -4,6 +4,8 @@
 
 #include "flutter/flow/frame_timings.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
 
@@ -73,6 +75,12 @@ fml::TimeDelta FrameTimingsRecorder::GetBuildDuration() const {
   return build_end_ - build_start_;
 }
 
+fml::TimeDelta FrameTimingsRecorder::GetRasterGPUTime() const {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ >= State::kRasterEnd);
+  return raster_gpu_time_;
+}
+
 /// Count of the layer cache entries
 size_t FrameTimingsRecorder::GetLayerCacheCount() const {
   std::scoped_lock state_lock(state_mutex_);
@@ -131,6 +139,13 @@ void FrameTimingsRecorder::RecordRasterStart(fml::TimePoint raster_start) {
   raster_start_ = raster_start;
 }
 
+void FrameTimingsRecorder::RecordRasterGPUTime(
+    fml::TimeDelta raster_gpu_time) {
+  std::scoped_lock state_lock(state_mutex_);
+  FML_DCHECK(state_ == State::kRasterStart);
+  raster_gpu_time_ = raster_gpu_time;
+}
+
 FrameTiming FrameTimingsRecorder::RecordRasterEnd(const RasterCache* cache) {
   std::scoped_lock state_lock(state_mutex_);
   FML_DCHECK(state_ == State::kRasterStart);
@@ -157,6 +172,7 @@ FrameTiming FrameTimingsRecorder::RecordRasterEnd(const RasterCache* cache) {
   timing_.SetFrameNumber(GetFrameNumber());
   timing_.SetRasterCacheStatistics(layer_cache_count_, layer_cache_bytes_,
                                    picture_cache_count_, picture_cache_bytes_);
+  timing_.SetRasterGPUTime(raster_gpu_time_);
   return timing_;
 }
 
@@ -194,6 +210,7 @@ std::unique_ptr<FrameTimingsRecorder> FrameTimingsRecorder::CloneUntil(
   if (state >= State::kRasterEnd) {
     recorder->raster_end_ = raster_end_;
     recorder->raster_end_wall_time_ = raster_end_wall_time_;
+    recorder->raster_gpu_time_ = raster_gpu_time_;
     recorder->layer_cache_count_ = layer_cache_count_;
     recorder->layer_cache_bytes_ = layer_cache_bytes_;
     recorder->picture_cache_count_ = picture_cache_count_;
@@ -211,4 +228,130 @@ const char* FrameTimingsRecorder::GetFrameNumberTraceArg() const {
   return frame_number_trace_arg_val_.c_str();
 }
 
+void FrameDurationHistogram::Add(fml::TimeDelta duration) {
+  int64_t bucket =
+      std::max<int64_t>(duration.ToMicroseconds(), 0) / kBucketMicros;
+  buckets_[std::min<int64_t>(bucket, kBucketCount)]++;
+  count_++;
+  max_ = std::max(max_, duration);
+}
+
+void FrameDurationHistogram::Reset() {
+  buckets_.fill(0);
+  count_ = 0;
+  max_ = fml::TimeDelta::Zero();
+}
+
+FrameDurationPercentiles FrameDurationHistogram::GetPercentiles() const {
+  return {
+      .p50 = GetPercentile(0.5),
+      .p90 = GetPercentile(0.9),
+      .p99 = GetPercentile(0.99),
+      .max = max_,
+  };
+}
+
+fml::TimeDelta FrameDurationHistogram::GetPercentile(double percentile) const {
+  if (count_ == 0) {
+    return fml::TimeDelta::Zero();
+  }
+  size_t rank = std::max<size_t>(std::ceil(percentile * count_), 1);
+  size_t seen = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      auto bucket_end = fml::TimeDelta::FromMicroseconds(
+          static_cast<int64_t>(i + 1) * kBucketMicros);
+      return std::min(bucket_end, max_);
+    }
+  }
+  return max_;
+}
+
+void FrameTimingStatisticsCollector::Add(const FrameTiming& timing,
+                                         fml::TimeDelta frame_budget) {
+  std::scoped_lock lock(mutex_);
+  frame_count_++;
+  if (timing.Get(FrameTiming::kRasterFinish) -
+          timing.Get(FrameTiming::kVsyncStart) >
+      frame_budget) {
+    vsync_overrun_count_++;
+  }
+  build_.Add(timing.Get(FrameTiming::kBuildFinish) -
+             timing.Get(FrameTiming::kBuildStart));
+  raster_.Add(timing.Get(FrameTiming::kRasterFinish) -
+              timing.Get(FrameTiming::kRasterStart));
+  if (timing.GetRasterGPUTime() > fml::TimeDelta::Zero()) {
+    raster_gpu_.Add(timing.GetRasterGPUTime());
+  }
+  const uint64_t frame_number = timing.GetFrameNumber();
+  pending_presentations_[frame_number % kPendingPresentationCount] = {
+      .frame_number = frame_number,
+      .vsync_start = timing.Get(FrameTiming::kVsyncStart),
+  };
+}
+
+std::optional<fml::TimeDelta> FrameTimingStatisticsCollector::AddPresentation(
+    uint64_t frame_number,
+    fml::TimePoint presentation_time,
+    fml::TimeDelta frame_budget) {
+  std::scoped_lock lock(mutex_);
+  PendingPresentation& pending =
+      pending_presentations_[frame_number % kPendingPresentationCount];
+  if (frame_number == 0 || pending.frame_number != frame_number) {
+    return std::nullopt;
+  }
+  pending.frame_number = 0;
+
+  const fml::TimeDelta latency = presentation_time - pending.vsync_start;
+  presented_frame_count_++;
+  if (latency > frame_budget + frame_budget / 2) {
+    missed_presentation_count_++;
+  }
+  presentation_latency_.Add(latency);
+  return latency;
+}
+
+FrameTimingStatistics FrameTimingStatisticsCollector::GetStatistics() const {
+  std::scoped_lock lock(mutex_);
+  return GetStatisticsLocked();
+}
+
+FrameTimingStatistics FrameTimingStatisticsCollector::TakeStatistics() {
+  std::scoped_lock lock(mutex_);
+  FrameTimingStatistics statistics = GetStatisticsLocked();
+  ResetLocked();
+  return statistics;
+}
+
+void FrameTimingStatisticsCollector::Reset() {
+  std::scoped_lock lock(mutex_);
+  ResetLocked();
+}
+
+FrameTimingStatistics FrameTimingStatisticsCollector::GetStatisticsLocked()
+    const {
+  return {
+      .frame_count = frame_count_,
+      .vsync_overrun_count = vsync_overrun_count_,
+      .build = build_.GetPercentiles(),
+      .raster = raster_.GetPercentiles(),
+      .raster_gpu = raster_gpu_.GetPercentiles(),
+      .presented_frame_count = presented_frame_count_,
+      .missed_presentation_count = missed_presentation_count_,
+      .presentation_latency = presentation_latency_.GetPercentiles(),
+  };
+}
+
+void FrameTimingStatisticsCollector::ResetLocked() {
+  frame_count_ = 0;
+  vsync_overrun_count_ = 0;
+  build_.Reset();
+  raster_.Reset();
+  raster_gpu_.Reset();
+  presented_frame_count_ = 0;
+  missed_presentation_count_ = 0;
+  presentation_latency_.Reset();
+}
+
 }  // namespace flutter
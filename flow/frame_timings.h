@@ -5,7 +5,9 @@
 #ifndef FLUTTER_FLOW_FRAME_TIMINGS_H_
 #define FLUTTER_FLOW_FRAME_TIMINGS_H_
 
+#include <array>
 #include <mutex>
+#include <optional>
 
 #include "flutter/common/settings.h"
 #include "flutter/flow/raster_cache.h"
@@ -83,6 +85,10 @@ class FrameTimingsRecorder {
   /// Total Bytes in all picture cache entries
   size_t GetPictureCacheBytes() const;
 
+  /// GPU time of the raster work that completed during rasterization. Zero
+  /// if the rendering backend does not measure GPU time.
+  fml::TimeDelta GetRasterGPUTime() const;
+
   /// Records a vsync event.
   void RecordVsync(fml::TimePoint vsync_start, fml::TimePoint vsync_target);
 
@@ -95,6 +101,10 @@ class FrameTimingsRecorder {
   /// Records a raster start event.
   void RecordRasterStart(fml::TimePoint raster_start);
 
+  /// Records the GPU time of raster work. GPU timings are only known once the
+  /// GPU is done, so this usually covers the work of an earlier frame.
+  void RecordRasterGPUTime(fml::TimeDelta raster_gpu_time);
+
   /// Clones the recorder until (and including) the specified state.
   std::unique_ptr<FrameTimingsRecorder> CloneUntil(State state);
 
@@ -129,6 +139,7 @@ class FrameTimingsRecorder {
   fml::TimePoint raster_start_;
   fml::TimePoint raster_end_;
   fml::TimePoint raster_end_wall_time_;
+  fml::TimeDelta raster_gpu_time_;
 
   size_t layer_cache_count_;
   size_t layer_cache_bytes_;
@@ -141,6 +152,130 @@ class FrameTimingsRecorder {
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(FrameTimingsRecorder);
 };
 
+/// The distribution of a frame duration over a number of frames.
+struct FrameDurationPercentiles {
+  fml::TimeDelta p50;
+  fml::TimeDelta p90;
+  fml::TimeDelta p99;
+  fml::TimeDelta max;
+};
+
+/// Aggregated timings of the frames that were rasterized since the
+/// statistics were last reset.
+struct FrameTimingStatistics {
+  size_t frame_count = 0;
+  /// The number of frames that took longer than the frame budget from the
+  /// start of their vsync to the end of their rasterization.
+  size_t vsync_overrun_count = 0;
+  FrameDurationPercentiles build;
+  FrameDurationPercentiles raster;
+  /// Only the frames for which the GPU time was measured are included.
+  FrameDurationPercentiles raster_gpu;
+  /// The number of frames whose presentation on the display was reported.
+  size_t presented_frame_count = 0;
+  /// The number of presented frames that were displayed later than the
+  /// refresh that follows the end of their vsync interval.
+  size_t missed_presentation_count = 0;
+  /// The time from the start of the vsync of the presented frames to their
+  /// presentation on the display.
+  FrameDurationPercentiles presentation_latency;
+};
+
+/// A histogram of durations with fixed size buckets, from which percentiles
+/// can be computed without keeping every duration.
+///
+/// Percentiles are rounded up to the end of their bucket, durations that
+/// are past the last bucket are only accounted for by the max.
+class FrameDurationHistogram {
+ public:
+  static constexpr int64_t kBucketMicros = 100;
+  static constexpr size_t kBucketCount = 1000;
+
+  FrameDurationHistogram() = default;
+
+  void Add(fml::TimeDelta duration);
+
+  void Reset();
+
+  size_t count() const { return count_; }
+
+  FrameDurationPercentiles GetPercentiles() const;
+
+ private:
+  // The last bucket collects all the durations that are past kBucketCount
+  // buckets.
+  std::array<uint32_t, kBucketCount + 1> buckets_ = {};
+  size_t count_ = 0;
+  fml::TimeDelta max_;
+
+  fml::TimeDelta GetPercentile(double percentile) const;
+};
+
+/// Aggregates the |FrameTiming| of rasterized frames into streaming
+/// |FrameTimingStatistics|, so that they can be monitored without keeping
+/// the timings of every frame.
+///
+/// This class is thread safe, frames are usually added on the raster thread
+/// while the statistics can be read from any thread.
+class FrameTimingStatisticsCollector {
+ public:
+  FrameTimingStatisticsCollector() = default;
+
+  /// Adds a rasterized frame. |frame_budget| is the time that the frame had
+  /// from the start of its vsync to the end of its rasterization.
+  void Add(const FrameTiming& timing, fml::TimeDelta frame_budget);
+
+  /// Adds the time at which the frame numbered |frame_number| was displayed.
+  /// Only the most recently rasterized frames can be matched to their
+  /// presentation, the presentations of other frames are ignored.
+  ///
+  /// A presented frame misses its deadline when it is displayed more than
+  /// half a |frame_budget| after the end of its vsync interval, that is
+  /// after the refresh at which it was due.
+  ///
+  /// Returns the latency of the frame or std::nullopt if the presentation
+  /// was ignored.
+  std::optional<fml::TimeDelta> AddPresentation(
+      uint64_t frame_number,
+      fml::TimePoint presentation_time,
+      fml::TimeDelta frame_budget);
+
+  FrameTimingStatistics GetStatistics() const;
+
+  /// Returns the statistics and resets them, without losing any frame that
+  /// is added concurrently.
+  FrameTimingStatistics TakeStatistics();
+
+  void Reset();
+
+ private:
+  // The number of recently rasterized frames whose vsync start is kept
+  // until they are presented.
+  static constexpr size_t kPendingPresentationCount = 8;
+
+  struct PendingPresentation {
+    uint64_t frame_number = 0;
+    fml::TimePoint vsync_start;
+  };
+
+  mutable std::mutex mutex_;
+  size_t frame_count_ = 0;
+  size_t vsync_overrun_count_ = 0;
+  FrameDurationHistogram build_;
+  FrameDurationHistogram raster_;
+  FrameDurationHistogram raster_gpu_;
+  size_t presented_frame_count_ = 0;
+  size_t missed_presentation_count_ = 0;
+  FrameDurationHistogram presentation_latency_;
+  std::array<PendingPresentation, kPendingPresentationCount>
+      pending_presentations_;
+
+  FrameTimingStatistics GetStatisticsLocked() const;
+  void ResetLocked();
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameTimingStatisticsCollector);
+};
+
 }  // namespace flutter
 
 #endif  // FLUTTER_FLOW_FRAME_TIMINGS_H_
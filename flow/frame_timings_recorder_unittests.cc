@@ -76,6 +76,24 @@ TEST(FrameTimingsRecorderTest, RecordRasterTimes) {
   ASSERT_EQ(recorder->GetPictureCacheBytes(), 0u);
 }
 
+TEST(FrameTimingsRecorderTest, RecordRasterGPUTime) {
+  auto recorder = std::make_unique<FrameTimingsRecorder>();
+
+  const auto now = fml::TimePoint::Now();
+  recorder->RecordVsync(now, now + fml::TimeDelta::FromMilliseconds(16));
+  recorder->RecordBuildStart(fml::TimePoint::Now());
+  recorder->RecordBuildEnd(fml::TimePoint::Now());
+  recorder->RecordRasterStart(fml::TimePoint::Now());
+  recorder->RecordRasterGPUTime(fml::TimeDelta::FromMilliseconds(4));
+  const auto timing = recorder->RecordRasterEnd();
+
+  ASSERT_EQ(recorder->GetRasterGPUTime(), fml::TimeDelta::FromMilliseconds(4));
+  ASSERT_EQ(timing.GetRasterGPUTime(), fml::TimeDelta::FromMilliseconds(4));
+
+  auto cloned = recorder->CloneUntil(FrameTimingsRecorder::State::kRasterEnd);
+  ASSERT_EQ(recorder->GetRasterGPUTime(), cloned->GetRasterGPUTime());
+}
+
 TEST(FrameTimingsRecorderTest, RecordRasterTimesWithCache) {
   auto recorder = std::make_unique<FrameTimingsRecorder>();
 
@@ -297,5 +315,104 @@ TEST(FrameTimingsRecorderTest, FrameNumberTraceArgIsValid) {
   ASSERT_EQ(actual_arg, expected_arg);
 }
 
+TEST(FrameDurationHistogramTest, EmptyHistogramHasZeroPercentiles) {
+  FrameDurationHistogram histogram;
+  const auto percentiles = histogram.GetPercentiles();
+  ASSERT_EQ(percentiles.p50, fml::TimeDelta::Zero());
+  ASSERT_EQ(percentiles.p99, fml::TimeDelta::Zero());
+  ASSERT_EQ(percentiles.max, fml::TimeDelta::Zero());
+}
+
+TEST(FrameDurationHistogramTest, ComputesPercentiles) {
+  FrameDurationHistogram histogram;
+  for (int i = 1; i <= 100; i++) {
+    histogram.Add(fml::TimeDelta::FromMilliseconds(i));
+  }
+  ASSERT_EQ(histogram.count(), 100u);
+
+  const auto percentiles = histogram.GetPercentiles();
+  // Percentiles are rounded up to the end of their bucket.
+  ASSERT_EQ(percentiles.p50, fml::TimeDelta::FromMicroseconds(50100));
+  ASSERT_EQ(percentiles.p90, fml::TimeDelta::FromMicroseconds(90100));
+  ASSERT_EQ(percentiles.p99, fml::TimeDelta::FromMicroseconds(99100));
+  ASSERT_EQ(percentiles.max, fml::TimeDelta::FromMilliseconds(100));
+}
+
+TEST(FrameDurationHistogramTest, LongDurationsAreReportedAsMax) {
+  FrameDurationHistogram histogram;
+  histogram.Add(fml::TimeDelta::FromSeconds(2));
+  const auto percentiles = histogram.GetPercentiles();
+  ASSERT_EQ(percentiles.p50, fml::TimeDelta::FromSeconds(2));
+  ASSERT_EQ(percentiles.max, fml::TimeDelta::FromSeconds(2));
+}
+
+TEST(FrameTimingStatisticsCollectorTest, CountsVsyncOverruns) {
+  const auto frame_budget = fml::TimeDelta::FromMilliseconds(16);
+  const auto vsync_start = fml::TimePoint::Now();
+  auto make_timing = [&vsync_start](int raster_end_millis,
+                                    int gpu_time_millis) {
+    FrameTiming timing;
+    timing.Set(FrameTiming::kVsyncStart, vsync_start);
+    timing.Set(FrameTiming::kBuildStart, vsync_start);
+    timing.Set(FrameTiming::kBuildFinish,
+               vsync_start + fml::TimeDelta::FromMilliseconds(2));
+    timing.Set(FrameTiming::kRasterStart,
+               vsync_start + fml::TimeDelta::FromMilliseconds(2));
+    timing.Set(FrameTiming::kRasterFinish,
+               vsync_start +
+                   fml::TimeDelta::FromMilliseconds(raster_end_millis));
+    timing.SetRasterGPUTime(fml::TimeDelta::FromMilliseconds(gpu_time_millis));
+    return timing;
+  };
+
+  FrameTimingStatisticsCollector collector;
+  collector.Add(make_timing(10, 0), frame_budget);
+  collector.Add(make_timing(20, 5), frame_budget);
+
+  auto statistics = collector.GetStatistics();
+  ASSERT_EQ(statistics.frame_count, 2u);
+  ASSERT_EQ(statistics.vsync_overrun_count, 1u);
+  ASSERT_EQ(statistics.build.max, fml::TimeDelta::FromMilliseconds(2));
+  ASSERT_EQ(statistics.raster.max, fml::TimeDelta::FromMilliseconds(18));
+  // Only the frame with a measured GPU time is included.
+  ASSERT_EQ(statistics.raster_gpu.p50, fml::TimeDelta::FromMilliseconds(5));
+
+  statistics = collector.TakeStatistics();
+  ASSERT_EQ(statistics.frame_count, 2u);
+  statistics = collector.GetStatistics();
+  ASSERT_EQ(statistics.frame_count, 0u);
+  ASSERT_EQ(statistics.vsync_overrun_count, 0u);
+}
+
+TEST(FrameTimingStatisticsCollectorTest, MeasuresPresentationLatency) {
+  const auto frame_budget = fml::TimeDelta::FromMilliseconds(16);
+  const auto vsync_start = fml::TimePoint::Now();
+  FrameTimingStatisticsCollector collector;
+  for (uint64_t frame_number = 1; frame_number <= 2; frame_number++) {
+    FrameTiming timing;
+    timing.SetFrameNumber(frame_number);
+    timing.Set(FrameTiming::kVsyncStart, vsync_start);
+    collector.Add(timing, frame_budget);
+  }
+
+  const auto on_time = vsync_start + frame_budget;
+  const auto late = vsync_start + frame_budget * 2;
+  // Frames that were never rasterized and repeated presentations are
+  // ignored.
+  ASSERT_FALSE(collector.AddPresentation(3, on_time, frame_budget));
+  ASSERT_EQ(collector.AddPresentation(1, on_time, frame_budget), frame_budget);
+  ASSERT_FALSE(collector.AddPresentation(1, on_time, frame_budget));
+  ASSERT_EQ(collector.AddPresentation(2, late, frame_budget), frame_budget * 2);
+
+  auto statistics = collector.TakeStatistics();
+  ASSERT_EQ(statistics.presented_frame_count, 2u);
+  ASSERT_EQ(statistics.missed_presentation_count, 1u);
+  ASSERT_EQ(statistics.presentation_latency.max, frame_budget * 2);
+
+  statistics = collector.GetStatistics();
+  ASSERT_EQ(statistics.presented_frame_count, 0u);
+  ASSERT_EQ(statistics.missed_presentation_count, 0u);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -11,15 +11,38 @@
 
 namespace flutter {
 
-static const size_t kMaxSamples = 120;
+static const size_t kMaxSamples = Stopwatch::kMaxSamples;
 static const size_t kMaxFrameMarkers = 8;
 
+fml::TimeDelta Stopwatch::Snapshot::LastLap() const {
+  return laps[(lap_count + kMaxSamples - 1) % kMaxSamples];
+}
+
+fml::TimeDelta Stopwatch::Snapshot::MaxDelta() const {
+  fml::TimeDelta max_delta;
+  for (size_t i = 0; i < kMaxSamples; i++) {
+    if (laps[i] > max_delta) {
+      max_delta = laps[i];
+    }
+  }
+  return max_delta;
+}
+
+fml::TimeDelta Stopwatch::Snapshot::AverageDelta() const {
+  fml::TimeDelta sum;  // default to 0
+  for (size_t i = 0; i < kMaxSamples; i++) {
+    sum = sum + laps[i];
+  }
+  return sum / kMaxSamples;
+}
+
 Stopwatch::Stopwatch(const RefreshRateUpdater& updater)
     : refresh_rate_updater_(updater),
       start_(fml::TimePoint::Now()),
-      current_sample_(0) {
-  const fml::TimeDelta delta = fml::TimeDelta::Zero();
-  laps_.resize(kMaxSamples, delta);
+      lap_count_(0) {
+  for (auto& lap : laps_) {
+    lap.store(0, std::memory_order_relaxed);
+  }
   cache_dirty_ = true;
   prev_drawn_sample_index_ = 0;
 }
@@ -36,20 +59,40 @@ FixedRefreshRateUpdater::FixedRefreshRateUpdater(
 
 void Stopwatch::Start() {
   start_ = fml::TimePoint::Now();
-  current_sample_ = (current_sample_ + 1) % kMaxSamples;
+  lap_count_.fetch_add(1, std::memory_order_release);
 }
 
 void Stopwatch::Stop() {
-  laps_[current_sample_] = fml::TimePoint::Now() - start_;
+  const uint64_t lap_count = lap_count_.load(std::memory_order_relaxed);
+  laps_[lap_count % kMaxSamples].store(
+      (fml::TimePoint::Now() - start_).ToNanoseconds(),
+      std::memory_order_release);
 }
 
 void Stopwatch::SetLapTime(const fml::TimeDelta& delta) {
-  current_sample_ = (current_sample_ + 1) % kMaxSamples;
-  laps_[current_sample_] = delta;
+  const uint64_t lap_count = lap_count_.load(std::memory_order_relaxed) + 1;
+  laps_[lap_count % kMaxSamples].store(delta.ToNanoseconds(),
+                                       std::memory_order_relaxed);
+  lap_count_.store(lap_count, std::memory_order_release);
 }
 
-const fml::TimeDelta& Stopwatch::LastLap() const {
-  return laps_[(current_sample_ - 1) % kMaxSamples];
+fml::TimeDelta Stopwatch::GetLap(size_t index) const {
+  return fml::TimeDelta::FromNanoseconds(
+      laps_[index].load(std::memory_order_acquire));
+}
+
+Stopwatch::Snapshot Stopwatch::GetSnapshot() const {
+  Snapshot snapshot;
+  snapshot.lap_count = lap_count_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < kMaxSamples; i++) {
+    snapshot.laps[i] = GetLap(i);
+  }
+  return snapshot;
+}
+
+fml::TimeDelta Stopwatch::LastLap() const {
+  const uint64_t lap_count = lap_count_.load(std::memory_order_acquire);
+  return GetLap((lap_count + kMaxSamples - 1) % kMaxSamples);
 }
 
 double Stopwatch::UnitFrameInterval(double raster_time_ms) const {
@@ -66,21 +109,11 @@ double Stopwatch::UnitHeight(double raster_time_ms,
 }
 
 fml::TimeDelta Stopwatch::MaxDelta() const {
-  fml::TimeDelta max_delta;
-  for (size_t i = 0; i < kMaxSamples; i++) {
-    if (laps_[i] > max_delta) {
-      max_delta = laps_[i];
-    }
-  }
-  return max_delta;
+  return GetSnapshot().MaxDelta();
 }
 
 fml::TimeDelta Stopwatch::AverageDelta() const {
-  fml::TimeDelta sum;  // default to 0
-  for (size_t i = 0; i < kMaxSamples; i++) {
-    sum = sum + laps_[i];
-  }
-  return sum / kMaxSamples;
+  return GetSnapshot().AverageDelta();
 }
 
 // Initialize the SkSurface for drawing into. Draws the base background and any
@@ -104,6 +137,8 @@ void Stopwatch::InitVisualizeSurface(const SkRect& rect) const {
       SkSurface::MakeRasterN32Premul(rect.width(), rect.height());
 
   SkCanvas* cache_canvas = visualize_cache_surface_->getCanvas();
+  const Snapshot snapshot = GetSnapshot();
+  const auto& laps = snapshot.laps;
 
   // Establish the graph position.
   const SkScalar x = 0;
@@ -127,7 +162,7 @@ void Stopwatch::InitVisualizeSurface(const SkRect& rect) const {
   SkPath path;
   path.setIsVolatile(true);
   path.moveTo(x, height);
-  path.lineTo(x, y + height * (1.0 - UnitHeight(laps_[0].ToMillisecondsF(),
+  path.lineTo(x, y + height * (1.0 - UnitHeight(laps[0].ToMillisecondsF(),
                                                 max_unit_interval)));
   double unit_x;
   double unit_next_x = 0.0;
@@ -135,14 +170,14 @@ void Stopwatch::InitVisualizeSurface(const SkRect& rect) const {
     unit_x = unit_next_x;
     unit_next_x = (static_cast<double>(i + 1) / kMaxSamples);
     const double sample_y =
-        y + height * (1.0 - UnitHeight(laps_[i].ToMillisecondsF(),
+        y + height * (1.0 - UnitHeight(laps[i].ToMillisecondsF(),
                                        max_unit_interval));
     path.lineTo(x + width * unit_x, sample_y);
     path.lineTo(x + width * unit_next_x, sample_y);
   }
   path.lineTo(
       width,
-      y + height * (1.0 - UnitHeight(laps_[kMaxSamples - 1].ToMillisecondsF(),
+      y + height * (1.0 - UnitHeight(laps[kMaxSamples - 1].ToMillisecondsF(),
                                      max_unit_interval)));
   path.lineTo(width, height);
   path.close();
@@ -159,6 +194,13 @@ void Stopwatch::Visualize(SkCanvas* canvas, const SkRect& rect) const {
   SkCanvas* cache_canvas = visualize_cache_surface_->getCanvas();
   SkPaint paint;
 
+  // Read the recording position once, the recording thread may advance it
+  // while the graph is drawn.
+  const uint64_t lap_count = lap_count_.load(std::memory_order_acquire);
+  const size_t current_sample = lap_count % kMaxSamples;
+  const fml::TimeDelta last_lap =
+      GetLap((lap_count + kMaxSamples - 1) % kMaxSamples);
+
   // Establish the graph position.
   const SkScalar x = 0;
   const SkScalar y = 0;
@@ -188,11 +230,8 @@ void Stopwatch::Visualize(SkCanvas* canvas, const SkRect& rect) const {
   paint.setBlendMode(SkBlendMode::kSrcOver);
   const auto bar_rect = SkRect::MakeLTRB(
       sample_x,
-      y + height * (1.0 -
-                    UnitHeight(laps_[current_sample_ == 0 ? kMaxSamples - 1
-                                                          : current_sample_ - 1]
-                                   .ToMillisecondsF(),
-                               max_unit_interval)),
+      y + height *
+              (1.0 - UnitHeight(last_lap.ToMillisecondsF(), max_unit_interval)),
       sample_x + width * sample_unit_width, height);
   cache_canvas->drawRect(bar_rect, paint);
 
@@ -227,18 +266,18 @@ void Stopwatch::Visualize(SkCanvas* canvas, const SkRect& rect) const {
   // paint this we don't yet have all the times for the current frame.
   paint.setStyle(SkPaint::Style::kFill_Style);
   paint.setBlendMode(SkBlendMode::kSrcOver);
-  if (UnitFrameInterval(LastLap().ToMillisecondsF()) > 1.0) {
+  if (UnitFrameInterval(last_lap.ToMillisecondsF()) > 1.0) {
     // budget exceeded
     paint.setColor(SK_ColorRED);
   } else {
     // within budget
     paint.setColor(SK_ColorGREEN);
   }
-  sample_x = x + width * (static_cast<double>(current_sample_) / kMaxSamples);
+  sample_x = x + width * (static_cast<double>(current_sample) / kMaxSamples);
   const auto marker_rect = SkRect::MakeLTRB(
       sample_x, y, sample_x + width * sample_unit_width, height);
   cache_canvas->drawRect(marker_rect, paint);
-  prev_drawn_sample_index_ = current_sample_;
+  prev_drawn_sample_index_ = current_sample;
 
   // Draw the cached surface onto the output canvas.
   visualize_cache_surface_->draw(canvas, rect.x(), rect.y());
@@ -5,7 +5,9 @@
 #ifndef FLUTTER_FLOW_INSTRUMENTATION_H_
 #define FLUTTER_FLOW_INSTRUMENTATION_H_
 
-#include <vector>
+#include <array>
+#include <atomic>
+#include <cstdint>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_delta.h"
@@ -14,8 +16,31 @@
 
 namespace flutter {
 
+/// Records the durations of the last |kMaxSamples| laps.
+///
+/// Laps are recorded by a single thread into a lock-free ring buffer and
+/// can be read from any other thread without blocking the recording thread.
+/// A reader that races with the recording thread may observe a mix of old
+/// and new samples, but never a partially written sample.
 class Stopwatch {
  public:
+  static constexpr size_t kMaxSamples = 120;
+
+  /// A copy of all samples of a stopwatch at one point in time.
+  struct Snapshot {
+    std::array<fml::TimeDelta, kMaxSamples> laps;
+    /// The total number of laps that were started or set. The lap in
+    /// progress, or the last lap that was set, is at index
+    /// |lap_count % kMaxSamples|.
+    uint64_t lap_count = 0;
+
+    fml::TimeDelta LastLap() const;
+
+    fml::TimeDelta MaxDelta() const;
+
+    fml::TimeDelta AverageDelta() const;
+  };
+
   /// The refresh rate interface for `Stopwatch`.
   class RefreshRateUpdater {
    public:
@@ -30,12 +55,15 @@ class Stopwatch {
 
   ~Stopwatch();
 
-  const fml::TimeDelta& LastLap() const;
+  fml::TimeDelta LastLap() const;
 
   fml::TimeDelta MaxDelta() const;
 
   fml::TimeDelta AverageDelta() const;
 
+  /// Copies the samples without blocking the thread that records them.
+  Snapshot GetSnapshot() const;
+
   void InitVisualizeSurface(const SkRect& rect) const;
 
   void Visualize(SkCanvas* canvas, const SkRect& rect) const;
@@ -53,10 +81,15 @@ class Stopwatch {
   inline double UnitFrameInterval(double time_ms) const;
   inline double UnitHeight(double time_ms, double max_height) const;
 
+  fml::TimeDelta GetLap(size_t index) const;
+
   const RefreshRateUpdater& refresh_rate_updater_;
   fml::TimePoint start_;
-  std::vector<fml::TimeDelta> laps_;
-  size_t current_sample_;
+  // Lap durations in nanoseconds. Only written by the recording thread.
+  std::array<std::atomic<int64_t>, kMaxSamples> laps_;
+  // Published with release semantics, so that a reader that acquires it also
+  // sees the laps that were written before it was advanced.
+  std::atomic<uint64_t> lap_count_;
 
   // Mutable data cache for performance optimization of the graphs. Prevents
   // expensive redrawing of old data.
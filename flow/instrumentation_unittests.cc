@@ -3,6 +3,9 @@
 // found in the LICENSE file.
 
 #include "flutter/flow/instrumentation.h"
+
+#include <thread>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -42,5 +45,48 @@ TEST(Instrumentation, GetFrameBudgetFromUpdaterTest) {
   EXPECT_EQ(frame_budget_90fps, actual_frame_budget);
 }
 
+TEST(Instrumentation, LastLapBeforeAnyLapIsZero) {
+  FixedRefreshRateStopwatch stopwatch;
+  EXPECT_EQ(stopwatch.LastLap(), fml::TimeDelta::Zero());
+  EXPECT_EQ(stopwatch.MaxDelta(), fml::TimeDelta::Zero());
+}
+
+TEST(Instrumentation, SnapshotContainsSetLaps) {
+  FixedRefreshRateStopwatch stopwatch;
+  for (size_t i = 1; i <= Stopwatch::kMaxSamples + 10; i++) {
+    stopwatch.SetLapTime(fml::TimeDelta::FromMicroseconds(i));
+  }
+
+  Stopwatch::Snapshot snapshot = stopwatch.GetSnapshot();
+  EXPECT_EQ(snapshot.lap_count, Stopwatch::kMaxSamples + 10);
+  EXPECT_EQ(snapshot.LastLap(),
+            fml::TimeDelta::FromMicroseconds(Stopwatch::kMaxSamples + 10));
+  EXPECT_EQ(snapshot.MaxDelta(), snapshot.LastLap());
+  EXPECT_EQ(stopwatch.LastLap(), snapshot.LastLap());
+  EXPECT_EQ(stopwatch.MaxDelta(), snapshot.MaxDelta());
+  EXPECT_EQ(stopwatch.AverageDelta(), snapshot.AverageDelta());
+  // The first ten laps have been overwritten, leaving laps 11us to 130us.
+  EXPECT_EQ(snapshot.AverageDelta(), fml::TimeDelta::FromNanoseconds(70500));
+}
+
+TEST(Instrumentation, SnapshotsCanBeTakenWhileRecording) {
+  FixedRefreshRateStopwatch stopwatch;
+  const fml::TimeDelta lap = fml::TimeDelta::FromMilliseconds(3);
+  std::thread recorder([&stopwatch, lap]() {
+    for (int i = 0; i < 10000; i++) {
+      stopwatch.SetLapTime(lap);
+    }
+  });
+  for (int i = 0; i < 100; i++) {
+    Stopwatch::Snapshot snapshot = stopwatch.GetSnapshot();
+    for (const fml::TimeDelta& sample : snapshot.laps) {
+      ASSERT_TRUE(sample == fml::TimeDelta::Zero() || sample == lap);
+    }
+  }
+  recorder.join();
+  EXPECT_EQ(stopwatch.GetSnapshot().lap_count, 10000u);
+  EXPECT_EQ(stopwatch.AverageDelta(), lap);
+}
+
 }  // namespace testing
 }  // namespace flutter
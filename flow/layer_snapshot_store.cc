@@ -26,4 +26,65 @@ void LayerSnapshotStore::Add(const LayerSnapshotData& data) {
   layer_snapshots_.push_back(data);
 }
 
+LayerRasterTimingStore::AutoTiming::AutoTiming(LayerRasterTimingStore* store,
+                                               int64_t layer_unique_id)
+    : store_(store), layer_unique_id_(layer_unique_id) {
+  if (store_) {
+    start_ = fml::TimePoint::Now();
+  }
+}
+
+LayerRasterTimingStore::AutoTiming::~AutoTiming() {
+  if (store_) {
+    store_->Add(layer_unique_id_, fml::TimePoint::Now() - start_);
+  }
+}
+
+LayerRasterTimingStore::LayerRasterTimingStore(size_t capacity)
+    : capacity_(capacity) {
+  FML_DCHECK(capacity_ > 0);
+}
+
+void LayerRasterTimingStore::SetEnabled(bool enabled) {
+  enabled_ = enabled;
+  if (!enabled_) {
+    Clear();
+  }
+}
+
+void LayerRasterTimingStore::Add(int64_t layer_unique_id,
+                                 const fml::TimeDelta& duration) {
+  LayerRasterTiming timing = {
+      .layer_unique_id = layer_unique_id,
+      .frame_number = frame_number_,
+      .duration = duration,
+  };
+  if (timings_.size() < capacity_) {
+    timings_.push_back(timing);
+  } else {
+    timings_[next_index_] = timing;
+  }
+  next_index_ = (next_index_ + 1) % capacity_;
+}
+
+void LayerRasterTimingStore::Clear() {
+  timings_.clear();
+  next_index_ = 0;
+}
+
+std::vector<LayerRasterTiming> LayerRasterTimingStore::GetTimings() const {
+  if (timings_.size() < capacity_) {
+    return timings_;
+  }
+  // The buffer is full, so the oldest timing is the one that will be
+  // overwritten next.
+  std::vector<LayerRasterTiming> timings;
+  timings.reserve(capacity_);
+  timings.insert(timings.end(), timings_.begin() + next_index_,
+                 timings_.end());
+  timings.insert(timings.end(), timings_.begin(),
+                 timings_.begin() + next_index_);
+  return timings;
+}
+
 }  // namespace flutter
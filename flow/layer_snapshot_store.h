@@ -9,6 +9,7 @@
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
 
 #include "third_party/skia/include/core/SkImageEncoder.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
@@ -74,6 +75,76 @@ class LayerSnapshotStore {
   FML_DISALLOW_COPY_AND_ASSIGN(LayerSnapshotStore);
 };
 
+/// The time taken to rasterize a leaf layer, identified by its unique id,
+/// in a given frame.
+struct LayerRasterTiming {
+  int64_t layer_unique_id;
+  uint64_t frame_number;
+  fml::TimeDelta duration;
+};
+
+/// Continuously collects the time taken to rasterize leaf layers into a
+/// fixed size ring buffer, overwriting the oldest timings once it is full.
+///
+/// Unlike the |LayerSnapshotStore| this does not render the layers a second
+/// time, so it is cheap enough to stay enabled over a whole session. The
+/// store must only be used on the raster thread.
+class LayerRasterTimingStore {
+ public:
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  /// Measures the time between its construction and destruction and adds it
+  /// to |store| for the layer. Does nothing if |store| is null.
+  class AutoTiming {
+   public:
+    AutoTiming(LayerRasterTimingStore* store, int64_t layer_unique_id);
+
+    ~AutoTiming();
+
+   private:
+    LayerRasterTimingStore* store_;
+    const int64_t layer_unique_id_;
+    fml::TimePoint start_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(AutoTiming);
+  };
+
+  explicit LayerRasterTimingStore(size_t capacity = kDefaultCapacity);
+
+  ~LayerRasterTimingStore() = default;
+
+  bool IsEnabled() const { return enabled_; }
+
+  /// Starts or stops collecting timings. The collected timings are cleared
+  /// when collection stops.
+  void SetEnabled(bool enabled);
+
+  /// Marks the start of a new frame. The timings that are added after this
+  /// call are attributed to that frame.
+  void BeginFrame() { frame_number_++; }
+
+  /// Adds the time taken to rasterize a layer in the current frame.
+  void Add(int64_t layer_unique_id, const fml::TimeDelta& duration);
+
+  /// Clears all the collected timings.
+  void Clear();
+
+  // Returns the number of timings collected.
+  size_t Size() const { return timings_.size(); }
+
+  /// Returns the collected timings, oldest first.
+  std::vector<LayerRasterTiming> GetTimings() const;
+
+ private:
+  const size_t capacity_;
+  std::vector<LayerRasterTiming> timings_;
+  size_t next_index_ = 0;
+  uint64_t frame_number_ = 0;
+  bool enabled_ = false;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(LayerRasterTimingStore);
+};
+
 }  // namespace flutter
 
 #endif  // FLUTTER_FLOW_LAYER_SNAPSHOT_STORE_H_
@@ -0,0 +1,77 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/layer_snapshot_store.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(LayerRasterTimingStore, IsDisabledByDefault) {
+  LayerRasterTimingStore store;
+  EXPECT_FALSE(store.IsEnabled());
+  EXPECT_EQ(store.Size(), 0u);
+}
+
+TEST(LayerRasterTimingStore, TimingsAreAttributedToFrames) {
+  LayerRasterTimingStore store;
+  store.SetEnabled(true);
+  store.BeginFrame();
+  store.Add(1, fml::TimeDelta::FromMicroseconds(10));
+  store.Add(2, fml::TimeDelta::FromMicroseconds(20));
+  store.BeginFrame();
+  store.Add(1, fml::TimeDelta::FromMicroseconds(30));
+
+  auto timings = store.GetTimings();
+  ASSERT_EQ(timings.size(), 3u);
+  EXPECT_EQ(timings[0].layer_unique_id, 1);
+  EXPECT_EQ(timings[0].frame_number, timings[1].frame_number);
+  EXPECT_EQ(timings[1].layer_unique_id, 2);
+  EXPECT_EQ(timings[2].layer_unique_id, 1);
+  EXPECT_EQ(timings[2].frame_number, timings[0].frame_number + 1);
+  EXPECT_EQ(timings[2].duration, fml::TimeDelta::FromMicroseconds(30));
+}
+
+TEST(LayerRasterTimingStore, OldestTimingsAreOverwritten) {
+  LayerRasterTimingStore store(3);
+  store.SetEnabled(true);
+  for (int64_t id = 1; id <= 5; id++) {
+    store.Add(id, fml::TimeDelta::FromMicroseconds(id));
+  }
+
+  auto timings = store.GetTimings();
+  ASSERT_EQ(timings.size(), 3u);
+  EXPECT_EQ(timings[0].layer_unique_id, 3);
+  EXPECT_EQ(timings[1].layer_unique_id, 4);
+  EXPECT_EQ(timings[2].layer_unique_id, 5);
+}
+
+TEST(LayerRasterTimingStore, DisablingClearsTimings) {
+  LayerRasterTimingStore store;
+  store.SetEnabled(true);
+  store.Add(1, fml::TimeDelta::FromMicroseconds(10));
+  EXPECT_EQ(store.Size(), 1u);
+
+  store.SetEnabled(false);
+  EXPECT_EQ(store.Size(), 0u);
+  EXPECT_TRUE(store.GetTimings().empty());
+}
+
+TEST(LayerRasterTimingStore, AutoTimingAddsTiming) {
+  LayerRasterTimingStore store;
+  {
+    LayerRasterTimingStore::AutoTiming timing(&store, 7);
+  }
+  {
+    LayerRasterTimingStore::AutoTiming timing(nullptr, 8);
+  }
+
+  auto timings = store.GetTimings();
+  ASSERT_EQ(timings.size(), 1u);
+  EXPECT_EQ(timings[0].layer_unique_id, 7);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -40,11 +40,19 @@ void ColorFilterLayer::Diff(DiffContext* context, const Layer* old_layer) {
 void ColorFilterLayer::Preroll(PrerollContext* context,
                                const SkMatrix& matrix) {
   Layer::AutoPrerollSaveLayerState save =
-      Layer::AutoPrerollSaveLayerState::Create(context);
+      Layer::AutoPrerollSaveLayerState::Create(context, filter_ != nullptr);
   SkMatrix child_matrix = matrix;
   AutoCache cache =
       AutoCache(layer_raster_cache_item_.get(), context, child_matrix);
 
+  if (!filter_) {
+    // Without a filter the children are painted directly, so the opacity
+    // can be passed through to them if they can all inherit it.
+    context->subtree_can_inherit_opacity = true;
+    ContainerLayer::Preroll(context, child_matrix);
+    return;
+  }
+
   ContainerLayer::Preroll(context, child_matrix);
   // We always use a saveLayer (or a cached rendering), so we
   // can always apply opacity in those cases.
@@ -67,6 +75,11 @@ void ColorFilterLayer::Paint(PaintContext& context) const {
     }
   }
 
+  if (!filter_) {
+    PaintChildren(context);
+    return;
+  }
+
   AutoCachePaint cache_paint(context);
   cache_paint.setColorFilter(filter_.get());
   if (context.leaf_nodes_builder) {
@@ -149,7 +149,7 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
     // override the answer during its |Preroll|
     context->subtree_can_inherit_opacity = false;
 
-    layer->Preroll(context, child_matrix);
+    layer->PrerollIfNeeded(context, child_matrix);
 
     subtree_can_inherit_opacity =
         subtree_can_inherit_opacity && context->subtree_can_inherit_opacity;
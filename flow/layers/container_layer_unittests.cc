@@ -541,6 +541,63 @@ TEST_F(ContainerLayerTest, CollectionCacheableLayer) {
             static_cast<const unsigned long>(2));
 }
 
+TEST_F(ContainerLayerTest, RetainedChildReusesPreroll) {
+  SkPath child_path;
+  child_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  SkPaint child_paint(SkColors::kGreen);
+  SkMatrix initial_transform = SkMatrix::Translate(-0.5f, -0.5f);
+
+  auto mock_layer = std::make_shared<MockLayer>(child_path, child_paint);
+  mock_layer->set_fake_opacity_compatible(true);
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->Add(mock_layer);
+
+  preroll_context()->reuse_retained_preroll = true;
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_FALSE(mock_layer->parent_has_platform_view());
+  EXPECT_EQ(layer->paint_bounds(), child_path.getBounds());
+
+  // The MockLayer resets this flag in its Preroll, so it is only left set
+  // when the Preroll of the retained child is skipped.
+  mock_layer->set_parent_has_platform_view(true);
+  preroll_context()->subtree_can_inherit_opacity = true;
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_TRUE(mock_layer->parent_has_platform_view());
+  EXPECT_EQ(layer->paint_bounds(), child_path.getBounds());
+  EXPECT_TRUE(preroll_context()->subtree_can_inherit_opacity);
+
+  // A different matrix invalidates the previous Preroll.
+  layer->Preroll(preroll_context(), SkMatrix::I());
+  EXPECT_FALSE(mock_layer->parent_has_platform_view());
+  EXPECT_EQ(mock_layer->parent_matrix(), SkMatrix::I());
+
+  // Assigning an old layer to the child invalidates its previous Preroll.
+  auto old_layer = std::make_shared<MockLayer>(child_path, child_paint);
+  mock_layer->AssignOldLayer(old_layer.get());
+  mock_layer->set_parent_has_platform_view(true);
+  layer->Preroll(preroll_context(), SkMatrix::I());
+  EXPECT_FALSE(mock_layer->parent_has_platform_view());
+}
+
+TEST_F(ContainerLayerTest, ChildWithTextureLayerIsAlwaysPrerolled) {
+  SkPath child_path;
+  child_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  SkPaint child_paint(SkColors::kGreen);
+
+  auto mock_layer = std::make_shared<MockLayer>(child_path, child_paint);
+  mock_layer->set_fake_has_texture_layer(true);
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->Add(mock_layer);
+
+  preroll_context()->reuse_retained_preroll = true;
+  layer->Preroll(preroll_context(), SkMatrix::I());
+  preroll_context()->has_texture_layer = false;
+  mock_layer->set_parent_has_texture_layer(true);
+  layer->Preroll(preroll_context(), SkMatrix::I());
+  EXPECT_FALSE(mock_layer->parent_has_texture_layer());
+  EXPECT_TRUE(preroll_context()->has_texture_layer);
+}
+
 using ContainerLayerDiffTest = DiffContextTest;
 
 // Insert PictureLayer amongst container layers
@@ -79,8 +79,10 @@ bool DisplayListLayer::Compare(DiffContext::Statistics& statistics,
     return false;
   }
 
-  if (op_bytes_1 > kMaxBytesToCompare) {
-    statistics.AddPictureTooComplexToCompare();
+  // Lists with the same hash are almost always equal, so the deep compare
+  // is worth doing no matter how large they are.
+  if (dl1->content_hash() != dl2->content_hash()) {
+    statistics.AddNewPicture();
     return false;
   }
 
@@ -112,6 +114,8 @@ void DisplayListLayer::Paint(PaintContext& context) const {
   FML_DCHECK(display_list_.skia_object());
   FML_DCHECK(needs_painting(context));
 
+  LayerRasterTimingStore::AutoTiming timing(context.layer_raster_timing_store,
+                                            unique_id());
   SkAutoCanvasRestore save(context.leaf_nodes_canvas, true);
   context.leaf_nodes_canvas->translate(offset_.x(), offset_.y());
   if (context.raster_cache) {
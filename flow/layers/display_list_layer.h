@@ -17,8 +17,6 @@ namespace flutter {
 
 class DisplayListLayer : public Layer {
  public:
-  static constexpr size_t kMaxBytesToCompare = 10000;
-
   DisplayListLayer(const SkPoint& offset,
                    SkiaGPUObject<DisplayList> display_list,
                    bool is_complex,
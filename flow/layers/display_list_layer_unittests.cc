@@ -392,6 +392,40 @@ TEST_F(DisplayListLayerDiffTest, DisplayListCompare) {
   EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(20, 20, 70, 70));
 }
 
+TEST_F(DisplayListLayerDiffTest, LargeDisplayListCompare) {
+  auto create_display_list = [](DlColor color) {
+    DisplayListBuilder builder;
+    builder.setColor(color);
+    for (int i = 0; i < 1000; i++) {
+      builder.drawRect(SkRect::MakeXYWH(10 + i % 50, 10, 1, 50));
+    }
+    return builder.Build();
+  };
+
+  MockLayerTree tree1;
+  auto display_list1 = create_display_list(DlColor::kRed());
+  ASSERT_GT(display_list1->bytes(), 10000u);
+  tree1.root()->Add(CreateDisplayListLayer(display_list1));
+
+  auto damage = DiffLayerTree(tree1, MockLayerTree());
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(10, 10, 60, 60));
+
+  // An identical large picture is not repainted.
+  MockLayerTree tree2;
+  tree2.root()->Add(
+      CreateDisplayListLayer(create_display_list(DlColor::kRed())));
+
+  damage = DiffLayerTree(tree2, tree1);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeEmpty());
+
+  MockLayerTree tree3;
+  tree3.root()->Add(
+      CreateDisplayListLayer(create_display_list(DlColor::kBlue())));
+
+  damage = DiffLayerTree(tree3, tree2);
+  EXPECT_EQ(damage.frame_damage, SkIRect::MakeLTRB(10, 10, 60, 60));
+}
+
 TEST_F(DisplayListLayerTest, LayerTreeSnapshotsWhenEnabled) {
   const SkPoint layer_offset = SkPoint::Make(1.5f, -0.5f);
   const SkRect picture_bounds = SkRect::MakeLTRB(5.0f, 6.0f, 20.5f, 21.5f);
@@ -427,6 +461,29 @@ TEST_F(DisplayListLayerTest, NoLayerTreeSnapshotsWhenDisabledByDefault) {
   EXPECT_EQ(0u, snapshot_store.Size());
 }
 
+TEST_F(DisplayListLayerTest, RecordsRasterTimingWhenEnabled) {
+  const SkPoint layer_offset = SkPoint::Make(1.5f, -0.5f);
+  const SkRect picture_bounds = SkRect::MakeLTRB(5.0f, 6.0f, 20.5f, 21.5f);
+  DisplayListBuilder builder;
+  builder.drawRect(picture_bounds);
+  auto display_list = builder.Build();
+  auto layer = std::make_shared<DisplayListLayer>(
+      layer_offset, SkiaGPUObject(display_list, unref_queue()), false, false);
+
+  layer->Preroll(preroll_context(), SkMatrix());
+  layer->Paint(paint_context());
+
+  LayerRasterTimingStore store;
+  paint_context().layer_raster_timing_store = &store;
+  layer->Paint(paint_context());
+  paint_context().layer_raster_timing_store = nullptr;
+
+  auto timings = store.GetTimings();
+  ASSERT_EQ(timings.size(), 1u);
+  EXPECT_EQ(timings[0].layer_unique_id,
+            static_cast<int64_t>(layer->unique_id()));
+}
+
 TEST_F(DisplayListLayerTest, DisplayListAccessCountDependsOnVisibility) {
   const SkPoint layer_offset = SkPoint::Make(1.5f, -0.5f);
   const SkRect picture_bounds = SkRect::MakeLTRB(5.0f, 6.0f, 20.5f, 21.5f);
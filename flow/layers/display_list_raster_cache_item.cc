@@ -70,10 +70,15 @@ std::unique_ptr<DisplayListRasterCacheItem> DisplayListRasterCacheItem::Make(
 void DisplayListRasterCacheItem::PrerollSetup(PrerollContext* context,
                                               const SkMatrix& matrix) {
   cache_state_ = CacheState::kNone;
-  DisplayListComplexityCalculator* complexity_calculator =
-      context->gr_context ? DisplayListComplexityCalculator::GetForBackend(
-                                context->gr_context->backend())
-                          : DisplayListComplexityCalculator::GetForSoftware();
+  DisplayListComplexityCalculator* complexity_calculator;
+  if (context->impeller_enabled) {
+    complexity_calculator = DisplayListComplexityCalculator::GetForImpeller();
+  } else if (context->gr_context) {
+    complexity_calculator = DisplayListComplexityCalculator::GetForBackend(
+        context->gr_context->backend());
+  } else {
+    complexity_calculator = DisplayListComplexityCalculator::GetForSoftware();
+  }
 
   if (!IsDisplayListWorthRasterizing(display_list_, will_change_, is_complex_,
                                      complexity_calculator)) {
@@ -131,6 +136,11 @@ bool DisplayListRasterCacheItem::Draw(const PaintContext& context,
     return false;
   }
   if (cache_state_ == CacheState::kCurrent) {
+    if (context.aiks_context && context.leaf_nodes_builder &&
+        canvas == context.leaf_nodes_canvas) {
+      return context.raster_cache->Draw(key_id_, *context.leaf_nodes_builder,
+                                        paint);
+    }
     return context.raster_cache->Draw(key_id_, *canvas, paint);
   }
   return false;
@@ -147,8 +157,12 @@ bool DisplayListRasterCacheItem::TryToPrepareRasterCache(
   // display_list or picture_list to calculate the memory they used, we
   // shouldn't cache the current node if the memory is more significant than the
   // limit.
+  // Entries that are rasterized in the background are still picked up once
+  // they are ready, even when the frame cannot generate new entries.
   if (cache_state_ == kNone || !context.raster_cache || parent_cached ||
-      !context.raster_cache->GenerateNewCacheInThisFrame()) {
+      (!context.raster_cache->GenerateNewCacheInThisFrame() &&
+       !context.raster_cache->HasPendingEntry(GetId().value(),
+                                              transformation_matrix_))) {
     return false;
   }
   SkRect bounds = display_list_->bounds().makeOffset(offset_.x(), offset_.y());
@@ -159,12 +173,10 @@ bool DisplayListRasterCacheItem::TryToPrepareRasterCache(
       .matrix             = transformation_matrix_,
       .logical_rect       = bounds,
       .flow_type          = flow_type,
+      .aiks_context       = context.aiks_context,
       // clang-format on
   };
-  return context.raster_cache->UpdateCacheEntry(
-      GetId().value(), r_context,
-      [display_list = display_list_](SkCanvas* canvas) {
-        display_list->RenderTo(canvas);
-      });
+  return context.raster_cache->UpdateDisplayListCacheEntry(
+      GetId().value(), r_context, sk_ref_sp(display_list_));
 }
 }  // namespace flutter
@@ -49,7 +49,7 @@ void ImageFilterLayer::Diff(DiffContext* context, const Layer* old_layer) {
 void ImageFilterLayer::Preroll(PrerollContext* context,
                                const SkMatrix& matrix) {
   Layer::AutoPrerollSaveLayerState save =
-      Layer::AutoPrerollSaveLayerState::Create(context);
+      Layer::AutoPrerollSaveLayerState::Create(context, filter_ != nullptr);
   SkMatrix child_matrix = matrix;
 
   AutoCache cache =
@@ -57,17 +57,21 @@ void ImageFilterLayer::Preroll(PrerollContext* context,
 
   SkRect child_bounds = SkRect::MakeEmpty();
 
+  if (!filter_) {
+    // Without a filter the children are painted directly, so the opacity
+    // can be passed through to them if they can all inherit it.
+    context->subtree_can_inherit_opacity = true;
+    PrerollChildren(context, child_matrix, &child_bounds);
+    set_paint_bounds(child_bounds);
+    return;
+  }
+
   PrerollChildren(context, child_matrix, &child_bounds);
 
   // We always paint with a saveLayer (or a cached rendering),
   // so we can always apply opacity in any of those cases.
   context->subtree_can_inherit_opacity = true;
 
-  if (!filter_) {
-    set_paint_bounds(child_bounds);
-    return;
-  }
-
   const SkIRect filter_in_bounds = child_bounds.roundOut();
   SkIRect filter_out_bounds;
   filter_->map_device_bounds(filter_in_bounds, SkMatrix::I(),
@@ -89,11 +93,11 @@ void ImageFilterLayer::Preroll(PrerollContext* context,
 void ImageFilterLayer::Paint(PaintContext& context) const {
   FML_DCHECK(needs_painting(context));
 
-  AutoCachePaint cache_paint(context);
   if (context.raster_cache) {
     context.internal_nodes_canvas->setMatrix(
         RasterCacheUtil::GetIntegralTransCTM(
             context.leaf_nodes_canvas->getTotalMatrix()));
+    AutoCachePaint cache_paint(context);
     if (layer_raster_cache_item_->IsCacheChildren()) {
       cache_paint.setImageFilter(transformed_filter_.get());
     }
@@ -102,6 +106,12 @@ void ImageFilterLayer::Paint(PaintContext& context) const {
     }
   }
 
+  if (!filter_) {
+    PaintChildren(context);
+    return;
+  }
+
+  AutoCachePaint cache_paint(context);
   cache_paint.setImageFilter(filter_.get());
   if (context.leaf_nodes_builder) {
     FML_DCHECK(context.builder_multiplexer);
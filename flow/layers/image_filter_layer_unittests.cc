@@ -63,18 +63,11 @@ TEST_F(ImageFilterLayerTest, EmptyFilter) {
   EXPECT_TRUE(layer->needs_painting(paint_context()));
   EXPECT_EQ(mock_layer->parent_matrix(), initial_transform);
 
-  SkPaint filter_paint;
-  filter_paint.setImageFilter(nullptr);
+  // Without a filter the children are painted without a saveLayer.
   layer->Paint(paint_context());
   EXPECT_EQ(mock_canvas().draw_calls(),
-            std::vector({
-                MockCanvas::DrawCall{
-                    0, MockCanvas::SaveLayerData{child_bounds, filter_paint,
-                                                 nullptr, 1}},
-                MockCanvas::DrawCall{
-                    1, MockCanvas::DrawPathData{child_path, child_paint}},
-                MockCanvas::DrawCall{1, MockCanvas::RestoreData{0}},
-            }));
+            std::vector({MockCanvas::DrawCall{
+                0, MockCanvas::DrawPathData{child_path, child_paint}}}));
 }
 
 TEST_F(ImageFilterLayerTest, SimpleFilter) {
@@ -485,6 +478,56 @@ TEST_F(ImageFilterLayerTest, OpacityInheritance) {
   EXPECT_TRUE(DisplayListsEQ_Verbose(expected_builder.Build(), display_list()));
 }
 
+TEST_F(ImageFilterLayerTest, EmptyFilterOpacityInheritance) {
+  const SkPath child_path = SkPath().addRect(SkRect::MakeWH(5.0f, 5.0f));
+  auto mock_layer = MockLayer::Make(child_path);
+  auto image_filter_layer = std::make_shared<ImageFilterLayer>(nullptr);
+  image_filter_layer->Add(mock_layer);
+
+  // A ImageFilterLayer without a filter paints its children directly, so it
+  // can only inherit opacity when its children are compatible.
+  PrerollContext* context = preroll_context();
+  context->subtree_can_inherit_opacity = false;
+  image_filter_layer->Preroll(context, SkMatrix::I());
+  EXPECT_FALSE(context->subtree_can_inherit_opacity);
+
+  mock_layer->set_fake_opacity_compatible(true);
+  context->subtree_can_inherit_opacity = false;
+  image_filter_layer->Preroll(context, SkMatrix::I());
+  EXPECT_TRUE(context->subtree_can_inherit_opacity);
+
+  int opacity_alpha = 0x7F;
+  SkPoint offset = SkPoint::Make(10, 10);
+  auto opacity_layer = std::make_shared<OpacityLayer>(opacity_alpha, offset);
+  opacity_layer->Add(image_filter_layer);
+  context->subtree_can_inherit_opacity = false;
+  opacity_layer->Preroll(context, SkMatrix::I());
+  EXPECT_TRUE(opacity_layer->children_can_accept_opacity());
+
+  DisplayListBuilder expected_builder;
+  /* OpacityLayer::Paint() */ {
+    expected_builder.save();
+    {
+      expected_builder.translate(offset.fX, offset.fY);
+      /* ImageFilterLayer::Paint() */ {
+        /* MockLayer::Paint() */ {
+          expected_builder.setColor(opacity_alpha << 24);
+          expected_builder.saveLayer(&child_path.getBounds(), true);
+          {
+            expected_builder.setColor(0xFF000000);
+            expected_builder.drawPath(child_path);
+          }
+          expected_builder.restore();
+        }
+      }
+    }
+    expected_builder.restore();
+  }
+
+  opacity_layer->Paint(display_list_paint_context());
+  EXPECT_TRUE(DisplayListsEQ_Verbose(expected_builder.Build(), display_list()));
+}
+
 using ImageFilterLayerDiffTest = DiffContextTest;
 
 TEST_F(ImageFilterLayerDiffTest, ImageFilterLayer) {
@@ -28,6 +28,52 @@ uint64_t Layer::NextUniqueID() {
 
 void Layer::Preroll(PrerollContext* context, const SkMatrix& matrix) {}
 
+void Layer::PrerollIfNeeded(PrerollContext* context, const SkMatrix& matrix) {
+  if (!context->reuse_retained_preroll) {
+    preroll_memo_.valid = false;
+    Preroll(context, matrix);
+    return;
+  }
+
+  if (preroll_memo_.valid && preroll_memo_.matrix == matrix &&
+      preroll_memo_.cull_rect == context->cull_rect &&
+      preroll_memo_.raster_cache == context->raster_cache &&
+      preroll_memo_.frame_device_pixel_ratio ==
+          context->frame_device_pixel_ratio &&
+      preroll_memo_.surface_needs_readback ==
+          context->surface_needs_readback) {
+    context->subtree_can_inherit_opacity =
+        preroll_memo_.subtree_can_inherit_opacity;
+    if (preroll_memo_.sets_surface_needs_readback) {
+      context->surface_needs_readback = true;
+    }
+    return;
+  }
+
+  bool surface_needs_readback = context->surface_needs_readback;
+  size_t raster_cached_entries = context->raster_cached_entries
+                                     ? context->raster_cached_entries->size()
+                                     : 0;
+
+  Preroll(context, matrix);
+
+  preroll_memo_.valid =
+      !context->has_platform_view && !context->has_texture_layer &&
+      (!context->raster_cached_entries ||
+       context->raster_cached_entries->size() == raster_cached_entries);
+  if (preroll_memo_.valid) {
+    preroll_memo_.matrix = matrix;
+    preroll_memo_.cull_rect = context->cull_rect;
+    preroll_memo_.raster_cache = context->raster_cache;
+    preroll_memo_.frame_device_pixel_ratio = context->frame_device_pixel_ratio;
+    preroll_memo_.surface_needs_readback = surface_needs_readback;
+    preroll_memo_.subtree_can_inherit_opacity =
+        context->subtree_can_inherit_opacity;
+    preroll_memo_.sets_surface_needs_readback =
+        !surface_needs_readback && context->surface_needs_readback;
+  }
+}
+
 Layer::AutoPrerollSaveLayerState::AutoPrerollSaveLayerState(
     PrerollContext* preroll_context,
     bool save_layer_is_active,
@@ -115,6 +115,15 @@ struct PrerollContext {
   // the embedders that must decide between creating SkPicture or
   // DisplayList objects for the inter-view slices of the layer tree.
   bool display_list_enabled = false;
+
+  // This flag will be set to true iff the frame will be rendered by
+  // Impeller, so that raster cache heuristics can use its costs.
+  bool impeller_enabled = false;
+
+  // This flag will be set to true iff layers that are retained from the
+  // previous frame may reuse the results of their previous Preroll, see
+  // |Layer::PrerollIfNeeded|.
+  bool reuse_retained_preroll = false;
 };
 
 struct PaintContext {
@@ -145,6 +154,10 @@ struct PaintContext {
   LayerSnapshotStore* layer_snapshot_store = nullptr;
   bool enable_leaf_layer_tracing = false;
 
+  // Store to continuously collect the time taken to paint leaf layers. The
+  // store is non-null only when raster timing collection is enabled.
+  LayerRasterTimingStore* layer_raster_timing_store = nullptr;
+
   // The following value should be used to modulate the opacity of the
   // layer during |Paint|. If the layer does not set the corresponding
   // |layer_can_inherit_opacity()| flag, then this value should always
@@ -166,6 +179,7 @@ class Layer {
 
   void AssignOldLayer(Layer* old_layer) {
     original_layer_id_ = old_layer->original_layer_id_;
+    preroll_memo_.valid = false;
   }
 
   // Used to establish link between old layer and new layer that replaces it.
@@ -189,6 +203,17 @@ class Layer {
 
   virtual void Preroll(PrerollContext* context, const SkMatrix& matrix);
 
+  // Calls |Preroll|, unless this layer was already prerolled in a previous
+  // frame with the same matrix, cull rect and raster cache. A retained layer
+  // is the same instance as in the previous frame, so its paint bounds and
+  // any decisions it made during that Preroll are still valid and only the
+  // effects on the |PrerollContext| need to be replayed.
+  //
+  // Subtrees that contain platform views or texture layers, or that
+  // registered raster cache entries, must be prerolled in every frame and
+  // are never reused.
+  void PrerollIfNeeded(PrerollContext* context, const SkMatrix& matrix);
+
   // Used during Preroll by layers that employ a saveLayer to manage the
   // PrerollContext settings with values affected by the saveLayer mechanism.
   // This object must be created before calling Preroll on the children to
@@ -405,6 +430,21 @@ class Layer {
   uint64_t original_layer_id_;
   bool subtree_has_platform_view_;
 
+  // The state that the last |Preroll| of this layer was performed with and
+  // the effects it had on the |PrerollContext|.
+  struct PrerollMemo {
+    bool valid = false;
+    SkMatrix matrix;
+    SkRect cull_rect;
+    const RasterCache* raster_cache = nullptr;
+    float frame_device_pixel_ratio = 1.0f;
+    bool surface_needs_readback = false;
+
+    bool subtree_can_inherit_opacity = false;
+    bool sets_surface_needs_readback = false;
+  };
+  PrerollMemo preroll_memo_;
+
   static uint64_t NextUniqueID();
 
   FML_DISALLOW_COPY_AND_ASSIGN(Layer);
@@ -101,12 +101,17 @@ const SkRect* LayerRasterCacheItem::GetPaintBoundsFromLayer() const {
 bool Rasterize(RasterCacheItem::CacheState cache_state,
                Layer* layer,
                const PaintContext& paint_context,
-               SkCanvas* canvas) {
+               SkCanvas* canvas,
+               DisplayListBuilder* builder) {
   FML_DCHECK(cache_state != RasterCacheItem::CacheState::kNone);
   SkISize canvas_size = canvas->getBaseLayerSize();
   SkNWayCanvas internal_nodes_canvas(canvas_size.width(), canvas_size.height());
   internal_nodes_canvas.setMatrix(canvas->getTotalMatrix());
   internal_nodes_canvas.addCanvas(canvas);
+  DisplayListBuilderMultiplexer builder_multiplexer;
+  if (builder) {
+    builder_multiplexer.addBuilder(builder);
+  }
   PaintContext context = {
       // clang-format off
           .internal_nodes_canvas         = static_cast<SkCanvas*>(&internal_nodes_canvas),
@@ -120,6 +125,9 @@ bool Rasterize(RasterCacheItem::CacheState cache_state,
           .raster_cache                  = paint_context.raster_cache,
           .checkerboard_offscreen_layers = paint_context.checkerboard_offscreen_layers,
           .frame_device_pixel_ratio      = paint_context.frame_device_pixel_ratio,
+          .leaf_nodes_builder            = builder,
+          .builder_multiplexer           = builder ? &builder_multiplexer : nullptr,
+          .aiks_context                  = paint_context.aiks_context,
       // clang-format on
   };
 
@@ -154,13 +162,14 @@ bool LayerRasterCacheItem::TryToPrepareRasterCache(const PaintContext& context,
           .matrix             = matrix_,
           .logical_rect       = *paint_bounds,
           .flow_type          = flow_type,
+          .aiks_context       = context.aiks_context,
           // clang-format on
       };
       return context.raster_cache->UpdateCacheEntry(
           GetId().value(), r_context,
-          [ctx = context, cache_state = cache_state_,
-           layer = layer_](SkCanvas* canvas) {
-            Rasterize(cache_state, layer, ctx, canvas);
+          [ctx = context, cache_state = cache_state_, layer = layer_](
+              SkCanvas* canvas, DisplayListBuilder* builder) {
+            Rasterize(cache_state, layer, ctx, canvas, builder);
           });
     }
   }
@@ -178,13 +187,24 @@ bool LayerRasterCacheItem::Draw(const PaintContext& context,
   if (!context.raster_cache || !canvas) {
     return false;
   }
+  // Impeller cache entries can only be drawn into the frame's builder.
+  bool use_builder = context.aiks_context && context.leaf_nodes_builder &&
+                     canvas == context.leaf_nodes_canvas;
   switch (cache_state_) {
     case RasterCacheItem::kNone:
       return false;
     case RasterCacheItem::kCurrent: {
+      if (use_builder) {
+        return context.raster_cache->Draw(key_id_, *context.leaf_nodes_builder,
+                                          paint);
+      }
       return context.raster_cache->Draw(key_id_, *canvas, paint);
     }
     case RasterCacheItem::kChildren: {
+      if (use_builder) {
+        return context.raster_cache->Draw(layer_children_id_.value(),
+                                          *context.leaf_nodes_builder, paint);
+      }
       return context.raster_cache->Draw(layer_children_id_.value(), *canvas,
                                         paint);
     }
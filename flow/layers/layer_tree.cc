@@ -44,7 +44,8 @@ bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
   SkColorSpace* color_space = GetColorSpace(frame.canvas());
   frame.context().raster_cache().SetCheckboardCacheImages(
       checkerboard_raster_cache_images_);
-  MutatorsStack stack;
+  preroll_arena_.Reset();
+  MutatorsStack stack(&preroll_arena_);
   RasterCache* cache =
       ignore_raster_cache ? nullptr : &frame.context().raster_cache();
   raster_cache_items_.clear();
@@ -65,6 +66,8 @@ bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
       .frame_device_pixel_ratio      = device_pixel_ratio_,
       .raster_cached_entries         = &raster_cache_items_,
       .display_list_enabled          = frame.display_list_builder() != nullptr,
+      .impeller_enabled              = frame.aiks_context() != nullptr,
+      .reuse_retained_preroll        = true,
       // clang-format on
   };
 
@@ -137,6 +140,12 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
     snapshot_store = &frame.context().snapshot_store();
   }
 
+  LayerRasterTimingStore* raster_timing_store = nullptr;
+  if (frame.context().layer_raster_timing_store().IsEnabled()) {
+    raster_timing_store = &frame.context().layer_raster_timing_store();
+    raster_timing_store->BeginFrame();
+  }
+
   SkColorSpace* color_space = GetColorSpace(frame.canvas());
   RasterCache* cache =
       ignore_raster_cache ? nullptr : &frame.context().raster_cache();
@@ -155,6 +164,7 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
       .frame_device_pixel_ratio      = device_pixel_ratio_,
       .layer_snapshot_store          = snapshot_store,
       .enable_leaf_layer_tracing     = enable_leaf_layer_tracing_,
+      .layer_raster_timing_store     = raster_timing_store,
       .inherited_opacity             = SK_Scalar1,
       .leaf_nodes_builder            = builder,
       .builder_multiplexer           = builder ? &builder_multiplexer : nullptr,
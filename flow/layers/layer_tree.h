@@ -13,6 +13,7 @@
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/raster_cache.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/memory/arena.h"
 #include "flutter/fml/time/time_delta.h"
 #include "third_party/skia/include/core/SkPicture.h"
 #include "third_party/skia/include/core/SkSize.h"
@@ -103,6 +104,10 @@ class LayerTree {
 
   std::vector<RasterCacheItem*> raster_cache_items_;
 
+  // Backs the mutators pushed during |Preroll|, which only live as long as
+  // the frame.
+  fml::Arena preroll_arena_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(LayerTree);
 };
 
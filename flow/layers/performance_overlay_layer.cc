@@ -6,7 +6,10 @@
 
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
+#include <utility>
 
 #include "third_party/skia/include/core/SkFont.h"
 #include "third_party/skia/include/core/SkTextBlob.h"
@@ -14,6 +17,50 @@
 namespace flutter {
 namespace {
 
+// Loading a typeface parses the whole font file, which is far too expensive
+// to do for every frame. The typefaces are loaded once per font path instead.
+sk_sp<SkTypeface> GetTypeface(const std::string& font_path) {
+  static std::mutex mutex;
+  static auto* typefaces = new std::map<std::string, sk_sp<SkTypeface>>();
+  std::scoped_lock lock(mutex);
+  auto found = typefaces->find(font_path);
+  if (found != typefaces->end()) {
+    return found->second;
+  }
+  sk_sp<SkTypeface> typeface = SkTypeface::MakeFromFile(font_path.c_str());
+  typefaces->emplace(font_path, typeface);
+  return typeface;
+}
+
+// The statistics only change at the displayed precision every few frames, so
+// the last text blob of every label is kept and only shaped again once its
+// text changes.
+sk_sp<SkTextBlob> GetStatisticsTextBlob(const std::string& label_prefix,
+                                        const std::string& font_path,
+                                        const std::string& text) {
+  struct CachedText {
+    std::string text;
+    sk_sp<SkTextBlob> blob;
+  };
+  static std::mutex mutex;
+  static auto* cache =
+      new std::map<std::pair<std::string, std::string>, CachedText>();
+  std::scoped_lock lock(mutex);
+  CachedText& cached = (*cache)[std::make_pair(label_prefix, font_path)];
+  if (cached.blob && cached.text == text) {
+    return cached.blob;
+  }
+  SkFont font;
+  if (font_path != "") {
+    font = SkFont(GetTypeface(font_path));
+  }
+  font.setSize(15);
+  cached.text = text;
+  cached.blob = SkTextBlob::MakeFromText(text.c_str(), text.size(), font,
+                                         SkTextEncoding::kUTF8);
+  return cached.blob;
+}
+
 void VisualizeStopWatch(SkCanvas* canvas,
                         const Stopwatch& stopwatch,
                         SkScalar x,
@@ -47,23 +94,17 @@ sk_sp<SkTextBlob> PerformanceOverlayLayer::MakeStatisticsText(
     const Stopwatch& stopwatch,
     const std::string& label_prefix,
     const std::string& font_path) {
-  SkFont font;
-  if (font_path != "") {
-    font = SkFont(SkTypeface::MakeFromFile(font_path.c_str()));
-  }
-  font.setSize(15);
-
-  double max_ms_per_frame = stopwatch.MaxDelta().ToMillisecondsF();
-  double average_ms_per_frame = stopwatch.AverageDelta().ToMillisecondsF();
+  // Both statistics are computed from a single copy of the samples.
+  const Stopwatch::Snapshot snapshot = stopwatch.GetSnapshot();
+  double max_ms_per_frame = snapshot.MaxDelta().ToMillisecondsF();
+  double average_ms_per_frame = snapshot.AverageDelta().ToMillisecondsF();
   std::stringstream stream;
   stream.setf(std::ios::fixed | std::ios::showpoint);
   stream << std::setprecision(1);
   stream << label_prefix << "  "
          << "max " << max_ms_per_frame << " ms/frame, "
          << "avg " << average_ms_per_frame << " ms/frame";
-  auto text = stream.str();
-  return SkTextBlob::MakeFromText(text.c_str(), text.size(), font,
-                                  SkTextEncoding::kUTF8);
+  return GetStatisticsTextBlob(label_prefix, font_path, stream.str());
 }
 
 PerformanceOverlayLayer::PerformanceOverlayLayer(uint64_t options,
@@ -190,6 +190,21 @@ TEST_F(PerformanceOverlayLayerTest, SimpleRasterizerStatistics) {
                                             text_position}}}));
 }
 
+TEST_F(PerformanceOverlayLayerTest, StatisticsTextIsReusedUntilItChanges) {
+  FixedRefreshRateStopwatch stopwatch;
+  stopwatch.SetLapTime(fml::TimeDelta::FromMilliseconds(12));
+  auto first_text =
+      PerformanceOverlayLayer::MakeStatisticsText(stopwatch, "Reused", "");
+  auto second_text =
+      PerformanceOverlayLayer::MakeStatisticsText(stopwatch, "Reused", "");
+  EXPECT_EQ(first_text.get(), second_text.get());
+
+  stopwatch.SetLapTime(fml::TimeDelta::FromMilliseconds(24));
+  auto changed_text =
+      PerformanceOverlayLayer::MakeStatisticsText(stopwatch, "Reused", "");
+  EXPECT_NE(first_text.get(), changed_text.get());
+}
+
 TEST_F(PerformanceOverlayLayerTest, MarkAsDirtyWhenResized) {
   // Regression test for https://github.com/flutter/flutter/issues/54188
 
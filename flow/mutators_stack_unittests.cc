@@ -43,6 +43,25 @@ TEST(MutatorsStack, CopyAndUpdateTheCopy) {
   ASSERT_TRUE(iter->get()->GetRect() == rect);
 }
 
+TEST(MutatorsStack, CopyOfArenaStackOutlivesArena) {
+  fml::Arena arena;
+  MutatorsStack stack(&arena);
+  auto rrect = SkRRect::MakeEmpty();
+  auto rect = SkRect::MakeEmpty();
+  stack.PushClipRect(rect);
+  stack.PushClipRRect(rrect);
+  ASSERT_GT(arena.allocated_bytes(), 0u);
+  MutatorsStack copy = MutatorsStack(stack);
+  ASSERT_TRUE(copy == stack);
+  stack.Pop();
+  stack.Pop();
+  arena.Reset();
+  ASSERT_EQ(arena.allocated_bytes(), 0u);
+  auto iter = copy.Bottom();
+  ASSERT_TRUE(iter->get()->GetType() == MutatorType::kClipRRect);
+  ASSERT_TRUE(iter->get()->GetRRect() == rrect);
+}
+
 TEST(MutatorsStack, PushClipRect) {
   MutatorsStack stack;
   auto rect = SkRect::MakeEmpty();
@@ -4,23 +4,34 @@
 
 #include "flutter/flow/raster_cache.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <mutex>
 #include <vector>
 
 #include "flutter/common/constants.h"
+#include "flutter/display_list/display_list_utils.h"
 #include "flutter/flow/layers/container_layer.h"
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/paint_utils.h"
 #include "flutter/flow/raster_cache_util.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkColorSpace.h"
+#include "third_party/skia/include/core/SkDeferredDisplayList.h"
+#include "third_party/skia/include/core/SkDeferredDisplayListRecorder.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkPicture.h"
 #include "third_party/skia/include/core/SkSurface.h"
+#include "third_party/skia/include/core/SkSurfaceCharacterization.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 
+#if IMPELLER_SUPPORTS_RENDERING
+#include "flutter/flow/raster_cache_impeller.h"
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 namespace flutter {
 
 RasterCacheResult::RasterCacheResult(sk_sp<SkImage> image,
@@ -42,6 +53,72 @@ void RasterCacheResult::draw(SkCanvas& canvas, const SkPaint* paint) const {
                    paint);
 }
 
+void RasterCacheResult::draw(DisplayListBuilder& builder,
+                             const SkPaint* paint) const {
+  DrawImage(builder, DlImage::Make(image_), paint);
+}
+
+bool RasterCacheResult::CompressToRGB565(GrDirectContext* gr_context,
+                                         bool dither) {
+  if (!image_ || image_->colorType() == kRGB_565_SkColorType) {
+    return false;
+  }
+  // The cache surfaces have an alpha channel, so whether the contents are
+  // opaque is only known from the pixels.
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(image_->imageInfo()
+                                 .makeColorType(kN32_SkColorType)
+                                 .makeAlphaType(kPremul_SkAlphaType)) ||
+      !image_->readPixels(gr_context, bitmap.pixmap(), 0, 0) ||
+      !SkBitmap::ComputeIsOpaque(bitmap)) {
+    return false;
+  }
+
+  sk_sp<SkSurface> surface = SkSurface::MakeRaster(
+      SkImageInfo::Make(image_->dimensions(), kRGB_565_SkColorType,
+                        kOpaque_SkAlphaType, image_->refColorSpace()));
+  if (!surface) {
+    return false;
+  }
+  SkPaint paint;
+  paint.setBlendMode(SkBlendMode::kSrc);
+  paint.setDither(dither);
+  surface->getCanvas()->drawImage(bitmap.asImage(), 0, 0, SkSamplingOptions(),
+                                  &paint);
+  sk_sp<SkImage> compressed = surface->makeImageSnapshot();
+  if (compressed && gr_context) {
+    compressed = compressed->makeTextureImage(gr_context);
+  }
+  if (!compressed) {
+    return false;
+  }
+  image_ = std::move(compressed);
+  return true;
+}
+
+void RasterCacheResult::DrawImage(DisplayListBuilder& builder,
+                                  const sk_sp<DlImage>& image,
+                                  const SkPaint* paint) const {
+  int restore_count = builder.getSaveCount();
+  builder.save();
+
+  auto matrix = RasterCacheUtil::GetIntegralTransCTM(builder.getTransform());
+  SkRect bounds =
+      RasterCacheUtil::GetRoundedOutDeviceBounds(logical_rect_, matrix);
+  FML_DCHECK(std::abs(bounds.width() - image->dimensions().width()) <= 1 &&
+             std::abs(bounds.height() - image->dimensions().height()) <= 1);
+  builder.transformReset();
+  flow_.Step();
+  if (paint) {
+    builder.setAttributesFromPaint(
+        *paint, DisplayListOpFlags::kDrawImageWithPaintFlags);
+  }
+  builder.drawImage(image, SkPoint::Make(bounds.fLeft, bounds.fTop),
+                    DlImageSampling::kNearestNeighbor, paint != nullptr);
+
+  builder.restoreToCount(restore_count);
+}
+
 RasterCache::RasterCache(size_t access_threshold,
                          size_t display_list_cache_limit_per_frame)
     : access_threshold_(access_threshold),
@@ -54,6 +131,26 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
     const std::function<void(SkCanvas*)>& draw_function,
     const std::function<void(SkCanvas*, const SkRect& rect)>& draw_checkerboard)
     const {
+  return Rasterize(
+      context,
+      [&draw_function](SkCanvas* canvas, DisplayListBuilder* builder) {
+        draw_function(canvas);
+      },
+      draw_checkerboard);
+}
+
+std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
+    const RasterCache::Context& context,
+    const DrawFunction& draw_function,
+    const std::function<void(SkCanvas*, const SkRect& rect)>& draw_checkerboard)
+    const {
+#if IMPELLER_SUPPORTS_RENDERING
+  if (context.aiks_context) {
+    return RasterizeWithImpeller(context, draw_function, checkerboard_images_,
+                                 draw_checkerboard);
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
   auto matrix = RasterCacheUtil::GetIntegralTransCTM(context.matrix);
   SkRect dest_rect =
       RasterCacheUtil::GetRoundedOutDeviceBounds(context.logical_rect, matrix);
@@ -75,7 +172,7 @@ std::unique_ptr<RasterCacheResult> RasterCache::Rasterize(
   canvas->clear(SK_ColorTRANSPARENT);
   canvas->translate(-dest_rect.left(), -dest_rect.top());
   canvas->concat(matrix);
-  draw_function(canvas);
+  draw_function(canvas, nullptr);
 
   if (checkerboard_images_) {
     draw_checkerboard(canvas, context.logical_rect);
@@ -89,9 +186,20 @@ bool RasterCache::UpdateCacheEntry(
     const RasterCacheKeyID& id,
     const Context& raster_cache_context,
     const std::function<void(SkCanvas*)>& render_function) const {
+  return UpdateCacheEntry(
+      id, raster_cache_context,
+      [&render_function](SkCanvas* canvas, DisplayListBuilder* builder) {
+        render_function(canvas);
+      });
+}
+
+bool RasterCache::UpdateCacheEntry(const RasterCacheKeyID& id,
+                                   const Context& raster_cache_context,
+                                   const DrawFunction& render_function) const {
   RasterCacheKey key = RasterCacheKey(id, raster_cache_context.matrix);
   Entry& entry = cache_[key];
   if (!entry.image) {
+    entry.last_used_frame = frame_count_;
     entry.image =
         Rasterize(raster_cache_context, render_function, DrawCheckerboard);
     if (entry.image != nullptr) {
@@ -106,9 +214,277 @@ bool RasterCache::UpdateCacheEntry(
       return true;
     }
   }
+  if (entry.image) {
+    MaybeCompress(entry, raster_cache_context.gr_context);
+  }
   return entry.image != nullptr;
 }
 
+void RasterCache::MaybeCompress(Entry& entry,
+                                GrDirectContext* gr_context) const {
+  if (compression_options_.compression == RasterCacheCompression::kNone ||
+      entry.compression_attempted ||
+      entry.frames_cached < compression_options_.min_age_frames ||
+      compressed_this_frame_ >=
+          compression_options_.max_compressions_per_frame) {
+    return;
+  }
+  const size_t bytes = entry.image->image_bytes();
+  if (bytes < compression_options_.min_image_bytes) {
+    return;
+  }
+  // The contents of an entry never change, so a failed attempt, for example
+  // on translucent contents, is not repeated.
+  entry.compression_attempted = true;
+  compressed_this_frame_++;
+  TRACE_EVENT0("flutter", "RasterCache::CompressEntry");
+  if (entry.image->CompressToRGB565(gr_context, compression_options_.dither)) {
+    entry.uncompressed_bytes = bytes;
+  }
+}
+
+namespace {
+
+// Finds out whether a DisplayList can be rendered into a raster surface on
+// another thread, which rules out textures and Skia objects that could be
+// holding on to them.
+class BackgroundRenderingChecker final
+    : public virtual Dispatcher,
+      public virtual IgnoreAttributeDispatchHelper,
+      public virtual IgnoreClipDispatchHelper,
+      public virtual IgnoreTransformDispatchHelper,
+      public virtual IgnoreDrawDispatchHelper {
+ public:
+  bool can_render_in_background() const { return can_render_; }
+
+  void setColorSource(const DlColorSource* source) override {
+    if (!source) {
+      return;
+    }
+    switch (source->type()) {
+      case DlColorSourceType::kImage:
+        CheckImage(source->asImage()->image().get());
+        break;
+      case DlColorSourceType::kRuntimeEffect:
+      case DlColorSourceType::kUnknown:
+        can_render_ = false;
+        break;
+      default:
+        break;
+    }
+  }
+  void drawImage(const sk_sp<DlImage> image,
+                 const SkPoint point,
+                 DlImageSampling sampling,
+                 bool render_with_attributes) override {
+    CheckImage(image.get());
+  }
+  void drawImageRect(const sk_sp<DlImage> image,
+                     const SkRect& src,
+                     const SkRect& dst,
+                     DlImageSampling sampling,
+                     bool render_with_attributes,
+                     SkCanvas::SrcRectConstraint constraint) override {
+    CheckImage(image.get());
+  }
+  void drawImageNine(const sk_sp<DlImage> image,
+                     const SkIRect& center,
+                     const SkRect& dst,
+                     DlFilterMode filter,
+                     bool render_with_attributes) override {
+    CheckImage(image.get());
+  }
+  void drawImageLattice(const sk_sp<DlImage> image,
+                        const SkCanvas::Lattice& lattice,
+                        const SkRect& dst,
+                        DlFilterMode filter,
+                        bool render_with_attributes) override {
+    CheckImage(image.get());
+  }
+  void drawAtlas(const sk_sp<DlImage> atlas,
+                 const SkRSXform xform[],
+                 const SkRect tex[],
+                 const DlColor colors[],
+                 int count,
+                 DlBlendMode mode,
+                 DlImageSampling sampling,
+                 const SkRect* cull_rect,
+                 bool render_with_attributes) override {
+    CheckImage(atlas.get());
+  }
+  void drawPicture(const sk_sp<SkPicture> picture,
+                   const SkMatrix* matrix,
+                   bool render_with_attributes) override {
+    can_render_ = false;
+  }
+  void drawDisplayList(const sk_sp<DisplayList> display_list) override {
+    if (can_render_) {
+      display_list->Dispatch(*this);
+    }
+  }
+
+ private:
+  bool can_render_ = true;
+
+  void CheckImage(const DlImage* image) {
+    if (!image || image->isTextureBacked()) {
+      can_render_ = false;
+    }
+  }
+};
+
+}  // namespace
+
+struct RasterCache::BackgroundJob {
+  std::mutex mutex;
+  bool done = false;
+  sk_sp<SkImage> image;
+  // Recorded instead of |image| when the entry is rendered into a GPU surface.
+  sk_sp<SkDeferredDisplayList> display_list;
+};
+
+bool RasterCache::UpdateDisplayListCacheEntry(
+    const RasterCacheKeyID& id,
+    const Context& raster_cache_context,
+    const sk_sp<DisplayList>& display_list) const {
+  RasterCacheKey key = RasterCacheKey(id, raster_cache_context.matrix);
+  if (background_task_runner_ && !raster_cache_context.aiks_context) {
+    Entry& entry = cache_[key];
+    entry.last_used_frame = frame_count_;
+    if (entry.image) {
+      MaybeCompress(entry, raster_cache_context.gr_context);
+      return true;
+    }
+    if (entry.background_job) {
+      return FinishBackgroundJob(entry, raster_cache_context);
+    }
+    BackgroundRenderingChecker checker;
+    display_list->Dispatch(checker);
+    if (checker.can_render_in_background()) {
+      StartBackgroundJob(entry, raster_cache_context, display_list);
+      return false;
+    }
+  }
+  return UpdateCacheEntry(
+      id, raster_cache_context,
+      [&display_list](SkCanvas* canvas, DisplayListBuilder* builder) {
+        if (builder) {
+          display_list->RenderTo(builder);
+        } else {
+          display_list->RenderTo(canvas);
+        }
+      });
+}
+
+bool RasterCache::StartBackgroundJob(
+    Entry& entry,
+    const Context& raster_cache_context,
+    const sk_sp<DisplayList>& display_list) const {
+  if (background_jobs_in_flight_->load() >= kMaxInFlightBackgroundJobs) {
+    return false;
+  }
+
+  SkMatrix matrix =
+      RasterCacheUtil::GetIntegralTransCTM(raster_cache_context.matrix);
+  SkRect dest_rect = RasterCacheUtil::GetRoundedOutDeviceBounds(
+      raster_cache_context.logical_rect, matrix);
+  SkImageInfo image_info = SkImageInfo::MakeN32Premul(
+      dest_rect.width(), dest_rect.height(),
+      sk_ref_sp(raster_cache_context.dst_color_space));
+
+  // The GPU surface is created and later drawn into on the raster thread.
+  // Only its characterization, which the recorder needs to record
+  // compatible commands, goes to the worker.
+  SkSurfaceCharacterization characterization;
+  if (use_deferred_display_lists_ && raster_cache_context.gr_context) {
+    entry.deferred_surface = SkSurface::MakeRenderTarget(
+        raster_cache_context.gr_context, SkBudgeted::kYes, image_info);
+    if (entry.deferred_surface &&
+        !entry.deferred_surface->characterize(&characterization)) {
+      entry.deferred_surface = nullptr;
+    }
+  }
+
+  auto job = std::make_shared<BackgroundJob>();
+  entry.background_job = job;
+  display_list_cached_this_frame_++;
+  background_jobs_in_flight_->fetch_add(1);
+  background_task_runner_->PostTask(
+      [job, display_list, image_info, dest_rect, matrix, characterization,
+       logical_rect = raster_cache_context.logical_rect,
+       checkerboard = checkerboard_images_,
+       in_flight = background_jobs_in_flight_]() {
+        auto render = [&](SkCanvas* canvas) {
+          canvas->clear(SK_ColorTRANSPARENT);
+          canvas->translate(-dest_rect.left(), -dest_rect.top());
+          canvas->concat(matrix);
+          display_list->RenderTo(canvas);
+          if (checkerboard) {
+            DrawCheckerboard(canvas, logical_rect);
+          }
+        };
+        sk_sp<SkImage> image;
+        sk_sp<SkDeferredDisplayList> deferred_display_list;
+        if (characterization.isValid()) {
+          SkDeferredDisplayListRecorder recorder(characterization);
+          if (SkCanvas* canvas = recorder.getCanvas()) {
+            render(canvas);
+            deferred_display_list = recorder.detach();
+          }
+        } else if (sk_sp<SkSurface> surface =
+                       SkSurface::MakeRaster(image_info)) {
+          render(surface->getCanvas());
+          image = surface->makeImageSnapshot();
+        }
+        {
+          std::scoped_lock lock(job->mutex);
+          job->image = std::move(image);
+          job->display_list = std::move(deferred_display_list);
+          job->done = true;
+        }
+        in_flight->fetch_sub(1);
+      });
+  return true;
+}
+
+bool RasterCache::FinishBackgroundJob(Entry& entry,
+                                      const Context& raster_cache_context) {
+  sk_sp<SkImage> image;
+  sk_sp<SkDeferredDisplayList> deferred_display_list;
+  {
+    std::scoped_lock lock(entry.background_job->mutex);
+    if (!entry.background_job->done) {
+      return false;
+    }
+    image = std::move(entry.background_job->image);
+    deferred_display_list = std::move(entry.background_job->display_list);
+  }
+  entry.background_job.reset();
+  sk_sp<SkSurface> deferred_surface = std::move(entry.deferred_surface);
+  if (deferred_display_list && deferred_surface) {
+    // Replaying the recorded commands is cheap compared to recording them.
+    if (deferred_surface->draw(deferred_display_list)) {
+      image = deferred_surface->makeImageSnapshot();
+    }
+  } else if (image && raster_cache_context.gr_context) {
+    // The image was rendered on the CPU and is uploaded once, here, so that
+    // drawing it from the cache does not upload it on every frame.
+    image = image->makeTextureImage(raster_cache_context.gr_context);
+  }
+  if (!image) {
+    return false;
+  }
+  entry.image = std::make_unique<RasterCacheResult>(
+      image, raster_cache_context.logical_rect, raster_cache_context.flow_type);
+  return true;
+}
+
+bool RasterCache::HasPendingEntry(const RasterCacheKeyID& id,
+                                  const SkMatrix& matrix) const {
+  auto it = cache_.find(RasterCacheKey(id, matrix));
+  return it != cache_.end() && it->second.background_job != nullptr;
+}
+
 int RasterCache::MarkSeen(const RasterCacheKeyID& id,
                           const SkMatrix& matrix,
                           bool visible) const {
@@ -116,6 +492,7 @@ int RasterCache::MarkSeen(const RasterCacheKeyID& id,
   Entry& entry = cache_[key];
   entry.encountered_this_frame = true;
   entry.visible_this_frame = visible;
+  entry.last_used_frame = frame_count_;
   if (visible || entry.accesses_since_visible > 0) {
     entry.accesses_since_visible++;
   }
@@ -159,26 +536,73 @@ bool RasterCache::Draw(const RasterCacheKeyID& id,
   return false;
 }
 
+bool RasterCache::Draw(const RasterCacheKeyID& id,
+                       DisplayListBuilder& builder,
+                       const SkPaint* paint) const {
+  auto it = cache_.find(RasterCacheKey(id, builder.getTransform()));
+  if (it == cache_.end()) {
+    return false;
+  }
+
+  Entry& entry = it->second;
+
+  if (entry.image) {
+    entry.image->draw(builder, paint);
+    return true;
+  }
+
+  return false;
+}
+
 void RasterCache::BeginFrame() {
+  frame_count_++;
   display_list_cached_this_frame_ = 0;
+  compressed_this_frame_ = 0;
   picture_metrics_ = {};
   layer_metrics_ = {};
+  is_multi_view_frame_ = false;
+}
+
+void RasterCache::BeginMultiViewFrame() {
+  BeginFrame();
+  is_multi_view_frame_ = true;
 }
 
 void RasterCache::UpdateMetrics() {
   for (auto it = cache_.begin(); it != cache_.end(); ++it) {
     Entry& entry = it->second;
-    FML_DCHECK(entry.encountered_this_frame);
+    FML_DCHECK(entry.encountered_this_frame ||
+               eviction_policy_ != RasterCacheEvictionPolicy::kUnusedInFrame);
     if (entry.image) {
       RasterCacheMetrics& metrics = GetMetricsForKind(it->first.kind());
-      metrics.in_use_count++;
-      metrics.in_use_bytes += entry.image->image_bytes();
+      if (entry.encountered_this_frame) {
+        metrics.in_use_count++;
+        metrics.in_use_bytes += entry.image->image_bytes();
+      } else {
+        metrics.retained_count++;
+        metrics.retained_bytes += entry.image->image_bytes();
+      }
+      if (entry.uncompressed_bytes > 0) {
+        metrics.compressed_count++;
+        metrics.compression_saved_bytes +=
+            entry.uncompressed_bytes - entry.image->image_bytes();
+      }
+      entry.frames_cached++;
     }
     entry.encountered_this_frame = false;
   }
 }
 
 void RasterCache::EvictUnusedCacheEntries() {
+  if (is_multi_view_frame_) {
+    // The views that have not been prerolled yet may still use the entries.
+    return;
+  }
+  if (eviction_policy_ == RasterCacheEvictionPolicy::kLeastRecentlyUsed) {
+    EvictLeastRecentlyUsedEntries();
+    return;
+  }
+
   std::vector<RasterCacheKey::Map<Entry>::iterator> dead;
 
   for (auto it = cache_.begin(); it != cache_.end(); ++it) {
@@ -189,16 +613,67 @@ void RasterCache::EvictUnusedCacheEntries() {
   }
 
   for (auto it : dead) {
-    if (it->second.image) {
-      RasterCacheMetrics& metrics = GetMetricsForKind(it->first.kind());
-      metrics.eviction_count++;
-      metrics.eviction_bytes += it->second.image->image_bytes();
+    Evict(it, false);
+  }
+}
+
+void RasterCache::EvictLeastRecentlyUsedEntries() {
+  std::vector<RasterCacheKey::Map<Entry>::iterator> unused;
+  size_t cached_bytes = 0;
+
+  for (auto it = cache_.begin(); it != cache_.end();) {
+    auto current = it++;
+    Entry& entry = current->second;
+    if (entry.encountered_this_frame) {
+      if (entry.image) {
+        cached_bytes += entry.image->image_bytes();
+      }
+    } else if (frame_count_ - entry.last_used_frame > kMaxUnusedFrames) {
+      Evict(current, false);
+    } else if (entry.image) {
+      cached_bytes += entry.image->image_bytes();
+      unused.push_back(current);
     }
-    cache_.erase(it);
+  }
+
+  if (max_bytes_ == 0 || cached_bytes <= max_bytes_) {
+    return;
+  }
+
+  // Entries used in this frame are never evicted, even when they alone are
+  // over the budget.
+  std::sort(unused.begin(), unused.end(), [](const auto& a, const auto& b) {
+    return a->second.last_used_frame < b->second.last_used_frame;
+  });
+  for (auto it : unused) {
+    if (cached_bytes <= max_bytes_) {
+      break;
+    }
+    cached_bytes -= it->second.image->image_bytes();
+    Evict(it, true);
   }
 }
 
+void RasterCache::Evict(RasterCacheKey::Map<Entry>::iterator it,
+                        bool over_budget) {
+  if (it->second.image) {
+    RasterCacheMetrics& metrics = GetMetricsForKind(it->first.kind());
+    metrics.eviction_count++;
+    metrics.eviction_bytes += it->second.image->image_bytes();
+    if (over_budget) {
+      metrics.budget_eviction_count++;
+    } else {
+      metrics.age_eviction_count++;
+    }
+  }
+  cache_.erase(it);
+}
+
 void RasterCache::EndFrame() {
+  if (is_multi_view_frame_) {
+    is_multi_view_frame_ = false;
+    EvictUnusedCacheEntries();
+  }
   UpdateMetrics();
   TraceStatsToTimeline();
 }
@@ -209,6 +684,23 @@ void RasterCache::Clear() {
   layer_metrics_ = {};
 }
 
+size_t RasterCache::EvictRetainedEntries() {
+  size_t evicted_bytes = 0;
+  for (auto it = cache_.begin(); it != cache_.end();) {
+    auto current = it++;
+    Entry& entry = current->second;
+    if (entry.last_used_frame == frame_count_ ||
+        entry.background_job != nullptr) {
+      continue;
+    }
+    if (entry.image) {
+      evicted_bytes += entry.image->image_bytes();
+    }
+    Evict(current, false);
+  }
+  return evicted_bytes;
+}
+
 size_t RasterCache::GetCachedEntriesCount() const {
   return cache_.size();
 }
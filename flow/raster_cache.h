@@ -5,24 +5,32 @@
 #ifndef FLUTTER_FLOW_RASTER_CACHE_H_
 #define FLUTTER_FLOW_RASTER_CACHE_H_
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
 #include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_builder.h"
 #include "flutter/display_list/display_list_complexity.h"
 #include "flutter/flow/raster_cache_key.h"
 #include "flutter/flow/raster_cache_util.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
+#include "flutter/fml/task_runner.h"
 #include "flutter/fml/trace_event.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkMatrix.h"
 #include "include/core/SkRect.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkSurface.h"
 
 class SkColorSpace;
 
+namespace impeller {
+class AiksContext;
+}  // namespace impeller
+
 namespace flutter {
 
 enum class RasterCacheLayerStrategy { kLayer, kLayerChildren };
@@ -37,6 +45,11 @@ class RasterCacheResult {
 
   virtual void draw(SkCanvas& canvas, const SkPaint* paint) const;
 
+  // Draws the cached image into the builder directly. This is how cache
+  // entries are drawn when the frame is recorded into a DisplayList that is
+  // rendered by Impeller, as Impeller textures can't be drawn to an SkCanvas.
+  virtual void draw(DisplayListBuilder& builder, const SkPaint* paint) const;
+
   virtual SkISize image_dimensions() const {
     return image_ ? image_->dimensions() : SkISize::Make(0, 0);
   };
@@ -45,6 +58,17 @@ class RasterCacheResult {
     return image_ ? image_->imageInfo().computeMinByteSize() : 0;
   };
 
+  // Replaces the image with a 16 bit RGB565 copy if every pixel of it is
+  // opaque, dithering the colors if |dither| is set. The image is read back
+  // to find out, so this stalls on the GPU. Returns whether the image was
+  // replaced.
+  virtual bool CompressToRGB565(GrDirectContext* gr_context, bool dither);
+
+ protected:
+  void DrawImage(DisplayListBuilder& builder,
+                 const sk_sp<DlImage>& image,
+                 const SkPaint* paint) const;
+
  private:
   sk_sp<SkImage> image_;
   SkRect logical_rect_;
@@ -67,6 +91,15 @@ struct RasterCacheMetrics {
    */
   size_t eviction_bytes = 0;
 
+  /**
+   * The number of evicted entries that were removed to bring the cache back
+   * within its byte budget, and the number that were removed because they
+   * had not been used for too many frames. Both are included in
+   * |eviction_count|.
+   */
+  size_t budget_eviction_count = 0;
+  size_t age_eviction_count = 0;
+
   /**
    * The number of cache entries with images used in this frame.
    */
@@ -77,15 +110,65 @@ struct RasterCacheMetrics {
    */
   size_t in_use_bytes = 0;
 
+  /**
+   * The number of cache entries with images that were kept but not used in
+   * this frame, and the size of their images.
+   */
+  size_t retained_count = 0;
+  size_t retained_bytes = 0;
+
+  /**
+   * The number of cached images that are stored compressed, and the bytes
+   * that compressing them saves. The compressed sizes are the ones counted
+   * in |in_use_bytes| and |retained_bytes|.
+   */
+  size_t compressed_count = 0;
+  size_t compression_saved_bytes = 0;
+
   /**
    * The total cache entries that had images during this frame.
    */
-  size_t total_count() const { return in_use_count; }
+  size_t total_count() const { return in_use_count + retained_count; }
 
   /**
    * The size of all of the cached images during this frame.
    */
-  size_t total_bytes() const { return in_use_bytes; }
+  size_t total_bytes() const { return in_use_bytes + retained_bytes; }
+};
+
+enum class RasterCacheEvictionPolicy {
+  // Entries that were not encountered in a frame are evicted before it is
+  // painted.
+  kUnusedInFrame,
+  // Entries survive frames in which they are not encountered until they
+  // have been unused for |RasterCache::kMaxUnusedFrames| frames. When the
+  // cached images exceed the byte budget of the cache, the least recently
+  // used entries are evicted first.
+  kLeastRecentlyUsed,
+};
+
+enum class RasterCacheCompression {
+  // Images are kept in the format they were rasterized in.
+  kNone,
+  // The images of opaque entries are converted to RGB565, which halves their
+  // size at the cost of color precision.
+  kRGB565,
+};
+
+// Controls which long-lived entries have their images compressed.
+struct RasterCacheCompressionOptions {
+  RasterCacheCompression compression = RasterCacheCompression::kNone;
+  // The number of frames an image must have been cached for. Entries that
+  // change often are not worth compressing.
+  size_t min_age_frames = 60;
+  // Smaller images are left alone, as they save little.
+  size_t min_image_bytes = 256 * 1024;
+  // Whether the conversion dithers, which hides the banding it introduces in
+  // gradients.
+  bool dither = true;
+  // The number of entries that may be compressed in a frame, as each one is
+  // read back from the GPU.
+  size_t max_compressions_per_frame = 1;
 };
 
 /**
@@ -111,6 +194,11 @@ struct RasterCacheMetrics {
  *       `RasterCache::Draw` will be used to draw those cache images.
  *   - RasterCache::EndFrame:
  *       Computes used counts and memory then reports cache metrics.
+ *
+ * When the layer trees of several views are rasterized in the same frame,
+ * the frame is begun with RasterCache::BeginMultiViewFrame and every view
+ * runs the preroll and paint stages in turn. The eviction of unused entries
+ * is then deferred to RasterCache::EndFrame.
  */
 class RasterCache {
  public:
@@ -120,14 +208,29 @@ class RasterCache {
     const SkMatrix& matrix;
     const SkRect& logical_rect;
     const char* flow_type;
+    // When set, entries are rasterized into Impeller textures instead of
+    // Skia surfaces.
+    impeller::AiksContext* aiks_context = nullptr;
   };
 
+  // A function that renders the contents of a cache entry. When the entry is
+  // rasterized by Impeller, the canvas records into the builder, which should
+  // be preferred for anything that can draw to it directly. The builder is
+  // null otherwise.
+  using DrawFunction = std::function<void(SkCanvas*, DisplayListBuilder*)>;
+
   std::unique_ptr<RasterCacheResult> Rasterize(
       const RasterCache::Context& context,
       const std::function<void(SkCanvas*)>& draw_function,
       const std::function<void(SkCanvas*, const SkRect& rect)>&
           draw_checkerboard) const;
 
+  std::unique_ptr<RasterCacheResult> Rasterize(
+      const RasterCache::Context& context,
+      const DrawFunction& draw_function,
+      const std::function<void(SkCanvas*, const SkRect& rect)>&
+          draw_checkerboard) const;
+
   explicit RasterCache(
       size_t access_threshold = 3,
       size_t picture_and_display_list_cache_limit_per_frame =
@@ -144,18 +247,56 @@ class RasterCache {
             SkCanvas& canvas,
             const SkPaint* paint) const;
 
+  bool Draw(const RasterCacheKeyID& id,
+            DisplayListBuilder& builder,
+            const SkPaint* paint) const;
+
   bool HasEntry(const RasterCacheKeyID& id, const SkMatrix&) const;
 
   void BeginFrame();
 
+  // Begins a frame in which the layer trees of several views are rasterized
+  // one after the other. The views share the entries of the cache, so the
+  // entries that are unused by the view painted first are only evicted by
+  // |EndFrame|, once all views have been prerolled.
+  void BeginMultiViewFrame();
+
   void EvictUnusedCacheEntries();
 
   void EndFrame();
 
   void Clear();
 
+  // Evicts the entries that were not used in the most recent frame, which
+  // are normally kept to avoid rasterizing them again when they reappear.
+  // Returns the number of bytes of cached images that were evicted.
+  size_t EvictRetainedEntries();
+
   void SetCheckboardCacheImages(bool checkerboard);
 
+  // The number of frames that an entry may go unused before it is evicted
+  // under the |kLeastRecentlyUsed| policy.
+  static constexpr size_t kMaxUnusedFrames = 120;
+
+  void SetEvictionPolicy(RasterCacheEvictionPolicy policy) {
+    eviction_policy_ = policy;
+  }
+  RasterCacheEvictionPolicy eviction_policy() const { return eviction_policy_; }
+
+  // Sets the number of bytes of cached images that the |kLeastRecentlyUsed|
+  // policy keeps entries that are not in use within, or 0 for no budget.
+  void SetMaxBytes(size_t max_bytes) { max_bytes_ = max_bytes; }
+  size_t max_bytes() const { return max_bytes_; }
+
+  // Sets how the images of entries that have been cached for a while are
+  // compressed. Each entry is compressed at most once.
+  void SetCompressionOptions(const RasterCacheCompressionOptions& options) {
+    compression_options_ = options;
+  }
+  const RasterCacheCompressionOptions& compression_options() const {
+    return compression_options_;
+  }
+
   const RasterCacheMetrics& picture_metrics() const { return picture_metrics_; }
   const RasterCacheMetrics& layer_metrics() const { return layer_metrics_; }
 
@@ -236,16 +377,83 @@ class RasterCache {
       const Context& raster_cache_context,
       const std::function<void(SkCanvas*)>& render_function) const;
 
+  bool UpdateCacheEntry(const RasterCacheKeyID& id,
+                        const Context& raster_cache_context,
+                        const DrawFunction& render_function) const;
+
+  // Populates the entry for |display_list|.
+  //
+  // When background rasterization is enabled and the DisplayList can be
+  // rendered away from the raster thread, the entry is rasterized on the
+  // background task runner instead and this returns false, so that the
+  // caller draws the DisplayList directly, until a later frame finds the
+  // rasterized image ready and swaps it in.
+  bool UpdateDisplayListCacheEntry(
+      const RasterCacheKeyID& id,
+      const Context& raster_cache_context,
+      const sk_sp<DisplayList>& display_list) const;
+
+  // Whether the entry is being rasterized in the background.
+  bool HasPendingEntry(const RasterCacheKeyID& id,
+                       const SkMatrix& matrix) const;
+
+  // The maximum number of entries that are rasterized in the background at
+  // the same time.
+  static constexpr size_t kMaxInFlightBackgroundJobs = 4;
+
+  // Enables rasterizing DisplayList entries on |runner|, or disables it if
+  // |runner| is null.
+  void SetBackgroundTaskRunner(std::shared_ptr<fml::BasicTaskRunner> runner) {
+    background_task_runner_ = std::move(runner);
+  }
+
+  // Experimental. Makes the background jobs of entries that are cached for a
+  // GrDirectContext record the DisplayList into an SkDeferredDisplayList,
+  // which the raster thread then replays into a GPU surface, instead of
+  // rasterizing it on the CPU and uploading the result.
+  void SetUseDeferredDisplayLists(bool use) {
+    use_deferred_display_lists_ = use;
+  }
+
  private:
+  struct BackgroundJob;
+
   struct Entry {
     bool encountered_this_frame = false;
     bool visible_this_frame = false;
     size_t accesses_since_visible = 0;
+    // The frame in which the entry was last encountered.
+    size_t last_used_frame = 0;
     std::unique_ptr<RasterCacheResult> image;
+    // Set while the image is being rasterized in the background.
+    std::shared_ptr<BackgroundJob> background_job;
+    // The surface that the deferred display list of the background job is
+    // replayed into. It never leaves the raster thread.
+    sk_sp<SkSurface> deferred_surface;
+    // The number of frames that ended while the entry had an image.
+    size_t frames_cached = 0;
+    bool compression_attempted = false;
+    // The size of the image before it was compressed, or 0.
+    size_t uncompressed_bytes = 0;
   };
 
+  void MaybeCompress(Entry& entry, GrDirectContext* gr_context) const;
+
+  bool StartBackgroundJob(Entry& entry,
+                          const Context& raster_cache_context,
+                          const sk_sp<DisplayList>& display_list) const;
+
+  static bool FinishBackgroundJob(Entry& entry,
+                                  const Context& raster_cache_context);
+
   void UpdateMetrics();
 
+  void EvictLeastRecentlyUsedEntries();
+
+  // Removes an entry, counting it as evicted for being over the byte budget
+  // or for being unused.
+  void Evict(RasterCacheKey::Map<Entry>::iterator it, bool over_budget);
+
   RasterCacheMetrics& GetMetricsForKind(RasterCacheKeyKind kind);
 
   const size_t access_threshold_;
@@ -255,6 +463,18 @@ class RasterCache {
   RasterCacheMetrics picture_metrics_;
   mutable RasterCacheKey::Map<Entry> cache_;
   bool checkerboard_images_;
+  RasterCacheEvictionPolicy eviction_policy_ =
+      RasterCacheEvictionPolicy::kUnusedInFrame;
+  size_t max_bytes_ = 0;
+  size_t frame_count_ = 0;
+  bool is_multi_view_frame_ = false;
+  RasterCacheCompressionOptions compression_options_;
+  mutable size_t compressed_this_frame_ = 0;
+  std::shared_ptr<fml::BasicTaskRunner> background_task_runner_;
+  bool use_deferred_display_lists_ = false;
+  // Shared with the background jobs, which count themselves out when done.
+  std::shared_ptr<std::atomic<size_t>> background_jobs_in_flight_ =
+      std::make_shared<std::atomic<size_t>>(0);
 
   void TraceStatsToTimeline() const;
 
@@ -0,0 +1,89 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/raster_cache_impeller.h"
+
+#include "flutter/display_list/display_list_canvas_recorder.h"
+#include "flutter/flow/raster_cache_util.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "flutter/impeller/aiks/aiks_context.h"
+#include "flutter/impeller/display_list/display_list_dispatcher.h"
+#include "flutter/impeller/display_list/display_list_image_impeller.h"
+
+namespace flutter {
+
+ImpellerRasterCacheResult::ImpellerRasterCacheResult(
+    sk_sp<DlImage> image,
+    const SkRect& logical_rect,
+    const char* type)
+    : RasterCacheResult(nullptr, logical_rect, type),
+      image_(std::move(image)) {}
+
+ImpellerRasterCacheResult::~ImpellerRasterCacheResult() = default;
+
+void ImpellerRasterCacheResult::draw(SkCanvas& canvas,
+                                     const SkPaint* paint) const {
+  // Impeller textures have no Skia backing. Layers draw cache entries into
+  // the DisplayListBuilder of the frame when Impeller is in use.
+  FML_DLOG(ERROR) << "Impeller raster cache entries can't be drawn to an "
+                     "SkCanvas.";
+}
+
+void ImpellerRasterCacheResult::draw(DisplayListBuilder& builder,
+                                     const SkPaint* paint) const {
+  DrawImage(builder, image_, paint);
+}
+
+SkISize ImpellerRasterCacheResult::image_dimensions() const {
+  return image_ ? image_->dimensions() : SkISize::Make(0, 0);
+}
+
+int64_t ImpellerRasterCacheResult::image_bytes() const {
+  return image_ ? image_->GetApproximateByteSize() : 0;
+}
+
+std::unique_ptr<RasterCacheResult> RasterizeWithImpeller(
+    const RasterCache::Context& context,
+    const RasterCache::DrawFunction& draw_function,
+    bool checkerboard,
+    const std::function<void(SkCanvas*, const SkRect& rect)>&
+        draw_checkerboard) {
+  TRACE_EVENT0("flutter", "RasterizeWithImpeller");
+  FML_DCHECK(context.aiks_context);
+
+  auto matrix = RasterCacheUtil::GetIntegralTransCTM(context.matrix);
+  SkRect dest_rect =
+      RasterCacheUtil::GetRoundedOutDeviceBounds(context.logical_rect, matrix);
+  if (dest_rect.isEmpty()) {
+    return nullptr;
+  }
+
+  DisplayListCanvasRecorder recorder(
+      SkRect::MakeWH(dest_rect.width(), dest_rect.height()));
+  recorder.translate(-dest_rect.left(), -dest_rect.top());
+  recorder.concat(matrix);
+  draw_function(&recorder, recorder.builder().get());
+
+  if (checkerboard) {
+    draw_checkerboard(&recorder, context.logical_rect);
+  }
+
+  impeller::DisplayListDispatcher dispatcher;
+  recorder.Build()->Dispatch(dispatcher);
+  auto picture = dispatcher.EndRecordingAsPicture();
+
+  auto image = picture.ToImage(
+      *context.aiks_context,
+      impeller::ISize(dest_rect.width(), dest_rect.height()));
+  if (!image) {
+    return nullptr;
+  }
+
+  return std::make_unique<ImpellerRasterCacheResult>(
+      impeller::DlImageImpeller::Make(image->GetTexture()),
+      context.logical_rect, context.flow_type);
+}
+
+}  // namespace flutter
@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_RASTER_CACHE_IMPELLER_H_
+#define FLUTTER_FLOW_RASTER_CACHE_IMPELLER_H_
+
+#include <memory>
+
+#include "flutter/display_list/display_list_image.h"
+#include "flutter/flow/raster_cache.h"
+
+namespace flutter {
+
+// A raster cache entry whose image is an Impeller texture. The texture is
+// produced by converting the entry's contents to an Impeller Picture and
+// rendering it with |Picture::ToImage|. It is drawn back as a |DlImage|, which
+// Impeller renders with |TextureContents|.
+class ImpellerRasterCacheResult : public RasterCacheResult {
+ public:
+  ImpellerRasterCacheResult(sk_sp<DlImage> image,
+                            const SkRect& logical_rect,
+                            const char* type);
+
+  ~ImpellerRasterCacheResult() override;
+
+  // |RasterCacheResult|
+  void draw(SkCanvas& canvas, const SkPaint* paint) const override;
+
+  // |RasterCacheResult|
+  void draw(DisplayListBuilder& builder, const SkPaint* paint) const override;
+
+  // |RasterCacheResult|
+  SkISize image_dimensions() const override;
+
+  // |RasterCacheResult|
+  int64_t image_bytes() const override;
+
+ private:
+  sk_sp<DlImage> image_;
+};
+
+// Rasterizes the contents rendered by |draw_function| into an Impeller
+// texture using the AiksContext of the raster cache context.
+std::unique_ptr<RasterCacheResult> RasterizeWithImpeller(
+    const RasterCache::Context& context,
+    const RasterCache::DrawFunction& draw_function,
+    bool checkerboard,
+    const std::function<void(SkCanvas*, const SkRect& rect)>&
+        draw_checkerboard);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_RASTER_CACHE_IMPELLER_H_
@@ -11,6 +11,7 @@
 #include "flutter/flow/raster_cache_item.h"
 #include "flutter/flow/testing/mock_raster_cache.h"
 #include "flutter/flow/testing/skia_gpu_object_layer_test.h"
+#include "flutter/fml/task_runner.h"
 #include "gtest/gtest.h"
 #include "include/core/SkMatrix.h"
 #include "include/core/SkPoint.h"
@@ -18,6 +19,7 @@
 #include "third_party/skia/include/core/SkPaint.h"
 #include "third_party/skia/include/core/SkPicture.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
+#include "third_party/skia/include/gpu/GrDirectContext.h"
 
 namespace flutter {
 namespace testing {
@@ -83,6 +85,61 @@ TEST(RasterCache, MetricsOmitUnpopulatedEntries) {
   ASSERT_EQ(cache.picture_metrics().total_bytes(), 25600u);
 }
 
+TEST(RasterCache, MultiViewFrameKeepsTheEntriesOfOtherViews) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto first_display_list = GetSampleDisplayList();
+  auto second_display_list = GetSampleDisplayList();
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  MutatorsStack mutators_stack;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      &cache, &raster_time, &ui_time, &mutators_stack);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(&cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem first_item(first_display_list.get(), SkPoint(),
+                                        true, false);
+  DisplayListRasterCacheItem second_item(second_display_list.get(), SkPoint(),
+                                         true, false);
+
+  // Each view is prerolled and painted in turn, which caches both display
+  // lists on their second access.
+  for (int i = 0; i < 2; i++) {
+    cache.BeginMultiViewFrame();
+    RasterCacheItemPrerollAndTryToRasterCache(first_item, preroll_context,
+                                              paint_context, matrix);
+    RasterCacheItemPrerollAndTryToRasterCache(second_item, preroll_context,
+                                              paint_context, matrix);
+    cache.EndFrame();
+  }
+  ASSERT_TRUE(first_item.Draw(paint_context, &dummy_canvas, &paint));
+  ASSERT_TRUE(second_item.Draw(paint_context, &dummy_canvas, &paint));
+  ASSERT_EQ(cache.GetCachedEntriesCount(), 2u);
+
+  // Painting the first view must not evict the entry of the second one.
+  cache.BeginMultiViewFrame();
+  RasterCacheItemPrerollAndTryToRasterCache(first_item, preroll_context,
+                                            paint_context, matrix);
+  ASSERT_TRUE(second_item.Draw(paint_context, &dummy_canvas, &paint));
+  ASSERT_EQ(cache.GetCachedEntriesCount(), 2u);
+
+  // The second view is gone, so its entry is evicted at the end of the frame.
+  cache.EndFrame();
+  ASSERT_EQ(cache.GetCachedEntriesCount(), 1u);
+  ASSERT_TRUE(first_item.Draw(paint_context, &dummy_canvas, &paint));
+  ASSERT_FALSE(second_item.Draw(paint_context, &dummy_canvas, &paint));
+}
+
 TEST(RasterCache, ThresholdIsRespectedForDisplayList) {
   size_t threshold = 2;
   flutter::RasterCache cache(threshold);
@@ -167,6 +224,50 @@ TEST(RasterCache, SetCheckboardCacheImages) {
   ASSERT_TRUE(did_draw_checkerboard);
 }
 
+TEST(RasterCache, CachedEntryCanBeDrawnIntoDisplayListBuilder) {
+  flutter::RasterCache cache;
+
+  SkMatrix matrix = SkMatrix::Translate(10.5, 10.5);
+
+  auto display_list = GetSampleDisplayList();
+  RasterCacheKeyID id(display_list->unique_id(),
+                      RasterCacheKeyType::kDisplayList);
+  RasterCache::Context r_context = {
+      // clang-format off
+      .gr_context         = nullptr,
+      .dst_color_space    = nullptr,
+      .matrix             = matrix,
+      .logical_rect       = display_list->bounds(),
+      .flow_type          = "RasterCacheFlow::DisplayList",
+      // clang-format on
+  };
+
+  cache.BeginFrame();
+  bool received_builder = false;
+  ASSERT_TRUE(cache.UpdateCacheEntry(
+      id, r_context, [&](SkCanvas* canvas, DisplayListBuilder* builder) {
+        received_builder = builder != nullptr;
+        display_list->RenderTo(canvas);
+      }));
+  // Only entries rasterized by Impeller are rendered through a builder.
+  ASSERT_FALSE(received_builder);
+
+  DisplayListBuilder scaled_builder;
+  scaled_builder.scale(2, 2);
+  ASSERT_FALSE(cache.Draw(id, scaled_builder, nullptr));
+
+  DisplayListBuilder builder;
+  builder.translate(10.5, 10.5);
+  ASSERT_TRUE(cache.Draw(id, builder, nullptr));
+  // The cached image is drawn at the device bounds of the entry, and the
+  // transform of the builder is left as it was.
+  ASSERT_EQ(builder.getTransform(), matrix);
+  ASSERT_EQ(builder.Build()->bounds(),
+            RasterCacheUtil::GetRoundedOutDeviceBounds(
+                display_list->bounds(),
+                RasterCacheUtil::GetIntegralTransCTM(matrix)));
+}
+
 TEST(RasterCache, AccessThresholdOfZeroDisablesCachingForSkPicture) {
   size_t threshold = 0;
   flutter::RasterCache cache(threshold);
@@ -398,6 +499,356 @@ TEST(RasterCache, EvitUnusedCacheEntries) {
   cache.EndFrame();
 }
 
+TEST(RasterCache, LeastRecentlyUsedEntriesSurviveShortAbsences) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  cache.SetEvictionPolicy(RasterCacheEvictionPolicy::kLeastRecentlyUsed);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list_1 = GetSampleDisplayList();
+  auto display_list_2 = GetSampleDisplayList();
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  MutatorsStack mutators_stack;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      &cache, &raster_time, &ui_time, &mutators_stack);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(&cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem display_list_item_1(display_list_1.get(),
+                                                 SkPoint(), true, false);
+  DisplayListRasterCacheItem display_list_item_2(display_list_2.get(),
+                                                 SkPoint(), true, false);
+
+  for (int i = 0; i < 2; i++) {
+    cache.BeginFrame();
+    RasterCacheItemPreroll(display_list_item_1, preroll_context, matrix);
+    RasterCacheItemPreroll(display_list_item_2, preroll_context, matrix);
+    cache.EvictUnusedCacheEntries();
+    RasterCacheItemTryToRasterCache(display_list_item_1, paint_context);
+    RasterCacheItemTryToRasterCache(display_list_item_2, paint_context);
+    cache.EndFrame();
+  }
+  ASSERT_EQ(cache.EstimatePictureCacheByteSize(), 51200u);
+
+  // The second entry is kept while it is not used.
+  cache.BeginFrame();
+  RasterCacheItemPreroll(display_list_item_1, preroll_context, matrix);
+  cache.EvictUnusedCacheEntries();
+  ASSERT_TRUE(display_list_item_1.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+
+  ASSERT_EQ(cache.EstimatePictureCacheByteSize(), 51200u);
+  ASSERT_EQ(cache.picture_metrics().eviction_count, 0u);
+  ASSERT_EQ(cache.picture_metrics().in_use_count, 1u);
+  ASSERT_EQ(cache.picture_metrics().retained_count, 1u);
+  ASSERT_EQ(cache.picture_metrics().total_bytes(), 51200u);
+
+  // And can be drawn again without being rasterized when it comes back.
+  cache.BeginFrame();
+  RasterCacheItemPreroll(display_list_item_1, preroll_context, matrix);
+  RasterCacheItemPreroll(display_list_item_2, preroll_context, matrix);
+  cache.EvictUnusedCacheEntries();
+  ASSERT_TRUE(display_list_item_2.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+
+  // Unused entries are evicted once the cache is over its budget.
+  cache.SetMaxBytes(25600u);
+  cache.BeginFrame();
+  RasterCacheItemPreroll(display_list_item_1, preroll_context, matrix);
+  cache.EvictUnusedCacheEntries();
+  ASSERT_EQ(cache.EstimatePictureCacheByteSize(), 25600u);
+  ASSERT_EQ(cache.picture_metrics().eviction_count, 1u);
+  ASSERT_EQ(cache.picture_metrics().budget_eviction_count, 1u);
+  ASSERT_EQ(cache.picture_metrics().age_eviction_count, 0u);
+  ASSERT_FALSE(display_list_item_2.Draw(paint_context, &dummy_canvas, &paint));
+  cache.EndFrame();
+
+  // Or once they have gone unused for too long.
+  for (size_t i = 0; i < RasterCache::kMaxUnusedFrames; i++) {
+    cache.BeginFrame();
+    cache.EvictUnusedCacheEntries();
+    cache.EndFrame();
+  }
+  ASSERT_EQ(cache.EstimatePictureCacheByteSize(), 25600u);
+  cache.BeginFrame();
+  cache.EvictUnusedCacheEntries();
+  ASSERT_EQ(cache.EstimatePictureCacheByteSize(), 0u);
+  ASSERT_EQ(cache.picture_metrics().age_eviction_count, 1u);
+  ASSERT_EQ(cache.picture_metrics().budget_eviction_count, 0u);
+  cache.EndFrame();
+}
+
+TEST(RasterCache, LongLivedOpaqueEntriesAreCompressed) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  cache.SetCompressionOptions({
+      .compression = RasterCacheCompression::kRGB565,
+      .min_age_frames = 2,
+      .min_image_bytes = 0,
+  });
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto opaque_display_list = GetSampleDisplayList();
+  DisplayListBuilder builder(SkRect::MakeWH(150, 100));
+  builder.setColor(SkColorSetARGB(0x80, 0xFF, 0x00, 0x00));
+  builder.drawRect(SkRect::MakeXYWH(10, 10, 80, 80));
+  auto translucent_display_list = builder.Build();
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  MutatorsStack mutators_stack;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      &cache, &raster_time, &ui_time, &mutators_stack);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(&cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem opaque_item(opaque_display_list.get(), SkPoint(),
+                                         true, false);
+  DisplayListRasterCacheItem translucent_item(translucent_display_list.get(),
+                                              SkPoint(), true, false);
+
+  auto render_frame = [&]() {
+    cache.BeginFrame();
+    RasterCacheItemPreroll(opaque_item, preroll_context, matrix);
+    RasterCacheItemPreroll(translucent_item, preroll_context, matrix);
+    cache.EvictUnusedCacheEntries();
+    RasterCacheItemTryToRasterCache(opaque_item, paint_context);
+    RasterCacheItemTryToRasterCache(translucent_item, paint_context);
+    cache.EndFrame();
+  };
+
+  // The entries are rasterized on their second frame, and kept uncompressed
+  // until they are old enough.
+  render_frame();
+  for (int i = 0; i < 2; i++) {
+    render_frame();
+    ASSERT_EQ(cache.picture_metrics().compressed_count, 0u);
+    ASSERT_EQ(cache.picture_metrics().total_bytes(), 51200u);
+  }
+
+  // The opaque entry is then stored with 2 bytes per pixel, and the
+  // translucent one is left alone.
+  for (int i = 0; i < 3; i++) {
+    render_frame();
+    ASSERT_EQ(cache.picture_metrics().compressed_count, 1u);
+    ASSERT_EQ(cache.picture_metrics().compression_saved_bytes, 12800u);
+    ASSERT_EQ(cache.picture_metrics().total_bytes(), 38400u);
+  }
+  ASSERT_TRUE(opaque_item.Draw(paint_context, &dummy_canvas, &paint));
+}
+
+TEST(RasterCache, EvictRetainedEntriesKeepsEntriesInUse) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  cache.SetEvictionPolicy(RasterCacheEvictionPolicy::kLeastRecentlyUsed);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  auto display_list_1 = GetSampleDisplayList();
+  auto display_list_2 = GetSampleDisplayList();
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  MutatorsStack mutators_stack;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      &cache, &raster_time, &ui_time, &mutators_stack);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(&cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  DisplayListRasterCacheItem display_list_item_1(display_list_1.get(),
+                                                 SkPoint(), true, false);
+  DisplayListRasterCacheItem display_list_item_2(display_list_2.get(),
+                                                 SkPoint(), true, false);
+
+  for (int i = 0; i < 2; i++) {
+    cache.BeginFrame();
+    RasterCacheItemPreroll(display_list_item_1, preroll_context, matrix);
+    RasterCacheItemPreroll(display_list_item_2, preroll_context, matrix);
+    cache.EvictUnusedCacheEntries();
+    RasterCacheItemTryToRasterCache(display_list_item_1, paint_context);
+    RasterCacheItemTryToRasterCache(display_list_item_2, paint_context);
+    cache.EndFrame();
+  }
+
+  cache.BeginFrame();
+  RasterCacheItemPreroll(display_list_item_1, preroll_context, matrix);
+  cache.EvictUnusedCacheEntries();
+  cache.EndFrame();
+  ASSERT_EQ(cache.EstimatePictureCacheByteSize(), 51200u);
+
+  // Only the entry that was not used in the last frame is evicted.
+  ASSERT_EQ(cache.EvictRetainedEntries(), 25600u);
+  ASSERT_EQ(cache.EstimatePictureCacheByteSize(), 25600u);
+  ASSERT_TRUE(display_list_item_1.Draw(paint_context, &dummy_canvas, &paint));
+  ASSERT_FALSE(display_list_item_2.Draw(paint_context, &dummy_canvas, &paint));
+  ASSERT_EQ(cache.EvictRetainedEntries(), 0u);
+}
+
+namespace {
+class QueuedTaskRunner : public fml::BasicTaskRunner {
+ public:
+  void PostTask(const fml::closure& task) override { tasks_.push_back(task); }
+
+  size_t task_count() const { return tasks_.size(); }
+
+  void RunTasks() {
+    std::vector<fml::closure> tasks = std::move(tasks_);
+    tasks_.clear();
+    for (auto& task : tasks) {
+      task();
+    }
+  }
+
+ private:
+  std::vector<fml::closure> tasks_;
+};
+}  // namespace
+
+TEST(RasterCache, DisplayListIsRasterizedInTheBackground) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold, 10);
+  auto task_runner = std::make_shared<QueuedTaskRunner>();
+  cache.SetBackgroundTaskRunner(task_runner);
+
+  SkMatrix matrix = SkMatrix::I();
+
+  const size_t item_count = RasterCache::kMaxInFlightBackgroundJobs + 2;
+  std::vector<sk_sp<DisplayList>> display_lists;
+  std::vector<std::unique_ptr<DisplayListRasterCacheItem>> items;
+  for (size_t i = 0; i < item_count; i++) {
+    display_lists.push_back(GetSampleDisplayList());
+    items.push_back(std::make_unique<DisplayListRasterCacheItem>(
+        display_lists.back().get(), SkPoint(), true, false));
+  }
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  MutatorsStack mutators_stack;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      &cache, &raster_time, &ui_time, &mutators_stack);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(&cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+
+  auto draw_frame = [&]() {
+    cache.BeginFrame();
+    for (auto& item : items) {
+      RasterCacheItemPreroll(*item, preroll_context, matrix);
+    }
+    cache.EvictUnusedCacheEntries();
+    for (auto& item : items) {
+      RasterCacheItemTryToRasterCache(*item, paint_context);
+    }
+    cache.EndFrame();
+  };
+
+  // The frames that reach the threshold start rasterizing the entries in the
+  // background and draw the DisplayLists directly.
+  draw_frame();
+  draw_frame();
+  ASSERT_EQ(task_runner->task_count(), RasterCache::kMaxInFlightBackgroundJobs);
+  for (auto& item : items) {
+    ASSERT_FALSE(item->Draw(paint_context, &dummy_canvas, &paint));
+  }
+  ASSERT_TRUE(cache.HasPendingEntry(items[0]->GetId().value(), matrix));
+
+  // Unfinished jobs do not block the frame.
+  draw_frame();
+  ASSERT_EQ(task_runner->task_count(), RasterCache::kMaxInFlightBackgroundJobs);
+  ASSERT_FALSE(items[0]->Draw(paint_context, &dummy_canvas, &paint));
+
+  // Finished jobs are swapped in by the next frame and make room for the
+  // entries that were over the limit.
+  task_runner->RunTasks();
+  draw_frame();
+  for (size_t i = 0; i < item_count; i++) {
+    bool started_first = i < RasterCache::kMaxInFlightBackgroundJobs;
+    ASSERT_EQ(items[i]->Draw(paint_context, &dummy_canvas, &paint),
+              started_first);
+  }
+  ASSERT_FALSE(cache.HasPendingEntry(items[0]->GetId().value(), matrix));
+  ASSERT_EQ(task_runner->task_count(), 2u);
+
+  task_runner->RunTasks();
+  draw_frame();
+  for (auto& item : items) {
+    ASSERT_TRUE(item->Draw(paint_context, &dummy_canvas, &paint));
+  }
+}
+
+TEST(RasterCache, BackgroundJobsCanRecordDeferredDisplayLists) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold, 10);
+  auto task_runner = std::make_shared<QueuedTaskRunner>();
+  cache.SetBackgroundTaskRunner(task_runner);
+  cache.SetUseDeferredDisplayLists(true);
+
+  sk_sp<GrDirectContext> gr_context = GrDirectContext::MakeMock(nullptr);
+  ASSERT_TRUE(gr_context);
+
+  SkMatrix matrix = SkMatrix::I();
+  auto display_list = GetSampleDisplayList();
+  DisplayListRasterCacheItem item(display_list.get(), SkPoint(), true, false);
+
+  SkCanvas dummy_canvas;
+  SkPaint paint;
+
+  FixedRefreshRateStopwatch raster_time;
+  FixedRefreshRateStopwatch ui_time;
+  MutatorsStack mutators_stack;
+  PrerollContextHolder preroll_context_holder = GetSamplePrerollContextHolder(
+      &cache, &raster_time, &ui_time, &mutators_stack);
+  PaintContextHolder paint_context_holder =
+      GetSamplePaintContextHolder(&cache, &raster_time, &ui_time);
+  auto& preroll_context = preroll_context_holder.preroll_context;
+  auto& paint_context = paint_context_holder.paint_context;
+  preroll_context.gr_context = gr_context.get();
+  paint_context.gr_context = gr_context.get();
+
+  auto draw_frame = [&]() {
+    cache.BeginFrame();
+    RasterCacheItemPreroll(item, preroll_context, matrix);
+    cache.EvictUnusedCacheEntries();
+    RasterCacheItemTryToRasterCache(item, paint_context);
+    cache.EndFrame();
+  };
+
+  draw_frame();
+  draw_frame();
+  ASSERT_EQ(task_runner->task_count(), 1u);
+  ASSERT_TRUE(cache.HasPendingEntry(item.GetId().value(), matrix));
+  ASSERT_FALSE(item.Draw(paint_context, &dummy_canvas, &paint));
+
+  // The recorded display list is replayed on the next frame.
+  task_runner->RunTasks();
+  draw_frame();
+  ASSERT_FALSE(cache.HasPendingEntry(item.GetId().value(), matrix));
+  ASSERT_TRUE(item.Draw(paint_context, &dummy_canvas, &paint));
+}
+
 TEST(RasterCache, ComputeDeviceRectBasedOnFractionalTranslation) {
   SkRect logical_rect = SkRect::MakeLTRB(0, 0, 300.2, 300.3);
   SkMatrix ctm = SkMatrix::MakeAll(2.0, 0, 0, 0, 2.0, 0, 0, 0, 1);
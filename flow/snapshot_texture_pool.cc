@@ -0,0 +1,133 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/snapshot_texture_pool.h"
+
+#include <algorithm>
+
+#include "flutter/common/constants.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+SnapshotTexturePool::SnapshotTexturePool(size_t max_pooled_bytes)
+    : max_pooled_bytes_(max_pooled_bytes) {}
+
+SnapshotTexturePool::~SnapshotTexturePool() {
+  Purge();
+}
+
+GrBackendTexture SnapshotTexturePool::Acquire(GrDirectContext* context,
+                                              const SkImageInfo& image_info) {
+  FML_DCHECK(context);
+  if (context != context_.get()) {
+    Purge();
+    in_use_.clear();
+    in_use_bytes_ = 0;
+    context_ = sk_ref_sp(context);
+  }
+
+  Entry entry;
+  // The most recently released match is the likeliest to still be resident.
+  auto it = std::find_if(
+      pooled_.rbegin(), pooled_.rend(), [&image_info](const Entry& pooled) {
+        return pooled.dimensions == image_info.dimensions() &&
+               pooled.color_type == image_info.colorType();
+      });
+  if (it != pooled_.rend()) {
+    entry = *it;
+    pooled_bytes_ -= entry.bytes;
+    pooled_.erase(std::next(it).base());
+  } else {
+    entry.texture = context->createBackendTexture(
+        image_info.width(), image_info.height(), image_info.colorType(),
+        GrMipmapped::kNo, GrRenderable::kYes);
+    if (!entry.texture.isValid()) {
+      return GrBackendTexture();
+    }
+    entry.dimensions = image_info.dimensions();
+    entry.color_type = image_info.colorType();
+    entry.bytes = image_info.computeMinByteSize();
+  }
+
+  bool was_within_budget = in_use_bytes_ <= budget_bytes_;
+  in_use_bytes_ += entry.bytes;
+  in_use_.push_back(entry);
+  if (budget_bytes_ > 0 && was_within_budget &&
+      in_use_bytes_ > budget_bytes_ && budget_exceeded_callback_) {
+    budget_exceeded_callback_(in_use_bytes_);
+  }
+  TraceStatsToTimeline();
+  return entry.texture;
+}
+
+bool SnapshotTexturePool::Release(const GrBackendTexture& texture) {
+  auto it = std::find_if(in_use_.begin(), in_use_.end(),
+                         [&texture](const Entry& entry) {
+                           return entry.texture.isSameTexture(texture);
+                         });
+  if (it == in_use_.end()) {
+    return false;
+  }
+  Entry entry = *it;
+  in_use_.erase(it);
+  in_use_bytes_ -= entry.bytes;
+
+  if (entry.bytes > max_pooled_bytes_) {
+    DeleteTexture(entry);
+  } else {
+    EvictOverLimit(max_pooled_bytes_ - entry.bytes);
+    pooled_bytes_ += entry.bytes;
+    pooled_.push_back(entry);
+  }
+  TraceStatsToTimeline();
+  return true;
+}
+
+size_t SnapshotTexturePool::Purge() {
+  size_t purged_bytes = pooled_bytes_;
+  EvictOverLimit(0);
+  TraceStatsToTimeline();
+  return purged_bytes;
+}
+
+void SnapshotTexturePool::OnGrContextDestroyed() {
+  Purge();
+  in_use_.clear();
+  in_use_bytes_ = 0;
+  context_.reset();
+}
+
+void SnapshotTexturePool::SetBudget(size_t budget_bytes,
+                                    BudgetExceededCallback callback) {
+  budget_bytes_ = budget_bytes;
+  budget_exceeded_callback_ = std::move(callback);
+}
+
+void SnapshotTexturePool::DeleteTexture(Entry& entry) {
+  if (context_) {
+    context_->deleteBackendTexture(entry.texture);
+  }
+  entry.texture = GrBackendTexture();
+}
+
+void SnapshotTexturePool::EvictOverLimit(size_t limit_bytes) {
+  while (pooled_bytes_ > limit_bytes && !pooled_.empty()) {
+    pooled_bytes_ -= pooled_.front().bytes;
+    DeleteTexture(pooled_.front());
+    pooled_.pop_front();
+  }
+}
+
+void SnapshotTexturePool::TraceStatsToTimeline() const {
+#if !FLUTTER_RELEASE
+  FML_TRACE_COUNTER("flutter",                                             //
+                    "SnapshotTexturePool", reinterpret_cast<int64_t>(this),  //
+                    "InUseMBytes", in_use_bytes_ / kMegaByteSizeInBytes,     //
+                    "PooledMBytes", pooled_bytes_ / kMegaByteSizeInBytes);
+#endif  // !FLUTTER_RELEASE
+}
+
+}  // namespace flutter
@@ -0,0 +1,106 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_SNAPSHOT_TEXTURE_POOL_H_
+#define FLUTTER_FLOW_SNAPSHOT_TEXTURE_POOL_H_
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/gpu/GrBackendSurface.h"
+#include "third_party/skia/include/gpu/GrDirectContext.h"
+
+namespace flutter {
+
+// A pool of the render target textures that GPU resident snapshots, such as
+// the images of Picture.toImageSync, are drawn into.
+//
+// Apps often snapshot the same sizes over and over, for example a page in a
+// route transition. Textures that are no longer used are kept, up to a byte
+// limit, and handed out again for snapshots of the same dimensions and color
+// type instead of allocating new ones. The bucket is the exact size because
+// an image can't be a view into part of a larger texture without a copy.
+//
+// The pool also tracks the bytes of the textures that are in use, and can
+// report when they exceed a budget.
+//
+// This class must only be used on the thread that owns the GrDirectContext,
+// which is the raster thread.
+class SnapshotTexturePool {
+ public:
+  static constexpr size_t kDefaultMaxPooledBytes = 32 * 1024 * 1024;
+
+  using BudgetExceededCallback = std::function<void(size_t in_use_bytes)>;
+
+  explicit SnapshotTexturePool(
+      size_t max_pooled_bytes = kDefaultMaxPooledBytes);
+
+  ~SnapshotTexturePool();
+
+  // Gets a renderable texture for |image_info|, either from the pool or
+  // newly created. Returns an invalid texture if one could not be created.
+  //
+  // The contents of a pooled texture are undefined.
+  GrBackendTexture Acquire(GrDirectContext* context,
+                           const SkImageInfo& image_info);
+
+  // Gives back a texture that was returned by |Acquire| and is no longer
+  // used. It is kept for reuse if it fits in the pool, and deleted
+  // otherwise.
+  //
+  // Returns false, leaving the texture to the caller, if it was not acquired
+  // from the pool since its context was last destroyed.
+  bool Release(const GrBackendTexture& texture);
+
+  // Deletes the pooled textures and returns the number of bytes they took up.
+  // The textures that are in use are not affected.
+  size_t Purge();
+
+  // Deletes the pooled textures and forgets the ones in use, which belong to
+  // the context that is about to be destroyed.
+  void OnGrContextDestroyed();
+
+  // Invokes |callback| whenever the bytes of the textures that are in use
+  // grow over |budget_bytes|. A budget of 0 disables the callback.
+  void SetBudget(size_t budget_bytes, BudgetExceededCallback callback);
+
+  size_t in_use_bytes() const { return in_use_bytes_; }
+
+  size_t pooled_bytes() const { return pooled_bytes_; }
+
+  size_t pooled_count() const { return pooled_.size(); }
+
+ private:
+  struct Entry {
+    GrBackendTexture texture;
+    SkISize dimensions;
+    SkColorType color_type;
+    size_t bytes;
+  };
+
+  const size_t max_pooled_bytes_;
+  sk_sp<GrDirectContext> context_;
+  // The least recently released textures come first.
+  std::deque<Entry> pooled_;
+  std::vector<Entry> in_use_;
+  size_t pooled_bytes_ = 0;
+  size_t in_use_bytes_ = 0;
+  size_t budget_bytes_ = 0;
+  BudgetExceededCallback budget_exceeded_callback_;
+
+  void DeleteTexture(Entry& entry);
+
+  void EvictOverLimit(size_t limit_bytes);
+
+  void TraceStatsToTimeline() const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(SnapshotTexturePool);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_SNAPSHOT_TEXTURE_POOL_H_
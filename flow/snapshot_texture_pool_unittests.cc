@@ -0,0 +1,122 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/snapshot_texture_pool.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+SkImageInfo MakeImageInfo(int width, int height) {
+  return SkImageInfo::MakeN32Premul(width, height);
+}
+}  // namespace
+
+TEST(SnapshotTexturePool, ReusesReleasedTexturesOfTheSameSize) {
+  auto context = GrDirectContext::MakeMock(nullptr);
+  ASSERT_TRUE(context);
+  SnapshotTexturePool pool;
+
+  auto info = MakeImageInfo(100, 50);
+  GrBackendTexture first = pool.Acquire(context.get(), info);
+  ASSERT_TRUE(first.isValid());
+  EXPECT_EQ(pool.in_use_bytes(), info.computeMinByteSize());
+
+  ASSERT_TRUE(pool.Release(first));
+  EXPECT_EQ(pool.in_use_bytes(), 0u);
+  EXPECT_EQ(pool.pooled_bytes(), info.computeMinByteSize());
+  EXPECT_EQ(pool.pooled_count(), 1u);
+
+  // Other sizes do not match the pooled texture.
+  GrBackendTexture other = pool.Acquire(context.get(), MakeImageInfo(50, 100));
+  ASSERT_TRUE(other.isValid());
+  EXPECT_FALSE(other.isSameTexture(first));
+  EXPECT_EQ(pool.pooled_count(), 1u);
+
+  GrBackendTexture second = pool.Acquire(context.get(), info);
+  EXPECT_TRUE(second.isSameTexture(first));
+  EXPECT_EQ(pool.pooled_count(), 0u);
+
+  ASSERT_TRUE(pool.Release(second));
+  ASSERT_TRUE(pool.Release(other));
+  // Textures can only be released once.
+  EXPECT_FALSE(pool.Release(first));
+  EXPECT_EQ(pool.Purge(), info.computeMinByteSize() * 2);
+  EXPECT_EQ(pool.pooled_count(), 0u);
+}
+
+TEST(SnapshotTexturePool, EvictsLeastRecentlyReleasedTexturesOverTheLimit) {
+  auto context = GrDirectContext::MakeMock(nullptr);
+  ASSERT_TRUE(context);
+  auto info = MakeImageInfo(10, 10);
+  const size_t texture_bytes = info.computeMinByteSize();
+  SnapshotTexturePool pool(texture_bytes * 2);
+
+  std::vector<GrBackendTexture> textures;
+  for (int i = 0; i < 3; i++) {
+    textures.push_back(pool.Acquire(context.get(), info));
+    ASSERT_TRUE(textures.back().isValid());
+  }
+  for (const auto& texture : textures) {
+    ASSERT_TRUE(pool.Release(texture));
+  }
+  EXPECT_EQ(pool.pooled_count(), 2u);
+  EXPECT_EQ(pool.pooled_bytes(), texture_bytes * 2);
+
+  // The most recently released texture is handed out first.
+  EXPECT_TRUE(pool.Acquire(context.get(), info).isSameTexture(textures[2]));
+  EXPECT_TRUE(pool.Acquire(context.get(), info).isSameTexture(textures[1]));
+  EXPECT_FALSE(pool.Acquire(context.get(), info).isSameTexture(textures[0]));
+}
+
+TEST(SnapshotTexturePool, ReportsWhenTexturesInUseExceedTheBudget) {
+  auto context = GrDirectContext::MakeMock(nullptr);
+  ASSERT_TRUE(context);
+  auto info = MakeImageInfo(10, 10);
+  const size_t texture_bytes = info.computeMinByteSize();
+  SnapshotTexturePool pool;
+
+  std::vector<size_t> reports;
+  pool.SetBudget(texture_bytes, [&reports](size_t in_use_bytes) {
+    reports.push_back(in_use_bytes);
+  });
+
+  GrBackendTexture first = pool.Acquire(context.get(), info);
+  EXPECT_TRUE(reports.empty());
+  GrBackendTexture second = pool.Acquire(context.get(), info);
+  GrBackendTexture third = pool.Acquire(context.get(), info);
+  // Only crossing the budget is reported.
+  EXPECT_EQ(reports, std::vector<size_t>({texture_bytes * 2}));
+
+  ASSERT_TRUE(pool.Release(second));
+  ASSERT_TRUE(pool.Release(third));
+  second = pool.Acquire(context.get(), info);
+  EXPECT_EQ(reports,
+            std::vector<size_t>({texture_bytes * 2, texture_bytes * 2}));
+}
+
+TEST(SnapshotTexturePool, ForgetsTexturesOfADestroyedContext) {
+  auto context = GrDirectContext::MakeMock(nullptr);
+  ASSERT_TRUE(context);
+  SnapshotTexturePool pool;
+
+  auto info = MakeImageInfo(10, 10);
+  GrBackendTexture pooled = pool.Acquire(context.get(), info);
+  GrBackendTexture in_use = pool.Acquire(context.get(), info);
+  ASSERT_TRUE(pool.Release(pooled));
+
+  pool.OnGrContextDestroyed();
+  EXPECT_EQ(pool.pooled_count(), 0u);
+  EXPECT_EQ(pool.in_use_bytes(), 0u);
+  // The caller deletes the textures that were in use.
+  EXPECT_FALSE(pool.Release(in_use));
+  context->deleteBackendTexture(in_use);
+}
+
+}  // namespace testing
+}  // namespace flutter
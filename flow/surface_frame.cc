@@ -62,11 +62,15 @@ bool SurfaceFrame::PerformSubmit() {
     return false;
   }
 
-  if (submit_callback_(*this, SkiaCanvas())) {
-    return true;
+  if (!submit_callback_(*this, SkiaCanvas())) {
+    return false;
+  }
+
+  if (present_callback_) {
+    return TakePresentCallback()();
   }
 
-  return false;
+  return true;
 }
 
 sk_sp<DisplayListBuilder> SurfaceFrame::GetDisplayListBuilder() {
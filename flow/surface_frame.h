@@ -5,8 +5,11 @@
 #ifndef FLUTTER_FLOW_SURFACE_FRAME_H_
 #define FLUTTER_FLOW_SURFACE_FRAME_H_
 
+#include <functional>
 #include <memory>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "flutter/common/graphics/gl_context_switch.h"
 #include "flutter/display_list/display_list_canvas_recorder.h"
@@ -24,6 +27,10 @@ class SurfaceFrame {
   using SubmitCallback =
       std::function<bool(SurfaceFrame& surface_frame, SkCanvas* canvas)>;
 
+  // Presents the frame once its submit callback has encoded it. Called from
+  // any thread, see |TakePresentCallback|.
+  using PresentCallback = std::function<bool()>;
+
   // Information about the underlying framebuffer
   struct FramebufferInfo {
     // Indicates whether or not the surface supports pixel readback as used in
@@ -75,9 +82,19 @@ class SurfaceFrame {
     // Corresponds to EGL_KHR_partial_update
     std::optional<SkIRect> buffer_damage;
 
+    // Disjoint rects that cover the changed parts of frame_damage and
+    // buffer_damage, which are their bounds. Empty when the respective damage
+    // is not set.
+    std::vector<SkIRect> frame_damage_rects;
+    std::vector<SkIRect> buffer_damage_rects;
+
     // Time at which this frame is scheduled to be presented. This is a hint
     // that can be passed to the platform to drop queued frames.
     std::optional<fml::TimePoint> presentation_time;
+
+    // The number that the |FrameTimingsRecorder| of this frame assigned to
+    // it, or zero if the frame is not numbered.
+    uint64_t frame_number = 0;
   };
 
   bool Submit();
@@ -95,6 +112,21 @@ class SurfaceFrame {
   }
   const SubmitInfo& submit_info() const { return submit_info_; }
 
+  // Surfaces whose presentation may block, but does not need to run on the
+  // raster thread, split it out of their submit callback. By default the
+  // frame is still presented by |Submit|.
+  void set_present_callback(PresentCallback present_callback) {
+    present_callback_ = std::move(present_callback);
+  }
+
+  // Takes over presenting the frame. |Submit| then only encodes the frame,
+  // and the caller is responsible for invoking the returned callback after
+  // the frame has been submitted successfully. Returns nullptr if the frame
+  // is presented by its submit callback.
+  PresentCallback TakePresentCallback() {
+    return std::exchange(present_callback_, nullptr);
+  }
+
   sk_sp<DisplayListBuilder> GetDisplayListBuilder();
 
   sk_sp<DisplayList> BuildDisplayList();
@@ -108,6 +140,7 @@ class SurfaceFrame {
   FramebufferInfo framebuffer_info_;
   SubmitInfo submit_info_;
   SubmitCallback submit_callback_;
+  PresentCallback present_callback_;
   std::unique_ptr<GLContextResult> context_result_;
 
   bool PerformSubmit();
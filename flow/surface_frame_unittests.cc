@@ -5,6 +5,10 @@
 #define FML_USED_ON_EMBEDDER
 
 #include "flutter/flow/surface_frame.h"
+
+#include <string>
+#include <vector>
+
 #include "flutter/testing/testing.h"
 
 namespace flutter {
@@ -35,4 +39,43 @@ TEST(FlowTest, SurfaceFrameDoesNotHaveEmptyCanvas) {
       frame.SkiaCanvas()->quickReject(SkRect::MakeLTRB(10, 10, 50, 50)));
 }
 
+TEST(FlowTest, SurfaceFramePresentsAfterSubmitting) {
+  std::vector<std::string> calls;
+  SurfaceFrame frame(
+      /*surface=*/nullptr, SurfaceFrame::FramebufferInfo(),
+      /*submit_callback=*/
+      [&calls](const SurfaceFrame&, SkCanvas*) {
+        calls.push_back("submit");
+        return true;
+      },
+      SkISize::Make(800, 600));
+  frame.set_present_callback([&calls]() {
+    calls.push_back("present");
+    return true;
+  });
+
+  EXPECT_TRUE(frame.Submit());
+  EXPECT_EQ(calls, std::vector<std::string>({"submit", "present"}));
+}
+
+TEST(FlowTest, SurfaceFrameDoesNotPresentTakenPresentCallback) {
+  bool presented = false;
+  SurfaceFrame frame(
+      /*surface=*/nullptr, SurfaceFrame::FramebufferInfo(),
+      /*submit_callback=*/[](const SurfaceFrame&, SkCanvas*) { return true; },
+      SkISize::Make(800, 600));
+  frame.set_present_callback([&presented]() {
+    presented = true;
+    return true;
+  });
+
+  SurfaceFrame::PresentCallback present = frame.TakePresentCallback();
+  ASSERT_TRUE(present);
+  EXPECT_FALSE(frame.TakePresentCallback());
+  EXPECT_TRUE(frame.Submit());
+  EXPECT_FALSE(presented);
+  EXPECT_TRUE(present());
+  EXPECT_TRUE(presented);
+}
+
 }  // namespace flutter
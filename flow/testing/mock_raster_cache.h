@@ -33,6 +33,9 @@ class MockRasterCacheResult : public RasterCacheResult {
 
   void draw(SkCanvas& canvas, const SkPaint* paint = nullptr) const override{};
 
+  void draw(DisplayListBuilder& builder,
+            const SkPaint* paint = nullptr) const override{};
+
   SkISize image_dimensions() const override {
     return SkSize::Make(device_rect_.width(), device_rect_.height()).toCeil();
   };
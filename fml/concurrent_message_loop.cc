@@ -19,16 +19,17 @@ std::shared_ptr<ConcurrentMessageLoop> ConcurrentMessageLoop::Create(
 
 ConcurrentMessageLoop::ConcurrentMessageLoop(size_t worker_count)
     : worker_count_(std::max<size_t>(worker_count, 1ul)) {
+  for (size_t i = 0; i < worker_count_; ++i) {
+    worker_queues_.emplace_back(std::make_unique<WorkerQueue>());
+  }
+
   for (size_t i = 0; i < worker_count_; ++i) {
     workers_.emplace_back([i, this]() {
-      fml::Thread::SetCurrentThreadName(fml::Thread::ThreadConfig(
+      fml::Thread::SetCurrentThreadConfig(fml::Thread::ThreadConfig(
           std::string{"io.worker." + std::to_string(i + 1)}));
-      WorkerMain();
+      WorkerMain(i);
     });
-  }
-
-  for (const auto& worker : workers_) {
-    worker_thread_ids_.emplace_back(worker.get_id());
+    worker_indices_[workers_.back().get_id()] = i;
   }
 }
 
@@ -47,105 +48,153 @@ std::shared_ptr<ConcurrentTaskRunner> ConcurrentMessageLoop::GetTaskRunner() {
   return std::make_shared<ConcurrentTaskRunner>(weak_from_this());
 }
 
-void ConcurrentMessageLoop::PostTask(const fml::closure& task) {
+void ConcurrentMessageLoop::PostTask(const fml::closure& task,
+                                     ConcurrentTaskPriority priority) {
   if (!task) {
     return;
   }
 
-  std::unique_lock lock(tasks_mutex_);
-
   // Don't just drop tasks on the floor in case of shutdown.
   if (shutdown_) {
     FML_DLOG(WARNING)
         << "Tried to post a task to shutdown concurrent message "
            "loop. The task will be executed on the callers thread.";
-    lock.unlock();
     task();
     return;
   }
 
-  tasks_.push(task);
+  // Workers queue the tasks that they post themselves, which keeps the data
+  // of related tasks on the same core unless another worker is idle.
+  size_t worker_index;
+  auto found = worker_indices_.find(std::this_thread::get_id());
+  if (found != worker_indices_.end()) {
+    worker_index = found->second;
+  } else {
+    worker_index = next_worker_++ % worker_count_;
+  }
 
-  // Unlock the mutex before notifying the condition variable because that mutex
-  // has to be acquired on the other thread anyway. Waiting in this scope till
-  // it is acquired there is a pessimization.
-  lock.unlock();
+  size_t priority_index = static_cast<size_t>(priority);
+  {
+    WorkerQueue& queue = *worker_queues_[worker_index];
+    std::scoped_lock lock(queue.mutex);
+    queue.tasks[priority_index].push_back(task);
+  }
+  pending_tasks_[priority_index]++;
 
-  tasks_condition_.notify_one();
+  WakeUpWorkers(false);
 }
 
-void ConcurrentMessageLoop::WorkerMain() {
+void ConcurrentMessageLoop::WorkerMain(size_t worker_index) {
+  WorkerQueue& queue = *worker_queues_[worker_index];
   while (true) {
-    std::unique_lock lock(tasks_mutex_);
-    tasks_condition_.wait(lock, [&]() {
-      return !tasks_.empty() || shutdown_ || HasThreadTasksLocked();
-    });
+    RunThreadTasks(queue);
 
-    // Shutdown cannot be read with the task mutex unlocked.
-    bool shutdown_now = shutdown_;
-    fml::closure task;
-    std::vector<fml::closure> thread_tasks;
-
-    if (!tasks_.empty()) {
-      task = tasks_.front();
-      tasks_.pop();
+    if (shutdown_) {
+      break;
     }
 
-    if (HasThreadTasksLocked()) {
-      thread_tasks = GetThreadTasksLocked();
-      FML_DCHECK(!HasThreadTasksLocked());
+    fml::closure task = PopTask(worker_index);
+    if (!task) {
+      WaitForTasks(queue);
+      continue;
     }
 
-    // Don't hold onto the mutex while tasks are being executed as they could
-    // themselves try to post more tasks to the message loop.
-    lock.unlock();
-
     TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
-    // Execute the primary task we woke up for.
-    if (task) {
-      task();
-    }
+    task();
+  }
+}
 
-    // Execute any thread tasks.
-    for (const auto& thread_task : thread_tasks) {
-      thread_task();
+fml::closure ConcurrentMessageLoop::PopTask(size_t worker_index) {
+  for (size_t priority_index = kPriorityCount; priority_index-- > 0;) {
+    if (pending_tasks_[priority_index] <= 0) {
+      continue;
     }
-
-    if (shutdown_now) {
-      break;
+    // Look at the own queue of the worker first, and then steal from the
+    // queues of the other workers.
+    for (size_t i = 0; i < worker_count_; i++) {
+      WorkerQueue& queue = *worker_queues_[(worker_index + i) % worker_count_];
+      std::scoped_lock lock(queue.mutex);
+      auto& tasks = queue.tasks[priority_index];
+      if (!tasks.empty()) {
+        fml::closure task = std::move(tasks.front());
+        tasks.pop_front();
+        pending_tasks_[priority_index]--;
+        return task;
+      }
     }
   }
+  return nullptr;
 }
 
-void ConcurrentMessageLoop::Terminate() {
-  std::scoped_lock lock(tasks_mutex_);
-  shutdown_ = true;
-  tasks_condition_.notify_all();
+bool ConcurrentMessageLoop::HasPendingTasks() const {
+  return std::any_of(std::begin(pending_tasks_), std::end(pending_tasks_),
+                     [](const auto& pending) { return pending > 0; });
 }
 
-void ConcurrentMessageLoop::PostTaskToAllWorkers(const fml::closure& task) {
-  if (!task) {
+void ConcurrentMessageLoop::RunThreadTasks(WorkerQueue& queue) {
+  if (!queue.has_thread_tasks) {
     return;
   }
 
-  std::scoped_lock lock(tasks_mutex_);
-  for (const auto& worker_thread_id : worker_thread_ids_) {
-    thread_tasks_[worker_thread_id].emplace_back(task);
+  std::vector<fml::closure> thread_tasks;
+  {
+    std::scoped_lock lock(queue.mutex);
+    std::swap(thread_tasks, queue.thread_tasks);
+    queue.has_thread_tasks = false;
+  }
+
+  for (const auto& thread_task : thread_tasks) {
+    thread_task();
   }
-  tasks_condition_.notify_all();
 }
 
-bool ConcurrentMessageLoop::HasThreadTasksLocked() const {
-  return thread_tasks_.count(std::this_thread::get_id()) > 0;
+void ConcurrentMessageLoop::WaitForTasks(const WorkerQueue& queue) {
+  std::unique_lock lock(sleep_mutex_);
+  // Posters only take the sleep mutex when there is a sleeping worker, so the
+  // count must be incremented before the pending tasks are checked.
+  sleeping_workers_++;
+  sleep_condition_.wait(lock, [&]() {
+    return shutdown_ || queue.has_thread_tasks || HasPendingTasks();
+  });
+  sleeping_workers_--;
 }
 
-std::vector<fml::closure> ConcurrentMessageLoop::GetThreadTasksLocked() {
-  auto found = thread_tasks_.find(std::this_thread::get_id());
-  FML_DCHECK(found != thread_tasks_.end());
-  std::vector<fml::closure> pending_tasks;
-  std::swap(pending_tasks, found->second);
-  thread_tasks_.erase(found);
-  return pending_tasks;
+void ConcurrentMessageLoop::WakeUpWorkers(bool all) {
+  if (sleeping_workers_ == 0) {
+    return;
+  }
+
+  // Acquire the mutex so that a worker that is about to sleep cannot miss
+  // the notification, but release it before notifying because it has to be
+  // acquired by the worker anyway.
+  { std::scoped_lock lock(sleep_mutex_); }
+
+  if (all) {
+    sleep_condition_.notify_all();
+  } else {
+    sleep_condition_.notify_one();
+  }
+}
+
+void ConcurrentMessageLoop::Terminate() {
+  {
+    std::scoped_lock lock(sleep_mutex_);
+    shutdown_ = true;
+  }
+  sleep_condition_.notify_all();
+}
+
+void ConcurrentMessageLoop::PostTaskToAllWorkers(const fml::closure& task) {
+  if (!task) {
+    return;
+  }
+
+  for (auto& queue : worker_queues_) {
+    std::scoped_lock lock(queue->mutex);
+    queue->thread_tasks.emplace_back(task);
+    queue->has_thread_tasks = true;
+  }
+  WakeUpWorkers(true);
 }
 
 ConcurrentTaskRunner::ConcurrentTaskRunner(
@@ -155,12 +204,18 @@ ConcurrentTaskRunner::ConcurrentTaskRunner(
 ConcurrentTaskRunner::~ConcurrentTaskRunner() = default;
 
 void ConcurrentTaskRunner::PostTask(const fml::closure& task) {
+  PostTaskWithPriority(task, ConcurrentTaskPriority::kNormal);
+}
+
+void ConcurrentTaskRunner::PostTaskWithPriority(
+    const fml::closure& task,
+    ConcurrentTaskPriority priority) {
   if (!task) {
     return;
   }
 
   if (auto loop = weak_loop_.lock()) {
-    loop->PostTask(task);
+    loop->PostTask(task, priority);
     return;
   }
 
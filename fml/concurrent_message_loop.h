@@ -5,10 +5,14 @@
 #ifndef FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 #define FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <map>
-#include <queue>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
@@ -18,6 +22,22 @@ namespace fml {
 
 class ConcurrentTaskRunner;
 
+/// The priority of a task posted to a |ConcurrentMessageLoop|. Workers run
+/// all pending tasks of a higher priority before those of a lower priority.
+enum class ConcurrentTaskPriority {
+  kLow,
+  kNormal,
+  kHigh,
+};
+
+/// A pool of worker threads that run the tasks posted to it in no particular
+/// order.
+///
+/// Each worker has its own queue of tasks. Tasks posted from a worker are
+/// queued on that worker, and tasks posted from other threads are spread
+/// over the workers. Workers that run out of tasks steal them from the queues
+/// of the other workers before going to sleep. Posting a task wakes up at
+/// most one sleeping worker.
 class ConcurrentMessageLoop
     : public std::enable_shared_from_this<ConcurrentMessageLoop> {
  public:
@@ -37,24 +57,44 @@ class ConcurrentMessageLoop
  private:
   friend ConcurrentTaskRunner;
 
+  static constexpr size_t kPriorityCount = 3;
+
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<fml::closure> tasks[kPriorityCount];
+    std::vector<fml::closure> thread_tasks;
+    std::atomic_bool has_thread_tasks = false;
+  };
+
   size_t worker_count_ = 0;
   std::vector<std::thread> workers_;
-  std::mutex tasks_mutex_;
-  std::condition_variable tasks_condition_;
-  std::queue<fml::closure> tasks_;
-  std::vector<std::thread::id> worker_thread_ids_;
-  std::map<std::thread::id, std::vector<fml::closure>> thread_tasks_;
-  bool shutdown_ = false;
+  std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+  // Only written before any task can be posted.
+  std::map<std::thread::id, size_t> worker_indices_;
+  // The number of tasks in the worker queues for each priority. This may
+  // briefly be negative while a task is being posted.
+  std::atomic<int64_t> pending_tasks_[kPriorityCount] = {};
+  std::atomic_size_t next_worker_ = 0;
+  std::atomic_size_t sleeping_workers_ = 0;
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_condition_;
+  std::atomic_bool shutdown_ = false;
 
   explicit ConcurrentMessageLoop(size_t worker_count);
 
-  void WorkerMain();
+  void WorkerMain(size_t worker_index);
 
-  void PostTask(const fml::closure& task);
+  void PostTask(const fml::closure& task, ConcurrentTaskPriority priority);
 
-  bool HasThreadTasksLocked() const;
+  fml::closure PopTask(size_t worker_index);
 
-  std::vector<fml::closure> GetThreadTasksLocked();
+  bool HasPendingTasks() const;
+
+  void RunThreadTasks(WorkerQueue& queue);
+
+  void WaitForTasks(const WorkerQueue& queue);
+
+  void WakeUpWorkers(bool all);
 
   FML_DISALLOW_COPY_AND_ASSIGN(ConcurrentMessageLoop);
 };
@@ -67,6 +107,11 @@ class ConcurrentTaskRunner : public BasicTaskRunner {
 
   void PostTask(const fml::closure& task) override;
 
+  /// Posts a task that is run before the pending tasks of lower priorities.
+  /// |PostTask| posts tasks of |ConcurrentTaskPriority::kNormal| priority.
+  void PostTaskWithPriority(const fml::closure& task,
+                            ConcurrentTaskPriority priority);
+
  private:
   friend ConcurrentMessageLoop;
 
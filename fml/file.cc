@@ -4,7 +4,13 @@
 
 #include "flutter/fml/file.h"
 
+#include <utility>
+
 #include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/post_task_and_reply.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/fml/unique_fd.h"
 
 namespace fml {
@@ -99,6 +105,44 @@ fml::UniqueFD OpenDirectoryReadOnly(const fml::UniqueFD& base_directory,
   return OpenDirectory(base_directory, path, false, FilePermission::kRead);
 }
 
+void ReadFileToMappingAsync(
+    BasicTaskRunner* io_runner,
+    std::shared_ptr<const fml::UniqueFD> base_directory,
+    std::string file_name,
+    fml::RefPtr<TaskRunner> reply_runner,
+    std::function<void(std::unique_ptr<Mapping>)> callback) {
+  FML_DCHECK(io_runner && base_directory && reply_runner && callback);
+  PostTaskAndReply(
+      io_runner,
+      [base_directory = std::move(base_directory),
+       file_name = std::move(file_name)]() -> std::unique_ptr<Mapping> {
+        TRACE_EVENT0("flutter", "ReadFileToMappingAsync");
+        return FileMapping::CreateReadOnly(*base_directory, file_name);
+      },
+      std::move(reply_runner), std::move(callback));
+}
+
+void WriteAtomicallyAsync(BasicTaskRunner* io_runner,
+                          std::shared_ptr<const fml::UniqueFD> base_directory,
+                          std::string file_name,
+                          std::unique_ptr<const Mapping> mapping,
+                          std::function<void(bool)> callback) {
+  FML_DCHECK(io_runner && base_directory && mapping);
+  io_runner->PostTask([base_directory = std::move(base_directory),
+                       file_name = std::move(file_name),
+                       mapping = std::shared_ptr<const Mapping>(
+                           std::move(mapping)),
+                       callback = std::move(callback)]() mutable {
+    TRACE_EVENT0("flutter", "WriteAtomicallyAsync");
+    bool success = WriteAtomically(*base_directory, file_name.c_str(),
+                                   *mapping);
+    mapping.reset();
+    if (callback) {
+      callback(success);
+    }
+  });
+}
+
 bool RemoveFilesInDirectory(const fml::UniqueFD& directory) {
   fml::FileVisitor recursive_cleanup = [&recursive_cleanup](
                                            const fml::UniqueFD& directory,
@@ -7,10 +7,12 @@
 
 #include <functional>
 #include <initializer_list>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/fml/unique_fd.h"
 
 #ifdef ERROR
@@ -19,7 +21,9 @@
 
 namespace fml {
 
+class BasicTaskRunner;
 class Mapping;
+class TaskRunner;
 
 enum class FilePermission {
   kRead,
@@ -90,6 +94,30 @@ bool WriteAtomically(const fml::UniqueFD& base_directory,
                      const char* file_name,
                      const Mapping& mapping);
 
+/// Maps the file at `file_name` relative to `base_directory` on `io_runner`
+/// and calls `callback` on `reply_runner` with the mapping, or with nullptr
+/// if the file could not be mapped. The contents of the file are not copied.
+///
+/// The callback is not called if either task runner is shut down before the
+/// read completes.
+void ReadFileToMappingAsync(
+    BasicTaskRunner* io_runner,
+    std::shared_ptr<const fml::UniqueFD> base_directory,
+    std::string file_name,
+    fml::RefPtr<TaskRunner> reply_runner,
+    std::function<void(std::unique_ptr<Mapping>)> callback);
+
+/// Calls `WriteAtomically` on `io_runner`. The contents of `mapping` are not
+/// copied and `mapping` is released on `io_runner` once the write completes.
+///
+/// The optional `callback` is called on `io_runner` with the result of the
+/// write.
+void WriteAtomicallyAsync(BasicTaskRunner* io_runner,
+                          std::shared_ptr<const fml::UniqueFD> base_directory,
+                          std::string file_name,
+                          std::unique_ptr<const Mapping> mapping,
+                          std::function<void(bool)> callback = nullptr);
+
 /// Signature of a callback on a file in `directory` with `filename` (relative
 /// to `directory`). The returned bool should be false if and only if further
 /// traversal should be stopped. For example, a file-search visitor may return
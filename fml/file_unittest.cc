@@ -10,6 +10,8 @@
 #include "flutter/fml/file.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/paths.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
 #include "flutter/fml/unique_fd.h"
 #include "gtest/gtest.h"
 
@@ -253,6 +255,55 @@ TEST(FileTest, AtomicWriteTest) {
   ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "precious_data"));
 }
 
+TEST(FileTest, AsyncWriteAndReadTest) {
+  fml::ScopedTemporaryDirectory dir;
+  auto dir_fd = std::make_shared<fml::UniqueFD>(fml::Duplicate(dir.fd().get()));
+  fml::Thread io_thread("io");
+  fml::Thread reply_thread("reply");
+  auto io_runner = io_thread.GetTaskRunner();
+  auto reply_runner = reply_thread.GetTaskRunner();
+
+  const std::string contents = "These are my contents.";
+  auto data = std::make_unique<fml::DataMapping>(
+      std::vector<uint8_t>{contents.begin(), contents.end()});
+
+  fml::AutoResetWaitableEvent latch;
+  bool written = false;
+  fml::WriteAtomicallyAsync(
+      io_runner.get(), dir_fd, "precious_data", std::move(data),
+      [&](bool success) {
+        ASSERT_TRUE(io_runner->RunsTasksOnCurrentThread());
+        written = success;
+        latch.Signal();
+      });
+  latch.Wait();
+  ASSERT_TRUE(written);
+
+  std::string read;
+  fml::ReadFileToMappingAsync(
+      io_runner.get(), dir_fd, "precious_data", reply_runner,
+      [&](std::unique_ptr<fml::Mapping> mapping) {
+        ASSERT_TRUE(reply_runner->RunsTasksOnCurrentThread());
+        ASSERT_TRUE(mapping);
+        read.assign(reinterpret_cast<const char*>(mapping->GetMapping()),
+                    mapping->GetSize());
+        latch.Signal();
+      });
+  latch.Wait();
+  ASSERT_EQ(read, contents);
+
+  bool missing_is_null = false;
+  fml::ReadFileToMappingAsync(io_runner.get(), dir_fd, "missing", reply_runner,
+                              [&](std::unique_ptr<fml::Mapping> mapping) {
+                                missing_is_null = mapping == nullptr;
+                                latch.Signal();
+                              });
+  latch.Wait();
+  ASSERT_TRUE(missing_is_null);
+
+  ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "precious_data"));
+}
+
 TEST(FileTest, IgnoreBaseDirWhenPathIsAbsolute) {
   fml::ScopedTemporaryDirectory dir;
 
@@ -326,6 +377,84 @@ TEST(FileTest, MappingDontNeedSafeTest) {
   ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "my_contents"));
 }
 
+TEST(FileTest, MappingCanBeAdvisedAndPrefetched) {
+  fml::ScopedTemporaryDirectory dir;
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "my_contents", true,
+                              fml::FilePermission::kReadWrite);
+    WriteStringToFile(file, std::string(100000, 'a'));
+  }
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "my_contents", false,
+                              fml::FilePermission::kRead);
+    fml::FileMapping mapping(file);
+    ASSERT_TRUE(mapping.IsValid());
+    ASSERT_TRUE(mapping.Prefetch());
+    ASSERT_TRUE(mapping.Prefetch(5000, 10000));
+    ASSERT_FALSE(mapping.Prefetch(100000));
+    ASSERT_FALSE(mapping.Prefetch(5000, 100000));
+#if !FML_OS_WIN
+    ASSERT_TRUE(mapping.Advise(fml::FileMapping::Advice::kSequential));
+    ASSERT_TRUE(mapping.Advise(fml::FileMapping::Advice::kRandom, 5000));
+    ASSERT_TRUE(mapping.Advise(fml::FileMapping::Advice::kDontNeed));
+#endif  // !FML_OS_WIN
+    // Advice never changes the contents of the mapping.
+    ASSERT_EQ(ReadStringFromFile(file), std::string(100000, 'a'));
+  }
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "my_contents", false,
+                              fml::FilePermission::kReadWrite);
+    fml::FileMapping mapping(file, {fml::FileMapping::Protection::kRead,
+                                    fml::FileMapping::Protection::kWrite});
+    ASSERT_TRUE(mapping.IsValid());
+    ASSERT_FALSE(mapping.Advise(fml::FileMapping::Advice::kDontNeed));
+  }
+  ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "my_contents"));
+}
+
+#if !FML_OS_WIN && !FML_OS_FUCHSIA
+TEST(FileTest, ResidentPagesOfMappingCanBePrefetched) {
+  fml::ScopedTemporaryDirectory dir;
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "my_contents", true,
+                              fml::FilePermission::kReadWrite);
+    WriteStringToFile(file, std::string(100000, 'a'));
+  }
+
+  auto file = fml::OpenFile(dir.fd(), "my_contents", false,
+                            fml::FilePermission::kRead);
+  fml::FileMapping mapping(file);
+  ASSERT_TRUE(mapping.IsValid());
+
+  // Touch every page of the mapping.
+  size_t sum = 0;
+  for (size_t i = 0; i < mapping.GetSize(); i++) {
+    sum += mapping.GetMapping()[i];
+  }
+  ASSERT_EQ(sum, 100000u * 'a');
+
+  auto resident_pages = fml::GetResidentPages(mapping);
+  ASSERT_TRUE(resident_pages.has_value());
+  ASSERT_FALSE(resident_pages->empty());
+  for (bool resident : resident_pages.value()) {
+    ASSERT_TRUE(resident);
+  }
+
+  ASSERT_TRUE(fml::PrefetchPages(mapping, resident_pages.value()));
+  // Pages past the end of the mapping are ignored.
+  ASSERT_TRUE(fml::PrefetchPages(
+      mapping, std::vector<bool>(resident_pages->size() + 10, true)));
+
+  fml::DataMapping empty(std::vector<uint8_t>{});
+  ASSERT_FALSE(fml::GetResidentPages(empty).has_value());
+  ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "my_contents"));
+}
+#endif  // !FML_OS_WIN && !FML_OS_FUCHSIA
+
 TEST(FileTest, FileTestsWork) {
   fml::ScopedTemporaryDirectory dir;
   ASSERT_TRUE(dir.fd().is_valid());
@@ -60,6 +60,9 @@ class ICUContext {
     auto file_mapping = std::make_unique<FileMapping>(fd, protection);
 
     if (file_mapping->GetSize() != 0) {
+      // Start reading the data in the background, so that the lookups made
+      // while the engine starts up don't block on disk reads.
+      file_mapping->Prefetch();
       mapping_ = std::move(file_mapping);
       return true;
     }
@@ -7,6 +7,7 @@
 
 #include <initializer_list>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -44,6 +45,23 @@ class FileMapping final : public Mapping {
     kExecute,
   };
 
+  /// How the pages of a mapping are going to be accessed.
+  enum class Advice {
+    // No particular order. This is the default for new mappings.
+    kNormal,
+    // In order from lower to higher offsets, so pages may be read ahead
+    // aggressively and dropped soon after they were accessed.
+    kSequential,
+    // In no particular order, so reading ahead is wasted.
+    kRandom,
+    // Soon, so pages should be read ahead now.
+    kWillNeed,
+    // Not for some time, so pages may be dropped and read again from the
+    // file if they are accessed. Rejected for mappings that are not
+    // |IsDontNeedSafe|.
+    kDontNeed,
+  };
+
   explicit FileMapping(const fml::UniqueFD& fd,
                        std::initializer_list<Protection> protection = {
                            Protection::kRead});
@@ -76,6 +94,36 @@ class FileMapping final : public Mapping {
 
   bool IsValid() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Tells the system how a range of the mapping is going to be
+  ///             accessed. This is only a hint and doesn't change the
+  ///             contents of the mapping.
+  ///
+  /// @param[in]  advice  How the range is going to be accessed.
+  /// @param[in]  offset  The offset in bytes of the range in the mapping.
+  /// @param[in]  length  The length in bytes of the range, or 0 for the rest
+  ///                     of the mapping.
+  ///
+  /// @return     Whether the system accepted the advice. False if the range
+  ///             is not within the mapping or the platform doesn't support
+  ///             the advice.
+  ///
+  bool Advise(Advice advice, size_t offset = 0, size_t length = 0) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Asks the system to read a range of the mapping into memory
+  ///             in the background, so that the first accesses to it don't
+  ///             block on disk reads.
+  ///
+  /// @param[in]  offset  The offset in bytes of the range in the mapping.
+  /// @param[in]  length  The length in bytes of the range, or 0 for the rest
+  ///                     of the mapping.
+  ///
+  /// @return     Whether the read was started. False if the range is not
+  ///             within the mapping or the platform doesn't support it.
+  ///
+  bool Prefetch(size_t offset = 0, size_t length = 0) const;
+
  private:
   bool valid_ = false;
   size_t size_ = 0;
@@ -214,6 +262,33 @@ class SymbolMapping final : public Mapping {
   FML_DISALLOW_COPY_AND_ASSIGN(SymbolMapping);
 };
 
+//------------------------------------------------------------------------------
+/// @brief      Determines which pages of the memory of a mapping are resident.
+///             For mappings of files these are the pages that have been read
+///             from the file since it was last evicted from the page cache.
+///
+/// @param[in]  mapping  The mapping. The first page is the one that contains
+///                      the first byte of the mapping, which need not be
+///                      page aligned.
+///
+/// @return     Whether each page is resident, or nullopt if the mapping is
+///             empty or the platform can't tell.
+///
+std::optional<std::vector<bool>> GetResidentPages(const Mapping& mapping);
+
+//------------------------------------------------------------------------------
+/// @brief      Asks the system to read pages of a mapping into memory in the
+///             background.
+///
+/// @param[in]  mapping  The mapping.
+/// @param[in]  pages    Which pages to read, as returned by |GetResidentPages|.
+///                      Pages past the end of the mapping are ignored.
+///
+/// @return     Whether the reads were started. False if the platform doesn't
+///             support prefetching.
+///
+bool PrefetchPages(const Mapping& mapping, const std::vector<bool>& pages);
+
 }  // namespace fml
 
 #endif  // FLUTTER_FML_MAPPING_H_
@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory/arena.h"
+
+#include <algorithm>
+
+#include "flutter/fml/logging.h"
+
+namespace fml {
+
+Arena::Arena(size_t block_size)
+    : block_size_(std::max<size_t>(block_size, 1)) {}
+
+Arena::~Arena() = default;
+
+void* Arena::Allocate(size_t size, size_t alignment) {
+  FML_DCHECK(alignment != 0 && (alignment & (alignment - 1)) == 0);
+  if (!blocks_.empty()) {
+    const Block& block = blocks_.back();
+    const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+    const uintptr_t aligned =
+        (base + offset_ + alignment - 1) & ~(uintptr_t{alignment} - 1);
+    const size_t offset = aligned - base;
+    if (offset + size <= block.size) {
+      offset_ = offset + size;
+      allocated_bytes_ += size;
+      return reinterpret_cast<void*>(aligned);
+    }
+  }
+
+  // The new block is large enough for the allocation at any alignment.
+  AddBlock(std::max(block_size_, size + alignment));
+  return Allocate(size, alignment);
+}
+
+void Arena::Reset() {
+  if (blocks_.size() > 1) {
+    // Merge the blocks so that the allocations of the next frame fit in a
+    // single block.
+    const size_t size = reserved_bytes_;
+    blocks_.clear();
+    reserved_bytes_ = 0;
+    AddBlock(size);
+  }
+  offset_ = 0;
+  allocated_bytes_ = 0;
+}
+
+void Arena::AddBlock(size_t size) {
+  // The blocks are not value initialized like std::make_unique would.
+  blocks_.push_back({std::unique_ptr<uint8_t[]>(new uint8_t[size]), size});
+  offset_ = 0;
+  reserved_bytes_ += size;
+}
+
+}  // namespace fml
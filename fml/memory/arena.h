@@ -0,0 +1,109 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_MEMORY_ARENA_H_
+#define FLUTTER_FML_MEMORY_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace fml {
+
+/// A monotonic allocator for objects that share a lifetime, such as the
+/// transient objects of a frame.
+///
+/// Allocations are carved out of large blocks and are never freed one by
+/// one. |Reset| releases all of them at once and keeps the memory of the
+/// blocks in a single block. An arena that is reset at the start of every
+/// frame stops allocating from the heap once it has grown to the size of a
+/// frame.
+///
+/// The arena does not run destructors, the owners of the objects must
+/// destroy them before the arena is reset. An arena must only be used by
+/// one thread at a time.
+class Arena {
+ public:
+  static constexpr size_t kDefaultBlockSize = 4096;
+
+  explicit Arena(size_t block_size = kDefaultBlockSize);
+
+  ~Arena();
+
+  /// Returns |size| bytes aligned to |alignment|, which must be a power of
+  /// two. The memory stays valid until the arena is reset or destroyed.
+  void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  /// Releases all the allocations of the arena.
+  void Reset();
+
+  /// The number of bytes handed out since the arena was last reset.
+  size_t allocated_bytes() const { return allocated_bytes_; }
+
+  /// The number of bytes of the blocks that the arena holds.
+  size_t reserved_bytes() const { return reserved_bytes_; }
+
+  /// The number of blocks that the arena holds.
+  size_t block_count() const { return blocks_.size(); }
+
+ private:
+  struct Block {
+    std::unique_ptr<uint8_t[]> data;
+    size_t size;
+  };
+
+  void AddBlock(size_t size);
+
+  const size_t block_size_;
+  std::vector<Block> blocks_;
+  // The offset of the first free byte in the last block.
+  size_t offset_ = 0;
+  size_t allocated_bytes_ = 0;
+  size_t reserved_bytes_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(Arena);
+};
+
+/// An allocator for standard containers and |std::allocate_shared| that
+/// allocates from an |Arena|. Deallocations are no-ops, the memory is
+/// reclaimed when the arena is reset.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena* arena) : arena_(arena) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other)  // NOLINT
+      : arena_(other.arena()) {}
+
+  T* allocate(size_t count) {
+    return static_cast<T*>(arena_->Allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* pointer, size_t count) {}
+
+  Arena* arena() const { return arena_; }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return arena_ == other.arena();
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return arena_ != other.arena();
+  }
+
+ private:
+  Arena* arena_;
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_MEMORY_ARENA_H_
@@ -0,0 +1,96 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/memory/arena.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace {
+
+TEST(ArenaTest, AllocationsAreAligned) {
+  Arena arena;
+  for (size_t alignment : {1, 2, 4, 8, 16, 64}) {
+    arena.Allocate(1, 1);
+    void* pointer = arena.Allocate(3, alignment);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % alignment, 0u);
+  }
+}
+
+TEST(ArenaTest, AllocationsDoNotOverlap) {
+  Arena arena(64);
+  std::vector<uint8_t*> pointers;
+  for (size_t i = 0; i < 100; i++) {
+    auto* pointer = static_cast<uint8_t*>(arena.Allocate(16, 1));
+    memset(pointer, static_cast<int>(i), 16);
+    pointers.push_back(pointer);
+  }
+  for (size_t i = 0; i < pointers.size(); i++) {
+    for (size_t j = 0; j < 16; j++) {
+      ASSERT_EQ(pointers[i][j], i);
+    }
+  }
+  EXPECT_EQ(arena.allocated_bytes(), 1600u);
+  EXPECT_GT(arena.block_count(), 1u);
+}
+
+TEST(ArenaTest, LargeAllocationsGetTheirOwnBlock) {
+  Arena arena(64);
+  void* pointer = arena.Allocate(1000);
+  ASSERT_NE(pointer, nullptr);
+  EXPECT_GE(arena.reserved_bytes(), 1000u);
+}
+
+TEST(ArenaTest, ResetMergesTheBlocks) {
+  Arena arena(64);
+  for (size_t i = 0; i < 10; i++) {
+    arena.Allocate(64, 1);
+  }
+  const size_t reserved_bytes = arena.reserved_bytes();
+  ASSERT_EQ(arena.block_count(), 10u);
+
+  arena.Reset();
+  EXPECT_EQ(arena.allocated_bytes(), 0u);
+  EXPECT_EQ(arena.block_count(), 1u);
+  EXPECT_EQ(arena.reserved_bytes(), reserved_bytes);
+
+  // The same allocations fit in the merged block.
+  for (size_t i = 0; i < 10; i++) {
+    arena.Allocate(64, 1);
+  }
+  EXPECT_EQ(arena.block_count(), 1u);
+}
+
+TEST(ArenaTest, AllocatorWorksWithContainers) {
+  Arena arena;
+  std::vector<int, ArenaAllocator<int>> values{ArenaAllocator<int>(&arena)};
+  for (int i = 0; i < 100; i++) {
+    values.push_back(i);
+  }
+  EXPECT_EQ(values[99], 99);
+  EXPECT_GE(arena.allocated_bytes(), 100 * sizeof(int));
+}
+
+TEST(ArenaTest, AllocatorWorksWithSharedPointers) {
+  Arena arena;
+  int destroyed = 0;
+  struct Tracker {
+    explicit Tracker(int* counter) : counter(counter) {}
+    ~Tracker() { ++*counter; }
+    int* counter;
+  };
+  {
+    auto tracker = std::allocate_shared<Tracker>(
+        ArenaAllocator<Tracker>(&arena), &destroyed);
+    EXPECT_GE(arena.allocated_bytes(), sizeof(Tracker));
+  }
+  EXPECT_EQ(destroyed, 1);
+}
+
+}  // namespace
+}  // namespace fml
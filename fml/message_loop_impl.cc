@@ -54,14 +54,15 @@ MessageLoopImpl::~MessageLoopImpl() {
 }
 
 void MessageLoopImpl::PostTask(const fml::closure& task,
-                               fml::TimePoint target_time) {
+                               fml::TimePoint target_time,
+                               fml::TaskSourceGrade task_source_grade) {
   FML_DCHECK(task != nullptr);
   if (terminated_) {
     // If the message loop has already been terminated, PostTask should destruct
     // |task| synchronously within this function.
     return;
   }
-  task_queue_->RegisterTask(queue_id_, task, target_time);
+  task_queue_->RegisterTask(queue_id_, task, target_time, task_source_grade);
 }
 
 void MessageLoopImpl::AddTaskObserver(intptr_t key,
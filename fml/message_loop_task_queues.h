@@ -46,6 +46,11 @@ class TaskQueueEntry {
 
   TaskQueueId created_for;
 
+  /// Guards the tasks, observers and wakeable of this TaskQueue and of the
+  /// TaskQueues that it owns. The TaskQueues that are subsumed are guarded by
+  /// the mutex of their owner instead.
+  std::mutex mutex;
+
   explicit TaskQueueEntry(TaskQueueId created_for);
 
  private:
@@ -61,6 +66,12 @@ enum class FlushType {
 /// fml::MessageLoops.
 ///
 /// This also wakes up the loop at the required times.
+///
+/// Each TaskQueue and the TaskQueues that it owns are guarded by their own
+/// lock, so that loops only contend with the threads that post to them. The
+/// set of TaskQueues and their merged state are guarded by a reader/writer
+/// lock that is only acquired exclusively to create, dispose, merge and
+/// unmerge TaskQueues.
 /// \see fml::MessageLoop
 /// \see fml::Wakeable
 class MessageLoopTaskQueues {
@@ -152,7 +163,11 @@ class MessageLoopTaskQueues {
 
   fml::TimePoint GetNextWakeTimeUnlocked(TaskQueueId queue_id) const;
 
-  mutable std::mutex queue_mutex_;
+  // Returns the mutex of the TaskQueue that owns |queue_id|, or of |queue_id|
+  // itself if it is not subsumed. The caller must hold |queue_meta_mutex_|.
+  std::mutex& GetQueueMutexUnlocked(TaskQueueId queue_id) const;
+
+  std::unique_ptr<fml::SharedMutex> queue_meta_mutex_;
   std::map<TaskQueueId, std::unique_ptr<TaskQueueEntry>> queue_entries_;
 
   size_t task_queue_id_counter_;
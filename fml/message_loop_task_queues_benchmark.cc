@@ -66,5 +66,116 @@ static void BM_RegisterAndGetTasks(benchmark::State& state) {  // NOLINT
 
 BENCHMARK(BM_RegisterAndGetTasks);
 
+// Drains |num_tasks| tasks from |queue_id| as they are posted.
+static void DrainTasks(MessageLoopTaskQueues* task_queues,
+                       TaskQueueId queue_id,
+                       int num_tasks) {
+  int num_invocations = 0;
+  while (num_invocations < num_tasks) {
+    fml::closure invocation =
+        task_queues->GetNextTaskToRun(queue_id, fml::TimePoint::Now());
+    if (invocation) {
+      num_invocations++;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+// Several threads post to each task queue while the thread that owns the
+// queue drains it, as the platform threads and the threads of several engines
+// do.
+static void BM_MultiProducerRegisterAndGetTasks(  // NOLINT
+    benchmark::State& state) {
+  auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
+  const int num_task_queues = state.range(0);
+  const int num_producers_per_queue = state.range(1);
+  const int num_tasks_per_producer = 100;
+
+  std::vector<TaskQueueId> queue_ids;
+  for (int i = 0; i < num_task_queues; i++) {
+    queue_ids.push_back(task_queues->CreateTaskQueue());
+  }
+
+  while (state.KeepRunning()) {
+    const fml::TimePoint past = fml::TimePoint::Now();
+    std::vector<std::thread> threads;
+    for (TaskQueueId queue_id : queue_ids) {
+      for (int i = 0; i < num_producers_per_queue; i++) {
+        threads.emplace_back([task_queues, queue_id, past]() {
+          for (int j = 0; j < num_tasks_per_producer; j++) {
+            task_queues->RegisterTask(
+                queue_id, [] {}, past);
+          }
+        });
+      }
+      threads.emplace_back([task_queues, queue_id, num_producers_per_queue]() {
+        DrainTasks(task_queues, queue_id,
+                   num_producers_per_queue * num_tasks_per_producer);
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  for (TaskQueueId queue_id : queue_ids) {
+    task_queues->Dispose(queue_id);
+  }
+}
+
+BENCHMARK(BM_MultiProducerRegisterAndGetTasks)
+    ->Args({1, 4})
+    ->Args({4, 1})
+    ->Args({4, 4})
+    ->Args({16, 1})
+    ->Args({16, 4})
+    ->UseRealTime();
+
+// Several threads post to both of two merged task queues while the thread of
+// the owner drains them.
+static void BM_MultiProducerMergedTaskQueues(  // NOLINT
+    benchmark::State& state) {
+  auto task_queues = fml::MessageLoopTaskQueues::GetInstance();
+  const int num_producers_per_queue = state.range(0);
+  const int num_tasks_per_producer = 100;
+
+  TaskQueueId owner = task_queues->CreateTaskQueue();
+  TaskQueueId subsumed = task_queues->CreateTaskQueue();
+  task_queues->Merge(owner, subsumed);
+
+  while (state.KeepRunning()) {
+    const fml::TimePoint past = fml::TimePoint::Now();
+    std::vector<std::thread> threads;
+    for (TaskQueueId queue_id : {owner, subsumed}) {
+      for (int i = 0; i < num_producers_per_queue; i++) {
+        threads.emplace_back([task_queues, queue_id, past]() {
+          for (int j = 0; j < num_tasks_per_producer; j++) {
+            task_queues->RegisterTask(
+                queue_id, [] {}, past);
+          }
+        });
+      }
+    }
+    threads.emplace_back([task_queues, owner, num_producers_per_queue]() {
+      DrainTasks(task_queues, owner,
+                 2 * num_producers_per_queue * num_tasks_per_producer);
+    });
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  task_queues->Unmerge(owner, subsumed);
+  task_queues->Dispose(owner);
+  task_queues->Dispose(subsumed);
+}
+
+BENCHMARK(BM_MultiProducerMergedTaskQueues)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
+
 }  // namespace benchmarking
 }  // namespace fml
@@ -80,6 +80,23 @@ TEST(MessageLoop, CanRunAndTerminate) {
   ASSERT_TRUE(terminated);
 }
 
+TEST(MessageLoop, TasksPostedWithGradeRunWithThatGrade) {
+  fml::TaskSourceGrade grade = fml::TaskSourceGrade::kUnspecified;
+  std::thread thread([&grade]() {
+    fml::MessageLoop::EnsureInitializedForCurrentThread();
+    auto& loop = fml::MessageLoop::GetCurrent();
+    loop.GetTaskRunner()->PostTaskWithGrade(
+        [&grade]() {
+          grade = fml::MessageLoopTaskQueues::GetCurrentTaskSourceGrade();
+          fml::MessageLoop::GetCurrent().Terminate();
+        },
+        fml::TaskSourceGrade::kUserInteraction);
+    loop.Run();
+  });
+  thread.join();
+  ASSERT_EQ(grade, fml::TaskSourceGrade::kUserInteraction);
+}
+
 TEST(MessageLoop, NonDelayedTasksAreRunInOrder) {
   const size_t count = 100;
   bool started = false;
@@ -339,3 +356,73 @@ TEST(MessageLoop, CanCreateConcurrentMessageLoop) {
   latch.Wait();
   ASSERT_GE(thread_ids.size(), 1u);
 }
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsHigherPriorityTasksFirst) {
+  auto loop = fml::ConcurrentMessageLoop::Create(1u);
+  auto task_runner = loop->GetTaskRunner();
+  fml::AutoResetWaitableEvent blocker;
+  task_runner->PostTask([&blocker]() { blocker.Wait(); });
+
+  fml::CountDownLatch latch(3);
+  std::mutex order_mutex;
+  std::vector<fml::ConcurrentTaskPriority> order;
+  for (auto priority :
+       {fml::ConcurrentTaskPriority::kLow, fml::ConcurrentTaskPriority::kNormal,
+        fml::ConcurrentTaskPriority::kHigh}) {
+    task_runner->PostTaskWithPriority(
+        [&, priority]() {
+          std::scoped_lock lock(order_mutex);
+          order.push_back(priority);
+          latch.CountDown();
+        },
+        priority);
+  }
+  blocker.Signal();
+  latch.Wait();
+  ASSERT_EQ(order, std::vector<fml::ConcurrentTaskPriority>(
+                       {fml::ConcurrentTaskPriority::kHigh,
+                        fml::ConcurrentTaskPriority::kNormal,
+                        fml::ConcurrentTaskPriority::kLow}));
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopWorkersStealTasks) {
+  auto loop = fml::ConcurrentMessageLoop::Create(2u);
+  auto task_runner = loop->GetTaskRunner();
+  const size_t kCount = 10;
+  fml::AutoResetWaitableEvent done;
+  fml::AutoResetWaitableEvent finished;
+  std::atomic_size_t stolen_count = 0;
+  bool timed_out = true;
+  task_runner->PostTask([&]() {
+    auto poster_id = std::this_thread::get_id();
+    // The tasks are queued on this worker, which is blocked until all of
+    // them ran, so the other worker has to steal them.
+    for (size_t i = 0; i < kCount; ++i) {
+      task_runner->PostTask([&, poster_id]() {
+        if (std::this_thread::get_id() != poster_id &&
+            ++stolen_count == kCount) {
+          done.Signal();
+        }
+      });
+    }
+    timed_out = done.WaitWithTimeout(fml::TimeDelta::FromSeconds(10));
+    finished.Signal();
+  });
+  finished.Wait();
+  ASSERT_FALSE(timed_out);
+  ASSERT_EQ(stolen_count, kCount);
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopRunsThreadTasksOnEveryWorker) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  fml::CountDownLatch latch(4);
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  loop->PostTaskToAllWorkers([&]() {
+    std::scoped_lock lock(thread_ids_mutex);
+    thread_ids.insert(std::this_thread::get_id());
+    latch.CountDown();
+  });
+  latch.Wait();
+  ASSERT_EQ(thread_ids.size(), 4u);
+}
@@ -0,0 +1,34 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <pthread.h>
+#include <pthread/qos.h>
+
+#include "flutter/fml/thread.h"
+
+namespace fml {
+
+// Darwin schedules threads by their quality of service class. Setting the
+// scheduling parameters of a thread directly would opt it out of the QoS
+// system.
+bool Thread::SetCurrentThreadPriority(ThreadPriority priority) {
+  qos_class_t qos_class = QOS_CLASS_DEFAULT;
+  switch (priority) {
+    case ThreadPriority::BACKGROUND:
+      // QOS_CLASS_BACKGROUND also throttles disk and network IO, which the
+      // engine threads should not be subject to.
+      qos_class = QOS_CLASS_UTILITY;
+      break;
+    case ThreadPriority::NORMAL:
+      qos_class = QOS_CLASS_DEFAULT;
+      break;
+    case ThreadPriority::DISPLAY:
+    case ThreadPriority::RASTER:
+      qos_class = QOS_CLASS_USER_INTERACTIVE;
+      break;
+  }
+  return ::pthread_set_qos_class_self_np(qos_class, 0) == 0;
+}
+
+}  // namespace fml
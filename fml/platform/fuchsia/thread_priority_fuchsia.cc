@@ -0,0 +1,15 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/thread.h"
+
+namespace fml {
+
+// Fuchsia assigns scheduler profiles to threads through the profile provider
+// service, which fml does not have access to.
+bool Thread::SetCurrentThreadPriority(ThreadPriority priority) {
+  return false;
+}
+
+}  // namespace fml
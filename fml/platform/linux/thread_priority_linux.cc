@@ -0,0 +1,35 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <sys/resource.h>
+
+#include "flutter/fml/thread.h"
+
+namespace fml {
+
+// Linux and Android schedule each thread with its own nice value, which
+// setpriority sets for the calling thread when given a pid of 0. Raising the
+// priority above the default requires privileges on desktop Linux, so that
+// usually fails outside of Android.
+bool Thread::SetCurrentThreadPriority(ThreadPriority priority) {
+  switch (priority) {
+    case ThreadPriority::BACKGROUND:
+      return ::setpriority(PRIO_PROCESS, 0, 10) == 0;
+    case ThreadPriority::NORMAL:
+      return ::setpriority(PRIO_PROCESS, 0, 0) == 0;
+    case ThreadPriority::DISPLAY:
+      return ::setpriority(PRIO_PROCESS, 0, -1) == 0;
+    case ThreadPriority::RASTER:
+      // Android describes -8 as "most important display threads, for
+      // compositing the screen and retrieving input events". Conservatively
+      // set the raster thread to slightly lower priority than it. Depending
+      // on the OEM, it may not be possible to set the priority to -5, so fall
+      // back to -2.
+      return ::setpriority(PRIO_PROCESS, 0, -5) == 0 ||
+             ::setpriority(PRIO_PROCESS, 0, -2) == 0;
+  }
+  return false;
+}
+
+}  // namespace fml
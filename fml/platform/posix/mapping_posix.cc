@@ -9,7 +9,9 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <type_traits>
+#include <utility>
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/eintr_wrapper.h"
@@ -107,4 +109,111 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+static int ToPosixAdvice(FileMapping::Advice advice) {
+  switch (advice) {
+    case FileMapping::Advice::kNormal:
+      return MADV_NORMAL;
+    case FileMapping::Advice::kSequential:
+      return MADV_SEQUENTIAL;
+    case FileMapping::Advice::kRandom:
+      return MADV_RANDOM;
+    case FileMapping::Advice::kWillNeed:
+      return MADV_WILLNEED;
+    case FileMapping::Advice::kDontNeed:
+      return MADV_DONTNEED;
+  }
+  return MADV_NORMAL;
+}
+
+bool FileMapping::Advise(Advice advice, size_t offset, size_t length) const {
+  if (mapping_ == nullptr || offset >= size_ || length > size_ - offset) {
+    return false;
+  }
+  if (advice == Advice::kDontNeed && !IsDontNeedSafe()) {
+    return false;
+  }
+  if (length == 0) {
+    length = size_ - offset;
+  }
+
+  // The advice applies to whole pages, so the start of the range is rounded
+  // down to the page that contains it.
+  static const size_t kPageSize = ::sysconf(_SC_PAGESIZE);
+  size_t page_offset = offset - offset % kPageSize;
+  return ::madvise(mapping_ + page_offset, length + offset - page_offset,
+                   ToPosixAdvice(advice)) == 0;
+}
+
+bool FileMapping::Prefetch(size_t offset, size_t length) const {
+  // MADV_WILLNEED starts reading the pages into the page cache without
+  // waiting for the reads to complete.
+  return Advise(Advice::kWillNeed, offset, length);
+}
+
+// Returns the page aligned start and the length of the pages that contain
+// the memory of |mapping|.
+static std::pair<uint8_t*, size_t> GetPageRange(const Mapping& mapping) {
+  static const size_t kPageSize = ::sysconf(_SC_PAGESIZE);
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(mapping.GetMapping());
+  const uintptr_t page_begin = begin - begin % kPageSize;
+  return {reinterpret_cast<uint8_t*>(page_begin),
+          begin + mapping.GetSize() - page_begin};
+}
+
+std::optional<std::vector<bool>> GetResidentPages(const Mapping& mapping) {
+#if FML_OS_FUCHSIA
+  return std::nullopt;
+#else
+  if (mapping.GetMapping() == nullptr || mapping.GetSize() == 0) {
+    return std::nullopt;
+  }
+  static const size_t kPageSize = ::sysconf(_SC_PAGESIZE);
+  auto [start, length] = GetPageRange(mapping);
+  const size_t page_count = (length + kPageSize - 1) / kPageSize;
+#if FML_OS_MACOSX || FML_OS_IOS
+  std::vector<char> residency(page_count);
+#else
+  std::vector<unsigned char> residency(page_count);
+#endif
+  if (::mincore(start, length, residency.data()) != 0) {
+    return std::nullopt;
+  }
+  std::vector<bool> resident_pages(page_count);
+  for (size_t i = 0; i < page_count; i++) {
+    resident_pages[i] = residency[i] & 1;
+  }
+  return resident_pages;
+#endif  // FML_OS_FUCHSIA
+}
+
+bool PrefetchPages(const Mapping& mapping, const std::vector<bool>& pages) {
+  if (mapping.GetMapping() == nullptr || mapping.GetSize() == 0) {
+    return false;
+  }
+  static const size_t kPageSize = ::sysconf(_SC_PAGESIZE);
+  auto [start, length] = GetPageRange(mapping);
+  const size_t page_count =
+      std::min(pages.size(), (length + kPageSize - 1) / kPageSize);
+  // Runs of pages are advised together to keep the number of system calls
+  // down.
+  size_t page = 0;
+  while (page < page_count) {
+    if (!pages[page]) {
+      page++;
+      continue;
+    }
+    const size_t run_start = page;
+    while (page < page_count && pages[page]) {
+      page++;
+    }
+    const size_t offset = run_start * kPageSize;
+    const size_t run_length =
+        std::min((page - run_start) * kPageSize, length - offset);
+    if (::madvise(start + offset, run_length, MADV_WILLNEED) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace fml
@@ -123,4 +123,41 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::Advise(Advice advice, size_t offset, size_t length) const {
+  // Windows has no equivalent of the other advice for views of files.
+  if (advice == Advice::kWillNeed) {
+    return Prefetch(offset, length);
+  }
+  return false;
+}
+
+bool FileMapping::Prefetch(size_t offset, size_t length) const {
+  if (mapping_ == nullptr || offset >= size_ || length > size_ - offset) {
+    return false;
+  }
+  if (length == 0) {
+    length = size_ - offset;
+  }
+
+  WIN32_MEMORY_RANGE_ENTRY range;
+  range.VirtualAddress = mapping_ + offset;
+  range.NumberOfBytes = length;
+  if (!::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0)) {
+    FML_DLOG(ERROR) << "Could not prefetch file mapping. "
+                    << GetLastErrorMessage();
+    return false;
+  }
+  return true;
+}
+
+std::optional<std::vector<bool>> GetResidentPages(const Mapping& mapping) {
+  // Windows only reports the residency of pages in the working set of the
+  // process, which says little about what would have to be read from disk.
+  return std::nullopt;
+}
+
+bool PrefetchPages(const Mapping& mapping, const std::vector<bool>& pages) {
+  return false;
+}
+
 }  // namespace fml
@@ -0,0 +1,28 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <windows.h>
+
+#include "flutter/fml/thread.h"
+
+namespace fml {
+
+bool Thread::SetCurrentThreadPriority(ThreadPriority priority) {
+  int thread_priority = THREAD_PRIORITY_NORMAL;
+  switch (priority) {
+    case ThreadPriority::BACKGROUND:
+      thread_priority = THREAD_PRIORITY_BELOW_NORMAL;
+      break;
+    case ThreadPriority::NORMAL:
+      thread_priority = THREAD_PRIORITY_NORMAL;
+      break;
+    case ThreadPriority::DISPLAY:
+    case ThreadPriority::RASTER:
+      thread_priority = THREAD_PRIORITY_ABOVE_NORMAL;
+      break;
+  }
+  return ::SetThreadPriority(::GetCurrentThread(), thread_priority) != 0;
+}
+
+}  // namespace fml
@@ -0,0 +1,97 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_POST_TASK_AND_REPLY_H_
+#define FLUTTER_FML_POST_TASK_AND_REPLY_H_
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/fml/task_runner.h"
+
+namespace fml {
+namespace internal {
+
+// The state of a task and its reply as they hop between task runners. The
+// task and the reply are collected on the threads they run on.
+template <typename Task, typename Reply>
+class TaskAndReplyRelay {
+ public:
+  using Result = std::invoke_result_t<Task>;
+
+  TaskAndReplyRelay(Task task,
+                    fml::RefPtr<TaskRunner> reply_runner,
+                    Reply reply)
+      : task_(std::move(task)),
+        reply_runner_(std::move(reply_runner)),
+        reply_(std::move(reply)) {}
+
+  void RunTask() {
+    if constexpr (std::is_void_v<Result>) {
+      (*task_)();
+    } else {
+      result_.emplace((*task_)());
+    }
+    task_.reset();
+  }
+
+  void RunReply() {
+    if constexpr (std::is_void_v<Result>) {
+      (*reply_)();
+    } else {
+      (*reply_)(std::move(*result_));
+      result_.reset();
+    }
+    reply_.reset();
+  }
+
+  const fml::RefPtr<TaskRunner>& reply_runner() const { return reply_runner_; }
+
+ private:
+  struct Empty {};
+  using ResultStorage =
+      std::conditional_t<std::is_void_v<Result>, Empty, std::optional<Result>>;
+
+  std::optional<Task> task_;
+  fml::RefPtr<TaskRunner> reply_runner_;
+  std::optional<Reply> reply_;
+  ResultStorage result_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TaskAndReplyRelay);
+};
+
+}  // namespace internal
+
+/// Runs |task| on |task_runner| and then |reply| on |reply_runner|. If |task|
+/// returns a value, it is moved into |reply|.
+///
+/// This replaces a |PostTask| nested in another |PostTask|. The task and the
+/// reply may be move-only without wrapping them in |fml::MakeCopyable|, and
+/// they share a single allocation across both hops. The task is collected on
+/// the task runner after it runs and the reply on the reply runner, which
+/// matters for replies that capture objects that must only be collected on
+/// the UI thread.
+///
+/// If either task runner drops its task without running it, for example
+/// because its thread is shutting down, the reply is never run.
+template <typename Task, typename Reply>
+void PostTaskAndReply(BasicTaskRunner* task_runner,
+                      Task task,
+                      fml::RefPtr<TaskRunner> reply_runner,
+                      Reply reply) {
+  auto relay = std::make_shared<internal::TaskAndReplyRelay<Task, Reply>>(
+      std::move(task), std::move(reply_runner), std::move(reply));
+  task_runner->PostTask([relay]() {
+    relay->RunTask();
+    relay->reply_runner()->PostTask([relay]() { relay->RunReply(); });
+  });
+}
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_POST_TASK_AND_REPLY_H_
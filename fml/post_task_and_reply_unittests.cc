@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#define FML_USED_ON_EMBEDDER
+
+#include "flutter/fml/post_task_and_reply.h"
+
+#include <functional>
+#include <memory>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace testing {
+
+namespace {
+
+// Runs a callback when it is collected.
+class OnCollect {
+ public:
+  explicit OnCollect(std::function<void()> callback)
+      : callback_(std::move(callback)) {}
+
+  ~OnCollect() { callback_(); }
+
+ private:
+  std::function<void()> callback_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(OnCollect);
+};
+
+}  // namespace
+
+TEST(PostTaskAndReply, RepliesWithTheResultOfTheTask) {
+  Thread task_thread("task");
+  Thread reply_thread("reply");
+  auto task_runner = task_thread.GetTaskRunner();
+  auto reply_runner = reply_thread.GetTaskRunner();
+
+  AutoResetWaitableEvent latch;
+  auto value = std::make_unique<int>(42);
+  PostTaskAndReply(
+      task_runner.get(),
+      [task_runner, value = std::move(value)]() {
+        EXPECT_TRUE(task_runner->RunsTasksOnCurrentThread());
+        return std::make_unique<int>(*value + 1);
+      },
+      reply_runner,
+      [&latch, reply_runner](std::unique_ptr<int> result) {
+        EXPECT_TRUE(reply_runner->RunsTasksOnCurrentThread());
+        EXPECT_EQ(*result, 43);
+        latch.Signal();
+      });
+  latch.Wait();
+}
+
+TEST(PostTaskAndReply, RepliesAfterTasksWithoutResults) {
+  auto loop = ConcurrentMessageLoop::Create(2);
+  Thread reply_thread("reply");
+  auto reply_runner = reply_thread.GetTaskRunner();
+
+  AutoResetWaitableEvent latch;
+  bool task_ran = false;
+  PostTaskAndReply(
+      loop->GetTaskRunner().get(), [&task_ran]() { task_ran = true; },
+      reply_runner,
+      [&latch, &task_ran, reply_runner]() {
+        EXPECT_TRUE(reply_runner->RunsTasksOnCurrentThread());
+        EXPECT_TRUE(task_ran);
+        latch.Signal();
+      });
+  latch.Wait();
+}
+
+TEST(PostTaskAndReply, CollectsTheTaskAndReplyOnTheirTaskRunners) {
+  Thread task_thread("task");
+  Thread reply_thread("reply");
+  auto task_runner = task_thread.GetTaskRunner();
+  auto reply_runner = reply_thread.GetTaskRunner();
+
+  AutoResetWaitableEvent latch;
+  bool task_collected_on_task_runner = false;
+  bool reply_collected_on_reply_runner = false;
+  auto task_capture = std::make_unique<OnCollect>([&]() {
+    task_collected_on_task_runner = task_runner->RunsTasksOnCurrentThread();
+  });
+  auto reply_capture = std::make_unique<OnCollect>([&]() {
+    reply_collected_on_reply_runner = reply_runner->RunsTasksOnCurrentThread();
+    latch.Signal();
+  });
+  PostTaskAndReply(
+      task_runner.get(), [capture = std::move(task_capture)]() {}, reply_runner,
+      [capture = std::move(reply_capture)]() {});
+  latch.Wait();
+
+  EXPECT_TRUE(task_collected_on_task_runner);
+  EXPECT_TRUE(reply_collected_on_reply_runner);
+}
+
+}  // namespace testing
+}  // namespace fml
@@ -0,0 +1,172 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/synchronization/semaphore.h"
+#include "flutter/fml/synchronization/shared_mutex.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+
+namespace fml {
+namespace benchmarking {
+
+namespace {
+
+// Bounces a signal between the benchmark thread and a helper thread. Each
+// iteration measures the time it takes to wake the helper thread up and to be
+// woken up by it in turn.
+template <typename Event>
+void PingPong(benchmark::State& state,
+              Event& ping,
+              Event& pong,
+              const std::function<void(Event&)>& signal,
+              const std::function<void(Event&)>& wait) {
+  std::atomic_bool done = false;
+  std::thread thread([&]() {
+    while (true) {
+      wait(ping);
+      if (done) {
+        break;
+      }
+      signal(pong);
+    }
+  });
+  while (state.KeepRunning()) {
+    signal(ping);
+    wait(pong);
+  }
+  done = true;
+  signal(ping);
+  thread.join();
+}
+
+}  // namespace
+
+static void BM_AutoResetWaitableEventSignalAndWait(
+    benchmark::State& state) {  // NOLINT
+  AutoResetWaitableEvent event;
+  while (state.KeepRunning()) {
+    event.Signal();
+    event.Wait();
+  }
+}
+BENCHMARK(BM_AutoResetWaitableEventSignalAndWait);
+
+static void BM_AutoResetWaitableEventPingPong(
+    benchmark::State& state) {  // NOLINT
+  AutoResetWaitableEvent ping;
+  AutoResetWaitableEvent pong;
+  PingPong<AutoResetWaitableEvent>(
+      state, ping, pong, [](auto& event) { event.Signal(); },
+      [](auto& event) { event.Wait(); });
+}
+BENCHMARK(BM_AutoResetWaitableEventPingPong)->UseRealTime();
+
+static void BM_ManualResetWaitableEventSignalWaitAndReset(
+    benchmark::State& state) {  // NOLINT
+  ManualResetWaitableEvent event;
+  while (state.KeepRunning()) {
+    event.Signal();
+    event.Wait();
+    event.Reset();
+  }
+}
+BENCHMARK(BM_ManualResetWaitableEventSignalWaitAndReset);
+
+static void BM_SemaphoreSignalAndWait(benchmark::State& state) {  // NOLINT
+  Semaphore semaphore(0);
+  while (state.KeepRunning()) {
+    semaphore.Signal();
+    if (!semaphore.Wait()) {
+      state.SkipWithError("Could not wait for the semaphore.");
+      break;
+    }
+  }
+}
+BENCHMARK(BM_SemaphoreSignalAndWait);
+
+static void BM_SemaphorePingPong(benchmark::State& state) {  // NOLINT
+  Semaphore ping(0);
+  Semaphore pong(0);
+  PingPong<Semaphore>(
+      state, ping, pong, [](auto& semaphore) { semaphore.Signal(); },
+      [](auto& semaphore) { static_cast<void>(semaphore.Wait()); });
+}
+BENCHMARK(BM_SemaphorePingPong)->UseRealTime();
+
+static void BM_CountDownLatchFanIn(benchmark::State& state) {  // NOLINT
+  const size_t thread_count = state.range(0);
+  while (state.KeepRunning()) {
+    CountDownLatch latch(thread_count);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < thread_count; i++) {
+      threads.emplace_back([&latch]() { latch.CountDown(); });
+    }
+    latch.Wait();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+}
+BENCHMARK(BM_CountDownLatchFanIn)->Arg(1)->Arg(4)->Arg(8)->UseRealTime();
+
+static SharedMutex& GetSharedMutex() {
+  static SharedMutex* shared_mutex = SharedMutex::Create();
+  return *shared_mutex;
+}
+
+// Run with one thread, these measure the uncontended cost of the locks. With
+// more threads, all of them contend for the same mutex.
+static void BM_SharedMutexLock(benchmark::State& state) {  // NOLINT
+  while (state.KeepRunning()) {
+    UniqueLock lock(GetSharedMutex());
+  }
+}
+BENCHMARK(BM_SharedMutexLock)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_SharedMutexLockShared(benchmark::State& state) {  // NOLINT
+  while (state.KeepRunning()) {
+    SharedLock lock(GetSharedMutex());
+  }
+}
+BENCHMARK(BM_SharedMutexLockShared)->ThreadRange(1, 8)->UseRealTime();
+
+// A reader contending with a writer and with as many other readers as the
+// argument, which is how the task queues use their shared mutex.
+static void BM_SharedMutexReadersAndWriter(benchmark::State& state) {  // NOLINT
+  std::atomic_bool done = false;
+  std::vector<std::thread> threads;
+  threads.emplace_back([&done]() {
+    while (!done) {
+      UniqueLock lock(GetSharedMutex());
+    }
+  });
+  for (int64_t i = 0; i < state.range(0); i++) {
+    threads.emplace_back([&done]() {
+      while (!done) {
+        SharedLock lock(GetSharedMutex());
+      }
+    });
+  }
+  while (state.KeepRunning()) {
+    SharedLock lock(GetSharedMutex());
+  }
+  done = true;
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+BENCHMARK(BM_SharedMutexReadersAndWriter)
+    ->Arg(0)
+    ->Arg(3)
+    ->Arg(7)
+    ->UseRealTime();
+
+}  // namespace benchmarking
+}  // namespace fml
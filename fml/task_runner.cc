@@ -30,6 +30,17 @@ void TaskRunner::PostTaskForTime(const fml::closure& task,
   loop_->PostTask(task, target_time);
 }
 
+void TaskRunner::PostTaskWithGrade(const fml::closure& task,
+                                   TaskSourceGrade grade) {
+  if (!loop_) {
+    // Task runners that are not backed by a message loop dispatch their tasks
+    // elsewhere and only learn about grades if they override this.
+    PostTask(task);
+    return;
+  }
+  loop_->PostTask(task, fml::TimePoint::Now(), grade);
+}
+
 void TaskRunner::PostDelayedTask(const fml::closure& task,
                                  fml::TimeDelta delay) {
   loop_->PostTask(task, fml::TimePoint::Now() + delay);
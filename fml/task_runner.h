@@ -10,6 +10,7 @@
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/fml/message_loop_task_queues.h"
+#include "flutter/fml/task_source_grade.h"
 #include "flutter/fml/time/time_point.h"
 
 namespace fml {
@@ -41,6 +42,12 @@ class TaskRunner : public fml::RefCountedThreadSafe<TaskRunner>,
   virtual void PostTaskForTime(const fml::closure& task,
                                fml::TimePoint target_time);
 
+  /// Schedules \p task like \p PostTask, and tells the dispatcher how
+  /// important the task is, for example that a frame is waiting for it.
+  /// \see fml::TaskSourceGrade
+  virtual void PostTaskWithGrade(const fml::closure& task,
+                                 TaskSourceGrade grade);
+
   /// Schedules a task to be run on the MessageLoop after the time \p delay has
   /// passed.
   /// \note There is latency between when the task is schedule and actually
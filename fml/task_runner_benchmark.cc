@@ -0,0 +1,88 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#define FML_USED_ON_EMBEDDER
+
+#include "flutter/fml/task_runner.h"
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+
+namespace fml {
+namespace benchmarking {
+
+// The latency of posting a task to an idle thread and being signaled by it,
+// which is what every hop between the engine threads pays.
+static void BM_TaskRunnerPostTaskRoundTrip(benchmark::State& state) {  // NOLINT
+  Thread thread("round_trip");
+  auto task_runner = thread.GetTaskRunner();
+  AutoResetWaitableEvent event;
+  while (state.KeepRunning()) {
+    task_runner->PostTask([&event]() { event.Signal(); });
+    event.Wait();
+  }
+}
+BENCHMARK(BM_TaskRunnerPostTaskRoundTrip)->UseRealTime();
+
+// Bounces a task between two threads for as many hops as the argument.
+static void BM_TaskRunnerPingPong(benchmark::State& state) {  // NOLINT
+  Thread ping_thread("ping");
+  Thread pong_thread("pong");
+  auto ping_runner = ping_thread.GetTaskRunner();
+  auto pong_runner = pong_thread.GetTaskRunner();
+  AutoResetWaitableEvent event;
+  const int64_t hops = state.range(0);
+  std::function<void(int64_t)> ping = [&](int64_t remaining) {
+    if (remaining == 0) {
+      event.Signal();
+      return;
+    }
+    auto runner = remaining % 2 == 0 ? ping_runner : pong_runner;
+    runner->PostTask([&ping, remaining]() { ping(remaining - 1); });
+  };
+  while (state.KeepRunning()) {
+    ping(hops);
+    event.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * hops);
+}
+BENCHMARK(BM_TaskRunnerPingPong)->Arg(100)->UseRealTime();
+
+// The throughput of posting tasks to a busy thread.
+static void BM_TaskRunnerPostTaskThroughput(
+    benchmark::State& state) {  // NOLINT
+  Thread thread("throughput");
+  auto task_runner = thread.GetTaskRunner();
+  AutoResetWaitableEvent event;
+  const int64_t task_count = state.range(0);
+  while (state.KeepRunning()) {
+    for (int64_t i = 1; i < task_count; i++) {
+      task_runner->PostTask([]() {});
+    }
+    task_runner->PostTask([&event]() { event.Signal(); });
+    event.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * task_count);
+}
+BENCHMARK(BM_TaskRunnerPostTaskThroughput)->Arg(1000)->UseRealTime();
+
+static void BM_ConcurrentTaskRunnerPostTaskRoundTrip(
+    benchmark::State& state) {  // NOLINT
+  auto loop = ConcurrentMessageLoop::Create(state.range(0));
+  auto task_runner = loop->GetTaskRunner();
+  AutoResetWaitableEvent event;
+  while (state.KeepRunning()) {
+    task_runner->PostTask([&event]() { event.Signal(); });
+    event.Wait();
+  }
+}
+BENCHMARK(BM_ConcurrentTaskRunnerPostTaskRoundTrip)
+    ->Arg(1)
+    ->Arg(4)
+    ->UseRealTime();
+
+}  // namespace benchmarking
+}  // namespace fml
@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "flutter/fml/build_config.h"
+#include "flutter/fml/logging.h"
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 
@@ -22,6 +23,10 @@
 #include <pthread.h>
 #endif
 
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+#include <sched.h>
+#endif
+
 namespace fml {
 
 #if defined(FML_OS_WIN)
@@ -67,8 +72,40 @@ void Thread::SetCurrentThreadName(const Thread::ThreadConfig& config) {
   SetThreadName(config.name);
 }
 
+void Thread::SetCurrentThreadConfig(const Thread::ThreadConfig& config) {
+  SetThreadName(config.name);
+  if (!SetCurrentThreadPriority(config.priority)) {
+    FML_DLOG(WARNING) << "Could not set the priority of thread '"
+                      << config.name << "'.";
+  }
+}
+
+bool Thread::SetCurrentThreadAffinity(uint64_t cpu_affinity) {
+  if (cpu_affinity == 0) {
+    return false;
+  }
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (size_t cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; cpu++) {
+    if (cpu_affinity & (uint64_t{1} << cpu)) {
+      CPU_SET(cpu, &cpu_set);
+    }
+  }
+  // A pid of 0 refers to the calling thread.
+  return ::sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#elif defined(FML_OS_WIN)
+  return ::SetThreadAffinityMask(::GetCurrentThread(),
+                                 static_cast<DWORD_PTR>(cpu_affinity)) != 0;
+#else
+  // Darwin only supports affinity hints between threads and Fuchsia leaves
+  // the placement of threads to the scheduler.
+  return false;
+#endif
+}
+
 Thread::Thread(const std::string& name)
-    : Thread(Thread::SetCurrentThreadName, ThreadConfig(name)) {}
+    : Thread(Thread::SetCurrentThreadConfig, ThreadConfig(name)) {}
 
 Thread::Thread(const ThreadConfigSetter& setter, const ThreadConfig& config)
     : joined_(false) {
@@ -78,6 +115,11 @@ Thread::Thread(const ThreadConfigSetter& setter, const ThreadConfig& config)
   thread_ = std::make_unique<std::thread>(
       [&latch, &runner, setter, config]() -> void {
         setter(config);
+        if (config.cpu_affinity != 0 &&
+            !SetCurrentThreadAffinity(config.cpu_affinity)) {
+          FML_LOG(ERROR) << "Could not set the CPU affinity of thread '"
+                         << config.name << "'.";
+        }
         fml::MessageLoop::EnsureInitializedForCurrentThread();
         auto& loop = MessageLoop::GetCurrent();
         runner = loop.GetTaskRunner();
@@ -6,6 +6,7 @@
 #define FLUTTER_FML_THREAD_H_
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -42,6 +43,9 @@ class Thread {
 
     std::string name;
     ThreadPriority priority;
+    /// The bit mask of the CPUs the thread may run on, where bit N stands
+    /// for CPU N. 0 lets the thread run on any CPU.
+    uint64_t cpu_affinity = 0;
   };
 
   using ThreadConfigSetter = std::function<void(const ThreadConfig&)>;
@@ -59,6 +63,21 @@ class Thread {
 
   static void SetCurrentThreadName(const ThreadConfig& config);
 
+  /// Sets the name and the priority of the current thread from |config|.
+  /// This is the default |ThreadConfigSetter| of the engine threads.
+  static void SetCurrentThreadConfig(const ThreadConfig& config);
+
+  /// Applies |priority| to the current thread with the scheduling API of the
+  /// platform. Returns false if the priority could not be applied, which is
+  /// usually the case for priorities above |ThreadPriority::NORMAL| in
+  /// unprivileged processes on desktop platforms.
+  static bool SetCurrentThreadPriority(ThreadPriority priority);
+
+  /// Restricts the current thread to the CPUs in |cpu_affinity|, see
+  /// |ThreadConfig::cpu_affinity|. Returns false if the affinity could not
+  /// be set or if the platform does not support thread affinities.
+  static bool SetCurrentThreadAffinity(uint64_t cpu_affinity);
+
  private:
   std::unique_ptr<std::thread> thread_;
 
@@ -4,6 +4,8 @@
 
 #include "flutter/fml/thread.h"
 
+#include "flutter/fml/build_config.h"
+
 #if defined(FML_OS_MACOSX) || defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
 #define FLUTTER_PTHREAD_SUPPORTED 1
 #else
@@ -15,6 +17,11 @@
 #else
 #endif
 
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+#include <sched.h>
+#include <sys/resource.h>
+#endif
+
 #include <memory>
 #include "gtest/gtest.h"
 
@@ -45,15 +52,17 @@ TEST(Thread, ThreadNameCreatedWithConfig) {
   bool done = false;
   thread.GetTaskRunner()->PostTask([&done, &name]() {
     done = true;
-    char thread_name[8];
+    char thread_name[16];
     pthread_t current_thread = pthread_self();
-    pthread_getname_np(current_thread, thread_name, 8);
+    pthread_getname_np(current_thread, thread_name, 16);
     ASSERT_EQ(thread_name, name);
   });
   thread.Join();
   ASSERT_TRUE(done);
 }
 
+#if defined(FML_OS_MACOSX)
+// Linux only supports a static priority of 0 for SCHED_OTHER.
 static void MockThreadConfigSetter(const fml::Thread::ThreadConfig& config) {
   // set thread name
   fml::Thread::SetCurrentThreadName(config);
@@ -84,9 +93,9 @@ TEST(Thread, ThreadPriorityCreatedWithConfig) {
   int policy;
   thread.GetTaskRunner()->PostTask([&]() {
     done = true;
-    char thread_name[8];
+    char thread_name[16];
     pthread_t current_thread = pthread_self();
-    pthread_getname_np(current_thread, thread_name, 8);
+    pthread_getname_np(current_thread, thread_name, 16);
     pthread_getschedparam(current_thread, &policy, &param);
     ASSERT_EQ(thread_name, thread1_name);
     ASSERT_EQ(policy, SCHED_OTHER);
@@ -98,9 +107,9 @@ TEST(Thread, ThreadPriorityCreatedWithConfig) {
                           thread2_name, fml::Thread::ThreadPriority::DISPLAY));
   thread2.GetTaskRunner()->PostTask([&]() {
     done = true;
-    char thread_name[8];
+    char thread_name[16];
     pthread_t current_thread = pthread_self();
-    pthread_getname_np(current_thread, thread_name, 8);
+    pthread_getname_np(current_thread, thread_name, 16);
     pthread_getschedparam(current_thread, &policy, &param);
     ASSERT_EQ(thread_name, thread2_name);
     ASSERT_EQ(policy, SCHED_OTHER);
@@ -109,4 +118,40 @@ TEST(Thread, ThreadPriorityCreatedWithConfig) {
   thread.Join();
   ASSERT_TRUE(done);
 }
+#endif  // defined(FML_OS_MACOSX)
+#endif
+
+#if defined(FML_OS_LINUX) || defined(FML_OS_ANDROID)
+TEST(Thread, ThreadAffinityCreatedWithConfig) {
+  fml::Thread::ThreadConfig config("Thread1");
+  config.cpu_affinity = 1;
+  fml::Thread thread(fml::Thread::SetCurrentThreadName, config);
+
+  bool done = false;
+  thread.GetTaskRunner()->PostTask([&done]() {
+    done = true;
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set), &cpu_set), 0);
+    ASSERT_EQ(CPU_COUNT(&cpu_set), 1);
+    ASSERT_TRUE(CPU_ISSET(0, &cpu_set));
+  });
+  thread.Join();
+  ASSERT_TRUE(done);
+}
+
+TEST(Thread, ThreadConfigSetsThePriority) {
+  fml::Thread thread(fml::Thread::SetCurrentThreadConfig,
+                     fml::Thread::ThreadConfig(
+                         "Thread1", fml::Thread::ThreadPriority::BACKGROUND));
+
+  bool done = false;
+  thread.GetTaskRunner()->PostTask([&done]() {
+    done = true;
+    // A pid of 0 refers to the calling thread.
+    ASSERT_EQ(getpriority(PRIO_PROCESS, 0), 10);
+  });
+  thread.Join();
+  ASSERT_TRUE(done);
+}
 #endif
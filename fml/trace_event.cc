@@ -11,6 +11,7 @@
 #include "flutter/fml/ascii_trie.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_recorder.h"
 
 namespace fml {
 namespace tracing {
@@ -27,6 +28,21 @@ AsciiTrie gAllowlist;
 std::atomic<TimelineEventHandler> gTimelineEventHandler;
 std::atomic<TimelineMicrosSource> gTimelineMicrosSource = DefaultMicrosSource;
 
+inline void DispatchTimelineEvent(const char* label,
+                                  int64_t timestamp0,
+                                  int64_t timestamp1_or_async_id,
+                                  Dart_Timeline_Event_Type type,
+                                  intptr_t argument_count,
+                                  const char** argument_names,
+                                  const char** argument_values) {
+  TimelineEventHandler handler =
+      gTimelineEventHandler.load(std::memory_order_relaxed);
+  if (handler && gAllowlist.Query(label)) {
+    handler(label, timestamp0, timestamp1_or_async_id, type, argument_count,
+            argument_names, argument_values);
+  }
+}
+
 inline void FlutterTimelineEvent(const char* label,
                                  int64_t timestamp0,
                                  int64_t timestamp1_or_async_id,
@@ -34,12 +50,9 @@ inline void FlutterTimelineEvent(const char* label,
                                  intptr_t argument_count,
                                  const char** argument_names,
                                  const char** argument_values) {
-  TimelineEventHandler handler =
-      gTimelineEventHandler.load(std::memory_order_relaxed);
-  if (handler && gAllowlist.Query(label)) {
-    handler(label, timestamp0, timestamp1_or_async_id, type, argument_count,
-            argument_names, argument_values);
-  }
+  TraceRecorder::Record(type, label, timestamp1_or_async_id);
+  DispatchTimelineEvent(label, timestamp0, timestamp1_or_async_id, type,
+                        argument_count, argument_names, argument_values);
 }
 }  // namespace
 
@@ -85,7 +98,10 @@ void TraceTimelineEvent(TraceArg category_group,
     c_values[i] = values[i].c_str();
   }
 
-  FlutterTimelineEvent(
+  TraceRecorder::Record(type, name, identifier,
+                        TimePoint::FromEpochDelta(
+                            TimeDelta::FromMicroseconds(timestamp_micros)));
+  DispatchTimelineEvent(
       name,                                      // label
       timestamp_micros,                          // timestamp0
       identifier,                                // timestamp1_or_async_id
@@ -327,7 +343,8 @@ int64_t TraceGetTimelineMicros() {
 void TraceSetTimelineMicrosSource(TimelineMicrosSource source) {}
 
 size_t TraceNonce() {
-  return 0;
+  static std::atomic_size_t last_item;
+  return ++last_item;
 }
 
 void TraceTimelineEvent(TraceArg category_group,
@@ -336,79 +353,120 @@ void TraceTimelineEvent(TraceArg category_group,
                         TraceIDArg identifier,
                         Dart_Timeline_Event_Type type,
                         const std::vector<const char*>& c_names,
-                        const std::vector<std::string>& values) {}
+                        const std::vector<std::string>& values) {
+  TraceRecorder::Record(type, name, identifier,
+                        TimePoint::FromEpochDelta(
+                            TimeDelta::FromMicroseconds(timestamp_micros)));
+}
 
 void TraceTimelineEvent(TraceArg category_group,
                         TraceArg name,
                         TraceIDArg identifier,
                         Dart_Timeline_Event_Type type,
                         const std::vector<const char*>& c_names,
-                        const std::vector<std::string>& values) {}
+                        const std::vector<std::string>& values) {
+  TraceRecorder::Record(type, name, identifier);
+}
 
-void TraceEvent0(TraceArg category_group, TraceArg name) {}
+void TraceEvent0(TraceArg category_group, TraceArg name) {
+  TraceRecorder::Record(Dart_Timeline_Event_Begin, name, 0);
+}
 
 void TraceEvent1(TraceArg category_group,
                  TraceArg name,
                  TraceArg arg1_name,
-                 TraceArg arg1_val) {}
+                 TraceArg arg1_val) {
+  TraceRecorder::Record(Dart_Timeline_Event_Begin, name, 0);
+}
 
 void TraceEvent2(TraceArg category_group,
                  TraceArg name,
                  TraceArg arg1_name,
                  TraceArg arg1_val,
                  TraceArg arg2_name,
-                 TraceArg arg2_val) {}
+                 TraceArg arg2_val) {
+  TraceRecorder::Record(Dart_Timeline_Event_Begin, name, 0);
+}
 
-void TraceEventEnd(TraceArg name) {}
+void TraceEventEnd(TraceArg name) {
+  TraceRecorder::Record(Dart_Timeline_Event_End, name, 0);
+}
 
 void TraceEventAsyncComplete(TraceArg category_group,
                              TraceArg name,
                              TimePoint begin,
-                             TimePoint end) {}
+                             TimePoint end) {
+  if (begin > end) {
+    std::swap(begin, end);
+  }
+  const auto identifier = TraceNonce();
+  TraceRecorder::Record(Dart_Timeline_Event_Async_Begin, name, identifier,
+                        begin);
+  TraceRecorder::Record(Dart_Timeline_Event_Async_End, name, identifier, end);
+}
 
 void TraceEventAsyncBegin0(TraceArg category_group,
                            TraceArg name,
-                           TraceIDArg id) {}
+                           TraceIDArg id) {
+  TraceRecorder::Record(Dart_Timeline_Event_Async_Begin, name, id);
+}
 
 void TraceEventAsyncEnd0(TraceArg category_group,
                          TraceArg name,
-                         TraceIDArg id) {}
+                         TraceIDArg id) {
+  TraceRecorder::Record(Dart_Timeline_Event_Async_End, name, id);
+}
 
 void TraceEventAsyncBegin1(TraceArg category_group,
                            TraceArg name,
                            TraceIDArg id,
                            TraceArg arg1_name,
-                           TraceArg arg1_val) {}
+                           TraceArg arg1_val) {
+  TraceRecorder::Record(Dart_Timeline_Event_Async_Begin, name, id);
+}
 
 void TraceEventAsyncEnd1(TraceArg category_group,
                          TraceArg name,
                          TraceIDArg id,
                          TraceArg arg1_name,
-                         TraceArg arg1_val) {}
+                         TraceArg arg1_val) {
+  TraceRecorder::Record(Dart_Timeline_Event_Async_End, name, id);
+}
 
-void TraceEventInstant0(TraceArg category_group, TraceArg name) {}
+void TraceEventInstant0(TraceArg category_group, TraceArg name) {
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, name, 0);
+}
 
 void TraceEventInstant1(TraceArg category_group,
                         TraceArg name,
                         TraceArg arg1_name,
-                        TraceArg arg1_val) {}
+                        TraceArg arg1_val) {
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, name, 0);
+}
 
 void TraceEventInstant2(TraceArg category_group,
                         TraceArg name,
                         TraceArg arg1_name,
                         TraceArg arg1_val,
                         TraceArg arg2_name,
-                        TraceArg arg2_val) {}
+                        TraceArg arg2_val) {
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, name, 0);
+}
 
 void TraceEventFlowBegin0(TraceArg category_group,
                           TraceArg name,
-                          TraceIDArg id) {}
+                          TraceIDArg id) {
+  TraceRecorder::Record(Dart_Timeline_Event_Flow_Begin, name, id);
+}
 
 void TraceEventFlowStep0(TraceArg category_group,
                          TraceArg name,
-                         TraceIDArg id) {}
+                         TraceIDArg id) {
+  TraceRecorder::Record(Dart_Timeline_Event_Flow_Step, name, id);
+}
 
 void TraceEventFlowEnd0(TraceArg category_group, TraceArg name, TraceIDArg id) {
+  TraceRecorder::Record(Dart_Timeline_Event_Flow_End, name, id);
 }
 
 #endif  // FLUTTER_TIMELINE_ENABLED
@@ -0,0 +1,308 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_recorder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#include "flutter/fml/thread_local.h"
+
+namespace fml {
+namespace tracing {
+
+namespace {
+
+constexpr size_t kNameWords =
+    (TraceRecorder::kMaxNameLength + 1) / sizeof(uint64_t);
+
+static_assert((TraceRecorder::kMaxNameLength + 1) % sizeof(uint64_t) == 0,
+              "Names must fill the words of a slot.");
+
+// A slot is only ever written by the thread that owns its buffer. Readers
+// copy a slot and discard the copy if its sequence number changed while they
+// were copying, which happens when the writer wrapped around the buffer and
+// overwrote the slot.
+struct Slot {
+  std::atomic<uint64_t> sequence{0};
+  std::atomic<int64_t> timestamp{0};
+  std::atomic<int64_t> id{0};
+  std::atomic<int32_t> type{0};
+  std::atomic<uint64_t> name[kNameWords] = {};
+};
+
+struct ThreadBuffer {
+  explicit ThreadBuffer(size_t p_thread) : thread(p_thread) {}
+
+  const size_t thread;
+  // The number of events that have ever been written to the buffer.
+  std::atomic<uint64_t> head{0};
+  // The events before this index have been cleared.
+  std::atomic<uint64_t> start{0};
+  // Guarded by the mutex of the registry.
+  bool in_use = false;
+  Slot slots[TraceRecorder::kEventsPerThread];
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ThreadBuffer);
+};
+
+// The buffers are never deallocated so that the events of threads that have
+// exited can still be dumped. The buffers of exited threads are handed to new
+// threads instead.
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+Registry& GetRegistry() {
+  static Registry* registry = new Registry();
+  return *registry;
+}
+
+std::atomic_bool gRecorderEnabled = false;
+
+// Leases a buffer from the registry for as long as its thread is alive.
+class ThreadBufferLease {
+ public:
+  ThreadBufferLease() {
+    Registry& registry = GetRegistry();
+    std::scoped_lock lock(registry.mutex);
+    for (const auto& buffer : registry.buffers) {
+      if (!buffer->in_use) {
+        buffer_ = buffer.get();
+        break;
+      }
+    }
+    if (buffer_) {
+      // The buffer belonged to a thread that has exited and its events
+      // would be attributed to this thread otherwise.
+      buffer_->start.store(buffer_->head.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+    } else {
+      registry.buffers.push_back(
+          std::make_unique<ThreadBuffer>(registry.buffers.size() + 1));
+      buffer_ = registry.buffers.back().get();
+    }
+    buffer_->in_use = true;
+  }
+
+  ~ThreadBufferLease() {
+    std::scoped_lock lock(GetRegistry().mutex);
+    buffer_->in_use = false;
+  }
+
+  ThreadBuffer* buffer() const { return buffer_; }
+
+ private:
+  ThreadBuffer* buffer_ = nullptr;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ThreadBufferLease);
+};
+
+FML_THREAD_LOCAL ThreadLocalUniquePtr<ThreadBufferLease> tls_buffer_lease;
+
+ThreadBuffer* GetThreadBuffer() {
+  ThreadBufferLease* lease = tls_buffer_lease.get();
+  if (!lease) {
+    lease = new ThreadBufferLease();
+    tls_buffer_lease.reset(lease);
+  }
+  return lease->buffer();
+}
+
+const char* GetPhase(Dart_Timeline_Event_Type type) {
+  switch (type) {
+    case Dart_Timeline_Event_Begin:
+      return "B";
+    case Dart_Timeline_Event_End:
+      return "E";
+    case Dart_Timeline_Event_Async_Begin:
+      return "b";
+    case Dart_Timeline_Event_Async_End:
+      return "e";
+    case Dart_Timeline_Event_Flow_Begin:
+      return "s";
+    case Dart_Timeline_Event_Flow_Step:
+      return "t";
+    case Dart_Timeline_Event_Flow_End:
+      return "f";
+    default:
+      // Durations and counter values are not recorded, so the remaining
+      // events are dumped as instants.
+      return "i";
+  }
+}
+
+bool HasId(Dart_Timeline_Event_Type type) {
+  switch (type) {
+    case Dart_Timeline_Event_Async_Begin:
+    case Dart_Timeline_Event_Async_End:
+    case Dart_Timeline_Event_Flow_Begin:
+    case Dart_Timeline_Event_Flow_Step:
+    case Dart_Timeline_Event_Flow_End:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void WriteJSONString(std::ostream& stream, const std::string& value) {
+  stream << '"';
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      stream << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+             << static_cast<int>(c) << std::dec << std::setfill(' ');
+    } else {
+      stream << c;
+    }
+  }
+  stream << '"';
+}
+
+}  // namespace
+
+void TraceRecorder::SetEnabled(bool enabled) {
+  gRecorderEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool TraceRecorder::IsEnabled() {
+  return gRecorderEnabled.load(std::memory_order_relaxed);
+}
+
+void TraceRecorder::Record(Dart_Timeline_Event_Type type,
+                           const char* name,
+                           int64_t id) {
+  if (!IsEnabled()) {
+    return;
+  }
+  Record(type, name, id, TimePoint::Now());
+}
+
+void TraceRecorder::Record(Dart_Timeline_Event_Type type,
+                           const char* name,
+                           int64_t id,
+                           TimePoint timestamp) {
+  if (!IsEnabled()) {
+    return;
+  }
+
+  uint64_t name_words[kNameWords] = {};
+  if (name) {
+    memcpy(name_words, name, strnlen(name, kMaxNameLength));
+  }
+
+  ThreadBuffer* buffer = GetThreadBuffer();
+  const uint64_t index = buffer->head.load(std::memory_order_relaxed);
+  Slot& slot = buffer->slots[index % kEventsPerThread];
+
+  // Invalidate the slot before overwriting it so that readers that are
+  // copying it concurrently discard their copy.
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.timestamp.store(timestamp.ToEpochDelta().ToNanoseconds(),
+                       std::memory_order_relaxed);
+  slot.id.store(id, std::memory_order_relaxed);
+  slot.type.store(type, std::memory_order_relaxed);
+  for (size_t i = 0; i < kNameWords; i++) {
+    slot.name[i].store(name_words[i], std::memory_order_relaxed);
+  }
+
+  slot.sequence.store(index + 1, std::memory_order_release);
+  buffer->head.store(index + 1, std::memory_order_release);
+}
+
+void TraceRecorder::Clear() {
+  Registry& registry = GetRegistry();
+  std::scoped_lock lock(registry.mutex);
+  for (const auto& buffer : registry.buffers) {
+    buffer->start.store(buffer->head.load(std::memory_order_acquire),
+                        std::memory_order_relaxed);
+  }
+}
+
+std::vector<TraceRecorder::Event> TraceRecorder::GetEvents() {
+  std::vector<Event> events;
+  Registry& registry = GetRegistry();
+  std::scoped_lock lock(registry.mutex);
+  for (const auto& buffer : registry.buffers) {
+    const uint64_t head = buffer->head.load(std::memory_order_acquire);
+    uint64_t begin = buffer->start.load(std::memory_order_relaxed);
+    if (head > kEventsPerThread) {
+      begin = std::max(begin, head - kEventsPerThread);
+    }
+    for (uint64_t index = begin; index < head; index++) {
+      const Slot& slot = buffer->slots[index % kEventsPerThread];
+      const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence != index + 1) {
+        continue;
+      }
+
+      const int64_t timestamp = slot.timestamp.load(std::memory_order_relaxed);
+      const int64_t id = slot.id.load(std::memory_order_relaxed);
+      const int32_t type = slot.type.load(std::memory_order_relaxed);
+      uint64_t name_words[kNameWords];
+      for (size_t i = 0; i < kNameWords; i++) {
+        name_words[i] = slot.name[i].load(std::memory_order_relaxed);
+      }
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+        // The slot was overwritten while it was being copied.
+        continue;
+      }
+
+      Event event;
+      event.thread = buffer->thread;
+      event.type = static_cast<Dart_Timeline_Event_Type>(type);
+      event.id = id;
+      event.timestamp =
+          TimePoint::FromEpochDelta(TimeDelta::FromNanoseconds(timestamp));
+      const char* name = reinterpret_cast<const char*>(name_words);
+      event.name.assign(name, strnlen(name, sizeof(name_words)));
+      events.push_back(std::move(event));
+    }
+  }
+  return events;
+}
+
+std::string TraceRecorder::DumpChromeJSON() {
+  std::stringstream stream;
+  stream << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto& event : GetEvents()) {
+    if (!first) {
+      stream << ",";
+    }
+    first = false;
+
+    const char* phase = GetPhase(event.type);
+    const int64_t nanos = event.timestamp.ToEpochDelta().ToNanoseconds();
+    stream << "{\"name\":";
+    WriteJSONString(stream, event.name);
+    stream << ",\"cat\":\"flutter\",\"ph\":\"" << phase
+           << "\",\"ts\":" << nanos / 1000 << "." << std::setw(3)
+           << std::setfill('0') << nanos % 1000 << std::setfill(' ')
+           << ",\"pid\":0,\"tid\":" << event.thread;
+    if (HasId(event.type)) {
+      stream << ",\"id\":\"0x" << std::hex << event.id << std::dec << "\"";
+    }
+    if (strcmp(phase, "i") == 0) {
+      stream << ",\"s\":\"t\"";
+    }
+    stream << "}";
+  }
+  stream << "]}";
+  return stream.str();
+}
+
+}  // namespace tracing
+}  // namespace fml
@@ -0,0 +1,88 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_TRACE_RECORDER_H_
+#define FLUTTER_FML_TRACE_RECORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
+#include "third_party/dart/runtime/include/dart_tools_api.h"
+
+namespace fml {
+namespace tracing {
+
+//------------------------------------------------------------------------------
+/// @brief      An in-process recorder for the events of the `TRACE_EVENT*`
+///             macros.
+///
+///             Unlike the timeline event handler, the recorder does not need
+///             a connected tool and is available in release builds. Each
+///             thread records into its own fixed size ring buffer without
+///             taking any locks, so the recorder can be left enabled in
+///             production and the most recent events of every thread dumped
+///             when something interesting happens, for example when a janky
+///             frame is detected.
+///
+///             Only the type, name, identifier and timestamp of each event
+///             are recorded. Arguments are dropped and names longer than
+///             `kMaxNameLength` are truncated.
+///
+class TraceRecorder {
+ public:
+  /// The number of most recent events that are kept for each thread.
+  static constexpr size_t kEventsPerThread = 2048;
+
+  static constexpr size_t kMaxNameLength = 63;
+
+  struct Event {
+    /// An identifier of the thread that recorded the event, unique among
+    /// the threads that are alive at the same time.
+    size_t thread = 0;
+    Dart_Timeline_Event_Type type = Dart_Timeline_Event_Instant;
+    /// The async or flow identifier of the event, zero for other events.
+    int64_t id = 0;
+    TimePoint timestamp;
+    std::string name;
+  };
+
+  /// Starts or stops recording events. The recorder is disabled by default.
+  static void SetEnabled(bool enabled);
+
+  static bool IsEnabled();
+
+  /// Records an event on the calling thread at the current time.
+  static void Record(Dart_Timeline_Event_Type type,
+                     const char* name,
+                     int64_t id);
+
+  /// Records an event on the calling thread at `timestamp`.
+  static void Record(Dart_Timeline_Event_Type type,
+                     const char* name,
+                     int64_t id,
+                     TimePoint timestamp);
+
+  /// Drops all the events that have been recorded so far.
+  static void Clear();
+
+  /// Returns the events recorded by every thread. The events of each thread
+  /// are ordered from oldest to newest.
+  static std::vector<Event> GetEvents();
+
+  /// Returns the recorded events in the JSON trace event format, which can
+  /// be loaded by Perfetto and chrome://tracing.
+  static std::string DumpChromeJSON();
+
+ private:
+  FML_DISALLOW_IMPLICIT_CONSTRUCTORS(TraceRecorder);
+};
+
+}  // namespace tracing
+}  // namespace fml
+
+#endif  // FLUTTER_FML_TRACE_RECORDER_H_
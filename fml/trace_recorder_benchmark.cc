@@ -0,0 +1,26 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_recorder.h"
+
+#include "flutter/benchmarking/benchmarking.h"
+
+namespace fml {
+namespace benchmarking {
+
+static void BM_TraceRecorderRecord(benchmark::State& state) {  // NOLINT
+  tracing::TraceRecorder::SetEnabled(state.range(0) != 0);
+  int64_t id = 0;
+  while (state.KeepRunning()) {
+    tracing::TraceRecorder::Record(Dart_Timeline_Event_Begin,
+                                   "BM_TraceRecorderRecord", id++);
+  }
+  tracing::TraceRecorder::SetEnabled(false);
+  tracing::TraceRecorder::Clear();
+}
+
+BENCHMARK(BM_TraceRecorderRecord)->Arg(0)->Arg(1);
+
+}  // namespace benchmarking
+}  // namespace fml
@@ -0,0 +1,159 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_recorder.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "flutter/fml/trace_event.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace tracing {
+namespace {
+
+class TraceRecorderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    TraceRecorder::Clear();
+    TraceRecorder::SetEnabled(true);
+  }
+
+  void TearDown() override {
+    TraceRecorder::SetEnabled(false);
+    TraceRecorder::Clear();
+  }
+};
+
+TEST(TraceRecorder, IsDisabledByDefault) {
+  ASSERT_FALSE(TraceRecorder::IsEnabled());
+  TraceRecorder::Clear();
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, "event", 0);
+  ASSERT_TRUE(TraceRecorder::GetEvents().empty());
+}
+
+TEST_F(TraceRecorderTest, RecordsEventsInOrder) {
+  TraceRecorder::Record(Dart_Timeline_Event_Begin, "outer", 0);
+  TraceRecorder::Record(Dart_Timeline_Event_Async_Begin, "async", 7);
+  TraceRecorder::Record(Dart_Timeline_Event_End, "outer", 0);
+
+  auto events = TraceRecorder::GetEvents();
+  ASSERT_EQ(events.size(), 3u);
+  EXPECT_EQ(events[0].type, Dart_Timeline_Event_Begin);
+  EXPECT_EQ(events[0].name, "outer");
+  EXPECT_EQ(events[1].type, Dart_Timeline_Event_Async_Begin);
+  EXPECT_EQ(events[1].name, "async");
+  EXPECT_EQ(events[1].id, 7);
+  EXPECT_EQ(events[2].type, Dart_Timeline_Event_End);
+  EXPECT_LE(events[0].timestamp, events[1].timestamp);
+  EXPECT_LE(events[1].timestamp, events[2].timestamp);
+  EXPECT_EQ(events[0].thread, events[2].thread);
+}
+
+TEST_F(TraceRecorderTest, RecordsTraceEvents) {
+  {
+    TRACE_EVENT0("flutter", "TraceRecorderTest");
+  }
+  auto events = TraceRecorder::GetEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].type, Dart_Timeline_Event_Begin);
+  EXPECT_EQ(events[0].name, "TraceRecorderTest");
+  EXPECT_EQ(events[1].type, Dart_Timeline_Event_End);
+}
+
+TEST_F(TraceRecorderTest, KeepsTheMostRecentEvents) {
+  const size_t count = TraceRecorder::kEventsPerThread + 10;
+  for (size_t i = 0; i < count; i++) {
+    TraceRecorder::Record(Dart_Timeline_Event_Instant, "event", i);
+  }
+  auto events = TraceRecorder::GetEvents();
+  ASSERT_EQ(events.size(), TraceRecorder::kEventsPerThread);
+  EXPECT_EQ(events.front().id, 10);
+  EXPECT_EQ(events.back().id, static_cast<int64_t>(count - 1));
+}
+
+TEST_F(TraceRecorderTest, TruncatesLongNames) {
+  std::string name(TraceRecorder::kMaxNameLength + 10, 'a');
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, name.c_str(), 0);
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, nullptr, 0);
+  auto events = TraceRecorder::GetEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].name, name.substr(0, TraceRecorder::kMaxNameLength));
+  EXPECT_EQ(events[1].name, "");
+}
+
+TEST_F(TraceRecorderTest, ClearDropsRecordedEvents) {
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, "before", 0);
+  TraceRecorder::Clear();
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, "after", 0);
+  auto events = TraceRecorder::GetEvents();
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].name, "after");
+}
+
+TEST_F(TraceRecorderTest, EachThreadRecordsIntoItsOwnBuffer) {
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, "main", 0);
+  std::thread thread([]() {
+    for (size_t i = 0; i < TraceRecorder::kEventsPerThread; i++) {
+      TraceRecorder::Record(Dart_Timeline_Event_Instant, "thread", i);
+    }
+  });
+  thread.join();
+
+  auto events = TraceRecorder::GetEvents();
+  ASSERT_EQ(events.size(), TraceRecorder::kEventsPerThread + 1);
+  size_t main_thread = 0;
+  for (const auto& event : events) {
+    if (event.name == "main") {
+      main_thread = event.thread;
+    }
+  }
+  ASSERT_NE(main_thread, 0u);
+  for (const auto& event : events) {
+    if (event.name == "thread") {
+      EXPECT_NE(event.thread, main_thread);
+    }
+  }
+}
+
+TEST_F(TraceRecorderTest, CanReadWhileThreadsAreRecording) {
+  std::atomic_bool done = false;
+  std::thread thread([&done]() {
+    int64_t id = 0;
+    while (!done) {
+      TraceRecorder::Record(Dart_Timeline_Event_Flow_Step, "step", id++);
+    }
+  });
+  for (int i = 0; i < 100; i++) {
+    for (const auto& event : TraceRecorder::GetEvents()) {
+      ASSERT_EQ(event.type, Dart_Timeline_Event_Flow_Step);
+      ASSERT_EQ(event.name, "step");
+    }
+  }
+  done = true;
+  thread.join();
+}
+
+TEST_F(TraceRecorderTest, DumpsChromeJSON) {
+  TraceRecorder::Record(Dart_Timeline_Event_Begin, "frame", 0,
+                        TimePoint::FromEpochDelta(
+                            TimeDelta::FromNanoseconds(1234567)));
+  TraceRecorder::Record(Dart_Timeline_Event_Async_End, "a\"b", 255);
+  TraceRecorder::Record(Dart_Timeline_Event_Instant, "jank", 0);
+
+  auto json = TraceRecorder::DumpChromeJSON();
+  EXPECT_EQ(json.find("{\"traceEvents\":[{\"name\":\"frame\""), 0u);
+  EXPECT_NE(json.find("\"ph\":\"B\",\"ts\":1234.567,"), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"a\\\"b\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"e\""), std::string::npos);
+  EXPECT_NE(json.find("\"id\":\"0xff\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"i\""), std::string::npos);
+  EXPECT_EQ(json.substr(json.size() - 2), "]}");
+}
+
+}  // namespace
+}  // namespace tracing
+}  // namespace fml
@@ -0,0 +1,386 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/time/time_point.h"
+#include "flutter/testing/testing.h"
+#include "impeller/aiks/aiks_context.h"
+#include "impeller/aiks/canvas.h"
+#include "impeller/aiks/entity_pass_pool.h"
+#include "impeller/entity/contents/filters/filter_contents.h"
+#include "impeller/entity/contents/linear_gradient_contents.h"
+#include "impeller/entity/contents/radial_gradient_contents.h"
+#include "impeller/entity/contents/sweep_gradient_contents.h"
+#include "impeller/geometry/path_builder.h"
+#include "impeller/playground/playground.h"
+#include "impeller/renderer/allocator.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/host_buffer_ring.h"
+#include "impeller/renderer/render_target.h"
+#include "impeller/typographer/backends/skia/text_frame_skia.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkFont.h"
+#include "third_party/skia/include/core/SkTextBlob.h"
+#include "third_party/skia/include/core/SkTypeface.h"
+
+// The heap allocations made by this process. Used to count the allocations
+// made while recording a scene.
+static std::atomic<size_t> gHeapAllocationCount = 0u;
+
+void* operator new(size_t size) {
+  gHeapAllocationCount.fetch_add(1u, std::memory_order_relaxed);
+  if (auto pointer = std::malloc(size == 0u ? 1u : size)) {
+    return pointer;
+  }
+  std::abort();
+}
+
+void* operator new[](size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t size) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t size) noexcept {
+  std::free(pointer);
+}
+
+namespace impeller {
+
+namespace {
+
+constexpr ISize kFrameSize = {1024, 768};
+
+/// A playground that only sets up a context. Contexts are created with
+/// invisible windows, so nothing is ever presented.
+class BenchmarkPlayground final : public Playground {
+ public:
+  BenchmarkPlayground() = default;
+
+  ~BenchmarkPlayground() override = default;
+
+  // |Playground|
+  std::unique_ptr<fml::Mapping> OpenAssetAsMapping(
+      std::string asset_name) const override {
+    return flutter::testing::OpenFixtureAsMapping(asset_name);
+  }
+
+  // |Playground|
+  std::string GetWindowTitle() const override { return "Impeller Benchmarks"; }
+
+ private:
+  FML_DISALLOW_COPY_AND_ASSIGN(BenchmarkPlayground);
+};
+
+using SceneProc = std::function<bool(Canvas& canvas)>;
+
+bool DrawBlurs(Canvas& canvas) {
+  Paint paint;
+  paint.color = Color::Blue();
+  paint.mask_blur_descriptor = Paint::MaskBlurDescriptor{
+      .style = FilterContents::BlurStyle::kNormal,
+      .sigma = Sigma{10},
+  };
+  for (int i = 0; i < 10; i++) {
+    canvas.DrawCircle({100.0f + i * 80.0f, 200}, 35, paint);
+  }
+  paint.mask_blur_descriptor->style = FilterContents::BlurStyle::kOuter;
+  canvas.DrawRRect({100, 400, 600, 200}, 40, paint);
+
+  canvas.SaveLayer({}, std::nullopt,
+                   [](const FilterInput::Ref& input,
+                      const Matrix& effect_transform) {
+                     return FilterContents::MakeGaussianBlur(
+                         input, Sigma{20}, Sigma{20});
+                   });
+  canvas.Restore();
+  return true;
+}
+
+bool DrawGradients(Canvas& canvas) {
+  std::vector<Color> colors = {Color::Red(), Color::Green(), Color::Blue()};
+  std::vector<Scalar> stops = {0.0, 0.5, 1.0};
+
+  Paint paint;
+  paint.color_source = [colors, stops]() {
+    auto contents = std::make_shared<LinearGradientContents>();
+    contents->SetEndPoints({0, 0}, {300, 300});
+    contents->SetColors(colors);
+    contents->SetStops(stops);
+    return contents;
+  };
+  canvas.DrawRect({0, 0, 300, 300}, paint);
+
+  paint.color_source = [colors, stops]() {
+    auto contents = std::make_shared<RadialGradientContents>();
+    contents->SetCenterAndRadius({450, 150}, 150);
+    contents->SetColors(colors);
+    contents->SetStops(stops);
+    return contents;
+  };
+  canvas.DrawRect({300, 0, 300, 300}, paint);
+
+  paint.color_source = [colors, stops]() {
+    auto contents = std::make_shared<SweepGradientContents>();
+    contents->SetCenterAndAngles({750, 150}, Degrees(0), Degrees(360));
+    contents->SetColors(colors);
+    contents->SetStops(stops);
+    return contents;
+  };
+  canvas.DrawRect({600, 0, 300, 300}, paint);
+  return true;
+}
+
+sk_sp<SkData> OpenFixtureAsSkData(const char* fixture_name) {
+  auto mapping = flutter::testing::OpenFixtureAsMapping(fixture_name);
+  if (!mapping) {
+    return nullptr;
+  }
+  auto data = SkData::MakeWithProc(
+      mapping->GetMapping(), mapping->GetSize(),
+      [](const void* ptr, void* context) {
+        delete reinterpret_cast<fml::Mapping*>(context);
+      },
+      mapping.get());
+  mapping.release();
+  return data;
+}
+
+bool DrawText(Canvas& canvas) {
+  auto mapping = OpenFixtureAsSkData("Roboto-Regular.ttf");
+  if (!mapping) {
+    return false;
+  }
+  SkFont sk_font(SkTypeface::MakeFromData(mapping), 24.0);
+  auto blob = SkTextBlob::MakeFromString(
+      "the quick brown fox jumped over the lazy dog!.?", sk_font);
+  if (!blob) {
+    return false;
+  }
+  auto frame = TextFrameFromTextBlob(blob);
+
+  Paint paint;
+  paint.color = Color::Black();
+  for (int i = 0; i < 25; i++) {
+    canvas.DrawTextFrame(frame, {20, 30.0f + i * 28.0f}, paint);
+  }
+  return true;
+}
+
+bool DrawPaths(Canvas& canvas) {
+  PathBuilder builder;
+  for (int i = 0; i < 20; i++) {
+    Scalar x = i * 50.0f;
+    builder.MoveTo({x, 100});
+    builder.CubicCurveTo({x + 100, 0}, {x - 50, 300}, {x + 50, 400});
+    builder.CubicCurveTo({x + 150, 500}, {x - 100, 600}, {x, 700});
+  }
+  auto path = builder.TakePath();
+
+  Paint paint;
+  paint.color = Color::Red();
+  canvas.DrawPath(path, paint);
+
+  paint.color = Color::Black();
+  paint.style = Paint::Style::kStroke;
+  paint.stroke_width = 5.0;
+  paint.stroke_join = Join::kRound;
+  paint.stroke_cap = Cap::kRound;
+  canvas.DrawPath(path, paint);
+  return true;
+}
+
+bool DrawClips(Canvas& canvas) {
+  Paint paint;
+  for (int i = 0; i < 10; i++) {
+    canvas.Save();
+    canvas.ClipPath(PathBuilder{}
+                        .AddCircle({512, 384}, 380.0f - i * 35.0f)
+                        .TakePath());
+    canvas.ClipRect({i * 20.0f, i * 20.0f, 1024 - i * 40.0f, 768 - i * 40.0f});
+    paint.color = i % 2 == 0 ? Color::Red() : Color::Blue();
+    canvas.DrawPaint(paint);
+  }
+  canvas.RestoreToCount(1);
+  return true;
+}
+
+/// Submit an empty command buffer and wait for it to complete. Since command
+/// buffers are executed in order, this waits for all previously submitted
+/// work. On OpenGL ES, this only waits for the commands to be issued.
+bool WaitForGPU(const Context& context) {
+  auto buffer = context.CreateCommandBuffer();
+  if (!buffer) {
+    return false;
+  }
+  fml::AutoResetWaitableEvent latch;
+  bool success = false;
+  if (!buffer->SubmitCommands([&](CommandBuffer::Status status) {
+        success = status == CommandBuffer::Status::kCompleted;
+        latch.Signal();
+      })) {
+    return false;
+  }
+  latch.Wait();
+  return success;
+}
+
+/// Renders the scene into an offscreen target every iteration and reports
+/// the CPU time spent encoding the frame, the time spent waiting for the GPU
+/// after encoding, and the number and size of the device allocations made
+/// per frame.
+void BM_RenderScene(benchmark::State& state,
+                    PlaygroundBackend backend,
+                    const SceneProc& scene) {
+  if (!Playground::SupportsBackend(backend)) {
+    state.SkipWithError("Backend not supported.");
+    return;
+  }
+  BenchmarkPlayground playground;
+  playground.SetupContext(backend);
+  auto context = playground.GetContext();
+  if (!context) {
+    state.SkipWithError("Could not create a context.");
+    return;
+  }
+  AiksContext aiks_context(context);
+  if (!aiks_context.IsValid()) {
+    state.SkipWithError("Could not create an Aiks context.");
+    return;
+  }
+
+  Canvas canvas;
+  if (!scene(canvas)) {
+    state.SkipWithError("Could not record the scene.");
+    return;
+  }
+  auto picture = canvas.EndRecordingAsPicture();
+
+  auto render_target =
+      context->SupportsOffscreenMSAA()
+          ? RenderTarget::CreateOffscreenMSAA(*context, kFrameSize)
+          : RenderTarget::CreateOffscreen(*context, kFrameSize);
+  auto allocator = context->GetResourceAllocator();
+
+  double encode_ms = 0.0;
+  double gpu_ms = 0.0;
+  size_t allocation_count = 0u;
+  size_t allocated_bytes = 0u;
+  for (auto _ : state) {
+    auto allocation_count_start = allocator->GetAllocationCount();
+    auto allocated_bytes_start = allocator->GetAllocatedBytes();
+
+    auto encode_start = fml::TimePoint::Now();
+    if (!aiks_context.Render(picture, render_target)) {
+      state.SkipWithError("Could not render the scene.");
+      return;
+    }
+    auto gpu_start = fml::TimePoint::Now();
+    if (!WaitForGPU(*context)) {
+      state.SkipWithError("Could not wait for the GPU.");
+      return;
+    }
+    auto gpu_end = fml::TimePoint::Now();
+    context->GetHostBufferRing()->AdvanceFrame();
+
+    encode_ms += (gpu_start - encode_start).ToMillisecondsF();
+    gpu_ms += (gpu_end - gpu_start).ToMillisecondsF();
+    allocation_count +=
+        allocator->GetAllocationCount() - allocation_count_start;
+    allocated_bytes += allocator->GetAllocatedBytes() - allocated_bytes_start;
+  }
+
+  state.counters["EncodeMs"] =
+      benchmark::Counter(encode_ms, benchmark::Counter::kAvgIterations);
+  state.counters["GPUWaitMs"] =
+      benchmark::Counter(gpu_ms, benchmark::Counter::kAvgIterations);
+  state.counters["Allocations"] =
+      benchmark::Counter(allocation_count, benchmark::Counter::kAvgIterations);
+  state.counters["AllocatedBytes"] =
+      benchmark::Counter(allocated_bytes, benchmark::Counter::kAvgIterations);
+}
+
+/// Records the scene into a picture every iteration without rendering it, and
+/// reports the heap allocations made per recording. This includes the
+/// allocations made by the scene itself, like building its paths. If
+/// `recycle` is set, every picture is recycled so that the next one reuses
+/// its passes, like the frames of an onscreen surface.
+void BM_RecordScene(benchmark::State& state,
+                    bool recycle,
+                    const SceneProc& scene) {
+  auto pass_pool = recycle ? std::make_shared<EntityPassPool>() : nullptr;
+  Canvas canvas(pass_pool);
+
+  size_t heap_allocation_count = 0u;
+  for (auto _ : state) {
+    auto heap_allocation_count_start = gHeapAllocationCount.load();
+    if (!scene(canvas)) {
+      state.SkipWithError("Could not record the scene.");
+      return;
+    }
+    auto picture = canvas.EndRecordingAsPicture();
+    heap_allocation_count += gHeapAllocationCount.load() -
+                             heap_allocation_count_start;
+
+    // Destroying the picture isn't part of the recording.
+    state.PauseTiming();
+    if (pass_pool) {
+      pass_pool->Recycle(std::move(picture));
+    } else {
+      picture = {};
+    }
+    state.ResumeTiming();
+  }
+
+  state.counters["HeapAllocations"] = benchmark::Counter(
+      heap_allocation_count, benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+#define AIKS_SCENE_BENCHMARKS(scene)                                        \
+  BENCHMARK_CAPTURE(BM_RenderScene, scene/Metal, PlaygroundBackend::kMetal, \
+                    Draw##scene)                                            \
+      ->Unit(benchmark::kMillisecond)                                       \
+      ->UseRealTime();                                                      \
+  BENCHMARK_CAPTURE(BM_RenderScene, scene/OpenGLES,                         \
+                    PlaygroundBackend::kOpenGLES, Draw##scene)              \
+      ->Unit(benchmark::kMillisecond)                                       \
+      ->UseRealTime();                                                      \
+  BENCHMARK_CAPTURE(BM_RenderScene, scene/Vulkan,                           \
+                    PlaygroundBackend::kVulkan, Draw##scene)                \
+      ->Unit(benchmark::kMillisecond)                                       \
+      ->UseRealTime();                                                      \
+  BENCHMARK_CAPTURE(BM_RecordScene, scene/Record, false, Draw##scene)       \
+      ->Unit(benchmark::kMicrosecond);                                      \
+  BENCHMARK_CAPTURE(BM_RecordScene, scene/RecordRecycled, true,             \
+                    Draw##scene)                                            \
+      ->Unit(benchmark::kMicrosecond)
+
+AIKS_SCENE_BENCHMARKS(Blurs)
+AIKS_SCENE_BENCHMARKS(Gradients)
+AIKS_SCENE_BENCHMARKS(Text)
+AIKS_SCENE_BENCHMARKS(Paths)
+AIKS_SCENE_BENCHMARKS(Clips)
+
+}  // namespace impeller
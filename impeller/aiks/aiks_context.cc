@@ -41,11 +41,15 @@ bool AiksContext::Render(const Picture& picture, RenderTarget& render_target) {
     return false;
   }
 
-  if (picture.pass) {
-    return picture.pass->Render(*content_context_, render_target);
+  if (!picture.pass) {
+    return true;
   }
 
-  return true;
+  auto render_target_cache = content_context_->GetRenderTargetCache();
+  render_target_cache->Start();
+  auto result = picture.pass->Render(*content_context_, render_target);
+  render_target_cache->End();
+  return result;
 }
 
 }  // namespace impeller
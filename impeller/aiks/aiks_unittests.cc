@@ -11,7 +11,9 @@
 #include "flutter/testing/testing.h"
 #include "impeller/aiks/aiks_playground.h"
 #include "impeller/aiks/canvas.h"
+#include "impeller/aiks/entity_pass_pool.h"
 #include "impeller/aiks/image.h"
+#include "impeller/entity/contents/rrect_fill_contents.h"
 #include "impeller/entity/contents/tiled_texture_contents.h"
 #include "impeller/geometry/color.h"
 #include "impeller/geometry/geometry_unittests.h"
@@ -55,6 +57,36 @@ TEST_P(AiksTest, CanvasCanPushPopCTM) {
                      Matrix::MakeTranslation({100.0, 100.0, 0.0}));
 }
 
+TEST_P(AiksTest, CanvasRecordsIntoRecycledPasses) {
+  auto pass_pool = std::make_shared<EntityPassPool>();
+  Canvas canvas(pass_pool);
+  canvas.DrawRect({0, 0, 100, 100}, {});
+  canvas.SaveLayer({});
+  canvas.DrawRect({50, 50, 100, 100}, {});
+  canvas.Restore();
+  auto picture = canvas.EndRecordingAsPicture();
+  ASSERT_EQ(picture.pass->GetSubpassesDepth(), 2u);
+
+  pass_pool->Recycle(std::move(picture));
+  ASSERT_EQ(pass_pool->GetSize(), 2u);
+
+  // The layer and the base pass of the next picture are taken from the pool.
+  canvas.SaveLayer({});
+  ASSERT_EQ(pass_pool->GetSize(), 1u);
+  canvas.Restore();
+  picture = canvas.EndRecordingAsPicture();
+  ASSERT_EQ(pass_pool->GetSize(), 0u);
+
+  // The recycled passes don't keep anything from the first picture.
+  ASSERT_EQ(picture.pass->GetSubpassesDepth(), 2u);
+  size_t entity_count = 0u;
+  picture.pass->IterateAllEntities([&entity_count](Entity& entity) {
+    entity_count++;
+    return true;
+  });
+  ASSERT_EQ(entity_count, 0u);
+}
+
 TEST_P(AiksTest, CanRenderColoredRect) {
   Canvas canvas;
   Paint paint;
@@ -227,6 +259,27 @@ TEST_P(AiksTest, CanRenderNestedClips) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST_P(AiksTest, CanRenderRectClipsMixedWithPathClips) {
+  Canvas canvas;
+  Paint paint;
+  canvas.Scale(Vector2(1.5, 1.5));
+  canvas.Translate({20, 20});
+
+  // The rect clips are applied with the scissor and the circle clip with the
+  // stencil. A single restore drops all of them.
+  canvas.Save();
+  canvas.ClipRect(Rect::MakeXYWH(0, 0, 400, 300));
+  canvas.ClipPath(PathBuilder{}.AddCircle({200, 150}, 180).TakePath());
+  canvas.ClipRect(Rect::MakeXYWH(50, 50, 400, 300));
+  paint.color = Color::Fuchsia();
+  canvas.DrawPaint(paint);
+  canvas.Restore();
+
+  paint.color = Color::Blue();
+  canvas.DrawRect(Rect::MakeXYWH(300, 200, 100, 100), paint);
+  ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
+}
+
 TEST_P(AiksTest, CanRenderDifferenceClips) {
   Paint paint;
   Canvas canvas;
@@ -992,6 +1045,51 @@ TEST_P(AiksTest, CanRenderRoundedRectWithNonUniformRadii) {
   ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
 }
 
+TEST_P(AiksTest, SolidRoundedShapesAreNotTessellated) {
+  Canvas canvas;
+
+  Paint fill;
+  fill.color = Color::Red();
+  canvas.DrawRRect(Rect::MakeXYWH(10, 10, 100, 50), 10, fill);
+  canvas.DrawCircle({200, 200}, 50, fill);
+  canvas.DrawOval(Rect::MakeXYWH(300, 10, 100, 50), fill);
+
+  Paint stroke = fill;
+  stroke.style = Paint::Style::kStroke;
+  canvas.DrawCircle({200, 200}, 50, stroke);
+
+  std::vector<bool> analytic;
+  canvas.EndRecordingAsPicture().pass->IterateAllEntities(
+      [&analytic](Entity& entity) {
+        analytic.push_back(std::dynamic_pointer_cast<RRectFillContents>(
+                               entity.GetContents()) != nullptr);
+        return true;
+      });
+  ASSERT_EQ(analytic, std::vector<bool>({true, true, true, false}));
+}
+
+TEST_P(AiksTest, CanRenderAnalyticRoundedShapes) {
+  Canvas canvas;
+  canvas.Scale(GetContentScale());
+
+  Paint paint;
+  paint.color = Color::Blue();
+  canvas.DrawRRect(Rect::MakeXYWH(50, 50, 200, 100), 30, paint);
+  canvas.DrawRRect(Rect::MakeXYWH(300, 50, 200, 100), 500, paint);
+  canvas.DrawCircle({150, 300}, 80, paint);
+  canvas.DrawOval(Rect::MakeXYWH(300, 220, 200, 160), paint);
+
+  canvas.Save();
+  canvas.Translate({100, 500});
+  canvas.Rotate(Degrees(30));
+  canvas.Scale(Vector2(3, 1));
+  paint.color = Color::Red().WithAlpha(0.5);
+  canvas.DrawRRect(Rect::MakeXYWH(0, 0, 50, 80), 10, paint);
+  canvas.Restore();
+
+  ASSERT_TRUE(OpenPlaygroundHere(canvas.EndRecordingAsPicture()));
+}
+
 TEST_P(AiksTest, CanRenderDifferencePaths) {
   Canvas canvas;
 
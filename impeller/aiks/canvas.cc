@@ -12,6 +12,7 @@
 #include "impeller/aiks/paint_pass_delegate.h"
 #include "impeller/entity/contents/atlas_contents.h"
 #include "impeller/entity/contents/clip_contents.h"
+#include "impeller/entity/contents/rrect_fill_contents.h"
 #include "impeller/entity/contents/rrect_shadow_contents.h"
 #include "impeller/entity/contents/text_contents.h"
 #include "impeller/entity/contents/texture_contents.h"
@@ -22,14 +23,18 @@
 
 namespace impeller {
 
-Canvas::Canvas() {
+Canvas::Canvas() : Canvas(nullptr) {}
+
+Canvas::Canvas(std::shared_ptr<EntityPassPool> pass_pool)
+    : pass_pool_(std::move(pass_pool)) {
   Initialize();
 }
 
 Canvas::~Canvas() = default;
 
 void Canvas::Initialize() {
-  base_pass_ = std::make_unique<EntityPass>();
+  arena_ = std::make_shared<Arena>();
+  base_pass_ = CreateEntityPass();
   current_pass_ = base_pass_.get();
   xformation_stack_.emplace_back(CanvasStackEntry{});
   FML_DCHECK(GetSaveCount() == 1u);
@@ -37,6 +42,7 @@ void Canvas::Initialize() {
 }
 
 void Canvas::Reset() {
+  arena_ = nullptr;
   base_pass_ = nullptr;
   current_pass_ = nullptr;
   xformation_stack_ = {};
@@ -55,7 +61,7 @@ void Canvas::Save(
   entry.stencil_depth = xformation_stack_.back().stencil_depth;
   if (create_subpass) {
     entry.is_subpass = true;
-    auto subpass = std::make_unique<EntityPass>();
+    auto subpass = CreateEntityPass();
     subpass->SetBackdropFilter(std::move(backdrop_filter));
     subpass->SetBlendMode(blend_mode);
     current_pass_ = GetCurrentPass().AddSubpass(std::move(subpass));
@@ -137,14 +143,15 @@ void Canvas::RestoreToCount(size_t count) {
   }
 }
 
-void Canvas::DrawPath(const Path& path, const Paint& paint) {
+void Canvas::DrawPath(Path path, const Paint& paint) {
   Entity entity;
   entity.SetTransformation(GetCurrentTransformation());
   entity.SetStencilDepth(GetStencilDepth());
   entity.SetBlendMode(paint.blend_mode);
-  entity.SetContents(paint.WithFilters(paint.CreateContentsForEntity(path)));
+  entity.SetContents(paint.WithFilters(
+      paint.CreateContentsForEntity(std::move(path), false, arena_)));
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 }
 
 void Canvas::DrawPaint(const Paint& paint) {
@@ -152,9 +159,9 @@ void Canvas::DrawPaint(const Paint& paint) {
   entity.SetTransformation(GetCurrentTransformation());
   entity.SetStencilDepth(GetStencilDepth());
   entity.SetBlendMode(paint.blend_mode);
-  entity.SetContents(paint.CreateContentsForEntity({}, true));
+  entity.SetContents(paint.CreateContentsForEntity({}, true, arena_));
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 }
 
 bool Canvas::AttemptDrawBlurredRRect(const Rect& rect,
@@ -173,7 +180,7 @@ bool Canvas::AttemptDrawBlurredRRect(const Rect& rect,
   // For symmetrically mask blurred solid RRects, absorb the mask blur and use
   // a faster SDF approximation.
 
-  auto contents = std::make_shared<RRectShadowContents>();
+  auto contents = CreateContents<RRectShadowContents>();
   contents->SetColor(new_paint.color);
   contents->SetSigma(new_paint.mask_blur_descriptor->sigma);
   contents->SetRRect(rect, corner_radius);
@@ -186,7 +193,7 @@ bool Canvas::AttemptDrawBlurredRRect(const Rect& rect,
   entity.SetBlendMode(new_paint.blend_mode);
   entity.SetContents(new_paint.WithFilters(std::move(contents)));
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 
   return true;
 }
@@ -201,13 +208,40 @@ void Canvas::DrawRect(Rect rect, const Paint& paint) {
   entity.SetStencilDepth(GetStencilDepth());
   entity.SetBlendMode(paint.blend_mode);
   entity.SetContents(paint.WithFilters(
-      paint.CreateContentsForGeometry(Geometry::MakeRect(rect))));
+      paint.CreateContentsForGeometry(Geometry::MakeRect(rect), arena_)));
+
+  GetCurrentPass().AddEntity(std::move(entity));
+}
+
+bool Canvas::AttemptDrawAnalyticRRect(const Rect& rect,
+                                      Size corner_radii,
+                                      const Paint& paint) {
+  if (paint.style != Paint::Style::kFill || paint.color_source.has_value() ||
+      paint.mask_blur_descriptor.has_value()) {
+    return false;
+  }
+
+  // Solid filled rounded rects, circles and ovals compute their coverage in
+  // the fragment shader instead of tessellating a path.
+  auto contents = CreateContents<RRectFillContents>();
+  contents->SetColor(paint.color);
+  contents->SetRRect(rect, corner_radii);
+
+  Entity entity;
+  entity.SetTransformation(GetCurrentTransformation());
+  entity.SetStencilDepth(GetStencilDepth());
+  entity.SetBlendMode(paint.blend_mode);
+  entity.SetContents(paint.WithFilters(std::move(contents)));
+
+  GetCurrentPass().AddEntity(std::move(entity));
 
-  GetCurrentPass().AddEntity(entity);
+  return true;
 }
 
 void Canvas::DrawRRect(Rect rect, Scalar corner_radius, const Paint& paint) {
-  if (AttemptDrawBlurredRRect(rect, corner_radius, paint)) {
+  if (AttemptDrawBlurredRRect(rect, corner_radius, paint) ||
+      AttemptDrawAnalyticRRect(rect, Size(corner_radius, corner_radius),
+                               paint)) {
     return;
   }
   DrawPath(PathBuilder{}.AddRoundedRect(rect, corner_radius).TakePath(), paint);
@@ -215,16 +249,38 @@ void Canvas::DrawRRect(Rect rect, Scalar corner_radius, const Paint& paint) {
 
 void Canvas::DrawCircle(Point center, Scalar radius, const Paint& paint) {
   Size half_size(radius, radius);
-  if (AttemptDrawBlurredRRect(Rect(center - half_size, half_size * 2), radius,
-                              paint)) {
+  Rect bounds(center - half_size, half_size * 2);
+  if (AttemptDrawBlurredRRect(bounds, radius, paint) ||
+      AttemptDrawAnalyticRRect(bounds, half_size, paint)) {
     return;
   }
   DrawPath(PathBuilder{}.AddCircle(center, radius).TakePath(), paint);
 }
 
-void Canvas::ClipPath(const Path& path, Entity::ClipOperation clip_op) {
-  auto contents = std::make_shared<ClipContents>();
-  contents->SetGeometry(Geometry::MakeFillPath(path));
+void Canvas::DrawOval(Rect rect, const Paint& paint) {
+  auto half_size = rect.GetPositive().size * 0.5;
+  if (half_size.width == half_size.height) {
+    DrawCircle(rect.GetPositive().origin + half_size, half_size.width, paint);
+    return;
+  }
+  if (AttemptDrawAnalyticRRect(rect, half_size, paint)) {
+    return;
+  }
+  DrawPath(PathBuilder{}.AddOval(rect).TakePath(), paint);
+}
+
+void Canvas::ClipPath(Path path, Entity::ClipOperation clip_op) {
+  ClipGeometry(Geometry::MakeFillPath(std::move(path)), clip_op);
+}
+
+void Canvas::ClipRect(const Rect& rect, Entity::ClipOperation clip_op) {
+  ClipGeometry(Geometry::MakeRect(rect), clip_op);
+}
+
+void Canvas::ClipGeometry(std::unique_ptr<Geometry> geometry,
+                          Entity::ClipOperation clip_op) {
+  auto contents = CreateContents<ClipContents>();
+  contents->SetGeometry(std::move(geometry));
   contents->SetClipOperation(clip_op);
 
   Entity entity;
@@ -232,7 +288,7 @@ void Canvas::ClipPath(const Path& path, Entity::ClipOperation clip_op) {
   entity.SetContents(std::move(contents));
   entity.SetStencilDepth(GetStencilDepth());
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 
   ++xformation_stack_.back().stencil_depth;
   xformation_stack_.back().contains_clips = true;
@@ -243,13 +299,13 @@ void Canvas::RestoreClip() {
   entity.SetTransformation(GetCurrentTransformation());
   // This path is empty because ClipRestoreContents just generates a quad that
   // takes up the full render target.
-  entity.SetContents(std::make_shared<ClipRestoreContents>());
+  entity.SetContents(CreateContents<ClipRestoreContents>());
   entity.SetStencilDepth(GetStencilDepth());
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 }
 
-void Canvas::DrawPicture(Picture picture) {
+void Canvas::DrawPicture(const Picture& picture) {
   if (!picture.pass) {
     return;
   }
@@ -261,7 +317,7 @@ void Canvas::DrawPicture(Picture picture) {
                              entity.GetTransformation());
     return true;
   });
-  return;
+  GetCurrentPass().AddSubpassInline(std::move(pass));
 }
 
 void Canvas::DrawImage(const std::shared_ptr<Image>& image,
@@ -303,10 +359,10 @@ void Canvas::DrawImageRect(const std::shared_ptr<Image>& image,
   Entity entity;
   entity.SetBlendMode(paint.blend_mode);
   entity.SetStencilDepth(GetStencilDepth());
-  entity.SetContents(paint.WithFilters(contents, false));
+  entity.SetContents(paint.WithFilters(std::move(contents), false));
   entity.SetTransformation(GetCurrentTransformation());
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 }
 
 Picture Canvas::EndRecordingAsPicture() {
@@ -319,6 +375,13 @@ Picture Canvas::EndRecordingAsPicture() {
   return picture;
 }
 
+std::unique_ptr<EntityPass> Canvas::CreateEntityPass() {
+  if (pass_pool_) {
+    return pass_pool_->Take();
+  }
+  return std::make_unique<EntityPass>();
+}
+
 EntityPass& Canvas::GetCurrentPass() {
   FML_DCHECK(current_pass_ != nullptr);
   return *current_pass_;
@@ -344,7 +407,7 @@ void Canvas::SaveLayer(
     // the size of the render target that would have been allocated will be
     // absent. Explicitly add back a clip to reproduce that behavior. Since
     // clips never require a render target switch, this is a cheap operation.
-    ClipPath(PathBuilder{}.AddRect(bounds.value()).TakePath());
+    ClipRect(bounds.value());
   }
 }
 
@@ -355,7 +418,7 @@ void Canvas::DrawTextFrame(const TextFrame& text_frame,
 
   lazy_glyph_atlas->AddTextFrame(text_frame);
 
-  auto text_contents = std::make_shared<TextContents>();
+  auto text_contents = CreateContents<TextContents>();
   text_contents->SetTextFrame(text_frame);
   text_contents->SetGlyphAtlas(std::move(lazy_glyph_atlas));
   text_contents->SetColor(paint.color);
@@ -367,7 +430,7 @@ void Canvas::DrawTextFrame(const TextFrame& text_frame,
   entity.SetBlendMode(paint.blend_mode);
   entity.SetContents(paint.WithFilters(std::move(text_contents), true));
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 }
 
 void Canvas::DrawVertices(const Vertices& vertices,
@@ -387,15 +450,14 @@ void Canvas::DrawVertices(const Vertices& vertices,
     contents->SetAlpha(paint.color.alpha);
     entity.SetContents(paint.WithFilters(std::move(contents), true));
   } else {
-    std::shared_ptr<VerticesContents> contents =
-        std::make_shared<VerticesContents>();
+    auto contents = CreateContents<VerticesContents>();
     contents->SetColor(paint.color);
     contents->SetBlendMode(blend_mode);
     contents->SetGeometry(std::move(geometry));
     entity.SetContents(paint.WithFilters(std::move(contents), true));
   }
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 }
 
 void Canvas::DrawAtlas(const std::shared_ptr<Image>& atlas,
@@ -415,7 +477,7 @@ void Canvas::DrawAtlas(const std::shared_ptr<Image>& atlas,
     return;
   }
 
-  std::shared_ptr<AtlasContents> contents = std::make_shared<AtlasContents>();
+  auto contents = CreateContents<AtlasContents>();
   contents->SetColors(std::move(colors));
   contents->SetTransforms(std::move(transforms));
   contents->SetTextureCoordinates(std::move(texture_coordinates));
@@ -429,9 +491,9 @@ void Canvas::DrawAtlas(const std::shared_ptr<Image>& atlas,
   entity.SetTransformation(GetCurrentTransformation());
   entity.SetStencilDepth(GetStencilDepth());
   entity.SetBlendMode(paint.blend_mode);
-  entity.SetContents(paint.WithFilters(contents, false));
+  entity.SetContents(paint.WithFilters(std::move(contents), false));
 
-  GetCurrentPass().AddEntity(entity);
+  GetCurrentPass().AddEntity(std::move(entity));
 }
 
 }  // namespace impeller
@@ -10,10 +10,13 @@
 #include <vector>
 
 #include "flutter/fml/macros.h"
+#include "impeller/aiks/entity_pass_pool.h"
 #include "impeller/aiks/image.h"
 #include "impeller/aiks/paint.h"
 #include "impeller/aiks/picture.h"
+#include "impeller/base/arena.h"
 #include "impeller/entity/entity_pass.h"
+#include "impeller/entity/geometry.h"
 #include "impeller/geometry/matrix.h"
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/point.h"
@@ -31,6 +34,13 @@ class Canvas {
  public:
   Canvas();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Create a canvas that records into passes taken from
+  ///             `pass_pool`, so that pictures recycled into the pool after
+  ///             they are rendered lend their storage to later pictures.
+  ///
+  explicit Canvas(std::shared_ptr<EntityPassPool> pass_pool);
+
   ~Canvas();
 
   void Save();
@@ -66,7 +76,7 @@ class Canvas {
 
   void Rotate(Radians radians);
 
-  void DrawPath(const Path& path, const Paint& paint);
+  void DrawPath(Path path, const Paint& paint);
 
   void DrawPaint(const Paint& paint);
 
@@ -76,6 +86,8 @@ class Canvas {
 
   void DrawCircle(Point center, Scalar radius, const Paint& paint);
 
+  void DrawOval(Rect rect, const Paint& paint);
+
   void DrawImage(const std::shared_ptr<Image>& image,
                  Point offset,
                  const Paint& paint,
@@ -88,10 +100,14 @@ class Canvas {
                      SamplerDescriptor sampler = {});
 
   void ClipPath(
-      const Path& path,
+      Path path,
+      Entity::ClipOperation clip_op = Entity::ClipOperation::kIntersect);
+
+  void ClipRect(
+      const Rect& rect,
       Entity::ClipOperation clip_op = Entity::ClipOperation::kIntersect);
 
-  void DrawPicture(Picture picture);
+  void DrawPicture(const Picture& picture);
 
   void DrawTextFrame(const TextFrame& text_frame,
                      Point position,
@@ -113,12 +129,23 @@ class Canvas {
   Picture EndRecordingAsPicture();
 
  private:
+  std::shared_ptr<EntityPassPool> pass_pool_;
+  // The contents that this canvas creates for the picture being recorded are
+  // allocated from this arena, which lives as long as the last of them.
+  std::shared_ptr<Arena> arena_;
   std::unique_ptr<EntityPass> base_pass_;
   EntityPass* current_pass_ = nullptr;
   std::deque<CanvasStackEntry> xformation_stack_;
 
   void Initialize();
 
+  std::unique_ptr<EntityPass> CreateEntityPass();
+
+  template <class T>
+  std::shared_ptr<T> CreateContents() const {
+    return std::allocate_shared<T>(ArenaAllocator<T>(arena_));
+  }
+
   void Reset();
 
   EntityPass& GetCurrentPass();
@@ -132,10 +159,17 @@ class Canvas {
 
   void RestoreClip();
 
+  void ClipGeometry(std::unique_ptr<Geometry> geometry,
+                    Entity::ClipOperation clip_op);
+
   bool AttemptDrawBlurredRRect(const Rect& rect,
                                Scalar corner_radius,
                                const Paint& paint);
 
+  bool AttemptDrawAnalyticRRect(const Rect& rect,
+                                Size corner_radii,
+                                const Paint& paint);
+
   FML_DISALLOW_COPY_AND_ASSIGN(Canvas);
 };
 
@@ -0,0 +1,57 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/aiks/entity_pass_pool.h"
+
+#include <utility>
+
+namespace impeller {
+
+EntityPassPool::EntityPassPool() = default;
+
+EntityPassPool::~EntityPassPool() = default;
+
+std::unique_ptr<EntityPass> EntityPassPool::Take() {
+  {
+    Lock lock(mutex_);
+    if (!passes_.empty()) {
+      auto pass = std::move(passes_.back());
+      passes_.pop_back();
+      return pass;
+    }
+  }
+  return std::make_unique<EntityPass>();
+}
+
+void EntityPassPool::Recycle(Picture picture) {
+  Recycle(std::move(picture.pass));
+}
+
+void EntityPassPool::Recycle(std::unique_ptr<EntityPass> pass) {
+  // Deep pass trees are flattened instead of recursing.
+  std::vector<std::unique_ptr<EntityPass>> pending;
+  if (pass) {
+    pending.push_back(std::move(pass));
+  }
+  while (!pending.empty()) {
+    auto next = std::move(pending.back());
+    pending.pop_back();
+    // Resetting the pass releases the contents of its entities, which may be
+    // slow, so it happens outside of the lock.
+    for (auto& subpass : next->Reset()) {
+      pending.push_back(std::move(subpass));
+    }
+    Lock lock(mutex_);
+    if (passes_.size() < kMaxPooledPasses) {
+      passes_.push_back(std::move(next));
+    }
+  }
+}
+
+size_t EntityPassPool::GetSize() const {
+  Lock lock(mutex_);
+  return passes_.size();
+}
+
+}  // namespace impeller
@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/aiks/picture.h"
+#include "impeller/base/thread.h"
+#include "impeller/entity/entity_pass.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Keeps the entity passes of pictures that have been rendered so
+///             that later pictures can be recorded into them. A recycled pass
+///             keeps the storage of its elements, so recording a frame that
+///             looks like the previous one doesn't grow any vectors.
+///
+class EntityPassPool {
+ public:
+  /// The maximum number of passes kept for reuse. Passes recycled beyond that
+  /// are destroyed.
+  static constexpr size_t kMaxPooledPasses = 64u;
+
+  EntityPassPool();
+
+  ~EntityPassPool();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Take a pass from the pool, or create a new one if the pool is
+  ///             empty. The pass is in the state of a newly created pass.
+  ///
+  std::unique_ptr<EntityPass> Take();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reset the passes of a picture that is no longer needed, and
+  ///             add them to the pool.
+  ///
+  void Recycle(Picture picture);
+
+  void Recycle(std::unique_ptr<EntityPass> pass);
+
+  size_t GetSize() const;
+
+ private:
+  mutable Mutex mutex_;
+  std::vector<std::unique_ptr<EntityPass>> passes_ IPLR_GUARDED_BY(mutex_);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(EntityPassPool);
+};
+
+}  // namespace impeller
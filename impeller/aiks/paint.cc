@@ -8,25 +8,29 @@
 
 namespace impeller {
 
-std::shared_ptr<Contents> Paint::CreateContentsForEntity(const Path& path,
-                                                         bool cover) const {
+std::shared_ptr<Contents> Paint::CreateContentsForEntity(
+    Path path,
+    bool cover,
+    const std::shared_ptr<Arena>& arena) const {
   std::unique_ptr<Geometry> geometry;
   switch (style) {
     case Style::kFill:
-      geometry = cover ? Geometry::MakeCover() : Geometry::MakeFillPath(path);
+      geometry = cover ? Geometry::MakeCover()
+                       : Geometry::MakeFillPath(std::move(path));
       break;
     case Style::kStroke:
-      geometry =
-          cover ? Geometry::MakeCover()
-                : Geometry::MakeStrokePath(path, stroke_width, stroke_miter,
-                                           stroke_cap, stroke_join);
+      geometry = cover ? Geometry::MakeCover()
+                       : Geometry::MakeStrokePath(std::move(path), stroke_width,
+                                                  stroke_miter, stroke_cap,
+                                                  stroke_join);
       break;
   }
-  return CreateContentsForGeometry(std::move(geometry));
+  return CreateContentsForGeometry(std::move(geometry), arena);
 }
 
 std::shared_ptr<Contents> Paint::CreateContentsForGeometry(
-    std::unique_ptr<Geometry> geometry) const {
+    std::unique_ptr<Geometry> geometry,
+    const std::shared_ptr<Arena>& arena) const {
   if (color_source.has_value()) {
     auto& source = color_source.value();
     auto contents = source();
@@ -34,7 +38,10 @@ std::shared_ptr<Contents> Paint::CreateContentsForGeometry(
     contents->SetAlpha(color.alpha);
     return contents;
   }
-  auto solid_color = std::make_shared<SolidColorContents>();
+  auto solid_color =
+      arena ? std::allocate_shared<SolidColorContents>(
+                  ArenaAllocator<SolidColorContents>(arena))
+            : std::make_shared<SolidColorContents>();
   solid_color->SetGeometry(std::move(geometry));
   solid_color->SetColor(color);
   return solid_color;
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "flutter/fml/macros.h"
+#include "impeller/base/arena.h"
 #include "impeller/entity/contents/contents.h"
 #include "impeller/entity/contents/filters/color_filter_contents.h"
 #include "impeller/entity/contents/filters/filter_contents.h"
@@ -88,11 +89,19 @@ struct Paint {
       std::shared_ptr<Contents> input,
       const Matrix& effect_transform = Matrix()) const;
 
-  std::shared_ptr<Contents> CreateContentsForEntity(const Path& path = {},
-                                                    bool cover = false) const;
+  /// @brief      Create the contents that fill or stroke `path` with this
+  ///             paint, without its filters.
+  /// @param[in]  path   The path to draw. It is moved into the geometry.
+  /// @param[in]  cover  Whether to cover the whole render target instead.
+  /// @param[in]  arena  If set, solid color contents are allocated from it.
+  std::shared_ptr<Contents> CreateContentsForEntity(
+      Path path = {},
+      bool cover = false,
+      const std::shared_ptr<Arena>& arena = nullptr) const;
 
   std::shared_ptr<Contents> CreateContentsForGeometry(
-      std::unique_ptr<Geometry> geometry) const;
+      std::unique_ptr<Geometry> geometry,
+      const std::shared_ptr<Arena>& arena = nullptr) const;
 
  private:
   std::shared_ptr<Contents> WithMaskBlur(std::shared_ptr<Contents> input,
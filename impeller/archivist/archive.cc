@@ -26,6 +26,23 @@ bool Archive::IsValid() const {
   return database_->IsValid();
 }
 
+bool Archive::WriteInTransaction(const std::function<bool()>& writes) {
+  if (!IsValid()) {
+    return false;
+  }
+
+  /*
+   *  Transactions nest, so the writes in the callback only commit along with
+   *  this outermost one.
+   */
+  auto transaction = database_->CreateTransaction(transaction_count_);
+  if (!writes()) {
+    return false;
+  }
+  transaction.MarkWritesAsReadyForCommit();
+  return true;
+}
+
 std::optional<int64_t /* row id */> Archive::ArchiveInstance(
     const ArchiveDef& definition,
     const Archivable& archivable) {
@@ -41,6 +41,18 @@ class Archive {
     return UnarchiveInstance(def, name, archivable);
   }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Perform the writes made by `writes` in a single transaction.
+  ///             Writes are otherwise committed one at a time, which makes
+  ///             writing many small archivables expensive.
+  ///
+  /// @param[in]  writes  Makes the writes, and returns false if they must be
+  ///                     rolled back.
+  ///
+  /// @return     If the writes were committed.
+  ///
+  [[nodiscard]] bool WriteInTransaction(const std::function<bool()>& writes);
+
   using UnarchiveStep = std::function<bool(ArchiveLocation&)>;
 
   template <class T,
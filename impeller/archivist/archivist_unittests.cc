@@ -179,6 +179,43 @@ TEST_F(ArchiveTest, ReadDataWithNames) {
   }
 }
 
+TEST_F(ArchiveTest, WriteInTransactionCommitsAllWrites) {
+  Archive archive(GetArchiveFileName().c_str());
+  ASSERT_TRUE(archive.IsValid());
+
+  std::vector<PrimaryKey::value_type> keys;
+  ASSERT_TRUE(archive.WriteInTransaction([&]() {
+    for (size_t i = 0; i < 100; i++) {
+      Sample sample(i + 1);
+      keys.push_back(sample.GetPrimaryKey().value());
+      if (!archive.Write(sample)) {
+        return false;
+      }
+    }
+    return true;
+  }));
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    Sample sample;
+    ASSERT_TRUE(archive.Read(keys[i], sample));
+    ASSERT_EQ(sample.GetSomeData(), i + 1);
+  }
+}
+
+TEST_F(ArchiveTest, WriteInTransactionRollsBackFailedWrites) {
+  Archive archive(GetArchiveFileName().c_str());
+  ASSERT_TRUE(archive.IsValid());
+
+  Sample sample(7);
+  ASSERT_FALSE(archive.WriteInTransaction([&]() {
+    EXPECT_TRUE(archive.Write(sample));
+    return false;
+  }));
+
+  Sample read;
+  ASSERT_FALSE(archive.Read(sample.GetPrimaryKey(), read));
+}
+
 TEST_F(ArchiveTest, CanReadWriteVectorOfArchivables) {
   Archive archive(GetArchiveFileName().c_str());
   ASSERT_TRUE(archive.IsValid());
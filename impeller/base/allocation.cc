@@ -31,9 +31,13 @@ size_t Allocation::GetReservedLength() const {
 }
 
 bool Allocation::Truncate(size_t length, bool npot) {
-  const auto reserved = npot ? ReserveNPOT(length) : Reserve(length);
-  if (!reserved) {
-    return false;
+  // Shrinking only updates the length so that allocations that are reset and
+  // reused (such as recycled host buffers) retain their reservation.
+  if (length > reserved_ || reserved_ == 0u) {
+    const auto reserved = npot ? ReserveNPOT(length) : Reserve(length);
+    if (!reserved) {
+      return false;
+    }
   }
   length_ = length;
   return true;
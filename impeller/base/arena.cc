@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/base/arena.h"
+
+#include "flutter/fml/logging.h"
+
+namespace impeller {
+
+Arena::Arena() = default;
+
+Arena::~Arena() = default;
+
+void* Arena::Allocate(size_t size, size_t alignment) {
+  FML_DCHECK(alignment > 0u && (alignment & (alignment - 1u)) == 0u);
+  FML_DCHECK(alignment <= alignof(std::max_align_t));
+  if (size == 0u) {
+    size = 1u;
+  }
+
+  // Blocks are aligned to max_align_t, so large allocations can use the
+  // start of their own block.
+  if (size > kBlockSize / 4u) {
+    blocks_.emplace_back(new uint8_t[size]);
+    allocated_bytes_ += size;
+    return blocks_.back().get();
+  }
+
+  auto misalignment = reinterpret_cast<uintptr_t>(cursor_) % alignment;
+  size_t padding = misalignment == 0u ? 0u : alignment - misalignment;
+  if (cursor_ == nullptr || padding + size > remaining_) {
+    // The blocks are not zeroed. The objects placed in them are constructed
+    // by the caller.
+    blocks_.emplace_back(new uint8_t[kBlockSize]);
+    cursor_ = blocks_.back().get();
+    remaining_ = kBlockSize;
+    padding = 0u;
+  }
+
+  auto result = cursor_ + padding;
+  cursor_ += padding + size;
+  remaining_ -= padding + size;
+  allocated_bytes_ += size;
+  return result;
+}
+
+size_t Arena::GetBlockCount() const {
+  return blocks_.size();
+}
+
+size_t Arena::GetAllocatedBytes() const {
+  return allocated_bytes_;
+}
+
+}  // namespace impeller
@@ -0,0 +1,96 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A bump allocator for many small objects that share a lifetime,
+///             like the contents recorded into a picture. Allocations are
+///             carved out of large blocks, and the memory is only returned
+///             when the arena is destroyed.
+///
+///             An arena must only be allocated from on one thread at a time.
+///             Objects are usually placed in an arena with an `ArenaAllocator`
+///             and `std::allocate_shared`, which keeps the arena alive until
+///             the last of them is released.
+///
+class Arena {
+ public:
+  static constexpr size_t kBlockSize = 16u * 1024u;
+
+  Arena();
+
+  ~Arena();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Allocate `size` bytes aligned to `alignment`, which must be a
+  ///             power of two no larger than `alignof(std::max_align_t)`.
+  ///             Allocations larger than a quarter of a block get a block of
+  ///             their own so that they don't waste the rest of the current
+  ///             block.
+  ///
+  [[nodiscard]] void* Allocate(size_t size, size_t alignment);
+
+  size_t GetBlockCount() const;
+
+  size_t GetAllocatedBytes() const;
+
+ private:
+  std::vector<std::unique_ptr<uint8_t[]>> blocks_;
+  uint8_t* cursor_ = nullptr;
+  size_t remaining_ = 0u;
+  size_t allocated_bytes_ = 0u;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(Arena);
+};
+
+//------------------------------------------------------------------------------
+/// @brief      A standard allocator that allocates from an arena. Memory is
+///             not reclaimed when it is deallocated, only when the arena is
+///             destroyed.
+///
+template <class T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(std::shared_ptr<Arena> arena)
+      : arena_(std::move(arena)) {}
+
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U>& other)  // NOLINT
+      : arena_(other.GetArena()) {}
+
+  T* allocate(size_t count) {
+    return static_cast<T*>(arena_->Allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* pointer, size_t count) {}
+
+  const std::shared_ptr<Arena>& GetArena() const { return arena_; }
+
+  template <class U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return arena_ == other.GetArena();
+  }
+
+  template <class U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return arena_ != other.GetArena();
+  }
+
+ private:
+  std::shared_ptr<Arena> arena_;
+};
+
+}  // namespace impeller
@@ -2,7 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <thread>
+
 #include "flutter/testing/testing.h"
+#include "impeller/base/arena.h"
+#include "impeller/base/lock_free_lookup_table.h"
 #include "impeller/base/thread.h"
 
 namespace impeller {
@@ -68,5 +72,106 @@ TEST(ThreadTest, CanCreateRWMutexLock) {
   // f.mtx.UnlockReader(); <--- Static analysis error.
 }
 
+TEST(LockFreeLookupTableTest, CanInsertAndFind) {
+  LockFreeLookupTable<int> table(2u);
+  ASSERT_EQ(table.Find(1u), nullptr);
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(*table.Insert(i, std::make_unique<int>(i * 10)), i * 10);
+  }
+  ASSERT_EQ(table.GetSize(), 100u);
+  for (int i = 0; i < 100; i++) {
+    ASSERT_NE(table.Find(i), nullptr);
+    ASSERT_EQ(*table.Find(i), i * 10);
+  }
+  ASSERT_EQ(table.Find(100u), nullptr);
+}
+
+TEST(LockFreeLookupTableTest, InsertKeepsExistingValue) {
+  LockFreeLookupTable<int> table;
+  int* first = table.Insert(7u, std::make_unique<int>(1));
+  int* second = table.Insert(7u, std::make_unique<int>(2));
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(*table.Find(7u), 1);
+  ASSERT_EQ(table.GetSize(), 1u);
+  ASSERT_EQ(table.Insert(8u, nullptr), nullptr);
+  ASSERT_EQ(table.GetSize(), 1u);
+}
+
+TEST(LockFreeLookupTableTest, CanFindWhileInserting) {
+  LockFreeLookupTable<int> table(2u);
+  constexpr int kCount = 2048;
+  std::atomic<bool> done = false;
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; i++) {
+    readers.emplace_back([&table, &done]() {
+      while (!done.load()) {
+        for (int key = 0; key < kCount; key++) {
+          if (auto value = table.Find(key)) {
+            // A reader that sees a key must also see its value.
+            ASSERT_EQ(*value, key);
+          }
+        }
+      }
+    });
+  }
+  for (int key = 0; key < kCount; key++) {
+    table.Insert(key, std::make_unique<int>(key));
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  ASSERT_EQ(table.GetSize(), static_cast<size_t>(kCount));
+}
+
+TEST(ArenaTest, AllocationsShareBlocks) {
+  Arena arena;
+  ASSERT_EQ(arena.GetBlockCount(), 0u);
+  auto first = static_cast<uint8_t*>(arena.Allocate(3u, 1u));
+  auto second = static_cast<uint8_t*>(arena.Allocate(8u, 8u));
+  ASSERT_EQ(arena.GetBlockCount(), 1u);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(second) % 8u, 0u);
+  ASSERT_GE(second, first + 3u);
+  ASSERT_EQ(arena.GetAllocatedBytes(), 11u);
+
+  // Filling the block starts a new one.
+  for (size_t i = 0; i < Arena::kBlockSize / 64u; i++) {
+    ASSERT_NE(arena.Allocate(64u, 8u), nullptr);
+  }
+  ASSERT_EQ(arena.GetBlockCount(), 2u);
+}
+
+TEST(ArenaTest, LargeAllocationsGetTheirOwnBlock) {
+  Arena arena;
+  auto small = static_cast<uint8_t*>(arena.Allocate(16u, 8u));
+  ASSERT_NE(arena.Allocate(Arena::kBlockSize, 8u), nullptr);
+  ASSERT_EQ(arena.GetBlockCount(), 2u);
+  // The rest of the first block is still used.
+  auto next = static_cast<uint8_t*>(arena.Allocate(16u, 8u));
+  ASSERT_EQ(next, small + 16u);
+  ASSERT_EQ(arena.GetBlockCount(), 2u);
+}
+
+TEST(ArenaTest, SharedObjectsKeepTheArenaAlive) {
+  struct Counted {
+    explicit Counted(int* destroyed) : destroyed_(destroyed) {}
+    ~Counted() { (*destroyed_)++; }
+    int* destroyed_;
+  };
+
+  int destroyed = 0;
+  auto arena = std::make_shared<Arena>();
+  std::weak_ptr<Arena> weak_arena = arena;
+  auto object =
+      std::allocate_shared<Counted>(ArenaAllocator<Counted>(arena), &destroyed);
+  ASSERT_EQ(arena->GetBlockCount(), 1u);
+  arena.reset();
+  ASSERT_FALSE(weak_arena.expired());
+
+  object.reset();
+  ASSERT_EQ(destroyed, 1);
+  ASSERT_TRUE(weak_arena.expired());
+}
+
 }  // namespace testing
 }  // namespace impeller
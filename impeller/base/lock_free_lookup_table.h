@@ -0,0 +1,161 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/macros.h"
+#include "impeller/base/thread.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A table from integer keys to values that any number of threads
+///             can read without locking while other threads insert into it.
+///
+///             Lookups probe an open addressed array of atomic slots. Inserts
+///             are serialized by a mutex and publish the value of a slot
+///             before its key, so a reader that sees a key also sees its
+///             value. When the array is half full, it is replaced by an array
+///             of twice the size.
+///
+///             Entries can't be removed. Values and replaced arrays live as
+///             long as the table, so pointers returned to readers never
+///             dangle.
+///
+template <class T>
+class LockFreeLookupTable {
+ public:
+  using Key = uint64_t;
+
+  /// The only key that can't be inserted.
+  static constexpr Key kEmptyKey = std::numeric_limits<Key>::max();
+
+  explicit LockFreeLookupTable(size_t initial_capacity = 16u) {
+    size_t capacity = 2u;
+    while (capacity < initial_capacity) {
+      capacity *= 2u;
+    }
+    auto slots = std::make_unique<Slots>(capacity);
+    slots_.store(slots.get(), std::memory_order_relaxed);
+    all_slots_.push_back(std::move(slots));
+  }
+
+  ~LockFreeLookupTable() = default;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the value of a key. This never blocks.
+  ///
+  /// @return     The value, or nullptr if there is no value for the key yet.
+  ///
+  T* Find(Key key) const {
+    return FindIn(*slots_.load(std::memory_order_acquire), key);
+  }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Insert a value for a key unless the key already has one.
+  ///
+  /// @return     The value of the key in the table. This is the existing value
+  ///             if another thread won the race to insert it, in which case
+  ///             `value` is discarded. Null values are never inserted.
+  ///
+  T* Insert(Key key, std::unique_ptr<T> value) {
+    FML_DCHECK(key != kEmptyKey);
+    Lock lock(mutex_);
+    Slots* slots = slots_.load(std::memory_order_relaxed);
+    if (auto found = FindIn(*slots, key)) {
+      return found;
+    }
+    if (!value) {
+      return nullptr;
+    }
+    if ((values_.size() + 1u) * 2u > slots->capacity) {
+      auto grown = std::make_unique<Slots>(slots->capacity * 2u);
+      for (size_t i = 0u; i < slots->capacity; i++) {
+        const auto& slot = slots->slots[i];
+        const Key slot_key = slot.key.load(std::memory_order_relaxed);
+        if (slot_key != kEmptyKey) {
+          Place(*grown, slot_key, slot.value.load(std::memory_order_relaxed));
+        }
+      }
+      slots = grown.get();
+      slots_.store(slots, std::memory_order_release);
+      // Readers may still be probing the old array.
+      all_slots_.push_back(std::move(grown));
+    }
+    T* result = value.get();
+    values_.push_back(std::move(value));
+    Place(*slots, key, result);
+    size_.store(values_.size(), std::memory_order_relaxed);
+    return result;
+  }
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of values in the table.
+  ///
+  size_t GetSize() const { return size_.load(std::memory_order_relaxed); }
+
+ private:
+  struct Slot {
+    std::atomic<Key> key = kEmptyKey;
+    std::atomic<T*> value = nullptr;
+  };
+
+  struct Slots {
+    explicit Slots(size_t p_capacity)
+        : capacity(p_capacity), slots(std::make_unique<Slot[]>(p_capacity)) {}
+
+    const size_t capacity;
+    const std::unique_ptr<Slot[]> slots;
+  };
+
+  std::atomic<Slots*> slots_;
+  std::atomic<size_t> size_ = 0u;
+  Mutex mutex_;
+  std::vector<std::unique_ptr<Slots>> all_slots_ IPLR_GUARDED_BY(mutex_);
+  std::vector<std::unique_ptr<T>> values_ IPLR_GUARDED_BY(mutex_);
+
+  static size_t GetHome(const Slots& slots, Key key) {
+    // Keys are often small and dense, so they are scrambled to spread them
+    // across the array.
+    key *= 0x9e3779b97f4a7c15u;
+    return static_cast<size_t>(key ^ (key >> 32u)) & (slots.capacity - 1u);
+  }
+
+  static T* FindIn(const Slots& slots, Key key) {
+    const size_t mask = slots.capacity - 1u;
+    for (size_t i = GetHome(slots, key), probes = 0u;
+         probes < slots.capacity; i = (i + 1u) & mask, probes++) {
+      const auto& slot = slots.slots[i];
+      const Key slot_key = slot.key.load(std::memory_order_acquire);
+      if (slot_key == key) {
+        return slot.value.load(std::memory_order_relaxed);
+      }
+      if (slot_key == kEmptyKey) {
+        return nullptr;
+      }
+    }
+    return nullptr;
+  }
+
+  static void Place(Slots& slots, Key key, T* value) {
+    const size_t mask = slots.capacity - 1u;
+    size_t i = GetHome(slots, key);
+    while (slots.slots[i].key.load(std::memory_order_relaxed) != kEmptyKey) {
+      i = (i + 1u) & mask;
+    }
+    slots.slots[i].value.store(value, std::memory_order_relaxed);
+    slots.slots[i].key.store(key, std::memory_order_release);
+  }
+
+  FML_DISALLOW_COPY_AND_ASSIGN(LockFreeLookupTable);
+};
+
+}  // namespace impeller
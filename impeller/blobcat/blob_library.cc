@@ -47,18 +47,24 @@ BlobLibrary::BlobLibrary(std::shared_ptr<fml::Mapping> payload)
       BlobKey key;
       key.name = i->name()->str();
       key.type = ToShaderType(i->stage());
-      blobs_[key] = std::make_shared<fml::NonOwnedMapping>(
-          i->mapping()->Data(), i->mapping()->size(),
-          [payload = payload_](auto, auto) {
-            // The pointers are into the base payload. Instead of copying the
-            // data, just hold onto the payload.
-          });
+      BlobRange range;
+      range.offset = static_cast<size_t>(i->mapping()->Data() -
+                                         payload_->GetMapping());
+      range.length = i->mapping()->size();
+      blobs_[key] = range;
     }
   }
 
   is_valid_ = true;
 }
 
+BlobLibrary BlobLibrary::CreateFromFile(const fml::UniqueFD& base_directory,
+                                        const std::string& path) {
+  std::shared_ptr<fml::Mapping> mapping =
+      fml::FileMapping::CreateReadOnly(base_directory, path);
+  return BlobLibrary{std::move(mapping)};
+}
+
 BlobLibrary::BlobLibrary(BlobLibrary&&) = default;
 
 BlobLibrary::~BlobLibrary() = default;
@@ -77,7 +83,7 @@ std::shared_ptr<fml::Mapping> BlobLibrary::GetMapping(BlobShaderType type,
   key.type = type;
   key.name = std::move(name);
   auto found = blobs_.find(key);
-  return found == blobs_.end() ? nullptr : found->second;
+  return found == blobs_.end() ? nullptr : CreateBlobMapping(found->second);
 }
 
 size_t BlobLibrary::IterateAllBlobs(
@@ -91,11 +97,22 @@ size_t BlobLibrary::IterateAllBlobs(
   size_t count = 0u;
   for (const auto& blob : blobs_) {
     count++;
-    if (!callback(blob.first.type, blob.first.name, blob.second)) {
+    if (!callback(blob.first.type, blob.first.name,
+                  CreateBlobMapping(blob.second))) {
       break;
     }
   }
   return count;
 }
 
+std::shared_ptr<fml::Mapping> BlobLibrary::CreateBlobMapping(
+    const BlobRange& range) const {
+  return std::make_shared<fml::NonOwnedMapping>(
+      payload_->GetMapping() + range.offset, range.length,
+      [payload = payload_](auto, auto) {
+        // The pointers are into the base payload. Instead of copying the
+        // data, just hold onto the payload.
+      });
+}
+
 }  // namespace impeller
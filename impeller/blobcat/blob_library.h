@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 
@@ -15,10 +16,24 @@
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      A read-only view of a blob container. The container is only
+///             indexed on construction. Mappings for individual blobs are
+///             slices of the payload that are created when requested and
+///             never copy the blob data.
+///
 class BlobLibrary {
  public:
   explicit BlobLibrary(std::shared_ptr<fml::Mapping> payload);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Create a blob library backed by a read-only memory mapping
+  ///             of the file at the given path. Pages of the file are only
+  ///             faulted in when the blobs in them are accessed.
+  ///
+  static BlobLibrary CreateFromFile(const fml::UniqueFD& base_directory,
+                                    const std::string& path);
+
   BlobLibrary(BlobLibrary&&);
 
   ~BlobLibrary();
@@ -56,8 +71,14 @@ class BlobLibrary {
     };
   };
 
+  // The location of a blob in the payload.
+  struct BlobRange {
+    size_t offset = 0u;
+    size_t length = 0u;
+  };
+
   using Blobs = std::unordered_map<BlobKey,
-                                   std::shared_ptr<fml::Mapping>,
+                                   BlobRange,
                                    BlobKey::Hash,
                                    BlobKey::Equal>;
 
@@ -65,6 +86,9 @@ class BlobLibrary {
   Blobs blobs_;
   bool is_valid_ = false;
 
+  std::shared_ptr<fml::Mapping> CreateBlobMapping(
+      const BlobRange& range) const;
+
   FML_DISALLOW_COPY_AND_ASSIGN(BlobLibrary);
 };
 
@@ -4,6 +4,7 @@
 
 #include <string>
 
+#include "flutter/fml/file.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/testing/testing.h"
 #include "impeller/blobcat/blob_library.h"
@@ -53,5 +54,32 @@ TEST(BlobTest, CanReadAndWriteBlobs) {
   ASSERT_EQ(CreateStringFromMapping(*hello_vtx), "World");
 }
 
+TEST(BlobTest, CanReadBlobsFromFileMapping) {
+  BlobWriter writer;
+  ASSERT_TRUE(writer.AddBlob(BlobShaderType::kVertex, "Hello",
+                             CreateMappingFromString("World")));
+  ASSERT_TRUE(writer.AddBlob(BlobShaderType::kFragment, "Foo",
+                             CreateMappingFromString("Bar")));
+
+  auto mapping = writer.CreateMapping();
+  ASSERT_NE(mapping, nullptr);
+
+  fml::ScopedTemporaryDirectory temp_dir;
+  ASSERT_TRUE(fml::WriteAtomically(temp_dir.fd(), "shaders.blob", *mapping));
+
+  std::shared_ptr<fml::Mapping> hello_vtx;
+  {
+    auto library = BlobLibrary::CreateFromFile(temp_dir.fd(), "shaders.blob");
+    ASSERT_TRUE(library.IsValid());
+    ASSERT_EQ(library.GetShaderCount(), 2u);
+    hello_vtx = library.GetMapping(BlobShaderType::kVertex, "Hello");
+  }
+
+  // Slices keep the file mapping alive past the library.
+  ASSERT_NE(hello_vtx, nullptr);
+  ASSERT_EQ(CreateStringFromMapping(*hello_vtx), "World");
+  ASSERT_TRUE(fml::UnlinkFile(temp_dir.fd(), "shaders.blob"));
+}
+
 }  // namespace testing
 }  // namespace impeller
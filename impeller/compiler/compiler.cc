@@ -34,6 +34,11 @@ static CompilerBackend CreateMSLCompiler(const spirv_cross::ParsedIR& ir,
   // Metal to AIR must be updated as well.
   sl_options.msl_version =
       spirv_cross::CompilerMSL::Options::make_msl_version(1, 2);
+  // Subpass inputs read the color attachment directly using programmable
+  // blending. On macOS, this needs a newer Metal version, so they are
+  // emulated with textures there and never used.
+  sl_options.use_framebuffer_fetch_subpasses =
+      source_options.target_platform == TargetPlatform::kMetalIOS;
   sl_compiler->set_msl_options(sl_options);
   return CompilerBackend(sl_compiler);
 }
@@ -52,6 +57,13 @@ static CompilerBackend CreateGLSLCompiler(const spirv_cross::ParsedIR& ir,
     sl_options.es = false;
   }
   gl_compiler->set_common_options(sl_options);
+  // Subpass inputs read the color attachment using
+  // GL_EXT_shader_framebuffer_fetch.
+  for (const auto& input : gl_compiler->get_shader_resources().subpass_inputs) {
+    auto index = gl_compiler->get_decoration(
+        input.id, spv::DecorationInputAttachmentIndex);
+    gl_compiler->remap_ext_framebuffer_fetch(index, index, true);
+  }
   return CompilerBackend(gl_compiler);
 }
 
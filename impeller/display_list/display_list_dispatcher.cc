@@ -18,6 +18,7 @@
 #include "display_list/display_list_path_effect.h"
 #include "display_list/display_list_tile_mode.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/display_list/display_list_image_impeller.h"
 #include "impeller/display_list/nine_patch_converter.h"
@@ -48,6 +49,13 @@ namespace impeller {
 
 DisplayListDispatcher::DisplayListDispatcher() = default;
 
+DisplayListDispatcher::DisplayListDispatcher(
+    std::shared_ptr<DisplayListPictureCache> picture_cache,
+    std::shared_ptr<EntityPassPool> pass_pool)
+    : canvas_(pass_pool),
+      picture_cache_(std::move(picture_cache)),
+      pass_pool_(std::move(pass_pool)) {}
+
 DisplayListDispatcher::~DisplayListDispatcher() = default;
 
 static BlendMode ToBlendMode(flutter::DlBlendMode mode) {
@@ -739,6 +747,8 @@ static std::vector<Rect> ToRects(const SkRect tex[], int count) {
 void DisplayListDispatcher::saveLayer(const SkRect* bounds,
                                       const flutter::SaveLayerOptions options,
                                       const flutter::DlImageFilter* backdrop) {
+  // Cloning a picture doesn't preserve the properties of its subpasses.
+  is_cacheable_ = false;
   auto paint = options.renders_with_attributes() ? paint_ : Paint{};
   canvas_.SaveLayer(paint, ToRect(bounds), ToImageFilterProc(backdrop));
 }
@@ -837,8 +847,7 @@ static Entity::ClipOperation ToClipOperation(SkClipOp clip_op) {
 void DisplayListDispatcher::clipRect(const SkRect& rect,
                                      SkClipOp clip_op,
                                      bool is_aa) {
-  auto path = PathBuilder{}.AddRect(ToRect(rect)).TakePath();
-  canvas_.ClipPath(path, ToClipOperation(clip_op));
+  canvas_.ClipRect(ToRect(rect), ToClipOperation(clip_op));
 }
 
 static PathBuilder::RoundingRadii ToRoundingRadii(const SkRRect& rrect) {
@@ -851,7 +860,51 @@ static PathBuilder::RoundingRadii ToRoundingRadii(const SkRRect& rrect) {
   return radii;
 }
 
-static Path ToPath(const SkPath& path) {
+// Converts the verbs and points of the path in bulk. Returns false if the
+// path contains conics, which have to be approximated.
+static bool AddPathVerbs(const SkPath& path, Path& result) {
+  if (path.getSegmentMasks() & SkPath::kConic_SegmentMask) {
+    return false;
+  }
+
+  const auto verb_count = path.countVerbs();
+  std::vector<uint8_t> sk_verbs(verb_count);
+  path.getVerbs(sk_verbs.data(), verb_count);
+  std::vector<Path::Verb> verbs;
+  verbs.reserve(verb_count);
+  for (auto verb : sk_verbs) {
+    switch (static_cast<SkPath::Verb>(verb)) {
+      case SkPath::kMove_Verb:
+        verbs.push_back(Path::Verb::kMove);
+        break;
+      case SkPath::kLine_Verb:
+        verbs.push_back(Path::Verb::kLine);
+        break;
+      case SkPath::kQuad_Verb:
+        verbs.push_back(Path::Verb::kQuadratic);
+        break;
+      case SkPath::kCubic_Verb:
+        verbs.push_back(Path::Verb::kCubic);
+        break;
+      case SkPath::kClose_Verb:
+        verbs.push_back(Path::Verb::kClose);
+        break;
+      case SkPath::kConic_Verb:
+      case SkPath::kDone_Verb:
+        return false;
+    }
+  }
+
+  // The points are read straight into the storage of Impeller points.
+  static_assert(sizeof(SkPoint) == sizeof(Point));
+  const auto point_count = path.countPoints();
+  std::vector<Point> points(point_count);
+  path.getPoints(reinterpret_cast<SkPoint*>(points.data()), point_count);
+  return result.AddVerbs(verbs.data(), verbs.size(), points.data(),
+                         points.size());
+}
+
+static Path IteratePath(const SkPath& path) {
   auto iterator = SkPath::Iter(path, false);
 
   struct PathData {
@@ -908,6 +961,14 @@ static Path ToPath(const SkPath& path) {
         break;
     }
   } while (verb != SkPath::Verb::kDone_Verb);
+  return builder.TakePath();
+}
+
+static Path ToPath(const SkPath& path) {
+  Path result;
+  if (!AddPathVerbs(path, result)) {
+    result = IteratePath(path);
+  }
 
   FillType fill_type;
   switch (path.getFillType()) {
@@ -924,7 +985,14 @@ static Path ToPath(const SkPath& path) {
       fill_type = FillType::kNonZero;
       break;
   }
-  return builder.TakePath(fill_type);
+  result.SetFillType(fill_type);
+  // Non-volatile paths are likely to be drawn again in subsequent frames, so
+  // allow their tessellation to be retained. The generation ID changes
+  // whenever the path is edited.
+  if (!path.isVolatile()) {
+    result.SetCacheKey(path.getGenerationID());
+  }
+  return result;
 }
 
 static Path ToPath(const SkRRect& rrect) {
@@ -976,17 +1044,11 @@ void DisplayListDispatcher::drawRect(const SkRect& rect) {
 
 // |flutter::Dispatcher|
 void DisplayListDispatcher::drawOval(const SkRect& bounds) {
-  if (bounds.width() == bounds.height()) {
-    canvas_.DrawCircle(ToPoint(bounds.center()), bounds.width() * 0.5, paint_);
-  } else {
-    auto path = PathBuilder{}.AddOval(ToRect(bounds)).TakePath();
-    canvas_.DrawPath(path, paint_);
-  }
+  canvas_.DrawOval(ToRect(bounds), paint_);
 }
 
 // |flutter::Dispatcher|
 void DisplayListDispatcher::drawCircle(const SkPoint& center, SkScalar radius) {
-  auto path = PathBuilder{}.AddCircle(ToPoint(center), radius).TakePath();
   canvas_.DrawCircle(ToPoint(center), radius, paint_);
 }
 
@@ -1174,6 +1236,31 @@ void DisplayListDispatcher::drawPicture(const sk_sp<SkPicture> picture,
 // |flutter::Dispatcher|
 void DisplayListDispatcher::drawDisplayList(
     const sk_sp<flutter::DisplayList> display_list) {
+  if (picture_cache_ && !picture_cache_->IsUncacheable(*display_list)) {
+    if (auto picture = picture_cache_->GetPicture(*display_list)) {
+      canvas_.DrawPicture(*picture);
+      return;
+    }
+
+    // Record the display list on its own so that the picture doesn't depend
+    // on the state of this canvas. The save and restore keep the clips of the
+    // display list from leaking out of the picture.
+    auto start_time = fml::TimePoint::Now();
+    DisplayListDispatcher dispatcher(picture_cache_, pass_pool_);
+    dispatcher.canvas_.Save();
+    display_list->Dispatch(dispatcher);
+    if (dispatcher.is_cacheable_) {
+      dispatcher.canvas_.RestoreToCount(1);
+      const auto& picture = picture_cache_->AddPicture(
+          *display_list, dispatcher.EndRecordingAsPicture(),
+          fml::TimePoint::Now() - start_time);
+      canvas_.DrawPicture(picture);
+      return;
+    }
+    picture_cache_->AddUncacheable(*display_list);
+  }
+
+  is_cacheable_ = false;
   int saveCount = canvas_.GetSaveCount();
   Paint savePaint = paint_;
   paint_ = Paint();
@@ -1186,6 +1273,9 @@ void DisplayListDispatcher::drawDisplayList(
 void DisplayListDispatcher::drawTextBlob(const sk_sp<SkTextBlob> blob,
                                          SkScalar x,
                                          SkScalar y) {
+  // Text contents reference the glyph atlas of the pass they were recorded
+  // into, which isn't carried over when a picture is drawn.
+  is_cacheable_ = false;
   Scalar scale = canvas_.GetCurrentTransformation().GetMaxBasisLength();
   canvas_.DrawTextFrame(TextFrameFromTextBlob(blob, scale),  //
                         impeller::Point{x, y},               //
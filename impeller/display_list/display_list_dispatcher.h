@@ -11,6 +11,7 @@
 #include "flutter/fml/macros.h"
 #include "impeller/aiks/canvas.h"
 #include "impeller/aiks/paint.h"
+#include "impeller/display_list/display_list_picture_cache.h"
 
 namespace impeller {
 
@@ -18,6 +19,18 @@ class DisplayListDispatcher final : public flutter::Dispatcher {
  public:
   DisplayListDispatcher();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Create a dispatcher that draws nested display lists from
+  ///             the pictures in the given cache, and adds the pictures of
+  ///             nested display lists that aren't cached yet to it.
+  ///
+  ///             If `pass_pool` is set, the pictures are recorded into the
+  ///             passes of the pictures recycled into it.
+  ///
+  explicit DisplayListDispatcher(
+      std::shared_ptr<DisplayListPictureCache> picture_cache,
+      std::shared_ptr<EntityPassPool> pass_pool = nullptr);
+
   ~DisplayListDispatcher();
 
   Picture EndRecordingAsPicture();
@@ -239,6 +252,11 @@ class DisplayListDispatcher final : public flutter::Dispatcher {
  private:
   Paint paint_;
   Canvas canvas_;
+  std::shared_ptr<DisplayListPictureCache> picture_cache_;
+  std::shared_ptr<EntityPassPool> pass_pool_;
+  // Whether the picture of everything dispatched so far can be reused in
+  // later frames.
+  bool is_cacheable_ = true;
 
   FML_DISALLOW_COPY_AND_ASSIGN(DisplayListDispatcher);
 };
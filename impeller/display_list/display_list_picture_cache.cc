@@ -0,0 +1,100 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/display_list/display_list_picture_cache.h"
+
+#include "flutter/fml/trace_event.h"
+
+namespace impeller {
+
+DisplayListPictureCache::DisplayListPictureCache(size_t keep_alive_frame_count)
+    : keep_alive_frame_count_(keep_alive_frame_count) {}
+
+DisplayListPictureCache::~DisplayListPictureCache() = default;
+
+DisplayListPictureCache::Entry* DisplayListPictureCache::Find(
+    const flutter::DisplayList& display_list) {
+  auto found = entries_.find(display_list.unique_id());
+  if (found == entries_.end()) {
+    return nullptr;
+  }
+  found->second.last_used_frame = frame_;
+  return &found->second;
+}
+
+const Picture* DisplayListPictureCache::GetPicture(
+    const flutter::DisplayList& display_list) {
+  auto entry = Find(display_list);
+  if (!entry || !entry->picture.has_value()) {
+    return nullptr;
+  }
+  stats_.hit_count++;
+  stats_.conversion_time_saved =
+      stats_.conversion_time_saved + entry->conversion_time;
+  return &entry->picture.value();
+}
+
+bool DisplayListPictureCache::IsUncacheable(
+    const flutter::DisplayList& display_list) {
+  auto entry = Find(display_list);
+  return entry && !entry->picture.has_value();
+}
+
+const Picture& DisplayListPictureCache::AddPicture(
+    const flutter::DisplayList& display_list,
+    Picture picture,
+    fml::TimeDelta conversion_time) {
+  stats_.miss_count++;
+  stats_.conversion_time = stats_.conversion_time + conversion_time;
+  auto& entry = entries_[display_list.unique_id()];
+  entry.picture = std::move(picture);
+  entry.conversion_time = conversion_time;
+  entry.last_used_frame = frame_;
+  return entry.picture.value();
+}
+
+void DisplayListPictureCache::AddUncacheable(
+    const flutter::DisplayList& display_list) {
+  stats_.miss_count++;
+  auto& entry = entries_[display_list.unique_id()];
+  entry.picture = std::nullopt;
+  entry.last_used_frame = frame_;
+}
+
+void DisplayListPictureCache::EndFrame() {
+  TRACE_EVENT0("impeller", "DisplayListPictureCache::EndFrame");
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (frame_ - it->second.last_used_frame >= keep_alive_frame_count_) {
+      it = entries_.erase(it);
+    } else {
+      it++;
+    }
+  }
+  frame_++;
+
+  FML_TRACE_COUNTER("impeller", "DisplayListPictureCache",
+                    reinterpret_cast<int64_t>(this),  //
+                    "hits", stats_.hit_count,         //
+                    "misses", stats_.miss_count,      //
+                    "saved_micros",
+                    stats_.conversion_time_saved.ToMicroseconds()  //
+  );
+}
+
+size_t DisplayListPictureCache::GetCachedPictureCount() const {
+  size_t count = 0u;
+  for (const auto& entry : entries_) {
+    if (entry.second.picture.has_value()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+const DisplayListPictureCache::Stats& DisplayListPictureCache::GetStats()
+    const {
+  return stats_;
+}
+
+}  // namespace impeller
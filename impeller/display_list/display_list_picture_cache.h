@@ -0,0 +1,94 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "impeller/aiks/picture.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Caches the aiks pictures that nested display lists are
+///             converted to, so that display lists retained across frames
+///             are only dispatched once.
+///
+///             Entries are keyed by the unique ID of the display list, so a
+///             display list that is freed can never be confused with a new
+///             one. Entries that haven't been used for more than the keep
+///             alive frame count are evicted at the end of a frame.
+///
+///             The cache is not thread safe and must be used on the raster
+///             thread.
+///
+class DisplayListPictureCache {
+ public:
+  struct Stats {
+    size_t hit_count = 0u;
+    size_t miss_count = 0u;
+    /// The time spent converting display lists that were added to the
+    /// cache.
+    fml::TimeDelta conversion_time;
+    /// The conversion time of the cached display lists that were drawn from
+    /// the cache instead of being converted again.
+    fml::TimeDelta conversion_time_saved;
+  };
+
+  explicit DisplayListPictureCache(size_t keep_alive_frame_count = 1u);
+
+  ~DisplayListPictureCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the cached picture for the display list.
+  ///
+  /// @return     The picture, or nullptr if the display list has not been
+  ///             cached or can't be cached.
+  ///
+  const Picture* GetPicture(const flutter::DisplayList& display_list);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the display list was previously found to contain
+  ///             operations that prevent its picture from being reused.
+  ///
+  bool IsUncacheable(const flutter::DisplayList& display_list);
+
+  const Picture& AddPicture(const flutter::DisplayList& display_list,
+                            Picture picture,
+                            fml::TimeDelta conversion_time);
+
+  void AddUncacheable(const flutter::DisplayList& display_list);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Mark the end of a frame and evict the entries that haven't
+  ///             been used recently.
+  ///
+  void EndFrame();
+
+  size_t GetCachedPictureCount() const;
+
+  const Stats& GetStats() const;
+
+ private:
+  struct Entry {
+    std::optional<Picture> picture;
+    fml::TimeDelta conversion_time;
+    size_t last_used_frame = 0u;
+  };
+
+  const size_t keep_alive_frame_count_;
+  size_t frame_ = 0u;
+  std::unordered_map<uint32_t, Entry> entries_;
+  Stats stats_;
+
+  Entry* Find(const flutter::DisplayList& display_list);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DisplayListPictureCache);
+};
+
+}  // namespace impeller
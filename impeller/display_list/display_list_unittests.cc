@@ -15,7 +15,9 @@
 #include "flutter/display_list/display_list_mask_filter.h"
 #include "flutter/display_list/types.h"
 #include "flutter/testing/testing.h"
+#include "impeller/display_list/display_list_dispatcher.h"
 #include "impeller/display_list/display_list_image_impeller.h"
+#include "impeller/display_list/display_list_picture_cache.h"
 #include "impeller/display_list/display_list_playground.h"
 #include "impeller/geometry/constants.h"
 #include "impeller/geometry/point.h"
@@ -1013,5 +1015,39 @@ TEST_P(DisplayListTest, CanDrawCorrectlyWithColorFilterAndImageFilter) {
   ASSERT_TRUE(OpenPlaygroundHere(builder.Build()));
 }
 
+TEST_P(DisplayListTest, NestedDisplayListsAreCachedAcrossFrames) {
+  flutter::DisplayListBuilder child_builder;
+  child_builder.drawRect(SkRect::MakeXYWH(10, 10, 100, 100));
+  auto child = child_builder.Build();
+
+  flutter::DisplayListBuilder layer_builder;
+  layer_builder.saveLayer(nullptr, false);
+  layer_builder.drawRect(SkRect::MakeXYWH(10, 10, 100, 100));
+  layer_builder.restore();
+  auto layer_child = layer_builder.Build();
+
+  flutter::DisplayListBuilder builder;
+  builder.drawDisplayList(child);
+  builder.drawDisplayList(layer_child);
+  auto display_list = builder.Build();
+
+  auto picture_cache = std::make_shared<DisplayListPictureCache>();
+  for (size_t frame = 0; frame < 3; frame++) {
+    DisplayListDispatcher dispatcher(picture_cache);
+    display_list->Dispatch(dispatcher);
+    dispatcher.EndRecordingAsPicture();
+    picture_cache->EndFrame();
+  }
+
+  // Only the display list without a save layer can be cached.
+  ASSERT_EQ(picture_cache->GetCachedPictureCount(), 1u);
+  ASSERT_EQ(picture_cache->GetStats().miss_count, 2u);
+  ASSERT_EQ(picture_cache->GetStats().hit_count, 2u);
+
+  // Display lists that are no longer drawn are evicted.
+  picture_cache->EndFrame();
+  ASSERT_EQ(picture_cache->GetCachedPictureCount(), 0u);
+}
+
 }  // namespace testing
 }  // namespace impeller
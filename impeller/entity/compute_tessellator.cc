@@ -0,0 +1,324 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/compute_tessellator.h"
+
+#include <functional>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/allocation.h"
+#include "impeller/entity/convex_fill.comp.h"
+#include "impeller/entity/stroke_expansion.comp.h"
+#include "impeller/renderer/allocator.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_command.h"
+#include "impeller/renderer/compute_pass.h"
+#include "impeller/renderer/compute_pipeline_builder.h"
+#include "impeller/renderer/pipeline_library.h"
+
+namespace impeller {
+
+using StrokeCS = StrokeExpansionComputeShader;
+using FillCS = ConvexFillComputeShader;
+
+// These must match the flags in stroke_expansion.comp.
+static constexpr uint32_t kStartCap = 1u;
+static constexpr uint32_t kEndCap = 2u;
+static constexpr uint32_t kJoin = 4u;
+
+// These must match the join types in stroke_expansion.comp.
+static constexpr uint32_t kJoinBevel = 0u;
+static constexpr uint32_t kJoinMiter = 1u;
+
+// This must match kVerticesPerSegment in stroke_expansion.comp.
+static constexpr size_t kStrokeVerticesPerSegment = 12u;
+
+// This must match the local size declared in both compute shaders.
+static constexpr ISize kThreadGroupSize(256, 1);
+
+// The layout of |Segment| in stroke_expansion.comp.
+struct StrokeSegment {
+  Point p0;
+  Point p1;
+  Point p2;
+  Scalar flags = 0;
+  Scalar padding = 0;
+};
+static_assert(sizeof(StrokeSegment) == 8 * sizeof(Scalar));
+
+template <class T>
+static std::shared_ptr<Pipeline<ComputePipelineDescriptor>> CreatePipeline(
+    const Context& context) {
+  auto pipeline_desc =
+      ComputePipelineBuilder<T>::MakeDefaultPipelineDescriptor(context);
+  if (!pipeline_desc.has_value()) {
+    return nullptr;
+  }
+  return context.GetPipelineLibrary()->GetPipeline(pipeline_desc).Get();
+}
+
+ComputeTessellator::ComputeTessellator(std::shared_ptr<Context> context)
+    : context_(std::move(context)) {
+  if (!context_ || !context_->IsValid() || !context_->SupportsCompute()) {
+    return;
+  }
+  stroke_pipeline_ = CreatePipeline<StrokeCS>(*context_);
+  fill_pipeline_ = CreatePipeline<FillCS>(*context_);
+}
+
+ComputeTessellator::~ComputeTessellator() = default;
+
+bool ComputeTessellator::IsValid() const {
+  return stroke_pipeline_ && stroke_pipeline_->IsValid() && fill_pipeline_ &&
+         fill_pipeline_->IsValid();
+}
+
+// static
+bool ComputeTessellator::CanStroke(Cap stroke_cap, Join stroke_join) {
+  return stroke_cap != Cap::kRound && stroke_join != Join::kRound;
+}
+
+// static
+bool ComputeTessellator::IsConvex(const Path::Polyline& polyline) {
+  if (polyline.contours.size() != 1u) {
+    return false;
+  }
+  const auto& points = polyline.points;
+  size_t count = points.size();
+  // Ignore the point closing the contour.
+  if (count > 1u && points.front() == points.back()) {
+    count--;
+  }
+  if (count < 3u) {
+    return false;
+  }
+
+  // Every turn must be in the same direction, and the x direction of the
+  // edges may only flip twice. The second check rejects polygons that wind
+  // around more than once.
+  Scalar winding = 0;
+  size_t x_flips = 0u;
+  Scalar previous_dx = 0;
+  for (size_t i = 0; i < count; i++) {
+    const Point& a = points[i];
+    const Point& b = points[(i + 1) % count];
+    const Point& c = points[(i + 2) % count];
+    auto cross = (b - a).Cross(c - b);
+    if (cross != 0) {
+      if (winding != 0 && (cross > 0) != (winding > 0)) {
+        return false;
+      }
+      winding = cross;
+    }
+    auto dx = b.x - a.x;
+    if (dx != 0) {
+      if (previous_dx != 0 && (dx > 0) != (previous_dx > 0)) {
+        x_flips++;
+      }
+      previous_dx = dx;
+    }
+  }
+  return winding != 0 && x_flips <= 2u;
+}
+
+static bool SubmitCompute(
+    const Context& context,
+    const std::shared_ptr<Pipeline<ComputePipelineDescriptor>>& pipeline,
+    const char* label,
+    const std::function<void(ComputeCommand&, HostBuffer&)>& bind) {
+  auto cmd_buffer = context.CreateCommandBuffer();
+  if (!cmd_buffer) {
+    return false;
+  }
+  cmd_buffer->SetLabel(label);
+
+  auto pass = cmd_buffer->CreateComputePass();
+  if (!pass || !pass->IsValid()) {
+    return false;
+  }
+  pass->SetLabel(label);
+  pass->SetGridSize(kThreadGroupSize);
+  pass->SetThreadGroupSize(kThreadGroupSize);
+
+  ComputeCommand cmd;
+  cmd.label = label;
+  cmd.pipeline = pipeline;
+  bind(cmd, pass->GetTransientsBuffer());
+
+  return pass->AddCommand(std::move(cmd)) && pass->EncodeCommands() &&
+         cmd_buffer->SubmitCommands();
+}
+
+VertexBuffer ComputeTessellator::Stroke(const Path::Polyline& polyline,
+                                        Scalar stroke_width,
+                                        Scalar miter_limit,
+                                        Cap stroke_cap,
+                                        Join stroke_join) const {
+  if (!IsValid() || !CanStroke(stroke_cap, stroke_join) ||
+      polyline.points.size() < kMinSegmentCount) {
+    return {};
+  }
+  TRACE_EVENT0("impeller", "ComputeTessellator::Stroke");
+
+  const Scalar half_width = stroke_width * 0.5f;
+  std::vector<StrokeSegment> segments;
+  segments.reserve(polyline.points.size());
+  for (size_t contour_i = 0; contour_i < polyline.contours.size();
+       contour_i++) {
+    size_t contour_start_point_i, contour_end_point_i;
+    std::tie(contour_start_point_i, contour_end_point_i) =
+        polyline.GetContourPointBounds(contour_i);
+    const auto& points = polyline.points;
+
+    switch (contour_end_point_i - contour_start_point_i) {
+      case 1: {
+        // A lone point with square caps is a square centered on the point,
+        // which is the same as a horizontal segment with butt caps.
+        if (stroke_cap == Cap::kSquare) {
+          Point p = points[contour_start_point_i];
+          segments.push_back({.p0 = p - Point(half_width, 0),
+                              .p1 = p + Point(half_width, 0)});
+        }
+        continue;
+      }
+      case 0:
+        continue;  // This contour has no renderable content.
+      default:
+        break;
+    }
+
+    const bool is_closed = polyline.contours[contour_i].is_closed;
+    for (size_t point_i = contour_start_point_i + 1;
+         point_i < contour_end_point_i; point_i++) {
+      StrokeSegment segment;
+      segment.p0 = points[point_i - 1];
+      segment.p1 = points[point_i];
+      uint32_t flags = 0u;
+      if (point_i < contour_end_point_i - 1) {
+        segment.p2 = points[point_i + 1];
+        flags |= kJoin;
+      } else if (is_closed) {
+        // Join back to the direction of the first segment of the contour.
+        segment.p2 = segment.p1 + (points[contour_start_point_i + 1] -
+                                   points[contour_start_point_i]);
+        flags |= kJoin;
+      }
+      if (!is_closed && point_i == contour_start_point_i + 1) {
+        flags |= kStartCap;
+      }
+      if (!is_closed && point_i == contour_end_point_i - 1) {
+        flags |= kEndCap;
+      }
+      segment.flags = static_cast<Scalar>(flags);
+      segments.push_back(segment);
+    }
+  }
+  if (segments.empty()) {
+    return {};
+  }
+
+  auto allocator = context_->GetResourceAllocator();
+  auto input = allocator->CreateBufferWithCopy(
+      reinterpret_cast<const uint8_t*>(segments.data()),
+      segments.size() * sizeof(StrokeSegment));
+
+  const size_t vertex_count = segments.size() * kStrokeVerticesPerSegment;
+  DeviceBufferDescriptor output_desc;
+  output_desc.storage_mode = StorageMode::kDevicePrivate;
+  output_desc.size = vertex_count * sizeof(Point);
+  auto output = allocator->CreateBuffer(output_desc);
+  if (!input || !output) {
+    return {};
+  }
+
+  auto bind = [&](ComputeCommand& cmd, HostBuffer& host_buffer) {
+    StrokeCS::Info info;
+    info.half_width = half_width;
+    info.miter_limit = miter_limit;
+    info.segment_count = segments.size();
+    info.square_cap = stroke_cap == Cap::kSquare ? 1u : 0u;
+    info.join_type = stroke_join == Join::kMiter ? kJoinMiter : kJoinBevel;
+    StrokeCS::BindInfo(cmd, host_buffer.EmplaceUniform(info));
+    StrokeCS::BindSegments(cmd, input->AsBufferView());
+    StrokeCS::BindVertices(cmd, output->AsBufferView());
+  };
+  if (!SubmitCompute(*context_, stroke_pipeline_, "Stroke Expansion", bind)) {
+    return {};
+  }
+  return MakeVertexBuffer(std::move(output), vertex_count);
+}
+
+VertexBuffer ComputeTessellator::FillConvex(
+    const Path::Polyline& polyline) const {
+  if (!IsValid() || polyline.points.size() < kMinSegmentCount) {
+    return {};
+  }
+  TRACE_EVENT0("impeller", "ComputeTessellator::FillConvex");
+  FML_DCHECK(IsConvex(polyline));
+
+  const auto& points = polyline.points;
+  size_t point_count = points.size();
+  if (points.front() == points.back()) {
+    point_count--;
+  }
+  const size_t triangle_count = point_count - 2u;
+  const size_t vertex_count = triangle_count * 3u;
+
+  auto allocator = context_->GetResourceAllocator();
+  auto input = allocator->CreateBufferWithCopy(
+      reinterpret_cast<const uint8_t*>(points.data()),
+      point_count * sizeof(Point));
+
+  DeviceBufferDescriptor output_desc;
+  output_desc.storage_mode = StorageMode::kDevicePrivate;
+  output_desc.size = vertex_count * sizeof(Point);
+  auto output = allocator->CreateBuffer(output_desc);
+  if (!input || !output) {
+    return {};
+  }
+
+  auto bind = [&](ComputeCommand& cmd, HostBuffer& host_buffer) {
+    FillCS::Info info;
+    info.triangle_count = triangle_count;
+    FillCS::BindInfo(cmd, host_buffer.EmplaceUniform(info));
+    FillCS::BindPoints(cmd, input->AsBufferView());
+    FillCS::BindVertices(cmd, output->AsBufferView());
+  };
+  if (!SubmitCompute(*context_, fill_pipeline_, "Convex Fill", bind)) {
+    return {};
+  }
+  return MakeVertexBuffer(std::move(output), vertex_count);
+}
+
+VertexBuffer ComputeTessellator::MakeVertexBuffer(
+    std::shared_ptr<DeviceBuffer> vertices,
+    size_t vertex_count) const {
+  if (index_buffer_count_ < vertex_count) {
+    const size_t count = Allocation::NextPowerOfTwoSize(vertex_count);
+    std::vector<uint32_t> indices(count);
+    std::iota(indices.begin(), indices.end(), 0u);
+    auto index_buffer =
+        context_->GetResourceAllocator()->CreateBufferWithCopy(
+            reinterpret_cast<const uint8_t*>(indices.data()),
+            indices.size() * sizeof(uint32_t));
+    if (!index_buffer) {
+      return {};
+    }
+    // Draws still in flight keep the previous buffer alive.
+    index_buffer_ = std::move(index_buffer);
+    index_buffer_count_ = count;
+  }
+
+  VertexBuffer vertex_buffer;
+  vertex_buffer.vertex_buffer = vertices->AsBufferView();
+  vertex_buffer.index_buffer = index_buffer_->AsBufferView();
+  vertex_buffer.index_count = vertex_count;
+  vertex_buffer.index_type = IndexType::k32bit;
+  return vertex_buffer;
+}
+
+}  // namespace impeller
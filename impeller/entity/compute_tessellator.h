@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+
+#include "flutter/fml/macros.h"
+#include "impeller/entity/geometry.h"
+#include "impeller/geometry/path.h"
+#include "impeller/renderer/compute_pipeline_descriptor.h"
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/device_buffer.h"
+#include "impeller/renderer/pipeline.h"
+#include "impeller/renderer/vertex_buffer.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Generates the vertices of stroked and filled polylines with
+///             compute shaders, writing them into device buffers that draws
+///             consume directly.
+///
+///             The work for each polyline is submitted on its own command
+///             buffer before the draw using the vertices is. This relies on
+///             command buffers executing in the order they are submitted.
+///
+///             The tessellator is only valid on contexts that support compute.
+///             Callers fall back to CPU tessellation whenever a method returns
+///             an empty vertex buffer.
+///
+class ComputeTessellator {
+ public:
+  /// Polylines with fewer segments than this are cheaper to tessellate on the
+  /// CPU than to dispatch.
+  static constexpr size_t kMinSegmentCount = 256u;
+
+  explicit ComputeTessellator(std::shared_ptr<Context> context);
+
+  ~ComputeTessellator();
+
+  bool IsValid() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether strokes with the given cap and join can be expanded
+  ///             on the GPU. Round caps and joins emit a tolerance dependent
+  ///             number of vertices and are left to the CPU.
+  ///
+  static bool CanStroke(Cap stroke_cap, Join stroke_join);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the polyline is a single convex contour, which can be
+  ///             triangulated as a fan regardless of the fill type.
+  ///
+  static bool IsConvex(const Path::Polyline& polyline);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Expand the polyline into a triangle list covering its stroke.
+  ///
+  /// @param[in]  polyline      The flattened path to stroke.
+  /// @param[in]  stroke_width  The width of the stroke.
+  /// @param[in]  miter_limit   The maximum miter length, already scaled by
+  ///                           half the stroke width.
+  /// @param[in]  stroke_cap    The cap, which must satisfy |CanStroke|.
+  /// @param[in]  stroke_join   The join, which must satisfy |CanStroke|.
+  ///
+  /// @return     The vertices, to be drawn as |PrimitiveType::kTriangle|, or
+  ///             an empty vertex buffer if the stroke should be expanded on
+  ///             the CPU instead.
+  ///
+  VertexBuffer Stroke(const Path::Polyline& polyline,
+                      Scalar stroke_width,
+                      Scalar miter_limit,
+                      Cap stroke_cap,
+                      Join stroke_join) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Triangulate a polyline that satisfies |IsConvex|.
+  ///
+  /// @return     The vertices, to be drawn as |PrimitiveType::kTriangle|, or
+  ///             an empty vertex buffer if the polyline should be tessellated
+  ///             on the CPU instead.
+  ///
+  VertexBuffer FillConvex(const Path::Polyline& polyline) const;
+
+ private:
+  std::shared_ptr<Context> context_;
+  std::shared_ptr<Pipeline<ComputePipelineDescriptor>> stroke_pipeline_;
+  std::shared_ptr<Pipeline<ComputePipelineDescriptor>> fill_pipeline_;
+  // Draws of the generated vertices are not indexed, but render passes
+  // require an index buffer. This one counts up from zero and grows as
+  // needed.
+  mutable std::shared_ptr<DeviceBuffer> index_buffer_;
+  mutable size_t index_buffer_count_ = 0u;
+
+  VertexBuffer MakeVertexBuffer(std::shared_ptr<DeviceBuffer> vertices,
+                                size_t vertex_count) const;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ComputeTessellator);
+};
+
+}  // namespace impeller
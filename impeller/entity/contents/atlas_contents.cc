@@ -2,15 +2,18 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <optional>
 #include <utility>
 
 #include "impeller/renderer/formats.h"
+#include "impeller/renderer/platform.h"
 #include "impeller/renderer/sampler_library.h"
 #include "impeller/renderer/vertex_buffer_builder.h"
 
 #include "impeller/entity/atlas_fill.frag.h"
 #include "impeller/entity/atlas_fill.vert.h"
+#include "impeller/entity/atlas_instanced.vert.h"
 #include "impeller/entity/contents/atlas_contents.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/entity.h"
@@ -93,6 +96,14 @@ bool AtlasContents::Render(const ContentContext& renderer,
     return true;
   }
 
+  if (CanRenderInstanced()) {
+    auto pipeline = renderer.GetAtlasInstancedPipeline(
+        OptionsFromPassAndEntity(pass, entity));
+    if (pipeline) {
+      return RenderInstanced(renderer, entity, pass, std::move(pipeline));
+    }
+  }
+
   VertexBufferBuilder<VS::PerVertexData> vertex_builder;
   vertex_builder.Reserve(texture_coords_.size() * 6);
   constexpr size_t indices[6] = {0, 1, 2, 1, 2, 3};
@@ -148,4 +159,89 @@ bool AtlasContents::Render(const ContentContext& renderer,
   return true;
 }
 
+// This must match kRecordsPerSprite in atlas_instanced.vert.
+static constexpr size_t kRecordsPerSprite = 3u;
+
+/// Whether the transform can be written as an RSTransform, which is all the
+/// instanced vertex shader can apply.
+static bool IsRSTransform(const Matrix& m) {
+  // clang-format off
+  return m.m[2]  == 0 && m.m[3]  == 0 &&
+         m.m[4]  == -m.m[1] && m.m[5] == m.m[0] &&
+         m.m[6]  == 0 && m.m[7]  == 0 &&
+         m.m[8]  == 0 && m.m[9]  == 0 && m.m[10] == 1 && m.m[11] == 0 &&
+         m.m[14] == 0 && m.m[15] == 1;
+  // clang-format on
+}
+
+bool AtlasContents::CanRenderInstanced() const {
+  if (texture_coords_.empty()) {
+    return false;
+  }
+  return std::all_of(transforms_.begin(), transforms_.end(), IsRSTransform);
+}
+
+bool AtlasContents::RenderInstanced(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass,
+    std::shared_ptr<Pipeline<PipelineDescriptor>> pipeline) const {
+  using VS = AtlasInstancedVertexShader;
+  using FS = AtlasFillFragmentShader;
+
+  auto& host_buffer = pass.GetTransientsBuffer();
+
+  // Each sprite is a single instance of a unit square.
+  VertexBufferBuilder<VS::PerVertexData> vertex_builder;
+  vertex_builder.AddVertices({{Point(0, 0)},
+                              {Point(1, 0)},
+                              {Point(0, 1)},
+                              {Point(1, 1)}});
+  for (auto index : {0, 1, 2, 1, 2, 3}) {
+    vertex_builder.AppendIndex(index);
+  }
+
+  std::vector<Vector4> records;
+  records.reserve(texture_coords_.size() * kRecordsPerSprite);
+  for (size_t i = 0; i < texture_coords_.size(); i++) {
+    const auto& m = transforms_[i].m;
+    const auto& sample_rect = texture_coords_[i];
+    auto color = colors_.size() > 0 ? colors_[i] : Color::Black();
+    records.emplace_back(m[0], m[1], m[12], m[13]);
+    records.emplace_back(sample_rect.origin.x, sample_rect.origin.y,
+                         sample_rect.size.width, sample_rect.size.height);
+    records.emplace_back(color.Premultiply());
+  }
+
+  VS::VertInfo vert_info;
+  vert_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                  entity.GetTransformation();
+  vert_info.texture_size = Point(texture_->GetSize());
+
+  FS::FragInfo frag_info;
+  frag_info.texture_sampler_y_coord_scale = texture_->GetYCoordScale();
+  frag_info.has_vertex_color = colors_.size() > 0 ? 1.0 : 0.0;
+  frag_info.alpha = alpha_;
+
+  Command cmd;
+  cmd.label = "DrawAtlas (Instanced)";
+  cmd.pipeline = std::move(pipeline);
+  cmd.stencil_reference = entity.GetStencilDepth();
+  cmd.instance_count = texture_coords_.size();
+  cmd.BindVertices(vertex_builder.CreateVertexBuffer(host_buffer));
+  VS::BindVertInfo(cmd, host_buffer.EmplaceUniform(vert_info));
+  VS::BindSpriteInfo(
+      cmd, host_buffer.Emplace(records.data(),
+                               records.size() * sizeof(Vector4),
+                               std::max(alignof(Vector4),
+                                        DefaultUniformAlignment())));
+  FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+  FS::BindTextureSampler(cmd, texture_,
+                         renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+                             sampler_descriptor_));
+  pass.AddCommand(std::move(cmd));
+
+  return true;
+}
+
 }  // namespace impeller
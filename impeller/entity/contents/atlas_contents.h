@@ -11,6 +11,7 @@
 #include "flutter/fml/macros.h"
 #include "impeller/entity/contents/contents.h"
 #include "impeller/entity/entity.h"
+#include "impeller/renderer/pipeline.h"
 #include "impeller/renderer/sampler_descriptor.h"
 
 namespace impeller {
@@ -50,6 +51,14 @@ class AtlasContents final : public Contents {
               RenderPass& pass) const override;
 
  private:
+  bool CanRenderInstanced() const;
+
+  bool RenderInstanced(const ContentContext& renderer,
+                       const Entity& entity,
+                       RenderPass& pass,
+                       std::shared_ptr<Pipeline<PipelineDescriptor>> pipeline)
+      const;
+
   std::shared_ptr<Texture> texture_;
   std::vector<Rect> texture_coords_;
   std::vector<Color> colors_;
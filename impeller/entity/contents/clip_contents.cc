@@ -46,12 +46,18 @@ Contents::StencilCoverage ClipContents::GetStencilCoverage(
       // the current stencil will shrink.
       return {.type = StencilCoverage::Type::kAppend,
               .coverage = current_stencil_coverage};
-    case Entity::ClipOperation::kIntersect:
+    case Entity::ClipOperation::kIntersect: {
+      // Rects stay rects under transforms that only translate and scale.
+      const auto& transform = entity.GetTransformation();
       return {
           .type = StencilCoverage::Type::kAppend,
           .coverage = current_stencil_coverage->Intersection(
-              geometry_->GetCoverage(entity.GetTransformation()).value()),
+              geometry_->GetCoverage(transform).value()),
+          .is_rect_intersection = geometry_->GetRect().has_value() &&
+                                  transform.IsAffine() &&
+                                  transform.IsAligned(),
       };
+    }
   }
   FML_UNREACHABLE();
 }
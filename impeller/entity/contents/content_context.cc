@@ -4,11 +4,17 @@
 
 #include "impeller/entity/contents/content_context.h"
 
+#include <algorithm>
 #include <sstream>
 
+#include "flutter/fml/trace_event.h"
+#include "impeller/entity/compute_tessellator.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/render_target_cache.h"
+#include "impeller/entity/signed_distance_field_generator.h"
 #include "impeller/renderer/command_buffer.h"
 #include "impeller/renderer/formats.h"
+#include "impeller/renderer/pipeline_library.h"
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/render_target.h"
 #include "impeller/tessellator/tessellator.h"
@@ -146,82 +152,118 @@ static std::unique_ptr<PipelineT> CreateDefaultPipeline(
 ContentContext::ContentContext(std::shared_ptr<Context> context)
     : context_(std::move(context)),
       tessellator_(std::make_shared<Tessellator>()),
-      glyph_atlas_context_(std::make_shared<GlyphAtlasContext>()) {
+      tessellation_cache_(std::make_shared<TessellationCache>()),
+      glyph_atlas_context_(std::make_shared<GlyphAtlasContext>()),
+      gradient_texture_cache_(std::make_unique<GradientTextureCache>()) {
   if (!context_ || !context_->IsValid()) {
     return;
   }
+  render_target_cache_ =
+      std::make_shared<RenderTargetCache>(context_->GetResourceAllocator());
 
-  solid_fill_pipelines_[{}] =
-      CreateDefaultPipeline<SolidFillPipeline>(*context_);
-  linear_gradient_fill_pipelines_[{}] =
-      CreateDefaultPipeline<LinearGradientFillPipeline>(*context_);
-  radial_gradient_fill_pipelines_[{}] =
-      CreateDefaultPipeline<RadialGradientFillPipeline>(*context_);
-  sweep_gradient_fill_pipelines_[{}] =
-      CreateDefaultPipeline<SweepGradientFillPipeline>(*context_);
-  rrect_blur_pipelines_[{}] =
-      CreateDefaultPipeline<RRectBlurPipeline>(*context_);
-  texture_blend_pipelines_[{}] =
-      CreateDefaultPipeline<BlendPipeline>(*context_);
-  blend_color_pipelines_[{}] =
-      CreateDefaultPipeline<BlendColorPipeline>(*context_);
-  blend_colorburn_pipelines_[{}] =
-      CreateDefaultPipeline<BlendColorBurnPipeline>(*context_);
-  blend_colordodge_pipelines_[{}] =
-      CreateDefaultPipeline<BlendColorDodgePipeline>(*context_);
-  blend_darken_pipelines_[{}] =
-      CreateDefaultPipeline<BlendDarkenPipeline>(*context_);
-  blend_difference_pipelines_[{}] =
-      CreateDefaultPipeline<BlendDifferencePipeline>(*context_);
-  blend_exclusion_pipelines_[{}] =
-      CreateDefaultPipeline<BlendExclusionPipeline>(*context_);
-  blend_hardlight_pipelines_[{}] =
-      CreateDefaultPipeline<BlendHardLightPipeline>(*context_);
-  blend_hue_pipelines_[{}] = CreateDefaultPipeline<BlendHuePipeline>(*context_);
-  blend_lighten_pipelines_[{}] =
-      CreateDefaultPipeline<BlendLightenPipeline>(*context_);
-  blend_luminosity_pipelines_[{}] =
-      CreateDefaultPipeline<BlendLuminosityPipeline>(*context_);
-  blend_multiply_pipelines_[{}] =
-      CreateDefaultPipeline<BlendMultiplyPipeline>(*context_);
-  blend_overlay_pipelines_[{}] =
-      CreateDefaultPipeline<BlendOverlayPipeline>(*context_);
-  blend_saturation_pipelines_[{}] =
-      CreateDefaultPipeline<BlendSaturationPipeline>(*context_);
-  blend_screen_pipelines_[{}] =
-      CreateDefaultPipeline<BlendScreenPipeline>(*context_);
-  blend_softlight_pipelines_[{}] =
-      CreateDefaultPipeline<BlendSoftLightPipeline>(*context_);
-  texture_pipelines_[{}] = CreateDefaultPipeline<TexturePipeline>(*context_);
-  tiled_texture_pipelines_[{}] =
-      CreateDefaultPipeline<TiledTexturePipeline>(*context_);
-  gaussian_blur_pipelines_[{}] =
-      CreateDefaultPipeline<GaussianBlurPipeline>(*context_);
-  border_mask_blur_pipelines_[{}] =
-      CreateDefaultPipeline<BorderMaskBlurPipeline>(*context_);
-  morphology_filter_pipelines_[{}] =
-      CreateDefaultPipeline<MorphologyFilterPipeline>(*context_);
-  color_matrix_color_filter_pipelines_[{}] =
-      CreateDefaultPipeline<ColorMatrixColorFilterPipeline>(*context_);
-  linear_to_srgb_filter_pipelines_[{}] =
-      CreateDefaultPipeline<LinearToSrgbFilterPipeline>(*context_);
-  srgb_to_linear_filter_pipelines_[{}] =
-      CreateDefaultPipeline<SrgbToLinearFilterPipeline>(*context_);
-  glyph_atlas_pipelines_[{}] =
-      CreateDefaultPipeline<GlyphAtlasPipeline>(*context_);
-  glyph_atlas_sdf_pipelines_[{}] =
-      CreateDefaultPipeline<GlyphAtlasSdfPipeline>(*context_);
-  geometry_color_pipelines_[{}] =
-      CreateDefaultPipeline<GeometryColorPipeline>(*context_);
-  geometry_position_pipelines_[{}] =
-      CreateDefaultPipeline<GeometryPositionPipeline>(*context_);
-  atlas_pipelines_[{}] = CreateDefaultPipeline<AtlasPipeline>(*context_);
-  yuv_to_rgb_filter_pipelines_[{}] =
-      CreateDefaultPipeline<YUVToRGBFilterPipeline>(*context_);
-
-  if (solid_fill_pipelines_[{}]->GetDescriptor().has_value()) {
+  if (context_->SupportsCompute()) {
+    auto sdf_generator =
+        std::make_shared<SignedDistanceFieldGenerator>(context_);
+    if (sdf_generator->IsValid()) {
+      glyph_atlas_context_->SetSignedDistanceFieldGenerator(
+          [sdf_generator](uint8_t* pixels, ISize size) {
+            return sdf_generator->Generate(pixels, size);
+          });
+    }
+
+    auto compute_tessellator = std::make_shared<ComputeTessellator>(context_);
+    if (compute_tessellator->IsValid()) {
+      compute_tessellator_ = std::move(compute_tessellator);
+    }
+  }
+
+  solid_fill_pipelines_.SetPrototype(
+      CreateDefaultPipeline<SolidFillPipeline>(*context_));
+  linear_gradient_fill_pipelines_.SetPrototype(
+      CreateDefaultPipeline<LinearGradientFillPipeline>(*context_));
+  radial_gradient_fill_pipelines_.SetPrototype(
+      CreateDefaultPipeline<RadialGradientFillPipeline>(*context_));
+  sweep_gradient_fill_pipelines_.SetPrototype(
+      CreateDefaultPipeline<SweepGradientFillPipeline>(*context_));
+  rrect_blur_pipelines_.SetPrototype(
+      CreateDefaultPipeline<RRectBlurPipeline>(*context_));
+  rrect_fill_pipelines_.SetPrototype(
+      CreateDefaultPipeline<RRectFillPipeline>(*context_));
+  texture_blend_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendPipeline>(*context_));
+  blend_color_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendColorPipeline>(*context_));
+  blend_colorburn_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendColorBurnPipeline>(*context_));
+  blend_colordodge_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendColorDodgePipeline>(*context_));
+  blend_darken_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendDarkenPipeline>(*context_));
+  blend_difference_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendDifferencePipeline>(*context_));
+  blend_exclusion_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendExclusionPipeline>(*context_));
+  blend_hardlight_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendHardLightPipeline>(*context_));
+  blend_hue_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendHuePipeline>(*context_));
+  blend_lighten_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendLightenPipeline>(*context_));
+  blend_luminosity_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendLuminosityPipeline>(*context_));
+  blend_multiply_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendMultiplyPipeline>(*context_));
+  blend_overlay_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendOverlayPipeline>(*context_));
+  blend_saturation_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendSaturationPipeline>(*context_));
+  blend_screen_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendScreenPipeline>(*context_));
+  blend_softlight_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BlendSoftLightPipeline>(*context_));
+  if (context_->SupportsFramebufferFetch()) {
+    framebuffer_blend_pipelines_.SetPrototype(
+        CreateDefaultPipeline<FramebufferBlendPipeline>(*context_));
+  }
+  texture_pipelines_.SetPrototype(
+      CreateDefaultPipeline<TexturePipeline>(*context_));
+  tiled_texture_pipelines_.SetPrototype(
+      CreateDefaultPipeline<TiledTexturePipeline>(*context_));
+  gaussian_blur_pipelines_.SetPrototype(
+      CreateDefaultPipeline<GaussianBlurPipeline>(*context_));
+  border_mask_blur_pipelines_.SetPrototype(
+      CreateDefaultPipeline<BorderMaskBlurPipeline>(*context_));
+  morphology_filter_pipelines_.SetPrototype(
+      CreateDefaultPipeline<MorphologyFilterPipeline>(*context_));
+  color_matrix_color_filter_pipelines_.SetPrototype(
+      CreateDefaultPipeline<ColorMatrixColorFilterPipeline>(*context_));
+  color_filter_chain_pipelines_.SetPrototype(
+      CreateDefaultPipeline<ColorFilterChainPipeline>(*context_));
+  linear_to_srgb_filter_pipelines_.SetPrototype(
+      CreateDefaultPipeline<LinearToSrgbFilterPipeline>(*context_));
+  srgb_to_linear_filter_pipelines_.SetPrototype(
+      CreateDefaultPipeline<SrgbToLinearFilterPipeline>(*context_));
+  glyph_atlas_pipelines_.SetPrototype(
+      CreateDefaultPipeline<GlyphAtlasPipeline>(*context_));
+  glyph_atlas_sdf_pipelines_.SetPrototype(
+      CreateDefaultPipeline<GlyphAtlasSdfPipeline>(*context_));
+  geometry_color_pipelines_.SetPrototype(
+      CreateDefaultPipeline<GeometryColorPipeline>(*context_));
+  geometry_position_pipelines_.SetPrototype(
+      CreateDefaultPipeline<GeometryPositionPipeline>(*context_));
+  atlas_pipelines_.SetPrototype(
+      CreateDefaultPipeline<AtlasPipeline>(*context_));
+  if (context_->SupportsInstancedRendering()) {
+    atlas_instanced_pipelines_.SetPrototype(
+        CreateDefaultPipeline<AtlasInstancedPipeline>(*context_));
+  }
+  yuv_to_rgb_filter_pipelines_.SetPrototype(
+      CreateDefaultPipeline<YUVToRGBFilterPipeline>(*context_));
+
+  if (auto solid_fill_pipeline = solid_fill_pipelines_.GetPrototype();
+      solid_fill_pipeline && solid_fill_pipeline->GetDescriptor().has_value()) {
     auto clip_pipeline_descriptor =
-        solid_fill_pipelines_[{}]->GetDescriptor().value();
+        solid_fill_pipeline->GetDescriptor().value();
     clip_pipeline_descriptor.SetLabel("Clip Pipeline");
     // Disable write to all color attachments.
     auto color_attachments =
@@ -232,8 +274,8 @@ ContentContext::ContentContext(std::shared_ptr<Context> context)
     }
     clip_pipeline_descriptor.SetColorAttachmentDescriptors(
         std::move(color_attachments));
-    clip_pipelines_[{}] =
-        std::make_unique<ClipPipeline>(*context_, clip_pipeline_descriptor);
+    clip_pipelines_.SetPrototype(
+        std::make_unique<ClipPipeline>(*context_, clip_pipeline_descriptor));
   } else {
     return;
   }
@@ -254,9 +296,11 @@ std::shared_ptr<Texture> ContentContext::MakeSubpass(
 
   RenderTarget subpass_target;
   if (context->SupportsOffscreenMSAA()) {
-    subpass_target = RenderTarget::CreateOffscreenMSAA(*context, texture_size);
+    subpass_target = RenderTarget::CreateOffscreenMSAA(*render_target_cache_,
+                                                       texture_size);
   } else {
-    subpass_target = RenderTarget::CreateOffscreen(*context, texture_size);
+    subpass_target =
+        RenderTarget::CreateOffscreen(*render_target_cache_, texture_size);
   }
   auto subpass_texture = subpass_target.GetRenderTargetTexture();
   if (!subpass_texture) {
@@ -294,11 +338,232 @@ std::shared_ptr<Tessellator> ContentContext::GetTessellator() const {
   return tessellator_;
 }
 
+std::shared_ptr<TessellationCache> ContentContext::GetTessellationCache()
+    const {
+  return tessellation_cache_;
+}
+
+std::shared_ptr<ComputeTessellator> ContentContext::GetComputeTessellator()
+    const {
+  return compute_tessellator_;
+}
+
 std::shared_ptr<GlyphAtlasContext> ContentContext::GetGlyphAtlasContext()
     const {
   return glyph_atlas_context_;
 }
 
+std::shared_ptr<RenderTargetAllocator> ContentContext::GetRenderTargetCache()
+    const {
+  return render_target_cache_;
+}
+
+std::shared_ptr<Texture> ContentContext::GetGradientTexture(
+    const std::vector<Color>& colors,
+    const std::vector<Scalar>& stops) const {
+  return gradient_texture_cache_->GetOrCreate(colors, stops, context_);
+}
+
+void ContentContext::SetParallelSubpassEncodingEnabled(bool enabled) {
+  parallel_subpass_encoding_enabled_ = enabled;
+}
+
+bool ContentContext::IsParallelSubpassEncodingEnabled() const {
+  return parallel_subpass_encoding_enabled_;
+}
+
+void ContentContext::SetDrawBatchingEnabled(bool enabled) {
+  draw_batching_enabled_ = enabled;
+}
+
+bool ContentContext::IsDrawBatchingEnabled() const {
+  return draw_batching_enabled_;
+}
+
+void ContentContext::RecordCoalescedDraws(size_t count) {
+  coalesced_draw_count_ += count;
+}
+
+size_t ContentContext::GetCoalescedDrawCount() const {
+  return coalesced_draw_count_;
+}
+
+void ContentContext::ResetCoalescedDrawCount() {
+  coalesced_draw_count_ = 0u;
+}
+
+void ContentContext::RecordClipCulledEntities(size_t count) {
+  clip_culled_entity_count_ += count;
+}
+
+void ContentContext::RecordOccludedEntities(size_t count) {
+  occluded_entity_count_ += count;
+}
+
+size_t ContentContext::GetClipCulledEntityCount() const {
+  return clip_culled_entity_count_;
+}
+
+size_t ContentContext::GetOccludedEntityCount() const {
+  return occluded_entity_count_;
+}
+
+void ContentContext::ResetCulledEntityCounts() {
+  clip_culled_entity_count_ = 0u;
+  occluded_entity_count_ = 0u;
+}
+
+PipelineFuture<PipelineDescriptor> ContentContext::GetRuntimeEffectPipeline(
+    size_t runtime_stage_hash,
+    ContentContextOptions opts,
+    const RuntimeEffectDescriptorCallback& create_descriptor) const {
+  if (!IsValid()) {
+    return {};
+  }
+
+  const auto key = RuntimeEffectPipelineKey{runtime_stage_hash, opts};
+  Lock lock(runtime_effect_pipelines_mutex_);
+  if (auto found = runtime_effect_pipelines_.find(key);
+      found != runtime_effect_pipelines_.end()) {
+    return found->second;
+  }
+
+  auto desc = create_descriptor();
+  if (!desc.has_value()) {
+    return {};
+  }
+
+  auto future = context_->GetPipelineLibrary()->GetPipeline(desc.value());
+  runtime_effect_pipelines_[key] = future;
+  return future;
+}
+
+void ContentContext::SetRuntimeEffectAsyncCompilationEnabled(bool enabled) {
+  runtime_effect_async_compilation_enabled_ = enabled;
+}
+
+bool ContentContext::IsRuntimeEffectAsyncCompilationEnabled() const {
+  return runtime_effect_async_compilation_enabled_;
+}
+
+void ContentContext::SetGaussianBlurDownsampleRadius(Scalar radius) {
+  gaussian_blur_downsample_radius_ = std::max(radius, 0.0f);
+}
+
+Scalar ContentContext::GetGaussianBlurDownsampleRadius() const {
+  return gaussian_blur_downsample_radius_;
+}
+
+size_t ContentContext::PrewarmPipelineVariants(
+    const std::vector<PipelineVariant>& variants) const {
+  if (!IsValid()) {
+    return 0u;
+  }
+  TRACE_EVENT0("impeller", "ContentContext::PrewarmPipelineVariants");
+  size_t started = 0u;
+  for (const auto& variant : variants) {
+    // Pipelines that share a fragment stage (such as the two geometry
+    // pipelines) also share a prototype label, so every container with a
+    // matching label is given the variant.
+    ForEachPipelineVariants([&](auto& container) {
+      if (PrewarmPipelineVariant(container, variant)) {
+        started++;
+      }
+    });
+  }
+  return started;
+}
+
+void ContentContext::SetPipelineVariantRecordingEnabled(bool enabled) {
+  record_pipeline_variants_ = enabled;
+}
+
+std::vector<ContentContext::PipelineVariant>
+ContentContext::GetRecordedPipelineVariants() const {
+  Lock lock(recorded_pipeline_variants_mutex_);
+  return recorded_pipeline_variants_;
+}
+
+void ContentContext::SetEntityPassCapture(
+    std::shared_ptr<EntityPassCapture> capture) {
+  if (capture) {
+    record_pipeline_variants_ = true;
+  }
+  entity_pass_capture_ = std::move(capture);
+}
+
+const std::shared_ptr<EntityPassCapture>&
+ContentContext::GetEntityPassCapture() const {
+  return entity_pass_capture_;
+}
+
+std::string ContentContext::SerializePipelineVariants(
+    const std::vector<PipelineVariant>& variants) {
+  std::stringstream stream;
+  for (const auto& variant : variants) {
+    const auto& options = variant.options;
+    stream << variant.pipeline << ","
+           << static_cast<int>(options.sample_count) << ","
+           << static_cast<int>(options.blend_mode) << ","
+           << static_cast<int>(options.stencil_compare) << ","
+           << static_cast<int>(options.stencil_operation) << ","
+           << static_cast<int>(options.primitive_type) << "\n";
+  }
+  return stream.str();
+}
+
+std::vector<ContentContext::PipelineVariant>
+ContentContext::DeserializePipelineVariants(std::string_view data) {
+  std::vector<PipelineVariant> variants;
+  std::stringstream stream{std::string{data}};
+  std::string line;
+  while (std::getline(stream, line)) {
+    auto label_end = line.find(',');
+    if (label_end == std::string::npos || label_end == 0u) {
+      continue;
+    }
+    std::stringstream fields{line.substr(label_end + 1)};
+    int values[5];
+    bool valid = true;
+    for (auto i = 0u; i < 5u; i++) {
+      char separator = ',';
+      if ((i > 0u && !(fields >> separator)) || separator != ',' ||
+          !(fields >> values[i])) {
+        valid = false;
+        break;
+      }
+    }
+    if (!valid || !(fields >> std::ws).eof()) {
+      VALIDATION_LOG << "Skipping malformed pipeline variant: " << line;
+      continue;
+    }
+    if ((values[0] != static_cast<int>(SampleCount::kCount1) &&
+         values[0] != static_cast<int>(SampleCount::kCount4)) ||
+        values[1] < 0 ||
+        values[1] > static_cast<int>(Entity::kLastAdvancedBlendMode) ||
+        values[2] < 0 ||
+        values[2] > static_cast<int>(CompareFunction::kGreaterEqual) ||
+        values[3] < 0 ||
+        values[3] > static_cast<int>(StencilOperation::kDecrementWrap) ||
+        values[4] < 0 || values[4] > static_cast<int>(PrimitiveType::kPoint)) {
+      VALIDATION_LOG << "Skipping out of range pipeline variant: " << line;
+      continue;
+    }
+    variants.push_back({
+        .pipeline = line.substr(0, label_end),
+        .options =
+            {
+                .sample_count = static_cast<SampleCount>(values[0]),
+                .blend_mode = static_cast<BlendMode>(values[1]),
+                .stencil_compare = static_cast<CompareFunction>(values[2]),
+                .stencil_operation = static_cast<StencilOperation>(values[3]),
+                .primitive_type = static_cast<PrimitiveType>(values[4]),
+            },
+    });
+  }
+  return variants;
+}
+
 std::shared_ptr<Context> ContentContext::GetContext() const {
   return context_;
 }
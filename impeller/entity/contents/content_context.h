@@ -4,12 +4,20 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
+
 
 #include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "fml/logging.h"
+#include "impeller/base/lock_free_lookup_table.h"
+#include "impeller/base/thread.h"
 #include "impeller/base/validation.h"
 #include "impeller/entity/advanced_blend.vert.h"
 #include "impeller/entity/advanced_blend_color.frag.h"
@@ -29,13 +37,19 @@
 #include "impeller/entity/advanced_blend_softlight.frag.h"
 #include "impeller/entity/atlas_fill.frag.h"
 #include "impeller/entity/atlas_fill.vert.h"
+#include "impeller/entity/atlas_instanced.vert.h"
 #include "impeller/entity/blend.frag.h"
 #include "impeller/entity/blend.vert.h"
 #include "impeller/entity/border_mask_blur.frag.h"
 #include "impeller/entity/border_mask_blur.vert.h"
+#include "impeller/entity/color_filter_chain.frag.h"
+#include "impeller/entity/color_filter_chain.vert.h"
 #include "impeller/entity/color_matrix_color_filter.frag.h"
 #include "impeller/entity/color_matrix_color_filter.vert.h"
+#include "impeller/entity/contents/gradient_generator.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/framebuffer_blend.frag.h"
+#include "impeller/entity/tessellation_cache.h"
 #include "impeller/entity/gaussian_blur.frag.h"
 #include "impeller/entity/gaussian_blur.vert.h"
 #include "impeller/entity/glyph_atlas.frag.h"
@@ -51,6 +65,7 @@
 #include "impeller/entity/radial_gradient_fill.frag.h"
 #include "impeller/entity/rrect_blur.frag.h"
 #include "impeller/entity/rrect_blur.vert.h"
+#include "impeller/entity/rrect_fill.frag.h"
 #include "impeller/entity/solid_fill.frag.h"
 #include "impeller/entity/solid_fill.vert.h"
 #include "impeller/entity/srgb_to_linear_filter.frag.h"
@@ -65,6 +80,7 @@
 #include "impeller/entity/yuv_to_rgb_filter.vert.h"
 #include "impeller/renderer/formats.h"
 #include "impeller/renderer/pipeline.h"
+#include "impeller/renderer/render_target.h"
 
 #include "impeller/entity/position.vert.h"
 #include "impeller/entity/position_color.vert.h"
@@ -85,6 +101,10 @@ using SweepGradientFillPipeline =
 using BlendPipeline = RenderPipelineT<BlendVertexShader, BlendFragmentShader>;
 using RRectBlurPipeline =
     RenderPipelineT<RrectBlurVertexShader, RrectBlurFragmentShader>;
+// The fill shares the vertex stage of the blur, which passes the local
+// position of the quad through.
+using RRectFillPipeline =
+    RenderPipelineT<RrectBlurVertexShader, RrectFillFragmentShader>;
 using BlendPipeline = RenderPipelineT<BlendVertexShader, BlendFragmentShader>;
 using BlendColorPipeline = RenderPipelineT<AdvancedBlendVertexShader,
                                            AdvancedBlendColorFragmentShader>;
@@ -127,6 +147,8 @@ using BlendScreenPipeline = RenderPipelineT<AdvancedBlendVertexShader,
 using BlendSoftLightPipeline =
     RenderPipelineT<AdvancedBlendVertexShader,
                     AdvancedBlendSoftlightFragmentShader>;
+using FramebufferBlendPipeline =
+    RenderPipelineT<TextureFillVertexShader, FramebufferBlendFragmentShader>;
 using TexturePipeline =
     RenderPipelineT<TextureFillVertexShader, TextureFillFragmentShader>;
 using TiledTexturePipeline = RenderPipelineT<TiledTextureFillVertexShader,
@@ -141,6 +163,9 @@ using MorphologyFilterPipeline =
 using ColorMatrixColorFilterPipeline =
     RenderPipelineT<ColorMatrixColorFilterVertexShader,
                     ColorMatrixColorFilterFragmentShader>;
+using ColorFilterChainPipeline =
+    RenderPipelineT<ColorFilterChainVertexShader,
+                    ColorFilterChainFragmentShader>;
 using LinearToSrgbFilterPipeline =
     RenderPipelineT<LinearToSrgbFilterVertexShader,
                     LinearToSrgbFilterFragmentShader>;
@@ -153,6 +178,8 @@ using GlyphAtlasSdfPipeline =
     RenderPipelineT<GlyphAtlasSdfVertexShader, GlyphAtlasSdfFragmentShader>;
 using AtlasPipeline =
     RenderPipelineT<AtlasFillVertexShader, AtlasFillFragmentShader>;
+using AtlasInstancedPipeline =
+    RenderPipelineT<AtlasInstancedVertexShader, AtlasFillFragmentShader>;
 // Instead of requiring new shaders for clips, the solid fill stages are used
 // to redirect writing to the stencil instead of color attachments.
 using ClipPipeline =
@@ -190,13 +217,36 @@ struct ContentContextOptions {
     }
   };
 
+  /// Packs the options into an integer that is unique to them, so that
+  /// pipeline variants can be looked up without hashing the options.
+  constexpr uint64_t ToKey() const {
+    return static_cast<uint64_t>(sample_count) |
+           static_cast<uint64_t>(blend_mode) << 8u |
+           static_cast<uint64_t>(stencil_compare) << 16u |
+           static_cast<uint64_t>(stencil_operation) << 24u |
+           static_cast<uint64_t>(primitive_type) << 32u;
+  }
+
   void ApplyToPipelineDescriptor(PipelineDescriptor& desc) const;
 };
 
+class ComputeTessellator;
+class EntityPassCapture;
 class Tessellator;
 
 class ContentContext {
  public:
+  //----------------------------------------------------------------------------
+  /// @brief      Identifies a variant of one of the pipelines of a content
+  ///             context. Pipelines are named by the label of their
+  ///             prototype so that lists of variants remain meaningful across
+  ///             launches.
+  ///
+  struct PipelineVariant {
+    std::string pipeline;
+    ContentContextOptions options;
+  };
+
   explicit ContentContext(std::shared_ptr<Context> context);
 
   ~ContentContext();
@@ -205,6 +255,14 @@ class ContentContext {
 
   std::shared_ptr<Tessellator> GetTessellator() const;
 
+  std::shared_ptr<TessellationCache> GetTessellationCache() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The tessellator used to generate path vertices on the GPU, or
+  ///             nullptr if the context doesn't support compute.
+  ///
+  std::shared_ptr<ComputeTessellator> GetComputeTessellator() const;
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetLinearGradientFillPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(linear_gradient_fill_pipelines_, opts);
@@ -220,6 +278,11 @@ class ContentContext {
     return GetPipeline(rrect_blur_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetRRectFillPipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(rrect_fill_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetSweepGradientFillPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(sweep_gradient_fill_pipelines_, opts);
@@ -265,6 +328,11 @@ class ContentContext {
     return GetPipeline(color_matrix_color_filter_pipelines_, opts);
   }
 
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetColorFilterChainPipeline(
+      ContentContextOptions opts) const {
+    return GetPipeline(color_filter_chain_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetLinearToSrgbFilterPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(linear_to_srgb_filter_pipelines_, opts);
@@ -305,6 +373,15 @@ class ContentContext {
     return GetPipeline(atlas_pipelines_, opts);
   }
 
+  /// Only available on contexts that support instanced rendering.
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetAtlasInstancedPipeline(
+      ContentContextOptions opts) const {
+    if (atlas_instanced_pipelines_.GetSize() == 0u) {
+      return nullptr;
+    }
+    return GetPipeline(atlas_instanced_pipelines_, opts);
+  }
+
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetYUVToRGBFilterPipeline(
       ContentContextOptions opts) const {
     return GetPipeline(yuv_to_rgb_filter_pipelines_, opts);
@@ -387,10 +464,177 @@ class ContentContext {
     return GetPipeline(blend_softlight_pipelines_, opts);
   }
 
+  /// Applies all advanced blends in place. Only available on contexts that
+  /// support framebuffer fetch.
+  std::shared_ptr<Pipeline<PipelineDescriptor>> GetFramebufferBlendPipeline(
+      ContentContextOptions opts) const {
+    if (framebuffer_blend_pipelines_.GetSize() == 0u) {
+      return nullptr;
+    }
+    return GetPipeline(framebuffer_blend_pipelines_, opts);
+  }
+
   std::shared_ptr<Context> GetContext() const;
 
   std::shared_ptr<GlyphAtlasContext> GetGlyphAtlasContext() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The allocator used for the offscreen render targets of
+  ///             subpasses. Textures are recycled between frames delimited
+  ///             by `RenderTargetAllocator::Start` and
+  ///             `RenderTargetAllocator::End`.
+  ///
+  std::shared_ptr<RenderTargetAllocator> GetRenderTargetCache() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the gradient texture for the given colors and stops.
+  ///             Textures are cached so that unchanged gradients aren't
+  ///             reallocated and uploaded on every frame.
+  ///
+  std::shared_ptr<Texture> GetGradientTexture(
+      const std::vector<Color>& colors,
+      const std::vector<Scalar>& stops) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the command buffers of offscreen subpasses may be
+  ///             encoded on the context's worker queue. Backends that can't
+  ///             encode asynchronously fall back to encoding on the calling
+  ///             thread.
+  ///
+  void SetParallelSubpassEncodingEnabled(bool enabled);
+
+  bool IsParallelSubpassEncodingEnabled() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether entity passes may merge the draws of adjacent
+  ///             entities into a single draw. See |Contents::RenderBatch|.
+  ///
+  void SetDrawBatchingEnabled(bool enabled);
+
+  bool IsDrawBatchingEnabled() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Note that `count` entity draws were merged into the draw of
+  ///             a preceding entity instead of being issued on their own.
+  ///
+  void RecordCoalescedDraws(size_t count);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of entity draws that were merged into other draws
+  ///             since the count was last reset.
+  ///
+  size_t GetCoalescedDrawCount() const;
+
+  void ResetCoalescedDrawCount();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Note that `count` entities were skipped because they lie
+  ///             outside of the current clip.
+  ///
+  void RecordClipCulledEntities(size_t count);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Note that `count` entities were skipped because opaque
+  ///             entities drawn after them fully hide them.
+  ///
+  void RecordOccludedEntities(size_t count);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of entities that were skipped for being outside of
+  ///             the clip since the counts were last reset.
+  ///
+  size_t GetClipCulledEntityCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of entities that were skipped for being hidden
+  ///             under opaque entities since the counts were last reset.
+  ///
+  size_t GetOccludedEntityCount() const;
+
+  void ResetCulledEntityCounts();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Start creating the given pipeline variants so that they
+  ///             don't have to be created on first use in the middle of a
+  ///             frame. This doesn't block, the backends compile pipelines
+  ///             on their worker threads. Must be called on the thread that
+  ///             renders with this content context.
+  ///
+  /// @param[in]  variants  The variants to create. Variants of pipelines
+  ///                       that are unknown to this content context are
+  ///                       ignored.
+  ///
+  /// @return     The number of variants whose creation was started.
+  ///
+  size_t PrewarmPipelineVariants(
+      const std::vector<PipelineVariant>& variants) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether to record every pipeline variant that is requested
+  ///             while rendering. The recorded list can be persisted and
+  ///             given to |PrewarmPipelineVariants| on the next launch.
+  ///
+  void SetPipelineVariantRecordingEnabled(bool enabled);
+
+  std::vector<PipelineVariant> GetRecordedPipelineVariants() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the entity passes rendered with this content context
+  ///             into `capture`, or stop recording them if it is null.
+  ///             Capturing also enables the recording of pipeline variants,
+  ///             which are included in the capture.
+  ///
+  void SetEntityPassCapture(std::shared_ptr<EntityPassCapture> capture);
+
+  const std::shared_ptr<EntityPassCapture>& GetEntityPassCapture() const;
+
+  static std::string SerializePipelineVariants(
+      const std::vector<PipelineVariant>& variants);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Parse variants serialized with |SerializePipelineVariants|.
+  ///             Malformed entries are skipped.
+  ///
+  static std::vector<PipelineVariant> DeserializePipelineVariants(
+      std::string_view data);
+
+  using RuntimeEffectDescriptorCallback =
+      std::function<std::optional<PipelineDescriptor>()>;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the pipeline of a runtime effect with the given options.
+  ///             Pipelines are shared by all runtime effects whose runtime
+  ///             stages have the same hash. If there is no such pipeline yet,
+  ///             its creation is started with the descriptor returned by
+  ///             `create_descriptor`.
+  ///
+  /// @return     The future of the pipeline. The future is invalid if the
+  ///             descriptor couldn't be created.
+  ///
+  PipelineFuture<PipelineDescriptor> GetRuntimeEffectPipeline(
+      size_t runtime_stage_hash,
+      ContentContextOptions opts,
+      const RuntimeEffectDescriptorCallback& create_descriptor) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether runtime effects whose pipelines are still being
+  ///             created are skipped instead of waiting for the pipeline.
+  ///
+  void SetRuntimeEffectAsyncCompilationEnabled(bool enabled);
+
+  bool IsRuntimeEffectAsyncCompilationEnabled() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The blur radius, in pixels, above which Gaussian blurs sample
+  ///             a progressively downsampled copy of their input instead of
+  ///             the input itself. Devices with limited fill rate can lower
+  ///             it to trade blur quality for speed. Zero disables
+  ///             downsampling.
+  ///
+  void SetGaussianBlurDownsampleRadius(Scalar radius);
+
+  Scalar GetGaussianBlurDownsampleRadius() const;
+
   using SubpassCallback =
       std::function<bool(const ContentContext&, RenderPass&)>;
 
@@ -403,11 +647,34 @@ class ContentContext {
  private:
   std::shared_ptr<Context> context_;
 
+  // The variants of a pipeline, keyed by their options. The prototype is the
+  // variant with the default options. Variants can be looked up from any
+  // thread without locking while others are inserted, for example by
+  // parallel subpass encoding and background prewarming.
   template <class T>
-  using Variants = std::unordered_map<ContentContextOptions,
-                                      std::unique_ptr<T>,
-                                      ContentContextOptions::Hash,
-                                      ContentContextOptions::Equal>;
+  class Variants {
+   public:
+    T* Get(ContentContextOptions opts) const {
+      return variants_.Find(opts.ToKey());
+    }
+
+    T* GetPrototype() const { return Get({}); }
+
+    // Inserts the variant unless there is one for |opts| already. Returns
+    // the variant in the table.
+    T* Set(ContentContextOptions opts, std::unique_ptr<T> variant) {
+      return variants_.Insert(opts.ToKey(), std::move(variant));
+    }
+
+    void SetPrototype(std::unique_ptr<T> prototype) {
+      Set({}, std::move(prototype));
+    }
+
+    size_t GetSize() const { return variants_.GetSize(); }
+
+   private:
+    LockFreeLookupTable<T> variants_;
+  };
 
   // These are mutable because while the prototypes are created eagerly, any
   // variants requested from that are lazily created and cached in the variants
@@ -417,6 +684,7 @@ class ContentContext {
   mutable Variants<RadialGradientFillPipeline> radial_gradient_fill_pipelines_;
   mutable Variants<SweepGradientFillPipeline> sweep_gradient_fill_pipelines_;
   mutable Variants<RRectBlurPipeline> rrect_blur_pipelines_;
+  mutable Variants<RRectFillPipeline> rrect_fill_pipelines_;
   mutable Variants<BlendPipeline> texture_blend_pipelines_;
   mutable Variants<TexturePipeline> texture_pipelines_;
   mutable Variants<TiledTexturePipeline> tiled_texture_pipelines_;
@@ -425,12 +693,14 @@ class ContentContext {
   mutable Variants<MorphologyFilterPipeline> morphology_filter_pipelines_;
   mutable Variants<ColorMatrixColorFilterPipeline>
       color_matrix_color_filter_pipelines_;
+  mutable Variants<ColorFilterChainPipeline> color_filter_chain_pipelines_;
   mutable Variants<LinearToSrgbFilterPipeline> linear_to_srgb_filter_pipelines_;
   mutable Variants<SrgbToLinearFilterPipeline> srgb_to_linear_filter_pipelines_;
   mutable Variants<ClipPipeline> clip_pipelines_;
   mutable Variants<GlyphAtlasPipeline> glyph_atlas_pipelines_;
   mutable Variants<GlyphAtlasSdfPipeline> glyph_atlas_sdf_pipelines_;
   mutable Variants<AtlasPipeline> atlas_pipelines_;
+  mutable Variants<AtlasInstancedPipeline> atlas_instanced_pipelines_;
   mutable Variants<GeometryPositionPipeline> geometry_position_pipelines_;
   mutable Variants<GeometryColorPipeline> geometry_color_pipelines_;
   mutable Variants<YUVToRGBFilterPipeline> yuv_to_rgb_filter_pipelines_;
@@ -450,6 +720,106 @@ class ContentContext {
   mutable Variants<BlendSaturationPipeline> blend_saturation_pipelines_;
   mutable Variants<BlendScreenPipeline> blend_screen_pipelines_;
   mutable Variants<BlendSoftLightPipeline> blend_softlight_pipelines_;
+  mutable Variants<FramebufferBlendPipeline> framebuffer_blend_pipelines_;
+
+  template <class Visitor>
+  void ForEachPipelineVariants(Visitor&& visitor) const {
+    visitor(solid_fill_pipelines_);
+    visitor(linear_gradient_fill_pipelines_);
+    visitor(radial_gradient_fill_pipelines_);
+    visitor(sweep_gradient_fill_pipelines_);
+    visitor(rrect_blur_pipelines_);
+    visitor(rrect_fill_pipelines_);
+    visitor(texture_blend_pipelines_);
+    visitor(texture_pipelines_);
+    visitor(tiled_texture_pipelines_);
+    visitor(gaussian_blur_pipelines_);
+    visitor(border_mask_blur_pipelines_);
+    visitor(morphology_filter_pipelines_);
+    visitor(color_matrix_color_filter_pipelines_);
+    visitor(color_filter_chain_pipelines_);
+    visitor(linear_to_srgb_filter_pipelines_);
+    visitor(srgb_to_linear_filter_pipelines_);
+    visitor(clip_pipelines_);
+    visitor(glyph_atlas_pipelines_);
+    visitor(glyph_atlas_sdf_pipelines_);
+    visitor(atlas_pipelines_);
+    visitor(atlas_instanced_pipelines_);
+    visitor(geometry_position_pipelines_);
+    visitor(geometry_color_pipelines_);
+    visitor(yuv_to_rgb_filter_pipelines_);
+    visitor(blend_color_pipelines_);
+    visitor(blend_colorburn_pipelines_);
+    visitor(blend_colordodge_pipelines_);
+    visitor(blend_darken_pipelines_);
+    visitor(blend_difference_pipelines_);
+    visitor(blend_exclusion_pipelines_);
+    visitor(blend_hardlight_pipelines_);
+    visitor(blend_hue_pipelines_);
+    visitor(blend_lighten_pipelines_);
+    visitor(blend_luminosity_pipelines_);
+    visitor(blend_multiply_pipelines_);
+    visitor(blend_overlay_pipelines_);
+    visitor(blend_saturation_pipelines_);
+    visitor(blend_screen_pipelines_);
+    visitor(blend_softlight_pipelines_);
+    visitor(framebuffer_blend_pipelines_);
+  }
+
+  template <class TypedPipeline>
+  static std::optional<std::string> GetPrototypeLabel(
+      const Variants<TypedPipeline>& container) {
+    auto prototype = container.GetPrototype();
+    if (!prototype) {
+      return std::nullopt;
+    }
+    auto desc = prototype->GetDescriptor();
+    if (!desc.has_value()) {
+      return std::nullopt;
+    }
+    return desc->GetLabel();
+  }
+
+  template <class TypedPipeline>
+  void RecordPipelineVariant(const Variants<TypedPipeline>& container,
+                             ContentContextOptions opts) const {
+    auto label = GetPrototypeLabel(container);
+    if (!label.has_value()) {
+      return;
+    }
+    Lock lock(recorded_pipeline_variants_mutex_);
+    for (const auto& recorded : recorded_pipeline_variants_) {
+      if (recorded.pipeline == label.value() &&
+          ContentContextOptions::Equal{}(recorded.options, opts)) {
+        return;
+      }
+    }
+    recorded_pipeline_variants_.push_back({label.value(), opts});
+  }
+
+  template <class TypedPipeline>
+  bool PrewarmPipelineVariant(Variants<TypedPipeline>& container,
+                              const PipelineVariant& variant) const {
+    if (container.Get(variant.options)) {
+      return false;
+    }
+    auto prototype = container.GetPrototype();
+    if (!prototype) {
+      return false;
+    }
+    // Variants are created from the descriptor of the prototype so that the
+    // prototype itself doesn't need to be waited on.
+    auto desc = prototype->GetDescriptor();
+    if (!desc.has_value() || desc->GetLabel() != variant.pipeline) {
+      return false;
+    }
+    variant.options.ApplyToPipelineDescriptor(desc.value());
+    desc->SetLabel(
+        SPrintF("%s V#%zu", desc->GetLabel().c_str(), container.GetSize()));
+    container.Set(variant.options,
+                  std::make_unique<TypedPipeline>(*context_, std::move(desc)));
+    return true;
+  }
 
   template <class TypedPipeline>
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetPipeline(
@@ -459,30 +829,80 @@ class ContentContext {
       return nullptr;
     }
 
-    if (auto found = container.find(opts); found != container.end()) {
-      return found->second->WaitAndGet();
+    if (record_pipeline_variants_) {
+      RecordPipelineVariant(container, opts);
+    }
+
+    if (auto found = container.Get(opts)) {
+      return found->WaitAndGet();
     }
 
-    auto prototype = container.find({});
+    auto prototype = container.GetPrototype();
 
     // The prototype must always be initialized in the constructor.
-    FML_CHECK(prototype != container.end());
+    FML_CHECK(prototype);
 
-    auto variant_future = prototype->second->WaitAndGet()->CreateVariant(
-        [&opts, variants_count = container.size()](PipelineDescriptor& desc) {
+    auto variant_future = prototype->WaitAndGet()->CreateVariant(
+        [&opts,
+         variants_count = container.GetSize()](PipelineDescriptor& desc) {
           opts.ApplyToPipelineDescriptor(desc);
           desc.SetLabel(
               SPrintF("%s V#%zu", desc.GetLabel().c_str(), variants_count));
         });
-    auto variant = std::make_unique<TypedPipeline>(std::move(variant_future));
-    auto variant_pipeline = variant->WaitAndGet();
-    container[opts] = std::move(variant);
-    return variant_pipeline;
-  }
+    // If another thread created the same variant in the meantime, its
+    // variant is kept and this one is dropped.
+    return container
+        .Set(opts, std::make_unique<TypedPipeline>(std::move(variant_future)))
+        ->WaitAndGet();
+  }
+
+  struct RuntimeEffectPipelineKey {
+    size_t runtime_stage_hash = 0u;
+    ContentContextOptions options;
+
+    struct Hash {
+      std::size_t operator()(const RuntimeEffectPipelineKey& key) const {
+        return fml::HashCombine(key.runtime_stage_hash,
+                                ContentContextOptions::Hash{}(key.options));
+      }
+    };
+
+    struct Equal {
+      bool operator()(const RuntimeEffectPipelineKey& lhs,
+                      const RuntimeEffectPipelineKey& rhs) const {
+        return lhs.runtime_stage_hash == rhs.runtime_stage_hash &&
+               ContentContextOptions::Equal{}(lhs.options, rhs.options);
+      }
+    };
+  };
+
+  mutable Mutex runtime_effect_pipelines_mutex_;
+  mutable std::unordered_map<RuntimeEffectPipelineKey,
+                             PipelineFuture<PipelineDescriptor>,
+                             RuntimeEffectPipelineKey::Hash,
+                             RuntimeEffectPipelineKey::Equal>
+      runtime_effect_pipelines_
+          IPLR_GUARDED_BY(runtime_effect_pipelines_mutex_);
 
   bool is_valid_ = false;
+  bool parallel_subpass_encoding_enabled_ = true;
+  bool runtime_effect_async_compilation_enabled_ = true;
+  bool record_pipeline_variants_ = false;
+  bool draw_batching_enabled_ = true;
+  Scalar gaussian_blur_downsample_radius_ = 16.0f;
+  size_t coalesced_draw_count_ = 0u;
+  size_t clip_culled_entity_count_ = 0u;
+  size_t occluded_entity_count_ = 0u;
+  mutable Mutex recorded_pipeline_variants_mutex_;
+  mutable std::vector<PipelineVariant> recorded_pipeline_variants_
+      IPLR_GUARDED_BY(recorded_pipeline_variants_mutex_);
   std::shared_ptr<Tessellator> tessellator_;
+  std::shared_ptr<TessellationCache> tessellation_cache_;
+  std::shared_ptr<ComputeTessellator> compute_tessellator_;
   std::shared_ptr<GlyphAtlasContext> glyph_atlas_context_;
+  std::shared_ptr<RenderTargetAllocator> render_target_cache_;
+  std::unique_ptr<GradientTextureCache> gradient_texture_cache_;
+  std::shared_ptr<EntityPassCapture> entity_pass_capture_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ContentContext);
 };
@@ -85,4 +85,27 @@ bool Contents::ShouldRender(const Entity& entity,
   return stencil_coverage->IntersectsWithRect(coverage.value());
 }
 
+bool Contents::IsOpaqueWithinCoverage(const Entity& entity) const {
+  return false;
+}
+
+Contents::BatchKind Contents::GetBatchKind(const Entity& entity) const {
+  return BatchKind::kNone;
+}
+
+bool Contents::CanBatchWith(const Entity& entity, const Entity& other) const {
+  return false;
+}
+
+bool Contents::RenderBatch(const ContentContext& renderer,
+                           const std::vector<Entity>& entities,
+                           RenderPass& pass) const {
+  for (const auto& entity : entities) {
+    if (!entity.Render(renderer, pass)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace impeller
@@ -37,8 +37,20 @@ class Contents {
 
     Type type = Type::kNone;
     std::optional<Rect> coverage = std::nullopt;
+    /// Set for appends whose clip is exactly the intersection of the current
+    /// clip with |coverage|. These can be applied with a scissor rect instead
+    /// of drawing into the stencil.
+    bool is_rect_intersection = false;
   };
 
+  /// @brief The kinds of contents that can merge the draws of adjacent
+  ///        entities into a single draw with |RenderBatch|.
+  enum class BatchKind { kNone, kSolidColor, kTexture };
+
+  /// @brief The most entities that are given to a single |RenderBatch| call,
+  ///        so that batches can always be indexed with 16 bit indices.
+  static constexpr size_t kMaxBatchSize = 4096;
+
   virtual bool Render(const ContentContext& renderer,
                       const Entity& entity,
                       RenderPass& pass) const = 0;
@@ -65,6 +77,29 @@ class Contents {
   virtual bool ShouldRender(const Entity& entity,
                             const std::optional<Rect>& stencil_coverage) const;
 
+  /// @brief Whether every pixel within `GetCoverage(entity)` is painted with
+  ///        an opaque color. Entity passes skip the entities drawn before
+  ///        this one that it fully hides.
+  virtual bool IsOpaqueWithinCoverage(const Entity& entity) const;
+
+  /// @brief Get the kind of batch that this contents can join when rendered
+  ///        for the given entity, or `BatchKind::kNone` if it must always be
+  ///        rendered on its own.
+  virtual BatchKind GetBatchKind(const Entity& entity) const;
+
+  /// @brief Whether the draw of `other` can be merged into the batch started
+  ///        by this contents for `entity`. Only called when the contents of
+  ///        `other` has the same batch kind as this contents.
+  virtual bool CanBatchWith(const Entity& entity, const Entity& other) const;
+
+  /// @brief Render a run of adjacent entities whose contents can all be
+  ///        batched with the contents of the first entity, which is this
+  ///        contents. Renders each entity separately by default. Never
+  ///        called with more than `kMaxBatchSize` entities.
+  virtual bool RenderBatch(const ContentContext& renderer,
+                           const std::vector<Entity>& entities,
+                           RenderPass& pass) const;
+
  protected:
 
  private:
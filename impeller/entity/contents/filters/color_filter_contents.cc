@@ -4,13 +4,17 @@
 
 #include "impeller/entity/contents/filters/color_filter_contents.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "impeller/base/validation.h"
+#include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/contents/filters/blend_filter_contents.h"
 #include "impeller/entity/contents/filters/color_matrix_filter_contents.h"
 #include "impeller/entity/contents/filters/linear_to_srgb_filter_contents.h"
 #include "impeller/entity/contents/filters/srgb_to_linear_filter_contents.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/sampler_library.h"
 
 namespace impeller {
 
@@ -90,4 +94,172 @@ bool ColorFilterContents::GetAbsorbOpacity() const {
   return absorb_opacity_;
 }
 
+std::optional<ColorFilterContents::FusedStage>
+ColorFilterContents::GetFusedStage() const {
+  return std::nullopt;
+}
+
+std::vector<ColorFilterContents::FusedStage>
+ColorFilterContents::CollectFusedStages(FilterInput::Ref& source) const {
+  std::vector<FusedStage> stages;
+  const ColorFilterContents* filter = this;
+  while (filter && stages.size() < kMaxFusedStages) {
+    auto stage = filter->GetFusedStage();
+    const auto& inputs = filter->GetInputs();
+    if (!stage.has_value() || inputs.size() != 1u) {
+      break;
+    }
+    stages.push_back(stage.value());
+    source = inputs[0];
+
+    // Keep walking while the input is another color filter. A crop on an
+    // inner filter applies to an intermediate result that is never rendered
+    // when fused, so cropped filters end the chain.
+    filter = nullptr;
+    auto input = source->GetInput();
+    if (auto input_filter =
+            std::get_if<std::shared_ptr<FilterContents>>(&input)) {
+      auto color_filter = (*input_filter)->AsColorFilterContents();
+      if (color_filter && !color_filter->GetCoverageCrop().has_value()) {
+        filter = color_filter;
+      }
+    }
+  }
+  std::reverse(stages.begin(), stages.end());
+  return stages;
+}
+
+const ColorFilterContents* ColorFilterContents::AsColorFilterContents() const {
+  return this;
+}
+
+std::optional<Snapshot> ColorFilterContents::RenderToSnapshot(
+    const ContentContext& renderer,
+    const Entity& entity) const {
+  FilterInput::Ref source;
+  auto stages = CollectFusedStages(source);
+  // A lone filter is rendered with its own specialized shader.
+  if (stages.size() < 2u) {
+    return FilterContents::RenderToSnapshot(renderer, entity);
+  }
+
+  auto coverage = GetCoverage(entity);
+  if (!coverage.has_value() || coverage->IsEmpty()) {
+    return std::nullopt;
+  }
+
+  Entity entity_with_local_transform = entity;
+  entity_with_local_transform.SetTransformation(
+      GetTransform(entity.GetTransformation()));
+  return RenderFusedStages(stages, source, renderer,
+                           entity_with_local_transform);
+}
+
+std::optional<Snapshot> ColorFilterContents::RenderFusedStages(
+    const std::vector<FusedStage>& stages,
+    const FilterInput::Ref& source,
+    const ContentContext& renderer,
+    const Entity& entity) const {
+  using VS = ColorFilterChainPipeline::VertexShader;
+  using FS = ColorFilterChainPipeline::FragmentShader;
+
+  FML_DCHECK(!stages.empty() && stages.size() <= kMaxFusedStages);
+
+  auto input_snapshot = source->GetSnapshot(renderer, entity);
+  if (!input_snapshot.has_value()) {
+    return std::nullopt;
+  }
+
+  // Resolve where the input opacity is absorbed. Each stage that absorbs
+  // opacity multiplies in whatever hasn't been absorbed by an earlier stage.
+  Scalar opacity = input_snapshot->opacity;
+  Scalar stage_types[kMaxFusedStages] = {};
+  Scalar stage_input_alphas[kMaxFusedStages] = {1, 1, 1, 1};
+  Matrix color_m[kMaxFusedStages];
+  Vector4 color_v[kMaxFusedStages];
+  for (size_t i = 0; i < stages.size(); i++) {
+    const auto& stage = stages[i];
+    stage_types[i] = static_cast<Scalar>(stage.type);
+    if (stage.absorb_opacity) {
+      stage_input_alphas[i] = opacity;
+      opacity = 1.0f;
+    }
+    if (stage.type == FusedStage::Type::kColorMatrix) {
+      const float* m = stage.matrix.array;
+      color_v[i] = Vector4(m[4], m[9], m[14], m[19]);
+      // clang-format off
+      color_m[i] = Matrix(
+          m[0], m[5], m[10], m[15],
+          m[1], m[6], m[11], m[16],
+          m[2], m[7], m[12], m[17],
+          m[3], m[8], m[13], m[18]
+      );
+      // clang-format on
+    }
+  }
+
+  ContentContext::SubpassCallback callback = [&](const ContentContext& renderer,
+                                                 RenderPass& pass) {
+    Command cmd;
+    cmd.label = "Color Filter Chain";
+
+    auto options = OptionsFromPass(pass);
+    options.blend_mode = BlendMode::kSource;
+    cmd.pipeline = renderer.GetColorFilterChainPipeline(options);
+
+    VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+    vtx_builder.AddVertices({
+        {Point(0, 0)},
+        {Point(1, 0)},
+        {Point(1, 1)},
+        {Point(0, 0)},
+        {Point(1, 1)},
+        {Point(0, 1)},
+    });
+    auto& host_buffer = pass.GetTransientsBuffer();
+    auto vtx_buffer = vtx_builder.CreateVertexBuffer(host_buffer);
+    cmd.BindVertices(vtx_buffer);
+
+    VS::FrameInfo frame_info;
+    frame_info.mvp = Matrix::MakeOrthographic(ISize(1, 1));
+
+    FS::FragInfo frag_info;
+    frag_info.color_m0 = color_m[0];
+    frag_info.color_m1 = color_m[1];
+    frag_info.color_m2 = color_m[2];
+    frag_info.color_m3 = color_m[3];
+    frag_info.color_v0 = color_v[0];
+    frag_info.color_v1 = color_v[1];
+    frag_info.color_v2 = color_v[2];
+    frag_info.color_v3 = color_v[3];
+    frag_info.stage_types = Vector4(stage_types[0], stage_types[1],
+                                    stage_types[2], stage_types[3]);
+    frag_info.stage_input_alphas =
+        Vector4(stage_input_alphas[0], stage_input_alphas[1],
+                stage_input_alphas[2], stage_input_alphas[3]);
+    frag_info.texture_sampler_y_coord_scale =
+        input_snapshot->texture->GetYCoordScale();
+    frag_info.stage_count = static_cast<Scalar>(stages.size());
+
+    auto sampler = renderer.GetContext()->GetSamplerLibrary()->GetSampler({});
+    FS::BindInputTexture(cmd, input_snapshot->texture, sampler);
+    FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+    VS::BindFrameInfo(cmd, host_buffer.EmplaceUniform(frame_info));
+
+    return pass.AddCommand(std::move(cmd));
+  };
+
+  auto out_texture =
+      renderer.MakeSubpass(input_snapshot->texture->GetSize(), callback);
+  if (!out_texture) {
+    return std::nullopt;
+  }
+  out_texture->SetLabel("ColorFilterChain Texture");
+
+  return Snapshot{.texture = out_texture,
+                  .transform = input_snapshot->transform,
+                  .sampler_descriptor = input_snapshot->sampler_descriptor,
+                  .opacity = opacity};
+}
+
 }  // namespace impeller
@@ -4,12 +4,28 @@
 
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "impeller/entity/contents/filters/filter_contents.h"
 
 namespace impeller {
 
 class ColorFilterContents : public FilterContents {
  public:
+  /// The per-pixel transform applied by a color filter that may be rendered
+  /// in the same pass as the color filters adjacent to it.
+  struct FusedStage {
+    enum class Type { kColorMatrix, kLinearToSrgb, kSrgbToLinear };
+
+    Type type = Type::kColorMatrix;
+    ColorMatrix matrix = {};
+    bool absorb_opacity = false;
+  };
+
+  /// The maximum number of filters rendered in a single fused pass.
+  static constexpr size_t kMaxFusedStages = 4u;
+
   static std::shared_ptr<ColorFilterContents> MakeBlend(
       BlendMode blend_mode,
       FilterInput::Vector inputs,
@@ -33,7 +49,32 @@ class ColorFilterContents : public FilterContents {
 
   bool GetAbsorbOpacity() const;
 
+  /// @brief  The transform this filter applies when fused with adjacent
+  ///         color filters, or std::nullopt if it can't be fused.
+  virtual std::optional<FusedStage> GetFusedStage() const;
+
+  /// @brief  Collects the stages of this filter and of the chain of fusable
+  ///         color filters feeding its input, innermost first. `source` is
+  ///         set to the input that the innermost stage reads from.
+  ///
+  ///         At most |kMaxFusedStages| are collected. Returns an empty vector
+  ///         if this filter can't be fused.
+  std::vector<FusedStage> CollectFusedStages(FilterInput::Ref& source) const;
+
+  // |FilterContents|
+  const ColorFilterContents* AsColorFilterContents() const override;
+
+  // |Contents|
+  std::optional<Snapshot> RenderToSnapshot(const ContentContext& renderer,
+                                           const Entity& entity) const override;
+
  private:
+  std::optional<Snapshot> RenderFusedStages(
+      const std::vector<FusedStage>& stages,
+      const FilterInput::Ref& source,
+      const ContentContext& renderer,
+      const Entity& entity) const;
+
   bool absorb_opacity_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ColorFilterContents);
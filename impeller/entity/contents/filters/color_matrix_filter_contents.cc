@@ -23,6 +23,13 @@ void ColorMatrixFilterContents::SetMatrix(const ColorMatrix& matrix) {
   matrix_ = matrix;
 }
 
+std::optional<ColorFilterContents::FusedStage>
+ColorMatrixFilterContents::GetFusedStage() const {
+  return FusedStage{.type = FusedStage::Type::kColorMatrix,
+                    .matrix = matrix_,
+                    .absorb_opacity = GetAbsorbOpacity()};
+}
+
 std::optional<Snapshot> ColorMatrixFilterContents::RenderFilter(
     const FilterInput::Vector& inputs,
     const ContentContext& renderer,
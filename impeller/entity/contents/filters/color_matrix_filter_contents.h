@@ -22,6 +22,9 @@ class ColorMatrixFilterContents final : public ColorFilterContents {
 
   void SetMatrix(const ColorMatrix& matrix);
 
+  // |ColorFilterContents|
+  std::optional<FusedStage> GetFusedStage() const override;
+
  private:
   // |FilterContents|
   std::optional<Snapshot> RenderFilter(
@@ -149,10 +149,18 @@ void FilterContents::SetInputs(FilterInput::Vector inputs) {
   inputs_ = std::move(inputs);
 }
 
+const FilterInput::Vector& FilterContents::GetInputs() const {
+  return inputs_;
+}
+
 void FilterContents::SetCoverageCrop(std::optional<Rect> coverage_crop) {
   coverage_crop_ = coverage_crop;
 }
 
+const std::optional<Rect>& FilterContents::GetCoverageCrop() const {
+  return coverage_crop_;
+}
+
 void FilterContents::SetEffectTransform(Matrix effect_transform) {
   effect_transform_ = effect_transform.Basis();
 }
@@ -258,4 +266,8 @@ Matrix FilterContents::GetTransform(const Matrix& parent_transform) const {
   return parent_transform * GetLocalTransform(parent_transform);
 }
 
+const ColorFilterContents* FilterContents::AsColorFilterContents() const {
+  return nullptr;
+}
+
 }  // namespace impeller
@@ -16,6 +16,8 @@
 
 namespace impeller {
 
+class ColorFilterContents;
+
 class FilterContents : public Contents {
  public:
   enum class BlurStyle {
@@ -100,9 +102,13 @@ class FilterContents : public Contents {
   ///         particular filter's implementation.
   void SetInputs(FilterInput::Vector inputs);
 
+  const FilterInput::Vector& GetInputs() const;
+
   /// @brief  Screen space bounds to use for cropping the filter output.
   void SetCoverageCrop(std::optional<Rect> coverage_crop);
 
+  const std::optional<Rect>& GetCoverageCrop() const;
+
   /// @brief  Sets the transform which gets appended to the effect of this
   ///         filter. Note that this is in addition to the entity's transform.
   void SetEffectTransform(Matrix effect_transform);
@@ -123,6 +129,11 @@ class FilterContents : public Contents {
 
   Matrix GetTransform(const Matrix& parent_transform) const;
 
+  /// @brief  Returns this filter if it is a |ColorFilterContents|, or nullptr
+  ///         otherwise. Used to walk chains of color filters that can be
+  ///         rendered in a single pass.
+  virtual const ColorFilterContents* AsColorFilterContents() const;
+
  private:
   virtual std::optional<Rect> GetFilterCoverage(
       const FilterInput::Vector& inputs,
@@ -4,6 +4,7 @@
 
 #include "impeller/entity/contents/filters/gaussian_blur_filter_contents.h"
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 #include <valarray>
@@ -12,6 +13,8 @@
 #include "impeller/base/validation.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/contents/filters/filter_contents.h"
+#include "impeller/entity/contents/texture_contents.h"
+#include "impeller/entity/entity.h"
 #include "impeller/geometry/rect.h"
 #include "impeller/geometry/scalar.h"
 #include "impeller/renderer/command_buffer.h"
@@ -23,6 +26,9 @@
 
 namespace impeller {
 
+// Each level halves the input, so this limits the downsampling to 1/16th.
+static constexpr size_t kMaxDownsampleLevels = 4u;
+
 DirectionalGaussianBlurFilterContents::DirectionalGaussianBlurFilterContents() =
     default;
 
@@ -81,6 +87,71 @@ void DirectionalGaussianBlurFilterContents::SetSourceOverride(
   source_override_ = std::move(source_override);
 }
 
+size_t DirectionalGaussianBlurFilterContents::GetDownsampleLevels(
+    Scalar blur_radius,
+    Scalar texel_size,
+    Scalar downsample_radius) {
+  if (downsample_radius <= 0 || texel_size <= 0 ||
+      blur_radius <= downsample_radius) {
+    return 0u;
+  }
+  // Stop before fewer than half of |downsample_radius| samples would be left
+  // on each side of the kernel.
+  size_t levels = 0u;
+  while (levels < kMaxDownsampleLevels &&
+         blur_radius / (texel_size * 2) >= downsample_radius / 2) {
+    texel_size *= 2;
+    levels++;
+  }
+  return levels;
+}
+
+/// Halves the snapshot's texture along one axis. The linear sampler averages
+/// each pair of texels, which box filters the input.
+static std::optional<Snapshot> DownsampleSnapshot(
+    const ContentContext& renderer,
+    const Snapshot& snapshot,
+    bool horizontal) {
+  auto size = snapshot.texture->GetSize();
+  auto downsampled_size = horizontal
+                              ? ISize((size.width + 1) / 2, size.height)
+                              : ISize(size.width, (size.height + 1) / 2);
+  if (downsampled_size == size) {
+    return std::nullopt;
+  }
+
+  SamplerDescriptor sampler_desc;
+  sampler_desc.min_filter = MinMagFilter::kLinear;
+  sampler_desc.mag_filter = MinMagFilter::kLinear;
+
+  auto contents = TextureContents::MakeRect(Rect::MakeSize(downsampled_size));
+  contents->SetLabel("Gaussian Blur Downsample");
+  contents->SetTexture(snapshot.texture);
+  contents->SetSourceRect(Rect::MakeSize(size));
+  contents->SetSamplerDescriptor(sampler_desc);
+  contents->SetStencilEnabled(false);
+
+  ContentContext::SubpassCallback callback = [&](const ContentContext& renderer,
+                                                 RenderPass& pass) {
+    Entity entity;
+    entity.SetBlendMode(BlendMode::kSource);
+    return contents->Render(renderer, entity, pass);
+  };
+
+  auto texture = renderer.MakeSubpass(downsampled_size, callback);
+  if (!texture) {
+    return std::nullopt;
+  }
+  texture->SetLabel("DirectionalGaussianBlurFilter Downsample Texture");
+
+  return Snapshot{.texture = texture,
+                  .transform = snapshot.transform *
+                               Matrix::MakeScale(Vector2(size) /
+                                                 Vector2(downsampled_size)),
+                  .sampler_descriptor = sampler_desc,
+                  .opacity = snapshot.opacity};
+}
+
 std::optional<Snapshot> DirectionalGaussianBlurFilterContents::RenderFilter(
     const FilterInput::Vector& inputs,
     const ContentContext& renderer,
@@ -123,6 +194,37 @@ std::optional<Snapshot> DirectionalGaussianBlurFilterContents::RenderFilter(
     return input_snapshot.value();  // No blur to render.
   }
 
+  // Blurs with a large radius sample a progressively downsampled copy of the
+  // input once per downsampled texel instead of once per pixel.
+  Scalar sample_stride = 1;
+  {
+    auto texture_direction = input_snapshot->transform.Invert()
+                                 .TransformDirection(transformed_blur_radius)
+                                 .Normalize();
+    // The input can only be downsampled along the blur direction when the
+    // blur is aligned with one of its axes.
+    bool horizontal = ScalarNearlyZero(texture_direction.y);
+    if (horizontal || ScalarNearlyZero(texture_direction.x)) {
+      auto texel_axis = horizontal ? Vector2(1, 0) : Vector2(0, 1);
+      auto get_texel_size = [&input_snapshot, &texel_axis]() {
+        return input_snapshot->transform.TransformDirection(texel_axis)
+            .GetLength();
+      };
+      auto levels =
+          GetDownsampleLevels(transformed_blur_radius_length, get_texel_size(),
+                              renderer.GetGaussianBlurDownsampleRadius());
+      for (size_t i = 0; i < levels; i++) {
+        auto downsampled =
+            DownsampleSnapshot(renderer, input_snapshot.value(), horizontal);
+        if (!downsampled.has_value()) {
+          break;
+        }
+        input_snapshot = downsampled;
+        sample_stride = std::max(1.0f, get_texel_size());
+      }
+    }
+  }
+
   // A matrix that rotates the snapshot space such that the blur direction is
   // +X.
   auto texture_rotate = Matrix::MakeRotationZ(
@@ -191,8 +293,17 @@ std::optional<Snapshot> DirectionalGaussianBlurFilterContents::RenderFilter(
         source_snapshot->texture->GetYCoordScale();
 
     auto r = Radius{transformed_blur_radius_length};
-    frag_info.blur_sigma = Sigma{r}.sigma;
-    frag_info.blur_radius = r.radius;
+    auto sigma = Sigma{r}.sigma;
+    if (sample_stride > 1) {
+      // Downsampling already box filtered the input. Remove the variance of
+      // the box from the kernel so that the total blur stays the same.
+      auto box_variance = (sample_stride * sample_stride - 1) / 12;
+      sigma = std::sqrt(
+          std::max(sigma * sigma - box_variance, sigma * sigma / 4));
+    }
+    // The kernel is evaluated in units of the sample stride.
+    frag_info.blur_sigma = sigma / sample_stride;
+    frag_info.blur_radius = r.radius / sample_stride;
 
     // The blur direction is in input UV space.
     frag_info.blur_direction =
@@ -202,11 +313,12 @@ std::optional<Snapshot> DirectionalGaussianBlurFilterContents::RenderFilter(
     frag_info.src_factor = src_color_factor_;
     frag_info.inner_blur_factor = inner_blur_factor_;
     frag_info.outer_blur_factor = outer_blur_factor_;
-    frag_info.texture_size = Point(input_snapshot->GetCoverage().value().size);
+    frag_info.texture_size =
+        Point(input_snapshot->GetCoverage().value().size) / sample_stride;
 
     Command cmd;
-    cmd.label = SPrintF("Gaussian Blur Filter (Radius=%.2f)",
-                        transformed_blur_radius_length);
+    cmd.label = SPrintF("Gaussian Blur Filter (Radius=%.2f, Stride=%.0f)",
+                        transformed_blur_radius_length, sample_stride);
     auto options = OptionsFromPass(pass);
     options.blend_mode = BlendMode::kSource;
     cmd.pipeline = renderer.GetGaussianBlurPipeline(options);
@@ -29,6 +29,22 @@ class DirectionalGaussianBlurFilterContents final : public FilterContents {
 
   void SetSourceOverride(FilterInput::Ref alpha_mask);
 
+  //----------------------------------------------------------------------------
+  /// @brief      The number of times the input of a blur pass is halved along
+  ///             the blur direction before it is blurred. The blur then
+  ///             samples the downsampled input at a stride of one of its
+  ///             texels, so the number of samples drops with each level.
+  ///
+  /// @param[in]  blur_radius        The blur radius in screen pixels.
+  /// @param[in]  texel_size         The size of an input texel along the blur
+  ///                                direction in screen pixels.
+  /// @param[in]  downsample_radius  The radius above which blurs are
+  ///                                downsampled. Zero disables downsampling.
+  ///
+  static size_t GetDownsampleLevels(Scalar blur_radius,
+                                    Scalar texel_size,
+                                    Scalar downsample_radius);
+
   // |FilterContents|
   std::optional<Rect> GetFilterCoverage(
       const FilterInput::Vector& inputs,
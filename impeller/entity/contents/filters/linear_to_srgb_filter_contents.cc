@@ -17,6 +17,12 @@ LinearToSrgbFilterContents::LinearToSrgbFilterContents() = default;
 
 LinearToSrgbFilterContents::~LinearToSrgbFilterContents() = default;
 
+std::optional<ColorFilterContents::FusedStage>
+LinearToSrgbFilterContents::GetFusedStage() const {
+  return FusedStage{.type = FusedStage::Type::kLinearToSrgb,
+                    .absorb_opacity = GetAbsorbOpacity()};
+}
+
 std::optional<Snapshot> LinearToSrgbFilterContents::RenderFilter(
     const FilterInput::Vector& inputs,
     const ContentContext& renderer,
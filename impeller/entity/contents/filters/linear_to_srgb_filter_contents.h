@@ -15,6 +15,9 @@ class LinearToSrgbFilterContents final : public ColorFilterContents {
 
   ~LinearToSrgbFilterContents() override;
 
+  // |ColorFilterContents|
+  std::optional<FusedStage> GetFusedStage() const override;
+
  private:
   // |FilterContents|
   std::optional<Snapshot> RenderFilter(
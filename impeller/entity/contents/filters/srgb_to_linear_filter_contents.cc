@@ -17,6 +17,12 @@ SrgbToLinearFilterContents::SrgbToLinearFilterContents() = default;
 
 SrgbToLinearFilterContents::~SrgbToLinearFilterContents() = default;
 
+std::optional<ColorFilterContents::FusedStage>
+SrgbToLinearFilterContents::GetFusedStage() const {
+  return FusedStage{.type = FusedStage::Type::kSrgbToLinear,
+                    .absorb_opacity = GetAbsorbOpacity()};
+}
+
 std::optional<Snapshot> SrgbToLinearFilterContents::RenderFilter(
     const FilterInput::Vector& inputs,
     const ContentContext& renderer,
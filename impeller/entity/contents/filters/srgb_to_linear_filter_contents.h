@@ -15,6 +15,9 @@ class SrgbToLinearFilterContents final : public ColorFilterContents {
 
   ~SrgbToLinearFilterContents() override;
 
+  // |ColorFilterContents|
+  std::optional<FusedStage> GetFusedStage() const override;
+
  private:
   // |FilterContents|
   std::optional<Snapshot> RenderFilter(
@@ -0,0 +1,94 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/framebuffer_blend_contents.h"
+
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/entity.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/sampler_library.h"
+
+namespace impeller {
+
+FramebufferBlendContents::FramebufferBlendContents() = default;
+
+FramebufferBlendContents::~FramebufferBlendContents() = default;
+
+void FramebufferBlendContents::SetBlendMode(BlendMode blend_mode) {
+  FML_DCHECK(blend_mode > Entity::kLastPipelineBlendMode);
+  blend_mode_ = blend_mode;
+}
+
+void FramebufferBlendContents::SetChildContents(
+    std::shared_ptr<Contents> child_contents) {
+  child_contents_ = std::move(child_contents);
+}
+
+std::optional<Rect> FramebufferBlendContents::GetCoverage(
+    const Entity& entity) const {
+  if (!child_contents_) {
+    return std::nullopt;
+  }
+  return child_contents_->GetCoverage(entity);
+}
+
+bool FramebufferBlendContents::Render(const ContentContext& renderer,
+                                      const Entity& entity,
+                                      RenderPass& pass) const {
+  using VS = FramebufferBlendPipeline::VertexShader;
+  using FS = FramebufferBlendPipeline::FragmentShader;
+
+  if (!child_contents_) {
+    return true;
+  }
+
+  auto options = OptionsFromPassAndEntity(pass, entity);
+  options.blend_mode = BlendMode::kSource;
+  auto pipeline = renderer.GetFramebufferBlendPipeline(options);
+  if (!pipeline) {
+    return false;
+  }
+
+  auto src_snapshot = child_contents_->RenderToSnapshot(renderer, entity);
+  if (!src_snapshot.has_value()) {
+    return true;  // Nothing to blend.
+  }
+
+  auto size = src_snapshot->texture->GetSize();
+  VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+  vtx_builder.AddVertices({
+      {Point(0, 0), Point(0, 0)},
+      {Point(size.width, 0), Point(1, 0)},
+      {Point(size.width, size.height), Point(1, 1)},
+      {Point(0, 0), Point(0, 0)},
+      {Point(size.width, size.height), Point(1, 1)},
+      {Point(0, size.height), Point(0, 1)},
+  });
+
+  auto& host_buffer = pass.GetTransientsBuffer();
+
+  VS::VertInfo vert_info;
+  vert_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                  src_snapshot->transform;
+
+  FS::FragInfo frag_info;
+  frag_info.src_y_coord_scale = src_snapshot->texture->GetYCoordScale();
+  frag_info.src_input_alpha = src_snapshot->opacity;
+  frag_info.blend_mode = static_cast<Scalar>(blend_mode_);
+
+  Command cmd;
+  cmd.label = "Framebuffer Advanced Blend";
+  cmd.pipeline = std::move(pipeline);
+  cmd.stencil_reference = entity.GetStencilDepth();
+  cmd.BindVertices(vtx_builder.CreateVertexBuffer(host_buffer));
+  VS::BindVertInfo(cmd, host_buffer.EmplaceUniform(vert_info));
+  FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+  FS::BindTextureSamplerSrc(
+      cmd, src_snapshot->texture,
+      renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+          src_snapshot->sampler_descriptor));
+  return pass.AddCommand(std::move(cmd));
+}
+
+}  // namespace impeller
@@ -0,0 +1,48 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+
+#include "flutter/fml/macros.h"
+#include "impeller/entity/contents/contents.h"
+#include "impeller/geometry/color.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Blends its child contents onto the render pass with an advanced
+///             blend mode. The destination is read directly from the color
+///             attachment, so the pass neither has to end nor be copied.
+///
+///             Only usable on contexts that support framebuffer fetch. The
+///             entity must use |BlendMode::kSource|.
+///
+class FramebufferBlendContents final : public Contents {
+ public:
+  FramebufferBlendContents();
+
+  ~FramebufferBlendContents() override;
+
+  void SetBlendMode(BlendMode blend_mode);
+
+  void SetChildContents(std::shared_ptr<Contents> child_contents);
+
+  // |Contents|
+  std::optional<Rect> GetCoverage(const Entity& entity) const override;
+
+  // |Contents|
+  bool Render(const ContentContext& renderer,
+              const Entity& entity,
+              RenderPass& pass) const override;
+
+ private:
+  BlendMode blend_mode_ = BlendMode::kScreen;
+  std::shared_ptr<Contents> child_contents_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FramebufferBlendContents);
+};
+
+}  // namespace impeller
@@ -6,6 +6,7 @@
 
 #include "impeller/entity/contents/gradient_generator.h"
 
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/logging.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/geometry/gradient.h"
@@ -45,4 +46,54 @@ std::shared_ptr<Texture> CreateGradientTexture(
   return texture;
 }
 
+std::size_t GradientTextureCache::Key::Hash::operator()(const Key& key) const {
+  auto hash = fml::HashCombine(key.colors.size(), key.stops.size());
+  for (const auto& color : key.colors) {
+    fml::HashCombineSeed(hash, color.red, color.green, color.blue, color.alpha);
+  }
+  for (const auto& stop : key.stops) {
+    fml::HashCombineSeed(hash, stop);
+  }
+  return hash;
+}
+
+bool GradientTextureCache::Key::Equal::operator()(const Key& lhs,
+                                                  const Key& rhs) const {
+  return lhs.colors == rhs.colors && lhs.stops == rhs.stops;
+}
+
+GradientTextureCache::GradientTextureCache(size_t max_entries)
+    : max_entries_(max_entries) {}
+
+GradientTextureCache::~GradientTextureCache() = default;
+
+std::shared_ptr<Texture> GradientTextureCache::GetOrCreate(
+    const std::vector<Color>& colors,
+    const std::vector<Scalar>& stops,
+    const std::shared_ptr<impeller::Context>& context) {
+  Key key{.colors = colors, .stops = stops};
+  if (auto found = index_.find(key); found != index_.end()) {
+    // Move the entry to the front of the recently used list.
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return found->second->second;
+  }
+
+  auto texture = CreateGradientTexture(colors, stops, context);
+  if (!texture || max_entries_ == 0u) {
+    return texture;
+  }
+
+  if (entries_.size() >= max_entries_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+  entries_.emplace_front(key, texture);
+  index_[std::move(key)] = entries_.begin();
+  return texture;
+}
+
+size_t GradientTextureCache::GetSize() const {
+  return entries_.size();
+}
+
 }  // namespace impeller
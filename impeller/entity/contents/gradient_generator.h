@@ -5,7 +5,9 @@
 #pragma once
 
 #include <functional>
+#include <list>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "flutter/fml/macros.h"
@@ -27,4 +29,55 @@ std::shared_ptr<Texture> CreateGradientTexture(
     const std::vector<Scalar>& stops,
     const std::shared_ptr<impeller::Context>& context);
 
+//------------------------------------------------------------------------------
+/// @brief      A bounded, least-recently-used cache of gradient textures keyed
+///             by their colors and stops.
+///
+///             Gradient textures are immutable once created, so identical
+///             gradients drawn across frames can share the same texture
+///             instead of allocating and uploading a new one on every render.
+///
+class GradientTextureCache {
+ public:
+  static constexpr size_t kDefaultMaxEntries = 64u;
+
+  explicit GradientTextureCache(size_t max_entries = kDefaultMaxEntries);
+
+  ~GradientTextureCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the texture for the gradient defined by the colors and
+  ///             stops, creating it if no matching texture is cached.
+  ///
+  std::shared_ptr<Texture> GetOrCreate(
+      const std::vector<Color>& colors,
+      const std::vector<Scalar>& stops,
+      const std::shared_ptr<impeller::Context>& context);
+
+  size_t GetSize() const;
+
+ private:
+  struct Key {
+    std::vector<Color> colors;
+    std::vector<Scalar> stops;
+
+    struct Hash {
+      std::size_t operator()(const Key& key) const;
+    };
+
+    struct Equal {
+      bool operator()(const Key& lhs, const Key& rhs) const;
+    };
+  };
+
+  using Entry = std::pair<Key, std::shared_ptr<Texture>>;
+
+  const size_t max_entries_;
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, Key::Hash, Key::Equal>
+      index_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GradientTextureCache);
+};
+
 }  // namespace impeller
@@ -7,7 +7,6 @@
 #include "flutter/fml/logging.h"
 #include "impeller/entity/contents/clip_contents.h"
 #include "impeller/entity/contents/content_context.h"
-#include "impeller/entity/contents/gradient_generator.h"
 #include "impeller/entity/entity.h"
 #include "impeller/renderer/formats.h"
 #include "impeller/renderer/render_pass.h"
@@ -50,8 +49,7 @@ bool LinearGradientContents::Render(const ContentContext& renderer,
   using VS = LinearGradientFillPipeline::VertexShader;
   using FS = LinearGradientFillPipeline::FragmentShader;
 
-  auto gradient_texture =
-      CreateGradientTexture(colors_, stops_, renderer.GetContext());
+  auto gradient_texture = renderer.GetGradientTexture(colors_, stops_);
   if (gradient_texture == nullptr) {
     return false;
   }
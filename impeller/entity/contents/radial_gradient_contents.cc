@@ -7,7 +7,6 @@
 #include "flutter/fml/logging.h"
 #include "impeller/entity/contents/clip_contents.h"
 #include "impeller/entity/contents/content_context.h"
-#include "impeller/entity/contents/gradient_generator.h"
 #include "impeller/entity/entity.h"
 #include "impeller/entity/geometry.h"
 #include "impeller/renderer/render_pass.h"
@@ -50,8 +49,7 @@ bool RadialGradientContents::Render(const ContentContext& renderer,
   using VS = RadialGradientFillPipeline::VertexShader;
   using FS = RadialGradientFillPipeline::FragmentShader;
 
-  auto gradient_texture =
-      CreateGradientTexture(colors_, stops_, renderer.GetContext());
+  auto gradient_texture = renderer.GetGradientTexture(colors_, stops_);
   if (gradient_texture == nullptr) {
     return false;
   }
@@ -0,0 +1,109 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/rrect_fill_contents.h"
+
+#include <algorithm>
+
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/entity.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/vertex_buffer_builder.h"
+
+namespace impeller {
+
+namespace {
+
+// The quad is outset by a pixel so that the smoothed edge isn't cut off. Under
+// non-uniform scales the smaller scale gives the larger, safe, outset.
+Scalar GetAntialiasOutset(const Matrix& transform) {
+  auto scale = std::min(transform.GetBasisX().Length(),
+                        transform.GetBasisY().Length());
+  return scale > 0 ? 1.0f / scale : 0.0f;
+}
+
+}  // namespace
+
+RRectFillContents::RRectFillContents() = default;
+
+RRectFillContents::~RRectFillContents() = default;
+
+void RRectFillContents::SetRRect(std::optional<Rect> rect, Size corner_radii) {
+  rect_ = rect;
+  corner_radii_ = corner_radii;
+}
+
+void RRectFillContents::SetColor(Color color) {
+  color_ = color.Premultiply();
+}
+
+std::optional<Rect> RRectFillContents::GetCoverage(const Entity& entity) const {
+  if (!rect_.has_value()) {
+    return std::nullopt;
+  }
+
+  auto outset = GetAntialiasOutset(entity.GetTransformation());
+  auto ltrb = rect_->GetPositive().GetLTRB();
+  Rect bounds = Rect::MakeLTRB(ltrb[0] - outset, ltrb[1] - outset,
+                               ltrb[2] + outset, ltrb[3] + outset);
+  return bounds.TransformBounds(entity.GetTransformation());
+}
+
+bool RRectFillContents::Render(const ContentContext& renderer,
+                               const Entity& entity,
+                               RenderPass& pass) const {
+  if (!rect_.has_value() || rect_->GetPositive().IsEmpty()) {
+    return true;
+  }
+
+  using VS = RRectFillPipeline::VertexShader;
+  using FS = RRectFillPipeline::FragmentShader;
+
+  VertexBufferBuilder<VS::PerVertexData> vtx_builder;
+
+  auto outset = GetAntialiasOutset(entity.GetTransformation());
+  auto positive_rect = rect_->GetPositive();
+  {
+    auto left = -outset;
+    auto top = -outset;
+    auto right = positive_rect.size.width + outset;
+    auto bottom = positive_rect.size.height + outset;
+
+    vtx_builder.AddVertices({
+        {Point(left, top)},
+        {Point(right, top)},
+        {Point(left, bottom)},
+        {Point(right, bottom)},
+    });
+  }
+
+  Command cmd;
+  cmd.label = "RRect Fill";
+  auto opts = OptionsFromPassAndEntity(pass, entity);
+  opts.primitive_type = PrimitiveType::kTriangleStrip;
+  cmd.pipeline = renderer.GetRRectFillPipeline(opts);
+  cmd.stencil_reference = entity.GetStencilDepth();
+
+  cmd.BindVertices(vtx_builder.CreateVertexBuffer(pass.GetTransientsBuffer()));
+
+  VS::VertInfo vert_info;
+  vert_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                  entity.GetTransformation() *
+                  Matrix::MakeTranslation({positive_rect.origin});
+  VS::BindVertInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(vert_info));
+
+  FS::FragInfo frag_info;
+  frag_info.color = color_;
+  frag_info.rect_size = Point(positive_rect.size);
+  frag_info.corner_radii =
+      Point(std::clamp(corner_radii_.width, 0.0f,
+                       positive_rect.size.width / 2.0f),
+            std::clamp(corner_radii_.height, 0.0f,
+                       positive_rect.size.height / 2.0f));
+  FS::BindFragInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frag_info));
+
+  return pass.AddCommand(std::move(cmd));
+}
+
+}  // namespace impeller
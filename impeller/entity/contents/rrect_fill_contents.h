@@ -0,0 +1,47 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <optional>
+
+#include "flutter/fml/macros.h"
+#include "impeller/entity/contents/contents.h"
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/rect.h"
+
+namespace impeller {
+
+/// Fills a rounded rect with a solid color. The coverage, including the anti
+/// aliased edge, is computed analytically per fragment on a single quad, so
+/// the shape is never tessellated. Circles and ovals are rounded rects whose
+/// corner radii are half of their size.
+class RRectFillContents final : public Contents {
+ public:
+  RRectFillContents();
+
+  ~RRectFillContents() override;
+
+  void SetRRect(std::optional<Rect> rect, Size corner_radii = {});
+
+  void SetColor(Color color);
+
+  // |Contents|
+  std::optional<Rect> GetCoverage(const Entity& entity) const override;
+
+  // |Contents|
+  bool Render(const ContentContext& renderer,
+              const Entity& entity,
+              RenderPass& pass) const override;
+
+ private:
+  std::optional<Rect> rect_;
+  Size corner_radii_;
+
+  Color color_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(RRectFillContents);
+};
+
+}  // namespace impeller
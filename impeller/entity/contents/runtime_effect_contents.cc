@@ -4,6 +4,7 @@
 
 #include "impeller/entity/contents/runtime_effect_contents.h"
 
+#include <chrono>
 #include <future>
 #include <memory>
 
@@ -37,11 +38,11 @@ void RuntimeEffectContents::SetTextureInputs(
   texture_inputs_ = std::move(texture_inputs);
 }
 
-bool RuntimeEffectContents::Render(const ContentContext& renderer,
-                                   const Entity& entity,
-                                   RenderPass& pass) const {
-  auto context = renderer.GetContext();
-  auto library = context->GetShaderLibrary();
+std::optional<PipelineDescriptor>
+RuntimeEffectContents::CreatePipelineDescriptor(
+    Context& context,
+    const ContentContextOptions& options) const {
+  auto library = context.GetShaderLibrary();
 
   //--------------------------------------------------------------------------
   /// Get or register shader.
@@ -53,7 +54,7 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
       runtime_stage_->GetEntrypoint(), ShaderStage::kFragment);
 
   if (function && runtime_stage_->IsDirty()) {
-    context->GetPipelineLibrary()->RemovePipelinesWithEntryPoint(function);
+    context.GetPipelineLibrary()->RemovePipelinesWithEntryPoint(function);
     library->UnregisterFunction(runtime_stage_->GetEntrypoint(),
                                 ShaderStage::kFragment);
 
@@ -75,7 +76,7 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
     if (!future.get()) {
       VALIDATION_LOG << "Failed to build runtime effect (entry point: "
                      << runtime_stage_->GetEntrypoint() << ")";
-      return false;
+      return std::nullopt;
     }
 
     function = library->GetFunction(runtime_stage_->GetEntrypoint(),
@@ -85,30 +86,18 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
           << "Failed to fetch runtime effect function immediately after "
              "registering it (entry point: "
           << runtime_stage_->GetEntrypoint() << ")";
-      return false;
+      return std::nullopt;
     }
 
     runtime_stage_->SetClean();
   }
 
-  //--------------------------------------------------------------------------
-  /// Resolve geometry.
-  ///
-
-  auto geometry_result =
-      GetGeometry()->GetPositionBuffer(renderer, entity, pass);
-
-  //--------------------------------------------------------------------------
-  /// Get or create runtime stage pipeline.
-  ///
-
   using VS = RuntimeEffectVertexShader;
   PipelineDescriptor desc;
   desc.SetLabel("Runtime Stage");
   desc.AddStageEntrypoint(
       library->GetFunction(VS::kEntrypointName, ShaderStage::kVertex));
-  desc.AddStageEntrypoint(library->GetFunction(runtime_stage_->GetEntrypoint(),
-                                               ShaderStage::kFragment));
+  desc.AddStageEntrypoint(function);
   auto vertex_descriptor = std::make_shared<VertexDescriptor>();
   if (!vertex_descriptor->SetStageInputs(VS::kAllShaderStageInputs)) {
     VALIDATION_LOG << "Failed to set stage inputs for runtime effect pipeline.";
@@ -118,6 +107,25 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
       0u, {.format = PixelFormat::kDefaultColor, .blending_enabled = true});
   desc.SetStencilAttachmentDescriptors({});
   desc.SetStencilPixelFormat(PixelFormat::kDefaultStencil);
+  options.ApplyToPipelineDescriptor(desc);
+  return desc;
+}
+
+bool RuntimeEffectContents::Render(const ContentContext& renderer,
+                                   const Entity& entity,
+                                   RenderPass& pass) const {
+  auto context = renderer.GetContext();
+
+  //--------------------------------------------------------------------------
+  /// Resolve geometry.
+  ///
+
+  auto geometry_result =
+      GetGeometry()->GetPositionBuffer(renderer, entity, pass);
+
+  //--------------------------------------------------------------------------
+  /// Get or create runtime stage pipeline.
+  ///
 
   auto options = OptionsFromPassAndEntity(pass, entity);
   if (geometry_result.prevent_overdraw) {
@@ -125,9 +133,23 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
     options.stencil_operation = StencilOperation::kIncrementClamp;
   }
   options.primitive_type = geometry_result.type;
-  options.ApplyToPipelineDescriptor(desc);
 
-  auto pipeline = context->GetPipelineLibrary()->GetPipeline(desc).Get();
+  auto pipeline_future = renderer.GetRuntimeEffectPipeline(
+      runtime_stage_->GetHash(), options,
+      [&]() { return CreatePipelineDescriptor(*context, options); });
+  if (!pipeline_future.IsValid()) {
+    return false;
+  }
+
+  if (renderer.IsRuntimeEffectAsyncCompilationEnabled() &&
+      pipeline_future.future.wait_for(std::chrono::seconds(0)) !=
+          std::future_status::ready) {
+    // The pipeline is still being compiled. Skip the effect instead of
+    // stalling the frame on it.
+    return true;
+  }
+
+  auto pipeline = pipeline_future.Get();
   if (!pipeline) {
     VALIDATION_LOG << "Failed to get or create runtime effect pipeline.";
     return false;
@@ -4,9 +4,12 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "impeller/entity/contents/color_source_contents.h"
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/pipeline_descriptor.h"
 #include "impeller/renderer/sampler_descriptor.h"
 #include "impeller/runtime_stage/runtime_stage.h"
 
@@ -34,6 +37,10 @@ class RuntimeEffectContents final : public ColorSourceContents {
   std::shared_ptr<RuntimeStage> runtime_stage_;
   std::shared_ptr<std::vector<uint8_t>> uniform_data_;
   std::vector<TextureInput> texture_inputs_;
+
+  std::optional<PipelineDescriptor> CreatePipelineDescriptor(
+      Context& context,
+      const ContentContextOptions& options) const;
 };
 
 }  // namespace impeller
@@ -4,11 +4,13 @@
 
 #include "solid_color_contents.h"
 
+#include "impeller/base/strings.h"
 #include "impeller/entity/contents/clip_contents.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/entity.h"
 #include "impeller/geometry/path.h"
 #include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/vertex_buffer_builder.h"
 
 namespace impeller {
 
@@ -88,6 +90,80 @@ bool SolidColorContents::Render(const ContentContext& renderer,
   return true;
 }
 
+bool SolidColorContents::IsOpaqueWithinCoverage(const Entity& entity) const {
+  // The coverage of rects is only exact while they stay axis aligned.
+  const auto& transform = entity.GetTransformation();
+  return color_.IsOpaque() && geometry_ != nullptr &&
+         geometry_->GetRect().has_value() && transform.IsAffine() &&
+         transform.IsAligned();
+}
+
+Contents::BatchKind SolidColorContents::GetBatchKind(
+    const Entity& entity) const {
+  // Batched rectangles are transformed on the CPU, which can't represent
+  // perspective.
+  if (geometry_ == nullptr || !geometry_->GetRect().has_value() ||
+      !entity.GetTransformation().IsAffine()) {
+    return BatchKind::kNone;
+  }
+  return BatchKind::kSolidColor;
+}
+
+bool SolidColorContents::CanBatchWith(const Entity& entity,
+                                      const Entity& other) const {
+  // The color is per vertex in a batch, so only the pipeline state of the
+  // entities has to match.
+  return entity.GetBlendMode() == other.GetBlendMode() &&
+         entity.GetStencilDepth() == other.GetStencilDepth();
+}
+
+bool SolidColorContents::RenderBatch(const ContentContext& renderer,
+                                     const std::vector<Entity>& entities,
+                                     RenderPass& pass) const {
+  if (entities.size() == 1u) {
+    return Render(renderer, entities.front(), pass);
+  }
+
+  using VS = GeometryColorPipeline::VertexShader;
+
+  VertexBufferBuilder<VS::PerVertexData> vertex_builder;
+  vertex_builder.Reserve(entities.size() * 4);
+  vertex_builder.ReserveIndices(entities.size() * 6);
+  for (const auto& entity : entities) {
+    // All of the entities in the batch have solid color contents.
+    const auto& contents =
+        static_cast<const SolidColorContents&>(*entity.GetContents());
+    auto color = contents.GetColor().Premultiply();
+    auto base = static_cast<uint16_t>(vertex_builder.GetVertexCount());
+    auto points = contents.geometry_->GetRect()->GetTransformedPoints(
+        entity.GetTransformation());
+    for (const auto& point : points) {
+      vertex_builder.AppendVertex({.position = point, .color = color});
+    }
+    for (auto index : {0u, 1u, 2u, 1u, 3u, 2u}) {
+      vertex_builder.AppendIndex(static_cast<uint16_t>(base + index));
+    }
+  }
+
+  const auto& entity = entities.front();
+  auto& host_buffer = pass.GetTransientsBuffer();
+
+  Command cmd;
+  cmd.label = SPrintF("Solid Fill Batch (%zu)", entities.size());
+  cmd.stencil_reference = entity.GetStencilDepth();
+
+  auto options = OptionsFromPassAndEntity(pass, entity);
+  options.primitive_type = PrimitiveType::kTriangle;
+  cmd.pipeline = renderer.GetGeometryColorPipeline(options);
+  cmd.BindVertices(vertex_builder.CreateVertexBuffer(host_buffer));
+
+  VS::VertInfo vert_info;
+  vert_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize());
+  VS::BindVertInfo(cmd, host_buffer.EmplaceUniform(vert_info));
+
+  return pass.AddCommand(std::move(cmd));
+}
+
 std::unique_ptr<SolidColorContents> SolidColorContents::Make(const Path& path,
                                                              Color color) {
   auto contents = std::make_unique<SolidColorContents>();
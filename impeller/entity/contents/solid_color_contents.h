@@ -47,6 +47,20 @@ class SolidColorContents final : public Contents {
               const Entity& entity,
               RenderPass& pass) const override;
 
+  // |Contents|
+  bool IsOpaqueWithinCoverage(const Entity& entity) const override;
+
+  // |Contents|
+  BatchKind GetBatchKind(const Entity& entity) const override;
+
+  // |Contents|
+  bool CanBatchWith(const Entity& entity, const Entity& other) const override;
+
+  // |Contents|
+  bool RenderBatch(const ContentContext& renderer,
+                   const std::vector<Entity>& entities,
+                   RenderPass& pass) const override;
+
  private:
   std::unique_ptr<Geometry> geometry_;
 
@@ -27,6 +27,8 @@ TextContents::~TextContents() = default;
 
 void TextContents::SetTextFrame(const TextFrame& frame) {
   frame_ = frame;
+  vertices_atlas_generation_ = 0u;
+  retained_vertices_.reset();
 }
 
 void TextContents::SetGlyphAtlas(std::shared_ptr<LazyGlyphAtlas> atlas) {
@@ -58,45 +60,11 @@ std::optional<Rect> TextContents::GetCoverage(const Entity& entity) const {
   return bounds->TransformBounds(entity.GetTransformation());
 }
 
-template <class TPipeline>
-static bool CommonRender(
-    const ContentContext& renderer,
-    const Entity& entity,
-    RenderPass& pass,
-    const Color& color,
+template <class VS>
+static bool BuildGlyphVertices(
     const TextFrame& frame,
-    std::shared_ptr<GlyphAtlas>
-        atlas,  // NOLINT(performance-unnecessary-value-param)
-    Command& cmd) {
-  using VS = typename TPipeline::VertexShader;
-  using FS = typename TPipeline::FragmentShader;
-
-  // Common vertex uniforms for all glyphs.
-  typename VS::FrameInfo frame_info;
-  frame_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
-                   entity.GetTransformation();
-  VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
-
-  SamplerDescriptor sampler_desc;
-  sampler_desc.min_filter = MinMagFilter::kLinear;
-  sampler_desc.mag_filter = MinMagFilter::kLinear;
-
-  typename FS::FragInfo frag_info;
-  frag_info.text_color = ToVector(color.Premultiply());
-  frag_info.atlas_size =
-      Point{static_cast<Scalar>(atlas->GetTexture()->GetSize().width),
-            static_cast<Scalar>(atlas->GetTexture()->GetSize().height)};
-  FS::BindFragInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frag_info));
-
-  // Common fragment uniforms for all glyphs.
-  FS::BindGlyphAtlasSampler(
-      cmd,                  // command
-      atlas->GetTexture(),  // texture
-      renderer.GetContext()->GetSamplerLibrary()->GetSampler(
-          sampler_desc)  // sampler
-  );
-
-  // Common vertex information for all glyphs.
+    const GlyphAtlas& atlas,
+    VertexBufferBuilder<typename VS::PerVertexData>& vertex_builder) {
   // All glyphs are given the same vertex information in the form of a
   // unit-sized quad. The size of the glyph is specified in per instance data
   // and the vertex shader uses this to size the glyph correctly. The
@@ -107,8 +75,6 @@ static bool CommonRender(
       {0, 0}, {1, 0}, {0, 1}, {1, 1}};
   const std::vector<uint32_t> indices = {0, 1, 2, 1, 2, 3};
 
-  VertexBufferBuilder<typename VS::PerVertexData> vertex_builder;
-
   size_t count = 0;
   for (const auto& run : frame.GetRuns()) {
     count += run.GetGlyphPositions().size();
@@ -135,7 +101,7 @@ static bool CommonRender(
 
     for (const auto& glyph_position : run.GetGlyphPositions()) {
       FontGlyphPair font_glyph_pair{font, glyph_position.glyph};
-      auto atlas_glyph_pos = atlas->FindFontGlyphPosition(font_glyph_pair);
+      auto atlas_glyph_pos = atlas.FindFontGlyphPosition(font_glyph_pair);
       if (!atlas_glyph_pos.has_value()) {
         VALIDATION_LOG << "Could not find glyph position in the atlas.";
         return false;
@@ -155,7 +121,7 @@ static bool CommonRender(
         vtx.glyph_size = glyph_size;
         vtx.atlas_position = atlas_position;
         vtx.atlas_glyph_size = atlas_glyph_size;
-        if constexpr (std::is_same_v<TPipeline, GlyphAtlasPipeline>) {
+        if constexpr (std::is_same_v<VS, GlyphAtlasVertexShader>) {
           vtx.color_glyph =
               glyph_position.glyph.type == Glyph::Type::kBitmap ? 1.0 : 0.0;
         }
@@ -163,8 +129,81 @@ static bool CommonRender(
       }
     }
   }
-  auto vertex_buffer =
-      vertex_builder.CreateVertexBuffer(pass.GetTransientsBuffer());
+  return true;
+}
+
+template <class TPipeline>
+std::optional<VertexBuffer> TextContents::GetOrCreateVertexBuffer(
+    const ContentContext& renderer,
+    RenderPass& pass,
+    const GlyphAtlas& atlas) const {
+  // The vertices are in the coordinate space of the text frame and only
+  // depend on where the glyphs are in the atlas. Changes to the transform or
+  // color are applied with uniforms.
+  const bool same_atlas = vertices_atlas_generation_ == atlas.GetGeneration();
+  if (same_atlas && retained_vertices_.has_value()) {
+    return retained_vertices_;
+  }
+
+  using VS = typename TPipeline::VertexShader;
+  VertexBufferBuilder<typename VS::PerVertexData> vertex_builder;
+  if (!BuildGlyphVertices<VS>(frame_, atlas, vertex_builder)) {
+    return std::nullopt;
+  }
+
+  // Text that is only drawn once isn't worth a device allocation. Text that
+  // is drawn again with the same atlas, like text in a retained picture, is
+  // likely to be drawn many more times.
+  if (same_atlas) {
+    auto vertex_buffer = vertex_builder.CreateVertexBuffer(
+        *renderer.GetContext()->GetResourceAllocator());
+    if (vertex_buffer.vertex_buffer && vertex_buffer.index_buffer) {
+      retained_vertices_ = vertex_buffer;
+      return vertex_buffer;
+    }
+  }
+  vertices_atlas_generation_ = atlas.GetGeneration();
+  retained_vertices_.reset();
+  return vertex_builder.CreateVertexBuffer(pass.GetTransientsBuffer());
+}
+
+template <class TPipeline>
+static bool CommonRender(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass,
+    const Color& color,
+    const GlyphAtlas& atlas,
+    VertexBuffer vertex_buffer,
+    Command& cmd) {
+  using VS = typename TPipeline::VertexShader;
+  using FS = typename TPipeline::FragmentShader;
+
+  // Common vertex uniforms for all glyphs.
+  typename VS::FrameInfo frame_info;
+  frame_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransformation();
+  VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+
+  SamplerDescriptor sampler_desc;
+  sampler_desc.min_filter = MinMagFilter::kLinear;
+  sampler_desc.mag_filter = MinMagFilter::kLinear;
+
+  typename FS::FragInfo frag_info;
+  frag_info.text_color = ToVector(color.Premultiply());
+  frag_info.atlas_size =
+      Point{static_cast<Scalar>(atlas.GetTexture()->GetSize().width),
+            static_cast<Scalar>(atlas.GetTexture()->GetSize().height)};
+  FS::BindFragInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frag_info));
+
+  // Common fragment uniforms for all glyphs.
+  FS::BindGlyphAtlasSampler(
+      cmd,                 // command
+      atlas.GetTexture(),  // texture
+      renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+          sampler_desc)  // sampler
+  );
+
   cmd.BindVertices(std::move(vertex_buffer));
 
   if (!pass.AddCommand(cmd)) {
@@ -194,8 +233,15 @@ bool TextContents::RenderSdf(const ContentContext& renderer,
   cmd.pipeline = renderer.GetGlyphAtlasSdfPipeline(opts);
   cmd.stencil_reference = entity.GetStencilDepth();
 
+  auto vertex_buffer =
+      GetOrCreateVertexBuffer<GlyphAtlasSdfPipeline>(renderer, pass, *atlas);
+  if (!vertex_buffer.has_value()) {
+    return false;
+  }
+
   return CommonRender<GlyphAtlasSdfPipeline>(renderer, entity, pass, color_,
-                                             frame_, atlas, cmd);
+                                             *atlas, vertex_buffer.value(),
+                                             cmd);
 }
 
 bool TextContents::Render(const ContentContext& renderer,
@@ -229,8 +275,14 @@ bool TextContents::Render(const ContentContext& renderer,
   cmd.pipeline = renderer.GetGlyphAtlasPipeline(opts);
   cmd.stencil_reference = entity.GetStencilDepth();
 
+  auto vertex_buffer =
+      GetOrCreateVertexBuffer<GlyphAtlasPipeline>(renderer, pass, *atlas);
+  if (!vertex_buffer.has_value()) {
+    return false;
+  }
+
   return CommonRender<GlyphAtlasPipeline>(renderer, entity, pass, color_,
-                                          frame_, atlas, cmd);
+                                          *atlas, vertex_buffer.value(), cmd);
 }
 
 }  // namespace impeller
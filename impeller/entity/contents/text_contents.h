@@ -6,12 +6,14 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <variant>
 #include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/entity/contents/contents.h"
 #include "impeller/geometry/color.h"
+#include "impeller/renderer/vertex_buffer.h"
 #include "impeller/typographer/glyph_atlas.h"
 #include "impeller/typographer/text_frame.h"
 
@@ -49,6 +51,17 @@ class TextContents final : public Contents {
   TextFrame frame_;
   Color color_;
   mutable std::shared_ptr<LazyGlyphAtlas> lazy_atlas_;
+  // The generation of the atlas the glyph vertices were last generated for.
+  mutable uint64_t vertices_atlas_generation_ = 0u;
+  // The glyph vertices, retained in device memory once they have been
+  // generated twice for the same atlas.
+  mutable std::optional<VertexBuffer> retained_vertices_;
+
+  template <class TPipeline>
+  std::optional<VertexBuffer> GetOrCreateVertexBuffer(
+      const ContentContext& renderer,
+      RenderPass& pass,
+      const GlyphAtlas& atlas) const;
 
   std::shared_ptr<GlyphAtlas> ResolveAtlas(
       GlyphAtlas::Type type,
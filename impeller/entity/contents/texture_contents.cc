@@ -8,6 +8,7 @@
 #include <optional>
 #include <utility>
 
+#include "impeller/base/strings.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/entity.h"
 #include "impeller/entity/texture_fill.frag.h"
@@ -186,6 +187,97 @@ bool TextureContents::Render(const ContentContext& renderer,
   return true;
 }
 
+Contents::BatchKind TextureContents::GetBatchKind(const Entity& entity) const {
+  // Batched rectangles are transformed on the CPU, which can't represent
+  // perspective.
+  if (!is_rect_ || texture_ == nullptr || texture_->GetSize().IsEmpty() ||
+      source_rect_.IsEmpty() || !entity.GetTransformation().IsAffine()) {
+    return BatchKind::kNone;
+  }
+  auto coverage_rect = path_.GetBoundingBox();
+  if (!coverage_rect.has_value() || coverage_rect->size.IsEmpty()) {
+    return BatchKind::kNone;
+  }
+  return BatchKind::kTexture;
+}
+
+bool TextureContents::CanBatchWith(const Entity& entity,
+                                   const Entity& other) const {
+  // All of the entities in a batch have texture contents.
+  const auto& contents =
+      static_cast<const TextureContents&>(*other.GetContents());
+  return entity.GetBlendMode() == other.GetBlendMode() &&
+         entity.GetStencilDepth() == other.GetStencilDepth() &&
+         texture_ == contents.texture_ &&
+         sampler_descriptor_.IsEqual(contents.sampler_descriptor_) &&
+         opacity_ == contents.opacity_ &&
+         stencil_enabled_ == contents.stencil_enabled_;
+}
+
+bool TextureContents::RenderBatch(const ContentContext& renderer,
+                                  const std::vector<Entity>& entities,
+                                  RenderPass& pass) const {
+  if (entities.size() == 1u) {
+    return Render(renderer, entities.front(), pass);
+  }
+
+  using VS = TextureFillVertexShader;
+  using FS = TextureFillFragmentShader;
+
+  const auto texture_size = texture_->GetSize();
+
+  VertexBufferBuilder<VS::PerVertexData> vertex_builder;
+  vertex_builder.Reserve(entities.size() * 4);
+  vertex_builder.ReserveIndices(entities.size() * 6);
+  for (const auto& entity : entities) {
+    const auto& contents =
+        static_cast<const TextureContents&>(*entity.GetContents());
+    auto points = contents.path_.GetBoundingBox()->GetTransformedPoints(
+        entity.GetTransformation());
+    auto texture_coords = contents.source_rect_.GetPoints();
+    auto base = static_cast<uint16_t>(vertex_builder.GetVertexCount());
+    for (auto i = 0u; i < points.size(); i++) {
+      vertex_builder.AppendVertex({
+          .position = points[i],
+          .texture_coords = texture_coords[i] / texture_size,
+      });
+    }
+    for (auto index : {0u, 1u, 2u, 1u, 3u, 2u}) {
+      vertex_builder.AppendIndex(static_cast<uint16_t>(base + index));
+    }
+  }
+
+  const auto& entity = entities.front();
+  auto& host_buffer = pass.GetTransientsBuffer();
+
+  VS::VertInfo vert_info;
+  vert_info.mvp = Matrix::MakeOrthographic(pass.GetRenderTargetSize());
+
+  FS::FragInfo frag_info;
+  frag_info.texture_sampler_y_coord_scale = texture_->GetYCoordScale();
+  frag_info.alpha = opacity_;
+
+  Command cmd;
+  cmd.label = SPrintF("Texture Fill Batch (%zu)", entities.size());
+  if (!label_.empty()) {
+    cmd.label += ": " + label_;
+  }
+
+  auto pipeline_options = OptionsFromPassAndEntity(pass, entity);
+  if (!stencil_enabled_) {
+    pipeline_options.stencil_compare = CompareFunction::kAlways;
+  }
+  cmd.pipeline = renderer.GetTexturePipeline(pipeline_options);
+  cmd.stencil_reference = entity.GetStencilDepth();
+  cmd.BindVertices(vertex_builder.CreateVertexBuffer(host_buffer));
+  VS::BindVertInfo(cmd, host_buffer.EmplaceUniform(vert_info));
+  FS::BindFragInfo(cmd, host_buffer.EmplaceUniform(frag_info));
+  FS::BindTextureSampler(cmd, texture_,
+                         renderer.GetContext()->GetSamplerLibrary()->GetSampler(
+                             sampler_descriptor_));
+  return pass.AddCommand(std::move(cmd));
+}
+
 void TextureContents::SetSourceRect(const Rect& source_rect) {
   source_rect_ = source_rect;
 }
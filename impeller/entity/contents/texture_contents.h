@@ -60,6 +60,17 @@ class TextureContents final : public Contents {
               const Entity& entity,
               RenderPass& pass) const override;
 
+  // |Contents|
+  BatchKind GetBatchKind(const Entity& entity) const override;
+
+  // |Contents|
+  bool CanBatchWith(const Entity& entity, const Entity& other) const override;
+
+  // |Contents|
+  bool RenderBatch(const ContentContext& renderer,
+                   const std::vector<Entity>& entities,
+                   RenderPass& pass) const override;
+
   void SetDeferApplyingOpacity(bool defer_applying_opacity);
 
  private:
@@ -20,6 +20,16 @@ Entity::Entity() = default;
 
 Entity::~Entity() = default;
 
+Entity::Entity(const Entity& entity) = default;
+
+// Moving an entity into its pass must not touch the reference count of its
+// contents.
+Entity::Entity(Entity&& entity) = default;
+
+Entity& Entity::operator=(const Entity& entity) = default;
+
+Entity& Entity::operator=(Entity&& entity) = default;
+
 const Matrix& Entity::GetTransformation() const {
   return transformation_;
 }
@@ -53,6 +53,14 @@ class Entity {
 
   ~Entity();
 
+  Entity(const Entity& entity);
+
+  Entity(Entity&& entity);
+
+  Entity& operator=(const Entity& entity);
+
+  Entity& operator=(Entity&& entity);
+
   const Matrix& GetTransformation() const;
 
   void SetTransformation(const Matrix& transformation);
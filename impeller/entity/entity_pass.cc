@@ -4,10 +4,12 @@
 
 #include "impeller/entity/entity_pass.h"
 
+#include <cmath>
 #include <memory>
 #include <utility>
 #include <variant>
 
+#include "flutter/fml/closure.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/trace_event.h"
@@ -15,8 +17,10 @@
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/contents/filters/color_filter_contents.h"
 #include "impeller/entity/contents/filters/inputs/filter_input.h"
+#include "impeller/entity/contents/framebuffer_blend_contents.h"
 #include "impeller/entity/contents/texture_contents.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/entity_pass_capture.h"
 #include "impeller/entity/inline_pass_context.h"
 #include "impeller/geometry/path_builder.h"
 #include "impeller/renderer/allocator.h"
@@ -39,6 +43,29 @@ void EntityPass::SetDelegate(std::unique_ptr<EntityPassDelegate> delegate) {
   delegate_ = std::move(delegate);
 }
 
+std::vector<std::unique_ptr<EntityPass>> EntityPass::Reset() {
+  std::vector<std::unique_ptr<EntityPass>> subpasses;
+  for (auto& element : elements_) {
+    if (auto subpass = std::get_if<std::unique_ptr<EntityPass>>(&element)) {
+      subpasses.push_back(std::move(*subpass));
+    }
+  }
+  elements_.clear();
+
+  superpass_ = nullptr;
+  xformation_ = {};
+  stencil_depth_ = 0u;
+  blend_mode_ = BlendMode::kSourceOver;
+  target_damage_ = std::nullopt;
+  cover_whole_screen_ = false;
+  reads_from_pass_texture_ = 0;
+  backdrop_filter_proc_ = std::nullopt;
+  delegate_ = EntityPassDelegate::MakeDefault();
+  // Text contents of the previous picture may still reference the old atlas.
+  lazy_glyph_atlas_ = std::make_shared<LazyGlyphAtlas>();
+  return subpasses;
+}
+
 void EntityPass::AddEntity(Entity entity) {
   if (entity.GetBlendMode() > Entity::kLastPipelineBlendMode) {
     reads_from_pass_texture_ += 1;
@@ -143,10 +170,31 @@ EntityPass* EntityPass::AddSubpass(std::unique_ptr<EntityPass> pass) {
   return subpass_pointer;
 }
 
+void EntityPass::AddSubpassInline(std::unique_ptr<EntityPass> pass) {
+  if (!pass) {
+    return;
+  }
+  FML_DCHECK(pass->superpass_ == nullptr);
+
+  for (auto& element : pass->elements_) {
+    if (auto entity = std::get_if<Entity>(&element)) {
+      AddEntity(std::move(*entity));
+      continue;
+    }
+    if (auto subpass = std::get_if<std::unique_ptr<EntityPass>>(&element)) {
+      (*subpass)->superpass_ = nullptr;
+      AddSubpass(std::move(*subpass));
+      continue;
+    }
+    FML_UNREACHABLE();
+  }
+}
+
 static RenderTarget CreateRenderTarget(ContentContext& renderer,
                                        ISize size,
                                        bool readable) {
   auto context = renderer.GetContext();
+  auto& allocator = *renderer.GetRenderTargetCache();
 
   /// All of the load/store actions are managed by `InlinePassContext` when
   /// `RenderPasses` are created, so we just set them to `kDontCare` here.
@@ -155,7 +203,7 @@ static RenderTarget CreateRenderTarget(ContentContext& renderer,
 
   if (context->SupportsOffscreenMSAA()) {
     return RenderTarget::CreateOffscreenMSAA(
-        *context,                          // context
+        allocator,                         // allocator
         size,                              // size
         "EntityPass",                      // label
         StorageMode::kDeviceTransient,     // color_storage_mode
@@ -170,7 +218,7 @@ static RenderTarget CreateRenderTarget(ContentContext& renderer,
   }
 
   return RenderTarget::CreateOffscreen(
-      *context,                     // context
+      allocator,                    // allocator
       size,                         // size
       "EntityPass",                 // label
       StorageMode::kDevicePrivate,  // color_storage_mode
@@ -185,6 +233,17 @@ static RenderTarget CreateRenderTarget(ContentContext& renderer,
 
 bool EntityPass::Render(ContentContext& renderer,
                         const RenderTarget& render_target) const {
+  std::shared_ptr<EntityPassCapture> capture =
+      renderer.GetEntityPassCapture();
+  if (capture) {
+    capture->BeginFrame();
+  }
+  fml::ScopedCleanupClosure end_capture([&renderer, capture]() {
+    if (capture) {
+      capture->EndFrame(renderer.GetRecordedPipelineVariants());
+    }
+  });
+
   if (reads_from_pass_texture_ > 0) {
     auto offscreen_target =
         CreateRenderTarget(renderer, render_target.GetRenderTargetSize(), true);
@@ -193,13 +252,21 @@ bool EntityPass::Render(ContentContext& renderer,
       return false;
     }
 
+    auto size_rect = Rect::MakeSize(offscreen_target.GetRenderTargetSize());
+    if (target_damage_.has_value()) {
+      auto damage_rect = size_rect.Intersection(target_damage_.value());
+      if (!damage_rect.has_value()) {
+        return true;
+      }
+      size_rect = damage_rect.value();
+    }
+
     auto command_buffer = renderer.GetContext()->CreateCommandBuffer();
     command_buffer->SetLabel("EntityPass Root Command Buffer");
     auto render_pass = command_buffer->CreateRenderPass(render_target);
     render_pass->SetLabel("EntityPass Root Render Pass");
 
     {
-      auto size_rect = Rect::MakeSize(offscreen_target.GetRenderTargetSize());
       auto contents = TextureContents::MakeRect(size_rect);
       contents->SetTexture(offscreen_target.GetRenderTargetTexture());
       contents->SetSourceRect(size_rect);
@@ -373,11 +440,107 @@ EntityPass::EntityResult EntityPass::GetEntityForElement(
   return EntityPass::EntityResult::Success(element_entity);
 }
 
+std::vector<bool> EntityPass::FindOccludedElements(Point position) const {
+  std::vector<bool> occluded(elements_.size(), false);
+  const auto translation = Matrix::MakeTranslation(Vector3(-position));
+
+  // Walk from the last element to the first, tracking the largest opaque
+  // rect drawn after the current element and the stencil depth it's drawn
+  // at. Keeping a single rect makes this conservative, but cheap.
+  std::optional<Rect> occluder;
+  size_t occluder_depth = 0u;
+  for (size_t i = elements_.size(); i > 0u; i--) {
+    const auto* element_entity = std::get_if<Entity>(&elements_[i - 1]);
+    if (!element_entity) {
+      // Subpasses may read from the pass texture or render into it directly,
+      // so nothing before them is culled.
+      break;
+    }
+    Entity entity = *element_entity;
+    entity.SetTransformation(translation * entity.GetTransformation());
+
+    auto stencil_coverage = entity.GetStencilCoverage(Rect());
+    if (stencil_coverage.type != Contents::StencilCoverage::Type::kNone) {
+      // Clips are never culled. Clips appended below the depth of the
+      // occluder also clip the occluder, which then no longer hides what is
+      // drawn before them.
+      if (stencil_coverage.type == Contents::StencilCoverage::Type::kAppend &&
+          entity.GetStencilDepth() < occluder_depth) {
+        occluder = std::nullopt;
+      }
+      continue;
+    }
+    if (Entity::BlendModeShouldCoverWholeScreen(entity.GetBlendMode())) {
+      continue;
+    }
+
+    auto coverage = entity.GetCoverage();
+    if (!coverage.has_value()) {
+      continue;
+    }
+    if (occluder.has_value() && occluder->Contains(coverage.value())) {
+      occluded[i - 1] = true;
+      continue;
+    }
+
+    if ((entity.GetBlendMode() != BlendMode::kSourceOver &&
+         entity.GetBlendMode() != BlendMode::kSource) ||
+        !entity.GetContents()->IsOpaqueWithinCoverage(entity)) {
+      continue;
+    }
+    // Pixels along the edges may only be partially covered and blend with
+    // what's below them.
+    auto opaque = Rect::MakeLTRB(
+        std::ceil(coverage->GetLeft()), std::ceil(coverage->GetTop()),
+        std::floor(coverage->GetRight()), std::floor(coverage->GetBottom()));
+    if (opaque.IsEmpty()) {
+      continue;
+    }
+    if (!occluder.has_value() || opaque.size.Area() > occluder->size.Area()) {
+      occluder = opaque;
+      occluder_depth = entity.GetStencilDepth();
+    }
+  }
+  return occluded;
+}
+
 struct StencilLayer {
   std::optional<Rect> coverage;
   size_t stencil_depth;
+  // The intersection of all clips on the stack that are applied with a
+  // scissor rect instead of the stencil.
+  std::optional<IRect> scissor;
+  // How many of the clips on the stack are applied with the scissor. These
+  // don't increment the values in the stencil buffer.
+  size_t scissor_clip_count = 0u;
 };
 
+/// Get the scissor rect that clips to the same pixels as drawing the rect
+/// into the stencil would, if there is one.
+static std::optional<IRect> ToScissorRect(const Rect& rect,
+                                          ISize target_size,
+                                          SampleCount sample_count) {
+  auto rounded = Rect::MakeLTRB(std::round(rect.GetLeft()),
+                                std::round(rect.GetTop()),
+                                std::round(rect.GetRight()),
+                                std::round(rect.GetBottom()));
+  // Stencil clips are evaluated per sample. With more than one sample per
+  // pixel, the edges of rects that aren't pixel aligned are partially
+  // covered, which a scissor can't reproduce.
+  if (sample_count != SampleCount::kCount1 &&
+      !(ScalarNearlyEqual(rounded.GetLeft(), rect.GetLeft()) &&
+        ScalarNearlyEqual(rounded.GetTop(), rect.GetTop()) &&
+        ScalarNearlyEqual(rounded.GetRight(), rect.GetRight()) &&
+        ScalarNearlyEqual(rounded.GetBottom(), rect.GetBottom()))) {
+    return std::nullopt;
+  }
+  auto scissor = IRect::MakeLTRB(rounded.GetLeft(), rounded.GetTop(),
+                                rounded.GetRight(), rounded.GetBottom());
+  // Scissors must lie within the render target. An empty scissor drops all
+  // commands.
+  return scissor.Intersection(IRect::MakeSize(target_size)).value_or(IRect());
+}
+
 bool EntityPass::OnRender(
     ContentContext& renderer,
     ISize root_pass_size,
@@ -388,10 +551,18 @@ bool EntityPass::OnRender(
     size_t stencil_depth_floor,
     std::shared_ptr<Contents> backdrop_filter_contents) const {
   TRACE_EVENT0("impeller", "EntityPass::OnRender");
+  EntityPassCapture::ScopedPass captured_pass(
+      renderer.GetEntityPassCapture().get(), pass_depth, elements_.size(),
+      blend_mode_, stencil_depth_, render_target.GetRenderTargetSize());
 
   auto context = renderer.GetContext();
+  // Subpasses render into their own offscreen targets, so their command
+  // buffers may be encoded on worker threads. The root pass may target an
+  // onscreen surface and is always submitted synchronously.
+  const bool submit_async =
+      pass_depth > 0 && renderer.IsParallelSubpassEncodingEnabled();
   InlinePassContext pass_context(context, render_target,
-                                 reads_from_pass_texture_);
+                                 reads_from_pass_texture_, submit_async);
   if (!pass_context.IsValid()) {
     return false;
   }
@@ -399,9 +570,33 @@ bool EntityPass::OnRender(
   std::vector<StencilLayer> stencil_stack = {StencilLayer{
       .coverage = Rect::MakeSize(render_target.GetRenderTargetSize()),
       .stencil_depth = stencil_depth_floor}};
+  const auto sample_count = render_target.GetSampleCount();
+
+  // Runs of adjacent entities whose draws can be merged are collected here
+  // and rendered together once an entity that can't join the run is reached.
+  // The batch is always flushed before the active pass is ended.
+  std::vector<Entity> batch;
+  auto batch_kind = Contents::BatchKind::kNone;
+  auto flush_batch = [&batch, &pass_context, &pass_depth, &renderer]() {
+    if (batch.empty()) {
+      return true;
+    }
+    auto result = pass_context.GetRenderPass(pass_depth);
+    if (!result.pass) {
+      return false;
+    }
+    // The pass was already active when the first entity joined the batch.
+    FML_DCHECK(!result.backdrop_texture);
+    auto success =
+        batch.front().GetContents()->RenderBatch(renderer, batch, *result.pass);
+    renderer.RecordCoalescedDraws(batch.size() - 1);
+    batch.clear();
+    return success;
+  };
 
   auto render_element = [&stencil_depth_floor, &pass_context, &pass_depth,
-                         &renderer, &stencil_stack](Entity& element_entity) {
+                         &renderer, &stencil_stack, &sample_count, &batch,
+                         &batch_kind, &flush_batch](Entity& element_entity) {
     auto result = pass_context.GetRenderPass(pass_depth);
 
     if (!result.pass) {
@@ -428,6 +623,7 @@ bool EntityPass::OnRender(
     }
 
     if (!element_entity.ShouldRender(stencil_stack.back().coverage)) {
+      renderer.RecordClipCulledEntities(1u);
       return true;  // Nothing to render.
     }
 
@@ -439,9 +635,38 @@ bool EntityPass::OnRender(
         break;
       case Contents::StencilCoverage::Type::kAppend: {
         auto op = stencil_stack.back().coverage;
+        const auto previous = stencil_stack.back();
+
+        // Rect intersections are applied with a scissor rect, which skips
+        // both the stencil draw and the restore.
+        std::optional<IRect> scissor;
+        if (stencil_coverage.is_rect_intersection &&
+            stencil_coverage.coverage.has_value()) {
+          scissor = ToScissorRect(stencil_coverage.coverage.value(),
+                                  result.pass->GetRenderTargetSize(),
+                                  sample_count);
+        }
+        if (scissor.has_value()) {
+          if (!flush_batch()) {
+            return false;
+          }
+          if (previous.scissor.has_value()) {
+            scissor = scissor->Intersection(previous.scissor.value())
+                          .value_or(IRect());
+          }
+          stencil_stack.push_back(StencilLayer{
+              .coverage = stencil_coverage.coverage,
+              .stencil_depth = element_entity.GetStencilDepth() + 1,
+              .scissor = scissor,
+              .scissor_clip_count = previous.scissor_clip_count + 1});
+          return true;
+        }
+
         stencil_stack.push_back(StencilLayer{
             .coverage = stencil_coverage.coverage,
-            .stencil_depth = element_entity.GetStencilDepth() + 1});
+            .stencil_depth = element_entity.GetStencilDepth() + 1,
+            .scissor = previous.scissor,
+            .scissor_clip_count = previous.scissor_clip_count});
 
         if (!op.has_value()) {
           // Running this append op won't impact the stencil because the whole
@@ -458,7 +683,24 @@ bool EntityPass::OnRender(
 
         FML_DCHECK(stencil_stack.size() > 1);
 
-        stencil_stack.pop_back();
+        // A restore may drop several clips at once. Clips applied with the
+        // scissor have nothing to restore in the stencil.
+        const size_t layer_count = stencil_stack.size();
+        const size_t scissor_clip_count =
+            stencil_stack.back().scissor_clip_count;
+        do {
+          stencil_stack.pop_back();
+        } while (stencil_stack.size() > 1 &&
+                 stencil_stack.back().stencil_depth >
+                     element_entity.GetStencilDepth());
+        const size_t popped_scissor_clips =
+            scissor_clip_count - stencil_stack.back().scissor_clip_count;
+        if (popped_scissor_clips > 0u && !flush_batch()) {
+          return false;
+        }
+        if (popped_scissor_clips == layer_count - stencil_stack.size()) {
+          return true;
+        }
 
         if (!stencil_stack.back().coverage.has_value()) {
           // Running this restore op won't make anything renderable, so skip it.
@@ -468,7 +710,31 @@ bool EntityPass::OnRender(
     }
 
     element_entity.SetStencilDepth(element_entity.GetStencilDepth() -
-                                   stencil_depth_floor);
+                                   stencil_depth_floor -
+                                   stencil_stack.back().scissor_clip_count);
+    result.pass->SetScissor(stencil_stack.back().scissor);
+
+    auto kind = Contents::BatchKind::kNone;
+    if (renderer.IsDrawBatchingEnabled() && element_entity.GetContents() &&
+        stencil_coverage.type == Contents::StencilCoverage::Type::kNone) {
+      kind = element_entity.GetContents()->GetBatchKind(element_entity);
+    }
+    if (kind != Contents::BatchKind::kNone && kind == batch_kind &&
+        !batch.empty() && batch.size() < Contents::kMaxBatchSize &&
+        batch.front().GetContents()->CanBatchWith(batch.front(),
+                                                  element_entity)) {
+      batch.push_back(element_entity);
+      return true;
+    }
+    if (!flush_batch()) {
+      return false;
+    }
+    if (kind != Contents::BatchKind::kNone) {
+      batch_kind = kind;
+      batch.push_back(element_entity);
+      return true;
+    }
+
     if (!element_entity.Render(renderer, *result.pass)) {
       return false;
     }
@@ -489,7 +755,19 @@ bool EntityPass::OnRender(
     render_element(backdrop_entity);
   }
 
-  for (const auto& element : elements_) {
+  const auto occluded = FindOccludedElements(position);
+  for (size_t i = 0; i < elements_.size(); i++) {
+    const auto& element = elements_[i];
+    if (occluded[i]) {
+      renderer.RecordOccludedEntities(1u);
+      continue;
+    }
+
+    // Subpasses may end the active pass or render directly into the target.
+    if (!std::holds_alternative<Entity>(element) && !flush_batch()) {
+      return false;
+    }
+
     EntityResult result =
         GetEntityForElement(element, renderer, pass_context, root_pass_size,
                             position, pass_depth, stencil_depth_floor);
@@ -507,7 +785,16 @@ bool EntityPass::OnRender(
     /// Setup advanced blends.
     ///
 
-    if (result.entity.GetBlendMode() > Entity::kLastPipelineBlendMode) {
+    if (result.entity.GetBlendMode() > Entity::kLastPipelineBlendMode &&
+        renderer.GetContext()->SupportsFramebufferFetch()) {
+      // The blend reads the destination from the color attachment, so the
+      // pass can stay active.
+      auto contents = std::make_shared<FramebufferBlendContents>();
+      contents->SetBlendMode(result.entity.GetBlendMode());
+      contents->SetChildContents(result.entity.GetContents());
+      result.entity.SetContents(std::move(contents));
+      result.entity.SetBlendMode(BlendMode::kSource);
+    } else if (result.entity.GetBlendMode() > Entity::kLastPipelineBlendMode) {
       // End the active pass and flush the buffer before rendering "advanced"
       // blends. Advanced blends work by binding the current render target
       // texture as an input ("destination"), blending with a second texture
@@ -517,7 +804,7 @@ bool EntityPass::OnRender(
       // to the render target texture so far need to execute before it's bound
       // for blending (otherwise the blend pass will end up executing before
       // all the previous commands in the active pass).
-      if (!pass_context.EndPass()) {
+      if (!flush_batch() || !pass_context.EndPass()) {
         return false;
       }
 
@@ -548,7 +835,7 @@ bool EntityPass::OnRender(
     }
   }
 
-  return true;
+  return flush_batch();
 }
 
 void EntityPass::IterateAllEntities(
@@ -606,6 +893,10 @@ void EntityPass::SetBlendMode(BlendMode blend_mode) {
   cover_whole_screen_ = Entity::BlendModeShouldCoverWholeScreen(blend_mode);
 }
 
+void EntityPass::SetTargetDamage(std::optional<Rect> damage) {
+  target_damage_ = damage;
+}
+
 void EntityPass::SetBackdropFilter(std::optional<BackdropFilterProc> proc) {
   if (superpass_) {
     VALIDATION_LOG << "Backdrop filters cannot be set on EntityPasses that "
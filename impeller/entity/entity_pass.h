@@ -39,6 +39,15 @@ class EntityPass {
 
   std::unique_ptr<EntityPass> Clone() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Return this pass to the state of a newly created pass so that
+  ///             it can record another picture. The storage of the elements
+  ///             is kept.
+  ///
+  /// @return     The subpasses that this pass contained, which are not reset.
+  ///
+  std::vector<std::unique_ptr<EntityPass>> Reset();
+
   void AddEntity(Entity entity);
 
   void SetElements(std::vector<Element> elements);
@@ -47,6 +56,12 @@ class EntityPass {
 
   EntityPass* AddSubpass(std::unique_ptr<EntityPass> pass);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Move all of the elements of the given pass into this pass
+  ///             instead of rendering them into a separate subpass.
+  ///
+  void AddSubpassInline(std::unique_ptr<EntityPass> pass);
+
   EntityPass* GetSuperpass() const;
 
   bool Render(ContentContext& renderer,
@@ -62,6 +77,17 @@ class EntityPass {
 
   void SetBackdropFilter(std::optional<BackdropFilterProc> proc);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Limit the area of the render target that is written when
+  ///             this pass is rendered into an offscreen texture and then
+  ///             copied into the target. Pixels outside of `damage` keep the
+  ///             contents that the target loaded.
+  ///
+  ///             This is used when only the damaged part of an onscreen
+  ///             target is redrawn.
+  ///
+  void SetTargetDamage(std::optional<Rect> damage);
+
   std::optional<Rect> GetSubpassCoverage(
       const EntityPass& subpass,
       std::optional<Rect> coverage_crop) const;
@@ -101,6 +127,11 @@ class EntityPass {
                                    uint32_t pass_depth,
                                    size_t stencil_depth_floor) const;
 
+  /// @brief  Find the entities that are fully hidden under opaque entities
+  ///         drawn after them, and so don't need to be rendered. The result
+  ///         has one flag per element.
+  std::vector<bool> FindOccludedElements(Point position) const;
+
   bool OnRender(
       ContentContext& renderer,
       ISize root_pass_size,
@@ -117,6 +148,7 @@ class EntityPass {
   Matrix xformation_;
   size_t stencil_depth_ = 0u;
   BlendMode blend_mode_ = BlendMode::kSourceOver;
+  std::optional<Rect> target_damage_;
   bool cover_whole_screen_ = false;
 
   /// This value is incremented whenever something is added to the pass that
@@ -0,0 +1,252 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/entity_pass_capture.h"
+
+#include <cstdio>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/archivist/archive_location.h"
+
+namespace impeller {
+
+const ArchiveDef CapturedFrame::kArchiveDefinition = {
+    .table_name = "CapturedFrame",
+    .members = {"pass_count", "duration_us"},
+};
+
+bool CapturedFrame::Write(ArchiveLocation& item) const {
+  return item.Write("pass_count", pass_count) &&
+         item.Write("duration_us", duration_us);
+}
+
+bool CapturedFrame::Read(ArchiveLocation& item) {
+  number = item.GetPrimaryKey().value_or(0);
+  return item.Read("pass_count", pass_count) &&
+         item.Read("duration_us", duration_us);
+}
+
+const ArchiveDef CapturedPass::kArchiveDefinition = {
+    .table_name = "CapturedPass",
+    .members = {"frame", "parent", "depth", "element_count", "blend_mode",
+                "stencil_depth", "target_width", "target_height",
+                "duration_us"},
+};
+
+bool CapturedPass::Write(ArchiveLocation& item) const {
+  return item.Write("frame", frame) && item.Write("parent", parent) &&
+         item.Write("depth", depth) &&
+         item.Write("element_count", element_count) &&
+         item.Write("blend_mode", blend_mode) &&
+         item.Write("stencil_depth", stencil_depth) &&
+         item.Write("target_width", target_width) &&
+         item.Write("target_height", target_height) &&
+         item.Write("duration_us", duration_us);
+}
+
+bool CapturedPass::Read(ArchiveLocation& item) {
+  id = item.GetPrimaryKey().value_or(0);
+  return item.Read("frame", frame) && item.Read("parent", parent) &&
+         item.Read("depth", depth) &&
+         item.Read("element_count", element_count) &&
+         item.Read("blend_mode", blend_mode) &&
+         item.Read("stencil_depth", stencil_depth) &&
+         item.Read("target_width", target_width) &&
+         item.Read("target_height", target_height) &&
+         item.Read("duration_us", duration_us);
+}
+
+const ArchiveDef CapturedPipelineVariant::kArchiveDefinition = {
+    .table_name = "CapturedPipelineVariant",
+    .members = {"frame", "pipeline", "sample_count", "blend_mode",
+                "stencil_compare", "stencil_operation", "primitive_type"},
+};
+
+bool CapturedPipelineVariant::Write(ArchiveLocation& item) const {
+  return item.Write("frame", frame) && item.Write("pipeline", pipeline) &&
+         item.Write("sample_count", sample_count) &&
+         item.Write("blend_mode", blend_mode) &&
+         item.Write("stencil_compare", stencil_compare) &&
+         item.Write("stencil_operation", stencil_operation) &&
+         item.Write("primitive_type", primitive_type);
+}
+
+bool CapturedPipelineVariant::Read(ArchiveLocation& item) {
+  return item.Read("frame", frame) && item.Read("pipeline", pipeline) &&
+         item.Read("sample_count", sample_count) &&
+         item.Read("blend_mode", blend_mode) &&
+         item.Read("stencil_compare", stencil_compare) &&
+         item.Read("stencil_operation", stencil_operation) &&
+         item.Read("primitive_type", primitive_type);
+}
+
+std::shared_ptr<EntityPassCapture> EntityPassCapture::Make(
+    const std::string& path) {
+  // Frame numbers and pass IDs restart with every capture.
+  std::remove(path.c_str());
+  std::shared_ptr<EntityPassCapture> capture(new EntityPassCapture(path));
+  if (!capture->writer_->archive.IsValid()) {
+    return nullptr;
+  }
+  return capture;
+}
+
+EntityPassCapture::EntityPassCapture(const std::string& path)
+    : writer_(std::make_shared<Writer>(path)),
+      writer_thread_(fml::Thread::SetCurrentThreadConfig,
+                     fml::Thread::ThreadConfig(
+                         "io.flutter.impeller.capture",
+                         fml::Thread::ThreadPriority::BACKGROUND)) {}
+
+EntityPassCapture::~EntityPassCapture() {
+  FML_DCHECK(frame_depth_ == 0u);
+  Flush();
+}
+
+EntityPassCapture::ScopedPass::ScopedPass(EntityPassCapture* capture,
+                                          uint32_t depth,
+                                          size_t element_count,
+                                          BlendMode blend_mode,
+                                          size_t stencil_depth,
+                                          ISize target_size)
+    : capture_(capture) {
+  if (!capture_ || capture_->frame_depth_ == 0u) {
+    capture_ = nullptr;
+    return;
+  }
+  auto& frame = capture_->frame_;
+  CapturedPass pass;
+  pass.id = capture_->next_pass_id_++;
+  pass.frame = frame.frame.number;
+  if (!capture_->open_passes_.empty()) {
+    pass.parent = frame.passes[capture_->open_passes_.back()].id;
+  }
+  pass.depth = depth;
+  pass.element_count = static_cast<int64_t>(element_count);
+  pass.blend_mode = static_cast<int64_t>(blend_mode);
+  pass.stencil_depth = static_cast<int64_t>(stencil_depth);
+  pass.target_width = target_size.width;
+  pass.target_height = target_size.height;
+  index_ = frame.passes.size();
+  frame.passes.push_back(std::move(pass));
+  capture_->open_passes_.push_back(index_);
+  start_ = fml::TimePoint::Now();
+}
+
+EntityPassCapture::ScopedPass::~ScopedPass() {
+  if (!capture_) {
+    return;
+  }
+  FML_DCHECK(capture_->open_passes_.back() == index_);
+  capture_->open_passes_.pop_back();
+  capture_->frame_.passes[index_].duration_us =
+      (fml::TimePoint::Now() - start_).ToMicroseconds();
+}
+
+void EntityPassCapture::BeginFrame() {
+  if (frame_depth_++ > 0u) {
+    return;
+  }
+  frame_ = {};
+  frame_.frame.number = ++next_frame_number_;
+  frame_start_ = fml::TimePoint::Now();
+}
+
+void EntityPassCapture::EndFrame(
+    const std::vector<ContentContext::PipelineVariant>& variants) {
+  FML_DCHECK(frame_depth_ > 0u);
+  if (--frame_depth_ > 0u) {
+    return;
+  }
+  FML_DCHECK(open_passes_.empty());
+  TRACE_EVENT0("impeller", "EntityPassCapture::EndFrame");
+
+  for (const auto& variant : variants) {
+    auto key = ContentContext::SerializePipelineVariants({variant});
+    if (!recorded_variants_.insert(std::move(key)).second) {
+      continue;
+    }
+    CapturedPipelineVariant captured;
+    captured.frame = frame_.frame.number;
+    captured.pipeline = variant.pipeline;
+    captured.sample_count = static_cast<int64_t>(variant.options.sample_count);
+    captured.blend_mode = static_cast<int64_t>(variant.options.blend_mode);
+    captured.stencil_compare =
+        static_cast<int64_t>(variant.options.stencil_compare);
+    captured.stencil_operation =
+        static_cast<int64_t>(variant.options.stencil_operation);
+    captured.primitive_type =
+        static_cast<int64_t>(variant.options.primitive_type);
+    frame_.variants.push_back(std::move(captured));
+  }
+  frame_.frame.pass_count = static_cast<int64_t>(frame_.passes.size());
+  frame_.frame.duration_us =
+      (fml::TimePoint::Now() - frame_start_).ToMicroseconds();
+
+  bool post_task = false;
+  {
+    Lock lock(writer_->mutex);
+    if (writer_->pending_frames.size() >= kMaxPendingFrames) {
+      dropped_frame_count_++;
+      return;
+    }
+    // A task is already posted for the frames that are waiting.
+    post_task = writer_->pending_frames.empty();
+    writer_->pending_frames.push_back(std::move(frame_));
+  }
+  frame_ = {};
+
+  if (post_task) {
+    writer_thread_.GetTaskRunner()->PostTask(
+        [writer = writer_]() { WritePendingFrames(*writer); });
+  }
+}
+
+void EntityPassCapture::Flush() {
+  fml::AutoResetWaitableEvent latch;
+  writer_thread_.GetTaskRunner()->PostTask([&latch]() { latch.Signal(); });
+  latch.Wait();
+}
+
+size_t EntityPassCapture::GetDroppedFrameCount() const {
+  return dropped_frame_count_;
+}
+
+void EntityPassCapture::WritePendingFrames(Writer& writer) {
+  TRACE_EVENT0("impeller", "EntityPassCapture::WritePendingFrames");
+  std::vector<Frame> frames;
+  {
+    Lock lock(writer.mutex);
+    frames.swap(writer.pending_frames);
+  }
+
+  auto& archive = writer.archive;
+  const bool written = archive.WriteInTransaction([&archive, &frames]() {
+    for (const auto& frame : frames) {
+      if (!archive.Write(frame.frame)) {
+        return false;
+      }
+      for (const auto& pass : frame.passes) {
+        if (!archive.Write(pass)) {
+          return false;
+        }
+      }
+      for (const auto& variant : frame.variants) {
+        if (!archive.Write(variant)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  });
+  if (!written) {
+    FML_LOG(ERROR) << "Could not write " << frames.size()
+                   << " captured frames.";
+  }
+}
+
+}  // namespace impeller
@@ -0,0 +1,202 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/thread.h"
+#include "flutter/fml/time/time_point.h"
+#include "impeller/archivist/archivable.h"
+#include "impeller/archivist/archive.h"
+#include "impeller/base/thread.h"
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/geometry/size.h"
+
+namespace impeller {
+
+/// A frame of an entity pass capture, which is one render of a root pass.
+struct CapturedFrame final : public Archivable {
+  int64_t number = 0;
+  int64_t pass_count = 0;
+  int64_t duration_us = 0;
+
+  static const ArchiveDef kArchiveDefinition;
+
+  // |Archivable|
+  PrimaryKey GetPrimaryKey() const override { return number; }
+
+  // |Archivable|
+  bool Write(ArchiveLocation& item) const override;
+
+  // |Archivable|
+  bool Read(ArchiveLocation& item) override;
+};
+
+/// A pass rendered in a captured frame. The root pass of the frame has no
+/// parent, which is recorded as a parent of 0.
+struct CapturedPass final : public Archivable {
+  int64_t id = 0;
+  int64_t frame = 0;
+  int64_t parent = 0;
+  int64_t depth = 0;
+  int64_t element_count = 0;
+  int64_t blend_mode = 0;
+  int64_t stencil_depth = 0;
+  int64_t target_width = 0;
+  int64_t target_height = 0;
+  // The time spent encoding the pass, including its subpasses.
+  int64_t duration_us = 0;
+
+  static const ArchiveDef kArchiveDefinition;
+
+  // |Archivable|
+  PrimaryKey GetPrimaryKey() const override { return id; }
+
+  // |Archivable|
+  bool Write(ArchiveLocation& item) const override;
+
+  // |Archivable|
+  bool Read(ArchiveLocation& item) override;
+};
+
+/// A pipeline variant that was first used in a captured frame.
+struct CapturedPipelineVariant final : public Archivable {
+  int64_t frame = 0;
+  std::string pipeline;
+  int64_t sample_count = 0;
+  int64_t blend_mode = 0;
+  int64_t stencil_compare = 0;
+  int64_t stencil_operation = 0;
+  int64_t primitive_type = 0;
+
+  static const ArchiveDef kArchiveDefinition;
+
+  // |Archivable|
+  PrimaryKey GetPrimaryKey() const override { return std::nullopt; }
+
+  // |Archivable|
+  bool Write(ArchiveLocation& item) const override;
+
+  // |Archivable|
+  bool Read(ArchiveLocation& item) override;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Records the entity pass trees, pass timings and pipeline
+///             variants of the frames rendered with a content context into
+///             an archive, for offline inspection with
+///             `impeller/tools/export_entity_pass_capture.py`.
+///
+///             Frames are recorded in memory on the thread that renders them
+///             and handed to a background thread once they end. The
+///             background thread writes all the frames that are waiting in a
+///             single transaction, so the cost of the capture on the
+///             rendering thread stays small. If the archive can't keep up,
+///             frames are dropped instead of growing the backlog.
+///
+class EntityPassCapture {
+ public:
+  /// The number of ended frames that may wait to be written before new frames
+  /// are dropped.
+  static constexpr size_t kMaxPendingFrames = 120u;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Create a capture that writes to a new archive at `path`. An
+  ///             existing file at `path` is replaced.
+  ///
+  /// @return     The capture, or nullptr if the archive couldn't be opened.
+  ///
+  static std::shared_ptr<EntityPassCapture> Make(const std::string& path);
+
+  /// Writes the frames that have ended and waits for the writes.
+  ~EntityPassCapture();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records a pass for its lifetime. Must be nested in a frame.
+  ///             Does nothing if the capture is null.
+  ///
+  class ScopedPass {
+   public:
+    ScopedPass(EntityPassCapture* capture,
+               uint32_t depth,
+               size_t element_count,
+               BlendMode blend_mode,
+               size_t stencil_depth,
+               ISize target_size);
+
+    ~ScopedPass();
+
+   private:
+    EntityPassCapture* capture_;
+    size_t index_ = 0u;
+    fml::TimePoint start_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(ScopedPass);
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Begin a frame. Frames that begin while another frame is being
+  ///             recorded, for example to render a picture into an image,
+  ///             are recorded as part of the outer frame.
+  ///
+  void BeginFrame();
+
+  //----------------------------------------------------------------------------
+  /// @brief      End the frame and queue it to be written.
+  ///
+  /// @param[in]  variants  The pipeline variants used so far. Those that were
+  ///                       not recorded before are recorded with this frame.
+  ///
+  void EndFrame(const std::vector<ContentContext::PipelineVariant>& variants);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Wait for the frames that have ended to be written.
+  ///
+  void Flush();
+
+  size_t GetDroppedFrameCount() const;
+
+ private:
+  struct Frame {
+    CapturedFrame frame;
+    std::vector<CapturedPass> passes;
+    std::vector<CapturedPipelineVariant> variants;
+  };
+
+  // Shared with the tasks of the writer thread.
+  struct Writer {
+    explicit Writer(const std::string& path) : archive(path) {}
+
+    Archive archive;
+    Mutex mutex;
+    std::vector<Frame> pending_frames IPLR_GUARDED_BY(mutex);
+  };
+
+  std::shared_ptr<Writer> writer_;
+  fml::Thread writer_thread_;
+
+  // Only used on the rendering thread.
+  size_t frame_depth_ = 0u;
+  fml::TimePoint frame_start_;
+  Frame frame_;
+  std::vector<size_t> open_passes_;
+  int64_t next_frame_number_ = 0;
+  int64_t next_pass_id_ = 1;
+  std::set<std::string> recorded_variants_;
+  size_t dropped_frame_count_ = 0u;
+
+  explicit EntityPassCapture(const std::string& path);
+
+  static void WritePendingFrames(Writer& writer);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(EntityPassCapture);
+};
+
+}  // namespace impeller
@@ -0,0 +1,111 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <map>
+#include <vector>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/paths.h"
+#include "flutter/testing/testing.h"
+#include "impeller/archivist/archive.h"
+#include "impeller/archivist/archive_location.h"
+#include "impeller/entity/entity_pass_capture.h"
+
+namespace impeller {
+namespace testing {
+
+TEST(EntityPassCaptureTest, WritesPassTreesOfEndedFrames) {
+  fml::ScopedTemporaryDirectory directory;
+  auto path = fml::paths::JoinPaths({directory.path(), "capture.db"});
+
+  ContentContext::PipelineVariant variant;
+  variant.pipeline = "SolidFill Pipeline";
+  variant.options.blend_mode = BlendMode::kSource;
+  {
+    auto capture = EntityPassCapture::Make(path);
+    ASSERT_TRUE(capture);
+
+    for (size_t i = 0; i < 3; i++) {
+      capture->BeginFrame();
+      {
+        EntityPassCapture::ScopedPass root(capture.get(), 0, 2,
+                                           BlendMode::kSourceOver, 0,
+                                           ISize(100, 100));
+        EntityPassCapture::ScopedPass subpass(capture.get(), 1, 5,
+                                              BlendMode::kMultiply, 1,
+                                              ISize(50, 50));
+      }
+      capture->EndFrame({variant});
+    }
+    EXPECT_EQ(capture->GetDroppedFrameCount(), 0u);
+  }
+
+  Archive archive(path);
+  ASSERT_TRUE(archive.IsValid());
+
+  std::vector<CapturedFrame> frames;
+  size_t read = archive.Read<CapturedFrame>([&frames](ArchiveLocation& item) {
+    frames.emplace_back();
+    return frames.back().Read(item);
+  });
+  ASSERT_EQ(read, 3u);
+  for (const auto& frame : frames) {
+    EXPECT_EQ(frame.pass_count, 2);
+  }
+
+  std::map<int64_t, CapturedPass> passes;
+  read = archive.Read<CapturedPass>([&passes](ArchiveLocation& item) {
+    CapturedPass pass;
+    bool result = pass.Read(item);
+    passes[pass.id] = pass;
+    return result;
+  });
+  ASSERT_EQ(read, 6u);
+  ASSERT_EQ(passes.size(), 6u);
+  for (const auto& [id, pass] : passes) {
+    if (pass.depth == 0) {
+      EXPECT_EQ(pass.parent, 0);
+      EXPECT_EQ(pass.element_count, 2);
+      EXPECT_EQ(pass.target_width, 100);
+    } else {
+      ASSERT_EQ(passes.count(pass.parent), 1u);
+      EXPECT_EQ(passes[pass.parent].depth, 0);
+      EXPECT_EQ(passes[pass.parent].frame, pass.frame);
+      EXPECT_EQ(pass.blend_mode, static_cast<int64_t>(BlendMode::kMultiply));
+    }
+  }
+
+  // A variant is only recorded with the frame that first used it.
+  std::vector<CapturedPipelineVariant> variants;
+  read = archive.Read<CapturedPipelineVariant>(
+      [&variants](ArchiveLocation& item) {
+        variants.emplace_back();
+        return variants.back().Read(item);
+      });
+  ASSERT_EQ(read, 1u);
+  EXPECT_EQ(variants[0].frame, 1);
+  EXPECT_EQ(variants[0].pipeline, "SolidFill Pipeline");
+  EXPECT_EQ(variants[0].blend_mode, static_cast<int64_t>(BlendMode::kSource));
+}
+
+TEST(EntityPassCaptureTest, PassesOutsideOfFramesAreIgnored) {
+  fml::ScopedTemporaryDirectory directory;
+  auto path = fml::paths::JoinPaths({directory.path(), "capture.db"});
+  {
+    auto capture = EntityPassCapture::Make(path);
+    ASSERT_TRUE(capture);
+    EntityPassCapture::ScopedPass pass(capture.get(), 0, 1,
+                                       BlendMode::kSourceOver, 0,
+                                       ISize(10, 10));
+  }
+
+  Archive archive(path);
+  ASSERT_TRUE(archive.IsValid());
+  size_t read =
+      archive.Read<CapturedPass>([](ArchiveLocation& item) { return true; });
+  EXPECT_EQ(read, 0u);
+}
+
+}  // namespace testing
+}  // namespace impeller
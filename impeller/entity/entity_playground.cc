@@ -22,7 +22,10 @@ bool EntityPlayground::OpenPlaygroundHere(Entity entity) {
     return false;
   }
   SinglePassCallback callback = [&](RenderPass& pass) -> bool {
-    return entity.Render(content_context, pass);
+    content_context.GetRenderTargetCache()->Start();
+    auto result = entity.Render(content_context, pass);
+    content_context.GetRenderTargetCache()->End();
+    return result;
   };
   return Playground::OpenPlaygroundHere(callback);
 }
@@ -37,7 +40,10 @@ bool EntityPlayground::OpenPlaygroundHere(EntityPlaygroundCallback callback) {
     return false;
   }
   SinglePassCallback pass_callback = [&](RenderPass& pass) -> bool {
-    return callback(content_context, pass);
+    content_context.GetRenderTargetCache()->Start();
+    auto result = callback(content_context, pass);
+    content_context.GetRenderTargetCache()->End();
+    return result;
   };
   return Playground::OpenPlaygroundHere(pass_callback);
 }
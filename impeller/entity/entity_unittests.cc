@@ -3,9 +3,11 @@
 // found in the LICENSE file.
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <optional>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -13,13 +15,16 @@
 #include "fml/logging.h"
 #include "fml/time/time_point.h"
 #include "gtest/gtest.h"
+#include "impeller/entity/compute_tessellator.h"
 #include "impeller/entity/contents/atlas_contents.h"
 #include "impeller/entity/contents/clip_contents.h"
 #include "impeller/entity/contents/contents.h"
 #include "impeller/entity/contents/filters/blend_filter_contents.h"
 #include "impeller/entity/contents/filters/color_filter_contents.h"
 #include "impeller/entity/contents/filters/filter_contents.h"
+#include "impeller/entity/contents/filters/gaussian_blur_filter_contents.h"
 #include "impeller/entity/contents/filters/inputs/filter_input.h"
+#include "impeller/entity/contents/gradient_generator.h"
 #include "impeller/entity/contents/linear_gradient_contents.h"
 #include "impeller/entity/contents/rrect_shadow_contents.h"
 #include "impeller/entity/contents/runtime_effect_contents.h"
@@ -32,6 +37,9 @@
 #include "impeller/entity/entity_pass_delegate.h"
 #include "impeller/entity/entity_playground.h"
 #include "impeller/entity/geometry.h"
+#include "impeller/entity/render_target_cache.h"
+#include "impeller/entity/signed_distance_field_generator.h"
+#include "impeller/entity/tessellation_cache.h"
 #include "impeller/geometry/color.h"
 #include "impeller/geometry/geometry_unittests.h"
 #include "impeller/geometry/path_builder.h"
@@ -882,6 +890,7 @@ TEST_P(EntityTest, GaussianBlurFilter) {
     static int selected_blur_type = 0;
     static int selected_pass_variation = 0;
     static float blur_amount[2] = {10, 10};
+    static float downsample_radius = context.GetGaussianBlurDownsampleRadius();
     static int selected_blur_style = 0;
     static int selected_tile_mode = 3;
     static Color cover_color(1, 0, 0, 0.2);
@@ -911,7 +920,8 @@ TEST_P(EntityTest, GaussianBlurFilter) {
                      pass_variation_names,
                      sizeof(pass_variation_names) / sizeof(char*));
       }
-      ImGui::SliderFloat2("Sigma", blur_amount, 0, 10);
+      ImGui::SliderFloat2("Sigma", blur_amount, 0, 100);
+      ImGui::SliderFloat("Downsample radius", &downsample_radius, 0, 64);
       ImGui::Combo("Blur style", &selected_blur_style, blur_style_names,
                    sizeof(blur_style_names) / sizeof(char*));
       ImGui::Combo("Tile mode", &selected_tile_mode, tile_mode_names,
@@ -928,6 +938,8 @@ TEST_P(EntityTest, GaussianBlurFilter) {
     }
     ImGui::End();
 
+    context.SetGaussianBlurDownsampleRadius(downsample_radius);
+
     std::shared_ptr<Contents> input;
     Size input_size;
 
@@ -1009,6 +1021,26 @@ TEST_P(EntityTest, GaussianBlurFilter) {
   ASSERT_TRUE(OpenPlaygroundHere(callback));
 }
 
+TEST_P(EntityTest, GaussianBlurDownsamplesLargeRadii) {
+  using Blur = DirectionalGaussianBlurFilterContents;
+
+  // Small blurs sample every pixel of the input.
+  ASSERT_EQ(Blur::GetDownsampleLevels(10, 1, 16), 0u);
+  ASSERT_EQ(Blur::GetDownsampleLevels(16, 1, 16), 0u);
+
+  // Large blurs keep at least half of the downsample radius worth of samples.
+  ASSERT_EQ(Blur::GetDownsampleLevels(32, 1, 16), 2u);
+  ASSERT_EQ(Blur::GetDownsampleLevels(64, 1, 16), 3u);
+
+  // Inputs that are already coarse need fewer levels.
+  ASSERT_EQ(Blur::GetDownsampleLevels(64, 4, 16), 1u);
+  ASSERT_EQ(Blur::GetDownsampleLevels(64, 8, 16), 0u);
+
+  // The number of levels is capped, and a radius of zero disables them.
+  ASSERT_EQ(Blur::GetDownsampleLevels(10000, 1, 16), 4u);
+  ASSERT_EQ(Blur::GetDownsampleLevels(64, 1, 0), 0u);
+}
+
 TEST_P(EntityTest, MorphologyFilter) {
   auto boston = CreateTextureForFixture("boston.jpg");
   ASSERT_TRUE(boston);
@@ -1435,6 +1467,49 @@ TEST_P(EntityTest, DrawAtlasNoColorFullSize) {
   ASSERT_TRUE(OpenPlaygroundHere(e));
 }
 
+TEST_P(EntityTest, DrawAtlasWithManyRotatedSprites) {
+  // Enough sprites to take the instanced path where it is available. Every
+  // transform is an RSTransform, as produced by drawAtlas.
+  auto atlas = CreateTextureForFixture("bay_bridge.jpg");
+  auto size = atlas->GetSize();
+  Scalar tile_width = size.width / 8;
+  Scalar tile_height = size.height / 8;
+  std::vector<Rect> texture_coordinates;
+  std::vector<Matrix> transforms;
+  std::vector<Color> colors;
+  for (size_t i = 0; i < 10000; i++) {
+    Scalar angle = i * 0.01;
+    Scalar scale = 0.1 + (i % 10) * 0.02;
+    Scalar scos = std::cos(angle) * scale;
+    Scalar ssin = std::sin(angle) * scale;
+    // clang-format off
+    transforms.push_back(Matrix{
+       scos, ssin, 0, 0,
+      -ssin, scos, 0, 0,
+          0,    0, 1, 0,
+      static_cast<Scalar>(i % 100) * 10, static_cast<Scalar>(i / 100) * 8, 0, 1
+    });
+    // clang-format on
+    texture_coordinates.push_back(Rect::MakeXYWH(
+        (i % 8) * tile_width, ((i / 8) % 8) * tile_height, tile_width,
+        tile_height));
+    colors.push_back(Color::Random());
+  }
+  std::shared_ptr<AtlasContents> contents = std::make_shared<AtlasContents>();
+
+  contents->SetTransforms(std::move(transforms));
+  contents->SetTextureCoordinates(std::move(texture_coordinates));
+  contents->SetColors(std::move(colors));
+  contents->SetTexture(atlas);
+  contents->SetBlendMode(BlendMode::kModulate);
+
+  Entity e;
+  e.SetTransformation(Matrix::MakeScale(GetContentScale()));
+  e.SetContents(contents);
+
+  ASSERT_TRUE(OpenPlaygroundHere(e));
+}
+
 TEST_P(EntityTest, SolidFillCoverageIsCorrect) {
   // No transform
   {
@@ -1775,6 +1850,74 @@ TEST_P(EntityTest, SrgbToLinearFilter) {
   ASSERT_TRUE(OpenPlaygroundHere(callback));
 }
 
+TEST_P(EntityTest, ChainedColorFiltersAreFused) {
+  auto image = CreateTextureForFixture("boston.jpg");
+  ASSERT_TRUE(image);
+
+  FilterContents::ColorMatrix matrix = {
+      1, 0, 0, 0, 0,  //
+      0, 1, 0, 0, 0,  //
+      0, 0, 1, 0, 0,  //
+      0, 0, 0, 1, 0   //
+  };
+  auto source = FilterInput::Make(image);
+  auto to_linear = ColorFilterContents::MakeSrgbToLinearFilter(source);
+  auto color_matrix = ColorFilterContents::MakeColorMatrix(
+      FilterInput::Make(to_linear), matrix);
+  auto to_srgb = ColorFilterContents::MakeLinearToSrgbFilter(
+      FilterInput::Make(color_matrix));
+
+  // The whole chain is fused, innermost stage first.
+  {
+    FilterInput::Ref fused_source;
+    auto stages = to_srgb->CollectFusedStages(fused_source);
+    ASSERT_EQ(stages.size(), 3u);
+    ASSERT_EQ(stages[0].type,
+              ColorFilterContents::FusedStage::Type::kSrgbToLinear);
+    ASSERT_EQ(stages[1].type,
+              ColorFilterContents::FusedStage::Type::kColorMatrix);
+    ASSERT_EQ(stages[2].type,
+              ColorFilterContents::FusedStage::Type::kLinearToSrgb);
+    ASSERT_EQ(fused_source, source);
+  }
+
+  // A cropped filter ends the chain.
+  {
+    color_matrix->SetCoverageCrop(Rect::MakeLTRB(50, 50, 100, 100));
+    FilterInput::Ref fused_source;
+    auto stages = to_srgb->CollectFusedStages(fused_source);
+    ASSERT_EQ(stages.size(), 1u);
+    color_matrix->SetCoverageCrop(std::nullopt);
+  }
+
+  // Blends can't be fused.
+  {
+    auto blend = ColorFilterContents::MakeBlend(BlendMode::kSoftLight,
+                                                FilterInput::Make({image}));
+    FilterInput::Ref fused_source;
+    ASSERT_TRUE(blend->CollectFusedStages(fused_source).empty());
+
+    auto filter =
+        ColorFilterContents::MakeLinearToSrgbFilter(FilterInput::Make(blend));
+    auto stages = filter->CollectFusedStages(fused_source);
+    ASSERT_EQ(stages.size(), 1u);
+  }
+
+  // The number of fused stages is capped.
+  {
+    FilterInput::Ref input = source;
+    std::shared_ptr<ColorFilterContents> filter;
+    for (size_t i = 0; i < ColorFilterContents::kMaxFusedStages + 2; i++) {
+      filter = ColorFilterContents::MakeColorMatrix(input, matrix);
+      input = FilterInput::Make(filter);
+    }
+    FilterInput::Ref fused_source;
+    auto stages = filter->CollectFusedStages(fused_source);
+    ASSERT_EQ(stages.size(), ColorFilterContents::kMaxFusedStages);
+    ASSERT_NE(fused_source, source);
+  }
+}
+
 TEST_P(EntityTest, TTTBlendColor) {
   {
     Color src = {1, 0, 0, 0.5};
@@ -2177,5 +2320,493 @@ TEST_P(EntityTest, RuntimeEffect) {
   ASSERT_TRUE(OpenPlaygroundHere(callback));
 }
 
+TEST_P(EntityTest, RenderTargetCacheReusesTexturesAcrossFrames) {
+  RenderTargetCache cache(GetContext()->GetResourceAllocator(),
+                          /*keep_alive_frame_count=*/1u);
+  auto color_storage = StorageMode::kDevicePrivate;
+
+  cache.Start();
+  auto target_a =
+      RenderTarget::CreateOffscreen(cache, {100, 100}, "A", color_storage);
+  auto texture_a = target_a.GetRenderTargetTexture();
+  ASSERT_TRUE(texture_a);
+  target_a = {};
+  cache.End();
+
+  // Color and stencil attachments.
+  ASSERT_EQ(cache.GetCachedTextureCount(), 2u);
+  ASSERT_EQ(cache.GetMissCount(), 2u);
+  ASSERT_EQ(cache.GetHitCount(), 0u);
+  texture_a.reset();
+
+  // Matching descriptors in the next frame are served from the cache.
+  cache.Start();
+  auto target_b =
+      RenderTarget::CreateOffscreen(cache, {100, 100}, "B", color_storage);
+  ASSERT_TRUE(target_b.IsValid());
+  // The textures are in use this frame, so a second target must allocate.
+  auto target_c =
+      RenderTarget::CreateOffscreen(cache, {100, 100}, "C", color_storage);
+  ASSERT_TRUE(target_c.IsValid());
+  ASSERT_NE(target_b.GetRenderTargetTexture(),
+            target_c.GetRenderTargetTexture());
+  target_b = {};
+  target_c = {};
+  cache.End();
+
+  ASSERT_EQ(cache.GetHitCount(), 2u);
+  ASSERT_EQ(cache.GetMissCount(), 4u);
+  ASSERT_EQ(cache.GetCachedTextureCount(), 4u);
+
+  // Unused textures age out once they exceed the keep alive frame count.
+  cache.Start();
+  cache.End();
+  ASSERT_EQ(cache.GetCachedTextureCount(), 4u);
+  cache.Start();
+  cache.End();
+  ASSERT_EQ(cache.GetCachedTextureCount(), 0u);
+}
+
+TEST_P(EntityTest, GradientTextureCacheReusesTextures) {
+  GradientTextureCache cache(/*max_entries=*/2u);
+  std::vector<Color> colors = {Color::Red(), Color::Blue()};
+  std::vector<Scalar> stops = {0.0, 1.0};
+
+  auto texture = cache.GetOrCreate(colors, stops, GetContext());
+  ASSERT_TRUE(texture);
+  ASSERT_EQ(cache.GetOrCreate(colors, stops, GetContext()), texture);
+  ASSERT_EQ(cache.GetSize(), 1u);
+
+  std::vector<Scalar> other_stops = {0.0, 0.5};
+  auto other_texture = cache.GetOrCreate(colors, other_stops, GetContext());
+  ASSERT_NE(other_texture, texture);
+  ASSERT_EQ(cache.GetSize(), 2u);
+
+  // Exceeding the limit evicts the least recently used gradient.
+  std::vector<Color> other_colors = {Color::Green(), Color::Blue()};
+  ASSERT_TRUE(cache.GetOrCreate(other_colors, stops, GetContext()));
+  ASSERT_EQ(cache.GetSize(), 2u);
+  ASSERT_NE(cache.GetOrCreate(colors, stops, GetContext()), texture);
+}
+
+TEST_P(EntityTest, TessellationCacheRetainsKeyedPaths) {
+  TessellationCache cache;
+  Tessellator tessellator;
+  auto allocator = GetContext()->GetResourceAllocator();
+
+  auto path = PathBuilder{}.AddRect(Rect::MakeXYWH(0, 0, 100, 100)).TakePath();
+  ASSERT_FALSE(cache.GetOrCreate(path, tessellator, *allocator).has_value());
+  ASSERT_EQ(cache.GetEntryCount(), 0u);
+
+  path.SetCacheKey(42u);
+  auto vertex_buffer = cache.GetOrCreate(path, tessellator, *allocator);
+  ASSERT_TRUE(vertex_buffer.has_value());
+  ASSERT_EQ(cache.GetMissCount(), 1u);
+  ASSERT_EQ(cache.GetEntryCount(), 1u);
+  ASSERT_GT(cache.GetByteSize(), 0u);
+
+  auto cached_vertex_buffer = cache.GetOrCreate(path, tessellator, *allocator);
+  ASSERT_TRUE(cached_vertex_buffer.has_value());
+  ASSERT_EQ(cache.GetHitCount(), 1u);
+  ASSERT_EQ(cached_vertex_buffer->vertex_buffer.buffer,
+            vertex_buffer->vertex_buffer.buffer);
+  ASSERT_EQ(cached_vertex_buffer->index_count, vertex_buffer->index_count);
+
+  // The fill type is part of the key.
+  path.SetFillType(FillType::kOdd);
+  ASSERT_TRUE(cache.GetOrCreate(path, tessellator, *allocator).has_value());
+  ASSERT_EQ(cache.GetMissCount(), 2u);
+  ASSERT_EQ(cache.GetEntryCount(), 2u);
+}
+
+TEST_P(EntityTest, TessellationCacheEvictsLeastRecentlyUsed) {
+  Tessellator tessellator;
+  auto allocator = GetContext()->GetResourceAllocator();
+
+  auto path = PathBuilder{}.AddRect(Rect::MakeXYWH(0, 0, 100, 100)).TakePath();
+  path.SetCacheKey(1u);
+
+  // Find the byte size of a single entry.
+  size_t entry_size = 0u;
+  {
+    TessellationCache cache;
+    ASSERT_TRUE(cache.GetOrCreate(path, tessellator, *allocator).has_value());
+    entry_size = cache.GetByteSize();
+  }
+
+  TessellationCache cache(entry_size * 2);
+  ASSERT_TRUE(cache.GetOrCreate(path, tessellator, *allocator).has_value());
+  path.SetCacheKey(2u);
+  ASSERT_TRUE(cache.GetOrCreate(path, tessellator, *allocator).has_value());
+  path.SetCacheKey(3u);
+  ASSERT_TRUE(cache.GetOrCreate(path, tessellator, *allocator).has_value());
+  ASSERT_EQ(cache.GetEntryCount(), 2u);
+  ASSERT_LE(cache.GetByteSize(), entry_size * 2);
+
+  // The first path was evicted.
+  path.SetCacheKey(1u);
+  ASSERT_TRUE(cache.GetOrCreate(path, tessellator, *allocator).has_value());
+  ASSERT_EQ(cache.GetHitCount(), 0u);
+  ASSERT_EQ(cache.GetMissCount(), 4u);
+}
+
+TEST_P(EntityTest, TessellationCacheRetainsKeyedStrokes) {
+  TessellationCache cache;
+  auto allocator = GetContext()->GetResourceAllocator();
+
+  size_t created_count = 0u;
+  auto create_vertices = [&]() {
+    created_count++;
+    VertexBufferBuilder<SolidFillVertexShader::PerVertexData> builder;
+    builder.AddVertices({{Point(0, 0)}, {Point(10, 0)}, {Point(0, 10)}});
+    return builder.CreateVertexBuffer(*allocator);
+  };
+  TessellationCache::StrokeParameters stroke = {
+      .width = 4.0f,
+      .miter_limit = 4.0f,
+      .cap = Cap::kButt,
+      .join = Join::kMiter,
+      .scale_bucket = TessellationCache::GetScaleBucket(1.0f),
+  };
+
+  auto path = PathBuilder{}.AddLine({0, 0}, {100, 100}).TakePath();
+  ASSERT_FALSE(
+      cache.GetOrCreateStroke(path, stroke, create_vertices).has_value());
+  ASSERT_EQ(created_count, 0u);
+
+  path.SetCacheKey(42u);
+  auto vertex_buffer = cache.GetOrCreateStroke(path, stroke, create_vertices);
+  ASSERT_TRUE(vertex_buffer.has_value());
+  auto cached_vertex_buffer =
+      cache.GetOrCreateStroke(path, stroke, create_vertices);
+  ASSERT_TRUE(cached_vertex_buffer.has_value());
+  ASSERT_EQ(created_count, 1u);
+  ASSERT_EQ(cache.GetHitCount(), 1u);
+  ASSERT_EQ(cached_vertex_buffer->vertex_buffer.buffer,
+            vertex_buffer->vertex_buffer.buffer);
+
+  // Scales in the same bucket share the vertices, and others don't.
+  ASSERT_EQ(TessellationCache::GetScaleBucket(0.8f),
+            TessellationCache::GetScaleBucket(1.0f));
+  ASSERT_GE(TessellationCache::GetBucketMaxScale(
+                TessellationCache::GetScaleBucket(1.2f)),
+            1.2f);
+  stroke.scale_bucket = TessellationCache::GetScaleBucket(2.0f);
+  ASSERT_TRUE(
+      cache.GetOrCreateStroke(path, stroke, create_vertices).has_value());
+  ASSERT_EQ(created_count, 2u);
+
+  // Fills of the path are cached separately.
+  Tessellator tessellator;
+  ASSERT_TRUE(cache.GetOrCreate(path, tessellator, *allocator).has_value());
+  ASSERT_EQ(cache.GetEntryCount(), 3u);
+}
+
+TEST_P(EntityTest, SignedDistanceFieldGeneratorSignsDistances) {
+  if (!GetContext()->SupportsCompute()) {
+    GTEST_SKIP_("Compute is only supported on Metal.");
+  }
+  SignedDistanceFieldGenerator generator(GetContext());
+  ASSERT_TRUE(generator.IsValid());
+
+  // A 40x40 square inside a 64x64 bitmap.
+  constexpr ISize kSize(64, 64);
+  std::vector<uint8_t> pixels(kSize.Area(), 0u);
+  for (size_t y = 12; y < 52; y++) {
+    for (size_t x = 12; x < 52; x++) {
+      pixels[y * kSize.width + x] = 0xFF;
+    }
+  }
+
+  ASSERT_TRUE(generator.Generate(pixels.data(), kSize));
+
+  // Far outside and deep inside the square saturate the field.
+  ASSERT_EQ(pixels[0], 0u);
+  ASSERT_EQ(pixels[32 * kSize.width + 32], 255u);
+  // The field increases across the edge of the square.
+  ASSERT_LT(pixels[32 * kSize.width + 5], pixels[32 * kSize.width + 10]);
+  ASSERT_LT(pixels[32 * kSize.width + 10], pixels[32 * kSize.width + 14]);
+  ASSERT_LT(pixels[32 * kSize.width + 14], pixels[32 * kSize.width + 18]);
+}
+
+TEST_P(EntityTest, ComputeTessellatorRecognizesConvexPolylines) {
+  auto rect = PathBuilder{}.AddRect(Rect::MakeXYWH(0, 0, 100, 100)).TakePath();
+  ASSERT_TRUE(ComputeTessellator::IsConvex(rect.CreatePolyline()));
+
+  auto circle = PathBuilder{}.AddCircle({50, 50}, 50).TakePath();
+  ASSERT_TRUE(ComputeTessellator::IsConvex(circle.CreatePolyline()));
+
+  auto concave = PathBuilder{}
+                     .MoveTo({0, 0})
+                     .LineTo({100, 0})
+                     .LineTo({100, 100})
+                     .LineTo({50, 50})
+                     .LineTo({0, 100})
+                     .Close()
+                     .TakePath();
+  ASSERT_FALSE(ComputeTessellator::IsConvex(concave.CreatePolyline()));
+
+  // A pentagram turns the same way at every point but winds twice.
+  PathBuilder star_builder;
+  for (size_t i = 0; i < 5; i++) {
+    Scalar angle = kPiOver2 + i * 4 * kPi / 5;
+    Point point(50 + 50 * std::cos(angle), 50 + 50 * std::sin(angle));
+    if (i == 0) {
+      star_builder.MoveTo(point);
+    } else {
+      star_builder.LineTo(point);
+    }
+  }
+  auto star = star_builder.Close().TakePath();
+  ASSERT_FALSE(ComputeTessellator::IsConvex(star.CreatePolyline()));
+
+  auto two_rects = PathBuilder{}
+                       .AddRect(Rect::MakeXYWH(0, 0, 10, 10))
+                       .AddRect(Rect::MakeXYWH(20, 0, 10, 10))
+                       .TakePath();
+  ASSERT_FALSE(ComputeTessellator::IsConvex(two_rects.CreatePolyline()));
+}
+
+TEST_P(EntityTest, ComputeTessellatorExpandsLongStrokes) {
+  if (!GetContext()->SupportsCompute()) {
+    GTEST_SKIP_("Compute is only supported on Metal.");
+  }
+  ComputeTessellator tessellator(GetContext());
+  ASSERT_TRUE(tessellator.IsValid());
+
+  // A zig zag with enough segments to be worth dispatching.
+  constexpr size_t kSegmentCount = ComputeTessellator::kMinSegmentCount * 2;
+  PathBuilder builder;
+  builder.MoveTo({0, 0});
+  for (size_t i = 1; i <= kSegmentCount; i++) {
+    builder.LineTo({i * 4.0f, (i % 2) * 10.0f});
+  }
+  auto polyline = builder.TakePath().CreatePolyline();
+
+  auto vertex_buffer =
+      tessellator.Stroke(polyline, 2, 4, Cap::kSquare, Join::kMiter);
+  ASSERT_TRUE(vertex_buffer);
+  ASSERT_EQ(vertex_buffer.index_count, kSegmentCount * 12);
+  ASSERT_EQ(vertex_buffer.index_type, IndexType::k32bit);
+
+  // Round joins and short polylines are left to the CPU.
+  ASSERT_FALSE(tessellator.Stroke(polyline, 2, 4, Cap::kButt, Join::kRound));
+  auto short_polyline =
+      PathBuilder{}.MoveTo({0, 0}).LineTo({10, 10}).TakePath().CreatePolyline();
+  ASSERT_FALSE(
+      tessellator.Stroke(short_polyline, 2, 4, Cap::kButt, Join::kMiter));
+}
+
+TEST_P(EntityTest, PipelineVariantsRoundTripThroughSerialization) {
+  std::vector<ContentContext::PipelineVariant> variants = {
+      {.pipeline = "SolidFill Pipeline",
+       .options = {.sample_count = SampleCount::kCount4,
+                   .blend_mode = BlendMode::kSourceIn,
+                   .primitive_type = PrimitiveType::kTriangleStrip}},
+      {.pipeline = "Clip Pipeline",
+       .options = {.stencil_compare = CompareFunction::kAlways,
+                   .stencil_operation = StencilOperation::kIncrementClamp}},
+  };
+  auto serialized = ContentContext::SerializePipelineVariants(variants);
+  // Malformed and out of range entries are skipped.
+  serialized += "Bogus Pipeline,1,2\nBogus Pipeline,3,0,0,0,0\n";
+
+  auto parsed = ContentContext::DeserializePipelineVariants(serialized);
+  ASSERT_EQ(parsed.size(), variants.size());
+  for (size_t i = 0; i < variants.size(); i++) {
+    ASSERT_EQ(parsed[i].pipeline, variants[i].pipeline);
+    ASSERT_TRUE(ContentContextOptions::Equal{}(parsed[i].options,
+                                               variants[i].options));
+  }
+}
+
+TEST_P(EntityTest, PipelineVariantsCanBeLookedUpConcurrently) {
+  ContentContext context(GetContext());
+  ASSERT_TRUE(context.IsValid());
+
+  const std::vector<BlendMode> blend_modes = {
+      BlendMode::kSource, BlendMode::kSourceIn, BlendMode::kSourceOut,
+      BlendMode::kDestinationOver, BlendMode::kXor};
+  std::vector<std::shared_ptr<Pipeline<PipelineDescriptor>>> expected;
+  for (auto blend_mode : blend_modes) {
+    expected.push_back(
+        context.GetSolidFillPipeline({.blend_mode = blend_mode}));
+    ASSERT_TRUE(expected.back());
+  }
+
+  std::atomic<size_t> mismatches = 0u;
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < 4; i++) {
+    threads.emplace_back([&]() {
+      for (auto j = 0; j < 100; j++) {
+        for (size_t k = 0; k < blend_modes.size(); k++) {
+          if (context.GetSolidFillPipeline({.blend_mode = blend_modes[k]}) !=
+              expected[k]) {
+            mismatches++;
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(mismatches, 0u);
+}
+
+TEST_P(EntityTest, PrewarmedPipelineVariantsAreRecordedAndReused) {
+  ContentContext context(GetContext());
+  ASSERT_TRUE(context.IsValid());
+  context.SetPipelineVariantRecordingEnabled(true);
+
+  ContentContextOptions options{.blend_mode = BlendMode::kSourceIn};
+  ASSERT_TRUE(context.GetSolidFillPipeline(options));
+  auto recorded = context.GetRecordedPipelineVariants();
+  ASSERT_EQ(recorded.size(), 1u);
+  ASSERT_EQ(recorded[0].pipeline, "SolidFill Pipeline");
+
+  ContentContext prewarmed(GetContext());
+  auto replayed = ContentContext::DeserializePipelineVariants(
+      ContentContext::SerializePipelineVariants(recorded));
+  ASSERT_EQ(prewarmed.PrewarmPipelineVariants(replayed), 1u);
+  // Variants that already exist are not created again.
+  ASSERT_EQ(prewarmed.PrewarmPipelineVariants(replayed), 0u);
+  ASSERT_TRUE(prewarmed.GetSolidFillPipeline(options));
+}
+
+TEST_P(EntityTest, AdjacentCompatibleDrawsAreBatched) {
+  ContentContext content_context(GetContext());
+  ASSERT_TRUE(content_context.IsValid());
+
+  EntityPass pass;
+  auto add_rect = [&pass](Rect rect, Color color, BlendMode blend_mode) {
+    auto contents = std::make_shared<SolidColorContents>();
+    contents->SetGeometry(Geometry::MakeRect(rect));
+    contents->SetColor(color);
+    Entity entity;
+    entity.SetContents(std::move(contents));
+    entity.SetBlendMode(blend_mode);
+    pass.AddEntity(entity);
+  };
+  add_rect({0, 0, 10, 10}, Color::Red(), BlendMode::kSourceOver);
+  add_rect({5, 5, 10, 10}, Color::Blue(), BlendMode::kSourceOver);
+  add_rect({10, 10, 10, 10}, Color::Green(), BlendMode::kSourceOver);
+  // A different blend mode starts a new batch.
+  add_rect({20, 20, 10, 10}, Color::Red(), BlendMode::kSourceIn);
+  add_rect({30, 30, 10, 10}, Color::Blue(), BlendMode::kSourceIn);
+
+  auto render_target = RenderTarget::CreateOffscreen(*GetContext(), {100, 100});
+  ASSERT_TRUE(pass.Render(content_context, render_target));
+  ASSERT_EQ(content_context.GetCoalescedDrawCount(), 3u);
+
+  content_context.ResetCoalescedDrawCount();
+  content_context.SetDrawBatchingEnabled(false);
+  ASSERT_TRUE(pass.Render(content_context, render_target));
+  ASSERT_EQ(content_context.GetCoalescedDrawCount(), 0u);
+}
+
+TEST_P(EntityTest, HiddenAndClippedEntitiesAreCulled) {
+  ContentContext content_context(GetContext());
+  ASSERT_TRUE(content_context.IsValid());
+
+  EntityPass pass;
+  auto add_rect = [&pass](Rect rect, Color color) {
+    auto contents = std::make_shared<SolidColorContents>();
+    contents->SetGeometry(Geometry::MakeRect(rect));
+    contents->SetColor(color);
+    Entity entity;
+    entity.SetContents(std::move(contents));
+    pass.AddEntity(entity);
+  };
+  // The edges of the opaque rect drawn last only cover half a pixel, so this
+  // stays visible along them.
+  add_rect({0, 0, 100, 100}, Color::Red());
+  // Hidden under the opaque rect drawn last.
+  add_rect({10, 10, 20, 20}, Color::Blue().WithAlpha(0.5));
+  // Only partially covered.
+  add_rect({90, 90, 20, 20}, Color::Green());
+  // Translucent, so it doesn't hide anything.
+  add_rect({0, 0, 100, 100}, Color::Blue().WithAlpha(0.5));
+  add_rect({0.5, 0.5, 99.5, 99.5}, Color::White());
+
+  auto render_target = RenderTarget::CreateOffscreen(*GetContext(), {200, 200});
+  ASSERT_TRUE(pass.Render(content_context, render_target));
+  ASSERT_EQ(content_context.GetOccludedEntityCount(), 1u);
+  ASSERT_EQ(content_context.GetClipCulledEntityCount(), 0u);
+
+  // The opaque rect drawn under the clip doesn't hide anything drawn before
+  // the clip.
+  content_context.ResetCulledEntityCounts();
+  auto clip = std::make_shared<ClipContents>();
+  clip->SetGeometry(Geometry::MakeRect({150, 150, 50, 50}));
+  Entity clip_entity;
+  clip_entity.SetContents(std::move(clip));
+  pass.AddEntity(clip_entity);
+  auto contents = std::make_shared<SolidColorContents>();
+  contents->SetGeometry(Geometry::MakeRect({0, 0, 100, 100}));
+  contents->SetColor(Color::Red());
+  Entity clipped;
+  clipped.SetContents(std::move(contents));
+  clipped.SetStencilDepth(1);
+  pass.AddEntity(clipped);
+
+  ASSERT_TRUE(pass.Render(content_context, render_target));
+  ASSERT_EQ(content_context.GetOccludedEntityCount(), 1u);
+  ASSERT_EQ(content_context.GetClipCulledEntityCount(), 1u);
+}
+
+TEST_P(EntityTest, AdvancedBlendsUseFramebufferFetchWhereSupported) {
+  ContentContext content_context(GetContext());
+  ASSERT_TRUE(content_context.IsValid());
+  ASSERT_EQ(content_context.GetFramebufferBlendPipeline({}) != nullptr,
+            GetContext()->SupportsFramebufferFetch());
+
+  EntityPass pass;
+  auto add_rect = [&pass](Rect rect, Color color, BlendMode blend_mode) {
+    auto contents = std::make_shared<SolidColorContents>();
+    contents->SetGeometry(Geometry::MakeRect(rect));
+    contents->SetColor(color);
+    Entity entity;
+    entity.SetContents(std::move(contents));
+    entity.SetBlendMode(blend_mode);
+    pass.AddEntity(entity);
+  };
+  add_rect({0, 0, 100, 100}, Color::Red(), BlendMode::kSourceOver);
+  add_rect({50, 50, 100, 100}, Color::Blue(), BlendMode::kScreen);
+  add_rect({25, 25, 100, 100}, Color::Green(), BlendMode::kLuminosity);
+
+  auto render_target = RenderTarget::CreateOffscreen(*GetContext(), {200, 200});
+  ASSERT_TRUE(pass.Render(content_context, render_target));
+}
+
+TEST_P(EntityTest, RuntimeEffectPipelinesAreSharedByStageHash) {
+  ContentContext content_context(GetContext());
+  ASSERT_TRUE(content_context.IsValid());
+  auto desc = content_context.GetSolidFillPipeline({})->GetDescriptor();
+
+  size_t created_count = 0u;
+  auto create_descriptor = [&]() -> std::optional<PipelineDescriptor> {
+    created_count++;
+    return desc;
+  };
+
+  auto first =
+      content_context.GetRuntimeEffectPipeline(1u, {}, create_descriptor);
+  auto second =
+      content_context.GetRuntimeEffectPipeline(1u, {}, create_descriptor);
+  ASSERT_TRUE(first.IsValid());
+  ASSERT_TRUE(second.IsValid());
+  ASSERT_EQ(created_count, 1u);
+  ASSERT_EQ(first.Get(), second.Get());
+
+  ContentContextOptions options;
+  options.blend_mode = BlendMode::kSource;
+  content_context.GetRuntimeEffectPipeline(1u, options, create_descriptor);
+  ASSERT_EQ(created_count, 2u);
+
+  content_context.GetRuntimeEffectPipeline(2u, {}, create_descriptor);
+  ASSERT_EQ(created_count, 3u);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "impeller/entity/geometry.h"
+#include "impeller/entity/compute_tessellator.h"
 #include "impeller/entity/contents/content_context.h"
 #include "impeller/entity/position_color.vert.h"
 #include "impeller/geometry/matrix.h"
@@ -17,17 +18,21 @@ Geometry::Geometry() = default;
 
 Geometry::~Geometry() = default;
 
+std::optional<Rect> Geometry::GetRect() const {
+  return std::nullopt;
+}
+
 // static
 std::unique_ptr<VerticesGeometry> Geometry::MakeVertices(
     const Vertices& vertices) {
   return std::make_unique<VerticesGeometry>(vertices);
 }
 
-std::unique_ptr<Geometry> Geometry::MakeFillPath(const Path& path) {
-  return std::make_unique<FillPathGeometry>(path);
+std::unique_ptr<Geometry> Geometry::MakeFillPath(Path path) {
+  return std::make_unique<FillPathGeometry>(std::move(path));
 }
 
-std::unique_ptr<Geometry> Geometry::MakeStrokePath(const Path& path,
+std::unique_ptr<Geometry> Geometry::MakeStrokePath(Path path,
                                                    Scalar stroke_width,
                                                    Scalar miter_limit,
                                                    Cap stroke_cap,
@@ -36,8 +41,8 @@ std::unique_ptr<Geometry> Geometry::MakeStrokePath(const Path& path,
   if (miter_limit < 0) {
     miter_limit = 4.0;
   }
-  return std::make_unique<StrokePathGeometry>(path, stroke_width, miter_limit,
-                                              stroke_cap, stroke_join);
+  return std::make_unique<StrokePathGeometry>(
+      std::move(path), stroke_width, miter_limit, stroke_cap, stroke_join);
 }
 
 std::unique_ptr<Geometry> Geometry::MakeCover() {
@@ -200,7 +205,7 @@ std::optional<Rect> VerticesGeometry::GetCoverage(
 
 /////// Path Geometry ///////
 
-FillPathGeometry::FillPathGeometry(const Path& path) : path_(path) {}
+FillPathGeometry::FillPathGeometry(Path path) : path_(std::move(path)) {}
 
 FillPathGeometry::~FillPathGeometry() = default;
 
@@ -208,10 +213,42 @@ GeometryResult FillPathGeometry::GetPositionBuffer(
     const ContentContext& renderer,
     const Entity& entity,
     RenderPass& pass) {
+  if (path_.GetCacheKey().has_value()) {
+    auto cached_vertex_buffer = renderer.GetTessellationCache()->GetOrCreate(
+        path_, *renderer.GetTessellator(),
+        *renderer.GetContext()->GetResourceAllocator());
+    if (cached_vertex_buffer.has_value()) {
+      return GeometryResult{
+          .type = PrimitiveType::kTriangle,
+          .vertex_buffer = cached_vertex_buffer.value(),
+          .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                       entity.GetTransformation(),
+          .prevent_overdraw = false,
+      };
+    }
+  }
+
+  auto polyline = path_.CreatePolyline();
+  if (auto compute_tessellator = renderer.GetComputeTessellator();
+      compute_tessellator &&
+      polyline.points.size() >= ComputeTessellator::kMinSegmentCount &&
+      ComputeTessellator::IsConvex(polyline)) {
+    auto vertex_buffer = compute_tessellator->FillConvex(polyline);
+    if (vertex_buffer) {
+      return GeometryResult{
+          .type = PrimitiveType::kTriangle,
+          .vertex_buffer = vertex_buffer,
+          .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                       entity.GetTransformation(),
+          .prevent_overdraw = false,
+      };
+    }
+  }
+
   VertexBuffer vertex_buffer;
   auto& host_buffer = pass.GetTransientsBuffer();
   auto tesselation_result = renderer.GetTessellator()->Tessellate(
-      path_.GetFillType(), path_.CreatePolyline(),
+      path_.GetFillType(), polyline,
       [&vertex_buffer, &host_buffer](
           const float* vertices, size_t vertices_count, const uint16_t* indices,
           size_t indices_count) {
@@ -246,12 +283,12 @@ std::optional<Rect> FillPathGeometry::GetCoverage(
 
 ///// Stroke Geometry //////
 
-StrokePathGeometry::StrokePathGeometry(const Path& path,
+StrokePathGeometry::StrokePathGeometry(Path path,
                                        Scalar stroke_width,
                                        Scalar miter_limit,
                                        Cap stroke_cap,
                                        Join stroke_join)
-    : path_(path),
+    : path_(std::move(path)),
       stroke_width_(stroke_width),
       miter_limit_(miter_limit),
       stroke_cap_(stroke_cap),
@@ -445,15 +482,28 @@ StrokePathGeometry::CapProc StrokePathGeometry::GetCapProc(Cap stroke_cap) {
 
 // static
 VertexBuffer StrokePathGeometry::CreateSolidStrokeVertices(
-    const Path& path,
+    const Path::Polyline& polyline,
     HostBuffer& buffer,
     Scalar stroke_width,
     Scalar scaled_miter_limit,
     const StrokePathGeometry::JoinProc& join_proc,
     const StrokePathGeometry::CapProc& cap_proc,
     Scalar tolerance) {
+  return CreateSolidStrokeVertexBuilder(polyline, stroke_width,
+                                        scaled_miter_limit, join_proc,
+                                        cap_proc, tolerance)
+      .CreateVertexBuffer(buffer);
+}
+
+VertexBufferBuilder<SolidFillVertexShader::PerVertexData>
+StrokePathGeometry::CreateSolidStrokeVertexBuilder(
+    const Path::Polyline& polyline,
+    Scalar stroke_width,
+    Scalar scaled_miter_limit,
+    const StrokePathGeometry::JoinProc& join_proc,
+    const StrokePathGeometry::CapProc& cap_proc,
+    Scalar tolerance) {
   VertexBufferBuilder<VS::PerVertexData> vtx_builder;
-  auto polyline = path.CreatePolyline();
 
   VS::PerVertexData vtx;
 
@@ -554,7 +604,7 @@ VertexBuffer StrokePathGeometry::CreateSolidStrokeVertices(
     }
   }
 
-  return vtx_builder.CreateVertexBuffer(buffer);
+  return vtx_builder;
 }
 
 GeometryResult StrokePathGeometry::GetPositionBuffer(
@@ -572,13 +622,67 @@ GeometryResult StrokePathGeometry::GetPositionBuffer(
   Scalar min_size = 1.0f / sqrt(std::abs(determinant));
   Scalar stroke_width = std::max(stroke_width_, min_size);
 
-  auto tolerance =
-      kDefaultCurveTolerance /
-      (stroke_width_ * entity.GetTransformation().GetMaxBasisLength());
+  auto scale = entity.GetTransformation().GetMaxBasisLength();
+
+  // Static paths are stroked once per range of scales, and then reused with
+  // any transform. Hairlines are left out, as their width depends on the
+  // exact transform.
+  if (path_.GetCacheKey().has_value() && stroke_width == stroke_width_) {
+    const auto scale_bucket = TessellationCache::GetScaleBucket(scale);
+    const auto cached_vertex_buffer =
+        renderer.GetTessellationCache()->GetOrCreateStroke(
+            path_,
+            {.width = stroke_width,
+             .miter_limit = miter_limit_,
+             .cap = stroke_cap_,
+             .join = stroke_join_,
+             .scale_bucket = scale_bucket},
+            [&]() {
+              auto tolerance =
+                  kDefaultCurveTolerance /
+                  (stroke_width_ *
+                   TessellationCache::GetBucketMaxScale(scale_bucket));
+              return CreateSolidStrokeVertexBuilder(
+                         path_.CreatePolyline(), stroke_width,
+                         miter_limit_ * stroke_width_ * 0.5,
+                         GetJoinProc(stroke_join_), GetCapProc(stroke_cap_),
+                         tolerance)
+                  .CreateVertexBuffer(
+                      *renderer.GetContext()->GetResourceAllocator());
+            });
+    if (cached_vertex_buffer.has_value()) {
+      return GeometryResult{
+          .type = PrimitiveType::kTriangleStrip,
+          .vertex_buffer = cached_vertex_buffer.value(),
+          .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                       entity.GetTransformation(),
+          .prevent_overdraw = true,
+      };
+    }
+  }
+
+  auto tolerance = kDefaultCurveTolerance / (stroke_width_ * scale);
+
+  auto polyline = path_.CreatePolyline();
+  if (auto compute_tessellator = renderer.GetComputeTessellator();
+      compute_tessellator) {
+    auto vertex_buffer = compute_tessellator->Stroke(
+        polyline, stroke_width, miter_limit_ * stroke_width_ * 0.5,
+        stroke_cap_, stroke_join_);
+    if (vertex_buffer) {
+      return GeometryResult{
+          .type = PrimitiveType::kTriangle,
+          .vertex_buffer = vertex_buffer,
+          .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                       entity.GetTransformation(),
+          .prevent_overdraw = true,
+      };
+    }
+  }
 
   auto& host_buffer = pass.GetTransientsBuffer();
   auto vertex_buffer = CreateSolidStrokeVertices(
-      path_, host_buffer, stroke_width, miter_limit_ * stroke_width_ * 0.5,
+      polyline, host_buffer, stroke_width, miter_limit_ * stroke_width_ * 0.5,
       GetJoinProc(stroke_join_), GetCapProc(stroke_cap_), tolerance);
 
   return GeometryResult{
@@ -694,4 +798,8 @@ std::optional<Rect> RectGeometry::GetCoverage(const Matrix& transform) const {
   return rect_.TransformBounds(transform);
 }
 
+std::optional<Rect> RectGeometry::GetRect() const {
+  return rect_;
+}
+
 }  // namespace impeller
@@ -54,10 +54,10 @@ class Geometry {
   static std::unique_ptr<VerticesGeometry> MakeVertices(
       const Vertices& vertices);
 
-  static std::unique_ptr<Geometry> MakeFillPath(const Path& path);
+  static std::unique_ptr<Geometry> MakeFillPath(Path path);
 
   static std::unique_ptr<Geometry> MakeStrokePath(
-      const Path& path,
+      Path path,
       Scalar stroke_width = 0.0,
       Scalar miter_limit = 4.0,
       Cap stroke_cap = Cap::kButt,
@@ -74,6 +74,10 @@ class Geometry {
   virtual GeometryVertexType GetVertexType() const = 0;
 
   virtual std::optional<Rect> GetCoverage(const Matrix& transform) const = 0;
+
+  /// @brief If this geometry is exactly a rectangle in its local space,
+  ///        return it. Used to batch the draws of simple geometry.
+  virtual std::optional<Rect> GetRect() const;
 };
 
 /// @brief A geometry that is created from a vertices object.
@@ -113,7 +117,7 @@ class VerticesGeometry : public Geometry {
 /// @brief A geometry that is created from a filled path object.
 class FillPathGeometry : public Geometry {
  public:
-  explicit FillPathGeometry(const Path& path);
+  explicit FillPathGeometry(Path path);
 
   ~FillPathGeometry();
 
@@ -137,7 +141,7 @@ class FillPathGeometry : public Geometry {
 /// @brief A geometry that is created from a stroked path object.
 class StrokePathGeometry : public Geometry {
  public:
-  StrokePathGeometry(const Path& path,
+  StrokePathGeometry(Path path,
                      Scalar stroke_width,
                      Scalar miter_limit,
                      Cap stroke_cap,
@@ -154,6 +158,8 @@ class StrokePathGeometry : public Geometry {
   Join GetStrokeJoin() const;
 
  private:
+  friend class ImpellerBenchmarkAccessor;
+
   using VS = SolidFillVertexShader;
 
   using CapProc =
@@ -186,7 +192,7 @@ class StrokePathGeometry : public Geometry {
       const Point& start_offset,
       const Point& end_offset);
 
-  static VertexBuffer CreateSolidStrokeVertices(const Path& path,
+  static VertexBuffer CreateSolidStrokeVertices(const Path::Polyline& polyline,
                                                 HostBuffer& buffer,
                                                 Scalar stroke_width,
                                                 Scalar scaled_miter_limit,
@@ -194,6 +200,14 @@ class StrokePathGeometry : public Geometry {
                                                 const CapProc& cap_proc,
                                                 Scalar tolerance);
 
+  static VertexBufferBuilder<VS::PerVertexData> CreateSolidStrokeVertexBuilder(
+      const Path::Polyline& polyline,
+      Scalar stroke_width,
+      Scalar scaled_miter_limit,
+      const JoinProc& join_proc,
+      const CapProc& cap_proc,
+      Scalar tolerance);
+
   static StrokePathGeometry::JoinProc GetJoinProc(Join stroke_join);
 
   static StrokePathGeometry::CapProc GetCapProc(Cap stroke_cap);
@@ -248,6 +262,9 @@ class RectGeometry : public Geometry {
   // |Geometry|
   std::optional<Rect> GetCoverage(const Matrix& transform) const override;
 
+  // |Geometry|
+  std::optional<Rect> GetRect() const override;
+
   Rect rect_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(RectGeometry);
@@ -15,10 +15,18 @@ namespace impeller {
 
 InlinePassContext::InlinePassContext(std::shared_ptr<Context> context,
                                      const RenderTarget& render_target,
-                                     uint32_t pass_texture_reads)
+                                     uint32_t pass_texture_reads,
+                                     bool submit_async)
     : context_(std::move(context)),
       render_target_(render_target),
-      total_pass_reads_(pass_texture_reads) {}
+      total_pass_reads_(pass_texture_reads),
+      submit_async_(submit_async) {
+  auto color0 = render_target_.GetColorAttachments().find(0);
+  load_initial_contents_ =
+      color0 != render_target_.GetColorAttachments().end() &&
+      !color0->second.resolve_texture &&
+      color0->second.load_action == LoadAction::kLoad;
+}
 
 InlinePassContext::~InlinePassContext() {
   EndPass();
@@ -44,12 +52,18 @@ bool InlinePassContext::EndPass() {
     return true;
   }
 
-  if (!pass_->EncodeCommands()) {
-    return false;
-  }
+  if (submit_async_) {
+    if (!command_buffer_->SubmitCommandsAsync(std::move(pass_))) {
+      return false;
+    }
+  } else {
+    if (!pass_->EncodeCommands()) {
+      return false;
+    }
 
-  if (!command_buffer_->SubmitCommands()) {
-    return false;
+    if (!command_buffer_->SubmitCommands()) {
+      return false;
+    }
   }
 
   pass_ = nullptr;
@@ -100,7 +114,9 @@ InlinePassContext::RenderPassResult InlinePassContext::GetRenderPass(
         pass_count_ > 0 ? LoadAction::kDontCare : LoadAction::kClear;
     color0.store_action = StoreAction::kMultisampleResolve;
   } else {
-    color0.load_action = LoadAction::kClear;
+    color0.load_action = pass_count_ == 0 && load_initial_contents_
+                             ? LoadAction::kLoad
+                             : LoadAction::kClear;
     color0.store_action = StoreAction::kStore;
   }
 
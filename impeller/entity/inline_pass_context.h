@@ -17,9 +17,14 @@ class InlinePassContext {
     std::shared_ptr<Texture> backdrop_texture;
   };
 
+  /// If `submit_async` is true, ended passes are encoded and submitted via
+  /// `CommandBuffer::SubmitCommandsAsync`. This must only be used for
+  /// offscreen render targets since presentation may happen before the
+  /// commands are committed.
   InlinePassContext(std::shared_ptr<Context> context,
                     const RenderTarget& render_target,
-                    uint32_t pass_texture_reads);
+                    uint32_t pass_texture_reads,
+                    bool submit_async = false);
   ~InlinePassContext();
 
   bool IsValid() const;
@@ -38,6 +43,10 @@ class InlinePassContext {
   std::shared_ptr<RenderPass> pass_;
   uint32_t pass_count_ = 0;
   uint32_t total_pass_reads_ = 0;
+  const bool submit_async_;
+  // Whether the first pass loads the existing contents of the target instead
+  // of clearing them, as asked for by a color attachment that loads.
+  bool load_initial_contents_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(InlinePassContext);
 };
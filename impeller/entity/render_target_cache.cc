@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/render_target_cache.h"
+
+#include <algorithm>
+
+#include "impeller/renderer/texture.h"
+
+namespace impeller {
+
+static bool TextureDescriptorsAreEqual(const TextureDescriptor& a,
+                                       const TextureDescriptor& b) {
+  return a.storage_mode == b.storage_mode &&  //
+         a.type == b.type &&                  //
+         a.format == b.format &&              //
+         a.size == b.size &&                  //
+         a.mip_count == b.mip_count &&        //
+         a.usage == b.usage &&                //
+         a.sample_count == b.sample_count;
+}
+
+RenderTargetCache::RenderTargetCache(std::shared_ptr<Allocator> allocator,
+                                     size_t keep_alive_frame_count)
+    : RenderTargetAllocator(std::move(allocator)),
+      keep_alive_frame_count_(keep_alive_frame_count) {}
+
+RenderTargetCache::~RenderTargetCache() = default;
+
+void RenderTargetCache::Start() {
+  for (auto& td : texture_data_) {
+    td.used_this_frame = false;
+  }
+}
+
+void RenderTargetCache::End() {
+  for (auto& td : texture_data_) {
+    if (td.used_this_frame) {
+      td.unused_frame_count = 0u;
+    } else {
+      td.unused_frame_count++;
+    }
+  }
+  texture_data_.erase(
+      std::remove_if(texture_data_.begin(), texture_data_.end(),
+                     [keep_alive = keep_alive_frame_count_](const auto& td) {
+                       return td.unused_frame_count > keep_alive;
+                     }),
+      texture_data_.end());
+}
+
+std::shared_ptr<Texture> RenderTargetCache::CreateTexture(
+    const TextureDescriptor& desc) {
+  for (auto& td : texture_data_) {
+    if (td.used_this_frame || td.texture.use_count() > 1) {
+      // Either handed out earlier in this frame or still referenced by a
+      // client that outlived its frame (a snapshot for instance).
+      continue;
+    }
+    if (TextureDescriptorsAreEqual(desc, td.texture->GetTextureDescriptor())) {
+      td.used_this_frame = true;
+      hit_count_++;
+      return td.texture;
+    }
+  }
+
+  auto result = RenderTargetAllocator::CreateTexture(desc);
+  if (!result) {
+    return result;
+  }
+  miss_count_++;
+  texture_data_.push_back(
+      TextureData{.used_this_frame = true, .texture = result});
+  return result;
+}
+
+size_t RenderTargetCache::GetCachedTextureCount() const {
+  return texture_data_.size();
+}
+
+size_t RenderTargetCache::GetHitCount() const {
+  return hit_count_;
+}
+
+size_t RenderTargetCache::GetMissCount() const {
+  return miss_count_;
+}
+
+}  // namespace impeller
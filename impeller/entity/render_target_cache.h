@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/renderer/render_target.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A render target allocator that recycles the textures backing
+///             offscreen render targets across frames.
+///
+///             A texture is only handed out once per frame, and only if no
+///             one else holds a reference to it. Textures that go unused for
+///             more than `keep_alive_frame_count` frames are released.
+///
+class RenderTargetCache : public RenderTargetAllocator {
+ public:
+  static constexpr size_t kDefaultKeepAliveFrameCount = 3u;
+
+  explicit RenderTargetCache(
+      std::shared_ptr<Allocator> allocator,
+      size_t keep_alive_frame_count = kDefaultKeepAliveFrameCount);
+
+  ~RenderTargetCache() override;
+
+  // |RenderTargetAllocator|
+  void Start() override;
+
+  // |RenderTargetAllocator|
+  void End() override;
+
+  // |RenderTargetAllocator|
+  std::shared_ptr<Texture> CreateTexture(
+      const TextureDescriptor& desc) override;
+
+  //----------------------------------------------------------------------------
+  /// @return     The number of textures currently retained by the cache.
+  ///
+  size_t GetCachedTextureCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @return     The number of texture requests served from the cache.
+  ///
+  size_t GetHitCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @return     The number of texture requests that needed a new allocation.
+  ///
+  size_t GetMissCount() const;
+
+ private:
+  struct TextureData {
+    bool used_this_frame = false;
+    size_t unused_frame_count = 0u;
+    std::shared_ptr<Texture> texture;
+  };
+
+  const size_t keep_alive_frame_count_;
+  std::vector<TextureData> texture_data_;
+  size_t hit_count_ = 0u;
+  size_t miss_count_ = 0u;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(RenderTargetCache);
+};
+
+}  // namespace impeller
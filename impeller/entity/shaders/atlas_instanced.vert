@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Expands one instance per atlas sprite. The vertices are the corners of a
+// unit square and every sprite is described by three consecutive records:
+//
+// * The RSTransform (scos, ssin, tx, ty) of the sprite.
+// * The rect sampled from the atlas texture (x, y, width, height).
+// * The premultiplied color of the sprite.
+
+#ifdef IMPELLER_TARGET_OPENGLES
+
+void main() {
+  // Instancing is not supported on legacy targets. AtlasContents always
+  // generates the vertices on the CPU there.
+}
+
+#else  // IMPELLER_TARGET_OPENGLES
+
+// Must match kRecordsPerSprite in AtlasContents.
+const int kRecordsPerSprite = 3;
+
+uniform VertInfo {
+  mat4 mvp;
+  vec2 texture_size;
+}
+vert_info;
+
+readonly buffer SpriteInfo {
+  vec4 records[];
+}
+sprite_info;
+
+in vec2 corner;
+
+out vec2 v_texture_coords;
+out vec4 v_color;
+
+void main() {
+  int base = gl_InstanceIndex * kRecordsPerSprite;
+  vec4 transform = sprite_info.records[base];
+  vec4 texture_rect = sprite_info.records[base + 1];
+
+  vec2 local = corner * texture_rect.zw;
+  vec2 position =
+      vec2(transform.x * local.x - transform.y * local.y + transform.z,
+           transform.y * local.x + transform.x * local.y + transform.w);
+  gl_Position = vert_info.mvp * vec4(position, 0.0, 1.0);
+  v_texture_coords = (texture_rect.xy + local) / vert_info.texture_size;
+  v_color = sprite_info.records[base + 2];
+}
+
+#endif  // IMPELLER_TARGET_OPENGLES
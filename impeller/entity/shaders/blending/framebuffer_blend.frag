@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Applies an advanced blend in place. The destination is read from the color
+// attachment that is being rendered to instead of from a copy of it. Only
+// used when the context supports framebuffer fetch.
+
+#include <impeller/blending.glsl>
+#include <impeller/color.glsl>
+#include <impeller/texture.glsl>
+
+// These must match the values of |BlendMode|.
+const int kBlendModeScreen = 14;
+const int kBlendModeOverlay = 15;
+const int kBlendModeDarken = 16;
+const int kBlendModeLighten = 17;
+const int kBlendModeColorDodge = 18;
+const int kBlendModeColorBurn = 19;
+const int kBlendModeHardLight = 20;
+const int kBlendModeSoftLight = 21;
+const int kBlendModeDifference = 22;
+const int kBlendModeExclusion = 23;
+const int kBlendModeMultiply = 24;
+const int kBlendModeHue = 25;
+const int kBlendModeSaturation = 26;
+const int kBlendModeColor = 27;
+
+uniform FragInfo {
+  float src_y_coord_scale;
+  float src_input_alpha;
+  float blend_mode;
+}
+frag_info;
+
+uniform sampler2D texture_sampler_src;
+
+layout(input_attachment_index = 0) uniform subpassInput framebuffer_dst;
+
+in vec2 v_texture_coords;
+
+out vec4 frag_color;
+
+vec3 Blend(vec3 dst, vec3 src, int blend_mode) {
+  if (blend_mode == kBlendModeScreen) {
+    return IPBlendScreen(dst, src);
+  }
+  if (blend_mode == kBlendModeOverlay) {
+    return IPBlendOverlay(dst, src);
+  }
+  if (blend_mode == kBlendModeDarken) {
+    return IPBlendDarken(dst, src);
+  }
+  if (blend_mode == kBlendModeLighten) {
+    return IPBlendLighten(dst, src);
+  }
+  if (blend_mode == kBlendModeColorDodge) {
+    return IPBlendColorDodge(dst, src);
+  }
+  if (blend_mode == kBlendModeColorBurn) {
+    return IPBlendColorBurn(dst, src);
+  }
+  if (blend_mode == kBlendModeHardLight) {
+    return IPBlendHardLight(dst, src);
+  }
+  if (blend_mode == kBlendModeSoftLight) {
+    return IPBlendSoftLight(dst, src);
+  }
+  if (blend_mode == kBlendModeDifference) {
+    return IPBlendDifference(dst, src);
+  }
+  if (blend_mode == kBlendModeExclusion) {
+    return IPBlendExclusion(dst, src);
+  }
+  if (blend_mode == kBlendModeMultiply) {
+    return IPBlendMultiply(dst, src);
+  }
+  if (blend_mode == kBlendModeHue) {
+    return IPBlendHue(dst, src);
+  }
+  if (blend_mode == kBlendModeSaturation) {
+    return IPBlendSaturation(dst, src);
+  }
+  if (blend_mode == kBlendModeColor) {
+    return IPBlendColor(dst, src);
+  }
+  return IPBlendLuminosity(dst, src);
+}
+
+void main() {
+  vec4 dst_sample = subpassLoad(framebuffer_dst);
+  vec4 dst = IPUnpremultiply(dst_sample);
+  vec4 src = IPUnpremultiply(
+      IPSampleWithTileMode(texture_sampler_src,           // sampler
+                           v_texture_coords,              // texture coordinates
+                           frag_info.src_y_coord_scale,   // y coordinate scale
+                           kTileModeDecal                 // tile mode
+                           ) *
+      frag_info.src_input_alpha);
+
+  vec4 blended =
+      vec4(Blend(dst.rgb, src.rgb, int(frag_info.blend_mode)), 1) * dst.a;
+
+  frag_color = mix(dst_sample, blended, src.a);
+}
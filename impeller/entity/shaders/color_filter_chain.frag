@@ -0,0 +1,88 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <impeller/color.glsl>
+#include <impeller/texture.glsl>
+
+// Applies a chain of up to four per-pixel color filters in a single pass.
+//
+// Each stage matches the color_matrix_color_filter, linear_to_srgb_filter or
+// srgb_to_linear_filter shader it replaces, including the unpremultiply and
+// premultiply around the transform, so the fused result is the same as
+// rendering the stages one after another.
+//
+// Stage types:
+//   0: 4x5 color matrix (clamped).
+//   1: Linear to sRGB gamma curve.
+//   2: sRGB to linear gamma curve.
+
+uniform FragInfo {
+  mat4 color_m0;
+  mat4 color_m1;
+  mat4 color_m2;
+  mat4 color_m3;
+  vec4 color_v0;
+  vec4 color_v1;
+  vec4 color_v2;
+  vec4 color_v3;
+  vec4 stage_types;
+  vec4 stage_input_alphas;
+  float texture_sampler_y_coord_scale;
+  float stage_count;
+} frag_info;
+
+uniform sampler2D input_texture;
+
+in vec2 v_position;
+out vec4 frag_color;
+
+vec4 ApplyStage(vec4 input_color,
+                float type,
+                mat4 color_m,
+                vec4 color_v,
+                float input_alpha) {
+  vec4 color = IPUnpremultiply(input_color * input_alpha);
+  if (type < 0.5) {
+    color = clamp(color_m * color + color_v, 0.0, 1.0);
+  } else if (type < 1.5) {
+    for (int i = 0; i < 3; i++) {
+      if (color[i] <= 0.0031308) {
+        color[i] = (color[i]) * 12.92;
+      } else {
+        color[i] = 1.055 * pow(color[i], (1.0 / 2.4)) - 0.055;
+      }
+    }
+  } else {
+    for (int i = 0; i < 3; i++) {
+      if (color[i] <= 0.04045) {
+        color[i] = color[i] / 12.92;
+      } else {
+        color[i] = pow((color[i] + 0.055) / 1.055, 2.4);
+      }
+    }
+  }
+  return IPPremultiply(color);
+}
+
+void main() {
+  vec4 color = IPSample(input_texture, v_position,
+                        frag_info.texture_sampler_y_coord_scale);
+
+  color = ApplyStage(color, frag_info.stage_types.x, frag_info.color_m0,
+                     frag_info.color_v0, frag_info.stage_input_alphas.x);
+  if (frag_info.stage_count > 1.5) {
+    color = ApplyStage(color, frag_info.stage_types.y, frag_info.color_m1,
+                       frag_info.color_v1, frag_info.stage_input_alphas.y);
+  }
+  if (frag_info.stage_count > 2.5) {
+    color = ApplyStage(color, frag_info.stage_types.z, frag_info.color_m2,
+                       frag_info.color_v2, frag_info.stage_input_alphas.z);
+  }
+  if (frag_info.stage_count > 3.5) {
+    color = ApplyStage(color, frag_info.stage_types.w, frag_info.color_m3,
+                       frag_info.color_v3, frag_info.stage_input_alphas.w);
+  }
+
+  frag_color = color;
+}
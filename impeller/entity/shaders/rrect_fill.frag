@@ -0,0 +1,46 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <impeller/constants.glsl>
+
+uniform FragInfo {
+  vec4 color;
+  vec2 rect_size;
+  vec2 corner_radii;
+}
+frag_info;
+
+in vec2 v_position;
+
+out vec4 frag_color;
+
+/// Approximates the signed distance to a rounded rect with elliptical corners
+/// by dividing the implicit function of the corner ellipse by the length of
+/// its gradient. The approximation is exact for circular corners.
+float RRectDistance(vec2 sample_position, vec2 half_size) {
+  vec2 radii = max(frag_info.corner_radii, vec2(0.001));
+  vec2 corner = abs(sample_position) - half_size + radii;
+  if (corner.x <= 0.0 || corner.y <= 0.0) {
+    // Outside of the corners, the nearest edge is axis aligned.
+    vec2 edge = abs(sample_position) - half_size;
+    return max(edge.x, edge.y);
+  }
+  vec2 unit = corner / radii;
+  float unit_length = length(unit);
+  vec2 gradient = unit / (radii * unit_length);
+  return (unit_length - 1.0) / length(gradient);
+}
+
+void main() {
+  vec2 half_size = frag_info.rect_size * 0.5;
+  float signed_distance = RRectDistance(v_position - half_size, half_size);
+
+  // Converts the local distance to pixels so that the edge is smoothed over
+  // one pixel at any scale.
+  float pixel_size =
+      max(length(vec2(dFdx(signed_distance), dFdy(signed_distance))),
+          kEhCloseEnough);
+  float coverage = clamp(0.5 - signed_distance / pixel_size, 0.0, 1.0);
+  frag_color = frag_info.color * coverage;
+}
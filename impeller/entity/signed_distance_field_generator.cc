@@ -0,0 +1,178 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/signed_distance_field_generator.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/allocation.h"
+#include "impeller/entity/sdf_jump_flood.comp.h"
+#include "impeller/renderer/allocator.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/compute_command.h"
+#include "impeller/renderer/compute_pass.h"
+#include "impeller/renderer/compute_pipeline_builder.h"
+#include "impeller/renderer/device_buffer.h"
+#include "impeller/renderer/pipeline_library.h"
+
+namespace impeller {
+
+using CS = SdfJumpFloodComputeShader;
+
+// These must match the phases in sdf_jump_flood.comp.
+static constexpr uint32_t kPhaseSeed = 0u;
+static constexpr uint32_t kPhaseFlood = 1u;
+static constexpr uint32_t kPhaseResolve = 2u;
+
+// This must match the local size declared in sdf_jump_flood.comp.
+static constexpr ISize kThreadGroupSize(16, 16);
+
+SignedDistanceFieldGenerator::SignedDistanceFieldGenerator(
+    std::shared_ptr<Context> context)
+    : context_(std::move(context)) {
+  if (!context_ || !context_->IsValid() || !context_->SupportsCompute()) {
+    return;
+  }
+  auto pipeline_desc =
+      ComputePipelineBuilder<CS>::MakeDefaultPipelineDescriptor(*context_);
+  if (!pipeline_desc.has_value()) {
+    return;
+  }
+  pipeline_ = context_->GetPipelineLibrary()->GetPipeline(pipeline_desc).Get();
+}
+
+SignedDistanceFieldGenerator::~SignedDistanceFieldGenerator() = default;
+
+bool SignedDistanceFieldGenerator::IsValid() const {
+  return pipeline_ && pipeline_->IsValid();
+}
+
+static bool EncodePhase(
+    CommandBuffer& cmd_buffer,
+    const std::shared_ptr<Pipeline<ComputePipelineDescriptor>>& pipeline,
+    ISize size,
+    uint32_t phase,
+    uint32_t step_size,
+    const DeviceBuffer& input,
+    const DeviceBuffer& seeds_in,
+    const DeviceBuffer& seeds_out,
+    const DeviceBuffer& output) {
+  auto pass = cmd_buffer.CreateComputePass();
+  if (!pass || !pass->IsValid()) {
+    return false;
+  }
+  pass->SetLabel("SDF Jump Flood");
+  pass->SetGridSize(kThreadGroupSize);
+  pass->SetThreadGroupSize(kThreadGroupSize);
+
+  ComputeCommand cmd;
+  cmd.label = "SDF Jump Flood";
+  cmd.pipeline = pipeline;
+
+  CS::Info info;
+  info.width = size.width;
+  info.height = size.height;
+  info.phase = phase;
+  info.step_size = step_size;
+  CS::BindInfo(cmd, pass->GetTransientsBuffer().EmplaceUniform(info));
+  CS::BindInputPixels(cmd, input.AsBufferView());
+  CS::BindSeedsIn(cmd, seeds_in.AsBufferView());
+  CS::BindSeedsOut(cmd, seeds_out.AsBufferView());
+  CS::BindOutputPixels(cmd, output.AsBufferView());
+
+  return pass->AddCommand(std::move(cmd)) && pass->EncodeCommands();
+}
+
+bool SignedDistanceFieldGenerator::Generate(uint8_t* pixels,
+                                            ISize size) const {
+  TRACE_EVENT0("impeller", "SignedDistanceFieldGenerator::Generate");
+  if (!IsValid() || !pixels || size.IsEmpty()) {
+    return false;
+  }
+
+  // Seeds pack each coordinate into 16 bits and pixels are processed four at
+  // a time.
+  if (size.width > std::numeric_limits<uint16_t>::max() ||
+      size.height > std::numeric_limits<uint16_t>::max()) {
+    return false;
+  }
+  const size_t pixel_count = size.Area();
+  if (pixel_count % 4u != 0u) {
+    return false;
+  }
+
+  auto allocator = context_->GetResourceAllocator();
+  auto input = allocator->CreateBufferWithCopy(pixels, pixel_count);
+
+  DeviceBufferDescriptor seeds_desc;
+  seeds_desc.storage_mode = StorageMode::kDevicePrivate;
+  seeds_desc.size = pixel_count * sizeof(uint32_t);
+  std::array<std::shared_ptr<DeviceBuffer>, 2> seeds = {
+      allocator->CreateBuffer(seeds_desc),
+      allocator->CreateBuffer(seeds_desc),
+  };
+
+  DeviceBufferDescriptor output_desc;
+  output_desc.storage_mode = StorageMode::kHostVisible;
+  output_desc.size = pixel_count;
+  auto output = allocator->CreateBuffer(output_desc);
+
+  if (!input || !seeds[0] || !seeds[1] || !output) {
+    return false;
+  }
+
+  auto cmd_buffer = context_->CreateCommandBuffer();
+  if (!cmd_buffer) {
+    return false;
+  }
+  cmd_buffer->SetLabel("SDF Jump Flood");
+
+  // The index of the seeds buffer the next phase reads from.
+  size_t current = 0u;
+  if (!EncodePhase(*cmd_buffer, pipeline_, size, kPhaseSeed, 0u, *input,
+                   *seeds[current], *seeds[1u - current], *output)) {
+    return false;
+  }
+  current = 1u - current;
+
+  const uint32_t max_dimension = std::max(size.width, size.height);
+  for (uint32_t step_size = Allocation::NextPowerOfTwoSize(max_dimension) / 2u;
+       step_size > 0u; step_size /= 2u) {
+    if (!EncodePhase(*cmd_buffer, pipeline_, size, kPhaseFlood, step_size,
+                     *input, *seeds[current], *seeds[1u - current], *output)) {
+      return false;
+    }
+    current = 1u - current;
+  }
+
+  if (!EncodePhase(*cmd_buffer, pipeline_, size, kPhaseResolve, 0u, *input,
+                   *seeds[current], *seeds[1u - current], *output)) {
+    return false;
+  }
+
+  fml::AutoResetWaitableEvent latch;
+  bool completed = false;
+  if (!cmd_buffer->SubmitCommands(
+          [&latch, &completed](CommandBuffer::Status status) {
+            completed = status == CommandBuffer::Status::kCompleted;
+            latch.Signal();
+          })) {
+    return false;
+  }
+  latch.Wait();
+
+  if (!completed) {
+    return false;
+  }
+
+  ::memcpy(pixels, output->AsBufferView().contents, pixel_count);
+  return true;
+}
+
+}  // namespace impeller
@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+
+#include "flutter/fml/macros.h"
+#include "impeller/geometry/size.h"
+#include "impeller/renderer/compute_pipeline_descriptor.h"
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/pipeline.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Converts 8-bit grayscale glyph atlas bitmaps into signed
+///             distance fields using a jump flood on the GPU.
+///
+///             The generator is only valid on contexts that support compute.
+///
+class SignedDistanceFieldGenerator {
+ public:
+  explicit SignedDistanceFieldGenerator(std::shared_ptr<Context> context);
+
+  ~SignedDistanceFieldGenerator();
+
+  bool IsValid() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Replace the contents of a tightly packed 8-bit grayscale
+  ///             bitmap with its signed distance field. Values greater than
+  ///             127 are considered inside the glyphs.
+  ///
+  ///             This blocks until the GPU has finished.
+  ///
+  /// @param      pixels  The pixels of the bitmap.
+  /// @param[in]  size    The size of the bitmap.
+  ///
+  /// @return     If the distance field was written back to `pixels`. On
+  ///             failure, the pixels are left untouched.
+  ///
+  [[nodiscard]] bool Generate(uint8_t* pixels, ISize size) const;
+
+ private:
+  std::shared_ptr<Context> context_;
+  std::shared_ptr<Pipeline<ComputePipelineDescriptor>> pipeline_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(SignedDistanceFieldGenerator);
+};
+
+}  // namespace impeller
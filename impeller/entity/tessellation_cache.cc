@@ -0,0 +1,165 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/tessellation_cache.h"
+
+#include <cmath>
+
+#include "impeller/renderer/device_buffer.h"
+#include "impeller/tessellator/tessellator.h"
+
+namespace impeller {
+
+TessellationCache::TessellationCache(size_t max_bytes)
+    : max_bytes_(max_bytes) {}
+
+TessellationCache::~TessellationCache() = default;
+
+int TessellationCache::GetScaleBucket(Scalar scale) {
+  return static_cast<int>(std::ceil(std::log2(scale) * 2.0f));
+}
+
+Scalar TessellationCache::GetBucketMaxScale(int scale_bucket) {
+  return std::exp2(scale_bucket * 0.5f);
+}
+
+std::optional<VertexBuffer> TessellationCache::GetOrCreate(
+    const Path& path,
+    const Tessellator& tessellator,
+    Allocator& allocator) {
+  auto cache_key = path.GetCacheKey();
+  if (!cache_key.has_value()) {
+    return std::nullopt;
+  }
+
+  Key key{.cache_key = cache_key.value(), .fill_type = path.GetFillType()};
+  if (auto found = Find(key)) {
+    return found;
+  }
+  miss_count_++;
+
+  std::shared_ptr<DeviceBuffer> buffer;
+  size_t vertex_bytes = 0u;
+  size_t index_bytes = 0u;
+  size_t index_count = 0u;
+  auto result = tessellator.Tessellate(
+      path.GetFillType(), path.CreatePolyline(),
+      [&](const float* vertices, size_t vertices_count,
+          const uint16_t* indices, size_t indices_count) {
+        vertex_bytes = vertices_count * sizeof(float);
+        index_bytes = indices_count * sizeof(uint16_t);
+        index_count = indices_count;
+
+        DeviceBufferDescriptor buffer_desc;
+        buffer_desc.size = vertex_bytes + index_bytes;
+        buffer_desc.storage_mode = StorageMode::kHostVisible;
+        buffer = allocator.CreateBuffer(buffer_desc);
+        if (!buffer) {
+          return false;
+        }
+        if (!buffer->CopyHostBuffer(
+                reinterpret_cast<const uint8_t*>(vertices),
+                Range{0, vertex_bytes}, 0)) {
+          return false;
+        }
+        if (!buffer->CopyHostBuffer(reinterpret_cast<const uint8_t*>(indices),
+                                    Range{0, index_bytes}, vertex_bytes)) {
+          return false;
+        }
+        return true;
+      });
+  if (result != Tessellator::Result::kSuccess || !buffer) {
+    return std::nullopt;
+  }
+
+  VertexBuffer vertex_buffer = {
+      .vertex_buffer = {.buffer = buffer, .range = Range{0, vertex_bytes}},
+      .index_buffer = {.buffer = buffer,
+                       .range = Range{vertex_bytes, index_bytes}},
+      .index_count = index_count,
+      .index_type = IndexType::k16bit,
+  };
+
+  Retain(key, vertex_buffer, vertex_bytes + index_bytes);
+  return vertex_buffer;
+}
+
+std::optional<VertexBuffer> TessellationCache::GetOrCreateStroke(
+    const Path& path,
+    const StrokeParameters& stroke,
+    const StrokeVerticesCallback& create_vertices) {
+  auto cache_key = path.GetCacheKey();
+  if (!cache_key.has_value()) {
+    return std::nullopt;
+  }
+
+  Key key{.cache_key = cache_key.value(),
+          .fill_type = FillType::kNonZero,
+          .stroke = stroke};
+  if (auto found = Find(key)) {
+    return found;
+  }
+  miss_count_++;
+
+  auto vertex_buffer = create_vertices();
+  if (!vertex_buffer.vertex_buffer.buffer) {
+    return std::nullopt;
+  }
+  Retain(key, vertex_buffer,
+         vertex_buffer.vertex_buffer.range.length +
+             vertex_buffer.index_buffer.range.length);
+  return vertex_buffer;
+}
+
+std::optional<VertexBuffer> TessellationCache::Find(const Key& key) {
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    return std::nullopt;
+  }
+  // Move the entry to the front of the recently used list.
+  entries_.splice(entries_.begin(), entries_, found->second);
+  hit_count_++;
+  return found->second->vertex_buffer;
+}
+
+void TessellationCache::Retain(const Key& key,
+                               const VertexBuffer& vertex_buffer,
+                               size_t byte_size) {
+  if (byte_size > max_bytes_) {
+    // Too large to retain. Still usable for this frame.
+    return;
+  }
+  EvictToFit(byte_size);
+  entries_.push_front(Entry{
+      .key = key, .vertex_buffer = vertex_buffer, .byte_size = byte_size});
+  index_[key] = entries_.begin();
+  byte_size_ += byte_size;
+}
+
+void TessellationCache::EvictToFit(size_t byte_size) {
+  while (!entries_.empty() && byte_size_ + byte_size > max_bytes_) {
+    const auto& entry = entries_.back();
+    byte_size_ -= entry.byte_size;
+    index_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
+
+size_t TessellationCache::GetByteSize() const {
+  return byte_size_;
+}
+
+size_t TessellationCache::GetEntryCount() const {
+  return entries_.size();
+}
+
+size_t TessellationCache::GetHitCount() const {
+  return hit_count_;
+}
+
+size_t TessellationCache::GetMissCount() const {
+  return miss_count_;
+}
+
+}  // namespace impeller
@@ -0,0 +1,169 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/macros.h"
+#include "impeller/geometry/path.h"
+#include "impeller/renderer/allocator.h"
+#include "impeller/renderer/vertex_buffer.h"
+
+namespace impeller {
+
+class Tessellator;
+enum class Cap;
+enum class Join;
+
+//------------------------------------------------------------------------------
+/// @brief      Retains the tessellated vertices and indices of fill paths, and
+///             the vertices of stroked paths, that have a cache key in device
+///             buffers, so that static paths don't need to be tessellated on
+///             every frame.
+///
+///             The cache is bounded by the total byte size of the retained
+///             buffers. Least recently used entries are evicted first.
+///
+class TessellationCache {
+ public:
+  static constexpr size_t kDefaultMaxBytes = 4u * 1024u * 1024u;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The stroke that the retained vertices of a path were
+  ///             generated for.
+  ///
+  struct StrokeParameters {
+    Scalar width = 0.0f;
+    Scalar miter_limit = 0.0f;
+    Cap cap;
+    Join join;
+    /// The range of transform scales that the vertices were tessellated
+    /// for, as returned by |GetScaleBucket|. The vertices are in the local
+    /// space of the path, so they can be reused by any transform with a scale
+    /// in the range.
+    int scale_bucket = 0;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the bucket of a transform scale. Buckets are half an
+  ///             octave wide.
+  ///
+  static int GetScaleBucket(Scalar scale);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The largest scale in the bucket, which is the one to
+  ///             tessellate its vertices for so that curves are smooth at
+  ///             every scale in it.
+  ///
+  static Scalar GetBucketMaxScale(int scale_bucket);
+
+  using StrokeVerticesCallback = std::function<VertexBuffer()>;
+
+  explicit TessellationCache(size_t max_bytes = kDefaultMaxBytes);
+
+  ~TessellationCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the retained vertex buffer for the path, tessellating the
+  ///             path and retaining the result on a miss.
+  ///
+  /// @return     The vertex buffer, or std::nullopt if the path doesn't have a
+  ///             cache key or could not be tessellated.
+  ///
+  std::optional<VertexBuffer> GetOrCreate(const Path& path,
+                                          const Tessellator& tessellator,
+                                          Allocator& allocator);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the retained vertex buffer for the stroke of the path,
+  ///             retaining the vertices created by `create_vertices` on a
+  ///             miss. Their buffers must be device buffers.
+  ///
+  /// @return     The vertex buffer, or std::nullopt if the path doesn't have a
+  ///             cache key or no vertices could be created.
+  ///
+  std::optional<VertexBuffer> GetOrCreateStroke(
+      const Path& path,
+      const StrokeParameters& stroke,
+      const StrokeVerticesCallback& create_vertices);
+
+  size_t GetByteSize() const;
+
+  size_t GetEntryCount() const;
+
+  size_t GetHitCount() const;
+
+  size_t GetMissCount() const;
+
+ private:
+  struct Key {
+    uint64_t cache_key;
+    FillType fill_type;
+    // Only set for strokes, whose vertices don't depend on the fill type.
+    std::optional<StrokeParameters> stroke;
+
+    struct Hash {
+      std::size_t operator()(const Key& key) const {
+        if (!key.stroke.has_value()) {
+          return fml::HashCombine(key.cache_key,
+                                  static_cast<int>(key.fill_type));
+        }
+        const auto& stroke = key.stroke.value();
+        return fml::HashCombine(key.cache_key, stroke.width, stroke.miter_limit,
+                                static_cast<int>(stroke.cap),
+                                static_cast<int>(stroke.join),
+                                stroke.scale_bucket);
+      }
+    };
+
+    struct Equal {
+      bool operator()(const Key& lhs, const Key& rhs) const {
+        if (lhs.cache_key != rhs.cache_key ||
+            lhs.stroke.has_value() != rhs.stroke.has_value()) {
+          return false;
+        }
+        if (!lhs.stroke.has_value()) {
+          return lhs.fill_type == rhs.fill_type;
+        }
+        return lhs.stroke->width == rhs.stroke->width &&
+               lhs.stroke->miter_limit == rhs.stroke->miter_limit &&
+               lhs.stroke->cap == rhs.stroke->cap &&
+               lhs.stroke->join == rhs.stroke->join &&
+               lhs.stroke->scale_bucket == rhs.stroke->scale_bucket;
+      }
+    };
+  };
+
+  struct Entry {
+    Key key;
+    VertexBuffer vertex_buffer;
+    size_t byte_size = 0u;
+  };
+
+  const size_t max_bytes_;
+  size_t byte_size_ = 0u;
+  size_t hit_count_ = 0u;
+  size_t miss_count_ = 0u;
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, Key::Hash, Key::Equal>
+      index_;
+
+  std::optional<VertexBuffer> Find(const Key& key);
+
+  void Retain(const Key& key,
+              const VertexBuffer& vertex_buffer,
+              size_t byte_size);
+
+  void EvictToFit(size_t byte_size);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TessellationCache);
+};
+
+}  // namespace impeller
@@ -4,18 +4,50 @@
 
 #include "flutter/benchmarking/benchmarking.h"
 
+#include <cmath>
+#include <vector>
+
+#include "impeller/entity/geometry.h"
+#include "impeller/geometry/constants.h"
+#include "impeller/geometry/matrix.h"
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/path_builder.h"
+#include "impeller/geometry/rect.h"
+#include "impeller/renderer/host_buffer.h"
 #include "impeller/tessellator/tessellator.h"
 
 namespace impeller {
 
+class ImpellerBenchmarkAccessor {
+ public:
+  static VertexBuffer GenerateSolidStrokeVertices(const Path& path,
+                                                  HostBuffer& buffer,
+                                                  Scalar stroke_width,
+                                                  Scalar miter_limit,
+                                                  Cap stroke_cap,
+                                                  Join stroke_join) {
+    return StrokePathGeometry::CreateSolidStrokeVertices(
+        path.CreatePolyline(), buffer, stroke_width, miter_limit,
+        StrokePathGeometry::GetJoinProc(stroke_join),
+        StrokePathGeometry::GetCapProc(stroke_cap), kDefaultCurveTolerance);
+  }
+};
+
 namespace {
 /// A path with many connected cubic components, including
 /// overlaps/self-intersections/multi-contour.
 Path CreateCubic();
 /// Similar to the path above, but with all cubics replaced by quadratics.
 Path CreateQuadratic();
+/// Convex single contour paths, which are fanned without triangulation.
+Path CreateRect();
+Path CreateRRect();
+Path CreateCircle();
+/// Material icons of increasing complexity, scaled to 3x their 24dp size.
+Path CreateCheckIcon();
+Path CreateFavoriteIcon();
+Path CreateSettingsIcon();
+std::vector<Path> CreateIconCorpus();
 }  // namespace
 
 static Tessellator tess;
@@ -43,10 +75,153 @@ static void BM_Polyline(benchmark::State& state, Args&&... args) {
   state.counters["TotalPointCount"] = point_count;
 }
 
+static void BM_PolylineIconCorpus(benchmark::State& state) {
+  auto paths = CreateIconCorpus();
+  size_t point_count = 0u;
+  // Reuse the polyline across paths the way a raster thread flattening many
+  // icons would.
+  Path::Polyline polyline;
+  while (state.KeepRunning()) {
+    for (const auto& path : paths) {
+      path.CreatePolyline(polyline);
+      point_count += polyline.points.size();
+      tess.Tessellate(
+          FillType::kNonZero, polyline,
+          [](const float* vertices, size_t vertices_size,
+             const uint16_t* indices, size_t indices_size) { return true; });
+    }
+  }
+  state.counters["PathCount"] = paths.size();
+  state.counters["TotalPointCount"] = point_count;
+}
+
+template <class... Args>
+static void BM_StrokePolyline(benchmark::State& state, Args&&... args) {
+  auto args_tuple = std::make_tuple(std::move(args)...);
+  auto path = std::get<Path>(args_tuple);
+  auto cap = std::get<Cap>(args_tuple);
+  auto join = std::get<Join>(args_tuple);
+
+  const Scalar stroke_width = 5.0f;
+  const Scalar miter_limit = 10.0f;
+  auto buffer = HostBuffer::Create();
+
+  size_t index_count = 0u;
+  size_t single_index_count = 0u;
+  while (state.KeepRunning()) {
+    auto vertex_buffer = ImpellerBenchmarkAccessor::GenerateSolidStrokeVertices(
+        path, *buffer, stroke_width, miter_limit, cap, join);
+    single_index_count = vertex_buffer.index_count;
+    index_count += single_index_count;
+    buffer->Reset();
+  }
+  state.counters["SingleIndexCount"] = single_index_count;
+  state.counters["TotalIndexCount"] = index_count;
+}
+
+static void BM_MatrixMultiply(benchmark::State& state) {
+  auto a = Matrix::MakeTranslation({10, 20, 0}) *
+           Matrix::MakeRotationZ(Radians{0.5f}) * Matrix::MakeScale({2, 3, 1});
+  auto b = Matrix::MakePerspective(Radians{1.0f}, 1.5f, 0.1f, 100.0f);
+  for (auto _ : state) {
+    a = a * b;
+    benchmark::DoNotOptimize(a);
+  }
+}
+
+static void BM_MatrixInvert(benchmark::State& state) {
+  auto m = Matrix::MakeTranslation({10, 20, 0}) *
+           Matrix::MakeRotationZ(Radians{0.5f}) * Matrix::MakeScale({2, 3, 1});
+  for (auto _ : state) {
+    auto inverse = m.Invert();
+    benchmark::DoNotOptimize(inverse);
+  }
+}
+
+static void BM_MatrixTransformPoints(benchmark::State& state) {
+  auto m = Matrix::MakeTranslation({10, 20, 0}) *
+           Matrix::MakeRotationZ(Radians{0.5f}) * Matrix::MakeScale({2, 3, 1});
+  std::vector<Point> points(1024);
+  for (size_t i = 0; i < points.size(); i++) {
+    points[i] = Point(i, i * 2);
+  }
+  for (auto _ : state) {
+    for (auto& point : points) {
+      point = m * point;
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+  state.SetItemsProcessed(state.iterations() * points.size());
+}
+
+static void BM_RectTransformBounds(benchmark::State& state) {
+  auto m = Matrix::MakeTranslation({10, 20, 0}) *
+           Matrix::MakeRotationZ(Radians{0.5f}) * Matrix::MakeScale({2, 3, 1});
+  auto rect = Rect::MakeXYWH(10, 10, 300, 200);
+  for (auto _ : state) {
+    auto bounds = rect.TransformBounds(m);
+    benchmark::DoNotOptimize(bounds);
+  }
+}
+
 BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline, CreateCubic(), false);
 BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline_tess, CreateCubic(), true);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline, CreateQuadratic(), false);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline_tess, CreateQuadratic(), true);
+BENCHMARK_CAPTURE(BM_Polyline, rect_polyline, CreateRect(), false);
+BENCHMARK_CAPTURE(BM_Polyline, rect_polyline_tess, CreateRect(), true);
+BENCHMARK_CAPTURE(BM_Polyline, rrect_polyline, CreateRRect(), false);
+BENCHMARK_CAPTURE(BM_Polyline, rrect_polyline_tess, CreateRRect(), true);
+BENCHMARK_CAPTURE(BM_Polyline, circle_polyline, CreateCircle(), false);
+BENCHMARK_CAPTURE(BM_Polyline, circle_polyline_tess, CreateCircle(), true);
+BENCHMARK_CAPTURE(BM_Polyline, check_icon_polyline, CreateCheckIcon(), false);
+BENCHMARK_CAPTURE(BM_Polyline,
+                  check_icon_polyline_tess,
+                  CreateCheckIcon(),
+                  true);
+BENCHMARK_CAPTURE(BM_Polyline,
+                  favorite_icon_polyline,
+                  CreateFavoriteIcon(),
+                  false);
+BENCHMARK_CAPTURE(BM_Polyline,
+                  favorite_icon_polyline_tess,
+                  CreateFavoriteIcon(),
+                  true);
+BENCHMARK_CAPTURE(BM_Polyline,
+                  settings_icon_polyline,
+                  CreateSettingsIcon(),
+                  false);
+BENCHMARK_CAPTURE(BM_Polyline,
+                  settings_icon_polyline_tess,
+                  CreateSettingsIcon(),
+                  true);
+BENCHMARK(BM_PolylineIconCorpus);
+
+BENCHMARK_CAPTURE(BM_StrokePolyline,
+                  cubic_stroke_butt_miter,
+                  CreateCubic(),
+                  Cap::kButt,
+                  Join::kMiter);
+BENCHMARK_CAPTURE(BM_StrokePolyline,
+                  cubic_stroke_round_round,
+                  CreateCubic(),
+                  Cap::kRound,
+                  Join::kRound);
+BENCHMARK_CAPTURE(BM_StrokePolyline,
+                  quad_stroke_square_bevel,
+                  CreateQuadratic(),
+                  Cap::kSquare,
+                  Join::kBevel);
+BENCHMARK_CAPTURE(BM_StrokePolyline,
+                  rrect_stroke_butt_round,
+                  CreateRRect(),
+                  Cap::kButt,
+                  Join::kRound);
+
+BENCHMARK(BM_MatrixMultiply);
+BENCHMARK(BM_MatrixInvert);
+BENCHMARK(BM_MatrixTransformPoints);
+BENCHMARK(BM_RectTransformBounds);
 
 namespace {
 Path CreateCubic() {
@@ -312,5 +487,89 @@ Path CreateQuadratic() {
       .TakePath();
 }
 
+Path CreateRect() {
+  return PathBuilder{}.AddRect(Rect::MakeXYWH(10, 10, 300, 200)).TakePath();
+}
+
+Path CreateRRect() {
+  return PathBuilder{}
+      .AddRoundedRect(Rect::MakeXYWH(10, 10, 300, 200), 24)
+      .TakePath();
+}
+
+Path CreateCircle() {
+  return PathBuilder{}.AddCircle({160, 160}, 150).TakePath();
+}
+
+// M9 16.17L4.83 12l-1.42 1.41L9 19 21 7l-1.41-1.41z
+Path CreateCheckIcon() {
+  return PathBuilder{}
+      .MoveTo({27, 48.51})
+      .LineTo({14.49, 36})
+      .LineTo({10.23, 40.23})
+      .LineTo({27, 57})
+      .LineTo({63, 21})
+      .LineTo({58.77, 16.77})
+      .Close()
+      .TakePath();
+}
+
+// M12 21.35l-1.45-1.32C5.4 15.36 2 12.28 2 8.5 2 5.42 4.42 3 7.5 3c1.74 0
+// 3.41.81 4.5 2.09C13.09 3.81 14.76 3 16.5 3 19.58 3 22 5.42 22 8.5c0
+// 3.78-3.4 6.86-8.55 11.54L12 21.35z
+Path CreateFavoriteIcon() {
+  return PathBuilder{}
+      .MoveTo({36, 64.05})
+      .LineTo({31.65, 60.09})
+      .CubicCurveTo({16.2, 46.08}, {6, 36.84}, {6, 25.5})
+      .CubicCurveTo({6, 16.26}, {13.26, 9}, {22.5, 9})
+      .CubicCurveTo({27.72, 9}, {32.73, 11.43}, {36, 15.27})
+      .CubicCurveTo({39.27, 11.43}, {44.28, 9}, {49.5, 9})
+      .CubicCurveTo({58.74, 9}, {66, 16.26}, {66, 25.5})
+      .CubicCurveTo({66, 36.84}, {55.8, 46.08}, {40.35, 60.12})
+      .LineTo({36, 64.05})
+      .Close()
+      .TakePath();
+}
+
+// A gear with eight teeth and a round hole, in the spirit of the Material
+// settings icon.
+Path CreateSettingsIcon() {
+  const Point center = {36, 36};
+  const Scalar outer_radius = 30;
+  const Scalar inner_radius = 24;
+  const size_t tooth_count = 8u;
+  const Scalar step = kPi * 2 / tooth_count / 4;
+  auto at = [&center](Scalar angle, Scalar radius) {
+    return center + Point(std::cos(angle), std::sin(angle)) * radius;
+  };
+
+  PathBuilder builder;
+  for (size_t i = 0; i < tooth_count; i++) {
+    const Scalar start = kPi * 2 * i / tooth_count;
+    if (i == 0) {
+      builder.MoveTo(at(start, inner_radius));
+    } else {
+      builder.QuadraticCurveTo(at(start - step / 2, inner_radius * 1.05),
+                               at(start, inner_radius));
+    }
+    builder.LineTo(at(start + step, outer_radius));
+    builder.QuadraticCurveTo(at(start + step * 1.5, outer_radius * 1.05),
+                             at(start + step * 2, outer_radius));
+    builder.LineTo(at(start + step * 3, inner_radius));
+  }
+  builder.Close();
+  builder.AddCircle(center, 10.5);
+  return builder.TakePath();
+}
+
+std::vector<Path> CreateIconCorpus() {
+  return {
+      CreateCheckIcon(),  CreateFavoriteIcon(), CreateSettingsIcon(),
+      CreateRRect(),      CreateCircle(),       CreateCubic(),
+      CreateQuadratic(),
+  };
+}
+
 }  // namespace
 }  // namespace impeller
@@ -4,6 +4,7 @@
 
 #include "impeller/geometry/geometry_unittests.h"
 
+#include <iterator>
 #include <limits>
 #include <sstream>
 
@@ -129,6 +130,40 @@ TEST(GeometryTest, InvertMatrix) {
   ASSERT_MATRIX_NEAR(inverted, result);
 }
 
+TEST(GeometryTest, InvertAffineMatrix) {
+  auto matrix = Matrix::MakeTranslation({10, -20, 0}) *
+                Matrix::MakeRotationZ(Radians{0.7}) *
+                Matrix::MakeScale(Vector2{2, 3});
+  ASSERT_TRUE(matrix.IsAffine());
+  ASSERT_MATRIX_NEAR(matrix * matrix.Invert(), Matrix{});
+  ASSERT_MATRIX_NEAR(matrix.Invert() * matrix, Matrix{});
+
+  // Singular affine matrices are not invertible.
+  ASSERT_MATRIX_NEAR(Matrix::MakeScale(Vector2{0, 3}).Invert(), Matrix{});
+}
+
+TEST(GeometryTest, MatrixTransformPointsMatchesPointTransform) {
+  std::vector<Point> points = {{0, 0}, {10, 20}, {-3.5, 7}, {100, -50}, {1, 1}};
+  std::vector<Matrix> matrices = {
+      Matrix{},
+      Matrix::MakeTranslation({10, 20, 0}) * Matrix::MakeRotationZ(Radians{1}),
+      Matrix::MakePerspective(Radians{1}, 1.5, 0.1, 100) *
+          Matrix::MakeTranslation({0, 0, -10}),
+  };
+  for (const auto& matrix : matrices) {
+    std::vector<Point> results(points.size());
+    matrix.TransformPoints(points.data(), results.data(), points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+      ASSERT_POINT_NEAR(results[i], matrix * points[i]);
+    }
+
+    // Transforming in place is supported.
+    auto in_place = points;
+    matrix.TransformPoints(in_place.data(), in_place.data(), in_place.size());
+    ASSERT_EQ(in_place, results);
+  }
+}
+
 TEST(GeometryTest, TestDecomposition) {
   auto rotated = Matrix::MakeRotationZ(Radians{kPiOver4});
 
@@ -600,6 +635,91 @@ TEST(GeometryTest, BoundingBoxOfCompositePathIsCorrect) {
   ASSERT_RECT_NEAR(actual.value(), expected);
 }
 
+TEST(GeometryTest, TakePathResetsTheBuilder) {
+  PathBuilder builder;
+  builder.AddRect(Rect::MakeXYWH(10, 10, 100, 100));
+  auto path = builder.TakePath(FillType::kOdd);
+  ASSERT_EQ(path.GetFillType(), FillType::kOdd);
+  ASSERT_EQ(path.GetComponentCount(), PathBuilder{}
+                                           .AddRect(Rect::MakeXYWH(0, 0, 1, 1))
+                                           .TakePath()
+                                           .GetComponentCount());
+  ASSERT_EQ(builder.GetCurrentPath().GetComponentCount(),
+            PathBuilder{}.GetCurrentPath().GetComponentCount());
+
+  auto moved = std::move(path);
+  auto box = moved.GetBoundingBox();
+  ASSERT_TRUE(box.has_value());
+  ASSERT_RECT_NEAR(box.value(), Rect::MakeXYWH(10, 10, 100, 100));
+}
+
+TEST(GeometryTest, PathVerbsMatchPathBuilder) {
+  const Path::Verb verbs[] = {
+      Path::Verb::kMove,  Path::Verb::kLine,  Path::Verb::kQuadratic,
+      Path::Verb::kClose, Path::Verb::kMove,  Path::Verb::kCubic,
+      Path::Verb::kLine,
+  };
+  const Point points[] = {
+      {10, 10},   {100, 10},  {150, 50},  {100, 100},
+      {200, 200}, {250, 150}, {300, 250}, {350, 200},
+      {350, 300},
+  };
+  Path path;
+  ASSERT_TRUE(
+      path.AddVerbs(verbs, std::size(verbs), points, std::size(points)));
+
+  auto expected = PathBuilder{}
+                      .MoveTo({10, 10})
+                      .LineTo({100, 10})
+                      .QuadraticCurveTo({150, 50}, {100, 100})
+                      .Close()
+                      .MoveTo({200, 200})
+                      .CubicCurveTo({250, 150}, {300, 250}, {350, 200})
+                      .LineTo({350, 300})
+                      .TakePath();
+  ASSERT_EQ(path.GetComponentCount(), expected.GetComponentCount());
+
+  ContourComponent contour;
+  ASSERT_TRUE(path.GetContourComponentAtIndex(0, contour));
+  ASSERT_EQ(contour.destination, Point(10, 10));
+  ASSERT_TRUE(contour.is_closed);
+  QuadraticPathComponent quad;
+  ASSERT_TRUE(path.GetQuadraticComponentAtIndex(2, quad));
+  ASSERT_EQ(quad.p1, Point(100, 10));
+  ASSERT_EQ(quad.p2, Point(100, 100));
+  CubicPathComponent cubic;
+  ASSERT_TRUE(path.GetCubicComponentAtIndex(5, cubic));
+  ASSERT_EQ(cubic.p1, Point(200, 200));
+
+  auto polyline = path.CreatePolyline();
+  auto expected_polyline = expected.CreatePolyline();
+  ASSERT_EQ(polyline.points, expected_polyline.points);
+  ASSERT_EQ(polyline.contours.size(), expected_polyline.contours.size());
+  ASSERT_RECT_NEAR(path.GetBoundingBox().value(),
+                   expected.GetBoundingBox().value());
+}
+
+TEST(GeometryTest, PathVerbsMustConsumeAllPoints) {
+  const Path::Verb verbs[] = {Path::Verb::kMove, Path::Verb::kCubic};
+  const Point points[] = {{0, 0}, {10, 10}, {20, 20}};
+  Path path;
+  auto component_count = path.GetComponentCount();
+  ASSERT_FALSE(
+      path.AddVerbs(verbs, std::size(verbs), points, std::size(points)));
+  ASSERT_EQ(path.GetComponentCount(), component_count);
+}
+
+TEST(GeometryTest, PathComponentsCanBeUpdated) {
+  auto path = PathBuilder{}.MoveTo({0, 0}).LineTo({10, 10}).TakePath();
+  ASSERT_TRUE(path.UpdateLinearComponentAtIndex(1, {{0, 0}, {20, 30}}));
+  LinearPathComponent linear;
+  ASSERT_TRUE(path.GetLinearComponentAtIndex(1, linear));
+  ASSERT_EQ(linear.p2, Point(20, 30));
+  CubicPathComponent cubic;
+  ASSERT_FALSE(path.GetCubicComponentAtIndex(1, cubic));
+  ASSERT_RECT_NEAR(path.GetBoundingBox().value(), Rect::MakeLTRB(0, 0, 20, 30));
+}
+
 TEST(GeometryTest, PathGetBoundingBoxForCubicWithNoDerivativeRootsIsCorrect) {
   PathBuilder builder;
   // Straight diagonal line.
@@ -1480,6 +1600,30 @@ TEST(GeometryTest, CubicPathComponentPolylineDoesNotIncludePointOne) {
   ASSERT_EQ(polyline.back().y, 40);
 }
 
+TEST(GeometryTest, PathCreatePolylineReusesPolyline) {
+  auto path = PathBuilder{}
+                  .MoveTo({10, 10})
+                  .QuadraticCurveTo({100, 10}, {100, 100})
+                  .CubicCurveTo({100, 200}, {10, 200}, {10, 100})
+                  .Close()
+                  .TakePath();
+  auto expected = path.CreatePolyline();
+
+  Path::Polyline polyline;
+  polyline.points = {{1, 1}, {2, 2}, {3, 3}};
+  polyline.contours = {{.start_index = 0, .is_closed = false},
+                       {.start_index = 2, .is_closed = true}};
+  path.CreatePolyline(polyline);
+
+  ASSERT_EQ(polyline.points, expected.points);
+  ASSERT_EQ(polyline.contours.size(), expected.contours.size());
+  for (size_t i = 0; i < expected.contours.size(); i++) {
+    ASSERT_EQ(polyline.contours[i].start_index,
+              expected.contours[i].start_index);
+    ASSERT_EQ(polyline.contours[i].is_closed, expected.contours[i].is_closed);
+  }
+}
+
 TEST(GeometryTest, PathCreatePolyLineDoesNotDuplicatePoints) {
   Path path;
   path.AddContourComponent({10, 10});
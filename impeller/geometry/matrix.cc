@@ -95,6 +95,24 @@ Matrix Matrix::operator+(const Matrix& o) const {
 }
 
 Matrix Matrix::Invert() const {
+  if (IsAffine()) {
+    // Only the upper 2x2 and the translation are non-trivial, so the inverse
+    // is that of a 3x3 affine transform.
+    Scalar det = m[0] * m[5] - m[1] * m[4];
+    if (det == 0) {
+      return {};
+    }
+    det = 1.0 / det;
+    const Scalar tx = (m[4] * m[13] - m[5] * m[12]) * det;
+    const Scalar ty = (m[1] * m[12] - m[0] * m[13]) * det;
+    // clang-format off
+    return { m[5] * det, -m[1] * det, 0, 0,
+            -m[4] * det,  m[0] * det, 0, 0,
+             0,           0,          1, 0,
+             tx,          ty,         0, 1};
+    // clang-format on
+  }
+
   Matrix tmp{
       m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] +
           m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10],
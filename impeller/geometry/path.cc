@@ -6,6 +6,7 @@
 
 #include <optional>
 
+#include "flutter/fml/logging.h"
 #include "impeller/geometry/path_component.h"
 
 namespace impeller {
@@ -16,6 +17,16 @@ Path::Path() {
 
 Path::~Path() = default;
 
+Path::Path(const Path& path) = default;
+
+// Paths are moved into the geometry of the entities that draw them, so the
+// declared destructor must not suppress the move operations.
+Path::Path(Path&& path) = default;
+
+Path& Path::operator=(const Path& path) = default;
+
+Path& Path::operator=(Path&& path) = default;
+
 std::tuple<size_t, size_t> Path::Polyline::GetContourPointBounds(
     size_t contour_index) const {
   if (contour_index >= contours.size()) {
@@ -40,21 +51,51 @@ FillType Path::GetFillType() const {
   return fill_;
 }
 
+void Path::SetCacheKey(std::optional<uint64_t> cache_key) {
+  cache_key_ = cache_key;
+}
+
+std::optional<uint64_t> Path::GetCacheKey() const {
+  return cache_key_;
+}
+
+size_t Path::GetPointCount(ComponentType type) {
+  switch (type) {
+    case ComponentType::kLinear:
+      return 2u;
+    case ComponentType::kQuadratic:
+      return 3u;
+    case ComponentType::kCubic:
+      return 4u;
+    case ComponentType::kContour:
+      return 1u;
+  }
+  FML_UNREACHABLE();
+}
+
+void Path::AddComponent(ComponentType type,
+                        std::initializer_list<Point> points) {
+  components_.push_back(
+      {.point_index = static_cast<uint32_t>(points_.size()), .type = type});
+  points_.insert(points_.end(), points);
+}
+
+const Point* Path::GetPoints(const Component& component) const {
+  return points_.data() + component.point_index;
+}
+
 Path& Path::AddLinearComponent(Point p1, Point p2) {
-  linears_.emplace_back(p1, p2);
-  components_.emplace_back(ComponentType::kLinear, linears_.size() - 1);
+  AddComponent(ComponentType::kLinear, {p1, p2});
   return *this;
 }
 
 Path& Path::AddQuadraticComponent(Point p1, Point cp, Point p2) {
-  quads_.emplace_back(p1, cp, p2);
-  components_.emplace_back(ComponentType::kQuadratic, quads_.size() - 1);
+  AddComponent(ComponentType::kQuadratic, {p1, cp, p2});
   return *this;
 }
 
 Path& Path::AddCubicComponent(Point p1, Point cp1, Point cp2, Point p2) {
-  cubics_.emplace_back(p1, cp1, cp2, p2);
-  components_.emplace_back(ComponentType::kCubic, cubics_.size() - 1);
+  AddComponent(ComponentType::kCubic, {p1, cp1, cp2, p2});
   return *this;
 }
 
@@ -62,16 +103,111 @@ Path& Path::AddContourComponent(Point destination, bool is_closed) {
   if (components_.size() > 0 &&
       components_.back().type == ComponentType::kContour) {
     // Never insert contiguous contours.
-    contours_.back() = ContourComponent(destination, is_closed);
+    points_[components_.back().point_index] = destination;
   } else {
-    contours_.emplace_back(ContourComponent(destination, is_closed));
-    components_.emplace_back(ComponentType::kContour, contours_.size() - 1);
+    AddComponent(ComponentType::kContour, {destination});
   }
+  components_.back().is_closed = is_closed;
   return *this;
 }
 
 void Path::SetContourClosed(bool is_closed) {
-  contours_.back().is_closed = is_closed;
+  for (auto it = components_.rbegin(); it != components_.rend(); ++it) {
+    if (it->type == ComponentType::kContour) {
+      it->is_closed = is_closed;
+      return;
+    }
+  }
+}
+
+bool Path::AddVerbs(const Verb* verbs,
+                    size_t verb_count,
+                    const Point* points,
+                    size_t point_count) {
+  // Count the storage for the components first so that it is only reserved
+  // once.
+  size_t consumed_point_count = 0u;
+  size_t component_count = 0u;
+  size_t stored_point_count = 0u;
+  for (size_t i = 0; i < verb_count; i++) {
+    switch (verbs[i]) {
+      case Verb::kMove:
+        consumed_point_count += 1u;
+        component_count += 1u;
+        stored_point_count += 1u;
+        break;
+      case Verb::kLine:
+        consumed_point_count += 1u;
+        component_count += 1u;
+        stored_point_count += 2u;
+        break;
+      case Verb::kQuadratic:
+        consumed_point_count += 2u;
+        component_count += 1u;
+        stored_point_count += 3u;
+        break;
+      case Verb::kCubic:
+        consumed_point_count += 3u;
+        component_count += 1u;
+        stored_point_count += 4u;
+        break;
+      case Verb::kClose:
+        // A line back to the start of the contour, and the next contour.
+        component_count += 2u;
+        stored_point_count += 3u;
+        break;
+    }
+  }
+  if (consumed_point_count != point_count) {
+    return false;
+  }
+  components_.reserve(components_.size() + component_count);
+  points_.reserve(points_.size() + stored_point_count);
+
+  // Continue from the end of the path, like a path builder that built it.
+  Point current;
+  Point contour_start;
+  if (!components_.empty()) {
+    const auto& last = components_.back();
+    current = GetPoints(last)[GetPointCount(last.type) - 1u];
+    for (auto it = components_.rbegin(); it != components_.rend(); ++it) {
+      if (it->type == ComponentType::kContour) {
+        contour_start = points_[it->point_index];
+        break;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < verb_count; i++) {
+    switch (verbs[i]) {
+      case Verb::kMove:
+        current = contour_start = *points++;
+        AddContourComponent(current);
+        break;
+      case Verb::kLine:
+        AddLinearComponent(current, points[0]);
+        current = points[0];
+        points += 1;
+        break;
+      case Verb::kQuadratic:
+        AddQuadraticComponent(current, points[0], points[1]);
+        current = points[1];
+        points += 2;
+        break;
+      case Verb::kCubic:
+        AddCubicComponent(current, points[0], points[1], points[2]);
+        current = points[2];
+        points += 3;
+        break;
+      case Verb::kClose:
+        AddLinearComponent(current, contour_start);
+        current = contour_start;
+        SetContourClosed(true);
+        AddContourComponent(current);
+        break;
+    }
+  }
+  return true;
 }
 
 void Path::EnumerateComponents(
@@ -81,25 +217,31 @@ void Path::EnumerateComponents(
     const Applier<ContourComponent>& contour_applier) const {
   size_t currentIndex = 0;
   for (const auto& component : components_) {
+    const auto* points = GetPoints(component);
     switch (component.type) {
       case ComponentType::kLinear:
         if (linear_applier) {
-          linear_applier(currentIndex, linears_[component.index]);
+          linear_applier(currentIndex,
+                         LinearPathComponent(points[0], points[1]));
         }
         break;
       case ComponentType::kQuadratic:
         if (quad_applier) {
-          quad_applier(currentIndex, quads_[component.index]);
+          quad_applier(currentIndex, QuadraticPathComponent(
+                                         points[0], points[1], points[2]));
         }
         break;
       case ComponentType::kCubic:
         if (cubic_applier) {
-          cubic_applier(currentIndex, cubics_[component.index]);
+          cubic_applier(currentIndex,
+                        CubicPathComponent(points[0], points[1], points[2],
+                                           points[3]));
         }
         break;
       case ComponentType::kContour:
         if (contour_applier) {
-          contour_applier(currentIndex, contours_[component.index]);
+          contour_applier(currentIndex,
+                          ContourComponent(points[0], component.is_closed));
         }
         break;
     }
@@ -117,7 +259,8 @@ bool Path::GetLinearComponentAtIndex(size_t index,
     return false;
   }
 
-  linear = linears_[components_[index].index];
+  const auto* points = GetPoints(components_[index]);
+  linear = LinearPathComponent(points[0], points[1]);
   return true;
 }
 
@@ -132,7 +275,8 @@ bool Path::GetQuadraticComponentAtIndex(
     return false;
   }
 
-  quadratic = quads_[components_[index].index];
+  const auto* points = GetPoints(components_[index]);
+  quadratic = QuadraticPathComponent(points[0], points[1], points[2]);
   return true;
 }
 
@@ -146,7 +290,8 @@ bool Path::GetCubicComponentAtIndex(size_t index,
     return false;
   }
 
-  cubic = cubics_[components_[index].index];
+  const auto* points = GetPoints(components_[index]);
+  cubic = CubicPathComponent(points[0], points[1], points[2], points[3]);
   return true;
 }
 
@@ -160,7 +305,8 @@ bool Path::GetContourComponentAtIndex(size_t index,
     return false;
   }
 
-  move = contours_[components_[index].index];
+  const auto& component = components_[index];
+  move = ContourComponent(GetPoints(component)[0], component.is_closed);
   return true;
 }
 
@@ -174,7 +320,9 @@ bool Path::UpdateLinearComponentAtIndex(size_t index,
     return false;
   }
 
-  linears_[components_[index].index] = linear;
+  auto* points = &points_[components_[index].point_index];
+  points[0] = linear.p1;
+  points[1] = linear.p2;
   return true;
 }
 
@@ -189,7 +337,10 @@ bool Path::UpdateQuadraticComponentAtIndex(
     return false;
   }
 
-  quads_[components_[index].index] = quadratic;
+  auto* points = &points_[components_[index].point_index];
+  points[0] = quadratic.p1;
+  points[1] = quadratic.cp;
+  points[2] = quadratic.p2;
   return true;
 }
 
@@ -203,7 +354,11 @@ bool Path::UpdateCubicComponentAtIndex(size_t index,
     return false;
   }
 
-  cubics_[components_[index].index] = cubic;
+  auto* points = &points_[components_[index].point_index];
+  points[0] = cubic.p1;
+  points[1] = cubic.cp1;
+  points[2] = cubic.cp2;
+  points[3] = cubic.p2;
   return true;
 }
 
@@ -217,43 +372,62 @@ bool Path::UpdateContourComponentAtIndex(size_t index,
     return false;
   }
 
-  contours_[components_[index].index] = move;
+  auto& component = components_[index];
+  points_[component.point_index] = move.destination;
+  component.is_closed = move.is_closed;
   return true;
 }
 
 Path::Polyline Path::CreatePolyline(Scalar tolerance) const {
   Polyline polyline;
+  CreatePolyline(polyline, tolerance);
+  return polyline;
+}
+
+void Path::CreatePolyline(Polyline& polyline, Scalar tolerance) const {
+  polyline.points.clear();
+  polyline.contours.clear();
 
   std::optional<Point> previous_contour_point;
+  // Components append their points directly to the polyline. The appended
+  // points are then compacted in place to skip over duplicate points in the
+  // same contour.
   auto collect_points = [&polyline, &previous_contour_point](
-                            const std::vector<Point>& collection) {
-    if (collection.empty()) {
-      return;
-    }
-
-    for (const auto& point : collection) {
+                            size_t first_index) {
+    auto& points = polyline.points;
+    auto write_index = first_index;
+    for (auto read_index = first_index; read_index < points.size();
+         read_index++) {
+      const auto point = points[read_index];
       if (previous_contour_point.has_value() &&
           previous_contour_point.value() == point) {
-        // Skip over duplicate points in the same contour.
         continue;
       }
       previous_contour_point = point;
-      polyline.points.push_back(point);
+      points[write_index++] = point;
     }
+    points.resize(write_index);
   };
 
   for (size_t component_i = 0; component_i < components_.size();
        component_i++) {
     const auto& component = components_[component_i];
+    const auto* points = GetPoints(component);
+    const auto first_index = polyline.points.size();
     switch (component.type) {
       case ComponentType::kLinear:
-        collect_points(linears_[component.index].CreatePolyline());
+        polyline.points.push_back(points[1]);
+        collect_points(first_index);
         break;
       case ComponentType::kQuadratic:
-        collect_points(quads_[component.index].CreatePolyline(tolerance));
+        QuadraticPathComponent(points[0], points[1], points[2])
+            .FillPointsForPolyline(polyline.points, tolerance);
+        collect_points(first_index);
         break;
       case ComponentType::kCubic:
-        collect_points(cubics_[component.index].CreatePolyline(tolerance));
+        CubicPathComponent(points[0], points[1], points[2], points[3])
+            .FillPointsForPolyline(polyline.points, tolerance);
+        collect_points(first_index);
         break;
       case ComponentType::kContour:
         if (component_i == components_.size() - 1) {
@@ -261,15 +435,14 @@ Path::Polyline Path::CreatePolyline(Scalar tolerance) const {
           // contour, so skip it.
           continue;
         }
-        const auto& contour = contours_[component.index];
         polyline.contours.push_back({.start_index = polyline.points.size(),
-                                     .is_closed = contour.is_closed});
+                                     .is_closed = component.is_closed});
         previous_contour_point = std::nullopt;
-        collect_points({contour.destination});
+        polyline.points.push_back(points[0]);
+        collect_points(first_index);
         break;
     }
   }
-  return polyline;
 }
 
 std::optional<Rect> Path::GetBoundingBox() const {
@@ -293,10 +466,6 @@ std::optional<Rect> Path::GetTransformedBoundingBox(
 }
 
 std::optional<std::pair<Point, Point>> Path::GetMinMaxCoveragePoints() const {
-  if (linears_.empty() && quads_.empty() && cubics_.empty()) {
-    return std::nullopt;
-  }
-
   std::optional<Point> min, max;
 
   auto clamp = [&min, &max](const std::vector<Point>& extrema) {
@@ -316,16 +485,23 @@ std::optional<std::pair<Point, Point>> Path::GetMinMaxCoveragePoints() const {
     }
   };
 
-  for (const auto& linear : linears_) {
-    clamp(linear.Extrema());
-  }
-
-  for (const auto& quad : quads_) {
-    clamp(quad.Extrema());
-  }
-
-  for (const auto& cubic : cubics_) {
-    clamp(cubic.Extrema());
+  for (const auto& component : components_) {
+    const auto* points = GetPoints(component);
+    switch (component.type) {
+      case ComponentType::kLinear:
+        clamp(LinearPathComponent(points[0], points[1]).Extrema());
+        break;
+      case ComponentType::kQuadratic:
+        clamp(
+            QuadraticPathComponent(points[0], points[1], points[2]).Extrema());
+        break;
+      case ComponentType::kCubic:
+        clamp(CubicPathComponent(points[0], points[1], points[2], points[3])
+                  .Extrema());
+        break;
+      case ComponentType::kContour:
+        break;
+    }
   }
 
   if (!min.has_value() || !max.has_value()) {
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <optional>
 #include <set>
 #include <tuple>
@@ -34,15 +36,36 @@ enum class FillType {
 ///             Creating paths that describe complex shapes is usually done by a
 ///             path builder.
 ///
+///             The points of all components are packed into a single vector,
+///             in the order of the components, so that walking a path reads
+///             its points sequentially.
+///
 class Path {
  public:
-  enum class ComponentType {
+  enum class ComponentType : uint8_t {
     kLinear,
     kQuadratic,
     kCubic,
     kContour,
   };
 
+  /// The verbs of a path in the packed form used by `SkPath` and similar
+  /// paths, where each verb consumes the points after those of the previous
+  /// verbs and starts at the end of the previous verb.
+  enum class Verb : uint8_t {
+    /// Starts a new contour. Consumes one point.
+    kMove,
+    /// Consumes one point.
+    kLine,
+    /// Consumes a control point and an end point.
+    kQuadratic,
+    /// Consumes two control points and an end point.
+    kCubic,
+    /// Draws a line back to the start of the contour and closes it. Consumes
+    /// no points.
+    kClose,
+  };
+
   struct PolylineContour {
     /// Index that denotes the first point of this contour.
     size_t start_index;
@@ -71,12 +94,33 @@ class Path {
 
   ~Path();
 
+  Path(const Path& path);
+
+  Path(Path&& path);
+
+  Path& operator=(const Path& path);
+
+  Path& operator=(Path&& path);
+
   size_t GetComponentCount() const;
 
   void SetFillType(FillType fill);
 
   FillType GetFillType() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Set a key that identifies the contents of this path across
+  ///             frames. Paths with a cache key may have their tessellation
+  ///             results retained between frames.
+  ///
+  ///             The key must change whenever the components of the path do.
+  ///             Only non-volatile paths (those that are unlikely to change
+  ///             from frame to frame) should be given a key.
+  ///
+  void SetCacheKey(std::optional<uint64_t> cache_key);
+
+  std::optional<uint64_t> GetCacheKey() const;
+
   Path& AddLinearComponent(Point p1, Point p2);
 
   Path& AddQuadraticComponent(Point p1, Point cp, Point p2);
@@ -87,6 +131,20 @@ class Path {
 
   void SetContourClosed(bool is_closed);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Append the components described by packed verbs and points,
+  ///             with the same results as issuing the verbs to a path builder
+  ///             that continues from the end of this path. The storage for
+  ///             all of the components is reserved up front.
+  ///
+  /// @return     Whether the number of points matches what the verbs consume.
+  ///             Nothing is appended if it doesn't.
+  ///
+  bool AddVerbs(const Verb* verbs,
+                size_t verb_count,
+                const Point* points,
+                size_t point_count);
+
   template <class T>
   using Applier = std::function<void(size_t index, const T& component)>;
   void EnumerateComponents(
@@ -119,6 +177,14 @@ class Path {
 
   Polyline CreatePolyline(Scalar tolerance = kDefaultCurveTolerance) const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Flatten the path into the given polyline. The polyline is
+  ///             cleared first, but its storage is reused so that callers
+  ///             that flatten many paths don't reallocate it for each one.
+  ///
+  void CreatePolyline(Polyline& polyline,
+                      Scalar tolerance = kDefaultCurveTolerance) const;
+
   std::optional<Rect> GetBoundingBox() const;
 
   std::optional<Rect> GetTransformedBoundingBox(const Matrix& transform) const;
@@ -126,22 +192,26 @@ class Path {
   std::optional<std::pair<Point, Point>> GetMinMaxCoveragePoints() const;
 
  private:
-  struct ComponentIndexPair {
+  /// A component whose points start at `point_index` in `points_`. Linear,
+  /// quadratic and cubic components store all of their points, including
+  /// the first one. Contours store their destination.
+  struct Component {
+    uint32_t point_index = 0u;
     ComponentType type = ComponentType::kLinear;
-    size_t index = 0;
-
-    ComponentIndexPair() {}
-
-    ComponentIndexPair(ComponentType a_type, size_t a_index)
-        : type(a_type), index(a_index) {}
+    /// Only used by contours.
+    bool is_closed = false;
   };
 
   FillType fill_ = FillType::kNonZero;
-  std::vector<ComponentIndexPair> components_;
-  std::vector<LinearPathComponent> linears_;
-  std::vector<QuadraticPathComponent> quads_;
-  std::vector<CubicPathComponent> cubics_;
-  std::vector<ContourComponent> contours_;
+  std::optional<uint64_t> cache_key_;
+  std::vector<Component> components_;
+  std::vector<Point> points_;
+
+  static size_t GetPointCount(ComponentType type);
+
+  void AddComponent(ComponentType type, std::initializer_list<Point> points);
+
+  const Point* GetPoints(const Component& component) const;
 };
 
 }  // namespace impeller
@@ -5,6 +5,7 @@
 #include "path_builder.h"
 
 #include <cmath>
+#include <utility>
 
 namespace impeller {
 
@@ -19,8 +20,12 @@ Path PathBuilder::CopyPath(FillType fill) const {
 }
 
 Path PathBuilder::TakePath(FillType fill) {
-  auto path = prototype_;
+  auto path = std::move(prototype_);
   path.SetFillType(fill);
+  // Leave the builder as if it had just been created.
+  prototype_ = {};
+  subpath_start_ = {};
+  current_ = {};
   return path;
 }
 
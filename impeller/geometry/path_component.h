@@ -106,6 +106,9 @@ struct CubicPathComponent {
   std::vector<Point> CreatePolyline(
       Scalar tolerance = kDefaultCurveTolerance) const;
 
+  void FillPointsForPolyline(std::vector<Point>& points,
+                             Scalar tolerance = kDefaultCurveTolerance) const;
+
   std::vector<Point> Extrema() const;
 
   std::vector<QuadraticPathComponent> ToQuadraticPathComponents(
@@ -120,6 +123,10 @@ struct CubicPathComponent {
 
  private:
   QuadraticPathComponent Lower() const;
+
+  template <class Callback>
+  void ForEachQuadraticPathComponent(Scalar accuracy,
+                                     Callback&& callback) const;
 };
 
 struct ContourComponent {
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <optional>
 #include <ostream>
+#include <type_traits>
 #include <vector>
 
 #include "impeller/geometry/matrix.h"
@@ -163,8 +165,12 @@ struct TRect {
   constexpr std::array<TPoint<T>, 4> GetTransformedPoints(
       const Matrix& transform) const {
     auto points = GetPoints();
-    for (size_t i = 0; i < points.size(); i++) {
-      points[i] = transform * points[i];
+    if constexpr (std::is_same_v<Type, Scalar>) {
+      transform.TransformPoints(points.data(), points.data(), points.size());
+    } else {
+      for (size_t i = 0; i < points.size(); i++) {
+        points[i] = transform * points[i];
+      }
     }
     return points;
   }
@@ -173,7 +179,17 @@ struct TRect {
   ///         rectangle.
   constexpr TRect TransformBounds(const Matrix& transform) const {
     auto points = GetTransformedPoints(transform);
-    return TRect::MakePointBounds({points.begin(), points.end()}).value();
+    auto left = points[0].x;
+    auto top = points[0].y;
+    auto right = points[0].x;
+    auto bottom = points[0].y;
+    for (size_t i = 1; i < points.size(); i++) {
+      left = std::min(left, points[i].x);
+      top = std::min(top, points[i].y);
+      right = std::max(right, points[i].x);
+      bottom = std::max(bottom, points[i].y);
+    }
+    return TRect::MakeLTRB(left, top, right, bottom);
   }
 
   constexpr TRect Union(const TRect& o) const {
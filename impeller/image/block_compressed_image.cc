@@ -0,0 +1,205 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/image/block_compressed_image.h"
+
+#include <cstring>
+#include <optional>
+
+namespace impeller {
+
+// All supported formats use 4x4 pixel blocks.
+static constexpr int64_t kBlockSize = 4;
+
+static size_t GetBytesPerBlock(BlockCompressedImage::Format format) {
+  switch (format) {
+    case BlockCompressedImage::Format::kInvalid:
+      return 0u;
+    case BlockCompressedImage::Format::kETC2RGB8:
+    case BlockCompressedImage::Format::kBC1:
+      return 8u;
+    case BlockCompressedImage::Format::kASTC4x4:
+    case BlockCompressedImage::Format::kETC2RGBA8:
+    case BlockCompressedImage::Format::kBC3:
+    case BlockCompressedImage::Format::kBC7:
+      return 16u;
+  }
+  return 0u;
+}
+
+static size_t GetByteSize(ISize size, BlockCompressedImage::Format format) {
+  const size_t blocks_x = (size.width + kBlockSize - 1) / kBlockSize;
+  const size_t blocks_y = (size.height + kBlockSize - 1) / kBlockSize;
+  return blocks_x * blocks_y * GetBytesPerBlock(format);
+}
+
+BlockCompressedImage::BlockCompressedImage() = default;
+
+BlockCompressedImage::BlockCompressedImage(
+    ISize size,
+    Format format,
+    std::shared_ptr<const fml::Mapping> allocation)
+    : size_(size), format_(format), allocation_(std::move(allocation)) {
+  if (!allocation_ || !size.IsPositive() || format_ == Format::kInvalid) {
+    return;
+  }
+  if (allocation_->GetSize() < GetByteSize(size_, format_)) {
+    return;
+  }
+  is_valid_ = true;
+}
+
+BlockCompressedImage::~BlockCompressedImage() = default;
+
+bool BlockCompressedImage::IsValid() const {
+  return is_valid_;
+}
+
+const ISize& BlockCompressedImage::GetSize() const {
+  return size_;
+}
+
+BlockCompressedImage::Format BlockCompressedImage::GetFormat() const {
+  return format_;
+}
+
+const std::shared_ptr<const fml::Mapping>&
+BlockCompressedImage::GetAllocation() const {
+  return allocation_;
+}
+
+/// Wraps a range of the container without copying it. The range keeps the
+/// container alive.
+static std::shared_ptr<const fml::Mapping> MakeSubMapping(
+    const std::shared_ptr<const fml::Mapping>& container,
+    size_t offset,
+    size_t length) {
+  return std::make_shared<fml::NonOwnedMapping>(
+      container->GetMapping() + offset,  //
+      length,                            //
+      [container](auto, auto) {}         //
+  );
+}
+
+static uint32_t ReadUint32(const uint8_t* data) {
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+static std::optional<BlockCompressedImage::Format> FormatFromGLInternalFormat(
+    uint32_t internal_format) {
+  switch (internal_format) {
+    case 0x93B0:  // GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+      return BlockCompressedImage::Format::kASTC4x4;
+    case 0x9274:  // GL_COMPRESSED_RGB8_ETC2
+      return BlockCompressedImage::Format::kETC2RGB8;
+    case 0x9278:  // GL_COMPRESSED_RGBA8_ETC2_EAC
+      return BlockCompressedImage::Format::kETC2RGBA8;
+    case 0x83F0:  // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    case 0x83F1:  // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+      return BlockCompressedImage::Format::kBC1;
+    case 0x83F3:  // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+      return BlockCompressedImage::Format::kBC3;
+    case 0x8E8C:  // GL_COMPRESSED_RGBA_BPTC_UNORM_EXT
+      return BlockCompressedImage::Format::kBC7;
+  }
+  return std::nullopt;
+}
+
+// https://registry.khronos.org/KTX/specs/1.0/ktxspec.v1.html
+static constexpr uint8_t kKTXIdentifier[12] = {
+    0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A,
+};
+static constexpr uint32_t kKTXEndianness = 0x04030201;
+static constexpr size_t kKTXHeaderSize = 64u;
+
+static BlockCompressedImage ReadKTX(
+    const std::shared_ptr<const fml::Mapping>& container) {
+  const uint8_t* data = container->GetMapping();
+  const size_t size = container->GetSize();
+  // The identifier is followed by 13 32-bit header fields.
+  const uint8_t* fields = data + sizeof(kKTXIdentifier);
+  auto field = [fields](size_t index) {
+    return ReadUint32(fields + index * sizeof(uint32_t));
+  };
+  // Containers written with the opposite endianness are not supported.
+  if (field(0) != kKTXEndianness) {
+    return {};
+  }
+  // Compressed formats have a type of zero.
+  if (field(1) != 0u) {
+    return {};
+  }
+  auto format = FormatFromGLInternalFormat(field(4));
+  if (!format.has_value()) {
+    return {};
+  }
+  const ISize image_size(field(6), field(7));
+  // Only 2D textures are supported, not arrays, cube maps or 3D textures.
+  if (field(8) > 1u || field(9) > 1u || field(10) != 1u) {
+    return {};
+  }
+  const size_t key_value_size = field(12);
+
+  // The base mip level is preceded by its size.
+  const size_t level_offset = kKTXHeaderSize + key_value_size;
+  if (level_offset + sizeof(uint32_t) > size) {
+    return {};
+  }
+  const size_t level_size = ReadUint32(data + level_offset);
+  const size_t blocks_offset = level_offset + sizeof(uint32_t);
+  if (blocks_offset + level_size > size) {
+    return {};
+  }
+  return BlockCompressedImage{
+      image_size, format.value(),
+      MakeSubMapping(container, blocks_offset, level_size)};
+}
+
+// The header written by the reference ASTC encoder.
+static constexpr uint8_t kASTCMagic[4] = {0x13, 0xAB, 0xA1, 0x5C};
+static constexpr size_t kASTCHeaderSize = 16u;
+
+static BlockCompressedImage ReadASTC(
+    const std::shared_ptr<const fml::Mapping>& container) {
+  const uint8_t* data = container->GetMapping();
+  const size_t size = container->GetSize();
+  const uint8_t* block_dims = data + sizeof(kASTCMagic);
+  if (block_dims[0] != kBlockSize || block_dims[1] != kBlockSize ||
+      block_dims[2] != 1u) {
+    return {};
+  }
+  // Followed by the 24-bit little endian width, height and depth.
+  auto dim = [image_dims = block_dims + 3](size_t index) {
+    const uint8_t* bytes = image_dims + index * 3u;
+    return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16);
+  };
+  if (dim(2) != 1) {
+    return {};
+  }
+  return BlockCompressedImage{
+      ISize(dim(0), dim(1)), BlockCompressedImage::Format::kASTC4x4,
+      MakeSubMapping(container, kASTCHeaderSize, size - kASTCHeaderSize)};
+}
+
+BlockCompressedImage BlockCompressedImage::Create(
+    std::shared_ptr<const fml::Mapping> container) {
+  if (!container || container->GetMapping() == nullptr) {
+    return {};
+  }
+  const uint8_t* data = container->GetMapping();
+  const size_t size = container->GetSize();
+  if (size >= kKTXHeaderSize &&
+      std::memcmp(data, kKTXIdentifier, sizeof(kKTXIdentifier)) == 0) {
+    return ReadKTX(container);
+  }
+  if (size >= kASTCHeaderSize &&
+      std::memcmp(data, kASTCMagic, sizeof(kASTCMagic)) == 0) {
+    return ReadASTC(container);
+  }
+  return {};
+}
+
+}  // namespace impeller
@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "impeller/geometry/size.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      An image whose pixels are stored in a GPU block compressed
+///             format. Unlike a |CompressedImage|, the contents are never
+///             decoded on the CPU and are instead uploaded to textures as is.
+///
+///             Images are read from KTX (version 1) or ASTC containers. Only
+///             the base mip level of the container is read.
+///
+class BlockCompressedImage {
+ public:
+  enum class Format {
+    kInvalid,
+    kASTC4x4,
+    kETC2RGB8,
+    kETC2RGBA8,
+    kBC1,
+    kBC3,
+    kBC7,
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Read the base mip level of a KTX or ASTC container.
+  ///
+  /// @param[in]  container  The contents of the container file.
+  ///
+  /// @return     The image, which is invalid if the container isn't
+  ///             recognized or uses an unsupported format.
+  ///
+  static BlockCompressedImage Create(
+      std::shared_ptr<const fml::Mapping> container);
+
+  BlockCompressedImage();
+
+  BlockCompressedImage(ISize size,
+                       Format format,
+                       std::shared_ptr<const fml::Mapping> allocation);
+
+  ~BlockCompressedImage();
+
+  const ISize& GetSize() const;
+
+  bool IsValid() const;
+
+  Format GetFormat() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The compressed blocks of the image in row major order.
+  ///
+  const std::shared_ptr<const fml::Mapping>& GetAllocation() const;
+
+ private:
+  ISize size_;
+  Format format_ = Format::kInvalid;
+  std::shared_ptr<const fml::Mapping> allocation_;
+  bool is_valid_ = false;
+};
+
+}  // namespace impeller
@@ -0,0 +1,94 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstring>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+#include "flutter/testing/testing.h"
+#include "impeller/image/block_compressed_image.h"
+
+namespace impeller {
+namespace testing {
+
+static void AppendUint32(std::vector<uint8_t>& data, uint32_t value) {
+  uint8_t bytes[sizeof(value)];
+  std::memcpy(bytes, &value, sizeof(value));
+  data.insert(data.end(), bytes, bytes + sizeof(value));
+}
+
+static std::shared_ptr<const fml::Mapping> MakeKTX(uint32_t internal_format,
+                                                   uint32_t width,
+                                                   uint32_t height,
+                                                   uint32_t level_size) {
+  std::vector<uint8_t> data = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31,
+                               0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+  AppendUint32(data, 0x04030201);       // endianness
+  AppendUint32(data, 0u);               // glType
+  AppendUint32(data, 1u);               // glTypeSize
+  AppendUint32(data, 0u);               // glFormat
+  AppendUint32(data, internal_format);  // glInternalFormat
+  AppendUint32(data, 0x1908);           // glBaseInternalFormat
+  AppendUint32(data, width);            // pixelWidth
+  AppendUint32(data, height);           // pixelHeight
+  AppendUint32(data, 0u);               // pixelDepth
+  AppendUint32(data, 0u);               // numberOfArrayElements
+  AppendUint32(data, 1u);               // numberOfFaces
+  AppendUint32(data, 1u);               // numberOfMipmapLevels
+  AppendUint32(data, 4u);               // bytesOfKeyValueData
+  AppendUint32(data, 0u);               // key and value data
+  AppendUint32(data, level_size);       // imageSize
+  data.resize(data.size() + level_size, 0xCD);
+  return std::make_shared<fml::DataMapping>(std::move(data));
+}
+
+TEST(ImageTest, CanReadKTXContainers) {
+  // 10x6 pixels of ETC2 RGBA8 are 3x2 blocks of 16 bytes each.
+  auto image = BlockCompressedImage::Create(MakeKTX(0x9278, 10, 6, 96));
+  ASSERT_TRUE(image.IsValid());
+  ASSERT_EQ(image.GetFormat(), BlockCompressedImage::Format::kETC2RGBA8);
+  ASSERT_EQ(image.GetSize(), ISize(10, 6));
+  ASSERT_EQ(image.GetAllocation()->GetSize(), 96u);
+  ASSERT_EQ(image.GetAllocation()->GetMapping()[0], 0xCD);
+}
+
+TEST(ImageTest, RejectsTruncatedOrUnknownKTXContainers) {
+  // BC1 uses 8 bytes per block, so 3x2 blocks need 48 bytes.
+  ASSERT_TRUE(BlockCompressedImage::Create(MakeKTX(0x83F1, 10, 6, 48))
+                  .IsValid());
+  ASSERT_FALSE(BlockCompressedImage::Create(MakeKTX(0x83F1, 10, 6, 40))
+                   .IsValid());
+  // GL_RGBA8 is not block compressed.
+  ASSERT_FALSE(BlockCompressedImage::Create(MakeKTX(0x8058, 10, 6, 240))
+                   .IsValid());
+}
+
+TEST(ImageTest, CanReadASTCContainers) {
+  std::vector<uint8_t> data = {0x13, 0xAB, 0xA1, 0x5C,  // magic
+                               4,    4,    1,           // block size
+                               5,    0,    0,           // width
+                               4,    0,    0,           // height
+                               1,    0,    0};          // depth
+  data.resize(data.size() + 2 * 16, 0u);
+  auto image = BlockCompressedImage::Create(
+      std::make_shared<fml::DataMapping>(std::move(data)));
+  ASSERT_TRUE(image.IsValid());
+  ASSERT_EQ(image.GetFormat(), BlockCompressedImage::Format::kASTC4x4);
+  ASSERT_EQ(image.GetSize(), ISize(5, 4));
+}
+
+TEST(ImageTest, RejectsUnsupportedASTCBlockSizes) {
+  std::vector<uint8_t> data = {0x13, 0xAB, 0xA1, 0x5C,  // magic
+                               8,    8,    1,           // block size
+                               8,    0,    0,           // width
+                               8,    0,    0,           // height
+                               1,    0,    0};          // depth
+  data.resize(data.size() + 16, 0u);
+  auto image = BlockCompressedImage::Create(
+      std::make_shared<fml::DataMapping>(std::move(data)));
+  ASSERT_FALSE(image.IsValid());
+}
+
+}  // namespace testing
+}  // namespace impeller
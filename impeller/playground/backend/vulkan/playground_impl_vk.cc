@@ -68,7 +68,7 @@ PlaygroundImplVK::PlaygroundImplVK()
   auto context = ContextVK::Create(reinterpret_cast<PFN_vkGetInstanceProcAddr>(
                                        &::glfwGetInstanceProcAddress),    //
                                    ShaderLibraryMappingsForPlayground(),  //
-                                   nullptr,                               //
+                                   fml::UniqueFD{},                       //
                                    concurrent_loop_->GetTaskRunner(),     //
                                    "Playground Library"                   //
   );
@@ -96,7 +96,7 @@ void PlaygroundImplVK::SetupSwapchain() {
     return;
   }
   vk::UniqueSurfaceKHR surface{surface_tmp, instance};
-  context_vk->SetupSwapchain(std::move(surface));
+  context_vk->SetupSwapchain(std::move(surface), SwapchainConfigVK{});
 }
 
 PlaygroundImplVK::~PlaygroundImplVK() = default;
@@ -115,7 +115,8 @@ PlaygroundImpl::WindowHandle PlaygroundImplVK::GetWindowHandle() const {
 std::unique_ptr<Surface> PlaygroundImplVK::AcquireSurfaceFrame(
     std::shared_ptr<Context> context) {
   ContextVK* context_vk = reinterpret_cast<ContextVK*>(context_.get());
-  return context_vk->AcquireSurface(current_frame_++);
+  // Swapchain images always have the size of the window.
+  return context_vk->AcquireSurface(current_frame_++, {});
 }
 
 }  // namespace impeller
@@ -16,6 +16,7 @@
 
 #include "flutter/fml/paths.h"
 #include "impeller/base/validation.h"
+#include "impeller/image/block_compressed_image.h"
 #include "impeller/image/compressed_image.h"
 #include "impeller/playground/imgui/imgui_impl_impeller.h"
 #include "impeller/playground/playground.h"
@@ -407,6 +408,64 @@ std::shared_ptr<Texture> Playground::CreateTextureForFixture(
   return texture;
 }
 
+static PixelFormat ToPixelFormat(BlockCompressedImage::Format format) {
+  switch (format) {
+    case BlockCompressedImage::Format::kInvalid:
+      return PixelFormat::kUnknown;
+    case BlockCompressedImage::Format::kASTC4x4:
+      return PixelFormat::kASTC4x4UNormInt;
+    case BlockCompressedImage::Format::kETC2RGB8:
+      return PixelFormat::kETC2R8G8B8UNormInt;
+    case BlockCompressedImage::Format::kETC2RGBA8:
+      return PixelFormat::kETC2R8G8B8A8UNormInt;
+    case BlockCompressedImage::Format::kBC1:
+      return PixelFormat::kBC1R8G8B8A8UNormInt;
+    case BlockCompressedImage::Format::kBC3:
+      return PixelFormat::kBC3R8G8B8A8UNormInt;
+    case BlockCompressedImage::Format::kBC7:
+      return PixelFormat::kBC7R8G8B8A8UNormInt;
+  }
+  FML_UNREACHABLE();
+}
+
+std::shared_ptr<Texture> Playground::CreateBlockCompressedTextureForFixture(
+    const char* fixture_name) const {
+  if (!renderer_ || fixture_name == nullptr) {
+    return nullptr;
+  }
+
+  auto image = BlockCompressedImage::Create(OpenAssetAsMapping(fixture_name));
+  if (!image.IsValid()) {
+    VALIDATION_LOG << "Could not read block compressed fixture "
+                   << fixture_name;
+    return nullptr;
+  }
+
+  auto context = renderer_->GetContext();
+  auto texture_descriptor = TextureDescriptor{};
+  texture_descriptor.storage_mode = StorageMode::kHostVisible;
+  texture_descriptor.format = ToPixelFormat(image.GetFormat());
+  texture_descriptor.size = image.GetSize();
+  if (!context->SupportsPixelFormat(texture_descriptor.format)) {
+    return nullptr;
+  }
+
+  auto texture =
+      context->GetResourceAllocator()->CreateTexture(texture_descriptor);
+  if (!texture) {
+    VALIDATION_LOG << "Could not allocate texture for fixture " << fixture_name;
+    return nullptr;
+  }
+  texture->SetLabel(fixture_name);
+
+  if (!texture->SetContents(image.GetAllocation())) {
+    VALIDATION_LOG << "Could not upload texture to device memory for fixture "
+                   << fixture_name;
+    return nullptr;
+  }
+  return texture;
+}
+
 std::shared_ptr<Texture> Playground::CreateTextureCubeForFixture(
     std::array<const char*, 6> fixture_names) const {
   std::array<DecompressedImage, 6> images;
@@ -63,6 +63,16 @@ class Playground {
       const char* fixture_name,
       bool enable_mipmapping = false) const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Upload the base mip level of a KTX or ASTC fixture without
+  ///             decompressing it.
+  ///
+  /// @return     The texture, or nullptr if the fixture couldn't be read or
+  ///             its format isn't supported by the context.
+  ///
+  std::shared_ptr<Texture> CreateBlockCompressedTextureForFixture(
+      const char* fixture_name) const;
+
   std::shared_ptr<Texture> CreateTextureCubeForFixture(
       std::array<const char*, 6> fixture_names) const;
 
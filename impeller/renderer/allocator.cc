@@ -42,7 +42,12 @@ std::shared_ptr<DeviceBuffer> Allocator::CreateBufferWithCopy(
 
 std::shared_ptr<DeviceBuffer> Allocator::CreateBuffer(
     const DeviceBufferDescriptor& desc) {
-  return OnCreateBuffer(desc);
+  auto buffer = OnCreateBuffer(desc);
+  if (buffer) {
+    allocation_count_++;
+    allocated_bytes_ += desc.size;
+  }
+  return buffer;
 }
 
 std::shared_ptr<Texture> Allocator::CreateTexture(
@@ -55,7 +60,28 @@ std::shared_ptr<Texture> Allocator::CreateTexture(
     return nullptr;
   }
 
-  return OnCreateTexture(desc);
+  if (IsBlockCompressedPixelFormat(desc.format) &&
+      (desc.usage &
+       static_cast<TextureUsageMask>(TextureUsage::kRenderTarget))) {
+    VALIDATION_LOG << "Block compressed textures cannot be render targets.";
+    return nullptr;
+  }
+
+  auto texture = OnCreateTexture(desc);
+  if (texture) {
+    allocation_count_++;
+    allocated_bytes_ += desc.GetByteSizeOfBaseMipLevel() *
+                        static_cast<size_t>(desc.sample_count);
+  }
+  return texture;
+}
+
+size_t Allocator::GetAllocationCount() const {
+  return allocation_count_;
+}
+
+size_t Allocator::GetAllocatedBytes() const {
+  return allocated_bytes_;
 }
 
 uint16_t Allocator::MinimumBytesPerRow(PixelFormat format) const {
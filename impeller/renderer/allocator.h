@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include "flutter/fml/macros.h"
@@ -45,6 +46,18 @@ class Allocator {
 
   virtual ISize GetMaxTextureSizeSupported() const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The number of buffers and textures created by this allocator
+  ///             over its lifetime.
+  ///
+  size_t GetAllocationCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The combined size in bytes of all buffers and textures
+  ///             created by this allocator over its lifetime.
+  ///
+  size_t GetAllocatedBytes() const;
+
  protected:
   Allocator();
 
@@ -55,6 +68,9 @@ class Allocator {
       const TextureDescriptor& desc) = 0;
 
  private:
+  std::atomic<size_t> allocation_count_ = 0u;
+  std::atomic<size_t> allocated_bytes_ = 0u;
+
   FML_DISALLOW_COPY_AND_ASSIGN(Allocator);
 };
 
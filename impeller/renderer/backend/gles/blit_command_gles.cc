@@ -155,6 +155,24 @@ bool BlitCopyTextureToBufferCommandGLES::Encode(
   return true;
 };
 
+BlitCopyBufferToTextureCommandGLES::~BlitCopyBufferToTextureCommandGLES() =
+    default;
+
+std::string BlitCopyBufferToTextureCommandGLES::GetLabel() const {
+  return label;
+}
+
+bool BlitCopyBufferToTextureCommandGLES::Encode(
+    const ReactorGLES& reactor) const {
+  // Buffers are backed by host memory, so there is nothing to gain from
+  // staging. Upload the contents directly.
+  const auto* contents =
+      DeviceBufferGLES::Cast(*source).GetBufferData() + source_offset;
+  const auto length =
+      destination->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+  return destination->SetContents(contents, length);
+};
+
 BlitGenerateMipmapCommandGLES::~BlitGenerateMipmapCommandGLES() = default;
 
 std::string BlitGenerateMipmapCommandGLES::GetLabel() const {
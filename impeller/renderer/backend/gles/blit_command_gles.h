@@ -39,6 +39,16 @@ struct BlitCopyTextureToBufferCommandGLES
   [[nodiscard]] bool Encode(const ReactorGLES& reactor) const override;
 };
 
+struct BlitCopyBufferToTextureCommandGLES
+    : public BlitEncodeGLES,
+      public BlitCopyBufferToTextureCommand {
+  ~BlitCopyBufferToTextureCommandGLES() override;
+
+  std::string GetLabel() const override;
+
+  [[nodiscard]] bool Encode(const ReactorGLES& reactor) const override;
+};
+
 struct BlitGenerateMipmapCommandGLES : public BlitEncodeGLES,
                                        public BlitGenerateMipmapCommand {
   ~BlitGenerateMipmapCommandGLES() override;
@@ -130,6 +130,22 @@ bool BlitPassGLES::OnCopyTextureToBufferCommand(
   return true;
 }
 
+// |BlitPass|
+bool BlitPassGLES::OnCopyBufferToTextureCommand(
+    std::shared_ptr<DeviceBuffer> source,
+    std::shared_ptr<Texture> destination,
+    size_t source_offset,
+    std::string label) {
+  auto command = std::make_unique<BlitCopyBufferToTextureCommandGLES>();
+  command->label = label;
+  command->source = std::move(source);
+  command->destination = std::move(destination);
+  command->source_offset = source_offset;
+
+  commands_.emplace_back(std::move(command));
+  return true;
+}
+
 // |BlitPass|
 bool BlitPassGLES::OnGenerateMipmapCommand(std::shared_ptr<Texture> texture,
                                            std::string label) {
@@ -50,6 +50,12 @@ class BlitPassGLES final : public BlitPass {
                                     size_t destination_offset,
                                     std::string label) override;
 
+  // |BlitPass|
+  bool OnCopyBufferToTextureCommand(std::shared_ptr<DeviceBuffer> source,
+                                    std::shared_ptr<Texture> destination,
+                                    size_t source_offset,
+                                    std::string label) override;
+
   // |BlitPass|
   bool OnGenerateMipmapCommand(std::shared_ptr<Texture> texture,
                                std::string label) override;
@@ -52,10 +52,13 @@ bool BufferBindingsGLES::RegisterVertexStageInput(
     offset += (input.bit_width * input.vec_size) / 8;
     vertex_attrib_arrays.emplace_back(attrib);
   }
+  std::vector<GLuint> vertex_attrib_indices;
   for (auto& array : vertex_attrib_arrays) {
     array.stride = offset;
+    vertex_attrib_indices.push_back(array.index);
   }
   vertex_attrib_arrays_ = std::move(vertex_attrib_arrays);
+  vertex_attrib_indices_ = std::move(vertex_attrib_indices);
   return true;
 }
 
@@ -126,13 +129,18 @@ bool BufferBindingsGLES::ReadUniformsBindings(const ProcTableGLES& gl,
     uniform_locations_[NormalizeUniformKey(std::string{
         name.data(), static_cast<size_t>(written_count)})] = location;
   }
+  // Linking resets all uniforms of the program.
+  uniform_values_.clear();
   return true;
 }
 
 bool BufferBindingsGLES::BindVertexAttributes(const ProcTableGLES& gl,
+                                              StateTrackerGLES& state_tracker,
                                               size_t vertex_offset) const {
+  state_tracker.SetEnabledVertexAttribArrays(vertex_attrib_indices_);
+  // The attribute pointers capture the currently bound array buffer and must
+  // be set for every draw.
   for (const auto& array : vertex_attrib_arrays_) {
-    gl.EnableVertexAttribArray(array.index);
     gl.VertexAttribPointer(array.index,       // index
                            array.size,        // size (must be 1, 2, 3, or 4)
                            array.type,        // type
@@ -150,39 +158,49 @@ bool BufferBindingsGLES::BindUniformData(
     const ProcTableGLES& gl,
     Allocator& transients_allocator,
     const Bindings& vertex_bindings,
-    const Bindings& fragment_bindings) const {
+    const Bindings& fragment_bindings,
+    UniformUploadStats& stats) const {
   for (const auto& buffer : vertex_bindings.buffers) {
-    if (!BindUniformBuffer(gl, transients_allocator, buffer.second)) {
+    if (!BindUniformBuffer(gl, transients_allocator, buffer.second, stats)) {
       return false;
     }
   }
   for (const auto& buffer : fragment_bindings.buffers) {
-    if (!BindUniformBuffer(gl, transients_allocator, buffer.second)) {
+    if (!BindUniformBuffer(gl, transients_allocator, buffer.second, stats)) {
       return false;
     }
   }
 
-  if (!BindTextures(gl, vertex_bindings, ShaderStage::kVertex)) {
+  if (!BindTextures(gl, vertex_bindings, ShaderStage::kVertex, stats)) {
     return false;
   }
 
-  if (!BindTextures(gl, fragment_bindings, ShaderStage::kFragment)) {
+  if (!BindTextures(gl, fragment_bindings, ShaderStage::kFragment, stats)) {
     return false;
   }
 
   return true;
 }
 
-bool BufferBindingsGLES::UnbindVertexAttributes(const ProcTableGLES& gl) const {
-  for (const auto& array : vertex_attrib_arrays_) {
-    gl.DisableVertexAttribArray(array.index);
+bool BufferBindingsGLES::UniformNeedsUpload(GLint location,
+                                            const void* data,
+                                            size_t length,
+                                            UniformUploadStats& stats) const {
+  auto& value = uniform_values_[location];
+  if (value.size() == length && std::memcmp(value.data(), data, length) == 0) {
+    stats.skipped++;
+    return false;
   }
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+  value.assign(bytes, bytes + length);
+  stats.issued++;
   return true;
 }
 
 bool BufferBindingsGLES::BindUniformBuffer(const ProcTableGLES& gl,
                                            Allocator& transients_allocator,
-                                           const BufferResource& buffer) const {
+                                           const BufferResource& buffer,
+                                           UniformUploadStats& stats) const {
   const auto* metadata = buffer.isa;
   if (metadata == nullptr) {
     // Vertex buffer bindings don't have metadata as those definitions are
@@ -249,6 +267,10 @@ bool BufferBindingsGLES::BindUniformBuffer(const ProcTableGLES& gl,
 
     switch (member.type) {
       case ShaderType::kFloat:
+        if (!UniformNeedsUpload(location->second, buffer_data,
+                                member.size * element_count, stats)) {
+          continue;
+        }
         switch (member.size) {
           case sizeof(Matrix):
             gl.UniformMatrix4fv(location->second,  // location
@@ -310,7 +332,8 @@ bool BufferBindingsGLES::BindUniformBuffer(const ProcTableGLES& gl,
 
 bool BufferBindingsGLES::BindTextures(const ProcTableGLES& gl,
                                       const Bindings& bindings,
-                                      ShaderStage stage) const {
+                                      ShaderStage stage,
+                                      UniformUploadStats& stats) const {
   size_t active_index = 0;
   for (const auto& texture : bindings.textures) {
     const auto& texture_gles = TextureGLES::Cast(*texture.second.resource);
@@ -358,7 +381,11 @@ bool BufferBindingsGLES::BindTextures(const ProcTableGLES& gl,
     //--------------------------------------------------------------------------
     /// Set the texture uniform location.
     ///
-    gl.Uniform1i(uniform->second, active_index);
+    const GLint texture_unit = active_index;
+    if (UniformNeedsUpload(uniform->second, &texture_unit,
+                           sizeof(texture_unit), stats)) {
+      gl.Uniform1i(uniform->second, texture_unit);
+    }
 
     //--------------------------------------------------------------------------
     /// Bump up the active index at binding.
@@ -5,11 +5,13 @@
 #pragma once
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/renderer/backend/gles/gles.h"
 #include "impeller/renderer/backend/gles/proc_table_gles.h"
+#include "impeller/renderer/backend/gles/state_tracker_gles.h"
 #include "impeller/renderer/command.h"
 #include "impeller/renderer/vertex_descriptor.h"
 
@@ -21,6 +23,15 @@ namespace impeller {
 ///
 class BufferBindingsGLES {
  public:
+  //----------------------------------------------------------------------------
+  /// @brief      Counts of the glUniform* calls made and skipped because the
+  ///             program already had the same value at that location.
+  ///
+  struct UniformUploadStats {
+    size_t issued = 0u;
+    size_t skipped = 0u;
+  };
+
   BufferBindingsGLES();
 
   ~BufferBindingsGLES();
@@ -31,14 +42,14 @@ class BufferBindingsGLES {
   bool ReadUniformsBindings(const ProcTableGLES& gl, GLuint program);
 
   bool BindVertexAttributes(const ProcTableGLES& gl,
+                            StateTrackerGLES& state_tracker,
                             size_t vertex_offset) const;
 
   bool BindUniformData(const ProcTableGLES& gl,
                        Allocator& transients_allocator,
                        const Bindings& vertex_bindings,
-                       const Bindings& fragment_bindings) const;
-
-  bool UnbindVertexAttributes(const ProcTableGLES& gl) const;
+                       const Bindings& fragment_bindings,
+                       UniformUploadStats& stats) const;
 
  private:
   //----------------------------------------------------------------------------
@@ -53,15 +64,26 @@ class BufferBindingsGLES {
     GLsizei offset = 0u;
   };
   std::vector<VertexAttribPointer> vertex_attrib_arrays_;
+  std::vector<GLuint> vertex_attrib_indices_;
   std::map<std::string, GLint> uniform_locations_;
+  // Uniform values are program state. This is the last value uploaded to
+  // each location of the program these bindings were read from.
+  mutable std::unordered_map<GLint, std::vector<uint8_t>> uniform_values_;
 
   bool BindUniformBuffer(const ProcTableGLES& gl,
                          Allocator& transients_allocator,
-                         const BufferResource& buffer) const;
+                         const BufferResource& buffer,
+                         UniformUploadStats& stats) const;
 
   bool BindTextures(const ProcTableGLES& gl,
                     const Bindings& bindings,
-                    ShaderStage stage) const;
+                    ShaderStage stage,
+                    UniformUploadStats& stats) const;
+
+  bool UniformNeedsUpload(GLint location,
+                          const void* data,
+                          size_t length,
+                          UniformUploadStats& stats) const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(BufferBindingsGLES);
 };
@@ -4,7 +4,10 @@
 
 #include "impeller/renderer/backend/gles/capabilities_gles.h"
 
+#include <algorithm>
+
 #include "impeller/renderer/backend/gles/proc_table_gles.h"
+#include "impeller/renderer/formats.h"
 
 namespace impeller {
 
@@ -81,11 +84,31 @@ CapabilitiesGLES::CapabilitiesGLES(const ProcTableGLES& gl) {
     num_compressed_texture_formats = value;
   }
 
+  if (num_compressed_texture_formats > 0) {
+    std::vector<GLint> values(num_compressed_texture_formats);
+    gl.GetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, values.data());
+    compressed_texture_formats.assign(values.begin(), values.end());
+  }
+
   if (gl.GetDescription()->IsES()) {
     GLint value = 0;
     gl.GetIntegerv(GL_NUM_SHADER_BINARY_FORMATS, &value);
     num_shader_binary_formats = value;
   }
+
+  supports_vertex_array_objects = gl.BindVertexArray.IsAvailable() &&
+                                  gl.DeleteVertexArrays.IsAvailable() &&
+                                  gl.GenVertexArrays.IsAvailable();
+
+  if (gl.FramebufferTexture2DMultisampleEXT.IsAvailable() &&
+      gl.RenderbufferStorageMultisampleEXT.IsAvailable()) {
+    GLint value = 0;
+    gl.GetIntegerv(GL_MAX_SAMPLES_EXT, &value);
+    max_samples = value;
+  }
+
+  supports_implicit_msaa =
+      max_samples >= static_cast<size_t>(SampleCount::kCount4);
 }
 
 size_t CapabilitiesGLES::GetMaxTextureUnits(ShaderStage stage) const {
@@ -103,4 +126,10 @@ size_t CapabilitiesGLES::GetMaxTextureUnits(ShaderStage stage) const {
   FML_UNREACHABLE();
 }
 
+bool CapabilitiesGLES::SupportsCompressedTextureFormat(GLenum format) const {
+  return std::find(compressed_texture_formats.begin(),
+                   compressed_texture_formats.end(),
+                   format) != compressed_texture_formats.end();
+}
+
 }  // namespace impeller
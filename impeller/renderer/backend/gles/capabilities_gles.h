@@ -5,9 +5,11 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/geometry/size.h"
+#include "impeller/renderer/backend/gles/gles.h"
 #include "impeller/renderer/shader_types.h"
 
 namespace impeller {
@@ -53,10 +55,28 @@ struct CapabilitiesGLES {
   // May be 0.
   size_t num_compressed_texture_formats = 0;
 
+  // The values of GL_COMPRESSED_TEXTURE_FORMATS.
+  std::vector<GLenum> compressed_texture_formats;
+
   // May be 0.
   size_t num_shader_binary_formats = 0;
 
+  // OpenGL ES 3.0 or GL_OES_vertex_array_object.
+  bool supports_vertex_array_objects = false;
+
+  // The value of GL_MAX_SAMPLES_EXT. 0 without
+  // GL_EXT_multisampled_render_to_texture.
+  size_t max_samples = 0;
+
+  // GL_EXT_multisampled_render_to_texture with at least 4 samples. Passes with
+  // a multisampled color attachment then render straight into the resolve
+  // texture, which the tiler resolves as it writes out the tiles. Otherwise
+  // they render into the resolve texture without multisampling.
+  bool supports_implicit_msaa = false;
+
   size_t GetMaxTextureUnits(ShaderStage stage) const;
+
+  bool SupportsCompressedTextureFormat(GLenum format) const;
 };
 
 }  // namespace impeller
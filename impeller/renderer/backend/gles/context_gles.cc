@@ -7,6 +7,7 @@
 #include "impeller/base/config.h"
 #include "impeller/base/validation.h"
 #include "impeller/base/work_queue_common.h"
+#include "impeller/renderer/backend/gles/formats_gles.h"
 
 namespace impeller {
 
@@ -59,6 +60,11 @@ ContextGLES::ContextGLES(std::unique_ptr<ProcTableGLES> gl,
         std::shared_ptr<SamplerLibraryGLES>(new SamplerLibraryGLES());
   }
 
+  // Create the GPU tracer.
+  {
+    gpu_tracer_ = std::make_shared<GPUTracerGLES>(reactor_->GetProcTable());
+  }
+
   // Create the work queue.
   {
     work_queue_ = WorkQueueCommon::Create();
@@ -127,6 +133,11 @@ std::shared_ptr<WorkQueue> ContextGLES::GetWorkQueue() const {
   return work_queue_;
 }
 
+// |Context|
+std::shared_ptr<GPUTracer> ContextGLES::GetGPUTracer() const {
+  return gpu_tracer_;
+}
+
 // |Context|
 bool ContextGLES::HasThreadingRestrictions() const {
   return true;
@@ -134,7 +145,33 @@ bool ContextGLES::HasThreadingRestrictions() const {
 
 // |Context|
 bool ContextGLES::SupportsOffscreenMSAA() const {
-  return false;
+  if (!IsValid()) {
+    return false;
+  }
+  return reactor_->GetProcTable().GetCapabilities()->supports_implicit_msaa;
+}
+
+// |Context|
+bool ContextGLES::SupportsFramebufferFetch() const {
+  if (!IsValid()) {
+    return false;
+  }
+  return reactor_->GetProcTable().GetDescription()->HasExtension(
+      "GL_EXT_shader_framebuffer_fetch");
+}
+
+// |Context|
+bool ContextGLES::SupportsPixelFormat(PixelFormat format) const {
+  auto compressed_format = ToCompressedTextureFormat(format);
+  if (!compressed_format.has_value()) {
+    return Context::SupportsPixelFormat(format);
+  }
+  if (!IsValid()) {
+    return false;
+  }
+  return reactor_->GetProcTable()
+      .GetCapabilities()
+      ->SupportsCompressedTextureFormat(compressed_format.value());
 }
 
 }  // namespace impeller
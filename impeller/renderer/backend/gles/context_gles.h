@@ -8,6 +8,7 @@
 #include "impeller/base/backend_cast.h"
 #include "impeller/renderer/backend/gles/allocator_gles.h"
 #include "impeller/renderer/backend/gles/command_buffer_gles.h"
+#include "impeller/renderer/backend/gles/gpu_tracer_gles.h"
 #include "impeller/renderer/backend/gles/pipeline_library_gles.h"
 #include "impeller/renderer/backend/gles/reactor_gles.h"
 #include "impeller/renderer/backend/gles/sampler_library_gles.h"
@@ -40,6 +41,7 @@ class ContextGLES final : public Context,
   std::shared_ptr<SamplerLibraryGLES> sampler_library_;
   std::shared_ptr<WorkQueue> work_queue_;
   std::shared_ptr<AllocatorGLES> resource_allocator_;
+  std::shared_ptr<GPUTracerGLES> gpu_tracer_;
   bool is_valid_ = false;
 
   ContextGLES(
@@ -67,12 +69,21 @@ class ContextGLES final : public Context,
   // |Context|
   std::shared_ptr<WorkQueue> GetWorkQueue() const override;
 
+  // |Context|
+  std::shared_ptr<GPUTracer> GetGPUTracer() const override;
+
   // |Context|
   bool HasThreadingRestrictions() const override;
 
   // |Context|
   bool SupportsOffscreenMSAA() const override;
 
+  // |Context|
+  bool SupportsFramebufferFetch() const override;
+
+  // |Context|
+  bool SupportsPixelFormat(PixelFormat format) const override;
+
   FML_DISALLOW_COPY_AND_ASSIGN(ContextGLES);
 };
 
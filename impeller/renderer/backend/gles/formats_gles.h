@@ -187,4 +187,32 @@ constexpr std::optional<GLenum> ToTextureTarget(TextureType type) {
   FML_UNREACHABLE();
 }
 
+constexpr std::optional<GLenum> ToCompressedTextureFormat(PixelFormat format) {
+  switch (format) {
+    case PixelFormat::kASTC4x4UNormInt:
+      return GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+    case PixelFormat::kETC2R8G8B8UNormInt:
+      return GL_COMPRESSED_RGB8_ETC2;
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+      return GL_COMPRESSED_RGBA8_ETC2_EAC;
+    case PixelFormat::kBC1R8G8B8A8UNormInt:
+      return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    case PixelFormat::kBC3R8G8B8A8UNormInt:
+      return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case PixelFormat::kBC7R8G8B8A8UNormInt:
+      return GL_COMPRESSED_RGBA_BPTC_UNORM_EXT;
+    case PixelFormat::kUnknown:
+    case PixelFormat::kA8UNormInt:
+    case PixelFormat::kR8UNormInt:
+    case PixelFormat::kR8G8UNormInt:
+    case PixelFormat::kR8G8B8A8UNormInt:
+    case PixelFormat::kR8G8B8A8UNormIntSRGB:
+    case PixelFormat::kB8G8R8A8UNormInt:
+    case PixelFormat::kB8G8R8A8UNormIntSRGB:
+    case PixelFormat::kS8UInt:
+      return std::nullopt;
+  }
+  FML_UNREACHABLE();
+}
+
 }  // namespace impeller
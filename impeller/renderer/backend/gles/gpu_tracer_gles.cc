@@ -0,0 +1,84 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/gles/gpu_tracer_gles.h"
+
+#include <utility>
+
+namespace impeller {
+
+GPUTracerGLES::GPUTracerGLES(const ProcTableGLES& gl)
+    : supports_timestamp_queries_(gl.BeginQueryEXT.IsAvailable()) {}
+
+GPUTracerGLES::~GPUTracerGLES() = default;
+
+bool GPUTracerGLES::SupportsTimestampQueries() const {
+  return supports_timestamp_queries_;
+}
+
+bool GPUTracerGLES::BeginRegion(const ProcTableGLES& gl, std::string label) {
+  if (!supports_timestamp_queries_) {
+    return false;
+  }
+
+  CollectCompletedRegions(gl);
+
+  Region region;
+  gl.GenQueriesEXT(1u, &region.query);
+  if (region.query == GL_NONE) {
+    return false;
+  }
+  region.label = std::move(label);
+  region.cpu_start = fml::TimePoint::Now();
+  gl.BeginQueryEXT(GL_TIME_ELAPSED_EXT, region.query);
+  pending_regions_.emplace_back(std::move(region));
+  return true;
+}
+
+void GPUTracerGLES::EndRegion(const ProcTableGLES& gl) {
+  if (!supports_timestamp_queries_) {
+    return;
+  }
+  gl.EndQueryEXT(GL_TIME_ELAPSED_EXT);
+}
+
+void GPUTracerGLES::CollectCompletedRegions(const ProcTableGLES& gl) {
+  if (pending_regions_.empty()) {
+    return;
+  }
+
+  // Reading the flag clears it. A disjoint operation invalidates the results
+  // of every query that was active or pending when it happened.
+  GLint disjoint = GL_FALSE;
+  gl.GetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+
+  while (!pending_regions_.empty()) {
+    auto& region = pending_regions_.front();
+    // Queries are not shared between contexts. If a reaction happened on
+    // another context in the share group, its queries can't be read here.
+    if (gl.IsQueryEXT(region.query) == GL_FALSE) {
+      pending_regions_.pop_front();
+      continue;
+    }
+    GLuint available = GL_FALSE;
+    gl.GetQueryObjectuivEXT(region.query, GL_QUERY_RESULT_AVAILABLE_EXT,
+                            &available);
+    if (available == GL_FALSE && disjoint == GL_FALSE) {
+      // Queries complete in order. Later ones aren't available either, check
+      // again when the next region begins.
+      return;
+    }
+    if (disjoint == GL_FALSE) {
+      GLuint64 elapsed_ns = 0u;
+      gl.GetQueryObjectui64vEXT(region.query, GL_QUERY_RESULT_EXT, &elapsed_ns);
+      RecordCompletedRegion(
+          region.label, region.cpu_start,
+          fml::TimeDelta::FromNanoseconds(static_cast<int64_t>(elapsed_ns)));
+    }
+    gl.DeleteQueriesEXT(1u, &region.query);
+    pending_regions_.pop_front();
+  }
+}
+
+}  // namespace impeller
@@ -0,0 +1,71 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <deque>
+#include <optional>
+#include <string>
+
+#include "flutter/fml/macros.h"
+#include "impeller/base/backend_cast.h"
+#include "impeller/renderer/backend/gles/gles.h"
+#include "impeller/renderer/backend/gles/proc_table_gles.h"
+#include "impeller/renderer/gpu_tracer.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Measures the GPU time taken by labelled regions with
+///             GL_EXT_disjoint_timer_query.
+///
+///             Regions must begin and end within the same reaction, as
+///             time elapsed queries can't be nested. Results of earlier
+///             regions are read back without blocking as new ones begin.
+///             They are dropped if the GPU reports a disjoint operation in
+///             the meantime since the timings can't be trusted.
+///
+///             Like the rest of the GLES backend, the tracer is only used
+///             from within reactions, which the reactor serializes.
+///
+class GPUTracerGLES final : public GPUTracer,
+                            public BackendCast<GPUTracerGLES, GPUTracer> {
+ public:
+  explicit GPUTracerGLES(const ProcTableGLES& gl);
+
+  // |GPUTracer|
+  ~GPUTracerGLES() override;
+
+  // |GPUTracer|
+  bool SupportsTimestampQueries() const override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Begin a labelled region. Must be called with a current
+  ///             context, and no other region may be active.
+  ///
+  /// @return     Whether a region was begun and needs to be ended.
+  ///
+  bool BeginRegion(const ProcTableGLES& gl, std::string label);
+
+  //----------------------------------------------------------------------------
+  /// @brief      End the region begun last.
+  ///
+  void EndRegion(const ProcTableGLES& gl);
+
+ private:
+  struct Region {
+    GLuint query = GL_NONE;
+    std::string label;
+    fml::TimePoint cpu_start;
+  };
+
+  const bool supports_timestamp_queries_;
+  std::deque<Region> pending_regions_;
+
+  void CollectCompletedRegions(const ProcTableGLES& gl);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GPUTracerGLES);
+};
+
+}  // namespace impeller
@@ -64,13 +64,13 @@ bool PipelineGLES::BuildVertexDescriptor(const ProcTableGLES& gl,
   if (!handle.has_value()) {
     return false;
   }
-  reactor_->GetProcTable().UseProgram(handle.value());
+  reactor_->GetStateTracker().UseProgram(handle.value());
   return true;
 }
 
 [[nodiscard]] bool PipelineGLES::UnbindProgram() const {
   if (reactor_) {
-    reactor_->GetProcTable().UseProgram(0u);
+    reactor_->GetStateTracker().UseProgram(0u);
   }
   return true;
 }
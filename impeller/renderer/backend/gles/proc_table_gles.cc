@@ -111,6 +111,41 @@ ProcTableGLES::ProcTableGLES(Resolver resolver) {
     DiscardFramebufferEXT.Reset();
   }
 
+  if (!description_->HasExtension("GL_EXT_disjoint_timer_query")) {
+    BeginQueryEXT.Reset();
+    DeleteQueriesEXT.Reset();
+    EndQueryEXT.Reset();
+    GenQueriesEXT.Reset();
+    GetQueryObjectui64vEXT.Reset();
+    GetQueryObjectuivEXT.Reset();
+    IsQueryEXT.Reset();
+  }
+
+  if (!description_->HasExtension("GL_EXT_multisampled_render_to_texture")) {
+    FramebufferTexture2DMultisampleEXT.Reset();
+    RenderbufferStorageMultisampleEXT.Reset();
+  }
+
+  // Vertex array objects are core in OpenGL ES 3.0 and available on some
+  // OpenGL ES 2.0 implementations via an extension with the same signatures.
+  if (!description_->GetGlVersion().IsAtLeast(Version{3, 0, 0})) {
+    BindVertexArray.Reset();
+    DeleteVertexArrays.Reset();
+    GenVertexArrays.Reset();
+    if (description_->HasExtension("GL_OES_vertex_array_object")) {
+      const auto resolve_oes_proc = [&](auto& proc, const char* name) {
+        if (auto fn_ptr = resolver(name)) {
+          proc.name = name;
+          proc.function = reinterpret_cast<decltype(proc.function)>(fn_ptr);
+          proc.error_fn = error_fn;
+        }
+      };
+      resolve_oes_proc(BindVertexArray, "glBindVertexArrayOES");
+      resolve_oes_proc(DeleteVertexArrays, "glDeleteVertexArraysOES");
+      resolve_oes_proc(GenVertexArrays, "glGenVertexArraysOES");
+    }
+  }
+
   capabilities_ = std::make_unique<CapabilitiesGLES>(*this);
 
   is_valid_ = true;
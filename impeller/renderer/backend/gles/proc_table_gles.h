@@ -101,6 +101,7 @@ struct GLProc {
   PROC(ClearStencil);                        \
   PROC(ColorMask);                           \
   PROC(CompileShader);                       \
+  PROC(CompressedTexImage2D);                \
   PROC(CreateProgram);                       \
   PROC(CreateShader);                        \
   PROC(CullFace);                            \
@@ -119,6 +120,7 @@ struct GLProc {
   PROC(DrawElements);                        \
   PROC(Enable);                              \
   PROC(EnableVertexAttribArray);             \
+  PROC(Finish);                              \
   PROC(FramebufferRenderbuffer);             \
   PROC(FramebufferTexture2D);                \
   PROC(FrontFace);                           \
@@ -165,12 +167,25 @@ struct GLProc {
   PROC(Viewport);                            \
   PROC(ReadPixels);
 
-#define FOR_EACH_IMPELLER_GLES3_PROC(PROC) PROC(BlitFramebuffer);
-
-#define FOR_EACH_IMPELLER_EXT_PROC(PROC) \
-  PROC(DiscardFramebufferEXT);           \
-  PROC(PushDebugGroupKHR);               \
-  PROC(PopDebugGroupKHR);                \
+#define FOR_EACH_IMPELLER_GLES3_PROC(PROC) \
+  PROC(BindVertexArray);                   \
+  PROC(BlitFramebuffer);                   \
+  PROC(DeleteVertexArrays);                \
+  PROC(GenVertexArrays);
+
+#define FOR_EACH_IMPELLER_EXT_PROC(PROC)    \
+  PROC(BeginQueryEXT);                      \
+  PROC(DeleteQueriesEXT);                   \
+  PROC(DiscardFramebufferEXT);              \
+  PROC(EndQueryEXT);                        \
+  PROC(FramebufferTexture2DMultisampleEXT); \
+  PROC(GenQueriesEXT);                      \
+  PROC(GetQueryObjectui64vEXT);             \
+  PROC(GetQueryObjectuivEXT);               \
+  PROC(IsQueryEXT);                         \
+  PROC(RenderbufferStorageMultisampleEXT);  \
+  PROC(PushDebugGroupKHR);                  \
+  PROC(PopDebugGroupKHR);                   \
   PROC(ObjectLabelKHR);
 
 enum class DebugResourceType {
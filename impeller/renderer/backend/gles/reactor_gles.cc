@@ -5,6 +5,7 @@
 #include "impeller/renderer/backend/gles/reactor_gles.h"
 
 #include <algorithm>
+#include <iterator>
 
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
@@ -18,6 +19,7 @@ ReactorGLES::ReactorGLES(std::unique_ptr<ProcTableGLES> gl)
     return;
   }
   can_set_debug_labels_ = proc_table_->GetDescription()->HasDebugExtension();
+  state_tracker_ = std::make_unique<StateTrackerGLES>(*proc_table_);
   is_valid_ = true;
 }
 
@@ -49,6 +51,11 @@ const ProcTableGLES& ReactorGLES::GetProcTable() const {
   return *proc_table_;
 }
 
+StateTrackerGLES& ReactorGLES::GetStateTracker() const {
+  FML_DCHECK(IsValid());
+  return *state_tracker_;
+}
+
 std::optional<GLuint> ReactorGLES::GetGLHandle(const HandleGLES& handle) const {
   ReaderLock handles_lock(handles_mutex_);
   if (auto found = handles_.find(handle); found != handles_.end()) {
@@ -68,18 +75,66 @@ std::optional<GLuint> ReactorGLES::GetGLHandle(const HandleGLES& handle) const {
 }
 
 bool ReactorGLES::AddOperation(Operation operation) {
+  return EnqueueOperation(std::move(operation), false);
+}
+
+bool ReactorGLES::AddBackgroundOperation(Operation operation) {
+  return EnqueueOperation(std::move(operation), true);
+}
+
+bool ReactorGLES::EnqueueOperation(Operation operation, bool background_safe) {
   if (!operation) {
     return false;
   }
   {
     Lock ops_lock(ops_mutex_);
-    ops_.emplace_back(std::move(operation));
+    ops_.push_back({std::move(operation), background_safe});
   }
   // Attempt a reaction if able but it is not an error if this isn't possible.
-  [[maybe_unused]] auto result = React();
+  if (!React() && background_safe) {
+    ScheduleBackgroundReaction();
+  }
   return true;
 }
 
+void ReactorGLES::SetBackgroundDispatcher(BackgroundDispatcher dispatcher) {
+  Lock lock(dispatcher_mutex_);
+  background_dispatcher_ = std::move(dispatcher);
+}
+
+void ReactorGLES::ScheduleBackgroundReaction() {
+  Lock lock(dispatcher_mutex_);
+  if (!background_dispatcher_) {
+    return;
+  }
+  // One pending background reaction picks up everything queued before it
+  // runs.
+  if (background_reaction_pending_.exchange(true)) {
+    return;
+  }
+  background_dispatcher_([weak = weak_from_this()]() {
+    if (auto reactor = weak.lock()) {
+      reactor->ReactInBackground();
+    }
+  });
+}
+
+void ReactorGLES::ReactInBackground() {
+  background_reaction_pending_ = false;
+  if (!IsValid() || !CanReactOnCurrentThread()) {
+    return;
+  }
+  TRACE_EVENT0("impeller", "ReactorGLES::ReactInBackground");
+  std::scoped_lock reaction_lock(reaction_mutex_);
+  if (!ConsolidateHandles(true) || !FlushOps(true)) {
+    return;
+  }
+  // Objects created or modified in one context are only guaranteed to be
+  // complete for other contexts in the share group once the commands have
+  // finished.
+  GetProcTable().Finish();
+}
+
 static std::optional<GLuint> CreateGLHandle(const ProcTableGLES& gl,
                                             HandleType type) {
   GLuint handle = GL_NONE;
@@ -104,26 +159,78 @@ static std::optional<GLuint> CreateGLHandle(const ProcTableGLES& gl,
   return std::nullopt;
 }
 
-static bool CollectGLHandle(const ProcTableGLES& gl,
+// Framebuffers are container objects and are not shared between the contexts
+// in a share group. They must be created and collected by the context that
+// uses them.
+static bool IsSharedHandleType(HandleType type) {
+  switch (type) {
+    case HandleType::kUnknown:
+    case HandleType::kFrameBuffer:
+      return false;
+    case HandleType::kTexture:
+    case HandleType::kBuffer:
+    case HandleType::kProgram:
+    case HandleType::kRenderBuffer:
+      return true;
+  }
+  return false;
+}
+
+static bool CreateGLHandles(const ProcTableGLES& gl,
                             HandleType type,
-                            GLuint handle) {
+                            std::vector<GLuint>& handles) {
+  if (handles.empty()) {
+    return true;
+  }
   switch (type) {
     case HandleType::kUnknown:
       return false;
     case HandleType::kTexture:
-      gl.DeleteTextures(1u, &handle);
+      gl.GenTextures(handles.size(), handles.data());
       return true;
     case HandleType::kBuffer:
-      gl.DeleteBuffers(1u, &handle);
+      gl.GenBuffers(handles.size(), handles.data());
       return true;
     case HandleType::kProgram:
-      gl.DeleteProgram(handle);
+      for (auto& handle : handles) {
+        handle = gl.CreateProgram();
+      }
       return true;
     case HandleType::kRenderBuffer:
-      gl.DeleteRenderbuffers(1u, &handle);
+      gl.GenRenderbuffers(handles.size(), handles.data());
       return true;
     case HandleType::kFrameBuffer:
-      gl.DeleteFramebuffers(1u, &handle);
+      gl.GenFramebuffers(handles.size(), handles.data());
+      return true;
+  }
+  return false;
+}
+
+static bool CollectGLHandles(const ProcTableGLES& gl,
+                             HandleType type,
+                             const std::vector<GLuint>& handles) {
+  if (handles.empty()) {
+    return true;
+  }
+  switch (type) {
+    case HandleType::kUnknown:
+      return false;
+    case HandleType::kTexture:
+      gl.DeleteTextures(handles.size(), handles.data());
+      return true;
+    case HandleType::kBuffer:
+      gl.DeleteBuffers(handles.size(), handles.data());
+      return true;
+    case HandleType::kProgram:
+      for (auto handle : handles) {
+        gl.DeleteProgram(handle);
+      }
+      return true;
+    case HandleType::kRenderBuffer:
+      gl.DeleteRenderbuffers(handles.size(), handles.data());
+      return true;
+    case HandleType::kFrameBuffer:
+      gl.DeleteFramebuffers(handles.size(), handles.data());
       return true;
   }
   return false;
@@ -137,18 +244,29 @@ HandleGLES ReactorGLES::CreateHandle(HandleType type) {
   if (new_handle.IsDead()) {
     return HandleGLES::DeadHandle();
   }
-  WriterLock handles_lock(handles_mutex_);
-  auto gl_handle = CanReactOnCurrentThread()
-                       ? CreateGLHandle(GetProcTable(), type)
-                       : std::nullopt;
-  handles_[new_handle] = LiveHandle{gl_handle};
+  std::optional<GLuint> gl_handle;
+  {
+    WriterLock handles_lock(handles_mutex_);
+    gl_handle = CanReactOnCurrentThread()
+                    ? CreateGLHandle(GetProcTable(), type)
+                    : std::nullopt;
+    handles_[new_handle] = LiveHandle{gl_handle};
+  }
+  if (!gl_handle.has_value() && IsSharedHandleType(type)) {
+    ScheduleBackgroundReaction();
+  }
   return new_handle;
 }
 
 void ReactorGLES::CollectHandle(HandleGLES handle) {
-  WriterLock handles_lock(handles_mutex_);
-  if (auto found = handles_.find(handle); found != handles_.end()) {
-    found->second.pending_collection = true;
+  {
+    WriterLock handles_lock(handles_mutex_);
+    if (auto found = handles_.find(handle); found != handles_.end()) {
+      found->second.pending_collection = true;
+    }
+  }
+  if (IsSharedHandleType(handle.type)) {
+    ScheduleBackgroundReaction();
   }
 }
 
@@ -157,6 +275,7 @@ bool ReactorGLES::React() {
     return false;
   }
   TRACE_EVENT0("impeller", "ReactorGLES::React");
+  std::scoped_lock reaction_lock(reaction_mutex_);
   while (HasPendingOperations()) {
     if (!ReactOnce()) {
       return false;
@@ -188,61 +307,94 @@ bool ReactorGLES::ReactOnce() {
     return false;
   }
   TRACE_EVENT0("impeller", __FUNCTION__);
-  return ConsolidateHandles() && FlushOps();
+  return ConsolidateHandles(false) && FlushOps(false);
 }
 
-bool ReactorGLES::ConsolidateHandles() {
+bool ReactorGLES::ConsolidateHandles(bool shared_handles_only) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   const auto& gl = GetProcTable();
   WriterLock handles_lock(handles_mutex_);
+  // Names are created and deleted with one call per handle type.
+  std::map<HandleType, std::vector<LiveHandle*>> handles_to_create;
+  std::map<HandleType, std::vector<GLuint>> names_to_delete;
   std::vector<HandleGLES> handles_to_delete;
   for (auto& handle : handles_) {
+    if (shared_handles_only && !IsSharedHandleType(handle.first.type)) {
+      continue;
+    }
     // Collect dead handles.
     if (handle.second.pending_collection) {
       // This could be false if the handle was created and collected without
       // use. We still need to get rid of map entry.
       if (handle.second.name.has_value()) {
-        CollectGLHandle(gl, handle.first.type, handle.second.name.value());
+        names_to_delete[handle.first.type].push_back(
+            handle.second.name.value());
       }
       handles_to_delete.push_back(handle.first);
       continue;
     }
     // Create live handles.
     if (!handle.second.name.has_value()) {
-      auto gl_handle = CreateGLHandle(gl, handle.first.type);
-      if (!gl_handle) {
-        VALIDATION_LOG << "Could not create GL handle.";
-        return false;
-      }
-      handle.second.name = gl_handle;
-    }
-    // Set pending debug labels.
-    if (handle.second.pending_debug_label.has_value()) {
-      if (gl.SetDebugLabel(ToDebugResourceType(handle.first.type),
-                           handle.second.name.value(),
-                           handle.second.pending_debug_label.value())) {
-        handle.second.pending_debug_label = std::nullopt;
-      }
+      handles_to_create[handle.first.type].push_back(&handle.second);
     }
   }
+
+  for (const auto& [type, names] : names_to_delete) {
+    CollectGLHandles(gl, type, names);
+  }
   for (const auto& handle_to_delete : handles_to_delete) {
     handles_.erase(handle_to_delete);
   }
+
+  for (auto& [type, live_handles] : handles_to_create) {
+    std::vector<GLuint> names(live_handles.size(), GL_NONE);
+    if (!CreateGLHandles(gl, type, names)) {
+      VALIDATION_LOG << "Could not create GL handles.";
+      return false;
+    }
+    for (size_t i = 0; i < live_handles.size(); i++) {
+      live_handles[i]->name = names[i];
+    }
+  }
+
+  // Set pending debug labels.
+  for (auto& handle : handles_) {
+    if (!handle.second.name.has_value() ||
+        !handle.second.pending_debug_label.has_value()) {
+      continue;
+    }
+    if (gl.SetDebugLabel(ToDebugResourceType(handle.first.type),
+                         handle.second.name.value(),
+                         handle.second.pending_debug_label.value())) {
+      handle.second.pending_debug_label = std::nullopt;
+    }
+  }
   return true;
 }
 
-bool ReactorGLES::FlushOps() {
+bool ReactorGLES::FlushOps(bool background_safe_only) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   // Do NOT hold the ops or handles locks while performing operations in case
   // the ops enqueue more ops.
   decltype(ops_) ops;
   {
     Lock ops_lock(ops_mutex_);
-    std::swap(ops_, ops);
+    if (background_safe_only) {
+      // Operations must be performed in order. Only take the leading run of
+      // background safe operations and leave the rest for a full reaction.
+      auto first_unsafe =
+          std::find_if(ops_.begin(), ops_.end(),
+                       [](const auto& op) { return !op.background_safe; });
+      ops.insert(ops.end(), std::make_move_iterator(ops_.begin()),
+                 std::make_move_iterator(first_unsafe));
+      ops_.erase(ops_.begin(), first_unsafe);
+    } else {
+      std::swap(ops_, ops);
+    }
   }
   for (const auto& op : ops) {
     TRACE_EVENT0("impeller", "ReactorGLES::Operation");
-    op(*this);
+    op.operation(*this);
   }
   return true;
 }
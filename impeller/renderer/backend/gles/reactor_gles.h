@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "flutter/fml/closure.h"
@@ -13,10 +16,11 @@
 #include "impeller/base/thread.h"
 #include "impeller/renderer/backend/gles/handle_gles.h"
 #include "impeller/renderer/backend/gles/proc_table_gles.h"
+#include "impeller/renderer/backend/gles/state_tracker_gles.h"
 
 namespace impeller {
 
-class ReactorGLES {
+class ReactorGLES : public std::enable_shared_from_this<ReactorGLES> {
  public:
   using WorkerID = UniqueID;
 
@@ -42,6 +46,13 @@ class ReactorGLES {
 
   const ProcTableGLES& GetProcTable() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The shadow of GL state used to filter redundant state changes
+  ///             while encoding render passes. Only valid to use from within
+  ///             an operation, as reactions are serialized.
+  ///
+  StateTrackerGLES& GetStateTracker() const;
+
   std::optional<GLuint> GetGLHandle(const HandleGLES& handle) const;
 
   HandleGLES CreateHandle(HandleType type);
@@ -53,8 +64,35 @@ class ReactorGLES {
   using Operation = std::function<void(const ReactorGLES& reactor)>;
   [[nodiscard]] bool AddOperation(Operation operation);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Add an operation that only touches objects shared between
+  ///             all contexts in the share group (textures, buffers and
+  ///             programs) and does not depend on the bound framebuffer. Such
+  ///             operations may also be performed by a background reaction.
+  ///
+  [[nodiscard]] bool AddBackgroundOperation(Operation operation);
+
   [[nodiscard]] bool React();
 
+  using BackgroundDispatcher = std::function<void(fml::closure)>;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Set a dispatcher that runs closures on a thread whose context
+  ///             is in the same share group as the workers' (typically the IO
+  ///             thread's resource context).
+  ///
+  ///             When handles are created or collected, or background
+  ///             operations added, on a thread that cannot react, the reactor
+  ///             schedules a reaction through this dispatcher. That reaction
+  ///             creates and collects pending handles in batches and performs
+  ///             queued background operations, so this work no longer waits
+  ///             for the next reaction in the middle of a frame.
+  ///
+  /// @param[in]  dispatcher  The dispatcher. May be null to stop scheduling
+  ///                         background reactions.
+  ///
+  void SetBackgroundDispatcher(BackgroundDispatcher dispatcher);
+
  private:
   struct LiveHandle {
     std::optional<GLuint> name;
@@ -69,10 +107,26 @@ class ReactorGLES {
     constexpr bool IsLive() const { return name.has_value(); }
   };
 
+  struct PendingOperation {
+    Operation operation;
+    bool background_safe = false;
+  };
+
   std::unique_ptr<ProcTableGLES> proc_table_;
+  std::unique_ptr<StateTrackerGLES> state_tracker_;
 
   mutable Mutex ops_mutex_;
-  std::vector<Operation> ops_ IPLR_GUARDED_BY(ops_mutex_);
+  std::vector<PendingOperation> ops_ IPLR_GUARDED_BY(ops_mutex_);
+
+  // Only one thread may react at a time so that objects created or uploaded
+  // by a background reaction are complete before another thread uses them.
+  // Operations may react recursively.
+  std::recursive_mutex reaction_mutex_;
+
+  Mutex dispatcher_mutex_;
+  BackgroundDispatcher background_dispatcher_
+      IPLR_GUARDED_BY(dispatcher_mutex_);
+  std::atomic_bool background_reaction_pending_ = false;
 
   // Make sure the container is one where erasing items during iteration doesn't
   // invalidate other iterators.
@@ -96,9 +150,15 @@ class ReactorGLES {
 
   bool CanReactOnCurrentThread() const;
 
-  bool ConsolidateHandles();
+  bool ConsolidateHandles(bool shared_handles_only);
+
+  bool FlushOps(bool background_safe_only);
+
+  bool EnqueueOperation(Operation operation, bool background_safe);
+
+  void ScheduleBackgroundReaction();
 
-  bool FlushOps();
+  void ReactInBackground();
 
   FML_DISALLOW_COPY_AND_ASSIGN(ReactorGLES);
 };
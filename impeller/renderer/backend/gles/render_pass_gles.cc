@@ -11,6 +11,7 @@
 #include "impeller/base/validation.h"
 #include "impeller/renderer/backend/gles/device_buffer_gles.h"
 #include "impeller/renderer/backend/gles/formats_gles.h"
+#include "impeller/renderer/backend/gles/gpu_tracer_gles.h"
 #include "impeller/renderer/backend/gles/pipeline_gles.h"
 #include "impeller/renderer/backend/gles/texture_gles.h"
 
@@ -36,14 +37,14 @@ void RenderPassGLES::OnSetLabel(std::string label) {
   label_ = std::move(label);
 }
 
-void ConfigureBlending(const ProcTableGLES& gl,
+void ConfigureBlending(StateTrackerGLES& gl,
                        const ColorAttachmentDescriptor* color) {
   if (!color->blending_enabled) {
-    gl.Disable(GL_BLEND);
+    gl.SetEnabled(GL_BLEND, false);
     return;
   }
 
-  gl.Enable(GL_BLEND);
+  gl.SetEnabled(GL_BLEND, true);
   gl.BlendFuncSeparate(
       ToBlendFactor(color->src_color_blend_factor),  // src color
       ToBlendFactor(color->dst_color_blend_factor),  // dst color
@@ -72,7 +73,7 @@ void ConfigureBlending(const ProcTableGLES& gl,
 }
 
 void ConfigureStencil(GLenum face,
-                      const ProcTableGLES& gl,
+                      StateTrackerGLES& gl,
                       const StencilAttachmentDescriptor& stencil,
                       uint32_t stencil_reference) {
   gl.StencilOpSeparate(
@@ -89,15 +90,15 @@ void ConfigureStencil(GLenum face,
   gl.StencilMaskSeparate(face, stencil.write_mask);
 }
 
-void ConfigureStencil(const ProcTableGLES& gl,
+void ConfigureStencil(StateTrackerGLES& gl,
                       const PipelineDescriptor& pipeline,
                       uint32_t stencil_reference) {
   if (!pipeline.HasStencilAttachmentDescriptors()) {
-    gl.Disable(GL_STENCIL_TEST);
+    gl.SetEnabled(GL_STENCIL_TEST, false);
     return;
   }
 
-  gl.Enable(GL_STENCIL_TEST);
+  gl.SetEnabled(GL_STENCIL_TEST, true);
   const auto& front = pipeline.GetFrontStencilAttachmentDescriptor();
   const auto& back = pipeline.GetBackStencilAttachmentDescriptor();
   if (front == back) {
@@ -123,6 +124,9 @@ struct RenderPassData {
   Scalar clear_depth = 1.0;
 
   std::shared_ptr<Texture> color_attachment;
+  // The samples to render the color attachment with before it is implicitly
+  // resolved.
+  SampleCount color_attachment_samples = SampleCount::kCount1;
   std::shared_ptr<Texture> depth_attachment;
   std::shared_ptr<Texture> stencil_attachment;
 
@@ -135,6 +139,8 @@ struct RenderPassData {
   bool discard_stencil_attachment = true;
 
   std::string label;
+
+  std::shared_ptr<GPUTracer> gpu_tracer;
 };
 
 [[nodiscard]] bool EncodeCommandsInReactor(
@@ -149,6 +155,10 @@ struct RenderPassData {
   }
 
   const auto& gl = reactor.GetProcTable();
+  auto& state_tracker = reactor.GetStateTracker();
+  // GL state may have been modified outside of Impeller since the last pass.
+  state_tracker.Invalidate();
+  const auto filtered_calls_before = state_tracker.GetFilteredCallCount();
 
   fml::ScopedCleanupClosure pop_pass_debug_marker(
       [&gl]() { gl.PopDebugGroup(); });
@@ -158,6 +168,16 @@ struct RenderPassData {
     pop_pass_debug_marker.Release();
   }
 
+  fml::ScopedCleanupClosure end_gpu_region([&gl, &pass_data]() {
+    GPUTracerGLES::Cast(*pass_data.gpu_tracer).EndRegion(gl);
+  });
+  if (!pass_data.gpu_tracer ||
+      !GPUTracerGLES::Cast(*pass_data.gpu_tracer)
+           .BeginRegion(gl, pass_data.label.empty() ? "RenderPassGLES"
+                                                    : pass_data.label)) {
+    end_gpu_region.Release();
+  }
+
   GLuint fbo = GL_NONE;
   fml::ScopedCleanupClosure delete_fbo([&gl, &fbo]() {
     if (fbo != GL_NONE) {
@@ -176,7 +196,8 @@ struct RenderPassData {
 
     if (auto color = TextureGLES::Cast(pass_data.color_attachment.get())) {
       if (!color->SetAsFramebufferAttachment(
-              GL_FRAMEBUFFER, fbo, TextureGLES::AttachmentPoint::kColor0)) {
+              GL_FRAMEBUFFER, fbo, TextureGLES::AttachmentPoint::kColor0,
+              pass_data.color_attachment_samples)) {
         return false;
       }
     }
@@ -222,15 +243,32 @@ struct RenderPassData {
     clear_bits |= GL_STENCIL_BUFFER_BIT;
   }
 
-  gl.Disable(GL_SCISSOR_TEST);
-  gl.Disable(GL_DEPTH_TEST);
-  gl.Disable(GL_STENCIL_TEST);
-  gl.Disable(GL_CULL_FACE);
-  gl.Disable(GL_BLEND);
-  gl.ColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+  state_tracker.SetEnabled(GL_SCISSOR_TEST, false);
+  state_tracker.SetEnabled(GL_DEPTH_TEST, false);
+  state_tracker.SetEnabled(GL_STENCIL_TEST, false);
+  state_tracker.SetEnabled(GL_CULL_FACE, false);
+  state_tracker.SetEnabled(GL_BLEND, false);
+  state_tracker.ColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
   gl.Clear(clear_bits);
 
+  //----------------------------------------------------------------------------
+  /// Use a vertex array object for the pass where available. Like the FBO,
+  /// it is not shared between contexts and so is created by the pass.
+  ///
+  GLuint vao = GL_NONE;
+  fml::ScopedCleanupClosure delete_vao([&gl, &state_tracker, &vao]() {
+    if (vao != GL_NONE) {
+      state_tracker.BindVertexArray(GL_NONE);
+      gl.DeleteVertexArrays(1u, &vao);
+    }
+  });
+  if (gl.GetCapabilities()->supports_vertex_array_objects) {
+    gl.GenVertexArrays(1u, &vao);
+    state_tracker.BindVertexArray(vao);
+  }
+
+  BufferBindingsGLES::UniformUploadStats uniform_upload_stats;
   for (const auto& command : commands) {
     if (command.instance_count != 1u) {
       VALIDATION_LOG << "GLES backend does not support instanced rendering.";
@@ -263,12 +301,13 @@ struct RenderPassData {
     //--------------------------------------------------------------------------
     /// Configure blending.
     ///
-    ConfigureBlending(gl, color_attachment);
+    ConfigureBlending(state_tracker, color_attachment);
 
     //--------------------------------------------------------------------------
     /// Setup stencil.
     ///
-    ConfigureStencil(gl, pipeline.GetDescriptor(), command.stencil_reference);
+    ConfigureStencil(state_tracker, pipeline.GetDescriptor(),
+                     command.stencil_reference);
 
     //--------------------------------------------------------------------------
     /// Configure depth.
@@ -276,11 +315,11 @@ struct RenderPassData {
     if (auto depth =
             pipeline.GetDescriptor().GetDepthStencilAttachmentDescriptor();
         depth.has_value()) {
-      gl.Enable(GL_DEPTH_TEST);
-      gl.DepthFunc(ToCompareFunction(depth->depth_compare));
-      gl.DepthMask(depth->depth_write_enabled ? GL_TRUE : GL_FALSE);
+      state_tracker.SetEnabled(GL_DEPTH_TEST, true);
+      state_tracker.DepthFunc(ToCompareFunction(depth->depth_compare));
+      state_tracker.DepthMask(depth->depth_write_enabled ? GL_TRUE : GL_FALSE);
     } else {
-      gl.Disable(GL_DEPTH_TEST);
+      state_tracker.SetEnabled(GL_DEPTH_TEST, false);
     }
 
     // Both the viewport and scissor are specified in framebuffer coordinates.
@@ -292,14 +331,15 @@ struct RenderPassData {
     /// Setup the viewport.
     ///
     const auto& viewport = command.viewport.value_or(pass_data.viewport);
-    gl.Viewport(viewport.rect.origin.x,  // x
-                target_size.height - viewport.rect.origin.y -
-                    viewport.rect.size.height,  // y
-                viewport.rect.size.width,       // width
-                viewport.rect.size.height       // height
+    state_tracker.Viewport(viewport.rect.origin.x,  // x
+                           target_size.height - viewport.rect.origin.y -
+                               viewport.rect.size.height,  // y
+                           viewport.rect.size.width,       // width
+                           viewport.rect.size.height       // height
     );
     if (pass_data.depth_attachment) {
-      gl.DepthRangef(viewport.depth_range.z_near, viewport.depth_range.z_far);
+      state_tracker.DepthRangef(viewport.depth_range.z_near,
+                                viewport.depth_range.z_far);
     }
 
     //--------------------------------------------------------------------------
@@ -307,15 +347,15 @@ struct RenderPassData {
     ///
     if (command.scissor.has_value()) {
       const auto& scissor = command.scissor.value();
-      gl.Enable(GL_SCISSOR_TEST);
-      gl.Scissor(
+      state_tracker.SetEnabled(GL_SCISSOR_TEST, true);
+      state_tracker.Scissor(
           scissor.origin.x,                                             // x
           target_size.height - scissor.origin.y - scissor.size.height,  // y
           scissor.size.width,                                           // width
           scissor.size.height  // height
       );
     } else {
-      gl.Disable(GL_SCISSOR_TEST);
+      state_tracker.SetEnabled(GL_SCISSOR_TEST, false);
     }
 
     //--------------------------------------------------------------------------
@@ -323,15 +363,15 @@ struct RenderPassData {
     ///
     switch (pipeline.GetDescriptor().GetCullMode()) {
       case CullMode::kNone:
-        gl.Disable(GL_CULL_FACE);
+        state_tracker.SetEnabled(GL_CULL_FACE, false);
         break;
       case CullMode::kFrontFace:
-        gl.Enable(GL_CULL_FACE);
-        gl.CullFace(GL_FRONT);
+        state_tracker.SetEnabled(GL_CULL_FACE, true);
+        state_tracker.CullFace(GL_FRONT);
         break;
       case CullMode::kBackFace:
-        gl.Enable(GL_CULL_FACE);
-        gl.CullFace(GL_BACK);
+        state_tracker.SetEnabled(GL_CULL_FACE, true);
+        state_tracker.CullFace(GL_BACK);
         break;
     }
     //--------------------------------------------------------------------------
@@ -339,10 +379,10 @@ struct RenderPassData {
     ///
     switch (pipeline.GetDescriptor().GetWindingOrder()) {
       case WindingOrder::kClockwise:
-        gl.FrontFace(GL_CW);
+        state_tracker.FrontFace(GL_CW);
         break;
       case WindingOrder::kCounterClockwise:
-        gl.FrontFace(GL_CCW);
+        state_tracker.FrontFace(GL_CCW);
         break;
     }
 
@@ -393,17 +433,18 @@ struct RenderPassData {
     /// Bind vertex attribs.
     ///
     if (!vertex_desc_gles->BindVertexAttributes(
-            gl, vertex_buffer_view.range.offset)) {
+            gl, state_tracker, vertex_buffer_view.range.offset)) {
       return false;
     }
 
     //--------------------------------------------------------------------------
     /// Bind uniform data.
     ///
-    if (!vertex_desc_gles->BindUniformData(gl,                        //
-                                           *transients_allocator,     //
-                                           command.vertex_bindings,   //
-                                           command.fragment_bindings  //
+    if (!vertex_desc_gles->BindUniformData(gl,                         //
+                                           *transients_allocator,      //
+                                           command.vertex_bindings,    //
+                                           command.fragment_bindings,  //
+                                           uniform_upload_stats        //
                                            )) {
       return false;
     }
@@ -419,21 +460,28 @@ struct RenderPassData {
                         index_buffer_view.range.offset))  // indices
     );
 
-    //--------------------------------------------------------------------------
-    /// Unbind vertex attribs.
-    ///
-    if (!vertex_desc_gles->UnbindVertexAttributes(gl)) {
-      return false;
-    }
-
-    //--------------------------------------------------------------------------
-    /// Unbind the program pipeline.
-    ///
-    if (!pipeline.UnbindProgram()) {
-      return false;
-    }
   }
 
+  //----------------------------------------------------------------------------
+  /// Vertex attribs and the program are left bound between commands so that
+  /// consecutive commands sharing them don't rebind. Unbind them once the
+  /// pass is done.
+  ///
+  state_tracker.DisableVertexAttribArrays();
+  state_tracker.UseProgram(GL_NONE);
+
+  FML_TRACE_COUNTER("impeller", "UniformUploadsGLES",
+                    reinterpret_cast<int64_t>(&reactor),     //
+                    "issued", uniform_upload_stats.issued,   //
+                    "skipped", uniform_upload_stats.skipped  //
+  );
+  FML_TRACE_COUNTER("impeller", "FilteredStateChangesGLES",
+                    reinterpret_cast<int64_t>(&reactor),  //
+                    "calls",
+                    state_tracker.GetFilteredCallCount() -
+                        filtered_calls_before  //
+  );
+
   if (gl.DiscardFramebufferEXT.IsAvailable()) {
     std::vector<GLenum> attachments;
     if (pass_data.discard_color_attachment) {
@@ -475,6 +523,7 @@ bool RenderPassGLES::OnEncodeCommands(const Context& context) const {
 
   auto pass_data = std::make_shared<RenderPassData>();
   pass_data->label = label_;
+  pass_data->gpu_tracer = context.GetGPUTracer();
   pass_data->viewport.rect = Rect::MakeSize(GetRenderTargetSize());
 
   //----------------------------------------------------------------------------
@@ -485,6 +534,22 @@ bool RenderPassGLES::OnEncodeCommands(const Context& context) const {
   pass_data->clear_color_attachment = CanClearAttachment(color0.load_action);
   pass_data->discard_color_attachment =
       CanDiscardAttachmentWhenDone(color0.store_action);
+  if (color0.resolve_texture) {
+    // Multisampled passes render straight into the resolve texture, so the
+    // multisampled color texture is never attached and never gets storage.
+    // With GL_EXT_multisampled_render_to_texture the samples only live in
+    // tile memory and are resolved as the tiles are written out, which saves
+    // both the multisampled attachment and a blit to resolve it. Otherwise
+    // the pass is rendered without multisampling.
+    pass_data->color_attachment = color0.resolve_texture;
+    if (reactor_->GetProcTable().GetCapabilities()->supports_implicit_msaa) {
+      pass_data->color_attachment_samples =
+          color0.texture->GetTextureDescriptor().sample_count;
+    }
+    // Discarding the attachment would discard the resolved contents.
+    pass_data->discard_color_attachment =
+        color0.store_action == StoreAction::kDontCare;
+  }
 
   //----------------------------------------------------------------------------
   /// Setup depth data.
@@ -0,0 +1,207 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/gles/state_tracker_gles.h"
+
+#include <algorithm>
+
+namespace impeller {
+
+StateTrackerGLES::StateTrackerGLES(const ProcTableGLES& gl) : gl_(gl) {}
+
+StateTrackerGLES::~StateTrackerGLES() = default;
+
+void StateTrackerGLES::Invalidate() {
+  capabilities_.clear();
+  blend_func_.reset();
+  blend_equation_.reset();
+  color_mask_.reset();
+  stencil_op_ = {};
+  stencil_func_ = {};
+  stencil_mask_ = {};
+  depth_func_.reset();
+  depth_mask_.reset();
+  depth_range_.reset();
+  viewport_.reset();
+  scissor_.reset();
+  cull_face_.reset();
+  front_face_.reset();
+  program_.reset();
+  vertex_array_.reset();
+  vertex_attrib_arrays_.clear();
+}
+
+StateTrackerGLES::FaceMask StateTrackerGLES::GetFaces(GLenum face) {
+  switch (face) {
+    case GL_FRONT:
+      return {true, false};
+    case GL_BACK:
+      return {false, true};
+    case GL_FRONT_AND_BACK:
+      return {true, true};
+  }
+  return {false, false};
+}
+
+void StateTrackerGLES::SetEnabled(GLenum capability, bool enabled) {
+  if (auto found = capabilities_.find(capability);
+      found != capabilities_.end() && found->second == enabled) {
+    filtered_call_count_++;
+    return;
+  }
+  capabilities_[capability] = enabled;
+  if (enabled) {
+    gl_.Enable(capability);
+  } else {
+    gl_.Disable(capability);
+  }
+}
+
+void StateTrackerGLES::BlendFuncSeparate(GLenum src_color,
+                                         GLenum dst_color,
+                                         GLenum src_alpha,
+                                         GLenum dst_alpha) {
+  if (Update(blend_func_,
+             std::make_tuple(src_color, dst_color, src_alpha, dst_alpha))) {
+    gl_.BlendFuncSeparate(src_color, dst_color, src_alpha, dst_alpha);
+  }
+}
+
+void StateTrackerGLES::BlendEquationSeparate(GLenum mode_color,
+                                             GLenum mode_alpha) {
+  if (Update(blend_equation_, std::make_tuple(mode_color, mode_alpha))) {
+    gl_.BlendEquationSeparate(mode_color, mode_alpha);
+  }
+}
+
+void StateTrackerGLES::ColorMask(GLboolean red,
+                                 GLboolean green,
+                                 GLboolean blue,
+                                 GLboolean alpha) {
+  if (Update(color_mask_, std::make_tuple(red, green, blue, alpha))) {
+    gl_.ColorMask(red, green, blue, alpha);
+  }
+}
+
+void StateTrackerGLES::StencilOpSeparate(GLenum face,
+                                         GLenum stencil_fail,
+                                         GLenum depth_fail,
+                                         GLenum depth_stencil_pass) {
+  if (UpdateFaces(stencil_op_, face,
+                  StencilOp{stencil_fail, depth_fail, depth_stencil_pass})) {
+    gl_.StencilOpSeparate(face, stencil_fail, depth_fail, depth_stencil_pass);
+  }
+}
+
+void StateTrackerGLES::StencilFuncSeparate(GLenum face,
+                                           GLenum func,
+                                           GLint ref,
+                                           GLuint mask) {
+  if (UpdateFaces(stencil_func_, face, StencilFunc{func, ref, mask})) {
+    gl_.StencilFuncSeparate(face, func, ref, mask);
+  }
+}
+
+void StateTrackerGLES::StencilMaskSeparate(GLenum face, GLuint mask) {
+  if (UpdateFaces(stencil_mask_, face, mask)) {
+    gl_.StencilMaskSeparate(face, mask);
+  }
+}
+
+void StateTrackerGLES::DepthFunc(GLenum func) {
+  if (Update(depth_func_, func)) {
+    gl_.DepthFunc(func);
+  }
+}
+
+void StateTrackerGLES::DepthMask(GLboolean mask) {
+  if (Update(depth_mask_, mask)) {
+    gl_.DepthMask(mask);
+  }
+}
+
+void StateTrackerGLES::DepthRangef(GLfloat z_near, GLfloat z_far) {
+  if (Update(depth_range_, std::make_tuple(z_near, z_far))) {
+    gl_.DepthRangef(z_near, z_far);
+  }
+}
+
+void StateTrackerGLES::Viewport(GLint x,
+                                GLint y,
+                                GLsizei width,
+                                GLsizei height) {
+  if (Update(viewport_, std::make_tuple(x, y, width, height))) {
+    gl_.Viewport(x, y, width, height);
+  }
+}
+
+void StateTrackerGLES::Scissor(GLint x,
+                               GLint y,
+                               GLsizei width,
+                               GLsizei height) {
+  if (Update(scissor_, std::make_tuple(x, y, width, height))) {
+    gl_.Scissor(x, y, width, height);
+  }
+}
+
+void StateTrackerGLES::CullFace(GLenum mode) {
+  if (Update(cull_face_, mode)) {
+    gl_.CullFace(mode);
+  }
+}
+
+void StateTrackerGLES::FrontFace(GLenum mode) {
+  if (Update(front_face_, mode)) {
+    gl_.FrontFace(mode);
+  }
+}
+
+void StateTrackerGLES::UseProgram(GLuint program) {
+  if (Update(program_, program)) {
+    gl_.UseProgram(program);
+  }
+}
+
+void StateTrackerGLES::BindVertexArray(GLuint vertex_array) {
+  if (Update(vertex_array_, vertex_array)) {
+    gl_.BindVertexArray(vertex_array);
+    // Enabled attribute arrays are vertex array object state.
+    vertex_attrib_arrays_.clear();
+  }
+}
+
+void StateTrackerGLES::SetEnabledVertexAttribArrays(
+    const std::vector<GLuint>& indices) {
+  for (auto& [index, enabled] : vertex_attrib_arrays_) {
+    if (enabled &&
+        std::find(indices.begin(), indices.end(), index) == indices.end()) {
+      gl_.DisableVertexAttribArray(index);
+      enabled = false;
+    }
+  }
+  for (auto index : indices) {
+    auto& enabled = vertex_attrib_arrays_[index];
+    if (enabled) {
+      filtered_call_count_++;
+      continue;
+    }
+    gl_.EnableVertexAttribArray(index);
+    enabled = true;
+  }
+}
+
+void StateTrackerGLES::DisableVertexAttribArrays() {
+  for (auto& [index, enabled] : vertex_attrib_arrays_) {
+    if (enabled) {
+      gl_.DisableVertexAttribArray(index);
+      enabled = false;
+    }
+  }
+}
+
+size_t StateTrackerGLES::GetFilteredCallCount() const {
+  return filtered_call_count_;
+}
+
+}  // namespace impeller
@@ -0,0 +1,163 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/renderer/backend/gles/gles.h"
+#include "impeller/renderer/backend/gles/proc_table_gles.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A shadow of the fixed function GL state set while encoding
+///             render passes. Calls that would set state to the value it
+///             already has are filtered out.
+///
+///             The shadow only knows about state set through it. Anything
+///             else may modify GL state (other GL clients in the process,
+///             operations that don't go through the tracker), so the tracker
+///             must be invalidated before it is relied upon again, e.g. at
+///             the start of each render pass.
+///
+class StateTrackerGLES {
+ public:
+  explicit StateTrackerGLES(const ProcTableGLES& gl);
+
+  ~StateTrackerGLES();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Forget all shadowed state. The next call for each piece of
+  ///             state always reaches GL.
+  ///
+  void Invalidate();
+
+  void SetEnabled(GLenum capability, bool enabled);
+
+  void BlendFuncSeparate(GLenum src_color,
+                         GLenum dst_color,
+                         GLenum src_alpha,
+                         GLenum dst_alpha);
+
+  void BlendEquationSeparate(GLenum mode_color, GLenum mode_alpha);
+
+  void ColorMask(GLboolean red,
+                 GLboolean green,
+                 GLboolean blue,
+                 GLboolean alpha);
+
+  void StencilOpSeparate(GLenum face,
+                         GLenum stencil_fail,
+                         GLenum depth_fail,
+                         GLenum depth_stencil_pass);
+
+  void StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask);
+
+  void StencilMaskSeparate(GLenum face, GLuint mask);
+
+  void DepthFunc(GLenum func);
+
+  void DepthMask(GLboolean mask);
+
+  void DepthRangef(GLfloat z_near, GLfloat z_far);
+
+  void Viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+  void Scissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+  void CullFace(GLenum mode);
+
+  void FrontFace(GLenum mode);
+
+  void UseProgram(GLuint program);
+
+  void BindVertexArray(GLuint vertex_array);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Enable exactly the given vertex attribute arrays. Arrays
+  ///             previously enabled through the tracker that are not in the
+  ///             list are disabled.
+  ///
+  void SetEnabledVertexAttribArrays(const std::vector<GLuint>& indices);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Disable all vertex attribute arrays enabled through the
+  ///             tracker.
+  ///
+  void DisableVertexAttribArrays();
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of calls filtered out since the tracker was
+  ///             created.
+  ///
+  size_t GetFilteredCallCount() const;
+
+ private:
+  using StencilOp = std::tuple<GLenum, GLenum, GLenum>;
+  using StencilFunc = std::tuple<GLenum, GLint, GLuint>;
+
+  // Front and back faces.
+  using FaceMask = std::array<bool, 2>;
+
+  const ProcTableGLES& gl_;
+  std::map<GLenum, bool> capabilities_;
+  std::optional<std::tuple<GLenum, GLenum, GLenum, GLenum>> blend_func_;
+  std::optional<std::tuple<GLenum, GLenum>> blend_equation_;
+  std::optional<std::tuple<GLboolean, GLboolean, GLboolean, GLboolean>>
+      color_mask_;
+  std::array<std::optional<StencilOp>, 2> stencil_op_;
+  std::array<std::optional<StencilFunc>, 2> stencil_func_;
+  std::array<std::optional<GLuint>, 2> stencil_mask_;
+  std::optional<GLenum> depth_func_;
+  std::optional<GLboolean> depth_mask_;
+  std::optional<std::tuple<GLfloat, GLfloat>> depth_range_;
+  std::optional<std::tuple<GLint, GLint, GLsizei, GLsizei>> viewport_;
+  std::optional<std::tuple<GLint, GLint, GLsizei, GLsizei>> scissor_;
+  std::optional<GLenum> cull_face_;
+  std::optional<GLenum> front_face_;
+  std::optional<GLuint> program_;
+  std::optional<GLuint> vertex_array_;
+  std::map<GLuint, bool> vertex_attrib_arrays_;
+  size_t filtered_call_count_ = 0u;
+
+  static FaceMask GetFaces(GLenum face);
+
+  template <class T>
+  bool Update(std::optional<T>& shadow, const T& value) {
+    if (shadow.has_value() && shadow.value() == value) {
+      filtered_call_count_++;
+      return false;
+    }
+    shadow = value;
+    return true;
+  }
+
+  template <class T>
+  bool UpdateFaces(std::array<std::optional<T>, 2>& shadow,
+                   GLenum face,
+                   const T& value) {
+    const auto faces = GetFaces(face);
+    bool changed = false;
+    for (size_t i = 0; i < faces.size(); i++) {
+      if (faces[i] && shadow[i] != value) {
+        shadow[i] = value;
+        changed = true;
+      }
+    }
+    if (!changed) {
+      filtered_call_count_++;
+    }
+    return changed;
+  }
+
+  FML_DISALLOW_COPY_AND_ASSIGN(StateTrackerGLES);
+};
+
+}  // namespace impeller
@@ -90,6 +90,7 @@ struct TexImage2DData {
   GLint internal_format = 0;
   GLenum external_format = GL_NONE;
   GLenum type = GL_NONE;
+  bool is_compressed = false;
   std::shared_ptr<const fml::Mapping> data;
 
   explicit TexImage2DData(PixelFormat pixel_format) {
@@ -111,6 +112,13 @@ struct TexImage2DData {
       case PixelFormat::kS8UInt:
       case PixelFormat::kR8UNormInt:
       case PixelFormat::kR8G8UNormInt:
+      // Compressed textures have no storage until their contents are set.
+      case PixelFormat::kASTC4x4UNormInt:
+      case PixelFormat::kETC2R8G8B8UNormInt:
+      case PixelFormat::kETC2R8G8B8A8UNormInt:
+      case PixelFormat::kBC1R8G8B8A8UNormInt:
+      case PixelFormat::kBC3R8G8B8A8UNormInt:
+      case PixelFormat::kBC7R8G8B8A8UNormInt:
         return;
     }
     is_valid_ = true;
@@ -147,6 +155,17 @@ struct TexImage2DData {
         return;
       case PixelFormat::kR8G8UNormInt:
         return;
+      case PixelFormat::kASTC4x4UNormInt:
+      case PixelFormat::kETC2R8G8B8UNormInt:
+      case PixelFormat::kETC2R8G8B8A8UNormInt:
+      case PixelFormat::kBC1R8G8B8A8UNormInt:
+      case PixelFormat::kBC3R8G8B8A8UNormInt:
+      case PixelFormat::kBC7R8G8B8A8UNormInt: {
+        internal_format = ToCompressedTextureFormat(pixel_format).value();
+        is_compressed = true;
+        data = std::move(mapping);
+        break;
+      }
     }
     is_valid_ = true;
   }
@@ -228,9 +247,11 @@ bool TextureGLES::OnSetContents(std::shared_ptr<const fml::Mapping> mapping,
     return false;
   }
 
+  const GLsizei image_size = tex_descriptor.GetByteSizeOfBaseMipLevel();
   ReactorGLES::Operation texture_upload = [handle = handle_,            //
                                            data,                        //
                                            size = tex_descriptor.size,  //
+                                           image_size,                  //
                                            texture_type,                //
                                            texture_target               //
   ](const auto& reactor) {
@@ -247,6 +268,21 @@ bool TextureGLES::OnSetContents(std::shared_ptr<const fml::Mapping> mapping,
       tex_data = data->data->GetMapping();
     }
 
+    if (data->is_compressed) {
+      TRACE_EVENT1("impeller", "CompressedTexImage2DUpload", "Bytes",
+                   std::to_string(image_size).c_str());
+      gl.CompressedTexImage2D(texture_target,         // target
+                              0u,                     // LOD level
+                              data->internal_format,  // internal format
+                              size.width,             // width
+                              size.height,            // height
+                              0u,                     // border
+                              image_size,             // image size
+                              tex_data                // data
+      );
+      return;
+    }
+
     {
       TRACE_EVENT1("impeller", "TexImage2DUpload", "Bytes",
                    std::to_string(data->data->GetSize()).c_str());
@@ -263,7 +299,7 @@ bool TextureGLES::OnSetContents(std::shared_ptr<const fml::Mapping> mapping,
     }
   };
 
-  contents_initialized_ = reactor_->AddOperation(texture_upload);
+  contents_initialized_ = reactor_->AddBackgroundOperation(texture_upload);
   return contents_initialized_;
 }
 
@@ -285,6 +321,12 @@ static std::optional<GLenum> ToRenderBufferFormat(PixelFormat format) {
     case PixelFormat::kR8G8UNormInt:
     case PixelFormat::kR8G8B8A8UNormIntSRGB:
     case PixelFormat::kB8G8R8A8UNormIntSRGB:
+    case PixelFormat::kASTC4x4UNormInt:
+    case PixelFormat::kETC2R8G8B8UNormInt:
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+    case PixelFormat::kBC1R8G8B8A8UNormInt:
+    case PixelFormat::kBC3R8G8B8A8UNormInt:
+    case PixelFormat::kBC7R8G8B8A8UNormInt:
       return std::nullopt;
   }
   FML_UNREACHABLE();
@@ -303,6 +345,11 @@ void TextureGLES::InitializeContentsIfNecessary() const {
     return;
   }
 
+  // Compressed textures can only be sampled after their contents are set.
+  if (IsBlockCompressedPixelFormat(GetTextureDescriptor().format)) {
+    return;
+  }
+
   auto size = GetSize();
 
   if (size.IsEmpty()) {
@@ -347,6 +394,22 @@ void TextureGLES::InitializeContentsIfNecessary() const {
         return;
       }
       gl.BindRenderbuffer(GL_RENDERBUFFER, handle.value());
+      // Multisampled render buffers are attached alongside color textures
+      // that are implicitly resolved, and must use the same sample count.
+      // Without implicit resolves, the passes render without multisampling.
+      const auto samples = GetTextureDescriptor().sample_count;
+      if (samples != SampleCount::kCount1 &&
+          gl.GetCapabilities()->supports_implicit_msaa) {
+        TRACE_EVENT0("impeller", "RenderBufferStorageInitialization");
+        gl.RenderbufferStorageMultisampleEXT(
+            GL_RENDERBUFFER,                // target
+            static_cast<GLsizei>(samples),  // samples
+            render_buffer_format.value(),   // internal format
+            size.width,                     // width
+            size.height                     // height
+        );
+        break;
+      }
       {
         TRACE_EVENT0("impeller", "RenderBufferStorageInitialization");
         gl.RenderbufferStorage(GL_RENDERBUFFER,               // target
@@ -437,7 +500,8 @@ static GLenum ToAttachmentPoint(TextureGLES::AttachmentPoint point) {
 
 bool TextureGLES::SetAsFramebufferAttachment(GLenum target,
                                              GLuint fbo,
-                                             AttachmentPoint point) const {
+                                             AttachmentPoint point,
+                                             SampleCount samples) const {
   if (!IsValid()) {
     return false;
   }
@@ -449,6 +513,21 @@ bool TextureGLES::SetAsFramebufferAttachment(GLenum target,
   const auto& gl = reactor_->GetProcTable();
   switch (type_) {
     case Type::kTexture:
+      if (samples != SampleCount::kCount1) {
+        if (!gl.GetCapabilities()->supports_implicit_msaa) {
+          VALIDATION_LOG << "Implicit multisample resolves are not supported.";
+          return false;
+        }
+        gl.FramebufferTexture2DMultisampleEXT(
+            target,                         // target
+            ToAttachmentPoint(point),       // attachment
+            GL_TEXTURE_2D,                  // textarget
+            handle.value(),                 // texture
+            0,                              // level
+            static_cast<GLsizei>(samples)   // samples
+        );
+        break;
+      }
       gl.FramebufferTexture2D(target,                    // target
                               ToAttachmentPoint(point),  // attachment
                               GL_TEXTURE_2D,             // textarget
@@ -44,9 +44,21 @@ class TextureGLES final : public Texture,
     kDepth,
     kStencil,
   };
-  [[nodiscard]] bool SetAsFramebufferAttachment(GLenum target,
-                                                GLuint fbo,
-                                                AttachmentPoint point) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Attach the texture to the bound framebuffer.
+  ///
+  /// @param[in]  samples  The samples to render with before the texture is
+  ///                      implicitly resolved. More than one sample requires
+  ///                      `CapabilitiesGLES::supports_implicit_msaa`. Render
+  ///                      buffers ignore this and use the sample count of
+  ///                      their descriptor instead.
+  ///
+  [[nodiscard]] bool SetAsFramebufferAttachment(
+      GLenum target,
+      GLuint fbo,
+      AttachmentPoint point,
+      SampleCount samples = SampleCount::kCount1) const;
 
   Type GetType() const;
 
@@ -7,6 +7,7 @@
 #include <Metal/Metal.h>
 
 #include "flutter/fml/macros.h"
+#include "impeller/base/thread.h"
 #include "impeller/renderer/allocator.h"
 
 namespace impeller {
@@ -18,6 +19,12 @@ class AllocatorMTL final : public Allocator {
   // |Allocator|
   ~AllocatorMTL() override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The number of heaps currently used to suballocate device
+  ///             private render target textures.
+  ///
+  size_t GetRenderTargetHeapCount() const;
+
  private:
   friend class ContextMTL;
 
@@ -25,8 +32,12 @@ class AllocatorMTL final : public Allocator {
   std::string allocator_label_;
   bool supports_memoryless_targets_ = false;
   bool supports_uma_ = false;
+  bool supports_render_target_heaps_ = false;
   bool is_valid_ = false;
   ISize max_texture_supported_;
+  mutable Mutex heaps_mutex_;
+  NSMutableArray<id<MTLHeap>>* render_target_heaps_ IPLR_GUARDED_BY(
+      heaps_mutex_) = [[NSMutableArray alloc] init];
 
   AllocatorMTL(id<MTLDevice> device, std::string label);
 
@@ -41,6 +52,9 @@ class AllocatorMTL final : public Allocator {
   std::shared_ptr<Texture> OnCreateTexture(
       const TextureDescriptor& desc) override;
 
+  id<MTLTexture> CreateRenderTargetTextureFromHeap(
+      MTLTextureDescriptor* desc);
+
   // |Allocator|
   uint16_t MinimumBytesPerRow(PixelFormat format) const override;
 
@@ -4,6 +4,8 @@
 
 #include "impeller/renderer/backend/metal/allocator_mtl.h"
 
+#include <algorithm>
+
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
 #include "impeller/base/validation.h"
@@ -50,6 +52,16 @@ static bool DeviceHasUnifiedMemoryArchitecture(id<MTLDevice> device) {
   FML_UNREACHABLE();
 }
 
+static bool DeviceSupportsRenderTargetHeaps(id<MTLDevice> device) {
+  // Resources suballocated from the heap are made aliasable once released.
+  // This is only safe if Metal tracks hazards between them, which needs heaps
+  // with tracked hazard tracking mode.
+  if (@available(ios 13.0, tvos 13.0, macos 10.15, *)) {
+    return true;
+  }
+  return false;
+}
+
 static ISize DeviceMaxTextureSizeSupported(id<MTLDevice> device) {
   // Since Apple didn't expose API for us to get the max texture size, we have
   // to use hardcoded data from
@@ -86,6 +98,7 @@ AllocatorMTL::AllocatorMTL(id<MTLDevice> device, std::string label)
 
   supports_memoryless_targets_ = DeviceSupportsMemorylessTargets(device_);
   supports_uma_ = DeviceHasUnifiedMemoryArchitecture(device_);
+  supports_render_target_heaps_ = DeviceSupportsRenderTargetHeaps(device_);
   max_texture_supported_ = DeviceMaxTextureSizeSupported(device_);
 
   is_valid_ = true;
@@ -97,6 +110,11 @@ bool AllocatorMTL::IsValid() const {
   return is_valid_;
 }
 
+size_t AllocatorMTL::GetRenderTargetHeapCount() const {
+  Lock lock(heaps_mutex_);
+  return render_target_heaps_.count;
+}
+
 static MTLResourceOptions ToMTLResourceOptions(StorageMode type,
                                                bool supports_memoryless_targets,
                                                bool supports_uma) {
@@ -194,13 +212,73 @@ std::shared_ptr<Texture> AllocatorMTL::OnCreateTexture(
 
   mtl_texture_desc.storageMode = ToMTLStorageMode(
       desc.storage_mode, supports_memoryless_targets_, supports_uma_);
-  auto texture = [device_ newTextureWithDescriptor:mtl_texture_desc];
+
+  id<MTLTexture> texture = nil;
+  // Memoryless textures have no backing store to suballocate. Device private
+  // render targets are the transient offscreen textures that come and go
+  // with the passes of a frame.
+  if (supports_render_target_heaps_ &&
+      mtl_texture_desc.storageMode == MTLStorageModePrivate &&
+      (desc.usage &
+       static_cast<TextureUsageMask>(TextureUsage::kRenderTarget))) {
+    texture = CreateRenderTargetTextureFromHeap(mtl_texture_desc);
+  }
+  if (!texture) {
+    texture = [device_ newTextureWithDescriptor:mtl_texture_desc];
+  }
   if (!texture) {
     return nullptr;
   }
   return std::make_shared<TextureMTL>(desc, texture);
 }
 
+// The minimum size of each heap. Large enough to hold a couple of full screen
+// offscreen targets so that most frames are served from a single heap.
+static constexpr NSUInteger kRenderTargetHeapSize = 32u * 1024u * 1024u;
+
+id<MTLTexture> AllocatorMTL::CreateRenderTargetTextureFromHeap(
+    MTLTextureDescriptor* desc) {
+  if (@available(ios 13.0, tvos 13.0, macos 10.15, *)) {
+    const auto size_and_align =
+        [device_ heapTextureSizeAndAlignWithDescriptor:desc];
+
+    Lock lock(heaps_mutex_);
+
+    // Heaps whose textures have all been released are dropped, keeping the
+    // first one around for the next frame.
+    for (NSUInteger i = render_target_heaps_.count; i > 1u; i--) {
+      if (render_target_heaps_[i - 1].usedSize == 0u) {
+        [render_target_heaps_ removeObjectAtIndex:i - 1];
+      }
+    }
+
+    // Textures released earlier in the frame have been made aliasable. Their
+    // memory is reused here.
+    for (id<MTLHeap> heap in render_target_heaps_) {
+      if ([heap maxAvailableSizeWithAlignment:size_and_align.align] >=
+          size_and_align.size) {
+        if (auto texture = [heap newTextureWithDescriptor:desc]) {
+          return texture;
+        }
+      }
+    }
+
+    auto heap_desc = [[MTLHeapDescriptor alloc] init];
+    heap_desc.type = MTLHeapTypeAutomatic;
+    heap_desc.storageMode = MTLStorageModePrivate;
+    heap_desc.hazardTrackingMode = MTLHazardTrackingModeTracked;
+    heap_desc.size = std::max(kRenderTargetHeapSize, size_and_align.size);
+    auto heap = [device_ newHeapWithDescriptor:heap_desc];
+    if (!heap) {
+      return nil;
+    }
+    heap.label = @(allocator_label_.c_str());
+    [render_target_heaps_ addObject:heap];
+    return [heap newTextureWithDescriptor:desc];
+  }
+  return nil;
+}
+
 uint16_t AllocatorMTL::MinimumBytesPerRow(PixelFormat format) const {
   return static_cast<uint16_t>([device_
       minimumLinearTextureAlignmentForPixelFormat:ToMTLPixelFormat(format)]);
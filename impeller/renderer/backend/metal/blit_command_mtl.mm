@@ -94,6 +94,44 @@ bool BlitCopyTextureToBufferCommandMTL::Encode(
   return true;
 };
 
+BlitCopyBufferToTextureCommandMTL::~BlitCopyBufferToTextureCommandMTL() =
+    default;
+
+std::string BlitCopyBufferToTextureCommandMTL::GetLabel() const {
+  return label;
+}
+
+bool BlitCopyBufferToTextureCommandMTL::Encode(
+    id<MTLBlitCommandEncoder> encoder) const {
+  auto source_mtl = DeviceBufferMTL::Cast(*source).GetMTLBuffer();
+  if (!source_mtl) {
+    return false;
+  }
+
+  auto destination_mtl = TextureMTL::Cast(*destination).GetMTLTexture();
+  if (!destination_mtl) {
+    return false;
+  }
+
+  const auto& descriptor = destination->GetTextureDescriptor();
+  auto source_size_mtl =
+      MTLSizeMake(descriptor.size.width, descriptor.size.height, 1);
+  auto source_bytes_per_row = descriptor.GetBytesPerRow();
+  auto source_bytes_per_image = descriptor.GetByteSizeOfBaseMipLevel();
+
+  [encoder copyFromBuffer:source_mtl
+                 sourceOffset:source_offset
+            sourceBytesPerRow:source_bytes_per_row
+          sourceBytesPerImage:source_bytes_per_image
+                   sourceSize:source_size_mtl
+                    toTexture:destination_mtl
+             destinationSlice:0
+             destinationLevel:0
+            destinationOrigin:MTLOriginMake(0, 0, 0)];
+
+  return true;
+};
+
 BlitGenerateMipmapCommandMTL::~BlitGenerateMipmapCommandMTL() = default;
 
 std::string BlitGenerateMipmapCommandMTL::GetLabel() const {
@@ -33,6 +33,9 @@ class CommandBufferMTL final : public CommandBuffer {
   // |CommandBuffer|
   bool OnSubmitCommands(CompletionCallback callback) override;
 
+  // |CommandBuffer|
+  bool OnSubmitCommandsAsync(std::shared_ptr<RenderPass> render_pass) override;
+
   // |CommandBuffer|
   std::shared_ptr<RenderPass> OnCreateRenderPass(RenderTarget target) override;
 
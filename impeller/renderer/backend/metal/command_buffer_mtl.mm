@@ -4,9 +4,13 @@
 
 #include "impeller/renderer/backend/metal/command_buffer_mtl.h"
 
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/validation.h"
+#include "impeller/base/work_queue.h"
 #include "impeller/renderer/backend/metal/blit_pass_mtl.h"
 #include "impeller/renderer/backend/metal/compute_pass_mtl.h"
 #include "impeller/renderer/backend/metal/render_pass_mtl.h"
+#include "impeller/renderer/context.h"
 
 namespace impeller {
 
@@ -169,6 +173,33 @@ bool CommandBufferMTL::OnSubmitCommands(CompletionCallback callback) {
   return true;
 }
 
+bool CommandBufferMTL::OnSubmitCommandsAsync(
+    std::shared_ptr<RenderPass> render_pass) {
+  auto context = context_.lock();
+  if (!context) {
+    return false;
+  }
+  auto work_queue = context->GetWorkQueue();
+  if (!work_queue) {
+    return CommandBuffer::OnSubmitCommandsAsync(std::move(render_pass));
+  }
+
+  // Reserve a spot in the queue so that command buffers submitted later on
+  // are executed after this one, regardless of when this one is committed.
+  [buffer_ enqueue];
+  auto buffer = buffer_;
+  buffer_ = nil;
+
+  work_queue->PostTask([render_pass = std::move(render_pass), buffer]() {
+    TRACE_EVENT0("impeller", "CommandBufferMTL::EncodeAndCommit");
+    if (!render_pass->EncodeCommands()) {
+      VALIDATION_LOG << "Failed to encode render pass.";
+    }
+    [buffer commit];
+  });
+  return true;
+}
+
 std::shared_ptr<RenderPass> CommandBufferMTL::OnCreateRenderPass(
     RenderTarget target) {
   if (!buffer_) {
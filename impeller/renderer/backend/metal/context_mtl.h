@@ -36,6 +36,14 @@ class ContextMTL final : public Context,
 
   id<MTLDevice> GetMTLDevice() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Persist the binary archive of compiled pipelines to disk.
+  ///             Embedders should call this when the application is
+  ///             backgrounded, as it may not get a chance to shut down
+  ///             cleanly.
+  ///
+  bool FlushPipelineCache() const;
+
  private:
   id<MTLDevice> device_ = nullptr;
   id<MTLCommandQueue> command_queue_ = nullptr;
@@ -76,6 +84,18 @@ class ContextMTL final : public Context,
   // |Context|
   bool SupportsOffscreenMSAA() const override;
 
+  // |Context|
+  bool SupportsCompute() const override;
+
+  // |Context|
+  bool SupportsInstancedRendering() const override;
+
+  // |Context|
+  bool SupportsFramebufferFetch() const override;
+
+  // |Context|
+  bool SupportsPixelFormat(PixelFormat format) const override;
+
   std::shared_ptr<CommandBuffer> CreateCommandBufferInQueue(
       id<MTLCommandQueue> queue) const;
 
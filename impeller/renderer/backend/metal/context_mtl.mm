@@ -10,6 +10,7 @@
 #include "flutter/fml/logging.h"
 #include "flutter/fml/paths.h"
 #include "impeller/base/platform/darwin/work_queue_darwin.h"
+#include "impeller/renderer/backend/metal/formats_mtl.h"
 #include "impeller/renderer/backend/metal/sampler_library_mtl.h"
 #include "impeller/renderer/sampler_descriptor.h"
 
@@ -201,6 +202,13 @@ std::shared_ptr<PipelineLibrary> ContextMTL::GetPipelineLibrary() const {
   return pipeline_library_;
 }
 
+bool ContextMTL::FlushPipelineCache() const {
+  if (!pipeline_library_) {
+    return false;
+  }
+  return pipeline_library_->PersistBinaryArchiveToDisk();
+}
+
 // |Context|
 std::shared_ptr<SamplerLibrary> ContextMTL::GetSamplerLibrary() const {
   return sampler_library_;
@@ -247,4 +255,51 @@ bool ContextMTL::SupportsOffscreenMSAA() const {
   return true;
 }
 
+// |Context|
+bool ContextMTL::SupportsCompute() const {
+  return true;
+}
+
+// |Context|
+bool ContextMTL::SupportsInstancedRendering() const {
+  // The iOS Simulator does not support instanced rendering.
+#if TARGET_OS_SIMULATOR
+  return false;
+#else
+  return true;
+#endif  // TARGET_OS_SIMULATOR
+}
+
+// |Context|
+bool ContextMTL::SupportsFramebufferFetch() const {
+  // Programmable blending is available on all iOS devices, but not in the
+  // simulator or on macOS. Shaders are only compiled to read the color
+  // attachment for iOS.
+#if TARGET_OS_IPHONE && !TARGET_OS_SIMULATOR
+  return true;
+#else
+  return false;
+#endif  // TARGET_OS_IPHONE && !TARGET_OS_SIMULATOR
+}
+
+// |Context|
+bool ContextMTL::SupportsPixelFormat(PixelFormat format) const {
+  if (!IsBlockCompressedPixelFormat(format)) {
+    return true;
+  }
+  if (ToMTLPixelFormat(format) == MTLPixelFormatInvalid) {
+    return false;
+  }
+#if FML_OS_IOS
+  // ETC2 is supported by all iOS GPUs but ASTC needs an A8 or newer.
+  if (format == PixelFormat::kASTC4x4UNormInt) {
+    if (@available(iOS 13.0, *)) {
+      return [device_ supportsFamily:MTLGPUFamilyApple2];
+    }
+    return [device_ supportsFeatureSet:MTLFeatureSet_iOS_GPUFamily2_v1];
+  }
+#endif  // FML_OS_IOS
+  return true;
+}
+
 }  // namespace impeller
@@ -8,6 +8,7 @@
 
 #include <optional>
 
+#include "flutter/fml/build_config.h"
 #include "flutter/fml/macros.h"
 #include "impeller/geometry/color.h"
 #include "impeller/renderer/formats.h"
@@ -57,6 +58,32 @@ constexpr MTLPixelFormat ToMTLPixelFormat(PixelFormat format) {
       return MTLPixelFormatStencil8;
     case PixelFormat::kR8G8B8A8UNormIntSRGB:
       return MTLPixelFormatRGBA8Unorm_sRGB;
+    // Apple GPUs on macOS 11 and above also support ASTC and ETC2, but those
+    // formats are only exposed on iOS to keep the macOS deployment target.
+    // See |ContextMTL::SupportsPixelFormat|.
+#if FML_OS_IOS
+    case PixelFormat::kASTC4x4UNormInt:
+      return MTLPixelFormatASTC_4x4_LDR;
+    case PixelFormat::kETC2R8G8B8UNormInt:
+      return MTLPixelFormatETC2_RGB8;
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+      return MTLPixelFormatEAC_RGBA8;
+    case PixelFormat::kBC1R8G8B8A8UNormInt:
+    case PixelFormat::kBC3R8G8B8A8UNormInt:
+    case PixelFormat::kBC7R8G8B8A8UNormInt:
+      return MTLPixelFormatInvalid;
+#else   // FML_OS_IOS
+    case PixelFormat::kASTC4x4UNormInt:
+    case PixelFormat::kETC2R8G8B8UNormInt:
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+      return MTLPixelFormatInvalid;
+    case PixelFormat::kBC1R8G8B8A8UNormInt:
+      return MTLPixelFormatBC1_RGBA;
+    case PixelFormat::kBC3R8G8B8A8UNormInt:
+      return MTLPixelFormatBC3_RGBA;
+    case PixelFormat::kBC7R8G8B8A8UNormInt:
+      return MTLPixelFormatBC7_RGBAUnorm;
+#endif  // FML_OS_IOS
   }
   return MTLPixelFormatInvalid;
 };
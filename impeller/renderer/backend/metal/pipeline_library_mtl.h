@@ -7,6 +7,7 @@
 #include <Metal/Metal.h>
 
 #include "flutter/fml/macros.h"
+#include "impeller/base/thread.h"
 #include "impeller/renderer/pipeline_library.h"
 
 namespace impeller {
@@ -20,15 +21,31 @@ class PipelineLibraryMTL final : public PipelineLibrary {
   // |PipelineLibrary|
   ~PipelineLibraryMTL() override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Write the binary archive of the pipelines created so far to
+  ///             disk so that the next launch can skip compiling them.
+  ///
+  /// @return     If the archive was written.
+  ///
+  bool PersistBinaryArchiveToDisk() const;
+
  private:
   friend ContextMTL;
 
   id<MTLDevice> device_ = nullptr;
   PipelineMap pipelines_;
   ComputePipelineMap compute_pipelines_;
+  // A MTLBinaryArchive, which is only available on iOS 14 and macOS 11.
+  id binary_archive_ = nil;
+  NSURL* binary_archive_url_ = nil;
+  mutable Mutex binary_archive_mutex_;
+  mutable bool binary_archive_is_dirty_ IPLR_GUARDED_BY(
+      binary_archive_mutex_) = false;
 
   PipelineLibraryMTL(id<MTLDevice> device);
 
+  void AddToBinaryArchive(MTLRenderPipelineDescriptor* descriptor) const;
+
   // |PipelineLibrary|
   bool IsValid() const override;
 
@@ -6,6 +6,7 @@
 #include <Metal/Metal.h>
 
 #include "flutter/fml/container.h"
+#include "flutter/fml/trace_event.h"
 #include "impeller/base/promise.h"
 #include "impeller/renderer/backend/metal/compute_pipeline_mtl.h"
 #include "impeller/renderer/backend/metal/formats_mtl.h"
@@ -15,10 +16,88 @@
 
 namespace impeller {
 
+static constexpr const char* kBinaryArchiveFileName =
+    "flutter.impeller.mtlarchive";
+
+static NSURL* GetBinaryArchiveURL() {
+  NSArray* paths = NSSearchPathForDirectoriesInDomains(NSCachesDirectory,
+                                                       NSUserDomainMask, YES);
+  if (paths.count == 0u) {
+    return nil;
+  }
+  NSURL* caches_url = [NSURL fileURLWithPath:[paths objectAtIndex:0]];
+  return [caches_url URLByAppendingPathComponent:@(kBinaryArchiveFileName)];
+}
+
 PipelineLibraryMTL::PipelineLibraryMTL(id<MTLDevice> device)
-    : device_(device) {}
+    : device_(device) {
+  if (!device_) {
+    return;
+  }
+  if (@available(ios 14.0, macos 11.0, *)) {
+    binary_archive_url_ = GetBinaryArchiveURL();
+    auto archive_desc = [[MTLBinaryArchiveDescriptor alloc] init];
+    // Archives written by a different OS or GPU are rejected, in which case
+    // pipelines are compiled as usual and a fresh archive is started.
+    if (binary_archive_url_ &&
+        [[NSFileManager defaultManager]
+            fileExistsAtPath:binary_archive_url_.path]) {
+      archive_desc.url = binary_archive_url_;
+      binary_archive_ = [device_ newBinaryArchiveWithDescriptor:archive_desc
+                                                          error:nil];
+    }
+    if (!binary_archive_) {
+      archive_desc.url = nil;
+      binary_archive_ = [device_ newBinaryArchiveWithDescriptor:archive_desc
+                                                          error:nil];
+    }
+  }
+}
 
-PipelineLibraryMTL::~PipelineLibraryMTL() = default;
+PipelineLibraryMTL::~PipelineLibraryMTL() {
+  PersistBinaryArchiveToDisk();
+}
+
+bool PipelineLibraryMTL::PersistBinaryArchiveToDisk() const {
+  if (@available(ios 14.0, macos 11.0, *)) {
+    if (!binary_archive_ || !binary_archive_url_) {
+      return false;
+    }
+    TRACE_EVENT0("impeller", "PipelineLibraryMTL::PersistBinaryArchiveToDisk");
+    Lock lock(binary_archive_mutex_);
+    if (!binary_archive_is_dirty_) {
+      return true;
+    }
+    NSError* error = nil;
+    if (![static_cast<id<MTLBinaryArchive>>(binary_archive_)
+            serializeToURL:binary_archive_url_
+                     error:&error]) {
+      VALIDATION_LOG << "Could not write the binary archive to disk: "
+                     << error.localizedDescription.UTF8String;
+      return false;
+    }
+    binary_archive_is_dirty_ = false;
+    return true;
+  }
+  return false;
+}
+
+void PipelineLibraryMTL::AddToBinaryArchive(
+    MTLRenderPipelineDescriptor* descriptor) const {
+  if (@available(ios 14.0, macos 11.0, *)) {
+    if (!binary_archive_) {
+      return;
+    }
+    Lock lock(binary_archive_mutex_);
+    // Pipelines that were found in the archive are already in it, in which
+    // case this is cheap.
+    if ([static_cast<id<MTLBinaryArchive>>(binary_archive_)
+            addRenderPipelineFunctionsWithDescriptor:descriptor
+                                               error:nil]) {
+      binary_archive_is_dirty_ = true;
+    }
+  }
+}
 
 static MTLRenderPipelineDescriptor* GetMTLRenderPipelineDescriptor(
     const PipelineDescriptor& desc) {
@@ -105,6 +184,14 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryMTL::GetPipeline(
   pipelines_[descriptor] = pipeline_future;
   auto weak_this = weak_from_this();
 
+  auto mtl_descriptor = GetMTLRenderPipelineDescriptor(descriptor);
+  if (@available(ios 14.0, macos 11.0, *)) {
+    if (binary_archive_) {
+      // Pipelines found in the archive are loaded instead of compiled.
+      mtl_descriptor.binaryArchives = @[ binary_archive_ ];
+    }
+  }
+
   auto completion_handler =
       ^(id<MTLRenderPipelineState> _Nullable render_pipeline_state,
         NSError* _Nullable error) {
@@ -123,6 +210,8 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryMTL::GetPipeline(
           return;
         }
 
+        AddToBinaryArchive(mtl_descriptor);
+
         auto new_pipeline = std::shared_ptr<PipelineMTL>(new PipelineMTL(
             weak_this,
             descriptor,                                        //
@@ -131,8 +220,7 @@ PipelineFuture<PipelineDescriptor> PipelineLibraryMTL::GetPipeline(
             ));
         promise->set_value(new_pipeline);
       };
-  [device_ newRenderPipelineStateWithDescriptor:GetMTLRenderPipelineDescriptor(
-                                                    descriptor)
+  [device_ newRenderPipelineStateWithDescriptor:mtl_descriptor
                               completionHandler:completion_handler];
   return pipeline_future;
 }
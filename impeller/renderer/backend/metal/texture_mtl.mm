@@ -33,7 +33,14 @@ std::shared_ptr<TextureMTL> TextureMTL::Wrapper(TextureDescriptor desc,
   return std::make_shared<TextureMTL>(desc, texture, true);
 }
 
-TextureMTL::~TextureMTL() = default;
+TextureMTL::~TextureMTL() {
+  // Textures suballocated from a heap give their memory back to it. Metal
+  // tracks hazards on the heap, so later textures aliasing this memory wait
+  // for pending work using this one.
+  if (!is_wrapped_ && texture_.heap != nil) {
+    [texture_ makeAliasable];
+  }
+}
 
 void TextureMTL::SetLabel(std::string_view label) {
   [texture_ setLabel:@(label.data())];
@@ -79,6 +86,29 @@ bool TextureMTL::OnSetContents(const uint8_t* contents,
   return true;
 }
 
+// |Texture|
+bool TextureMTL::OnSetContentsInRegion(const uint8_t* contents,
+                                       size_t bytes_per_row,
+                                       IRect region,
+                                       size_t slice) {
+  if (!IsValid() || is_wrapped_) {
+    return false;
+  }
+
+  const auto mtl_region =
+      MTLRegionMake2D(region.origin.x, region.origin.y, region.size.width,
+                      region.size.height);
+  [texture_ replaceRegion:mtl_region                          //
+              mipmapLevel:0u                                  //
+                    slice:slice                               //
+                withBytes:contents                            //
+              bytesPerRow:bytes_per_row                       //
+            bytesPerImage:bytes_per_row * region.size.height  //
+  ];
+
+  return true;
+}
+
 ISize TextureMTL::GetSize() const {
   return {static_cast<ISize::Type>(texture_.width),
           static_cast<ISize::Type>(texture_.height)};
@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "flutter/fml/logging.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/vulkan/procs/vulkan_handle.h"
 #include "flutter/vulkan/procs/vulkan_proc_table.h"
@@ -82,10 +83,32 @@ AllocatorVK::AllocatorVK(ContextVK& context,
     return;
   }
   allocator_ = allocator;
+
+  // The pools are keyed by representative attachments. Attachments whose
+  // memory requirements don't fit a pool are allocated outside of it.
+  transient_pool_ = CreatePool(
+      vk::ImageCreateInfo{}
+          .setFormat(vk::Format::eR8G8B8A8Unorm)
+          .setSamples(vk::SampleCountFlagBits::e4)
+          .setUsage(vk::ImageUsageFlagBits::eColorAttachment |
+                    vk::ImageUsageFlagBits::eTransientAttachment),
+      VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED, "Transient Attachments");
+  offscreen_pool_ = CreatePool(
+      vk::ImageCreateInfo{}
+          .setFormat(vk::Format::eR8G8B8A8Unorm)
+          .setUsage(vk::ImageUsageFlagBits::eColorAttachment |
+                    vk::ImageUsageFlagBits::eSampled),
+      VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, "Offscreen Render Targets");
   is_valid_ = true;
 }
 
 AllocatorVK::~AllocatorVK() {
+  if (transient_pool_) {
+    ::vmaDestroyPool(allocator_, transient_pool_);
+  }
+  if (offscreen_pool_) {
+    ::vmaDestroyPool(allocator_, offscreen_pool_);
+  }
   if (allocator_) {
     ::vmaDestroyAllocator(allocator_);
   }
@@ -96,6 +119,91 @@ bool AllocatorVK::IsValid() const {
   return is_valid_;
 }
 
+VmaPool AllocatorVK::CreatePool(const vk::ImageCreateInfo& image_info,
+                                VmaMemoryUsage usage,
+                                const char* label) const {
+  auto image_info_native = static_cast<vk::ImageCreateInfo::NativeType>(
+      vk::ImageCreateInfo{image_info}
+          .setImageType(vk::ImageType::e2D)
+          .setExtent({1u, 1u, 1u})
+          .setMipLevels(1u)
+          .setArrayLayers(1u)
+          .setTiling(vk::ImageTiling::eOptimal));
+
+  VmaAllocationCreateInfo alloc_create_info = {};
+  alloc_create_info.usage = usage;
+
+  uint32_t memory_type_index = 0u;
+  auto result = vk::Result{::vmaFindMemoryTypeIndexForImageInfo(
+      allocator_, &image_info_native, &alloc_create_info, &memory_type_index)};
+  if (result != vk::Result::eSuccess) {
+    // Not an error. Lazily allocated memory is only available on tiling GPUs.
+    FML_LOG(INFO) << "No memory type for the " << label << " pool.";
+    return {};
+  }
+
+  VmaPoolCreateInfo pool_create_info = {};
+  pool_create_info.memoryTypeIndex = memory_type_index;
+
+  VmaPool pool = {};
+  result = vk::Result{::vmaCreatePool(allocator_, &pool_create_info, &pool)};
+  if (result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not create the " << label
+                   << " pool: " << vk::to_string(result);
+    return {};
+  }
+  ::vmaSetPoolName(allocator_, pool, label);
+  return pool;
+}
+
+std::vector<AllocatorVK::PoolUsageVK> AllocatorVK::GetPoolUsage() const {
+  std::vector<PoolUsageVK> usage;
+  for (auto pool : {transient_pool_, offscreen_pool_}) {
+    if (!pool) {
+      continue;
+    }
+    const char* name = nullptr;
+    ::vmaGetPoolName(allocator_, pool, &name);
+    VmaStatistics stats = {};
+    ::vmaGetPoolStatistics(allocator_, pool, &stats);
+    usage.push_back(PoolUsageVK{
+        .label = name ? name : "",
+        .allocation_count = stats.allocationCount,
+        .allocation_bytes = static_cast<size_t>(stats.allocationBytes),
+        .block_bytes = static_cast<size_t>(stats.blockBytes),
+    });
+  }
+  return usage;
+}
+
+static constexpr bool IsStencilFormat(PixelFormat format) {
+  return format == PixelFormat::kS8UInt;
+}
+
+static bool IsTransientAttachment(const TextureDescriptor& desc) {
+  // Transient attachments can't be sampled or copied and so can't have any
+  // usage other than rendering.
+  return desc.storage_mode == StorageMode::kDeviceTransient &&
+         desc.usage ==
+             static_cast<TextureUsageMask>(TextureUsage::kRenderTarget);
+}
+
+static vk::ImageUsageFlags ToVKImageUsageFlags(const TextureDescriptor& desc) {
+  vk::ImageUsageFlags usage;
+  if (IsStencilFormat(desc.format)) {
+    usage |= vk::ImageUsageFlagBits::eDepthStencilAttachment;
+  } else {
+    usage |= vk::ImageUsageFlagBits::eColorAttachment;
+  }
+  if (IsTransientAttachment(desc)) {
+    return usage | vk::ImageUsageFlagBits::eTransientAttachment;
+  }
+  if (!IsStencilFormat(desc.format)) {
+    usage |= vk::ImageUsageFlagBits::eSampled;
+  }
+  return usage;
+}
+
 // |Allocator|
 std::shared_ptr<Texture> AllocatorVK::OnCreateTexture(
     const TextureDescriptor& desc) {
@@ -113,15 +221,27 @@ std::shared_ptr<Texture> AllocatorVK::OnCreateTexture(
 
   image_create_info.tiling = vk::ImageTiling::eOptimal;
   image_create_info.initialLayout = vk::ImageLayout::eUndefined;
-  image_create_info.usage = vk::ImageUsageFlagBits::eSampled |
-                            vk::ImageUsageFlagBits::eColorAttachment;
+  image_create_info.usage = ToVKImageUsageFlags(desc);
 
   VmaAllocationCreateInfo alloc_create_info = {};
-  alloc_create_info.usage = VMA_MEMORY_USAGE_AUTO;
-  // docs recommend using `VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT` for image
-  // allocations, but setting them to be host visible for now.
-  alloc_create_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT |
-                            VMA_ALLOCATION_CREATE_MAPPED_BIT;
+  if (IsTransientAttachment(desc)) {
+    // On tiling GPUs, transient attachments live in tile memory and are never
+    // backed by device memory.
+    alloc_create_info.usage = transient_pool_
+                                  ? VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED
+                                  : VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+    alloc_create_info.pool = transient_pool_;
+  } else if (desc.usage &
+             static_cast<TextureUsageMask>(TextureUsage::kRenderTarget)) {
+    alloc_create_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+    alloc_create_info.pool = offscreen_pool_;
+  } else {
+    alloc_create_info.usage = VMA_MEMORY_USAGE_AUTO;
+    // docs recommend using `VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT` for
+    // image allocations, but setting them to be host visible for now.
+    alloc_create_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT |
+                              VMA_ALLOCATION_CREATE_MAPPED_BIT;
+  }
 
   auto create_info_native =
       static_cast<vk::ImageCreateInfo::NativeType>(image_create_info);
@@ -132,6 +252,17 @@ std::shared_ptr<Texture> AllocatorVK::OnCreateTexture(
   auto result = vk::Result{vmaCreateImage(allocator_, &create_info_native,
                                           &alloc_create_info, &img, &allocation,
                                           &allocation_info)};
+  if (result != vk::Result::eSuccess && alloc_create_info.pool) {
+    // The memory requirements of this image don't fit the pool, such as with
+    // unusual formats. Fall back to a dedicated allocation.
+    alloc_create_info.pool = {};
+    if (alloc_create_info.usage == VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED) {
+      alloc_create_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+    }
+    result = vk::Result{vmaCreateImage(allocator_, &create_info_native,
+                                       &alloc_create_info, &img, &allocation,
+                                       &allocation_info)};
+  }
   if (result != vk::Result::eSuccess) {
     VALIDATION_LOG << "Unable to allocate an image";
     return nullptr;
@@ -142,7 +273,8 @@ std::shared_ptr<Texture> AllocatorVK::OnCreateTexture(
   view_create_info.viewType = vk::ImageViewType::e2D;
   view_create_info.format = image_create_info.format;
   view_create_info.subresourceRange.aspectMask =
-      vk::ImageAspectFlagBits::eColor;
+      IsStencilFormat(desc.format) ? vk::ImageAspectFlagBits::eStencil
+                                   : vk::ImageAspectFlagBits::eColor;
   view_create_info.subresourceRange.levelCount = image_create_info.mipLevels;
   view_create_info.subresourceRange.layerCount = image_create_info.arrayLayers;
 
@@ -12,19 +12,40 @@
 #include "impeller/renderer/backend/vulkan/vk.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace impeller {
 
 class AllocatorVK final : public Allocator {
  public:
+  struct PoolUsageVK {
+    std::string label;
+    size_t allocation_count = 0u;
+    size_t allocation_bytes = 0u;
+    size_t block_bytes = 0u;
+  };
+
   // |Allocator|
   ~AllocatorVK() override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The usage of each of the pools that render targets are
+  ///             suballocated from. Pools that couldn't be created on this
+  ///             device aren't reported.
+  ///
+  std::vector<PoolUsageVK> GetPoolUsage() const;
+
  private:
   friend class ContextVK;
 
   fml::RefPtr<vulkan::VulkanProcTable> vk_;
   VmaAllocator allocator_ = {};
+  // Lazily allocated memory for transient attachments, such as MSAA and
+  // stencil attachments, that never leave tile memory.
+  VmaPool transient_pool_ = {};
+  // Device local memory for short-lived offscreen render targets.
+  VmaPool offscreen_pool_ = {};
   ContextVK& context_;
   vk::Device device_;
   bool is_valid_ = false;
@@ -40,6 +61,10 @@ class AllocatorVK final : public Allocator {
   // |Allocator|
   bool IsValid() const;
 
+  VmaPool CreatePool(const vk::ImageCreateInfo& image_info,
+                     VmaMemoryUsage usage,
+                     const char* label) const;
+
   // |Allocator|
   std::shared_ptr<DeviceBuffer> OnCreateBuffer(
       const DeviceBufferDescriptor& desc) override;
@@ -0,0 +1,222 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/vulkan/android_hardware_buffer_vk.h"
+
+#include "impeller/base/validation.h"
+#include "impeller/renderer/backend/vulkan/formats_vk.h"
+#include "impeller/renderer/backend/vulkan/texture_vk.h"
+
+namespace impeller {
+
+namespace {
+
+// The image and the memory imported from a buffer. Views of the image are
+// owned by the textures.
+struct ImportedImageVK {
+  // Declared first so that the image is destroyed before its memory is freed.
+  vk::UniqueDeviceMemory memory;
+  vk::UniqueImage image;
+};
+
+}  // namespace
+
+static std::optional<uint32_t> FindMemoryTypeIndex(
+    const vk::PhysicalDevice& physical_device,
+    uint32_t memory_type_bits) {
+  const auto properties = physical_device.getMemoryProperties();
+  std::optional<uint32_t> index;
+  for (uint32_t i = 0; i < properties.memoryTypeCount; i++) {
+    if ((memory_type_bits & (1u << i)) == 0) {
+      continue;
+    }
+    // Any of the memory types the driver reports can import the buffer, but
+    // device local memory is the fastest to sample from.
+    if (properties.memoryTypes[i].propertyFlags &
+        vk::MemoryPropertyFlagBits::eDeviceLocal) {
+      return i;
+    }
+    if (!index.has_value()) {
+      index = i;
+    }
+  }
+  return index;
+}
+
+static std::shared_ptr<Texture> CreatePlaneTexture(
+    const std::shared_ptr<ContextVK>& context,
+    const std::shared_ptr<ImportedImageVK>& imported_image,
+    vk::Format format,
+    vk::ImageAspectFlagBits aspect,
+    PixelFormat pixel_format,
+    const ISize& size) {
+  auto view_info =
+      vk::ImageViewCreateInfo()
+          .setImage(*imported_image->image)
+          .setViewType(vk::ImageViewType::e2D)
+          .setFormat(format)
+          .setSubresourceRange(vk::ImageSubresourceRange()
+                                   .setAspectMask(aspect)
+                                   .setBaseMipLevel(0)
+                                   .setLevelCount(1)
+                                   .setBaseArrayLayer(0)
+                                   .setLayerCount(1));
+  auto view = context->GetDevice().createImageView(view_info);
+  if (view.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not create the view of an imported image: "
+                   << vk::to_string(view.result);
+    return nullptr;
+  }
+
+  auto texture_info = std::make_unique<TextureInfoVK>(TextureInfoVK{
+      .backing_type = TextureBackingTypeVK::kImportedTexture,
+      .imported_texture =
+          {
+              .image = *imported_image->image,
+              .image_view = view.value,
+          },
+      .imported_image = imported_image,
+  });
+
+  TextureDescriptor desc;
+  desc.storage_mode = StorageMode::kDevicePrivate;
+  desc.format = pixel_format;
+  desc.size = size;
+  desc.mip_count = 1u;
+  return std::make_shared<TextureVK>(desc, context.get(),
+                                     std::move(texture_info));
+}
+
+std::optional<AndroidHardwareBufferTexturesVK> ImportAndroidHardwareBufferVK(
+    const std::shared_ptr<ContextVK>& context,
+    AHardwareBuffer* buffer,
+    const ISize& size) {
+  if (!context || !context->SupportsAndroidHardwareBuffers()) {
+    VALIDATION_LOG << "The device cannot import Android hardware buffers.";
+    return std::nullopt;
+  }
+  if (!buffer || size.IsEmpty()) {
+    return std::nullopt;
+  }
+
+  const auto device = context->GetDevice();
+  auto properties = device.getAndroidHardwareBufferPropertiesANDROID<
+      vk::AndroidHardwareBufferPropertiesANDROID,
+      vk::AndroidHardwareBufferFormatPropertiesANDROID>(*buffer);
+  if (properties.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not get the properties of a hardware buffer: "
+                   << vk::to_string(properties.result);
+    return std::nullopt;
+  }
+  const auto& buffer_properties =
+      properties.value.get<vk::AndroidHardwareBufferPropertiesANDROID>();
+  const auto& format_properties =
+      properties.value.get<vk::AndroidHardwareBufferFormatPropertiesANDROID>();
+
+  // Buffers with an external format can only be sampled through an immutable
+  // YCbCr conversion sampler, which the pipelines of Impeller cannot bind.
+  // Bi-planar 4:2:0 buffers, which cameras and video decoders produce, are
+  // instead imported as a view of each plane and converted to RGB in a shader.
+  const bool is_yuv =
+      format_properties.format == vk::Format::eG8B8R82Plane420Unorm;
+  if (!is_yuv && ToPixelFormat(format_properties.format) ==
+                     PixelFormat::kUnknown) {
+    VALIDATION_LOG << "Unsupported hardware buffer format: "
+                   << vk::to_string(format_properties.format)
+                   << " (external format "
+                   << format_properties.externalFormat << ")";
+    return std::nullopt;
+  }
+
+  const auto memory_type_index = FindMemoryTypeIndex(
+      context->GetPhysicalDevice(), buffer_properties.memoryTypeBits);
+  if (!memory_type_index.has_value()) {
+    VALIDATION_LOG << "No memory type can import the hardware buffer.";
+    return std::nullopt;
+  }
+
+  vk::StructureChain<vk::ImageCreateInfo, vk::ExternalMemoryImageCreateInfo>
+      image_chain;
+  image_chain.get<vk::ImageCreateInfo>()
+      .setFlags(is_yuv ? vk::ImageCreateFlagBits::eMutableFormat
+                       : vk::ImageCreateFlags{})
+      .setImageType(vk::ImageType::e2D)
+      .setFormat(format_properties.format)
+      .setExtent(vk::Extent3D(size.width, size.height, 1))
+      .setMipLevels(1)
+      .setArrayLayers(1)
+      .setSamples(vk::SampleCountFlagBits::e1)
+      .setTiling(vk::ImageTiling::eOptimal)
+      .setUsage(vk::ImageUsageFlagBits::eSampled)
+      .setSharingMode(vk::SharingMode::eExclusive)
+      .setInitialLayout(vk::ImageLayout::eUndefined);
+  image_chain.get<vk::ExternalMemoryImageCreateInfo>().setHandleTypes(
+      vk::ExternalMemoryHandleTypeFlagBits::eAndroidHardwareBufferANDROID);
+
+  auto imported_image = std::make_shared<ImportedImageVK>();
+  auto image = device.createImageUnique(image_chain.get());
+  if (image.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not create the image of a hardware buffer: "
+                   << vk::to_string(image.result);
+    return std::nullopt;
+  }
+
+  // Hardware buffers must be imported into a dedicated allocation. The memory
+  // holds a reference to the buffer until it is freed.
+  vk::StructureChain<vk::MemoryAllocateInfo,
+                     vk::ImportAndroidHardwareBufferInfoANDROID,
+                     vk::MemoryDedicatedAllocateInfo>
+      memory_chain;
+  memory_chain.get<vk::MemoryAllocateInfo>()
+      .setAllocationSize(buffer_properties.allocationSize)
+      .setMemoryTypeIndex(memory_type_index.value());
+  memory_chain.get<vk::ImportAndroidHardwareBufferInfoANDROID>().setBuffer(
+      buffer);
+  memory_chain.get<vk::MemoryDedicatedAllocateInfo>().setImage(*image.value);
+
+  auto memory = device.allocateMemoryUnique(memory_chain.get());
+  if (memory.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not import the memory of a hardware buffer: "
+                   << vk::to_string(memory.result);
+    return std::nullopt;
+  }
+  auto bind_result = device.bindImageMemory(*image.value, *memory.value, 0u);
+  if (bind_result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not bind the memory of a hardware buffer: "
+                   << vk::to_string(bind_result);
+    return std::nullopt;
+  }
+  imported_image->memory = std::move(memory.value);
+  imported_image->image = std::move(image.value);
+
+  AndroidHardwareBufferTexturesVK textures;
+  if (!is_yuv) {
+    textures.texture = CreatePlaneTexture(
+        context, imported_image, format_properties.format,
+        vk::ImageAspectFlagBits::eColor,
+        ToPixelFormat(format_properties.format), size);
+    if (!textures.texture) {
+      return std::nullopt;
+    }
+    return textures;
+  }
+
+  textures.y_texture = CreatePlaneTexture(
+      context, imported_image, vk::Format::eR8Unorm,
+      vk::ImageAspectFlagBits::ePlane0, PixelFormat::kR8UNormInt, size);
+  textures.uv_texture = CreatePlaneTexture(
+      context, imported_image, vk::Format::eR8G8Unorm,
+      vk::ImageAspectFlagBits::ePlane1, PixelFormat::kR8G8UNormInt,
+      ISize(size.width / 2, size.height / 2));
+  if (!textures.y_texture || !textures.uv_texture) {
+    return std::nullopt;
+  }
+  textures.yuv_color_space =
+      format_properties.suggestedYcbcrRange == vk::SamplerYcbcrRange::eItuFull
+          ? YUVColorSpace::kBT601FullRange
+          : YUVColorSpace::kBT601LimitedRange;
+  return textures;
+}
+
+}  // namespace impeller
@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <android/hardware_buffer.h>
+
+#include <memory>
+#include <optional>
+
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/size.h"
+#include "impeller/renderer/backend/vulkan/context_vk.h"
+#include "impeller/renderer/texture.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      The textures an AHardwareBuffer is imported as. RGBA buffers
+///             are imported as one texture, bi-planar YUV buffers as a
+///             texture for each plane.
+///
+struct AndroidHardwareBufferTexturesVK {
+  std::shared_ptr<Texture> texture;
+  std::shared_ptr<Texture> y_texture;
+  std::shared_ptr<Texture> uv_texture;
+  YUVColorSpace yuv_color_space = YUVColorSpace::kBT601LimitedRange;
+
+  bool IsYUV() const { return y_texture && uv_texture; }
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Imports the memory of an AHardwareBuffer into textures that can
+///             be sampled without a copy.
+///
+///             The textures keep a reference to the buffer, so it may be
+///             released by the caller once this returns.
+///
+/// @param[in]  context  The context, which must support Android hardware
+///                      buffers.
+/// @param[in]  buffer   The buffer, which must have been allocated with
+///                      `AHARDWAREBUFFER_USAGE_GPU_SAMPLED_IMAGE`.
+/// @param[in]  size     The size of the buffer in pixels.
+///
+/// @return     The textures, or std::nullopt if the buffer could not be
+///             imported or has a format that is not supported.
+///
+std::optional<AndroidHardwareBufferTexturesVK> ImportAndroidHardwareBufferVK(
+    const std::shared_ptr<ContextVK>& context,
+    AHardwareBuffer* buffer,
+    const ISize& size);
+
+}  // namespace impeller
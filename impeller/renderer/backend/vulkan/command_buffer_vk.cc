@@ -19,39 +19,42 @@ namespace impeller {
 std::shared_ptr<CommandBufferVK> CommandBufferVK::Create(
     const std::weak_ptr<const Context>& context,
     vk::Device device,
-    vk::CommandPool command_pool,
+    std::shared_ptr<CommandPoolVK> command_pool,
     SurfaceProducerVK* surface_producer) {
-  vk::CommandBufferAllocateInfo allocate_info;
-  allocate_info.setLevel(vk::CommandBufferLevel::ePrimary);
-  allocate_info.setCommandBufferCount(1);
-  allocate_info.setCommandPool(command_pool);
-
-  auto res = device.allocateCommandBuffersUnique(allocate_info);
-  if (res.result != vk::Result::eSuccess) {
-    VALIDATION_LOG << "Failed to allocate command buffer: "
-                   << vk::to_string(res.result);
+  if (!command_pool) {
+    return nullptr;
+  }
+
+  auto cmd = command_pool->CreateCommandBuffer();
+  if (!cmd) {
     return nullptr;
   }
 
-  vk::UniqueCommandBuffer cmd = std::move(res.value[0]);
   return std::make_shared<CommandBufferVK>(context, device, surface_producer,
-                                           command_pool, std::move(cmd));
+                                           std::move(command_pool),
+                                           std::move(cmd));
 }
 
 CommandBufferVK::CommandBufferVK(std::weak_ptr<const Context> context,
                                  vk::Device device,
                                  SurfaceProducerVK* surface_producer,
-                                 vk::CommandPool command_pool,
+                                 std::shared_ptr<CommandPoolVK> command_pool,
                                  vk::UniqueCommandBuffer command_buffer)
     : CommandBuffer(std::move(context)),
       device_(device),
-      command_pool_(command_pool),
+      command_pool_(std::move(command_pool)),
       command_buffer_(std::move(command_buffer)),
       surface_producer_(surface_producer) {
   is_valid_ = true;
 }
 
-CommandBufferVK::~CommandBufferVK() = default;
+CommandBufferVK::~CommandBufferVK() {
+  // The command buffer is only still owned here if no render pass was ever
+  // created from it.
+  if (command_buffer_) {
+    command_pool_->CollectCommandBuffer(std::move(command_buffer_));
+  }
+}
 
 void CommandBufferVK::SetLabel(const std::string& label) const {
   if (auto context = context_.lock()) {
@@ -93,7 +96,9 @@ std::shared_ptr<RenderPass> CommandBufferVK::OnCreateRenderPass(
     color_attachment.setStencilLoadOp(vk::AttachmentLoadOp::eDontCare);
     color_attachment.setStencilStoreOp(vk::AttachmentStoreOp::eDontCare);
     color_attachment.setInitialLayout(vk::ImageLayout::eColorAttachmentOptimal);
-    color_attachment.setFinalLayout(vk::ImageLayout::ePresentSrcKHR);
+    color_attachment.setFinalLayout(
+        surface_producer_ ? surface_producer_->GetFinalImageLayout()
+                          : vk::ImageLayout::ePresentSrcKHR);
 
     color_attachments.push_back(color_attachment);
   }
@@ -124,8 +129,9 @@ std::shared_ptr<RenderPass> CommandBufferVK::OnCreateRenderPass(
   }
 
   return std::make_shared<RenderPassVK>(
-      context_, device_, std::move(target), std::move(command_buffer_),
-      std::move(render_pass_create_res.value), surface_producer_);
+      context_, device_, std::move(target), command_pool_,
+      std::move(command_buffer_), std::move(render_pass_create_res.value),
+      surface_producer_);
 }
 
 std::shared_ptr<BlitPass> CommandBufferVK::OnCreateBlitPass() const {
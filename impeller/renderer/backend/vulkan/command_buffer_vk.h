@@ -5,6 +5,7 @@
 #pragma once
 
 #include "flutter/fml/macros.h"
+#include "impeller/renderer/backend/vulkan/command_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/surface_producer_vk.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 #include "impeller/renderer/command_buffer.h"
@@ -16,13 +17,13 @@ class CommandBufferVK final : public CommandBuffer {
   static std::shared_ptr<CommandBufferVK> Create(
       const std::weak_ptr<const Context>& context,
       vk::Device device,
-      vk::CommandPool command_pool,
+      std::shared_ptr<CommandPoolVK> command_pool,
       SurfaceProducerVK* surface_producer);
 
   CommandBufferVK(std::weak_ptr<const Context> context,
                   vk::Device device,
                   SurfaceProducerVK* surface_producer,
-                  vk::CommandPool command_pool,
+                  std::shared_ptr<CommandPoolVK> command_pool,
                   vk::UniqueCommandBuffer command_buffer);
 
   // |CommandBuffer|
@@ -32,7 +33,7 @@ class CommandBufferVK final : public CommandBuffer {
   friend class ContextVK;
 
   vk::Device device_;
-  vk::CommandPool command_pool_;
+  std::shared_ptr<CommandPoolVK> command_pool_;
   vk::UniqueCommandBuffer command_buffer_;
   vk::UniqueRenderPass render_pass_;
   SurfaceProducerVK* surface_producer_;
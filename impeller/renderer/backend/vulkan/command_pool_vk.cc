@@ -4,12 +4,19 @@
 
 #include "impeller/renderer/backend/vulkan/command_pool_vk.h"
 
+#include <utility>
+
+#include "impeller/base/validation.h"
+
 namespace impeller {
 
-std::unique_ptr<CommandPoolVK> CommandPoolVK::Create(vk::Device device,
-                                                     uint32_t queue_index) {
+std::shared_ptr<CommandPoolVK> CommandPoolVK::Create(
+    vk::Device device,
+    uint32_t queue_family_index) {
   vk::CommandPoolCreateInfo create_info;
-  create_info.setQueueFamilyIndex(queue_index);
+  create_info.setQueueFamilyIndex(queue_family_index);
+  // Recycled command buffers are reset individually.
+  create_info.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
 
   auto res = device.createCommandPoolUnique(create_info);
   if (res.result != vk::Result::eSuccess) {
@@ -18,16 +25,64 @@ std::unique_ptr<CommandPoolVK> CommandPoolVK::Create(vk::Device device,
     return nullptr;
   }
 
-  return std::make_unique<CommandPoolVK>(std::move(res.value));
+  return std::make_shared<CommandPoolVK>(device, std::move(res.value));
+}
+
+CommandPoolVK::CommandPoolVK(vk::Device device,
+                             vk::UniqueCommandPool command_pool)
+    : device_(device), command_pool_(std::move(command_pool)) {}
+
+CommandPoolVK::~CommandPoolVK() {
+  Lock lock(pool_mutex_);
+  // The recycled buffers must be freed before the pool they came from.
+  recycled_buffers_.clear();
+  command_pool_.reset();
 }
 
 vk::CommandPool CommandPoolVK::Get() const {
+  Lock lock(pool_mutex_);
   return *command_pool_;
 }
 
-CommandPoolVK::CommandPoolVK(vk::UniqueCommandPool command_pool)
-    : command_pool_(std::move(command_pool)) {}
+vk::UniqueCommandBuffer CommandPoolVK::CreateCommandBuffer() {
+  Lock lock(pool_mutex_);
+
+  if (!recycled_buffers_.empty()) {
+    auto buffer = std::move(recycled_buffers_.back());
+    recycled_buffers_.pop_back();
+    auto res = buffer->reset();
+    if (res == vk::Result::eSuccess) {
+      return buffer;
+    }
+    VALIDATION_LOG << "Could not reset recycled command buffer: "
+                   << vk::to_string(res);
+  }
+
+  vk::CommandBufferAllocateInfo allocate_info;
+  allocate_info.setLevel(vk::CommandBufferLevel::ePrimary);
+  allocate_info.setCommandBufferCount(1);
+  allocate_info.setCommandPool(*command_pool_);
+
+  auto res = device_.allocateCommandBuffersUnique(allocate_info);
+  if (res.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to allocate command buffer: "
+                   << vk::to_string(res.result);
+    return {};
+  }
+  return std::move(res.value[0]);
+}
+
+void CommandPoolVK::CollectCommandBuffer(vk::UniqueCommandBuffer buffer) {
+  if (!buffer) {
+    return;
+  }
+  Lock lock(pool_mutex_);
+  recycled_buffers_.emplace_back(std::move(buffer));
+}
 
-CommandPoolVK::~CommandPoolVK() = default;
+size_t CommandPoolVK::GetRecycledCommandBufferCount() const {
+  Lock lock(pool_mutex_);
+  return recycled_buffers_.size();
+}
 
 }  // namespace impeller
@@ -4,24 +4,62 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "flutter/fml/macros.h"
+#include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      A command pool along with the command buffers it has handed
+///             out and gotten back.
+///
+///             Vulkan command pools are externally synchronized. The context
+///             keeps one pool per recording thread so that threads never
+///             contend on the pool while recording. Command buffers that
+///             have finished executing on the GPU are handed back to the
+///             pool they were allocated from and reset on their next use
+///             instead of being freed.
+///
 class CommandPoolVK {
  public:
-  static std::unique_ptr<CommandPoolVK> Create(vk::Device device,
-                                               uint32_t queue_index);
+  static std::shared_ptr<CommandPoolVK> Create(vk::Device device,
+                                               uint32_t queue_family_index);
 
-  explicit CommandPoolVK(vk::UniqueCommandPool command_pool);
+  CommandPoolVK(vk::Device device, vk::UniqueCommandPool command_pool);
 
   ~CommandPoolVK();
 
   vk::CommandPool Get() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Get a primary command buffer ready for recording. Recycled
+  ///             command buffers are reused before new ones are allocated.
+  ///
+  /// @return     The command buffer or a null handle on failure.
+  ///
+  vk::UniqueCommandBuffer CreateCommandBuffer();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Return a command buffer allocated from this pool for reuse.
+  ///             May be called from any thread, but only once the GPU is done
+  ///             with the command buffer (i.e. its fence has been signaled).
+  ///
+  /// @param[in]  buffer  The command buffer to recycle.
+  ///
+  void CollectCommandBuffer(vk::UniqueCommandBuffer buffer);
+
+  size_t GetRecycledCommandBufferCount() const;
+
  private:
-  vk::UniqueCommandPool command_pool_;
+  const vk::Device device_;
+  mutable Mutex pool_mutex_;
+  vk::UniqueCommandPool command_pool_ IPLR_GUARDED_BY(pool_mutex_);
+  std::vector<vk::UniqueCommandBuffer> recycled_buffers_
+      IPLR_GUARDED_BY(pool_mutex_);
 
   FML_DISALLOW_COPY_AND_ASSIGN(CommandPoolVK);
 };
@@ -58,6 +58,16 @@ static std::set<std::string> kRequiredDeviceExtensions = {
 #endif
 };
 
+#if FML_OS_ANDROID
+// Enabled when the device has all of them, so that AHardwareBuffers can be
+// imported as textures. The other dependencies of the hardware buffer
+// extension are core in Vulkan 1.1.
+static std::vector<std::string> kAndroidHardwareBufferDeviceExtensions = {
+    VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME,
+    VK_EXT_QUEUE_FAMILY_FOREIGN_EXTENSION_NAME,
+};
+#endif  // FML_OS_ANDROID
+
 std::vector<std::string> kRequiredWSIInstanceExtensions = {
 #if FML_OS_WIN
     "VK_KHR_win32_surface",
@@ -105,6 +115,21 @@ static std::vector<std::string> HasRequiredExtensions(
   return missing;
 }
 
+[[maybe_unused]] static bool HasDeviceExtensions(
+    const vk::PhysicalDevice& device,
+    const std::vector<std::string>& extensions) {
+  std::set<std::string> exts;
+  for (const auto& ext : device.enumerateDeviceExtensionProperties().value) {
+    exts.insert(ext.extensionName);
+  }
+  for (const auto& ext : extensions) {
+    if (exts.count(ext) != 1u) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static vk::PhysicalDeviceFeatures GetRequiredPhysicalDeviceFeatures() {
   vk::PhysicalDeviceFeatures features;
   features.setRobustBufferAccess(true);
@@ -205,15 +230,36 @@ static std::optional<QueueVK> PickPresentQueue(const vk::PhysicalDevice& device,
 std::shared_ptr<ContextVK> ContextVK::Create(
     PFN_vkGetInstanceProcAddr proc_address_callback,
     const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
-    const std::shared_ptr<const fml::Mapping>& pipeline_cache_data,
+    fml::UniqueFD pipeline_cache_directory,
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
+    const std::string& label) {
+  auto context = std::shared_ptr<ContextVK>(new ContextVK(
+      proc_address_callback,                //
+      shader_libraries_data,                //
+      std::move(pipeline_cache_directory),  //
+      std::move(worker_task_runner),        //
+      label                                 //
+      ));
+  if (!context->IsValid()) {
+    return nullptr;
+  }
+  return context;
+}
+
+std::shared_ptr<ContextVK> ContextVK::Create(
+    PFN_vkGetInstanceProcAddr proc_address_callback,
+    const ExternalHandlesVK& handles,
+    const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
+    fml::UniqueFD pipeline_cache_directory,
     std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
     const std::string& label) {
   auto context = std::shared_ptr<ContextVK>(new ContextVK(
-      proc_address_callback,          //
-      shader_libraries_data,          //
-      pipeline_cache_data,            //
-      std::move(worker_task_runner),  //
-      label                           //
+      proc_address_callback,                //
+      handles,                              //
+      shader_libraries_data,                //
+      std::move(pipeline_cache_directory),  //
+      std::move(worker_task_runner),        //
+      label                                 //
       ));
   if (!context->IsValid()) {
     return nullptr;
@@ -224,7 +270,7 @@ std::shared_ptr<ContextVK> ContextVK::Create(
 ContextVK::ContextVK(
     PFN_vkGetInstanceProcAddr proc_address_callback,
     const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
-    const std::shared_ptr<const fml::Mapping>& pipeline_cache_data,
+    fml::UniqueFD pipeline_cache_directory,
     std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
     const std::string& label)
     : worker_task_runner_(std::move(worker_task_runner)) {
@@ -405,6 +451,15 @@ ContextVK::ContextVK(
   for (const auto& ext : kRequiredDeviceExtensions) {
     required_extensions.push_back(ext.data());
   }
+#if FML_OS_ANDROID
+  if (HasDeviceExtensions(physical_device.value(),
+                          kAndroidHardwareBufferDeviceExtensions)) {
+    for (const auto& ext : kAndroidHardwareBufferDeviceExtensions) {
+      required_extensions.push_back(ext.data());
+    }
+    supports_android_hardware_buffers_ = true;
+  }
+#endif  // FML_OS_ANDROID
 
   const auto queue_create_infos = GetQueueCreateInfos(
       {graphics_queue.value(), compute_queue.value(), transfer_queue.value()});
@@ -423,12 +478,67 @@ ContextVK::ContextVK(
     return;
   }
 
+  instance_ = std::move(instance.value);
+  debug_messenger_ = std::move(debug_messenger);
+  device_ = std::move(device.value);
+  SetupDevice(application_info.apiVersion, graphics_queue->family,
+              device_->getQueue(graphics_queue->family, graphics_queue->index),
+              device_->getQueue(compute_queue->family, compute_queue->index),
+              device_->getQueue(transfer_queue->family, transfer_queue->index),
+              shader_libraries_data, std::move(pipeline_cache_directory));
+}
+
+ContextVK::ContextVK(
+    PFN_vkGetInstanceProcAddr proc_address_callback,
+    const ExternalHandlesVK& handles,
+    const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
+    fml::UniqueFD pipeline_cache_directory,
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
+    const std::string& label)
+    : worker_task_runner_(std::move(worker_task_runner)),
+      owns_instance_and_device_(false) {
+  TRACE_EVENT0("impeller", "ContextVK::Create");
+
+  if (!worker_task_runner_) {
+    VALIDATION_LOG << "Invalid worker task runner.";
+    return;
+  }
+
+  if (!proc_address_callback || !handles.instance ||
+      !handles.physical_device || !handles.device || !handles.queue) {
+    VALIDATION_LOG << "Invalid external Vulkan handles.";
+    return;
+  }
+
+  auto& dispatcher = VULKAN_HPP_DEFAULT_DISPATCHER;
+  dispatcher.init(proc_address_callback);
+  dispatcher.init(handles.instance);
+
+  // The handles are released in the destructor instead of being destroyed.
+  instance_ = vk::UniqueInstance(handles.instance);
+  device_ = vk::UniqueDevice(handles.device);
+  physical_device_ = handles.physical_device;
+  SetupDevice(handles.api_version, handles.queue_family_index, handles.queue,
+              handles.queue, handles.queue, shader_libraries_data,
+              std::move(pipeline_cache_directory));
+}
+
+void ContextVK::SetupDevice(
+    uint32_t api_version,
+    uint32_t graphics_queue_family_index,
+    vk::Queue graphics_queue,
+    vk::Queue compute_queue,
+    vk::Queue transfer_queue,
+    const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
+    fml::UniqueFD pipeline_cache_directory) {
+  auto& dispatcher = VULKAN_HPP_DEFAULT_DISPATCHER;
+
   auto allocator = std::shared_ptr<AllocatorVK>(new AllocatorVK(
       *this,                             //
-      application_info.apiVersion,       //
-      physical_device.value(),           //
-      device.value.get(),                //
-      instance.value.get(),              //
+      api_version,                       //
+      physical_device_,                  //
+      *device_,                          //
+      *instance_,                        //
       dispatcher.vkGetInstanceProcAddr,  //
       dispatcher.vkGetDeviceProcAddr     //
       ));
@@ -439,9 +549,10 @@ ContextVK::ContextVK(
   }
 
   auto pipeline_library = std::shared_ptr<PipelineLibraryVK>(
-      new PipelineLibraryVK(device.value.get(),   //
-                            pipeline_cache_data,  //
-                            worker_task_runner_   //
+      new PipelineLibraryVK(*device_,                             //
+                            physical_device_.getProperties(),     //
+                            std::move(pipeline_cache_directory),  //
+                            worker_task_runner_                   //
                             ));
 
   if (!pipeline_library->IsValid()) {
@@ -449,11 +560,11 @@ ContextVK::ContextVK(
     return;
   }
 
-  auto sampler_library = std::shared_ptr<SamplerLibraryVK>(
-      new SamplerLibraryVK(device.value.get()));
+  auto sampler_library =
+      std::shared_ptr<SamplerLibraryVK>(new SamplerLibraryVK(*device_));
 
   auto shader_library = std::shared_ptr<ShaderLibraryVK>(
-      new ShaderLibraryVK(device.value.get(), shader_libraries_data));
+      new ShaderLibraryVK(*device_, shader_libraries_data));
 
   if (!shader_library->IsValid()) {
     VALIDATION_LOG << "Could not create shader library.";
@@ -467,32 +578,45 @@ ContextVK::ContextVK(
     return;
   }
 
-  instance_ = std::move(instance.value);
-  debug_messenger_ = std::move(debug_messenger);
-  device_ = std::move(device.value);
   allocator_ = std::move(allocator);
   shader_library_ = std::move(shader_library);
   sampler_library_ = std::move(sampler_library);
   pipeline_library_ = std::move(pipeline_library);
   work_queue_ = std::move(work_queue);
-  graphics_queue_ =
-      device_->getQueue(graphics_queue->family, graphics_queue->index);
-  compute_queue_ =
-      device_->getQueue(compute_queue->family, compute_queue->index);
-  transfer_queue_ =
-      device_->getQueue(transfer_queue->family, transfer_queue->index);
-  graphics_command_pool_ =
-      CommandPoolVK::Create(*device_, graphics_queue->index);
+  graphics_queue_ = graphics_queue;
+  compute_queue_ = compute_queue;
+  transfer_queue_ = transfer_queue;
+  graphics_queue_family_index_ = graphics_queue_family_index;
+  gpu_tracer_ = GPUTracerVK::Create(
+      *device_,
+      physical_device_.getQueueFamilyProperties()[graphics_queue_family_index]
+          .timestampValidBits,
+      physical_device_.getProperties().limits.timestampPeriod);
   descriptor_pool_ = std::make_shared<DescriptorPoolVK>(*device_);
+  if (!descriptor_pool_->IsValid()) {
+    VALIDATION_LOG << "Could not create descriptor pools.";
+    return;
+  }
   is_valid_ = true;
 }
 
-ContextVK::~ContextVK() = default;
+ContextVK::~ContextVK() {
+  // Nothing destroys the embedder's instance and device, but the members
+  // collected after this may still use them.
+  if (!owns_instance_and_device_) {
+    device_.release();
+    instance_.release();
+  }
+}
 
 bool ContextVK::IsValid() const {
   return is_valid_;
 }
 
+std::shared_ptr<GPUTracer> ContextVK::GetGPUTracer() const {
+  return gpu_tracer_;
+}
+
 std::shared_ptr<Allocator> ContextVK::GetResourceAllocator() const {
   return allocator_;
 }
@@ -509,6 +633,13 @@ std::shared_ptr<PipelineLibrary> ContextVK::GetPipelineLibrary() const {
   return pipeline_library_;
 }
 
+bool ContextVK::FlushPipelineCache() const {
+  if (!pipeline_library_) {
+    return false;
+  }
+  return pipeline_library_->PersistPipelineCacheToDisk();
+}
+
 // |Context|
 std::shared_ptr<WorkQueue> ContextVK::GetWorkQueue() const {
   return work_queue_;
@@ -516,16 +647,41 @@ std::shared_ptr<WorkQueue> ContextVK::GetWorkQueue() const {
 
 std::shared_ptr<CommandBuffer> ContextVK::CreateCommandBuffer() const {
   return CommandBufferVK::Create(weak_from_this(), *device_,
-                                 graphics_command_pool_->Get(),
+                                 GetThreadLocalCommandPool(),
                                  surface_producer_.get());
 }
 
+std::shared_ptr<CommandPoolVK> ContextVK::GetThreadLocalCommandPool() const {
+  // Command pools may not be used concurrently. Give each thread that records
+  // command buffers (raster, IO, workers) its own pool. The pools are owned by
+  // the context so that they are collected before the device.
+  Lock lock(command_pools_mutex_);
+  auto& pool = command_pools_[std::this_thread::get_id()];
+  if (!pool) {
+    pool = CommandPoolVK::Create(*device_, graphics_queue_family_index_);
+  }
+  return pool;
+}
+
 vk::Instance ContextVK::GetInstance() const {
   return *instance_;
 }
 
-std::unique_ptr<Surface> ContextVK::AcquireSurface(size_t current_frame) {
-  return surface_producer_->AcquireSurface(current_frame);
+vk::Device ContextVK::GetDevice() const {
+  return *device_;
+}
+
+vk::PhysicalDevice ContextVK::GetPhysicalDevice() const {
+  return physical_device_;
+}
+
+bool ContextVK::SupportsAndroidHardwareBuffers() const {
+  return supports_android_hardware_buffers_;
+}
+
+std::unique_ptr<Surface> ContextVK::AcquireSurface(size_t current_frame,
+                                                   const ISize& size) {
+  return surface_producer_->AcquireSurface(current_frame, size);
 }
 
 #ifdef FML_OS_ANDROID
@@ -550,7 +706,8 @@ vk::UniqueSurfaceKHR ContextVK::CreateAndroidSurface(
 
 #endif  // FML_OS_ANDROID
 
-void ContextVK::SetupSwapchain(vk::UniqueSurfaceKHR surface) {
+void ContextVK::SetupSwapchain(vk::UniqueSurfaceKHR surface,
+                               const SwapchainConfigVK& config) {
   surface_ = std::move(surface);
   auto present_queue_out = PickPresentQueue(physical_device_, *surface_);
   if (!present_queue_out.has_value()) {
@@ -565,7 +722,11 @@ void ContextVK::SetupSwapchain(vk::UniqueSurfaceKHR surface) {
     return;
   }
   surface_format_ = swapchain_details->PickSurfaceFormat().format;
-  swapchain_ = SwapchainVK::Create(*device_, *surface_, *swapchain_details);
+  swapchain_ =
+      SwapchainVK::Create(*device_, *surface_, *swapchain_details, config);
+  if (!swapchain_) {
+    return;
+  }
   auto weak_this = weak_from_this();
   surface_producer_ = SurfaceProducerVK::Create(
       weak_this, {
@@ -573,13 +734,49 @@ void ContextVK::SetupSwapchain(vk::UniqueSurfaceKHR surface) {
                      .graphics_queue = graphics_queue_,
                      .present_queue = present_queue_,
                      .swapchain = swapchain_.get(),
+                     .frames_in_flight = config.frames_in_flight,
                  });
 }
 
+bool ContextVK::SetupExternalImages(ExternalImageCallbacksVK callbacks,
+                                    vk::Format format,
+                                    uint32_t frames_in_flight) {
+  surface_format_ = format;
+  present_queue_ = graphics_queue_;
+  surface_producer_ = SurfaceProducerVK::Create(
+      weak_from_this(), {
+                            .device = *device_,
+                            .graphics_queue = graphics_queue_,
+                            .present_queue = present_queue_,
+                            .swapchain = nullptr,
+                            .frames_in_flight = frames_in_flight,
+                            .external_images = std::move(callbacks),
+                        });
+  return surface_producer_ != nullptr;
+}
+
+FramePacingStatsVK ContextVK::GetFramePacingStats() const {
+  if (!surface_producer_) {
+    return {};
+  }
+  return surface_producer_->GetFramePacingStats();
+}
+
 bool ContextVK::SupportsOffscreenMSAA() const {
   return true;
 }
 
+bool ContextVK::SupportsPixelFormat(PixelFormat format) const {
+  if (!IsBlockCompressedPixelFormat(format)) {
+    return true;
+  }
+  // Textures are created with optimal tiling.
+  auto properties =
+      physical_device_.getFormatProperties(ToVKImageFormat(format));
+  return static_cast<bool>(properties.optimalTilingFeatures &
+                           vk::FormatFeatureFlagBits::eSampledImage);
+}
+
 std::shared_ptr<DescriptorPoolVK> ContextVK::GetDescriptorPool() const {
   return descriptor_pool_;
 }
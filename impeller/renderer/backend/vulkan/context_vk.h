@@ -5,13 +5,18 @@
 #pragma once
 
 #include <memory>
+#include <thread>
+#include <unordered_map>
 
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/unique_fd.h"
 #include "impeller/base/backend_cast.h"
+#include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/command_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/descriptor_pool_vk.h"
+#include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
 #include "impeller/renderer/backend/vulkan/pipeline_library_vk.h"
 #include "impeller/renderer/backend/vulkan/sampler_library_vk.h"
 #include "impeller/renderer/backend/vulkan/shader_library_vk.h"
@@ -23,12 +28,41 @@
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      The handles of a Vulkan instance and device that are created and
+///             owned by an embedder. A context created with them renders with
+///             them but never destroys them.
+///
+struct ExternalHandlesVK {
+  vk::Instance instance;
+  /// The Vulkan API version the instance was created with.
+  uint32_t api_version = VK_API_VERSION_1_1;
+  vk::PhysicalDevice physical_device;
+  vk::Device device;
+  /// The family of `queue`, which must support graphics operations.
+  uint32_t queue_family_index = 0u;
+  /// The queue used for graphics, compute and transfer operations.
+  vk::Queue queue;
+};
+
 class ContextVK final : public Context, public BackendCast<ContextVK, Context> {
  public:
   static std::shared_ptr<ContextVK> Create(
       PFN_vkGetInstanceProcAddr proc_address_callback,
       const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
-      const std::shared_ptr<const fml::Mapping>& pipeline_cache_data,
+      fml::UniqueFD pipeline_cache_directory,
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
+      const std::string& label);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a context that renders with the instance and device
+  ///             of an embedder instead of creating its own.
+  ///
+  static std::shared_ptr<ContextVK> Create(
+      PFN_vkGetInstanceProcAddr proc_address_callback,
+      const ExternalHandlesVK& handles,
+      const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
+      fml::UniqueFD pipeline_cache_directory,
       std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
       const std::string& label);
 
@@ -61,12 +95,61 @@ class ContextVK final : public Context, public BackendCast<ContextVK, Context> {
 
   vk::Instance GetInstance() const;
 
-  void SetupSwapchain(vk::UniqueSurfaceKHR surface);
-
-  std::unique_ptr<Surface> AcquireSurface(size_t current_frame);
+  vk::Device GetDevice() const;
+
+  vk::PhysicalDevice GetPhysicalDevice() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the device was created with the extensions that
+  ///             import AHardwareBuffers as textures. This is always false
+  ///             for embedder supplied devices and off Android.
+  ///
+  bool SupportsAndroidHardwareBuffers() const;
+
+  void SetupSwapchain(vk::UniqueSurfaceKHR surface,
+                      const SwapchainConfigVK& config);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Sets up the context to render into images acquired from and
+  ///             presented by an embedder instead of a swapchain.
+  ///
+  /// @param[in]  callbacks         The callbacks that acquire and present the
+  ///                               images.
+  /// @param[in]  format            The format of all the acquired images.
+  /// @param[in]  frames_in_flight  The number of frames the CPU may record
+  ///                               while the GPU is still working on earlier
+  ///                               ones.
+  ///
+  /// @return     If surfaces can be acquired from the context.
+  ///
+  bool SetupExternalImages(ExternalImageCallbacksVK callbacks,
+                           vk::Format format,
+                           uint32_t frames_in_flight);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Acquires the surface of the next frame. The size is only used
+  ///             for external images, the images of a swapchain have the size
+  ///             of the swapchain.
+  ///
+  std::unique_ptr<Surface> AcquireSurface(size_t current_frame,
+                                          const ISize& size);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Frame pacing statistics of the onscreen surface. Returns
+  ///             default statistics if no swapchain has been set up.
+  ///
+  FramePacingStatsVK GetFramePacingStats() const;
 
   std::shared_ptr<DescriptorPoolVK> GetDescriptorPool() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Persist the pipeline cache to the pipeline cache directory.
+  ///             Embedders should call this when the application is
+  ///             backgrounded, as it may not get a chance to shut down
+  ///             cleanly.
+  ///
+  bool FlushPipelineCache() const;
+
 #ifdef FML_OS_ANDROID
   vk::UniqueSurfaceKHR CreateAndroidSurface(ANativeWindow* window) const;
 #endif  // FML_OS_ANDROID
@@ -88,22 +171,52 @@ class ContextVK final : public Context, public BackendCast<ContextVK, Context> {
   vk::UniqueSurfaceKHR surface_;
   vk::Format surface_format_;
   std::unique_ptr<SwapchainVK> swapchain_;
-  std::unique_ptr<CommandPoolVK> graphics_command_pool_;
+  uint32_t graphics_queue_family_index_ = 0u;
+  mutable Mutex command_pools_mutex_;
+  mutable std::unordered_map<std::thread::id, std::shared_ptr<CommandPoolVK>>
+      command_pools_ IPLR_GUARDED_BY(command_pools_mutex_);
   std::unique_ptr<SurfaceProducerVK> surface_producer_;
   std::shared_ptr<WorkQueue> work_queue_;
   std::shared_ptr<DescriptorPoolVK> descriptor_pool_;
+  std::shared_ptr<GPUTracerVK> gpu_tracer_;
+  // Embedder supplied instances and devices are released instead of being
+  // destroyed with the context.
+  bool owns_instance_and_device_ = true;
+  bool supports_android_hardware_buffers_ = false;
   bool is_valid_ = false;
 
   ContextVK(
       PFN_vkGetInstanceProcAddr proc_address_callback,
       const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
-      const std::shared_ptr<const fml::Mapping>& pipeline_cache_data,
+      fml::UniqueFD pipeline_cache_directory,
       std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
       const std::string& label);
 
+  ContextVK(
+      PFN_vkGetInstanceProcAddr proc_address_callback,
+      const ExternalHandlesVK& handles,
+      const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
+      fml::UniqueFD pipeline_cache_directory,
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner,
+      const std::string& label);
+
+  // Creates the allocator, libraries and queues of the context once its
+  // instance and device are set up.
+  void SetupDevice(
+      uint32_t api_version,
+      uint32_t graphics_queue_family_index,
+      vk::Queue graphics_queue,
+      vk::Queue compute_queue,
+      vk::Queue transfer_queue,
+      const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data,
+      fml::UniqueFD pipeline_cache_directory);
+
   // |Context|
   std::shared_ptr<Allocator> GetResourceAllocator() const override;
 
+  // |Context|
+  std::shared_ptr<GPUTracer> GetGPUTracer() const override;
+
   // |Context|
   std::shared_ptr<ShaderLibrary> GetShaderLibrary() const override;
 
@@ -116,6 +229,8 @@ class ContextVK final : public Context, public BackendCast<ContextVK, Context> {
   // |Context|
   std::shared_ptr<CommandBuffer> CreateCommandBuffer() const override;
 
+  std::shared_ptr<CommandPoolVK> GetThreadLocalCommandPool() const;
+
   // |Context|
   PixelFormat GetColorAttachmentPixelFormat() const override;
 
@@ -125,6 +240,9 @@ class ContextVK final : public Context, public BackendCast<ContextVK, Context> {
   // |Context|
   bool SupportsOffscreenMSAA() const override;
 
+  // |Context|
+  bool SupportsPixelFormat(PixelFormat format) const override;
+
   FML_DISALLOW_COPY_AND_ASSIGN(ContextVK);
 };
 
@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/vulkan/descriptor_pool_vk.h"
 
+#include "flutter/fml/hash_combine.h"
 #include "fml/logging.h"
 #include "impeller/base/validation.h"
 #include "vulkan/vulkan_enums.hpp"
@@ -11,6 +12,29 @@
 namespace impeller {
 
 DescriptorPoolVK::DescriptorPoolVK(vk::Device device) : device_(device) {
+  for (auto& frame : frames_) {
+    auto pool = CreatePool();
+    if (!pool.has_value()) {
+      return;
+    }
+    frame.pools.push_back(pool.value());
+  }
+  is_valid_ = true;
+}
+
+DescriptorPoolVK::~DescriptorPoolVK() {
+  for (auto& frame : frames_) {
+    for (auto pool : frame.pools) {
+      device_.destroyDescriptorPool(pool);
+    }
+  }
+}
+
+bool DescriptorPoolVK::IsValid() const {
+  return is_valid_;
+}
+
+std::optional<vk::DescriptorPool> DescriptorPoolVK::CreatePool() const {
   constexpr size_t kPoolSize = 1024;
 
   std::vector<vk::DescriptorPoolSize> pool_sizes = {
@@ -27,31 +51,89 @@ DescriptorPoolVK::DescriptorPoolVK(vk::Device device) : device_(device) {
       {vk::DescriptorType::eInputAttachment, kPoolSize},
   };
 
+  // Sets are only ever reclaimed by resetting the whole pool, so individual
+  // sets don't need to be freeable.
   vk::DescriptorPoolCreateInfo pool_info = {
-      vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet,  // flags
+      {},                                                    // flags
       static_cast<uint32_t>(pool_sizes.size() * kPoolSize),  // max sets
       static_cast<uint32_t>(pool_sizes.size()),              // pool sizes count
       pool_sizes.data()                                      // pool sizes
   };
 
-  auto res = device.createDescriptorPool(pool_info);
+  auto res = device_.createDescriptorPool(pool_info);
   if (res.result != vk::Result::eSuccess) {
     VALIDATION_LOG << "Unable to create a descriptor pool";
-    return;
+    return std::nullopt;
   }
+  return res.value;
+}
 
-  pool_ = res.value;
-  is_valid_ = true;
+std::optional<vk::DescriptorSet> DescriptorPoolVK::GetCachedDescriptorSet(
+    uint32_t frame_num,
+    const DescriptorSetKeyVK& key) const {
+  const auto& sets = frames_[frame_num % kMaxFramesInFlight].sets;
+  if (auto found = sets.find(key); found != sets.end()) {
+    return found->second;
+  }
+  return std::nullopt;
+}
+
+std::optional<vk::DescriptorSet> DescriptorPoolVK::AllocateDescriptorSet(
+    uint32_t frame_num,
+    vk::DescriptorSetLayout layout,
+    DescriptorSetKeyVK key) {
+  if (!is_valid_) {
+    return std::nullopt;
+  }
+  auto& frame = frames_[frame_num % kMaxFramesInFlight];
+
+  vk::DescriptorSetAllocateInfo alloc_info;
+  alloc_info.setSetLayouts(layout);
+
+  while (true) {
+    alloc_info.setDescriptorPool(frame.pools[frame.active_pool]);
+    vk::DescriptorSet set;
+    auto result = device_.allocateDescriptorSets(&alloc_info, &set);
+    if (result == vk::Result::eSuccess) {
+      frame.sets[std::move(key)] = set;
+      return set;
+    }
+    if (result != vk::Result::eErrorOutOfPoolMemory &&
+        result != vk::Result::eErrorFragmentedPool) {
+      VALIDATION_LOG << "Failed to allocate descriptor sets: "
+                     << vk::to_string(result);
+      return std::nullopt;
+    }
+    // The active pool is exhausted. Move on to the next pool of the frame,
+    // creating one if this is the busiest the frame has been.
+    frame.active_pool++;
+    if (frame.active_pool == frame.pools.size()) {
+      auto pool = CreatePool();
+      if (!pool.has_value()) {
+        frame.active_pool--;
+        return std::nullopt;
+      }
+      frame.pools.push_back(pool.value());
+    }
+  }
 }
 
-vk::DescriptorPool DescriptorPoolVK::GetPool() {
-  return pool_;
+void DescriptorPoolVK::ResetFrame(uint32_t frame_num) {
+  auto& frame = frames_[frame_num % kMaxFramesInFlight];
+  frame.sets.clear();
+  frame.active_pool = 0u;
+  for (auto pool : frame.pools) {
+    device_.resetDescriptorPool(pool);
+  }
 }
 
-DescriptorPoolVK::~DescriptorPoolVK() {
-  if (is_valid_) {
-    device_.destroyDescriptorPool(pool_);
+std::size_t DescriptorPoolVK::KeyHash::operator()(
+    const DescriptorSetKeyVK& key) const {
+  std::size_t hash = key.size();
+  for (auto word : key) {
+    fml::HashCombineSeed(hash, word);
   }
+  return hash;
 }
 
 }  // namespace impeller
@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
@@ -13,19 +17,68 @@
 
 namespace impeller {
 
+//------------------------------------------------------------------------------
+/// @brief      Identifies the layout and the contents of a descriptor set.
+///             Descriptor sets with equal keys can be shared between commands
+///             in the same frame.
+///
+using DescriptorSetKeyVK = std::vector<uint64_t>;
+
+//------------------------------------------------------------------------------
+/// @brief      A ring of descriptor pools, one set of pools per frame in
+///             flight. Descriptor sets are never freed individually. Instead,
+///             all the pools of a frame are reset at once when the frame is
+///             reused, after its fence has signaled.
+///
 class DescriptorPoolVK {
  public:
   explicit DescriptorPoolVK(vk::Device device);
 
   ~DescriptorPoolVK();
 
-  vk::DescriptorPool GetPool();
+  bool IsValid() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get a descriptor set with the given key that was already
+  ///             allocated and written to during the frame.
+  ///
+  std::optional<vk::DescriptorSet> GetCachedDescriptorSet(
+      uint32_t frame_num,
+      const DescriptorSetKeyVK& key) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Allocate a descriptor set that lives until the frame is
+  ///             reset. The caller must write to the set before the set is
+  ///             returned from |GetCachedDescriptorSet| for the same key.
+  ///
+  std::optional<vk::DescriptorSet> AllocateDescriptorSet(
+      uint32_t frame_num,
+      vk::DescriptorSetLayout layout,
+      DescriptorSetKeyVK key);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reclaim all the descriptor sets allocated for the frame. The
+  ///             previous submission of the frame must have completed.
+  ///
+  void ResetFrame(uint32_t frame_num);
 
  private:
+  struct KeyHash {
+    std::size_t operator()(const DescriptorSetKeyVK& key) const;
+  };
+
+  struct FramePoolsVK {
+    std::vector<vk::DescriptorPool> pools;
+    size_t active_pool = 0u;
+    std::unordered_map<DescriptorSetKeyVK, vk::DescriptorSet, KeyHash> sets;
+  };
+
   vk::Device device_;
-  vk::DescriptorPool pool_;
+  FramePoolsVK frames_[kMaxFramesInFlight];
   bool is_valid_ = false;
 
+  std::optional<vk::DescriptorPool> CreatePool() const;
+
   FML_DISALLOW_COPY_AND_ASSIGN(DescriptorPoolVK);
 };
 
@@ -154,6 +154,18 @@ constexpr vk::Format ToVKImageFormat(PixelFormat format) {
       return vk::Format::eR8Unorm;
     case PixelFormat::kR8G8UNormInt:
       return vk::Format::eR8G8Unorm;
+    case PixelFormat::kASTC4x4UNormInt:
+      return vk::Format::eAstc4x4UnormBlock;
+    case PixelFormat::kETC2R8G8B8UNormInt:
+      return vk::Format::eEtc2R8G8B8UnormBlock;
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+      return vk::Format::eEtc2R8G8B8A8UnormBlock;
+    case PixelFormat::kBC1R8G8B8A8UNormInt:
+      return vk::Format::eBc1RgbaUnormBlock;
+    case PixelFormat::kBC3R8G8B8A8UNormInt:
+      return vk::Format::eBc3UnormBlock;
+    case PixelFormat::kBC7R8G8B8A8UNormInt:
+      return vk::Format::eBc7UnormBlock;
   }
 
   FML_UNREACHABLE();
@@ -188,6 +200,24 @@ constexpr PixelFormat ToPixelFormat(vk::Format format) {
     case vk::Format::eR8G8Unorm:
       return PixelFormat::kR8G8UNormInt;
 
+    case vk::Format::eAstc4x4UnormBlock:
+      return PixelFormat::kASTC4x4UNormInt;
+
+    case vk::Format::eEtc2R8G8B8UnormBlock:
+      return PixelFormat::kETC2R8G8B8UNormInt;
+
+    case vk::Format::eEtc2R8G8B8A8UnormBlock:
+      return PixelFormat::kETC2R8G8B8A8UNormInt;
+
+    case vk::Format::eBc1RgbaUnormBlock:
+      return PixelFormat::kBC1R8G8B8A8UNormInt;
+
+    case vk::Format::eBc3UnormBlock:
+      return PixelFormat::kBC3R8G8B8A8UNormInt;
+
+    case vk::Format::eBc7UnormBlock:
+      return PixelFormat::kBC7R8G8B8A8UNormInt;
+
     default:
       return PixelFormat::kUnknown;
   }
@@ -0,0 +1,125 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
+
+#include <utility>
+
+#include "impeller/base/validation.h"
+
+namespace impeller {
+
+std::shared_ptr<GPUTracerVK> GPUTracerVK::Create(vk::Device device,
+                                                 uint32_t timestamp_valid_bits,
+                                                 float timestamp_period) {
+  return std::shared_ptr<GPUTracerVK>(
+      new GPUTracerVK(device, timestamp_valid_bits, timestamp_period));
+}
+
+GPUTracerVK::GPUTracerVK(vk::Device device,
+                         uint32_t timestamp_valid_bits,
+                         float timestamp_period)
+    : device_(device),
+      timestamp_mask_(timestamp_valid_bits >= 64u
+                          ? ~0ull
+                          : (1ull << timestamp_valid_bits) - 1ull),
+      timestamp_period_(timestamp_period) {
+  if (timestamp_valid_bits == 0u) {
+    return;
+  }
+
+  Lock lock(frames_mutex_);
+  for (auto& frame : frames_) {
+    vk::QueryPoolCreateInfo query_pool_info;
+    query_pool_info.setQueryType(vk::QueryType::eTimestamp);
+    query_pool_info.setQueryCount(kMaxRegionsPerFrame * 2u);
+    auto res = device_.createQueryPoolUnique(query_pool_info);
+    if (res.result != vk::Result::eSuccess) {
+      VALIDATION_LOG << "Could not create timestamp query pool: "
+                     << vk::to_string(res.result);
+      return;
+    }
+    frame.query_pool = std::move(res.value);
+    frame.regions.reserve(kMaxRegionsPerFrame);
+  }
+  supports_timestamp_queries_ = true;
+}
+
+GPUTracerVK::~GPUTracerVK() = default;
+
+bool GPUTracerVK::SupportsTimestampQueries() const {
+  return supports_timestamp_queries_;
+}
+
+std::optional<uint32_t> GPUTracerVK::BeginRegion(
+    const vk::CommandBuffer& buffer,
+    uint32_t frame_num,
+    std::string label) {
+  if (!supports_timestamp_queries_ || frame_num >= kMaxFramesInFlight) {
+    return std::nullopt;
+  }
+
+  Lock lock(frames_mutex_);
+  auto& frame = frames_[frame_num];
+  if (frame.regions.size() == kMaxRegionsPerFrame) {
+    return std::nullopt;
+  }
+
+  const auto region = static_cast<uint32_t>(frame.regions.size());
+  frame.regions.push_back({std::move(label), fml::TimePoint::Now()});
+
+  buffer.resetQueryPool(*frame.query_pool, region * 2u, 2u);
+  buffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe,
+                        *frame.query_pool, region * 2u);
+  return region;
+}
+
+void GPUTracerVK::EndRegion(const vk::CommandBuffer& buffer,
+                            uint32_t frame_num,
+                            uint32_t region) {
+  if (!supports_timestamp_queries_ || frame_num >= kMaxFramesInFlight) {
+    return;
+  }
+
+  Lock lock(frames_mutex_);
+  buffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe,
+                        *frames_[frame_num].query_pool, region * 2u + 1u);
+}
+
+void GPUTracerVK::OnFrameCompleted(uint32_t frame_num) {
+  if (!supports_timestamp_queries_ || frame_num >= kMaxFramesInFlight) {
+    return;
+  }
+
+  Lock lock(frames_mutex_);
+  auto& frame = frames_[frame_num];
+  for (size_t i = 0; i < frame.regions.size(); i++) {
+    std::array<uint64_t, 2> timestamps = {};
+    // The fence has been signaled so the results of submitted regions are
+    // available. Regions in command buffers that never made it to the queue
+    // are not, and are skipped.
+    const auto res = device_.getQueryPoolResults(
+        *frame.query_pool,            // query pool
+        i * 2u,                       // first query
+        2u,                           // query count
+        sizeof(timestamps),           // data size
+        timestamps.data(),            // data
+        sizeof(uint64_t),             // stride
+        vk::QueryResultFlagBits::e64  // flags
+    );
+    if (res != vk::Result::eSuccess) {
+      continue;
+    }
+    const auto ticks = ((timestamps[1] & timestamp_mask_) -
+                        (timestamps[0] & timestamp_mask_)) &
+                       timestamp_mask_;
+    RecordCompletedRegion(
+        frame.regions[i].label, frame.regions[i].cpu_start,
+        fml::TimeDelta::FromNanoseconds(static_cast<int64_t>(
+            static_cast<double>(ticks) * timestamp_period_)));
+  }
+  frame.regions.clear();
+}
+
+}  // namespace impeller
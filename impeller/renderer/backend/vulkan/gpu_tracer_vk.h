@@ -0,0 +1,107 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/base/backend_cast.h"
+#include "impeller/base/thread.h"
+#include "impeller/renderer/backend/vulkan/vk.h"
+#include "impeller/renderer/gpu_tracer.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Measures the GPU time taken by labelled regions of command
+///             buffers with timestamp queries.
+///
+///             Each frame in flight has its own query pool. Results are read
+///             back once the fence of the frame has been signaled, just
+///             before the frame's resources are reused.
+///
+class GPUTracerVK final : public GPUTracer,
+                          public BackendCast<GPUTracerVK, GPUTracer> {
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      Create a tracer for command buffers submitted to a queue
+  ///             family with the given properties.
+  ///
+  /// @param[in]  device                The device.
+  /// @param[in]  timestamp_valid_bits  The number of valid bits in timestamps
+  ///                                   written by the queue family. Zero if
+  ///                                   timestamps are unsupported.
+  /// @param[in]  timestamp_period      The number of nanoseconds per
+  ///                                   timestamp tick.
+  ///
+  static std::shared_ptr<GPUTracerVK> Create(vk::Device device,
+                                             uint32_t timestamp_valid_bits,
+                                             float timestamp_period);
+
+  // |GPUTracer|
+  ~GPUTracerVK() override;
+
+  // |GPUTracer|
+  bool SupportsTimestampQueries() const override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the start of a labelled region of a frame into the
+  ///             command buffer. This must be recorded outside of a render
+  ///             pass instance.
+  ///
+  /// @return     The region to end, or nothing if timestamps are not
+  ///             supported or the frame has run out of queries.
+  ///
+  std::optional<uint32_t> BeginRegion(const vk::CommandBuffer& buffer,
+                                      uint32_t frame_num,
+                                      std::string label);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the end of a region into the same command buffer it
+  ///             was started in.
+  ///
+  void EndRegion(const vk::CommandBuffer& buffer,
+                 uint32_t frame_num,
+                 uint32_t region);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Read back the results of the regions of a frame whose fence
+  ///             has been signaled, and make its queries available for reuse.
+  ///
+  void OnFrameCompleted(uint32_t frame_num);
+
+ private:
+  static constexpr uint32_t kMaxRegionsPerFrame = 32u;
+
+  struct Region {
+    std::string label;
+    fml::TimePoint cpu_start;
+  };
+
+  struct FrameQueries {
+    vk::UniqueQueryPool query_pool;
+    std::vector<Region> regions;
+  };
+
+  const vk::Device device_;
+  const uint64_t timestamp_mask_;
+  const float timestamp_period_;
+  bool supports_timestamp_queries_ = false;
+  Mutex frames_mutex_;
+  std::array<FrameQueries, kMaxFramesInFlight> frames_ IPLR_GUARDED_BY(
+      frames_mutex_);
+
+  GPUTracerVK(vk::Device device,
+              uint32_t timestamp_valid_bits,
+              float timestamp_period);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GPUTracerVK);
+};
+
+}  // namespace impeller
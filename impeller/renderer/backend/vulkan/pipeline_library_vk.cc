@@ -4,9 +4,12 @@
 
 #include "impeller/renderer/backend/vulkan/pipeline_library_vk.h"
 
+#include <cstring>
 #include <optional>
 
 #include "flutter/fml/container.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/promise.h"
 #include "impeller/base/validation.h"
@@ -17,20 +20,83 @@
 
 namespace impeller {
 
+static constexpr const char* kPipelineCacheFileName =
+    "flutter.impeller.vkcache";
+
+// Precedes the pipeline cache data on disk. Drivers are meant to reject data
+// from other devices but not all of them do, so the cache is only handed to
+// the driver if it was written by the same device and driver.
+struct PipelineCacheHeaderVK {
+  // Bumped whenever the layout of the header changes.
+  uint32_t version = 1u;
+  uint32_t vendor_id = 0u;
+  uint32_t device_id = 0u;
+  uint32_t driver_version = 0u;
+  uint8_t uuid[VK_UUID_SIZE] = {};
+  uint64_t data_size = 0u;
+
+  explicit PipelineCacheHeaderVK(const vk::PhysicalDeviceProperties& props)
+      : vendor_id(props.vendorID),
+        device_id(props.deviceID),
+        driver_version(props.driverVersion) {
+    std::memcpy(uuid, props.pipelineCacheUUID, VK_UUID_SIZE);
+  }
+
+  bool IsCompatibleWith(const PipelineCacheHeaderVK& o) const {
+    return version == o.version && vendor_id == o.vendor_id &&
+           device_id == o.device_id && driver_version == o.driver_version &&
+           std::memcmp(uuid, o.uuid, VK_UUID_SIZE) == 0;
+  }
+};
+
+static std::unique_ptr<fml::Mapping> OpenPipelineCacheData(
+    const fml::UniqueFD& cache_directory,
+    const vk::PhysicalDeviceProperties& props) {
+  if (!cache_directory.is_valid()) {
+    return nullptr;
+  }
+  auto mapping = fml::FileMapping::CreateReadOnly(cache_directory,
+                                                  kPipelineCacheFileName);
+  if (!mapping) {
+    return nullptr;
+  }
+  const PipelineCacheHeaderVK expected(props);
+  PipelineCacheHeaderVK header(props);
+  if (mapping->GetSize() < sizeof(header)) {
+    FML_LOG(INFO) << "Discarding a truncated pipeline cache.";
+    return nullptr;
+  }
+  std::memcpy(&header, mapping->GetMapping(), sizeof(header));
+  if (!header.IsCompatibleWith(expected) ||
+      header.data_size != mapping->GetSize() - sizeof(header)) {
+    FML_LOG(INFO) << "Discarding a pipeline cache from a different device or "
+                     "driver.";
+    return nullptr;
+  }
+  return mapping;
+}
+
 PipelineLibraryVK::PipelineLibraryVK(
     const vk::Device& device,
-    const std::shared_ptr<const fml::Mapping>& pipeline_cache_data,
+    const vk::PhysicalDeviceProperties& device_properties,
+    fml::UniqueFD cache_directory,
     std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner)
-    : worker_task_runner_(std::move(worker_task_runner)) {
+    : device_properties_(device_properties),
+      cache_directory_(std::move(cache_directory)),
+      worker_task_runner_(std::move(worker_task_runner)) {
   if (!worker_task_runner_) {
     return;
   }
 
   vk::PipelineCacheCreateInfo cache_info;
 
+  auto pipeline_cache_data =
+      OpenPipelineCacheData(cache_directory_, device_properties_);
   if (pipeline_cache_data) {
-    cache_info.pInitialData = pipeline_cache_data->GetMapping();
-    cache_info.initialDataSize = pipeline_cache_data->GetSize();
+    cache_info.pInitialData =
+        pipeline_cache_data->GetMapping() + sizeof(PipelineCacheHeaderVK);
+    cache_info.initialDataSize =
+        pipeline_cache_data->GetSize() - sizeof(PipelineCacheHeaderVK);
   }
 
   auto cache = device.createPipelineCacheUnique(cache_info);
@@ -45,7 +111,40 @@ PipelineLibraryVK::PipelineLibraryVK(
   is_valid_ = true;
 }
 
-PipelineLibraryVK::~PipelineLibraryVK() = default;
+PipelineLibraryVK::~PipelineLibraryVK() {
+  PersistPipelineCacheToDisk();
+}
+
+bool PipelineLibraryVK::PersistPipelineCacheToDisk() const {
+  if (!is_valid_ || !cache_directory_.is_valid()) {
+    return false;
+  }
+  TRACE_EVENT0("impeller", "PipelineLibraryVK::PersistPipelineCacheToDisk");
+
+  // See the note in the header about why this is a writer lock.
+  WriterLock lock(cache_mutex_);
+  auto data = device_.getPipelineCacheData(*cache_);
+  if (data.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not get pipeline cache data: "
+                   << vk::to_string(data.result);
+    return false;
+  }
+
+  PipelineCacheHeaderVK header(device_properties_);
+  header.data_size = data.value.size();
+
+  std::vector<uint8_t> contents(sizeof(header) + data.value.size());
+  std::memcpy(contents.data(), &header, sizeof(header));
+  std::memcpy(contents.data() + sizeof(header), data.value.data(),
+              data.value.size());
+
+  if (!fml::WriteAtomically(cache_directory_, kPipelineCacheFileName,
+                            fml::DataMapping{std::move(contents)})) {
+    VALIDATION_LOG << "Could not write the pipeline cache to disk.";
+    return false;
+  }
+  return true;
+}
 
 // |PipelineLibrary|
 bool PipelineLibraryVK::IsValid() const {
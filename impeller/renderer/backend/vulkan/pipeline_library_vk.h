@@ -7,6 +7,7 @@
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/unique_fd.h"
 #include "impeller/base/backend_cast.h"
 #include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/pipeline_vk.h"
@@ -25,10 +26,22 @@ class PipelineLibraryVK final
   // |PipelineLibrary|
   ~PipelineLibraryVK() override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Write the contents of the pipeline cache to the cache
+  ///             directory so that the next launch can skip compiling the
+  ///             pipelines created so far. Does nothing if there is no cache
+  ///             directory.
+  ///
+  /// @return     If the cache was persisted.
+  ///
+  bool PersistPipelineCacheToDisk() const;
+
  private:
   friend ContextVK;
 
   vk::Device device_;
+  vk::PhysicalDeviceProperties device_properties_;
+  fml::UniqueFD cache_directory_;
   // On locking around the pipeline cache: The cache is internally synchronized.
   // So there is no need to hold a writer lock around its use when pipelines are
   // being created. The time it takes for implementations to spend within the
@@ -44,7 +57,8 @@ class PipelineLibraryVK final
 
   PipelineLibraryVK(
       const vk::Device& device,
-      const std::shared_ptr<const fml::Mapping>& pipeline_cache_data,
+      const vk::PhysicalDeviceProperties& device_properties,
+      fml::UniqueFD cache_directory,
       std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner);
 
   // |PipelineLibrary|
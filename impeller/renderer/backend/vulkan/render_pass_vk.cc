@@ -12,6 +12,7 @@
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/device_buffer_vk.h"
 #include "impeller/renderer/backend/vulkan/formats_vk.h"
+#include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
 #include "impeller/renderer/backend/vulkan/pipeline_vk.h"
 #include "impeller/renderer/backend/vulkan/sampler_vk.h"
 #include "impeller/renderer/backend/vulkan/surface_producer_vk.h"
@@ -25,21 +26,61 @@ namespace impeller {
 
 static uint32_t color_flash = 0;
 
+// The descriptors of a command, keyed by their binding.
+struct DescriptorWritesVK {
+  std::vector<std::pair<uint32_t, vk::DescriptorBufferInfo>> buffers;
+  std::vector<std::pair<uint32_t, vk::DescriptorImageInfo>> images;
+};
+
+template <class VKHandle>
+static uint64_t ToDescriptorSetKeyWord(VKHandle handle) {
+  return reinterpret_cast<uint64_t>(
+      static_cast<typename VKHandle::NativeType>(handle));
+}
+
+static DescriptorSetKeyVK ToDescriptorSetKey(vk::DescriptorSetLayout layout,
+                                             const DescriptorWritesVK& writes) {
+  DescriptorSetKeyVK key;
+  key.reserve(1u + writes.buffers.size() * 4u + writes.images.size() * 3u);
+  key.push_back(ToDescriptorSetKeyWord(layout));
+  for (const auto& [binding, info] : writes.buffers) {
+    key.push_back(binding);
+    key.push_back(ToDescriptorSetKeyWord(info.buffer));
+    key.push_back(info.offset);
+    key.push_back(info.range);
+  }
+  for (const auto& [binding, info] : writes.images) {
+    // Distinguishes image bindings from buffer bindings.
+    key.push_back(binding | (1ull << 32));
+    key.push_back(ToDescriptorSetKeyWord(info.imageView));
+    key.push_back(ToDescriptorSetKeyWord(info.sampler));
+  }
+  return key;
+}
+
 RenderPassVK::RenderPassVK(std::weak_ptr<const Context> context,
                            vk::Device device,
                            const RenderTarget& target,
+                           std::shared_ptr<CommandPoolVK> command_pool,
                            vk::UniqueCommandBuffer command_buffer,
                            vk::UniqueRenderPass render_pass,
                            SurfaceProducerVK* surface_producer)
     : RenderPass(std::move(context), target),
       device_(device),
+      command_pool_(std::move(command_pool)),
       command_buffer_(std::move(command_buffer)),
       render_pass_(std::move(render_pass)),
       surface_producer_(surface_producer) {
   is_valid_ = true;
 }
 
-RenderPassVK::~RenderPassVK() = default;
+RenderPassVK::~RenderPassVK() {
+  // A pass that was never encoded still owns its command buffer, which was
+  // never submitted and so can be recycled right away.
+  if (command_buffer_) {
+    command_pool_->CollectCommandBuffer(std::move(command_buffer_));
+  }
+}
 
 bool RenderPassVK::IsValid() const {
   return is_valid_;
@@ -102,6 +143,15 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
                            .setRenderArea(render_area)
                            .setClearValues(clear_value);
 
+  // Timestamp queries are reset outside of the render pass instance.
+  std::optional<uint32_t> gpu_region;
+  auto gpu_tracer = context.GetGPUTracer();
+  if (gpu_tracer) {
+    gpu_region = GPUTracerVK::Cast(*gpu_tracer)
+                     .BeginRegion(*command_buffer_, frame_num,
+                                  label_.empty() ? "RenderPassVK" : label_);
+  }
+
   command_buffer_->beginRenderPass(rp_begin_info, vk::SubpassContents::eInline);
 
   const auto& transients_allocator = context.GetResourceAllocator();
@@ -127,6 +177,11 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
 
   command_buffer_->endRenderPass();
 
+  if (gpu_region.has_value()) {
+    GPUTracerVK::Cast(*gpu_tracer)
+        .EndRegion(*command_buffer_, frame_num, gpu_region.value());
+  }
+
   return const_cast<RenderPassVK*>(this)->EndCommandBuffer(frame_num);
 }
 
@@ -140,7 +195,7 @@ bool RenderPassVK::EndCommandBuffer(uint32_t frame_num) {
 
     surface_producer_->StashRP(frame_num, std::move(render_pass_));
 
-    return surface_producer_->QueueCommandBuffer(frame_num,
+    return surface_producer_->QueueCommandBuffer(frame_num, command_pool_,
                                                  std::move(command_buffer_));
   }
   return false;
@@ -210,53 +265,66 @@ bool RenderPassVK::AllocateAndBindDescriptorSets(
   auto& allocator = *context.GetResourceAllocator();
   vk::PipelineLayout pipeline_layout =
       pipeline_create_info->GetPipelineLayout();
+  vk::DescriptorSetLayout descriptor_set_layout =
+      pipeline_create_info->GetDescriptorSetLayout();
 
-  const auto& context_vk = ContextVK::Cast(context);
-  const auto& pool = context_vk.GetDescriptorPool();
-
-  vk::DescriptorSetAllocateInfo alloc_info;
-  std::array<vk::DescriptorSetLayout, 1> dsls = {
-      pipeline_create_info->GetDescriptorSetLayout(),
-  };
-
-  alloc_info.setDescriptorPool(pool->GetPool());
-  alloc_info.setSetLayouts(dsls);
-
-  auto desc_sets_res = device_.allocateDescriptorSets(alloc_info);
-  if (desc_sets_res.result != vk::Result::eSuccess) {
-    VALIDATION_LOG << "Failed to allocate descriptor sets: "
-                   << vk::to_string(desc_sets_res.result);
+  DescriptorWritesVK writes;
+  if (!CollectDescriptorWrites(frame_num, command.vertex_bindings, allocator,
+                               writes)) {
     return false;
   }
-
-  auto desc_sets = desc_sets_res.value;
-  bool update_vertex_descriptors =
-      UpdateDescriptorSets(frame_num, "vertex_bindings",
-                           command.vertex_bindings, allocator, desc_sets[0]);
-  if (!update_vertex_descriptors) {
+  if (!CollectDescriptorWrites(frame_num, command.fragment_bindings, allocator,
+                               writes)) {
     return false;
   }
-  bool update_frag_descriptors =
-      UpdateDescriptorSets(frame_num, "fragment_bindings",
-                           command.fragment_bindings, allocator, desc_sets[0]);
-  if (!update_frag_descriptors) {
-    return false;
+
+  // Commands in the same frame that bind identical resources share a single
+  // descriptor set.
+  const auto& pool = ContextVK::Cast(context).GetDescriptorPool();
+  auto key = ToDescriptorSetKey(descriptor_set_layout, writes);
+  auto desc_set = pool->GetCachedDescriptorSet(frame_num, key);
+  if (!desc_set.has_value()) {
+    desc_set = pool->AllocateDescriptorSet(frame_num, descriptor_set_layout,
+                                           std::move(key));
+    if (!desc_set.has_value()) {
+      return false;
+    }
+
+    std::vector<vk::WriteDescriptorSet> set_writes;
+    set_writes.reserve(writes.buffers.size() + writes.images.size());
+    for (const auto& [binding, info] : writes.buffers) {
+      vk::WriteDescriptorSet set_write;
+      set_write.setDstSet(desc_set.value());
+      set_write.setDstBinding(binding);
+      set_write.setDescriptorCount(1);
+      set_write.setDescriptorType(vk::DescriptorType::eUniformBuffer);
+      set_write.setPBufferInfo(&info);
+      set_writes.push_back(set_write);
+    }
+    for (const auto& [binding, info] : writes.images) {
+      vk::WriteDescriptorSet set_write;
+      set_write.setDstSet(desc_set.value());
+      set_write.setDstBinding(binding);
+      set_write.setDescriptorCount(1);
+      set_write.setDescriptorType(vk::DescriptorType::eCombinedImageSampler);
+      set_write.setPImageInfo(&info);
+      set_writes.push_back(set_write);
+    }
+
+    std::array<vk::CopyDescriptorSet, 0> copies;
+    device_.updateDescriptorSets(set_writes, copies);
   }
 
   command_buffer_->bindDescriptorSets(vk::PipelineBindPoint::eGraphics,
-                                      pipeline_layout, 0, desc_sets, nullptr);
+                                      pipeline_layout, 0, desc_set.value(),
+                                      nullptr);
   return true;
 }
 
-bool RenderPassVK::UpdateDescriptorSets(uint32_t frame_num,
-                                        const char* label,
-                                        const Bindings& bindings,
-                                        Allocator& allocator,
-                                        vk::DescriptorSet desc_set) const {
-  std::vector<vk::WriteDescriptorSet> writes;
-  std::vector<vk::DescriptorBufferInfo> buffer_infos;
-  std::vector<vk::DescriptorImageInfo> image_infos;
-
+bool RenderPassVK::CollectDescriptorWrites(uint32_t frame_num,
+                                           const Bindings& bindings,
+                                           Allocator& allocator,
+                                           DescriptorWritesVK& writes) const {
   for (const auto& [buffer_index, view] : bindings.buffers) {
     const auto& buffer_view = view.resource.buffer;
 
@@ -282,18 +350,9 @@ bool RenderPassVK::UpdateDescriptorSets(uint32_t frame_num,
     desc_buffer_info.setBuffer(buffer);
     desc_buffer_info.setOffset(offset);
     desc_buffer_info.setRange(view.resource.range.length);
-    buffer_infos.push_back(desc_buffer_info);
 
     const ShaderUniformSlot& uniform = bindings.uniforms.at(buffer_index);
-
-    vk::WriteDescriptorSet setWrite;
-    setWrite.setDstSet(desc_set);
-    setWrite.setDstBinding(uniform.binding);
-    setWrite.setDescriptorCount(1);
-    setWrite.setDescriptorType(vk::DescriptorType::eUniformBuffer);
-    setWrite.setPBufferInfo(&buffer_infos.back());
-
-    writes.push_back(setWrite);
+    writes.buffers.emplace_back(uniform.binding, desc_buffer_info);
   }
 
   for (const auto& [index, sampler_handle] : bindings.samplers) {
@@ -320,21 +379,9 @@ bool RenderPassVK::UpdateDescriptorSets(uint32_t frame_num,
     desc_image_info.setImageLayout(vk::ImageLayout::eGeneral);
     desc_image_info.setSampler(sampler_vk.GetSamplerVK());
     desc_image_info.setImageView(texture_vk.GetImageView());
-    image_infos.push_back(desc_image_info);
-
-    vk::WriteDescriptorSet setWrite;
-    setWrite.setDstSet(desc_set);
-    setWrite.setDstBinding(slot.binding);
-    setWrite.setDescriptorCount(1);
-    setWrite.setDescriptorType(vk::DescriptorType::eCombinedImageSampler);
-    setWrite.setPImageInfo(&image_infos.back());
-
-    writes.push_back(setWrite);
+    writes.images.emplace_back(slot.binding, desc_image_info);
   }
 
-  std::array<vk::CopyDescriptorSet, 0> copies;
-  device_.updateDescriptorSets(writes, copies);
-
   return true;
 }
 
@@ -380,19 +427,10 @@ bool RenderPassVK::TransitionImageLayout(uint32_t frame_num,
                                          vk::Image image,
                                          vk::ImageLayout layout_old,
                                          vk::ImageLayout layout_new) const {
-  auto pool = command_buffer_.getPool();
-  vk::CommandBufferAllocateInfo alloc_info =
-      vk::CommandBufferAllocateInfo()
-          .setCommandPool(pool)
-          .setLevel(vk::CommandBufferLevel::ePrimary)
-          .setCommandBufferCount(1);
-  auto cmd_buf_res = device_.allocateCommandBuffersUnique(alloc_info);
-  if (cmd_buf_res.result != vk::Result::eSuccess) {
-    VALIDATION_LOG << "Failed to allocate command buffer: "
-                   << vk::to_string(cmd_buf_res.result);
+  auto transition_cmd = command_pool_->CreateCommandBuffer();
+  if (!transition_cmd) {
     return false;
   }
-  auto transition_cmd = std::move(cmd_buf_res.value[0]);
 
   vk::CommandBufferBeginInfo begin_info;
   auto res = transition_cmd->begin(begin_info);
@@ -429,8 +467,8 @@ bool RenderPassVK::TransitionImageLayout(uint32_t frame_num,
     return false;
   }
 
-  surface_producer_->QueueCommandBuffer(frame_num, std::move(transition_cmd));
-  return true;
+  return surface_producer_->QueueCommandBuffer(frame_num, command_pool_,
+                                               std::move(transition_cmd));
 }
 
 }  // namespace impeller
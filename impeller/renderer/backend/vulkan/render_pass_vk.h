@@ -6,6 +6,7 @@
 
 #include <vector>
 #include "flutter/fml/macros.h"
+#include "impeller/renderer/backend/vulkan/command_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/surface_producer_vk.h"
 #include "impeller/renderer/backend/vulkan/texture_vk.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
@@ -17,11 +18,14 @@
 
 namespace impeller {
 
+struct DescriptorWritesVK;
+
 class RenderPassVK final : public RenderPass {
  public:
   RenderPassVK(std::weak_ptr<const Context> context,
                vk::Device device,
                const RenderTarget& target,
+               std::shared_ptr<CommandPoolVK> command_pool,
                vk::UniqueCommandBuffer command_buffer,
                vk::UniqueRenderPass render_pass,
                SurfaceProducerVK* surface_producer);
@@ -33,6 +37,7 @@ class RenderPassVK final : public RenderPass {
   friend class CommandBufferVK;
 
   vk::Device device_;
+  std::shared_ptr<CommandPoolVK> command_pool_;
   vk::UniqueCommandBuffer command_buffer_;
   vk::UniqueRenderPass render_pass_;
   SurfaceProducerVK* surface_producer_;
@@ -61,11 +66,10 @@ class RenderPassVK final : public RenderPass {
 
   bool EndCommandBuffer(uint32_t frame_num);
 
-  bool UpdateDescriptorSets(uint32_t frame_num,
-                            const char* label,
-                            const Bindings& bindings,
-                            Allocator& allocator,
-                            vk::DescriptorSet desc_set) const;
+  bool CollectDescriptorWrites(uint32_t frame_num,
+                               const Bindings& bindings,
+                               Allocator& allocator,
+                               DescriptorWritesVK& writes) const;
 
   void SetViewportAndScissor(const Command& command) const;
 
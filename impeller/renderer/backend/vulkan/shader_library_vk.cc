@@ -53,40 +53,19 @@ static std::string VKShaderNameToShaderKeyName(const std::string& name,
 
 ShaderLibraryVK::ShaderLibraryVK(
     const vk::Device& device,
-    const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data) {
+    const std::vector<std::shared_ptr<fml::Mapping>>& shader_libraries_data)
+    : device_(device) {
   TRACE_EVENT0("impeller", "ShaderLibraryCreate");
-  ShaderFunctionMap functions;
-  bool success = true;
-  auto iterator = [&success, &device, &functions, library_id = library_id_](
-                      auto type,           //
-                      const auto& name,    //
-                      const auto& mapping  //
-                      ) -> bool {
-    vk::ShaderModuleCreateInfo shader_module_info;
-
-    shader_module_info.setPCode(
-        reinterpret_cast<const uint32_t*>(mapping->GetMapping()));
-    shader_module_info.setCodeSize(mapping->GetSize());
-
-    auto module = device.createShaderModuleUnique(shader_module_info);
-
-    if (module.result != vk::Result::eSuccess) {
-      VALIDATION_LOG << "Could not create shader module: "
-                     << vk::to_string(module.result);
-      success = false;
-      return false;
-    }
-
+  // Shader modules are only created when their functions are first requested.
+  // Until then, only the slices of the (possibly file mapped) libraries are
+  // held onto.
+  auto iterator = [this](auto type,           //
+                         const auto& name,    //
+                         const auto& mapping  //
+                         ) -> bool {
     const auto stage = ToShaderStage(type);
     const auto key_name = VKShaderNameToShaderKeyName(name, stage);
-
-    functions[ShaderKey{key_name, stage}] = std::shared_ptr<ShaderFunctionVK>(
-        new ShaderFunctionVK(library_id,              //
-                             key_name,                //
-                             stage,                   //
-                             std::move(module.value)  //
-                             ));
-
+    pending_modules_[ShaderKey{key_name, stage}] = mapping;
     return true;
   };
   for (const auto& library_data : shader_libraries_data) {
@@ -98,10 +77,6 @@ ShaderLibraryVK::ShaderLibraryVK(
     blob_library.IterateAllBlobs(iterator);
   }
 
-  if (!success) {
-    return;
-  }
-  functions_ = std::move(functions);
   is_valid_ = true;
 }
 
@@ -114,14 +89,62 @@ bool ShaderLibraryVK::IsValid() const {
 std::shared_ptr<const ShaderFunction> ShaderLibraryVK::GetFunction(
     std::string_view name,
     ShaderStage stage) {
-  ReaderLock lock(functions_mutex_);
-
   const auto key = ShaderKey{{name.data(), name.size()}, stage};
-  auto found = functions_.find(key);
-  if (found != functions_.end()) {
+
+  {
+    ReaderLock lock(functions_mutex_);
+    auto found = functions_.find(key);
+    if (found != functions_.end()) {
+      return found->second;
+    }
+  }
+
+  WriterLock lock(functions_mutex_);
+
+  // Another thread may have created the module while the lock was released.
+  if (auto found = functions_.find(key); found != functions_.end()) {
     return found->second;
   }
-  return nullptr;
+
+  auto pending = pending_modules_.find(key);
+  if (pending == pending_modules_.end()) {
+    return nullptr;
+  }
+  auto mapping = std::move(pending->second);
+  pending_modules_.erase(pending);
+
+  auto function = CreateFunction(key, *mapping);
+  if (!function) {
+    return nullptr;
+  }
+  functions_[key] = function;
+  return function;
+}
+
+std::shared_ptr<const ShaderFunction> ShaderLibraryVK::CreateFunction(
+    const ShaderKey& key,
+    const fml::Mapping& mapping) const {
+  TRACE_EVENT0("impeller", "CreateShaderModule");
+  vk::ShaderModuleCreateInfo shader_module_info;
+
+  shader_module_info.setPCode(
+      reinterpret_cast<const uint32_t*>(mapping.GetMapping()));
+  shader_module_info.setCodeSize(mapping.GetSize());
+
+  auto module = device_.createShaderModuleUnique(shader_module_info);
+
+  if (module.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not create shader module for " << key.name
+                   << ": " << vk::to_string(module.result);
+    return nullptr;
+  }
+
+  return std::shared_ptr<ShaderFunctionVK>(
+      new ShaderFunctionVK(library_id_,             //
+                           key.name,                //
+                           key.stage,               //
+                           std::move(module.value)  //
+                           ));
 }
 
 // |ShaderLibrary|
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "impeller/base/comparable.h"
 #include "impeller/base/thread.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
@@ -26,6 +29,12 @@ class ShaderLibraryVK final : public ShaderLibrary {
   const UniqueID library_id_;
   mutable RWMutex functions_mutex_;
   ShaderFunctionMap functions_;
+  std::unordered_map<ShaderKey,
+                     std::shared_ptr<fml::Mapping>,
+                     ShaderKey::Hash,
+                     ShaderKey::Equal>
+      pending_modules_;
+  vk::Device device_;
   bool is_valid_ = false;
 
   ShaderLibraryVK(
@@ -36,6 +45,10 @@ class ShaderLibraryVK final : public ShaderLibrary {
   std::shared_ptr<const ShaderFunction> GetFunction(std::string_view name,
                                                     ShaderStage stage) override;
 
+  std::shared_ptr<const ShaderFunction> CreateFunction(
+      const ShaderKey& key,
+      const fml::Mapping& mapping) const;
+
   // |ShaderLibrary|
   void UnregisterFunction(std::string name, ShaderStage stage) override;
 
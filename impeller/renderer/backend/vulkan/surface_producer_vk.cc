@@ -4,10 +4,14 @@
 
 #include "impeller/renderer/backend/vulkan/surface_producer_vk.h"
 
+#include <algorithm>
 #include <array>
 #include <utility>
 
+#include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
+#include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/surface_vk.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 
@@ -16,6 +20,14 @@ namespace impeller {
 std::unique_ptr<SurfaceProducerVK> SurfaceProducerVK::Create(
     const std::weak_ptr<Context>& context,
     const SurfaceProducerCreateInfoVK& create_info) {
+  if (!create_info.swapchain &&
+      (!create_info.external_images.acquire_image ||
+       !create_info.external_images.present_image)) {
+    VALIDATION_LOG
+        << "A swapchain or external images are required to produce surfaces.";
+    return nullptr;
+  }
+
   auto surface_producer =
       std::make_unique<SurfaceProducerVK>(context, create_info);
   if (!surface_producer->SetupSyncObjects()) {
@@ -29,15 +41,53 @@ std::unique_ptr<SurfaceProducerVK> SurfaceProducerVK::Create(
 SurfaceProducerVK::SurfaceProducerVK(
     std::weak_ptr<Context> context,
     const SurfaceProducerCreateInfoVK& create_info)
-    : context_(std::move(context)), create_info_(create_info) {}
+    : context_(std::move(context)),
+      create_info_(create_info),
+      frames_in_flight_(std::clamp(create_info.frames_in_flight, 1u,
+                                   kMaxFramesInFlight)),
+      image_fences_(create_info.swapchain
+                        ? create_info.swapchain->GetSwapchainImageCount()
+                        : 0u) {
+  Lock lock(stats_mutex_);
+  stats_.frames_in_flight = frames_in_flight_;
+}
 
-SurfaceProducerVK::~SurfaceProducerVK() = default;
+SurfaceProducerVK::~SurfaceProducerVK() {
+  // Frames may still be executing. Their resources can only be released once
+  // the device is done with them.
+  [[maybe_unused]] auto result = create_info_.device.waitIdle();
+  for (size_t i = 0; i < frames_in_flight_; i++) {
+    RecycleFrameResources(i);
+  }
+}
+
+uint32_t SurfaceProducerVK::GetFramesInFlight() const {
+  return frames_in_flight_;
+}
+
+FramePacingStatsVK SurfaceProducerVK::GetFramePacingStats() const {
+  Lock lock(stats_mutex_);
+  return stats_;
+}
+
+vk::ImageLayout SurfaceProducerVK::GetFinalImageLayout() const {
+  // Embedders expect their images to be ready to be sampled from or blitted
+  // as if Skia had rendered into them.
+  return create_info_.swapchain ? vk::ImageLayout::ePresentSrcKHR
+                                : vk::ImageLayout::eColorAttachmentOptimal;
+}
 
 std::unique_ptr<Surface> SurfaceProducerVK::AcquireSurface(
-    size_t current_frame) {
-  current_frame = current_frame % kMaxFramesInFlight;
+    size_t current_frame,
+    const ISize& size) {
+  TRACE_EVENT0("impeller", "SurfaceProducerVK::AcquireSurface");
+  current_frame = current_frame % frames_in_flight_;
   const auto& sync_objects = sync_objects_[current_frame];
 
+  // Only block if the GPU is still working on the frame that last used this
+  // slot. Until then, recording this frame overlaps with the GPU executing
+  // the previous ones.
+  const auto frame_fence_wait_start = fml::TimePoint::Now();
   auto fence_wait_res = create_info_.device.waitForFences(
       {*sync_objects->in_flight_fence}, VK_TRUE, UINT64_MAX);
   if (fence_wait_res != vk::Result::eSuccess) {
@@ -45,13 +95,21 @@ std::unique_ptr<Surface> SurfaceProducerVK::AcquireSurface(
                    << vk::to_string(fence_wait_res);
     return nullptr;
   }
+  const auto frame_fence_wait =
+      fml::TimePoint::Now() - frame_fence_wait_start;
 
-  auto fence_reset_res =
-      create_info_.device.resetFences({*sync_objects->in_flight_fence});
-  if (fence_reset_res != vk::Result::eSuccess) {
-    VALIDATION_LOG << "Failed to reset fence: "
-                   << vk::to_string(fence_reset_res);
-    return nullptr;
+  // The previous submission of this frame has completed, so the command
+  // buffers, render passes and descriptor sets it used can be reclaimed.
+  RecycleFrameResources(current_frame);
+  if (auto context = context_.lock()) {
+    ContextVK::Cast(*context).GetDescriptorPool()->ResetFrame(current_frame);
+    if (auto gpu_tracer = context->GetGPUTracer()) {
+      GPUTracerVK::Cast(*gpu_tracer).OnFrameCompleted(current_frame);
+    }
+  }
+
+  if (!create_info_.swapchain) {
+    return AcquireExternalSurface(current_frame, size, frame_fence_wait);
   }
 
   uint32_t image_index;
@@ -66,6 +124,45 @@ std::unique_ptr<Surface> SurfaceProducerVK::AcquireSurface(
     return nullptr;
   }
 
+  // With more images than frames in flight, the acquired image may still be
+  // in use by a frame other than the one that last used this slot.
+  const auto image_fence_wait_start = fml::TimePoint::Now();
+  auto& image_fence = image_fences_[image_index];
+  if (image_fence && image_fence != *sync_objects->in_flight_fence) {
+    auto image_wait_res =
+        create_info_.device.waitForFences({image_fence}, VK_TRUE, UINT64_MAX);
+    if (image_wait_res != vk::Result::eSuccess) {
+      VALIDATION_LOG << "Failed to wait for image fence: "
+                     << vk::to_string(image_wait_res);
+      return nullptr;
+    }
+  }
+  image_fence = *sync_objects->in_flight_fence;
+  const auto image_fence_wait =
+      fml::TimePoint::Now() - image_fence_wait_start;
+
+  // Only reset the fence once this frame is certain to be submitted.
+  auto fence_reset_res =
+      create_info_.device.resetFences({*sync_objects->in_flight_fence});
+  if (fence_reset_res != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to reset fence: "
+                   << vk::to_string(fence_reset_res);
+    return nullptr;
+  }
+
+  {
+    Lock lock(stats_mutex_);
+    stats_.last_frame_fence_wait = frame_fence_wait;
+    stats_.last_image_fence_wait = image_fence_wait;
+    stats_.total_fence_wait =
+        stats_.total_fence_wait + frame_fence_wait + image_fence_wait;
+  }
+  FML_TRACE_COUNTER("impeller", "FramePacingVK",
+                    reinterpret_cast<int64_t>(this),  //
+                    "fence wait (us)",                //
+                    (frame_fence_wait + image_fence_wait).ToMicroseconds()  //
+  );
+
   SurfaceVK::SwapCallback swap_callback = [this, current_frame, image_index]() {
     return Present(current_frame, image_index);
   };
@@ -80,6 +177,72 @@ std::unique_ptr<Surface> SurfaceProducerVK::AcquireSurface(
   }
 }
 
+std::unique_ptr<Surface> SurfaceProducerVK::AcquireExternalSurface(
+    size_t frame_num,
+    const ISize& size,
+    fml::TimeDelta frame_fence_wait) {
+  const auto image = create_info_.external_images.acquire_image(size);
+  if (!image.image) {
+    VALIDATION_LOG << "Could not acquire an external image.";
+    return nullptr;
+  }
+
+  vk::ImageViewCreateInfo view_info;
+  view_info.image = image.image;
+  view_info.viewType = vk::ImageViewType::e2D;
+  view_info.format = image.format;
+  view_info.components.r = vk::ComponentSwizzle::eIdentity;
+  view_info.components.g = vk::ComponentSwizzle::eIdentity;
+  view_info.components.b = vk::ComponentSwizzle::eIdentity;
+  view_info.components.a = vk::ComponentSwizzle::eIdentity;
+  view_info.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
+  view_info.subresourceRange.baseMipLevel = 0;
+  view_info.subresourceRange.levelCount = 1;
+  view_info.subresourceRange.baseArrayLayer = 0;
+  view_info.subresourceRange.layerCount = 1;
+
+  auto view_res = create_info_.device.createImageViewUnique(view_info);
+  if (view_res.result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to create external image view: "
+                   << vk::to_string(view_res.result);
+    return nullptr;
+  }
+
+  // The image view of the previous image of this frame was released when the
+  // frame's resources were recycled.
+  external_images_[frame_num] = std::make_unique<SwapchainImageVK>(
+      image.image, std::move(view_res.value), image.format,
+      vk::Extent2D(size.width, size.height));
+
+  const auto& sync_objects = sync_objects_[frame_num];
+  auto fence_reset_res =
+      create_info_.device.resetFences({*sync_objects->in_flight_fence});
+  if (fence_reset_res != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to reset fence: "
+                   << vk::to_string(fence_reset_res);
+    return nullptr;
+  }
+
+  {
+    Lock lock(stats_mutex_);
+    stats_.last_frame_fence_wait = frame_fence_wait;
+    stats_.last_image_fence_wait = {};
+    stats_.total_fence_wait = stats_.total_fence_wait + frame_fence_wait;
+  }
+
+  SurfaceVK::SwapCallback swap_callback = [this, frame_num, image]() {
+    return PresentExternal(frame_num, image);
+  };
+
+  if (auto context = context_.lock()) {
+    ContextVK* context_vk = reinterpret_cast<ContextVK*>(context.get());
+    return SurfaceVK::WrapSwapchainImage(frame_num,
+                                         external_images_[frame_num].get(),
+                                         context_vk, std::move(swap_callback));
+  }
+  return nullptr;
+}
+
 std::unique_ptr<SurfaceSyncObjectsVK> SurfaceSyncObjectsVK::Create(
     vk::Device device) {
   auto sync_objects = std::make_unique<SurfaceSyncObjectsVK>();
@@ -123,7 +286,7 @@ std::unique_ptr<SurfaceSyncObjectsVK> SurfaceSyncObjectsVK::Create(
 }
 
 bool SurfaceProducerVK::SetupSyncObjects() {
-  for (size_t i = 0; i < kMaxFramesInFlight; i++) {
+  for (size_t i = 0; i < frames_in_flight_; i++) {
     auto sync_objects = SurfaceSyncObjectsVK::Create(create_info_.device);
     if (!sync_objects) {
       return false;
@@ -133,30 +296,55 @@ bool SurfaceProducerVK::SetupSyncObjects() {
   return true;
 }
 
-bool SurfaceProducerVK::QueueCommandBuffer(uint32_t frame_num,
-                                           vk::UniqueCommandBuffer buffer) {
-  command_buffers_[frame_num].push_back(std::move(buffer));
+bool SurfaceProducerVK::QueueCommandBuffer(
+    uint32_t frame_num,
+    std::shared_ptr<CommandPoolVK> pool,
+    vk::UniqueCommandBuffer buffer) {
+  if (!pool || !buffer) {
+    return false;
+  }
+  Lock lock(command_buffers_mutex_);
+  command_buffers_[frame_num].emplace_back(std::move(pool), std::move(buffer));
   return true;
 }
 
+void SurfaceProducerVK::RecycleFrameResources(size_t frame_num) {
+  // Callers must ensure that the frame's fence has been signaled, so none of
+  // these command buffers are pending execution anymore.
+  {
+    Lock lock(command_buffers_mutex_);
+    for (auto& [pool, buffer] : command_buffers_[frame_num]) {
+      pool->CollectCommandBuffer(std::move(buffer));
+    }
+    command_buffers_[frame_num].clear();
+  }
+  stash_rp_[frame_num].clear();
+  external_images_[frame_num].reset();
+}
+
 bool SurfaceProducerVK::Submit(uint32_t frame_num) {
   auto& sync_objects = sync_objects_[frame_num];
   vk::SubmitInfo submit_info;
   std::array<vk::PipelineStageFlags, 1> wait_stages = {
       vk::PipelineStageFlagBits::eColorAttachmentOutput};
-  submit_info.setWaitDstStageMask(wait_stages);
-
   std::array<vk::Semaphore, 1> wait_semaphores = {
       *sync_objects->image_available_semaphore};
-  submit_info.setWaitSemaphores(wait_semaphores);
-
   std::array<vk::Semaphore, 1> signal_semaphores = {
       *sync_objects->render_finished_semaphore};
-  submit_info.setSignalSemaphores(signal_semaphores);
+  // External images are neither acquired from nor presented to a swapchain,
+  // so there are no semaphores to wait on or signal.
+  if (create_info_.swapchain) {
+    submit_info.setWaitDstStageMask(wait_stages);
+    submit_info.setWaitSemaphores(wait_semaphores);
+    submit_info.setSignalSemaphores(signal_semaphores);
+  }
 
   std::vector<vk::CommandBuffer> command_buffers = {};
-  for (auto& buf : command_buffers_[frame_num]) {
-    command_buffers.push_back(*buf);
+  {
+    Lock lock(command_buffers_mutex_);
+    for (const auto& [pool, buffer] : command_buffers_[frame_num]) {
+      command_buffers.push_back(*buffer);
+    }
   }
   submit_info.setCommandBuffers(command_buffers);
 
@@ -168,18 +356,15 @@ bool SurfaceProducerVK::Submit(uint32_t frame_num) {
     return false;
   }
 
-  auto idle_wait_res = create_info_.graphics_queue.waitIdle();
-  if (idle_wait_res != vk::Result::eSuccess) {
-    VALIDATION_LOG << "Failed to wait for graphics queue idle: "
-                   << vk::to_string(idle_wait_res);
-    return false;
-  }
-
   return true;
 }
 
 bool SurfaceProducerVK::Present(size_t frame_num, uint32_t image_index) {
-  Submit(frame_num);
+  // The frame's resources stay alive until its fence is waited on the next
+  // time this frame slot is acquired.
+  if (!Submit(frame_num)) {
+    return false;
+  }
 
   auto& sync_objects = sync_objects_[frame_num];
 
@@ -199,13 +384,39 @@ bool SurfaceProducerVK::Present(size_t frame_num, uint32_t image_index) {
   auto present_res = create_info_.present_queue.presentKHR(present_info);
   if ((present_res != vk::Result::eSuccess) &&
       (present_res != vk::Result::eSuboptimalKHR)) {
-    command_buffers_[frame_num].clear();
-    stash_rp_[frame_num].clear();
+    VALIDATION_LOG << "Failed to present: " << vk::to_string(present_res);
     return false;
   }
 
-  command_buffers_[frame_num].clear();
-  stash_rp_[frame_num].clear();
+  Lock lock(stats_mutex_);
+  stats_.presented_frame_count++;
+  return true;
+}
+
+bool SurfaceProducerVK::PresentExternal(size_t frame_num,
+                                        const ExternalImageVK& image) {
+  if (!Submit(frame_num)) {
+    return false;
+  }
+
+  // Embedders use the image as soon as it has been presented, so wait for the
+  // GPU to finish rendering into it. The fence stays signaled until the next
+  // acquire of this frame.
+  auto fence_wait_res = create_info_.device.waitForFences(
+      {*sync_objects_[frame_num]->in_flight_fence}, VK_TRUE, UINT64_MAX);
+  if (fence_wait_res != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to wait for fence: "
+                   << vk::to_string(fence_wait_res);
+    return false;
+  }
+
+  if (!create_info_.external_images.present_image(image)) {
+    VALIDATION_LOG << "Could not present the external image.";
+    return false;
+  }
+
+  Lock lock(stats_mutex_);
+  stats_.presented_frame_count++;
   return true;
 }
 
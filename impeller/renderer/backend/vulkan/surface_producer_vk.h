@@ -4,9 +4,15 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "impeller/base/thread.h"
+#include "impeller/renderer/backend/vulkan/command_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/swapchain_vk.h"
 #include "impeller/renderer/backend/vulkan/vk.h"
 #include "impeller/renderer/surface.h"
@@ -14,11 +20,47 @@
 
 namespace impeller {
 
+struct ExternalImageVK {
+  vk::Image image;
+  vk::Format format = vk::Format::eUndefined;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Callbacks used to render into images that are owned by an
+///             embedder instead of the images of a swapchain.
+///
+struct ExternalImageCallbacksVK {
+  /// Returns the image to render the next frame of the given size into.
+  std::function<ExternalImageVK(const ISize& size)> acquire_image;
+  /// Hands an image back to the embedder. The GPU has finished rendering into
+  /// the image when this is called.
+  std::function<bool(const ExternalImageVK& image)> present_image;
+};
+
 struct SurfaceProducerCreateInfoVK {
   vk::Device device;
   vk::Queue graphics_queue;
   vk::Queue present_queue;
   SwapchainVK* swapchain;
+  uint32_t frames_in_flight = 2u;
+  /// Used instead of the swapchain if there is none.
+  ExternalImageCallbacksVK external_images;
+};
+
+struct FramePacingStatsVK {
+  /// The number of frames the CPU may record ahead of the GPU.
+  uint32_t frames_in_flight = 0u;
+  /// Number of frames submitted for presentation so far.
+  uint64_t presented_frame_count = 0u;
+  /// Time the last acquire spent waiting on the GPU to finish the previous
+  /// frame that used the same slot. Non-zero values mean the CPU is running
+  /// more than `frames_in_flight` frames ahead of the GPU.
+  fml::TimeDelta last_frame_fence_wait;
+  /// Time the last acquire spent waiting for a swapchain image that was
+  /// still in use by an earlier frame.
+  fml::TimeDelta last_image_fence_wait;
+  /// Cumulative time spent blocked in the above waits.
+  fml::TimeDelta total_fence_wait;
 };
 
 class SurfaceSyncObjectsVK {
@@ -41,15 +83,32 @@ class SurfaceProducerVK {
 
   ~SurfaceProducerVK();
 
-  std::unique_ptr<Surface> AcquireSurface(size_t current_frame);
+  //----------------------------------------------------------------------------
+  /// @brief      Acquires the surface of the next frame. The size is only used
+  ///             to acquire external images, swapchain images have the size
+  ///             of the swapchain.
+  ///
+  std::unique_ptr<Surface> AcquireSurface(size_t current_frame,
+                                          const ISize& size);
 
-  // take ownership of the command buffer until present.
-  bool QueueCommandBuffer(uint32_t frame_num, vk::UniqueCommandBuffer buffer);
+  uint32_t GetFramesInFlight() const;
+
+  FramePacingStatsVK GetFramePacingStats() const;
+
+  // take ownership of the command buffer until present, after which it is
+  // handed back to the pool it was allocated from.
+  bool QueueCommandBuffer(uint32_t frame_num,
+                          std::shared_ptr<CommandPoolVK> pool,
+                          vk::UniqueCommandBuffer buffer);
 
   void StashRP(uint32_t frame_num, vk::UniqueRenderPass data) {
     stash_rp_[frame_num].push_back(std::move(data));
   }
 
+  /// The layout the images of the produced surfaces are left in once they
+  /// have been rendered into.
+  vk::ImageLayout GetFinalImageLayout() const;
+
  private:
   std::weak_ptr<Context> context_;
 
@@ -59,12 +118,32 @@ class SurfaceProducerVK {
 
   bool Present(size_t frame_num, uint32_t image_index);
 
+  std::unique_ptr<Surface> AcquireExternalSurface(
+      size_t frame_num,
+      const ISize& size,
+      fml::TimeDelta frame_fence_wait);
+
+  bool PresentExternal(size_t frame_num, const ExternalImageVK& image);
+
+  void RecycleFrameResources(size_t frame_num);
+
   const SurfaceProducerCreateInfoVK create_info_;
+  const uint32_t frames_in_flight_;
 
   // sync objects
   std::unique_ptr<SurfaceSyncObjectsVK> sync_objects_[kMaxFramesInFlight];
-  std::vector<vk::UniqueCommandBuffer> command_buffers_[kMaxFramesInFlight];
+  using PooledCommandBuffer =
+      std::pair<std::shared_ptr<CommandPoolVK>, vk::UniqueCommandBuffer>;
+  Mutex command_buffers_mutex_;
+  std::vector<PooledCommandBuffer> command_buffers_[kMaxFramesInFlight]
+      IPLR_GUARDED_BY(command_buffers_mutex_);
   std::vector<vk::UniqueRenderPass> stash_rp_[kMaxFramesInFlight];
+  // The external image each frame renders into, if there is no swapchain.
+  std::unique_ptr<SwapchainImageVK> external_images_[kMaxFramesInFlight];
+  // The fence of the frame that last rendered to each swapchain image.
+  std::vector<vk::Fence> image_fences_;
+  mutable Mutex stats_mutex_;
+  FramePacingStatsVK stats_ IPLR_GUARDED_BY(stats_mutex_);
 
   FML_DISALLOW_COPY_AND_ASSIGN(SurfaceProducerVK);
 };
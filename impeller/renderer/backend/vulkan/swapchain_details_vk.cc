@@ -67,14 +67,19 @@ vk::SurfaceFormatKHR SwapchainDetailsVK::PickSurfaceFormat() const {
   return surface_formats_[0];
 }
 
-vk::PresentModeKHR SwapchainDetailsVK::PickPresentationMode() const {
+vk::PresentModeKHR SwapchainDetailsVK::PickPresentationMode(
+    bool prefer_mailbox) const {
+  if (!prefer_mailbox) {
+    return vk::PresentModeKHR::eFifo;
+  }
+
   for (const auto& mode : present_modes_) {
     if (mode == vk::PresentModeKHR::eMailbox) {
       return mode;
     }
   }
 
-  VALIDATION_LOG << "Picking a sub-optimal presentation mode.";
+  VALIDATION_LOG << "Mailbox presentation mode unavailable, using FIFO.";
   // Vulkan spec dictates that FIFO is always available.
   return vk::PresentModeKHR::eFifo;
 }
@@ -24,7 +24,7 @@ class SwapchainDetailsVK {
 
   vk::SurfaceFormatKHR PickSurfaceFormat() const;
 
-  vk::PresentModeKHR PickPresentationMode() const;
+  vk::PresentModeKHR PickPresentationMode(bool prefer_mailbox) const;
 
   vk::CompositeAlphaFlagBitsKHR PickCompositeAlpha() const;
 
@@ -10,11 +10,14 @@
 
 namespace impeller {
 
-std::unique_ptr<SwapchainVK> SwapchainVK::Create(vk::Device device,
-                                                 vk::SurfaceKHR surface,
-                                                 SwapchainDetailsVK& details) {
+std::unique_ptr<SwapchainVK> SwapchainVK::Create(
+    vk::Device device,
+    vk::SurfaceKHR surface,
+    SwapchainDetailsVK& details,
+    const SwapchainConfigVK& config) {
   vk::SurfaceFormatKHR surface_format = details.PickSurfaceFormat();
-  vk::PresentModeKHR present_mode = details.PickPresentationMode();
+  vk::PresentModeKHR present_mode =
+      details.PickPresentationMode(config.prefer_mailbox);
   vk::Extent2D extent = details.PickExtent();
 
   vk::SwapchainCreateInfoKHR create_info;
@@ -49,7 +52,8 @@ std::unique_ptr<SwapchainVK> SwapchainVK::Create(vk::Device device,
   }
 
   auto swapchain = std::make_unique<SwapchainVK>(
-      device, std::move(swapchain_res.value), surface_format.format, extent);
+      device, std::move(swapchain_res.value), surface_format.format, extent,
+      present_mode);
   if (!swapchain->CreateSwapchainImages()) {
     VALIDATION_LOG << "Failed to create swapchain images.";
     return nullptr;
@@ -104,11 +108,13 @@ bool SwapchainVK::CreateSwapchainImages() {
 SwapchainVK::SwapchainVK(vk::Device device,
                          vk::UniqueSwapchainKHR swapchain,
                          vk::Format image_format,
-                         vk::Extent2D extent)
+                         vk::Extent2D extent,
+                         vk::PresentModeKHR present_mode)
     : device_(device),
       swapchain_(std::move(swapchain)),
       image_format_(image_format),
-      extent_(extent) {}
+      extent_(extent),
+      present_mode_(present_mode) {}
 
 SwapchainVK::~SwapchainVK() = default;
 
@@ -130,6 +136,14 @@ SwapchainImageVK* SwapchainVK::GetSwapchainImage(uint32_t image_index) const {
   return swapchain_images_[image_index].get();
 }
 
+size_t SwapchainVK::GetSwapchainImageCount() const {
+  return swapchain_images_.size();
+}
+
+vk::PresentModeKHR SwapchainVK::GetPresentMode() const {
+  return present_mode_;
+}
+
 PixelFormat SwapchainImageVK::GetPixelFormat() const {
   return ToPixelFormat(image_format_);
 }
@@ -39,16 +39,28 @@ class SwapchainImageVK {
   FML_DISALLOW_COPY_AND_ASSIGN(SwapchainImageVK);
 };
 
+struct SwapchainConfigVK {
+  /// The number of frames the CPU may record while the GPU is still working
+  /// on earlier ones. Clamped to [1, kMaxFramesInFlight].
+  uint32_t frames_in_flight = 2u;
+  /// Mailbox presentation replaces queued images with newer ones and never
+  /// blocks on present. FIFO is locked to the display refresh rate. FIFO is
+  /// used when mailbox is not supported.
+  bool prefer_mailbox = true;
+};
+
 class SwapchainVK {
  public:
   static std::unique_ptr<SwapchainVK> Create(vk::Device device,
                                              vk::SurfaceKHR surface,
-                                             SwapchainDetailsVK& details);
+                                             SwapchainDetailsVK& details,
+                                             const SwapchainConfigVK& config);
 
   SwapchainVK(vk::Device device,
               vk::UniqueSwapchainKHR swapchain,
               vk::Format image_format,
-              vk::Extent2D extent);
+              vk::Extent2D extent,
+              vk::PresentModeKHR present_mode);
 
   ~SwapchainVK();
 
@@ -56,6 +68,10 @@ class SwapchainVK {
 
   SwapchainImageVK* GetSwapchainImage(uint32_t image_index) const;
 
+  size_t GetSwapchainImageCount() const;
+
+  vk::PresentModeKHR GetPresentMode() const;
+
  private:
   bool CreateSwapchainImages();
 
@@ -63,6 +79,7 @@ class SwapchainVK {
   vk::UniqueSwapchainKHR swapchain_;
   vk::Format image_format_;
   vk::Extent2D extent_;
+  vk::PresentModeKHR present_mode_;
   std::vector<std::unique_ptr<SwapchainImageVK>> swapchain_images_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(SwapchainVK);
@@ -14,9 +14,22 @@ TextureVK::TextureVK(TextureDescriptor desc,
       texture_info_(std::move(texture_info)) {}
 
 TextureVK::~TextureVK() {
-  if (!IsWrapped() && IsValid()) {
-    const auto& texture = texture_info_->allocated_texture;
-    vmaDestroyImage(*texture.allocator, texture.image, texture.allocation);
+  if (!IsValid()) {
+    return;
+  }
+  switch (texture_info_->backing_type) {
+    case TextureBackingTypeVK::kAllocatedTexture: {
+      const auto& texture = texture_info_->allocated_texture;
+      vmaDestroyImage(*texture.allocator, texture.image, texture.allocation);
+      break;
+    }
+    case TextureBackingTypeVK::kImportedTexture:
+      context_->GetDevice().destroyImageView(
+          vk::ImageView{texture_info_->imported_texture.image_view});
+      break;
+    case TextureBackingTypeVK::kUnknownType:
+    case TextureBackingTypeVK::kWrappedTexture:
+      break;
   }
 }
 
@@ -32,6 +45,11 @@ bool TextureVK::OnSetContents(const uint8_t* contents,
     return false;
   }
 
+  if (texture_info_->backing_type == TextureBackingTypeVK::kImportedTexture) {
+    FML_LOG(ERROR) << "Cannot set contents of an imported texture";
+    return false;
+  }
+
   if (!IsValid() || !contents) {
     return false;
   }
@@ -70,6 +88,8 @@ bool TextureVK::IsValid() const {
       return texture_info_->allocated_texture.image;
     case TextureBackingTypeVK::kWrappedTexture:
       return texture_info_->wrapped_texture.swapchain_image;
+    case TextureBackingTypeVK::kImportedTexture:
+      return texture_info_->imported_texture.image_view;
   }
 }
 
@@ -93,6 +113,8 @@ vk::ImageView TextureVK::GetImageView() const {
       return vk::ImageView{texture_info_->allocated_texture.image_view};
     case TextureBackingTypeVK::kWrappedTexture:
       return texture_info_->wrapped_texture.swapchain_image->GetImageView();
+    case TextureBackingTypeVK::kImportedTexture:
+      return vk::ImageView{texture_info_->imported_texture.image_view};
   }
 }
 
@@ -104,6 +126,8 @@ vk::Image TextureVK::GetImage() const {
       return vk::Image{texture_info_->allocated_texture.image};
     case TextureBackingTypeVK::kWrappedTexture:
       return texture_info_->wrapped_texture.swapchain_image->GetImage();
+    case TextureBackingTypeVK::kImportedTexture:
+      return vk::Image{texture_info_->imported_texture.image};
   }
 }
 
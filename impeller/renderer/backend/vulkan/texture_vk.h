@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "flutter/fml/macros.h"
 #include "impeller/base/backend_cast.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
@@ -17,6 +19,7 @@ enum class TextureBackingTypeVK {
   kUnknownType,
   kAllocatedTexture,
   kWrappedTexture,
+  kImportedTexture,
 };
 
 struct WrappedTextureInfoVK {
@@ -32,12 +35,24 @@ struct AllocatedTextureInfoVK {
   VkImageView image_view = VK_NULL_HANDLE;
 };
 
+/// A view of an image whose memory was imported from another API, such as an
+/// AHardwareBuffer. The texture destroys the view, the image and its memory
+/// are collected with the `imported_image` of the texture info.
+struct ImportedTextureInfoVK {
+  VkImage image = VK_NULL_HANDLE;
+  VkImageView image_view = VK_NULL_HANDLE;
+};
+
 struct TextureInfoVK {
   TextureBackingTypeVK backing_type;
   union {
     WrappedTextureInfoVK wrapped_texture;
     AllocatedTextureInfoVK allocated_texture;
+    ImportedTextureInfoVK imported_texture;
   };
+  /// Owns the image and memory of an imported texture. It is shared by the
+  /// textures of the planes of a multi-planar image.
+  std::shared_ptr<const void> imported_image;
 };
 
 class TextureVK final : public Texture, public BackendCast<TextureVK, Texture> {
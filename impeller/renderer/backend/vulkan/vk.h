@@ -28,7 +28,9 @@ static_assert(VK_HEADER_VERSION >= 215,
 
 namespace impeller {
 
-const uint32_t kMaxFramesInFlight = 2;
+// The upper bound on the number of frames the CPU may record ahead of the
+// GPU. The actual number is configured per swapchain.
+const uint32_t kMaxFramesInFlight = 3;
 
 struct QueueVK {
   size_t family = 0;
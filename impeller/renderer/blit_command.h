@@ -28,6 +28,12 @@ struct BlitCopyTextureToBufferCommand : public BlitCommand {
   size_t destination_offset;
 };
 
+struct BlitCopyBufferToTextureCommand : public BlitCommand {
+  std::shared_ptr<DeviceBuffer> source;
+  size_t source_offset;
+  std::shared_ptr<Texture> destination;
+};
+
 struct BlitGenerateMipmapCommand : public BlitCommand {
   std::shared_ptr<Texture> texture;
 };
@@ -90,6 +90,12 @@ bool BlitPass::AddCopy(std::shared_ptr<Texture> source,
     return false;
   }
 
+  if (IsBlockCompressedPixelFormat(source->GetTextureDescriptor().format)) {
+    VALIDATION_LOG
+        << "Attempted to add a texture blit from a block compressed texture.";
+    return false;
+  }
+
   if (!source_region.has_value()) {
     source_region = IRect::MakeSize(source->GetSize());
   }
@@ -116,6 +122,37 @@ bool BlitPass::AddCopy(std::shared_ptr<Texture> source,
                                       std::move(label));
 }
 
+bool BlitPass::AddCopy(std::shared_ptr<DeviceBuffer> source,
+                       std::shared_ptr<Texture> destination,
+                       size_t source_offset,
+                       std::string label) {
+  if (!source) {
+    VALIDATION_LOG << "Attempted to add a texture upload with no source.";
+    return false;
+  }
+  if (!destination) {
+    VALIDATION_LOG << "Attempted to add a texture upload with no destination.";
+    return false;
+  }
+
+  const auto& descriptor = destination->GetTextureDescriptor();
+  if (IsBlockCompressedPixelFormat(descriptor.format)) {
+    VALIDATION_LOG
+        << "Attempted to add a texture upload to a block compressed texture.";
+    return false;
+  }
+
+  if (source_offset + descriptor.GetByteSizeOfBaseMipLevel() >
+      source->GetDeviceBufferDescriptor().size) {
+    VALIDATION_LOG
+        << "Attempted to add a texture upload with out of bounds access.";
+    return false;
+  }
+
+  return OnCopyBufferToTextureCommand(std::move(source), std::move(destination),
+                                      source_offset, std::move(label));
+}
+
 bool BlitPass::GenerateMipmap(std::shared_ptr<Texture> texture,
                               std::string label) {
   if (!texture) {
@@ -124,6 +161,12 @@ bool BlitPass::GenerateMipmap(std::shared_ptr<Texture> texture,
     return false;
   }
 
+  if (IsBlockCompressedPixelFormat(texture->GetTextureDescriptor().format)) {
+    VALIDATION_LOG << "Mipmaps cannot be generated for block compressed "
+                      "textures.";
+    return false;
+  }
+
   return OnGenerateMipmapCommand(std::move(texture), std::move(label));
 }
 
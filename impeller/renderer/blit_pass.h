@@ -84,6 +84,26 @@ class BlitPass {
                size_t destination_offset = 0,
                std::string label = "");
 
+  //----------------------------------------------------------------------------
+  /// @brief      Record a command to replace the base mip level of the
+  ///             texture with the contents of the buffer.
+  ///             No work is encoded into the command buffer at this time.
+  ///
+  /// @param[in]  source         The buffer to read the tightly packed rows of
+  ///                            the image from.
+  /// @param[in]  destination    The texture to overwrite using the buffer
+  ///                            contents.
+  /// @param[in]  source_offset  The offset of the image in the buffer.
+  /// @param[in]  label          The optional debug label to give the
+  ///                            command.
+  ///
+  /// @return     If the command was valid for subsequent commitment.
+  ///
+  bool AddCopy(std::shared_ptr<DeviceBuffer> source,
+               std::shared_ptr<Texture> destination,
+               size_t source_offset = 0,
+               std::string label = "");
+
   //----------------------------------------------------------------------------
   /// @brief      Record a command to generate all mip levels for a texture.
   ///             No work is encoded into the command buffer at this time.
@@ -127,6 +147,12 @@ class BlitPass {
       size_t destination_offset,
       std::string label) = 0;
 
+  virtual bool OnCopyBufferToTextureCommand(
+      std::shared_ptr<DeviceBuffer> source,
+      std::shared_ptr<Texture> destination,
+      size_t source_offset,
+      std::string label) = 0;
+
   virtual bool OnGenerateMipmapCommand(std::shared_ptr<Texture> texture,
                                        std::string label) = 0;
 
@@ -65,6 +65,22 @@ class CommandBuffer {
 
   [[nodiscard]] bool SubmitCommands();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Encode the commands recorded into the render pass and
+  ///             schedule this command buffer on the GPU. Backends that
+  ///             support it reserve a spot for the command buffer in the queue
+  ///             and then encode and commit on a worker thread. GPU work is
+  ///             still executed in submission order.
+  ///
+  ///             The render pass must have been created from this command
+  ///             buffer and may not be used after this call. Backends without
+  ///             support for async submission encode and submit synchronously.
+  ///
+  /// @param[in]  render_pass  The render pass to encode.
+  ///
+  [[nodiscard]] bool SubmitCommandsAsync(
+      std::shared_ptr<RenderPass> render_pass);
+
   //----------------------------------------------------------------------------
   /// @brief      Create a render pass to record render commands into.
   ///
@@ -102,6 +118,9 @@ class CommandBuffer {
 
   [[nodiscard]] virtual bool OnSubmitCommands(CompletionCallback callback) = 0;
 
+  [[nodiscard]] virtual bool OnSubmitCommandsAsync(
+      std::shared_ptr<RenderPass> render_pass);
+
   virtual std::shared_ptr<ComputePass> OnCreateComputePass() const = 0;
 
  private:
@@ -8,11 +8,13 @@
 #include "impeller/base/strings.h"
 #include "impeller/base/validation.h"
 #include "impeller/renderer/host_buffer.h"
+#include "impeller/renderer/host_buffer_ring.h"
 
 namespace impeller {
 
 ComputePass::ComputePass(std::weak_ptr<const Context> context)
-    : context_(std::move(context)), transients_buffer_(HostBuffer::Create()) {}
+    : context_(std::move(context)),
+      transients_buffer_(HostBufferRing::AcquireFrom(context_)) {}
 
 ComputePass::~ComputePass() = default;
 
@@ -4,11 +4,14 @@
 
 #include "impeller/renderer/context.h"
 
+#include "impeller/renderer/host_buffer_ring.h"
+#include "impeller/renderer/texture_uploader.h"
+
 namespace impeller {
 
 Context::~Context() = default;
 
-Context::Context() = default;
+Context::Context() : host_buffer_ring_(std::make_shared<HostBufferRing>()) {}
 
 bool Context::HasThreadingRestrictions() const {
   return false;
@@ -18,8 +21,37 @@ std::shared_ptr<GPUTracer> Context::GetGPUTracer() const {
   return nullptr;
 }
 
+bool Context::SupportsCompute() const {
+  return false;
+}
+
+bool Context::SupportsInstancedRendering() const {
+  return false;
+}
+
+bool Context::SupportsFramebufferFetch() const {
+  return false;
+}
+
+bool Context::SupportsPixelFormat(PixelFormat format) const {
+  return !IsBlockCompressedPixelFormat(format);
+}
+
 PixelFormat Context::GetColorAttachmentPixelFormat() const {
   return PixelFormat::kDefaultColor;
 }
 
+const std::shared_ptr<HostBufferRing>& Context::GetHostBufferRing() const {
+  return host_buffer_ring_;
+}
+
+const std::shared_ptr<TextureUploader>& Context::GetTextureUploader() const {
+  // The uploader refers back to the context, which isn't possible until the
+  // context is owned by a shared pointer.
+  std::call_once(texture_uploader_once_, [this]() {
+    texture_uploader_ = std::make_shared<TextureUploader>(weak_from_this());
+  });
+  return texture_uploader_;
+}
+
 }  // namespace impeller
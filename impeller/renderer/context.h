@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "flutter/fml/macros.h"
@@ -18,6 +19,8 @@ class CommandBuffer;
 class PipelineLibrary;
 class Allocator;
 class GPUTracer;
+class HostBufferRing;
+class TextureUploader;
 class WorkQueue;
 
 class Context : public std::enable_shared_from_this<Context> {
@@ -52,10 +55,52 @@ class Context : public std::enable_shared_from_this<Context> {
 
   virtual bool SupportsOffscreenMSAA() const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @return     Whether compute pipelines and passes can be created from
+  ///             this context.
+  ///
+  virtual bool SupportsCompute() const;
+
+  //----------------------------------------------------------------------------
+  /// @return     Whether commands may draw more than one instance and read
+  ///             per-instance data from storage buffers in the vertex stage.
+  ///
+  virtual bool SupportsInstancedRendering() const;
+
+  //----------------------------------------------------------------------------
+  /// @return     Whether fragment shaders may read the current value of the
+  ///             color attachment they are writing to. Shaders read it through
+  ///             a `subpassInput` with an input attachment index of zero.
+  ///
+  virtual bool SupportsFramebufferFetch() const;
+
+  //----------------------------------------------------------------------------
+  /// @return     Whether textures of the given format can be created and
+  ///             sampled from on this context. All formats that aren't block
+  ///             compressed are supported everywhere.
+  ///
+  virtual bool SupportsPixelFormat(PixelFormat format) const;
+
+  //----------------------------------------------------------------------------
+  /// @return     The ring from which render and compute passes acquire their
+  ///             transients buffers. Renderers must advance it once per frame.
+  ///
+  const std::shared_ptr<HostBufferRing>& GetHostBufferRing() const;
+
+  //----------------------------------------------------------------------------
+  /// @return     The uploader used to fill device private textures via
+  ///             staging buffers. It is created on first use.
+  ///
+  const std::shared_ptr<TextureUploader>& GetTextureUploader() const;
+
  protected:
   Context();
 
  private:
+  std::shared_ptr<HostBufferRing> host_buffer_ring_;
+  mutable std::once_flag texture_uploader_once_;
+  mutable std::shared_ptr<TextureUploader> texture_uploader_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(Context);
 };
 
@@ -78,6 +78,11 @@ enum class StorageMode {
 ///             esoteric formats and use blit passes to convert to a
 ///             non-esoteric pass.
 ///
+///             Block compressed formats are stored as 4x4 pixel blocks. They
+///             can only be sampled from and their contents may only be set
+///             all at once. Use `Context::SupportsPixelFormat` to check that
+///             the device can sample them before creating textures.
+///
 enum class PixelFormat {
   kUnknown,
   kA8UNormInt,
@@ -88,6 +93,13 @@ enum class PixelFormat {
   kB8G8R8A8UNormInt,
   kB8G8R8A8UNormIntSRGB,
   kS8UInt,
+  // Block compressed formats.
+  kASTC4x4UNormInt,
+  kETC2R8G8B8UNormInt,
+  kETC2R8G8B8A8UNormInt,
+  kBC1R8G8B8A8UNormInt,
+  kBC3R8G8B8A8UNormInt,
+  kBC7R8G8B8A8UNormInt,
 
   // Defaults. If you don't know which ones to use, these are usually a safe
   // bet.
@@ -285,10 +297,56 @@ constexpr size_t BytesPerPixelForPixelFormat(PixelFormat format) {
     case PixelFormat::kB8G8R8A8UNormInt:
     case PixelFormat::kB8G8R8A8UNormIntSRGB:
       return 4u;
+    case PixelFormat::kASTC4x4UNormInt:
+    case PixelFormat::kETC2R8G8B8UNormInt:
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+    case PixelFormat::kBC1R8G8B8A8UNormInt:
+    case PixelFormat::kBC3R8G8B8A8UNormInt:
+    case PixelFormat::kBC7R8G8B8A8UNormInt:
+      // Pixels of block compressed formats aren't individually addressable.
+      // See |BytesPerBlockForPixelFormat|.
+      return 0u;
+  }
+  return 0u;
+}
+
+/// The width and height in pixels of the blocks of block compressed formats.
+static constexpr int64_t kPixelFormatBlockSize = 4;
+
+/// The number of blocks needed to cover the given number of pixels along one
+/// dimension of a block compressed texture.
+constexpr size_t BlockCountForPixels(int64_t pixels) {
+  return (pixels + kPixelFormatBlockSize - 1) / kPixelFormatBlockSize;
+}
+
+constexpr size_t BytesPerBlockForPixelFormat(PixelFormat format) {
+  switch (format) {
+    case PixelFormat::kETC2R8G8B8UNormInt:
+    case PixelFormat::kBC1R8G8B8A8UNormInt:
+      return 8u;
+    case PixelFormat::kASTC4x4UNormInt:
+    case PixelFormat::kETC2R8G8B8A8UNormInt:
+    case PixelFormat::kBC3R8G8B8A8UNormInt:
+    case PixelFormat::kBC7R8G8B8A8UNormInt:
+      return 16u;
+    case PixelFormat::kUnknown:
+    case PixelFormat::kA8UNormInt:
+    case PixelFormat::kR8UNormInt:
+    case PixelFormat::kR8G8UNormInt:
+    case PixelFormat::kR8G8B8A8UNormInt:
+    case PixelFormat::kR8G8B8A8UNormIntSRGB:
+    case PixelFormat::kB8G8R8A8UNormInt:
+    case PixelFormat::kB8G8R8A8UNormIntSRGB:
+    case PixelFormat::kS8UInt:
+      return 0u;
   }
   return 0u;
 }
 
+constexpr bool IsBlockCompressedPixelFormat(PixelFormat format) {
+  return BytesPerBlockForPixelFormat(format) > 0u;
+}
+
 //------------------------------------------------------------------------------
 /// @brief      Describe the color attachment that will be used with this
 ///             pipeline.
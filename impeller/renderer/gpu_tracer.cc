@@ -4,6 +4,8 @@
 
 #include "gpu_tracer.h"
 
+#include "flutter/fml/trace_event.h"
+
 namespace impeller {
 
 GPUTracer::GPUTracer() = default;
@@ -18,4 +20,29 @@ bool GPUTracer::StopCapturingFrame() {
   return false;
 }
 
+bool GPUTracer::SupportsTimestampQueries() const {
+  return false;
+}
+
+fml::TimeDelta GPUTracer::TakeCompletedGPUTime() {
+  Lock lock(completed_gpu_time_mutex_);
+  auto gpu_time = completed_gpu_time_;
+  completed_gpu_time_ = fml::TimeDelta::Zero();
+  return gpu_time;
+}
+
+void GPUTracer::RecordCompletedRegion(const std::string& label,
+                                      fml::TimePoint cpu_start,
+                                      fml::TimeDelta gpu_duration) {
+  fml::tracing::TraceEventAsyncComplete(
+      "impeller",                                       //
+      label.c_str(),                                    //
+      cpu_start,                                        //
+      cpu_start + gpu_duration,                         //
+      "GPUMicroseconds", gpu_duration.ToMicroseconds()  //
+  );
+  Lock lock(completed_gpu_time_mutex_);
+  completed_gpu_time_ = completed_gpu_time_ + gpu_duration;
+}
+
 }  // namespace impeller
@@ -2,7 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#pragma once
+
+#include <string>
+
 #include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+#include "impeller/base/thread.h"
 
 namespace impeller {
 
@@ -21,6 +28,12 @@ struct GPUTracerConfiguration {
 //------------------------------------------------------------------------------
 /// @brief      A GPU tracer to trace gpu workflow during rendering.
 ///
+///             Backends that support timestamp queries also measure the GPU
+///             time taken by labelled regions of work, usually one per render
+///             pass. Results become available some time after the work was
+///             submitted. Each one is emitted as a trace event and accumulated
+///             until collected by `TakeCompletedGPUTime`.
+///
 class GPUTracer {
  public:
   virtual ~GPUTracer();
@@ -43,10 +56,42 @@ class GPUTracer {
   ///
   virtual bool StopCapturingFrame();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the GPU time taken by labelled regions is measured.
+  ///
+  virtual bool SupportsTimestampQueries() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the GPU time taken by the regions whose results became
+  ///             available since the last call, and reset it.
+  ///
+  ///             Since results lag behind submission, this usually covers the
+  ///             work of an earlier frame.
+  ///
+  fml::TimeDelta TakeCompletedGPUTime();
+
  protected:
   GPUTracer();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Called by backends once the GPU time taken by a region is
+  ///             known.
+  ///
+  /// @param[in]  label         The label of the region.
+  /// @param[in]  cpu_start     The CPU time at which the region was encoded.
+  ///                           GPU and CPU clocks are not correlated, so the
+  ///                           trace event is placed here.
+  /// @param[in]  gpu_duration  The GPU time taken by the region.
+  ///
+  void RecordCompletedRegion(const std::string& label,
+                             fml::TimePoint cpu_start,
+                             fml::TimeDelta gpu_duration);
+
  private:
+  Mutex completed_gpu_time_mutex_;
+  fml::TimeDelta completed_gpu_time_ IPLR_GUARDED_BY(
+      completed_gpu_time_mutex_);
+
   FML_DISALLOW_COPY_AND_ASSIGN(GPUTracer);
 };
 
@@ -27,6 +27,14 @@ void HostBuffer::SetLabel(std::string label) {
   label_ = std::move(label);
 }
 
+void HostBuffer::Reset() {
+  if (!Truncate(0u)) {
+    return;
+  }
+  generation_++;
+  recycle_device_buffer_ = device_buffer_ != nullptr;
+}
+
 BufferView HostBuffer::Emplace(const void* buffer,
                                size_t length,
                                size_t align) {
@@ -61,6 +69,17 @@ std::shared_ptr<const DeviceBuffer> HostBuffer::GetDeviceBuffer(
   if (generation_ == device_buffer_generation_) {
     return device_buffer_;
   }
+  // Only the first upload after a reset may overwrite the previous device
+  // buffer. Later uploads in the same frame may race with commands that are
+  // already encoded against it.
+  if (recycle_device_buffer_) {
+    recycle_device_buffer_ = false;
+    if (device_buffer_->GetDeviceBufferDescriptor().size >= GetLength() &&
+        device_buffer_->CopyHostBuffer(GetBuffer(), Range{0, GetLength()})) {
+      device_buffer_generation_ = generation_;
+      return device_buffer_;
+    }
+  }
   auto new_buffer = allocator.CreateBufferWithCopy(GetBuffer(), GetLength());
   if (!new_buffer) {
     return nullptr;
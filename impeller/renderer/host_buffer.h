@@ -28,6 +28,17 @@ class HostBuffer final : public std::enable_shared_from_this<HostBuffer>,
 
   void SetLabel(std::string label);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Discard all emplaced data while retaining the host
+  ///             reservation. The device buffer created for the previous
+  ///             contents is reused for the next upload if it is large
+  ///             enough.
+  ///
+  ///             Callers must ensure the GPU is no longer reading from the
+  ///             previous contents. This is managed by |HostBufferRing|.
+  ///
+  void Reset();
+
   //----------------------------------------------------------------------------
   /// @brief      Emplace uniform data onto the host buffer. Ensure that backend
   ///             specific uniform alignment requirements are respected.
@@ -98,6 +109,7 @@ class HostBuffer final : public std::enable_shared_from_this<HostBuffer>,
  private:
   mutable std::shared_ptr<DeviceBuffer> device_buffer_;
   mutable size_t device_buffer_generation_ = 0u;
+  mutable bool recycle_device_buffer_ = false;
   size_t generation_ = 1u;
   std::string label_;
 
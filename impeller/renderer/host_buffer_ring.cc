@@ -0,0 +1,77 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/host_buffer_ring.h"
+
+#include <algorithm>
+
+#include "impeller/renderer/context.h"
+
+namespace impeller {
+
+HostBufferRing::HostBufferRing(size_t frames_in_flight)
+    : frames_(std::max<size_t>(frames_in_flight, 1u)) {}
+
+HostBufferRing::~HostBufferRing() = default;
+
+std::shared_ptr<HostBuffer> HostBufferRing::Acquire() {
+  std::scoped_lock lock(mutex_);
+  std::shared_ptr<HostBuffer> buffer;
+  if (free_buffers_.empty()) {
+    buffer = HostBuffer::Create();
+  } else {
+    buffer = std::move(free_buffers_.back());
+    free_buffers_.pop_back();
+  }
+  frames_[frame_index_].push_back(buffer);
+  return buffer;
+}
+
+std::shared_ptr<HostBuffer> HostBufferRing::AcquireFrom(
+    const std::weak_ptr<const Context>& weak_context) {
+  auto context = weak_context.lock();
+  if (!context) {
+    return HostBuffer::Create();
+  }
+  return context->GetHostBufferRing()->Acquire();
+}
+
+void HostBufferRing::AdvanceFrame() {
+  std::scoped_lock lock(mutex_);
+
+  size_t frame_usage = 0u;
+  for (const auto& buffer : frames_[frame_index_]) {
+    frame_usage += buffer->GetLength();
+  }
+  high_water_mark_ = std::max(high_water_mark_, frame_usage);
+
+  // Buffers that were not reacquired for an entire frame are surplus to the
+  // current workload.
+  free_buffers_.clear();
+
+  frame_index_ = (frame_index_ + 1u) % frames_.size();
+  auto& retired = frames_[frame_index_];
+  for (auto& buffer : retired) {
+    // A buffer still referenced elsewhere (say, by a pass that was never
+    // submitted) may not be overwritten. Let its owner collect it instead.
+    if (buffer.use_count() != 1) {
+      continue;
+    }
+    buffer->Reset();
+    free_buffers_.push_back(std::move(buffer));
+  }
+  retired.clear();
+}
+
+size_t HostBufferRing::GetHighWaterMark() const {
+  std::scoped_lock lock(mutex_);
+  return high_water_mark_;
+}
+
+size_t HostBufferRing::GetFreeBufferCount() const {
+  std::scoped_lock lock(mutex_);
+  return free_buffers_.size();
+}
+
+}  // namespace impeller
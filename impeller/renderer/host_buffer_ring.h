@@ -0,0 +1,77 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "impeller/renderer/host_buffer.h"
+
+namespace impeller {
+
+class Context;
+
+//------------------------------------------------------------------------------
+/// @brief      A ring of host buffers that are handed out as pass transients
+///             and recycled once the frame they were used in can no longer be
+///             in flight on the GPU.
+///
+///             Buffers acquired during a frame are retired after
+///             `frames_in_flight` calls to |AdvanceFrame|. Retired buffers
+///             retain both their host reservation and their device buffer so
+///             that steady state frames perform no transient allocations.
+///
+class HostBufferRing {
+ public:
+  static constexpr size_t kDefaultFramesInFlight = 3u;
+
+  explicit HostBufferRing(size_t frames_in_flight = kDefaultFramesInFlight);
+
+  ~HostBufferRing();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Acquire an empty host buffer to use for the current frame.
+  ///
+  std::shared_ptr<HostBuffer> Acquire();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Acquire a buffer from the ring of the given context. If the
+  ///             context has already been collected, a standalone buffer is
+  ///             created instead.
+  ///
+  static std::shared_ptr<HostBuffer> AcquireFrom(
+      const std::weak_ptr<const Context>& context);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Mark the end of the current frame. Buffers acquired
+  ///             `frames_in_flight` frames ago are reset and made available
+  ///             for reuse.
+  ///
+  void AdvanceFrame();
+
+  //----------------------------------------------------------------------------
+  /// @brief      The largest number of bytes emplaced into the buffers of a
+  ///             single frame seen so far.
+  ///
+  size_t GetHighWaterMark() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of retired buffers available for reuse.
+  ///
+  size_t GetFreeBufferCount() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<std::vector<std::shared_ptr<HostBuffer>>> frames_;
+  std::vector<std::shared_ptr<HostBuffer>> free_buffers_;
+  size_t frame_index_ = 0u;
+  size_t high_water_mark_ = 0u;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(HostBufferRing);
+};
+
+}  // namespace impeller
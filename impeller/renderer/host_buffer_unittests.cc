@@ -4,6 +4,7 @@
 
 #include "flutter/testing/testing.h"
 #include "impeller/renderer/host_buffer.h"
+#include "impeller/renderer/host_buffer_ring.h"
 
 namespace impeller {
 namespace testing {
@@ -75,5 +76,60 @@ TEST(HostBufferTest, CanEmplaceWithAlignment) {
   }
 }
 
+TEST(HostBufferTest, ResetRetainsReservation) {
+  auto buffer = HostBuffer::Create();
+  ASSERT_TRUE(buffer->Emplace(nullptr, 10000u, 0u));
+  const auto reserved = buffer->GetReservedLength();
+  ASSERT_GE(reserved, 10000u);
+
+  buffer->Reset();
+  ASSERT_EQ(buffer->GetLength(), 0u);
+  ASSERT_EQ(buffer->GetReservedLength(), reserved);
+
+  auto view = buffer->Emplace(nullptr, 16u, 0u);
+  ASSERT_TRUE(view);
+  ASSERT_EQ(view.range, Range(0u, 16u));
+  ASSERT_EQ(buffer->GetReservedLength(), reserved);
+}
+
+TEST(HostBufferTest, RingRecyclesBuffersAfterFramesInFlight) {
+  HostBufferRing ring(2u);
+
+  auto first = ring.Acquire().get();
+  ring.AdvanceFrame();
+  ASSERT_EQ(ring.GetFreeBufferCount(), 0u);
+
+  // The first frame may still be in flight.
+  ASSERT_NE(ring.Acquire().get(), first);
+  ring.AdvanceFrame();
+  ASSERT_EQ(ring.GetFreeBufferCount(), 1u);
+
+  auto recycled = ring.Acquire();
+  ASSERT_EQ(recycled.get(), first);
+  ASSERT_EQ(recycled->GetLength(), 0u);
+}
+
+TEST(HostBufferTest, RingDoesNotRecycleReferencedBuffers) {
+  HostBufferRing ring(1u);
+
+  auto held = ring.Acquire();
+  ring.AdvanceFrame();
+  ASSERT_EQ(ring.GetFreeBufferCount(), 0u);
+  ASSERT_NE(ring.Acquire(), held);
+}
+
+TEST(HostBufferTest, RingTracksHighWaterMark) {
+  HostBufferRing ring(1u);
+
+  ASSERT_TRUE(ring.Acquire()->Emplace(nullptr, 100u, 0u));
+  ASSERT_TRUE(ring.Acquire()->Emplace(nullptr, 50u, 0u));
+  ring.AdvanceFrame();
+  ASSERT_EQ(ring.GetHighWaterMark(), 150u);
+
+  ASSERT_TRUE(ring.Acquire()->Emplace(nullptr, 20u, 0u));
+  ring.AdvanceFrame();
+  ASSERT_EQ(ring.GetHighWaterMark(), 150u);
+}
+
 }  // namespace  testing
 }  // namespace impeller
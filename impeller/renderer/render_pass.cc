@@ -4,13 +4,15 @@
 
 #include "impeller/renderer/render_pass.h"
 
+#include "impeller/renderer/host_buffer_ring.h"
+
 namespace impeller {
 
 RenderPass::RenderPass(std::weak_ptr<const Context> context,
                        const RenderTarget& target)
     : context_(std::move(context)),
       render_target_(target),
-      transients_buffer_(HostBuffer::Create()) {}
+      transients_buffer_(HostBufferRing::AcquireFrom(context_)) {}
 
 RenderPass::~RenderPass() = default;
 
@@ -40,6 +42,17 @@ bool RenderPass::AddCommand(Command command) {
     return false;
   }
 
+  if (scissor_.has_value()) {
+    auto scissor = command.scissor.has_value()
+                       ? command.scissor->Intersection(scissor_.value())
+                       : scissor_;
+    if (!scissor.has_value()) {
+      // Nothing the command draws would be visible.
+      return true;
+    }
+    command.scissor = scissor;
+  }
+
   if (command.scissor.has_value()) {
     auto target_rect = IRect({}, render_target_.GetRenderTargetSize());
     if (!target_rect.Contains(command.scissor.value())) {
@@ -65,6 +78,14 @@ bool RenderPass::AddCommand(Command command) {
   return true;
 }
 
+void RenderPass::SetScissor(std::optional<IRect> scissor) {
+  scissor_ = scissor;
+}
+
+const std::optional<IRect>& RenderPass::GetScissor() const {
+  return scissor_;
+}
+
 bool RenderPass::EncodeCommands() const {
   auto context = context_.lock();
   // The context could have been collected in the meantime.
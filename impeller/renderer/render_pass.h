@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "impeller/renderer/command.h"
@@ -37,6 +38,19 @@ class RenderPass {
 
   HostBuffer& GetTransientsBuffer();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Set a scissor rect that is applied to all commands that are
+  ///             added to the pass from now on, in addition to the scissor of
+  ///             the command itself. Commands that end up with an empty
+  ///             scissor are dropped.
+  ///
+  /// @param[in]  scissor  The scissor, or std::nullopt to stop scissoring.
+  ///                      Must lie within the render target.
+  ///
+  void SetScissor(std::optional<IRect> scissor);
+
+  const std::optional<IRect>& GetScissor() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Record a command for subsequent encoding to the underlying
   ///             command buffer. No work is encoded into the command buffer at
@@ -61,6 +75,7 @@ class RenderPass {
   const RenderTarget render_target_;
   std::shared_ptr<HostBuffer> transients_buffer_;
   std::vector<Command> commands_;
+  std::optional<IRect> scissor_;
 
   RenderPass(std::weak_ptr<const Context> context, const RenderTarget& target);
 
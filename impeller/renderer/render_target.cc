@@ -12,6 +12,24 @@
 
 namespace impeller {
 
+RenderTargetAllocator::RenderTargetAllocator(
+    std::shared_ptr<Allocator> allocator)
+    : allocator_(std::move(allocator)) {}
+
+RenderTargetAllocator::~RenderTargetAllocator() = default;
+
+std::shared_ptr<Texture> RenderTargetAllocator::CreateTexture(
+    const TextureDescriptor& desc) {
+  if (!allocator_) {
+    return nullptr;
+  }
+  return allocator_->CreateTexture(desc);
+}
+
+void RenderTargetAllocator::Start() {}
+
+void RenderTargetAllocator::End() {}
+
 RenderTarget::RenderTarget() = default;
 
 RenderTarget::~RenderTarget() = default;
@@ -186,6 +204,40 @@ RenderTarget RenderTarget::CreateOffscreen(const Context& context,
                                            StorageMode stencil_storage_mode,
                                            LoadAction stencil_load_action,
                                            StoreAction stencil_store_action) {
+  RenderTargetAllocator allocator(context.GetResourceAllocator());
+  return CreateOffscreen(allocator, size, label, color_storage_mode,
+                         color_load_action, color_store_action,
+                         stencil_storage_mode, stencil_load_action,
+                         stencil_store_action);
+}
+
+RenderTarget RenderTarget::CreateOffscreenMSAA(
+    const Context& context,
+    ISize size,
+    const std::string& label,
+    StorageMode color_storage_mode,
+    StorageMode color_resolve_storage_mode,
+    LoadAction color_load_action,
+    StoreAction color_store_action,
+    StorageMode stencil_storage_mode,
+    LoadAction stencil_load_action,
+    StoreAction stencil_store_action) {
+  RenderTargetAllocator allocator(context.GetResourceAllocator());
+  return CreateOffscreenMSAA(allocator, size, label, color_storage_mode,
+                             color_resolve_storage_mode, color_load_action,
+                             color_store_action, stencil_storage_mode,
+                             stencil_load_action, stencil_store_action);
+}
+
+RenderTarget RenderTarget::CreateOffscreen(RenderTargetAllocator& allocator,
+                                           ISize size,
+                                           const std::string& label,
+                                           StorageMode color_storage_mode,
+                                           LoadAction color_load_action,
+                                           StoreAction color_store_action,
+                                           StorageMode stencil_storage_mode,
+                                           LoadAction stencil_load_action,
+                                           StoreAction stencil_store_action) {
   if (size.IsEmpty()) {
     return {};
   }
@@ -208,7 +260,7 @@ RenderTarget RenderTarget::CreateOffscreen(const Context& context,
   color0.clear_color = Color::BlackTransparent();
   color0.load_action = color_load_action;
   color0.store_action = color_store_action;
-  color0.texture = context.GetResourceAllocator()->CreateTexture(color_tex0);
+  color0.texture = allocator.CreateTexture(color_tex0);
 
   if (!color0.texture) {
     return {};
@@ -220,8 +272,7 @@ RenderTarget RenderTarget::CreateOffscreen(const Context& context,
   stencil0.load_action = stencil_load_action;
   stencil0.store_action = stencil_store_action;
   stencil0.clear_stencil = 0u;
-  stencil0.texture =
-      context.GetResourceAllocator()->CreateTexture(stencil_tex0);
+  stencil0.texture = allocator.CreateTexture(stencil_tex0);
 
   if (!stencil0.texture) {
     return {};
@@ -237,7 +288,7 @@ RenderTarget RenderTarget::CreateOffscreen(const Context& context,
 }
 
 RenderTarget RenderTarget::CreateOffscreenMSAA(
-    const Context& context,
+    RenderTargetAllocator& allocator,
     ISize size,
     const std::string& label,
     StorageMode color_storage_mode,
@@ -261,8 +312,7 @@ RenderTarget RenderTarget::CreateOffscreenMSAA(
   color0_tex_desc.size = size;
   color0_tex_desc.usage = static_cast<uint64_t>(TextureUsage::kRenderTarget);
 
-  auto color0_msaa_tex =
-      context.GetResourceAllocator()->CreateTexture(color0_tex_desc);
+  auto color0_msaa_tex = allocator.CreateTexture(color0_tex_desc);
   if (!color0_msaa_tex) {
     VALIDATION_LOG << "Could not create multisample color texture.";
     return {};
@@ -280,8 +330,7 @@ RenderTarget RenderTarget::CreateOffscreenMSAA(
       static_cast<uint64_t>(TextureUsage::kRenderTarget) |
       static_cast<uint64_t>(TextureUsage::kShaderRead);
 
-  auto color0_resolve_tex =
-      context.GetResourceAllocator()->CreateTexture(color0_resolve_tex_desc);
+  auto color0_resolve_tex = allocator.CreateTexture(color0_resolve_tex_desc);
   if (!color0_resolve_tex) {
     VALIDATION_LOG << "Could not create color texture.";
     return {};
@@ -312,8 +361,7 @@ RenderTarget RenderTarget::CreateOffscreenMSAA(
   stencil0.load_action = stencil_load_action;
   stencil0.store_action = stencil_store_action;
   stencil0.clear_stencil = 0u;
-  stencil0.texture =
-      context.GetResourceAllocator()->CreateTexture(stencil_tex0);
+  stencil0.texture = allocator.CreateTexture(stencil_tex0);
 
   if (!stencil0.texture) {
     return {};
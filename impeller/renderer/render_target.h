@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <optional>
 
 #include "flutter/fml/macros.h"
@@ -17,6 +18,38 @@ namespace impeller {
 
 class Context;
 
+//------------------------------------------------------------------------------
+/// @brief      An allocator of the textures backing render target attachments.
+///
+///             The base implementation forwards every request to the
+///             underlying resource allocator. Subclasses may recycle textures
+///             across frames. `Start` and `End` mark the boundaries of a frame.
+///
+class RenderTargetAllocator {
+ public:
+  explicit RenderTargetAllocator(std::shared_ptr<Allocator> allocator);
+
+  virtual ~RenderTargetAllocator();
+
+  virtual std::shared_ptr<Texture> CreateTexture(
+      const TextureDescriptor& desc);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Mark the beginning of a frame workload.
+  ///
+  virtual void Start();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Mark the end of a frame workload.
+  ///
+  virtual void End();
+
+ private:
+  std::shared_ptr<Allocator> allocator_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(RenderTargetAllocator);
+};
+
 class RenderTarget {
  public:
   static RenderTarget CreateOffscreen(
@@ -42,6 +75,29 @@ class RenderTarget {
       LoadAction stencil_load_action = LoadAction::kClear,
       StoreAction stencil_store_action = StoreAction::kDontCare);
 
+  static RenderTarget CreateOffscreen(
+      RenderTargetAllocator& allocator,
+      ISize size,
+      const std::string& label = "Offscreen",
+      StorageMode color_storage_mode = StorageMode::kDevicePrivate,
+      LoadAction color_load_action = LoadAction::kClear,
+      StoreAction color_store_action = StoreAction::kStore,
+      StorageMode stencil_storage_mode = StorageMode::kDeviceTransient,
+      LoadAction stencil_load_action = LoadAction::kClear,
+      StoreAction stencil_store_action = StoreAction::kDontCare);
+
+  static RenderTarget CreateOffscreenMSAA(
+      RenderTargetAllocator& allocator,
+      ISize size,
+      const std::string& label = "Offscreen MSAA",
+      StorageMode color_storage_mode = StorageMode::kDeviceTransient,
+      StorageMode color_resolve_storage_mode = StorageMode::kDevicePrivate,
+      LoadAction color_load_action = LoadAction::kClear,
+      StoreAction color_store_action = StoreAction::kMultisampleResolve,
+      StorageMode stencil_storage_mode = StorageMode::kDeviceTransient,
+      LoadAction stencil_load_action = LoadAction::kClear,
+      StoreAction stencil_store_action = StoreAction::kDontCare);
+
   RenderTarget();
 
   ~RenderTarget();
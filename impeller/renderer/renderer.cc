@@ -10,6 +10,7 @@
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
 #include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/host_buffer_ring.h"
 #include "impeller/renderer/surface.h"
 
 namespace impeller {
@@ -57,6 +58,8 @@ bool Renderer::Render(std::unique_ptr<Surface> surface,
 
   frames_in_flight_sema_->Signal();
 
+  context_->GetHostBufferRing()->AdvanceFrame();
+
   return present_result;
 }
 
@@ -2,6 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/testing/testing.h"
 #include "impeller/base/strings.h"
 #include "impeller/fixtures/array.frag.h"
@@ -30,11 +35,13 @@
 #include "impeller/renderer/formats.h"
 #include "impeller/renderer/pipeline_builder.h"
 #include "impeller/renderer/pipeline_library.h"
+#include "impeller/renderer/render_target.h"
 #include "impeller/renderer/renderer.h"
 #include "impeller/renderer/sampler.h"
 #include "impeller/renderer/sampler_descriptor.h"
 #include "impeller/renderer/sampler_library.h"
 #include "impeller/renderer/surface.h"
+#include "impeller/renderer/texture_uploader.h"
 #include "impeller/renderer/vertex_buffer_builder.h"
 #include "impeller/tessellator/tessellator.h"
 #include "third_party/imgui/imgui.h"
@@ -1026,5 +1033,169 @@ TEST_P(RendererTest, VertexBufferBuilder) {
   ASSERT_EQ(vertex_builder.GetVertexCount(), 4u);
 }
 
+TEST_P(RendererTest, CanSubmitCommandsAsync) {
+  auto context = GetContext();
+  ASSERT_TRUE(context);
+
+  auto target = RenderTarget::CreateOffscreen(*context, {100, 100});
+  ASSERT_TRUE(target.IsValid());
+
+  auto buffer = context->CreateCommandBuffer();
+  ASSERT_TRUE(buffer);
+  ASSERT_FALSE(buffer->SubmitCommandsAsync(nullptr));
+
+  auto pass = buffer->CreateRenderPass(target);
+  ASSERT_TRUE(pass);
+  ASSERT_TRUE(buffer->SubmitCommandsAsync(std::move(pass)));
+}
+
+TEST_P(RendererTest, CanCreateCommandBuffersFromManyThreads) {
+  auto context = GetContext();
+  ASSERT_TRUE(context);
+
+  constexpr size_t kThreadCount = 4u;
+  constexpr size_t kCommandBuffersPerThread = 256u;
+
+  std::atomic<size_t> valid_command_buffers = 0u;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreadCount; i++) {
+    threads.emplace_back([&context, &valid_command_buffers]() {
+      for (size_t j = 0; j < kCommandBuffersPerThread; j++) {
+        // Every other buffer is kept alive while the next one is created so
+        // that both fresh and recycled command buffers are handed out.
+        auto first = context->CreateCommandBuffer();
+        auto second = context->CreateCommandBuffer();
+        for (const auto& buffer : {first, second}) {
+          if (buffer && buffer->IsValid()) {
+            valid_command_buffers++;
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(valid_command_buffers.load(),
+            kThreadCount * kCommandBuffersPerThread * 2u);
+}
+
+TEST_P(RendererTest, CanUploadTexturesThroughStagingBuffers) {
+  if (GetParam() == PlaygroundBackend::kVulkan) {
+    GTEST_SKIP_("Blit passes are not implemented on Vulkan yet.");
+  }
+  auto context = GetContext();
+  ASSERT_TRUE(context);
+
+  TextureDescriptor texture_desc;
+  texture_desc.format = PixelFormat::kR8G8B8A8UNormInt;
+  texture_desc.size = {32, 32};
+  const auto length = texture_desc.GetByteSizeOfBaseMipLevel();
+
+  // Only two of the textures fit into a single staging buffer.
+  auto uploader = std::make_shared<TextureUploader>(context, length * 5 / 2);
+
+  std::vector<std::shared_ptr<Texture>> textures;
+  for (uint8_t i = 0; i < 3; i++) {
+    std::vector<uint8_t> pixels(length, i + 1);
+    fml::NonOwnedMapping mapping(pixels.data(), pixels.size());
+    auto texture = uploader->Upload(texture_desc, mapping);
+    ASSERT_TRUE(texture);
+    ASSERT_EQ(texture->GetTextureDescriptor().storage_mode,
+              StorageMode::kDevicePrivate);
+    textures.push_back(std::move(texture));
+  }
+  ASSERT_EQ(uploader->GetPendingUploadCount(), 1u);
+
+  fml::AutoResetWaitableEvent latch;
+  bool uploaded = false;
+  ASSERT_TRUE(uploader->Flush([&](bool success) {
+    uploaded = success;
+    latch.Signal();
+  }));
+  latch.Wait();
+  ASSERT_TRUE(uploaded);
+  ASSERT_EQ(uploader->GetPendingUploadCount(), 0u);
+  ASSERT_EQ(uploader->GetIdleStagingBufferCount(), 2u);
+
+  DeviceBufferDescriptor buffer_desc;
+  buffer_desc.storage_mode = StorageMode::kHostVisible;
+  buffer_desc.size = length;
+  auto readback = context->GetResourceAllocator()->CreateBuffer(buffer_desc);
+  ASSERT_TRUE(readback);
+
+  auto buffer = context->CreateCommandBuffer();
+  ASSERT_TRUE(buffer);
+  auto pass = buffer->CreateBlitPass();
+  ASSERT_TRUE(pass);
+  ASSERT_TRUE(pass->AddCopy(textures.back(), readback));
+  ASSERT_TRUE(pass->EncodeCommands(context->GetResourceAllocator()));
+  ASSERT_TRUE(buffer->SubmitCommands([&](CommandBuffer::Status status) {
+    latch.Signal();
+  }));
+  latch.Wait();
+
+  auto contents = readback->AsBufferView().contents;
+  ASSERT_EQ(contents[0], 3u);
+  ASSERT_EQ(contents[length - 1], 3u);
+}
+
+TEST_P(RendererTest, CanUploadTexturesWrittenIntoStagingBuffers) {
+  if (GetParam() == PlaygroundBackend::kVulkan) {
+    GTEST_SKIP_("Blit passes are not implemented on Vulkan yet.");
+  }
+  auto context = GetContext();
+  ASSERT_TRUE(context);
+
+  TextureDescriptor texture_desc;
+  texture_desc.format = PixelFormat::kR8G8B8A8UNormInt;
+  texture_desc.size = {32, 32};
+  const auto length = texture_desc.GetByteSizeOfBaseMipLevel();
+
+  // The staging buffer of the written texture is larger than the default
+  // size, so it is not kept for reuse.
+  auto uploader = std::make_shared<TextureUploader>(context, length / 2);
+  ASSERT_FALSE(uploader->Upload(texture_desc,
+                                [](uint8_t* contents) { return false; }));
+  auto texture = uploader->Upload(texture_desc, [&](uint8_t* contents) {
+    memset(contents, 7, length);
+    return true;
+  });
+  ASSERT_TRUE(texture);
+  ASSERT_EQ(uploader->GetPendingUploadCount(), 1u);
+
+  fml::AutoResetWaitableEvent latch;
+  bool uploaded = false;
+  ASSERT_TRUE(uploader->Flush([&](bool success) {
+    uploaded = success;
+    latch.Signal();
+  }));
+  latch.Wait();
+  ASSERT_TRUE(uploaded);
+  ASSERT_EQ(uploader->GetIdleStagingBufferCount(), 0u);
+
+  DeviceBufferDescriptor buffer_desc;
+  buffer_desc.storage_mode = StorageMode::kHostVisible;
+  buffer_desc.size = length;
+  auto readback = context->GetResourceAllocator()->CreateBuffer(buffer_desc);
+  ASSERT_TRUE(readback);
+
+  auto buffer = context->CreateCommandBuffer();
+  ASSERT_TRUE(buffer);
+  auto pass = buffer->CreateBlitPass();
+  ASSERT_TRUE(pass);
+  ASSERT_TRUE(pass->AddCopy(texture, readback));
+  ASSERT_TRUE(pass->EncodeCommands(context->GetResourceAllocator()));
+  ASSERT_TRUE(buffer->SubmitCommands([&](CommandBuffer::Status status) {
+    latch.Signal();
+  }));
+  latch.Wait();
+
+  auto contents = readback->AsBufferView().contents;
+  ASSERT_EQ(contents[0], 7u);
+  ASSERT_EQ(contents[length - 1], 7u);
+}
+
 }  // namespace testing
 }  // namespace impeller
@@ -42,6 +42,41 @@ bool Texture::SetContents(std::shared_ptr<const fml::Mapping> mapping,
   return true;
 }
 
+bool Texture::SetContentsInRegion(const uint8_t* contents,
+                                  size_t bytes_per_row,
+                                  IRect region,
+                                  size_t slice) {
+  if (!IsSliceValid(slice)) {
+    VALIDATION_LOG << "Invalid slice for texture.";
+    return false;
+  }
+  if (!contents || region.IsEmpty() ||
+      !IRect::MakeSize(desc_.size).Contains(region)) {
+    return false;
+  }
+  if (IsBlockCompressedPixelFormat(desc_.format)) {
+    VALIDATION_LOG << "The contents of block compressed textures can only be "
+                      "set all at once.";
+    return false;
+  }
+  if (bytes_per_row <
+      region.size.width * BytesPerPixelForPixelFormat(desc_.format)) {
+    return false;
+  }
+  if (!OnSetContentsInRegion(contents, bytes_per_row, region, slice)) {
+    return false;
+  }
+  intent_ = TextureIntent::kUploadFromHost;
+  return true;
+}
+
+bool Texture::OnSetContentsInRegion(const uint8_t* contents,
+                                    size_t bytes_per_row,
+                                    IRect region,
+                                    size_t slice) {
+  return false;
+}
+
 size_t Texture::GetMipCount() const {
   return GetTextureDescriptor().mip_count;
 }
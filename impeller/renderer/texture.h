@@ -8,6 +8,7 @@
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
+#include "impeller/geometry/rect.h"
 #include "impeller/geometry/size.h"
 #include "impeller/renderer/formats.h"
 #include "impeller/renderer/texture_descriptor.h"
@@ -27,6 +28,25 @@ class Texture {
   [[nodiscard]] bool SetContents(std::shared_ptr<const fml::Mapping> mapping,
                                  size_t slice = 0);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Replace a region of the base mip level of the texture.
+  ///
+  ///             Not all backends support partial updates. Callers must be
+  ///             prepared to fall back to replacing the entire contents via
+  ///             |SetContents|.
+  ///
+  /// @param[in]  contents       The first pixel of the region.
+  /// @param[in]  bytes_per_row  The stride between rows of `contents`.
+  /// @param[in]  region         The region of the texture to replace.
+  /// @param[in]  slice          The slice of the texture to replace.
+  ///
+  /// @return     If the region was replaced.
+  ///
+  [[nodiscard]] bool SetContentsInRegion(const uint8_t* contents,
+                                         size_t bytes_per_row,
+                                         IRect region,
+                                         size_t slice = 0);
+
   virtual bool IsValid() const = 0;
 
   virtual ISize GetSize() const = 0;
@@ -52,6 +72,11 @@ class Texture {
       std::shared_ptr<const fml::Mapping> mapping,
       size_t slice) = 0;
 
+  [[nodiscard]] virtual bool OnSetContentsInRegion(const uint8_t* contents,
+                                                   size_t bytes_per_row,
+                                                   IRect region,
+                                                   size_t slice);
+
  private:
   TextureIntent intent_ = TextureIntent::kRenderToTexture;
   const TextureDescriptor desc_;
@@ -30,13 +30,21 @@ struct TextureDescriptor {
     if (!IsValid()) {
       return 0u;
     }
+    if (IsBlockCompressedPixelFormat(format)) {
+      return GetBytesPerRow() * BlockCountForPixels(size.height);
+    }
     return size.Area() * BytesPerPixelForPixelFormat(format);
   }
 
+  /// For block compressed formats, this is the size of a row of blocks.
   constexpr size_t GetBytesPerRow() const {
     if (!IsValid()) {
       return 0u;
     }
+    if (IsBlockCompressedPixelFormat(format)) {
+      return BlockCountForPixels(size.width) *
+             BytesPerBlockForPixelFormat(format);
+    }
     return size.width * BytesPerPixelForPixelFormat(format);
   }
 
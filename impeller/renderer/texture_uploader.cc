@@ -0,0 +1,274 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/texture_uploader.h"
+
+#include <algorithm>
+
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/validation.h"
+#include "impeller/renderer/allocator.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/context.h"
+
+namespace impeller {
+
+// Satisfies the buffer offset alignment requirements of all backends for
+// copies into textures.
+static constexpr size_t kStagingAlignment = 256u;
+
+// Staging buffers beyond this count are released once they are idle.
+static constexpr size_t kMaxIdleStagingBuffers = 3u;
+
+static size_t AlignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1u) / alignment * alignment;
+}
+
+TextureUploader::TextureUploader(std::weak_ptr<const Context> context,
+                                 size_t staging_buffer_size)
+    : context_(std::move(context)), staging_buffer_size_(staging_buffer_size) {}
+
+TextureUploader::~TextureUploader() = default;
+
+std::shared_ptr<Texture> TextureUploader::Upload(TextureDescriptor descriptor,
+                                                 const fml::Mapping& contents) {
+  TRACE_EVENT0("impeller", "TextureUploader::Upload");
+  auto context = context_.lock();
+  if (!context) {
+    return nullptr;
+  }
+
+  const auto length = descriptor.GetByteSizeOfBaseMipLevel();
+  if (contents.GetMapping() == nullptr || contents.GetSize() < length) {
+    VALIDATION_LOG << "Not enough contents to upload to the texture.";
+    return nullptr;
+  }
+
+  descriptor.storage_mode = StorageMode::kDevicePrivate;
+  auto texture = context->GetResourceAllocator()->CreateTexture(descriptor);
+  if (!texture) {
+    return nullptr;
+  }
+
+  std::optional<Batch> full_batch;
+  {
+    std::scoped_lock lock(mutex_);
+    auto offset = AlignUp(staging_offset_, kStagingAlignment);
+    if (staging_buffer_ &&
+        offset + length > staging_buffer_->GetDeviceBufferDescriptor().size) {
+      full_batch = TakeBatchLocked();
+      offset = 0u;
+    }
+    if (!staging_buffer_) {
+      staging_buffer_ = AcquireStagingBufferLocked(*context, length);
+      if (!staging_buffer_) {
+        return nullptr;
+      }
+    }
+    if (!staging_buffer_->CopyHostBuffer(contents.GetMapping(),
+                                         Range{0, length}, offset)) {
+      return nullptr;
+    }
+    staging_offset_ = offset + length;
+    pending_uploads_.push_back({texture, offset});
+  }
+
+  // A full batch is submitted outside the lock since backends may invoke the
+  // completion callback, which recycles the staging buffer, synchronously.
+  if (full_batch.has_value() &&
+      !Submit(*context, std::move(full_batch.value()), nullptr)) {
+    return nullptr;
+  }
+
+  return texture;
+}
+
+std::shared_ptr<Texture> TextureUploader::Upload(TextureDescriptor descriptor,
+                                                 const ContentsWriter& writer) {
+  TRACE_EVENT0("impeller", "TextureUploader::UploadInPlace");
+  auto context = context_.lock();
+  if (!context) {
+    return nullptr;
+  }
+
+  descriptor.storage_mode = StorageMode::kDevicePrivate;
+  auto texture = context->GetResourceAllocator()->CreateTexture(descriptor);
+  if (!texture) {
+    return nullptr;
+  }
+
+  const auto length = descriptor.GetByteSizeOfBaseMipLevel();
+  std::shared_ptr<DeviceBuffer> staging_buffer;
+  {
+    std::scoped_lock lock(mutex_);
+    staging_buffer = AcquireStagingBufferLocked(*context, length);
+  }
+  if (!staging_buffer) {
+    return nullptr;
+  }
+  auto contents = staging_buffer->AsBufferView().contents;
+  if (!contents) {
+    VALIDATION_LOG << "Staging buffer contents are not host visible.";
+    return nullptr;
+  }
+  if (!writer(contents)) {
+    RecycleStagingBuffer(std::move(staging_buffer));
+    return nullptr;
+  }
+
+  std::scoped_lock lock(mutex_);
+  pending_uploads_.push_back({texture, 0u, std::move(staging_buffer)});
+  return texture;
+}
+
+bool TextureUploader::Flush(const CompletionCallback& callback) {
+  auto context = context_.lock();
+  if (!context) {
+    if (callback) {
+      callback(false);
+    }
+    return false;
+  }
+
+  std::optional<Batch> batch;
+  {
+    std::scoped_lock lock(mutex_);
+    batch = TakeBatchLocked();
+  }
+  if (!batch.has_value()) {
+    if (callback) {
+      callback(true);
+    }
+    return true;
+  }
+  return Submit(*context, std::move(batch.value()), callback);
+}
+
+size_t TextureUploader::GetPendingUploadCount() const {
+  std::scoped_lock lock(mutex_);
+  return pending_uploads_.size();
+}
+
+size_t TextureUploader::GetIdleStagingBufferCount() const {
+  std::scoped_lock lock(mutex_);
+  return idle_staging_buffers_.size();
+}
+
+std::optional<TextureUploader::Batch> TextureUploader::TakeBatchLocked() {
+  if (pending_uploads_.empty()) {
+    return std::nullopt;
+  }
+  Batch batch;
+  batch.staging_buffer = std::move(staging_buffer_);
+  batch.uploads = std::move(pending_uploads_);
+  staging_buffer_.reset();
+  staging_offset_ = 0u;
+  pending_uploads_.clear();
+  return batch;
+}
+
+std::shared_ptr<DeviceBuffer> TextureUploader::AcquireStagingBufferLocked(
+    const Context& context,
+    size_t length) {
+  auto found = std::find_if(
+      idle_staging_buffers_.begin(), idle_staging_buffers_.end(),
+      [length](const auto& buffer) {
+        return buffer->GetDeviceBufferDescriptor().size >= length;
+      });
+  if (found != idle_staging_buffers_.end()) {
+    auto buffer = std::move(*found);
+    idle_staging_buffers_.erase(found);
+    return buffer;
+  }
+
+  DeviceBufferDescriptor descriptor;
+  descriptor.storage_mode = StorageMode::kHostVisible;
+  descriptor.size = std::max(staging_buffer_size_, length);
+  auto buffer = context.GetResourceAllocator()->CreateBuffer(descriptor);
+  if (!buffer) {
+    VALIDATION_LOG << "Could not allocate a staging buffer.";
+    return nullptr;
+  }
+  buffer->SetLabel("Texture Upload Staging Buffer");
+  return buffer;
+}
+
+bool TextureUploader::Submit(const Context& context,
+                             Batch batch,
+                             const CompletionCallback& callback) {
+  TRACE_EVENT0("impeller", "TextureUploader::Submit");
+  auto fail = [&callback]() {
+    if (callback) {
+      callback(false);
+    }
+    return false;
+  };
+
+  auto command_buffer = context.CreateCommandBuffer();
+  if (!command_buffer) {
+    return fail();
+  }
+  command_buffer->SetLabel("Texture Upload Command Buffer");
+
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    return fail();
+  }
+  blit_pass->SetLabel("Texture Upload Blit Pass");
+
+  // The staging buffers are recycled once the GPU is done reading them.
+  std::vector<std::shared_ptr<DeviceBuffer>> staging_buffers;
+  if (batch.staging_buffer) {
+    staging_buffers.push_back(batch.staging_buffer);
+  }
+  for (const auto& upload : batch.uploads) {
+    if (upload.staging_buffer) {
+      staging_buffers.push_back(upload.staging_buffer);
+    }
+    const auto& staging_buffer =
+        upload.staging_buffer ? upload.staging_buffer : batch.staging_buffer;
+    if (!blit_pass->AddCopy(staging_buffer, upload.texture, upload.offset)) {
+      return fail();
+    }
+    if (upload.texture->GetMipCount() > 1u &&
+        !blit_pass->GenerateMipmap(upload.texture)) {
+      return fail();
+    }
+  }
+
+  if (!blit_pass->EncodeCommands(context.GetResourceAllocator())) {
+    return fail();
+  }
+
+  return command_buffer->SubmitCommands(
+      [weak_uploader = weak_from_this(),
+       staging_buffers = std::move(staging_buffers),
+       callback](CommandBuffer::Status status) mutable {
+        if (auto uploader = weak_uploader.lock()) {
+          for (auto& staging_buffer : staging_buffers) {
+            uploader->RecycleStagingBuffer(std::move(staging_buffer));
+          }
+        }
+        if (callback) {
+          callback(status == CommandBuffer::Status::kCompleted);
+        }
+      });
+}
+
+void TextureUploader::RecycleStagingBuffer(
+    std::shared_ptr<DeviceBuffer> staging_buffer) {
+  // Buffers that were allocated for a single large upload are not kept
+  // around for later uploads.
+  if (staging_buffer->GetDeviceBufferDescriptor().size >
+      staging_buffer_size_) {
+    return;
+  }
+  std::scoped_lock lock(mutex_);
+  if (idle_staging_buffers_.size() < kMaxIdleStagingBuffers) {
+    idle_staging_buffers_.push_back(std::move(staging_buffer));
+  }
+}
+
+}  // namespace impeller
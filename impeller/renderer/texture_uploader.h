@@ -0,0 +1,146 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "impeller/renderer/device_buffer.h"
+#include "impeller/renderer/texture.h"
+#include "impeller/renderer/texture_descriptor.h"
+
+namespace impeller {
+
+class Context;
+
+//------------------------------------------------------------------------------
+/// @brief      Uploads the contents of device private textures via host
+///             visible staging buffers.
+///
+///             Uploads are batched into a staging buffer until |Flush| is
+///             called or the buffer fills up. A single blit pass then copies
+///             every upload in the batch into its texture. Staging buffers are
+///             recycled once the command buffer that reads them has completed
+///             on the GPU.
+///
+///             Uploads may be made from any thread.
+///
+class TextureUploader final
+    : public std::enable_shared_from_this<TextureUploader> {
+ public:
+  using CompletionCallback = std::function<void(bool success)>;
+
+  using ContentsWriter = std::function<bool(uint8_t* contents)>;
+
+  static constexpr size_t kDefaultStagingBufferSize = 4u * 1024u * 1024u;
+
+  explicit TextureUploader(
+      std::weak_ptr<const Context> context,
+      size_t staging_buffer_size = kDefaultStagingBufferSize);
+
+  ~TextureUploader();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Create a device private texture and schedule its base mip
+  ///             level to be replaced with the contents. The remaining mip
+  ///             levels, if any, are generated after the upload.
+  ///
+  ///             The texture may only be used by command buffers submitted
+  ///             after the next call to |Flush|.
+  ///
+  /// @param[in]  descriptor  The descriptor of the texture. The storage mode
+  ///                         is ignored.
+  /// @param[in]  contents    The tightly packed rows of the base mip level.
+  ///
+  /// @return     The texture, or nullptr if it could not be created or the
+  ///             contents could not be staged.
+  ///
+  std::shared_ptr<Texture> Upload(TextureDescriptor descriptor,
+                                  const fml::Mapping& contents);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Create a device private texture and let `writer` write the
+  ///             contents of its base mip level straight into staging memory,
+  ///             instead of copying them from an intermediate allocation.
+  ///
+  ///             The contents are staged in a buffer of their own, so the
+  ///             writer runs on the calling thread without blocking other
+  ///             uploads. This suits producers of large textures such as
+  ///             image decoders.
+  ///
+  /// @param[in]  descriptor  The descriptor of the texture. The storage mode
+  ///                         is ignored.
+  /// @param[in]  writer      Writes the tightly packed rows of the base mip
+  ///                         level and returns whether it succeeded.
+  ///
+  /// @return     The texture, or nullptr if it could not be created or the
+  ///             writer failed.
+  ///
+  std::shared_ptr<Texture> Upload(TextureDescriptor descriptor,
+                                  const ContentsWriter& writer);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Submit all pending uploads.
+  ///
+  /// @param[in]  callback  The optional callback invoked once the uploads
+  ///                       have completed on the GPU.
+  ///
+  /// @return     If the uploads were submitted.
+  ///
+  bool Flush(const CompletionCallback& callback = nullptr);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of uploads that have not been submitted yet.
+  ///
+  size_t GetPendingUploadCount() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of staging buffers that are available for reuse.
+  ///
+  size_t GetIdleStagingBufferCount() const;
+
+ private:
+  struct PendingUpload {
+    std::shared_ptr<Texture> texture;
+    size_t offset = 0u;
+    // The buffer the upload was staged in if it is not the staging buffer of
+    // the batch.
+    std::shared_ptr<DeviceBuffer> staging_buffer;
+  };
+
+  struct Batch {
+    std::shared_ptr<DeviceBuffer> staging_buffer;
+    std::vector<PendingUpload> uploads;
+  };
+
+  const std::weak_ptr<const Context> context_;
+  const size_t staging_buffer_size_;
+  mutable std::mutex mutex_;
+  std::shared_ptr<DeviceBuffer> staging_buffer_;
+  size_t staging_offset_ = 0u;
+  std::vector<PendingUpload> pending_uploads_;
+  std::vector<std::shared_ptr<DeviceBuffer>> idle_staging_buffers_;
+
+  std::optional<Batch> TakeBatchLocked();
+
+  std::shared_ptr<DeviceBuffer> AcquireStagingBufferLocked(
+      const Context& context,
+      size_t length);
+
+  bool Submit(const Context& context,
+              Batch batch,
+              const CompletionCallback& callback);
+
+  void RecycleStagingBuffer(std::shared_ptr<DeviceBuffer> staging_buffer);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TextureUploader);
+};
+
+}  // namespace impeller
@@ -5,6 +5,9 @@
 #include "impeller/runtime_stage/runtime_stage.h"
 
 #include <array>
+#include <string_view>
+
+#include "flutter/fml/hash_combine.h"
 
 #include "impeller/base/validation.h"
 #include "impeller/runtime_stage/runtime_stage_flatbuffers.h"
@@ -102,6 +105,12 @@ RuntimeStage::RuntimeStage(std::shared_ptr<fml::Mapping> payload)
       [payload = payload_](auto, auto) {}  //
   );
 
+  hash_ = fml::HashCombine(
+      stage_, entrypoint_,
+      std::string_view{
+          reinterpret_cast<const char*>(code_mapping_->GetMapping()),
+          code_mapping_->GetSize()});
+
   is_valid_ = true;
 }
 
@@ -140,6 +149,10 @@ const std::string& RuntimeStage::GetEntrypoint() const {
   return entrypoint_;
 }
 
+size_t RuntimeStage::GetHash() const {
+  return hash_;
+}
+
 RuntimeShaderStage RuntimeStage::GetShaderStage() const {
   return stage_;
 }
@@ -36,6 +36,12 @@ class RuntimeStage {
 
   const std::shared_ptr<fml::Mapping>& GetSkSLMapping() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      A hash of the stage, entrypoint, and shader code. Runtime
+  ///             stages created from the same payload have the same hash.
+  ///
+  size_t GetHash() const;
+
   bool IsDirty() const;
 
   void SetClean();
@@ -43,6 +49,7 @@ class RuntimeStage {
  private:
   RuntimeShaderStage stage_ = RuntimeShaderStage::kVertex;
   std::shared_ptr<fml::Mapping> payload_;
+  size_t hash_ = 0u;
   std::string entrypoint_;
   std::shared_ptr<fml::Mapping> code_mapping_;
   std::shared_ptr<fml::Mapping> sksl_mapping_;
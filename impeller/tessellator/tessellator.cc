@@ -4,6 +4,9 @@
 
 #include "impeller/tessellator/tessellator.h"
 
+#include <limits>
+#include <optional>
+
 #include "third_party/libtess2/Include/tesselator.h"
 
 namespace impeller {
@@ -36,6 +39,74 @@ Tessellator::Tessellator()
 
 Tessellator::~Tessellator() = default;
 
+/// Returns true if the points describe a simple convex polygon. Repeated and
+/// collinear points are tolerated.
+static bool IsConvexPolygon(const Point* points, size_t point_count) {
+  if (point_count < 3) {
+    return false;
+  }
+
+  Scalar winding = 0;
+  int x_direction_changes = 0;
+  int y_direction_changes = 0;
+  Scalar last_dx = 0;
+  Scalar last_dy = 0;
+  std::optional<Point> last_edge;
+  std::optional<Point> first_edge;
+
+  auto check_turn = [&](Point from, Point to) {
+    auto cross = from.Cross(to);
+    if (cross == 0) {
+      return true;
+    }
+    if (winding == 0) {
+      winding = cross;
+      return true;
+    }
+    return (cross > 0) == (winding > 0);
+  };
+
+  for (size_t i = 0; i < point_count; i++) {
+    auto edge = points[(i + 1) % point_count] - points[i];
+    if (edge.IsZero()) {
+      continue;
+    }
+
+    // A simple convex polygon changes direction along each axis at most
+    // twice. This rejects self-intersecting contours like pentagrams whose
+    // turns all have the same sign.
+    if (edge.x != 0) {
+      if (last_dx != 0 && (edge.x > 0) != (last_dx > 0)) {
+        x_direction_changes++;
+      }
+      last_dx = edge.x;
+    }
+    if (edge.y != 0) {
+      if (last_dy != 0 && (edge.y > 0) != (last_dy > 0)) {
+        y_direction_changes++;
+      }
+      last_dy = edge.y;
+    }
+    if (x_direction_changes > 2 || y_direction_changes > 2) {
+      return false;
+    }
+
+    if (last_edge.has_value() && !check_turn(last_edge.value(), edge)) {
+      return false;
+    }
+    if (!first_edge.has_value()) {
+      first_edge = edge;
+    }
+    last_edge = edge;
+  }
+
+  if (!first_edge.has_value() || winding == 0) {
+    // All points are coincident or collinear.
+    return false;
+  }
+  return check_turn(last_edge.value(), first_edge.value());
+}
+
 static int ToTessWindingRule(FillType fill_type) {
   switch (fill_type) {
     case FillType::kOdd:
@@ -64,6 +135,36 @@ Tessellator::Result Tessellator::Tessellate(
     return Result::kInputError;
   }
 
+  //----------------------------------------------------------------------------
+  /// Convex single contour fills (rects, rounded rects, circles, ...) don't
+  /// need the general triangulator. Fan out from the first point and hand the
+  /// polyline points to the callback directly.
+  ///
+  if (polyline.contours.size() == 1u &&
+      (fill_type == FillType::kNonZero || fill_type == FillType::kOdd)) {
+    auto point_count = polyline.points.size();
+    if (point_count > 1 && polyline.points.front() == polyline.points.back()) {
+      // Drop the closing point.
+      point_count--;
+    }
+    if (point_count <= std::numeric_limits<uint16_t>::max() &&
+        IsConvexPolygon(polyline.points.data(), point_count)) {
+      std::vector<uint16_t> indices;
+      indices.reserve((point_count - 2) * 3);
+      for (size_t i = 1; i < point_count - 1; i++) {
+        indices.push_back(0);
+        indices.push_back(static_cast<uint16_t>(i));
+        indices.push_back(static_cast<uint16_t>(i + 1));
+      }
+      static_assert(sizeof(Point) == 2 * sizeof(float));
+      if (!callback(reinterpret_cast<const float*>(polyline.points.data()),
+                    point_count * 2, indices.data(), indices.size())) {
+        return Result::kInputError;
+      }
+      return Result::kSuccess;
+    }
+  }
+
   auto tessellator = c_tessellator_.get();
   if (!tessellator) {
     return Result::kTessellationError;
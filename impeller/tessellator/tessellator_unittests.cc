@@ -83,5 +83,90 @@ TEST(TessellatorTest, TessellatorBuilderReturnsCorrectResultStatus) {
   }
 }
 
+TEST(TessellatorTest, ConvexContoursAreFannedWithoutTriangulation) {
+  Tessellator t;
+  auto check_fan = [&t](const Path& path) {
+    auto polyline = path.CreatePolyline();
+    const float* result_vertices = nullptr;
+    size_t result_vertices_size = 0u;
+    size_t result_indices_size = 0u;
+    Tessellator::Result result = t.Tessellate(
+        path.GetFillType(), polyline,
+        [&](const float* vertices, size_t vertices_size,
+            const uint16_t* indices, size_t indices_size) {
+          result_vertices = vertices;
+          result_vertices_size = vertices_size;
+          result_indices_size = indices_size;
+          return true;
+        });
+    ASSERT_EQ(result, Tessellator::Result::kSuccess);
+    // The polyline points are handed to the callback directly.
+    ASSERT_EQ(result_vertices,
+              reinterpret_cast<const float*>(polyline.points.data()));
+    auto vertex_count = result_vertices_size / 2;
+    ASSERT_GE(vertex_count, 3u);
+    ASSERT_EQ(result_indices_size, (vertex_count - 2) * 3);
+  };
+
+  check_fan(PathBuilder{}.AddRect(Rect::MakeXYWH(0, 0, 100, 100)).TakePath());
+  check_fan(PathBuilder{}
+                .AddRoundedRect(Rect::MakeXYWH(0, 0, 100, 100), 10)
+                .TakePath());
+  check_fan(PathBuilder{}.AddCircle({50, 50}, 20).TakePath());
+  check_fan(PathBuilder{}.AddOval(Rect::MakeXYWH(0, 0, 100, 50)).TakePath());
+  check_fan(PathBuilder{}
+                .MoveTo({0, 0})
+                .LineTo({10, 0})
+                .LineTo({5, 10})
+                .Close()
+                .TakePath(FillType::kOdd));
+}
+
+TEST(TessellatorTest, NonConvexContoursAreTriangulated) {
+  Tessellator t;
+  auto check_triangulated = [&t](const Path& path) {
+    auto polyline = path.CreatePolyline();
+    const float* result_vertices = nullptr;
+    Tessellator::Result result = t.Tessellate(
+        path.GetFillType(), polyline,
+        [&](const float* vertices, size_t vertices_size,
+            const uint16_t* indices, size_t indices_size) {
+          result_vertices = vertices;
+          return true;
+        });
+    ASSERT_EQ(result, Tessellator::Result::kSuccess);
+    ASSERT_NE(result_vertices,
+              reinterpret_cast<const float*>(polyline.points.data()));
+  };
+
+  // Concave.
+  check_triangulated(PathBuilder{}
+                         .MoveTo({0, 0})
+                         .LineTo({10, 0})
+                         .LineTo({5, 5})
+                         .LineTo({10, 10})
+                         .LineTo({0, 10})
+                         .Close()
+                         .TakePath());
+  // Self-intersecting pentagram. All turns have the same sign.
+  check_triangulated(PathBuilder{}
+                         .MoveTo({50, 0})
+                         .LineTo({79, 90})
+                         .LineTo({2, 35})
+                         .LineTo({98, 35})
+                         .LineTo({21, 90})
+                         .Close()
+                         .TakePath());
+  // Multiple contours.
+  check_triangulated(PathBuilder{}
+                         .AddRect(Rect::MakeXYWH(0, 0, 10, 10))
+                         .AddRect(Rect::MakeXYWH(20, 20, 10, 10))
+                         .TakePath());
+  // Winding dependent fill types.
+  check_triangulated(PathBuilder{}
+                         .AddRect(Rect::MakeXYWH(0, 0, 10, 10))
+                         .TakePath(FillType::kPositive));
+}
+
 }  // namespace testing
 }  // namespace impeller
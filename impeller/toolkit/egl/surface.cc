@@ -4,11 +4,45 @@
 
 #include "impeller/toolkit/egl/surface.h"
 
+#include <cstring>
+
 namespace impeller {
 namespace egl {
 
+static bool HasExtension(const char* extensions, const char* name) {
+  if (extensions == nullptr) {
+    return false;
+  }
+  const auto length = ::strlen(name);
+  for (const char* match = ::strstr(extensions, name); match != nullptr;
+       match = ::strstr(match + length, name)) {
+    const bool starts = match == extensions || match[-1] == ' ';
+    const bool ends = match[length] == ' ' || match[length] == '\0';
+    if (starts && ends) {
+      return true;
+    }
+  }
+  return false;
+}
+
 Surface::Surface(EGLDisplay display, EGLSurface surface)
-    : display_(display), surface_(surface) {}
+    : display_(display), surface_(surface) {
+  const char* extensions = ::eglQueryString(display_, EGL_EXTENSIONS);
+  if (!HasExtension(extensions, "EGL_KHR_partial_update")) {
+    return;
+  }
+  set_damage_region_ = reinterpret_cast<PFNEGLSETDAMAGEREGIONKHRPROC>(
+      ::eglGetProcAddress("eglSetDamageRegionKHR"));
+  if (HasExtension(extensions, "EGL_EXT_swap_buffers_with_damage")) {
+    swap_buffers_with_damage_ =
+        reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEEXTPROC>(
+            ::eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+  } else if (HasExtension(extensions, "EGL_KHR_swap_buffers_with_damage")) {
+    swap_buffers_with_damage_ =
+        reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEEXTPROC>(
+            ::eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+  }
+}
 
 Surface::~Surface() {
   if (surface_ != EGL_NO_SURFACE) {
@@ -34,5 +68,63 @@ bool Surface::Present() const {
   return result;
 }
 
+bool Surface::SupportsPartialUpdate() const {
+  return set_damage_region_ != nullptr && swap_buffers_with_damage_ != nullptr;
+}
+
+std::optional<EGLint> Surface::GetBufferAge() const {
+  if (!SupportsPartialUpdate()) {
+    return std::nullopt;
+  }
+  EGLint age = 0;
+  if (::eglQuerySurface(display_, surface_, EGL_BUFFER_AGE_KHR, &age) !=
+      EGL_TRUE) {
+    IMPELLER_LOG_EGL_ERROR;
+    return std::nullopt;
+  }
+  return age;
+}
+
+bool Surface::SetDamageRegion(const IRect& region) const {
+  if (!set_damage_region_) {
+    return false;
+  }
+  auto rect = ToEGLRect(region);
+  const auto result =
+      set_damage_region_(display_, surface_, rect.data(), 1) == EGL_TRUE;
+  if (!result) {
+    IMPELLER_LOG_EGL_ERROR;
+  }
+  return result;
+}
+
+bool Surface::Present(const std::vector<IRect>& damage) const {
+  if (!swap_buffers_with_damage_ || damage.empty()) {
+    return Present();
+  }
+  std::vector<EGLint> rects;
+  rects.reserve(damage.size() * 4);
+  for (const auto& rect : damage) {
+    auto egl_rect = ToEGLRect(rect);
+    rects.insert(rects.end(), egl_rect.begin(), egl_rect.end());
+  }
+  const auto result =
+      swap_buffers_with_damage_(display_, surface_, rects.data(),
+                                static_cast<EGLint>(damage.size())) == EGL_TRUE;
+  if (!result) {
+    IMPELLER_LOG_EGL_ERROR;
+  }
+  return result;
+}
+
+std::array<EGLint, 4> Surface::ToEGLRect(const IRect& rect) const {
+  EGLint height = 0;
+  ::eglQuerySurface(display_, surface_, EGL_HEIGHT, &height);
+  return {static_cast<EGLint>(rect.GetLeft()),
+          static_cast<EGLint>(height - rect.GetBottom()),
+          static_cast<EGLint>(rect.size.width),
+          static_cast<EGLint>(rect.size.height)};
+}
+
 }  // namespace egl
 }  // namespace impeller
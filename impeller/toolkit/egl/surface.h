@@ -4,7 +4,14 @@
 
 #pragma once
 
+#include <EGL/eglext.h>
+
+#include <array>
+#include <optional>
+#include <vector>
+
 #include "flutter/fml/macros.h"
+#include "impeller/geometry/rect.h"
 #include "impeller/toolkit/egl/egl.h"
 
 namespace impeller {
@@ -22,9 +29,39 @@ class Surface {
 
   bool Present() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the surface can be partially redrawn, which needs
+  ///             `EGL_KHR_partial_update` and swapping with damage.
+  ///
+  bool SupportsPartialUpdate() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The number of frames since the back buffer was last
+  ///             presented, or zero if its contents are undefined. Only
+  ///             available when partial updates are supported.
+  ///
+  std::optional<EGLint> GetBufferAge() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Tell the driver which part of the back buffer the next frame
+  ///             redraws. Must be called before rendering into the frame.
+  ///
+  bool SetDamageRegion(const IRect& region) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Present the back buffer, telling the compositor which parts
+  ///             of it changed since the previous frame.
+  ///
+  bool Present(const std::vector<IRect>& damage) const;
+
  private:
   EGLDisplay display_ = EGL_NO_DISPLAY;
   EGLSurface surface_ = EGL_NO_SURFACE;
+  PFNEGLSETDAMAGEREGIONKHRPROC set_damage_region_ = nullptr;
+  PFNEGLSWAPBUFFERSWITHDAMAGEEXTPROC swap_buffers_with_damage_ = nullptr;
+
+  // EGL rectangles have their origin in the bottom left corner.
+  std::array<EGLint, 4> ToEGLRect(const IRect& rect) const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(Surface);
 };
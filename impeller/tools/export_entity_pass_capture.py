@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+#
+# Copyright 2013 The Flutter Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+"""Prints or exports an archive written by impeller::EntityPassCapture.
+
+The text output lists the captured frames with the tree of entity passes that
+each frame rendered and the time spent encoding every pass. The JSON output
+contains the same data for other tools, along with the pipeline variants that
+each frame used for the first time.
+
+Usage:
+  export_entity_pass_capture.py capture.db
+  export_entity_pass_capture.py capture.db --slowest 10
+  export_entity_pass_capture.py capture.db --format json > capture.json
+"""
+
+import argparse
+import json
+import sqlite3
+import sys
+
+# The order of impeller::BlendMode.
+BLEND_MODES = [
+    'Clear', 'Source', 'Destination', 'SourceOver', 'DestinationOver',
+    'SourceIn', 'DestinationIn', 'SourceOut', 'DestinationOut', 'SourceATop',
+    'DestinationATop', 'Xor', 'Plus', 'Modulate', 'Screen', 'Overlay',
+    'Darken', 'Lighten', 'ColorDodge', 'ColorBurn', 'HardLight', 'SoftLight',
+    'Difference', 'Exclusion', 'Multiply', 'Hue', 'Saturation', 'Color',
+    'Luminosity'
+]
+
+
+def blend_mode_name(value):
+  if 0 <= value < len(BLEND_MODES):
+    return BLEND_MODES[value]
+  return str(value)
+
+
+def query(connection, statement):
+  try:
+    return connection.execute(statement).fetchall()
+  except sqlite3.OperationalError:
+    # The table is only created once a row of its kind is written.
+    return []
+
+
+def load_capture(path):
+  """Returns the captured frames, ordered by frame number."""
+  connection = sqlite3.connect(path)
+  frames = {}
+  for number, pass_count, duration_us in query(
+      connection, 'SELECT primary_key, pass_count, duration_us '
+      'FROM CapturedFrame ORDER BY primary_key'):
+    frames[number] = {
+        'number': number,
+        'pass_count': pass_count,
+        'duration_us': duration_us,
+        'passes': [],
+        'pipeline_variants': [],
+    }
+
+  passes = {}
+  for row in query(
+      connection, 'SELECT primary_key, frame, parent, depth, element_count, '
+      'blend_mode, stencil_depth, target_width, target_height, duration_us '
+      'FROM CapturedPass ORDER BY primary_key'):
+    (pass_id, frame, parent, depth, element_count, blend_mode, stencil_depth,
+     target_width, target_height, duration_us) = row
+    captured_pass = {
+        'id': pass_id,
+        'depth': depth,
+        'element_count': element_count,
+        'blend_mode': blend_mode_name(blend_mode),
+        'stencil_depth': stencil_depth,
+        'target_size': [target_width, target_height],
+        'duration_us': duration_us,
+        'subpasses': [],
+    }
+    passes[pass_id] = captured_pass
+    if parent in passes:
+      passes[parent]['subpasses'].append(captured_pass)
+    elif frame in frames:
+      frames[frame]['passes'].append(captured_pass)
+
+  for row in query(
+      connection, 'SELECT frame, pipeline, sample_count, blend_mode, '
+      'stencil_compare, stencil_operation, primitive_type '
+      'FROM CapturedPipelineVariant ORDER BY primary_key'):
+    (frame, pipeline, sample_count, blend_mode, stencil_compare,
+     stencil_operation, primitive_type) = row
+    if frame not in frames:
+      continue
+    frames[frame]['pipeline_variants'].append({
+        'pipeline': pipeline,
+        'sample_count': sample_count,
+        'blend_mode': blend_mode_name(blend_mode),
+        'stencil_compare': stencil_compare,
+        'stencil_operation': stencil_operation,
+        'primitive_type': primitive_type,
+    })
+
+  connection.close()
+  return [frames[number] for number in sorted(frames)]
+
+
+def print_pass(captured_pass, indent):
+  print(
+      '%s%s pass, %d elements, %dx%d, %d us' % (
+          '  ' * indent, captured_pass['blend_mode'],
+          captured_pass['element_count'], captured_pass['target_size'][0],
+          captured_pass['target_size'][1], captured_pass['duration_us']
+      )
+  )
+  for subpass in captured_pass['subpasses']:
+    print_pass(subpass, indent + 1)
+
+
+def print_frames(frames):
+  for frame in frames:
+    print(
+        'Frame %d: %d passes, %d us' %
+        (frame['number'], frame['pass_count'], frame['duration_us'])
+    )
+    for captured_pass in frame['passes']:
+      print_pass(captured_pass, 1)
+    for variant in frame['pipeline_variants']:
+      print('  New pipeline variant: %s (%s)' %
+            (variant['pipeline'], variant['blend_mode']))
+
+
+def main():
+  parser = argparse.ArgumentParser(
+      description='Prints or exports a capture of Impeller entity passes.'
+  )
+  parser.add_argument(
+      'capture', help='The archive written by impeller::EntityPassCapture.'
+  )
+  parser.add_argument(
+      '--format',
+      choices=['text', 'json'],
+      default='text',
+      help='Print a readable summary, or export the capture as JSON.'
+  )
+  parser.add_argument(
+      '--slowest',
+      type=int,
+      help='Only include this many frames, the slowest first.'
+  )
+  args = parser.parse_args()
+
+  frames = load_capture(args.capture)
+  if args.slowest is not None:
+    frames = sorted(frames, key=lambda frame: frame['duration_us'],
+                    reverse=True)[:args.slowest]
+
+  if args.format == 'json':
+    json.dump({'frames': frames}, sys.stdout, indent=2)
+    print()
+  else:
+    print_frames(frames)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -4,6 +4,7 @@
 
 #include "impeller/typographer/backends/skia/text_render_context_skia.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "flutter/fml/logging.h"
@@ -58,24 +59,25 @@ static FontGlyphPair::Vector CollectUniqueFontGlyphPairs(
   return vector;
 }
 
-static size_t PairsFitInAtlasOfSize(const FontGlyphPair::Vector& pairs,
-                                    const ISize& atlas_size,
-                                    std::vector<Rect>& glyph_positions) {
+static ISize GlyphSizeInAtlas(const FontGlyphPair& pair) {
+  return ISize::Ceil(pair.font.GetMetrics().GetBoundingBox().size *
+                     pair.font.GetMetrics().scale);
+}
+
+static size_t PairsFitInAtlasOfSize(
+    const FontGlyphPair::Vector& pairs,
+    const ISize& atlas_size,
+    std::vector<Rect>& glyph_positions,
+    const std::shared_ptr<GrRectanizer>& rect_packer) {
   if (atlas_size.IsEmpty()) {
     return false;
   }
 
-  auto rect_packer = std::unique_ptr<GrRectanizer>(
-      GrRectanizer::Factory(atlas_size.width, atlas_size.height));
-
   glyph_positions.clear();
   glyph_positions.reserve(pairs.size());
 
   for (size_t i = 0; i < pairs.size(); i++) {
-    const auto& pair = pairs[i];
-    const auto glyph_size =
-        ISize::Ceil(pair.font.GetMetrics().GetBoundingBox().size *
-                    pair.font.GetMetrics().scale);
+    const auto glyph_size = GlyphSizeInAtlas(pairs[i]);
     SkIPoint16 location_in_atlas;
     if (!rect_packer->addRect(glyph_size.width,   //
                               glyph_size.height,  //
@@ -93,20 +95,57 @@ static size_t PairsFitInAtlasOfSize(const FontGlyphPair::Vector& pairs,
   return 0;
 }
 
+static bool CanAppendToExistingAtlas(
+    const FontGlyphPair::Vector& extra_pairs,
+    std::vector<Rect>& glyph_positions,
+    const std::shared_ptr<GrRectanizer>& rect_packer) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (!rect_packer) {
+    return false;
+  }
+
+  glyph_positions.clear();
+  glyph_positions.reserve(extra_pairs.size());
+
+  for (const auto& pair : extra_pairs) {
+    const auto glyph_size = GlyphSizeInAtlas(pair);
+    SkIPoint16 location_in_atlas;
+    if (!rect_packer->addRect(glyph_size.width,   //
+                              glyph_size.height,  //
+                              &location_in_atlas  //
+                              )) {
+      return false;
+    }
+    glyph_positions.emplace_back(Rect::MakeXYWH(location_in_atlas.x(),  //
+                                                location_in_atlas.y(),  //
+                                                glyph_size.width,       //
+                                                glyph_size.height       //
+                                                ));
+  }
+
+  return true;
+}
+
 static ISize OptimumAtlasSizeForFontGlyphPairs(
     const FontGlyphPair::Vector& pairs,
-    std::vector<Rect>& glyph_positions) {
+    std::vector<Rect>& glyph_positions,
+    const std::shared_ptr<GlyphAtlasContext>& atlas_context,
+    ISize min_size) {
   static constexpr auto kMinAtlasSize = 8u;
   static constexpr auto kMaxAtlasSize = 4096u;
 
   TRACE_EVENT0("impeller", __FUNCTION__);
 
-  ISize current_size(kMinAtlasSize, kMinAtlasSize);
+  ISize current_size(std::max<ISize::Type>(kMinAtlasSize, min_size.width),
+                     std::max<ISize::Type>(kMinAtlasSize, min_size.height));
   size_t total_pairs = pairs.size() + 1;
   do {
-    auto remaining_pairs =
-        PairsFitInAtlasOfSize(pairs, current_size, glyph_positions);
+    auto rect_packer = std::shared_ptr<GrRectanizer>(
+        GrRectanizer::Factory(current_size.width, current_size.height));
+    auto remaining_pairs = PairsFitInAtlasOfSize(pairs, current_size,
+                                                 glyph_positions, rect_packer);
     if (remaining_pairs == 0) {
+      atlas_context->UpdateRectPacker(std::move(rect_packer));
       return current_size;
     } else if (remaining_pairs < std::ceil(total_pairs / 2)) {
       current_size = ISize::MakeWH(
@@ -123,6 +162,13 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
   return ISize{0, 0};
 }
 
+/// Cheaper than `hypot` as the coordinates can't overflow.
+static Scalar DistanceTo(uint16_t x, uint16_t y, TPoint<uint16_t> point) {
+  const int32_t dx = static_cast<int32_t>(x) - point.x;
+  const int32_t dy = static_cast<int32_t>(y) - point.y;
+  return std::sqrt(static_cast<Scalar>(dx * dx + dy * dy));
+}
+
 /// Compute signed-distance field for an 8-bpp grayscale image (values greater
 /// than 127 are considered "on") For details of this algorithm, see "The 'dead
 /// reckoning' signed distance transform" [Grevera 2004]
@@ -176,19 +222,19 @@ static void ConvertBitmapToSignedDistanceField(uint8_t* pixels,
     for (uint16_t x = 1; x < width - 2; ++x) {
       if (distance_map[(y - 1) * width + (x - 1)] + distDiag < distance(x, y)) {
         nearestpt(x, y) = nearestpt(x - 1, y - 1);
-        distance(x, y) = hypot(x - nearestpt(x, y).x, y - nearestpt(x, y).y);
+        distance(x, y) = DistanceTo(x, y, nearestpt(x, y));
       }
       if (distance(x, y - 1) + distUnit < distance(x, y)) {
         nearestpt(x, y) = nearestpt(x, y - 1);
-        distance(x, y) = hypot(x - nearestpt(x, y).x, y - nearestpt(x, y).y);
+        distance(x, y) = DistanceTo(x, y, nearestpt(x, y));
       }
       if (distance(x + 1, y - 1) + distDiag < distance(x, y)) {
         nearestpt(x, y) = nearestpt(x + 1, y - 1);
-        distance(x, y) = hypot(x - nearestpt(x, y).x, y - nearestpt(x, y).y);
+        distance(x, y) = DistanceTo(x, y, nearestpt(x, y));
       }
       if (distance(x - 1, y) + distUnit < distance(x, y)) {
         nearestpt(x, y) = nearestpt(x - 1, y);
-        distance(x, y) = hypot(x - nearestpt(x, y).x, y - nearestpt(x, y).y);
+        distance(x, y) = DistanceTo(x, y, nearestpt(x, y));
       }
     }
   }
@@ -198,19 +244,19 @@ static void ConvertBitmapToSignedDistanceField(uint8_t* pixels,
     for (uint16_t x = width - 2; x >= 1; --x) {
       if (distance(x + 1, y) + distUnit < distance(x, y)) {
         nearestpt(x, y) = nearestpt(x + 1, y);
-        distance(x, y) = hypot(x - nearestpt(x, y).x, y - nearestpt(x, y).y);
+        distance(x, y) = DistanceTo(x, y, nearestpt(x, y));
       }
       if (distance(x - 1, y + 1) + distDiag < distance(x, y)) {
         nearestpt(x, y) = nearestpt(x - 1, y + 1);
-        distance(x, y) = hypot(x - nearestpt(x, y).x, y - nearestpt(x, y).y);
+        distance(x, y) = DistanceTo(x, y, nearestpt(x, y));
       }
       if (distance(x, y + 1) + distUnit < distance(x, y)) {
         nearestpt(x, y) = nearestpt(x, y + 1);
-        distance(x, y) = hypot(x - nearestpt(x, y).x, y - nearestpt(x, y).y);
+        distance(x, y) = DistanceTo(x, y, nearestpt(x, y));
       }
       if (distance(x + 1, y + 1) + distDiag < distance(x, y)) {
         nearestpt(x, y) = nearestpt(x + 1, y + 1);
-        distance(x, y) = hypot(x - nearestpt(x, y).x, y - nearestpt(x, y).y);
+        distance(x, y) = DistanceTo(x, y, nearestpt(x, y));
       }
     }
   }
@@ -238,6 +284,56 @@ static void ConvertBitmapToSignedDistanceField(uint8_t* pixels,
 #undef nearestpt
 }
 
+static void DrawGlyph(SkCanvas* canvas,
+                      const FontGlyphPair& font_glyph,
+                      const Rect& location) {
+  const auto& metrics = font_glyph.font.GetMetrics();
+  const auto position = SkPoint::Make(location.origin.x / metrics.scale,
+                                      location.origin.y / metrics.scale);
+  SkGlyphID glyph_id = font_glyph.glyph.index;
+
+  SkFont sk_font(
+      TypefaceSkia::Cast(*font_glyph.font.GetTypeface()).GetSkiaTypeface(),
+      metrics.point_size);
+  auto glyph_color = SK_ColorWHITE;
+
+  SkPaint glyph_paint;
+  glyph_paint.setColor(glyph_color);
+  canvas->resetMatrix();
+  canvas->scale(metrics.scale, metrics.scale);
+  canvas->drawGlyphs(1u,         // count
+                     &glyph_id,  // glyphs
+                     &position,  // positions
+                     SkPoint::Make(-metrics.min_extent.x,
+                                   -metrics.ascent),  // origin
+                     sk_font,                         // font
+                     glyph_paint                      // paint
+  );
+}
+
+static bool UpdateAtlasBitmap(const GlyphAtlas& atlas,
+                              const std::shared_ptr<SkBitmap>& bitmap,
+                              const FontGlyphPair::Vector& new_pairs) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  auto surface = SkSurface::MakeRasterDirect(bitmap->pixmap());
+  if (!surface) {
+    return false;
+  }
+  auto canvas = surface->getCanvas();
+  if (!canvas) {
+    return false;
+  }
+
+  for (const auto& pair : new_pairs) {
+    auto pos = atlas.FindFontGlyphPosition(pair);
+    if (!pos.has_value()) {
+      continue;
+    }
+    DrawGlyph(canvas, pair, pos.value());
+  }
+  return true;
+}
+
 static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
                                                    const ISize& atlas_size) {
   TRACE_EVENT0("impeller", __FUNCTION__);
@@ -269,28 +365,7 @@ static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
 
   atlas.IterateGlyphs([canvas](const FontGlyphPair& font_glyph,
                                const Rect& location) -> bool {
-    const auto& metrics = font_glyph.font.GetMetrics();
-    const auto position = SkPoint::Make(location.origin.x / metrics.scale,
-                                        location.origin.y / metrics.scale);
-    SkGlyphID glyph_id = font_glyph.glyph.index;
-
-    SkFont sk_font(
-        TypefaceSkia::Cast(*font_glyph.font.GetTypeface()).GetSkiaTypeface(),
-        metrics.point_size);
-    auto glyph_color = SK_ColorWHITE;
-
-    SkPaint glyph_paint;
-    glyph_paint.setColor(glyph_color);
-    canvas->resetMatrix();
-    canvas->scale(metrics.scale, metrics.scale);
-    canvas->drawGlyphs(1u,         // count
-                       &glyph_id,  // glyphs
-                       &position,  // positions
-                       SkPoint::Make(-metrics.min_extent.x,
-                                     -metrics.ascent),  // origin
-                       sk_font,                         // font
-                       glyph_paint                      // paint
-    );
+    DrawGlyph(canvas, font_glyph, location);
     return true;
   });
 
@@ -344,6 +419,25 @@ bool UploadGlyphTextureAtlas(const std::shared_ptr<Texture>& texture,
   return true;
 }
 
+static bool UpdateGlyphTextureAtlas(std::shared_ptr<SkBitmap> bitmap,
+                                    const std::shared_ptr<Texture>& texture,
+                                    IRect region) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+
+  FML_DCHECK(bitmap != nullptr);
+  const auto& pixmap = bitmap->pixmap();
+  const auto* contents =
+      reinterpret_cast<const uint8_t*>(pixmap.addr(region.origin.x,  //
+                                                   region.origin.y   //
+                                                   ));
+  if (texture->SetContentsInRegion(contents, pixmap.rowBytes(), region)) {
+    return true;
+  }
+
+  // The backend doesn't support partial updates. Upload the whole bitmap.
+  return UploadGlyphTextureAtlas(texture, std::move(bitmap));
+}
+
 std::shared_ptr<GlyphAtlas> TextRenderContextSkia::CreateGlyphAtlas(
     GlyphAtlas::Type type,
     std::shared_ptr<GlyphAtlasContext> atlas_context,
@@ -372,15 +466,66 @@ std::shared_ptr<GlyphAtlas> TextRenderContextSkia::CreateGlyphAtlas(
     return last_atlas;
   }
 
+  // ---------------------------------------------------------------------------
+  // Step 3a: If the new glyphs fit into the free space of the current atlas,
+  //          rasterize only those glyphs into the retained bitmap and update
+  //          the affected region of the texture.
+  //
+  //          The signed distance field is computed over the entire bitmap so
+  //          these atlases are always rebuilt.
+  // ---------------------------------------------------------------------------
+  if (last_atlas->GetType() == type &&
+      type != GlyphAtlas::Type::kSignedDistanceField &&
+      last_atlas->IsValid() && atlas_context->GetBitmap()) {
+    FontGlyphPair::Vector new_glyphs;
+    for (const auto& pair : font_glyph_pairs) {
+      if (!last_atlas->FindFontGlyphPosition(pair).has_value()) {
+        new_glyphs.push_back(pair);
+      }
+    }
+
+    std::vector<Rect> new_positions;
+    if (CanAppendToExistingAtlas(new_glyphs, new_positions,
+                                 atlas_context->GetRectPacker())) {
+      Rect dirty_rect = new_positions[0];
+      for (size_t i = 0, count = new_positions.size(); i < count; i++) {
+        last_atlas->AddTypefaceGlyphPosition(new_glyphs[i], new_positions[i]);
+        dirty_rect = dirty_rect.Union(new_positions[i]);
+      }
+
+      auto bitmap = atlas_context->GetBitmap();
+      if (!UpdateAtlasBitmap(*last_atlas, bitmap, new_glyphs)) {
+        return nullptr;
+      }
+
+      const auto dirty_region = IRect::MakeXYWH(dirty_rect.origin.x,    //
+                                                dirty_rect.origin.y,    //
+                                                dirty_rect.size.width,  //
+                                                dirty_rect.size.height  //
+      );
+      if (!UpdateGlyphTextureAtlas(bitmap, last_atlas->GetTexture(),
+                                   dirty_region)) {
+        return nullptr;
+      }
+      return last_atlas;
+    }
+  }
+
   auto glyph_atlas = std::make_shared<GlyphAtlas>(type);
   atlas_context->UpdateGlyphAtlas(glyph_atlas);
 
   // ---------------------------------------------------------------------------
-  // Step 3: Get the optimum size of the texture atlas.
+  // Step 3b: Get the optimum size of the texture atlas. The atlas doesn't
+  //          shrink below the size of the last atlas of the same type so that
+  //          there is room to append glyphs in subsequent frames.
   // ---------------------------------------------------------------------------
+  ISize min_atlas_size;
+  if (last_atlas->GetType() == type && last_atlas->IsValid()) {
+    min_atlas_size = last_atlas->GetTexture()->GetSize();
+  }
   std::vector<Rect> glyph_positions;
-  const auto atlas_size =
-      OptimumAtlasSizeForFontGlyphPairs(font_glyph_pairs, glyph_positions);
+  const auto atlas_size = OptimumAtlasSizeForFontGlyphPairs(
+      font_glyph_pairs, glyph_positions, atlas_context, min_atlas_size);
   if (atlas_size.IsEmpty()) {
     return nullptr;
   }
@@ -410,16 +555,22 @@ std::shared_ptr<GlyphAtlas> TextRenderContextSkia::CreateGlyphAtlas(
   if (!bitmap) {
     return nullptr;
   }
+  atlas_context->UpdateBitmap(bitmap);
 
   // ---------------------------------------------------------------------------
   // Step 7: Upload the atlas as a texture.
   // ---------------------------------------------------------------------------
   PixelFormat format;
   switch (type) {
-    case GlyphAtlas::Type::kSignedDistanceField:
-      ConvertBitmapToSignedDistanceField(
-          reinterpret_cast<uint8_t*>(bitmap->getPixels()), atlas_size.width,
-          atlas_size.height);
+    case GlyphAtlas::Type::kSignedDistanceField: {
+      auto pixels = reinterpret_cast<uint8_t*>(bitmap->getPixels());
+      const auto& generator = atlas_context->GetSignedDistanceFieldGenerator();
+      if (!generator || !generator(pixels, atlas_size)) {
+        ConvertBitmapToSignedDistanceField(pixels, atlas_size.width,
+                                           atlas_size.height);
+      }
+    }
+      [[fallthrough]];
     case GlyphAtlas::Type::kAlphaBitmap:
       format = PixelFormat::kA8UNormInt;
       break;
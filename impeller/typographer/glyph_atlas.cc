@@ -4,8 +4,11 @@
 
 #include "impeller/typographer/glyph_atlas.h"
 
+#include <atomic>
 #include <utility>
 
+#include "third_party/skia/include/core/SkBitmap.h"
+
 namespace impeller {
 
 GlyphAtlasContext::GlyphAtlasContext()
@@ -21,7 +24,52 @@ void GlyphAtlasContext::UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas) {
   atlas_ = std::move(atlas);
 }
 
-GlyphAtlas::GlyphAtlas(Type type) : type_(type) {}
+std::shared_ptr<SkBitmap> GlyphAtlasContext::GetBitmap() const {
+  return bitmap_;
+}
+
+std::shared_ptr<GrRectanizer> GlyphAtlasContext::GetRectPacker() const {
+  return rect_packer_;
+}
+
+void GlyphAtlasContext::UpdateBitmap(std::shared_ptr<SkBitmap> bitmap) {
+  bitmap_ = std::move(bitmap);
+}
+
+void GlyphAtlasContext::UpdateRectPacker(
+    std::shared_ptr<GrRectanizer> rect_packer) {
+  rect_packer_ = std::move(rect_packer);
+}
+
+void GlyphAtlasContext::SetSignedDistanceFieldGenerator(
+    SignedDistanceFieldGenerator generator) {
+  sdf_generator_ = std::move(generator);
+}
+
+const GlyphAtlasContext::SignedDistanceFieldGenerator&
+GlyphAtlasContext::GetSignedDistanceFieldGenerator() const {
+  return sdf_generator_;
+}
+
+size_t GlyphAtlasContext::Reset() {
+  size_t released_bytes = 0;
+  if (atlas_ && atlas_->GetTexture()) {
+    const auto& descriptor = atlas_->GetTexture()->GetTextureDescriptor();
+    released_bytes += descriptor.GetByteSizeOfBaseMipLevel();
+  }
+  if (bitmap_) {
+    released_bytes += bitmap_->computeByteSize();
+  }
+  atlas_ = std::make_shared<GlyphAtlas>(GlyphAtlas::Type::kAlphaBitmap);
+  bitmap_.reset();
+  rect_packer_.reset();
+  return released_bytes;
+}
+
+static std::atomic<uint64_t> gNextGlyphAtlasGeneration = 1u;
+
+GlyphAtlas::GlyphAtlas(Type type)
+    : type_(type), generation_(gNextGlyphAtlasGeneration++) {}
 
 GlyphAtlas::~GlyphAtlas() = default;
 
@@ -33,6 +81,10 @@ GlyphAtlas::Type GlyphAtlas::GetType() const {
   return type_;
 }
 
+uint64_t GlyphAtlas::GetGeneration() const {
+  return generation_;
+}
+
 const std::shared_ptr<Texture>& GlyphAtlas::GetTexture() const {
   return texture_;
 }
@@ -15,6 +15,9 @@
 #include "impeller/renderer/texture.h"
 #include "impeller/typographer/font_glyph_pair.h"
 
+class SkBitmap;
+class GrRectanizer;
+
 namespace impeller {
 
 //------------------------------------------------------------------------------
@@ -63,6 +66,13 @@ class GlyphAtlas {
   ///
   Type GetType() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      A value unique to this atlas. Glyphs never move once their
+  ///             position is recorded, so data derived from the positions
+  ///             stays valid for as long as the generation is the same.
+  ///
+  uint64_t GetGeneration() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Set the texture for the glyph atlas.
   ///
@@ -128,6 +138,7 @@ class GlyphAtlas {
 
  private:
   const Type type_;
+  const uint64_t generation_;
   std::shared_ptr<Texture> texture_;
 
   std::unordered_map<FontGlyphPair,
@@ -144,6 +155,14 @@ class GlyphAtlas {
 ///
 class GlyphAtlasContext {
  public:
+  //----------------------------------------------------------------------------
+  /// @brief      Replaces the contents of a tightly packed 8-bit grayscale
+  ///             bitmap with its signed distance field. Returns false if the
+  ///             bitmap could not be converted.
+  ///
+  using SignedDistanceFieldGenerator =
+      std::function<bool(uint8_t* pixels, ISize size)>;
+
   GlyphAtlasContext();
 
   ~GlyphAtlasContext();
@@ -156,8 +175,52 @@ class GlyphAtlasContext {
   /// @brief      Update the context with a newly constructed glyph atlas.
   void UpdateGlyphAtlas(std::shared_ptr<GlyphAtlas> atlas);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Retrieve the host copy of the current atlas texture. New
+  ///             glyphs are rasterized into this bitmap so that existing
+  ///             glyphs don't need to be redrawn.
+  std::shared_ptr<SkBitmap> GetBitmap() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Retrieve the rect packer that tracks the free space in the
+  ///             current atlas texture.
+  std::shared_ptr<GrRectanizer> GetRectPacker() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Update the context with the bitmap of a newly constructed
+  ///             glyph atlas.
+  void UpdateBitmap(std::shared_ptr<SkBitmap> bitmap);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Update the context with the rect packer of a newly
+  ///             constructed glyph atlas.
+  void UpdateRectPacker(std::shared_ptr<GrRectanizer> rect_packer);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Set a generator for signed distance field atlases to use
+  ///             instead of the default CPU implementation. The CPU
+  ///             implementation is still used if the generator fails.
+  void SetSignedDistanceFieldGenerator(SignedDistanceFieldGenerator generator);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Retrieve the generator for signed distance field atlases, if
+  ///             one was set.
+  const SignedDistanceFieldGenerator& GetSignedDistanceFieldGenerator() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drop the current atlas along with its host copy so that the
+  ///             next atlas is built from scratch at its optimum size.
+  ///
+  /// @return     The number of bytes of texture and bitmap memory that were
+  ///             released by this context.
+  ///
+  size_t Reset();
+
  private:
   std::shared_ptr<GlyphAtlas> atlas_;
+  std::shared_ptr<SkBitmap> bitmap_;
+  std::shared_ptr<GrRectanizer> rect_packer_;
+  SignedDistanceFieldGenerator sdf_generator_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(GlyphAtlasContext);
 };
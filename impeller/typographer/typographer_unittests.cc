@@ -48,6 +48,34 @@ TEST_P(TypographerTest, CanCreateGlyphAtlas) {
   OpenPlaygroundHere([](RenderTarget&) { return true; });
 }
 
+TEST_P(TypographerTest, GlyphAtlasContextCanBeReset) {
+  auto context = TextRenderContext::Create(GetContext());
+  auto atlas_context = std::make_shared<GlyphAtlasContext>();
+  ASSERT_TRUE(context && context->IsValid());
+  SkFont sk_font;
+  auto blob = SkTextBlob::MakeFromString("hello", sk_font);
+  ASSERT_TRUE(blob);
+  auto atlas =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob));
+  ASSERT_NE(atlas, nullptr);
+  ASSERT_NE(atlas->GetTexture(), nullptr);
+
+  ASSERT_GE(atlas_context->Reset(), atlas->GetTexture()
+                                        ->GetTextureDescriptor()
+                                        .GetByteSizeOfBaseMipLevel());
+  ASSERT_NE(atlas_context->GetGlyphAtlas(), atlas);
+  ASSERT_EQ(atlas_context->GetGlyphAtlas()->GetTexture(), nullptr);
+  ASSERT_EQ(atlas_context->GetBitmap(), nullptr);
+  ASSERT_EQ(atlas_context->Reset(), 0u);
+
+  auto next_atlas =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob));
+  ASSERT_NE(next_atlas, nullptr);
+  ASSERT_NE(next_atlas, atlas);
+}
+
 static sk_sp<SkData> OpenFixtureAsSkData(const char* fixture_name) {
   auto mapping = flutter::testing::OpenFixtureAsMapping(fixture_name);
   if (!mapping) {
@@ -137,6 +165,32 @@ TEST_P(TypographerTest, GlyphAtlasIsRecycledIfUnchanged) {
   ASSERT_EQ(atlas_context->GetGlyphAtlas(), atlas);
 }
 
+TEST_P(TypographerTest, GlyphAtlasGenerationIsKeptWhileRecycled) {
+  auto context = TextRenderContext::Create(GetContext());
+  auto atlas_context = std::make_shared<GlyphAtlasContext>();
+  ASSERT_TRUE(context && context->IsValid());
+  SkFont sk_font;
+  auto blob = SkTextBlob::MakeFromString("spooky skellingtons", sk_font);
+  ASSERT_TRUE(blob);
+  auto atlas =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob));
+  ASSERT_NE(atlas, nullptr);
+  auto generation = atlas->GetGeneration();
+
+  auto next_atlas =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob));
+  ASSERT_EQ(next_atlas->GetGeneration(), generation);
+
+  // Atlases that are created from scratch never reuse a generation.
+  auto color_atlas = context->CreateGlyphAtlas(
+      GlyphAtlas::Type::kColorBitmap, std::make_shared<GlyphAtlasContext>(),
+      TextFrameFromTextBlob(blob));
+  ASSERT_NE(color_atlas, nullptr);
+  ASSERT_NE(color_atlas->GetGeneration(), generation);
+}
+
 TEST_P(TypographerTest, GlyphAtlasTextureIsRecycledIfUnchanged) {
   auto context = TextRenderContext::Create(GetContext());
   auto atlas_context = std::make_shared<GlyphAtlasContext>();
@@ -152,6 +206,7 @@ TEST_P(TypographerTest, GlyphAtlasTextureIsRecycledIfUnchanged) {
   ASSERT_EQ(atlas, atlas_context->GetGlyphAtlas());
 
   auto* first_texture = atlas->GetTexture().get();
+  auto first_glyph_count = atlas->GetGlyphCount();
 
   // now create a new glyph atlas with a nearly identical blob.
 
@@ -159,12 +214,46 @@ TEST_P(TypographerTest, GlyphAtlasTextureIsRecycledIfUnchanged) {
   auto next_atlas =
       context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
                                 TextFrameFromTextBlob(blob2));
-  ASSERT_NE(atlas, next_atlas);
+  ASSERT_NE(next_atlas, nullptr);
+  ASSERT_EQ(next_atlas->GetGlyphCount(), first_glyph_count + 1);
   auto* second_texture = next_atlas->GetTexture().get();
 
   ASSERT_EQ(second_texture, first_texture);
 }
 
+TEST_P(TypographerTest, GlyphAtlasAppendsNewGlyphsIntoFreeSpace) {
+  auto context = TextRenderContext::Create(GetContext());
+  auto atlas_context = std::make_shared<GlyphAtlasContext>();
+  ASSERT_TRUE(context && context->IsValid());
+  SkFont sk_font;
+  auto blob = SkTextBlob::MakeFromString("spooky skellingtons", sk_font);
+  ASSERT_TRUE(blob);
+  auto atlas =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob));
+  ASSERT_NE(atlas, nullptr);
+  ASSERT_NE(atlas->GetTexture(), nullptr);
+
+  // Either appended to the first atlas or repacked into a texture of at least
+  // the same size. Both leave room for another glyph.
+  auto blob_a = SkTextBlob::MakeFromString("a", sk_font);
+  auto atlas_a =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob_a));
+  ASSERT_NE(atlas_a, nullptr);
+  ASSERT_EQ(atlas_a->GetTexture()->GetSize(), atlas->GetTexture()->GetSize());
+  auto* texture = atlas_a->GetTexture().get();
+  auto glyph_count = atlas_a->GetGlyphCount();
+
+  auto blob_b = SkTextBlob::MakeFromString("b", sk_font);
+  auto atlas_b =
+      context->CreateGlyphAtlas(GlyphAtlas::Type::kAlphaBitmap, atlas_context,
+                                TextFrameFromTextBlob(blob_b));
+  ASSERT_EQ(atlas_b, atlas_a);
+  ASSERT_EQ(atlas_b->GetTexture().get(), texture);
+  ASSERT_EQ(atlas_b->GetGlyphCount(), glyph_count + 1);
+}
+
 TEST_P(TypographerTest, GlyphAtlasWithLotsOfdUniqueGlyphSize) {
   auto context = TextRenderContext::Create(GetContext());
   auto atlas_context = std::make_shared<GlyphAtlasContext>();
@@ -129,12 +129,10 @@ typedef CanvasPath Path;
 //   trying to resolve, an exception will be thrown.
 #define FFI_METHOD_LIST(V)                             \
   V(Canvas, clipPath, 3)                               \
-  V(Canvas, clipRect, 7)                               \
   V(Canvas, clipRRect, 3)                              \
   V(Canvas, drawArc, 10)                               \
   V(Canvas, drawAtlas, 10)                             \
   V(Canvas, drawCircle, 6)                             \
-  V(Canvas, drawColor, 3)                              \
   V(Canvas, drawDRRect, 5)                             \
   V(Canvas, drawImage, 7)                              \
   V(Canvas, drawImageNine, 13)                         \
@@ -153,16 +151,13 @@ typedef CanvasPath Path;
   V(Canvas, getLocalClipBounds, 2)                     \
   V(Canvas, getSaveCount, 1)                           \
   V(Canvas, getTransform, 2)                           \
-  V(Canvas, restore, 1)                                \
+  V(Canvas, recordCommands, 3)                         \
   V(Canvas, restoreToCount, 2)                         \
   V(Canvas, rotate, 2)                                 \
-  V(Canvas, save, 1)                                   \
   V(Canvas, saveLayer, 7)                              \
   V(Canvas, saveLayerWithoutBounds, 3)                 \
-  V(Canvas, scale, 3)                                  \
   V(Canvas, skew, 3)                                   \
   V(Canvas, transform, 2)                              \
-  V(Canvas, translate, 3)                              \
   V(Codec, dispose, 1)                                 \
   V(Codec, frameCount, 1)                              \
   V(Codec, getNextFrame, 2)                            \
@@ -187,7 +182,7 @@ typedef CanvasPath Path;
   V(ImageDescriptor, bytesPerPixel, 1)                 \
   V(ImageDescriptor, dispose, 1)                       \
   V(ImageDescriptor, height, 1)                        \
-  V(ImageDescriptor, instantiateCodec, 4)              \
+  V(ImageDescriptor, instantiateCodec, 5)              \
   V(ImageDescriptor, width, 1)                         \
   V(ImageFilter, initBlur, 4)                          \
   V(ImageFilter, initDilate, 3)                        \
@@ -216,6 +211,7 @@ typedef CanvasPath Path;
   V(Paragraph, height, 1)                              \
   V(Paragraph, ideographicBaseline, 1)                 \
   V(Paragraph, layout, 2)                              \
+  V(Paragraph, layoutAsync, 3)                         \
   V(Paragraph, longestLine, 1)                         \
   V(Paragraph, maxIntrinsicWidth, 1)                   \
   V(Paragraph, minIntrinsicWidth, 1)                   \
@@ -225,6 +221,7 @@ typedef CanvasPath Path;
   V(PathMeasure, getLength, 2)                         \
   V(PathMeasure, getPosTan, 3)                         \
   V(PathMeasure, getSegment, 6)                        \
+  V(PathMeasure, getSegments, 5)                       \
   V(PathMeasure, isClosed, 2)                          \
   V(PathMeasure, nextContour, 1)                       \
   V(Path, addArc, 7)                                   \
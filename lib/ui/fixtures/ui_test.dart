@@ -267,6 +267,15 @@ void platformMessagePortResponseTest() async {
   }
 }
 
+@pragma('vm:entry-point')
+void platformMessagePortLargeResponseTest() async {
+  ReceivePort receivePort = ReceivePort();
+  _callPlatformMessageResponseDartPort(receivePort.sendPort.nativePort);
+  List<dynamic> resultList = await receivePort.first;
+  Uint8List? bytes = resultList[1] as Uint8List?;
+  _finishCallResponse(bytes != null && bytes.lengthInBytes == 2000);
+}
+
 @pragma('vm:entry-point')
 void platformMessageResponseTest() {
   _callPlatformMessageResponseDart((ByteData? result) {
@@ -396,6 +405,22 @@ void convertPaintToDlPaint() {
 @pragma('vm:external-name',  'ConvertPaintToDlPaint')
 external void _convertPaintToDlPaint(Paint paint);
 
+@pragma('vm:entry-point')
+void cacheDlPaints() {
+  final Paint paint = Paint()..color = const Color(0xFF112233);
+  _cacheDlPaint(paint);
+  _cacheDlPaint(paint);
+  paint.color = const Color(0xFF445566);
+  _cacheDlPaint(paint);
+  _cacheDlPaint(Paint());
+  _cacheDlPaint(paint);
+  _finishCacheDlPaints();
+}
+@pragma('vm:external-name', 'CacheDlPaint')
+external void _cacheDlPaint(Paint paint);
+@pragma('vm:external-name', 'FinishCacheDlPaints')
+external void _finishCacheDlPaints();
+
 @pragma('vm:entry-point')
 void hooksTests() async {
   Future<void> test(String name, FutureOr<void> Function() testFunction) async {
@@ -1041,3 +1066,98 @@ external void _callHook(
   Object? arg19,
   Object? arg20,
 ]);
+
+// The entrypoints below are run by ui_benchmarks.cc. Each performs `count`
+// operations, so that the time to enter the isolate is amortized.
+
+@pragma('vm:entry-point')
+void benchmarkCanvasRecording(int count) {
+  final PictureRecorder recorder = PictureRecorder();
+  final Canvas canvas = Canvas(recorder);
+  final Paint paint = Paint()..color = const Color(0xFF2196F3);
+  for (int i = 0; i < count; i++) {
+    final double offset = (i % 100).toDouble();
+    canvas.save();
+    canvas.translate(offset, offset);
+    canvas.drawRect(const Rect.fromLTWH(0, 0, 10, 10), paint);
+    canvas.drawCircle(const Offset(5, 5), 5, paint);
+    canvas.restore();
+  }
+  recorder.endRecording().dispose();
+}
+
+@pragma('vm:entry-point')
+void benchmarkPaintDecode(int count) {
+  final PictureRecorder recorder = PictureRecorder();
+  final Canvas canvas = Canvas(recorder);
+  // Sets most of the fields of the paint, so that all of them are decoded
+  // for every draw call.
+  final Paint paint = Paint()
+    ..color = const Color(0x802196F3)
+    ..blendMode = BlendMode.multiply
+    ..style = PaintingStyle.stroke
+    ..strokeWidth = 2
+    ..strokeCap = StrokeCap.round
+    ..strokeJoin = StrokeJoin.bevel
+    ..isAntiAlias = true
+    ..maskFilter = const MaskFilter.blur(BlurStyle.normal, 2)
+    ..colorFilter = const ColorFilter.mode(Color(0xFF00FF00), BlendMode.srcIn)
+    ..shader = Gradient.linear(
+      Offset.zero,
+      const Offset(10, 10),
+      const <Color>[Color(0xFF000000), Color(0xFFFFFFFF)],
+    );
+  for (int i = 0; i < count; i++) {
+    canvas.drawLine(Offset.zero, const Offset(10, 10), paint);
+  }
+  recorder.endRecording().dispose();
+}
+
+@pragma('vm:entry-point')
+void benchmarkPathBuilding(int count) {
+  for (int i = 0; i < count; i++) {
+    final Path path = Path()
+      ..moveTo(0, 0)
+      ..lineTo(10, 0)
+      ..quadraticBezierTo(15, 5, 10, 10)
+      ..cubicTo(8, 12, 2, 12, 0, 10)
+      ..addRect(const Rect.fromLTWH(2, 2, 4, 4))
+      ..close();
+    path.getBounds();
+  }
+}
+
+@pragma('vm:entry-point')
+void benchmarkSceneBuilderPushPop(int count) {
+  // Building the scene needs the window of a platform configuration, which
+  // the benchmark isolates do not have, so only the layer stack is measured.
+  final SceneBuilder builder = SceneBuilder();
+  for (int i = 0; i < count; i++) {
+    builder.pushOffset(1, 1);
+    builder.pushClipRect(const Rect.fromLTWH(0, 0, 100, 100));
+    builder.pushOpacity(128);
+    builder.pop();
+    builder.pop();
+    builder.pop();
+  }
+}
+
+ImmutableBuffer? _benchmarkImageBuffer;
+
+@pragma('vm:entry-point')
+Future<void> prepareImageDescriptorBenchmark() async {
+  _benchmarkImageBuffer =
+      await ImmutableBuffer.fromUint8List(Uint8List(64 * 64 * 4));
+}
+
+@pragma('vm:entry-point')
+void benchmarkImageDescriptorCreation(int count) {
+  for (int i = 0; i < count; i++) {
+    ImageDescriptor.raw(
+      _benchmarkImageBuffer!,
+      width: 64,
+      height: 64,
+      pixelFormat: PixelFormat.rgba8888,
+    ).dispose();
+  }
+}
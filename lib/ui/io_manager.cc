@@ -10,4 +10,8 @@ std::shared_ptr<impeller::Context> IOManager::GetImpellerContext() const {
   return nullptr;
 }
 
+fml::RefPtr<TextureUploadQueue> IOManager::GetTextureUploadQueue() const {
+  return nullptr;
+}
+
 }  // namespace flutter
@@ -8,6 +8,7 @@
 #include "flutter/flow/skia_gpu_object.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/synchronization/sync_switch.h"
+#include "flutter/lib/ui/painting/texture_upload_queue.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 
 namespace impeller {
@@ -32,6 +33,10 @@ class IOManager {
   GetIsGpuDisabledSyncSwitch() = 0;
 
   virtual std::shared_ptr<impeller::Context> GetImpellerContext() const;
+
+  // The queue that schedules the texture uploads of decoded images, or null
+  // if images are uploaded as soon as they are decoded.
+  virtual fml::RefPtr<TextureUploadQueue> GetTextureUploadQueue() const;
 };
 
 }  // namespace flutter
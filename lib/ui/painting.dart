@@ -1130,6 +1130,7 @@ class Paint {
   static const int _kMaskFilterSigmaIndex = 11;
   static const int _kInvertColorIndex = 12;
   static const int _kDitherIndex = 13;
+  static const int _kVersionIndex = 14;
 
   static const int _kIsAntiAliasOffset = _kIsAntiAliasIndex << 2;
   static const int _kColorOffset = _kColorIndex << 2;
@@ -1145,8 +1146,28 @@ class Paint {
   static const int _kMaskFilterSigmaOffset = _kMaskFilterSigmaIndex << 2;
   static const int _kInvertColorOffset = _kInvertColorIndex << 2;
   static const int _kDitherOffset = _kDitherIndex << 2;
+  static const int _kVersionOffset = _kVersionIndex << 2;
   // If you add more fields, remember to update _kDataByteCount.
-  static const int _kDataByteCount = 56;
+  static const int _kDataByteCount = 60;
+
+  // Every change of a paint stores a new version in its data so that the
+  // engine can reuse what it decoded the last time the paint was drawn.
+  // Paints that never changed and paints with a [FragmentShader], whose
+  // uniforms can change without changing the paint, have the version zero
+  // and are decoded on every draw.
+  static int _lastVersion = 0;
+
+  void _updateVersion() {
+    int version = 0;
+    if (_objects?[_kShaderIndex] is! FragmentShader) {
+      _lastVersion = (_lastVersion + 1) & 0xFFFFFFFF;
+      if (_lastVersion == 0) {
+        _lastVersion = 1;
+      }
+      version = _lastVersion;
+    }
+    _data.setUint32(_kVersionOffset, version, _kFakeHostEndian);
+  }
 
   // Binary format must match the deserialization code in paint.cc.
   // C++ unit tests access this.
@@ -1157,6 +1178,16 @@ class Paint {
     return _objects ??= List<Object?>.filled(_kObjectCount, null);
   }
 
+  // Whether the paint has a shader, color filter or image filter, which
+  // cannot be encoded into the batched commands of a [Canvas].
+  bool get _hasObjects {
+    final List<Object?>? objects = _objects;
+    return objects != null &&
+        (objects[_kShaderIndex] != null ||
+         objects[_kColorFilterIndex] != null ||
+         objects[_kImageFilterIndex] != null);
+  }
+
   static const int _kShaderIndex = 0;
   static const int _kColorFilterIndex = 1;
   static const int _kImageFilterIndex = 2;
@@ -1174,6 +1205,7 @@ class Paint {
     // we always encode as zero, is true.
     final int encoded = value ? 0 : 1;
     _data.setInt32(_kIsAntiAliasOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   // Must be kept in sync with the default in paint.cc.
@@ -1199,6 +1231,7 @@ class Paint {
     assert(value != null);
     final int encoded = value.value ^ _kColorDefault;
     _data.setInt32(_kColorOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   // Must be kept in sync with the default in paint.cc.
@@ -1230,6 +1263,7 @@ class Paint {
     assert(value != null);
     final int encoded = value.index ^ _kBlendModeDefault;
     _data.setInt32(_kBlendModeOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   /// Whether to paint inside shapes, the edges of shapes, or both.
@@ -1242,6 +1276,7 @@ class Paint {
     assert(value != null);
     final int encoded = value.index;
     _data.setInt32(_kStyleOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   /// How wide to make edges drawn when [style] is set to
@@ -1256,6 +1291,7 @@ class Paint {
     assert(value != null);
     final double encoded = value;
     _data.setFloat32(_kStrokeWidthOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   /// The kind of finish to place on the end of lines drawn when
@@ -1269,6 +1305,7 @@ class Paint {
     assert(value != null);
     final int encoded = value.index;
     _data.setInt32(_kStrokeCapOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   /// The kind of finish to place on the joins between segments.
@@ -1303,6 +1340,7 @@ class Paint {
     assert(value != null);
     final int encoded = value.index;
     _data.setInt32(_kStrokeJoinOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   // Must be kept in sync with the default in paint.cc.
@@ -1341,6 +1379,7 @@ class Paint {
     assert(value != null);
     final double encoded = value - _kStrokeMiterLimitDefault;
     _data.setFloat32(_kStrokeMiterLimitOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   /// A mask filter (for example, a blur) to apply to a shape after it has been
@@ -1371,6 +1410,7 @@ class Paint {
       _data.setInt32(_kMaskFilterBlurStyleOffset, value._style.index, _kFakeHostEndian);
       _data.setFloat32(_kMaskFilterSigmaOffset, value._sigma, _kFakeHostEndian);
     }
+    _updateVersion();
   }
 
   /// Controls the performance vs quality trade-off to use when sampling bitmaps,
@@ -1386,6 +1426,7 @@ class Paint {
     assert(value != null);
     final int encoded = value.index;
     _data.setInt32(_kFilterQualityOffset, encoded, _kFakeHostEndian);
+    _updateVersion();
   }
 
   /// The shader to use when stroking or filling a shape.
@@ -1418,6 +1459,7 @@ class Paint {
       return true;
     }());
     _ensureObjectsInitialized()[_kShaderIndex] = value;
+    _updateVersion();
   }
 
   /// A color filter to apply when a shape is drawn or when a layer is
@@ -1439,6 +1481,7 @@ class Paint {
     } else {
       _ensureObjectsInitialized()[_kColorFilterIndex] = nativeFilter;
     }
+    _updateVersion();
   }
 
   /// The [ImageFilter] to use when drawing raster images.
@@ -1475,6 +1518,7 @@ class Paint {
         objects[_kImageFilterIndex] = value._toNativeImageFilter();
       }
     }
+    _updateVersion();
   }
 
   /// Whether the colors of the image are inverted when drawn.
@@ -1487,6 +1531,7 @@ class Paint {
   }
   set invertColors(bool value) {
     _data.setInt32(_kInvertColorOffset, value ? 1 : 0, _kFakeHostEndian);
+    _updateVersion();
   }
 
   bool get _dither {
@@ -1494,6 +1539,7 @@ class Paint {
   }
   set _dither(bool value) {
     _data.setInt32(_kDitherOffset, value ? 1 : 0, _kFakeHostEndian);
+    _updateVersion();
   }
 
   /// Whether to dither the output when drawing images.
@@ -3000,6 +3046,22 @@ class PathMetric {
     return _measure.extractPath(contourIndex, start, end, startWithMoveTo: startWithMoveTo);
   }
 
+  /// Return a single path containing the segments between each pair of
+  /// distances in `startAndEndDistances`.
+  ///
+  /// The list holds the start of the first segment, followed by its end,
+  /// then the start of the second segment, and so on. This is equivalent to
+  /// adding the result of [extractPath] for every pair to one path, but
+  /// extracts all the segments at once, which is faster when there are many
+  /// of them, for example for the dashes of a dashed line.
+  ///
+  /// The distances are clamped to legal values (0..[length]). Each segment
+  /// begins with a moveTo if `startWithMoveTo` is true.
+  Path extractPathSegments(List<double> startAndEndDistances, {bool startWithMoveTo = true}) {
+    assert(startAndEndDistances.length.isEven, 'Every segment needs a start and an end distance.');
+    return _measure.extractPathSegments(contourIndex, startAndEndDistances, startWithMoveTo: startWithMoveTo);
+  }
+
   @override
   String toString() => '$runtimeType{length: $length, isClosed: $isClosed, contourIndex:$contourIndex}';
 }
@@ -3049,6 +3111,17 @@ class _PathMeasure extends NativeFieldWrapperClass1 {
   @FfiNative<Void Function(Pointer<Void>, Handle, Int32, Float, Float, Bool)>('PathMeasure::getSegment')
   external void _extractPath(Path outPath, int contourIndex, double start, double end, bool startWithMoveTo);
 
+  Path extractPathSegments(int contourIndex, List<double> startAndEndDistances,
+      {bool startWithMoveTo = true}) {
+    assert(contourIndex <= currentContourIndex, 'Iterator must be advanced before index $contourIndex can be used.');
+    final Path path = Path._();
+    _extractPathSegments(path, contourIndex, Float32List.fromList(startAndEndDistances), startWithMoveTo);
+    return path;
+  }
+
+  @FfiNative<Void Function(Pointer<Void>, Handle, Int32, Handle, Bool)>('PathMeasure::getSegments')
+  external void _extractPathSegments(Path outPath, int contourIndex, Float32List startAndEndDistances, bool startWithMoveTo);
+
   bool isClosed(int contourIndex) {
     assert(contourIndex <= currentContourIndex, 'Iterator must be advanced before index $contourIndex can be used.');
     return _isClosed(contourIndex);
@@ -4554,6 +4627,97 @@ class Canvas extends NativeFieldWrapperClass1 {
   // garbage collected until PictureRecorder.endRecording is called.
   PictureRecorder? _recorder;
 
+  // Commands that only take numbers and paints without any objects are
+  // encoded into a buffer instead of making a native call each, and the whole
+  // buffer is recorded with a single native call. The buffer is flushed when
+  // it is full, before any other native call on this canvas, and when the
+  // recording ends.
+  //
+  // The command values and their encoding must match CanvasCommand in
+  // canvas.cc. Each command is a 32 bit word followed by the paint data for
+  // draw commands and then by the arguments of the command.
+  static const int _kCommandSave = 0;
+  static const int _kCommandRestore = 1;
+  static const int _kCommandTranslate = 2;
+  static const int _kCommandScale = 3;
+  static const int _kCommandClipRect = 4;
+  static const int _kCommandDrawColor = 5;
+  static const int _kCommandDrawLine = 6;
+  static const int _kCommandDrawPaint = 7;
+  static const int _kCommandDrawRect = 8;
+  static const int _kCommandDrawRRect = 9;
+  static const int _kCommandDrawDRRect = 10;
+  static const int _kCommandDrawOval = 11;
+  static const int _kCommandDrawCircle = 12;
+
+  static const int _kCommandBufferByteCount = 8192;
+  static const int _kPaintWordCount = Paint._kDataByteCount >> 2;
+
+  ByteData? _commandData;
+  Uint32List? _commandWords;
+  Float32List? _commandFloats;
+  int _commandWordCount = 0;
+
+  // Appends `command` followed by `argumentWordCount` words for its arguments
+  // and returns the index of the first argument word.
+  int _addCommand(int command, int argumentWordCount) {
+    Uint32List? commandWords = _commandWords;
+    if (commandWords == null) {
+      final ByteData commandData = ByteData(_kCommandBufferByteCount);
+      _commandData = commandData;
+      commandWords = _commandWords = commandData.buffer.asUint32List();
+      _commandFloats = commandData.buffer.asFloat32List();
+    } else if (_commandWordCount + 1 + argumentWordCount > commandWords.length) {
+      _flushCommands();
+    }
+    final int index = _commandWordCount;
+    commandWords[index] = command;
+    _commandWordCount = index + 1 + argumentWordCount;
+    return index + 1;
+  }
+
+  // Like [_addCommand] for draw commands, which copy the data of `paint`
+  // before their arguments because the paint may change before the commands
+  // are flushed. Returns the index of the first argument word after the
+  // paint data.
+  int _addPaintCommand(int command, int argumentWordCount, Paint paint) {
+    final int index = _addCommand(command, _kPaintWordCount + argumentWordCount);
+    final Uint32List commandWords = _commandWords!;
+    final ByteData paintData = paint._data;
+    for (int i = 0; i < _kPaintWordCount; i++) {
+      commandWords[index + i] = paintData.getUint32(i << 2, _kFakeHostEndian);
+    }
+    return index + _kPaintWordCount;
+  }
+
+  void _addRRect(int index, RRect rrect) {
+    final Float32List commandFloats = _commandFloats!;
+    commandFloats[index] = rrect.left;
+    commandFloats[index + 1] = rrect.top;
+    commandFloats[index + 2] = rrect.right;
+    commandFloats[index + 3] = rrect.bottom;
+    commandFloats[index + 4] = rrect.tlRadiusX;
+    commandFloats[index + 5] = rrect.tlRadiusY;
+    commandFloats[index + 6] = rrect.trRadiusX;
+    commandFloats[index + 7] = rrect.trRadiusY;
+    commandFloats[index + 8] = rrect.brRadiusX;
+    commandFloats[index + 9] = rrect.brRadiusY;
+    commandFloats[index + 10] = rrect.blRadiusX;
+    commandFloats[index + 11] = rrect.blRadiusY;
+  }
+
+  void _flushCommands() {
+    final int wordCount = _commandWordCount;
+    if (wordCount == 0) {
+      return;
+    }
+    _commandWordCount = 0;
+    _recordCommands(_commandData!, wordCount << 2);
+  }
+
+  @FfiNative<Void Function(Pointer<Void>, Handle, Int32)>('Canvas::recordCommands')
+  external void _recordCommands(ByteData commands, int length);
+
   /// Saves a copy of the current transform and clip on the save stack.
   ///
   /// Call [restore] to pop the save stack.
@@ -4562,8 +4726,9 @@ class Canvas extends NativeFieldWrapperClass1 {
   ///
   ///  * [saveLayer], which does the same thing but additionally also groups the
   ///    commands done until the matching [restore].
-  @FfiNative<Void Function(Pointer<Void>)>('Canvas::save', isLeaf: true)
-  external void save();
+  void save() {
+    _addCommand(_kCommandSave, 0);
+  }
 
   /// Saves a copy of the current transform and clip on the save stack, and then
   /// creates a new group which subsequent calls will become a part of. When the
@@ -4676,6 +4841,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   ///    [saveLayer].
   void saveLayer(Rect? bounds, Paint paint) {
     assert(paint != null);
+    _flushCommands();
     if (bounds == null) {
       _saveLayerWithoutBounds(paint._objects, paint._data);
     } else {
@@ -4697,8 +4863,9 @@ class Canvas extends NativeFieldWrapperClass1 {
   ///
   /// If the state was pushed with with [saveLayer], then this call will also
   /// cause the new layer to be composited into the previous layer.
-  @FfiNative<Void Function(Pointer<Void>)>('Canvas::restore', isLeaf: true)
-  external void restore();
+  void restore() {
+    _addCommand(_kCommandRestore, 0);
+  }
 
   /// Restores the save stack to a previous level as might be obtained from [getSaveCount].
   /// If [count] is less than 1, the stack is restored to its initial state.
@@ -4709,8 +4876,13 @@ class Canvas extends NativeFieldWrapperClass1 {
   /// If any of the state stack levels restored by this call were pushed with
   /// [saveLayer], then this call will also cause those layers to be composited
   /// into their previous layers.
+  void restoreToCount(int count) {
+    _flushCommands();
+    _restoreToCount(count);
+  }
+
   @FfiNative<Void Function(Pointer<Void>, Int32)>('Canvas::restoreToCount', isLeaf: true)
-  external void restoreToCount(int count);
+  external void _restoreToCount(int count);
 
   /// Returns the number of items on the save stack, including the
   /// initial state. This means it returns 1 for a clean canvas, and
@@ -4718,13 +4890,21 @@ class Canvas extends NativeFieldWrapperClass1 {
   /// each matching call to [restore] decrements it.
   ///
   /// This number cannot go below 1.
+  int getSaveCount() {
+    _flushCommands();
+    return _getSaveCount();
+  }
+
   @FfiNative<Int32 Function(Pointer<Void>)>('Canvas::getSaveCount', isLeaf: true)
-  external int getSaveCount();
+  external int _getSaveCount();
 
   /// Add a translation to the current transform, shifting the coordinate space
   /// horizontally by the first argument and vertically by the second argument.
-  @FfiNative<Void Function(Pointer<Void>, Double, Double)>('Canvas::translate', isLeaf: true)
-  external void translate(double dx, double dy);
+  void translate(double dx, double dy) {
+    final int index = _addCommand(_kCommandTranslate, 2);
+    _commandFloats![index] = dx;
+    _commandFloats![index + 1] = dy;
+  }
 
   /// Add an axis-aligned scale to the current transform, scaling by the first
   /// argument in the horizontal direction and the second in the vertical
@@ -4732,21 +4912,32 @@ class Canvas extends NativeFieldWrapperClass1 {
   ///
   /// If [sy] is unspecified, [sx] will be used for the scale in both
   /// directions.
-  void scale(double sx, [double? sy]) => _scale(sx, sy ?? sx);
-
-  @FfiNative<Void Function(Pointer<Void>, Double, Double)>('Canvas::scale', isLeaf: true)
-  external void _scale(double sx, double sy);
+  void scale(double sx, [double? sy]) {
+    final int index = _addCommand(_kCommandScale, 2);
+    _commandFloats![index] = sx;
+    _commandFloats![index + 1] = sy ?? sx;
+  }
 
   /// Add a rotation to the current transform. The argument is in radians clockwise.
+  void rotate(double radians) {
+    _flushCommands();
+    _rotate(radians);
+  }
+
   @FfiNative<Void Function(Pointer<Void>, Double)>('Canvas::rotate', isLeaf: true)
-  external void rotate(double radians);
+  external void _rotate(double radians);
 
   /// Add an axis-aligned skew to the current transform, with the first argument
   /// being the horizontal skew in rise over run units clockwise around the
   /// origin, and the second argument being the vertical skew in rise over run
   /// units clockwise around the origin.
+  void skew(double sx, double sy) {
+    _flushCommands();
+    _skew(sx, sy);
+  }
+
   @FfiNative<Void Function(Pointer<Void>, Double, Double)>('Canvas::skew', isLeaf: true)
-  external void skew(double sx, double sy);
+  external void _skew(double sx, double sy);
 
   /// Multiply the current transform by the specified 4⨉4 transformation matrix
   /// specified as a list of values in column-major order.
@@ -4755,6 +4946,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     if (matrix4.length != 16) {
       throw ArgumentError('"matrix4" must have 16 entries.');
     }
+    _flushCommands();
     _transform(matrix4);
   }
 
@@ -4771,6 +4963,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   /// associated [save] or [saveLayer] call.
   Float64List getTransform() {
     final Float64List matrix4 = Float64List(16);
+    _flushCommands();
     _getTransform(matrix4);
     return matrix4;
   }
@@ -4795,12 +4988,16 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(_rectIsValid(rect));
     assert(clipOp != null);
     assert(doAntiAlias != null);
-    _clipRect(rect.left, rect.top, rect.right, rect.bottom, clipOp.index, doAntiAlias);
+    final int index = _addCommand(_kCommandClipRect, 6);
+    final Float32List commandFloats = _commandFloats!;
+    commandFloats[index] = rect.left;
+    commandFloats[index + 1] = rect.top;
+    commandFloats[index + 2] = rect.right;
+    commandFloats[index + 3] = rect.bottom;
+    _commandWords![index + 4] = clipOp.index;
+    _commandWords![index + 5] = doAntiAlias ? 1 : 0;
   }
 
-  @FfiNative<Void Function(Pointer<Void>, Double, Double, Double, Double, Int32, Bool)>('Canvas::clipRect', isLeaf: true)
-  external void _clipRect(double left, double top, double right, double bottom, int clipOp, bool doAntiAlias);
-
   /// Reduces the clip region to the intersection of the current clip and the
   /// given rounded rectangle.
   ///
@@ -4814,6 +5011,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   void clipRRect(RRect rrect, {bool doAntiAlias = true}) {
     assert(_rrectIsValid(rrect));
     assert(doAntiAlias != null);
+    _flushCommands();
     _clipRRect(rrect._getValue32(), doAntiAlias);
   }
 
@@ -4833,6 +5031,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   void clipPath(Path path, {bool doAntiAlias = true}) {
     assert(path != null); // path is checked on the engine side
     assert(doAntiAlias != null);
+    _flushCommands();
     _clipPath(path, doAntiAlias);
   }
 
@@ -4893,6 +5092,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   /// {@endtemplate}
   Rect getLocalClipBounds() {
     final Float64List bounds = Float64List(4);
+    _flushCommands();
     _getLocalClipBounds(bounds);
     return Rect.fromLTRB(bounds[0], bounds[1], bounds[2], bounds[3]);
   }
@@ -4916,6 +5116,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   /// {@macro dart.ui.canvas.conservativeClipBounds}
   Rect getDestinationClipBounds() {
     final Float64List bounds = Float64List(4);
+    _flushCommands();
     _getDestinationClipBounds(bounds);
     return Rect.fromLTRB(bounds[0], bounds[1], bounds[2], bounds[3]);
   }
@@ -4929,12 +5130,11 @@ class Canvas extends NativeFieldWrapperClass1 {
   void drawColor(Color color, BlendMode blendMode) {
     assert(color != null);
     assert(blendMode != null);
-    _drawColor(color.value, blendMode.index);
+    final int index = _addCommand(_kCommandDrawColor, 2);
+    _commandWords![index] = color.value;
+    _commandWords![index + 1] = blendMode.index;
   }
 
-  @FfiNative<Void Function(Pointer<Void>, Uint32, Int32)>('Canvas::drawColor', isLeaf: true)
-  external void _drawColor(int color, int blendMode);
-
   /// Draws a line between the given points using the given paint. The line is
   /// stroked, the value of the [Paint.style] is ignored for this call.
   ///
@@ -4946,7 +5146,17 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(_offsetIsValid(p1));
     assert(_offsetIsValid(p2));
     assert(paint != null);
-    _drawLine(p1.dx, p1.dy, p2.dx, p2.dy, paint._objects, paint._data);
+    if (paint._hasObjects) {
+      _flushCommands();
+      _drawLine(p1.dx, p1.dy, p2.dx, p2.dy, paint._objects, paint._data);
+      return;
+    }
+    final int index = _addPaintCommand(_kCommandDrawLine, 4, paint);
+    final Float32List commandFloats = _commandFloats!;
+    commandFloats[index] = p1.dx;
+    commandFloats[index + 1] = p1.dy;
+    commandFloats[index + 2] = p2.dx;
+    commandFloats[index + 3] = p2.dy;
   }
 
   @FfiNative<Void Function(Pointer<Void>, Double, Double, Double, Double, Handle, Handle)>('Canvas::drawLine')
@@ -4958,7 +5168,12 @@ class Canvas extends NativeFieldWrapperClass1 {
   /// [drawColor] instead.
   void drawPaint(Paint paint) {
     assert(paint != null);
-    _drawPaint(paint._objects, paint._data);
+    if (paint._hasObjects) {
+      _flushCommands();
+      _drawPaint(paint._objects, paint._data);
+      return;
+    }
+    _addPaintCommand(_kCommandDrawPaint, 0, paint);
   }
 
   @FfiNative<Void Function(Pointer<Void>, Handle, Handle)>('Canvas::drawPaint')
@@ -4972,7 +5187,17 @@ class Canvas extends NativeFieldWrapperClass1 {
   void drawRect(Rect rect, Paint paint) {
     assert(_rectIsValid(rect));
     assert(paint != null);
-    _drawRect(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+    if (paint._hasObjects) {
+      _flushCommands();
+      _drawRect(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      return;
+    }
+    final int index = _addPaintCommand(_kCommandDrawRect, 4, paint);
+    final Float32List commandFloats = _commandFloats!;
+    commandFloats[index] = rect.left;
+    commandFloats[index + 1] = rect.top;
+    commandFloats[index + 2] = rect.right;
+    commandFloats[index + 3] = rect.bottom;
   }
 
   @FfiNative<Void Function(Pointer<Void>, Double, Double, Double, Double, Handle, Handle)>('Canvas::drawRect')
@@ -4986,7 +5211,12 @@ class Canvas extends NativeFieldWrapperClass1 {
   void drawRRect(RRect rrect, Paint paint) {
     assert(_rrectIsValid(rrect));
     assert(paint != null);
-    _drawRRect(rrect._getValue32(), paint._objects, paint._data);
+    if (paint._hasObjects) {
+      _flushCommands();
+      _drawRRect(rrect._getValue32(), paint._objects, paint._data);
+      return;
+    }
+    _addRRect(_addPaintCommand(_kCommandDrawRRect, 12, paint), rrect);
   }
 
   @FfiNative<Void Function(Pointer<Void>, Handle, Handle, Handle)>('Canvas::drawRRect')
@@ -5001,7 +5231,14 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(_rrectIsValid(outer));
     assert(_rrectIsValid(inner));
     assert(paint != null);
-    _drawDRRect(outer._getValue32(), inner._getValue32(), paint._objects, paint._data);
+    if (paint._hasObjects) {
+      _flushCommands();
+      _drawDRRect(outer._getValue32(), inner._getValue32(), paint._objects, paint._data);
+      return;
+    }
+    final int index = _addPaintCommand(_kCommandDrawDRRect, 24, paint);
+    _addRRect(index, outer);
+    _addRRect(index + 12, inner);
   }
 
   @FfiNative<Void Function(Pointer<Void>, Handle, Handle, Handle, Handle)>('Canvas::drawDRRect')
@@ -5016,7 +5253,17 @@ class Canvas extends NativeFieldWrapperClass1 {
   void drawOval(Rect rect, Paint paint) {
     assert(_rectIsValid(rect));
     assert(paint != null);
-    _drawOval(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+    if (paint._hasObjects) {
+      _flushCommands();
+      _drawOval(rect.left, rect.top, rect.right, rect.bottom, paint._objects, paint._data);
+      return;
+    }
+    final int index = _addPaintCommand(_kCommandDrawOval, 4, paint);
+    final Float32List commandFloats = _commandFloats!;
+    commandFloats[index] = rect.left;
+    commandFloats[index + 1] = rect.top;
+    commandFloats[index + 2] = rect.right;
+    commandFloats[index + 3] = rect.bottom;
   }
 
   @FfiNative<Void Function(Pointer<Void>, Double, Double, Double, Double, Handle, Handle)>('Canvas::drawOval')
@@ -5032,7 +5279,16 @@ class Canvas extends NativeFieldWrapperClass1 {
   void drawCircle(Offset c, double radius, Paint paint) {
     assert(_offsetIsValid(c));
     assert(paint != null);
-    _drawCircle(c.dx, c.dy, radius, paint._objects, paint._data);
+    if (paint._hasObjects) {
+      _flushCommands();
+      _drawCircle(c.dx, c.dy, radius, paint._objects, paint._data);
+      return;
+    }
+    final int index = _addPaintCommand(_kCommandDrawCircle, 3, paint);
+    final Float32List commandFloats = _commandFloats!;
+    commandFloats[index] = c.dx;
+    commandFloats[index + 1] = c.dy;
+    commandFloats[index + 2] = radius;
   }
 
   @FfiNative<Void Function(Pointer<Void>, Double, Double, Double, Handle, Handle)>('Canvas::drawCircle')
@@ -5055,6 +5311,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   void drawArc(Rect rect, double startAngle, double sweepAngle, bool useCenter, Paint paint) {
     assert(_rectIsValid(rect));
     assert(paint != null);
+    _flushCommands();
     _drawArc(rect.left, rect.top, rect.right, rect.bottom, startAngle, sweepAngle, useCenter, paint._objects, paint._data);
   }
 
@@ -5078,6 +5335,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   void drawPath(Path path, Paint paint) {
     assert(path != null); // path is checked on the engine side
     assert(paint != null);
+    _flushCommands();
     _drawPath(path, paint._objects, paint._data);
   }
 
@@ -5091,6 +5349,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(!image.debugDisposed);
     assert(_offsetIsValid(offset));
     assert(paint != null);
+    _flushCommands();
     final String? error = _drawImage(image._image, offset.dx, offset.dy, paint._objects, paint._data, paint.filterQuality.index);
     if (error != null) {
       throw PictureRasterizationException._(error, stack: image._debugStack);
@@ -5115,6 +5374,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(_rectIsValid(src));
     assert(_rectIsValid(dst));
     assert(paint != null);
+    _flushCommands();
     final String? error = _drawImageRect(image._image,
                                          src.left,
                                          src.top,
@@ -5166,6 +5426,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(_rectIsValid(center));
     assert(_rectIsValid(dst));
     assert(paint != null);
+    _flushCommands();
     final String? error = _drawImageNine(image._image,
                                          center.left,
                                          center.top,
@@ -5203,6 +5464,7 @@ class Canvas extends NativeFieldWrapperClass1 {
   void drawPicture(Picture picture) {
     assert(picture != null); // picture is checked on the engine side
     assert(!picture.debugDisposed);
+    _flushCommands();
     _drawPicture(picture);
   }
 
@@ -5234,6 +5496,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(!paragraph.debugDisposed);
     assert(_offsetIsValid(offset));
     assert(!paragraph._needsLayout);
+    _flushCommands();
     paragraph._paint(this, offset.dx, offset.dy);
   }
 
@@ -5249,6 +5512,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(pointMode != null);
     assert(points != null);
     assert(paint != null);
+    _flushCommands();
     _drawPoints(paint._objects, paint._data, pointMode.index, _encodePointList(points));
   }
 
@@ -5268,6 +5532,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     if (points.length % 2 != 0) {
       throw ArgumentError('"points" must have an even number of values.');
     }
+    _flushCommands();
     _drawPoints(paint._objects, paint._data, pointMode.index, points);
   }
 
@@ -5299,6 +5564,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(!vertices.debugDisposed);
     assert(paint != null);
     assert(blendMode != null);
+    _flushCommands();
     _drawVertices(vertices, blendMode.index, paint._objects, paint._data);
   }
 
@@ -5483,6 +5749,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     final Float32List? cullRectBuffer = cullRect?._getValue32();
     final int qualityIndex = paint.filterQuality.index;
 
+    _flushCommands();
     final String? error = _drawAtlas(
       paint._objects, paint._data, qualityIndex, atlas._image, rstTransformBuffer, rectBuffer,
       colorBuffer, (blendMode ?? BlendMode.src).index, cullRectBuffer
@@ -5665,6 +5932,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     }
     final int qualityIndex = paint.filterQuality.index;
 
+    _flushCommands();
     final String? error = _drawAtlas(
       paint._objects, paint._data, qualityIndex, atlas._image, rstTransforms, rects,
       colors, (blendMode ?? BlendMode.src).index, cullRect?._getValue32()
@@ -5697,6 +5965,7 @@ class Canvas extends NativeFieldWrapperClass1 {
     assert(path != null); // path is checked on the engine side
     assert(color != null);
     assert(transparentOccluder != null);
+    _flushCommands();
     _drawShadow(path, color.value, elevation, transparentOccluder);
   }
 
@@ -5863,6 +6132,7 @@ class PictureRecorder extends NativeFieldWrapperClass1 {
     if (_canvas == null) {
       throw StateError('PictureRecorder did not start recording.');
     }
+    _canvas!._flushCommands();
     final Picture picture = Picture._();
     _endRecording(picture);
     _canvas!._recorder = null;
@@ -6277,7 +6547,17 @@ class ImageDescriptor extends NativeFieldWrapperClass1 {
   ///
   /// If either targetWidth or targetHeight is less than or equal to zero, it
   /// will be treated as if it is null.
-  Future<Codec> instantiateCodec({int? targetWidth, int? targetHeight}) async {
+  ///
+  /// If `generateMipmaps` is true, renderers that support it generate the mip
+  /// levels of the decoded image on the GPU. This makes drawing the image
+  /// minified with [FilterQuality.medium] cheaper and reduces aliasing, but
+  /// uses a third more memory. It should only be set for images that are
+  /// likely to be drawn minified. Animated images never get mip levels.
+  Future<Codec> instantiateCodec({
+    int? targetWidth,
+    int? targetHeight,
+    bool generateMipmaps = false,
+  }) async {
     if (targetWidth != null && targetWidth <= 0) {
       targetWidth = null;
     }
@@ -6299,12 +6579,12 @@ class ImageDescriptor extends NativeFieldWrapperClass1 {
     assert(targetHeight != null);
 
     final Codec codec = Codec._();
-    _instantiateCodec(codec, targetWidth!, targetHeight!);
+    _instantiateCodec(codec, targetWidth!, targetHeight!, generateMipmaps);
     return codec;
   }
 
-  @FfiNative<Void Function(Pointer<Void>, Handle, Int32, Int32)>('ImageDescriptor::instantiateCodec')
-  external void _instantiateCodec(Codec outCodec, int targetWidth, int targetHeight);
+  @FfiNative<Void Function(Pointer<Void>, Handle, Int32, Int32, Bool)>('ImageDescriptor::instantiateCodec')
+  external void _instantiateCodec(Codec outCodec, int targetWidth, int targetHeight, bool generateMipmaps);
 }
 
 /// Generic callback signature, used by [_futurize].
@@ -0,0 +1,60 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/attribute_interner.h"
+
+#include "flutter/lib/ui/ui_dart_state.h"
+
+namespace flutter {
+
+AttributeInterner::AttributeInterner() = default;
+
+AttributeInterner::~AttributeInterner() = default;
+
+AttributeInterner* AttributeInterner::Current() {
+  auto* state = UIDartState::Current();
+  return state ? state->GetAttributeInterner() : nullptr;
+}
+
+std::shared_ptr<DlColorFilter> AttributeInterner::Intern(
+    size_t hash,
+    const DlColorFilter& candidate) {
+  auto* interner = Current();
+  if (!interner) {
+    return candidate.shared();
+  }
+  return interner->color_filters().Intern(hash, candidate);
+}
+
+std::shared_ptr<DlImageFilter> AttributeInterner::Intern(
+    size_t hash,
+    const DlImageFilter& candidate) {
+  auto* interner = Current();
+  if (!interner) {
+    return candidate.shared();
+  }
+  return interner->image_filters().Intern(hash, candidate);
+}
+
+std::shared_ptr<DlMaskFilter> AttributeInterner::Intern(
+    size_t hash,
+    const DlMaskFilter& candidate) {
+  auto* interner = Current();
+  if (!interner) {
+    return candidate.shared();
+  }
+  return interner->mask_filters().Intern(hash, candidate);
+}
+
+std::shared_ptr<DlColorSource> AttributeInterner::Intern(
+    size_t hash,
+    std::shared_ptr<DlColorSource> source) {
+  auto* interner = Current();
+  if (!interner) {
+    return source;
+  }
+  return interner->color_sources().Intern(hash, std::move(source));
+}
+
+}  // namespace flutter
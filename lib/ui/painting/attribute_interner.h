@@ -0,0 +1,165 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_ATTRIBUTE_INTERNER_H_
+#define FLUTTER_LIB_UI_PAINTING_ATTRIBUTE_INTERNER_H_
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+
+#include "flutter/display_list/display_list_color_filter.h"
+#include "flutter/display_list/display_list_color_source.h"
+#include "flutter/display_list/display_list_image_filter.h"
+#include "flutter/display_list/display_list_mask_filter.h"
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+/// A table of weakly referenced DisplayList attributes which hands out a
+/// single shared instance for all attributes that are equal.
+///
+/// Interned attributes can be compared by pointer, which is the first
+/// thing that the DlComparable equality operators check. The caller
+/// provides a hash of the values that the attribute was constructed from,
+/// and equal attributes must have equal hashes.
+///
+/// The table does not keep its attributes alive, entries whose attribute
+/// has been released are dropped as they are encountered.
+template <class T>
+class AttributeInternTable {
+ public:
+  AttributeInternTable() = default;
+
+  /// Returns a live attribute that is equal to |candidate|, or interns and
+  /// returns a shared copy of |candidate| if there is none.
+  std::shared_ptr<T> Intern(size_t hash, const T& candidate) {
+    std::shared_ptr<T> existing = Find(hash, candidate);
+    if (existing) {
+      return existing;
+    }
+    std::shared_ptr<T> attribute = candidate.shared();
+    Insert(hash, attribute);
+    return attribute;
+  }
+
+  /// Returns a live attribute that is equal to |attribute|, or interns and
+  /// returns |attribute| itself if there is none.
+  std::shared_ptr<T> Intern(size_t hash, std::shared_ptr<T> attribute) {
+    if (!attribute) {
+      return attribute;
+    }
+    std::shared_ptr<T> existing = Find(hash, *attribute);
+    if (existing) {
+      return existing;
+    }
+    Insert(hash, attribute);
+    return attribute;
+  }
+
+  /// The number of entries in the table, including entries whose attribute
+  /// has been released but that have not been dropped yet.
+  size_t size() const { return entries_.size(); }
+
+ private:
+  static constexpr size_t kMinSweepSize = 64;
+
+  std::shared_ptr<T> Find(size_t hash, const T& candidate) {
+    auto range = entries_.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+      std::shared_ptr<T> existing = it->second.lock();
+      if (!existing) {
+        it = entries_.erase(it);
+      } else if (*existing == candidate) {
+        return existing;
+      } else {
+        ++it;
+      }
+    }
+    return nullptr;
+  }
+
+  void Insert(size_t hash, const std::shared_ptr<T>& attribute) {
+    // Attributes that are never looked up again would otherwise stay in
+    // the table, so the whole table is swept whenever it has doubled in
+    // size since the last sweep.
+    if (entries_.size() >= sweep_size_) {
+      for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.expired()) {
+          it = entries_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      sweep_size_ = std::max(kMinSweepSize, entries_.size() * 2);
+    }
+    entries_.emplace(hash, attribute);
+  }
+
+  std::unordered_multimap<size_t, std::weak_ptr<T>> entries_;
+  size_t sweep_size_ = kMinSweepSize;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AttributeInternTable);
+};
+
+/// Combines the hashes of the first |count| entries of |values| into
+/// |seed|.
+template <class T>
+void HashCombineValues(size_t& seed, const T* values, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    fml::HashCombineSeed(seed, values[i]);
+  }
+}
+
+/// The intern tables for the attributes created from dart:ui objects.
+///
+/// Each UI isolate owns an interner and it must only be used on the UI
+/// task runner of that isolate.
+class AttributeInterner {
+ public:
+  AttributeInterner();
+
+  ~AttributeInterner();
+
+  /// Interns |candidate| in the interner of the current isolate. Returns a
+  /// shared copy of |candidate| if there is no current isolate.
+  static std::shared_ptr<DlColorFilter> Intern(size_t hash,
+                                               const DlColorFilter& candidate);
+  static std::shared_ptr<DlImageFilter> Intern(size_t hash,
+                                               const DlImageFilter& candidate);
+  static std::shared_ptr<DlMaskFilter> Intern(size_t hash,
+                                              const DlMaskFilter& candidate);
+
+  /// Interns |source| in the interner of the current isolate. Returns
+  /// |source| itself if there is no current isolate.
+  static std::shared_ptr<DlColorSource> Intern(
+      size_t hash,
+      std::shared_ptr<DlColorSource> source);
+
+  AttributeInternTable<DlColorSource>& color_sources() {
+    return color_sources_;
+  }
+  AttributeInternTable<DlColorFilter>& color_filters() {
+    return color_filters_;
+  }
+  AttributeInternTable<DlImageFilter>& image_filters() {
+    return image_filters_;
+  }
+  AttributeInternTable<DlMaskFilter>& mask_filters() { return mask_filters_; }
+
+ private:
+  static AttributeInterner* Current();
+
+  AttributeInternTable<DlColorSource> color_sources_;
+  AttributeInternTable<DlColorFilter> color_filters_;
+  AttributeInternTable<DlImageFilter> image_filters_;
+  AttributeInternTable<DlMaskFilter> mask_filters_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AttributeInterner);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_ATTRIBUTE_INTERNER_H_
@@ -0,0 +1,64 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/attribute_interner.h"
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(AttributeInternTable, EqualAttributesAreShared) {
+  AttributeInternTable<DlImageFilter> table;
+  auto blur1 = table.Intern(1, DlBlurImageFilter(5, 5, DlTileMode::kClamp));
+  auto blur2 = table.Intern(1, DlBlurImageFilter(5, 5, DlTileMode::kClamp));
+  ASSERT_EQ(blur1.get(), blur2.get());
+  ASSERT_EQ(table.size(), 1u);
+}
+
+TEST(AttributeInternTable, DifferentAttributesWithTheSameHashAreNotShared) {
+  AttributeInternTable<DlImageFilter> table;
+  auto blur = table.Intern(1, DlBlurImageFilter(5, 5, DlTileMode::kClamp));
+  auto dilate = table.Intern(1, DlDilateImageFilter(5, 5));
+  ASSERT_NE(blur.get(), dilate.get());
+  ASSERT_EQ(*blur, DlBlurImageFilter(5, 5, DlTileMode::kClamp));
+  ASSERT_EQ(*dilate, DlDilateImageFilter(5, 5));
+  ASSERT_EQ(table.size(), 2u);
+}
+
+TEST(AttributeInternTable, SharedAttributesAreInterned) {
+  AttributeInternTable<DlColorSource> table;
+  DlColor colors[] = {DlColor::kRed(), DlColor::kBlue()};
+  auto make_gradient = [&colors]() {
+    return DlColorSource::MakeLinear({0, 0}, {10, 10}, 2, colors, nullptr,
+                                     DlTileMode::kClamp);
+  };
+  auto gradient = make_gradient();
+  ASSERT_EQ(table.Intern(7, gradient).get(), gradient.get());
+  ASSERT_EQ(table.Intern(7, make_gradient()).get(), gradient.get());
+  ASSERT_EQ(table.Intern(7, nullptr), nullptr);
+}
+
+TEST(AttributeInternTable, ReleasedAttributesAreNotKeptAlive) {
+  AttributeInternTable<DlMaskFilter> table;
+  std::weak_ptr<DlMaskFilter> weak_filter =
+      table.Intern(3, DlBlurMaskFilter(kNormal_SkBlurStyle, 5));
+  ASSERT_TRUE(weak_filter.expired());
+
+  auto filter = table.Intern(3, DlBlurMaskFilter(kNormal_SkBlurStyle, 5));
+  ASSERT_NE(filter, nullptr);
+  // The released entry was dropped when the hash was looked up again.
+  ASSERT_EQ(table.size(), 1u);
+}
+
+TEST(AttributeInternTable, ReleasedAttributesAreSwept) {
+  AttributeInternTable<DlColorFilter> table;
+  for (int i = 0; i < 1000; i++) {
+    table.Intern(i, DlBlendColorFilter(DlColor(i), DlBlendMode::kSrcOver));
+  }
+  ASSERT_LT(table.size(), 1000u);
+}
+
+}  // namespace testing
+}  // namespace flutter
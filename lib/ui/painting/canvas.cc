@@ -24,6 +24,7 @@
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/dart_library_natives.h"
+#include "third_party/tonic/typed_data/dart_byte_data.h"
 
 using tonic::ToDart;
 
@@ -242,8 +243,8 @@ void Canvas::drawLine(double x1,
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawLineFlags);
-    builder()->drawLine(SkPoint::Make(x1, y1), SkPoint::Make(x2, y2));
+    builder()->drawLine(SkPoint::Make(x1, y1), SkPoint::Make(x2, y2),
+                        *paint_cache_.Get(paint));
   }
 }
 
@@ -252,14 +253,14 @@ void Canvas::drawPaint(Dart_Handle paint_objects, Dart_Handle paint_data) {
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawPaintFlags);
-    std::shared_ptr<const DlImageFilter> filter = builder()->getImageFilter();
+    const DlPaint* dl_paint = paint_cache_.Get(paint);
+    std::shared_ptr<const DlImageFilter> filter = dl_paint->getImageFilter();
     if (filter && !filter->asColorFilter()) {
       // drawPaint does an implicit saveLayer if an SkImageFilter is
       // present that cannot be replaced by an SkColorFilter.
       TRACE_EVENT0("flutter", "ui.Canvas::saveLayer (Recorded)");
     }
-    builder()->drawPaint();
+    builder()->drawPaint(*dl_paint);
   }
 }
 
@@ -273,8 +274,8 @@ void Canvas::drawRect(double left,
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawRectFlags);
-    builder()->drawRect(SkRect::MakeLTRB(left, top, right, bottom));
+    builder()->drawRect(SkRect::MakeLTRB(left, top, right, bottom),
+                        *paint_cache_.Get(paint));
   }
 }
 
@@ -285,8 +286,7 @@ void Canvas::drawRRect(const RRect& rrect,
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawRRectFlags);
-    builder()->drawRRect(rrect.sk_rrect);
+    builder()->drawRRect(rrect.sk_rrect, *paint_cache_.Get(paint));
   }
 }
 
@@ -298,8 +298,8 @@ void Canvas::drawDRRect(const RRect& outer,
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawDRRectFlags);
-    builder()->drawDRRect(outer.sk_rrect, inner.sk_rrect);
+    builder()->drawDRRect(outer.sk_rrect, inner.sk_rrect,
+                          *paint_cache_.Get(paint));
   }
 }
 
@@ -313,8 +313,8 @@ void Canvas::drawOval(double left,
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawOvalFlags);
-    builder()->drawOval(SkRect::MakeLTRB(left, top, right, bottom));
+    builder()->drawOval(SkRect::MakeLTRB(left, top, right, bottom),
+                        *paint_cache_.Get(paint));
   }
 }
 
@@ -327,8 +327,8 @@ void Canvas::drawCircle(double x,
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawCircleFlags);
-    builder()->drawCircle(SkPoint::Make(x, y), radius);
+    builder()->drawCircle(SkPoint::Make(x, y), radius,
+                          *paint_cache_.Get(paint));
   }
 }
 
@@ -345,13 +345,9 @@ void Canvas::drawArc(double left,
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(),
-                  useCenter  //
-                      ? kDrawArcWithCenterFlags
-                      : kDrawArcNoCenterFlags);
     builder()->drawArc(SkRect::MakeLTRB(left, top, right, bottom),
                        startAngle * 180.0 / M_PI, sweepAngle * 180.0 / M_PI,
-                       useCenter);
+                       useCenter, *paint_cache_.Get(paint));
   }
 }
 
@@ -367,8 +363,7 @@ void Canvas::drawPath(const CanvasPath* path,
     return;
   }
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawPathFlags);
-    builder()->drawPath(path->path());
+    builder()->drawPath(path->path(), *paint_cache_.Get(paint));
   }
 }
 
@@ -512,20 +507,10 @@ void Canvas::drawPoints(Dart_Handle paint_objects,
 
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    switch (point_mode) {
-      case SkCanvas::kPoints_PointMode:
-        paint.sync_to(builder(), kDrawPointsAsPointsFlags);
-        break;
-      case SkCanvas::kLines_PointMode:
-        paint.sync_to(builder(), kDrawPointsAsLinesFlags);
-        break;
-      case SkCanvas::kPolygon_PointMode:
-        paint.sync_to(builder(), kDrawPointsAsPolygonFlags);
-        break;
-    }
     builder()->drawPoints(point_mode,
                           points.num_elements() / 2,  // SkPoints have 2 floats
-                          reinterpret_cast<const SkPoint*>(points.data()));
+                          reinterpret_cast<const SkPoint*>(points.data()),
+                          *paint_cache_.Get(paint));
   }
 }
 
@@ -542,8 +527,8 @@ void Canvas::drawVertices(const Vertices* vertices,
   }
   FML_DCHECK(paint.isNotNull());
   if (display_list_recorder_) {
-    paint.sync_to(builder(), kDrawVerticesFlags);
-    builder()->drawVertices(vertices->vertices(), blend_mode);
+    builder()->drawVertices(vertices->vertices(), blend_mode,
+                            *paint_cache_.Get(paint));
   }
 }
 
@@ -623,6 +608,165 @@ void Canvas::drawShadow(const CanvasPath* path,
   }
 }
 
+// Must be kept in sync with the _kCommand constants in painting.dart.
+enum class CanvasCommand : uint32_t {
+  kSave,
+  kRestore,
+  kTranslate,
+  kScale,
+  kClipRect,
+  kDrawColor,
+  kDrawLine,
+  kDrawPaint,
+  kDrawRect,
+  kDrawRRect,
+  kDrawDRRect,
+  kDrawOval,
+  kDrawCircle,
+};
+
+static constexpr size_t kPaintWords = Paint::kDataByteCount / 4;
+
+// The number of 32bit words that follow the command word, including the
+// paint data of draw commands.
+static size_t GetCommandWords(CanvasCommand command) {
+  switch (command) {
+    case CanvasCommand::kSave:
+    case CanvasCommand::kRestore:
+      return 0;
+    case CanvasCommand::kTranslate:
+    case CanvasCommand::kScale:
+    case CanvasCommand::kDrawColor:
+      return 2;
+    case CanvasCommand::kClipRect:
+      return 6;
+    case CanvasCommand::kDrawPaint:
+      return kPaintWords;
+    case CanvasCommand::kDrawCircle:
+      return kPaintWords + 3;
+    case CanvasCommand::kDrawLine:
+    case CanvasCommand::kDrawRect:
+    case CanvasCommand::kDrawOval:
+      return kPaintWords + 4;
+    case CanvasCommand::kDrawRRect:
+      return kPaintWords + 12;
+    case CanvasCommand::kDrawDRRect:
+      return kPaintWords + 24;
+  }
+  return 0;
+}
+
+// Decodes an RRect in the layout of RRect._getValue32 in geometry.dart.
+static SkRRect ReadRRect(const float* values) {
+  SkVector radii[4] = {{values[4], values[5]},
+                       {values[6], values[7]},
+                       {values[8], values[9]},
+                       {values[10], values[11]}};
+  SkRRect rrect;
+  rrect.setRectRadii(
+      SkRect::MakeLTRB(values[0], values[1], values[2], values[3]), radii);
+  return rrect;
+}
+
+void Canvas::recordCommands(Dart_Handle commands_handle, int length) {
+  tonic::DartByteData commands(commands_handle);
+  if (length < 0 || static_cast<size_t>(length) > commands.length_in_bytes() ||
+      length % 4 != 0) {
+    commands.Release();
+    Dart_ThrowException(
+        ToDart("Canvas.recordCommands called with an invalid length."));
+    return;
+  }
+  if (!display_list_recorder_) {
+    return;
+  }
+  TRACE_EVENT0("flutter", "ui.Canvas::recordCommands");
+
+  DisplayListBuilder* recorder = builder();
+  const uint32_t* words = static_cast<const uint32_t*>(commands.data());
+  const size_t word_count = length / 4;
+  size_t index = 0;
+  const char* error = nullptr;
+  while (index < word_count) {
+    const uint32_t encoded_command = words[index++];
+    if (encoded_command > static_cast<uint32_t>(CanvasCommand::kDrawCircle)) {
+      error = "Canvas.recordCommands called with an unknown command.";
+      break;
+    }
+    const auto command = static_cast<CanvasCommand>(encoded_command);
+    const size_t command_words = GetCommandWords(command);
+    if (word_count - index < command_words) {
+      error = "Canvas.recordCommands called with a truncated command.";
+      break;
+    }
+    const uint32_t* uint_args = words + index;
+    const float* args = reinterpret_cast<const float*>(uint_args);
+    const float* paint_args = args + kPaintWords;
+    index += command_words;
+
+    switch (command) {
+      case CanvasCommand::kSave:
+        save();
+        break;
+      case CanvasCommand::kRestore:
+        restore();
+        break;
+      case CanvasCommand::kTranslate:
+        translate(args[0], args[1]);
+        break;
+      case CanvasCommand::kScale:
+        scale(args[0], args[1]);
+        break;
+      case CanvasCommand::kClipRect:
+        clipRect(args[0], args[1], args[2], args[3],
+                 static_cast<SkClipOp>(uint_args[4]), uint_args[5] != 0);
+        break;
+      case CanvasCommand::kDrawColor:
+        drawColor(uint_args[0], static_cast<DlBlendMode>(uint_args[1]));
+        break;
+      case CanvasCommand::kDrawLine:
+        Paint::SyncDataTo(recorder, kDrawLineFlags, uint_args);
+        recorder->drawLine(SkPoint::Make(paint_args[0], paint_args[1]),
+                           SkPoint::Make(paint_args[2], paint_args[3]));
+        break;
+      case CanvasCommand::kDrawPaint:
+        Paint::SyncDataTo(recorder, kDrawPaintFlags, uint_args);
+        recorder->drawPaint();
+        break;
+      case CanvasCommand::kDrawRect:
+        Paint::SyncDataTo(recorder, kDrawRectFlags, uint_args);
+        recorder->drawRect(SkRect::MakeLTRB(paint_args[0], paint_args[1],
+                                            paint_args[2], paint_args[3]));
+        break;
+      case CanvasCommand::kDrawRRect:
+        Paint::SyncDataTo(recorder, kDrawRRectFlags, uint_args);
+        recorder->drawRRect(ReadRRect(paint_args));
+        break;
+      case CanvasCommand::kDrawDRRect:
+        Paint::SyncDataTo(recorder, kDrawDRRectFlags, uint_args);
+        recorder->drawDRRect(ReadRRect(paint_args),
+                             ReadRRect(paint_args + 12));
+        break;
+      case CanvasCommand::kDrawOval:
+        Paint::SyncDataTo(recorder, kDrawOvalFlags, uint_args);
+        recorder->drawOval(SkRect::MakeLTRB(paint_args[0], paint_args[1],
+                                            paint_args[2], paint_args[3]));
+        break;
+      case CanvasCommand::kDrawCircle:
+        Paint::SyncDataTo(recorder, kDrawCircleFlags, uint_args);
+        recorder->drawCircle(SkPoint::Make(paint_args[0], paint_args[1]),
+                             paint_args[2]);
+        break;
+    }
+  }
+
+  if (error) {
+    // The exception does not return, so the commands must be released first.
+    commands.Release();
+    Dart_ThrowException(ToDart(error));
+  }
+}
+
 void Canvas::Invalidate() {
   canvas_ = nullptr;
   display_list_recorder_ = nullptr;
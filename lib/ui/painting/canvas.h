@@ -187,6 +187,11 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
                   double elevation,
                   bool transparentOccluder);
 
+  // Records the first |length| bytes of commands that the Dart Canvas
+  // batched into |commands_handle| instead of making a native call for each
+  // of them.
+  void recordCommands(Dart_Handle commands_handle, int length);
+
   SkCanvas* canvas() const { return canvas_; }
   void Invalidate();
 
@@ -210,6 +215,10 @@ class Canvas : public RefCountedDartWrappable<Canvas>, DisplayListOpFlags {
   // paint attributes from an SkPaint and an operation type as well as access
   // to the raw DisplayListBuilder for emitting custom rendering operations.
   sk_sp<DisplayListCanvasRecorder> display_list_recorder_;
+
+  // The paint of the previous draw call, which the next draw call usually
+  // reuses.
+  DlPaintCache paint_cache_;
 };
 
 }  // namespace flutter
@@ -6,6 +6,7 @@
 
 #include <cstring>
 
+#include "flutter/lib/ui/painting/attribute_interner.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
@@ -23,8 +24,10 @@ void ColorFilter::Create(Dart_Handle wrapper) {
 }
 
 void ColorFilter::initMode(int color, int blend_mode) {
-  filter_ = std::make_shared<DlBlendColorFilter>(
-      static_cast<DlColor>(color), static_cast<DlBlendMode>(blend_mode));
+  size_t hash = fml::HashCombine(DlColorFilterType::kBlend, color, blend_mode);
+  filter_ = AttributeInterner::Intern(
+      hash, DlBlendColorFilter(static_cast<DlColor>(color),
+                               static_cast<DlBlendMode>(blend_mode)));
 }
 
 void ColorFilter::initMatrix(const tonic::Float32List& color_matrix) {
@@ -39,7 +42,9 @@ void ColorFilter::initMatrix(const tonic::Float32List& color_matrix) {
   matrix[9] *= 1.0f / 255;
   matrix[14] *= 1.0f / 255;
   matrix[19] *= 1.0f / 255;
-  filter_ = std::make_shared<DlMatrixColorFilter>(matrix);
+  size_t hash = fml::HashCombine(DlColorFilterType::kMatrix);
+  HashCombineValues(hash, matrix, 20);
+  filter_ = AttributeInterner::Intern(hash, DlMatrixColorFilter(matrix));
 }
 
 void ColorFilter::initLinearToSrgbGamma() {
@@ -0,0 +1,69 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/contour_measure_cache.h"
+
+#include <utility>
+
+#include "flutter/lib/ui/ui_dart_state.h"
+
+namespace flutter {
+
+MeasuredContours::MeasuredContours(const SkPath& path, bool force_closed)
+    : iter_(path, force_closed, 1) {}
+
+MeasuredContours::~MeasuredContours() = default;
+
+SkContourMeasure* MeasuredContours::GetContour(size_t index) {
+  while (index >= contours_.size() && !done_) {
+    sk_sp<SkContourMeasure> contour = iter_.next();
+    if (contour) {
+      contours_.push_back(std::move(contour));
+    } else {
+      done_ = true;
+    }
+  }
+  return index < contours_.size() ? contours_[index].get() : nullptr;
+}
+
+ContourMeasureCache::ContourMeasureCache() = default;
+
+ContourMeasureCache::~ContourMeasureCache() = default;
+
+uint64_t ContourMeasureCache::GetKey(const SkPath& path, bool force_closed) {
+  return (static_cast<uint64_t>(path.getGenerationID()) << 1) |
+         (force_closed ? 1 : 0);
+}
+
+std::shared_ptr<MeasuredContours> ContourMeasureCache::GetContours(
+    const SkPath& path,
+    bool force_closed) {
+  const uint64_t key = GetKey(path, force_closed);
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return found->second->contours;
+  }
+
+  auto contours = std::make_shared<MeasuredContours>(path, force_closed);
+  if (entries_.size() >= kMaxEntries) {
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+  entries_.push_front({key, contours});
+  index_[key] = entries_.begin();
+  return contours;
+}
+
+std::shared_ptr<MeasuredContours>
+ContourMeasureCache::GetContoursForCurrentIsolate(const SkPath& path,
+                                                  bool force_closed) {
+  auto* state = UIDartState::Current();
+  if (!state) {
+    return std::make_shared<MeasuredContours>(path, force_closed);
+  }
+  return state->GetContourMeasureCache()->GetContours(path, force_closed);
+}
+
+}  // namespace flutter
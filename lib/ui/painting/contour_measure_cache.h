@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_CONTOUR_MEASURE_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_CONTOUR_MEASURE_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkContourMeasure.h"
+#include "third_party/skia/include/core/SkPath.h"
+
+namespace flutter {
+
+/// The contours of a path, which are measured the first time that they
+/// are asked for and kept for later measurements of the same path.
+///
+/// Measured contours are immutable, so the contour measures handed out
+/// stay valid for as long as the caller holds on to them, even once the
+/// contours have been evicted from the cache that they came from.
+class MeasuredContours {
+ public:
+  MeasuredContours(const SkPath& path, bool force_closed);
+
+  ~MeasuredContours();
+
+  /// Returns the contour at |index|, measuring the contours up to it if
+  /// they have not been measured yet. Returns nullptr if the path has no
+  /// contour at |index|.
+  SkContourMeasure* GetContour(size_t index);
+
+  /// The number of contours that have been measured so far.
+  size_t measured_count() const { return contours_.size(); }
+
+ private:
+  SkContourMeasureIter iter_;
+  std::vector<sk_sp<SkContourMeasure>> contours_;
+  bool done_ = false;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(MeasuredContours);
+};
+
+/// A cache of the measured contours of recently measured paths, keyed on
+/// the generation ID of the path.
+///
+/// Path metrics are often computed for the same path on every frame, for
+/// example by path following animations or dashed lines. Without the
+/// cache, every computation would flatten all the curves of the path
+/// again. The generation ID of an |SkPath| changes whenever the path is
+/// edited, so a cached entry is never used for a path that has changed
+/// since it was measured.
+///
+/// Each UI isolate owns a cache and it must only be used on the UI task
+/// runner of that isolate.
+class ContourMeasureCache {
+ public:
+  /// The number of paths whose contours are kept. The least recently used
+  /// paths are evicted first.
+  static constexpr size_t kMaxEntries = 32;
+
+  ContourMeasureCache();
+
+  ~ContourMeasureCache();
+
+  /// Returns the contours of |path|, reusing the contours of an earlier
+  /// request for the same path if the cache still has them.
+  std::shared_ptr<MeasuredContours> GetContours(const SkPath& path,
+                                                bool force_closed);
+
+  /// Returns the contours of |path| from the cache of the current
+  /// isolate. Returns contours that are not cached if there is no current
+  /// isolate.
+  static std::shared_ptr<MeasuredContours> GetContoursForCurrentIsolate(
+      const SkPath& path,
+      bool force_closed);
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    uint64_t key;
+    std::shared_ptr<MeasuredContours> contours;
+  };
+
+  // Most recently used entries are at the front.
+  std::list<Entry> entries_;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> index_;
+
+  static uint64_t GetKey(const SkPath& path, bool force_closed);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ContourMeasureCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_CONTOUR_MEASURE_CACHE_H_
@@ -0,0 +1,71 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/contour_measure_cache.h"
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(ContourMeasureCache, ContoursAreMeasuredLazily) {
+  SkPath path;
+  path.lineTo(0, 10);
+  path.moveTo(10, 10);
+  path.lineTo(10, 15);
+
+  MeasuredContours contours(path, false);
+  ASSERT_EQ(contours.measured_count(), 0u);
+  ASSERT_NE(contours.GetContour(0), nullptr);
+  ASSERT_EQ(contours.measured_count(), 1u);
+  ASSERT_EQ(contours.GetContour(0)->length(), 10);
+  ASSERT_EQ(contours.GetContour(1)->length(), 5);
+  ASSERT_EQ(contours.GetContour(2), nullptr);
+  ASSERT_EQ(contours.measured_count(), 2u);
+}
+
+TEST(ContourMeasureCache, UnchangedPathsShareTheirContours) {
+  ContourMeasureCache cache;
+  SkPath path;
+  path.lineTo(0, 10);
+
+  auto contours = cache.GetContours(path, false);
+  SkPath copy = path;
+  ASSERT_EQ(cache.GetContours(copy, false).get(), contours.get());
+  ASSERT_NE(cache.GetContours(path, true).get(), contours.get());
+  ASSERT_EQ(cache.size(), 2u);
+}
+
+TEST(ContourMeasureCache, EditedPathsAreMeasuredAgain) {
+  ContourMeasureCache cache;
+  SkPath path;
+  path.lineTo(0, 10);
+  auto contours = cache.GetContours(path, false);
+  ASSERT_EQ(contours->GetContour(0)->length(), 10);
+
+  path.lineTo(10, 10);
+  auto edited_contours = cache.GetContours(path, false);
+  ASSERT_NE(edited_contours.get(), contours.get());
+  ASSERT_EQ(edited_contours->GetContour(0)->length(), 20);
+  // The contours handed out before the edit are unchanged.
+  ASSERT_EQ(contours->GetContour(0)->length(), 10);
+}
+
+TEST(ContourMeasureCache, LeastRecentlyUsedPathsAreEvicted) {
+  ContourMeasureCache cache;
+  SkPath first;
+  first.lineTo(0, 1);
+  auto first_contours = cache.GetContours(first, false);
+
+  for (size_t i = 0; i < ContourMeasureCache::kMaxEntries; i++) {
+    SkPath path;
+    path.lineTo(0, i + 2);
+    cache.GetContours(path, false);
+  }
+  ASSERT_EQ(cache.size(), ContourMeasureCache::kMaxEntries);
+  ASSERT_NE(cache.GetContours(first, false).get(), first_contours.get());
+}
+
+}  // namespace testing
+}  // namespace flutter
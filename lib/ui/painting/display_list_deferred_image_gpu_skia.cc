@@ -210,7 +210,12 @@ void DlDeferredImageGPUSkia::ImageWrapper::Unregister() {
 
 void DlDeferredImageGPUSkia::ImageWrapper::DeleteTexture() {
   if (texture_.isValid()) {
-    unref_queue_->DeleteTexture(texture_);
+    // Snapshots of the same size, as taken by route transitions, can reuse
+    // the texture while the rasterizer is around.
+    if (!snapshot_delegate_ ||
+        !snapshot_delegate_->RecycleSkiaGpuTexture(texture_)) {
+      unref_queue_->DeleteTexture(texture_);
+    }
     texture_ = GrBackendTexture();
   }
   image_.reset();
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -82,24 +83,45 @@ void ReusableFragmentShader::SetSampler(Dart_Handle index_handle,
   samplers_[index] = sampler->shader(sampling);
   uniform_floats[float_count_ + 2 * index] = sampler->width();
   uniform_floats[float_count_ + 2 * index + 1] = sampler->height();
+  cached_color_source_.reset();
+  cached_uniform_data_.reset();
 }
 
 std::shared_ptr<DlColorSource> ReusableFragmentShader::shader(
     DlImageSampling sampling) {
   FML_CHECK(program_);
 
+  const size_t size = uniform_data_->size();
+  if (cached_color_source_) {
+    if (memcmp(cached_uniform_data_->data(), uniform_data_->bytes(), size) ==
+        0) {
+      return cached_color_source_;
+    }
+    // The cached color source and this object hold the only references to
+    // the snapshot unless a DisplayList, or a shader made from the color
+    // source, captured it. References are only added on the UI thread, so the
+    // snapshot can be overwritten when nobody else holds on to it.
+    if (cached_color_source_.use_count() == 1 &&
+        cached_uniform_data_.use_count() == 2) {
+      memcpy(cached_uniform_data_->data(), uniform_data_->bytes(), size);
+      return cached_color_source_;
+    }
+  }
+
   // The lifetime of this object is longer than a frame, and the uniforms can be
   // continually changed on the UI thread. So we take a copy of the uniforms
   // before handing it to the DisplayList for consumption on the render thread.
-  auto uniform_data = std::make_shared<std::vector<uint8_t>>();
-  uniform_data->resize(uniform_data_->size());
-  memcpy(uniform_data->data(), uniform_data_->bytes(), uniform_data->size());
-
-  return program_->MakeDlColorSource(std::move(uniform_data), samplers_);
+  cached_uniform_data_ = std::make_shared<std::vector<uint8_t>>(
+      uniform_data_->bytes(), uniform_data_->bytes() + size);
+  cached_color_source_ =
+      program_->MakeDlColorSource(cached_uniform_data_, samplers_);
+  return cached_color_source_;
 }
 
 void ReusableFragmentShader::Dispose() {
   uniform_data_.reset();
+  cached_color_source_.reset();
+  cached_uniform_data_.reset();
   program_ = nullptr;
   samplers_.clear();
   ClearDartWrapper();
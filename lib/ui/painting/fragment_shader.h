@@ -49,9 +49,17 @@ class ReusableFragmentShader : public Shader {
                          uint64_t sampler_count);
 
   fml::RefPtr<FragmentProgram> program_;
+  // The uniforms that Dart writes into directly.
   sk_sp<SkData> uniform_data_;
   std::vector<std::shared_ptr<DlColorSource>> samplers_;
   size_t float_count_;
+
+  // The color source returned by the last call to |shader| and the snapshot
+  // of the uniforms that it was made from. Both are reused for as long as the
+  // uniforms do not change, and the snapshot is updated in place when no
+  // DisplayList holds on to it.
+  std::shared_ptr<DlColorSource> cached_color_source_;
+  std::shared_ptr<std::vector<uint8_t>> cached_uniform_data_;
 };
 
 }  // namespace flutter
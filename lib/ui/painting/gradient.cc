@@ -4,6 +4,7 @@
 
 #include "flutter/lib/ui/painting/gradient.h"
 
+#include "flutter/lib/ui/painting/attribute_interner.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
@@ -22,6 +23,25 @@ void CanvasGradient::Create(Dart_Handle wrapper) {
   res->AssociateWithDartWrapper(wrapper);
 }
 
+// Hashes the values that all kinds of gradients are created from.
+static size_t HashGradient(DlColorSourceType type,
+                           const tonic::Int32List& colors,
+                           const tonic::Float32List& color_stops,
+                           SkTileMode tile_mode,
+                           const SkMatrix* matrix) {
+  size_t hash = fml::HashCombine(type, tile_mode);
+  HashCombineValues(hash, colors.data(), colors.num_elements());
+  if (color_stops.data()) {
+    HashCombineValues(hash, color_stops.data(), color_stops.num_elements());
+  }
+  if (matrix) {
+    SkScalar values[9];
+    matrix->get9(values);
+    HashCombineValues(hash, values, 9);
+  }
+  return hash;
+}
+
 void CanvasGradient::initLinear(const tonic::Float32List& end_points,
                                 const tonic::Int32List& colors,
                                 const tonic::Float32List& color_stops,
@@ -46,9 +66,15 @@ void CanvasGradient::initLinear(const tonic::Float32List& end_points,
   SkPoint p1 = SkPoint::Make(end_points[2], end_points[3]);
   const DlColor* colors_array = reinterpret_cast<const DlColor*>(colors.data());
 
-  dl_shader_ = DlColorSource::MakeLinear(
-      p0, p1, colors.num_elements(), colors_array, color_stops.data(),
-      ToDl(tile_mode), has_matrix ? &sk_matrix : nullptr);
+  size_t hash =
+      HashGradient(DlColorSourceType::kLinearGradient, colors, color_stops,
+                   tile_mode, has_matrix ? &sk_matrix : nullptr);
+  HashCombineValues(hash, end_points.data(), 4);
+  dl_shader_ = AttributeInterner::Intern(
+      hash, DlColorSource::MakeLinear(p0, p1, colors.num_elements(),
+                                      colors_array, color_stops.data(),
+                                      ToDl(tile_mode),
+                                      has_matrix ? &sk_matrix : nullptr));
 }
 
 void CanvasGradient::initRadial(double center_x,
@@ -72,10 +98,16 @@ void CanvasGradient::initRadial(double center_x,
 
   const DlColor* colors_array = reinterpret_cast<const DlColor*>(colors.data());
 
-  dl_shader_ = DlColorSource::MakeRadial(
-      SkPoint::Make(center_x, center_y), radius, colors.num_elements(),
-      colors_array, color_stops.data(), ToDl(tile_mode),
-      has_matrix ? &sk_matrix : nullptr);
+  size_t hash =
+      HashGradient(DlColorSourceType::kRadialGradient, colors, color_stops,
+                   tile_mode, has_matrix ? &sk_matrix : nullptr);
+  fml::HashCombineSeed(hash, center_x, center_y, radius);
+  dl_shader_ = AttributeInterner::Intern(
+      hash, DlColorSource::MakeRadial(SkPoint::Make(center_x, center_y),
+                                      radius, colors.num_elements(),
+                                      colors_array, color_stops.data(),
+                                      ToDl(tile_mode),
+                                      has_matrix ? &sk_matrix : nullptr));
 }
 
 void CanvasGradient::initSweep(double center_x,
@@ -100,10 +132,17 @@ void CanvasGradient::initSweep(double center_x,
 
   const DlColor* colors_array = reinterpret_cast<const DlColor*>(colors.data());
 
-  dl_shader_ = DlColorSource::MakeSweep(
-      SkPoint::Make(center_x, center_y), start_angle * 180.0 / M_PI,
-      end_angle * 180.0 / M_PI, colors.num_elements(), colors_array,
-      color_stops.data(), ToDl(tile_mode), has_matrix ? &sk_matrix : nullptr);
+  size_t hash =
+      HashGradient(DlColorSourceType::kSweepGradient, colors, color_stops,
+                   tile_mode, has_matrix ? &sk_matrix : nullptr);
+  fml::HashCombineSeed(hash, center_x, center_y, start_angle, end_angle);
+  dl_shader_ = AttributeInterner::Intern(
+      hash, DlColorSource::MakeSweep(SkPoint::Make(center_x, center_y),
+                                     start_angle * 180.0 / M_PI,
+                                     end_angle * 180.0 / M_PI,
+                                     colors.num_elements(), colors_array,
+                                     color_stops.data(), ToDl(tile_mode),
+                                     has_matrix ? &sk_matrix : nullptr));
 }
 
 void CanvasGradient::initTwoPointConical(double start_x,
@@ -130,11 +169,17 @@ void CanvasGradient::initTwoPointConical(double start_x,
 
   const DlColor* colors_array = reinterpret_cast<const DlColor*>(colors.data());
 
-  dl_shader_ = DlColorSource::MakeConical(
-      SkPoint::Make(start_x, start_y), start_radius,            //
-      SkPoint::Make(end_x, end_y), end_radius,                  //
-      colors.num_elements(), colors_array, color_stops.data(),  //
-      ToDl(tile_mode), has_matrix ? &sk_matrix : nullptr);
+  size_t hash =
+      HashGradient(DlColorSourceType::kConicalGradient, colors, color_stops,
+                   tile_mode, has_matrix ? &sk_matrix : nullptr);
+  fml::HashCombineSeed(hash, start_x, start_y, start_radius, end_x, end_y,
+                       end_radius);
+  dl_shader_ = AttributeInterner::Intern(
+      hash, DlColorSource::MakeConical(
+                SkPoint::Make(start_x, start_y), start_radius,            //
+                SkPoint::Make(end_x, end_y), end_radius,                  //
+                colors.num_elements(), colors_array, color_stops.data(),  //
+                ToDl(tile_mode), has_matrix ? &sk_matrix : nullptr));
 }
 
 CanvasGradient::CanvasGradient() = default;
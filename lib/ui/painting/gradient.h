@@ -57,8 +57,10 @@ class CanvasGradient : public Shader {
                            SkTileMode tile_mode,
                            const tonic::Float64List& matrix4);
 
+  // Gradients do not depend on the sampling, so the interned shader is
+  // shared rather than copied for each paint.
   std::shared_ptr<DlColorSource> shader(DlImageSampling sampling) override {
-    return dl_shader_->with_sampling(sampling);
+    return dl_shader_;
   }
 
  private:
@@ -38,9 +38,14 @@ class ImageDecoder {
   // concurrently. Texture upload is done on the IO thread and the result
   // returned back on the UI thread. On error, the texture is null but the
   // callback is guaranteed to return on the UI thread.
+  //
+  // If `generate_mipmaps` is set, decoders that support it also generate the
+  // mip levels of the texture on the GPU. This should only be requested for
+  // images that are likely to be drawn minified.
   virtual void Decode(fml::RefPtr<ImageDescriptor> descriptor,
                       uint32_t target_width,
                       uint32_t target_height,
+                      bool generate_mipmaps,
                       const ImageResult& result) = 0;
 
   fml::WeakPtr<ImageDecoder> GetWeakPtr() const;
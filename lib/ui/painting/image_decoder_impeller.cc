@@ -5,15 +5,16 @@
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
 
 #include <memory>
+#include <optional>
 
 #include "flutter/fml/closure.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/impeller/display_list/display_list_image_impeller.h"
 #include "flutter/impeller/renderer/allocator.h"
-#include "flutter/impeller/renderer/command_buffer.h"
 #include "flutter/impeller/renderer/context.h"
 #include "flutter/impeller/renderer/texture.h"
+#include "flutter/impeller/renderer/texture_uploader.h"
 #include "flutter/lib/ui/painting/image_decoder_skia.h"
 #include "impeller/base/strings.h"
 #include "impeller/geometry/size.h"
@@ -56,20 +57,22 @@ static std::optional<impeller::PixelFormat> ToPixelFormat(SkColorType type) {
   return std::nullopt;
 }
 
-std::shared_ptr<SkBitmap> ImageDecoderImpeller::DecompressTexture(
+// Returns the info of the image decoded at the generator's supported size
+// closest to the target size, and clamps the target size to the max texture
+// size.
+static std::optional<SkImageInfo> GetDecodeImageInfo(
     ImageDescriptor* descriptor,
-    SkISize target_size,
+    SkISize& target_size,
     impeller::ISize max_texture_size) {
-  TRACE_EVENT0("impeller", __FUNCTION__);
   if (!descriptor) {
     FML_DLOG(ERROR) << "Invalid descriptor.";
-    return nullptr;
+    return std::nullopt;
   }
 
   if (!descriptor->is_compressed()) {
     FML_DLOG(ERROR)
         << "Uncompressed images are not implemented in Impeller yet.";
-    return nullptr;
+    return std::nullopt;
   }
   target_size.set(std::min(static_cast<int32_t>(max_texture_size.width),
                            target_size.width()),
@@ -81,10 +84,6 @@ std::shared_ptr<SkBitmap> ImageDecoderImpeller::DecompressTexture(
       static_cast<double>(target_size.width()) / source_size.width(),
       static_cast<double>(target_size.height()) / source_size.height()));
 
-  //----------------------------------------------------------------------------
-  /// 1. Decode the image into the image generator's closest supported size.
-  ///
-
   const auto base_image_info = descriptor->image_info();
   const auto image_info =
       base_image_info.makeWH(decode_size.width(), decode_size.height())
@@ -95,8 +94,42 @@ std::shared_ptr<SkBitmap> ImageDecoderImpeller::DecompressTexture(
   const auto pixel_format = ToPixelFormat(image_info.colorType());
   if (!pixel_format.has_value()) {
     FML_DLOG(ERROR) << "Codec pixel format not supported by Impeller.";
+    return std::nullopt;
+  }
+  return image_info;
+}
+
+static impeller::TextureDescriptor CreateTextureDescriptor(
+    const SkImageInfo& image_info,
+    impeller::PixelFormat pixel_format,
+    bool generate_mipmaps) {
+  impeller::TextureDescriptor texture_descriptor;
+  texture_descriptor.format = pixel_format;
+  texture_descriptor.size = {image_info.width(), image_info.height()};
+  // Mip levels take up an additional third of memory, so they are only
+  // allocated for images that are expected to be drawn minified.
+  texture_descriptor.mip_count =
+      generate_mipmaps ? texture_descriptor.size.MipCount() : 1u;
+  return texture_descriptor;
+}
+
+std::shared_ptr<SkBitmap> ImageDecoderImpeller::DecompressTexture(
+    ImageDescriptor* descriptor,
+    SkISize target_size,
+    impeller::ISize max_texture_size,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  //----------------------------------------------------------------------------
+  /// 1. Decode the image into the image generator's closest supported size.
+  ///
+
+  const auto decode_image_info =
+      GetDecodeImageInfo(descriptor, target_size, max_texture_size);
+  if (!decode_image_info.has_value()) {
     return nullptr;
   }
+  const auto& image_info = decode_image_info.value();
+  const auto decode_size = image_info.dimensions();
 
   auto bitmap = std::make_shared<SkBitmap>();
   if (!bitmap->tryAllocPixels(image_info)) {
@@ -105,7 +138,7 @@ std::shared_ptr<SkBitmap> ImageDecoderImpeller::DecompressTexture(
     return nullptr;
   }
 
-  if (!descriptor->get_pixels(bitmap->pixmap())) {
+  if (!descriptor->get_pixels(bitmap->pixmap(), concurrent_task_runner)) {
     FML_DLOG(ERROR) << "Could not decompress image.";
     return nullptr;
   }
@@ -139,7 +172,8 @@ std::shared_ptr<SkBitmap> ImageDecoderImpeller::DecompressTexture(
 
 sk_sp<DlImage> ImageDecoderImpeller::UploadTexture(
     const std::shared_ptr<impeller::Context>& context,
-    std::shared_ptr<SkBitmap> bitmap) {
+    std::shared_ptr<SkBitmap> bitmap,
+    bool generate_mipmaps) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   if (!context || !bitmap) {
     return nullptr;
@@ -151,55 +185,83 @@ sk_sp<DlImage> ImageDecoderImpeller::UploadTexture(
     return nullptr;
   }
 
-  impeller::TextureDescriptor texture_descriptor;
-  texture_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
-  texture_descriptor.format = pixel_format.value();
-  texture_descriptor.size = {image_info.width(), image_info.height()};
-  texture_descriptor.mip_count = texture_descriptor.size.MipCount();
+  const auto texture_descriptor = CreateTextureDescriptor(
+      image_info, pixel_format.value(), generate_mipmaps);
 
-  auto texture =
-      context->GetResourceAllocator()->CreateTexture(texture_descriptor);
+  // The pixels are copied into a staging buffer and then blitted into device
+  // private memory. Any mip levels are generated by the same blit pass.
+  const auto& uploader = context->GetTextureUploader();
+  fml::NonOwnedMapping mapping(
+      reinterpret_cast<const uint8_t*>(bitmap->getAddr(0, 0)),  // data
+      texture_descriptor.GetByteSizeOfBaseMipLevel()            // size
+  );
+  auto texture = uploader->Upload(texture_descriptor, mapping);
   if (!texture) {
-    FML_DLOG(ERROR) << "Could not create Impeller texture.";
+    FML_DLOG(ERROR) << "Could not upload Impeller texture.";
     return nullptr;
   }
 
-  auto mapping = std::make_shared<fml::NonOwnedMapping>(
-      reinterpret_cast<const uint8_t*>(bitmap->getAddr(0, 0)),  // data
-      texture_descriptor.GetByteSizeOfBaseMipLevel(),           // size
-      [bitmap](auto, auto) mutable { bitmap.reset(); }          // proc
-  );
+  texture->SetLabel(impeller::SPrintF("ui.Image(%p)", texture.get()).c_str());
+
+  if (!uploader->Flush()) {
+    FML_DLOG(ERROR) << "Failed to submit texture upload command buffer.";
+    return nullptr;
+  }
+
+  return impeller::DlImageImpeller::Make(std::move(texture));
+}
+
+sk_sp<DlImage> ImageDecoderImpeller::DecompressAndUploadTexture(
+    const std::shared_ptr<impeller::Context>& context,
+    ImageDescriptor* descriptor,
+    SkISize target_size,
+    bool generate_mipmaps,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (!context) {
+    return nullptr;
+  }
+  const auto max_texture_size =
+      context->GetResourceAllocator()->GetMaxTextureSizeSupported();
+  const auto decode_image_info =
+      GetDecodeImageInfo(descriptor, target_size, max_texture_size);
+  if (!decode_image_info.has_value()) {
+    return nullptr;
+  }
+  const auto& image_info = decode_image_info.value();
+
+  if (image_info.dimensions() != target_size) {
+    // Images that need to be resized are decoded into an intermediate bitmap
+    // first.
+    return UploadTexture(context,
+                         DecompressTexture(descriptor, target_size,
+                                           max_texture_size,
+                                           concurrent_task_runner),
+                         generate_mipmaps);
+  }
 
-  if (!texture->SetContents(mapping)) {
-    FML_DLOG(ERROR) << "Could not copy contents into Impeller texture.";
+  // Decode straight into the staging memory of the upload, which saves a copy
+  // and an allocation of the size of the image.
+  const auto texture_descriptor = CreateTextureDescriptor(
+      image_info, ToPixelFormat(image_info.colorType()).value(),
+      generate_mipmaps);
+  const auto& uploader = context->GetTextureUploader();
+  auto texture = uploader->Upload(
+      texture_descriptor,
+      [descriptor, &image_info, &concurrent_task_runner](uint8_t* contents) {
+        SkPixmap pixmap(image_info, contents, image_info.minRowBytes());
+        return descriptor->get_pixels(pixmap, concurrent_task_runner);
+      });
+  if (!texture) {
+    FML_DLOG(ERROR) << "Could not decompress image into an Impeller texture.";
     return nullptr;
   }
 
   texture->SetLabel(impeller::SPrintF("ui.Image(%p)", texture.get()).c_str());
 
-  {
-    auto command_buffer = context->CreateCommandBuffer();
-    command_buffer->SetLabel("Mipmap Command Buffer");
-    if (!command_buffer) {
-      FML_DLOG(ERROR)
-          << "Could not create command buffer for mipmap generation.";
-      return nullptr;
-    }
-
-    auto blit_pass = command_buffer->CreateBlitPass();
-    blit_pass->SetLabel("Mipmap Blit Pass");
-    if (!blit_pass) {
-      FML_DLOG(ERROR) << "Could not create blit pass for mipmap generation.";
-      return nullptr;
-    }
-
-    blit_pass->GenerateMipmap(texture);
-
-    blit_pass->EncodeCommands(context->GetResourceAllocator());
-    if (!command_buffer->SubmitCommands()) {
-      FML_DLOG(ERROR) << "Failed to submit blit pass command buffer.";
-      return nullptr;
-    }
+  if (!uploader->Flush()) {
+    FML_DLOG(ERROR) << "Failed to submit texture upload command buffer.";
+    return nullptr;
   }
 
   return impeller::DlImageImpeller::Make(std::move(texture));
@@ -209,6 +271,7 @@ sk_sp<DlImage> ImageDecoderImpeller::UploadTexture(
 void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
                                   uint32_t target_width,
                                   uint32_t target_height,
+                                  bool generate_mipmaps,
                                   const ImageResult& p_result) {
   FML_DCHECK(descriptor);
   FML_DCHECK(p_result);
@@ -231,20 +294,32 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
        context = context_.get(),                                  //
        target_size = SkISize::Make(target_width, target_height),  //
        io_runner = runners_.GetIOTaskRunner(),                    //
+       concurrent_task_runner = concurrent_task_runner_,          //
+       generate_mipmaps,                                          //
        result                                                     //
   ]() {
+        if (!context->HasThreadingRestrictions()) {
+          // Decompress straight into the staging memory of the upload.
+          result(DecompressAndUploadTexture(context, raw_descriptor,
+                                            target_size, generate_mipmaps,
+                                            concurrent_task_runner));
+          return;
+        }
+
         auto max_size_supported =
             context->GetResourceAllocator()->GetMaxTextureSizeSupported();
 
         // Always decompress on the concurrent runner.
-        auto bitmap =
-            DecompressTexture(raw_descriptor, target_size, max_size_supported);
+        auto bitmap = DecompressTexture(raw_descriptor, target_size,
+                                        max_size_supported,
+                                        concurrent_task_runner);
         if (!bitmap) {
           result(nullptr);
           return;
         }
-        auto upload_texture_and_invoke_result = [result, context, bitmap]() {
-          result(UploadTexture(context, bitmap));
+        auto upload_texture_and_invoke_result = [result, context, bitmap,
+                                                 generate_mipmaps]() {
+          result(UploadTexture(context, bitmap, generate_mipmaps));
         };
         // Depending on whether the context has threading restrictions, stay on
         // the concurrent runner to perform texture upload or move to an IO
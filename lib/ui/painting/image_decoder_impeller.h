@@ -30,16 +30,31 @@ class ImageDecoderImpeller final : public ImageDecoder {
   void Decode(fml::RefPtr<ImageDescriptor> descriptor,
               uint32_t target_width,
               uint32_t target_height,
+              bool generate_mipmaps,
               const ImageResult& result) override;
 
   static std::shared_ptr<SkBitmap> DecompressTexture(
       ImageDescriptor* descriptor,
       SkISize target_size,
-      impeller::ISize max_texture_size);
+      impeller::ISize max_texture_size,
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner =
+          nullptr);
 
   static sk_sp<DlImage> UploadTexture(
       const std::shared_ptr<impeller::Context>& context,
-      std::shared_ptr<SkBitmap> bitmap);
+      std::shared_ptr<SkBitmap> bitmap,
+      bool generate_mipmaps);
+
+  /// Decompresses the image straight into the staging memory of its texture
+  /// upload when the image does not need to be resized, and through an
+  /// intermediate bitmap otherwise.
+  static sk_sp<DlImage> DecompressAndUploadTexture(
+      const std::shared_ptr<impeller::Context>& context,
+      ImageDescriptor* descriptor,
+      SkISize target_size,
+      bool generate_mipmaps,
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner =
+          nullptr);
 
  private:
   using FutureContext = std::shared_future<std::shared_ptr<impeller::Context>>;
@@ -94,18 +94,40 @@ static sk_sp<SkImage> ImageFromDecompressedData(
                            flow);
 }
 
+static sk_sp<SkImage> DecodeRasterImage(
+    ImageDescriptor* descriptor,
+    const SkImageInfo& image_info,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner) {
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(image_info)) {
+    FML_LOG(ERROR) << "Failed to allocate memory for bitmap of size "
+                   << image_info.computeMinByteSize() << "B";
+    return nullptr;
+  }
+
+  if (!descriptor->get_pixels(bitmap.pixmap(), concurrent_task_runner)) {
+    return nullptr;
+  }
+
+  // Marking this as immutable makes the MakeFromBitmap call share the pixels
+  // instead of copying.
+  bitmap.setImmutable();
+  return SkImage::MakeFromBitmap(bitmap);
+}
+
 sk_sp<SkImage> ImageDecoderSkia::ImageFromCompressedData(
     ImageDescriptor* descriptor,
     uint32_t target_width,
     uint32_t target_height,
-    const fml::tracing::TraceFlow& flow) {
+    const fml::tracing::TraceFlow& flow,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   flow.Step(__FUNCTION__);
 
   if (!descriptor->should_resize(target_width, target_height)) {
     // No resizing requested. Just decode & rasterize the image.
-    sk_sp<SkImage> image = descriptor->image();
-    return image ? image->makeRasterImage() : nullptr;
+    return DecodeRasterImage(descriptor, descriptor->image_info(),
+                             concurrent_task_runner);
   }
 
   const SkISize source_dimensions = descriptor->image_info().dimensions();
@@ -124,26 +146,9 @@ sk_sp<SkImage> ImageDecoderSkia::ImageFromCompressedData(
     auto scaled_image_info =
         descriptor->image_info().makeDimensions(decode_dimensions);
 
-    SkBitmap scaled_bitmap;
-    if (!scaled_bitmap.tryAllocPixels(scaled_image_info)) {
-      FML_LOG(ERROR) << "Failed to allocate memory for bitmap of size "
-                     << scaled_image_info.computeMinByteSize() << "B";
-      return nullptr;
-    }
-
-    const auto& pixmap = scaled_bitmap.pixmap();
-    if (descriptor->get_pixels(pixmap)) {
-      // Marking this as immutable makes the MakeFromBitmap call share
-      // the pixels instead of copying.
-      scaled_bitmap.setImmutable();
-
-      auto decoded_image = SkImage::MakeFromBitmap(scaled_bitmap);
-      FML_DCHECK(decoded_image);
-      if (!decoded_image) {
-        FML_LOG(ERROR)
-            << "Could not create a scaled image from a scaled bitmap.";
-        return nullptr;
-      }
+    auto decoded_image = DecodeRasterImage(descriptor, scaled_image_info,
+                                           concurrent_task_runner);
+    if (decoded_image) {
       return ResizeRasterImage(decoded_image, resized_dimensions, flow);
     }
   }
@@ -216,6 +221,7 @@ static SkiaGPUObject<SkImage> UploadRasterImage(
 void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
                               uint32_t target_width,
                               uint32_t target_height,
+                              bool generate_mipmaps,
                               const ImageResult& callback) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   fml::tracing::TraceFlow flow(__FUNCTION__);
@@ -261,22 +267,23 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
   }
 
   concurrent_task_runner_->PostTask(
-      fml::MakeCopyable([raw_descriptor,                          //
-                         io_manager = io_manager_,                //
-                         io_runner = runners_.GetIOTaskRunner(),  //
-                         result,                                  //
-                         target_width = target_width,             //
-                         target_height = target_height,           //
-                         flow = std::move(flow)                   //
+      fml::MakeCopyable([raw_descriptor,                                    //
+                         io_manager = io_manager_,                          //
+                         io_runner = runners_.GetIOTaskRunner(),            //
+                         concurrent_task_runner = concurrent_task_runner_,  //
+                         result,                                            //
+                         target_width = target_width,                       //
+                         target_height = target_height,                     //
+                         flow = std::move(flow)                             //
   ]() mutable {
         // Step 1: Decompress the image.
         // On Worker.
 
         auto decompressed = raw_descriptor->is_compressed()
-                                ? ImageFromCompressedData(raw_descriptor,  //
-                                                          target_width,    //
-                                                          target_height,   //
-                                                          flow)
+                                ? ImageFromCompressedData(
+                                      raw_descriptor, target_width,
+                                      target_height, flow,
+                                      concurrent_task_runner)
                                 : ImageFromDecompressedData(raw_descriptor,  //
                                                             target_width,    //
                                                             target_height,   //
@@ -309,17 +316,36 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
             return;
           }
 
-          auto uploaded =
-              UploadRasterImage(std::move(decompressed), io_manager, flow);
+          auto upload = fml::MakeCopyable([io_manager, decompressed, result,
+                                           flow = std::move(flow)]() mutable {
+            if (!io_manager) {
+              FML_DLOG(ERROR) << "Could not acquire IO manager.";
+              result({}, std::move(flow));
+              return;
+            }
 
-          if (!uploaded.skia_object()) {
-            FML_DLOG(ERROR) << "Could not upload image to the GPU.";
-            result({}, std::move(flow));
+            auto uploaded =
+                UploadRasterImage(std::move(decompressed), io_manager, flow);
+
+            if (!uploaded.skia_object()) {
+              FML_DLOG(ERROR) << "Could not upload image to the GPU.";
+              result({}, std::move(flow));
+              return;
+            }
+
+            // Finally, all done.
+            result(std::move(uploaded), std::move(flow));
+          });
+
+          // Let the upload queue batch and throttle the upload if there is
+          // one.
+          auto upload_queue = io_manager->GetTextureUploadQueue();
+          if (!upload_queue) {
+            upload();
             return;
           }
-
-          // Finally, all done.
-          result(std::move(uploaded), std::move(flow));
+          upload_queue->Enqueue(decompressed->imageInfo().computeMinByteSize(),
+                                std::move(upload));
         }));
       }));
 }
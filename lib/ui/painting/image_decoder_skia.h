@@ -23,13 +23,16 @@ class ImageDecoderSkia final : public ImageDecoder {
   void Decode(fml::RefPtr<ImageDescriptor> descriptor,
               uint32_t target_width,
               uint32_t target_height,
+              bool generate_mipmaps,
               const ImageResult& result) override;
 
   static sk_sp<SkImage> ImageFromCompressedData(
       ImageDescriptor* descriptor,
       uint32_t target_width,
       uint32_t target_height,
-      const fml::tracing::TraceFlow& flow);
+      const fml::tracing::TraceFlow& flow,
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner =
+          nullptr);
 
  private:
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoderSkia);
@@ -211,7 +211,8 @@ TEST_F(ImageDecoderFixtureTest, InvalidImageResultsError) {
       ASSERT_FALSE(image);
       latch.Signal();
     };
-    decoder->Decode(image_descriptor, 0, 0, callback);
+    decoder->Decode(image_descriptor, 0, 0, /*generate_mipmaps=*/false,
+                    callback);
   });
   latch.Wait();
 }
@@ -260,7 +261,7 @@ TEST_F(ImageDecoderFixtureTest, ValidImageResultsInSuccess) {
     };
     EXPECT_FALSE(io_manager->did_access_is_gpu_disabled_sync_switch_);
     image_decoder->Decode(descriptor, descriptor->width(), descriptor->height(),
-                          callback);
+                          /*generate_mipmaps=*/false, callback);
   };
 
   auto setup_io_manager_and_decode = [&]() {
@@ -317,7 +318,7 @@ TEST_F(ImageDecoderFixtureTest, ExifDataIsRespectedOnDecode) {
       runners.GetIOTaskRunner()->PostTask(release_io_manager);
     };
     image_decoder->Decode(descriptor, descriptor->width(), descriptor->height(),
-                          callback);
+                          /*generate_mipmaps=*/false, callback);
   };
 
   auto setup_io_manager_and_decode = [&]() {
@@ -376,7 +377,7 @@ TEST_F(ImageDecoderFixtureTest, CanDecodeWithoutAGPUContext) {
       runners.GetIOTaskRunner()->PostTask(release_io_manager);
     };
     image_decoder->Decode(descriptor, descriptor->width(), descriptor->height(),
-                          callback);
+                          /*generate_mipmaps=*/false, callback);
   };
 
   auto setup_io_manager_and_decode = [&]() {
@@ -447,7 +448,8 @@ TEST_F(ImageDecoderFixtureTest, CanDecodeWithResizes) {
         final_size = image->skia_image()->dimensions();
         latch.Signal();
       };
-      image_decoder->Decode(descriptor, target_width, target_height, callback);
+      image_decoder->Decode(descriptor, target_width, target_height,
+                            /*generate_mipmaps=*/false, callback);
     });
     latch.Wait();
     return final_size;
@@ -518,6 +520,51 @@ TEST(ImageDecoderTest, VerifySimpleDecoding) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+TEST(ImageDecoderTest, VerifyRowDecodingMatchesFullDecoding) {
+  auto data = OpenFixtureAsSkData("DashInNooglerHat.jpg");
+  ASSERT_TRUE(data);
+
+  ImageGeneratorRegistry registry;
+  auto generator = registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+  ASSERT_TRUE(generator->CanDecodeRows());
+
+  const auto info = generator->GetInfo().makeColorType(kRGBA_8888_SkColorType);
+  SkBitmap expected;
+  ASSERT_TRUE(expected.tryAllocPixels(info));
+  ASSERT_TRUE(generator->GetPixels(info, expected.getPixels(),
+                                   expected.rowBytes()));
+
+  SkBitmap bands;
+  ASSERT_TRUE(bands.tryAllocPixels(info));
+  const int band_count = 3;
+  const int rows_per_band = (info.height() + band_count - 1) / band_count;
+  for (int band = band_count - 1; band >= 0; band--) {
+    const int first_row = band * rows_per_band;
+    const int row_count = std::min(rows_per_band, info.height() - first_row);
+    ASSERT_TRUE(generator->GetPixelRows(info, bands.getAddr(0, first_row),
+                                        bands.rowBytes(), first_row,
+                                        row_count));
+  }
+
+  for (int y = 0; y < info.height(); y++) {
+    ASSERT_EQ(memcmp(expected.getAddr(0, y), bands.getAddr(0, y),
+                     info.minRowBytes()),
+              0)
+        << "Row " << y << " differs.";
+  }
+}
+
+TEST(ImageDecoderTest, OrientedImagesAreNotDecodedInRows) {
+  auto data = OpenFixtureAsSkData("Horizontal.jpg");
+  ASSERT_TRUE(data);
+
+  ImageGeneratorRegistry registry;
+  auto generator = registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+  ASSERT_FALSE(generator->CanDecodeRows());
+}
+
 TEST(ImageDecoderTest, VerifySubpixelDecodingPreservesExifOrientation) {
   auto data = OpenFixtureAsSkData("Horizontal.jpg");
 
@@ -4,8 +4,12 @@
 
 #include "flutter/lib/ui/painting/image_descriptor.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/painting/multi_frame_codec.h"
 #include "flutter/lib/ui/painting/single_frame_codec.h"
@@ -104,12 +108,13 @@ void ImageDescriptor::initRaw(Dart_Handle descriptor_handle,
 
 void ImageDescriptor::instantiateCodec(Dart_Handle codec_handle,
                                        int target_width,
-                                       int target_height) {
+                                       int target_height,
+                                       bool generate_mipmaps) {
   fml::RefPtr<Codec> ui_codec;
   if (!generator_ || generator_->GetFrameCount() == 1) {
     ui_codec = fml::MakeRefCounted<SingleFrameCodec>(
         static_cast<fml::RefPtr<ImageDescriptor>>(this), target_width,
-        target_height);
+        target_height, generate_mipmaps);
   } else {
     ui_codec = fml::MakeRefCounted<MultiFrameCodec>(generator_);
   }
@@ -126,4 +131,67 @@ bool ImageDescriptor::get_pixels(const SkPixmap& pixmap) const {
                                pixmap.rowBytes());
 }
 
+// The codec of every band parses the headers and skips the rows above the band
+// again, so smaller images are decoded in a single band.
+static constexpr int64_t kMinParallelDecodePixels = 4 * 1024 * 1024;
+static constexpr int kMinRowsPerBand = 256;
+static constexpr int kMaxBandCount = 4;
+
+bool ImageDescriptor::get_pixels(
+    const SkPixmap& pixmap,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner)
+    const {
+  FML_DCHECK(generator_);
+  const int height = pixmap.height();
+  const int band_count = std::min(kMaxBandCount, height / kMinRowsPerBand);
+  if (!concurrent_task_runner || !generator_->CanDecodeRows() ||
+      static_cast<int64_t>(pixmap.width()) * height <
+          kMinParallelDecodePixels ||
+      band_count < 2) {
+    return get_pixels(pixmap);
+  }
+  TRACE_EVENT0("flutter", "ImageDescriptor::DecodeBands");
+
+  struct Bands {
+    explicit Bands(int p_count) : count(p_count), latch(p_count) {}
+
+    const int count;
+    std::atomic<int> next{0};
+    std::atomic<bool> failed{false};
+    fml::CountDownLatch latch;
+  };
+  auto bands = std::make_shared<Bands>(band_count);
+  const int rows_per_band = (height + band_count - 1) / band_count;
+
+  // Bands are claimed by whichever thread gets to them first. The calling
+  // thread only waits for bands that other threads are already decoding, so
+  // it cannot wait on a task that is queued behind it.
+  auto decode_bands = [bands, generator = generator_, pixmap, rows_per_band]() {
+    int band;
+    while ((band = bands->next.fetch_add(1)) < bands->count) {
+      const int first_row = band * rows_per_band;
+      const int row_count =
+          std::min(rows_per_band, pixmap.height() - first_row);
+      if (row_count > 0 &&
+          !generator->GetPixelRows(pixmap.info(),
+                                   pixmap.writable_addr(0, first_row),
+                                   pixmap.rowBytes(), first_row, row_count)) {
+        bands->failed = true;
+      }
+      bands->latch.CountDown();
+    }
+  };
+  for (int i = 1; i < band_count; i++) {
+    concurrent_task_runner->PostTask(decode_bands);
+  }
+  decode_bands();
+  bands->latch.Wait();
+
+  if (bands->failed) {
+    FML_DLOG(ERROR) << "Could not decode the image in bands.";
+    return get_pixels(pixmap);
+  }
+  return true;
+}
+
 }  // namespace flutter
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/painting/image_generator_registry.h"
@@ -58,7 +59,10 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
                       PixelFormat pixel_format);
 
   /// @brief  Associates a flutter::Codec object with the dart.ui Codec handle.
-  void instantiateCodec(Dart_Handle codec, int target_width, int target_height);
+  void instantiateCodec(Dart_Handle codec,
+                        int target_width,
+                        int target_height,
+                        bool generate_mipmaps);
 
   /// @brief  The width of this image, EXIF oriented if applicable.
   int width() const { return image_info_.width(); }
@@ -108,6 +112,16 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
   ///         orientation tag, if applicable.
   bool get_pixels(const SkPixmap& pixmap) const;
 
+  /// @brief  Gets pixels for this image like `get_pixels`, but splits large
+  ///         images whose generator can decode bands of rows independently
+  ///         into bands that are decoded in parallel on
+  ///         `concurrent_task_runner`. The calling thread decodes bands too
+  ///         and returns once all the bands have been decoded.
+  bool get_pixels(
+      const SkPixmap& pixmap,
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner)
+      const;
+
   void dispose() {
     buffer_.reset();
     generator_.reset();
@@ -115,32 +115,55 @@ void ConvertImageToRaster(
       return;
     }
 
-    sk_sp<SkImage> raster_image =
-        snapshot_delegate->ConvertToRasterImage(image);
-
-    io_task_runner->PostTask([image, encode_task = encode_task,
-                              raster_image = std::move(raster_image),
-                              resource_context, is_gpu_disabled_sync_switch,
-                              owning_context = dl_image->owning_context(),
-                              raster_task_runner]() mutable {
-      if (!raster_image) {
-        // The rasterizer was unable to render the cross-context image
-        // (presumably because it does not have a GrContext).  In that case,
-        // convert the image on the IO thread using the resource context.
-        raster_image = ConvertToRasterUsingResourceContext(
-            image, resource_context, is_gpu_disabled_sync_switch);
-      }
-      encode_task(raster_image);
-      if (owning_context == DlImage::OwningContext::kRaster) {
-        raster_task_runner->PostTask([image = std::move(image)]() {});
-      }
-    });
+    // The pixels are read back without blocking the raster thread, the
+    // callback is invoked on the raster thread once they are available.
+    snapshot_delegate->ConvertToRasterImageAsync(
+        image, [image, encode_task, resource_context, io_task_runner,
+                is_gpu_disabled_sync_switch,
+                owning_context = dl_image->owning_context(),
+                raster_task_runner](sk_sp<SkImage> raster_image) {
+          io_task_runner->PostTask([image, encode_task = encode_task,
+                                    raster_image = std::move(raster_image),
+                                    resource_context,
+                                    is_gpu_disabled_sync_switch, owning_context,
+                                    raster_task_runner]() mutable {
+            if (!raster_image) {
+              // The rasterizer was unable to render the cross-context image
+              // (presumably because it does not have a GrContext).  In that
+              // case, convert the image on the IO thread using the resource
+              // context.
+              raster_image = ConvertToRasterUsingResourceContext(
+                  image, resource_context, is_gpu_disabled_sync_switch);
+            }
+            encode_task(raster_image);
+            if (owning_context == DlImage::OwningContext::kRaster) {
+              raster_task_runner->PostTask([image = std::move(image)]() {});
+            }
+          });
+        });
   });
 }
 
+// Wraps the tightly packed pixels of `pixmap` without copying them. The data
+// keeps `owner`, which owns the pixels, alive.
+template <typename T>
+sk_sp<SkData> WrapPixels(const SkPixmap& pixmap, sk_sp<T> owner) {
+  return SkData::MakeWithProc(
+      pixmap.addr(), pixmap.computeByteSize(),
+      [](const void* pixels, void* context) {
+        reinterpret_cast<T*>(context)->unref();
+      },
+      owner.release());
+}
+
+// Returns the pixels of the raster image in the given color and alpha type.
+// If `can_share_pixels` is true, the pixels of the raster image are not used
+// by anything else and are handed back without a copy when they already have
+// the right format.
 sk_sp<SkData> CopyImageByteData(const sk_sp<SkImage>& raster_image,
                                 SkColorType color_type,
-                                SkAlphaType alpha_type) {
+                                SkAlphaType alpha_type,
+                                bool can_share_pixels) {
   FML_DCHECK(raster_image);
 
   SkPixmap pixmap;
@@ -152,6 +175,9 @@ sk_sp<SkData> CopyImageByteData(const sk_sp<SkImage>& raster_image,
 
   // The color types already match. No need to swizzle. Return early.
   if (pixmap.colorType() == color_type && pixmap.alphaType() == alpha_type) {
+    if (can_share_pixels && pixmap.rowBytes() == pixmap.info().minRowBytes()) {
+      return WrapPixels(pixmap, raster_image);
+    }
     return SkData::MakeWithCopy(pixmap.addr(), pixmap.computeByteSize());
   }
 
@@ -172,11 +198,14 @@ sk_sp<SkData> CopyImageByteData(const sk_sp<SkImage>& raster_image,
     return nullptr;
   }
 
-  return SkData::MakeWithCopy(pixmap.addr(), pixmap.computeByteSize());
+  // The surface is only used for the swizzle, so its pixels are handed back
+  // as they are.
+  return WrapPixels(pixmap, std::move(surface));
 }
 
 sk_sp<SkData> EncodeImage(const sk_sp<SkImage>& raster_image,
-                          ImageByteFormat format) {
+                          ImageByteFormat format,
+                          bool can_share_pixels) {
   TRACE_EVENT0("flutter", __FUNCTION__);
 
   if (!raster_image) {
@@ -196,15 +225,15 @@ sk_sp<SkData> EncodeImage(const sk_sp<SkImage>& raster_image,
     } break;
     case kRawRGBA: {
       return CopyImageByteData(raster_image, kRGBA_8888_SkColorType,
-                               kPremul_SkAlphaType);
+                               kPremul_SkAlphaType, can_share_pixels);
     } break;
     case kRawStraightRGBA: {
       return CopyImageByteData(raster_image, kRGBA_8888_SkColorType,
-                               kUnpremul_SkAlphaType);
+                               kUnpremul_SkAlphaType, can_share_pixels);
     } break;
     case kRawUnmodified: {
       return CopyImageByteData(raster_image, raster_image->colorType(),
-                               raster_image->alphaType());
+                               raster_image->alphaType(), can_share_pixels);
     } break;
   }
 
@@ -219,26 +248,47 @@ void EncodeImageAndInvokeDataCallback(
     const fml::RefPtr<fml::TaskRunner>& ui_task_runner,
     const fml::RefPtr<fml::TaskRunner>& raster_task_runner,
     const fml::RefPtr<fml::TaskRunner>& io_task_runner,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner,
     const fml::WeakPtr<GrDirectContext>& resource_context,
     const fml::TaskRunnerAffineWeakPtr<SnapshotDelegate>& snapshot_delegate,
     const std::shared_ptr<const fml::SyncSwitch>& is_gpu_disabled_sync_switch) {
+  FML_DCHECK(image);
   auto callback_task = fml::MakeCopyable(
       [callback = std::move(callback)](sk_sp<SkData> encoded) mutable {
         InvokeDataCallback(std::move(callback), std::move(encoded));
       });
+  // Raster images that are the image itself rather than a copy made for
+  // the encoding must not be handed to Dart, which could modify them.
+  sk_sp<SkImage> shared_image =
+      image->owning_context() != DlImage::OwningContext::kRaster
+          ? image->skia_image()
+          : nullptr;
   // The static leak checker gets confused by the use of fml::MakeCopyable in
   // EncodeImage.
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
   auto encode_task = [callback_task = std::move(callback_task), format,
-                      ui_task_runner](const sk_sp<SkImage>& raster_image) {
-    sk_sp<SkData> encoded = EncodeImage(raster_image, format);
-    ui_task_runner->PostTask([callback_task = callback_task,
-                              encoded = std::move(encoded)]() mutable {
-      callback_task(std::move(encoded));
-    });
+                      shared_image = std::move(shared_image), ui_task_runner,
+                      concurrent_task_runner](
+                         const sk_sp<SkImage>& raster_image) {
+    auto encode = [callback_task, format, raster_image,
+                   can_share_pixels = raster_image != shared_image,
+                   ui_task_runner]() {
+      sk_sp<SkData> encoded =
+          EncodeImage(raster_image, format, can_share_pixels);
+      ui_task_runner->PostTask([callback_task = callback_task,
+                                encoded = std::move(encoded)]() mutable {
+        callback_task(std::move(encoded));
+      });
+    };
+    // Encoding large images takes a while, so it happens on the concurrent
+    // workers instead of holding up the IO thread.
+    if (raster_image && concurrent_task_runner) {
+      concurrent_task_runner->PostTask(encode);
+    } else {
+      encode();
+    }
   };
 
-  FML_DCHECK(image);
   ConvertImageToRaster(image, encode_task, raster_task_runner, io_task_runner,
                        resource_context, snapshot_delegate,
                        is_gpu_disabled_sync_switch);
@@ -271,12 +321,14 @@ Dart_Handle EncodeImage(CanvasImage* canvas_image,
        image_format, ui_task_runner = task_runners.GetUITaskRunner(),
        raster_task_runner = task_runners.GetRasterTaskRunner(),
        io_task_runner = task_runners.GetIOTaskRunner(),
+       concurrent_task_runner =
+           UIDartState::Current()->GetConcurrentTaskRunner(),
        io_manager = UIDartState::Current()->GetIOManager(),
        snapshot_delegate =
            UIDartState::Current()->GetSnapshotDelegate()]() mutable {
         EncodeImageAndInvokeDataCallback(
             image, std::move(callback), image_format, ui_task_runner,
-            raster_task_runner, io_task_runner,
+            raster_task_runner, io_task_runner, concurrent_task_runner,
             io_manager->GetResourceContext(), snapshot_delegate,
             io_manager->GetIsGpuDisabledSyncSwitch());
       }));
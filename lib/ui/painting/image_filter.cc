@@ -4,6 +4,7 @@
 
 #include "flutter/lib/ui/painting/image_filter.h"
 
+#include "flutter/lib/ui/painting/attribute_interner.h"
 #include "flutter/lib/ui/painting/matrix.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -53,35 +54,54 @@ ImageFilter::~ImageFilter() {}
 void ImageFilter::initBlur(double sigma_x,
                            double sigma_y,
                            SkTileMode tile_mode) {
-  filter_ =
-      std::make_shared<DlBlurImageFilter>(sigma_x, sigma_y, ToDl(tile_mode));
+  size_t hash = fml::HashCombine(DlImageFilterType::kBlur, sigma_x, sigma_y,
+                                 tile_mode);
+  filter_ = AttributeInterner::Intern(
+      hash, DlBlurImageFilter(sigma_x, sigma_y, ToDl(tile_mode)));
 }
 
 void ImageFilter::initDilate(double radius_x, double radius_y) {
-  filter_ = std::make_shared<DlDilateImageFilter>(radius_x, radius_y);
+  size_t hash =
+      fml::HashCombine(DlImageFilterType::kDilate, radius_x, radius_y);
+  filter_ =
+      AttributeInterner::Intern(hash, DlDilateImageFilter(radius_x, radius_y));
 }
 
 void ImageFilter::initErode(double radius_x, double radius_y) {
-  filter_ = std::make_shared<DlErodeImageFilter>(radius_x, radius_y);
+  size_t hash = fml::HashCombine(DlImageFilterType::kErode, radius_x, radius_y);
+  filter_ =
+      AttributeInterner::Intern(hash, DlErodeImageFilter(radius_x, radius_y));
 }
 
 void ImageFilter::initMatrix(const tonic::Float64List& matrix4,
                              int filterQualityIndex) {
   auto sampling = ImageFilter::SamplingFromIndex(filterQualityIndex);
+  SkMatrix sk_matrix = ToSkMatrix(matrix4);
+  SkScalar values[9];
+  sk_matrix.get9(values);
+  size_t hash = fml::HashCombine(DlImageFilterType::kMatrix, sampling);
+  HashCombineValues(hash, values, 9);
   filter_ =
-      std::make_shared<DlMatrixImageFilter>(ToSkMatrix(matrix4), sampling);
+      AttributeInterner::Intern(hash, DlMatrixImageFilter(sk_matrix, sampling));
 }
 
 void ImageFilter::initColorFilter(ColorFilter* colorFilter) {
   FML_DCHECK(colorFilter);
-  filter_ =
-      std::make_shared<DlColorFilterImageFilter>(colorFilter->dl_filter());
+  const DlColorFilter* color_filter = colorFilter->dl_filter();
+  size_t hash =
+      fml::HashCombine(DlImageFilterType::kColorFilter, color_filter);
+  filter_ = AttributeInterner::Intern(
+      hash, DlColorFilterImageFilter(color_filter));
 }
 
 void ImageFilter::initComposeFilter(ImageFilter* outer, ImageFilter* inner) {
   FML_DCHECK(outer && inner);
-  filter_ = std::make_shared<DlComposeImageFilter>(outer->dl_filter(),
-                                                   inner->dl_filter());
+  const DlImageFilter* outer_filter = outer->dl_filter();
+  const DlImageFilter* inner_filter = inner->dl_filter();
+  size_t hash = fml::HashCombine(DlImageFilterType::kComposeFilter,
+                                 outer_filter, inner_filter);
+  filter_ = AttributeInterner::Intern(
+      hash, DlComposeImageFilter(outer_filter, inner_filter));
 }
 
 }  // namespace flutter
@@ -4,6 +4,7 @@
 
 #include "flutter/lib/ui/painting/image_generator.h"
 
+#include <cstring>
 #include <utility>
 
 #include "flutter/fml/logging.h"
@@ -12,6 +13,18 @@ namespace flutter {
 
 ImageGenerator::~ImageGenerator() = default;
 
+bool ImageGenerator::CanDecodeRows() const {
+  return false;
+}
+
+bool ImageGenerator::GetPixelRows(const SkImageInfo& info,
+                                  void* pixels,
+                                  size_t row_bytes,
+                                  int first_row,
+                                  int row_count) const {
+  return false;
+}
+
 sk_sp<SkImage> ImageGenerator::GetImage() {
   SkImageInfo info = GetInfo();
 
@@ -79,6 +92,41 @@ std::unique_ptr<ImageGenerator> BuiltinSkiaImageGenerator::MakeFromGenerator(
 
 BuiltinSkiaCodecImageGenerator::~BuiltinSkiaCodecImageGenerator() = default;
 
+// The rows of an interlaced PNG are stored in passes over the whole image, so
+// the codec of every band would have to decode the entire image.
+static bool IsInterlacedPNG(const SkData& data) {
+  // The interlace method follows the signature, the length and type of the
+  // IHDR chunk and the width, height, bit depth, color type, compression
+  // method and filter method of the image.
+  constexpr size_t kIHDRTypeOffset = 12;
+  constexpr size_t kInterlaceMethodOffset = 28;
+  if (data.size() <= kInterlaceMethodOffset) {
+    return true;
+  }
+  const auto* bytes = data.bytes();
+  return memcmp(bytes + kIHDRTypeOffset, "IHDR", 4) != 0 ||
+         bytes[kInterlaceMethodOffset] != 0;
+}
+
+// Returns the encoded data of the codec if its rows can be decoded in
+// independent bands, or null otherwise.
+static sk_sp<SkData> GetRowData(SkCodec& codec, sk_sp<SkData> data) {
+  // Rows of oriented images end up in other rows or columns once the
+  // orientation is applied.
+  if (!data || codec.getOrigin() != kTopLeft_SkEncodedOrigin ||
+      codec.getFrameCount() > 1) {
+    return nullptr;
+  }
+  switch (codec.getEncodedFormat()) {
+    case SkEncodedImageFormat::kJPEG:
+      return data;
+    case SkEncodedImageFormat::kPNG:
+      return IsInterlacedPNG(*data) ? nullptr : data;
+    default:
+      return nullptr;
+  }
+}
+
 BuiltinSkiaCodecImageGenerator::BuiltinSkiaCodecImageGenerator(
     std::unique_ptr<SkCodec> codec)
     : codec_generator_(static_cast<SkCodecImageGenerator*>(
@@ -87,8 +135,11 @@ BuiltinSkiaCodecImageGenerator::BuiltinSkiaCodecImageGenerator(
 BuiltinSkiaCodecImageGenerator::BuiltinSkiaCodecImageGenerator(
     sk_sp<SkData> buffer)
     : codec_generator_(static_cast<SkCodecImageGenerator*>(
-          SkCodecImageGenerator::MakeFromEncodedCodec(std::move(buffer))
-              .release())) {}
+          SkCodecImageGenerator::MakeFromEncodedCodec(buffer).release())) {
+  if (auto codec = SkCodec::MakeFromData(buffer)) {
+    row_data_ = GetRowData(*codec, std::move(buffer));
+  }
+}
 
 const SkImageInfo& BuiltinSkiaCodecImageGenerator::GetInfo() {
   return codec_generator_->getInfo();
@@ -134,13 +185,42 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
   return codec_generator_->getPixels(info, pixels, row_bytes, &options);
 }
 
+bool BuiltinSkiaCodecImageGenerator::CanDecodeRows() const {
+  return !!row_data_;
+}
+
+bool BuiltinSkiaCodecImageGenerator::GetPixelRows(const SkImageInfo& info,
+                                                  void* pixels,
+                                                  size_t row_bytes,
+                                                  int first_row,
+                                                  int row_count) const {
+  if (!row_data_) {
+    return false;
+  }
+  // The codec of the generator is not thread safe, so every band is decoded
+  // by a codec of its own that skips the rows above the band.
+  auto codec = SkCodec::MakeFromData(row_data_);
+  if (!codec || codec->startScanlineDecode(info) != SkCodec::kSuccess ||
+      codec->getScanlineOrder() != SkCodec::kTopDown_SkScanlineOrder) {
+    return false;
+  }
+  if (first_row > 0 && !codec->skipScanlines(first_row)) {
+    return false;
+  }
+  return codec->getScanlines(pixels, row_count, row_bytes) == row_count;
+}
+
 std::unique_ptr<ImageGenerator> BuiltinSkiaCodecImageGenerator::MakeFromData(
     sk_sp<SkData> data) {
-  auto codec = SkCodec::MakeFromData(std::move(data));
+  auto codec = SkCodec::MakeFromData(data);
   if (!codec) {
     return nullptr;
   }
-  return std::make_unique<BuiltinSkiaCodecImageGenerator>(std::move(codec));
+  auto row_data = GetRowData(*codec, std::move(data));
+  auto generator =
+      std::make_unique<BuiltinSkiaCodecImageGenerator>(std::move(codec));
+  generator->row_data_ = std::move(row_data);
+  return generator;
 }
 
 }  // namespace flutter
@@ -124,6 +124,34 @@ class ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) = 0;
 
+  /// @brief      Whether `GetPixelRows` can decode bands of rows of the first
+  ///             frame independently of each other.
+  /// @return     True if `GetPixelRows` is supported. The default
+  ///             implementation returns false.
+  virtual bool CanDecodeRows() const;
+
+  /// @brief      Decode `row_count` rows of the first frame, starting at
+  ///             `first_row`, into `pixels`. Unlike the other methods of
+  ///             `ImageGenerator`, this method may be called from several
+  ///             threads at the same time, so that the bands of a large image
+  ///             can be decoded in parallel.
+  /// @param[in]  info         The desired size and color info of the whole
+  ///                          decoded image. The size must be supported by
+  ///                          `GetScaledDimensions`.
+  /// @param[in]  pixels       The location where the first decoded row should
+  ///                          be written.
+  /// @param[in]  row_bytes    The total number of bytes of a single row of
+  ///                          decoded image data.
+  /// @param[in]  first_row    The index of the first row to decode.
+  /// @param[in]  row_count    The number of rows to decode.
+  /// @return     True if the rows were successfully decoded.
+  /// @see        `CanDecodeRows`
+  virtual bool GetPixelRows(const SkImageInfo& info,
+                            void* pixels,
+                            size_t row_bytes,
+                            int first_row,
+                            int row_count) const;
+
   /// @brief   Creates an `SkImage` based on the current `ImageInfo` of this
   ///          `ImageGenerator`.
   /// @return  A new `SkImage` containing the decoded image data.
@@ -201,11 +229,24 @@ class BuiltinSkiaCodecImageGenerator : public ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) override;
 
+  // |ImageGenerator|
+  bool CanDecodeRows() const override;
+
+  // |ImageGenerator|
+  bool GetPixelRows(const SkImageInfo& info,
+                    void* pixels,
+                    size_t row_bytes,
+                    int first_row,
+                    int row_count) const override;
+
   static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
 
  private:
   FML_DISALLOW_COPY_ASSIGN_AND_MOVE(BuiltinSkiaCodecImageGenerator);
   std::unique_ptr<SkCodecImageGenerator> codec_generator_;
+  // The encoded data of images whose rows can be decoded in independent
+  // bands, each with a codec of its own. Null for other images.
+  sk_sp<SkData> row_data_;
 };
 
 }  // namespace flutter
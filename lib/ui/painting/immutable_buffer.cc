@@ -7,7 +7,7 @@
 #include <cstring>
 
 #include "flutter/fml/file.h"
-#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/post_task_and_reply.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -72,8 +72,7 @@ Dart_Handle ImmutableBuffer::initFromAsset(Dart_Handle buffer_handle,
   }
 
   auto size = data->GetSize();
-  const void* bytes = static_cast<const void*>(data->GetMapping());
-  auto sk_data = MakeSkDataWithCopy(bytes, size);
+  auto sk_data = MakeSkDataFromMapping(std::move(data));
   auto buffer = fml::MakeRefCounted<ImmutableBuffer>(sk_data);
   buffer->AssociateWithDartWrapper(buffer_handle);
   tonic::DartInvoke(callback_handle, {tonic::ToDart(size)});
@@ -106,10 +105,24 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
   auto buffer_handle = std::make_unique<tonic::DartPersistentValue>(
       dart_state, raw_buffer_handle);
 
-  auto ui_task = fml::MakeCopyable(
+  // The file is read on a worker and the buffer is handed to Dart on the UI
+  // thread, which is also where the persistent handles are collected.
+  fml::PostTaskAndReply(
+      dart_state->GetConcurrentTaskRunner().get(),
+      [file_path = std::move(file_path)]() {
+        auto mapping = std::make_unique<fml::FileMapping>(fml::OpenFile(
+            file_path.c_str(), false, fml::FilePermission::kRead));
+
+        sk_sp<SkData> sk_data;
+        if (mapping->IsValid()) {
+          const void* bytes = static_cast<const void*>(mapping->GetMapping());
+          sk_data = MakeSkDataWithCopy(bytes, mapping->GetSize());
+        }
+        return sk_data;
+      },
+      std::move(ui_task_runner),
       [buffer_callback = std::move(buffer_callback),
-       buffer_handle = std::move(buffer_handle)](const sk_sp<SkData>& sk_data,
-                                                 size_t buffer_size) mutable {
+       buffer_handle = std::move(buffer_handle)](sk_sp<SkData> sk_data) {
         auto dart_state = buffer_callback->dart_state().lock();
         if (!dart_state) {
           return;
@@ -120,30 +133,34 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
           tonic::DartInvoke(buffer_callback->Get(), {tonic::ToDart(-1)});
           return;
         }
-        auto buffer = fml::MakeRefCounted<ImmutableBuffer>(sk_data);
+        const size_t buffer_size = sk_data->size();
+        auto buffer = fml::MakeRefCounted<ImmutableBuffer>(std::move(sk_data));
         buffer->AssociateWithDartWrapper(buffer_handle->Get());
         tonic::DartInvoke(buffer_callback->Get(), {tonic::ToDart(buffer_size)});
       });
+  return Dart_Null();
+}
 
-  dart_state->GetConcurrentTaskRunner()->PostTask(
-      [file_path = std::move(file_path),
-       ui_task_runner = std::move(ui_task_runner), ui_task] {
-        auto mapping = std::make_unique<fml::FileMapping>(fml::OpenFile(
-            file_path.c_str(), false, fml::FilePermission::kRead));
+sk_sp<SkData> ImmutableBuffer::MakeSkDataFromMapping(
+    std::unique_ptr<fml::Mapping> mapping) {
+  if (mapping->GetSize() == 0) {
+    return SkData::MakeEmpty();
+  }
 
-        sk_sp<SkData> sk_data;
-        size_t buffer_size = 0;
-        if (mapping->IsValid()) {
-          buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
-        }
-        ui_task_runner->PostTask(
-            [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
-              ui_task(sk_data, buffer_size);
-            });
-      });
-  return Dart_Null();
+#if FML_OS_ANDROID
+  // Mappings that are not backed by files are heap allocated and would be
+  // freed on a decoder worker thread. See |MakeSkDataWithCopy|.
+  if (!mapping->IsDontNeedSafe()) {
+    return MakeSkDataWithCopy(mapping->GetMapping(), mapping->GetSize());
+  }
+#endif  // FML_OS_ANDROID
+
+  const uint8_t* bytes = mapping->GetMapping();
+  const size_t size = mapping->GetSize();
+  SkData::ReleaseProc proc = [](const void* ptr, void* context) {
+    delete reinterpret_cast<fml::Mapping*>(context);
+  };
+  return SkData::MakeWithProc(bytes, size, proc, mapping.release());
 }
 
 #if FML_OS_ANDROID
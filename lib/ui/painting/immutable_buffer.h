@@ -6,8 +6,10 @@
 #define FLUTTER_LIB_UI_PAINTNIG_IMMUTABLE_BUFER_H_
 
 #include <cstdint>
+#include <memory>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/tonic/dart_library_natives.h"
@@ -51,7 +53,11 @@ class ImmutableBuffer : public RefCountedDartWrappable<ImmutableBuffer> {
   /// to load.
   ///
   /// The second indexed argument is expected to be a void callback to signal
-  /// when the copy has completed.
+  /// when the buffer has been created.
+  ///
+  /// Assets that are mapped from files are not copied. The buffer keeps the
+  /// mapping alive for as long as it or any codec or image created from it
+  /// holds on to the data.
   static Dart_Handle initFromAsset(Dart_Handle buffer_handle,
                                    Dart_Handle asset_name_handle,
                                    Dart_Handle callback_handle);
@@ -96,6 +102,9 @@ class ImmutableBuffer : public RefCountedDartWrappable<ImmutableBuffer> {
 
   static sk_sp<SkData> MakeSkDataWithCopy(const void* data, size_t length);
 
+  static sk_sp<SkData> MakeSkDataFromMapping(
+      std::unique_ptr<fml::Mapping> mapping);
+
   DEFINE_WRAPPERTYPEINFO();
   FML_FRIEND_MAKE_REF_COUNTED(ImmutableBuffer);
   FML_DISALLOW_COPY_AND_ASSIGN(ImmutableBuffer);
@@ -4,9 +4,11 @@
 
 #include "flutter/lib/ui/painting/multi_frame_codec.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/painting/image.h"
 #if IMPELLER_SUPPORTS_RENDERING
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
@@ -18,6 +20,20 @@
 
 namespace flutter {
 
+static std::atomic<size_t> gDecodeAheadFrameCount = 2;
+static std::atomic<size_t> gDecodeAheadByteBudget = 16 * 1024 * 1024;
+static std::atomic<size_t> gDecodeAheadBytes = 0;
+
+void MultiFrameCodec::SetDecodeAheadLimits(size_t frame_count,
+                                           size_t byte_budget) {
+  gDecodeAheadFrameCount = frame_count;
+  gDecodeAheadByteBudget = byte_budget;
+}
+
+size_t MultiFrameCodec::GetDecodeAheadBytes() {
+  return gDecodeAheadBytes;
+}
+
 MultiFrameCodec::MultiFrameCodec(std::shared_ptr<ImageGenerator> generator)
     : state_(new State(std::move(generator))) {}
 
@@ -31,7 +47,16 @@ MultiFrameCodec::State::State(std::shared_ptr<ImageGenerator> generator)
                            ? -1
                            : generator_->GetPlayCount() - 1),
       is_impeller_enabled_(UIDartState::Current()->IsImpellerEnabled()),
-      nextFrameIndex_(0) {}
+      nextFrameIndex_(0) {
+  frameInfos_.reserve(frameCount_);
+  for (int i = 0; i < frameCount_; i++) {
+    frameInfos_.push_back(generator_->GetFrameInfo(i));
+  }
+}
+
+MultiFrameCodec::State::~State() {
+  gDecodeAheadBytes -= decodedFrameBytes_;
+}
 
 static void InvokeNextFrameCallback(
     const fml::RefPtr<CanvasImage>& image,
@@ -82,21 +107,23 @@ static bool CopyToBitmap(SkBitmap* dst,
   return true;
 }
 
-sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
-    fml::WeakPtr<GrDirectContext> resourceContext,
-    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
-    std::shared_ptr<impeller::Context> impeller_context_,
-    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
-  SkBitmap bitmap = SkBitmap();
-  SkImageInfo info = generator_->GetInfo().makeColorType(kN32_SkColorType);
+static SkImageInfo GetFrameImageInfo(ImageGenerator& generator) {
+  SkImageInfo info = generator.GetInfo().makeColorType(kN32_SkColorType);
   if (info.alphaType() == kUnpremul_SkAlphaType) {
     SkImageInfo updated = info.makeAlphaType(kPremul_SkAlphaType);
     info = updated;
   }
+  return info;
+}
+
+bool MultiFrameCodec::State::DecodeFrame(SkBitmap& bitmap) {
+  const int frameIndex = decodeFrameIndex_;
+  decodeFrameIndex_ = (decodeFrameIndex_ + 1) % frameCount_;
+
+  SkImageInfo info = GetFrameImageInfo(*generator_);
   bitmap.allocPixels(info);
 
-  ImageGenerator::FrameInfo frameInfo =
-      generator_->GetFrameInfo(nextFrameIndex_);
+  const ImageGenerator::FrameInfo& frameInfo = frameInfos_[frameIndex];
 
   const int requiredFrameIndex =
       frameInfo.required_frame.value_or(SkCodec::kNoFrame);
@@ -104,10 +131,10 @@ sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
 
   if (requiredFrameIndex != SkCodec::kNoFrame) {
     if (lastRequiredFrame_ == nullptr) {
-      FML_LOG(ERROR) << "Frame " << nextFrameIndex_ << " depends on frame "
+      FML_LOG(ERROR) << "Frame " << frameIndex << " depends on frame "
                      << requiredFrameIndex
                      << " and no required frames are cached.";
-      return nullptr;
+      return false;
     } else if (lastRequiredFrameIndex_ != requiredFrameIndex) {
       FML_DLOG(INFO) << "Required frame " << requiredFrameIndex
                      << " is not cached. Using " << lastRequiredFrameIndex_
@@ -122,15 +149,121 @@ sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
   }
 
   if (!generator_->GetPixels(info, bitmap.getPixels(), bitmap.rowBytes(),
-                             nextFrameIndex_, requiredFrameIndex)) {
-    FML_LOG(ERROR) << "Could not getPixels for frame " << nextFrameIndex_;
-    return nullptr;
+                             frameIndex, requiredFrameIndex)) {
+    FML_LOG(ERROR) << "Could not getPixels for frame " << frameIndex;
+    return false;
   }
 
   // Hold onto this if we need it to decode future frames.
   if (frameInfo.disposal_method == SkCodecAnimation::DisposalMethod::kKeep) {
     lastRequiredFrame_ = std::make_unique<SkBitmap>(bitmap);
-    lastRequiredFrameIndex_ = nextFrameIndex_;
+    lastRequiredFrameIndex_ = frameIndex;
+  }
+  return true;
+}
+
+SkBitmap MultiFrameCodec::State::TakeNextFrame() {
+  auto take_decoded_frame = [this](SkBitmap& bitmap) {
+    std::scoped_lock lock(frames_mutex_);
+    if (decodedFrames_.empty()) {
+      return false;
+    }
+    bitmap = std::move(decodedFrames_.front());
+    decodedFrames_.pop_front();
+    const size_t bytes = bitmap.computeByteSize();
+    decodedFrameBytes_ -= bytes;
+    gDecodeAheadBytes -= bytes;
+    return true;
+  };
+
+  SkBitmap bitmap;
+  if (take_decoded_frame(bitmap)) {
+    return bitmap;
+  }
+  std::scoped_lock lock(decode_mutex_);
+  // A decode ahead task may have decoded the frame while this thread was
+  // waiting for the lock.
+  if (take_decoded_frame(bitmap)) {
+    return bitmap;
+  }
+  if (!DecodeFrame(bitmap)) {
+    bitmap.reset();
+  }
+  return bitmap;
+}
+
+static size_t GetDecodeAheadFrameLimit(int frameCount) {
+  // The frame that is handed out next is never decoded twice.
+  return std::min<size_t>(gDecodeAheadFrameCount, frameCount - 1);
+}
+
+void MultiFrameCodec::State::ScheduleDecodeAhead(
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& task_runner) {
+  if (!task_runner) {
+    return;
+  }
+  {
+    std::scoped_lock lock(frames_mutex_);
+    if (decodeAheadPending_ ||
+        decodedFrames_.size() >= GetDecodeAheadFrameLimit(frameCount_)) {
+      return;
+    }
+    decodeAheadPending_ = true;
+  }
+  task_runner->PostTask([weak_state = weak_from_this()]() {
+    if (auto state = weak_state.lock()) {
+      state->DecodeAhead();
+    }
+  });
+}
+
+void MultiFrameCodec::State::DecodeAhead() {
+  TRACE_EVENT0("flutter", "MultiFrameCodec::DecodeAhead");
+  std::scoped_lock decode_lock(decode_mutex_);
+  {
+    std::scoped_lock lock(frames_mutex_);
+    decodeAheadPending_ = false;
+  }
+  const size_t frame_bytes =
+      GetFrameImageInfo(*generator_).computeMinByteSize();
+  while (true) {
+    {
+      std::scoped_lock lock(frames_mutex_);
+      if (decodedFrames_.size() >= GetDecodeAheadFrameLimit(frameCount_)) {
+        return;
+      }
+    }
+
+    // Reserve the bytes of the frame in the budget shared by all codecs.
+    size_t bytes = gDecodeAheadBytes.load();
+    do {
+      if (bytes + frame_bytes > gDecodeAheadByteBudget) {
+        return;
+      }
+    } while (!gDecodeAheadBytes.compare_exchange_weak(bytes,
+                                                      bytes + frame_bytes));
+
+    SkBitmap bitmap;
+    if (!DecodeFrame(bitmap)) {
+      bitmap.reset();
+    }
+    const size_t decoded_bytes = bitmap.computeByteSize();
+    gDecodeAheadBytes -= frame_bytes - decoded_bytes;
+
+    std::scoped_lock lock(frames_mutex_);
+    decodedFrames_.push_back(std::move(bitmap));
+    decodedFrameBytes_ += decoded_bytes;
+  }
+}
+
+sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
+    fml::WeakPtr<GrDirectContext> resourceContext,
+    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+    std::shared_ptr<impeller::Context> impeller_context_,
+    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
+  SkBitmap bitmap = TakeNextFrame();
+  if (!bitmap.getPixels()) {
+    return nullptr;
   }
 
 #if IMPELLER_SUPPORTS_RENDERING
@@ -139,8 +272,11 @@ sk_sp<DlImage> MultiFrameCodec::State::GetNextFrameImage(
     // impeller, transfer to DlImageImpeller
     gpu_disable_sync_switch->Execute(fml::SyncSwitch::Handlers().SetIfFalse(
         [&result, &bitmap, &impeller_context_] {
+          // Frames of animated images are only shown briefly, so they never
+          // get mip levels.
           result = ImageDecoderImpeller::UploadTexture(
-              impeller_context_, std::make_shared<SkBitmap>(bitmap));
+              impeller_context_, std::make_shared<SkBitmap>(bitmap),
+              /*generate_mipmaps=*/false);
         }));
 
     return result;
@@ -180,7 +316,8 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
     fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue,
     const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
     size_t trace_id,
-    std::shared_ptr<impeller::Context> impeller_context) {
+    std::shared_ptr<impeller::Context> impeller_context,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_task_runner) {
   fml::RefPtr<CanvasImage> image = nullptr;
   int duration = 0;
   sk_sp<DlImage> dlImage =
@@ -189,12 +326,13 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
   if (dlImage) {
     image = CanvasImage::Create();
     image->set_image(dlImage);
-    ImageGenerator::FrameInfo frameInfo =
-        generator_->GetFrameInfo(nextFrameIndex_);
-    duration = frameInfo.duration;
+    duration = frameInfos_[nextFrameIndex_].duration;
   }
   nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
 
+  // Decode the frames that follow while this one is shown.
+  ScheduleDecodeAhead(concurrent_task_runner);
+
   // The static leak checker gets confused by the use of fml::MakeCopyable.
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
   ui_task_runner->PostTask(fml::MakeCopyable([callback = std::move(callback),
@@ -232,6 +370,7 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
            tonic::DartState::Current(), callback_handle),
        weak_state = std::weak_ptr<MultiFrameCodec::State>(state_), trace_id,
        ui_task_runner = task_runners.GetUITaskRunner(),
+       concurrent_task_runner = dart_state->GetConcurrentTaskRunner(),
        io_manager = dart_state->GetIOManager()]() mutable {
         auto state = weak_state.lock();
         if (!state) {
@@ -243,7 +382,7 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
             std::move(callback), ui_task_runner,
             io_manager->GetResourceContext(), io_manager->GetSkiaUnrefQueue(),
             io_manager->GetIsGpuDisabledSyncSwitch(), trace_id,
-            io_manager->GetImpellerContext());
+            io_manager->GetImpellerContext(), concurrent_task_runner);
       }));
 
   return Dart_Null();
@@ -5,6 +5,12 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_MUTLI_FRAME_CODEC_H_
 #define FLUTTER_LIB_UI_PAINTING_MUTLI_FRAME_CODEC_H_
 
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/codec.h"
 #include "flutter/lib/ui/painting/image_generator.h"
@@ -28,6 +34,22 @@ class MultiFrameCodec : public Codec {
   // |Codec|
   Dart_Handle getNextFrame(Dart_Handle args) override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Sets how far codecs decode ahead of the frame that was last
+  ///             requested. Frames are decoded ahead on the concurrent task
+  ///             runner, in order, while fewer than `frame_count` frames of a
+  ///             codec are waiting and the waiting frames of all codecs take
+  ///             up less than `byte_budget` bytes. A `frame_count` of 0
+  ///             disables decoding ahead.
+  ///
+  static void SetDecodeAheadLimits(size_t frame_count, size_t byte_budget);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The bytes taken up by the frames that all codecs have
+  ///             decoded ahead and that have not been requested yet.
+  ///
+  static size_t GetDecodeAheadBytes();
+
  private:
   // Captures the state shared between the IO and UI task runners.
   //
@@ -38,24 +60,69 @@ class MultiFrameCodec : public Codec {
   // Instead, the MultiFrameCodec creates this object when it is constructed,
   // shares it with the IO task runner's decoding work, and sets the live_
   // member to false when it is destructed.
-  struct State {
+  struct State : public std::enable_shared_from_this<State> {
     explicit State(std::shared_ptr<ImageGenerator> generator);
 
+    ~State();
+
     const std::shared_ptr<ImageGenerator> generator_;
     const int frameCount_;
     const int repetitionCount_;
+    // The frame infos are read up front so that they can be looked up on the
+    // IO thread while frames are decoded ahead on another thread.
+    std::vector<ImageGenerator::FrameInfo> frameInfos_;
     bool is_impeller_enabled_ = false;
 
-    // The non-const members and functions below here are only read or written
-    // to on the IO thread. They are not safe to access or write on the UI
-    // thread.
+    // The index of the next frame to hand out. Only read or written to on the
+    // IO thread.
     int nextFrameIndex_;
+
+    // Serializes the decoding of frames on the IO thread and the concurrent
+    // task runner. Frames are always decoded in order, so that the frames
+    // that later frames depend on are decoded first. Guards the generator and
+    // the members below that are declared before `frames_mutex_`.
+    std::mutex decode_mutex_;
+
+    // The index of the next frame to decode.
+    int decodeFrameIndex_ = 0;
+
     // The last decoded frame that's required to decode any subsequent frames.
     std::unique_ptr<SkBitmap> lastRequiredFrame_;
 
     // The index of the last decoded required frame.
     int lastRequiredFrameIndex_ = -1;
 
+    // Guards the members below. May be locked while `decode_mutex_` is held,
+    // but not the other way around.
+    std::mutex frames_mutex_;
+
+    // The frames from `nextFrameIndex_` up to `decodeFrameIndex_` that have
+    // been decoded ahead of time, in order. A frame that could not be
+    // decoded has no pixels.
+    std::deque<SkBitmap> decodedFrames_;
+
+    // The bytes of `decodedFrames_`, which are also counted in the bytes of
+    // all codecs.
+    size_t decodedFrameBytes_ = 0;
+
+    // Whether a decode ahead task has been posted and not run yet.
+    bool decodeAheadPending_ = false;
+
+    // Decodes the frame at `decodeFrameIndex_` into `bitmap` and moves on to
+    // the next frame. Must be called with `decode_mutex_` held.
+    bool DecodeFrame(SkBitmap& bitmap);
+
+    // Takes the next frame out of the frames decoded ahead of time, or
+    // decodes it.
+    SkBitmap TakeNextFrame();
+
+    // Posts a task that decodes frames ahead until the window or the byte
+    // budget is full.
+    void ScheduleDecodeAhead(
+        const std::shared_ptr<fml::ConcurrentTaskRunner>& task_runner);
+
+    void DecodeAhead();
+
     sk_sp<DlImage> GetNextFrameImage(
         fml::WeakPtr<GrDirectContext> resourceContext,
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
@@ -69,7 +136,9 @@ class MultiFrameCodec : public Codec {
         fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue,
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
         size_t trace_id,
-        std::shared_ptr<impeller::Context> impeller_context_);
+        std::shared_ptr<impeller::Context> impeller_context_,
+        const std::shared_ptr<fml::ConcurrentTaskRunner>&
+            concurrent_task_runner);
   };
 
   // Shared across the UI and IO task runners.
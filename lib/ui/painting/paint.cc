@@ -6,6 +6,7 @@
 
 #include "flutter/display_list/display_list_builder.h"
 #include "flutter/fml/logging.h"
+#include "flutter/lib/ui/painting/attribute_interner.h"
 #include "flutter/lib/ui/painting/color_filter.h"
 #include "flutter/lib/ui/painting/image_filter.h"
 #include "flutter/lib/ui/painting/shader.h"
@@ -34,7 +35,9 @@ constexpr int kMaskFilterBlurStyleIndex = 10;
 constexpr int kMaskFilterSigmaIndex = 11;
 constexpr int kInvertColorIndex = 12;
 constexpr int kDitherIndex = 13;
-constexpr size_t kDataByteCount = 56;  // 4 * (last index + 1)
+constexpr int kVersionIndex = 14;
+static_assert(Paint::kDataByteCount == 4 * (kVersionIndex + 1),
+              "The paint data must hold every 32bit value.");
 
 // Indices for objects.
 constexpr int kShaderIndex = 0;
@@ -190,77 +193,23 @@ const SkPaint* Paint::paint(SkPaint& paint) const {
   return &paint;
 }
 
-bool Paint::sync_to(DisplayListBuilder* builder,
-                    const DisplayListAttributeFlags& flags) const {
-  if (isNull()) {
-    return false;
+static void ClearPaintObjects(DisplayListBuilder* builder,
+                              const DisplayListAttributeFlags& flags) {
+  if (flags.applies_shader()) {
+    builder->setColorSource(nullptr);
   }
-  tonic::DartByteData byte_data(paint_data_);
-  FML_CHECK(byte_data.length_in_bytes() == kDataByteCount);
-
-  const uint32_t* uint_data = static_cast<const uint32_t*>(byte_data.data());
-  const float* float_data = static_cast<const float*>(byte_data.data());
-
-  Dart_Handle values[kObjectCount];
-  if (Dart_IsNull(paint_objects_)) {
-    if (flags.applies_shader()) {
-      builder->setColorSource(nullptr);
-    }
-    if (flags.applies_color_filter()) {
-      builder->setColorFilter(nullptr);
-    }
-    if (flags.applies_image_filter()) {
-      builder->setImageFilter(nullptr);
-    }
-  } else {
-    FML_DCHECK(Dart_IsList(paint_objects_));
-    intptr_t length = 0;
-    Dart_ListLength(paint_objects_, &length);
-
-    FML_CHECK(length == kObjectCount);
-    if (Dart_IsError(
-            Dart_ListGetRange(paint_objects_, 0, kObjectCount, values))) {
-      return false;
-    }
-
-    if (flags.applies_shader()) {
-      Dart_Handle shader = values[kShaderIndex];
-      if (Dart_IsNull(shader)) {
-        builder->setColorSource(nullptr);
-      } else {
-        if (Shader* decoded = tonic::DartConverter<Shader*>::FromDart(shader)) {
-          auto sampling =
-              ImageFilter::SamplingFromIndex(uint_data[kFilterQualityIndex]);
-          builder->setColorSource(decoded->shader(sampling).get());
-        } else {
-          builder->setColorSource(nullptr);
-        }
-      }
-    }
-
-    if (flags.applies_color_filter()) {
-      Dart_Handle color_filter = values[kColorFilterIndex];
-      if (Dart_IsNull(color_filter)) {
-        builder->setColorFilter(nullptr);
-      } else {
-        ColorFilter* decoded =
-            tonic::DartConverter<ColorFilter*>::FromDart(color_filter);
-        builder->setColorFilter(decoded->dl_filter());
-      }
-    }
-
-    if (flags.applies_image_filter()) {
-      Dart_Handle image_filter = values[kImageFilterIndex];
-      if (Dart_IsNull(image_filter)) {
-        builder->setImageFilter(nullptr);
-      } else {
-        ImageFilter* decoded =
-            tonic::DartConverter<ImageFilter*>::FromDart(image_filter);
-        builder->setImageFilter(decoded->dl_filter());
-      }
-    }
+  if (flags.applies_color_filter()) {
+    builder->setColorFilter(nullptr);
+  }
+  if (flags.applies_image_filter()) {
+    builder->setImageFilter(nullptr);
   }
+}
 
+static void SyncPaintData(DisplayListBuilder* builder,
+                          const DisplayListAttributeFlags& flags,
+                          const uint32_t* uint_data,
+                          const float* float_data) {
   if (flags.applies_anti_alias()) {
     builder->setAntiAlias(uint_data[kIsAntiAliasIndex] == 0);
   }
@@ -327,10 +276,83 @@ bool Paint::sync_to(DisplayListBuilder* builder,
         break;
     }
   }
+}
 
+bool Paint::sync_to(DisplayListBuilder* builder,
+                    const DisplayListAttributeFlags& flags) const {
+  if (isNull()) {
+    return false;
+  }
+  tonic::DartByteData byte_data(paint_data_);
+  FML_CHECK(byte_data.length_in_bytes() == kDataByteCount);
+
+  const uint32_t* uint_data = static_cast<const uint32_t*>(byte_data.data());
+  const float* float_data = static_cast<const float*>(byte_data.data());
+
+  Dart_Handle values[kObjectCount];
+  if (Dart_IsNull(paint_objects_)) {
+    ClearPaintObjects(builder, flags);
+  } else {
+    FML_DCHECK(Dart_IsList(paint_objects_));
+    intptr_t length = 0;
+    Dart_ListLength(paint_objects_, &length);
+
+    FML_CHECK(length == kObjectCount);
+    if (Dart_IsError(
+            Dart_ListGetRange(paint_objects_, 0, kObjectCount, values))) {
+      return false;
+    }
+
+    if (flags.applies_shader()) {
+      Dart_Handle shader = values[kShaderIndex];
+      if (Dart_IsNull(shader)) {
+        builder->setColorSource(nullptr);
+      } else {
+        if (Shader* decoded = tonic::DartConverter<Shader*>::FromDart(shader)) {
+          auto sampling =
+              ImageFilter::SamplingFromIndex(uint_data[kFilterQualityIndex]);
+          builder->setColorSource(decoded->shader(sampling).get());
+        } else {
+          builder->setColorSource(nullptr);
+        }
+      }
+    }
+
+    if (flags.applies_color_filter()) {
+      Dart_Handle color_filter = values[kColorFilterIndex];
+      if (Dart_IsNull(color_filter)) {
+        builder->setColorFilter(nullptr);
+      } else {
+        ColorFilter* decoded =
+            tonic::DartConverter<ColorFilter*>::FromDart(color_filter);
+        builder->setColorFilter(decoded->dl_filter());
+      }
+    }
+
+    if (flags.applies_image_filter()) {
+      Dart_Handle image_filter = values[kImageFilterIndex];
+      if (Dart_IsNull(image_filter)) {
+        builder->setImageFilter(nullptr);
+      } else {
+        ImageFilter* decoded =
+            tonic::DartConverter<ImageFilter*>::FromDart(image_filter);
+        builder->setImageFilter(decoded->dl_filter());
+      }
+    }
+  }
+
+  SyncPaintData(builder, flags, uint_data, float_data);
   return true;
 }
 
+void Paint::SyncDataTo(DisplayListBuilder* builder,
+                       const DisplayListAttributeFlags& flags,
+                       const uint32_t* paint_data) {
+  ClearPaintObjects(builder, flags);
+  SyncPaintData(builder, flags, paint_data,
+                reinterpret_cast<const float*>(paint_data));
+}
+
 void Paint::toDlPaint(DlPaint& paint) const {
   if (isNull()) {
     return;
@@ -414,15 +436,37 @@ void Paint::toDlPaint(DlPaint& paint) const {
       SkBlurStyle blur_style =
           static_cast<SkBlurStyle>(uint_data[kMaskFilterBlurStyleIndex]);
       double sigma = float_data[kMaskFilterSigmaIndex];
-      std::shared_ptr<DlBlurMaskFilter> dl_filter =
-          std::make_shared<DlBlurMaskFilter>(blur_style, sigma);
-      if (dl_filter->skia_object()) {
-        paint.setMaskFilter(dl_filter);
+      DlBlurMaskFilter dl_filter(blur_style, sigma);
+      if (dl_filter.skia_object()) {
+        size_t hash =
+            fml::HashCombine(DlMaskFilterType::kBlur, blur_style, sigma);
+        paint.setMaskFilter(AttributeInterner::Intern(hash, dl_filter));
       }
       break;
   }
 }
 
+const DlPaint* DlPaintCache::Get(const Paint& paint) {
+  if (paint.isNull()) {
+    return nullptr;
+  }
+
+  uint32_t version;
+  {
+    tonic::DartByteData byte_data(paint.paint_data_);
+    FML_CHECK(byte_data.length_in_bytes() == Paint::kDataByteCount);
+    version = static_cast<const uint32_t*>(byte_data.data())[kVersionIndex];
+  }
+  if (version != 0 && version == version_) {
+    return &paint_;
+  }
+
+  paint_ = DlPaint();
+  paint.toDlPaint(paint_);
+  version_ = version;
+  return &paint_;
+}
+
 }  // namespace flutter
 
 namespace tonic {
@@ -14,6 +14,9 @@ namespace flutter {
 
 class Paint {
  public:
+  /// The size of the data that Dart encodes for each Paint object.
+  static constexpr size_t kDataByteCount = 60;
+
   Paint() = default;
   Paint(Dart_Handle paint_objects, Dart_Handle paint_data);
 
@@ -30,16 +33,41 @@ class Paint {
   bool sync_to(DisplayListBuilder* builder,
                const DisplayListAttributeFlags& flags) const;
 
+  /// Synchronize paint data that was encoded without any objects, for
+  /// example by the batched commands of a Canvas, to the display list.
+  /// The shader, color filter and image filter are cleared. The data must
+  /// be |kDataByteCount| bytes long.
+  static void SyncDataTo(DisplayListBuilder* builder,
+                         const DisplayListAttributeFlags& flags,
+                         const uint32_t* paint_data);
+
   bool isNull() const { return Dart_IsNull(paint_data_); }
   bool isNotNull() const { return !Dart_IsNull(paint_data_); }
 
  private:
   friend struct tonic::DartConverter<Paint>;
+  friend class DlPaintCache;
 
   Dart_Handle paint_objects_;
   Dart_Handle paint_data_;
 };
 
+// Holds the DlPaint decoded from the most recently drawn Paint. Dart stores
+// a new version in the data of a Paint whenever it changes, so drawing the
+// same unchanged Paint again only compares the versions and hands the
+// DisplayListBuilder the same attribute objects as before.
+class DlPaintCache {
+ public:
+  /// Returns the DlPaint for |paint|, or nullptr if |paint| is null. The
+  /// result is valid until the next call.
+  const DlPaint* Get(const Paint& paint);
+
+ private:
+  DlPaint paint_;
+  // Zero is never cached.
+  uint32_t version_ = 0;
+};
+
 // The PaintData argument is a placeholder to receive encoded data for Paint
 // objects. The data is actually processed by DartConverter<Paint>, which reads
 // both at the given index and at the next index (which it assumes is a byte
@@ -58,5 +58,54 @@ TEST_F(ShellTest, ConvertPaintToDlPaint) {
   ASSERT_EQ(dl_paint.getDrawStyle(), DlDrawStyle::kStroke);
 }
 
+TEST_F(ShellTest, DlPaintCacheDecodesChangedPaints) {
+  auto message_latch = std::make_shared<fml::AutoResetWaitableEvent>();
+  DlPaintCache cache;
+  std::vector<uint32_t> colors;
+
+  auto nativeCacheDlPaint = [&cache, &colors](Dart_NativeArguments args) {
+    Dart_Handle dart_paint = Dart_GetNativeArgument(args, 0);
+    Dart_Handle paint_objects =
+        Dart_GetField(dart_paint, tonic::ToDart("_objects"));
+    Dart_Handle paint_data = Dart_GetField(dart_paint, tonic::ToDart("_data"));
+    Paint ui_paint(paint_objects, paint_data);
+    const DlPaint* dl_paint = cache.Get(ui_paint);
+    ASSERT_NE(dl_paint, nullptr);
+    colors.push_back(static_cast<uint32_t>(dl_paint->getColor()));
+  };
+  auto nativeFinish = [message_latch](Dart_NativeArguments args) {
+    message_latch->Signal();
+  };
+
+  Settings settings = CreateSettingsForFixture();
+  TaskRunners task_runners("test",                  // label
+                           GetCurrentTaskRunner(),  // platform
+                           CreateNewThread(),       // raster
+                           CreateNewThread(),       // ui
+                           CreateNewThread()        // io
+  );
+
+  AddNativeCallback("CacheDlPaint", CREATE_NATIVE_ENTRY(nativeCacheDlPaint));
+  AddNativeCallback("FinishCacheDlPaints", CREATE_NATIVE_ENTRY(nativeFinish));
+
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(shell->IsSetup());
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("cacheDlPaints");
+
+  shell->RunEngine(std::move(configuration), [](auto result) {
+    ASSERT_EQ(result, Engine::RunStatus::Success);
+  });
+
+  message_latch->Wait();
+  DestroyShell(std::move(shell), task_runners);
+
+  std::vector<uint32_t> expected_colors = {
+      0xFF112233, 0xFF112233, 0xFF445566, 0xFF000000, 0xFF445566,
+  };
+  ASSERT_EQ(colors, expected_colors);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -25,14 +25,8 @@ void CanvasPathMeasure::Create(Dart_Handle wrapper,
   UIDartState::ThrowIfUIOperationsProhibited();
   fml::RefPtr<CanvasPathMeasure> pathMeasure =
       fml::MakeRefCounted<CanvasPathMeasure>();
-  if (path) {
-    const SkPath skPath = path->path();
-    SkScalar resScale = 1;
-    pathMeasure->path_measure_ =
-        std::make_unique<SkContourMeasureIter>(skPath, forceClosed, resScale);
-  } else {
-    pathMeasure->path_measure_ = std::make_unique<SkContourMeasureIter>();
-  }
+  pathMeasure->contours_ = ContourMeasureCache::GetContoursForCurrentIsolate(
+      path ? path->path() : SkPath(), forceClosed);
   pathMeasure->AssociateWithDartWrapper(wrapper);
 }
 
@@ -41,14 +35,22 @@ CanvasPathMeasure::CanvasPathMeasure() {}
 CanvasPathMeasure::~CanvasPathMeasure() {}
 
 void CanvasPathMeasure::setPath(const CanvasPath* path, bool isClosed) {
-  const SkPath& skPath = path->path();
-  path_measure_->reset(skPath, isClosed);
+  contours_ =
+      ContourMeasureCache::GetContoursForCurrentIsolate(path->path(), isClosed);
+  contour_count_ = 0;
+}
+
+SkContourMeasure* CanvasPathMeasure::GetContour(int contour_index) const {
+  if (contour_index < 0 ||
+      static_cast<size_t>(contour_index) >= contour_count_) {
+    return nullptr;
+  }
+  return contours_->GetContour(contour_index);
 }
 
 float CanvasPathMeasure::getLength(int contour_index) {
-  if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
-          contour_index) < measures_.size()) {
-    return measures_[contour_index]->length();
+  if (auto* contour = GetContour(contour_index)) {
+    return contour->length();
   }
   return -1;
 }
@@ -57,14 +59,14 @@ tonic::Float32List CanvasPathMeasure::getPosTan(int contour_index,
                                                 float distance) {
   tonic::Float32List posTan(Dart_NewTypedData(Dart_TypedData_kFloat32, 5));
   posTan[0] = 0;  // dart code will check for this for failure
-  if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
-          contour_index) >= measures_.size()) {
+  auto* contour = GetContour(contour_index);
+  if (!contour) {
     return posTan;
   }
 
   SkPoint pos;
   SkVector tan;
-  bool success = measures_[contour_index]->getPosTan(distance, &pos, &tan);
+  bool success = contour->getPosTan(distance, &pos, &tan);
 
   if (success) {
     posTan[0] = 1;  // dart code will check for this for success
@@ -82,13 +84,13 @@ void CanvasPathMeasure::getSegment(Dart_Handle path_handle,
                                    float start_d,
                                    float stop_d,
                                    bool start_with_move_to) {
-  if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
-          contour_index) >= measures_.size()) {
+  auto* contour = GetContour(contour_index);
+  if (!contour) {
     CanvasPath::Create(path_handle);
+    return;
   }
   SkPath dst;
-  bool success = measures_[contour_index]->getSegment(start_d, stop_d, &dst,
-                                                      start_with_move_to);
+  bool success = contour->getSegment(start_d, stop_d, &dst, start_with_move_to);
   if (!success) {
     CanvasPath::Create(path_handle);
   } else {
@@ -96,18 +98,35 @@ void CanvasPathMeasure::getSegment(Dart_Handle path_handle,
   }
 }
 
+void CanvasPathMeasure::getSegments(
+    Dart_Handle path_handle,
+    int contour_index,
+    const tonic::Float32List& start_and_stop_distances,
+    bool start_with_move_to) {
+  SkPath dst;
+  if (auto* contour = GetContour(contour_index)) {
+    // Skia appends each segment to |dst|, and empty segments leave it
+    // unchanged.
+    for (size_t i = 0; i + 1 < start_and_stop_distances.num_elements();
+         i += 2) {
+      contour->getSegment(start_and_stop_distances[i],
+                          start_and_stop_distances[i + 1], &dst,
+                          start_with_move_to);
+    }
+  }
+  CanvasPath::CreateFrom(path_handle, dst);
+}
+
 bool CanvasPathMeasure::isClosed(int contour_index) {
-  if (static_cast<std::vector<sk_sp<SkContourMeasure>>::size_type>(
-          contour_index) < measures_.size()) {
-    return measures_[contour_index]->isClosed();
+  if (auto* contour = GetContour(contour_index)) {
+    return contour->isClosed();
   }
   return false;
 }
 
 bool CanvasPathMeasure::nextContour() {
-  auto measure = path_measure_->next();
-  if (measure) {
-    measures_.push_back(std::move(measure));
+  if (contours_->GetContour(contour_count_)) {
+    contour_count_++;
     return true;
   }
   return false;
@@ -5,9 +5,10 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_PATH_MEASURE_H_
 #define FLUTTER_LIB_UI_PAINTING_PATH_MEASURE_H_
 
-#include <vector>
+#include <memory>
 
 #include "flutter/lib/ui/dart_wrapper.h"
+#include "flutter/lib/ui/painting/contour_measure_cache.h"
 #include "flutter/lib/ui/painting/path.h"
 #include "third_party/skia/include/core/SkContourMeasure.h"
 #include "third_party/skia/include/core/SkPath.h"
@@ -36,16 +37,25 @@ class CanvasPathMeasure : public RefCountedDartWrappable<CanvasPathMeasure> {
                   float start_d,
                   float stop_d,
                   bool start_with_move_to);
+  // Appends the segments between each pair of distances in
+  // |start_and_stop_distances| to a single path.
+  void getSegments(Dart_Handle path_handle,
+                   int contour_index,
+                   const tonic::Float32List& start_and_stop_distances,
+                   bool start_with_move_to);
   bool isClosed(int contour_index);
   bool nextContour();
 
-  const SkContourMeasureIter& pathMeasure() const { return *path_measure_; }
-
  private:
   CanvasPathMeasure();
 
-  std::unique_ptr<SkContourMeasureIter> path_measure_;
-  std::vector<sk_sp<SkContourMeasure>> measures_;
+  // Returns the contour at |contour_index| if the iteration has reached it.
+  SkContourMeasure* GetContour(int contour_index) const;
+
+  // The contours are shared with other measures of the same path through
+  // the |ContourMeasureCache| of the isolate.
+  std::shared_ptr<MeasuredContours> contours_;
+  size_t contour_count_ = 0;
 };
 
 }  // namespace flutter
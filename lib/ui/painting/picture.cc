@@ -199,22 +199,22 @@ Dart_Handle Picture::RasterizeToImage(const sk_sp<DisplayList>& display_list,
       raster_task_runner,
       [ui_task_runner, snapshot_delegate, display_list, picture_bounds, ui_task,
        layer_tree = std::move(layer_tree)] {
-        sk_sp<DlImage> image;
+        sk_sp<DisplayList> snapshot_display_list = display_list;
         if (layer_tree) {
-          auto display_list = layer_tree->Flatten(
+          snapshot_display_list = layer_tree->Flatten(
               SkRect::MakeWH(picture_bounds.width(), picture_bounds.height()),
               snapshot_delegate->GetTextureRegistry(),
               snapshot_delegate->GetGrContext());
-
-          image = snapshot_delegate->MakeRasterSnapshot(display_list,
-                                                        picture_bounds);
-        } else {
-          image = snapshot_delegate->MakeRasterSnapshot(display_list,
-                                                        picture_bounds);
         }
 
-        fml::TaskRunner::RunNowOrPostTask(
-            ui_task_runner, [ui_task, image]() { ui_task(image); });
+        // The pixels are read back without blocking the raster thread, the
+        // callback is invoked on the raster thread once they are available.
+        snapshot_delegate->MakeRasterSnapshotAsync(
+            snapshot_display_list, picture_bounds,
+            [ui_task_runner, ui_task](sk_sp<DlImage> image) {
+              fml::TaskRunner::RunNowOrPostTask(
+                  ui_task_runner, [ui_task, image]() { ui_task(image); });
+            });
       });
 
   return Dart_Null();
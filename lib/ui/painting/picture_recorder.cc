@@ -5,6 +5,7 @@
 #include "flutter/lib/ui/painting/picture_recorder.h"
 
 #include "flutter/display_list/display_list.h"
+#include "flutter/display_list/display_list_storage_pool.h"
 #include "flutter/lib/ui/painting/canvas.h"
 #include "flutter/lib/ui/painting/picture.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -27,7 +28,15 @@ PictureRecorder::PictureRecorder() {}
 PictureRecorder::~PictureRecorder() {}
 
 SkCanvas* PictureRecorder::BeginRecording(SkRect bounds) {
-  display_list_recorder_ = sk_make_sp<DisplayListCanvasRecorder>(bounds);
+  // Pictures are recorded on the UI thread but usually die on the raster
+  // thread, so the pool is shared by all recorders and never destroyed.
+  static auto* storage_pool = new std::shared_ptr<DisplayListStoragePool>(
+      std::make_shared<DisplayListStoragePool>());
+  display_list_recorder_ =
+      sk_make_sp<DisplayListCanvasRecorder>(bounds, *storage_pool);
+  // Widgets often nest tiny pictures, which are cheaper to replay inline.
+  display_list_recorder_->builder()->setMaxInlinedOpCount(
+      DisplayListBuilder::kDefaultMaxInlinedOpCount);
   return display_list_recorder_.get();
 }
 
@@ -11,11 +11,13 @@ namespace flutter {
 
 SingleFrameCodec::SingleFrameCodec(fml::RefPtr<ImageDescriptor> descriptor,
                                    uint32_t target_width,
-                                   uint32_t target_height)
+                                   uint32_t target_height,
+                                   bool generate_mipmaps)
     : status_(Status::kNew),
       descriptor_(std::move(descriptor)),
       target_width_(target_width),
-      target_height_(target_height) {}
+      target_height_(target_height),
+      generate_mipmaps_(generate_mipmaps) {}
 
 SingleFrameCodec::~SingleFrameCodec() = default;
 
@@ -69,7 +71,8 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
       new fml::RefPtr<SingleFrameCodec>(this);
 
   decoder->Decode(
-      descriptor_, target_width_, target_height_, [raw_codec_ref](auto image) {
+      descriptor_, target_width_, target_height_, generate_mipmaps_,
+      [raw_codec_ref](auto image) {
         std::unique_ptr<fml::RefPtr<SingleFrameCodec>> codec_ref(raw_codec_ref);
         fml::RefPtr<SingleFrameCodec> codec(std::move(*codec_ref));
 
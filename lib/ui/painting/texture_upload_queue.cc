@@ -0,0 +1,91 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/texture_upload_queue.h"
+
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+TextureUploadQueue::TextureUploadQueue(
+    fml::RefPtr<fml::TaskRunner> task_runner,
+    size_t max_bytes_per_frame,
+    fml::TimeDelta frame_interval)
+    : task_runner_(std::move(task_runner)),
+      max_bytes_per_frame_(max_bytes_per_frame),
+      frame_interval_(frame_interval) {}
+
+TextureUploadQueue::~TextureUploadQueue() = default;
+
+void TextureUploadQueue::Enqueue(size_t byte_size, fml::closure upload) {
+  std::scoped_lock lock(mutex_);
+  pending_uploads_.push_back({byte_size, std::move(upload)});
+  if (!drain_pending_) {
+    drain_pending_ = true;
+    task_runner_->PostTask(
+        [strong = fml::Ref(this)]() { strong->DrainFrame(); });
+  }
+}
+
+void TextureUploadQueue::Drain() {
+  TRACE_EVENT0("flutter", "TextureUploadQueue::Drain");
+  FML_DCHECK(task_runner_->RunsTasksOnCurrentThread());
+  std::vector<PendingUpload> uploads;
+  {
+    std::scoped_lock lock(mutex_);
+    pending_uploads_.swap(uploads);
+  }
+  for (auto it = uploads.rbegin(); it != uploads.rend(); ++it) {
+    it->upload();
+  }
+}
+
+size_t TextureUploadQueue::GetPendingUploadCount() const {
+  std::scoped_lock lock(mutex_);
+  return pending_uploads_.size();
+}
+
+void TextureUploadQueue::DrainFrame() {
+  TRACE_EVENT0("flutter", "TextureUploadQueue::DrainFrame");
+  std::vector<PendingUpload> uploads;
+  {
+    std::scoped_lock lock(mutex_);
+    const fml::TimePoint now = fml::TimePoint::Now();
+    if (now - frame_start_ >= frame_interval_) {
+      frame_start_ = now;
+      frame_bytes_ = 0;
+    }
+
+    // An upload that exceeds the budget on its own is still performed when
+    // nothing else has been uploaded in this frame.
+    while (!pending_uploads_.empty()) {
+      PendingUpload& upload = pending_uploads_.back();
+      if (frame_bytes_ > 0 &&
+          frame_bytes_ + upload.byte_size > max_bytes_per_frame_) {
+        break;
+      }
+      frame_bytes_ += upload.byte_size;
+      uploads.push_back(std::move(upload));
+      pending_uploads_.pop_back();
+    }
+
+    if (pending_uploads_.empty()) {
+      drain_pending_ = false;
+    } else {
+      TRACE_EVENT0("flutter", "TextureUploadQueue::DeferUploads");
+      task_runner_->PostTaskForTime(
+          [strong = fml::Ref(this)]() { strong->DrainFrame(); },
+          frame_start_ + frame_interval_);
+    }
+  }
+
+  for (PendingUpload& upload : uploads) {
+    upload.upload();
+  }
+}
+
+}  // namespace flutter
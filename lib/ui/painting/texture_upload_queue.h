@@ -0,0 +1,79 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_TEXTURE_UPLOAD_QUEUE_H_
+#define FLUTTER_LIB_UI_PAINTING_TEXTURE_UPLOAD_QUEUE_H_
+
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/closure.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/memory/ref_counted.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// Schedules the texture uploads of decoded images on the IO thread.
+///
+/// Uploads that are enqueued before the queue is drained are performed
+/// together in a single task, and at most |max_bytes_per_frame| are uploaded
+/// in each |frame_interval| so that the GPU work of the IO thread does not
+/// contend with the frames of the raster thread. The remaining uploads are
+/// deferred to the next interval.
+///
+/// When uploads are deferred, the most recently enqueued ones go first.
+/// Images that were requested last are the most likely to be needed by the
+/// current frame, for example the ones that have just been scrolled into
+/// view.
+class TextureUploadQueue
+    : public fml::RefCountedThreadSafe<TextureUploadQueue> {
+ public:
+  static constexpr size_t kDefaultMaxBytesPerFrame = 16 * 1024 * 1024;
+
+  /// Enqueues an upload of |byte_size| bytes. The upload is performed on the
+  /// task runner of the queue. This method is thread-safe.
+  void Enqueue(size_t byte_size, fml::closure upload);
+
+  /// Performs all the pending uploads right away, regardless of the budget.
+  /// This is used when the IO manager shuts down and must be called on the
+  /// task runner of the queue.
+  void Drain();
+
+  size_t GetPendingUploadCount() const;
+
+ private:
+  struct PendingUpload {
+    size_t byte_size;
+    fml::closure upload;
+  };
+
+  TextureUploadQueue(fml::RefPtr<fml::TaskRunner> task_runner,
+                     size_t max_bytes_per_frame,
+                     fml::TimeDelta frame_interval);
+
+  ~TextureUploadQueue();
+
+  void DrainFrame();
+
+  const fml::RefPtr<fml::TaskRunner> task_runner_;
+  const size_t max_bytes_per_frame_;
+  const fml::TimeDelta frame_interval_;
+  mutable std::mutex mutex_;
+  // Ordered from the oldest to the most recent upload.
+  std::vector<PendingUpload> pending_uploads_;
+  bool drain_pending_ = false;
+  fml::TimePoint frame_start_;
+  size_t frame_bytes_ = 0;
+
+  FML_FRIEND_REF_COUNTED_THREAD_SAFE(TextureUploadQueue);
+  FML_FRIEND_MAKE_REF_COUNTED(TextureUploadQueue);
+  FML_DISALLOW_COPY_AND_ASSIGN(TextureUploadQueue);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_TEXTURE_UPLOAD_QUEUE_H_
@@ -0,0 +1,82 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/texture_upload_queue.h"
+
+#include <vector>
+
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/testing/post_task_sync.h"
+#include "flutter/testing/thread_test.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+using TextureUploadQueueTest = ThreadTest;
+
+TEST_F(TextureUploadQueueTest, UploadsAreBatchedMostRecentFirst) {
+  auto task_runner = CreateNewThread();
+  auto queue = fml::MakeRefCounted<TextureUploadQueue>(
+      task_runner, 1000, fml::TimeDelta::FromMilliseconds(16));
+  std::vector<int> uploaded;
+  PostTaskSync(task_runner, [&]() {
+    for (int i = 0; i < 3; i++) {
+      queue->Enqueue(10, [&uploaded, i]() { uploaded.push_back(i); });
+    }
+    ASSERT_TRUE(uploaded.empty());
+  });
+  // The uploads are performed in a single task after the enqueuing one.
+  PostTaskSync(task_runner, [&]() {
+    ASSERT_EQ(uploaded, std::vector<int>({2, 1, 0}));
+    ASSERT_EQ(queue->GetPendingUploadCount(), 0u);
+  });
+}
+
+TEST_F(TextureUploadQueueTest, UploadsOverTheFrameBudgetAreDeferred) {
+  auto task_runner = CreateNewThread();
+  auto queue = fml::MakeRefCounted<TextureUploadQueue>(
+      task_runner, 100, fml::TimeDelta::FromSeconds(3600));
+  std::vector<int> uploaded;
+  PostTaskSync(task_runner, [&]() {
+    for (int i = 0; i < 3; i++) {
+      queue->Enqueue(60, [&uploaded, i]() { uploaded.push_back(i); });
+    }
+  });
+  PostTaskSync(task_runner, [&]() {
+    ASSERT_EQ(uploaded, std::vector<int>({2}));
+    ASSERT_EQ(queue->GetPendingUploadCount(), 2u);
+
+    queue->Drain();
+    ASSERT_EQ(uploaded, std::vector<int>({2, 1, 0}));
+    ASSERT_EQ(queue->GetPendingUploadCount(), 0u);
+  });
+}
+
+TEST_F(TextureUploadQueueTest, UploadLargerThanTheFrameBudgetIsPerformed) {
+  auto task_runner = CreateNewThread();
+  auto queue = fml::MakeRefCounted<TextureUploadQueue>(
+      task_runner, 100, fml::TimeDelta::FromMilliseconds(1));
+  fml::AutoResetWaitableEvent latch;
+  queue->Enqueue(1000, [&latch]() { latch.Signal(); });
+  latch.Wait();
+}
+
+TEST_F(TextureUploadQueueTest, DeferredUploadsArePerformedInTheNextFrame) {
+  auto task_runner = CreateNewThread();
+  auto queue = fml::MakeRefCounted<TextureUploadQueue>(
+      task_runner, 100, fml::TimeDelta::FromMilliseconds(1));
+  fml::CountDownLatch latch(3);
+  PostTaskSync(task_runner, [&]() {
+    for (int i = 0; i < 3; i++) {
+      queue->Enqueue(60, [&latch]() { latch.CountDown(); });
+    }
+  });
+  latch.Wait();
+  ASSERT_EQ(queue->GetPendingUploadCount(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,149 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/semantics/semantics_delta_encoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+#include <vector>
+
+namespace flutter {
+
+namespace {
+
+// Unset scroll positions and extents are NaN, which are not equal to
+// themselves.
+bool IsSameDouble(double a, double b) {
+  return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+bool IsSameStringAttributes(const StringAttributes& a,
+                            const StringAttributes& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); i++) {
+    const StringAttribute& first = *a[i];
+    const StringAttribute& second = *b[i];
+    if (first.start != second.start || first.end != second.end ||
+        first.type != second.type) {
+      return false;
+    }
+    if (first.type == StringAttributeType::kLocale &&
+        static_cast<const LocaleStringAttribute&>(first).locale !=
+            static_cast<const LocaleStringAttribute&>(second).locale) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Contains(const std::vector<int32_t>& ids, int32_t id) {
+  return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+}  // namespace
+
+SemanticsDeltaEncoder::SemanticsDeltaEncoder() = default;
+
+SemanticsDeltaEncoder::~SemanticsDeltaEncoder() = default;
+
+bool SemanticsDeltaEncoder::IsSameNode(const SemanticsNode& a,
+                                       const SemanticsNode& b) {
+  return a.id == b.id && a.flags == b.flags && a.actions == b.actions &&
+         a.maxValueLength == b.maxValueLength &&
+         a.currentValueLength == b.currentValueLength &&
+         a.textSelectionBase == b.textSelectionBase &&
+         a.textSelectionExtent == b.textSelectionExtent &&
+         a.platformViewId == b.platformViewId &&
+         a.scrollChildren == b.scrollChildren &&
+         a.scrollIndex == b.scrollIndex &&
+         IsSameDouble(a.scrollPosition, b.scrollPosition) &&
+         IsSameDouble(a.scrollExtentMax, b.scrollExtentMax) &&
+         IsSameDouble(a.scrollExtentMin, b.scrollExtentMin) &&
+         a.elevation == b.elevation && a.thickness == b.thickness &&
+         a.textDirection == b.textDirection && a.rect == b.rect &&
+         a.transform == b.transform && a.label == b.label &&
+         a.hint == b.hint && a.value == b.value &&
+         a.increasedValue == b.increasedValue &&
+         a.decreasedValue == b.decreasedValue && a.tooltip == b.tooltip &&
+         IsSameStringAttributes(a.labelAttributes, b.labelAttributes) &&
+         IsSameStringAttributes(a.hintAttributes, b.hintAttributes) &&
+         IsSameStringAttributes(a.valueAttributes, b.valueAttributes) &&
+         IsSameStringAttributes(a.increasedValueAttributes,
+                                b.increasedValueAttributes) &&
+         IsSameStringAttributes(a.decreasedValueAttributes,
+                                b.decreasedValueAttributes) &&
+         a.childrenInTraversalOrder == b.childrenInTraversalOrder &&
+         a.childrenInHitTestOrder == b.childrenInHitTestOrder &&
+         a.customAccessibilityActions == b.customAccessibilityActions;
+}
+
+void SemanticsDeltaEncoder::Encode(SemanticsNodeUpdates& update) {
+  // The children that the changed nodes of this update attach and detach.
+  // Attached children are always sent, even if they did not change, since
+  // platforms move a node to its new parent only if the node is part of
+  // the update.
+  std::unordered_set<int32_t> attached;
+  std::vector<int32_t> detached;
+  std::vector<int32_t> unchanged;
+  for (const auto& [id, node] : update) {
+    auto sent = sent_nodes_.find(id);
+    if (sent == sent_nodes_.end()) {
+      attached.insert(node.childrenInTraversalOrder.begin(),
+                      node.childrenInTraversalOrder.end());
+      continue;
+    }
+    if (IsSameNode(sent->second, node)) {
+      unchanged.push_back(id);
+      continue;
+    }
+    const SemanticsNode& previous = sent->second;
+    for (int32_t child : node.childrenInTraversalOrder) {
+      if (!Contains(previous.childrenInTraversalOrder, child)) {
+        attached.insert(child);
+      }
+    }
+    for (int32_t child : previous.childrenInTraversalOrder) {
+      if (!Contains(node.childrenInTraversalOrder, child)) {
+        detached.push_back(child);
+      }
+    }
+  }
+
+  for (int32_t id : unchanged) {
+    if (attached.find(id) == attached.end()) {
+      update.erase(id);
+    }
+  }
+  for (const auto& [id, node] : update) {
+    sent_nodes_[id] = node;
+  }
+  for (int32_t id : detached) {
+    if (attached.find(id) == attached.end()) {
+      ForgetSubtree(id);
+    }
+  }
+}
+
+void SemanticsDeltaEncoder::Reset() {
+  sent_nodes_.clear();
+}
+
+void SemanticsDeltaEncoder::ForgetSubtree(int32_t id) {
+  std::vector<int32_t> pending = {id};
+  while (!pending.empty()) {
+    auto it = sent_nodes_.find(pending.back());
+    pending.pop_back();
+    if (it == sent_nodes_.end()) {
+      continue;
+    }
+    pending.insert(pending.end(), it->second.childrenInTraversalOrder.begin(),
+                   it->second.childrenInTraversalOrder.end());
+    sent_nodes_.erase(it);
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_SEMANTICS_SEMANTICS_DELTA_ENCODER_H_
+#define FLUTTER_LIB_UI_SEMANTICS_SEMANTICS_DELTA_ENCODER_H_
+
+#include "flutter/fml/macros.h"
+#include "flutter/lib/ui/semantics/semantics_node.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Removes the nodes from semantics updates that are identical to
+///             the nodes that were last sent to the platform.
+///
+///             The framework sends every node that it marked dirty, and for
+///             large lists many of those nodes end up with the same
+///             semantics that they already had. The platform already holds
+///             those nodes, so they are dropped before the update is
+///             converted and copied to the platform thread.
+///
+///             Nodes that an update detaches from their parent are forgotten
+///             along with their descendants, since the platform removes them
+///             from its tree and they have to be sent in full if they are
+///             attached again later.
+///
+///             The encoder must be reset whenever the platform drops its
+///             tree, for example when semantics are disabled.
+///
+class SemanticsDeltaEncoder {
+ public:
+  SemanticsDeltaEncoder();
+
+  ~SemanticsDeltaEncoder();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Removes the nodes of `update` that did not change since the
+  ///             updates that were previously encoded, and records the
+  ///             remaining nodes as sent.
+  ///
+  /// @param[in]  update  The nodes of a semantics update that is about to be
+  ///                     sent to the platform.
+  ///
+  void Encode(SemanticsNodeUpdates& update);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Forgets all the nodes that were sent so that the next update
+  ///             is sent in full.
+  ///
+  void Reset();
+
+  //----------------------------------------------------------------------------
+  /// @return     The number of nodes that the encoder knows the platform has.
+  ///
+  size_t GetSentNodeCount() const { return sent_nodes_.size(); }
+
+  //----------------------------------------------------------------------------
+  /// @return     Whether the two nodes carry the same semantics.
+  ///
+  static bool IsSameNode(const SemanticsNode& a, const SemanticsNode& b);
+
+ private:
+  SemanticsNodeUpdates sent_nodes_;
+
+  void ForgetSubtree(int32_t id);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(SemanticsDeltaEncoder);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_SEMANTICS_SEMANTICS_DELTA_ENCODER_H_
@@ -0,0 +1,117 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/semantics/semantics_delta_encoder.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+SemanticsNode CreateNode(int32_t id, std::vector<int32_t> children = {}) {
+  SemanticsNode node;
+  node.id = id;
+  node.label = "node " + std::to_string(id);
+  node.childrenInTraversalOrder = children;
+  node.childrenInHitTestOrder = children;
+  return node;
+}
+
+}  // namespace
+
+TEST(SemanticsDeltaEncoderTest, DropsUnchangedNodes) {
+  SemanticsDeltaEncoder encoder;
+  SemanticsNodeUpdates first = {
+      {0, CreateNode(0, {1, 2})},
+      {1, CreateNode(1)},
+      {2, CreateNode(2)},
+  };
+  encoder.Encode(first);
+  EXPECT_EQ(first.size(), 3u);
+  EXPECT_EQ(encoder.GetSentNodeCount(), 3u);
+
+  SemanticsNodeUpdates second = {
+      {0, CreateNode(0, {1, 2})},
+      {1, CreateNode(1)},
+      {2, CreateNode(2)},
+  };
+  second[2].label = "changed";
+  encoder.Encode(second);
+  ASSERT_EQ(second.size(), 1u);
+  EXPECT_EQ(second.begin()->first, 2);
+}
+
+TEST(SemanticsDeltaEncoderTest, ComparesUnsetScrollPositions) {
+  SemanticsNode node = CreateNode(0);
+  ASSERT_TRUE(std::isnan(node.scrollPosition));
+  EXPECT_TRUE(SemanticsDeltaEncoder::IsSameNode(node, CreateNode(0)));
+
+  SemanticsNode scrolled = CreateNode(0);
+  scrolled.scrollPosition = 10;
+  EXPECT_FALSE(SemanticsDeltaEncoder::IsSameNode(node, scrolled));
+}
+
+TEST(SemanticsDeltaEncoderTest, SendsReattachedNodesInFull) {
+  SemanticsDeltaEncoder encoder;
+  SemanticsNodeUpdates first = {
+      {0, CreateNode(0, {1})},
+      {1, CreateNode(1, {2})},
+      {2, CreateNode(2)},
+  };
+  encoder.Encode(first);
+
+  // Detaching a node forgets its subtree.
+  SemanticsNodeUpdates detach = {{0, CreateNode(0)}};
+  encoder.Encode(detach);
+  EXPECT_EQ(detach.size(), 1u);
+  EXPECT_EQ(encoder.GetSentNodeCount(), 1u);
+
+  SemanticsNodeUpdates reattach = {
+      {0, CreateNode(0, {1})},
+      {1, CreateNode(1, {2})},
+      {2, CreateNode(2)},
+  };
+  encoder.Encode(reattach);
+  EXPECT_EQ(reattach.size(), 3u);
+}
+
+TEST(SemanticsDeltaEncoderTest, KeepsUnchangedNodesThatMoveToANewParent) {
+  SemanticsDeltaEncoder encoder;
+  SemanticsNodeUpdates first = {
+      {0, CreateNode(0, {1, 2})},
+      {1, CreateNode(1, {3})},
+      {2, CreateNode(2)},
+      {3, CreateNode(3)},
+  };
+  encoder.Encode(first);
+
+  SemanticsNodeUpdates move = {
+      {1, CreateNode(1)},
+      {2, CreateNode(2, {3})},
+      {3, CreateNode(3)},
+  };
+  encoder.Encode(move);
+  EXPECT_EQ(move.size(), 3u);
+  EXPECT_EQ(encoder.GetSentNodeCount(), 4u);
+}
+
+TEST(SemanticsDeltaEncoderTest, ResetSendsTheNextUpdateInFull) {
+  SemanticsDeltaEncoder encoder;
+  SemanticsNodeUpdates first = {{0, CreateNode(0)}};
+  encoder.Encode(first);
+  encoder.Reset();
+
+  SemanticsNodeUpdates second = {{0, CreateNode(0)}};
+  encoder.Encode(second);
+  EXPECT_EQ(second.size(), 1u);
+}
+
+}  // namespace testing
+}  // namespace flutter
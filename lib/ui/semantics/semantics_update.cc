@@ -36,6 +36,10 @@ SemanticsNodeUpdates SemanticsUpdate::takeNodes() {
   return std::move(nodes_);
 }
 
+void SemanticsUpdate::EncodeDelta(SemanticsDeltaEncoder& encoder) {
+  encoder.Encode(nodes_);
+}
+
 CustomAccessibilityActionUpdates SemanticsUpdate::takeActions() {
   return std::move(actions_);
 }
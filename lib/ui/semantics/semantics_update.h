@@ -7,6 +7,7 @@
 
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/semantics/custom_accessibility_action.h"
+#include "flutter/lib/ui/semantics/semantics_delta_encoder.h"
 #include "flutter/lib/ui/semantics/semantics_node.h"
 
 namespace flutter {
@@ -23,6 +24,9 @@ class SemanticsUpdate : public RefCountedDartWrappable<SemanticsUpdate> {
 
   SemanticsNodeUpdates takeNodes();
 
+  // Removes the nodes that |encoder| has already sent to the platform.
+  void EncodeDelta(SemanticsDeltaEncoder& encoder);
+
   CustomAccessibilityActionUpdates takeActions();
 
   void dispose();
@@ -115,7 +115,7 @@ void SemanticsUpdateBuilder::updateNode(
   node.customAccessibilityActions = std::vector<int32_t>(
       localContextActions.data(),
       localContextActions.data() + localContextActions.num_elements());
-  nodes_[id] = node;
+  nodes_[id] = std::move(node);
 }
 
 void SemanticsUpdateBuilder::updateCustomAction(int id,
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_LIB_UI_SNAPSHOT_DELEGATE_H_
 #define FLUTTER_LIB_UI_SNAPSHOT_DELEGATE_H_
 
+#include <functional>
 #include <string>
 
 #include "flutter/common/graphics/texture.h"
@@ -56,6 +57,15 @@ class SnapshotDelegate {
       sk_sp<DisplayList> display_list,
       const SkImageInfo& image_info) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Gives back a texture of a GpuImageResult that is no longer
+  ///             used, so that later images of the same size can be drawn
+  ///             into it instead of a new texture.
+  ///
+  /// @return     Whether the texture was taken back. If not, the caller is
+  ///             responsible for deleting it.
+  virtual bool RecycleSkiaGpuTexture(const GrBackendTexture& texture) = 0;
+
   //----------------------------------------------------------------------------
   /// @brief      Gets the registry of external textures currently in use by the
   ///             rasterizer. These textures may be updated at a cadence
@@ -73,6 +83,26 @@ class SnapshotDelegate {
                                             SkISize picture_size) = 0;
 
   virtual sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Like |MakeRasterSnapshot|, but the pixels are read back from
+  ///             the GPU without blocking the raster thread. The callback is
+  ///             invoked on the raster thread once the snapshot is available,
+  ///             or with nullptr if it could not be created.
+  ///
+  virtual void MakeRasterSnapshotAsync(
+      sk_sp<DisplayList> display_list,
+      SkISize picture_size,
+      std::function<void(sk_sp<DlImage>)> callback) = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Like |ConvertToRasterImage|, but the pixels are read back
+  ///             from the GPU without blocking the raster thread. The callback
+  ///             is invoked on the raster thread.
+  ///
+  virtual void ConvertToRasterImageAsync(
+      sk_sp<SkImage> image,
+      std::function<void(sk_sp<SkImage>)> callback) = 0;
 };
 
 }  // namespace flutter
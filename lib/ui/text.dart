@@ -2760,6 +2760,33 @@ class Paragraph extends NativeFieldWrapperClass1 {
   @FfiNative<Void Function(Pointer<Void>, Double)>('Paragraph::layout', isLeaf: true)
   external void _layout(double width);
 
+  /// Computes the size and position of each glyph in the paragraph, like
+  /// [layout], but on a background thread.
+  ///
+  /// This allows text to be prepared ahead of time, for example for content
+  /// that is not on screen yet or to paginate a long document, without
+  /// blocking the production of frames.
+  ///
+  /// The paragraph must not be used until the returned future completes,
+  /// except that it may be disposed.
+  Future<void> layoutAsync(ParagraphConstraints constraints) {
+    assert(!_disposed);
+    assert(() {
+      _needsLayout = true;
+      return true;
+    }());
+    return _futurize((_Callback<void> callback) {
+      return _layoutAsync(constraints.width, callback);
+    }).then((void _) {
+      assert(() {
+        _needsLayout = false;
+        return true;
+      }());
+    });
+  }
+  @FfiNative<Handle Function(Pointer<Void>, Double, Handle)>('Paragraph::layoutAsync')
+  external String? _layoutAsync(double width, _Callback<void> callback);
+
   List<TextBox> _decodeTextBoxes(Float32List encoded) {
     final int count = encoded.length ~/ 5;
     final List<TextBox> boxes = <TextBox>[];
@@ -7,11 +7,16 @@
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/post_task_and_reply.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/dart_library_natives.h"
+#include "third_party/tonic/dart_persistent_value.h"
+#include "third_party/tonic/logging/dart_invoke.h"
 
 namespace flutter {
 
@@ -58,6 +63,63 @@ void Paragraph::layout(double width) {
   m_paragraph->Layout(width);
 }
 
+Dart_Handle Paragraph::layoutAsync(double width, Dart_Handle callback_handle) {
+  if (!Dart_IsClosure(callback_handle)) {
+    return tonic::ToDart("Callback must be a function");
+  }
+  if (!m_paragraph || layout_pending_) {
+    return tonic::ToDart("Paragraph is disposed or being laid out");
+  }
+
+  auto* dart_state = UIDartState::Current();
+  auto ui_task_runner = dart_state->GetTaskRunners().GetUITaskRunner();
+  auto callback =
+      std::make_unique<tonic::DartPersistentValue>(dart_state, callback_handle);
+
+  if (!m_paragraph->CanLayoutOnAnyThread()) {
+    // Still complete asynchronously so that callers do not depend on the
+    // paragraph implementation.
+    m_paragraph->Layout(width);
+    ui_task_runner->PostTask(
+        fml::MakeCopyable([callback = std::move(callback)]() {
+          auto dart_state = callback->dart_state().lock();
+          if (!dart_state) {
+            return;
+          }
+          tonic::DartState::Scope scope(dart_state);
+          tonic::DartInvoke(callback->Get(), {Dart_TypeVoid()});
+        }));
+    return Dart_Null();
+  }
+
+  // The worker owns the paragraph until it has been laid out, and the
+  // paragraph is handed back on the UI thread unless it was disposed in the
+  // meantime.
+  layout_pending_ = true;
+  fml::PostTaskAndReply(
+      dart_state->GetConcurrentTaskRunner().get(),
+      [paragraph = std::move(m_paragraph), width]() mutable {
+        paragraph->Layout(width);
+        return std::move(paragraph);
+      },
+      std::move(ui_task_runner),
+      [self = fml::Ref(this), callback = std::move(callback)](
+          std::unique_ptr<txt::Paragraph> paragraph) {
+        if (!self->layout_pending_) {
+          return;
+        }
+        self->layout_pending_ = false;
+        self->m_paragraph = std::move(paragraph);
+        auto dart_state = callback->dart_state().lock();
+        if (!dart_state) {
+          return;
+        }
+        tonic::DartState::Scope scope(dart_state);
+        tonic::DartInvoke(callback->Get(), {Dart_TypeVoid()});
+      });
+  return Dart_Null();
+}
+
 void Paragraph::paint(Canvas* canvas, double x, double y) {
   if (!m_paragraph || !canvas) {
     // disposed.
@@ -171,6 +233,7 @@ tonic::Float64List Paragraph::computeLineMetrics() {
 }
 
 void Paragraph::dispose() {
+  layout_pending_ = false;
   m_paragraph.reset();
   ClearDartWrapper();
 }
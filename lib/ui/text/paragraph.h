@@ -37,6 +37,7 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
   bool didExceedMaxLines();
 
   void layout(double width);
+  Dart_Handle layoutAsync(double width, Dart_Handle callback_handle);
   void paint(Canvas* canvas, double x, double y);
 
   tonic::Float32List getRectsForRange(unsigned start,
@@ -53,6 +54,8 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
 
  private:
   std::unique_ptr<txt::Paragraph> m_paragraph;
+  // Set while m_paragraph is handed to a worker by layoutAsync.
+  bool layout_pending_ = false;
 
   explicit Paragraph(std::unique_ptr<txt::Paragraph> paragraph);
 };
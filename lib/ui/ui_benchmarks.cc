@@ -10,6 +10,7 @@
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/testing/dart_isolate_runner.h"
 #include "flutter/testing/fixture_test.h"
+#include "third_party/tonic/logging/dart_error.h"
 
 #include <future>
 
@@ -112,9 +113,104 @@ static void BM_PathVolatilityTracker(benchmark::State& state) {
   }
 }
 
+// Measures the dart:ui native bindings used by |entrypoint| of the ui_test.dart
+// fixture, which performs the number of operations passed to it. Each
+// iteration is one invocation of |batch_size| operations, so that the time to
+// post to the isolate is amortized. If |setup_entrypoint| is set, it is
+// invoked once before the timed iterations and its microtasks are run.
+static void RunDartUIBenchmark(benchmark::State& state,
+                               const char* entrypoint,
+                               int64_t batch_size,
+                               const char* setup_entrypoint = nullptr) {
+  ThreadHost thread_host(ThreadHost::ThreadHostConfig(
+      "test", ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+                  ThreadHost::Type::IO | ThreadHost::Type::UI));
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  Fixture fixture;
+  auto settings = fixture.CreateSettingsForFixture();
+  auto vm_ref = DartVMRef::Create(settings);
+  // Paths are tracked for volatility, as they are in an engine.
+  auto volatile_path_tracker = std::make_shared<VolatilePathTracker>(
+      task_runners.GetUITaskRunner(), true);
+  auto isolate = testing::RunDartCodeInIsolate(
+      vm_ref, settings, task_runners, "main", {},
+      testing::GetDefaultKernelFilePath(), {}, volatile_path_tracker);
+  FML_CHECK(isolate && isolate->IsValid());
+
+  if (setup_entrypoint) {
+    FML_CHECK(isolate->RunInIsolateScope([setup_entrypoint]() -> bool {
+      Dart_Handle result =
+          Dart_Invoke(Dart_RootLibrary(),
+                      Dart_NewStringFromCString(setup_entrypoint), 0, nullptr);
+      return !tonic::CheckAndHandleError(result);
+    }));
+    // The microtasks of the setup run once the task that invoked it is done.
+    FML_CHECK(isolate->RunInIsolateScope([]() { return true; }));
+  }
+
+  for (auto _ : state) {
+    FML_CHECK(isolate->RunInIsolateScope([entrypoint, batch_size]() -> bool {
+      Dart_Handle args[] = {Dart_NewInteger(batch_size)};
+      Dart_Handle result = Dart_Invoke(
+          Dart_RootLibrary(), Dart_NewStringFromCString(entrypoint), 1, args);
+      return !tonic::CheckAndHandleError(result);
+    }));
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+static void BM_CanvasRecording(benchmark::State& state) {
+  RunDartUIBenchmark(state, "benchmarkCanvasRecording", state.range(0));
+}
+
+static void BM_PaintDecode(benchmark::State& state) {
+  RunDartUIBenchmark(state, "benchmarkPaintDecode", state.range(0));
+}
+
+static void BM_PathBuilding(benchmark::State& state) {
+  RunDartUIBenchmark(state, "benchmarkPathBuilding", state.range(0));
+}
+
+static void BM_SceneBuilderPushPop(benchmark::State& state) {
+  RunDartUIBenchmark(state, "benchmarkSceneBuilderPushPop", state.range(0));
+}
+
+static void BM_ImageDescriptorCreation(benchmark::State& state) {
+  RunDartUIBenchmark(state, "benchmarkImageDescriptorCreation",
+                     state.range(0), "prepareImageDescriptorBenchmark");
+}
+
 BENCHMARK(BM_PlatformMessageResponseDartComplete)
     ->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_PathVolatilityTracker)->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_CanvasRecording)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_PaintDecode)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_PathBuilding)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_SceneBuilderPushPop)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_ImageDescriptorCreation)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace flutter
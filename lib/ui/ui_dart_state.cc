@@ -8,6 +8,8 @@
 #include <utility>
 
 #include "flutter/fml/message_loop.h"
+#include "flutter/lib/ui/painting/attribute_interner.h"
+#include "flutter/lib/ui/painting/contour_measure_cache.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_message_handler.h"
@@ -70,7 +72,9 @@ UIDartState::UIDartState(
       log_message_callback_(std::move(log_message_callback)),
       isolate_name_server_(std::move(isolate_name_server)),
       enable_skparagraph_(enable_skparagraph),
-      context_(context) {
+      context_(context),
+      attribute_interner_(std::make_unique<AttributeInterner>()),
+      contour_measure_cache_(std::make_unique<ContourMeasureCache>()) {
   AddOrRemoveTaskObserver(true /* add */);
 }
 
@@ -199,6 +203,14 @@ std::shared_ptr<IsolateNameServer> UIDartState::GetIsolateNameServer() const {
   return isolate_name_server_;
 }
 
+AttributeInterner* UIDartState::GetAttributeInterner() const {
+  return attribute_interner_.get();
+}
+
+ContourMeasureCache* UIDartState::GetContourMeasureCache() const {
+  return contour_measure_cache_.get();
+}
+
 tonic::DartErrorHandleType UIDartState::GetLastError() {
   tonic::DartErrorHandleType error = message_handler().isolate_last_error();
   if (error == tonic::kNoError) {
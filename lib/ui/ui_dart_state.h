@@ -28,6 +28,8 @@
 #include "third_party/tonic/dart_state.h"
 
 namespace flutter {
+class AttributeInterner;
+class ContourMeasureCache;
 class FontSelector;
 class ImageGeneratorRegistry;
 class PlatformConfiguration;
@@ -143,6 +145,13 @@ class UIDartState : public tonic::DartState {
 
   std::shared_ptr<IsolateNameServer> GetIsolateNameServer() const;
 
+  // The intern table for the DisplayList attributes of dart:ui objects
+  // created by this isolate.
+  AttributeInterner* GetAttributeInterner() const;
+
+  // The cache of the contours of paths recently measured by this isolate.
+  ContourMeasureCache* GetContourMeasureCache() const;
+
   tonic::DartErrorHandleType GetLastError();
 
   // Logs `print` messages from the application via an embedder-specified
@@ -212,6 +221,8 @@ class UIDartState : public tonic::DartState {
   const std::shared_ptr<IsolateNameServer> isolate_name_server_;
   const bool enable_skparagraph_;
   UIDartState::Context context_;
+  std::unique_ptr<AttributeInterner> attribute_interner_;
+  std::unique_ptr<ContourMeasureCache> contour_measure_cache_;
 
   void AddOrRemoveTaskObserver(bool add);
 };
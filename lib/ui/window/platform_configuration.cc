@@ -22,8 +22,22 @@
 namespace flutter {
 namespace {
 
-Dart_Handle ToByteData(const fml::Mapping& buffer) {
-  return tonic::DartByteData::Create(buffer.GetMapping(), buffer.GetSize());
+void FreeFinalizer(void* isolate_callback_data, void* peer) {
+  free(peer);
+}
+
+// Small payloads are copied into the Dart heap. Larger ones are handed to
+// Dart without a copy, as external typed data that frees the buffer when it
+// is collected. Their size is reported to the Dart GC as an external
+// allocation so that large messages still trigger collections.
+Dart_Handle ToByteData(fml::MallocMapping buffer) {
+  const size_t size = buffer.GetSize();
+  if (size < tonic::DartByteData::kExternalSizeThreshold) {
+    return tonic::DartByteData::Create(buffer.GetMapping(), size);
+  }
+  uint8_t* data = buffer.Release();
+  return tonic::DartByteData::CreateExternal(data, size, /*peer=*/data,
+                                             FreeFinalizer);
 }
 
 }  // namespace
@@ -115,6 +129,9 @@ void PlatformConfiguration::UpdateLifecycleState(const std::string& data) {
 }
 
 void PlatformConfiguration::UpdateSemanticsEnabled(bool enabled) {
+  // The platform drops its semantics tree when semantics are disabled.
+  semantics_delta_encoder_.Reset();
+
   std::shared_ptr<tonic::DartState> dart_state =
       update_semantics_enabled_.dart_state().lock();
   if (!dart_state) {
@@ -141,34 +158,45 @@ void PlatformConfiguration::UpdateAccessibilityFeatures(int32_t values) {
 
 void PlatformConfiguration::DispatchPlatformMessage(
     std::unique_ptr<PlatformMessage> message) {
+  std::vector<std::unique_ptr<PlatformMessage>> messages;
+  messages.push_back(std::move(message));
+  DispatchPlatformMessages(std::move(messages));
+}
+
+void PlatformConfiguration::DispatchPlatformMessages(
+    std::vector<std::unique_ptr<PlatformMessage>> messages) {
   std::shared_ptr<tonic::DartState> dart_state =
       dispatch_platform_message_.dart_state().lock();
   if (!dart_state) {
-    FML_DLOG(WARNING)
-        << "Dropping platform message for lack of DartState on channel: "
-        << message->channel();
+    for (const auto& message : messages) {
+      FML_DLOG(WARNING)
+          << "Dropping platform message for lack of DartState on channel: "
+          << message->channel();
+    }
     return;
   }
   tonic::DartState::Scope scope(dart_state);
-  Dart_Handle data_handle =
-      (message->hasData()) ? ToByteData(message->data()) : Dart_Null();
-  if (Dart_IsError(data_handle)) {
-    FML_DLOG(WARNING)
-        << "Dropping platform message because of a Dart error on channel: "
-        << message->channel();
-    return;
-  }
-
-  int response_id = 0;
-  if (auto response = message->response()) {
-    response_id = next_response_id_++;
-    pending_responses_[response_id] = response;
+  for (const auto& message : messages) {
+    Dart_Handle data_handle =
+        (message->hasData()) ? ToByteData(message->releaseData()) : Dart_Null();
+    if (Dart_IsError(data_handle)) {
+      FML_DLOG(WARNING)
+          << "Dropping platform message because of a Dart error on channel: "
+          << message->channel();
+      continue;
+    }
+
+    int response_id = 0;
+    if (auto response = message->response()) {
+      response_id = next_response_id_++;
+      pending_responses_[response_id] = response;
+    }
+
+    tonic::CheckAndHandleError(
+        tonic::DartInvoke(dispatch_platform_message_.Get(),
+                          {tonic::ToDart(message->channel()), data_handle,
+                           tonic::ToDart(response_id)}));
   }
-
-  tonic::CheckAndHandleError(
-      tonic::DartInvoke(dispatch_platform_message_.Get(),
-                        {tonic::ToDart(message->channel()), data_handle,
-                         tonic::ToDart(response_id)}));
 }
 
 void PlatformConfiguration::DispatchSemanticsAction(int32_t id,
@@ -182,7 +210,7 @@ void PlatformConfiguration::DispatchSemanticsAction(int32_t id,
   tonic::DartState::Scope scope(dart_state);
 
   Dart_Handle args_handle =
-      (args.GetSize() <= 0) ? Dart_Null() : ToByteData(args);
+      (args.GetSize() <= 0) ? Dart_Null() : ToByteData(std::move(args));
 
   if (Dart_IsError(args_handle)) {
     return;
@@ -407,8 +435,10 @@ void PlatformConfigurationNativeApi::ScheduleFrame() {
 
 void PlatformConfigurationNativeApi::UpdateSemantics(SemanticsUpdate* update) {
   UIDartState::ThrowIfUIOperationsProhibited();
-  UIDartState::Current()->platform_configuration()->client()->UpdateSemantics(
-      update);
+  PlatformConfiguration* platform_configuration =
+      UIDartState::Current()->platform_configuration();
+  update->EncodeDelta(platform_configuration->semantics_delta_encoder());
+  platform_configuration->client()->UpdateSemantics(update);
 }
 
 Dart_Handle PlatformConfigurationNativeApi::ComputePlatformResolvedLocale(
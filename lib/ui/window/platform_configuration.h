@@ -319,6 +319,18 @@ class PlatformConfiguration final {
   ///
   void DispatchPlatformMessage(std::unique_ptr<PlatformMessage> message);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Notifies the PlatformConfiguration that the client has sent
+  ///             it several messages at once. The messages are delivered to
+  ///             the Dart application in order, within a single entry into
+  ///             the isolate.
+  ///
+  /// @param[in]  messages  The messages sent from the embedder to the Dart
+  ///                       application.
+  ///
+  void DispatchPlatformMessages(
+      std::vector<std::unique_ptr<PlatformMessage>> messages);
+
   //----------------------------------------------------------------------------
   /// @brief      Notifies the framework that the embedder encountered an
   ///             accessibility related action on the specified node. This call
@@ -421,6 +433,15 @@ class PlatformConfiguration final {
 
   Dart_Handle on_error() { return on_error_.Get(); }
 
+  //----------------------------------------------------------------------------
+  /// @brief      The encoder that removes the nodes that the platform already
+  ///             has from the semantics updates of the framework. It is reset
+  ///             whenever semantics are enabled or disabled.
+  ///
+  SemanticsDeltaEncoder& semantics_delta_encoder() {
+    return semantics_delta_encoder_;
+  }
+
  private:
   PlatformConfigurationClient* client_;
   tonic::DartPersistentValue on_error_;
@@ -437,6 +458,8 @@ class PlatformConfiguration final {
 
   std::unordered_map<int64_t, std::unique_ptr<Window>> windows_;
 
+  SemanticsDeltaEncoder semantics_delta_encoder_;
+
   // ID starts at 1 because an ID of 0 indicates that no response is expected.
   int next_response_id_ = 1;
   std::unordered_map<int, fml::RefPtr<PlatformMessageResponse>>
@@ -75,13 +75,8 @@ void PlatformMessageResponseDart::Complete(std::unique_ptr<fml::Mapping> data) {
         intptr_t size = data->GetSize();
         if (data->GetSize() > tonic::DartByteData::kExternalSizeThreshold) {
           const void* mapping = data->GetMapping();
-          byte_buffer = Dart_NewUnmodifiableExternalTypedDataWithFinalizer(
-              /*type=*/Dart_TypedData_kByteData,
-              /*data=*/mapping,
-              /*length=*/size,
-              /*peer=*/data.release(),
-              /*external_allocation_size=*/size,
-              /*callback=*/MappingFinalizer);
+          byte_buffer = tonic::DartByteData::CreateUnmodifiableExternal(
+              mapping, size, /*peer=*/data.release(), MappingFinalizer);
         } else {
           Dart_Handle mutable_byte_buffer =
               tonic::DartByteData::Create(data->GetMapping(), data->GetSize());
@@ -17,6 +17,13 @@
 #include "third_party/tonic/typed_data/dart_byte_data.h"
 
 namespace flutter {
+namespace {
+
+void MappingFinalizer(void* isolate_callback_data, void* peer) {
+  delete static_cast<fml::Mapping*>(peer);
+}
+
+}  // namespace
 
 PlatformMessageResponseDartPort::PlatformMessageResponseDartPort(
     Dart_Port send_port,
@@ -33,12 +40,26 @@ void PlatformMessageResponseDartPort::Complete(
       .type = Dart_CObject_kInt64,
   };
   response_identifier.value.as_int64 = identifier_;
-  Dart_CObject response_data = {
-      .type = Dart_CObject_kTypedData,
-  };
-  response_data.value.as_typed_data.type = Dart_TypedData_kUint8;
-  response_data.value.as_typed_data.length = data->GetSize();
-  response_data.value.as_typed_data.values = data->GetMapping();
+  Dart_CObject response_data;
+  // Large responses are sent without copying them into the message. The
+  // receiving isolate owns the mapping once the message is posted and
+  // collects it with the typed data.
+  const bool is_external =
+      data->GetSize() >= tonic::DartByteData::kExternalSizeThreshold;
+  if (is_external) {
+    response_data.type = Dart_CObject_kUnmodifiableExternalTypedData;
+    response_data.value.as_external_typed_data.type = Dart_TypedData_kUint8;
+    response_data.value.as_external_typed_data.length = data->GetSize();
+    response_data.value.as_external_typed_data.data =
+        const_cast<uint8_t*>(data->GetMapping());
+    response_data.value.as_external_typed_data.peer = data.get();
+    response_data.value.as_external_typed_data.callback = MappingFinalizer;
+  } else {
+    response_data.type = Dart_CObject_kTypedData;
+    response_data.value.as_typed_data.type = Dart_TypedData_kUint8;
+    response_data.value.as_typed_data.length = data->GetSize();
+    response_data.value.as_typed_data.values = data->GetMapping();
+  }
 
   std::array<Dart_CObject*, 2> response_values = {&response_identifier,
                                                   &response_data};
@@ -51,6 +72,10 @@ void PlatformMessageResponseDartPort::Complete(
 
   bool did_send = Dart_PostCObject(send_port_, &response);
   FML_CHECK(did_send);
+  if (is_external) {
+    // Owned by the message now.
+    data.release();
+  }
 }
 
 void PlatformMessageResponseDartPort::CompleteEmpty() {
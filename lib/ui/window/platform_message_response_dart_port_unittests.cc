@@ -14,30 +14,32 @@
 namespace flutter {
 namespace testing {
 
-TEST_F(ShellTest, PlatformMessageResponseDartPort) {
+static void TestPlatformMessageResponseDartPort(ShellTest* fixture,
+                                                size_t response_size,
+                                                const char* entrypoint) {
   bool did_pass = false;
   auto message_latch = std::make_shared<fml::AutoResetWaitableEvent>();
-  TaskRunners task_runners("test",                  // label
-                           GetCurrentTaskRunner(),  // platform
-                           CreateNewThread(),       // raster
-                           CreateNewThread(),       // ui
-                           CreateNewThread()        // io
+  TaskRunners task_runners("test",                           // label
+                           fixture->GetCurrentTaskRunner(),  // platform
+                           fixture->CreateNewThread(),       // raster
+                           fixture->CreateNewThread(),       // ui
+                           fixture->CreateNewThread()        // io
   );
 
   auto nativeCallPlatformMessageResponseDartPort =
-      [ui_task_runner =
-           task_runners.GetUITaskRunner()](Dart_NativeArguments args) {
+      [response_size](Dart_NativeArguments args) {
         auto dart_state = std::make_shared<tonic::DartState>();
         auto response = fml::MakeRefCounted<PlatformMessageResponseDartPort>(
             tonic::DartConverter<int64_t>::FromDart(
                 Dart_GetNativeArgument(args, 0)),
             123, "foobar");
-        uint8_t* data = static_cast<uint8_t*>(malloc(100));
-        auto mapping = std::make_unique<fml::MallocMapping>(data, 100);
+        uint8_t* data = static_cast<uint8_t*>(malloc(response_size));
+        auto mapping =
+            std::make_unique<fml::MallocMapping>(data, response_size);
         response->Complete(std::move(mapping));
       };
 
-  AddNativeCallback(
+  fixture->AddNativeCallback(
       "CallPlatformMessageResponseDartPort",
       CREATE_NATIVE_ENTRY(nativeCallPlatformMessageResponseDartPort));
 
@@ -48,16 +50,16 @@ TEST_F(ShellTest, PlatformMessageResponseDartPort) {
     message_latch->Signal();
   };
 
-  AddNativeCallback("FinishCallResponse",
-                    CREATE_NATIVE_ENTRY(nativeFinishCallResponse));
+  fixture->AddNativeCallback("FinishCallResponse",
+                             CREATE_NATIVE_ENTRY(nativeFinishCallResponse));
 
-  Settings settings = CreateSettingsForFixture();
+  Settings settings = fixture->CreateSettingsForFixture();
 
-  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+  std::unique_ptr<Shell> shell = fixture->CreateShell(settings, task_runners);
 
   ASSERT_TRUE(shell->IsSetup());
   auto configuration = RunConfiguration::InferFromSettings(settings);
-  configuration.SetEntrypoint("platformMessagePortResponseTest");
+  configuration.SetEntrypoint(entrypoint);
 
   shell->RunEngine(std::move(configuration), [](auto result) {
     ASSERT_EQ(result, Engine::RunStatus::Success);
@@ -66,7 +68,18 @@ TEST_F(ShellTest, PlatformMessageResponseDartPort) {
   message_latch->Wait();
 
   ASSERT_TRUE(did_pass);
-  DestroyShell(std::move(shell), task_runners);
+  fixture->DestroyShell(std::move(shell), task_runners);
+}
+
+TEST_F(ShellTest, PlatformMessageResponseDartPort) {
+  TestPlatformMessageResponseDartPort(this, 100,
+                                      "platformMessagePortResponseTest");
+}
+
+TEST_F(ShellTest, PlatformMessageResponseDartPortSendsLargeResponses) {
+  // Large enough to be sent as external typed data.
+  TestPlatformMessageResponseDartPort(this, 2000,
+                                      "platformMessagePortLargeResponseTest");
 }
 
 }  // namespace testing
@@ -22,6 +22,10 @@ void PointerDataPacket::SetPointerData(size_t i, const PointerData& data) {
   memcpy(&data_[i * sizeof(PointerData)], &data, sizeof(PointerData));
 }
 
+void PointerDataPacket::Append(const PointerDataPacket& other) {
+  data_.insert(data_.end(), other.data_.begin(), other.data_.end());
+}
+
 PointerData PointerDataPacket::GetPointerData(size_t i) const {
   FML_DCHECK(i < GetLength());
   PointerData result;
@@ -20,6 +20,9 @@ class PointerDataPacket {
   ~PointerDataPacket();
 
   void SetPointerData(size_t i, const PointerData& data);
+  // Appends the pointer data of |other| after the pointer data of this
+  // packet.
+  void Append(const PointerDataPacket& other);
   PointerData GetPointerData(size_t i) const;
   size_t GetLength() const;
   const std::vector<uint8_t>& data() const { return data_; }
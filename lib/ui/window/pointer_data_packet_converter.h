@@ -101,6 +101,9 @@ class PointerDataPacketConverter {
 
   int64_t pointer_;
 
+  // The pointer data converted from the last packet.
+  std::vector<PointerData> converted_pointers_;
+
   void ConvertPointerData(PointerData pointer_data,
                           std::vector<PointerData>& converted_pointers);
 
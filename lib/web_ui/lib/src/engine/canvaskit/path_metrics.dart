@@ -111,6 +111,23 @@ class CkContourMeasure extends ManagedSkiaObject<SkContourMeasure>
     return CkPath.fromSkPath(skPath, _metrics._path.fillType);
   }
 
+  @override
+  ui.Path extractPathSegments(List<double> startAndEndDistances,
+      {bool startWithMoveTo = true}) {
+    final ui.Path path = ui.Path()..fillType = _metrics._path.fillType;
+    for (int i = 0; i + 1 < startAndEndDistances.length; i += 2) {
+      final ui.Path segment = extractPath(
+          startAndEndDistances[i], startAndEndDistances[i + 1],
+          startWithMoveTo: startWithMoveTo);
+      if (startWithMoveTo) {
+        path.addPath(segment, ui.Offset.zero);
+      } else {
+        path.extendWithPath(segment, ui.Offset.zero);
+      }
+    }
+    return path;
+  }
+
   @override
   ui.Tangent getTangentForOffset(double distance) {
     final Float32List posTan = skiaObject.getPosTan(distance);
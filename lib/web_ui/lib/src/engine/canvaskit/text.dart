@@ -788,6 +788,13 @@ class CkParagraph extends SkiaObject<SkParagraph> implements ui.Paragraph {
     return ui.TextRange(start: skRange.start, end: skRange.end);
   }
 
+  @override
+  Future<void> layoutAsync(ui.ParagraphConstraints constraints) {
+    // The web has no background threads to lay out paragraphs on.
+    layout(constraints);
+    return Future<void>.value();
+  }
+
   @override
   void layout(ui.ParagraphConstraints constraints) {
     if (_lastLayoutConstraints == constraints) {
@@ -601,6 +601,23 @@ class SurfacePathMetric implements ui.PathMetric {
         startWithMoveTo: startWithMoveTo);
   }
 
+  @override
+  ui.Path extractPathSegments(List<double> startAndEndDistances,
+      {bool startWithMoveTo = true}) {
+    final ui.Path path = ui.Path();
+    for (int i = 0; i + 1 < startAndEndDistances.length; i += 2) {
+      final ui.Path segment = extractPath(
+          startAndEndDistances[i], startAndEndDistances[i + 1],
+          startWithMoveTo: startWithMoveTo);
+      if (startWithMoveTo) {
+        path.addPath(segment, ui.Offset.zero);
+      } else {
+        path.extendWithPath(segment, ui.Offset.zero);
+      }
+    }
+    return path;
+  }
+
   @override
   String toString() => 'PathMetric';
 }
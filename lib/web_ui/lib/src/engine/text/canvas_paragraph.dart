@@ -88,6 +88,13 @@ class CanvasParagraph implements ui.Paragraph {
   late final TextLayoutService _layoutService = TextLayoutService(this);
   late final TextPaintService _paintService = TextPaintService(this);
 
+  @override
+  Future<void> layoutAsync(ui.ParagraphConstraints constraints) {
+    // The web has no background threads to lay out paragraphs on.
+    layout(constraints);
+    return Future<void>.value();
+  }
+
   @override
   void layout(ui.ParagraphConstraints constraints) {
     // When constraint width has a decimal place, we floor it to avoid getting
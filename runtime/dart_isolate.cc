@@ -8,6 +8,7 @@
 #include <tuple>
 #include <utility>
 
+#include "flutter/fml/closure.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/posix_wrappers.h"
 #include "flutter/fml/trace_event.h"
@@ -41,6 +42,10 @@ namespace {
 
 constexpr std::string_view kFileUriPrefix = "file://";
 
+// How long a deferred startup of the service isolate waits for the first
+// frame to be rasterized.
+constexpr int64_t kDeferredServiceIsolateStartupTimeoutSeconds = 10;
+
 class DartErrorString {
  public:
   DartErrorString() {}
@@ -196,19 +201,24 @@ std::weak_ptr<DartIsolate> DartIsolate::CreateRootIsolate(
     const DartIsolate* spawning_isolate) {
   TRACE_EVENT0("flutter", "DartIsolate::CreateRootIsolate");
 
-  // The child isolate preparer is null but will be set when the isolate is
-  // being prepared to run.
-  auto isolate_group_data =
-      std::make_unique<std::shared_ptr<DartIsolateGroupData>>(
-          std::shared_ptr<DartIsolateGroupData>(new DartIsolateGroupData(
-              settings,                            // settings
-              std::move(isolate_snapshot),         // isolate snapshot
-              context.advisory_script_uri,         // advisory URI
-              context.advisory_script_entrypoint,  // advisory entrypoint
-              nullptr,                             // child isolate preparer
-              isolate_create_callback,             // isolate create callback
-              isolate_shutdown_callback            // isolate shutdown callback
-              )));
+  // Spawned isolates join the group of the spawning isolate and the VM only
+  // ever hands them the data of that group, so they don't get their own.
+  std::unique_ptr<std::shared_ptr<DartIsolateGroupData>> isolate_group_data;
+  if (!spawning_isolate) {
+    // The child isolate preparer is null but will be set when the isolate is
+    // being prepared to run.
+    isolate_group_data =
+        std::make_unique<std::shared_ptr<DartIsolateGroupData>>(
+            std::shared_ptr<DartIsolateGroupData>(new DartIsolateGroupData(
+                settings,                            // settings
+                std::move(isolate_snapshot),         // isolate snapshot
+                context.advisory_script_uri,         // advisory URI
+                context.advisory_script_entrypoint,  // advisory entrypoint
+                nullptr,                             // child isolate preparer
+                isolate_create_callback,             // isolate create callback
+                isolate_shutdown_callback  // isolate shutdown callback
+                )));
+  }
 
   auto isolate_data = std::make_unique<std::shared_ptr<DartIsolate>>(
       std::shared_ptr<DartIsolate>(new DartIsolate(settings,  // settings
@@ -222,23 +232,23 @@ std::weak_ptr<DartIsolate> DartIsolate::CreateRootIsolate(
 
   IsolateMaker isolate_maker;
   if (spawning_isolate) {
-    isolate_maker = [spawning_isolate](
-                        std::shared_ptr<DartIsolateGroupData>*
-                            isolate_group_data,
-                        std::shared_ptr<DartIsolate>* isolate_data,
-                        Dart_IsolateFlags* flags, char** error) {
-      return Dart_CreateIsolateInGroup(
-          /*group_member=*/spawning_isolate->isolate(),
-          /*name=*/(*isolate_group_data)->GetAdvisoryScriptEntrypoint().c_str(),
-          /*shutdown_callback=*/
-          reinterpret_cast<Dart_IsolateShutdownCallback>(
-              DartIsolate::SpawnIsolateShutdownCallback),
-          /*cleanup_callback=*/
-          reinterpret_cast<Dart_IsolateCleanupCallback>(
-              DartIsolateCleanupCallback),
-          /*child_isolate_data=*/isolate_data,
-          /*error=*/error);
-    };
+    isolate_maker =
+        [spawning_isolate, name = context.advisory_script_entrypoint](
+            std::shared_ptr<DartIsolateGroupData>* isolate_group_data,
+            std::shared_ptr<DartIsolate>* isolate_data,
+            Dart_IsolateFlags* flags, char** error) {
+          return Dart_CreateIsolateInGroup(
+              /*group_member=*/spawning_isolate->isolate(),
+              /*name=*/name.c_str(),
+              /*shutdown_callback=*/
+              reinterpret_cast<Dart_IsolateShutdownCallback>(
+                  DartIsolate::SpawnIsolateShutdownCallback),
+              /*cleanup_callback=*/
+              reinterpret_cast<Dart_IsolateCleanupCallback>(
+                  DartIsolateCleanupCallback),
+              /*child_isolate_data=*/isolate_data,
+              /*error=*/error);
+        };
   } else {
     isolate_maker = [](std::shared_ptr<DartIsolateGroupData>*
                            isolate_group_data,
@@ -770,6 +780,21 @@ Dart_Isolate DartIsolate::DartCreateAndStartServiceIsolate(
     return nullptr;
   }
 
+  // The VM service is only needed once a tool attaches, so its startup can
+  // wait for the first frame. Apps that start paused need the VM service
+  // before they can render anything.
+  const bool defer_startup =
+      settings.defer_vm_service_startup && !settings.start_paused;
+  if (defer_startup) {
+    DartServiceIsolate::WaitForDeferredStartup(fml::TimeDelta::FromSeconds(
+        kDeferredServiceIsolateStartupTimeoutSeconds));
+  }
+  fml::ScopedCleanupClosure restore_thread_priority([defer_startup]() {
+    if (defer_startup) {
+      DartServiceIsolate::RestoreThreadPriority();
+    }
+  });
+
   flags->load_vmservice_library = true;
 
 #if (FLUTTER_RUNTIME_MODE != FLUTTER_RUNTIME_MODE_DEBUG)
@@ -981,6 +1006,7 @@ Dart_Isolate DartIsolate::CreateDartIsolateGroup(
   TRACE_EVENT0("flutter", "DartIsolate::CreateDartIsolateGroup");
 
   // Create the Dart VM isolate and give it the embedder object as the baton.
+  // The isolate group data is null if the isolate joins an existing group.
   Dart_Isolate isolate =
       make_isolate(isolate_group_data.get(), isolate_data.get(), flags, error);
 
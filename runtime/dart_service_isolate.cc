@@ -9,6 +9,9 @@
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/posix_wrappers.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/runtime/embedder_resources.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -34,6 +37,7 @@ namespace {
 static Dart_LibraryTagHandler g_embedder_tag_handler;
 static tonic::DartLibraryNatives* g_natives;
 static std::string g_observatory_uri;
+static fml::ManualResetWaitableEvent g_deferred_startup_allowed;
 
 Dart_NativeFunction GetNativeFunction(Dart_Handle name,
                                       int argument_count,
@@ -122,6 +126,29 @@ bool DartServiceIsolate::RemoveServerStatusCallback(
   return true;
 }
 
+void DartServiceIsolate::DeferStartup() {
+  g_deferred_startup_allowed.Reset();
+}
+
+void DartServiceIsolate::AllowDeferredStartup() {
+  g_deferred_startup_allowed.Signal();
+}
+
+void DartServiceIsolate::WaitForDeferredStartup(fml::TimeDelta timeout) {
+  TRACE_EVENT0("flutter", "DartServiceIsolate::WaitForDeferredStartup");
+  fml::Thread::SetCurrentThreadPriority(
+      fml::Thread::ThreadPriority::BACKGROUND);
+  if (g_deferred_startup_allowed.WaitWithTimeout(timeout)) {
+    FML_LOG(INFO) << "Starting the deferred VM service after the first frame "
+                     "did not arrive within "
+                  << timeout.ToMilliseconds() << "ms.";
+  }
+}
+
+void DartServiceIsolate::RestoreThreadPriority() {
+  fml::Thread::SetCurrentThreadPriority(fml::Thread::ThreadPriority::NORMAL);
+}
+
 void DartServiceIsolate::Shutdown(Dart_NativeArguments args) {
   // NO-OP.
 }
@@ -11,6 +11,7 @@
 #include <string>
 
 #include "flutter/fml/compiler_specific.h"
+#include "flutter/fml/time/time_delta.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 
 namespace flutter {
@@ -95,6 +96,48 @@ class DartServiceIsolate {
   ///
   static bool RemoveServerStatusCallback(CallbackHandle handle);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Make the next startup of the service isolate wait in
+  ///             `WaitForDeferredStartup` until `AllowDeferredStartup` is
+  ///             called. Must be called before the VM requests the creation
+  ///             of the service isolate.
+  ///
+  ///             This method is thread safe.
+  ///
+  static void DeferStartup();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Let a deferred startup of the service isolate proceed. This
+  ///             is called once the first frame has been rasterized, and by
+  ///             the VM before it shuts down, since VM shutdown waits for the
+  ///             service isolate to have started.
+  ///
+  ///             This method is thread safe.
+  ///
+  static void AllowDeferredStartup();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Called by the service isolate creation callback to wait for
+  ///             a deferred startup to be allowed. The VM creates the service
+  ///             isolate on a thread of its own, so the wait only delays the
+  ///             service isolate and not the rest of the engine. The calling
+  ///             thread is lowered to background priority, and stays there
+  ///             until `RestoreThreadPriority` is called, so that the startup
+  ///             work does not compete with the first frames either.
+  ///
+  /// @param[in]  timeout  The longest time to wait. The startup proceeds
+  ///                      once it expires so that apps that never rasterize a
+  ///                      frame can still be inspected.
+  ///
+  static void WaitForDeferredStartup(fml::TimeDelta timeout);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Restore the normal priority of a thread that waited in
+  ///             `WaitForDeferredStartup`. The VM reuses the thread for other
+  ///             work once the service isolate has started.
+  ///
+  static void RestoreThreadPriority();
+
  private:
   // Native entries.
   static void NotifyServerState(Dart_NativeArguments args);
@@ -4,6 +4,9 @@
 
 #include "flutter/runtime/dart_service_isolate.h"
 
+#include <thread>
+
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/testing/testing.h"
 
 namespace flutter {
@@ -15,4 +18,27 @@ TEST(DartServiceIsolateTest, CanAddAndRemoveHandles) {
   ASSERT_TRUE(DartServiceIsolate::RemoveServerStatusCallback(handle));
 }
 
+TEST(DartServiceIsolateTest, DeferredStartupWaitsUntilAllowed) {
+  DartServiceIsolate::DeferStartup();
+  fml::AutoResetWaitableEvent started;
+  std::thread thread([&started]() {
+    DartServiceIsolate::WaitForDeferredStartup(fml::TimeDelta::FromSeconds(60));
+    DartServiceIsolate::RestoreThreadPriority();
+    started.Signal();
+  });
+  // |WaitWithTimeout| returns true when it times out.
+  EXPECT_TRUE(started.WaitWithTimeout(fml::TimeDelta::FromMilliseconds(50)));
+  DartServiceIsolate::AllowDeferredStartup();
+  started.Wait();
+  thread.join();
+}
+
+TEST(DartServiceIsolateTest, DeferredStartupProceedsAfterTimeout) {
+  DartServiceIsolate::DeferStartup();
+  DartServiceIsolate::WaitForDeferredStartup(
+      fml::TimeDelta::FromMilliseconds(10));
+  DartServiceIsolate::RestoreThreadPriority();
+  DartServiceIsolate::AllowDeferredStartup();
+}
+
 }  // namespace flutter
@@ -34,9 +34,16 @@ static std::unique_ptr<const fml::Mapping> GetFileMapping(
     bool executable) {
   if (executable) {
     return fml::FileMapping::CreateReadExecute(path);
-  } else {
-    return fml::FileMapping::CreateReadOnly(path);
   }
+  auto mapping = fml::FileMapping::CreateReadOnly(path);
+  // Most of the snapshot data is read when the isolate is created, so start
+  // reading it in the background instead of faulting it in page by page.
+  // Only the instructions that are executed are ever touched, so they are
+  // left alone.
+  if (mapping) {
+    mapping->Prefetch();
+  }
+  return mapping;
 }
 
 // The first party embedders don't yet use the stable embedder API and depend on
@@ -254,6 +261,14 @@ const uint8_t* DartSnapshot::GetInstructionsMapping() const {
   return instructions_ ? instructions_->GetMapping() : nullptr;
 }
 
+const fml::Mapping* DartSnapshot::GetData() const {
+  return data_.get();
+}
+
+const fml::Mapping* DartSnapshot::GetInstructions() const {
+  return instructions_.get();
+}
+
 bool DartSnapshot::IsDontNeedSafe() const {
   if (data_ && !data_->IsDontNeedSafe()) {
     return false;
@@ -160,6 +160,20 @@ class DartSnapshot : public fml::RefCountedThreadSafe<DartSnapshot> {
   ///
   const uint8_t* GetInstructionsMapping() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Get the mapping backing the heap snapshot.
+  ///
+  /// @return     The data mapping or `nullptr` if there is none.
+  ///
+  const fml::Mapping* GetData() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get the mapping backing the instructions snapshot.
+  ///
+  /// @return     The instructions mapping or `nullptr` if there is none.
+  ///
+  const fml::Mapping* GetInstructions() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Returns whether both the data and instructions mappings are
   ///             safe to use with madvise(DONTNEED).
@@ -0,0 +1,163 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/dart_snapshot_profile.h"
+
+#include <cstring>
+#include <vector>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/paths.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+// The profile starts with a magic number and a version, followed by one
+// section per snapshot mapping in the order of |GetSnapshotMappings|. Each
+// section holds the size of the mapping, the number of its pages and a bitmap
+// of the resident pages.
+static constexpr uint32_t kProfileMagic = 0x50505346;  // "FSPP"
+static constexpr uint32_t kProfileVersion = 1;
+static constexpr size_t kSnapshotMappingCount = 4;
+
+static std::vector<const fml::Mapping*> GetSnapshotMappings(
+    const DartVMData& vm_data) {
+  const DartSnapshot& vm_snapshot = vm_data.GetVMSnapshot();
+  auto isolate_snapshot = vm_data.GetIsolateSnapshot();
+  return {
+      vm_snapshot.GetData(),
+      vm_snapshot.GetInstructions(),
+      isolate_snapshot ? isolate_snapshot->GetData() : nullptr,
+      isolate_snapshot ? isolate_snapshot->GetInstructions() : nullptr,
+  };
+}
+
+template <typename T>
+static void Append(std::vector<uint8_t>& buffer, T value) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+static bool Read(const uint8_t*& cursor, const uint8_t* end, T* value) {
+  if (static_cast<size_t>(end - cursor) < sizeof(T)) {
+    return false;
+  }
+  memcpy(value, cursor, sizeof(T));
+  cursor += sizeof(T);
+  return true;
+}
+
+bool DartSnapshotProfile::Prefetch(const std::string& path,
+                                   const DartVMData& vm_data) {
+  TRACE_EVENT0("flutter", "DartSnapshotProfile::Prefetch");
+  auto profile = fml::FileMapping::CreateReadOnly(path);
+  if (!profile || profile->GetSize() == 0) {
+    return false;
+  }
+
+  const uint8_t* cursor = profile->GetMapping();
+  const uint8_t* end = cursor + profile->GetSize();
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  if (!Read(cursor, end, &magic) || !Read(cursor, end, &version) ||
+      magic != kProfileMagic || version != kProfileVersion) {
+    FML_LOG(ERROR) << "Ignoring snapshot prefetch profile " << path
+                   << " with an unknown format.";
+    return false;
+  }
+
+  bool prefetched = false;
+  for (const fml::Mapping* mapping : GetSnapshotMappings(vm_data)) {
+    uint64_t mapping_size = 0;
+    uint64_t page_count = 0;
+    if (!Read(cursor, end, &mapping_size) || !Read(cursor, end, &page_count)) {
+      FML_LOG(ERROR) << "Snapshot prefetch profile " << path
+                     << " is truncated.";
+      return prefetched;
+    }
+    const size_t bitmap_size = (page_count + 7) / 8;
+    if (static_cast<size_t>(end - cursor) < bitmap_size) {
+      FML_LOG(ERROR) << "Snapshot prefetch profile " << path
+                     << " is truncated.";
+      return prefetched;
+    }
+    const uint8_t* bitmap = cursor;
+    cursor += bitmap_size;
+
+    if (!mapping || mapping->GetSize() == 0 ||
+        mapping->GetSize() != mapping_size) {
+      // The snapshot changed since the profile was recorded.
+      continue;
+    }
+
+    std::vector<bool> pages(page_count);
+    for (size_t i = 0; i < page_count; i++) {
+      pages[i] = bitmap[i / 8] & (1u << (i % 8));
+    }
+    prefetched |= fml::PrefetchPages(*mapping, pages);
+  }
+  return prefetched;
+}
+
+bool DartSnapshotProfile::Record(const std::string& path,
+                                 const DartVMData& vm_data) {
+  TRACE_EVENT0("flutter", "DartSnapshotProfile::Record");
+  if (fml::IsFile(path)) {
+    return false;
+  }
+
+  std::vector<uint8_t> buffer;
+  Append(buffer, kProfileMagic);
+  Append(buffer, kProfileVersion);
+
+  bool recorded = false;
+  const auto mappings = GetSnapshotMappings(vm_data);
+  FML_DCHECK(mappings.size() == kSnapshotMappingCount);
+  for (const fml::Mapping* mapping : mappings) {
+    std::optional<std::vector<bool>> pages;
+    if (mapping) {
+      pages = fml::GetResidentPages(*mapping);
+    }
+    if (!pages.has_value()) {
+      Append<uint64_t>(buffer, 0);
+      Append<uint64_t>(buffer, 0);
+      continue;
+    }
+    recorded = true;
+    Append<uint64_t>(buffer, mapping->GetSize());
+    Append<uint64_t>(buffer, pages->size());
+    std::vector<uint8_t> bitmap((pages->size() + 7) / 8);
+    for (size_t i = 0; i < pages->size(); i++) {
+      if ((*pages)[i]) {
+        bitmap[i / 8] |= 1u << (i % 8);
+      }
+    }
+    buffer.insert(buffer.end(), bitmap.begin(), bitmap.end());
+  }
+
+  if (!recorded) {
+    return false;
+  }
+
+  const std::string directory_name = fml::paths::GetDirectoryName(path);
+  auto directory = fml::OpenDirectory(directory_name.c_str(), false,
+                                      fml::FilePermission::kReadWrite);
+  if (!directory.is_valid() || directory_name.size() >= path.size()) {
+    return false;
+  }
+  const std::string file_name = path.substr(directory_name.size() + 1);
+  fml::DataMapping contents(std::move(buffer));
+  if (!fml::WriteAtomically(directory, file_name.c_str(), contents)) {
+    FML_LOG(ERROR) << "Could not write the snapshot prefetch profile to "
+                   << path;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace flutter
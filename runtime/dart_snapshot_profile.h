@@ -0,0 +1,59 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_RUNTIME_DART_SNAPSHOT_PROFILE_H_
+#define FLUTTER_RUNTIME_DART_SNAPSHOT_PROFILE_H_
+
+#include <string>
+
+#include "flutter/fml/macros.h"
+#include "flutter/runtime/dart_vm_data.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Records which pages of the VM and isolate snapshots are
+///             resident once the first frame has been rasterized, and
+///             prefetches those pages on later cold starts so that the page
+///             faults of startup are serviced by a few large reads instead of
+///             many small ones.
+///
+///             Only snapshots backed by mappings of a known size, such as
+///             snapshots mapped from files, are profiled. Snapshots resolved
+///             from symbols of a loaded library are skipped. A profile whose
+///             snapshot sizes no longer match the snapshots, for example
+///             after an update of the application, is ignored.
+///
+class DartSnapshotProfile {
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      Prefetches the snapshot pages listed in the profile at
+  ///             `path`.
+  ///
+  /// @param[in]  path     The path of the profile.
+  /// @param[in]  vm_data  The VM data whose snapshots are prefetched.
+  ///
+  /// @return     If the profile was read and at least one snapshot was
+  ///             prefetched.
+  ///
+  static bool Prefetch(const std::string& path, const DartVMData& vm_data);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records the resident snapshot pages to a profile at `path`.
+  ///             Nothing is recorded if a profile already exists at `path`.
+  ///
+  /// @param[in]  path     The path of the profile.
+  /// @param[in]  vm_data  The VM data whose snapshots are profiled.
+  ///
+  /// @return     If a profile was recorded.
+  ///
+  static bool Record(const std::string& path, const DartVMData& vm_data);
+
+ private:
+  FML_DISALLOW_IMPLICIT_CONSTRUCTORS(DartSnapshotProfile);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_RUNTIME_DART_SNAPSHOT_PROFILE_H_
@@ -18,6 +18,8 @@
 #include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/dart_ui.h"
 #include "flutter/runtime/dart_isolate.h"
+#include "flutter/runtime/dart_service_isolate.h"
+#include "flutter/runtime/dart_snapshot_profile.h"
 #include "flutter/runtime/dart_vm_initializer.h"
 #include "flutter/runtime/ptrace_check.h"
 #include "third_party/dart/runtime/include/bin/dart_io_api.h"
@@ -269,6 +271,11 @@ std::shared_ptr<DartVM> DartVM::Create(
     return {};
   }
 
+  if (!settings.snapshot_prefetch_profile_path.empty()) {
+    DartSnapshotProfile::Prefetch(settings.snapshot_prefetch_profile_path,
+                                  *vm_data);
+  }
+
   // Note: std::make_shared unviable due to hidden constructor.
   return std::shared_ptr<DartVM>(
       new DartVM(vm_data, std::move(isolate_name_server)));
@@ -286,7 +293,12 @@ DartVM::DartVM(const std::shared_ptr<const DartVMData>& vm_data,
       concurrent_message_loop_(fml::ConcurrentMessageLoop::Create()),
       skia_concurrent_executor_(
           [runner = concurrent_message_loop_->GetTaskRunner()](
-              const fml::closure& work) { runner->PostTask(work); }),
+              const fml::closure& work) {
+            // Skia work usually blocks the frame being rasterized, unlike the
+            // image decodes and other work on the concurrent loop.
+            runner->PostTaskWithPriority(work,
+                                         fml::ConcurrentTaskPriority::kHigh);
+          }),
       vm_data_(vm_data),
       isolate_name_server_(std::move(isolate_name_server)),
       service_protocol_(std::make_shared<ServiceProtocol>()) {
@@ -435,6 +447,11 @@ DartVM::DartVM(const std::shared_ptr<const DartVMData>& vm_data,
 
   dart::bin::SetExecutableName(settings_.executable_name.c_str());
 
+  if (settings_.defer_vm_service_startup) {
+    // The VM requests the service isolate during |Dart_Initialize|.
+    DartServiceIsolate::DeferStartup();
+  }
+
   {
     TRACE_EVENT0("flutter", "Dart_Initialize");
     Dart_InitializeParams params = {};
@@ -512,6 +529,10 @@ DartVM::~DartVM() {
     Dart_ExitIsolate();
   }
 
+  // VM shutdown waits for the service isolate to have started, which may
+  // still be deferred if no frame was rasterized.
+  DartServiceIsolate::AllowDeferredStartup();
+
   DartVMInitializer::Cleanup();
 
   dart::bin::CleanupDartIo();
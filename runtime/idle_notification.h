@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_RUNTIME_IDLE_NOTIFICATION_H_
+#define FLUTTER_RUNTIME_IDLE_NOTIFICATION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// What the animator knows about an idle period of the UI thread when it
+/// notifies the runtime of it. The runtime uses it to decide how much
+/// garbage collection work the Dart VM may do without causing jank.
+///
+struct IdleNotification {
+  /// The time by which the UI thread has to be done with the idle work, in
+  /// the time base of `Dart_TimelineGetMicros`.
+  fml::TimePoint deadline;
+
+  /// The number of vsync intervals that have passed since the last frame
+  /// began. Zero for the idle time that directly follows a frame, and large
+  /// for static screens.
+  int64_t idle_frames = 0;
+
+  /// The number of frames that have been built and are still waiting for the
+  /// raster thread.
+  size_t queued_raster_frames = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Counters of the idle notifications that reached the Dart VM.
+///
+struct IdleStats {
+  /// The number of idle notifications forwarded to the Dart VM.
+  size_t notifications = 0;
+
+  /// The number of those that were long enough for a major collection.
+  size_t long_idle_notifications = 0;
+
+  /// The idle time offered to the Dart VM.
+  fml::TimeDelta idle_time_offered;
+
+  /// The time the Dart VM spent on idle work, which is garbage collection
+  /// that would otherwise have happened while building frames.
+  fml::TimeDelta idle_time_used;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_RUNTIME_IDLE_NOTIFICATION_H_
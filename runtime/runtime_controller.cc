@@ -4,6 +4,7 @@
 
 #include "flutter/runtime/runtime_controller.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "flutter/fml/message_loop.h"
@@ -16,6 +17,7 @@
 #include "flutter/runtime/dart_isolate_group_data.h"
 #include "flutter/runtime/isolate_configuration.h"
 #include "flutter/runtime/runtime_delegate.h"
+#include "third_party/dart/runtime/include/dart_tools_api.h"
 #include "third_party/tonic/dart_message_handler.h"
 
 namespace flutter {
@@ -211,7 +213,19 @@ bool RuntimeController::ReportTimings(std::vector<int64_t> timings) {
   return false;
 }
 
+// The number of vsync intervals without a frame after which an idle period
+// is considered long.
+static constexpr int64_t kLongIdleFrames = 3;
+
+// The idle time given to the Dart VM while the raster thread is still busy.
+static constexpr fml::TimeDelta kMaxIdleTimeWhileRasterizing =
+    fml::TimeDelta::FromMilliseconds(4);
+
 bool RuntimeController::NotifyIdle(fml::TimePoint deadline) {
+  return NotifyIdle(IdleNotification{.deadline = deadline});
+}
+
+bool RuntimeController::NotifyIdle(const IdleNotification& notification) {
   std::shared_ptr<DartIsolate> root_isolate = root_isolate_.lock();
   if (!root_isolate) {
     return false;
@@ -225,8 +239,32 @@ bool RuntimeController::NotifyIdle(fml::TimePoint deadline) {
     return false;
   }
 
+  const fml::TimePoint now = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromMicroseconds(Dart_TimelineGetMicros()));
+  fml::TimePoint deadline = notification.deadline;
+  if (notification.queued_raster_frames > 0) {
+    deadline = std::min(deadline, now + kMaxIdleTimeWhileRasterizing);
+  }
+
+  idle_stats_.notifications++;
+  if (notification.idle_frames >= kLongIdleFrames &&
+      notification.queued_raster_frames == 0) {
+    idle_stats_.long_idle_notifications++;
+  }
+  if (deadline > now) {
+    idle_stats_.idle_time_offered =
+        idle_stats_.idle_time_offered + (deadline - now);
+  }
+
   Dart_NotifyIdle(deadline.ToEpochDelta().ToMicroseconds());
 
+  const fml::TimePoint idle_end = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromMicroseconds(Dart_TimelineGetMicros()));
+  idle_stats_.idle_time_used = idle_stats_.idle_time_used + (idle_end - now);
+  FML_TRACE_COUNTER("flutter", "IdleTimeUsed",
+                    reinterpret_cast<int64_t>(this), "microseconds",
+                    idle_stats_.idle_time_used.ToMicroseconds());
+
   // Idle notifications being in isolate scope are part of the contract.
   if (idle_notification_callback_) {
     TRACE_EVENT0("flutter", "EmbedderIdleNotification");
@@ -246,6 +284,18 @@ bool RuntimeController::DispatchPlatformMessage(
   return false;
 }
 
+bool RuntimeController::DispatchPlatformMessages(
+    std::vector<std::unique_ptr<PlatformMessage>> messages) {
+  if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
+    TRACE_EVENT1("flutter", "RuntimeController::DispatchPlatformMessages",
+                 "count", std::to_string(messages.size()).c_str());
+    platform_configuration->DispatchPlatformMessages(std::move(messages));
+    return true;
+  }
+
+  return false;
+}
+
 bool RuntimeController::DispatchPointerDataPacket(
     const PointerDataPacket& packet) {
   if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
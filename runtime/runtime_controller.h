@@ -21,6 +21,7 @@
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "flutter/lib/ui/window/pointer_data_packet.h"
 #include "flutter/runtime/dart_vm.h"
+#include "flutter/runtime/idle_notification.h"
 #include "flutter/runtime/platform_data.h"
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
@@ -360,6 +361,33 @@ class RuntimeController : public PlatformConfigurationClient {
   ///
   virtual bool NotifyIdle(fml::TimePoint deadline);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Notify the Dart VM of an idle period of the UI task runner
+  ///             along with what is known about the frame workload around
+  ///             it.
+  ///
+  ///             While the raster thread still has frames queued, the idle
+  ///             time is capped so that a major collection and its helper
+  ///             threads don't compete with rasterization. Notifications
+  ///             after several vsync intervals without a frame, as on a
+  ///             static screen, are counted as long idle periods in
+  ///             `GetIdleStats`.
+  ///
+  /// @see        `NotifyIdle(fml::TimePoint)`
+  ///
+  /// @param[in]  notification  The deadline and frame workload of the idle
+  ///                           period.
+  ///
+  /// @return     If the idle notification was forwarded to the running isolate.
+  ///
+  virtual bool NotifyIdle(const IdleNotification& notification);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Counters of the idle notifications that were forwarded to
+  ///             the Dart VM. Must be called on the UI task runner.
+  ///
+  const IdleStats& GetIdleStats() const { return idle_stats_; }
+
   //----------------------------------------------------------------------------
   /// @brief      Returns if the root isolate is running. The isolate must be
   ///             transitioned to the running phase manually. The isolate can
@@ -381,6 +409,19 @@ class RuntimeController : public PlatformConfigurationClient {
   virtual bool DispatchPlatformMessage(
       std::unique_ptr<PlatformMessage> message);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Dispatch the specified platform messages to the running root
+  ///             isolate, in order and within a single entry into the
+  ///             isolate.
+  ///
+  /// @param[in]  messages  The messages to dispatch to the isolate.
+  ///
+  /// @return     If the messages were dispatched to the running root isolate.
+  ///             This may fail is an isolate is not running.
+  ///
+  virtual bool DispatchPlatformMessages(
+      std::vector<std::unique_ptr<PlatformMessage>> messages);
+
   //----------------------------------------------------------------------------
   /// @brief      Dispatch the specified pointer data message to the running
   ///             root isolate.
@@ -586,6 +627,7 @@ class RuntimeController : public PlatformConfigurationClient {
   DartVM* const vm_;
   fml::RefPtr<const DartSnapshot> isolate_snapshot_;
   std::function<void(int64_t)> idle_notification_callback_;
+  IdleStats idle_stats_;
   PlatformData platform_data_;
   std::weak_ptr<DartIsolate> root_isolate_;
   std::weak_ptr<DartIsolate> spawning_isolate_;
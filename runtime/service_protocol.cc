@@ -24,6 +24,8 @@ const std::string_view ServiceProtocol::kScreenshotExtensionName =
     "_flutter.screenshot";
 const std::string_view ServiceProtocol::kScreenshotSkpExtensionName =
     "_flutter.screenshotSkp";
+const std::string_view ServiceProtocol::kScreenshotDisplayListExtensionName =
+    "_flutter.screenshotDisplayList";
 const std::string_view ServiceProtocol::kRunInViewExtensionName =
     "_flutter.runInView";
 const std::string_view ServiceProtocol::kFlushUIThreadTasksExtensionName =
@@ -40,6 +42,11 @@ const std::string_view
 const std::string_view
     ServiceProtocol::kRenderFrameWithRasterStatsExtensionName =
         "_flutter.renderFrameWithRasterStats";
+const std::string_view ServiceProtocol::kGetLayerRasterTimingsExtensionName =
+    "_flutter.getLayerRasterTimings";
+const std::string_view
+    ServiceProtocol::kGetFrameTimingStatisticsExtensionName =
+        "_flutter.getFrameTimingStatistics";
 const std::string_view ServiceProtocol::kReloadAssetFonts =
     "_flutter.reloadAssetFonts";
 
@@ -55,6 +62,7 @@ ServiceProtocol::ServiceProtocol()
           // Public
           kScreenshotExtensionName,
           kScreenshotSkpExtensionName,
+          kScreenshotDisplayListExtensionName,
           kRunInViewExtensionName,
           kFlushUIThreadTasksExtensionName,
           kSetAssetBundlePathExtensionName,
@@ -62,6 +70,8 @@ ServiceProtocol::ServiceProtocol()
           kGetSkSLsExtensionName,
           kEstimateRasterCacheMemoryExtensionName,
           kRenderFrameWithRasterStatsExtensionName,
+          kGetLayerRasterTimingsExtensionName,
+          kGetFrameTimingStatisticsExtensionName,
           kReloadAssetFonts,
       }),
       handlers_mutex_(fml::SharedMutex::Create()) {}
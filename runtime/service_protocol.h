@@ -23,6 +23,7 @@ class ServiceProtocol {
  public:
   static const std::string_view kScreenshotExtensionName;
   static const std::string_view kScreenshotSkpExtensionName;
+  static const std::string_view kScreenshotDisplayListExtensionName;
   static const std::string_view kRunInViewExtensionName;
   static const std::string_view kFlushUIThreadTasksExtensionName;
   static const std::string_view kSetAssetBundlePathExtensionName;
@@ -30,6 +31,8 @@ class ServiceProtocol {
   static const std::string_view kGetSkSLsExtensionName;
   static const std::string_view kEstimateRasterCacheMemoryExtensionName;
   static const std::string_view kRenderFrameWithRasterStatsExtensionName;
+  static const std::string_view kGetLayerRasterTimingsExtensionName;
+  static const std::string_view kGetFrameTimingStatisticsExtensionName;
   static const std::string_view kReloadAssetFonts;
 
   class Handler {
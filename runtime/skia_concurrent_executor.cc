@@ -4,6 +4,7 @@
 
 #include "flutter/runtime/skia_concurrent_executor.h"
 
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -17,7 +18,11 @@ void SkiaConcurrentExecutor::add(fml::closure work) {
   if (!work) {
     return;
   }
-  on_work_([work]() {
+  on_work_([this, work, queued_time = fml::TimePoint::Now()]() {
+    FML_TRACE_COUNTER(
+        "flutter", "SkiaExecutorQueueDelay", reinterpret_cast<int64_t>(this),
+        "microseconds",
+        (fml::TimePoint::Now() - queued_time).ToMicroseconds());
     TRACE_EVENT0("flutter", "SkiaExecutor");
     work();
   });
@@ -30,6 +30,12 @@ class SkiaConcurrentExecutor : public SkExecutor {
   /// The callback invoked by the executor to schedule the given task onto an
   /// engine managed background thread.
   ///
+  /// Skia hands the executor work such as shader compiles and path mask
+  /// generation that the raster thread is usually about to wait for, so the
+  /// callback should schedule it ahead of speculative work like image
+  /// decodes. The time the work spent queued is reported in the
+  /// `SkiaExecutorQueueDelay` trace counter.
+  ///
   using OnWorkCallback = std::function<void(fml::closure work)>;
 
   //----------------------------------------------------------------------------
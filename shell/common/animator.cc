@@ -4,6 +4,7 @@
 
 #include "flutter/shell/common/animator.h"
 
+#include "flutter/common/constants.h"
 #include "flutter/flow/frame_timings.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
@@ -91,6 +92,14 @@ void Animator::BeginFrame(
     // instead of asking the pipeline for a fresh continuation.
     producer_continuation_ = layer_tree_pipeline_->Produce();
 
+    if (!producer_continuation_ && drop_stale_frames_ &&
+        layer_tree_pipeline_->GetDropPolicy() == PipelineDropPolicy::kFIFO) {
+      // The rasterizer is falling behind. Rather than skipping this frame,
+      // replace the oldest frame that is still waiting to be rasterized.
+      layer_tree_pipeline_->SetDropPolicy(PipelineDropPolicy::kBoundedWithDrop);
+      producer_continuation_ = layer_tree_pipeline_->Produce();
+    }
+
     if (!producer_continuation_) {
       // If we still don't have valid continuation, the pipeline is currently
       // full because the consumer is being too slow. Try again at the next
@@ -107,6 +116,8 @@ void Animator::BeginFrame(
   const fml::TimePoint frame_target_time =
       frame_timings_recorder_->GetVsyncTargetTime();
   dart_frame_deadline_ = FxlToDartOrEarlier(frame_target_time);
+  last_frame_start_time_ = frame_timings_recorder_->GetVsyncStartTime();
+  last_frame_interval_ = frame_target_time - last_frame_start_time_;
   uint64_t frame_number = frame_timings_recorder_->GetFrameNumber();
   delegate_.OnAnimatorBeginFrame(frame_target_time, frame_number);
 
@@ -131,19 +142,31 @@ void Animator::BeginFrame(
           if (notify_idle_task_id == self->notify_idle_task_id_ &&
               !self->frame_scheduled_) {
             TRACE_EVENT0("flutter", "BeginFrame idle callback");
-            self->delegate_.OnAnimatorNotifyIdle(
+            self->delegate_.OnAnimatorNotifyIdle(self->MakeIdleNotification(
                 FxlToDartOrEarlier(fml::TimePoint::Now() +
-                                   fml::TimeDelta::FromMicroseconds(100000)));
+                                   fml::TimeDelta::FromMicroseconds(100000))));
           }
         },
         kNotifyIdleTaskWaitTime);
   }
 }
 
+void Animator::Render(int64_t view_id,
+                      std::shared_ptr<flutter::LayerTree> layer_tree) {
+  if (view_id == kFlutterImplicitViewId) {
+    Render(std::move(layer_tree));
+    return;
+  }
+  pending_view_layer_trees_[view_id] = std::move(layer_tree);
+}
+
 void Animator::Render(std::shared_ptr<flutter::LayerTree> layer_tree) {
   has_rendered_ = true;
   last_layer_tree_size_ = layer_tree->frame_size();
 
+  // Only frames that were built in response to a begin frame say anything
+  // about how long building a frame takes.
+  const bool has_begin_frame = frame_timings_recorder_ != nullptr;
   if (!frame_timings_recorder_) {
     // Framework can directly call render with a built scene.
     frame_timings_recorder_ = std::make_unique<FrameTimingsRecorder>();
@@ -155,12 +178,18 @@ void Animator::Render(std::shared_ptr<flutter::LayerTree> layer_tree) {
   TRACE_EVENT_WITH_FRAME_NUMBER(frame_timings_recorder_, "flutter",
                                 "Animator::Render");
   frame_timings_recorder_->RecordBuildEnd(fml::TimePoint::Now());
+  if (predictive_frame_scheduling_ && has_begin_frame) {
+    frame_schedule_predictor_.RecordBuildDuration(
+        frame_timings_recorder_->GetBuildDuration());
+  }
 
   delegate_.OnAnimatorUpdateLatestFrameTargetTime(
       frame_timings_recorder_->GetVsyncTargetTime());
 
   auto layer_tree_item = std::make_unique<LayerTreeItem>(
-      std::move(layer_tree), std::move(frame_timings_recorder_));
+      std::move(layer_tree), std::move(frame_timings_recorder_),
+      std::move(pending_view_layer_trees_));
+  pending_view_layer_trees_.clear();
   // Commit the pending continuation.
   PipelineProduceResult result =
       producer_continuation_.Complete(std::move(layer_tree_item));
@@ -170,6 +199,11 @@ void Animator::Render(std::shared_ptr<flutter::LayerTree> layer_tree) {
     return;
   }
 
+  if (drop_stale_frames_ && result.is_first_item) {
+    // The rasterizer has caught up, go back to rasterizing every frame.
+    layer_tree_pipeline_->SetDropPolicy(PipelineDropPolicy::kFIFO);
+  }
+
   if (!result.is_first_item) {
     // It has been successfully pushed to the pipeline but not as the first
     // item. Eventually the 'Rasterizer' will consume it, so we don't need to
@@ -180,6 +214,23 @@ void Animator::Render(std::shared_ptr<flutter::LayerTree> layer_tree) {
   delegate_.OnAnimatorDraw(layer_tree_pipeline_);
 }
 
+void Animator::SetDropStaleFrames(bool drop_stale_frames) {
+  drop_stale_frames_ = drop_stale_frames;
+  if (!drop_stale_frames_) {
+    layer_tree_pipeline_->SetDropPolicy(PipelineDropPolicy::kFIFO);
+  }
+}
+
+void Animator::SetPredictiveFrameScheduling(bool predictive_frame_scheduling) {
+  predictive_frame_scheduling_ = predictive_frame_scheduling;
+}
+
+void Animator::OnFramePresented(fml::TimePoint presentation_time) {
+  if (predictive_frame_scheduling_) {
+    frame_schedule_predictor_.RecordPresentation(presentation_time);
+  }
+}
+
 const std::weak_ptr<VsyncWaiter> Animator::GetVsyncWaiter() const {
   std::weak_ptr<VsyncWaiter> weak = waiter_;
   return weak;
@@ -241,10 +292,30 @@ void Animator::RequestFrame(bool regenerate_layer_tree) {
 }
 
 void Animator::AwaitVSync() {
+  if (predictive_frame_scheduling_ && !CanReuseLastLayerTree()) {
+    const fml::TimePoint now = fml::TimePoint::Now();
+    std::optional<fml::TimePoint> early_target =
+        frame_schedule_predictor_.PredictEarlyFrameTarget(now);
+    if (early_target.has_value()) {
+      // Waiting for the next vsync would make this frame miss an earlier
+      // vsync that it can still make when it starts building right away.
+      TRACE_EVENT0("flutter", "Animator::BeginFrameEarly");
+      auto frame_timings_recorder = std::make_unique<FrameTimingsRecorder>();
+      frame_timings_recorder->RecordVsync(now, early_target.value());
+      BeginFrame(std::move(frame_timings_recorder));
+      return;
+    }
+  }
+
   waiter_->AsyncWaitForVsync(
       [self = weak_factory_.GetWeakPtr()](
           std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder) {
         if (self) {
+          if (self->predictive_frame_scheduling_) {
+            self->frame_schedule_predictor_.RecordVsync(
+                frame_timings_recorder->GetVsyncStartTime(),
+                frame_timings_recorder->GetVsyncTargetTime());
+          }
           if (self->CanReuseLastLayerTree()) {
             self->DrawLastLayerTree(std::move(frame_timings_recorder));
           } else {
@@ -253,8 +324,29 @@ void Animator::AwaitVSync() {
         }
       });
   if (has_rendered_) {
-    delegate_.OnAnimatorNotifyIdle(dart_frame_deadline_);
+    if (predictive_frame_scheduling_) {
+      // The next frame starts building at the next vsync, which may be well
+      // past the target time of the last frame after a period without
+      // frames.
+      delegate_.OnAnimatorNotifyIdle(MakeIdleNotification(
+          FxlToDartOrEarlier(frame_schedule_predictor_.PredictNextVsyncStart(
+              fml::TimePoint::Now()))));
+    } else {
+      delegate_.OnAnimatorNotifyIdle(
+          MakeIdleNotification(dart_frame_deadline_));
+    }
+  }
+}
+
+IdleNotification Animator::MakeIdleNotification(fml::TimePoint deadline) {
+  IdleNotification notification{.deadline = deadline};
+  if (last_frame_interval_ > fml::TimeDelta::Zero()) {
+    notification.idle_frames =
+        (fml::TimePoint::Now() - last_frame_start_time_).ToNanoseconds() /
+        last_frame_interval_.ToNanoseconds();
   }
+  notification.queued_raster_frames = layer_tree_pipeline_->GetQueuedCount();
+  return notification;
 }
 
 void Animator::ScheduleSecondaryVsyncCallback(uintptr_t id,
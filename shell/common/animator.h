@@ -13,6 +13,8 @@
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/synchronization/semaphore.h"
 #include "flutter/fml/time/time_point.h"
+#include "flutter/runtime/idle_notification.h"
+#include "flutter/shell/common/frame_schedule_predictor.h"
 #include "flutter/shell/common/pipeline.h"
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/vsync_waiter.h"
@@ -34,7 +36,8 @@ class Animator final {
     virtual void OnAnimatorBeginFrame(fml::TimePoint frame_target_time,
                                       uint64_t frame_number) = 0;
 
-    virtual void OnAnimatorNotifyIdle(fml::TimePoint deadline) = 0;
+    virtual void OnAnimatorNotifyIdle(
+        const IdleNotification& notification) = 0;
 
     virtual void OnAnimatorUpdateLatestFrameTargetTime(
         fml::TimePoint frame_target_time) = 0;
@@ -56,6 +59,12 @@ class Animator final {
 
   void Render(std::shared_ptr<flutter::LayerTree> layer_tree);
 
+  // Renders the layer tree of a view. The layer trees of the views other than
+  // the implicit view are held until the implicit view is rendered, and are
+  // then handed to the rasterizer with its frame, so that all views of one
+  // frame are rasterized in the same pass.
+  void Render(int64_t view_id, std::shared_ptr<flutter::LayerTree> layer_tree);
+
   const std::weak_ptr<VsyncWaiter> GetVsyncWaiter() const;
 
   //--------------------------------------------------------------------------
@@ -76,6 +85,37 @@ class Animator final {
   void ScheduleSecondaryVsyncCallback(uintptr_t id,
                                       const fml::closure& callback);
 
+  //--------------------------------------------------------------------------
+  /// @brief    Whether frames that are still waiting to be rasterized are
+  ///           replaced by newer ones while the rasterizer is falling
+  ///           behind.
+  ///
+  ///           When enabled, the layer tree pipeline switches to
+  ///           `PipelineDropPolicy::kBoundedWithDrop` once it is found full
+  ///           at the beginning of a frame, and back to
+  ///           `PipelineDropPolicy::kFIFO` once a frame is pushed into an
+  ///           empty pipeline.
+  void SetDropStaleFrames(bool drop_stale_frames);
+
+  //--------------------------------------------------------------------------
+  /// @brief    Whether frames are scheduled from predictions that are based
+  ///           on the recent vsync signals and build durations.
+  ///
+  ///           When enabled, a frame that is predicted to land on a later
+  ///           vsync when built at the next vsync starts building as soon as
+  ///           it is requested, and the idle deadlines passed to
+  ///           `Delegate::OnAnimatorNotifyIdle` are the predicted start of
+  ///           the next vsync rather than the target time of the last frame.
+  ///
+  /// @see      `FrameSchedulePredictor`
+  void SetPredictiveFrameScheduling(bool predictive_frame_scheduling);
+
+  //--------------------------------------------------------------------------
+  /// @brief    Notifies the animator that a frame was displayed at
+  ///           |presentation_time|. When predictive frame scheduling is
+  ///           enabled, this realigns the predicted vsync phase.
+  void OnFramePresented(fml::TimePoint presentation_time);
+
   // Enqueue |trace_flow_id| into |trace_flow_ids_|.  The flow event will be
   // ended at either the next frame, or the next vsync interval with no active
   // active rendering.
@@ -94,6 +134,10 @@ class Animator final {
   // Clear |trace_flow_ids_| if |frame_scheduled_| is false.
   void ScheduleMaybeClearTraceFlowIds();
 
+  // Describes the idle period of the UI thread that ends at |deadline|, in
+  // the time base of |Dart_TimelineGetMicros|.
+  IdleNotification MakeIdleNotification(fml::TimePoint deadline);
+
   Delegate& delegate_;
   TaskRunners task_runners_;
   std::shared_ptr<VsyncWaiter> waiter_;
@@ -101,15 +145,21 @@ class Animator final {
   std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder_;
   uint64_t frame_request_number_ = 1;
   fml::TimePoint dart_frame_deadline_;
+  fml::TimePoint last_frame_start_time_;
+  fml::TimeDelta last_frame_interval_;
   std::shared_ptr<LayerTreePipeline> layer_tree_pipeline_;
   fml::Semaphore pending_frame_semaphore_;
   LayerTreePipeline::ProducerContinuation producer_continuation_;
+  ViewLayerTrees pending_view_layer_trees_;
   bool regenerate_layer_tree_ = false;
   bool frame_scheduled_ = false;
   int notify_idle_task_id_ = 0;
   SkISize last_layer_tree_size_ = {0, 0};
   std::deque<uint64_t> trace_flow_ids_;
   bool has_rendered_ = false;
+  bool drop_stale_frames_ = false;
+  bool predictive_frame_scheduling_ = false;
+  FrameSchedulePredictor frame_schedule_predictor_;
 
   fml::WeakPtrFactory<Animator> weak_factory_;
 
@@ -28,7 +28,7 @@ class FakeAnimatorDelegate : public Animator::Delegate {
   MOCK_METHOD2(OnAnimatorBeginFrame,
                void(fml::TimePoint frame_target_time, uint64_t frame_number));
 
-  void OnAnimatorNotifyIdle(fml::TimePoint deadline) override {
+  void OnAnimatorNotifyIdle(const IdleNotification& notification) override {
     notify_idle_called_ = true;
   }
 
@@ -247,6 +247,73 @@ TEST_F(ShellTest, AnimatorDoesNotNotifyDelegateIfPipelineIsNotEmpty) {
   PostTaskSync(task_runners.GetUITaskRunner(), [&] { animator.reset(); });
 }
 
+TEST_F(ShellTest, AnimatorDropsStaleFramesWhenPipelineIsFull) {
+  FakeAnimatorDelegate delegate;
+  TaskRunners task_runners = {
+      "test",
+      CreateNewThread(),  // platform
+      CreateNewThread(),  // raster
+      CreateNewThread(),  // ui
+      CreateNewThread()   // io
+  };
+
+  auto clock = std::make_shared<ShellTestVsyncClock>();
+  std::shared_ptr<Animator> animator;
+
+  auto flush_vsync_task = [&] {
+    fml::AutoResetWaitableEvent ui_latch;
+    task_runners.GetUITaskRunner()->PostTask([&] { ui_latch.Signal(); });
+    do {
+      clock->SimulateVSync();
+    } while (ui_latch.WaitWithTimeout(fml::TimeDelta::FromMilliseconds(1)));
+  };
+
+  // Create the animator on the UI task runner.
+  PostTaskSync(task_runners.GetUITaskRunner(), [&] {
+    auto vsync_waiter = static_cast<std::unique_ptr<VsyncWaiter>>(
+        std::make_unique<ShellTestVsyncWaiter>(task_runners, clock));
+    animator = std::make_unique<Animator>(delegate, task_runners,
+                                          std::move(vsync_waiter));
+    animator->SetDropStaleFrames(true);
+  });
+
+  fml::AutoResetWaitableEvent begin_frame_latch;
+  EXPECT_CALL(delegate, OnAnimatorBeginFrame)
+      .WillRepeatedly(
+          [&](fml::TimePoint frame_target_time, uint64_t frame_number) {
+            begin_frame_latch.Signal();
+          });
+  EXPECT_CALL(delegate, OnAnimatorUpdateLatestFrameTargetTime).Times(3);
+  // The pipeline is never consumed, so only the first frame is drawn.
+  std::shared_ptr<LayerTreePipeline> pipeline;
+  EXPECT_CALL(delegate, OnAnimatorDraw)
+      .WillOnce([&](std::shared_ptr<LayerTreePipeline> layer_tree_pipeline) {
+        pipeline = std::move(layer_tree_pipeline);
+      });
+
+  // The third frame finds the pipeline full and replaces the oldest frame
+  // instead of waiting for the next vsync.
+  for (int i = 0; i < 3; i++) {
+    task_runners.GetUITaskRunner()->PostTask([&] {
+      animator->RequestFrame();
+      task_runners.GetPlatformTaskRunner()->PostTask(flush_vsync_task);
+    });
+    begin_frame_latch.Wait();
+
+    PostTaskSync(task_runners.GetUITaskRunner(), [&] {
+      auto layer_tree =
+          std::make_shared<LayerTree>(SkISize::Make(600, 800), 1.0);
+      animator->Render(std::move(layer_tree));
+    });
+  }
+
+  ASSERT_TRUE(pipeline);
+  EXPECT_EQ(pipeline->GetDroppedCount(), 1u);
+  EXPECT_EQ(pipeline->GetDropPolicy(), PipelineDropPolicy::kBoundedWithDrop);
+
+  PostTaskSync(task_runners.GetUITaskRunner(), [&] { animator.reset(); });
+}
+
 }  // namespace testing
 }  // namespace flutter
 
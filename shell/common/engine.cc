@@ -10,7 +10,9 @@
 #include <utility>
 #include <vector>
 
+#include "flutter/assets/asset_access_profile.h"
 #include "flutter/common/settings.h"
+#include "flutter/fml/file.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/lib/snapshot/snapshot.h"
@@ -30,6 +32,9 @@ static constexpr char kLocalizationChannel[] = "flutter/localization";
 static constexpr char kSettingsChannel[] = "flutter/settings";
 static constexpr char kIsolateChannel[] = "flutter/isolate";
 
+// The number of assets recorded at most for the asset prefetch profile.
+static constexpr size_t kMaxAssetPrefetchProfileSize = 256;
+
 namespace {
 fml::MallocMapping MakeMapping(const std::string& str) {
   return fml::MallocMapping::Copy(str.c_str(), str.length());
@@ -57,7 +62,12 @@ Engine::Engine(
                                         std::move(io_manager))),
       task_runners_(task_runners),
       weak_factory_(this) {
-  pointer_data_dispatcher_ = dispatcher_maker(*this);
+  if (settings_.coalesce_pointer_data) {
+    pointer_data_dispatcher_ =
+        std::make_unique<CoalescingPointerDataDispatcher>(*this);
+  } else {
+    pointer_data_dispatcher_ = dispatcher_maker(*this);
+  }
 }
 
 Engine::Engine(Delegate& delegate,
@@ -149,6 +159,26 @@ fml::WeakPtr<Engine> Engine::GetWeakPtr() const {
 void Engine::SetupDefaultFontManager() {
   TRACE_EVENT0("flutter", "Engine::SetupDefaultFontManager");
   font_collection_->SetupDefaultFontManager(settings_.font_initialization_data);
+  if (!settings_.font_fallback_cache_path.empty()) {
+    font_collection_->GetFontCollection()->SetFallbackCachePath(
+        settings_.font_fallback_cache_path);
+  }
+}
+
+void Engine::PrefetchOrRecordStartupAssets() {
+  const std::string& path = settings_.asset_prefetch_profile_path;
+  if (!fml::IsFile(path)) {
+    asset_manager_->StartRecordingAccesses(kMaxAssetPrefetchProfileSize);
+    return;
+  }
+  if (!runtime_controller_ || !runtime_controller_->GetDartVM()) {
+    return;
+  }
+  runtime_controller_->GetDartVM()->GetConcurrentWorkerTaskRunner()->PostTask(
+      [path, asset_manager = asset_manager_]() {
+        AssetAccessProfile::Prefetch(*asset_manager,
+                                     AssetAccessProfile::Read(path));
+      });
 }
 
 std::shared_ptr<AssetManager> Engine::GetAssetManager() {
@@ -169,12 +199,24 @@ bool Engine::UpdateAssetManager(
     return false;
   }
 
+  const bool is_first_asset_manager = asset_manager_ == nullptr;
   asset_manager_ = new_asset_manager;
 
   if (!asset_manager_) {
     return false;
   }
 
+  if (settings_.enable_asset_lookup_index) {
+    asset_manager_->EnableLookupIndex();
+  }
+
+  // Only the assets of the startup are profiled, before any asset manager
+  // updates for hot restarts or deferred components.
+  if (is_first_asset_manager &&
+      !settings_.asset_prefetch_profile_path.empty()) {
+    PrefetchOrRecordStartupAssets();
+  }
+
   // Using libTXT as the text engine.
   if (settings_.use_asset_fonts) {
     font_collection_->RegisterFonts(asset_manager_);
@@ -258,12 +300,13 @@ void Engine::ReportTimings(std::vector<int64_t> timings) {
   runtime_controller_->ReportTimings(std::move(timings));
 }
 
-void Engine::NotifyIdle(fml::TimePoint deadline) {
-  auto trace_event = std::to_string(deadline.ToEpochDelta().ToMicroseconds() -
-                                    Dart_TimelineGetMicros());
+void Engine::NotifyIdle(const IdleNotification& notification) {
+  auto trace_event = std::to_string(
+      notification.deadline.ToEpochDelta().ToMicroseconds() -
+      Dart_TimelineGetMicros());
   TRACE_EVENT1("flutter", "Engine::NotifyIdle", "deadline_now_delta",
                trace_event.c_str());
-  runtime_controller_->NotifyIdle(deadline);
+  runtime_controller_->NotifyIdle(notification);
 }
 
 std::optional<uint32_t> Engine::GetUIIsolateReturnCode() {
@@ -319,6 +362,45 @@ void Engine::DispatchPlatformMessage(std::unique_ptr<PlatformMessage> message) {
   FML_DLOG(WARNING) << "Dropping platform message on channel: " << channel;
 }
 
+void Engine::DispatchPlatformMessages(
+    std::vector<std::unique_ptr<PlatformMessage>> messages) {
+  TRACE_EVENT0("flutter", "Engine::DispatchPlatformMessages");
+  std::vector<std::unique_ptr<PlatformMessage>> batch;
+  for (auto& message : messages) {
+    const std::string& channel = message->channel();
+    if (channel == kLifecycleChannel || channel == kLocalizationChannel ||
+        channel == kSettingsChannel || channel == kNavigationChannel) {
+      // The messages that the engine may handle itself split the batch, so
+      // that they are still handled in the order they were sent.
+      DispatchPlatformMessagesToIsolate(std::move(batch));
+      batch.clear();
+      DispatchPlatformMessage(std::move(message));
+    } else {
+      batch.push_back(std::move(message));
+    }
+  }
+  DispatchPlatformMessagesToIsolate(std::move(batch));
+}
+
+void Engine::DispatchPlatformMessagesToIsolate(
+    std::vector<std::unique_ptr<PlatformMessage>> messages) {
+  if (messages.empty()) {
+    return;
+  }
+  if (messages.size() == 1) {
+    DispatchPlatformMessage(std::move(messages.front()));
+    return;
+  }
+
+  const size_t count = messages.size();
+  if (runtime_controller_->IsRootIsolateRunning() &&
+      runtime_controller_->DispatchPlatformMessages(std::move(messages))) {
+    return;
+  }
+
+  FML_DLOG(WARNING) << "Dropping " << count << " platform messages.";
+}
+
 bool Engine::HandleLifecyclePlatformMessage(PlatformMessage* message) {
   const auto& data = message->data();
   std::string state(reinterpret_cast<const char*>(data.GetMapping()),
@@ -441,6 +523,10 @@ void Engine::ScheduleFrame(bool regenerate_layer_tree) {
   animator_->RequestFrame(regenerate_layer_tree);
 }
 
+void Engine::NotifyFramePresented(fml::TimePoint presentation_time) {
+  animator_->OnFramePresented(presentation_time);
+}
+
 void Engine::Render(std::shared_ptr<flutter::LayerTree> layer_tree) {
   if (!layer_tree) {
     return;
@@ -548,11 +548,12 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   ///             moments to perform collections.
   ///
   ///
-  /// @param[in]  deadline  The deadline is used by the VM to determine if the
-  ///                       corresponding sweep can be performed within the
-  ///                       deadline.
+  /// @param[in]  notification  The deadline of the idle period, which is used
+  ///                           by the VM to determine if the corresponding
+  ///                           sweep can be performed within the deadline,
+  ///                           and the frame workload around it.
   ///
-  void NotifyIdle(fml::TimePoint deadline);
+  void NotifyIdle(const IdleNotification& notification);
 
   //----------------------------------------------------------------------------
   /// @brief      Dart code cannot fully measure the time it takes for a
@@ -688,6 +689,18 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   ///
   void DispatchPlatformMessage(std::unique_ptr<PlatformMessage> message);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Notifies the engine that the embedder has sent it several
+  ///             messages in short succession. The messages are handled in
+  ///             order, and consecutive messages for the Dart application are
+  ///             delivered to the root isolate in a single batch.
+  ///
+  /// @param[in]  messages  The messages sent from the embedder to the Dart
+  ///                       application.
+  ///
+  void DispatchPlatformMessages(
+      std::vector<std::unique_ptr<PlatformMessage>> messages);
+
   //----------------------------------------------------------------------------
   /// @brief      Notifies the engine that the embedder has sent it a pointer
   ///             data packet. A pointer data packet may contain multiple
@@ -759,6 +772,16 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   /// tree.
   void ScheduleFrame() { ScheduleFrame(true); }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Notifies the engine that a frame was displayed at
+  ///             `presentation_time`, so that the animator can schedule the
+  ///             following frames from the measured presentation.
+  ///
+  /// @param[in]  presentation_time  The time at which the frame started to
+  ///                                be displayed.
+  ///
+  void NotifyFramePresented(fml::TimePoint presentation_time);
+
   // |RuntimeDelegate|
   FontCollection& GetFontCollection() override;
 
@@ -914,6 +937,11 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
 
   void SetNeedsReportTimings(bool value) override;
 
+  // Delivers messages that the engine doesn't handle itself to the root
+  // isolate.
+  void DispatchPlatformMessagesToIsolate(
+      std::vector<std::unique_ptr<PlatformMessage>> messages);
+
   bool HandleLifecyclePlatformMessage(PlatformMessage* message);
 
   bool HandleNavigationPlatformMessage(
@@ -927,6 +955,11 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
 
   bool GetAssetAsBuffer(const std::string& name, std::vector<uint8_t>* data);
 
+  // Prefetches the assets listed in the asset prefetch profile in the
+  // background, or records the assets that are loaded if there is no profile
+  // yet.
+  void PrefetchOrRecordStartupAssets();
+
   friend class testing::ShellTest;
 
   Engine::Delegate& delegate_;
@@ -74,6 +74,8 @@ class MockRuntimeController : public RuntimeController {
       : RuntimeController(client, p_task_runners) {}
   MOCK_METHOD0(IsRootIsolateRunning, bool());
   MOCK_METHOD1(DispatchPlatformMessage, bool(std::unique_ptr<PlatformMessage>));
+  MOCK_METHOD1(DispatchPlatformMessages,
+               bool(std::vector<std::unique_ptr<PlatformMessage>>));
   MOCK_METHOD3(LoadDartDeferredLibraryError,
                void(intptr_t, const std::string, bool));
   MOCK_CONST_METHOD0(GetDartVM, DartVM*());
@@ -256,6 +258,51 @@ TEST_F(EngineTest, DispatchPlatformMessageInitialRouteIgnored) {
   });
 }
 
+TEST_F(EngineTest, DispatchPlatformMessagesBatchesMessagesForTheIsolate) {
+  PostUITaskSync([this] {
+    MockRuntimeDelegate client;
+    auto mock_runtime_controller =
+        std::make_unique<MockRuntimeController>(client, task_runners_);
+    EXPECT_CALL(*mock_runtime_controller, IsRootIsolateRunning())
+        .WillRepeatedly(::testing::Return(true));
+    {
+      ::testing::InSequence sequence;
+      EXPECT_CALL(*mock_runtime_controller,
+                  DispatchPlatformMessages(::testing::SizeIs(2)))
+          .WillOnce(::testing::Return(true));
+      // The navigation message and the single message after it.
+      EXPECT_CALL(*mock_runtime_controller,
+                  DispatchPlatformMessage(::testing::_))
+          .Times(2)
+          .WillRepeatedly(::testing::Return(true));
+    }
+    auto engine = std::make_unique<Engine>(
+        /*delegate=*/delegate_,
+        /*dispatcher_maker=*/dispatcher_maker_,
+        /*image_decoder_task_runner=*/image_decoder_task_runner_,
+        /*task_runners=*/task_runners_,
+        /*settings=*/settings_,
+        /*animator=*/std::move(animator_),
+        /*io_manager=*/io_manager_,
+        /*font_collection=*/std::make_shared<FontCollection>(),
+        /*runtime_controller=*/std::move(mock_runtime_controller));
+
+    fml::RefPtr<PlatformMessageResponse> response =
+        fml::MakeRefCounted<MockResponse>();
+    std::map<std::string, std::string> values{
+        {"method", "setInitialRoute"},
+        {"args", "test_initial_route"},
+    };
+    std::vector<std::unique_ptr<PlatformMessage>> messages;
+    messages.push_back(std::make_unique<PlatformMessage>("foo", response));
+    messages.push_back(std::make_unique<PlatformMessage>("bar", response));
+    messages.push_back(
+        MakePlatformMessage("flutter/navigation", values, response));
+    messages.push_back(std::make_unique<PlatformMessage>("baz", response));
+    engine->DispatchPlatformMessages(std::move(messages));
+  });
+}
+
 TEST_F(EngineTest, SpawnSharesFontLibrary) {
   PostUITaskSync([this] {
     MockRuntimeDelegate client;
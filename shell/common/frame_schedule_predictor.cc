@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_schedule_predictor.h"
+
+#include <algorithm>
+
+namespace flutter {
+
+FrameSchedulePredictor::FrameSchedulePredictor() = default;
+
+FrameSchedulePredictor::~FrameSchedulePredictor() = default;
+
+void FrameSchedulePredictor::RecordVsync(fml::TimePoint start,
+                                         fml::TimePoint target) {
+  if (target <= start) {
+    return;
+  }
+  last_vsync_start_ = start;
+  vsync_interval_ = target - start;
+}
+
+void FrameSchedulePredictor::RecordBuildDuration(fml::TimeDelta duration) {
+  build_durations_[next_build_duration_] = duration;
+  next_build_duration_ = (next_build_duration_ + 1) % kHistorySize;
+  build_duration_count_ = std::min(build_duration_count_ + 1, kHistorySize);
+}
+
+void FrameSchedulePredictor::RecordPresentation(
+    fml::TimePoint presentation_time) {
+  if (vsync_interval_ <= fml::TimeDelta::Zero() ||
+      presentation_time <= last_vsync_start_) {
+    return;
+  }
+  last_vsync_start_ = presentation_time;
+}
+
+fml::TimeDelta FrameSchedulePredictor::PredictBuildDuration() const {
+  if (build_duration_count_ == 0) {
+    return fml::TimeDelta::Zero();
+  }
+  std::array<fml::TimeDelta, kHistorySize> sorted = build_durations_;
+  auto end = sorted.begin() + build_duration_count_;
+  std::sort(sorted.begin(), end);
+  // The smallest duration that is not exceeded by 90% of the frames.
+  const size_t index = (build_duration_count_ * 9 + 9) / 10 - 1;
+  return sorted[index];
+}
+
+fml::TimePoint FrameSchedulePredictor::NextVsyncBoundary(
+    fml::TimePoint time) const {
+  if (time <= last_vsync_start_) {
+    return last_vsync_start_;
+  }
+  const int64_t interval = vsync_interval_.ToNanoseconds();
+  const int64_t elapsed = (time - last_vsync_start_).ToNanoseconds();
+  const int64_t intervals = (elapsed + interval - 1) / interval;
+  return last_vsync_start_ +
+         fml::TimeDelta::FromNanoseconds(intervals * interval);
+}
+
+fml::TimePoint FrameSchedulePredictor::PredictNextVsyncStart(
+    fml::TimePoint now) const {
+  if (vsync_interval_ <= fml::TimeDelta::Zero()) {
+    return now;
+  }
+  return NextVsyncBoundary(now);
+}
+
+std::optional<fml::TimePoint> FrameSchedulePredictor::PredictEarlyFrameTarget(
+    fml::TimePoint now) const {
+  const fml::TimeDelta build_duration = PredictBuildDuration();
+  if (vsync_interval_ <= fml::TimeDelta::Zero() ||
+      build_duration <= vsync_interval_) {
+    // Either nothing is known yet, or a frame that starts building at the
+    // next vsync is predicted to be ready for its target.
+    return std::nullopt;
+  }
+  const fml::TimePoint next_vsync_start = NextVsyncBoundary(now);
+  const fml::TimePoint late_target =
+      NextVsyncBoundary(next_vsync_start + build_duration);
+  const fml::TimePoint early_target = NextVsyncBoundary(now + build_duration);
+  if (early_target >= late_target) {
+    return std::nullopt;
+  }
+  return early_target;
+}
+
+}  // namespace flutter
@@ -0,0 +1,74 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_FRAME_SCHEDULE_PREDICTOR_H_
+#define FLUTTER_SHELL_COMMON_FRAME_SCHEDULE_PREDICTOR_H_
+
+#include <array>
+#include <optional>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// Predicts when the next frames should be built from the recent vsync
+/// signals and frame build durations.
+///
+/// This is used by the |Animator| on the UI thread and is not thread safe.
+class FrameSchedulePredictor {
+ public:
+  /// The number of recent build durations that predictions are made from.
+  static constexpr size_t kHistorySize = 16;
+
+  FrameSchedulePredictor();
+
+  ~FrameSchedulePredictor();
+
+  /// Records a vsync signal that started at |start| for a frame targeted at
+  /// |target|.
+  void RecordVsync(fml::TimePoint start, fml::TimePoint target);
+
+  /// Records how long it took to build a frame.
+  void RecordBuildDuration(fml::TimeDelta duration);
+
+  /// Records that a frame was displayed at |presentation_time|. Displays
+  /// present frames on their refresh boundaries, while vsync signals can be
+  /// delivered late or be estimated, so a presentation that is more recent
+  /// than the last vsync realigns the predicted vsync phase.
+  void RecordPresentation(fml::TimePoint presentation_time);
+
+  /// The build duration that 90% of the recent frames stayed within, or zero
+  /// if no build duration has been recorded.
+  fml::TimeDelta PredictBuildDuration() const;
+
+  /// The start of the first vsync interval that begins at or after |now|,
+  /// extrapolated from the last recorded vsync. Returns |now| if no vsync
+  /// has been recorded.
+  fml::TimePoint PredictNextVsyncStart(fml::TimePoint now) const;
+
+  /// If a frame that is requested at |now| is predicted to land on an
+  /// earlier vsync when its build starts right away rather than at the next
+  /// vsync, returns the target time of that earlier vsync.
+  std::optional<fml::TimePoint> PredictEarlyFrameTarget(
+      fml::TimePoint now) const;
+
+ private:
+  // The first vsync boundary at or after |time|. Only valid once a vsync
+  // has been recorded.
+  fml::TimePoint NextVsyncBoundary(fml::TimePoint time) const;
+
+  std::array<fml::TimeDelta, kHistorySize> build_durations_;
+  size_t build_duration_count_ = 0;
+  size_t next_build_duration_ = 0;
+  fml::TimePoint last_vsync_start_;
+  fml::TimeDelta vsync_interval_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameSchedulePredictor);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_FRAME_SCHEDULE_PREDICTOR_H_
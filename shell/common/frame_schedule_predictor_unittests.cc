@@ -0,0 +1,94 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_schedule_predictor.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+fml::TimePoint Millis(int64_t millis) {
+  return fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromMilliseconds(millis));
+}
+
+}  // namespace
+
+TEST(FrameSchedulePredictorTest, NothingIsPredictedWithoutHistory) {
+  FrameSchedulePredictor predictor;
+  EXPECT_EQ(predictor.PredictBuildDuration(), fml::TimeDelta::Zero());
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(5)), Millis(5));
+  EXPECT_FALSE(predictor.PredictEarlyFrameTarget(Millis(5)).has_value());
+}
+
+TEST(FrameSchedulePredictorTest, PresentationsRealignTheVsyncPhase) {
+  FrameSchedulePredictor predictor;
+  // Presentations say nothing about the vsync interval.
+  predictor.RecordPresentation(Millis(4));
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(5)), Millis(5));
+
+  predictor.RecordVsync(Millis(0), Millis(16));
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(5)), Millis(16));
+
+  predictor.RecordPresentation(Millis(20));
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(21)), Millis(36));
+
+  // Older presentations are ignored.
+  predictor.RecordPresentation(Millis(10));
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(21)), Millis(36));
+}
+
+TEST(FrameSchedulePredictorTest, PredictsNinetiethPercentileBuildDuration) {
+  FrameSchedulePredictor predictor;
+  for (int i = 1; i <= 10; i++) {
+    predictor.RecordBuildDuration(fml::TimeDelta::FromMilliseconds(i));
+  }
+  EXPECT_EQ(predictor.PredictBuildDuration(),
+            fml::TimeDelta::FromMilliseconds(9));
+
+  // Only the most recent durations are kept.
+  for (size_t i = 0; i < FrameSchedulePredictor::kHistorySize; i++) {
+    predictor.RecordBuildDuration(fml::TimeDelta::FromMilliseconds(2));
+  }
+  EXPECT_EQ(predictor.PredictBuildDuration(),
+            fml::TimeDelta::FromMilliseconds(2));
+}
+
+TEST(FrameSchedulePredictorTest, ExtrapolatesVsyncStart) {
+  FrameSchedulePredictor predictor;
+  predictor.RecordVsync(Millis(100), Millis(116));
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(90)), Millis(100));
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(100)), Millis(100));
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(101)), Millis(116));
+  EXPECT_EQ(predictor.PredictNextVsyncStart(Millis(150)), Millis(164));
+}
+
+TEST(FrameSchedulePredictorTest, FastFramesAreNotStartedEarly) {
+  FrameSchedulePredictor predictor;
+  predictor.RecordVsync(Millis(100), Millis(116));
+  predictor.RecordBuildDuration(fml::TimeDelta::FromMilliseconds(10));
+  EXPECT_FALSE(predictor.PredictEarlyFrameTarget(Millis(104)).has_value());
+}
+
+TEST(FrameSchedulePredictorTest, SlowFramesAreStartedEarly) {
+  FrameSchedulePredictor predictor;
+  predictor.RecordVsync(Millis(100), Millis(116));
+  predictor.RecordBuildDuration(fml::TimeDelta::FromMilliseconds(20));
+
+  // Built at the vsync at 116ms, the frame would be ready at 136ms and land
+  // at 148ms. Started right away it is ready at 124ms and lands at 132ms.
+  std::optional<fml::TimePoint> target =
+      predictor.PredictEarlyFrameTarget(Millis(104));
+  ASSERT_TRUE(target.has_value());
+  EXPECT_EQ(target.value(), Millis(132));
+
+  // Too close to the next vsync for an early start to make a difference.
+  EXPECT_FALSE(predictor.PredictEarlyFrameTarget(Millis(114)).has_value());
+}
+
+}  // namespace testing
+}  // namespace flutter
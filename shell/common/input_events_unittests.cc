@@ -417,6 +417,77 @@ TEST_F(ShellTest, CanCorrectlySynthesizePointerPacket) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
 }
 
+namespace {
+
+class RecordingDispatcherDelegate : public PointerDataDispatcher::Delegate {
+ public:
+  void DoDispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                        uint64_t trace_flow_id) override {
+    dispatched_lengths.push_back(packet->GetLength());
+  }
+
+  void ScheduleSecondaryVsyncCallback(uintptr_t id,
+                                      const fml::closure& callback) override {
+    vsync_callback = callback;
+  }
+
+  void FireVsync() {
+    fml::closure callback = std::move(vsync_callback);
+    vsync_callback = nullptr;
+    if (callback) {
+      callback();
+    }
+  }
+
+  std::vector<size_t> dispatched_lengths;
+  fml::closure vsync_callback;
+};
+
+std::unique_ptr<PointerDataPacket> CreateSimulatedPacket(
+    PointerData::Change change) {
+  auto packet = std::make_unique<PointerDataPacket>(1);
+  PointerData data;
+  CreateSimulatedPointerData(data, change, 0, 0);
+  packet->SetPointerData(0, data);
+  return packet;
+}
+
+}  // namespace
+
+TEST(CoalescingPointerDataDispatcherTest, CoalescesMovesUntilTheNextVsync) {
+  RecordingDispatcherDelegate delegate;
+  CoalescingPointerDataDispatcher dispatcher(delegate);
+
+  // The first packet of a frame is dispatched right away and the following
+  // ones wait for the next vsync as a single packet.
+  for (int i = 0; i < 4; i++) {
+    dispatcher.DispatchPacket(CreateSimulatedPacket(PointerData::Change::kMove),
+                              0);
+  }
+  EXPECT_EQ(delegate.dispatched_lengths, std::vector<size_t>({1}));
+
+  delegate.FireVsync();
+  EXPECT_EQ(delegate.dispatched_lengths, std::vector<size_t>({1, 3}));
+  EXPECT_EQ(dispatcher.GetMetrics().delayed_packet_count, 1u);
+  EXPECT_EQ(dispatcher.GetMetrics().coalesced_packet_count, 2u);
+  EXPECT_GE(dispatcher.GetMetrics().max_pending_latency, fml::TimeDelta());
+}
+
+TEST(CoalescingPointerDataDispatcherTest, DoesNotCoalesceDiscreteEvents) {
+  RecordingDispatcherDelegate delegate;
+  CoalescingPointerDataDispatcher dispatcher(delegate);
+
+  dispatcher.DispatchPacket(CreateSimulatedPacket(PointerData::Change::kMove),
+                            0);
+  dispatcher.DispatchPacket(CreateSimulatedPacket(PointerData::Change::kMove),
+                            0);
+  dispatcher.DispatchPacket(CreateSimulatedPacket(PointerData::Change::kUp), 0);
+  delegate.FireVsync();
+
+  EXPECT_EQ(delegate.dispatched_lengths, std::vector<size_t>({1, 1, 1}));
+  EXPECT_EQ(dispatcher.GetMetrics().coalesced_packet_count, 0u);
+}
+
 }  // namespace testing
 }  // namespace flutter
 
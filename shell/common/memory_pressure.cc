@@ -0,0 +1,89 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/memory_pressure.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+MemoryPressureRegistry::MemoryPressureRegistry() = default;
+
+MemoryPressureRegistry::~MemoryPressureRegistry() = default;
+
+size_t MemoryPressureRegistry::Register(
+    std::string name,
+    fml::RefPtr<fml::TaskRunner> task_runner,
+    TrimCallback trim) {
+  FML_DCHECK(task_runner);
+  FML_DCHECK(trim);
+  std::scoped_lock lock(mutex_);
+  size_t id = next_id_++;
+  registrations_[id] = {std::move(name), std::move(task_runner),
+                        std::move(trim)};
+  return id;
+}
+
+void MemoryPressureRegistry::Unregister(size_t id) {
+  std::scoped_lock lock(mutex_);
+  registrations_.erase(id);
+}
+
+void MemoryPressureRegistry::Notify(MemoryPressureLevel level,
+                                    ReportCallback callback) const {
+  std::vector<Registration> registrations;
+  {
+    std::scoped_lock lock(mutex_);
+    registrations.reserve(registrations_.size());
+    for (const auto& item : registrations_) {
+      registrations.push_back(item.second);
+    }
+  }
+
+  if (registrations.empty()) {
+    if (callback) {
+      callback({});
+    }
+    return;
+  }
+
+  struct PendingReport {
+    std::mutex mutex;
+    size_t pending_trims;
+    MemoryPressureReport report;
+    ReportCallback callback;
+  };
+  auto pending = std::make_shared<PendingReport>();
+  pending->pending_trims = registrations.size();
+  pending->callback = std::move(callback);
+
+  for (auto& registration : registrations) {
+    fml::TaskRunner::RunNowOrPostTask(
+        registration.task_runner,
+        [pending, level, name = std::move(registration.name),
+         trim = std::move(registration.trim)]() {
+          size_t freed_bytes = trim(level);
+          ReportCallback callback;
+          MemoryPressureReport report;
+          {
+            std::scoped_lock lock(pending->mutex);
+            pending->report[name] += freed_bytes;
+            if (--pending->pending_trims > 0) {
+              return;
+            }
+            callback = std::move(pending->callback);
+            report = std::move(pending->report);
+          }
+          if (callback) {
+            callback(report);
+          }
+        });
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_MEMORY_PRESSURE_H_
+#define FLUTTER_SHELL_COMMON_MEMORY_PRESSURE_H_
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/fml/task_runner.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// The severity of a memory pressure notification.
+///
+enum class MemoryPressureLevel {
+  // Caches should drop the resources that they are unlikely to need soon,
+  // but may keep the ones in use to avoid janking the next frames.
+  kModerate,
+  // Caches should drop as much as possible, even when it is expensive to
+  // recreate the resources later.
+  kCritical,
+};
+
+//------------------------------------------------------------------------------
+/// The number of bytes that each subsystem freed in response to a memory
+/// pressure notification, keyed by the name that the subsystem registered
+/// with. Subsystems that cannot tell how much they freed report 0.
+///
+using MemoryPressureReport = std::map<std::string, size_t>;
+
+//------------------------------------------------------------------------------
+/// Dispatches memory pressure notifications to the caches of the shell
+/// subsystems, each of which is trimmed on the task runner that owns it.
+///
+/// This class is thread safe.
+///
+class MemoryPressureRegistry {
+ public:
+  using TrimCallback = std::function<size_t(MemoryPressureLevel level)>;
+  using ReportCallback = std::function<void(const MemoryPressureReport&)>;
+
+  MemoryPressureRegistry();
+
+  ~MemoryPressureRegistry();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Registers a cache to be trimmed on memory pressure.
+  ///
+  /// @param[in]  name         The name of the subsystem in reports.
+  /// @param[in]  task_runner  The task runner that |trim| is invoked on.
+  /// @param[in]  trim         Trims the cache according to the level and
+  ///                          returns the number of bytes that were freed.
+  ///                          Notifications that are in flight may still
+  ///                          invoke it after it was unregistered.
+  ///
+  /// @return     The identifier to unregister the cache with.
+  ///
+  size_t Register(std::string name,
+                  fml::RefPtr<fml::TaskRunner> task_runner,
+                  TrimCallback trim);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Stops trimming the cache with the given identifier for
+  ///             subsequent notifications.
+  ///
+  void Unregister(size_t id);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Trims all registered caches.
+  ///
+  /// @param[in]  level     The severity of the memory pressure.
+  /// @param[in]  callback  Invoked with the bytes freed by each subsystem
+  ///                       once all of them have been trimmed, on the task
+  ///                       runner of the cache that finished last. It is
+  ///                       invoked immediately if no cache is registered.
+  ///                       May be null.
+  ///
+  void Notify(MemoryPressureLevel level, ReportCallback callback) const;
+
+ private:
+  struct Registration {
+    std::string name;
+    fml::RefPtr<fml::TaskRunner> task_runner;
+    TrimCallback trim;
+  };
+
+  mutable std::mutex mutex_;
+  size_t next_id_ = 1;
+  std::map<size_t, Registration> registrations_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(MemoryPressureRegistry);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_MEMORY_PRESSURE_H_
@@ -0,0 +1,91 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#define FML_USED_ON_EMBEDDER
+
+#include "flutter/shell/common/memory_pressure.h"
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(MemoryPressureRegistryTest, ReportsImmediatelyWithoutCaches) {
+  MemoryPressureRegistry registry;
+  bool reported = false;
+  registry.Notify(MemoryPressureLevel::kCritical,
+                  [&reported](const MemoryPressureReport& report) {
+                    reported = true;
+                    ASSERT_TRUE(report.empty());
+                  });
+  ASSERT_TRUE(reported);
+}
+
+TEST(MemoryPressureRegistryTest, TrimsCachesOnTheirTaskRunners) {
+  fml::Thread thread_1("trim_1");
+  fml::Thread thread_2("trim_2");
+  MemoryPressureRegistry registry;
+  auto task_runner_1 = thread_1.GetTaskRunner();
+  auto task_runner_2 = thread_2.GetTaskRunner();
+  registry.Register("first", task_runner_1,
+                    [task_runner_1](MemoryPressureLevel level) -> size_t {
+                      EXPECT_TRUE(task_runner_1->RunsTasksOnCurrentThread());
+                      return level == MemoryPressureLevel::kCritical ? 100 : 10;
+                    });
+  registry.Register("second", task_runner_2,
+                    [task_runner_2](MemoryPressureLevel level) -> size_t {
+                      EXPECT_TRUE(task_runner_2->RunsTasksOnCurrentThread());
+                      return level == MemoryPressureLevel::kCritical ? 200 : 0;
+                    });
+
+  for (auto level :
+       {MemoryPressureLevel::kModerate, MemoryPressureLevel::kCritical}) {
+    fml::AutoResetEvent latch;
+    MemoryPressureReport report;
+    registry.Notify(level, [&](const MemoryPressureReport& result) {
+      report = result;
+      latch.Signal();
+    });
+    latch.Wait();
+    ASSERT_EQ(report.size(), 2u);
+    if (level == MemoryPressureLevel::kModerate) {
+      ASSERT_EQ(report["first"], 10u);
+      ASSERT_EQ(report["second"], 0u);
+    } else {
+      ASSERT_EQ(report["first"], 100u);
+      ASSERT_EQ(report["second"], 200u);
+    }
+  }
+}
+
+TEST(MemoryPressureRegistryTest, UnregisteredCachesAreNotTrimmed) {
+  fml::Thread thread("trim");
+  MemoryPressureRegistry registry;
+  size_t trim_count = 0;
+  size_t id = registry.Register(
+      "cache", thread.GetTaskRunner(),
+      [&trim_count](MemoryPressureLevel level) -> size_t {
+        trim_count++;
+        return 1;
+      });
+  registry.Register("other", thread.GetTaskRunner(),
+                    [](MemoryPressureLevel level) -> size_t { return 2; });
+  registry.Unregister(id);
+
+  fml::AutoResetEvent latch;
+  MemoryPressureReport report;
+  registry.Notify(MemoryPressureLevel::kCritical,
+                  [&](const MemoryPressureReport& result) {
+                    report = result;
+                    latch.Signal();
+                  });
+  latch.Wait();
+  ASSERT_EQ(trim_count, 0u);
+  ASSERT_EQ(report, MemoryPressureReport({{"other", 2}}));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -5,6 +5,7 @@
 #include "flutter/common/graphics/persistent_cache.h"
 
 #include <memory>
+#include <string>
 
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/flow/layers/container_layer.h"
@@ -13,6 +14,7 @@
 #include "flutter/fml/command_line.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/log_settings.h"
+#include "flutter/fml/paths.h"
 #include "flutter/fml/unique_fd.h"
 #include "flutter/shell/common/shell_test.h"
 #include "flutter/shell/common/switches.h"
@@ -362,5 +364,141 @@ TEST_F(PersistentCacheTest, PurgeAllowsFutureSkSLCache) {
   DestroyShell(std::move(shell));
 }
 
+TEST_F(PersistentCacheTest, CanStoreAndLoadFromPackedCache) {
+  sk_sp<SkData> shader_key = SkData::MakeWithCString("key");
+  sk_sp<SkData> shader_value = SkData::MakeWithCString("value");
+
+  fml::ScopedTemporaryDirectory base_dir;
+  ASSERT_TRUE(base_dir.fd().is_valid());
+  PersistentCache::SetCacheDirectoryPath(base_dir.path());
+  PersistentCache::SetUsePackedCache(true);
+  PersistentCache::ResetCacheForProcess();
+
+  auto settings = CreateSettingsForFixture();
+  settings.cache_sksl = true;
+  settings.packed_persistent_cache = true;
+  auto config = RunConfiguration::InferFromSettings(settings);
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+  RunEngine(shell.get(), std::move(config));
+  auto persistent_cache = PersistentCache::GetCacheForProcess();
+  ASSERT_EQ(persistent_cache->LoadSkSLs().size(), 0u);
+
+  StorePersistentCache(persistent_cache, *shader_key, *shader_value);
+  WaitForIO(shell.get());
+
+  // All the SkSLs are stored in the packed file of the SkSL directory.
+  auto sksl_dir = fml::OpenDirectoryReadOnly(
+      base_dir.fd(),
+      fml::JoinPaths({"flutter_engine", GetFlutterEngineVersion(), "skia",
+                      GetSkiaVersion(), PersistentCache::kSkSLSubdirName})
+          .c_str());
+  ASSERT_TRUE(sksl_dir.is_valid());
+  ASSERT_TRUE(
+      fml::FileExists(sksl_dir, PersistentCache::kPackedCacheFileName));
+  ASSERT_FALSE(fml::FileExists(
+      sksl_dir, PersistentCache::SkKeyToFilePath(*shader_key).c_str()));
+
+  // A new cache reads the entries back from the file.
+  DestroyShell(std::move(shell));
+  PersistentCache::ResetCacheForProcess();
+  auto sksls = PersistentCache::GetCacheForProcess()->LoadSkSLs();
+  ASSERT_EQ(sksls.size(), 1u);
+  ASSERT_TRUE(sksls[0].key->equals(shader_key.get()));
+  ASSERT_TRUE(sksls[0].value->equals(shader_value.get()));
+
+  // Cleanup
+  PersistentCache::SetUsePackedCache(false);
+  PersistentCache::ResetCacheForProcess();
+  fml::RemoveFilesInDirectory(base_dir.fd());
+}
+
+TEST(PackedCacheFileTest, EntriesArePersistedAcrossLoads) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  auto dir = std::make_shared<fml::UniqueFD>(
+      fml::OpenDirectory(temp_dir.path().c_str(), false,
+                         fml::FilePermission::kReadWrite));
+  // Compressible values are compressed, others are stored as is.
+  std::string compressible(1000, 'a');
+  sk_sp<SkData> key_a = SkData::MakeWithCString("a");
+  sk_sp<SkData> value_a = SkData::MakeWithCopy(compressible.data(), 1000);
+  sk_sp<SkData> key_b = SkData::MakeWithCString("b");
+  sk_sp<SkData> value_b = SkData::MakeWithCString("xyz");
+  {
+    PackedCacheFile cache(dir, "cache.pack", false, true);
+    ASSERT_EQ(cache.Get(*key_a), nullptr);
+    cache.Put(*key_a, *value_a);
+    ASSERT_TRUE(cache.Get(*key_a)->equals(value_a.get()));
+    ASSERT_TRUE(cache.Persist());
+    // The first entry compacts the new file, the following ones are appended.
+    cache.Put(*key_b, *value_b);
+    ASSERT_TRUE(cache.Persist());
+    ASSERT_EQ(cache.GetAppendedRecordCount(), 1u);
+  }
+  auto file = fml::OpenFileReadOnly(*dir, "cache.pack");
+  ASSERT_LT(fml::FileMapping(file).GetSize(), 1000u);
+
+  PackedCacheFile cache(dir, "cache.pack", false, true);
+  ASSERT_EQ(cache.GetEntryCount(), 2u);
+  ASSERT_EQ(cache.GetAppendedRecordCount(), 1u);
+  ASSERT_TRUE(cache.Get(*key_a)->equals(value_a.get()));
+  ASSERT_TRUE(cache.Get(*key_b)->equals(value_b.get()));
+  ASSERT_EQ(cache.GetEntries().size(), 2u);
+}
+
+TEST(PackedCacheFileTest, TornRecordsAreDropped) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  auto dir = std::make_shared<fml::UniqueFD>(
+      fml::OpenDirectory(temp_dir.path().c_str(), false,
+                         fml::FilePermission::kReadWrite));
+  sk_sp<SkData> key_a = SkData::MakeWithCString("a");
+  sk_sp<SkData> key_b = SkData::MakeWithCString("b");
+  sk_sp<SkData> value = SkData::MakeWithCString("value");
+  {
+    PackedCacheFile cache(dir, "cache.pack", false, false);
+    cache.Put(*key_a, *value);
+    ASSERT_TRUE(cache.Persist());
+    cache.Put(*key_b, *value);
+    ASSERT_TRUE(cache.Persist());
+  }
+
+  // Cut the last byte off the appended record.
+  {
+    auto file = fml::OpenFile(*dir, "cache.pack", false,
+                              fml::FilePermission::kReadWrite);
+    size_t size = fml::FileMapping(file).GetSize();
+    ASSERT_TRUE(fml::TruncateFile(file, size - 1));
+  }
+
+  PackedCacheFile cache(dir, "cache.pack", false, false);
+  ASSERT_EQ(cache.GetEntryCount(), 1u);
+  ASSERT_NE(cache.Get(*key_a), nullptr);
+  ASSERT_EQ(cache.Get(*key_b), nullptr);
+
+  // The torn record is overwritten by the next append.
+  cache.Put(*key_b, *value);
+  ASSERT_TRUE(cache.Persist());
+  PackedCacheFile reloaded(dir, "cache.pack", false, false);
+  ASSERT_EQ(reloaded.GetEntryCount(), 2u);
+}
+
+TEST(PackedCacheFileTest, ManyAppendsAreCompacted) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  auto dir = std::make_shared<fml::UniqueFD>(
+      fml::OpenDirectory(temp_dir.path().c_str(), false,
+                         fml::FilePermission::kReadWrite));
+  sk_sp<SkData> value = SkData::MakeWithCString("value");
+  PackedCacheFile cache(dir, "cache.pack", false, false);
+  for (size_t i = 0; i <= PackedCacheFile::kMaxAppendedRecords + 1; i++) {
+    sk_sp<SkData> key = SkData::MakeWithCString(std::to_string(i).c_str());
+    cache.Put(*key, *value);
+    ASSERT_TRUE(cache.Persist());
+  }
+  ASSERT_LT(cache.GetAppendedRecordCount(),
+            PackedCacheFile::kMaxAppendedRecords);
+
+  PackedCacheFile reloaded(dir, "cache.pack", false, false);
+  ASSERT_EQ(reloaded.GetEntryCount(), PackedCacheFile::kMaxAppendedRecords + 2);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -5,7 +5,10 @@
 #ifndef FLUTTER_SHELL_COMMON_PIPELINE_H_
 #define FLUTTER_SHELL_COMMON_PIPELINE_H_
 
+#include <atomic>
+#include <cstdint>
 #include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 
@@ -32,6 +35,19 @@ enum class PipelineConsumeResult {
   MoreAvailable,
 };
 
+/// What the pipeline does when the producer gets ahead of the consumer.
+enum class PipelineDropPolicy {
+  /// Items are consumed in order and none are dropped. |Produce| fails once
+  /// the pipeline is full.
+  kFIFO,
+  /// Committing an item drops all the items that are still waiting to be
+  /// consumed, so the consumer only ever sees the newest one.
+  kLatestOnly,
+  /// Like |kFIFO|, except that |Produce| drops the oldest item that is still
+  /// waiting to be consumed instead of failing when the pipeline is full.
+  kBoundedWithDrop,
+};
+
 size_t GetNextPipelineTraceID();
 
 /// A thread-safe queue of resources for a single consumer and a single
@@ -101,16 +117,42 @@ class Pipeline {
     FML_DISALLOW_COPY_AND_ASSIGN(ProducerContinuation);
   };
 
-  explicit Pipeline(uint32_t depth)
-      : empty_(depth), available_(0), inflight_(0) {}
+  explicit Pipeline(uint32_t depth,
+                    PipelineDropPolicy policy = PipelineDropPolicy::kFIFO)
+      : empty_(depth),
+        available_(0),
+        inflight_(0),
+        policy_(policy),
+        dropped_count_(0) {}
 
   ~Pipeline() = default;
 
   bool IsValid() const { return empty_.IsValid() && available_.IsValid(); }
 
+  /// The policy may be changed by the producer or the consumer at any time.
+  /// It applies to the items produced or committed after the change.
+  void SetDropPolicy(PipelineDropPolicy policy) { policy_ = policy; }
+
+  PipelineDropPolicy GetDropPolicy() const { return policy_; }
+
+  /// The number of committed items that were dropped before they could be
+  /// consumed.
+  size_t GetDroppedCount() const { return dropped_count_; }
+
+  /// The number of committed items that are waiting for the consumer.
+  size_t GetQueuedCount() {
+    std::scoped_lock lock(queue_mutex_);
+    return queue_.size();
+  }
+
   ProducerContinuation Produce() {
     if (!empty_.TryWait()) {
-      return {};
+      // Under |kBoundedWithDrop| the slot of the oldest waiting item is
+      // reused for the new one.
+      if (policy_ != PipelineDropPolicy::kBoundedWithDrop ||
+          DropWaitingItems(1) == 0) {
+        return {};
+      }
     }
     ++inflight_;
     FML_TRACE_COUNTER("flutter", "Pipeline Depth",
@@ -162,6 +204,11 @@ class Pipeline {
 
     {
       std::scoped_lock lock(queue_mutex_);
+      if (queue_.empty()) {
+        // The item was dropped by the producer after its availability was
+        // signaled. See |DropWaitingItems|.
+        return PipelineConsumeResult::NoneAvailable;
+      }
       std::tie(resource, trace_id) = std::move(queue_.front());
       queue_.pop_front();
       items_count = queue_.size();
@@ -183,14 +230,63 @@ class Pipeline {
   fml::Semaphore empty_;
   fml::Semaphore available_;
   std::atomic<int> inflight_;
+  std::atomic<PipelineDropPolicy> policy_;
+  std::atomic<size_t> dropped_count_;
   std::mutex queue_mutex_;
   std::deque<std::pair<ResourcePtr, size_t>> queue_;
 
+  // Drops up to |max_count| of the oldest items that are still waiting to be
+  // consumed and returns the number of items that were dropped. The slots of
+  // the dropped items stay reserved for the caller.
+  //
+  // The availability of each dropped item has already been signaled. Those
+  // signals are taken back where possible. When the consumer has already
+  // acquired one, it finds fewer items than signals and reports that none
+  // are available.
+  size_t DropWaitingItems(size_t max_count) {
+    std::deque<std::pair<ResourcePtr, size_t>> dropped;
+    {
+      std::scoped_lock lock(queue_mutex_);
+      while (dropped.size() < max_count && !queue_.empty()) {
+        dropped.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      }
+    }
+    for (const auto& item : dropped) {
+      available_.TryWait();
+      --inflight_;
+      TRACE_EVENT_INSTANT0("flutter", "PipelineItemDropped");
+      TRACE_FLOW_END("flutter", "PipelineItem", item.second);
+      TRACE_EVENT_ASYNC_END0("flutter", "PipelineItem", item.second);
+    }
+    dropped_count_ += dropped.size();
+    if (!dropped.empty()) {
+      FML_TRACE_COUNTER("flutter", "Pipeline Dropped Items",
+                        reinterpret_cast<int64_t>(this),  //
+                        "dropped items",
+                        static_cast<int64_t>(dropped_count_.load())  //
+      );
+    }
+    // The dropped resources are destroyed here, outside of the queue mutex.
+    return dropped.size();
+  }
+
   PipelineProduceResult ProducerCommit(ResourcePtr resource, size_t trace_id) {
+    size_t dropped = 0;
+    if (policy_ == PipelineDropPolicy::kLatestOnly) {
+      // The dropped items had their own slots, which are free again now.
+      dropped = DropWaitingItems(SIZE_MAX);
+      for (size_t i = 0; i < dropped; i++) {
+        empty_.Signal();
+      }
+    }
+
     bool is_first_item = false;
     {
       std::scoped_lock lock(queue_mutex_);
-      is_first_item = queue_.empty();
+      // The consumer was already notified about the dropped items, and it
+      // picks up this item in their place.
+      is_first_item = queue_.empty() && dropped == 0;
       queue_.emplace_back(std::move(resource), trace_id);
     }
 
@@ -220,13 +316,22 @@ class Pipeline {
   FML_DISALLOW_COPY_AND_ASSIGN(Pipeline);
 };
 
+// The layer trees of the views other than the implicit view, by view ID.
+using ViewLayerTrees = std::map<int64_t, std::shared_ptr<LayerTree>>;
+
 struct LayerTreeItem {
   LayerTreeItem(std::shared_ptr<LayerTree> layer_tree,
-                std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder)
+                std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder,
+                ViewLayerTrees view_layer_trees = {})
       : layer_tree(std::move(layer_tree)),
-        frame_timings_recorder(std::move(frame_timings_recorder)) {}
+        frame_timings_recorder(std::move(frame_timings_recorder)),
+        view_layer_trees(std::move(view_layer_trees)) {}
+  // The layer tree of the implicit view.
   std::shared_ptr<LayerTree> layer_tree;
   std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder;
+  // The layer trees of the other views that were rendered in the same frame.
+  // They are rasterized in the same pass as the implicit view.
+  ViewLayerTrees view_layer_trees;
 };
 
 using LayerTreePipeline = Pipeline<LayerTreeItem>;
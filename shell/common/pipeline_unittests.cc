@@ -144,5 +144,90 @@ TEST(PipelineTest, ProduceIfEmptySuccessfulIfQueueIsEmpty) {
   ASSERT_EQ(consume_result_1, PipelineConsumeResult::Done);
 }
 
+TEST(PipelineTest, LatestOnlyDropsWaitingItems) {
+  const int depth = 3;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(
+      depth, PipelineDropPolicy::kLatestOnly);
+
+  for (int i = 1; i <= 3; i++) {
+    Continuation continuation = pipeline->Produce();
+    PipelineProduceResult result =
+        continuation.Complete(std::make_unique<int>(i));
+    ASSERT_EQ(result.success, true);
+    ASSERT_EQ(result.is_first_item, i == 1);
+  }
+  ASSERT_EQ(pipeline->GetDroppedCount(), 2u);
+
+  PipelineConsumeResult consume_result = pipeline->Consume(
+      [](std::unique_ptr<int> v) { ASSERT_EQ(*v, 3); });
+  ASSERT_EQ(consume_result, PipelineConsumeResult::Done);
+
+  // The dropped items did not leave any signals behind.
+  consume_result = pipeline->Consume([](std::unique_ptr<int> v) { FAIL(); });
+  ASSERT_EQ(consume_result, PipelineConsumeResult::NoneAvailable);
+
+  // All the slots are free again.
+  Continuation continuation_1 = pipeline->Produce();
+  Continuation continuation_2 = pipeline->Produce();
+  Continuation continuation_3 = pipeline->Produce();
+  ASSERT_TRUE(continuation_1);
+  ASSERT_TRUE(continuation_2);
+  ASSERT_TRUE(continuation_3);
+}
+
+TEST(PipelineTest, BoundedWithDropReplacesOldestItemWhenFull) {
+  const int depth = 2;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(
+      depth, PipelineDropPolicy::kBoundedWithDrop);
+
+  for (int i = 1; i <= 4; i++) {
+    Continuation continuation = pipeline->Produce();
+    ASSERT_TRUE(continuation);
+    PipelineProduceResult result =
+        continuation.Complete(std::make_unique<int>(i));
+    ASSERT_EQ(result.success, true);
+  }
+  ASSERT_EQ(pipeline->GetDroppedCount(), 2u);
+
+  PipelineConsumeResult consume_result = pipeline->Consume(
+      [](std::unique_ptr<int> v) { ASSERT_EQ(*v, 3); });
+  ASSERT_EQ(consume_result, PipelineConsumeResult::MoreAvailable);
+  consume_result = pipeline->Consume(
+      [](std::unique_ptr<int> v) { ASSERT_EQ(*v, 4); });
+  ASSERT_EQ(consume_result, PipelineConsumeResult::Done);
+}
+
+TEST(PipelineTest, BoundedWithDropCannotDropItemsInProduction) {
+  const int depth = 1;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(
+      depth, PipelineDropPolicy::kBoundedWithDrop);
+
+  Continuation continuation_1 = pipeline->Produce();
+  Continuation continuation_2 = pipeline->Produce();
+  ASSERT_TRUE(continuation_1);
+  ASSERT_FALSE(continuation_2);
+  ASSERT_EQ(pipeline->GetDroppedCount(), 0u);
+}
+
+TEST(PipelineTest, DropPolicyCanBeChanged) {
+  const int depth = 1;
+  std::shared_ptr<IntPipeline> pipeline = std::make_shared<IntPipeline>(depth);
+  ASSERT_EQ(pipeline->GetDropPolicy(), PipelineDropPolicy::kFIFO);
+
+  PipelineProduceResult result =
+      pipeline->Produce().Complete(std::make_unique<int>(1));
+  ASSERT_EQ(result.success, true);
+  ASSERT_FALSE(pipeline->Produce());
+
+  pipeline->SetDropPolicy(PipelineDropPolicy::kBoundedWithDrop);
+  result = pipeline->Produce().Complete(std::make_unique<int>(2));
+  ASSERT_EQ(result.success, true);
+  ASSERT_EQ(pipeline->GetDroppedCount(), 1u);
+
+  PipelineConsumeResult consume_result = pipeline->Consume(
+      [](std::unique_ptr<int> v) { ASSERT_EQ(*v, 2); });
+  ASSERT_EQ(consume_result, PipelineConsumeResult::Done);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -4,6 +4,8 @@
 
 #include "flutter/shell/common/pointer_data_dispatcher.h"
 
+#include <algorithm>
+
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -15,6 +17,11 @@ SmoothPointerDataDispatcher::SmoothPointerDataDispatcher(Delegate& delegate)
     : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
 SmoothPointerDataDispatcher::~SmoothPointerDataDispatcher() = default;
 
+CoalescingPointerDataDispatcher::CoalescingPointerDataDispatcher(
+    Delegate& delegate)
+    : SmoothPointerDataDispatcher(delegate) {}
+CoalescingPointerDataDispatcher::~CoalescingPointerDataDispatcher() = default;
+
 void DefaultPointerDataDispatcher::DispatchPacket(
     std::unique_ptr<PointerDataPacket> packet,
     uint64_t trace_flow_id) {
@@ -68,4 +75,59 @@ void SmoothPointerDataDispatcher::DispatchPendingPacket() {
   ScheduleSecondaryVsyncCallback();
 }
 
+bool CoalescingPointerDataDispatcher::IsContinuous(
+    const PointerDataPacket& packet) {
+  for (size_t i = 0; i < packet.GetLength(); i++) {
+    const PointerData data = packet.GetPointerData(i);
+    if (data.signal_kind != PointerData::SignalKind::kNone) {
+      return false;
+    }
+    switch (data.change) {
+      case PointerData::Change::kMove:
+      case PointerData::Change::kHover:
+      case PointerData::Change::kPanZoomUpdate:
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+void CoalescingPointerDataDispatcher::DispatchPacket(
+    std::unique_ptr<PointerDataPacket> packet,
+    uint64_t trace_flow_id) {
+  if (is_pointer_data_in_progress_ && pending_packet_ != nullptr &&
+      is_pending_packet_continuous_ && IsContinuous(*packet)) {
+    TRACE_EVENT0("flutter", "CoalescingPointerDataDispatcher::DispatchPacket");
+    // The flow of the pending packet carries on to the framework.
+    TRACE_FLOW_END("flutter", "PointerEvent", trace_flow_id);
+    pending_packet_->Append(*packet);
+    metrics_.coalesced_packet_count++;
+    return;
+  }
+
+  const bool is_continuous = IsContinuous(*packet);
+  SmoothPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                              trace_flow_id);
+  // A packet that is still pending after the dispatch is the new packet.
+  if (pending_packet_ != nullptr) {
+    is_pending_packet_continuous_ = is_continuous;
+    pending_packet_time_ = fml::TimePoint::Now();
+  }
+}
+
+void CoalescingPointerDataDispatcher::DispatchPendingPacket() {
+  const fml::TimeDelta latency = fml::TimePoint::Now() - pending_packet_time_;
+  metrics_.delayed_packet_count++;
+  metrics_.total_pending_latency = metrics_.total_pending_latency + latency;
+  metrics_.max_pending_latency =
+      std::max(metrics_.max_pending_latency, latency);
+  FML_TRACE_COUNTER("flutter", "PointerDataPendingLatency",
+                    reinterpret_cast<int64_t>(this), "latency_us",
+                    latency.ToMicroseconds());
+  is_pending_packet_continuous_ = false;
+  SmoothPointerDataDispatcher::DispatchPendingPacket();
+}
+
 }  // namespace flutter
@@ -5,6 +5,7 @@
 #ifndef POINTER_DATA_DISPATCHER_H_
 #define POINTER_DATA_DISPATCHER_H_
 
+#include "flutter/fml/time/time_point.h"
 #include "flutter/runtime/runtime_controller.h"
 #include "flutter/shell/common/animator.h"
 
@@ -147,8 +148,8 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
 
   virtual ~SmoothPointerDataDispatcher();
 
- private:
-  void DispatchPendingPacket();
+ protected:
+  virtual void DispatchPendingPacket();
   void ScheduleSecondaryVsyncCallback();
 
   // If non-null, this will be a pending pointer data packet for the next frame
@@ -158,11 +159,61 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   int pending_trace_flow_id_ = -1;
   bool is_pointer_data_in_progress_ = false;
 
+ private:
   // WeakPtrFactory must be the last member.
   fml::WeakPtrFactory<SmoothPointerDataDispatcher> weak_factory_;
   FML_DISALLOW_COPY_AND_ASSIGN(SmoothPointerDataDispatcher);
 };
 
+//------------------------------------------------------------------------------
+/// A `SmoothPointerDataDispatcher` that coalesces the packets of continuous
+/// input, such as the moves of a stylus or a mouse reported at 240Hz, into
+/// the pending packet of the next vsync instead of dispatching the pending
+/// packet early for each of them.
+///
+/// The framework then handles the input of a frame in a single dispatch.
+/// Every pointer data is kept in its original order, so the historical
+/// samples remain available to the velocity trackers and the resampling of
+/// the framework. Packets that hold anything but moves, hovers and pan/zoom
+/// updates, such as a down or an up, are never coalesced.
+///
+class CoalescingPointerDataDispatcher : public SmoothPointerDataDispatcher {
+ public:
+  /// Counters of the packets that were coalesced and of the time that
+  /// packets waited to be dispatched.
+  struct Metrics {
+    // The packets that waited for a vsync to be dispatched.
+    size_t delayed_packet_count = 0;
+    // The packets that were appended to a delayed packet.
+    size_t coalesced_packet_count = 0;
+    fml::TimeDelta total_pending_latency;
+    fml::TimeDelta max_pending_latency;
+  };
+
+  explicit CoalescingPointerDataDispatcher(Delegate& delegate);
+
+  // |PointerDataDispatcer|
+  void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                      uint64_t trace_flow_id) override;
+
+  virtual ~CoalescingPointerDataDispatcher();
+
+  const Metrics& GetMetrics() const { return metrics_; }
+
+  /// Whether the packet only holds pointer data that may be coalesced.
+  static bool IsContinuous(const PointerDataPacket& packet);
+
+ private:
+  // |SmoothPointerDataDispatcher|
+  void DispatchPendingPacket() override;
+
+  bool is_pending_packet_continuous_ = false;
+  fml::TimePoint pending_packet_time_;
+  Metrics metrics_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(CoalescingPointerDataDispatcher);
+};
+
 //--------------------------------------------------------------------------
 /// @brief      Signature for constructing PointerDataDispatcher.
 ///
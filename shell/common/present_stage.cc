@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/present_stage.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+PresentStage::PresentStage(size_t max_pending_presents)
+    : max_pending_presents_(std::max<size_t>(max_pending_presents, 1)),
+      thread_("io.flutter.present") {}
+
+PresentStage::~PresentStage() {
+  Flush();
+}
+
+void PresentStage::Present(SurfaceFrame::PresentCallback present_callback) {
+  FML_DCHECK(present_callback);
+  {
+    TRACE_EVENT0("flutter", "PresentStage::WaitForPendingPresents");
+    std::unique_lock lock(mutex_);
+    pending_presents_changed_.wait(lock, [this] {
+      return pending_presents_ < max_pending_presents_;
+    });
+    pending_presents_++;
+  }
+
+  thread_.GetTaskRunner()->PostTask(fml::MakeCopyable(
+      [this, present_callback = std::move(present_callback)]() {
+        {
+          TRACE_EVENT0("flutter", "PresentStage::Present");
+          if (!present_callback()) {
+            FML_DLOG(ERROR) << "Could not present the frame.";
+          }
+        }
+        std::scoped_lock lock(mutex_);
+        pending_presents_--;
+        pending_presents_changed_.notify_all();
+      }));
+}
+
+void PresentStage::Flush() {
+  TRACE_EVENT0("flutter", "PresentStage::Flush");
+  std::unique_lock lock(mutex_);
+  pending_presents_changed_.wait(lock,
+                                 [this] { return pending_presents_ == 0; });
+}
+
+}  // namespace flutter
@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_PRESENT_STAGE_H_
+#define FLUTTER_SHELL_COMMON_PRESENT_STAGE_H_
+
+#include <condition_variable>
+#include <mutex>
+
+#include "flutter/flow/surface_frame.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/thread.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Presents the frames that the rasterizer has submitted on a dedicated
+/// thread, so that the raster thread can start on the next frame while the
+/// driver blocks in presenting the previous one.
+///
+/// At most |max_pending_presents| frames may be waiting to be presented. The
+/// raster thread blocks when it submits another one, which bounds the
+/// latency that the stage adds.
+///
+class PresentStage {
+ public:
+  explicit PresentStage(size_t max_pending_presents);
+
+  ~PresentStage();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Presents a frame on the present thread, after the frames
+  ///             that were handed to the stage before it.
+  ///
+  ///             Blocks while |max_pending_presents| frames are pending.
+  ///
+  void Present(SurfaceFrame::PresentCallback present_callback);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Blocks until all pending frames have been presented. This
+  ///             must be called before the surface that the frames belong
+  ///             to is torn down.
+  ///
+  void Flush();
+
+  size_t GetMaxPendingPresents() const { return max_pending_presents_; }
+
+ private:
+  const size_t max_pending_presents_;
+  std::mutex mutex_;
+  std::condition_variable pending_presents_changed_;
+  size_t pending_presents_ = 0;
+  // Declared last, so that the thread is joined before the state that its
+  // tasks use is destroyed.
+  fml::Thread thread_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PresentStage);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_PRESENT_STAGE_H_
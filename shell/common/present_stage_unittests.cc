@@ -0,0 +1,61 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#define FML_USED_ON_EMBEDDER
+
+#include "flutter/shell/common/present_stage.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(PresentStageTest, PresentsFramesInOrder) {
+  PresentStage stage(2);
+  std::vector<int> presented;
+  for (int i = 0; i < 10; i++) {
+    stage.Present([&presented, i]() {
+      presented.push_back(i);
+      return true;
+    });
+  }
+  stage.Flush();
+  ASSERT_EQ(presented, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(PresentStageTest, MaxPendingPresentsIsAtLeastOne) {
+  PresentStage stage(0);
+  ASSERT_EQ(stage.GetMaxPendingPresents(), 1u);
+}
+
+TEST(PresentStageTest, PresentBlocksWhenTooManyFramesArePending) {
+  PresentStage stage(1);
+  fml::AutoResetEvent release_first_present;
+  std::atomic<bool> second_present_queued = false;
+  stage.Present([&release_first_present]() {
+    release_first_present.Wait();
+    return true;
+  });
+
+  std::thread raster_thread([&stage, &second_present_queued]() {
+    stage.Present([]() { return true; });
+    second_present_queued = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  ASSERT_FALSE(second_present_queued);
+
+  release_first_present.Signal();
+  raster_thread.join();
+  ASSERT_TRUE(second_present_queued);
+  stage.Flush();
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -9,7 +9,9 @@
 #include <utility>
 
 #include "flow/frame_timings.h"
+#include "flutter/common/constants.h"
 #include "flutter/common/graphics/persistent_cache.h"
+#include "flutter/display_list/display_list_capture.h"
 #include "flutter/flow/layers/offscreen_surface.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
@@ -22,12 +24,23 @@
 #include "third_party/skia/include/core/SkSurfaceCharacterization.h"
 #include "third_party/skia/include/utils/SkBase64.h"
 
+#if IMPELLER_SUPPORTS_RENDERING
+#include "flutter/impeller/aiks/aiks_context.h"
+#include "flutter/impeller/renderer/context.h"
+#include "flutter/impeller/renderer/gpu_tracer.h"
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 namespace flutter {
 
 // The rasterizer will tell Skia to purge cached resources that have not been
 // used within this interval.
 static constexpr std::chrono::milliseconds kSkiaCleanupExpiration(15000);
 
+// Under moderate memory pressure, the rasterizer tells Skia to purge cached
+// resources that have not been used within this interval.
+static constexpr std::chrono::milliseconds kModerateMemoryPressureExpiration(
+    1000);
+
 Rasterizer::Rasterizer(Delegate& delegate,
                        MakeGpuImageBehavior gpu_image_behavior)
     : delegate_(delegate),
@@ -38,6 +51,18 @@ Rasterizer::Rasterizer(Delegate& delegate,
           SnapshotController::Make(*this, delegate.GetSettings())),
       weak_factory_(this) {
   FML_DCHECK(compositor_context_);
+  if (delegate.GetSettings().raster_cache_lru_eviction) {
+    compositor_context_->raster_cache().SetEvictionPolicy(
+        RasterCacheEvictionPolicy::kLeastRecentlyUsed);
+  }
+  if (delegate.GetSettings().raster_cache_compression) {
+    compositor_context_->raster_cache().SetCompressionOptions(
+        {.compression = RasterCacheCompression::kRGB565});
+  }
+  if (delegate.GetSettings().max_pending_presents > 0) {
+    present_stage_ = std::make_unique<PresentStage>(
+        delegate.GetSettings().max_pending_presents);
+  }
 }
 
 Rasterizer::~Rasterizer() = default;
@@ -52,6 +77,9 @@ fml::TaskRunnerAffineWeakPtr<SnapshotDelegate> Rasterizer::GetSnapshotDelegate()
 }
 
 void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
+  if (present_stage_) {
+    present_stage_->Flush();
+  }
   surface_ = std::move(surface);
 
   if (max_cache_bytes_.has_value()) {
@@ -84,6 +112,16 @@ void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
   }
 }
 
+void Rasterizer::AddView(int64_t view_id, std::unique_ptr<Surface> surface) {
+  FML_DCHECK(view_id != kFlutterImplicitViewId);
+  FML_DCHECK(surface);
+  view_surfaces_[view_id] = std::move(surface);
+}
+
+void Rasterizer::RemoveView(int64_t view_id) {
+  view_surfaces_.erase(view_id);
+}
+
 void Rasterizer::TeardownExternalViewEmbedder() {
   if (external_view_embedder_) {
     external_view_embedder_->Teardown();
@@ -91,9 +129,16 @@ void Rasterizer::TeardownExternalViewEmbedder() {
 }
 
 void Rasterizer::Teardown() {
+  if (present_stage_) {
+    // The pending frames still belong to the surface that is torn down.
+    present_stage_->Flush();
+  }
   if (surface_) {
     auto context_switch = surface_->MakeRenderContextCurrent();
     if (context_switch->GetResult()) {
+      // Forgets the snapshot textures in use first, so that the images which
+      // are notified below delete them instead of giving them back.
+      snapshot_texture_pool_.OnGrContextDestroyed();
       compositor_context_->OnGrContextDestroyed();
       if (auto* context = surface_->GetContext()) {
         context->purgeUnlockedResources(/*scratchResourcesOnly=*/false);
@@ -101,6 +146,7 @@ void Rasterizer::Teardown() {
     }
     surface_.reset();
   }
+  view_surfaces_.clear();
 
   last_layer_tree_.reset();
 
@@ -125,22 +171,62 @@ void Rasterizer::DisableThreadMergerIfNeeded() {
 }
 
 void Rasterizer::NotifyLowMemoryWarning() const {
+  TrimResourceCache(MemoryPressureLevel::kCritical);
+}
+
+size_t Rasterizer::TrimResourceCache(MemoryPressureLevel level) const {
   if (!surface_) {
-    FML_DLOG(INFO)
-        << "Rasterizer::NotifyLowMemoryWarning called with no surface.";
-    return;
+    FML_DLOG(INFO) << "Rasterizer::TrimResourceCache called with no surface.";
+    return 0;
   }
   auto context = surface_->GetContext();
   if (!context) {
     FML_DLOG(INFO)
-        << "Rasterizer::NotifyLowMemoryWarning called with no GrContext.";
-    return;
+        << "Rasterizer::TrimResourceCache called with no GrContext.";
+    return 0;
   }
   auto context_switch = surface_->MakeRenderContextCurrent();
   if (!context_switch->GetResult()) {
-    return;
+    return 0;
+  }
+  size_t bytes_before = 0;
+  context->getResourceCacheUsage(nullptr, &bytes_before);
+  context->performDeferredCleanup(level == MemoryPressureLevel::kCritical
+                                      ? std::chrono::milliseconds(0)
+                                      : kModerateMemoryPressureExpiration);
+  size_t bytes_after = 0;
+  context->getResourceCacheUsage(nullptr, &bytes_after);
+  return bytes_before > bytes_after ? bytes_before - bytes_after : 0;
+}
+
+size_t Rasterizer::TrimRasterCache(MemoryPressureLevel level) {
+  RasterCache& raster_cache = compositor_context_->raster_cache();
+  if (level == MemoryPressureLevel::kModerate) {
+    return raster_cache.EvictRetainedEntries();
   }
-  context->performDeferredCleanup(std::chrono::milliseconds(0));
+  size_t cached_bytes = raster_cache.EstimatePictureCacheByteSize() +
+                        raster_cache.EstimateLayerCacheByteSize();
+  raster_cache.Clear();
+  return cached_bytes;
+}
+
+size_t Rasterizer::TrimSnapshotTexturePool(MemoryPressureLevel level) {
+  return snapshot_texture_pool_.Purge();
+}
+
+size_t Rasterizer::TrimGlyphAtlas(MemoryPressureLevel level) const {
+#if IMPELLER_SUPPORTS_RENDERING
+  if (level != MemoryPressureLevel::kCritical || !surface_) {
+    return 0;
+  }
+  auto aiks_context = surface_->GetAiksContext();
+  if (!aiks_context) {
+    return 0;
+  }
+  return aiks_context->GetContentContext().GetGlyphAtlasContext()->Reset();
+#else
+  return 0;
+#endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
 std::shared_ptr<flutter::TextureRegistry> Rasterizer::GetTextureRegistry() {
@@ -161,7 +247,7 @@ void Rasterizer::DrawLastLayerTree(
     return;
   }
   RasterStatus raster_status =
-      DrawToSurface(*frame_timings_recorder, *last_layer_tree_);
+      DrawToSurface(*frame_timings_recorder, *last_layer_tree_, {});
 
   // EndFrame should perform cleanups for the external_view_embedder.
   if (external_view_embedder_ && external_view_embedder_->GetUsedThisFrame()) {
@@ -195,7 +281,8 @@ RasterStatus Rasterizer::Draw(
           raster_status = RasterStatus::kDiscarded;
         } else {
           raster_status =
-              DoDraw(std::move(frame_timings_recorder), std::move(layer_tree));
+              DoDraw(std::move(frame_timings_recorder), std::move(layer_tree),
+                     std::move(item->view_layer_trees));
         }
       };
 
@@ -209,7 +296,8 @@ RasterStatus Rasterizer::Draw(
   bool should_resubmit_frame = ShouldResubmitFrame(raster_status);
   if (should_resubmit_frame) {
     auto resubmitted_layer_tree_item = std::make_unique<LayerTreeItem>(
-        std::move(resubmitted_layer_tree_), std::move(resubmitted_recorder_));
+        std::move(resubmitted_layer_tree_), std::move(resubmitted_recorder_),
+        std::move(resubmitted_view_layer_trees_));
     auto front_continuation = pipeline->ProduceIfEmpty();
     PipelineProduceResult result =
         front_continuation.Complete(std::move(resubmitted_layer_tree_item));
@@ -303,7 +391,8 @@ std::unique_ptr<Rasterizer::GpuImageResult> Rasterizer::MakeSkiaGpuImage(
           })
           .SetIfFalse([&result, &image_info, &display_list,
                        surface = surface_.get(),
-                       gpu_image_behavior = gpu_image_behavior_] {
+                       gpu_image_behavior = gpu_image_behavior_,
+                       texture_pool = &snapshot_texture_pool_] {
             if (!surface ||
                 gpu_image_behavior == MakeGpuImageBehavior::kBitmap) {
               result = MakeBitmapImage(display_list, image_info);
@@ -316,9 +405,8 @@ std::unique_ptr<Rasterizer::GpuImageResult> Rasterizer::MakeSkiaGpuImage(
               return;
             }
 
-            GrBackendTexture texture = context->createBackendTexture(
-                image_info.width(), image_info.height(), image_info.colorType(),
-                GrMipmapped::kNo, GrRenderable::kYes);
+            GrBackendTexture texture =
+                texture_pool->Acquire(context, image_info);
             if (!texture.isValid()) {
               result = std::make_unique<SnapshotDelegate::GpuImageResult>(
                   GrBackendTexture(), nullptr, nullptr,
@@ -330,6 +418,7 @@ std::unique_ptr<Rasterizer::GpuImageResult> Rasterizer::MakeSkiaGpuImage(
                 context, texture, kTopLeft_GrSurfaceOrigin, /*sampleCnt=*/0,
                 image_info.colorType(), image_info.refColorSpace(), nullptr);
             if (!sk_surface) {
+              texture_pool->Release(texture);
               result = std::make_unique<SnapshotDelegate::GpuImageResult>(
                   GrBackendTexture(), nullptr, nullptr,
                   "unable to create rendering surface for image");
@@ -346,6 +435,10 @@ std::unique_ptr<Rasterizer::GpuImageResult> Rasterizer::MakeSkiaGpuImage(
   return result;
 }
 
+bool Rasterizer::RecycleSkiaGpuTexture(const GrBackendTexture& texture) {
+  return snapshot_texture_pool_.Release(texture);
+}
+
 sk_sp<DlImage> Rasterizer::MakeRasterSnapshot(sk_sp<DisplayList> display_list,
                                               SkISize picture_size) {
   return snapshot_controller_->MakeRasterSnapshot(display_list, picture_size);
@@ -356,13 +449,30 @@ sk_sp<SkImage> Rasterizer::ConvertToRasterImage(sk_sp<SkImage> image) {
   return snapshot_controller_->ConvertToRasterImage(image);
 }
 
+void Rasterizer::MakeRasterSnapshotAsync(
+    sk_sp<DisplayList> display_list,
+    SkISize picture_size,
+    std::function<void(sk_sp<DlImage>)> callback) {
+  TRACE_EVENT0("flutter", __FUNCTION__);
+  snapshot_controller_->MakeRasterSnapshotAsync(display_list, picture_size,
+                                                std::move(callback));
+}
+
+void Rasterizer::ConvertToRasterImageAsync(
+    sk_sp<SkImage> image,
+    std::function<void(sk_sp<SkImage>)> callback) {
+  TRACE_EVENT0("flutter", __FUNCTION__);
+  snapshot_controller_->ConvertToRasterImageAsync(image, std::move(callback));
+}
+
 fml::Milliseconds Rasterizer::GetFrameBudget() const {
   return delegate_.GetFrameBudget();
 };
 
 RasterStatus Rasterizer::DoDraw(
     std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder,
-    std::shared_ptr<flutter::LayerTree> layer_tree) {
+    std::shared_ptr<flutter::LayerTree> layer_tree,
+    ViewLayerTrees view_layer_trees) {
   TRACE_EVENT_WITH_FRAME_NUMBER(frame_timings_recorder, "flutter",
                                 "Rasterizer::DoDraw");
   FML_DCHECK(delegate_.GetTaskRunners()
@@ -376,12 +486,23 @@ RasterStatus Rasterizer::DoDraw(
   PersistentCache* persistent_cache = PersistentCache::GetCacheForProcess();
   persistent_cache->ResetStoredNewShaders();
 
+  // Drops the layer trees of the views that were removed since the frame was
+  // built.
+  for (auto it = view_layer_trees.begin(); it != view_layer_trees.end();) {
+    if (!it->second || view_surfaces_.count(it->first) == 0) {
+      it = view_layer_trees.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
   RasterStatus raster_status =
-      DrawToSurface(*frame_timings_recorder, *layer_tree);
+      DrawToSurface(*frame_timings_recorder, *layer_tree, view_layer_trees);
   if (raster_status == RasterStatus::kSuccess) {
     last_layer_tree_ = std::move(layer_tree);
   } else if (ShouldResubmitFrame(raster_status)) {
     resubmitted_layer_tree_ = std::move(layer_tree);
+    resubmitted_view_layer_trees_ = std::move(view_layer_trees);
     resubmitted_recorder_ = frame_timings_recorder->CloneUntil(
         FrameTimingsRecorder::State::kBuildEnd);
     return raster_status;
@@ -463,20 +584,22 @@ RasterStatus Rasterizer::DoDraw(
 
 RasterStatus Rasterizer::DrawToSurface(
     FrameTimingsRecorder& frame_timings_recorder,
-    flutter::LayerTree& layer_tree) {
+    flutter::LayerTree& layer_tree,
+    const ViewLayerTrees& view_layer_trees) {
   TRACE_EVENT0("flutter", "Rasterizer::DrawToSurface");
   FML_DCHECK(surface_);
 
   RasterStatus raster_status;
   if (surface_->AllowsDrawingWhenGpuDisabled()) {
-    raster_status = DrawToSurfaceUnsafe(frame_timings_recorder, layer_tree);
+    raster_status = DrawToSurfaceUnsafe(frame_timings_recorder, layer_tree,
+                                        view_layer_trees);
   } else {
     delegate_.GetIsGpuDisabledSyncSwitch()->Execute(
         fml::SyncSwitch::Handlers()
             .SetIfTrue([&] { raster_status = RasterStatus::kDiscarded; })
             .SetIfFalse([&] {
-              raster_status =
-                  DrawToSurfaceUnsafe(frame_timings_recorder, layer_tree);
+              raster_status = DrawToSurfaceUnsafe(
+                  frame_timings_recorder, layer_tree, view_layer_trees);
             }));
   }
 
@@ -488,7 +611,8 @@ RasterStatus Rasterizer::DrawToSurface(
 /// \see Rasterizer::DrawToSurface
 RasterStatus Rasterizer::DrawToSurfaceUnsafe(
     FrameTimingsRecorder& frame_timings_recorder,
-    flutter::LayerTree& layer_tree) {
+    flutter::LayerTree& layer_tree,
+    const ViewLayerTrees& view_layer_trees) {
   FML_DCHECK(surface_);
 
   compositor_context_->ui_time().SetLapTime(
@@ -535,7 +659,11 @@ RasterStatus Rasterizer::DrawToSurfaceUnsafe(
       surface_->GetAiksContext()             // aiks context
   );
   if (compositor_frame) {
-    compositor_context_->raster_cache().BeginFrame();
+    if (view_layer_trees.empty()) {
+      compositor_context_->raster_cache().BeginFrame();
+    } else {
+      compositor_context_->raster_cache().BeginMultiViewFrame();
+    }
     frame_timings_recorder.RecordRasterStart(fml::TimePoint::Now());
 
     std::unique_ptr<FrameDamage> damage;
@@ -586,9 +714,12 @@ RasterStatus Rasterizer::DrawToSurfaceUnsafe(
     if (presentation_time > fml::TimePoint::Now()) {
       submit_info.presentation_time = presentation_time;
     }
+    submit_info.frame_number = frame_timings_recorder.GetFrameNumber();
     if (damage) {
       submit_info.frame_damage = damage->GetFrameDamage();
       submit_info.buffer_damage = damage->GetBufferDamage();
+      submit_info.frame_damage_rects = damage->GetFrameDamageRects();
+      submit_info.buffer_damage_rects = damage->GetBufferDamageRects();
     }
 
     frame->set_submit_info(submit_info);
@@ -598,11 +729,45 @@ RasterStatus Rasterizer::DrawToSurfaceUnsafe(
       FML_DCHECK(!frame->IsSubmitted());
       external_view_embedder_->SubmitFrame(surface_->GetContext(),
                                            std::move(frame));
+    } else if (present_stage_) {
+      // Let the present thread block in presenting this frame while the
+      // raster thread moves on to the next one.
+      SurfaceFrame::PresentCallback present_callback =
+          frame->TakePresentCallback();
+      if (frame->Submit() && present_callback) {
+        present_stage_->Present(std::move(present_callback));
+      }
     } else {
       frame->Submit();
     }
 
+    // The other views share the raster cache frame of the implicit view, so
+    // that the entries they have in common are rasterized once and none of
+    // them are evicted before every view has been prerolled.
+    for (const auto& [view_id, view_layer_tree] : view_layer_trees) {
+      RasterStatus view_raster_status =
+          DrawToViewSurface(*view_surfaces_[view_id], *view_layer_tree);
+      if (view_raster_status != RasterStatus::kSuccess) {
+        FML_DLOG(ERROR) << "Failed to rasterize view " << view_id;
+      }
+    }
+
     compositor_context_->raster_cache().EndFrame();
+#if IMPELLER_SUPPORTS_RENDERING
+    // Report the GPU time measured by Impeller next to the CPU raster time.
+    // Results arrive once the GPU is done, so this trails the frame.
+    if (auto aiks_context = surface_->GetAiksContext()) {
+      auto gpu_tracer = aiks_context->GetContext()->GetGPUTracer();
+      if (gpu_tracer && gpu_tracer->SupportsTimestampQueries()) {
+        const auto gpu_time = gpu_tracer->TakeCompletedGPUTime();
+        frame_timings_recorder.RecordRasterGPUTime(gpu_time);
+        FML_TRACE_COUNTER("flutter", "RasterGPUTime",
+                          reinterpret_cast<int64_t>(this),            //
+                          "Microseconds", gpu_time.ToMicroseconds()  //
+        );
+      }
+    }
+#endif  // IMPELLER_SUPPORTS_RENDERING
     frame_timings_recorder.RecordRasterEnd(
         &compositor_context_->raster_cache());
     FireNextFrameCallbackIfPresent();
@@ -617,6 +782,46 @@ RasterStatus Rasterizer::DrawToSurfaceUnsafe(
   return RasterStatus::kFailed;
 }
 
+RasterStatus Rasterizer::DrawToViewSurface(Surface& surface,
+                                           flutter::LayerTree& layer_tree) {
+  TRACE_EVENT0("flutter", "Rasterizer::DrawToViewSurface");
+  auto frame = surface.AcquireFrame(layer_tree.frame_size());
+  if (frame == nullptr) {
+    return RasterStatus::kFailed;
+  }
+
+  auto compositor_frame = compositor_context_->AcquireFrame(
+      surface.GetContext(),               // skia GrContext
+      frame->SkiaCanvas(),                // root surface canvas
+      nullptr,                            // external view embedder
+      surface.GetRootTransformation(),    // root surface transformation
+      false,                              // instrumentation enabled
+      frame->framebuffer_info()
+          .supports_readback,                // surface supports pixel reads
+      nullptr,                               // thread merger
+      frame->GetDisplayListBuilder().get(),  // display list builder
+      surface.GetAiksContext()               // aiks context
+  );
+  if (!compositor_frame) {
+    return RasterStatus::kFailed;
+  }
+
+  bool ignore_raster_cache = !surface.EnableRasterCache() ||
+                             layer_tree.is_leaf_layer_tracing_enabled();
+  RasterStatus raster_status =
+      compositor_frame->Raster(layer_tree,           // layer tree
+                               ignore_raster_cache,  // ignore raster cache
+                               nullptr               // frame damage
+      );
+  if (raster_status == RasterStatus::kFailed ||
+      raster_status == RasterStatus::kSkipAndRetry) {
+    return raster_status;
+  }
+
+  frame->Submit();
+  return raster_status;
+}
+
 static sk_sp<SkData> ScreenshotLayerTreeAsPicture(
     flutter::LayerTree* tree,
     flutter::CompositorContext& compositor_context) {
@@ -647,6 +852,25 @@ static sk_sp<SkData> ScreenshotLayerTreeAsPicture(
   return recorder.finishRecordingAsPicture()->serialize(&procs);
 }
 
+static sk_sp<SkData> ScreenshotLayerTreeAsDisplayList(
+    flutter::LayerTree* tree,
+    flutter::CompositorContext& compositor_context) {
+  FML_DCHECK(tree != nullptr);
+  auto display_list = tree->Flatten(
+      SkRect::MakeWH(tree->frame_size().width(), tree->frame_size().height()),
+      compositor_context.texture_registry());
+  if (!display_list) {
+    return nullptr;
+  }
+  auto capture =
+      DisplayListCapture::Serialize(*display_list, tree->frame_size());
+  if (!capture) {
+    FML_LOG(ERROR) << "The layer tree has content that can't be captured.";
+    return nullptr;
+  }
+  return SkData::MakeWithCopy(capture->GetMapping(), capture->GetSize());
+}
+
 sk_sp<SkData> Rasterizer::ScreenshotLayerTreeAsImage(
     flutter::LayerTree* tree,
     flutter::CompositorContext& compositor_context,
@@ -724,6 +948,10 @@ Rasterizer::Screenshot Rasterizer::ScreenshotLastLayerTree(
       data = ScreenshotLayerTreeAsImage(layer_tree, *compositor_context_,
                                         surface_context, true);
       break;
+    case ScreenshotType::DisplayListCapture:
+      data =
+          ScreenshotLayerTreeAsDisplayList(layer_tree, *compositor_context_);
+      break;
   }
 
   if (data == nullptr) {
@@ -779,6 +1007,9 @@ void Rasterizer::SetResourceCacheMaxBytes(size_t max_bytes, bool from_user) {
   }
 
   max_cache_bytes_ = max_bytes;
+  // The raster cache images are kept within the same budget as the other
+  // GPU resources.
+  compositor_context_->raster_cache().SetMaxBytes(max_bytes);
   if (!surface_) {
     return;
   }
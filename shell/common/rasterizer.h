@@ -5,6 +5,7 @@
 #ifndef SHELL_COMMON_RASTERIZER_H_
 #define SHELL_COMMON_RASTERIZER_H_
 
+#include <map>
 #include <memory>
 #include <optional>
 
@@ -15,6 +16,7 @@
 #include "flutter/flow/embedded_views.h"
 #include "flutter/flow/frame_timings.h"
 #include "flutter/flow/layers/layer_tree.h"
+#include "flutter/flow/snapshot_texture_pool.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
 #include "flutter/fml/memory/weak_ptr.h"
@@ -24,7 +26,9 @@
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/lib/ui/snapshot_delegate.h"
+#include "flutter/shell/common/memory_pressure.h"
 #include "flutter/shell/common/pipeline.h"
+#include "flutter/shell/common/present_stage.h"
 #include "flutter/shell/common/snapshot_controller.h"
 #include "flutter/shell/common/snapshot_surface_producer.h"
 #include "third_party/skia/include/core/SkImage.h"
@@ -162,6 +166,34 @@ class Rasterizer final : public SnapshotDelegate,
   ///
   void Teardown();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Provides the on-screen surface of a view other than the
+  ///             implicit view. The layer trees of such views arrive with the
+  ///             frames of the implicit view and are rasterized in the same
+  ///             pass, sharing the compositor context and the raster cache.
+  ///             The surface must use the same rendering context as the
+  ///             surface given to `Rasterizer::Setup`.
+  ///
+  ///             Views other than the implicit view don't composite platform
+  ///             views, so the external view embedder is not used for them.
+  ///
+  /// @see        `Rasterizer::RemoveView`
+  ///
+  /// @param[in]  view_id  The ID of the view, which must not be the implicit
+  ///                      view.
+  /// @param[in]  surface  The on-screen render surface of the view.
+  ///
+  void AddView(int64_t view_id, std::unique_ptr<Surface> surface);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Releases the surface of a view added with
+  ///             `Rasterizer::AddView`. The layer trees of the view are
+  ///             dropped from then on.
+  ///
+  /// @param[in]  view_id  The ID of the view.
+  ///
+  void RemoveView(int64_t view_id);
+
   //----------------------------------------------------------------------------
   /// @brief      Releases any resource used by the external view embedder.
   ///             For example, overlay surfaces or Android views.
@@ -177,6 +209,57 @@ class Rasterizer final : public SnapshotDelegate,
   ///
   void NotifyLowMemoryWarning() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Frees the GPU resources cached by the Skia context that is
+  ///             associated with onscreen rendering. Under moderate memory
+  ///             pressure, only the resources that have not been used
+  ///             recently are freed.
+  ///
+  /// @param[in]  level  The severity of the memory pressure.
+  ///
+  /// @return     The number of bytes that were freed.
+  ///
+  size_t TrimResourceCache(MemoryPressureLevel level) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Evicts entries from the raster cache. Under moderate memory
+  ///             pressure, the entries that were used in the last frame are
+  ///             kept.
+  ///
+  /// @param[in]  level  The severity of the memory pressure.
+  ///
+  /// @return     The number of bytes of cached images that were evicted.
+  ///
+  size_t TrimRasterCache(MemoryPressureLevel level);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drops the glyph atlas of the Impeller context under critical
+  ///             memory pressure. Rebuilding the atlas is expensive, so it is
+  ///             kept under moderate memory pressure.
+  ///
+  /// @param[in]  level  The severity of the memory pressure.
+  ///
+  /// @return     The number of bytes that were freed.
+  ///
+  size_t TrimGlyphAtlas(MemoryPressureLevel level) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Deletes the textures that the snapshot texture pool keeps for
+  ///             reuse. They are not in use, so this is done under any memory
+  ///             pressure.
+  ///
+  /// @return     The number of bytes that were freed.
+  ///
+  size_t TrimSnapshotTexturePool(MemoryPressureLevel level);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The pool of the textures that GPU resident snapshots are
+  ///             drawn into on the Skia backend.
+  ///
+  SnapshotTexturePool& snapshot_texture_pool() {
+    return snapshot_texture_pool_;
+  }
+
   //----------------------------------------------------------------------------
   /// @brief      Gets a weak pointer to the rasterizer. The rasterizer may only
   ///             be accessed on the raster task runner.
@@ -287,6 +370,14 @@ class Rasterizer final : public SnapshotDelegate,
     /// container is used.
     ///
     CompressedImage,
+
+    //--------------------------------------------------------------------------
+    /// A format used to denote a capture of the flattened display list of the
+    /// layer tree, as described by `DisplayListCapture`. Captures may be
+    /// replayed offline with each backend using the `display_list_replay`
+    /// tool to compare the cost of rasterizing the frame.
+    ///
+    DisplayListCapture,
   };
 
   //----------------------------------------------------------------------------
@@ -474,6 +565,9 @@ class Rasterizer final : public SnapshotDelegate,
       sk_sp<DisplayList> display_list,
       const SkImageInfo& image_info) override;
 
+  // |SnapshotDelegate|
+  bool RecycleSkiaGpuTexture(const GrBackendTexture& texture) override;
+
   // |SnapshotDelegate|
   sk_sp<DlImage> MakeRasterSnapshot(sk_sp<DisplayList> display_list,
                                     SkISize picture_size) override;
@@ -481,6 +575,17 @@ class Rasterizer final : public SnapshotDelegate,
   // |SnapshotDelegate|
   sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) override;
 
+  // |SnapshotDelegate|
+  void MakeRasterSnapshotAsync(
+      sk_sp<DisplayList> display_list,
+      SkISize picture_size,
+      std::function<void(sk_sp<DlImage>)> callback) override;
+
+  // |SnapshotDelegate|
+  void ConvertToRasterImageAsync(
+      sk_sp<SkImage> image,
+      std::function<void(sk_sp<SkImage>)> callback) override;
+
   // |Stopwatch::Delegate|
   /// Time limit for a smooth frame.
   ///
@@ -512,13 +617,22 @@ class Rasterizer final : public SnapshotDelegate,
 
   RasterStatus DoDraw(
       std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder,
-      std::shared_ptr<flutter::LayerTree> layer_tree);
+      std::shared_ptr<flutter::LayerTree> layer_tree,
+      ViewLayerTrees view_layer_trees = {});
 
   RasterStatus DrawToSurface(FrameTimingsRecorder& frame_timings_recorder,
-                             flutter::LayerTree& layer_tree);
+                             flutter::LayerTree& layer_tree,
+                             const ViewLayerTrees& view_layer_trees);
 
   RasterStatus DrawToSurfaceUnsafe(FrameTimingsRecorder& frame_timings_recorder,
-                                   flutter::LayerTree& layer_tree);
+                                   flutter::LayerTree& layer_tree,
+                                   const ViewLayerTrees& view_layer_trees);
+
+  // Rasterizes the layer tree of a view added with |AddView|. This is part of
+  // the raster pass of the implicit view, which brackets the raster cache
+  // frame.
+  RasterStatus DrawToViewSurface(Surface& surface,
+                                 flutter::LayerTree& layer_tree);
 
   void FireNextFrameCallbackIfPresent();
 
@@ -528,6 +642,8 @@ class Rasterizer final : public SnapshotDelegate,
   Delegate& delegate_;
   MakeGpuImageBehavior gpu_image_behavior_;
   std::unique_ptr<Surface> surface_;
+  // The surfaces of the views other than the implicit view.
+  std::map<int64_t, std::unique_ptr<Surface>> view_surfaces_;
   std::unique_ptr<SnapshotSurfaceProducer> snapshot_surface_producer_;
   std::unique_ptr<flutter::CompositorContext> compositor_context_;
   // This is the last successfully rasterized layer tree.
@@ -537,12 +653,16 @@ class Rasterizer final : public SnapshotDelegate,
   // thread configuration. This will be inserted to the front of the pipeline.
   std::shared_ptr<flutter::LayerTree> resubmitted_layer_tree_;
   std::unique_ptr<FrameTimingsRecorder> resubmitted_recorder_;
+  ViewLayerTrees resubmitted_view_layer_trees_;
   fml::closure next_frame_callback_;
   bool user_override_resource_cache_bytes_;
   std::optional<size_t> max_cache_bytes_;
   fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger_;
   std::shared_ptr<ExternalViewEmbedder> external_view_embedder_;
   std::unique_ptr<SnapshotController> snapshot_controller_;
+  // Only set when frames are presented off the raster thread.
+  std::unique_ptr<PresentStage> present_stage_;
+  SnapshotTexturePool snapshot_texture_pool_;
 
   // WeakPtrFactory must be the last member.
   fml::TaskRunnerAffineWeakPtrFactory<Rasterizer> weak_factory_;
@@ -614,6 +614,81 @@ TEST(RasterizerTest,
   latch.Wait();
 }
 
+TEST(RasterizerTest, drawRasterizesTheLayerTreesOfAllViewsInOnePass) {
+  std::string test_name =
+      ::testing::UnitTest::GetInstance()->current_test_info()->name();
+  ThreadHost thread_host("io.flutter.test." + test_name + ".",
+                         ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+                             ThreadHost::Type::IO | ThreadHost::Type::UI);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  NiceMock<MockDelegate> delegate;
+  Settings settings;
+  ON_CALL(delegate, GetSettings()).WillByDefault(ReturnRef(settings));
+  EXPECT_CALL(delegate, GetTaskRunners())
+      .WillRepeatedly(ReturnRef(task_runners));
+  EXPECT_CALL(delegate, OnFrameRasterized(_));
+
+  auto rasterizer = std::make_unique<Rasterizer>(delegate);
+  auto surface = std::make_unique<NiceMock<MockSurface>>();
+  auto view_surface = std::make_unique<NiceMock<MockSurface>>();
+  auto removed_view_surface = std::make_unique<NiceMock<MockSurface>>();
+
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  framebuffer_info.supports_readback = true;
+  auto make_surface_frame = [&framebuffer_info](bool* submitted) {
+    return std::make_unique<SurfaceFrame>(
+        /*surface=*/nullptr, /*framebuffer_info=*/framebuffer_info,
+        /*submit_callback=*/
+        [submitted](const SurfaceFrame&, SkCanvas*) {
+          *submitted = true;
+          return true;
+        },
+        /*frame_size=*/SkISize::Make(800, 600));
+  };
+  bool implicit_view_submitted = false;
+  bool view_submitted = false;
+  EXPECT_CALL(*surface, AllowsDrawingWhenGpuDisabled()).WillOnce(Return(true));
+  EXPECT_CALL(*surface, AcquireFrame(SkISize()))
+      .WillOnce(Return(ByMove(make_surface_frame(&implicit_view_submitted))));
+  EXPECT_CALL(*surface, MakeRenderContextCurrent())
+      .WillOnce(Return(ByMove(std::make_unique<GLContextDefaultResult>(true))));
+  EXPECT_CALL(*view_surface, AcquireFrame(SkISize()))
+      .WillOnce(Return(ByMove(make_surface_frame(&view_submitted))));
+  EXPECT_CALL(*removed_view_surface, AcquireFrame(_)).Times(0);
+
+  rasterizer->Setup(std::move(surface));
+  rasterizer->AddView(1, std::move(view_surface));
+  rasterizer->AddView(2, std::move(removed_view_surface));
+  rasterizer->RemoveView(2);
+  fml::AutoResetWaitableEvent latch;
+  thread_host.raster_thread->GetTaskRunner()->PostTask([&] {
+    auto pipeline = std::make_shared<LayerTreePipeline>(/*depth=*/10);
+    auto layer_tree = std::make_shared<LayerTree>(/*frame_size=*/SkISize(),
+                                                  /*device_pixel_ratio=*/2.0f);
+    ViewLayerTrees view_layer_trees;
+    view_layer_trees[1] = std::make_shared<LayerTree>(
+        /*frame_size=*/SkISize(), /*device_pixel_ratio=*/2.0f);
+    view_layer_trees[2] = std::make_shared<LayerTree>(
+        /*frame_size=*/SkISize(), /*device_pixel_ratio=*/2.0f);
+    auto layer_tree_item = std::make_unique<LayerTreeItem>(
+        std::move(layer_tree), CreateFinishedBuildRecorder(),
+        std::move(view_layer_trees));
+    PipelineProduceResult result =
+        pipeline->Produce().Complete(std::move(layer_tree_item));
+    EXPECT_TRUE(result.success);
+    auto no_discard = [](LayerTree&) { return false; };
+    RasterStatus status = rasterizer->Draw(pipeline, no_discard);
+    EXPECT_EQ(status, RasterStatus::kSuccess);
+    EXPECT_TRUE(implicit_view_submitted);
+    EXPECT_TRUE(view_submitted);
+    latch.Signal();
+  });
+  latch.Wait();
+}
+
 TEST(
     RasterizerTest,
     drawWithGpuDisabledAndSurfaceAllowsDrawingWhenGpuDisabledDoesAcquireFrame) {
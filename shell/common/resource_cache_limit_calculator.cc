@@ -11,6 +11,10 @@ size_t ResourceCacheLimitCalculator::GetResourceCacheMaxBytes() {
   size_t max_bytes_threshold = max_bytes_threshold_ > 0
                                    ? max_bytes_threshold_
                                    : std::numeric_limits<size_t>::max();
+  if (max_bytes_threshold_ > 0 && reserved_bytes_callback_) {
+    max_bytes_threshold -=
+        std::min(reserved_bytes_callback_(), max_bytes_threshold_ / 2);
+  }
   std::vector<fml::WeakPtr<ResourceCacheLimitItem>> live_items;
   for (auto item : items_) {
     if (item) {
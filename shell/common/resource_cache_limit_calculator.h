@@ -6,6 +6,7 @@
 #define FLUTTER_SHELL_COMMON_RESOURCE_CACHE_LIMIT_CALCULATOR_
 
 #include <cstdint>
+#include <functional>
 #include <unordered_map>
 
 #include "flutter/fml/macros.h"
@@ -34,6 +35,14 @@ class ResourceCacheLimitCalculator {
     items_.push_back(item);
   }
 
+  // Sets a callback for the bytes held by caches outside of the GPU resource
+  // cache that count towards the max bytes threshold, such as the frames that
+  // animated images decode ahead. At most half of the threshold is reserved
+  // for them. This will be called on the platform thread.
+  void SetReservedBytesCallback(std::function<size_t()> callback) {
+    reserved_bytes_callback_ = std::move(callback);
+  }
+
   // The maximum GPU resource cache limit in bytes calculated by
   // 'ResourceCacheLimitItem's. This will be called on the platform thread.
   size_t GetResourceCacheMaxBytes();
@@ -41,6 +50,7 @@ class ResourceCacheLimitCalculator {
  private:
   std::vector<fml::WeakPtr<ResourceCacheLimitItem>> items_;
   size_t max_bytes_threshold_;
+  std::function<size_t()> reserved_bytes_callback_;
   FML_DISALLOW_COPY_AND_ASSIGN(ResourceCacheLimitCalculator);
 };
 }  // namespace flutter
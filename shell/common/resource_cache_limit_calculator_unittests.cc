@@ -50,5 +50,26 @@ TEST(ResourceCacheLimitCalculatorTest, GetResourceCacheMaxBytes) {
   EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(500U));
 }
 
+TEST(ResourceCacheLimitCalculatorTest, ReservedBytesReduceThreshold) {
+  ResourceCacheLimitCalculator calculator(800U);
+  auto item = std::make_unique<TestResourceCacheLimitItem>(1000.0);
+  calculator.AddResourceCacheLimitItem(item->GetWeakPtr());
+  size_t reserved_bytes = 100U;
+  calculator.SetReservedBytesCallback([&]() { return reserved_bytes; });
+  EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(700U));
+
+  // At most half of the threshold is reserved.
+  reserved_bytes = 600U;
+  EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(400U));
+}
+
+TEST(ResourceCacheLimitCalculatorTest, ReservedBytesIgnoredWithoutThreshold) {
+  ResourceCacheLimitCalculator calculator(0U);
+  auto item = std::make_unique<TestResourceCacheLimitItem>(1000.0);
+  calculator.AddResourceCacheLimitItem(item->GetWeakPtr());
+  calculator.SetReservedBytesCallback([]() { return 100U; });
+  EXPECT_EQ(calculator.GetResourceCacheMaxBytes(), static_cast<size_t>(1000U));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -5,11 +5,13 @@
 #define RAPIDJSON_HAS_STDSTRING 1
 #include "flutter/shell/common/shell.h"
 
+#include <atomic>
 #include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
 
+#include "flutter/assets/asset_access_profile.h"
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/fml/base32.h"
@@ -21,6 +23,9 @@
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/painting/multi_frame_codec.h"
+#include "flutter/runtime/dart_snapshot_profile.h"
+#include "flutter/runtime/dart_service_isolate.h"
 #include "flutter/runtime/dart_vm.h"
 #include "flutter/shell/common/engine.h"
 #include "flutter/shell/common/skia_event_tracer_impl.h"
@@ -39,6 +44,7 @@ constexpr char kSkiaChannel[] = "flutter/skia";
 constexpr char kSystemChannel[] = "flutter/system";
 constexpr char kTypeKey[] = "type";
 constexpr char kFontChange[] = "fontsChange";
+constexpr char kMemoryPressure[] = "memoryPressure";
 
 namespace {
 
@@ -113,7 +119,11 @@ void PerformInitializationTasks(Settings& settings) {
     }
   });
 
+  PersistentCache::SetUsePackedCache(settings.packed_persistent_cache);
   PersistentCache::SetCacheSkSL(settings.cache_sksl);
+  MultiFrameCodec::SetDecodeAheadLimits(
+      settings.animated_image_decode_ahead_frame_count,
+      settings.animated_image_decode_ahead_byte_budget);
 }
 
 }  // namespace
@@ -146,6 +156,8 @@ std::unique_ptr<Shell> Shell::Create(
   auto resource_cache_limit_calculator =
       std::make_shared<ResourceCacheLimitCalculator>(
           settings.resource_cache_max_bytes_threshold);
+  resource_cache_limit_calculator->SetReservedBytesCallback(
+      &MultiFrameCodec::GetDecodeAheadBytes);
   return CreateWithSnapshot(platform_data,                    //
                             task_runners,                     //
                             /*parent_merger=*/nullptr,        //
@@ -173,6 +185,11 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
     const Shell::CreateCallback<Rasterizer>& on_create_rasterizer,
     const Shell::EngineCreateCallback& on_create_engine,
     bool is_gpu_disabled) {
+  // The subsystems are set up concurrently on their own threads. Only the
+  // engine depends on the others, and it waits for the IO manager and the
+  // snapshot delegate of the rasterizer on the UI thread instead of blocking
+  // this thread.
+  TRACE_EVENT0("flutter", "Shell::CreateShellOnPlatformThread");
   if (!task_runners.IsValid()) {
     FML_LOG(ERROR) << "Task runners to run the shell were invalid.";
     return nullptr;
@@ -200,21 +217,33 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   ]() {
         TRACE_EVENT0("flutter", "ShellSetupGPUSubsystem");
         std::unique_ptr<Rasterizer> rasterizer(on_create_rasterizer(*shell));
+        if (shell->GetSettings().raster_cache_background_rasterization) {
+          auto& raster_cache = rasterizer->compositor_context()->raster_cache();
+          raster_cache.SetBackgroundTaskRunner(
+              shell->GetDartVM()->GetConcurrentWorkerTaskRunner());
+          raster_cache.SetUseDeferredDisplayLists(
+              shell->GetSettings().raster_cache_deferred_display_lists);
+        }
         snapshot_delegate_promise.set_value(rasterizer->GetSnapshotDelegate());
         rasterizer_promise.set_value(std::move(rasterizer));
       });
 
   // Create the platform view on the platform thread (this thread).
-  auto platform_view = on_create_platform_view(*shell.get());
-  if (!platform_view || !platform_view->GetWeakPtr()) {
-    return nullptr;
-  }
+  std::unique_ptr<PlatformView> platform_view;
+  std::unique_ptr<VsyncWaiter> vsync_waiter;
+  {
+    TRACE_EVENT0("flutter", "ShellSetupPlatformSubsystem");
+    platform_view = on_create_platform_view(*shell.get());
+    if (!platform_view || !platform_view->GetWeakPtr()) {
+      return nullptr;
+    }
 
-  // Ask the platform view for the vsync waiter. This will be used by the engine
-  // to create the animator.
-  auto vsync_waiter = platform_view->CreateVSyncWaiter();
-  if (!vsync_waiter) {
-    return nullptr;
+    // Ask the platform view for the vsync waiter. This will be used by the
+    // engine to create the animator.
+    vsync_waiter = platform_view->CreateVSyncWaiter();
+    if (!vsync_waiter) {
+      return nullptr;
+    }
   }
 
   // Create the IO manager on the IO thread. The IO manager must be initialized
@@ -285,26 +314,73 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
         // from the platform.
         auto animator = std::make_unique<Animator>(*shell, task_runners,
                                                    std::move(vsync_waiter));
+        animator->SetDropStaleFrames(shell->GetSettings().drop_stale_frames);
+        animator->SetPredictiveFrameScheduling(
+            shell->GetSettings().predictive_frame_scheduling);
+
+        fml::WeakPtr<ShellIOManager> weak_io_manager;
+        fml::RefPtr<SkiaUnrefQueue> unref_queue;
+        fml::TaskRunnerAffineWeakPtr<SnapshotDelegate> snapshot_delegate;
+        {
+          TRACE_EVENT0("flutter", "ShellWaitForEngineDependencies");
+          weak_io_manager = weak_io_manager_future.get();
+          unref_queue = unref_queue_future.get();
+          snapshot_delegate = snapshot_delegate_future.get();
+        }
 
-        engine_promise.set_value(
-            on_create_engine(*shell,                          //
-                             dispatcher_maker,                //
-                             *shell->GetDartVM(),             //
-                             std::move(isolate_snapshot),     //
-                             task_runners,                    //
-                             platform_data,                   //
-                             shell->GetSettings(),            //
-                             std::move(animator),             //
-                             weak_io_manager_future.get(),    //
-                             unref_queue_future.get(),        //
-                             snapshot_delegate_future.get(),  //
-                             shell->volatile_path_tracker_));
+        auto engine = on_create_engine(*shell,                        //
+                                       dispatcher_maker,              //
+                                       *shell->GetDartVM(),           //
+                                       std::move(isolate_snapshot),   //
+                                       task_runners,                  //
+                                       platform_data,                 //
+                                       shell->GetSettings(),          //
+                                       std::move(animator),           //
+                                       std::move(weak_io_manager),    //
+                                       std::move(unref_queue),        //
+                                       std::move(snapshot_delegate),  //
+                                       shell->volatile_path_tracker_);
+
+        // Set up the time-consuming default font manager right after the
+        // engine is created, while the platform thread finishes the setup of
+        // the shell.
+        if (engine && !shell->GetSettings().prefetched_default_font_manager) {
+          task_runners.GetUITaskRunner()->PostTask(
+              [engine = engine->GetWeakPtr()] {
+                if (engine) {
+                  engine->SetupDefaultFontManager();
+                }
+              });
+        }
+        engine_promise.set_value(std::move(engine));
       }));
 
-  if (!shell->Setup(std::move(platform_view),  //
-                    engine_future.get(),       //
-                    rasterizer_future.get(),   //
-                    io_manager_future.get())   //
+  // The rasterizer needs these from the platform view. Create them while the
+  // engine is being set up.
+  std::shared_ptr<ExternalViewEmbedder> external_view_embedder;
+  std::unique_ptr<SnapshotSurfaceProducer> snapshot_surface_producer;
+  {
+    TRACE_EVENT0("flutter", "ShellSetupPlatformViewEmbedder");
+    external_view_embedder = platform_view->CreateExternalViewEmbedder();
+    snapshot_surface_producer = platform_view->CreateSnapshotSurfaceProducer();
+  }
+
+  std::unique_ptr<Engine> engine;
+  std::unique_ptr<Rasterizer> rasterizer;
+  std::shared_ptr<ShellIOManager> io_manager;
+  {
+    TRACE_EVENT0("flutter", "ShellWaitForSubsystems");
+    rasterizer = rasterizer_future.get();
+    io_manager = io_manager_future.get();
+    engine = engine_future.get();
+  }
+
+  if (!shell->Setup(std::move(platform_view),              //
+                    std::move(engine),                     //
+                    std::move(rasterizer),                 //
+                    io_manager,                            //
+                    std::move(external_view_embedder),     //
+                    std::move(snapshot_surface_producer))  //
   ) {
     return nullptr;
   }
@@ -388,6 +464,7 @@ Shell::Shell(DartVMRef vm,
       vm_(std::move(vm)),
       is_gpu_disabled_sync_switch_(new fml::SyncSwitch(is_gpu_disabled)),
       volatile_path_tracker_(std::move(volatile_path_tracker)),
+      memory_pressure_registry_(std::make_unique<MemoryPressureRegistry>()),
       weak_factory_gpu_(nullptr),
       weak_factory_(this) {
   FML_CHECK(vm_) << "Must have access to VM to create a shell.";
@@ -417,6 +494,11 @@ Shell::Shell(DartVMRef vm,
       task_runners_.GetRasterTaskRunner(),
       std::bind(&Shell::OnServiceProtocolScreenshotSKP, this,
                 std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kScreenshotDisplayListExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolScreenshotDisplayList, this,
+                    std::placeholders::_1, std::placeholders::_2)};
   service_protocol_handlers_[ServiceProtocol::kRunInViewExtensionName] = {
       task_runners_.GetUITaskRunner(),
       std::bind(&Shell::OnServiceProtocolRunInView, this, std::placeholders::_1,
@@ -450,6 +532,16 @@ Shell::Shell(DartVMRef vm,
           task_runners_.GetRasterTaskRunner(),
           std::bind(&Shell::OnServiceProtocolRenderFrameWithRasterStats, this,
                     std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetLayerRasterTimingsExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetLayerRasterTimings, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetFrameTimingStatisticsExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetFrameTimingStatistics, this,
+                    std::placeholders::_1, std::placeholders::_2)};
   service_protocol_handlers_[ServiceProtocol::kReloadAssetFonts] = {
       task_runners_.GetPlatformTaskRunner(),
       std::bind(&Shell::OnServiceProtocolReloadAssetFonts, this,
@@ -551,27 +643,121 @@ std::unique_ptr<Shell> Shell::Spawn(
 }
 
 void Shell::NotifyLowMemoryWarning() const {
+  NotifyMemoryPressure(MemoryPressureLevel::kCritical);
+}
+
+void Shell::NotifyMemoryPressure(
+    MemoryPressureLevel level,
+    MemoryPressureRegistry::ReportCallback callback) const {
   auto trace_id = fml::tracing::TraceNonce();
-  TRACE_EVENT_ASYNC_BEGIN0("flutter", "Shell::NotifyLowMemoryWarning",
-                           trace_id);
+  TRACE_EVENT_ASYNC_BEGIN1("flutter", "Shell::NotifyMemoryPressure", trace_id,
+                           "level",
+                           level == MemoryPressureLevel::kCritical
+                               ? "critical"
+                               : "moderate");
+  memory_pressure_registry_->Notify(
+      level, [platform_task_runner = task_runners_.GetPlatformTaskRunner(),
+              callback = std::move(callback),
+              trace_id](const MemoryPressureReport& report) {
+        size_t freed_bytes = 0;
+        for (const auto& item : report) {
+          freed_bytes += item.second;
+        }
+        TRACE_EVENT_ASYNC_END1("flutter", "Shell::NotifyMemoryPressure",
+                               trace_id, "freed_bytes",
+                               std::to_string(freed_bytes).c_str());
+        if (callback) {
+          platform_task_runner->PostTask(
+              [callback, report]() { callback(report); });
+        }
+      });
+}
+
+MemoryPressureRegistry& Shell::GetMemoryPressureRegistry() const {
+  return *memory_pressure_registry_;
+}
+
+void Shell::RegisterMemoryPressureCaches() {
   // This does not require a current isolate but does require a running VM.
   // Since a valid shell will not be returned to the embedder without a valid
-  // DartVMRef, we can be certain that this is a safe spot to assume a VM is
-  // running.
-  ::Dart_NotifyLowMemory();
-
-  task_runners_.GetRasterTaskRunner()->PostTask(
-      [rasterizer = rasterizer_->GetWeakPtr(), trace_id = trace_id]() {
-        if (rasterizer) {
-          rasterizer->NotifyLowMemoryWarning();
+  // DartVMRef, we can be certain that it is safe to assume a VM is running.
+  memory_pressure_registry_->Register(
+      "dart", task_runners_.GetUITaskRunner(),
+      [](MemoryPressureLevel level) -> size_t {
+        if (level == MemoryPressureLevel::kCritical) {
+          ::Dart_NotifyLowMemory();
         }
-        TRACE_EVENT_ASYNC_END0("flutter", "Shell::NotifyLowMemoryWarning",
-                               trace_id);
+        return 0;
+      });
+
+  auto raster_task_runner = task_runners_.GetRasterTaskRunner();
+  memory_pressure_registry_->Register(
+      "resource_cache", raster_task_runner,
+      [rasterizer = weak_rasterizer_](MemoryPressureLevel level) {
+        return rasterizer ? rasterizer->TrimResourceCache(level) : 0;
+      });
+  memory_pressure_registry_->Register(
+      "raster_cache", raster_task_runner,
+      [rasterizer = weak_rasterizer_](MemoryPressureLevel level) {
+        return rasterizer ? rasterizer->TrimRasterCache(level) : 0;
+      });
+  memory_pressure_registry_->Register(
+      "glyph_atlas", raster_task_runner,
+      [rasterizer = weak_rasterizer_](MemoryPressureLevel level) {
+        return rasterizer ? rasterizer->TrimGlyphAtlas(level) : 0;
+      });
+  memory_pressure_registry_->Register(
+      "snapshot_texture_pool", raster_task_runner,
+      [rasterizer = weak_rasterizer_](MemoryPressureLevel level) {
+        return rasterizer ? rasterizer->TrimSnapshotTexturePool(level) : 0;
       });
   // The IO Manager uses resource cache limits of 0, so it is not necessary
   // to purge them.
 }
 
+void Shell::SetUpSnapshotTextureBudget() {
+  const size_t budget_bytes = settings_.snapshot_texture_budget_bytes;
+  if (budget_bytes == 0) {
+    return;
+  }
+  // Over the budget, the framework is sent the same message as for a low
+  // memory warning of the platform, so that it drops the images it can.
+  rapidjson::Document document;
+  document.SetObject();
+  auto& allocator = document.GetAllocator();
+  rapidjson::Value message_value;
+  message_value.SetString(kMemoryPressure, allocator);
+  document.AddMember(kTypeKey, message_value, allocator);
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  document.Accept(writer);
+  auto on_budget_exceeded = [ui_task_runner = task_runners_.GetUITaskRunner(),
+                             engine = weak_engine_,
+                             message = std::string(buffer.GetString())](
+                                size_t in_use_bytes) {
+    TRACE_EVENT_INSTANT1("flutter", "SnapshotTextureBudgetExceeded",
+                         "in_use_bytes", std::to_string(in_use_bytes).c_str());
+    ui_task_runner->PostTask([engine, message]() {
+      if (!engine) {
+        return;
+      }
+      engine->DispatchPlatformMessage(std::make_unique<PlatformMessage>(
+          kSystemChannel,
+          fml::MallocMapping::Copy(message.c_str(), message.length()),
+          nullptr));
+    });
+  };
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners_.GetRasterTaskRunner(),
+      [rasterizer = weak_rasterizer_, budget_bytes, on_budget_exceeded]() {
+        if (rasterizer) {
+          rasterizer->snapshot_texture_pool().SetBudget(budget_bytes,
+                                                        on_budget_exceeded);
+        }
+      });
+}
+
 void Shell::RunEngine(RunConfiguration run_configuration) {
   RunEngine(std::move(run_configuration), nullptr);
 }
@@ -648,7 +834,11 @@ bool Shell::IsSetup() const {
 bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
                   std::unique_ptr<Engine> engine,
                   std::unique_ptr<Rasterizer> rasterizer,
-                  const std::shared_ptr<ShellIOManager>& io_manager) {
+                  const std::shared_ptr<ShellIOManager>& io_manager,
+                  std::shared_ptr<ExternalViewEmbedder> external_view_embedder,
+                  std::unique_ptr<SnapshotSurfaceProducer>
+                      snapshot_surface_producer) {
+  TRACE_EVENT0("flutter", "Shell::Setup");
   if (is_setup_) {
     return false;
   }
@@ -671,10 +861,8 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
   io_manager_ = io_manager;
 
   // Set the external view embedder for the rasterizer.
-  auto view_embedder = platform_view_->CreateExternalViewEmbedder();
-  rasterizer_->SetExternalViewEmbedder(view_embedder);
-  rasterizer_->SetSnapshotSurfaceProducer(
-      platform_view_->CreateSnapshotSurfaceProducer());
+  rasterizer_->SetExternalViewEmbedder(external_view_embedder);
+  rasterizer_->SetSnapshotSurfaceProducer(std::move(snapshot_surface_producer));
 
   // The weak ptr must be generated in the platform thread which owns the unique
   // ptr.
@@ -682,15 +870,8 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
   weak_rasterizer_ = rasterizer_->GetWeakPtr();
   weak_platform_view_ = platform_view_->GetWeakPtr();
 
-  // Setup the time-consuming default font manager right after engine created.
-  if (!settings_.prefetched_default_font_manager) {
-    fml::TaskRunner::RunNowOrPostTask(task_runners_.GetUITaskRunner(),
-                                      [engine = weak_engine_] {
-                                        if (engine) {
-                                          engine->SetupDefaultFontManager();
-                                        }
-                                      });
-  }
+  RegisterMemoryPressureCaches();
+  SetUpSnapshotTextureBudget();
 
   is_setup_ = true;
 
@@ -959,14 +1140,28 @@ void Shell::OnPlatformViewDispatchPlatformMessage(
   FML_DCHECK(is_setup_);
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
 
-  // The static leak checker gets confused by the use of fml::MakeCopyable.
-  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
-  task_runners_.GetUITaskRunner()->PostTask(fml::MakeCopyable(
-      [engine = engine_->GetWeakPtr(), message = std::move(message)]() mutable {
+  {
+    std::scoped_lock<std::mutex> lock(pending_platform_messages_->mutex);
+    auto& messages = pending_platform_messages_->messages;
+    messages.push_back(std::move(message));
+    if (messages.size() > 1) {
+      // The task posted for the first pending message delivers this one too.
+      return;
+    }
+  }
+
+  task_runners_.GetUITaskRunner()->PostTask(
+      [engine = engine_->GetWeakPtr(), pending = pending_platform_messages_]() {
+        std::vector<std::unique_ptr<PlatformMessage>> messages;
+        {
+          std::scoped_lock<std::mutex> lock(pending->mutex);
+          messages.swap(pending->messages);
+        }
         if (engine) {
-          engine->DispatchPlatformMessage(std::move(message));
+          TRACE_EVENT0("flutter", "Shell::DispatchPendingPlatformMessages");
+          engine->DispatchPlatformMessages(std::move(messages));
         }
-      }));
+      });
 }
 
 // |PlatformView::Delegate|
@@ -976,13 +1171,14 @@ void Shell::OnPlatformViewDispatchPointerDataPacket(
   TRACE_FLOW_BEGIN("flutter", "PointerEvent", next_pointer_flow_id_);
   FML_DCHECK(is_setup_);
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
-  task_runners_.GetUITaskRunner()->PostTask(
+  task_runners_.GetUITaskRunner()->PostTaskWithGrade(
       fml::MakeCopyable([engine = weak_engine_, packet = std::move(packet),
                          flow_id = next_pointer_flow_id_]() mutable {
         if (engine) {
           engine->DispatchPointerDataPacket(std::move(packet), flow_id);
         }
-      }));
+      }),
+      fml::TaskSourceGrade::kUserInteraction);
   next_pointer_flow_id_++;
 }
 
@@ -1125,12 +1321,12 @@ void Shell::OnAnimatorBeginFrame(fml::TimePoint frame_target_time,
 }
 
 // |Animator::Delegate|
-void Shell::OnAnimatorNotifyIdle(fml::TimePoint deadline) {
+void Shell::OnAnimatorNotifyIdle(const IdleNotification& notification) {
   FML_DCHECK(is_setup_);
   FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
 
   if (engine_) {
-    engine_->NotifyIdle(deadline);
+    engine_->NotifyIdle(notification);
     volatile_path_tracker_->OnFrame();
   }
 }
@@ -1160,7 +1356,9 @@ void Shell::OnAnimatorDraw(std::shared_ptr<LayerTreePipeline> pipeline) {
            tree.frame_size() != expected_frame_size_;
   };
 
-  task_runners_.GetRasterTaskRunner()->PostTask(fml::MakeCopyable(
+  // A frame is waiting for the draw, so embedders that schedule tasks by
+  // grade must not let it wait behind less important work.
+  auto draw_task = fml::MakeCopyable(
       [&waiting_for_first_frame = waiting_for_first_frame_,
        &waiting_for_first_frame_condition = waiting_for_first_frame_condition_,
        rasterizer = rasterizer_->GetWeakPtr(),
@@ -1177,7 +1375,9 @@ void Shell::OnAnimatorDraw(std::shared_ptr<LayerTreePipeline> pipeline) {
             waiting_for_first_frame_condition.notify_all();
           }
         }
-      }));
+      });
+  task_runners_.GetRasterTaskRunner()->PostTaskWithGrade(
+      draw_task, fml::TaskSourceGrade::kUserInteraction);
 }
 
 // |Animator::Delegate|
@@ -1413,6 +1613,40 @@ void Shell::RequestDartDeferredLibrary(intptr_t loading_unit_id) {
       });
 }
 
+void Shell::RecordSnapshotPrefetchProfile() {
+  static std::atomic_bool recorded = false;
+  if (recorded.exchange(true)) {
+    return;
+  }
+  vm_->GetConcurrentWorkerTaskRunner()->PostTask(
+      [path = settings_.snapshot_prefetch_profile_path,
+       vm_data = vm_->GetVMData()]() {
+        DartSnapshotProfile::Record(path, *vm_data);
+      });
+}
+
+void Shell::RecordAssetPrefetchProfile() {
+  static std::atomic_bool recorded = false;
+  if (recorded.exchange(true)) {
+    return;
+  }
+  task_runners_.GetUITaskRunner()->PostTask(
+      [engine = weak_engine_, path = settings_.asset_prefetch_profile_path,
+       worker_task_runner = vm_->GetConcurrentWorkerTaskRunner()]() {
+        if (!engine || !engine->GetAssetManager()) {
+          return;
+        }
+        auto asset_names = engine->GetAssetManager()->StopRecordingAccesses();
+        if (asset_names.empty()) {
+          return;
+        }
+        worker_task_runner->PostTask(
+            [path, asset_names = std::move(asset_names)]() {
+              AssetAccessProfile::Write(path, asset_names);
+            });
+      });
+}
+
 void Shell::ReportTimings() {
   FML_DCHECK(is_setup_);
   FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
@@ -1443,6 +1677,9 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
     settings_.frame_rasterized_callback(timing);
   }
 
+  frame_timing_statistics_.Add(
+      timing, fml::TimeDelta::FromMillisecondsF(GetFrameBudget().count()));
+
   if (!needs_report_timings_) {
     return;
   }
@@ -1473,6 +1710,20 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
   // require a latency of no more than 100ms. Hence we lower that 1-second
   // threshold to 100ms because performance overhead isn't that critical in
   // those cases.
+  if (!first_frame_rasterized_ &&
+      !settings_.snapshot_prefetch_profile_path.empty()) {
+    RecordSnapshotPrefetchProfile();
+  }
+
+  if (!first_frame_rasterized_ &&
+      !settings_.asset_prefetch_profile_path.empty()) {
+    RecordAssetPrefetchProfile();
+  }
+
+  if (!first_frame_rasterized_ && settings_.defer_vm_service_startup) {
+    DartServiceIsolate::AllowDeferredStartup();
+  }
+
   if (!first_frame_rasterized_ || UnreportedFramesCount() >= 100) {
     first_frame_rasterized_ = true;
     ReportTimings();
@@ -1501,6 +1752,32 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
   }
 }
 
+FrameTimingStatistics Shell::GetFrameTimingStatistics(bool reset) {
+  return reset ? frame_timing_statistics_.TakeStatistics()
+               : frame_timing_statistics_.GetStatistics();
+}
+
+void Shell::OnFramePresented(uint64_t frame_number,
+                             fml::TimePoint presentation_time) {
+  const std::optional<fml::TimeDelta> latency =
+      frame_timing_statistics_.AddPresentation(
+          frame_number, presentation_time,
+          fml::TimeDelta::FromMillisecondsF(GetFrameBudget().count()));
+  if (!latency.has_value()) {
+    return;
+  }
+  FML_TRACE_COUNTER("flutter", "FramePresentationLatency",
+                    reinterpret_cast<int64_t>(this), "LatencyMicros",
+                    latency->ToMicroseconds());
+
+  task_runners_.GetUITaskRunner()->PostTask(
+      [engine = weak_engine_, presentation_time]() {
+        if (engine) {
+          engine->NotifyFramePresented(presentation_time);
+        }
+      });
+}
+
 fml::Milliseconds Shell::GetFrameBudget() {
   double display_refresh_rate = display_manager_->GetMainDisplayRefreshRate();
   if (display_refresh_rate > 0) {
@@ -1620,6 +1897,29 @@ bool Shell::OnServiceProtocolScreenshotSKP(
   return false;
 }
 
+// Service protocol handler
+bool Shell::OnServiceProtocolScreenshotDisplayList(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  auto screenshot = rasterizer_->ScreenshotLastLayerTree(
+      Rasterizer::ScreenshotType::DisplayListCapture, true);
+  if (screenshot.data) {
+    response->SetObject();
+    auto& allocator = response->GetAllocator();
+    response->AddMember("type", "ScreenshotDisplayList", allocator);
+    rapidjson::Value capture;
+    capture.SetString(static_cast<const char*>(screenshot.data->data()),
+                      screenshot.data->size(), allocator);
+    response->AddMember("capture", capture, allocator);
+    return true;
+  }
+  ServiceProtocolFailureError(response,
+                              "Could not capture the display list of the "
+                              "last frame.");
+  return false;
+}
+
 // Service protocol handler
 bool Shell::OnServiceProtocolRunInView(
     const ServiceProtocol::Handler::ServiceProtocolMap& params,
@@ -1925,6 +2225,93 @@ bool Shell::OnServiceProtocolRenderFrameWithRasterStats(
   }
 }
 
+bool Shell::OnServiceProtocolGetLayerRasterTimings(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+
+  LayerRasterTimingStore& store =
+      rasterizer_->compositor_context()->layer_raster_timing_store();
+
+  auto& allocator = response->GetAllocator();
+  rapidjson::Value timings;
+  timings.SetArray();
+  for (const LayerRasterTiming& timing : store.GetTimings()) {
+    rapidjson::Value value;
+    value.SetObject();
+    value.AddMember("layer_unique_id", timing.layer_unique_id, allocator);
+    value.AddMember("frame_number", timing.frame_number, allocator);
+    value.AddMember("duration_micros", timing.duration.ToMicroseconds(),
+                    allocator);
+    timings.PushBack(value, allocator);
+  }
+  store.Clear();
+
+  auto enabled = params.find("enabled");
+  if (enabled != params.end()) {
+    store.SetEnabled(enabled->second == "true");
+  }
+
+  response->SetObject();
+  response->AddMember("type", "LayerRasterTimings", allocator);
+  response->AddMember("enabled", store.IsEnabled(), allocator);
+  response->AddMember("timings", timings, allocator);
+  return true;
+}
+
+static rapidjson::Value SerializeFrameDurationPercentiles(
+    const FrameDurationPercentiles& percentiles,
+    rapidjson::Document* response) {
+  auto& allocator = response->GetAllocator();
+  rapidjson::Value result;
+  result.SetObject();
+  result.AddMember("p50_micros", percentiles.p50.ToMicroseconds(), allocator);
+  result.AddMember("p90_micros", percentiles.p90.ToMicroseconds(), allocator);
+  result.AddMember("p99_micros", percentiles.p99.ToMicroseconds(), allocator);
+  result.AddMember("max_micros", percentiles.max.ToMicroseconds(), allocator);
+  return result;
+}
+
+bool Shell::OnServiceProtocolGetFrameTimingStatistics(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document* response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+
+  auto reset = params.find("reset");
+  const FrameTimingStatistics statistics = GetFrameTimingStatistics(
+      reset != params.end() && reset->second == "true");
+
+  auto& allocator = response->GetAllocator();
+  response->SetObject();
+  response->AddMember("type", "FrameTimingStatistics", allocator);
+  response->AddMember("frame_count",
+                      static_cast<uint64_t>(statistics.frame_count), allocator);
+  response->AddMember("vsync_overrun_count",
+                      static_cast<uint64_t>(statistics.vsync_overrun_count),
+                      allocator);
+  response->AddMember(
+      "build", SerializeFrameDurationPercentiles(statistics.build, response),
+      allocator);
+  response->AddMember(
+      "raster", SerializeFrameDurationPercentiles(statistics.raster, response),
+      allocator);
+  response->AddMember(
+      "raster_gpu",
+      SerializeFrameDurationPercentiles(statistics.raster_gpu, response),
+      allocator);
+  response->AddMember("presented_frame_count",
+                      static_cast<uint64_t>(statistics.presented_frame_count),
+                      allocator);
+  response->AddMember(
+      "missed_presentation_count",
+      static_cast<uint64_t>(statistics.missed_presentation_count), allocator);
+  response->AddMember("presentation_latency",
+                      SerializeFrameDurationPercentiles(
+                          statistics.presentation_latency, response),
+                      allocator);
+  return true;
+}
+
 void Shell::SendFontChangeNotification() {
   // After system fonts are reloaded, we send a system channel message
   // to notify flutter framework.
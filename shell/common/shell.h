@@ -36,6 +36,7 @@
 #include "flutter/shell/common/animator.h"
 #include "flutter/shell/common/display_manager.h"
 #include "flutter/shell/common/engine.h"
+#include "flutter/shell/common/memory_pressure.h"
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/resource_cache_limit_calculator.h"
@@ -281,10 +282,31 @@ class Shell final : public PlatformView::Delegate,
 
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to notify that there is a low memory
-  ///             warning. The shell will attempt to purge caches. Current, only
-  ///             the rasterizer cache is purged.
+  ///             warning. This is equivalent to notifying critical memory
+  ///             pressure.
   void NotifyLowMemoryWarning() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Used by embedders to notify memory pressure. The caches of
+  ///             the shell subsystems are trimmed on their task runners
+  ///             according to the severity of the pressure.
+  ///
+  /// @param[in]  level     The severity of the memory pressure.
+  /// @param[in]  callback  Invoked on the platform task runner with the
+  ///                       bytes freed by each subsystem once all of them
+  ///                       have been trimmed. May be null.
+  ///
+  void NotifyMemoryPressure(
+      MemoryPressureLevel level,
+      MemoryPressureRegistry::ReportCallback callback = nullptr) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The registry that the caches which are trimmed by
+  ///             |NotifyMemoryPressure| register with. Embedders may
+  ///             register their own caches.
+  ///
+  MemoryPressureRegistry& GetMemoryPressureRegistry() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to check if all shell subcomponents are
   ///             initialized. It is the embedder's responsibility to make this
@@ -325,6 +347,32 @@ class Shell final : public PlatformView::Delegate,
   ///
   fml::Status WaitForFirstFrame(fml::TimeDelta timeout);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Gets the aggregated timings of the frames rasterized since
+  ///             the statistics were last reset. Unlike the timings reported
+  ///             to Dart, these are always collected. This can be called from
+  ///             any thread.
+  ///
+  /// @param[in]  reset  Whether the statistics should be reset once read.
+  ///
+  /// @return     The frame timing statistics.
+  ///
+  FrameTimingStatistics GetFrameTimingStatistics(bool reset);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Used by embedders to report when a frame was displayed. The
+  ///             latency of the frame is added to the frame timing
+  ///             statistics and the animator realigns its frame schedule to
+  ///             the presentation. This can be called from any thread.
+  ///
+  /// @param[in]  frame_number       The number of the frame, as assigned by
+  ///                                its `FrameTimingsRecorder`.
+  /// @param[in]  presentation_time  The time at which the frame started to
+  ///                                be displayed.
+  ///
+  void OnFramePresented(uint64_t frame_number,
+                        fml::TimePoint presentation_time);
+
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to reload the system fonts in
   ///             FontCollection.
@@ -425,6 +473,7 @@ class Shell final : public PlatformView::Delegate,
   std::shared_ptr<VolatilePathTracker> volatile_path_tracker_;
   std::shared_ptr<PlatformMessageHandler> platform_message_handler_;
   std::atomic<bool> route_messages_through_platform_thread_ = false;
+  std::unique_ptr<MemoryPressureRegistry> memory_pressure_registry_;
 
   fml::WeakPtr<Engine> weak_engine_;  // to be shared across threads
   fml::TaskRunnerAffineWeakPtr<Rasterizer>
@@ -460,10 +509,24 @@ class Shell final : public PlatformView::Delegate,
   // here for easier conversions to Dart objects.
   std::vector<int64_t> unreported_timings_;
 
+  // Aggregates the timings of every rasterized frame. Written on the raster
+  // thread and read from any thread.
+  FrameTimingStatisticsCollector frame_timing_statistics_;
+
   /// Manages the displays. This class is thread safe, can be accessed from any
   /// of the threads.
   std::unique_ptr<DisplayManager> display_manager_;
 
+  // Platform messages that wait for the UI task posted for the first of them.
+  // Messages that arrive before that task runs join it, so that a burst of
+  // messages enters the root isolate once. Shared with the posted task.
+  struct PendingPlatformMessages {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<PlatformMessage>> messages;
+  };
+  std::shared_ptr<PendingPlatformMessages> pending_platform_messages_ =
+      std::make_shared<PendingPlatformMessages>();
+
   // protects expected_frame_size_ which is set on platform thread and read on
   // raster thread
   std::mutex resize_mutex_;
@@ -519,10 +582,29 @@ class Shell final : public PlatformView::Delegate,
   bool Setup(std::unique_ptr<PlatformView> platform_view,
              std::unique_ptr<Engine> engine,
              std::unique_ptr<Rasterizer> rasterizer,
-             const std::shared_ptr<ShellIOManager>& io_manager);
+             const std::shared_ptr<ShellIOManager>& io_manager,
+             std::shared_ptr<ExternalViewEmbedder> external_view_embedder,
+             std::unique_ptr<SnapshotSurfaceProducer>
+                 snapshot_surface_producer);
+
+  void RegisterMemoryPressureCaches();
+
+  // Makes the rasterizer notify the framework of memory pressure when the
+  // textures of snapshot images exceed the configured budget.
+  void SetUpSnapshotTextureBudget();
 
   void ReportTimings();
 
+  // Records the snapshot pages used to render the first frame so that later
+  // launches can prefetch them. Only the first shell of the process records
+  // the profile.
+  void RecordSnapshotPrefetchProfile();
+
+  // Writes the assets loaded before the first frame to the asset prefetch
+  // profile, if the engine recorded them. Only the first shell of the process
+  // records the profile.
+  void RecordAssetPrefetchProfile();
+
   // |PlatformView::Delegate|
   void OnPlatformViewCreated(std::unique_ptr<Surface> surface) override;
 
@@ -591,7 +673,7 @@ class Shell final : public PlatformView::Delegate,
                             uint64_t frame_number) override;
 
   // |Animator::Delegate|
-  void OnAnimatorNotifyIdle(fml::TimePoint deadline) override;
+  void OnAnimatorNotifyIdle(const IdleNotification& notification) override;
 
   // |Animator::Delegate|
   void OnAnimatorUpdateLatestFrameTargetTime(
@@ -671,6 +753,14 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // Captures the last layer tree and its display lists for offline replay,
+  // see |DisplayListCapture|.
+  bool OnServiceProtocolScreenshotDisplayList(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
   // Service protocol handler
   bool OnServiceProtocolRunInView(
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
@@ -712,6 +802,24 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document* response);
 
+  // Service protocol handler
+  //
+  // Responds with the time taken to raster every leaf layer in the frames
+  // rendered since the last call, and clears them. The optional "enabled"
+  // parameter starts or stops the collection of these timings.
+  bool OnServiceProtocolGetLayerRasterTimings(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
+  // Service protocol handler
+  //
+  // Responds with the percentiles of the build, raster and GPU times and the
+  // number of vsync overruns of the frames rasterized since the statistics
+  // were last reset. The optional "reset" parameter resets them.
+  bool OnServiceProtocolGetFrameTimingStatistics(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document* response);
+
   // Service protocol handler
   //
   // Forces the FontCollection to reload the font manifest. Used to support hot
@@ -5,14 +5,52 @@
 #include "flutter/shell/common/shell.h"
 
 #include "flutter/benchmarking/benchmarking.h"
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/flow/compositor_context.h"
+#include "flutter/flow/layers/display_list_layer.h"
+#include "flutter/flow/layers/layer_tree.h"
+#include "flutter/flow/layers/platform_view_layer.h"
+#include "flutter/flow/layers/transform_layer.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/runtime/dart_vm.h"
+#include "flutter/shell/common/shell_test.h"
+#include "flutter/shell/common/shell_test_external_view_embedder.h"
+#include "flutter/shell/common/shell_test_platform_view.h"
 #include "flutter/shell/common/thread_host.h"
+#include "flutter/shell/common/vsync_waiter_fallback.h"
 #include "flutter/testing/elf_loader.h"
 #include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkFont.h"
+#include "third_party/skia/include/core/SkSurface.h"
+#include "third_party/skia/include/core/SkTextBlob.h"
 
 namespace flutter {
 
+static Settings CreateSettingsForFixtures(
+    const fml::UniqueFD& assets_dir,
+    testing::ELFAOTSymbols& aot_symbols) {
+  Settings settings = {};
+  settings.task_observer_add = [](intptr_t, const fml::closure&) {};
+  settings.task_observer_remove = [](intptr_t) {};
+
+  if (DartVM::IsRunningPrecompiledCode()) {
+    aot_symbols = testing::LoadELFSymbolFromFixturesIfNeccessary(
+        testing::kDefaultAOTAppELFFileName);
+    FML_CHECK(testing::PrepareSettingsForAOTWithSymbols(settings, aot_symbols))
+        << "Could not set up settings with AOT symbols.";
+  } else {
+    settings.application_kernels = [&assets_dir]() {
+      std::vector<std::unique_ptr<const fml::Mapping>> kernel_mappings;
+      kernel_mappings.emplace_back(
+          fml::FileMapping::CreateReadOnly(assets_dir, "kernel_blob.bin"));
+      return kernel_mappings;
+    };
+  }
+  return settings;
+}
+
 static void StartupAndShutdownShell(benchmark::State& state,
                                     bool measure_startup,
                                     bool measure_shutdown) {
@@ -24,24 +62,7 @@ static void StartupAndShutdownShell(benchmark::State& state,
 
   {
     benchmarking::ScopedPauseTiming pause(state, !measure_startup);
-    Settings settings = {};
-    settings.task_observer_add = [](intptr_t, const fml::closure&) {};
-    settings.task_observer_remove = [](intptr_t) {};
-
-    if (DartVM::IsRunningPrecompiledCode()) {
-      aot_symbols = testing::LoadELFSymbolFromFixturesIfNeccessary(
-          testing::kDefaultAOTAppELFFileName);
-      FML_CHECK(
-          testing::PrepareSettingsForAOTWithSymbols(settings, aot_symbols))
-          << "Could not set up settings with AOT symbols.";
-    } else {
-      settings.application_kernels = [&]() {
-        std::vector<std::unique_ptr<const fml::Mapping>> kernel_mappings;
-        kernel_mappings.emplace_back(
-            fml::FileMapping::CreateReadOnly(assets_dir, "kernel_blob.bin"));
-        return kernel_mappings;
-      };
-    }
+    Settings settings = CreateSettingsForFixtures(assets_dir, aot_symbols);
 
     thread_host = std::make_unique<ThreadHost>(ThreadHost::ThreadHostConfig(
         "io.flutter.bench.", ThreadHost::Type::Platform |
@@ -120,4 +141,481 @@ static void BM_ShellInitializationAndShutdown(benchmark::State& state) {
 
 BENCHMARK(BM_ShellInitializationAndShutdown);
 
+// Measures the time from the start of the shell setup until the first frame
+// of the root isolate has been rasterized.
+static void BM_ShellTimeToFirstFrame(benchmark::State& state) {
+  auto assets_dir = fml::OpenDirectory(testing::GetFixturesPath(), false,
+                                       fml::FilePermission::kRead);
+  testing::ELFAOTSymbols aot_symbols;
+
+  while (state.KeepRunning()) {
+    std::unique_ptr<Shell> shell;
+    std::unique_ptr<ThreadHost> thread_host;
+    Settings settings;
+    fml::AutoResetWaitableEvent first_frame_latch;
+
+    {
+      benchmarking::ScopedPauseTiming pause(state, true);
+      settings = CreateSettingsForFixtures(assets_dir, aot_symbols);
+      settings.frame_rasterized_callback =
+          [&first_frame_latch](const FrameTiming& timing) {
+            first_frame_latch.Signal();
+          };
+      thread_host = std::make_unique<ThreadHost>(ThreadHost::ThreadHostConfig(
+          "io.flutter.bench.",
+          ThreadHost::Type::Platform | ThreadHost::Type::RASTER |
+              ThreadHost::Type::IO | ThreadHost::Type::UI));
+    }
+
+    TaskRunners task_runners("test",
+                             thread_host->platform_thread->GetTaskRunner(),
+                             thread_host->raster_thread->GetTaskRunner(),
+                             thread_host->ui_thread->GetTaskRunner(),
+                             thread_host->io_thread->GetTaskRunner());
+
+    auto vsync_clock = std::make_shared<testing::ShellTestVsyncClock>();
+    testing::CreateVsyncWaiter create_vsync_waiter = [task_runners]() {
+      return static_cast<std::unique_ptr<VsyncWaiter>>(
+          std::make_unique<VsyncWaiterFallback>(task_runners, true));
+    };
+    shell = Shell::Create(
+        flutter::PlatformData(), task_runners, settings,
+        [&vsync_clock, &create_vsync_waiter](Shell& shell) {
+          return testing::ShellTestPlatformView::Create(
+              shell, shell.GetTaskRunners(), vsync_clock, create_vsync_waiter,
+              testing::ShellTestPlatformView::BackendType::kDefaultBackend,
+              nullptr);
+        },
+        [](Shell& shell) { return std::make_unique<Rasterizer>(shell); });
+    FML_CHECK(shell);
+
+    auto configuration = RunConfiguration::InferFromSettings(settings);
+    configuration.SetEntrypoint("scene_with_red_box");
+    fml::TaskRunner::RunNowOrPostTask(
+        task_runners.GetPlatformTaskRunner(),
+        fml::MakeCopyable([shell = shell.get(),
+                           configuration = std::move(configuration)]() mutable {
+          shell->GetPlatformView()->NotifyCreated();
+          shell->RunEngine(std::move(configuration));
+        }));
+    first_frame_latch.Wait();
+
+    {
+      benchmarking::ScopedPauseTiming pause(state, true);
+      fml::AutoResetWaitableEvent latch;
+      fml::TaskRunner::RunNowOrPostTask(
+          thread_host->platform_thread->GetTaskRunner(),
+          [&shell, &latch]() mutable {
+            shell.reset();
+            latch.Signal();
+          });
+      latch.Wait();
+      thread_host.reset();
+    }
+  }
+}
+
+BENCHMARK(BM_ShellTimeToFirstFrame)->Unit(benchmark::kMillisecond);
+
+// The canned scenes that the frame benchmarks render.
+enum class FrameScene {
+  // A list of rows that scrolls by a few pixels every frame.
+  kScrollingList,
+  // A grid of complex pictures that are drawn from the raster cache.
+  kRasterCachedPictures,
+  // Rows that are interleaved with platform views.
+  kPlatformViews,
+  // Blocks of text with a line that changes every frame.
+  kText,
+};
+
+// Adds the layers of frame |frame| of a scene to |root|.
+using FrameSceneBuilder = std::function<void(ContainerLayer* root, int frame)>;
+
+constexpr int kFrameWidth = 800;
+constexpr int kFrameHeight = 1200;
+constexpr int kListRowCount = 100;
+constexpr int kListRowHeight = 72;
+constexpr int kPictureTileSize = 200;
+constexpr int kTextLineCount = 20;
+constexpr int kTextLineHeight = 18;
+
+// Covers the raster cache access threshold, so that the measured frames draw
+// the cached pictures.
+constexpr int kWarmUpFrameCount = 5;
+
+static std::shared_ptr<DisplayListLayer> MakeDisplayListLayer(
+    const SkPoint& offset,
+    sk_sp<DisplayList> display_list,
+    const fml::RefPtr<SkiaUnrefQueue>& unref_queue,
+    bool is_complex = false) {
+  return std::make_shared<DisplayListLayer>(
+      offset,
+      SkiaGPUObject<DisplayList>({std::move(display_list), unref_queue}),
+      is_complex, false);
+}
+
+static sk_sp<DisplayList> MakeListRow(int index) {
+  DisplayListBuilder builder(SkRect::MakeWH(kFrameWidth, kListRowHeight));
+  builder.drawRect(SkRect::MakeWH(kFrameWidth, kListRowHeight),
+                   DlPaint().setColor(index % 2 ? DlColor(0xFFF5F5F5)
+                                                : DlColor::kWhite()));
+  builder.drawCircle(SkPoint::Make(kListRowHeight / 2, kListRowHeight / 2),
+                     kListRowHeight / 3,
+                     DlPaint().setColor(DlColor::kBlue()).setAntiAlias(true));
+  builder.drawRRect(
+      SkRRect::MakeRectXY(SkRect::MakeXYWH(kListRowHeight, 20,
+                                           kFrameWidth - 2 * kListRowHeight,
+                                           12),
+                          6, 6),
+      DlPaint().setColor(DlColor(0xFF757575)).setAntiAlias(true));
+  builder.drawRRect(
+      SkRRect::MakeRectXY(
+          SkRect::MakeXYWH(kListRowHeight, 40, kFrameWidth / 2, 10), 5, 5),
+      DlPaint().setColor(DlColor(0xFFBDBDBD)).setAntiAlias(true));
+  return builder.Build();
+}
+
+static sk_sp<DisplayList> MakeComplexPicture(int seed) {
+  DisplayListBuilder builder(SkRect::MakeWH(kPictureTileSize,
+                                            kPictureTileSize));
+  DlPaint paint;
+  paint.setAntiAlias(true);
+  for (int i = 0; i < 100; i++) {
+    float x = (seed * 31 + i * 17) % kPictureTileSize;
+    float y = (seed * 13 + i * 29) % kPictureTileSize;
+    SkPath path;
+    path.moveTo(x, y);
+    path.cubicTo(kPictureTileSize - y, x, y, kPictureTileSize - x,
+                 kPictureTileSize - x, kPictureTileSize - y);
+    path.close();
+    paint.setColor(DlColor(0x80000000 | ((seed * 977 + i * 7919) & 0xFFFFFF)));
+    builder.drawPath(path, paint);
+  }
+  return builder.Build();
+}
+
+static sk_sp<DisplayList> MakeTextBlock(int first_line, int line_count) {
+  DisplayListBuilder builder(
+      SkRect::MakeWH(kFrameWidth, line_count * kTextLineHeight));
+  SkFont font(nullptr, 14);
+  DlPaint paint;
+  for (int i = 0; i < line_count; i++) {
+    std::string line = "Line " + std::to_string(first_line + i) +
+                       ": The quick brown fox jumps over the lazy dog.";
+    builder.drawTextBlob(SkTextBlob::MakeFromString(line.c_str(), font), 8,
+                         (i + 1) * kTextLineHeight - 4, paint);
+  }
+  return builder.Build();
+}
+
+static FrameSceneBuilder MakeFrameScene(
+    FrameScene scene,
+    const fml::RefPtr<SkiaUnrefQueue>& unref_queue) {
+  switch (scene) {
+    case FrameScene::kScrollingList:
+    case FrameScene::kPlatformViews: {
+      std::vector<sk_sp<DisplayList>> rows;
+      for (int i = 0; i < kListRowCount; i++) {
+        rows.push_back(MakeListRow(i));
+      }
+      bool platform_views = scene == FrameScene::kPlatformViews;
+      return [rows, platform_views, unref_queue](ContainerLayer* root,
+                                                 int frame) {
+        const int scroll_extent = kListRowCount * kListRowHeight - kFrameHeight;
+        const int offset = (frame * 8) % scroll_extent;
+        auto scroll = std::make_shared<TransformLayer>(
+            SkMatrix::Translate(0, -offset));
+        for (int i = 0; i < kListRowCount; i++) {
+          const int top = i * kListRowHeight;
+          if (top + kListRowHeight < offset || top > offset + kFrameHeight) {
+            continue;
+          }
+          if (platform_views && i % 5 == 0) {
+            scroll->Add(std::make_shared<PlatformViewLayer>(
+                SkPoint::Make(0, top),
+                SkSize::Make(kFrameWidth, kListRowHeight), i));
+          } else {
+            scroll->Add(MakeDisplayListLayer(SkPoint::Make(0, top), rows[i],
+                                             unref_queue));
+          }
+        }
+        root->Add(scroll);
+      };
+    }
+    case FrameScene::kRasterCachedPictures: {
+      std::vector<sk_sp<DisplayList>> pictures;
+      for (int i = 0; i < 24; i++) {
+        pictures.push_back(MakeComplexPicture(i));
+      }
+      return [pictures, unref_queue](ContainerLayer* root, int frame) {
+        auto scroll = std::make_shared<TransformLayer>(
+            SkMatrix::Translate(0, -((frame * 2) % kPictureTileSize)));
+        for (size_t i = 0; i < pictures.size(); i++) {
+          SkPoint offset = SkPoint::Make((i % 4) * kPictureTileSize,
+                                         (i / 4) * kPictureTileSize);
+          scroll->Add(
+              MakeDisplayListLayer(offset, pictures[i], unref_queue, true));
+        }
+        root->Add(scroll);
+      };
+    }
+    case FrameScene::kText: {
+      std::vector<sk_sp<DisplayList>> blocks;
+      for (int i = 0; i < kFrameHeight / (kTextLineCount * kTextLineHeight);
+           i++) {
+        blocks.push_back(MakeTextBlock(i * kTextLineCount, kTextLineCount));
+      }
+      return [blocks, unref_queue](ContainerLayer* root, int frame) {
+        for (size_t i = 0; i < blocks.size(); i++) {
+          root->Add(MakeDisplayListLayer(
+              SkPoint::Make(0, i * kTextLineCount * kTextLineHeight),
+              blocks[i], unref_queue));
+        }
+        // The text of the last line is laid out again in every frame.
+        root->Add(MakeDisplayListLayer(
+            SkPoint::Make(0, kFrameHeight - kTextLineHeight),
+            MakeTextBlock(frame, 1), unref_queue));
+      };
+    }
+  }
+  FML_UNREACHABLE();
+}
+
+// A shell with a rendering backend that draws the frames of a scene.
+class FrameBenchmarkShell {
+ public:
+  FrameBenchmarkShell(testing::ShellTestPlatformView::BackendType backend,
+                      bool with_platform_views)
+      : assets_dir_(fml::OpenDirectory(testing::GetFixturesPath(),
+                                       false,
+                                       fml::FilePermission::kRead)) {
+    Settings settings = CreateSettingsForFixtures(assets_dir_, aot_symbols_);
+    settings.frame_rasterized_callback = [this](const FrameTiming& timing) {
+      last_frame_timing_ = timing;
+      frame_latch_.Signal();
+    };
+    thread_host_ = std::make_unique<ThreadHost>(ThreadHost::ThreadHostConfig(
+        "io.flutter.bench.", ThreadHost::Type::Platform |
+                                 ThreadHost::Type::RASTER |
+                                 ThreadHost::Type::IO | ThreadHost::Type::UI));
+    TaskRunners task_runners("test",
+                             thread_host_->platform_thread->GetTaskRunner(),
+                             thread_host_->raster_thread->GetTaskRunner(),
+                             thread_host_->ui_thread->GetTaskRunner(),
+                             thread_host_->io_thread->GetTaskRunner());
+    unref_queue_ = fml::MakeRefCounted<SkiaUnrefQueue>(
+        task_runners.GetIOTaskRunner(), fml::TimeDelta::Zero());
+
+    std::shared_ptr<testing::ShellTestExternalViewEmbedder> view_embedder;
+    if (with_platform_views) {
+      view_embedder = std::make_shared<testing::ShellTestExternalViewEmbedder>(
+          [](bool, fml::RefPtr<fml::RasterThreadMerger>) {},
+          PostPrerollResult::kSuccess, false);
+    }
+    auto vsync_clock = std::make_shared<testing::ShellTestVsyncClock>();
+    testing::CreateVsyncWaiter create_vsync_waiter = [task_runners]() {
+      return static_cast<std::unique_ptr<VsyncWaiter>>(
+          std::make_unique<VsyncWaiterFallback>(task_runners, true));
+    };
+    shell_ = Shell::Create(
+        flutter::PlatformData(), task_runners, settings,
+        [vsync_clock, create_vsync_waiter, backend,
+         view_embedder](Shell& shell) {
+          return testing::ShellTestPlatformView::Create(
+              shell, shell.GetTaskRunners(), vsync_clock, create_vsync_waiter,
+              backend, view_embedder);
+        },
+        [](Shell& shell) { return std::make_unique<Rasterizer>(shell); });
+    FML_CHECK(shell_);
+
+    testing::ShellTest::PlatformViewNotifyCreated(shell_.get());
+    auto configuration = RunConfiguration::InferFromSettings(settings);
+    configuration.SetEntrypoint("emptyMain");
+    testing::ShellTest::RunEngine(shell_.get(), std::move(configuration));
+  }
+
+  ~FrameBenchmarkShell() {
+    fml::AutoResetWaitableEvent latch;
+    fml::TaskRunner::RunNowOrPostTask(
+        thread_host_->platform_thread->GetTaskRunner(), [this, &latch]() {
+          shell_.reset();
+          latch.Signal();
+        });
+    latch.Wait();
+    thread_host_.reset();
+  }
+
+  const fml::RefPtr<SkiaUnrefQueue>& unref_queue() const {
+    return unref_queue_;
+  }
+
+  // Builds frame |frame| of |scene| on the UI thread and waits for it to be
+  // rasterized.
+  FrameTiming DrawFrame(const FrameSceneBuilder& scene, int frame) {
+    testing::ShellTest::PumpOneFrame(
+        shell_.get(), kFrameWidth, kFrameHeight,
+        [&scene, frame](const std::shared_ptr<ContainerLayer>& root) {
+          scene(root.get(), frame);
+        });
+    frame_latch_.Wait();
+    return last_frame_timing_;
+  }
+
+ private:
+  fml::UniqueFD assets_dir_;
+  testing::ELFAOTSymbols aot_symbols_;
+  std::unique_ptr<ThreadHost> thread_host_;
+  std::unique_ptr<Shell> shell_;
+  fml::RefPtr<SkiaUnrefQueue> unref_queue_;
+  fml::AutoResetWaitableEvent frame_latch_;
+  FrameTiming last_frame_timing_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameBenchmarkShell);
+};
+
+// Measures the time from the start of the frame build on the UI thread until
+// the frame has been presented by the rasterizer.
+static void BM_FrameBuildToPresent(
+    benchmark::State& state,
+    FrameScene scene,
+    testing::ShellTestPlatformView::BackendType backend) {
+  FrameBenchmarkShell shell(backend, scene == FrameScene::kPlatformViews);
+  FrameSceneBuilder scene_builder = MakeFrameScene(scene, shell.unref_queue());
+
+  int frame = 0;
+  for (; frame < kWarmUpFrameCount; frame++) {
+    shell.DrawFrame(scene_builder, frame);
+  }
+
+  fml::TimeDelta build_time;
+  fml::TimeDelta raster_time;
+  while (state.KeepRunning()) {
+    FrameTiming timing = shell.DrawFrame(scene_builder, frame++);
+    build_time = build_time + (timing.Get(FrameTiming::kBuildFinish) -
+                               timing.Get(FrameTiming::kBuildStart));
+    raster_time = raster_time + (timing.Get(FrameTiming::kRasterFinish) -
+                                 timing.Get(FrameTiming::kRasterStart));
+    state.SetIterationTime((timing.Get(FrameTiming::kRasterFinish) -
+                            timing.Get(FrameTiming::kBuildStart))
+                               .ToSecondsF());
+  }
+  state.counters["build_ms"] = benchmark::Counter(
+      build_time.ToMillisecondsF(), benchmark::Counter::kAvgIterations);
+  state.counters["raster_ms"] = benchmark::Counter(
+      raster_time.ToMillisecondsF(), benchmark::Counter::kAvgIterations);
+}
+
+// Measures the diff, preroll and paint phases of the rasterization of a scene
+// separately. The frames are rasterized in software because the phases that
+// walk the layer tree do not depend on the rendering backend, the paint time
+// of the GPU backends is part of the raster time of BM_FrameBuildToPresent.
+static void BM_FrameRasterPhases(benchmark::State& state, FrameScene scene) {
+  fml::Thread unref_thread("io.flutter.bench.unref");
+  auto unref_queue = fml::MakeRefCounted<SkiaUnrefQueue>(
+      unref_thread.GetTaskRunner(), fml::TimeDelta::Zero());
+  FrameSceneBuilder scene_builder = MakeFrameScene(scene, unref_queue);
+  sk_sp<SkSurface> surface = SkSurface::MakeRaster(
+      SkImageInfo::MakeN32Premul(kFrameWidth, kFrameHeight));
+  CompositorContext compositor_context;
+  std::unique_ptr<LayerTree> previous_layer_tree;
+
+  fml::TimeDelta diff_time;
+  fml::TimeDelta preroll_time;
+  fml::TimeDelta paint_time;
+  int frame = 0;
+  auto raster_frame = [&](bool measure) {
+    auto layer_tree = std::make_unique<LayerTree>(
+        SkISize::Make(kFrameWidth, kFrameHeight), 1.0f);
+    auto root = std::make_shared<TransformLayer>(SkMatrix::I());
+    scene_builder(root.get(), frame++);
+    layer_tree->set_root_layer(root);
+
+    compositor_context.raster_cache().BeginFrame();
+    auto compositor_frame = compositor_context.AcquireFrame(
+        nullptr, surface->getCanvas(), nullptr, SkMatrix::I(), false, true,
+        nullptr, nullptr, nullptr);
+
+    const fml::TimePoint diff_start = fml::TimePoint::Now();
+    FrameDamage damage;
+    damage.SetPreviousLayerTree(previous_layer_tree.get());
+    std::optional<SkRect> clip_rect =
+        damage.ComputeClipRect(*layer_tree, true);
+
+    const fml::TimePoint preroll_start = fml::TimePoint::Now();
+    layer_tree->Preroll(*compositor_frame, false,
+                        clip_rect ? *clip_rect : kGiantRect);
+
+    const fml::TimePoint paint_start = fml::TimePoint::Now();
+    SkAutoCanvasRestore restore(surface->getCanvas(), true);
+    if (clip_rect) {
+      surface->getCanvas()->clipRect(*clip_rect);
+    }
+    surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+    layer_tree->Paint(*compositor_frame);
+    surface->getCanvas()->flush();
+    const fml::TimePoint paint_end = fml::TimePoint::Now();
+
+    compositor_context.raster_cache().EndFrame();
+    previous_layer_tree = std::move(layer_tree);
+
+    if (measure) {
+      diff_time = diff_time + (preroll_start - diff_start);
+      preroll_time = preroll_time + (paint_start - preroll_start);
+      paint_time = paint_time + (paint_end - paint_start);
+      state.SetIterationTime((paint_end - diff_start).ToSecondsF());
+    }
+  };
+
+  for (int i = 0; i < kWarmUpFrameCount; i++) {
+    raster_frame(false);
+  }
+  while (state.KeepRunning()) {
+    raster_frame(true);
+  }
+  state.counters["diff_ms"] = benchmark::Counter(
+      diff_time.ToMillisecondsF(), benchmark::Counter::kAvgIterations);
+  state.counters["preroll_ms"] = benchmark::Counter(
+      preroll_time.ToMillisecondsF(), benchmark::Counter::kAvgIterations);
+  state.counters["paint_ms"] = benchmark::Counter(
+      paint_time.ToMillisecondsF(), benchmark::Counter::kAvgIterations);
+}
+
+#define FRAME_BENCHMARK(name, scene, backend)                            \
+  BENCHMARK_CAPTURE(BM_FrameBuildToPresent, name, scene,                \
+                    testing::ShellTestPlatformView::BackendType::backend) \
+      ->UseManualTime()                                                  \
+      ->Unit(benchmark::kMillisecond);
+
+#define FRAME_BENCHMARKS_FOR_BACKEND(suffix, backend)                         \
+  FRAME_BENCHMARK(ScrollingList##suffix, FrameScene::kScrollingList, backend) \
+  FRAME_BENCHMARK(RasterCachedPictures##suffix,                               \
+                  FrameScene::kRasterCachedPictures, backend)                 \
+  FRAME_BENCHMARK(PlatformViews##suffix, FrameScene::kPlatformViews, backend) \
+  FRAME_BENCHMARK(Text##suffix, FrameScene::kText, backend)
+
+#ifdef SHELL_ENABLE_GL
+FRAME_BENCHMARKS_FOR_BACKEND(GL, kGLBackend)
+#endif  // SHELL_ENABLE_GL
+#ifdef SHELL_ENABLE_VULKAN
+FRAME_BENCHMARKS_FOR_BACKEND(Vulkan, kVulkanBackend)
+#endif  // SHELL_ENABLE_VULKAN
+#ifdef SHELL_ENABLE_METAL
+FRAME_BENCHMARKS_FOR_BACKEND(Metal, kMetalBackend)
+#endif  // SHELL_ENABLE_METAL
+
+BENCHMARK_CAPTURE(BM_FrameRasterPhases,
+                  ScrollingList,
+                  FrameScene::kScrollingList)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_FrameRasterPhases,
+                  RasterCachedPictures,
+                  FrameScene::kRasterCachedPictures)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_FrameRasterPhases, Text, FrameScene::kText)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
 }  // namespace flutter
@@ -39,7 +39,8 @@ ShellIOManager::ShellIOManager(
     std::shared_ptr<const fml::SyncSwitch> is_gpu_disabled_sync_switch,
     fml::RefPtr<fml::TaskRunner> unref_queue_task_runner,
     std::shared_ptr<impeller::Context> impeller_context,
-    fml::TimeDelta unref_queue_drain_delay)
+    fml::TimeDelta unref_queue_drain_delay,
+    size_t texture_upload_bytes_per_frame)
     : resource_context_(std::move(resource_context)),
       resource_context_weak_factory_(
           resource_context_
@@ -47,9 +48,13 @@ ShellIOManager::ShellIOManager(
                     resource_context_.get())
               : nullptr),
       unref_queue_(fml::MakeRefCounted<flutter::SkiaUnrefQueue>(
-          std::move(unref_queue_task_runner),
+          unref_queue_task_runner,
           unref_queue_drain_delay,
           resource_context_)),
+      texture_upload_queue_(fml::MakeRefCounted<TextureUploadQueue>(
+          std::move(unref_queue_task_runner),
+          texture_upload_bytes_per_frame,
+          fml::TimeDelta::FromMilliseconds(16))),
       is_gpu_disabled_sync_switch_(std::move(is_gpu_disabled_sync_switch)),
       impeller_context_(std::move(impeller_context)),
       weak_factory_(this) {
@@ -63,6 +68,10 @@ ShellIOManager::ShellIOManager(
 }
 
 ShellIOManager::~ShellIOManager() {
+  // The uploads that are still pending complete the decodes that are waiting
+  // for them. They fall back to raster images if the GPU is disabled.
+  texture_upload_queue_->Drain();
+
   // Last chance to drain the IO queue as the platform side reference to the
   // underlying OpenGL context may be going away.
   is_gpu_disabled_sync_switch_->Execute(
@@ -122,4 +131,9 @@ std::shared_ptr<impeller::Context> ShellIOManager::GetImpellerContext() const {
   return impeller_context_;
 }
 
+// |IOManager|
+fml::RefPtr<TextureUploadQueue> ShellIOManager::GetTextureUploadQueue() const {
+  return texture_upload_queue_;
+}
+
 }  // namespace flutter
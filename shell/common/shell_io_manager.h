@@ -30,7 +30,9 @@ class ShellIOManager final : public IOManager {
       fml::RefPtr<fml::TaskRunner> unref_queue_task_runner,
       std::shared_ptr<impeller::Context> impeller_context,
       fml::TimeDelta unref_queue_drain_delay =
-          fml::TimeDelta::FromMilliseconds(8));
+          fml::TimeDelta::FromMilliseconds(8),
+      size_t texture_upload_bytes_per_frame =
+          TextureUploadQueue::kDefaultMaxBytesPerFrame);
 
   ~ShellIOManager() override;
 
@@ -62,6 +64,9 @@ class ShellIOManager final : public IOManager {
   // |IOManager|
   std::shared_ptr<impeller::Context> GetImpellerContext() const override;
 
+  // |IOManager|
+  fml::RefPtr<TextureUploadQueue> GetTextureUploadQueue() const override;
+
  private:
   // Resource context management.
   sk_sp<GrDirectContext> resource_context_;
@@ -69,6 +74,7 @@ class ShellIOManager final : public IOManager {
       resource_context_weak_factory_;
   // Unref queue management.
   fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue_;
+  fml::RefPtr<TextureUploadQueue> texture_upload_queue_;
   std::shared_ptr<const fml::SyncSwitch> is_gpu_disabled_sync_switch_;
   std::shared_ptr<impeller::Context> impeller_context_;
   fml::WeakPtrFactory<ShellIOManager> weak_factory_;
@@ -157,7 +157,7 @@ void ShellTest::NotifyIdle(Shell* shell, fml::TimePoint deadline) {
   shell->GetTaskRunners().GetUITaskRunner()->PostTask(
       [&latch, engine = shell->weak_engine_, deadline]() {
         if (engine) {
-          engine->NotifyIdle(deadline);
+          engine->NotifyIdle(IdleNotification{.deadline = deadline});
         }
         latch.Signal();
       });
@@ -11,8 +11,10 @@
 #include <utility>
 #include <vector>
 
+#include "assets/asset_access_profile.h"
 #include "assets/directory_asset_bundle.h"
 #include "common/graphics/persistent_cache.h"
+#include "flutter/display_list/display_list_capture.h"
 #include "flutter/flow/layers/backdrop_filter_layer.h"
 #include "flutter/flow/layers/display_list_layer.h"
 #include "flutter/flow/layers/layer_raster_cache_item.h"
@@ -22,6 +24,7 @@
 #include "flutter/fml/dart/dart_converter.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/message_loop.h"
+#include "flutter/fml/paths.h"
 #include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/runtime/dart_vm.h"
@@ -36,6 +39,7 @@
 #include "flutter/shell/version/version.h"
 #include "flutter/testing/testing.h"
 #include "gmock/gmock.h"
+#include "third_party/dart/runtime/include/dart_tools_api.h"
 #include "third_party/rapidjson/include/rapidjson/writer.h"
 #include "third_party/skia/include/codec/SkCodecAnimation.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
@@ -193,6 +197,42 @@ class TestAssetResolver : public AssetResolver {
   AssetResolver::AssetResolverType type_;
 };
 
+// Provides the assets in |names| and counts how often it is looked up.
+class CountingAssetResolver : public AssetResolver {
+ public:
+  explicit CountingAssetResolver(std::vector<std::string> names)
+      : names_(std::move(names)) {}
+
+  bool IsValid() const override { return true; }
+
+  bool IsValidAfterAssetManagerChange() const override { return true; }
+
+  AssetResolver::AssetResolverType GetType() const override {
+    return AssetResolver::AssetResolverType::kDirectoryAssetBundle;
+  }
+
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override {
+    lookup_count_++;
+    if (std::find(names_.begin(), names_.end(), asset_name) == names_.end()) {
+      return nullptr;
+    }
+    return std::make_unique<fml::DataMapping>(asset_name);
+  }
+
+  std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
+      const std::string& asset_pattern,
+      const std::optional<std::string>& subdir) const override {
+    return {};
+  };
+
+  int lookup_count() const { return lookup_count_; }
+
+ private:
+  std::vector<std::string> names_;
+  mutable int lookup_count_ = 0;
+};
+
 static bool ValidateShell(Shell* shell) {
   if (!shell) {
     return false;
@@ -2379,6 +2419,45 @@ TEST_F(ShellTest, RasterizerScreenshot) {
   DestroyShell(std::move(shell), task_runners);
 }
 
+TEST_F(ShellTest, RasterizerScreenshotDisplayList) {
+  Settings settings = CreateSettingsForFixture();
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  auto task_runner = CreateNewThread();
+  TaskRunners task_runners("test", task_runner, task_runner, task_runner,
+                           task_runner);
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  PlatformViewNotifyCreated(shell.get());
+
+  RunEngine(shell.get(), std::move(configuration));
+
+  auto latch = std::make_shared<fml::AutoResetWaitableEvent>();
+
+  PumpOneFrame(shell.get());
+
+  fml::TaskRunner::RunNowOrPostTask(
+      shell->GetTaskRunners().GetRasterTaskRunner(), [&shell, &latch]() {
+        Rasterizer::Screenshot screenshot =
+            shell->GetRasterizer()->ScreenshotLastLayerTree(
+                Rasterizer::ScreenshotType::DisplayListCapture, false);
+        EXPECT_NE(screenshot.data, nullptr);
+        if (screenshot.data) {
+          fml::NonOwnedMapping capture(
+              static_cast<const uint8_t*>(screenshot.data->data()),
+              screenshot.data->size());
+          SkISize frame_size;
+          EXPECT_NE(DisplayListCapture::Deserialize(capture, &frame_size),
+                    nullptr);
+          EXPECT_EQ(frame_size, screenshot.frame_size);
+        }
+
+        latch->Signal();
+      });
+  latch->Wait();
+  DestroyShell(std::move(shell), task_runners);
+}
+
 TEST_F(ShellTest, RasterizerMakeRasterSnapshot) {
   Settings settings = CreateSettingsForFixture();
   auto configuration = RunConfiguration::InferFromSettings(settings);
@@ -2410,6 +2489,89 @@ TEST_F(ShellTest, RasterizerMakeRasterSnapshot) {
   DestroyShell(std::move(shell), task_runners);
 }
 
+TEST_F(ShellTest, RasterizerMakeRasterSnapshotAsync) {
+  Settings settings = CreateSettingsForFixture();
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  auto task_runner = CreateNewThread();
+  TaskRunners task_runners("test", task_runner, task_runner, task_runner,
+                           task_runner);
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  PlatformViewNotifyCreated(shell.get());
+
+  RunEngine(shell.get(), std::move(configuration));
+
+  auto latch = std::make_shared<fml::AutoResetWaitableEvent>();
+
+  PumpOneFrame(shell.get());
+
+  fml::TaskRunner::RunNowOrPostTask(
+      shell->GetTaskRunners().GetRasterTaskRunner(), [&shell, latch]() {
+        SnapshotDelegate* delegate =
+            reinterpret_cast<Rasterizer*>(shell->GetRasterizer().get());
+        delegate->MakeRasterSnapshotAsync(
+            MakeSizedDisplayList(50, 50), SkISize::Make(50, 50),
+            [latch](sk_sp<DlImage> image) {
+              EXPECT_NE(image, nullptr);
+              if (image) {
+                EXPECT_EQ(image->dimensions(), SkISize::Make(50, 50));
+                // The snapshot must not need to be read back again.
+                SkPixmap pixmap;
+                EXPECT_TRUE(image->skia_image()->peekPixels(&pixmap));
+              }
+              latch->Signal();
+            });
+      });
+  latch->Wait();
+  DestroyShell(std::move(shell), task_runners);
+}
+
+TEST_F(ShellTest, NotifyMemoryPressureReportsFreedBytesPerSubsystem) {
+  Settings settings = CreateSettingsForFixture();
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  PlatformViewNotifyCreated(shell.get());
+  RunEngine(shell.get(), std::move(configuration));
+  PumpOneFrame(shell.get());
+
+  bool embedder_cache_trimmed = false;
+  shell->GetMemoryPressureRegistry().Register(
+      "embedder", shell->GetTaskRunners().GetIOTaskRunner(),
+      [&embedder_cache_trimmed](MemoryPressureLevel level) -> size_t {
+        embedder_cache_trimmed = true;
+        return level == MemoryPressureLevel::kCritical ? 1024 : 0;
+      });
+
+  fml::AutoResetWaitableEvent latch;
+  MemoryPressureReport report;
+  fml::TaskRunner::RunNowOrPostTask(
+      shell->GetTaskRunners().GetPlatformTaskRunner(), [&]() {
+        shell->NotifyMemoryPressure(
+            MemoryPressureLevel::kCritical,
+            [&](const MemoryPressureReport& result) {
+              EXPECT_TRUE(shell->GetTaskRunners()
+                              .GetPlatformTaskRunner()
+                              ->RunsTasksOnCurrentThread());
+              report = result;
+              latch.Signal();
+            });
+      });
+  latch.Wait();
+
+  ASSERT_TRUE(embedder_cache_trimmed);
+  ASSERT_EQ(report["embedder"], 1024u);
+  ASSERT_EQ(report.count("dart"), 1u);
+  ASSERT_EQ(report.count("resource_cache"), 1u);
+  ASSERT_EQ(report.count("raster_cache"), 1u);
+  ASSERT_EQ(report.count("glyph_atlas"), 1u);
+  ASSERT_EQ(report.count("snapshot_texture_pool"), 1u);
+
+  DestroyShell(std::move(shell));
+}
+
 TEST_F(ShellTest, OnServiceProtocolEstimateRasterCacheMemoryWorks) {
   Settings settings = CreateSettingsForFixture();
   std::unique_ptr<Shell> shell = CreateShell(settings);
@@ -2917,6 +3079,115 @@ TEST_F(ShellTest, AssetManagerMulti) {
   }
 }
 
+TEST_F(ShellTest, AssetManagerLookupIndexProbesOneResolver) {
+  auto first = std::make_unique<CountingAssetResolver>(
+      std::vector<std::string>{"first"});
+  auto second = std::make_unique<CountingAssetResolver>(
+      std::vector<std::string>{"second"});
+  auto* first_ptr = first.get();
+  auto* second_ptr = second.get();
+
+  AssetManager asset_manager;
+  asset_manager.EnableLookupIndex();
+  asset_manager.PushBack(std::move(first));
+  asset_manager.PushBack(std::move(second));
+
+  ASSERT_NE(asset_manager.GetAsMapping("second"), nullptr);
+  EXPECT_EQ(first_ptr->lookup_count(), 1);
+  EXPECT_EQ(second_ptr->lookup_count(), 1);
+
+  ASSERT_NE(asset_manager.GetAsMapping("second"), nullptr);
+  EXPECT_EQ(first_ptr->lookup_count(), 1);
+  EXPECT_EQ(second_ptr->lookup_count(), 2);
+
+  // Missing assets are remembered as well.
+  EXPECT_EQ(asset_manager.GetAsMapping("missing"), nullptr);
+  EXPECT_EQ(asset_manager.GetAsMapping("missing"), nullptr);
+  EXPECT_EQ(first_ptr->lookup_count(), 2);
+  EXPECT_EQ(second_ptr->lookup_count(), 3);
+}
+
+TEST_F(ShellTest, AssetManagerLookupIndexIsClearedWhenResolversChange) {
+  auto first = std::make_unique<CountingAssetResolver>(
+      std::vector<std::string>{"first"});
+  auto* first_ptr = first.get();
+
+  AssetManager asset_manager;
+  asset_manager.EnableLookupIndex();
+  asset_manager.PushBack(std::move(first));
+
+  EXPECT_EQ(asset_manager.GetAsMapping("added"), nullptr);
+  EXPECT_EQ(first_ptr->lookup_count(), 1);
+
+  asset_manager.PushFront(std::make_unique<CountingAssetResolver>(
+      std::vector<std::string>{"added"}));
+  EXPECT_NE(asset_manager.GetAsMapping("added"), nullptr);
+  ASSERT_NE(asset_manager.GetAsMapping("first"), nullptr);
+  EXPECT_EQ(first_ptr->lookup_count(), 2);
+}
+
+TEST_F(ShellTest, AssetManagerWithoutLookupIndexProbesEveryResolver) {
+  auto first = std::make_unique<CountingAssetResolver>(
+      std::vector<std::string>{});
+  auto* first_ptr = first.get();
+
+  AssetManager asset_manager;
+  asset_manager.PushBack(std::move(first));
+  asset_manager.PushBack(std::make_unique<CountingAssetResolver>(
+      std::vector<std::string>{"second"}));
+
+  ASSERT_NE(asset_manager.GetAsMapping("second"), nullptr);
+  ASSERT_NE(asset_manager.GetAsMapping("second"), nullptr);
+  EXPECT_EQ(first_ptr->lookup_count(), 2);
+}
+
+TEST_F(ShellTest, AssetManagerRecordsAccessesInFirstLookupOrder) {
+  AssetManager asset_manager;
+  asset_manager.PushBack(std::make_unique<CountingAssetResolver>(
+      std::vector<std::string>{"a", "b", "c"}));
+
+  // Lookups before recording starts are not recorded.
+  ASSERT_NE(asset_manager.GetAsMapping("c"), nullptr);
+
+  asset_manager.StartRecordingAccesses(2);
+  ASSERT_NE(asset_manager.GetAsMapping("b"), nullptr);
+  ASSERT_EQ(asset_manager.GetAsMapping("missing"), nullptr);
+  ASSERT_NE(asset_manager.GetAsMapping("b"), nullptr);
+  ASSERT_NE(asset_manager.GetAsMapping("a"), nullptr);
+  // Recording stops once the maximum count is reached.
+  ASSERT_NE(asset_manager.GetAsMapping("c"), nullptr);
+
+  EXPECT_EQ(asset_manager.StopRecordingAccesses(),
+            (std::vector<std::string>{"b", "a"}));
+  EXPECT_TRUE(asset_manager.StopRecordingAccesses().empty());
+}
+
+TEST_F(ShellTest, AssetAccessProfilePrefetchesRecordedAssets) {
+  fml::ScopedTemporaryDirectory asset_dir;
+  fml::UniqueFD asset_dir_fd = fml::OpenDirectory(
+      asset_dir.path().c_str(), false, fml::FilePermission::kRead);
+  for (auto filename : {"font", "image"}) {
+    ASSERT_TRUE(fml::WriteAtomically(asset_dir_fd, filename,
+                                     fml::DataMapping(std::string(filename))));
+  }
+
+  AssetManager asset_manager;
+  asset_manager.PushBack(
+      std::make_unique<DirectoryAssetBundle>(std::move(asset_dir_fd), false));
+
+  fml::ScopedTemporaryDirectory profile_dir;
+  const std::string path =
+      fml::paths::JoinPaths({profile_dir.path(), "asset_profile"});
+  EXPECT_TRUE(AssetAccessProfile::Read(path).empty());
+
+  const std::vector<std::string> asset_names = {"image", "removed", "font"};
+  ASSERT_TRUE(AssetAccessProfile::Write(path, asset_names));
+  EXPECT_EQ(AssetAccessProfile::Read(path), asset_names);
+
+  // Assets that are gone since the profile was recorded are skipped.
+  EXPECT_EQ(AssetAccessProfile::Prefetch(asset_manager, asset_names), 2u);
+}
+
 #if defined(OS_FUCHSIA)
 TEST_F(ShellTest, AssetManagerMultiSubdir) {
   std::string subdir_path = "subdir";
@@ -3932,6 +4203,49 @@ TEST_F(ShellTest, NotifyIdleNotCalledInLatencyMode) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
 }
 
+TEST_F(ShellTest, NotifyIdleCountsLongIdlePeriods) {
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+  Settings settings = CreateSettingsForFixture();
+  auto task_runner = CreateNewThread();
+  TaskRunners task_runners("test", task_runner, task_runner, task_runner,
+                           task_runner);
+  auto shell = CreateShell(settings, task_runners);
+  ASSERT_TRUE(ValidateShell(shell.get()));
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("emptyMain");
+  RunEngine(shell.get(), std::move(configuration));
+
+  PostSync(task_runner, [&shell]() {
+    auto runtime_controller = const_cast<RuntimeController*>(
+        shell->GetEngine()->GetRuntimeController());
+    const IdleStats before = runtime_controller->GetIdleStats();
+    const fml::TimePoint deadline =
+        fml::TimePoint::FromEpochDelta(
+            fml::TimeDelta::FromMicroseconds(Dart_TimelineGetMicros())) +
+        fml::TimeDelta::FromMilliseconds(20);
+
+    // A static screen with nothing left to rasterize.
+    ASSERT_TRUE(runtime_controller->NotifyIdle(IdleNotification{
+        .deadline = deadline, .idle_frames = 10, .queued_raster_frames = 0}));
+    // A frame is still waiting for the raster thread.
+    ASSERT_TRUE(runtime_controller->NotifyIdle(IdleNotification{
+        .deadline = deadline, .idle_frames = 10, .queued_raster_frames = 1}));
+    // The idle time at the end of a frame.
+    ASSERT_TRUE(runtime_controller->NotifyIdle(IdleNotification{
+        .deadline = deadline, .idle_frames = 0, .queued_raster_frames = 0}));
+
+    const IdleStats& after = runtime_controller->GetIdleStats();
+    EXPECT_EQ(after.notifications - before.notifications, 3u);
+    EXPECT_EQ(after.long_idle_notifications - before.long_idle_notifications,
+              1u);
+    EXPECT_GT(after.idle_time_offered, before.idle_time_offered);
+  });
+
+  DestroyShell(std::move(shell), task_runners);
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+}
+
 }  // namespace testing
 }  // namespace flutter
 
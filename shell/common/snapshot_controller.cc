@@ -26,4 +26,17 @@ std::unique_ptr<SnapshotController> SnapshotController::Make(
 SnapshotController::SnapshotController(const Delegate& delegate)
     : delegate_(delegate) {}
 
+void SnapshotController::MakeRasterSnapshotAsync(
+    sk_sp<DisplayList> display_list,
+    SkISize size,
+    std::function<void(sk_sp<DlImage>)> callback) {
+  callback(MakeRasterSnapshot(std::move(display_list), size));
+}
+
+void SnapshotController::ConvertToRasterImageAsync(
+    sk_sp<SkImage> image,
+    std::function<void(sk_sp<SkImage>)> callback) {
+  callback(ConvertToRasterImage(std::move(image)));
+}
+
 }  // namespace flutter
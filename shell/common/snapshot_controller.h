@@ -36,6 +36,27 @@ class SnapshotController {
 
   virtual sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Like |MakeRasterSnapshot|, but does not block the raster
+  ///             thread while the pixels are read back from the GPU. The
+  ///             callback is invoked on the raster thread. The default
+  ///             implementation performs a synchronous snapshot.
+  ///
+  virtual void MakeRasterSnapshotAsync(
+      sk_sp<DisplayList> display_list,
+      SkISize size,
+      std::function<void(sk_sp<DlImage>)> callback);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Like |ConvertToRasterImage|, but does not block the raster
+  ///             thread while the pixels are read back from the GPU. The
+  ///             callback is invoked on the raster thread. The default
+  ///             implementation performs a synchronous conversion.
+  ///
+  virtual void ConvertToRasterImageAsync(
+      sk_sp<SkImage> image,
+      std::function<void(sk_sp<SkImage>)> callback);
+
  protected:
   explicit SnapshotController(const Delegate& delegate);
   const Delegate& GetDelegate() { return delegate_; }
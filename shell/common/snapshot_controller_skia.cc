@@ -6,6 +6,7 @@
 
 #include "display_list/display_list_image.h"
 #include "flutter/flow/surface.h"
+#include "flutter/fml/message_loop.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/shell/common/snapshot_controller.h"
 #include "third_party/skia/include/core/SkSurface.h"
@@ -13,6 +14,9 @@
 namespace flutter {
 
 namespace {
+constexpr fml::TimeDelta kAsyncReadbackPollInterval =
+    fml::TimeDelta::FromMilliseconds(1);
+
 sk_sp<SkImage> DrawSnapshot(
     const sk_sp<SkSurface>& surface,
     const std::function<void(SkCanvas*)>& draw_callback) {
@@ -42,6 +46,72 @@ sk_sp<SkImage> DrawSnapshot(
 
   return nullptr;
 }
+
+// Creates a GPU render target for a snapshot of |image_info|. The target is
+// scaled down to the max size supported by the GPU if necessary, exceeding the
+// max would otherwise cause a null result.
+sk_sp<SkSurface> MakeSnapshotRenderTarget(GrRecordingContext* context,
+                                          const SkImageInfo& image_info) {
+  auto max_size = context->maxRenderTargetSize();
+  double scale_factor = std::min(
+      1.0, static_cast<double>(max_size) /
+               static_cast<double>(
+                   std::max(image_info.width(), image_info.height())));
+
+  SkImageInfo target_info = image_info;
+  if (scale_factor < 1.0) {
+    target_info = image_info.makeWH(
+        static_cast<double>(image_info.width()) * scale_factor,
+        static_cast<double>(image_info.height()) * scale_factor);
+  }
+
+  // When there is an on screen surface, we need a render target SkSurface
+  // because we want to access texture backed images.
+  sk_sp<SkSurface> sk_surface =
+      SkSurface::MakeRenderTarget(context,          // context
+                                  SkBudgeted::kNo,  // budgeted
+                                  target_info       // image info
+      );
+  if (sk_surface) {
+    sk_surface->getCanvas()->scale(scale_factor, scale_factor);
+  }
+  return sk_surface;
+}
+
+// The state of a readback that has been handed to Skia.
+struct AsyncReadback {
+  SkImageInfo image_info;
+  std::function<void(sk_sp<SkImage>)> callback;
+  std::shared_ptr<size_t> pending_readbacks;
+};
+
+// Invoked by Skia on the raster thread once the pixels of a readback are
+// available. The result is only valid for the duration of the call because
+// unmapping the transfer buffer is bound to the context, so the pixels are
+// copied into an image owned by the caller.
+void OnAsyncReadPixels(void* context,
+                       std::unique_ptr<const SkImage::AsyncReadResult> result) {
+  std::unique_ptr<AsyncReadback> readback(static_cast<AsyncReadback*>(context));
+  (*readback->pending_readbacks)--;
+
+  if (!result || result->count() != 1) {
+    FML_LOG(ERROR) << "Could not read back the pixels of the raster snapshot.";
+    readback->callback(nullptr);
+    return;
+  }
+
+  TRACE_EVENT0("flutter", "CopyAsyncReadPixels");
+  const SkImageInfo& info = readback->image_info;
+  const size_t row_bytes = info.minRowBytes();
+  sk_sp<SkData> pixels =
+      SkData::MakeUninitialized(info.computeByteSize(row_bytes));
+  const auto* src = static_cast<const uint8_t*>(result->data(0));
+  auto* dst = static_cast<uint8_t*>(pixels->writable_data());
+  for (int y = 0; y < info.height(); y++) {
+    memcpy(dst + y * row_bytes, src + y * result->rowBytes(0), row_bytes);
+  }
+  readback->callback(SkImage::MakeRasterData(info, pixels, row_bytes));
+}
 }  // namespace
 
 sk_sp<DlImage> SnapshotControllerSkia::DoMakeRasterSnapshot(
@@ -85,36 +155,14 @@ sk_sp<DlImage> SnapshotControllerSkia::DoMakeRasterSnapshot(
                 return;
               }
 
-              GrRecordingContext* context = snapshot_surface->GetContext();
-              auto max_size = context->maxRenderTargetSize();
-              double scale_factor = std::min(
-                  1.0, static_cast<double>(max_size) /
-                           static_cast<double>(std::max(image_info.width(),
-                                                        image_info.height())));
-
-              // Scale down the render target size to the max supported by the
-              // GPU if necessary. Exceeding the max would otherwise cause a
-              // null result.
-              if (scale_factor < 1.0) {
-                image_info = image_info.makeWH(
-                    static_cast<double>(image_info.width()) * scale_factor,
-                    static_cast<double>(image_info.height()) * scale_factor);
-              }
-
-              // When there is an on screen surface, we need a render target
-              // SkSurface because we want to access texture backed images.
-              sk_sp<SkSurface> sk_surface =
-                  SkSurface::MakeRenderTarget(context,          // context
-                                              SkBudgeted::kNo,  // budgeted
-                                              image_info        // image info
-                  );
+              sk_sp<SkSurface> sk_surface = MakeSnapshotRenderTarget(
+                  snapshot_surface->GetContext(), image_info);
               if (!sk_surface) {
                 FML_LOG(ERROR)
                     << "DoMakeRasterSnapshot can not create GPU render target";
                 return;
               }
 
-              sk_surface->getCanvas()->scale(scale_factor, scale_factor);
               result = DrawSnapshot(sk_surface, draw_callback);
             }));
   }
@@ -153,4 +201,128 @@ sk_sp<SkImage> SnapshotControllerSkia::ConvertToRasterImage(
   return result->skia_image();
 }
 
+void SnapshotControllerSkia::DoMakeRasterSnapshotAsync(
+    SkISize size,
+    std::function<void(SkCanvas*)> draw_callback,
+    std::function<void(sk_sp<SkImage>)> callback) {
+  TRACE_EVENT0("flutter", __FUNCTION__);
+  SkImageInfo image_info = SkImageInfo::MakeN32Premul(
+      size.width(), size.height(), SkColorSpace::MakeSRGB());
+
+  // The readback is only started on the on screen surface, the context of a
+  // snapshot surface does not outlive this call and could not be polled for
+  // the completion of the readback.
+  auto& delegate = GetDelegate();
+  Surface* snapshot_surface = delegate.GetSurface().get();
+  bool started = false;
+  if (snapshot_surface && snapshot_surface->GetContext()) {
+    delegate.GetIsGpuDisabledSyncSwitch()->Execute(
+        fml::SyncSwitch::Handlers().SetIfFalse([&] {
+          auto context_switch = snapshot_surface->MakeRenderContextCurrent();
+          if (!context_switch->GetResult()) {
+            return;
+          }
+
+          GrDirectContext* context = snapshot_surface->GetContext();
+          sk_sp<SkSurface> sk_surface =
+              MakeSnapshotRenderTarget(context, image_info);
+          if (!sk_surface) {
+            FML_LOG(ERROR) << "DoMakeRasterSnapshotAsync can not create GPU "
+                              "render target";
+            return;
+          }
+          draw_callback(sk_surface->getCanvas());
+
+          // Skia picks the transfer mechanism of the backend (for example a
+          // pixel buffer object on GL) and falls back to a blocking read if
+          // the backend has none.
+          auto* readback = new AsyncReadback{
+              sk_surface->imageInfo(), std::move(callback), pending_readbacks_};
+          (*pending_readbacks_)++;
+          SkIRect src_rect =
+              SkIRect::MakeSize(readback->image_info.dimensions());
+          sk_surface->asyncRescaleAndReadPixels(
+              readback->image_info,            // info
+              src_rect,                        // rect
+              SkImage::RescaleGamma::kSrc,     // gamma
+              SkImage::RescaleMode::kNearest,  // mode
+              OnAsyncReadPixels,               // callback
+              readback                         // context
+          );
+          context->flushAndSubmit();
+          started = true;
+        }));
+  }
+
+  if (!started) {
+    sk_sp<DlImage> result = DoMakeRasterSnapshot(size, draw_callback);
+    callback(result ? result->skia_image() : nullptr);
+    return;
+  }
+  CheckAsyncReadbacks();
+}
+
+void SnapshotControllerSkia::CheckAsyncReadbacks() {
+  // No frames may be submitted while a readback is in flight, so the context
+  // is polled for the completion of the readbacks instead of relying on the
+  // next frame to deliver them.
+  if (*pending_readbacks_ == 0) {
+    return;
+  }
+  Surface* surface = GetDelegate().GetSurface().get();
+  if (!surface || !surface->GetContext()) {
+    // The context delivers the remaining readbacks when it is destroyed.
+    return;
+  }
+  {
+    auto context_switch = surface->MakeRenderContextCurrent();
+    if (context_switch->GetResult()) {
+      surface->GetContext()->checkAsyncWorkCompletion();
+    }
+  }
+  if (*pending_readbacks_ == 0) {
+    return;
+  }
+  fml::MessageLoop::GetCurrent().GetTaskRunner()->PostDelayedTask(
+      [weak = weak_factory_.GetWeakPtr()]() {
+        if (weak) {
+          weak->CheckAsyncReadbacks();
+        }
+      },
+      kAsyncReadbackPollInterval);
+}
+
+void SnapshotControllerSkia::MakeRasterSnapshotAsync(
+    sk_sp<DisplayList> display_list,
+    SkISize size,
+    std::function<void(sk_sp<DlImage>)> callback) {
+  DoMakeRasterSnapshotAsync(
+      size,
+      [display_list](SkCanvas* canvas) { display_list->RenderTo(canvas); },
+      [callback = std::move(callback)](sk_sp<SkImage> image) {
+        callback(image ? DlImage::Make(std::move(image)) : nullptr);
+      });
+}
+
+void SnapshotControllerSkia::ConvertToRasterImageAsync(
+    sk_sp<SkImage> image,
+    std::function<void(sk_sp<SkImage>)> callback) {
+  // See |ConvertToRasterImage|, the caller creates the raster image on the IO
+  // thread if there is no surface with a GrContext.
+  if (GetDelegate().GetSurface() == nullptr ||
+      GetDelegate().GetSurface()->GetContext() == nullptr ||
+      image == nullptr) {
+    callback(nullptr);
+    return;
+  }
+
+  SkISize image_size = image->dimensions();
+  DoMakeRasterSnapshotAsync(
+      image_size,
+      [image = std::move(image)](SkCanvas* canvas) {
+        canvas->drawImage(image, 0, 0);
+      },
+      std::move(callback));
+}
+
 }  // namespace flutter
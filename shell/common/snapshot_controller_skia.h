@@ -5,6 +5,7 @@
 #ifndef FLUTTER_SHELL_COMMON_SNAPSHOT_CONTROLLER_SKIA_H_
 #define FLUTTER_SHELL_COMMON_SNAPSHOT_CONTROLLER_SKIA_H_
 
+#include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/shell/common/snapshot_controller.h"
 #include "third_party/skia/include/core/SkSurface.h"
 
@@ -13,18 +14,42 @@ namespace flutter {
 class SnapshotControllerSkia : public SnapshotController {
  public:
   explicit SnapshotControllerSkia(const SnapshotController::Delegate& delegate)
-      : SnapshotController(delegate) {}
+      : SnapshotController(delegate),
+        pending_readbacks_(std::make_shared<size_t>(0)),
+        weak_factory_(this) {}
 
   sk_sp<DlImage> MakeRasterSnapshot(sk_sp<DisplayList> display_list,
                                     SkISize size) override;
 
   virtual sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) override;
 
+  void MakeRasterSnapshotAsync(
+      sk_sp<DisplayList> display_list,
+      SkISize size,
+      std::function<void(sk_sp<DlImage>)> callback) override;
+
+  void ConvertToRasterImageAsync(
+      sk_sp<SkImage> image,
+      std::function<void(sk_sp<SkImage>)> callback) override;
+
  private:
   sk_sp<DlImage> DoMakeRasterSnapshot(
       SkISize size,
       std::function<void(SkCanvas*)> draw_callback);
 
+  void DoMakeRasterSnapshotAsync(
+      SkISize size,
+      std::function<void(SkCanvas*)> draw_callback,
+      std::function<void(sk_sp<SkImage>)> callback);
+
+  void CheckAsyncReadbacks();
+
+  // The number of readbacks whose pixels have not been delivered yet. It is
+  // shared with the readbacks in flight, which may outlive the controller.
+  std::shared_ptr<size_t> pending_readbacks_;
+
+  fml::WeakPtrFactory<SnapshotControllerSkia> weak_factory_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(SnapshotControllerSkia);
 };
 
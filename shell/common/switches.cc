@@ -199,6 +199,26 @@ static bool GetSwitchValue(const fml::CommandLine& command_line,
   return false;
 }
 
+// Parses a CPU affinity mask, which may be given in decimal, octal or
+// hexadecimal notation. Returns 0, which does not restrict the thread, if the
+// switch is missing or malformed.
+static uint64_t CpuAffinityFromCommandLine(const fml::CommandLine& command_line,
+                                           Switch sw) {
+  std::string switch_string;
+  if (!command_line.GetOptionValue(FlagForSwitch(sw), &switch_string)) {
+    return 0;
+  }
+
+  std::stringstream stream(switch_string);
+  uint64_t value = 0;
+  if (stream >> std::setbase(0) >> value && stream.eof()) {
+    return value;
+  }
+
+  FML_LOG(ERROR) << "Invalid CPU affinity mask '" << switch_string << "'.";
+  return 0;
+}
+
 std::unique_ptr<fml::Mapping> GetSymbolMapping(
     const std::string& symbol_prefix,
     const std::string& native_lib_path) {
@@ -281,6 +301,9 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
   settings.enable_service_port_fallback =
       command_line.HasOption(FlagForSwitch(Switch::EnableServicePortFallback));
 
+  settings.defer_vm_service_startup =
+      command_line.HasOption(FlagForSwitch(Switch::DeferVMServiceStartup));
+
   // Checked mode overrides.
   settings.disable_dart_asserts =
       command_line.HasOption(FlagForSwitch(Switch::DisableDartAsserts));
@@ -340,6 +363,8 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
 
   command_line.GetOptionValue(FlagForSwitch(Switch::FlutterAssetsDir),
                               &settings.assets_path);
+  settings.enable_asset_lookup_index =
+      command_line.HasOption(FlagForSwitch(Switch::EnableAssetLookupIndex));
 
   std::vector<std::string_view> aot_shared_library_name =
       command_line.GetOptionValues(FlagForSwitch(Switch::AotSharedLibraryName));
@@ -392,6 +417,16 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
   command_line.GetOptionValue(FlagForSwitch(Switch::CacheDirPath),
                               &settings.temp_directory_path);
 
+  command_line.GetOptionValue(
+      FlagForSwitch(Switch::SnapshotPrefetchProfilePath),
+      &settings.snapshot_prefetch_profile_path);
+
+  command_line.GetOptionValue(FlagForSwitch(Switch::AssetPrefetchProfilePath),
+                              &settings.asset_prefetch_profile_path);
+
+  command_line.GetOptionValue(FlagForSwitch(Switch::FontFallbackCachePath),
+                              &settings.font_fallback_cache_path);
+
   bool leak_vm = "true" == command_line.GetOptionValueWithDefault(
                                FlagForSwitch(Switch::LeakVM), "true");
   settings.leak_vm = leak_vm;
@@ -457,6 +492,9 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
   settings.purge_persistent_cache =
       command_line.HasOption(FlagForSwitch(Switch::PurgePersistentCache));
 
+  settings.packed_persistent_cache =
+      command_line.HasOption(FlagForSwitch(Switch::PackedPersistentCache));
+
   if (command_line.HasOption(FlagForSwitch(Switch::OldGenHeapSize))) {
     std::string old_gen_heap_size;
     command_line.GetOptionValue(FlagForSwitch(Switch::OldGenHeapSize),
@@ -474,6 +512,71 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
         std::stoi(resource_cache_max_bytes_threshold);
   }
 
+  if (command_line.HasOption(
+          FlagForSwitch(Switch::AnimatedImageDecodeAheadFrameCount))) {
+    std::string frame_count;
+    command_line.GetOptionValue(
+        FlagForSwitch(Switch::AnimatedImageDecodeAheadFrameCount),
+        &frame_count);
+    settings.animated_image_decode_ahead_frame_count = std::stoi(frame_count);
+  }
+
+  if (command_line.HasOption(
+          FlagForSwitch(Switch::AnimatedImageDecodeAheadByteBudget))) {
+    std::string byte_budget;
+    command_line.GetOptionValue(
+        FlagForSwitch(Switch::AnimatedImageDecodeAheadByteBudget),
+        &byte_budget);
+    settings.animated_image_decode_ahead_byte_budget = std::stoul(byte_budget);
+  }
+
+  settings.raster_cache_lru_eviction =
+      command_line.HasOption(FlagForSwitch(Switch::RasterCacheLruEviction));
+  settings.raster_cache_compression =
+      command_line.HasOption(FlagForSwitch(Switch::RasterCacheCompression));
+  settings.raster_cache_background_rasterization = command_line.HasOption(
+      FlagForSwitch(Switch::RasterCacheBackgroundRasterization));
+  settings.raster_cache_deferred_display_lists = command_line.HasOption(
+      FlagForSwitch(Switch::RasterCacheDeferredDisplayLists));
+  size_t snapshot_texture_budget_mb = 0;
+  if (GetSwitchValue(command_line, Switch::SnapshotTextureBudgetMB,
+                     &snapshot_texture_budget_mb)) {
+    settings.snapshot_texture_budget_bytes = snapshot_texture_budget_mb << 20;
+  }
+  settings.drop_stale_frames =
+      command_line.HasOption(FlagForSwitch(Switch::DropStaleFrames));
+  settings.predictive_frame_scheduling = command_line.HasOption(
+      FlagForSwitch(Switch::PredictiveFrameScheduling));
+  settings.coalesce_pointer_data =
+      command_line.HasOption(FlagForSwitch(Switch::CoalescePointerData));
+  settings.spawned_engines_share_rendering_resources = command_line.HasOption(
+      FlagForSwitch(Switch::SpawnedEnginesShareRenderingResources));
+  settings.defer_metal_drawable_acquisition = command_line.HasOption(
+      FlagForSwitch(Switch::DeferMetalDrawableAcquisition));
+
+  if (command_line.HasOption(
+          FlagForSwitch(Switch::MetalMaximumDrawableCount))) {
+    std::string maximum_drawable_count;
+    command_line.GetOptionValue(
+        FlagForSwitch(Switch::MetalMaximumDrawableCount),
+        &maximum_drawable_count);
+    settings.metal_maximum_drawable_count = std::stoi(maximum_drawable_count);
+  }
+
+  if (command_line.HasOption(FlagForSwitch(Switch::MaxPendingPresents))) {
+    std::string max_pending_presents;
+    command_line.GetOptionValue(FlagForSwitch(Switch::MaxPendingPresents),
+                                &max_pending_presents);
+    settings.max_pending_presents = std::stoi(max_pending_presents);
+  }
+
+  settings.ui_thread_cpu_affinity =
+      CpuAffinityFromCommandLine(command_line, Switch::UIThreadCpuAffinity);
+  settings.raster_thread_cpu_affinity =
+      CpuAffinityFromCommandLine(command_line, Switch::RasterThreadCpuAffinity);
+  settings.io_thread_cpu_affinity =
+      CpuAffinityFromCommandLine(command_line, Switch::IOThreadCpuAffinity);
+
   if (command_line.HasOption(FlagForSwitch(Switch::MsaaSamples))) {
     std::string msaa_samples;
     command_line.GetOptionValue(FlagForSwitch(Switch::MsaaSamples),
@@ -58,6 +58,20 @@ DEF_SWITCH(CacheDirPath,
            "Path to the cache directory. "
            "This is different from the persistent_cache_path in embedder.h, "
            "which is used for Skia shader cache.")
+DEF_SWITCH(SnapshotPrefetchProfilePath,
+           "snapshot-prefetch-profile-path",
+           "Path to a profile of the snapshot pages used during startup. The "
+           "profile is recorded after the first frame on the first launch "
+           "and used to prefetch those pages on later launches.")
+DEF_SWITCH(AssetPrefetchProfilePath,
+           "asset-prefetch-profile-path",
+           "Path to a profile of the assets loaded during startup. The profile "
+           "is recorded after the first frame on the first launch and used to "
+           "prefetch those assets on later launches.")
+DEF_SWITCH(FontFallbackCachePath,
+           "font-fallback-cache-path",
+           "Path to a file that persists the fallback fonts found by the "
+           "platform font manager across launches.")
 DEF_SWITCH(ICUDataFilePath, "icu-data-file-path", "Path to the ICU data file.")
 DEF_SWITCH(ICUSymbolPrefix,
            "icu-symbol-prefix",
@@ -116,6 +130,12 @@ DEF_SWITCH(SkiaDeterministicRendering,
 DEF_SWITCH(FlutterAssetsDir,
            "flutter-assets-dir",
            "Path to the Flutter assets directory.")
+DEF_SWITCH(EnableAssetLookupIndex,
+           "enable-asset-lookup-index",
+           "Remember which asset resolver provides each asset, and which "
+           "assets are missing, so that repeated lookups do not probe every "
+           "resolver. Must not be used when assets change while the app is "
+           "running.")
 DEF_SWITCH(Help, "help", "Display this help text.")
 DEF_SWITCH(LogTag, "log-tag", "Tag associated with log messages.")
 DEF_SWITCH(DisableServiceAuthCodes,
@@ -126,6 +146,12 @@ DEF_SWITCH(EnableServicePortFallback,
            "enable-service-port-fallback",
            "Allow the VM service to fallback to automatic port selection if"
            " binding to a specified port fails.")
+DEF_SWITCH(DeferVMServiceStartup,
+           "defer-vm-service-startup",
+           "Start the VM service at a low priority once the first frame has "
+           "been rasterized, instead of while the engine starts up. This "
+           "brings the startup times of profile builds closer to those of "
+           "release builds.")
 DEF_SWITCH(StartPaused,
            "start-paused",
            "Start the application paused in the Dart debugger.")
@@ -163,6 +189,11 @@ DEF_SWITCH(PurgePersistentCache,
            "purge-persistent-cache",
            "Remove all existing persistent cache. This is mainly for debugging "
            "purposes such as reproducing the shader compilation jank.")
+DEF_SWITCH(PackedPersistentCache,
+           "packed-persistent-cache",
+           "Store the persistent cache in a single indexed and compressed file "
+           "instead of a file per entry, which makes loading it a single "
+           "sequential read.")
 DEF_SWITCH(
     TraceSystrace,
     "trace-systrace",
@@ -229,6 +260,76 @@ DEF_SWITCH(OldGenHeapSize,
 DEF_SWITCH(ResourceCacheMaxBytesThreshold,
            "resource-cache-max-bytes-threshold",
            "The max bytes threshold of resource cache, or 0 for unlimited.")
+DEF_SWITCH(AnimatedImageDecodeAheadFrameCount,
+           "animated-image-decode-ahead-frame-count",
+           "The number of frames of an animated image that are decoded ahead "
+           "of the frame that is shown, or 0 to disable decoding ahead.")
+DEF_SWITCH(AnimatedImageDecodeAheadByteBudget,
+           "animated-image-decode-ahead-byte-budget",
+           "The bytes that the frames decoded ahead of all animated images may "
+           "take up.")
+DEF_SWITCH(RasterCacheLruEviction,
+           "raster-cache-lru-eviction",
+           "Keep raster cache entries through frames that do not use them, "
+           "evicting the least recently used entries when the cache exceeds "
+           "the resource cache limit.")
+DEF_SWITCH(RasterCacheCompression,
+           "raster-cache-compression",
+           "Store the images of opaque raster cache entries that have been "
+           "kept for a while as RGB565 to save memory.")
+DEF_SWITCH(RasterCacheBackgroundRasterization,
+           "raster-cache-background-rasterization",
+           "Rasterize raster cache entries on the concurrent worker threads "
+           "instead of the raster thread.")
+DEF_SWITCH(RasterCacheDeferredDisplayLists,
+           "raster-cache-deferred-display-lists",
+           "Experimental. Record the background raster cache entries into "
+           "Skia deferred display lists that the raster thread replays on "
+           "the GPU. Requires --raster-cache-background-rasterization.")
+DEF_SWITCH(SnapshotTextureBudgetMB,
+           "snapshot-texture-budget-mb",
+           "The megabytes of GPU textures that synchronously created "
+           "snapshot images may take up before the framework is sent a "
+           "memory pressure notification.")
+DEF_SWITCH(DropStaleFrames,
+           "drop-stale-frames",
+           "Replace frames that are still waiting to be rasterized with newer "
+           "ones while the rasterizer is falling behind.")
+DEF_SWITCH(PredictiveFrameScheduling,
+           "predictive-frame-scheduling",
+           "Start building frames that are predicted to miss their vsync "
+           "right away instead of waiting for the next vsync.")
+DEF_SWITCH(CoalescePointerData,
+           "coalesce-pointer-data",
+           "Dispatch the pointer moves that arrive within a frame to the "
+           "framework as a single packet at the next vsync.")
+DEF_SWITCH(MaxPendingPresents,
+           "max-pending-presents",
+           "The number of frames that may wait to be presented on a dedicated "
+           "present thread, or 0 to present on the raster thread.")
+DEF_SWITCH(UIThreadCpuAffinity,
+           "ui-thread-cpu-affinity",
+           "The bit mask of the CPUs the UI thread may run on, for example "
+           "0xf0 for CPUs 4 to 7.")
+DEF_SWITCH(RasterThreadCpuAffinity,
+           "raster-thread-cpu-affinity",
+           "The bit mask of the CPUs the raster thread may run on.")
+DEF_SWITCH(IOThreadCpuAffinity,
+           "io-thread-cpu-affinity",
+           "The bit mask of the CPUs the IO thread may run on.")
+DEF_SWITCH(SpawnedEnginesShareRenderingResources,
+           "spawned-engines-share-rendering-resources",
+           "Render the engines spawned from an engine with its Impeller "
+           "pipelines and glyph atlas.")
+DEF_SWITCH(DeferMetalDrawableAcquisition,
+           "defer-metal-drawable-acquisition",
+           "Acquire the drawable of the CAMetalLayer once the frame has been "
+           "recorded, and present it without waiting for the GPU work to be "
+           "scheduled. Only used on iOS.")
+DEF_SWITCH(MetalMaximumDrawableCount,
+           "metal-maximum-drawable-count",
+           "The maximum number of drawables of the CAMetalLayer, 2 or 3. Only "
+           "used on iOS.")
 DEF_SWITCH(EnableSkParagraph,
            "enable-skparagraph",
            "Selects the SkParagraph implementation of the text layout engine.")
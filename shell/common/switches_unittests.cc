@@ -58,6 +58,15 @@ TEST(SwitchesTest, RouteParsedFlag) {
   EXPECT_TRUE(settings.route.empty());
 }
 
+TEST(SwitchesTest, DeferVMServiceStartup) {
+  fml::CommandLine command_line =
+      fml::CommandLineFromInitializerList({"command"});
+  EXPECT_FALSE(SettingsFromCommandLine(command_line).defer_vm_service_startup);
+  command_line = fml::CommandLineFromInitializerList(
+      {"command", "--defer-vm-service-startup"});
+  EXPECT_TRUE(SettingsFromCommandLine(command_line).defer_vm_service_startup);
+}
+
 TEST(SwitchesTest, MsaaSamples) {
   for (int samples : {0, 1, 2, 4, 8, 16}) {
     fml::CommandLine command_line = fml::CommandLineFromInitializerList(
@@ -76,5 +85,15 @@ TEST(SwitchesTest, MsaaSamples) {
   EXPECT_EQ(settings.msaa_samples, 0);
 }
 
+TEST(SwitchesTest, ThreadCpuAffinities) {
+  fml::CommandLine command_line = fml::CommandLineFromInitializerList(
+      {"command", "--ui-thread-cpu-affinity=0xf0",
+       "--raster-thread-cpu-affinity=192", "--io-thread-cpu-affinity=foobar"});
+  Settings settings = SettingsFromCommandLine(command_line);
+  EXPECT_EQ(settings.ui_thread_cpu_affinity, 0xf0u);
+  EXPECT_EQ(settings.raster_thread_cpu_affinity, 192u);
+  EXPECT_EQ(settings.io_thread_cpu_affinity, 0u);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -56,6 +56,12 @@ void ThreadHost::ThreadHostConfig::SetProfilerConfig(
   profiler_config = config;
 }
 
+void ThreadHost::ThreadHostConfig::SetCpuAffinities(const Settings& settings) {
+  ui_cpu_affinity = settings.ui_thread_cpu_affinity;
+  raster_cpu_affinity = settings.raster_thread_cpu_affinity;
+  io_cpu_affinity = settings.io_thread_cpu_affinity;
+}
+
 std::unique_ptr<fml::Thread> ThreadHost::CreateThread(
     Type type,
     std::optional<ThreadConfig> thread_config,
@@ -65,6 +71,23 @@ std::unique_ptr<fml::Thread> ThreadHost::CreateThread(
     thread_config = ThreadConfig(
         ThreadHostConfig::MakeThreadName(type, host_config.name_prefix));
   }
+  uint64_t cpu_affinity = 0;
+  switch (type) {
+    case Type::UI:
+      cpu_affinity = host_config.ui_cpu_affinity;
+      break;
+    case Type::RASTER:
+      cpu_affinity = host_config.raster_cpu_affinity;
+      break;
+    case Type::IO:
+      cpu_affinity = host_config.io_cpu_affinity;
+      break;
+    default:
+      break;
+  }
+  if (cpu_affinity != 0) {
+    thread_config->cpu_affinity = cpu_affinity;
+  }
   return std::make_unique<fml::Thread>(host_config.config_setter,
                                        thread_config.value());
 }
@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 
+#include "flutter/common/settings.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/thread.h"
 
@@ -31,18 +32,18 @@ struct ThreadHost {
   /// configure in engine to info the thread.
   struct ThreadHostConfig {
     explicit ThreadHostConfig(
-        const ThreadConfigSetter& setter = fml::Thread::SetCurrentThreadName)
+        const ThreadConfigSetter& setter = fml::Thread::SetCurrentThreadConfig)
         : type_mask(0), config_setter(setter) {}
 
     ThreadHostConfig(
         const std::string& name_prefix,
         uint64_t mask,
-        const ThreadConfigSetter& setter = fml::Thread::SetCurrentThreadName)
+        const ThreadConfigSetter& setter = fml::Thread::SetCurrentThreadConfig)
         : type_mask(mask), name_prefix(name_prefix), config_setter(setter) {}
 
     explicit ThreadHostConfig(
         uint64_t mask,
-        const ThreadConfigSetter& setter = fml::Thread::SetCurrentThreadName)
+        const ThreadConfigSetter& setter = fml::Thread::SetCurrentThreadConfig)
         : ThreadHostConfig("", mask, setter) {}
 
     /// Check if need to create thread.
@@ -66,6 +67,11 @@ struct ThreadHost {
     /// Specified the ProfilerThread  Config, meanwhile set the mask.
     void SetProfilerConfig(const ThreadConfig&);
 
+    /// Pins the UI, raster and IO threads to the CPUs in the affinity masks
+    /// of the settings. The masks override the CPU affinities of the thread
+    /// configs unless they are 0.
+    void SetCpuAffinities(const Settings& settings);
+
     uint64_t type_mask;
 
     std::string name_prefix = "";
@@ -77,6 +83,10 @@ struct ThreadHost {
     std::optional<ThreadConfig> raster_config;
     std::optional<ThreadConfig> io_config;
     std::optional<ThreadConfig> profiler_config;
+
+    uint64_t ui_cpu_affinity = 0;
+    uint64_t raster_cpu_affinity = 0;
+    uint64_t io_cpu_affinity = 0;
   };
 
   std::string name_prefix;
@@ -137,21 +137,23 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
     fml::TaskQueueId ui_task_queue_id =
         task_runners_.GetUITaskRunner()->GetTaskQueueId();
 
-    task_runners_.GetUITaskRunner()->PostTask(
-        [ui_task_queue_id, callback, flow_identifier, frame_start_time,
-         frame_target_time, pause_secondary_tasks]() {
-          FML_TRACE_EVENT("flutter", kVsyncTraceName, "StartTime",
-                          frame_start_time, "TargetTime", frame_target_time);
-          std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder =
-              std::make_unique<FrameTimingsRecorder>();
-          frame_timings_recorder->RecordVsync(frame_start_time,
-                                              frame_target_time);
-          callback(std::move(frame_timings_recorder));
-          TRACE_FLOW_END("flutter", kVsyncFlowName, flow_identifier);
-          if (pause_secondary_tasks) {
-            ResumeDartMicroTasks(ui_task_queue_id);
-          }
-        });
+    auto frame_task = [ui_task_queue_id, callback, flow_identifier,
+                       frame_start_time, frame_target_time,
+                       pause_secondary_tasks]() {
+      FML_TRACE_EVENT("flutter", kVsyncTraceName, "StartTime",
+                      frame_start_time, "TargetTime", frame_target_time);
+      std::unique_ptr<FrameTimingsRecorder> frame_timings_recorder =
+          std::make_unique<FrameTimingsRecorder>();
+      frame_timings_recorder->RecordVsync(frame_start_time, frame_target_time);
+      callback(std::move(frame_timings_recorder));
+      TRACE_FLOW_END("flutter", kVsyncFlowName, flow_identifier);
+      if (pause_secondary_tasks) {
+        ResumeDartMicroTasks(ui_task_queue_id);
+      }
+    };
+    // The frame is the most important work on the UI thread.
+    task_runners_.GetUITaskRunner()->PostTaskWithGrade(
+        frame_task, fml::TaskSourceGrade::kUserInteraction);
   }
 
   for (auto& secondary_callback : secondary_callbacks) {
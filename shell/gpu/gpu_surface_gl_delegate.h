@@ -6,6 +6,7 @@
 #define FLUTTER_SHELL_GPU_GPU_SURFACE_GL_DELEGATE_H_
 
 #include <optional>
+#include <vector>
 
 #include "flutter/common/graphics/gl_context_switch.h"
 #include "flutter/flow/embedded_views.h"
@@ -48,6 +49,15 @@ struct GLPresentInfo {
   // The buffer damage refers to the region that needs to be set as damaged
   // within the frame buffer.
   const std::optional<SkIRect>& buffer_damage;
+
+  // Disjoint rects that cover the changed parts of frame_damage and
+  // buffer_damage, which are their bounds. Empty if the rects are not known,
+  // in which case the damage covers the whole of its bounds.
+  std::vector<SkIRect> frame_damage_rects = {};
+  std::vector<SkIRect> buffer_damage_rects = {};
+
+  // The number of the frame that is presented, or zero if it is not known.
+  uint64_t frame_number = 0;
 };
 
 class GPUSurfaceGLDelegate {
@@ -38,6 +38,8 @@ GPUSurfaceGLImpeller::GPUSurfaceGLImpeller(
   impeller_context_ = std::move(context);
   impeller_renderer_ = std::move(renderer);
   aiks_context_ = std::move(aiks_context);
+  picture_cache_ = std::make_shared<impeller::DisplayListPictureCache>();
+  pass_pool_ = std::make_shared<impeller::EntityPassPool>();
   is_valid_ = true;
 }
 
@@ -57,16 +59,23 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceGLImpeller::AcquireFrame(
     return nullptr;
   }
 
+  // The damage of the frame is only known once the frame is submitted, which
+  // is after the surface that presents it has been wrapped.
+  auto submit_info = std::make_shared<SurfaceFrame::SubmitInfo>();
+
   auto swap_callback = [weak = weak_factory_.GetWeakPtr(),
-                        delegate = delegate_]() -> bool {
+                        delegate = delegate_, submit_info]() -> bool {
     if (weak) {
       GLPresentInfo present_info = {
           .fbo_id = 0,
-          .frame_damage = std::nullopt,
+          .frame_damage = submit_info->frame_damage,
           // TODO (https://github.com/flutter/flutter/issues/105597): wire-up
           // presentation time to impeller backend.
           .presentation_time = std::nullopt,
-          .buffer_damage = std::nullopt,
+          .buffer_damage = submit_info->buffer_damage,
+          .frame_damage_rects = submit_info->frame_damage_rects,
+          .buffer_damage_rects = submit_info->buffer_damage_rects,
+          .frame_number = submit_info->frame_number,
       };
       delegate->GLContextPresent(present_info);
     }
@@ -89,40 +98,75 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceGLImpeller::AcquireFrame(
   );
 
   SurfaceFrame::SubmitCallback submit_callback =
-      fml::MakeCopyable([renderer = impeller_renderer_,  //
-                         aiks_context = aiks_context_,   //
-                         surface = std::move(surface)    //
+      fml::MakeCopyable([renderer = impeller_renderer_,   //
+                         aiks_context = aiks_context_,    //
+                         picture_cache = picture_cache_,  //
+                         pass_pool = pass_pool_,          //
+                         delegate = delegate_,            //
+                         submit_info,                     //
+                         surface = std::move(surface)     //
   ](SurfaceFrame& surface_frame, SkCanvas* canvas) mutable -> bool {
         if (!aiks_context) {
           return false;
         }
 
+        *submit_info = surface_frame.submit_info();
+        const auto buffer_damage = submit_info->buffer_damage;
+        delegate->GLContextSetDamageRegion(buffer_damage);
+
         auto display_list = surface_frame.BuildDisplayList();
         if (!display_list) {
           FML_LOG(ERROR) << "Could not build display list for surface frame.";
           return false;
         }
 
-        impeller::DisplayListDispatcher impeller_dispatcher;
+        impeller::DisplayListDispatcher impeller_dispatcher(picture_cache,
+                                                            pass_pool);
         display_list->Dispatch(impeller_dispatcher);
         auto picture = impeller_dispatcher.EndRecordingAsPicture();
+        picture_cache->EndFrame();
 
         return renderer->Render(
             std::move(surface),
             fml::MakeCopyable(
-                [aiks_context, picture = std::move(picture)](
-                    impeller::RenderTarget& render_target) -> bool {
-                  return aiks_context->Render(picture, render_target);
+                [aiks_context, pass_pool, buffer_damage,
+                 picture = std::move(picture)](
+                    impeller::RenderTarget& render_target) mutable -> bool {
+                  if (buffer_damage.has_value()) {
+                    // Only the damaged part of the buffer is redrawn, the
+                    // rest is kept from the last frame presented in it.
+                    auto color0 =
+                        render_target.GetColorAttachments().find(0)->second;
+                    color0.load_action = impeller::LoadAction::kLoad;
+                    render_target.SetColorAttachment(color0, 0u);
+                    picture.pass->SetTargetDamage(impeller::Rect::MakeLTRB(
+                        buffer_damage->left(), buffer_damage->top(),
+                        buffer_damage->right(), buffer_damage->bottom()));
+                  }
+                  auto rendered = aiks_context->Render(picture, render_target);
+                  pass_pool->Recycle(std::move(picture));
+                  return rendered;
                 }));
       });
 
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  const auto delegate_info = delegate_->GLContextFramebufferInfo();
+  if (delegate_info.supports_partial_repaint) {
+    framebuffer_info.supports_partial_repaint = true;
+    framebuffer_info.existing_damage = delegate_info.existing_damage;
+    framebuffer_info.horizontal_clip_alignment =
+        delegate_info.horizontal_clip_alignment;
+    framebuffer_info.vertical_clip_alignment =
+        delegate_info.vertical_clip_alignment;
+  }
+
   return std::make_unique<SurfaceFrame>(
-      nullptr,                          // surface
-      SurfaceFrame::FramebufferInfo{},  // framebuffer info
-      submit_callback,                  // submit callback
-      size,                             // frame size
-      std::move(context_switch),        // context result
-      true                              // display list fallback
+      nullptr,                    // surface
+      framebuffer_info,           // framebuffer info
+      submit_callback,            // submit callback
+      size,                       // frame size
+      std::move(context_switch),  // context result
+      true                        // display list fallback
   );
 }
 
@@ -154,11 +198,6 @@ bool GPUSurfaceGLImpeller::AllowsDrawingWhenGpuDisabled() const {
   return delegate_->AllowsDrawingWhenGpuDisabled();
 }
 
-// |Surface|
-bool GPUSurfaceGLImpeller::EnableRasterCache() const {
-  return false;
-}
-
 // |Surface|
 impeller::AiksContext* GPUSurfaceGLImpeller::GetAiksContext() const {
   return aiks_context_.get();
@@ -10,6 +10,8 @@
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/impeller/aiks/aiks_context.h"
+#include "flutter/impeller/aiks/entity_pass_pool.h"
+#include "flutter/impeller/display_list/display_list_picture_cache.h"
 #include "flutter/impeller/renderer/context.h"
 #include "flutter/shell/gpu/gpu_surface_gl_delegate.h"
 
@@ -31,6 +33,8 @@ class GPUSurfaceGLImpeller final : public Surface {
   std::shared_ptr<impeller::Context> impeller_context_;
   std::shared_ptr<impeller::Renderer> impeller_renderer_;
   std::shared_ptr<impeller::AiksContext> aiks_context_;
+  std::shared_ptr<impeller::DisplayListPictureCache> picture_cache_;
+  std::shared_ptr<impeller::EntityPassPool> pass_pool_;
   bool is_valid_ = false;
   fml::WeakPtrFactory<GPUSurfaceGLImpeller> weak_factory_;
 
@@ -52,9 +56,6 @@ class GPUSurfaceGLImpeller final : public Surface {
   // |Surface|
   bool AllowsDrawingWhenGpuDisabled() const override;
 
-  // |Surface|
-  bool EnableRasterCache() const override;
-
   // |Surface|
   impeller::AiksContext* GetAiksContext() const override;
 
@@ -20,4 +20,8 @@ bool GPUSurfaceMetalDelegate::AllowsDrawingWhenGpuDisabled() const {
   return true;
 }
 
+bool GPUSurfaceMetalDelegate::DefersDrawableAcquisition() const {
+  return false;
+}
+
 }  // namespace flutter
@@ -94,6 +94,15 @@ class GPUSurfaceMetalDelegate {
   ///
   virtual bool AllowsDrawingWhenGpuDisabled() const;
 
+  //------------------------------------------------------------------------------
+  /// @brief Whether the drawable of the CAMetalLayer is acquired only once the
+  /// frame has been recorded, instead of when the frame is acquired. The
+  /// drawable is then held for as short as possible, but the frame can't be
+  /// repainted partially. This is only called when the specified render target
+  /// type is `kCAMetalLayer`.
+  ///
+  virtual bool DefersDrawableAcquisition() const;
+
   MTLRenderTargetType GetRenderTargetType();
 
  private:
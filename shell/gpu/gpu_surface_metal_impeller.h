@@ -8,6 +8,8 @@
 #include "flutter/flow/surface.h"
 #include "flutter/fml/macros.h"
 #include "flutter/impeller/aiks/aiks_context.h"
+#include "flutter/impeller/aiks/entity_pass_pool.h"
+#include "flutter/impeller/display_list/display_list_picture_cache.h"
 #include "flutter/impeller/renderer/renderer.h"
 #include "flutter/shell/gpu/gpu_surface_metal_delegate.h"
 
@@ -15,8 +17,11 @@ namespace flutter {
 
 class SK_API_AVAILABLE_CA_METAL_LAYER GPUSurfaceMetalImpeller : public Surface {
  public:
+  // Renders with |aiks_context| if it isn't null, or with an Aiks context of
+  // its own otherwise.
   GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delegate,
-                          const std::shared_ptr<impeller::Context>& context);
+                          const std::shared_ptr<impeller::Context>& context,
+                          std::shared_ptr<impeller::AiksContext> aiks_context);
 
   // |Surface|
   ~GPUSurfaceMetalImpeller();
@@ -28,6 +33,8 @@ class SK_API_AVAILABLE_CA_METAL_LAYER GPUSurfaceMetalImpeller : public Surface {
   const GPUSurfaceMetalDelegate* delegate_;
   std::shared_ptr<impeller::Renderer> impeller_renderer_;
   std::shared_ptr<impeller::AiksContext> aiks_context_;
+  std::shared_ptr<impeller::DisplayListPictureCache> picture_cache_;
+  std::shared_ptr<impeller::EntityPassPool> pass_pool_;
 
   // |Surface|
   std::unique_ptr<SurfaceFrame> AcquireFrame(const SkISize& size) override;
@@ -44,9 +51,6 @@ class SK_API_AVAILABLE_CA_METAL_LAYER GPUSurfaceMetalImpeller : public Surface {
   // |Surface|
   bool AllowsDrawingWhenGpuDisabled() const override;
 
-  // |Surface|
-  bool EnableRasterCache() const override;
-
   // |Surface|
   impeller::AiksContext* GetAiksContext() const override;
 
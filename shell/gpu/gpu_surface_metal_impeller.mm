@@ -9,6 +9,7 @@
 
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/platform/darwin/scoped_nsobject.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/impeller/display_list/display_list_dispatcher.h"
 #include "flutter/impeller/renderer/backend/metal/surface_mtl.h"
@@ -27,12 +28,17 @@ static std::shared_ptr<impeller::Renderer> CreateImpellerRenderer(
   return renderer;
 }
 
-GPUSurfaceMetalImpeller::GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delegate,
-                                                 const std::shared_ptr<impeller::Context>& context)
+GPUSurfaceMetalImpeller::GPUSurfaceMetalImpeller(
+    GPUSurfaceMetalDelegate* delegate,
+    const std::shared_ptr<impeller::Context>& context,
+    std::shared_ptr<impeller::AiksContext> aiks_context)
     : delegate_(delegate),
       impeller_renderer_(CreateImpellerRenderer(context)),
-      aiks_context_(
-          std::make_shared<impeller::AiksContext>(impeller_renderer_ ? context : nullptr)) {}
+      aiks_context_(aiks_context ? std::move(aiks_context)
+                                 : std::make_shared<impeller::AiksContext>(
+                                       impeller_renderer_ ? context : nullptr)),
+      picture_cache_(std::make_shared<impeller::DisplayListPictureCache>()),
+      pass_pool_(std::make_shared<impeller::EntityPassPool>()) {}
 
 GPUSurfaceMetalImpeller::~GPUSurfaceMetalImpeller() = default;
 
@@ -58,13 +64,21 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrame(const SkISiz
 
   auto* mtl_layer = (CAMetalLayer*)layer;
 
-  auto surface = impeller::SurfaceMTL::WrapCurrentMetalLayerDrawable(
-      impeller_renderer_->GetContext(), mtl_layer);
+  // When the acquisition is deferred, the drawable is only acquired once the
+  // display list has been recorded into a picture.
+  std::unique_ptr<impeller::Surface> surface;
+  if (!delegate_->DefersDrawableAcquisition()) {
+    surface = impeller::SurfaceMTL::WrapCurrentMetalLayerDrawable(
+        impeller_renderer_->GetContext(), mtl_layer);
+  }
 
   SurfaceFrame::SubmitCallback submit_callback =
-      fml::MakeCopyable([renderer = impeller_renderer_,  //
-                         aiks_context = aiks_context_,   //
-                         surface = std::move(surface)    //
+      fml::MakeCopyable([renderer = impeller_renderer_,   //
+                         aiks_context = aiks_context_,    //
+                         picture_cache = picture_cache_,  //
+                         pass_pool = pass_pool_,          //
+                         surface = std::move(surface),    //
+                         layer = fml::scoped_nsobject<CAMetalLayer>([mtl_layer retain])  //
   ](SurfaceFrame& surface_frame, SkCanvas* canvas) mutable -> bool {
         if (!aiks_context) {
           return false;
@@ -76,15 +90,24 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrame(const SkISiz
           return false;
         }
 
-        impeller::DisplayListDispatcher impeller_dispatcher;
+        impeller::DisplayListDispatcher impeller_dispatcher(picture_cache, pass_pool);
         display_list->Dispatch(impeller_dispatcher);
         auto picture = impeller_dispatcher.EndRecordingAsPicture();
+        picture_cache->EndFrame();
+
+        if (!surface) {
+          TRACE_EVENT0("impeller", "AcquireDeferredDrawable");
+          surface = impeller::SurfaceMTL::WrapCurrentMetalLayerDrawable(
+              renderer->GetContext(), layer.get());
+        }
 
         return renderer->Render(
             std::move(surface),
-            fml::MakeCopyable([aiks_context, picture = std::move(picture)](
-                                  impeller::RenderTarget& render_target) -> bool {
-              return aiks_context->Render(picture, render_target);
+            fml::MakeCopyable([aiks_context, pass_pool, picture = std::move(picture)](
+                                  impeller::RenderTarget& render_target) mutable -> bool {
+              auto rendered = aiks_context->Render(picture, render_target);
+              pass_pool->Recycle(std::move(picture));
+              return rendered;
             }));
       });
 
@@ -119,11 +142,6 @@ bool GPUSurfaceMetalImpeller::AllowsDrawingWhenGpuDisabled() const {
   return delegate_->AllowsDrawingWhenGpuDisabled();
 }
 
-// |Surface|
-bool GPUSurfaceMetalImpeller::EnableRasterCache() const {
-  return false;
-}
-
 // |Surface|
 impeller::AiksContext* GPUSurfaceMetalImpeller::GetAiksContext() const {
   return aiks_context_.get();
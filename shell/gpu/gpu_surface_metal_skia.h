@@ -62,6 +62,12 @@ class SK_API_AVAILABLE_CA_METAL_LAYER GPUSurfaceMetalSkia : public Surface {
   std::unique_ptr<SurfaceFrame> AcquireFrameFromCAMetalLayer(
       const SkISize& frame_info);
 
+  // Creates a surface that only acquires the drawable of the layer when Skia
+  // flushes the frame into it.
+  std::unique_ptr<SurfaceFrame> AcquireDeferredFrameFromCAMetalLayer(
+      GPUCAMetalLayerHandle layer,
+      const SkISize& frame_info);
+
   std::unique_ptr<SurfaceFrame> AcquireFrameFromMTLTexture(
       const SkISize& frame_info);
 
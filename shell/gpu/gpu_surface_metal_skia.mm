@@ -122,7 +122,12 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireFrameFromCAMetalLayer(
     return nullptr;
   }
 
+  if (delegate_->DefersDrawableAcquisition()) {
+    return AcquireDeferredFrameFromCAMetalLayer(layer, frame_info);
+  }
+
   auto* mtl_layer = (CAMetalLayer*)layer;
+
   // Get the drawable eagerly, we will need texture object to identify target framebuffer
   fml::scoped_nsprotocol<id<CAMetalDrawable>> drawable(
       reinterpret_cast<id<CAMetalDrawable>>([[mtl_layer nextDrawable] retain]));
@@ -193,6 +198,60 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireFrameFromCAMetalLayer(
                                         frame_info);
 }
 
+std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireDeferredFrameFromCAMetalLayer(
+    GPUCAMetalLayerHandle layer,
+    const SkISize& frame_info) {
+  // Skia stores a retained reference to the drawable here when it acquires it.
+  auto drawable = std::make_shared<GrMTLHandle>(nullptr);
+  auto surface = SkSurface::MakeFromCAMetalLayer(context_.get(),                   // context
+                                                 layer,                            // layer
+                                                 kTopLeft_GrSurfaceOrigin,         // origin
+                                                 static_cast<int>(msaa_samples_),  // sample count
+                                                 kBGRA_8888_SkColorType,           // color type
+                                                 nullptr,                          // colorspace
+                                                 nullptr,                          // surface props
+                                                 drawable.get()                    // drawable
+  );
+
+  if (!surface) {
+    FML_LOG(ERROR) << "Could not create the SkSurface from the CAMetalLayer.";
+    return nullptr;
+  }
+
+  auto submit_callback = [this, drawable](const SurfaceFrame& surface_frame,
+                                          SkCanvas* canvas) -> bool {
+    TRACE_EVENT0("flutter", "GPUSurfaceMetal::Submit");
+    if (canvas == nullptr) {
+      FML_DLOG(ERROR) << "Canvas not available.";
+      return false;
+    }
+
+    {
+      TRACE_EVENT0("flutter", "SkCanvas::Flush");
+      canvas->flush();
+    }
+
+    // Adopts the reference Skia retained for the drawable.
+    fml::scoped_nsprotocol<id<CAMetalDrawable>> current_drawable(
+        reinterpret_cast<id<CAMetalDrawable>>(*drawable));
+    *drawable = nullptr;
+    if (!current_drawable.get()) {
+      FML_LOG(ERROR) << "Could not obtain drawable from the metal layer.";
+      return false;
+    }
+
+    return delegate_->PresentDrawable(current_drawable);
+  };
+
+  // The texture of the drawable isn't known until it is acquired, so the damage
+  // of its previous frames can't be tracked.
+  SurfaceFrame::FramebufferInfo framebuffer_info;
+  framebuffer_info.supports_readback = true;
+
+  return std::make_unique<SurfaceFrame>(std::move(surface), framebuffer_info, submit_callback,
+                                        frame_info);
+}
+
 std::unique_ptr<SurfaceFrame> GPUSurfaceMetalSkia::AcquireFrameFromMTLTexture(
     const SkISize& frame_info) {
   GPUMTLTextureInfo texture = delegate_->GetMTLTexture(frame_info);
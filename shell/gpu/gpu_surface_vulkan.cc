@@ -61,25 +61,32 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkan::AcquireFrame(
     return nullptr;
   }
 
-  SurfaceFrame::SubmitCallback callback = [image = image, delegate = delegate_](
-                                              const SurfaceFrame&,
-                                              SkCanvas* canvas) -> bool {
-    TRACE_EVENT0("flutter", "GPUSurfaceVulkan::PresentImage");
+  SurfaceFrame::SubmitCallback callback = [](const SurfaceFrame&,
+                                             SkCanvas* canvas) -> bool {
     if (canvas == nullptr) {
       FML_DLOG(ERROR) << "Canvas not available.";
       return false;
     }
 
     canvas->flush();
+    return true;
+  };
 
+  // Handing the image to the embedder does not touch the Skia context, so it
+  // may happen off the raster thread.
+  SurfaceFrame::PresentCallback present_callback = [image = image,
+                                                    delegate = delegate_]() {
+    TRACE_EVENT0("flutter", "GPUSurfaceVulkan::PresentImage");
     return delegate->PresentImage(reinterpret_cast<VkImage>(image.image),
                                   static_cast<VkFormat>(image.format));
   };
 
   SurfaceFrame::FramebufferInfo framebuffer_info{.supports_readback = true};
 
-  return std::make_unique<SurfaceFrame>(std::move(surface), framebuffer_info,
-                                        std::move(callback), frame_size);
+  auto surface_frame = std::make_unique<SurfaceFrame>(
+      std::move(surface), framebuffer_info, std::move(callback), frame_size);
+  surface_frame->set_present_callback(std::move(present_callback));
+  return surface_frame;
 }
 
 SkMatrix GPUSurfaceVulkan::GetRootTransformation() const {
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/gpu/gpu_surface_vulkan_impeller.h"
 
+#include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/impeller/display_list/display_list_dispatcher.h"
 #include "flutter/impeller/renderer/renderer.h"
@@ -12,7 +13,8 @@
 namespace flutter {
 
 GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
-    std::shared_ptr<impeller::Context> context)
+    std::shared_ptr<impeller::Context> context,
+    std::shared_ptr<impeller::AiksContext> aiks_context)
     : weak_factory_(this) {
   if (!context || !context->IsValid()) {
     return;
@@ -23,7 +25,10 @@ GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
     return;
   }
 
-  auto aiks_context = std::make_shared<impeller::AiksContext>(context);
+  if (!aiks_context) {
+    aiks_context = std::make_shared<impeller::AiksContext>(context);
+  }
+  FML_DCHECK(aiks_context->GetContext() == context);
   if (!aiks_context->IsValid()) {
     return;
   }
@@ -31,6 +36,8 @@ GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
   impeller_context_ = std::move(context);
   impeller_renderer_ = std::move(renderer);
   aiks_context_ = std::move(aiks_context);
+  picture_cache_ = std::make_shared<impeller::DisplayListPictureCache>();
+  pass_pool_ = std::make_shared<impeller::EntityPassPool>();
   is_valid_ = true;
 }
 
@@ -56,8 +63,12 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
   }
 
   auto& context_vk = impeller::ContextVK::Cast(*impeller_context_);
-  std::unique_ptr<impeller::Surface> surface =
-      context_vk.AcquireSurface(frame_num_++);
+  std::unique_ptr<impeller::Surface> surface = context_vk.AcquireSurface(
+      frame_num_++, impeller::ISize(size.width(), size.height()));
+  if (!surface) {
+    FML_LOG(ERROR) << "Could not acquire a Vulkan surface.";
+    return nullptr;
+  }
 
   auto swap_callback = [weak = weak_factory_.GetWeakPtr()]() -> bool {
     if (weak) {
@@ -68,9 +79,11 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
   };
 
   SurfaceFrame::SubmitCallback submit_callback =
-      fml::MakeCopyable([renderer = impeller_renderer_,  //
-                         aiks_context = aiks_context_,   //
-                         surface = std::move(surface)    //
+      fml::MakeCopyable([renderer = impeller_renderer_,   //
+                         aiks_context = aiks_context_,    //
+                         picture_cache = picture_cache_,  //
+                         pass_pool = pass_pool_,          //
+                         surface = std::move(surface)     //
   ](SurfaceFrame& surface_frame, SkCanvas* canvas) mutable -> bool {
         if (!aiks_context) {
           return false;
@@ -82,16 +95,20 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
           return false;
         }
 
-        impeller::DisplayListDispatcher impeller_dispatcher;
+        impeller::DisplayListDispatcher impeller_dispatcher(picture_cache,
+                                                            pass_pool);
         display_list->Dispatch(impeller_dispatcher);
         auto picture = impeller_dispatcher.EndRecordingAsPicture();
+        picture_cache->EndFrame();
 
         return renderer->Render(
             std::move(surface),
             fml::MakeCopyable(
-                [aiks_context, picture = std::move(picture)](
-                    impeller::RenderTarget& render_target) -> bool {
-                  return aiks_context->Render(picture, render_target);
+                [aiks_context, pass_pool, picture = std::move(picture)](
+                    impeller::RenderTarget& render_target) mutable -> bool {
+                  auto rendered = aiks_context->Render(picture, render_target);
+                  pass_pool->Recycle(std::move(picture));
+                  return rendered;
                 }));
       });
 
@@ -125,11 +142,6 @@ GPUSurfaceVulkanImpeller::MakeRenderContextCurrent() {
   return std::make_unique<GLContextDefaultResult>(true);
 }
 
-// |Surface|
-bool GPUSurfaceVulkanImpeller::EnableRasterCache() const {
-  return false;
-}
-
 // |Surface|
 impeller::AiksContext* GPUSurfaceVulkanImpeller::GetAiksContext() const {
   return aiks_context_.get();
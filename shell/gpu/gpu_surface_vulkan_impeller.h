@@ -9,6 +9,8 @@
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/impeller/aiks/aiks_context.h"
+#include "flutter/impeller/aiks/entity_pass_pool.h"
+#include "flutter/impeller/display_list/display_list_picture_cache.h"
 #include "flutter/impeller/renderer/context.h"
 #include "flutter/shell/gpu/gpu_surface_vulkan_delegate.h"
 
@@ -16,7 +18,10 @@ namespace flutter {
 
 class GPUSurfaceVulkanImpeller final : public Surface {
  public:
-  explicit GPUSurfaceVulkanImpeller(std::shared_ptr<impeller::Context> context);
+  // Renders with |aiks_context| if it isn't null, or with an Aiks context of
+  // its own otherwise. |aiks_context| must use |context|.
+  GPUSurfaceVulkanImpeller(std::shared_ptr<impeller::Context> context,
+                           std::shared_ptr<impeller::AiksContext> aiks_context);
 
   // |Surface|
   ~GPUSurfaceVulkanImpeller() override;
@@ -28,6 +33,8 @@ class GPUSurfaceVulkanImpeller final : public Surface {
   std::shared_ptr<impeller::Context> impeller_context_;
   std::shared_ptr<impeller::Renderer> impeller_renderer_;
   std::shared_ptr<impeller::AiksContext> aiks_context_;
+  std::shared_ptr<impeller::DisplayListPictureCache> picture_cache_;
+  std::shared_ptr<impeller::EntityPassPool> pass_pool_;
   bool is_valid_ = false;
   uint64_t frame_num_ = 0;
   fml::WeakPtrFactory<GPUSurfaceVulkanImpeller> weak_factory_;
@@ -44,9 +51,6 @@ class GPUSurfaceVulkanImpeller final : public Surface {
   // |Surface|
   std::unique_ptr<GLContextResult> MakeRenderContextCurrent() override;
 
-  // |Surface|
-  bool EnableRasterCache() const override;
-
   // |Surface|
   impeller::AiksContext* GetAiksContext() const override;
 
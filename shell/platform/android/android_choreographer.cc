@@ -17,8 +17,16 @@ typedef void (*AChoreographer_postFrameCallback_FPN)(
     AChoreographer* choreographer,
     AChoreographer_frameCallback callback,
     void* data);
+typedef void (*AChoreographer_refreshRateCallback)(int64_t vsyncPeriodNanos,
+                                                   void* data);
+typedef void (*AChoreographer_registerRefreshRateCallback_FPN)(
+    AChoreographer* choreographer,
+    AChoreographer_refreshRateCallback callback,
+    void* data);
 static AChoreographer_getInstance_FPN AChoreographer_getInstance;
 static AChoreographer_postFrameCallback_FPN AChoreographer_postFrameCallback;
+static AChoreographer_registerRefreshRateCallback_FPN
+    AChoreographer_registerRefreshRateCallback;
 
 namespace flutter {
 
@@ -45,6 +53,13 @@ bool AndroidChoreographer::ShouldUseNDKChoreographer() {
   if (get_instance_fn && post_frame_callback_fn) {
     AChoreographer_getInstance = get_instance_fn.value();
     AChoreographer_postFrameCallback = post_frame_callback_fn.value();
+    auto register_refresh_rate_callback_fn = libandroid->ResolveFunction<
+        AChoreographer_registerRefreshRateCallback_FPN>(
+        "AChoreographer_registerRefreshRateCallback");
+    if (register_refresh_rate_callback_fn) {
+      AChoreographer_registerRefreshRateCallback =
+          register_refresh_rate_callback_fn.value();
+    }
     use_ndk_choreographer = true;
   } else {
     use_ndk_choreographer = false;
@@ -58,4 +73,16 @@ void AndroidChoreographer::PostFrameCallback(OnFrameCallback callback,
   AChoreographer_postFrameCallback(choreographer, callback, data);
 }
 
+bool AndroidChoreographer::RegisterRefreshRateCallback(
+    OnRefreshRateCallback callback,
+    void* data) {
+  if (!ShouldUseNDKChoreographer() ||
+      !AChoreographer_registerRefreshRateCallback) {
+    return false;
+  }
+  AChoreographer* choreographer = AChoreographer_getInstance();
+  AChoreographer_registerRefreshRateCallback(choreographer, callback, data);
+  return true;
+}
+
 }  // namespace flutter
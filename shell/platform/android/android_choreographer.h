@@ -19,9 +19,21 @@ namespace flutter {
 class AndroidChoreographer {
  public:
   typedef void (*OnFrameCallback)(int64_t frame_time_nanos, void* data);
+  typedef void (*OnRefreshRateCallback)(int64_t vsync_period_nanos,
+                                        void* data);
   static bool ShouldUseNDKChoreographer();
   static void PostFrameCallback(OnFrameCallback callback, void* data);
 
+  // Registers |callback| to be called on the current thread whenever the
+  // refresh rate of the display changes, and once right away. Returns false
+  // if the NDK doesn't support refresh rate callbacks, which were added in
+  // API level 30.
+  //
+  // Like |PostFrameCallback|, this must be called on a thread that has a
+  // looper.
+  static bool RegisterRefreshRateCallback(OnRefreshRateCallback callback,
+                                          void* data);
+
   FML_DISALLOW_COPY_AND_ASSIGN(AndroidChoreographer);
 };
 
@@ -5,6 +5,8 @@
 #include "flutter/shell/platform/android/android_display.h"
 #include "android_display.h"
 
+#include "flutter/shell/platform/android/vsync_waiter_android.h"
+
 namespace flutter {
 
 AndroidDisplay::AndroidDisplay(
@@ -13,6 +15,11 @@ AndroidDisplay::AndroidDisplay(
       jni_facade_(std::move(jni_facade)) {}
 
 double AndroidDisplay::GetRefreshRate() const {
+  // The choreographer reports refresh rate switches as they happen, while
+  // the Java refresh rate is only updated by display listeners.
+  if (auto refresh_rate = VsyncWaiterAndroid::GetRefreshRateFromNDK()) {
+    return refresh_rate.value();
+  }
   return jni_facade_->GetDisplayRefreshRate();
 }
 
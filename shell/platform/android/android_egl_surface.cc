@@ -151,14 +151,26 @@ class AndroidEGLSurfaceDamage {
 
   bool SwapBuffersWithDamage(EGLDisplay display,
                              EGLSurface surface,
-                             const std::optional<SkIRect>& damage) {
+                             const std::optional<SkIRect>& damage,
+                             const std::vector<SkIRect>& damage_rects) {
     if (swap_buffers_with_damage_ && damage) {
       damage_history_.push_back(*damage);
       if (damage_history_.size() > kMaxHistorySize) {
         damage_history_.pop_front();
       }
-      auto rects = RectToInts(display, surface, *damage);
-      return swap_buffers_with_damage_(display, surface, rects.data(), 1);
+      if (damage_rects.empty()) {
+        auto rects = RectToInts(display, surface, *damage);
+        return swap_buffers_with_damage_(display, surface, rects.data(), 1);
+      }
+      std::vector<EGLint> rects;
+      rects.reserve(damage_rects.size() * 4);
+      for (const auto& damage_rect : damage_rects) {
+        auto rect = RectToInts(display, surface, damage_rect);
+        rects.insert(rects.end(), rect.begin(), rect.end());
+      }
+      return swap_buffers_with_damage_(
+          display, surface, rects.data(),
+          static_cast<EGLint>(damage_rects.size()));
     } else {
       return eglSwapBuffers(display, surface);
     }
@@ -256,9 +268,11 @@ bool AndroidEGLSurface::SetPresentationTime(
 }
 
 bool AndroidEGLSurface::SwapBuffers(
-    const std::optional<SkIRect>& surface_damage) {
+    const std::optional<SkIRect>& surface_damage,
+    const std::vector<SkIRect>& surface_damage_rects) {
   TRACE_EVENT0("flutter", "AndroidContextGL::SwapBuffers");
-  return damage_->SwapBuffersWithDamage(display_, surface_, surface_damage);
+  return damage_->SwapBuffersWithDamage(display_, surface_, surface_damage,
+                                        surface_damage_rects);
 }
 
 bool AndroidEGLSurface::SupportsPartialRepaint() const {
@@ -9,6 +9,7 @@
 #include <EGL/eglext.h>
 #include <KHR/khrplatform.h>
 #include <optional>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_point.h"
@@ -91,9 +92,13 @@ class AndroidEGLSurface {
   /// @brief      This only applies to on-screen surfaces such as those created
   ///             by `AndroidContextGL::CreateOnscreenSurface`.
   ///
+  ///             The compositor is told that `surface_damage_rects` changed,
+  ///             or all of `surface_damage` if the rects are empty.
+  ///
   /// @return     Whether the EGL surface color buffer was swapped.
   ///
-  bool SwapBuffers(const std::optional<SkIRect>& surface_damage);
+  bool SwapBuffers(const std::optional<SkIRect>& surface_damage,
+                   const std::vector<SkIRect>& surface_damage_rects = {});
 
   //----------------------------------------------------------------------------
   /// @return     The size of an `EGLSurface`.
@@ -53,13 +53,17 @@ bool AndroidImageGenerator::GetPixels(const SkImageInfo& info,
                                       size_t row_bytes,
                                       unsigned int frame_index,
                                       std::optional<unsigned int> prior_frame) {
-  fully_decoded_latch_.Wait();
+  // The decode task may still be waiting for a worker, for example when all
+  // the workers are busy getting the pixels of other images. Decode the image
+  // here rather than wait for it.
+  DecodeImage();
 
   if (!software_decoded_data_) {
     return false;
   }
 
-  if (kRGBA_8888_SkColorType != info.colorType()) {
+  if (kRGBA_8888_SkColorType != info.colorType() ||
+      info.dimensions() != GetInfo().dimensions()) {
     return false;
   }
 
@@ -79,16 +83,31 @@ bool AndroidImageGenerator::GetPixels(const SkImageInfo& info,
   // API level 30+ once it's updated to do symbol lookups and not get
   // preprocessed out in Skia. This will allow for avoiding this copy in
   // cases where the result image doesn't need to be resized.
-  memcpy(pixels, software_decoded_data_->data(),
-         software_decoded_data_->size());
+  const size_t min_row_bytes = info.minRowBytes();
+  if (row_bytes == min_row_bytes) {
+    memcpy(pixels, software_decoded_data_->data(),
+           software_decoded_data_->size());
+    return true;
+  }
+  if (row_bytes < min_row_bytes) {
+    return false;
+  }
+  const auto* src = software_decoded_data_->bytes();
+  auto* dst = static_cast<uint8_t*>(pixels);
+  for (int row = 0; row < info.height(); row++) {
+    memcpy(dst, src, min_row_bytes);
+    src += min_row_bytes;
+    dst += row_bytes;
+  }
   return true;
 }
 
 void AndroidImageGenerator::DecodeImage() {
-  DoDecodeImage();
-
-  header_decoded_latch_.Signal();
-  fully_decoded_latch_.Signal();
+  std::call_once(decode_once_, [this]() {
+    DoDecodeImage();
+    // Unblocks |GetInfo| if the header couldn't be decoded.
+    header_decoded_latch_.Signal();
+  });
 }
 
 void AndroidImageGenerator::DoDecodeImage() {
@@ -99,8 +118,8 @@ void AndroidImageGenerator::DoDecodeImage() {
 
   JNIEnv* env = fml::jni::AttachCurrentThread();
 
-  // This task is run on the IO thread.  Create a frame to ensure that all
-  // local JNI references used here are freed.
+  // This is run on a worker thread that stays attached to the JVM. Create a
+  // frame to ensure that all local JNI references used here are freed.
   fml::jni::ScopedJavaLocalFrame scoped_local_reference_frame(env);
 
   jobject direct_buffer =
@@ -174,12 +193,13 @@ bool AndroidImageGenerator::Register(JNIEnv* env) {
 
 std::shared_ptr<ImageGenerator> AndroidImageGenerator::MakeFromData(
     sk_sp<SkData> data,
-    const fml::RefPtr<fml::TaskRunner>& task_runner) {
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& task_runner) {
   std::shared_ptr<AndroidImageGenerator> generator(
       new AndroidImageGenerator(std::move(data)));
 
-  fml::TaskRunner::RunNowOrPostTask(
-      task_runner, [generator]() { generator->DecodeImage(); });
+  task_runner->PostTaskWithPriority(
+      [generator]() { generator->DecodeImage(); },
+      fml::ConcurrentTaskPriority::kHigh);
 
   if (generator->IsValidImageData()) {
     return generator;
@@ -202,7 +222,7 @@ void AndroidImageGenerator::NativeImageHeaderCallback(JNIEnv* env,
 }
 
 bool AndroidImageGenerator::IsValidImageData() {
-  // The generator kicks off an IO task to decode everything, and calls to
+  // The generator kicks off a worker task to decode everything, and calls to
   // "GetInfo()" block until either the header has been decoded or decoding has
   // failed, whichever is sooner. The decoder is initialized with a width and
   // height of -1 and will update the dimensions if the image is able to be
@@ -7,9 +7,11 @@
 
 #include <jni.h>
 
-#include "flutter/fml/memory/ref_ptr.h"
+#include <memory>
+#include <mutex>
+
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/synchronization/waitable_event.h"
-#include "flutter/fml/task_runner.h"
 #include "flutter/lib/ui/painting/image_generator.h"
 
 namespace flutter {
@@ -44,13 +46,18 @@ class AndroidImageGenerator : public ImageGenerator {
                  unsigned int frame_index,
                  std::optional<unsigned int> prior_frame) override;
 
+  /// Decodes the image on the calling thread, unless it has already been
+  /// decoded. If another thread is decoding the image, waits for it instead.
   void DecodeImage();
 
   static bool Register(JNIEnv* env);
 
+  /// Creates a generator for the encoded `data` and posts the decode of the
+  /// image to `task_runner`. The decode is posted with a high priority, as
+  /// calls to `GetInfo` on the UI thread wait for the header of the image.
   static std::shared_ptr<ImageGenerator> MakeFromData(
       sk_sp<SkData> data,
-      const fml::RefPtr<fml::TaskRunner>& task_runner);
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& task_runner);
 
   static void NativeImageHeaderCallback(JNIEnv* env,
                                         jclass jcaller,
@@ -68,8 +75,9 @@ class AndroidImageGenerator : public ImageGenerator {
   /// dimensions have been determined.
   fml::ManualResetWaitableEvent header_decoded_latch_;
 
-  /// Blocks until the image has been fully decoded.
-  fml::ManualResetWaitableEvent fully_decoded_latch_;
+  /// Ensures the image is only decoded once, whether by the task posted in
+  /// `MakeFromData` or by the first call to `GetPixels`.
+  std::once_flag decode_once_;
 
   void DoDecodeImage();
 
@@ -32,45 +32,6 @@
 
 namespace flutter {
 
-/// Inheriting ThreadConfigurer and use Android platform thread API to configure
-/// the thread priorities
-static void AndroidPlatformThreadConfigSetter(
-    const fml::Thread::ThreadConfig& config) {
-  // set thread name
-  fml::Thread::SetCurrentThreadName(config);
-  // set thread priority
-  switch (config.priority) {
-    case fml::Thread::ThreadPriority::BACKGROUND: {
-      if (::setpriority(PRIO_PROCESS, 0, 10) != 0) {
-        FML_LOG(ERROR) << "Failed to set IO task runner priority";
-      }
-      break;
-    }
-    case fml::Thread::ThreadPriority::DISPLAY: {
-      if (::setpriority(PRIO_PROCESS, 0, -1) != 0) {
-        FML_LOG(ERROR) << "Failed to set UI task runner priority";
-      }
-      break;
-    }
-    case fml::Thread::ThreadPriority::RASTER: {
-      // Android describes -8 as "most important display threads, for
-      // compositing the screen and retrieving input events". Conservatively
-      // set the raster thread to slightly lower priority than it.
-      if (::setpriority(PRIO_PROCESS, 0, -5) != 0) {
-        // Defensive fallback. Depending on the OEM, it may not be possible
-        // to set priority to -5.
-        if (::setpriority(PRIO_PROCESS, 0, -2) != 0) {
-          FML_LOG(ERROR) << "Failed to set raster task runner priority";
-        }
-      }
-      break;
-    }
-    default:
-      if (::setpriority(PRIO_PROCESS, 0, 0) != 0) {
-        FML_LOG(ERROR) << "Failed to set priority";
-      }
-  }
-}
 static PlatformData GetDefaultPlatformData() {
   PlatformData platform_data;
   platform_data.lifecycle_state = "AppLifecycleState.detached";
@@ -87,8 +48,7 @@ AndroidShellHolder::AndroidShellHolder(
   auto mask =
       ThreadHost::Type::UI | ThreadHost::Type::RASTER | ThreadHost::Type::IO;
 
-  flutter::ThreadHost::ThreadHostConfig host_config(
-      thread_label, mask, AndroidPlatformThreadConfigSetter);
+  flutter::ThreadHost::ThreadHostConfig host_config(thread_label, mask);
   host_config.ui_config = fml::Thread::ThreadConfig(
       flutter::ThreadHost::ThreadHostConfig::MakeThreadName(
           flutter::ThreadHost::Type::UI, thread_label),
@@ -101,6 +61,7 @@ AndroidShellHolder::AndroidShellHolder(
       flutter::ThreadHost::ThreadHostConfig::MakeThreadName(
           flutter::ThreadHost::Type::IO, thread_label),
       fml::Thread::ThreadPriority::NORMAL);
+  host_config.SetCpuAffinities(settings_);
 
   thread_host_ = std::make_shared<ThreadHost>(host_config);
 
@@ -162,8 +123,11 @@ AndroidShellHolder::AndroidShellHolder(
       }
     });
 
+    // Decode on the workers rather than the IO thread, which is also busy
+    // uploading textures.
     shell_->RegisterImageDecoder(
-        [runner = task_runners.GetIOTaskRunner()](sk_sp<SkData> buffer) {
+        [runner = shell_->GetDartVM()->GetConcurrentWorkerTaskRunner()](
+            sk_sp<SkData> buffer) {
           return AndroidImageGenerator::MakeFromData(std::move(buffer), runner);
         },
         -1);
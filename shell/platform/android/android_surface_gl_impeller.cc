@@ -5,6 +5,7 @@
 #include "flutter/shell/platform/android/android_surface_gl_impeller.h"
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/message_loop.h"
 #include "flutter/impeller/entity/gles/entity_shaders_gles.h"
 #include "flutter/impeller/renderer/backend/gles/context_gles.h"
 #include "flutter/impeller/renderer/backend/gles/proc_table_gles.h"
@@ -215,7 +216,23 @@ bool AndroidSurfaceGLImpeller::ResourceContextMakeCurrent() {
     return false;
   }
 
-  return offscreen_context_->MakeCurrent(*offscreen_surface_);
+  if (!offscreen_context_->MakeCurrent(*offscreen_surface_)) {
+    return false;
+  }
+
+  // The resource context is made current on the IO thread. Let the reactor
+  // drain handle creation, collection and texture uploads there instead of
+  // on the raster thread mid-frame.
+  if (impeller_context_ && fml::MessageLoop::IsInitializedForCurrentThread()) {
+    impeller::ContextGLES::Cast(*impeller_context_)
+        .GetReactor()
+        ->SetBackgroundDispatcher(
+            [task_runner = fml::MessageLoop::GetCurrent().GetTaskRunner()](
+                fml::closure reaction) {
+              task_runner->PostTask(std::move(reaction));
+            });
+  }
+  return true;
 }
 
 // |AndroidSurface|
@@ -224,6 +241,11 @@ bool AndroidSurfaceGLImpeller::ResourceContextClearCurrent() {
     return false;
   }
 
+  if (impeller_context_) {
+    impeller::ContextGLES::Cast(*impeller_context_)
+        .GetReactor()
+        ->SetBackgroundDispatcher(nullptr);
+  }
   return offscreen_context_->ClearCurrent();
 }
 
@@ -273,14 +295,41 @@ SurfaceFrame::FramebufferInfo
 AndroidSurfaceGLImpeller::GLContextFramebufferInfo() const {
   auto info = SurfaceFrame::FramebufferInfo{};
   info.supports_readback = true;
-  info.supports_partial_repaint = false;
+  if (!onscreen_surface_ || !onscreen_surface_->SupportsPartialUpdate()) {
+    return info;
+  }
+  info.supports_partial_repaint = true;
+  // Some devices (Pixel2 XL) needs EGL_KHR_partial_update rect aligned to 4,
+  // otherwise there are glitches
+  // (https://github.com/flutter/flutter/issues/97482#)
+  // Larger alignment might also be beneficial for tile base renderers.
+  info.horizontal_clip_alignment = 32;
+  info.vertical_clip_alignment = 32;
+
+  // The back buffer lags behind by the damage of the (age - 1) frames that
+  // were presented since it was, or its contents are undefined if its age
+  // is zero.
+  auto age = onscreen_surface_->GetBufferAge();
+  if (age.has_value() && age.value() > 0) {
+    auto damage = SkIRect::MakeEmpty();
+    EGLint frames = age.value() - 1;
+    for (auto i = damage_history_.rbegin();
+         i != damage_history_.rend() && frames > 0; ++i, --frames) {
+      damage.join(*i);
+    }
+    info.existing_damage = damage;
+  }
   return info;
 }
 
 // |GPUSurfaceGLDelegate|
 void AndroidSurfaceGLImpeller::GLContextSetDamageRegion(
     const std::optional<SkIRect>& region) {
-  // Not supported.
+  if (!onscreen_surface_ || !region.has_value()) {
+    return;
+  }
+  onscreen_surface_->SetDamageRegion(impeller::IRect::MakeLTRB(
+      region->left(), region->top(), region->right(), region->bottom()));
 }
 
 // |GPUSurfaceGLDelegate|
@@ -291,7 +340,24 @@ bool AndroidSurfaceGLImpeller::GLContextPresent(
   if (!onscreen_surface_) {
     return false;
   }
-  return onscreen_surface_->Present();
+  const auto& damage = present_info.frame_damage;
+  if (!damage.has_value() || !onscreen_surface_->SupportsPartialUpdate()) {
+    return onscreen_surface_->Present();
+  }
+  damage_history_.push_back(damage.value());
+  if (damage_history_.size() > kMaxDamageHistorySize) {
+    damage_history_.pop_front();
+  }
+  std::vector<impeller::IRect> damage_rects;
+  if (present_info.frame_damage_rects.empty()) {
+    damage_rects.push_back(impeller::IRect::MakeLTRB(
+        damage->left(), damage->top(), damage->right(), damage->bottom()));
+  }
+  for (const auto& rect : present_info.frame_damage_rects) {
+    damage_rects.push_back(impeller::IRect::MakeLTRB(
+        rect.left(), rect.top(), rect.right(), rect.bottom()));
+  }
+  return onscreen_surface_->Present(damage_rects);
 }
 
 // |GPUSurfaceGLDelegate|
@@ -314,6 +380,7 @@ bool AndroidSurfaceGLImpeller::
     return false;
   }
   onscreen_surface_.reset();
+  damage_history_.clear();
   auto onscreen_surface = display_->CreateWindowSurface(
       *onscreen_config_, native_window_->handle());
   if (!onscreen_surface) {
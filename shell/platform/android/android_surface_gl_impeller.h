@@ -5,6 +5,8 @@
 #ifndef FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_SURFACE_GL_IMPELLER_H_
 #define FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_SURFACE_GL_IMPELLER_H_
 
+#include <list>
+
 #include "flutter/fml/macros.h"
 #include "flutter/impeller/renderer/context.h"
 #include "flutter/impeller/toolkit/egl/display.h"
@@ -86,9 +88,16 @@ class AndroidSurfaceGLImpeller final : public GPUSurfaceGLDelegate,
   std::unique_ptr<impeller::egl::Context> offscreen_context_;
   std::shared_ptr<impeller::Context> impeller_context_;
   fml::RefPtr<AndroidNativeWindow> native_window_;
+  // The damage of the most recently presented frames, newest last, which
+  // is how far the back buffers lag behind the front buffer.
+  std::list<SkIRect> damage_history_;
 
   bool is_valid_ = false;
 
+  // Maximum damage history - for triple buffering the damage of the last two
+  // frames is needed, but some devices use quad buffering.
+  static constexpr size_t kMaxDamageHistorySize = 10;
+
   bool OnGLContextMakeCurrent();
 
   bool RecreateOnscreenSurfaceAndMakeOnscreenContextCurrent();
@@ -7,9 +7,11 @@
 #include <memory>
 #include <utility>
 
+#include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/impeller/aiks/aiks_context.h"
 #include "flutter/impeller/renderer/backend/vulkan/context_vk.h"
 #include "flutter/shell/gpu/gpu_surface_vulkan_impeller.h"
 #include "flutter/vulkan/vulkan_native_surface_android.h"
@@ -28,24 +30,35 @@ std::shared_ptr<impeller::Context> CreateImpellerContext(
   PFN_vkGetInstanceProcAddr instance_proc_addr =
       proc_table->NativeGetInstanceProcAddr();
 
-  auto context =
-      impeller::ContextVK::Create(instance_proc_addr,                //
-                                  shader_mappings,                   //
-                                  nullptr,                           //
-                                  concurrent_loop->GetTaskRunner(),  //
-                                  "Android Impeller Vulkan Lib"      //
-      );
+  auto context = impeller::ContextVK::Create(
+      instance_proc_addr,                             //
+      shader_mappings,                                //
+      PersistentCache::MakeImpellerCacheDirectory(),  //
+      concurrent_loop->GetTaskRunner(),               //
+      "Android Impeller Vulkan Lib"                   //
+  );
 
   return context;
 }
 
 AndroidSurfaceVulkanImpeller::AndroidSurfaceVulkanImpeller(
     const std::shared_ptr<AndroidContext>& android_context,
-    const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade)
+    const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade,
+    bool share_resources)
     : AndroidSurface(android_context),
       proc_table_(fml::MakeRefCounted<vulkan::VulkanProcTable>()),
-      workers_(fml::ConcurrentMessageLoop::Create()) {
-  impeller_context_ = CreateImpellerContext(proc_table_, workers_);
+      share_resources_(share_resources) {
+  AndroidContext::ImpellerResources shared_resources;
+  if (share_resources_) {
+    shared_resources = android_context->GetSharedImpellerResources();
+  }
+  if (shared_resources.aiks_context) {
+    workers_ = shared_resources.workers;
+    impeller_context_ = shared_resources.aiks_context->GetContext();
+  } else {
+    workers_ = fml::ConcurrentMessageLoop::Create();
+    impeller_context_ = CreateImpellerContext(proc_table_, workers_);
+  }
   is_valid_ =
       proc_table_->HasAcquiredMandatoryProcAddresses() && impeller_context_;
 }
@@ -57,7 +70,10 @@ bool AndroidSurfaceVulkanImpeller::IsValid() const {
 }
 
 void AndroidSurfaceVulkanImpeller::TeardownOnScreenContext() {
-  // Nothing to do.
+  // The application is being backgrounded and may be killed without notice.
+  if (impeller_context_) {
+    impeller::ContextVK::Cast(*impeller_context_).FlushPipelineCache();
+  }
 }
 
 std::unique_ptr<Surface> AndroidSurfaceVulkanImpeller::CreateGPUSurface(
@@ -70,8 +86,27 @@ std::unique_ptr<Surface> AndroidSurfaceVulkanImpeller::CreateGPUSurface(
     return nullptr;
   }
 
+  std::shared_ptr<impeller::AiksContext> aiks_context;
+  if (share_resources_) {
+    aiks_context = android_context_->GetSharedImpellerResources().aiks_context;
+    if (!aiks_context) {
+      aiks_context = std::make_shared<impeller::AiksContext>(impeller_context_);
+      if (aiks_context->IsValid()) {
+        android_context_->SetSharedImpellerResources({
+            .aiks_context = aiks_context,
+            .workers = workers_,
+        });
+      }
+    } else if (aiks_context->GetContext() != impeller_context_) {
+      // Another surface set up the shared resources after this one created
+      // its own Impeller context.
+      aiks_context = nullptr;
+    }
+  }
+
   std::unique_ptr<GPUSurfaceVulkanImpeller> gpu_surface =
-      std::make_unique<GPUSurfaceVulkanImpeller>(impeller_context_);
+      std::make_unique<GPUSurfaceVulkanImpeller>(impeller_context_,
+                                                 std::move(aiks_context));
 
   if (!gpu_surface->IsValid()) {
     return nullptr;
@@ -108,7 +143,13 @@ bool AndroidSurfaceVulkanImpeller::SetNativeWindow(
       return false;
     }
 
-    context_vk.SetupSwapchain(std::move(surface));
+    // Let the raster thread record the next frame while the GPU is still
+    // working on the current one.
+    context_vk.SetupSwapchain(std::move(surface),
+                              impeller::SwapchainConfigVK{
+                                  .frames_in_flight = 2u,
+                                  .prefer_mailbox = true,
+                              });
     return true;
   }
 
@@ -15,9 +15,13 @@ namespace flutter {
 
 class AndroidSurfaceVulkanImpeller : public AndroidSurface {
  public:
+  // If |share_resources| is true, the surface renders with the Impeller
+  // resources shared through |android_context|, setting them up if it is the
+  // first surface to do so.
   AndroidSurfaceVulkanImpeller(
       const std::shared_ptr<AndroidContext>& android_context,
-      const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade);
+      const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade,
+      bool share_resources);
 
   ~AndroidSurfaceVulkanImpeller() override;
 
@@ -48,6 +52,7 @@ class AndroidSurfaceVulkanImpeller : public AndroidSurface {
   fml::RefPtr<AndroidNativeWindow> native_window_;
   std::shared_ptr<fml::ConcurrentMessageLoop> workers_;
   std::shared_ptr<impeller::Context> impeller_context_;
+  const bool share_resources_;
   bool is_valid_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(AndroidSurfaceVulkanImpeller);
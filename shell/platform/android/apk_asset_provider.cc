@@ -4,16 +4,73 @@
 
 #include "flutter/shell/platform/android/apk_asset_provider.h"
 
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include <algorithm>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <utility>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/unique_fd.h"
 
 namespace flutter {
 
+// An uncompressed asset mapped directly from the APK.
+class APKAssetFileMapping : public fml::Mapping {
+ public:
+  APKAssetFileMapping(void* region,
+                      size_t region_size,
+                      size_t offset,
+                      size_t length)
+      : region_(region),
+        region_size_(region_size),
+        offset_(offset),
+        length_(length) {}
+
+  ~APKAssetFileMapping() override { ::munmap(region_, region_size_); }
+
+  size_t GetSize() const override { return length_; }
+
+  const uint8_t* GetMapping() const override {
+    return static_cast<const uint8_t*>(region_) + offset_;
+  }
+
+  // The pages are backed by the APK, so they can be dropped and faulted back
+  // in from it.
+  bool IsDontNeedSafe() const override { return true; }
+
+ private:
+  void* const region_;
+  const size_t region_size_;
+  const size_t offset_;
+  const size_t length_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(APKAssetFileMapping);
+};
+
+std::unique_ptr<fml::Mapping> MapAPKAssetRegion(int fd,
+                                                off64_t offset,
+                                                size_t length) {
+  if (fd < 0 || offset < 0 || length == 0) {
+    return nullptr;
+  }
+  // Assets are stored at arbitrary offsets in the APK, but mmap requires
+  // the offset to be a multiple of the page size.
+  const off64_t page_size = ::sysconf(_SC_PAGESIZE);
+  const off64_t aligned_offset = offset - (offset % page_size);
+  const size_t delta = static_cast<size_t>(offset - aligned_offset);
+  void* region = ::mmap64(nullptr, length + delta, PROT_READ, MAP_PRIVATE, fd,
+                          aligned_offset);
+  if (region == MAP_FAILED) {
+    return nullptr;
+  }
+  return std::make_unique<APKAssetFileMapping>(region, length + delta, delta,
+                                               length);
+}
+
 class APKAssetMapping : public fml::Mapping {
  public:
   explicit APKAssetMapping(AAsset* asset) : asset_(asset) {}
@@ -56,6 +113,21 @@ class APKAssetProviderImpl : public APKAssetProviderInternal {
       return nullptr;
     }
 
+    // Only assets that are stored uncompressed have a file descriptor.
+    off64_t start = 0;
+    off64_t length = 0;
+    fml::UniqueFD fd(AAsset_openFileDescriptor64(asset, &start, &length));
+    if (fd.is_valid()) {
+      auto mapping =
+          MapAPKAssetRegion(fd.get(), start, static_cast<size_t>(length));
+      if (mapping) {
+        AAsset_close(asset);
+        return mapping;
+      }
+    } else {
+      WarnAboutCompressedAsset(asset_name, asset);
+    }
+
     return std::make_unique<APKAssetMapping>(asset);
   };
 
@@ -63,6 +135,26 @@ class APKAssetProviderImpl : public APKAssetProviderInternal {
   fml::jni::ScopedJavaGlobalRef<jobject> java_asset_manager_;
   AAssetManager* asset_manager_;
   const std::string directory_;
+  mutable std::mutex warned_assets_mutex_;
+  mutable std::set<std::string> warned_assets_;
+
+  // Compressed assets are inflated into a heap allocation every time they
+  // are loaded. Warns once per asset so that it can be added to the
+  // noCompress list of the app.
+  void WarnAboutCompressedAsset(const std::string& asset_name,
+                                AAsset* asset) const {
+    {
+      std::scoped_lock lock(warned_assets_mutex_);
+      if (!warned_assets_.insert(asset_name).second) {
+        return;
+      }
+    }
+    FML_LOG(WARNING) << "The asset " << asset_name << " ("
+                     << AAsset_getLength64(asset)
+                     << " bytes) is compressed in the APK and is copied into "
+                        "memory when it is loaded. Add its extension to "
+                        "android.aaptOptions.noCompress to map it instead.";
+  }
 
   FML_DISALLOW_COPY_AND_ASSIGN(APKAssetProviderImpl);
 };
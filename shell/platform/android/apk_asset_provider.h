@@ -14,6 +14,20 @@
 
 namespace flutter {
 
+//------------------------------------------------------------------------------
+/// Maps |length| bytes of the file |fd| starting at |offset| read-only. The
+/// offset does not need to be page aligned. The file descriptor may be closed
+/// once this returns.
+///
+/// Uncompressed assets are mapped this way straight from the APK, so their
+/// pages are shared with the page cache instead of being copied.
+///
+/// Returns nullptr if the region could not be mapped.
+///
+std::unique_ptr<fml::Mapping> MapAPKAssetRegion(int fd,
+                                                off64_t offset,
+                                                size_t length);
+
 class APKAssetProviderInternal {
  public:
   virtual std::unique_ptr<fml::Mapping> GetAsMapping(
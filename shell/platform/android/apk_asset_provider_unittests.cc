@@ -1,4 +1,12 @@
 #include "flutter/shell/platform/android/apk_asset_provider.h"
+
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/mapping.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -21,5 +29,32 @@ TEST(APKAssetProvider, Clone) {
   ASSERT_NE(first_provider->GetImpl(), second_provider->GetImpl());
   ASSERT_EQ(first_provider->GetImpl(), third_provider->GetImpl());
 }
+
+TEST(APKAssetProvider, MapsRegionsAtUnalignedOffsets) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  const std::string padding(::sysconf(_SC_PAGESIZE) + 7, 'x');
+  const std::string contents = "asset contents";
+  const std::string file_contents = padding + contents + padding;
+  fml::DataMapping data(std::vector<uint8_t>(file_contents.begin(),
+                                             file_contents.end()));
+  ASSERT_TRUE(fml::WriteAtomically(temp_dir.fd(), "app.apk", data));
+  auto fd = fml::OpenFile(temp_dir.fd(), "app.apk", false,
+                          fml::FilePermission::kRead);
+  ASSERT_TRUE(fd.is_valid());
+
+  auto mapping = MapAPKAssetRegion(fd.get(), padding.size(), contents.size());
+
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(mapping->GetSize(), contents.size());
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(mapping->GetMapping()),
+                        mapping->GetSize()),
+            contents);
+  EXPECT_TRUE(mapping->IsDontNeedSafe());
+}
+
+TEST(APKAssetProvider, DoesNotMapInvalidRegions) {
+  EXPECT_EQ(MapAPKAssetRegion(-1, 0, 16), nullptr);
+  EXPECT_EQ(MapAPKAssetRegion(0, 0, 0), nullptr);
+}
 }  // namespace testing
 }  // namespace flutter
@@ -32,4 +32,16 @@ sk_sp<GrDirectContext> AndroidContext::GetMainSkiaContext() const {
   return main_context_;
 }
 
+void AndroidContext::SetSharedImpellerResources(
+    const ImpellerResources& resources) {
+  std::scoped_lock lock(impeller_resources_mutex_);
+  impeller_resources_ = resources;
+}
+
+AndroidContext::ImpellerResources AndroidContext::GetSharedImpellerResources()
+    const {
+  std::scoped_lock lock(impeller_resources_mutex_);
+  return impeller_resources_;
+}
+
 }  // namespace flutter
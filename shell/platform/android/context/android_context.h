@@ -5,10 +5,21 @@
 #ifndef FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_CONTEXT_H_
 #define FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_CONTEXT_H_
 
+#include <memory>
+#include <mutex>
+
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_runner.h"
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 
+namespace fml {
+class ConcurrentMessageLoop;
+}  // namespace fml
+
+namespace impeller {
+class AiksContext;
+}  // namespace impeller
+
 namespace flutter {
 
 enum class AndroidRenderingAPI {
@@ -54,12 +65,48 @@ class AndroidContext {
   ///
   sk_sp<GrDirectContext> GetMainSkiaContext() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The Impeller state that AndroidSurfaces can share.
+  ///
+  struct ImpellerResources {
+    // The Aiks context, which holds the Impeller context, its pipelines and
+    // the glyph atlas.
+    std::shared_ptr<impeller::AiksContext> aiks_context;
+    // The worker threads the Impeller context posts its tasks to.
+    std::shared_ptr<fml::ConcurrentMessageLoop> workers;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Setter for the Impeller resources to be used by subsequent
+  ///             AndroidSurfaces.
+  /// @details    Like the main Skia context, this lets the AndroidSurfaces of
+  ///             an engine, and of the engines spawned from it, render with
+  ///             the same Impeller context, pipelines and glyph atlas.
+  ///
+  ///             The resources must only be used on the raster task runner,
+  ///             which the spawned engines share with the engine they are
+  ///             spawned from.
+  ///
+  void SetSharedImpellerResources(const ImpellerResources& resources);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Accessor for the Impeller resources shared by the
+  ///             AndroidSurfaces.
+  /// @returns    Empty resources when no AndroidSurface has set them yet via
+  ///             SetSharedImpellerResources.
+  ///
+  ImpellerResources GetSharedImpellerResources() const;
+
  private:
   const AndroidRenderingAPI rendering_api_;
 
   // This is the Skia context used for on-screen rendering.
   sk_sp<GrDirectContext> main_context_;
 
+  // The surfaces may be created on the platform and on the raster threads.
+  mutable std::mutex impeller_resources_mutex_;
+  ImpellerResources impeller_resources_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(AndroidContext);
 };
 
@@ -107,8 +107,7 @@ void AndroidExternalViewEmbedder::SubmitFrame(
     return;
   }
 
-  std::unordered_map<int64_t, SkRect> overlay_layers;
-  std::unordered_map<int64_t, sk_sp<SkPicture>> pictures;
+  std::vector<OverlayContents> overlays;
   SkCanvas* background_canvas = frame->SkiaCanvas();
   DisplayListBuilder* background_builder = frame->GetDisplayListBuilder().get();
   auto current_frame_view_count = composition_order_.size();
@@ -157,7 +156,21 @@ void AndroidExternalViewEmbedder::SubmitFrame(
       //
       // For example, {0.3, 0.5, 3.1, 4.7} becomes {0, 0, 4, 5}.
       joined_rect.set(joined_rect.roundOut());
-      overlay_layers.insert({view_id, joined_rect});
+      // Merge the overlay into the one below it when no platform view in
+      // between would be covered by either, so that fewer surfaces are
+      // needed.
+      if (!overlays.empty() && CanLiftOverlay(overlays.back(), i)) {
+        OverlayContents& overlay = overlays.back();
+        overlay.composition_index = i;
+        overlay.bounds.join(joined_rect);
+        overlay.slices.emplace_back(slice, joined_rect);
+      } else {
+        overlays.push_back({
+            .composition_index = i,
+            .bounds = joined_rect,
+            .slices = {{slice, joined_rect}},
+        });
+      }
       // Clip the background canvas, so it doesn't contain any of the pixels
       // drawn on the overlay layer.
       background_canvas->clipRect(joined_rect, SkClipOp::kDifference);
@@ -172,6 +185,10 @@ void AndroidExternalViewEmbedder::SubmitFrame(
   // Manually trigger the SkAutoCanvasRestore before we submit the frame
   save.restore();
 
+  FML_TRACE_COUNTER("flutter", "AndroidOverlaysPerFrame",
+                    reinterpret_cast<int64_t>(this), "Overlays",
+                    overlays.size());
+
   // Submit the background canvas frame before switching the GL context to
   // the overlay surfaces.
   //
@@ -182,7 +199,9 @@ void AndroidExternalViewEmbedder::SubmitFrame(
     frame->Submit();
   }
 
-  for (int64_t view_id : composition_order_) {
+  auto overlay = overlays.begin();
+  for (size_t i = 0; i < composition_order_.size(); i++) {
+    int64_t view_id = composition_order_[i];
     SkRect view_rect = GetViewRect(view_id);
     const EmbeddedViewParams& params = view_params_.at(view_id);
     // Display the platform view. If it's already displayed, then it's
@@ -197,51 +216,70 @@ void AndroidExternalViewEmbedder::SubmitFrame(
         params.sizePoints().height() * device_pixel_ratio_,
         params.mutatorsStack()  //
     );
-    std::unordered_map<int64_t, SkRect>::const_iterator overlay =
-        overlay_layers.find(view_id);
-    if (overlay == overlay_layers.end()) {
+    if (overlay == overlays.end() || overlay->composition_index != i) {
       continue;
     }
     std::unique_ptr<SurfaceFrame> frame =
-        CreateSurfaceIfNeeded(context,                    //
-                              view_id,                    //
-                              slices_.at(view_id).get(),  //
-                              overlay->second             //
-        );
+        CreateSurfaceIfNeeded(context, *overlay);
     if (should_submit_current_frame) {
       frame->Submit();
     }
+    overlay++;
+  }
+}
+
+bool AndroidExternalViewEmbedder::CanLiftOverlay(
+    const OverlayContents& overlay,
+    size_t composition_index) const {
+  for (size_t i = overlay.composition_index + 1; i <= composition_index; i++) {
+    SkRect view_rect = GetViewRect(composition_order_[i]);
+    for (const auto& [slice, rect] : overlay.slices) {
+      if (rect.intersects(view_rect)) {
+        return false;
+      }
+    }
   }
+  return true;
 }
 
 // |ExternalViewEmbedder|
 std::unique_ptr<SurfaceFrame>
-AndroidExternalViewEmbedder::CreateSurfaceIfNeeded(GrDirectContext* context,
-                                                   int64_t view_id,
-                                                   EmbedderViewSlice* slice,
-                                                   const SkRect& rect) {
+AndroidExternalViewEmbedder::CreateSurfaceIfNeeded(
+    GrDirectContext* context,
+    const OverlayContents& overlay) {
   std::shared_ptr<OverlayLayer> layer = surface_pool_->GetLayer(
       context, android_context_, jni_facade_, surface_factory_);
 
   std::unique_ptr<SurfaceFrame> frame =
       layer->surface->AcquireFrame(frame_size_);
+  const SkRect& bounds = overlay.bounds;
   // Display the overlay surface. If it's already displayed, then it's
   // just positioned and sized.
-  jni_facade_->FlutterViewDisplayOverlaySurface(layer->id,     //
-                                                rect.x(),      //
-                                                rect.y(),      //
-                                                rect.width(),  //
-                                                rect.height()  //
+  jni_facade_->FlutterViewDisplayOverlaySurface(layer->id,       //
+                                                bounds.x(),      //
+                                                bounds.y(),      //
+                                                bounds.width(),  //
+                                                bounds.height()  //
   );
   SkCanvas* overlay_canvas = frame->SkiaCanvas();
   overlay_canvas->clear(SK_ColorTRANSPARENT);
   // Offset the picture since its absolute position on the scene is determined
   // by the position of the overlay view.
-  overlay_canvas->translate(-rect.x(), -rect.y());
-  if (frame->GetDisplayListBuilder()) {
-    slice->render_into(frame->GetDisplayListBuilder().get());
-  } else {
-    slice->render_into(overlay_canvas);
+  overlay_canvas->translate(-bounds.x(), -bounds.y());
+  DisplayListBuilder* builder = frame->GetDisplayListBuilder().get();
+  for (const auto& [slice, rect] : overlay.slices) {
+    // The rest of each slice was drawn into the background, or into another
+    // overlay.
+    if (builder) {
+      builder->save();
+      builder->clipRect(rect, SkClipOp::kIntersect, false);
+      slice->render_into(builder);
+      builder->restore();
+    } else {
+      SkAutoCanvasRestore restore(overlay_canvas, /*doSave=*/true);
+      overlay_canvas->clipRect(rect);
+      slice->render_into(overlay_canvas);
+    }
   }
   return frame;
 }
@@ -299,12 +337,12 @@ void AndroidExternalViewEmbedder::BeginFrame(
     fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger) {
   Reset();
 
-  // The surface size changed. Therefore, destroy existing surfaces as
-  // the existing surfaces in the pool can't be recycled.
-  if (frame_size_ != frame_size) {
+  // The surface size changed. Destroy the existing surfaces if the ones in the
+  // pool can't be recycled for frames of the new size.
+  surface_pool_->SetFrameSize(frame_size);
+  if (frame_size_ != frame_size && !surface_pool_->CanRecycleLayers()) {
     DestroySurfaces();
   }
-  surface_pool_->SetFrameSize(frame_size);
   // JNI method must be called on the platform thread.
   if (raster_thread_merger->IsOnPlatformThread()) {
     jni_facade_->FlutterViewBeginFrame();
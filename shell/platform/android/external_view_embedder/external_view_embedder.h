@@ -144,12 +144,26 @@ class AndroidExternalViewEmbedder final : public ExternalViewEmbedder {
   // Whether the layer tree in the current frame has platform layers.
   bool FrameHasPlatformLayers();
 
+  // The contents of an overlay layer. The layer is displayed above the
+  // platform view at |composition_index| in |composition_order_|, and draws
+  // the Flutter UI of one or more slices, each clipped to its rect.
+  struct OverlayContents {
+    size_t composition_index;
+    SkRect bounds;
+    std::vector<std::pair<EmbedderViewSlice*, SkRect>> slices;
+  };
+
+  // Whether the contents of |overlay| can be drawn above the platform view at
+  // |composition_index| instead. That is the case when none of the platform
+  // views in between intersect them.
+  bool CanLiftOverlay(const OverlayContents& overlay,
+                      size_t composition_index) const;
+
   // Creates a Surface when needed or recycles an existing one.
-  // Finally, draws the picture on the frame's canvas.
-  std::unique_ptr<SurfaceFrame> CreateSurfaceIfNeeded(GrDirectContext* context,
-                                                      int64_t view_id,
-                                                      EmbedderViewSlice* slice,
-                                                      const SkRect& rect);
+  // Finally, draws the slices of |overlay| on the frame's canvas.
+  std::unique_ptr<SurfaceFrame> CreateSurfaceIfNeeded(
+      GrDirectContext* context,
+      const OverlayContents& overlay);
 };
 
 }  // namespace flutter
@@ -6,8 +6,14 @@
 
 #include <utility>
 
+#include "flutter/fml/trace_event.h"
+
 namespace flutter {
 
+// Layers whose surfaces are more than twice as large as the frame are
+// reallocated to reclaim their memory.
+static constexpr int64_t kMaxRecycledLayerAreaRatio = 2;
+
 OverlayLayer::OverlayLayer(int id,
                            std::unique_ptr<AndroidSurface> android_surface,
                            std::unique_ptr<Surface> surface)
@@ -27,8 +33,8 @@ std::shared_ptr<OverlayLayer> SurfacePool::GetLayer(
     const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade,
     const std::shared_ptr<AndroidSurfaceFactory>& surface_factory) {
   std::lock_guard lock(mutex_);
-  // Destroy current layers in the pool if the frame size has changed.
-  if (requested_frame_size_ != current_frame_size_) {
+  // Destroy current layers in the pool if they don't fit the frame anymore.
+  if (!CanRecycleLayersLocked()) {
     DestroyLayersLocked(jni_facade);
   }
   intptr_t gr_context_key = reinterpret_cast<intptr_t>(gr_context);
@@ -56,7 +62,9 @@ std::shared_ptr<OverlayLayer> SurfacePool::GetLayer(
                                        std::move(surface)           //
         );
     layer->gr_context_key = gr_context_key;
+    layer->frame_size = requested_frame_size_;
     layers_.push_back(layer);
+    TraceLayersLocked();
   }
 
   std::shared_ptr<OverlayLayer> layer = layers_[available_layer_index_];
@@ -71,7 +79,6 @@ std::shared_ptr<OverlayLayer> SurfacePool::GetLayer(
     layer->surface = std::move(surface);
   }
   available_layer_index_++;
-  current_frame_size_ = requested_frame_size_;
   return layer;
 }
 
@@ -99,6 +106,43 @@ void SurfacePool::DestroyLayersLocked(
   jni_facade->FlutterViewDestroyOverlaySurfaces();
   layers_.clear();
   available_layer_index_ = 0;
+  TraceLayersLocked();
+}
+
+bool SurfacePool::CanRecycleLayers() {
+  std::lock_guard lock(mutex_);
+  return CanRecycleLayersLocked();
+}
+
+bool SurfacePool::CanRecycleLayersLocked() const {
+  const int64_t requested_area =
+      static_cast<int64_t>(requested_frame_size_.width()) *
+      requested_frame_size_.height();
+  for (const auto& layer : layers_) {
+    const SkISize& layer_size = layer->frame_size;
+    if (requested_frame_size_.width() > layer_size.width() ||
+        requested_frame_size_.height() > layer_size.height()) {
+      return false;
+    }
+    const int64_t layer_area =
+        static_cast<int64_t>(layer_size.width()) * layer_size.height();
+    if (layer_area > requested_area * kMaxRecycledLayerAreaRatio) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SurfacePool::TraceLayersLocked() const {
+  int64_t bytes = 0;
+  for (const auto& layer : layers_) {
+    // Overlay surfaces are RGBA_8888.
+    bytes += static_cast<int64_t>(layer->frame_size.width()) *
+             layer->frame_size.height() * 4;
+  }
+  FML_TRACE_COUNTER("flutter", "AndroidOverlayLayers",
+                    reinterpret_cast<int64_t>(this), "Count", layers_.size(),
+                    "Bytes", bytes);
 }
 
 std::vector<std::shared_ptr<OverlayLayer>> SurfacePool::GetUnusedLayers() {
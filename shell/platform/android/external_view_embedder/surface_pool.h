@@ -41,6 +41,10 @@ struct OverlayLayer {
   //
   // This may change when the overlay is recycled.
   intptr_t gr_context_key;
+
+  // The size of the frames when the overlay was created, which is the size of
+  // its surface.
+  SkISize frame_size;
 };
 
 class SurfacePool {
@@ -69,10 +73,18 @@ class SurfacePool {
   void DestroyLayers(const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade);
 
   // Sets the frame size used by the layers in the pool.
-  // If the current layers in the pool have a different frame size,
-  // then they are deallocated as soon as |GetLayer| is called.
+  // If the current layers in the pool can't be recycled for frames of this
+  // size, then they are deallocated as soon as |GetLayer| is called.
   void SetFrameSize(SkISize frame_size);
 
+  // Whether the layers in the pool can render frames of the size set by
+  // |SetFrameSize|.
+  //
+  // The layers are kept when the frame shrinks slightly, e.g. when the
+  // keyboard is shown, since only the part of an overlay that covers its
+  // contents is displayed.
+  bool CanRecycleLayers();
+
   // Returns true if the current pool has layers in use.
   bool HasLayers();
 
@@ -94,9 +106,6 @@ class SurfacePool {
   // The layers in the pool.
   std::vector<std::shared_ptr<OverlayLayer>> layers_;
 
-  // The frame size of the layers in the pool.
-  SkISize current_frame_size_;
-
   // The frame size to be used by future layers.
   SkISize requested_frame_size_;
 
@@ -105,6 +114,11 @@ class SurfacePool {
 
   void DestroyLayersLocked(
       const std::shared_ptr<PlatformViewAndroidJNI>& jni_facade);
+
+  bool CanRecycleLayersLocked() const;
+
+  // Reports the number and the memory of the layers in the pool.
+  void TraceLayersLocked() const;
 };
 
 }  // namespace flutter
@@ -272,5 +272,43 @@ TEST(SurfacePool, DestroyLayersFrameSizeChanged) {
   ASSERT_TRUE(pool->HasLayers());
 }
 
+TEST(SurfacePool, RecycleLayersWhenFrameSizeShrinksSlightly) {
+  auto pool = std::make_unique<SurfacePool>();
+  auto jni_mock = std::make_shared<JNIMock>();
+
+  auto gr_context = GrDirectContext::MakeMock(nullptr);
+  auto android_context =
+      std::make_shared<AndroidContext>(AndroidRenderingAPI::kSoftware);
+
+  auto window = fml::MakeRefCounted<AndroidNativeWindow>(nullptr);
+
+  auto surface_factory = std::make_shared<TestAndroidSurfaceFactory>(
+      [&android_context, gr_context, window]() {
+        auto android_surface_mock =
+            std::make_unique<AndroidSurfaceMock>(android_context);
+        EXPECT_CALL(*android_surface_mock, CreateGPUSurface(gr_context.get()));
+        EXPECT_CALL(*android_surface_mock, SetNativeWindow(window));
+        EXPECT_CALL(*android_surface_mock, IsValid()).WillOnce(Return(true));
+        return android_surface_mock;
+      });
+  pool->SetFrameSize(SkISize::Make(100, 100));
+  EXPECT_CALL(*jni_mock, FlutterViewDestroyOverlaySurfaces()).Times(0);
+  EXPECT_CALL(*jni_mock, FlutterViewCreateOverlaySurface())
+      .Times(1)
+      .WillOnce(Return(
+          ByMove(std::make_unique<PlatformViewAndroidJNI::OverlayMetadata>(
+              0, window))));
+
+  auto layer = pool->GetLayer(gr_context.get(), *android_context, jni_mock,
+                              surface_factory);
+  pool->RecycleLayers();
+
+  pool->SetFrameSize(SkISize::Make(100, 90));
+  ASSERT_TRUE(pool->CanRecycleLayers());
+  auto recycled_layer = pool->GetLayer(gr_context.get(), *android_context,
+                                       jni_mock, surface_factory);
+  ASSERT_EQ(layer, recycled_layer);
+}
+
 }  // namespace testing
 }  // namespace flutter
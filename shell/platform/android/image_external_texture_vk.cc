@@ -0,0 +1,178 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/image_external_texture_vk.h"
+
+#include <android/hardware_buffer.h>
+
+#include <optional>
+#include <utility>
+
+#include "flutter/display_list/display_list_builder.h"
+#include "flutter/fml/native_library.h"
+#include "flutter/fml/platform/android/jni_util.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/display_list/display_list_image_impeller.h"
+#include "impeller/renderer/backend/vulkan/android_hardware_buffer_vk.h"
+
+// Only available on API 26+.
+typedef AHardwareBuffer* (*AHardwareBuffer_fromHardwareBuffer_FPN)(
+    JNIEnv* env,
+    jobject hardware_buffer);
+typedef void (*AHardwareBuffer_describe_FPN)(const AHardwareBuffer* buffer,
+                                             AHardwareBuffer_Desc* desc);
+
+namespace flutter {
+
+namespace {
+
+struct HardwareBufferProcs {
+  AHardwareBuffer_fromHardwareBuffer_FPN from_hardware_buffer = nullptr;
+  AHardwareBuffer_describe_FPN describe = nullptr;
+
+  bool IsValid() const { return from_hardware_buffer && describe; }
+};
+
+const HardwareBufferProcs& GetHardwareBufferProcs() {
+  static const HardwareBufferProcs procs = [] {
+    HardwareBufferProcs procs;
+    auto libandroid = fml::NativeLibrary::Create("libandroid.so");
+    if (!libandroid) {
+      return procs;
+    }
+    procs.from_hardware_buffer =
+        libandroid
+            ->ResolveFunction<AHardwareBuffer_fromHardwareBuffer_FPN>(
+                "AHardwareBuffer_fromHardwareBuffer")
+            .value_or(nullptr);
+    procs.describe = libandroid
+                         ->ResolveFunction<AHardwareBuffer_describe_FPN>(
+                             "AHardwareBuffer_describe")
+                         .value_or(nullptr);
+    return procs;
+  }();
+  return procs;
+}
+
+}  // namespace
+
+ImageExternalTextureVK::ImageExternalTextureVK(
+    int64_t id,
+    const fml::jni::ScopedJavaGlobalRef<jobject>& image_consumer,
+    std::shared_ptr<PlatformViewAndroidJNI> jni_facade,
+    std::shared_ptr<impeller::ContextVK> impeller_context)
+    : Texture(id),
+      jni_facade_(std::move(jni_facade)),
+      image_consumer_(image_consumer),
+      impeller_context_(std::move(impeller_context)) {}
+
+ImageExternalTextureVK::~ImageExternalTextureVK() {
+  ReleaseImage();
+}
+
+// |Texture|
+void ImageExternalTextureVK::Paint(PaintContext& context,
+                                   const SkRect& bounds,
+                                   bool freeze,
+                                   const SkSamplingOptions& sampling) {
+  if ((!freeze && new_frame_ready_) || !dl_image_) {
+    new_frame_ready_ = false;
+    UpdateImage(context);
+  }
+  if (!dl_image_ || !context.builder) {
+    return;
+  }
+  context.builder->drawImageRect(
+      dl_image_,                                            // image
+      SkRect::Make(dl_image_->bounds()),                    // source rect
+      bounds,                                               // destination rect
+      ToDl(sampling),                                       // sampling
+      context.dl_paint,                                     // paint
+      SkCanvas::SrcRectConstraint::kFast_SrcRectConstraint  // constraint
+  );
+}
+
+void ImageExternalTextureVK::UpdateImage(PaintContext& context) {
+  TRACE_EVENT0("flutter", "ImageExternalTextureVK::UpdateImage");
+  const auto& procs = GetHardwareBufferProcs();
+  if (!procs.IsValid()) {
+    FML_LOG(ERROR) << "Image textures require AHardwareBuffer support.";
+    return;
+  }
+
+  JavaLocalRef image = jni_facade_->ImageConsumerAcquireLatestImage(
+      fml::jni::ScopedJavaLocalRef<jobject>(image_consumer_));
+  if (image.is_null()) {
+    return;
+  }
+  JavaLocalRef hardware_buffer = jni_facade_->ImageGetHardwareBuffer(image);
+  if (hardware_buffer.is_null()) {
+    FML_LOG(ERROR) << "The image pushed to an image texture is not backed by "
+                      "a hardware buffer.";
+    jni_facade_->ImageClose(image);
+    return;
+  }
+
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+  AHardwareBuffer* buffer =
+      procs.from_hardware_buffer(env, hardware_buffer.obj());
+  AHardwareBuffer_Desc desc = {};
+  if (buffer) {
+    procs.describe(buffer, &desc);
+  }
+
+  sk_sp<DlImage> dl_image;
+  // The imported memory holds its own reference to the buffer, so the Java
+  // object can be closed right away.
+  auto textures = impeller::ImportAndroidHardwareBufferVK(
+      impeller_context_, buffer,
+      impeller::ISize(static_cast<int64_t>(desc.width),
+                      static_cast<int64_t>(desc.height)));
+  jni_facade_->HardwareBufferClose(hardware_buffer);
+  if (textures.has_value()) {
+    if (textures->IsYUV()) {
+      dl_image = impeller::DlImageImpeller::MakeFromYUVTextures(
+          context.aiks_context, textures->y_texture, textures->uv_texture,
+          textures->yuv_color_space);
+    } else {
+      dl_image = impeller::DlImageImpeller::Make(textures->texture);
+    }
+  }
+  if (!dl_image) {
+    jni_facade_->ImageClose(image);
+    return;
+  }
+
+  ReleaseImage();
+  java_image_.Reset(image);
+  dl_image_ = std::move(dl_image);
+}
+
+void ImageExternalTextureVK::ReleaseImage() {
+  dl_image_ = nullptr;
+  if (!java_image_.is_null()) {
+    jni_facade_->ImageClose(fml::jni::ScopedJavaLocalRef<jobject>(java_image_));
+    java_image_.Reset();
+  }
+}
+
+// |Texture|
+void ImageExternalTextureVK::OnGrContextCreated() {}
+
+// |Texture|
+void ImageExternalTextureVK::OnGrContextDestroyed() {
+  ReleaseImage();
+}
+
+// |Texture|
+void ImageExternalTextureVK::MarkNewFrameAvailable() {
+  new_frame_ready_ = true;
+}
+
+// |Texture|
+void ImageExternalTextureVK::OnTextureUnregistered() {
+  ReleaseImage();
+}
+
+}  // namespace flutter
@@ -0,0 +1,79 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_ANDROID_IMAGE_EXTERNAL_TEXTURE_VK_H_
+#define FLUTTER_SHELL_PLATFORM_ANDROID_IMAGE_EXTERNAL_TEXTURE_VK_H_
+
+#include "flutter/common/graphics/texture.h"
+#include "flutter/display_list/display_list_image.h"
+#include "flutter/fml/platform/android/scoped_java_ref.h"
+#include "flutter/impeller/renderer/backend/vulkan/context_vk.h"
+#include "flutter/shell/platform/android/jni/platform_view_android_jni.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// An external texture that displays the android.media.Images pushed to an
+/// ImageTextureEntry by sampling their hardware buffers with Impeller's Vulkan
+/// backend.
+///
+/// Unlike `AndroidExternalTextureGL`, no SurfaceTexture or OpenGL ES context
+/// is involved and the frames are never copied.
+///
+class ImageExternalTextureVK : public flutter::Texture {
+ public:
+  ImageExternalTextureVK(
+      int64_t id,
+      const fml::jni::ScopedJavaGlobalRef<jobject>& image_consumer,
+      std::shared_ptr<PlatformViewAndroidJNI> jni_facade,
+      std::shared_ptr<impeller::ContextVK> impeller_context);
+
+  ~ImageExternalTextureVK() override;
+
+  // |Texture|
+  void Paint(PaintContext& context,
+             const SkRect& bounds,
+             bool freeze,
+             const SkSamplingOptions& sampling) override;
+
+  // |Texture|
+  void OnGrContextCreated() override;
+
+  // |Texture|
+  void OnGrContextDestroyed() override;
+
+  // |Texture|
+  void MarkNewFrameAvailable() override;
+
+  // |Texture|
+  void OnTextureUnregistered() override;
+
+ private:
+  // Takes the latest image from the image consumer and imports its hardware
+  // buffer. Keeps the current image if there is no new one.
+  void UpdateImage(PaintContext& context);
+
+  // Closes the image that is displayed and forgets its textures.
+  void ReleaseImage();
+
+  std::shared_ptr<PlatformViewAndroidJNI> jni_facade_;
+
+  fml::jni::ScopedJavaGlobalRef<jobject> image_consumer_;
+
+  std::shared_ptr<impeller::ContextVK> impeller_context_;
+
+  // The image whose hardware buffer backs |dl_image_|. It stays open while it
+  // is displayed so that the producer does not write into the buffer.
+  fml::jni::ScopedJavaGlobalRef<jobject> java_image_;
+
+  sk_sp<DlImage> dl_image_;
+
+  bool new_frame_ready_ = false;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ImageExternalTextureVK);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_ANDROID_IMAGE_EXTERNAL_TEXTURE_VK_H_
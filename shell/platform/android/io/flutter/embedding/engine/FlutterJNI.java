@@ -33,6 +33,7 @@ import io.flutter.plugin.platform.PlatformViewsController;
 import io.flutter.util.Preconditions;
 import io.flutter.view.AccessibilityBridge;
 import io.flutter.view.FlutterCallbackInformation;
+import io.flutter.view.TextureRegistry;
 import java.io.IOException;
 import java.lang.ref.WeakReference;
 import java.nio.ByteBuffer;
@@ -867,6 +868,29 @@ public class FlutterJNI {
       long textureId,
       @NonNull WeakReference<SurfaceTextureWrapper> textureWrapper);
 
+  /**
+   * Gives control of an {@link TextureRegistry.ImageConsumer} to Flutter so that the images it
+   * provides can be displayed within Flutter's UI.
+   *
+   * <p>The engine takes an image from {@code imageConsumer} on the raster thread each time {@link
+   * #markTextureFrameAvailable(long)} is called for {@code textureId}.
+   */
+  @UiThread
+  public void registerImageTexture(
+      long textureId, @NonNull TextureRegistry.ImageConsumer imageConsumer) {
+    ensureRunningOnMainThread();
+    ensureAttachedToNative();
+    nativeRegisterImageTexture(
+        nativeShellHolderId,
+        textureId,
+        new WeakReference<TextureRegistry.ImageConsumer>(imageConsumer));
+  }
+
+  private native void nativeRegisterImageTexture(
+      long nativeShellHolderId,
+      long textureId,
+      @NonNull WeakReference<TextureRegistry.ImageConsumer> imageConsumer);
+
   /**
    * Call this method to inform Flutter that a texture previously registered with {@link
    * #registerTexture(long, SurfaceTextureWrapper)} has a new frame available.
@@ -43,6 +43,14 @@ public class FlutterLoader {
       "io.flutter.embedding.android.EnableSkParagraph";
   private static final String ENABLE_IMPELLER_META_DATA_KEY =
       "io.flutter.embedding.android.EnableImpeller";
+  private static final String RASTER_CACHE_LRU_EVICTION_META_DATA_KEY =
+      "io.flutter.embedding.android.RasterCacheLruEviction";
+  private static final String RASTER_CACHE_COMPRESSION_META_DATA_KEY =
+      "io.flutter.embedding.android.RasterCacheCompression";
+  private static final String SPAWNED_ENGINES_SHARE_RENDERING_RESOURCES_META_DATA_KEY =
+      "io.flutter.embedding.android.SpawnedEnginesShareRenderingResources";
+  private static final String ENABLE_ASSET_LOOKUP_INDEX_META_DATA_KEY =
+      "io.flutter.embedding.android.EnableAssetLookupIndex";
 
   /**
    * Set whether leave or clean up the VM after the last shell shuts down. It can be set from app's
@@ -326,6 +334,26 @@ public class FlutterLoader {
         shellArgs.add("--enable-impeller");
       }
 
+      if (metaData != null
+          && metaData.getBoolean(RASTER_CACHE_LRU_EVICTION_META_DATA_KEY, false)) {
+        shellArgs.add("--raster-cache-lru-eviction");
+      }
+
+      if (metaData != null
+          && metaData.getBoolean(RASTER_CACHE_COMPRESSION_META_DATA_KEY, false)) {
+        shellArgs.add("--raster-cache-compression");
+      }
+
+      if (metaData != null
+          && metaData.getBoolean(SPAWNED_ENGINES_SHARE_RENDERING_RESOURCES_META_DATA_KEY, false)) {
+        shellArgs.add("--spawned-engines-share-rendering-resources");
+      }
+
+      if (metaData != null
+          && metaData.getBoolean(ENABLE_ASSET_LOOKUP_INDEX_META_DATA_KEY, false)) {
+        shellArgs.add("--enable-asset-lookup-index");
+      }
+
       final String leakVM = isLeakVM(metaData) ? "true" : "false";
       shellArgs.add("--leak-vm=" + leakVM);
 
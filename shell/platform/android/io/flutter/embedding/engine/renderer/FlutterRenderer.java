@@ -7,6 +7,7 @@ package io.flutter.embedding.engine.renderer;
 import android.graphics.Bitmap;
 import android.graphics.Rect;
 import android.graphics.SurfaceTexture;
+import android.media.Image;
 import android.os.Build;
 import android.os.Handler;
 import android.view.Surface;
@@ -158,6 +159,20 @@ public class FlutterRenderer implements TextureRegistry {
     return entry;
   }
 
+  /**
+   * Creates and returns a texture that displays the {@link Image}s pushed to it, which is also
+   * made available to Flutter code.
+   */
+  @Override
+  @NonNull
+  public ImageTextureEntry createImageTexture() {
+    final ImageTextureRegistryEntry entry =
+        new ImageTextureRegistryEntry(nextTextureId.getAndIncrement());
+    Log.v(TAG, "New ImageTexture ID: " + entry.id());
+    registerImageTexture(entry.id(), entry);
+    return entry;
+  }
+
   @Override
   public void onTrimMemory(int level) {
     final Iterator<WeakReference<OnTrimMemoryListener>> iterator = onTrimMemoryListeners.iterator();
@@ -305,6 +320,71 @@ public class FlutterRenderer implements TextureRegistry {
       flutterJNI.unregisterTexture(id);
     }
   }
+
+  final class ImageTextureRegistryEntry
+      implements TextureRegistry.ImageTextureEntry, TextureRegistry.ImageConsumer {
+    private final long id;
+    private boolean released;
+    // Written by the producer thread and read by the raster thread.
+    @Nullable private Image image;
+
+    ImageTextureRegistryEntry(long id) {
+      this.id = id;
+    }
+
+    @Override
+    public long id() {
+      return id;
+    }
+
+    @Override
+    public void release() {
+      if (released) {
+        return;
+      }
+      released = true;
+      Log.v(TAG, "Releasing an ImageTexture (" + id + ").");
+      synchronized (this) {
+        if (image != null) {
+          image.close();
+          image = null;
+        }
+      }
+      unregisterTexture(id);
+    }
+
+    @Override
+    public void pushImage(@Nullable Image image) {
+      if (released) {
+        if (image != null) {
+          image.close();
+        }
+        return;
+      }
+      synchronized (this) {
+        // An image the engine has not taken yet is skipped, the texture only shows the latest one.
+        if (this.image != null) {
+          this.image.close();
+        }
+        this.image = image;
+      }
+      // Images are usually pushed from the thread of an ImageReader listener.
+      handler.post(
+          () -> {
+            if (!released && flutterJNI.isAttached()) {
+              markTextureFrameAvailable(id);
+            }
+          });
+    }
+
+    @Override
+    @Nullable
+    public synchronized Image acquireLatestImage() {
+      final Image latest = image;
+      image = null;
+      return latest;
+    }
+  }
   // ------ END TextureRegistry IMPLEMENTATION ----
 
   /**
@@ -488,6 +568,11 @@ public class FlutterRenderer implements TextureRegistry {
     flutterJNI.registerTexture(textureId, textureWrapper);
   }
 
+  private void registerImageTexture(
+      long textureId, @NonNull TextureRegistry.ImageConsumer imageConsumer) {
+    flutterJNI.registerImageTexture(textureId, imageConsumer);
+  }
+
   // TODO(mattcarroll): describe the native behavior that this invokes
   private void markTextureFrameAvailable(long textureId) {
     flutterJNI.markTextureFrameAvailable(textureId);
@@ -5,6 +5,7 @@
 package io.flutter.view;
 
 import android.graphics.SurfaceTexture;
+import android.media.Image;
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
 
@@ -31,6 +32,20 @@ public interface TextureRegistry {
   @NonNull
   SurfaceTextureEntry registerSurfaceTexture(@NonNull SurfaceTexture surfaceTexture);
 
+  /**
+   * Creates and registers a texture that displays the {@link Image}s pushed to it.
+   *
+   * <p>Unlike a {@link SurfaceTexture}, the images are sampled directly from their hardware
+   * buffers, without a copy and without an OpenGL ES context. This requires Android API 28 and the
+   * Impeller Vulkan backend.
+   *
+   * @return An ImageTextureEntry.
+   */
+  @NonNull
+  default ImageTextureEntry createImageTexture() {
+    throw new UnsupportedOperationException("Image textures are not supported.");
+  }
+
   /**
    * Callback invoked when memory is low.
    *
@@ -57,6 +72,36 @@ public interface TextureRegistry {
     default void setOnTrimMemoryListener(@Nullable OnTrimMemoryListener listener) {}
   }
 
+  /** A registry entry for a texture that displays a stream of {@link Image}s. */
+  interface ImageTextureEntry {
+    /** @return The identity of this texture. */
+    long id();
+
+    /** Deregisters and releases this texture and the last image pushed to it. */
+    void release();
+
+    /**
+     * Displays {@code image} in the next frame. The texture takes ownership of the image and closes
+     * it once it has been replaced.
+     *
+     * <p>The image must be backed by a {@link android.hardware.HardwareBuffer}, for example
+     * because it was acquired from an {@link android.media.ImageReader} created with {@link
+     * android.hardware.HardwareBuffer#USAGE_GPU_SAMPLED_IMAGE}.
+     */
+    void pushImage(@Nullable Image image);
+  }
+
+  /** The side of an {@link ImageTextureEntry} that the engine takes images from. */
+  interface ImageConsumer {
+    /**
+     * Takes the most recently pushed image. The caller becomes responsible for closing it.
+     *
+     * @return The image, or null if no image has been pushed since the last call.
+     */
+    @Nullable
+    Image acquireLatestImage();
+  }
+
   /** Listener invoked when the most recent image has been consumed. */
   interface OnFrameConsumedListener {
     /**
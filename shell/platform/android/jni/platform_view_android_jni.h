@@ -109,6 +109,35 @@ class PlatformViewAndroidJNI {
   virtual void SurfaceTextureDetachFromGLContext(
       JavaLocalRef surface_texture) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Takes the most recent android.media.Image from an
+  ///             ImageConsumer. The caller must close the image.
+  ///
+  /// @return     The image, or a null reference if no image has been pushed
+  ///             since the last call.
+  ///
+  virtual JavaLocalRef ImageConsumerAcquireLatestImage(
+      JavaLocalRef image_consumer) = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Gets the android.hardware.HardwareBuffer that backs an
+  ///             android.media.Image. The caller must close the buffer.
+  ///
+  /// @note       Requires API 28. Returns a null reference on older versions.
+  ///
+  virtual JavaLocalRef ImageGetHardwareBuffer(JavaLocalRef image) = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Closes an android.media.Image, returning its buffer to the
+  ///             producer.
+  ///
+  virtual void ImageClose(JavaLocalRef image) = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Closes an android.hardware.HardwareBuffer.
+  ///
+  virtual void HardwareBufferClose(JavaLocalRef hardware_buffer) = 0;
+
   //----------------------------------------------------------------------------
   /// @brief      Positions and sizes a platform view if using hybrid
   ///             composition.
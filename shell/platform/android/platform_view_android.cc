@@ -21,6 +21,7 @@
 #endif
 #include "flutter/shell/platform/android/context/android_context.h"
 #include "flutter/shell/platform/android/external_view_embedder/external_view_embedder.h"
+#include "flutter/shell/platform/android/image_external_texture_vk.h"
 #include "flutter/shell/platform/android/jni/platform_view_android_jni.h"
 #include "flutter/shell/platform/android/platform_message_response_android.h"
 #include "flutter/shell/platform/android/surface/android_surface.h"
@@ -29,13 +30,18 @@
 
 namespace flutter {
 
+// TODO(kaushikiska@): Enable this after wiring a preference for Vulkan backend.
+static constexpr bool kEnableVulkanImpeller = false;
+
 AndroidSurfaceFactoryImpl::AndroidSurfaceFactoryImpl(
     const std::shared_ptr<AndroidContext>& context,
     std::shared_ptr<PlatformViewAndroidJNI> jni_facade,
-    bool enable_impeller)
+    bool enable_impeller,
+    bool share_impeller_resources)
     : android_context_(context),
       jni_facade_(std::move(jni_facade)),
-      enable_impeller_(enable_impeller) {}
+      enable_impeller_(enable_impeller),
+      share_impeller_resources_(share_impeller_resources) {}
 
 AndroidSurfaceFactoryImpl::~AndroidSurfaceFactoryImpl() = default;
 
@@ -46,15 +52,12 @@ std::unique_ptr<AndroidSurface> AndroidSurfaceFactoryImpl::CreateSurface() {
                                                       jni_facade_);
     case AndroidRenderingAPI::kOpenGLES:
       if (enable_impeller_) {
-// TODO(kaushikiska@): Enable this after wiring a preference for Vulkan backend.
-#if false
-        return std::make_unique<AndroidSurfaceVulkanImpeller>(android_context_,
-                                                              jni_facade_);
-
-#else
+        if (kEnableVulkanImpeller) {
+          return std::make_unique<AndroidSurfaceVulkanImpeller>(
+              android_context_, jni_facade_, share_impeller_resources_);
+        }
         return std::make_unique<AndroidSurfaceGLImpeller>(android_context_,
                                                           jni_facade_);
-#endif
       } else {
         return std::make_unique<AndroidSurfaceGLSkia>(android_context_,
                                                       jni_facade_);
@@ -113,9 +116,10 @@ PlatformViewAndroid::PlatformViewAndroid(
   if (android_context_) {
     FML_CHECK(android_context_->IsValid())
         << "Could not create surface from invalid Android context.";
+    const Settings& settings = delegate.OnPlatformViewGetSettings();
     surface_factory_ = std::make_shared<AndroidSurfaceFactoryImpl>(
-        android_context_, jni_facade_,
-        delegate.OnPlatformViewGetSettings().enable_impeller);
+        android_context_, jni_facade_, settings.enable_impeller,
+        settings.spawned_engines_share_rendering_resources);
     android_surface_ = surface_factory_->CreateSurface();
 
     FML_CHECK(android_surface_ && android_surface_->IsValid())
@@ -275,6 +279,22 @@ void PlatformViewAndroid::RegisterExternalTexture(
   }
 }
 
+void PlatformViewAndroid::RegisterImageTexture(
+    int64_t texture_id,
+    const fml::jni::ScopedJavaGlobalRef<jobject>& image_consumer) {
+  if (kEnableVulkanImpeller &&
+      delegate_.OnPlatformViewGetSettings().enable_impeller &&
+      android_context_->RenderingApi() == AndroidRenderingAPI::kOpenGLES) {
+    // Only the Vulkan surface creates the Impeller context of the view.
+    RegisterTexture(std::make_shared<ImageExternalTextureVK>(
+        texture_id, image_consumer, jni_facade_,
+        std::static_pointer_cast<impeller::ContextVK>(GetImpellerContext())));
+  } else {
+    FML_LOG(INFO) << "Attempted to use an image texture without the Vulkan "
+                     "backend of Impeller.";
+  }
+}
+
 // |PlatformView|
 std::unique_ptr<VsyncWaiter> PlatformViewAndroid::CreateVSyncWaiter() {
   return std::make_unique<VsyncWaiterAndroid>(task_runners_);
@@ -28,7 +28,8 @@ class AndroidSurfaceFactoryImpl : public AndroidSurfaceFactory {
  public:
   AndroidSurfaceFactoryImpl(const std::shared_ptr<AndroidContext>& context,
                             std::shared_ptr<PlatformViewAndroidJNI> jni_facade,
-                            bool enable_impeller);
+                            bool enable_impeller,
+                            bool share_impeller_resources);
 
   ~AndroidSurfaceFactoryImpl() override;
 
@@ -38,6 +39,7 @@ class AndroidSurfaceFactoryImpl : public AndroidSurfaceFactory {
   const std::shared_ptr<AndroidContext>& android_context_;
   std::shared_ptr<PlatformViewAndroidJNI> jni_facade_;
   const bool enable_impeller_;
+  const bool share_impeller_resources_;
 };
 
 class PlatformViewAndroid final : public PlatformView {
@@ -93,6 +95,14 @@ class PlatformViewAndroid final : public PlatformView {
       int64_t texture_id,
       const fml::jni::ScopedJavaGlobalRef<jobject>& surface_texture);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Registers a texture that displays the images of an
+  ///             ImageConsumer. Requires the Vulkan backend of Impeller.
+  ///
+  void RegisterImageTexture(
+      int64_t texture_id,
+      const fml::jni::ScopedJavaGlobalRef<jobject>& image_consumer);
+
   // |PlatformView|
   void LoadDartDeferredLibrary(
       intptr_t loading_unit_id,
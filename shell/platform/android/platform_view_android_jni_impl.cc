@@ -47,6 +47,12 @@ static fml::jni::ScopedJavaGlobalRef<jclass>* g_java_weak_reference_class =
 
 static fml::jni::ScopedJavaGlobalRef<jclass>* g_texture_wrapper_class = nullptr;
 
+static fml::jni::ScopedJavaGlobalRef<jclass>* g_image_consumer_class = nullptr;
+
+static fml::jni::ScopedJavaGlobalRef<jclass>* g_image_class = nullptr;
+
+static fml::jni::ScopedJavaGlobalRef<jclass>* g_hardware_buffer_class = nullptr;
+
 static fml::jni::ScopedJavaGlobalRef<jclass>* g_java_long_class = nullptr;
 
 static fml::jni::ScopedJavaGlobalRef<jclass>* g_bitmap_class = nullptr;
@@ -104,6 +110,14 @@ static jmethodID g_get_transform_matrix_method = nullptr;
 
 static jmethodID g_detach_from_gl_context_method = nullptr;
 
+static jmethodID g_acquire_latest_image_method = nullptr;
+
+static jmethodID g_image_get_hardware_buffer_method = nullptr;
+
+static jmethodID g_image_close_method = nullptr;
+
+static jmethodID g_hardware_buffer_close_method = nullptr;
+
 static jmethodID g_compute_platform_resolved_locale_method = nullptr;
 
 static jmethodID g_request_dart_deferred_library_method = nullptr;
@@ -465,6 +479,17 @@ static void RegisterTexture(JNIEnv* env,
   );
 }
 
+static void RegisterImageTexture(JNIEnv* env,
+                                 jobject jcaller,
+                                 jlong shell_holder,
+                                 jlong texture_id,
+                                 jobject image_consumer) {
+  ANDROID_SHELL_HOLDER->GetPlatformView()->RegisterImageTexture(
+      static_cast<int64_t>(texture_id),                            //
+      fml::jni::ScopedJavaGlobalRef<jobject>(env, image_consumer)  //
+  );
+}
+
 static void MarkTextureFrameAvailable(JNIEnv* env,
                                       jobject jcaller,
                                       jlong shell_holder,
@@ -732,6 +757,12 @@ bool RegisterApi(JNIEnv* env) {
                        "WeakReference;)V",
           .fnPtr = reinterpret_cast<void*>(&RegisterTexture),
       },
+      {
+          .name = "nativeRegisterImageTexture",
+          .signature = "(JJLjava/lang/ref/"
+                       "WeakReference;)V",
+          .fnPtr = reinterpret_cast<void*>(&RegisterImageTexture),
+      },
       {
           .name = "nativeMarkTextureFrameAvailable",
           .signature = "(JJ)V",
@@ -1112,6 +1143,57 @@ bool PlatformViewAndroid::Register(JNIEnv* env) {
     return false;
   }
 
+  g_image_consumer_class = new fml::jni::ScopedJavaGlobalRef<jclass>(
+      env, env->FindClass("io/flutter/view/TextureRegistry$ImageConsumer"));
+  if (g_image_consumer_class->is_null()) {
+    FML_LOG(ERROR) << "Could not locate TextureRegistry.ImageConsumer class";
+    return false;
+  }
+
+  g_acquire_latest_image_method =
+      env->GetMethodID(g_image_consumer_class->obj(), "acquireLatestImage",
+                       "()Landroid/media/Image;");
+  if (g_acquire_latest_image_method == nullptr) {
+    FML_LOG(ERROR) << "Could not locate acquireLatestImage method";
+    return false;
+  }
+
+  g_image_class = new fml::jni::ScopedJavaGlobalRef<jclass>(
+      env, env->FindClass("android/media/Image"));
+  if (g_image_class->is_null()) {
+    FML_LOG(ERROR) << "Could not locate Image class";
+    return false;
+  }
+
+  g_image_close_method = env->GetMethodID(g_image_class->obj(), "close", "()V");
+  if (g_image_close_method == nullptr) {
+    FML_LOG(ERROR) << "Could not locate Image.close method";
+    return false;
+  }
+
+  // Image.getHardwareBuffer and the HardwareBuffer class were added in API 28.
+  // Image textures are unavailable on older versions, which is not an error.
+  g_image_get_hardware_buffer_method =
+      env->GetMethodID(g_image_class->obj(), "getHardwareBuffer",
+                       "()Landroid/hardware/HardwareBuffer;");
+  if (g_image_get_hardware_buffer_method == nullptr) {
+    env->ExceptionClear();
+  } else {
+    g_hardware_buffer_class = new fml::jni::ScopedJavaGlobalRef<jclass>(
+        env, env->FindClass("android/hardware/HardwareBuffer"));
+    if (g_hardware_buffer_class->is_null()) {
+      FML_LOG(ERROR) << "Could not locate HardwareBuffer class";
+      return false;
+    }
+
+    g_hardware_buffer_close_method =
+        env->GetMethodID(g_hardware_buffer_class->obj(), "close", "()V");
+    if (g_hardware_buffer_close_method == nullptr) {
+      FML_LOG(ERROR) << "Could not locate HardwareBuffer.close method";
+      return false;
+    }
+  }
+
   g_compute_platform_resolved_locale_method = env->GetMethodID(
       g_flutter_jni_class->obj(), "computePlatformResolvedLocale",
       "([Ljava/lang/String;)[Ljava/lang/String;");
@@ -1405,6 +1487,71 @@ void PlatformViewAndroidJNIImpl::SurfaceTextureDetachFromGLContext(
   FML_CHECK(fml::jni::CheckException(env));
 }
 
+JavaLocalRef PlatformViewAndroidJNIImpl::ImageConsumerAcquireLatestImage(
+    JavaLocalRef image_consumer) {
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+
+  if (image_consumer.is_null()) {
+    return JavaLocalRef();
+  }
+
+  fml::jni::ScopedJavaLocalRef<jobject> image_consumer_local_ref(
+      env, env->CallObjectMethod(image_consumer.obj(),
+                                 g_java_weak_reference_get_method));
+  if (image_consumer_local_ref.is_null()) {
+    return JavaLocalRef();
+  }
+
+  JavaLocalRef image(env, env->CallObjectMethod(image_consumer_local_ref.obj(),
+                                                g_acquire_latest_image_method));
+
+  FML_CHECK(fml::jni::CheckException(env));
+
+  return image;
+}
+
+JavaLocalRef PlatformViewAndroidJNIImpl::ImageGetHardwareBuffer(
+    JavaLocalRef image) {
+  if (image.is_null() || g_image_get_hardware_buffer_method == nullptr) {
+    return JavaLocalRef();
+  }
+
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+
+  JavaLocalRef hardware_buffer(
+      env,
+      env->CallObjectMethod(image.obj(), g_image_get_hardware_buffer_method));
+
+  FML_CHECK(fml::jni::CheckException(env));
+
+  return hardware_buffer;
+}
+
+void PlatformViewAndroidJNIImpl::ImageClose(JavaLocalRef image) {
+  if (image.is_null()) {
+    return;
+  }
+
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+
+  env->CallVoidMethod(image.obj(), g_image_close_method);
+
+  FML_CHECK(fml::jni::CheckException(env));
+}
+
+void PlatformViewAndroidJNIImpl::HardwareBufferClose(
+    JavaLocalRef hardware_buffer) {
+  if (hardware_buffer.is_null() || g_hardware_buffer_close_method == nullptr) {
+    return;
+  }
+
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+
+  env->CallVoidMethod(hardware_buffer.obj(), g_hardware_buffer_close_method);
+
+  FML_CHECK(fml::jni::CheckException(env));
+}
+
 void PlatformViewAndroidJNIImpl::FlutterViewOnDisplayPlatformView(
     int view_id,
     int x,
@@ -3,6 +3,7 @@ package io.flutter.embedding.engine.renderer;
 import static android.content.ComponentCallbacks2.TRIM_MEMORY_COMPLETE;
 import static org.junit.Assert.assertArrayEquals;
 import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNull;
 import static org.mockito.ArgumentMatchers.anyFloat;
 import static org.mockito.ArgumentMatchers.anyInt;
 import static org.mockito.ArgumentMatchers.eq;
@@ -16,6 +17,7 @@ import static org.robolectric.Shadows.shadowOf;
 
 import android.graphics.Rect;
 import android.graphics.SurfaceTexture;
+import android.media.Image;
 import android.os.Looper;
 import android.view.Surface;
 import androidx.test.ext.junit.runners.AndroidJUnit4;
@@ -393,4 +395,46 @@ public class FlutterRendererTest {
     // Verify behavior under test.
     assertEquals(1, invocationCount.get());
   }
+
+  @Test
+  public void itPassesOnlyTheLatestImageOfAnImageTexture() {
+    // Setup the test.
+    FlutterRenderer flutterRenderer = new FlutterRenderer(fakeFlutterJNI);
+    when(fakeFlutterJNI.isAttached()).thenReturn(true);
+    FlutterRenderer.ImageTextureRegistryEntry entry =
+        (FlutterRenderer.ImageTextureRegistryEntry) flutterRenderer.createImageTexture();
+    verify(fakeFlutterJNI, times(1)).registerImageTexture(eq(entry.id()), eq(entry));
+    Image firstImage = mock(Image.class);
+    Image secondImage = mock(Image.class);
+
+    // Execute the behavior under test.
+    entry.pushImage(firstImage);
+    entry.pushImage(secondImage);
+    shadowOf(Looper.getMainLooper()).idle();
+
+    // Verify the behavior under test.
+    verify(firstImage, times(1)).close();
+    verify(fakeFlutterJNI, times(2)).markTextureFrameAvailable(eq(entry.id()));
+    assertEquals(secondImage, entry.acquireLatestImage());
+    assertNull(entry.acquireLatestImage());
+    verify(secondImage, never()).close();
+  }
+
+  @Test
+  public void itClosesThePendingImageWhenAnImageTextureIsReleased() {
+    // Setup the test.
+    FlutterRenderer flutterRenderer = new FlutterRenderer(fakeFlutterJNI);
+    FlutterRenderer.ImageTextureRegistryEntry entry =
+        (FlutterRenderer.ImageTextureRegistryEntry) flutterRenderer.createImageTexture();
+    Image image = mock(Image.class);
+    entry.pushImage(image);
+
+    // Execute the behavior under test.
+    entry.release();
+
+    // Verify the behavior under test.
+    verify(image, times(1)).close();
+    verify(fakeFlutterJNI, times(1)).unregisterTexture(eq(entry.id()));
+    assertNull(entry.acquireLatestImage());
+  }
 }
@@ -4,7 +4,9 @@
 
 #include "flutter/shell/platform/android/vsync_waiter_android.h"
 
+#include <atomic>
 #include <cmath>
+#include <string>
 #include <utility>
 
 #include "flutter/common/task_runners.h"
@@ -20,6 +22,10 @@ namespace flutter {
 static fml::jni::ScopedJavaGlobalRef<jclass>* g_vsync_waiter_class = nullptr;
 static jmethodID g_async_wait_for_vsync_method_ = nullptr;
 static std::atomic_uint g_refresh_rate_ = 60;
+// The vsync period reported by the choreographer, which takes precedence
+// over the refresh rate reported by Java because it is updated as soon as
+// the display switches between refresh rates.
+static std::atomic_int64_t g_ndk_vsync_period_nanos_ = 0;
 
 VsyncWaiterAndroid::VsyncWaiterAndroid(const flutter::TaskRunners& task_runners)
     : VsyncWaiter(task_runners),
@@ -34,6 +40,12 @@ void VsyncWaiterAndroid::AwaitVSync() {
     auto* weak_this = new std::weak_ptr<VsyncWaiter>(shared_from_this());
     fml::TaskRunner::RunNowOrPostTask(
         task_runners_.GetUITaskRunner(), [weak_this]() {
+          // Refresh rate callbacks are delivered on the thread they were
+          // registered on, and every UI thread has its own choreographer.
+          static thread_local bool registered_refresh_rate_callback =
+              AndroidChoreographer::RegisterRefreshRateCallback(
+                  &OnRefreshRateFromNDK, nullptr);
+          (void)registered_refresh_rate_callback;
           AndroidChoreographer::PostFrameCallback(&OnVsyncFromNDK, weak_this);
         });
   } else {
@@ -60,12 +72,36 @@ void VsyncWaiterAndroid::OnVsyncFromNDK(int64_t frame_nanos, void* data) {
   if (frame_time > now) {
     frame_time = now;
   }
-  auto target_time = frame_time + fml::TimeDelta::FromNanoseconds(
-                                      1000000000.0 / g_refresh_rate_);
+  int64_t vsync_period_nanos = g_ndk_vsync_period_nanos_;
+  if (vsync_period_nanos <= 0) {
+    vsync_period_nanos = 1000000000.0 / g_refresh_rate_;
+  }
+  auto target_time =
+      frame_time + fml::TimeDelta::FromNanoseconds(vsync_period_nanos);
   auto* weak_this = reinterpret_cast<std::weak_ptr<VsyncWaiter>*>(data);
   ConsumePendingCallback(weak_this, frame_time, target_time);
 }
 
+// static
+void VsyncWaiterAndroid::OnRefreshRateFromNDK(int64_t vsync_period_nanos,
+                                              void* data) {
+  if (vsync_period_nanos <= 0) {
+    return;
+  }
+  TRACE_EVENT1("flutter", "RefreshRateCallback", "vsync_period_nanos",
+               std::to_string(vsync_period_nanos).c_str());
+  g_ndk_vsync_period_nanos_ = vsync_period_nanos;
+}
+
+// static
+std::optional<double> VsyncWaiterAndroid::GetRefreshRateFromNDK() {
+  int64_t vsync_period_nanos = g_ndk_vsync_period_nanos_;
+  if (vsync_period_nanos <= 0) {
+    return std::nullopt;
+  }
+  return 1000000000.0 / vsync_period_nanos;
+}
+
 // static
 void VsyncWaiterAndroid::OnVsyncFromJava(JNIEnv* env,
                                          jclass jcaller,
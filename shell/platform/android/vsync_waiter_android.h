@@ -8,6 +8,7 @@
 #include <jni.h>
 
 #include <memory>
+#include <optional>
 
 #include "flutter/fml/macros.h"
 #include "flutter/shell/common/vsync_waiter.h"
@@ -24,12 +25,18 @@ class VsyncWaiterAndroid final : public VsyncWaiter {
 
   ~VsyncWaiterAndroid() override;
 
+  // The refresh rate last reported by the NDK choreographer, or nullopt if
+  // the choreographer doesn't report refresh rate changes on this device.
+  static std::optional<double> GetRefreshRateFromNDK();
+
  private:
   // |VsyncWaiter|
   void AwaitVSync() override;
 
   static void OnVsyncFromNDK(int64_t frame_nanos, void* data);
 
+  static void OnRefreshRateFromNDK(int64_t vsync_period_nanos, void* data);
+
   static void OnVsyncFromJava(JNIEnv* env,
                               jclass jcaller,
                               jlong frameDelayNanos,
@@ -4,9 +4,12 @@
 
 #include "accessibility_bridge.h"
 
+#include <cmath>
 #include <functional>
 #include <utility>
 
+#include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/third_party/accessibility/ax/ax_tree_update.h"
 #include "flutter/third_party/accessibility/base/logging.h"
 
@@ -41,6 +44,12 @@ void AccessibilityBridge::AddFlutterSemanticsCustomActionUpdate(
 }
 
 void AccessibilityBridge::CommitUpdates() {
+  TRACE_EVENT1("flutter", "AccessibilityBridge::CommitUpdates", "nodes",
+               std::to_string(pending_semantics_node_updates_.size()).c_str());
+  const fml::TimePoint start = fml::TimePoint::Now();
+  last_commit_stats_ = CommitStats();
+  last_commit_stats_.node_count = pending_semantics_node_updates_.size();
+
   // AXTree cannot move a node in a single update.
   // This must be split across two updates:
   //
@@ -83,31 +92,38 @@ void AccessibilityBridge::CommitUpdates() {
   }
 
   for (size_t i = results.size(); i > 0; i--) {
-    for (SemanticsNode node : results[i - 1]) {
-      ConvertFlutterUpdate(node, update);
+    for (const SemanticsNode& node : results[i - 1]) {
+      ConvertIncrementalFlutterUpdate(node, update);
     }
   }
 
-  tree_.Unserialize(update);
+  {
+    TRACE_EVENT0("flutter", "AccessibilityBridge::UpdateTree");
+    tree_.Unserialize(update);
+  }
   pending_semantics_node_updates_.clear();
   pending_semantics_custom_action_updates_.clear();
+  last_commit_stats_.tree_update_duration = fml::TimePoint::Now() - start;
 
   std::string error = tree_.error();
   if (!error.empty()) {
     FML_LOG(ERROR) << "Failed to update ui::AXTree, error: " << error;
+    // The committed nodes may not match the tree anymore.
+    committed_semantics_nodes_.clear();
     return;
   }
-  // Handles accessibility events as the result of the semantics update.
+  // Handles accessibility events as the result of the semantics update. The
+  // delegates of the targets are only created if the subclass requests them.
   for (const auto& targeted_event : event_generator_) {
-    auto event_target =
-        GetFlutterPlatformNodeDelegateFromID(targeted_event.node->id());
-    if (event_target.expired()) {
+    if (!tree_.GetFromId(targeted_event.node->id())) {
       continue;
     }
 
+    last_commit_stats_.event_count++;
     OnAccessibilityEvent(targeted_event);
   }
   event_generator_.ClearEvents();
+  last_commit_stats_.total_duration = fml::TimePoint::Now() - start;
 }
 
 std::weak_ptr<FlutterPlatformNodeDelegate>
@@ -118,7 +134,27 @@ AccessibilityBridge::GetFlutterPlatformNodeDelegateFromID(
     return iter->second;
   }
 
-  return std::weak_ptr<FlutterPlatformNodeDelegate>();
+  ui::AXNode* node = tree_.GetFromId(id);
+  if (!node) {
+    return std::weak_ptr<FlutterPlatformNodeDelegate>();
+  }
+  // Creating the delegate does not change the observable state of the
+  // bridge.
+  return const_cast<AccessibilityBridge*>(this)->CreatePlatformNodeDelegate(
+      node);
+}
+
+std::shared_ptr<FlutterPlatformNodeDelegate>
+AccessibilityBridge::CreatePlatformNodeDelegate(ui::AXNode* node) {
+  TRACE_EVENT0("flutter", "AccessibilityBridge::CreatePlatformNodeDelegate");
+  std::shared_ptr<FlutterPlatformNodeDelegate> platform_node_delegate =
+      CreateFlutterPlatformNodeDelegate();
+  platform_node_delegate->Init(
+      std::static_pointer_cast<FlutterPlatformNodeDelegate::OwnerBridge>(
+          shared_from_this()),
+      node);
+  id_wrapper_map_[node->id()] = platform_node_delegate;
+  return platform_node_delegate;
 }
 
 const ui::AXTreeData& AccessibilityBridge::GetAXTreeData() const {
@@ -132,16 +168,13 @@ AccessibilityBridge::GetPendingEvents() const {
   return result;
 }
 
+const AccessibilityBridge::CommitStats&
+AccessibilityBridge::GetLastCommitStats() const {
+  return last_commit_stats_;
+}
+
 void AccessibilityBridge::RecreateNodeDelegates() {
-  for (const auto& [node_id, old_platform_node_delegate] : id_wrapper_map_) {
-    std::shared_ptr<FlutterPlatformNodeDelegate> platform_node_delegate =
-        CreateFlutterPlatformNodeDelegate();
-    platform_node_delegate->Init(
-        std::static_pointer_cast<FlutterPlatformNodeDelegate::OwnerBridge>(
-            shared_from_this()),
-        old_platform_node_delegate->GetAXNode());
-    id_wrapper_map_[node_id] = platform_node_delegate;
-  }
+  id_wrapper_map_.clear();
 }
 
 void AccessibilityBridge::OnNodeWillBeDeleted(ui::AXTree* tree,
@@ -160,11 +193,6 @@ void AccessibilityBridge::OnRoleChanged(ui::AXTree* tree,
 
 void AccessibilityBridge::OnNodeCreated(ui::AXTree* tree, ui::AXNode* node) {
   BASE_DCHECK(node);
-  id_wrapper_map_[node->id()] = CreateFlutterPlatformNodeDelegate();
-  id_wrapper_map_[node->id()]->Init(
-      std::static_pointer_cast<FlutterPlatformNodeDelegate::OwnerBridge>(
-          shared_from_this()),
-      node);
 }
 
 void AccessibilityBridge::OnNodeDeleted(ui::AXTree* tree,
@@ -173,6 +201,7 @@ void AccessibilityBridge::OnNodeDeleted(ui::AXTree* tree,
   if (id_wrapper_map_.find(node_id) != id_wrapper_map_.end()) {
     id_wrapper_map_.erase(node_id);
   }
+  committed_semantics_nodes_.erase(node_id);
 }
 
 void AccessibilityBridge::OnAtomicUpdateFinished(
@@ -264,6 +293,32 @@ void AccessibilityBridge::GetSubTreeList(const SemanticsNode& target,
   }
 }
 
+void AccessibilityBridge::ConvertIncrementalFlutterUpdate(
+    const SemanticsNode& node,
+    ui::AXTreeUpdate& tree_update) {
+  auto committed = committed_semantics_nodes_.find(node.id);
+  ui::AXNode* ax_node = tree_.GetFromId(node.id);
+  // The descriptions of custom actions come with each update, so nodes with
+  // custom actions are always converted in full.
+  if (committed == committed_semantics_nodes_.end() || !ax_node ||
+      !node.custom_accessibility_actions.empty() ||
+      !IsSameNodeExceptBounds(committed->second, node)) {
+    ConvertFlutterUpdate(node, tree_update);
+  } else if (!IsSameBounds(committed->second, node)) {
+    // Only the geometry changed, which is the case for most of the nodes of
+    // a list that is being scrolled.
+    ui::AXNodeData node_data = ax_node->data();
+    SetBoundsFromFlutterUpdate(node_data, node);
+    SetTreeData(node, tree_update);
+    tree_update.nodes.push_back(std::move(node_data));
+  } else {
+    // The tree already has this node, but the selection and focus are still
+    // applied in case another node of the update changed them.
+    SetTreeData(node, tree_update);
+  }
+  committed_semantics_nodes_[node.id] = node;
+}
+
 void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
                                                ui::AXTreeUpdate& tree_update) {
   ui::AXNodeData node_data;
@@ -278,6 +333,17 @@ void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
   SetNameFromFlutterUpdate(node_data, node);
   SetValueFromFlutterUpdate(node_data, node);
   SetTooltipFromFlutterUpdate(node_data, node);
+  SetBoundsFromFlutterUpdate(node_data, node);
+  for (auto child : node.children_in_traversal_order) {
+    node_data.child_ids.push_back(child);
+  }
+  SetTreeData(node, tree_update);
+  tree_update.nodes.push_back(node_data);
+}
+
+void AccessibilityBridge::SetBoundsFromFlutterUpdate(
+    ui::AXNodeData& node_data,
+    const SemanticsNode& node) {
   node_data.relative_bounds.bounds.SetRect(node.rect.left, node.rect.top,
                                            node.rect.right - node.rect.left,
                                            node.rect.bottom - node.rect.top);
@@ -286,11 +352,6 @@ void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
       node.transform.skewY, node.transform.scaleY, node.transform.transY, 0,
       node.transform.pers0, node.transform.pers1, node.transform.pers2, 0, 0, 0,
       0, 0);
-  for (auto child : node.children_in_traversal_order) {
-    node_data.child_ids.push_back(child);
-  }
-  SetTreeData(node, tree_update);
-  tree_update.nodes.push_back(node_data);
 }
 
 void AccessibilityBridge::SetRoleFromFlutterUpdate(ui::AXNodeData& node_data,
@@ -603,6 +664,45 @@ AccessibilityBridge::FromFlutterSemanticsNode(
   return result;
 }
 
+bool AccessibilityBridge::IsSameBounds(const SemanticsNode& a,
+                                       const SemanticsNode& b) {
+  return a.rect.left == b.rect.left && a.rect.top == b.rect.top &&
+         a.rect.right == b.rect.right && a.rect.bottom == b.rect.bottom &&
+         a.transform.scaleX == b.transform.scaleX &&
+         a.transform.skewX == b.transform.skewX &&
+         a.transform.transX == b.transform.transX &&
+         a.transform.skewY == b.transform.skewY &&
+         a.transform.scaleY == b.transform.scaleY &&
+         a.transform.transY == b.transform.transY &&
+         a.transform.pers0 == b.transform.pers0 &&
+         a.transform.pers1 == b.transform.pers1 &&
+         a.transform.pers2 == b.transform.pers2;
+}
+
+bool AccessibilityBridge::IsSameNodeExceptBounds(const SemanticsNode& a,
+                                                 const SemanticsNode& b) {
+  // Unset scroll positions and extents are NaN, which are not equal to
+  // themselves.
+  auto same_double = [](double x, double y) {
+    return x == y || (std::isnan(x) && std::isnan(y));
+  };
+  return a.id == b.id && a.flags == b.flags && a.actions == b.actions &&
+         a.text_selection_base == b.text_selection_base &&
+         a.text_selection_extent == b.text_selection_extent &&
+         a.scroll_child_count == b.scroll_child_count &&
+         a.scroll_index == b.scroll_index &&
+         same_double(a.scroll_position, b.scroll_position) &&
+         same_double(a.scroll_extent_max, b.scroll_extent_max) &&
+         same_double(a.scroll_extent_min, b.scroll_extent_min) &&
+         a.elevation == b.elevation && a.thickness == b.thickness &&
+         a.label == b.label && a.hint == b.hint && a.value == b.value &&
+         a.increased_value == b.increased_value &&
+         a.decreased_value == b.decreased_value && a.tooltip == b.tooltip &&
+         a.text_direction == b.text_direction &&
+         a.children_in_traversal_order == b.children_in_traversal_order &&
+         a.custom_accessibility_actions == b.custom_accessibility_actions;
+}
+
 AccessibilityBridge::SemanticsCustomAction
 AccessibilityBridge::FromFlutterSemanticsCustomAction(
     const FlutterSemanticsCustomAction* flutter_custom_action) {
@@ -620,9 +720,7 @@ AccessibilityBridge::FromFlutterSemanticsCustomAction(
 
 void AccessibilityBridge::SetLastFocusedId(AccessibilityNodeId node_id) {
   if (last_focused_id_ != node_id) {
-    auto last_focused_child =
-        GetFlutterPlatformNodeDelegateFromID(last_focused_id_);
-    if (!last_focused_child.expired()) {
+    if (tree_.GetFromId(last_focused_id_)) {
       DispatchAccessibilityAction(
           last_focused_id_,
           FlutterSemanticsAction::
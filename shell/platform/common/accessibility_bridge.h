@@ -8,6 +8,7 @@
 #include <unordered_map>
 
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 
 #include "flutter/third_party/accessibility/ax/ax_event_generator.h"
@@ -51,6 +52,20 @@ class AccessibilityBridge
   //              this is always 0.
   static constexpr int32_t kRootNodeId = 0;
 
+  //-----------------------------------------------------------------------------
+  /// @brief      Statistics about the last call to CommitUpdates().
+  struct CommitStats {
+    /// The number of semantics nodes in the committed update.
+    size_t node_count = 0;
+    /// The number of accessibility events the update generated.
+    size_t event_count = 0;
+    /// The time it took to apply the update to the accessibility tree,
+    /// excluding the handling of the events.
+    fml::TimeDelta tree_update_duration;
+    /// The total time spent in CommitUpdates().
+    fml::TimeDelta total_duration;
+  };
+
   //------------------------------------------------------------------------------
   /// @brief      Adds a semantics node update to the pending semantics update.
   ///             Calling this method alone will NOT update the semantics tree.
@@ -86,6 +101,10 @@ class AccessibilityBridge
   ///             delegate associated with the id does not exist or has been
   ///             removed from the accessibility tree.
   ///
+  ///             Delegates are created the first time they are requested,
+  ///             rather than for every node in the tree, since assistive
+  ///             technologies usually only query a small part of it.
+  ///
   /// @param[in]  id           The id of the flutter accessibility node you want
   ///                          to retrieve.
   std::weak_ptr<FlutterPlatformNodeDelegate>
@@ -106,6 +125,10 @@ class AccessibilityBridge
   const std::vector<ui::AXEventGenerator::TargetedEvent> GetPendingEvents()
       const;
 
+  //------------------------------------------------------------------------------
+  /// @brief      Gets the statistics of the last call to CommitUpdates().
+  const CommitStats& GetLastCommitStats() const;
+
  protected:
   //---------------------------------------------------------------------------
   /// @brief      Handle accessibility events generated due to accessibility
@@ -132,9 +155,9 @@ class AccessibilityBridge
   ///
   ///             This can be useful for subclasses when updating some
   ///             properties that are used by node delegates, such as views.
-  ///             Each node is recreated using
-  ///             CreateFlutterPlatformNodeDelegate, then initialized using
-  ///             AXNodes from their corresponding old one.
+  ///             The existing delegates are released, and each node gets a
+  ///             new delegate from CreateFlutterPlatformNodeDelegate the next
+  ///             time it is requested.
   void RecreateNodeDelegates();
 
  private:
@@ -173,18 +196,28 @@ class AccessibilityBridge
     std::string hint;
   } SemanticsCustomAction;
 
-  std::unordered_map<AccessibilityNodeId,
-                     std::shared_ptr<FlutterPlatformNodeDelegate>>
+  // The delegates that have been requested so far, which are created lazily
+  // by GetFlutterPlatformNodeDelegateFromID.
+  mutable std::unordered_map<AccessibilityNodeId,
+                             std::shared_ptr<FlutterPlatformNodeDelegate>>
       id_wrapper_map_;
   ui::AXTree tree_;
   ui::AXEventGenerator event_generator_;
   std::unordered_map<int32_t, SemanticsNode> pending_semantics_node_updates_;
+  // The last update of each node in the tree, used to apply only what
+  // changed in the following updates.
+  std::unordered_map<int32_t, SemanticsNode> committed_semantics_nodes_;
   std::unordered_map<int32_t, SemanticsCustomAction>
       pending_semantics_custom_action_updates_;
   AccessibilityNodeId last_focused_id_ = ui::AXNode::kInvalidAXID;
+  CommitStats last_commit_stats_;
 
   void InitAXTree(const ui::AXTreeUpdate& initial_state);
 
+  // Creates the delegate for |node| and adds it to |id_wrapper_map_|.
+  std::shared_ptr<FlutterPlatformNodeDelegate> CreatePlatformNodeDelegate(
+      ui::AXNode* node);
+
   // Create an update that removes any nodes that will be reparented by
   // pending_semantics_updates_. Returns std::nullopt if none are reparented.
   std::optional<ui::AXTreeUpdate> CreateRemoveReparentedNodesUpdate();
@@ -193,6 +226,12 @@ class AccessibilityBridge
                       std::vector<SemanticsNode>& result);
   void ConvertFlutterUpdate(const SemanticsNode& node,
                             ui::AXTreeUpdate& tree_update);
+  // Applies |node| on top of the node that was last committed with the same
+  // id, converting only the parts of the node that changed.
+  void ConvertIncrementalFlutterUpdate(const SemanticsNode& node,
+                                       ui::AXTreeUpdate& tree_update);
+  void SetBoundsFromFlutterUpdate(ui::AXNodeData& node_data,
+                                  const SemanticsNode& node);
   void SetRoleFromFlutterUpdate(ui::AXNodeData& node_data,
                                 const SemanticsNode& node);
   void SetStateFromFlutterUpdate(ui::AXNodeData& node_data,
@@ -216,6 +255,10 @@ class AccessibilityBridge
   void SetTreeData(const SemanticsNode& node, ui::AXTreeUpdate& tree_update);
   SemanticsNode FromFlutterSemanticsNode(
       const FlutterSemanticsNode* flutter_node);
+  static bool IsSameBounds(const SemanticsNode& a, const SemanticsNode& b);
+  // Whether the nodes are the same, ignoring their rect and transform.
+  static bool IsSameNodeExceptBounds(const SemanticsNode& a,
+                                     const SemanticsNode& b);
   SemanticsCustomAction FromFlutterSemanticsCustomAction(
       const FlutterSemanticsCustomAction* flutter_custom_action);
 
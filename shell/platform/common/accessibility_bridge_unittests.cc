@@ -483,5 +483,93 @@ TEST(AccessibilityBridgeTest, CanReparentNodeWithChild) {
               Contains(ui::AXEventGenerator::Event::ROLE_CHANGED).Times(1));
 }
 
+TEST(AccessibilityBridgeTest, UnchangedNodesFireNoEvents) {
+  std::shared_ptr<TestAccessibilityBridge> bridge =
+      std::make_shared<TestAccessibilityBridge>();
+
+  std::vector<int32_t> children{1};
+  FlutterSemanticsNode root = CreateSemanticsNode(0, "root", &children);
+  FlutterSemanticsNode child1 = CreateSemanticsNode(1, "child 1");
+  bridge->AddFlutterSemanticsNodeUpdate(&root);
+  bridge->AddFlutterSemanticsNodeUpdate(&child1);
+  bridge->CommitUpdates();
+  bridge->accessibility_events.clear();
+
+  bridge->AddFlutterSemanticsNodeUpdate(&root);
+  bridge->AddFlutterSemanticsNodeUpdate(&child1);
+  bridge->CommitUpdates();
+
+  EXPECT_TRUE(bridge->accessibility_events.empty());
+  auto child1_node = bridge->GetFlutterPlatformNodeDelegateFromID(1).lock();
+  EXPECT_EQ(child1_node->GetName(), "child 1");
+}
+
+TEST(AccessibilityBridgeTest, CanUpdateTheBoundsOfUnchangedNodes) {
+  std::shared_ptr<TestAccessibilityBridge> bridge =
+      std::make_shared<TestAccessibilityBridge>();
+
+  std::vector<int32_t> children{1};
+  FlutterSemanticsNode root = CreateSemanticsNode(0, "root", &children);
+  FlutterSemanticsNode child1 = CreateSemanticsNode(1, "child 1");
+  child1.rect = {0, 0, 100, 50};
+  bridge->AddFlutterSemanticsNodeUpdate(&root);
+  bridge->AddFlutterSemanticsNodeUpdate(&child1);
+  bridge->CommitUpdates();
+
+  child1.rect = {0, 20, 100, 70};
+  bridge->AddFlutterSemanticsNodeUpdate(&child1);
+  bridge->CommitUpdates();
+
+  auto child1_node = bridge->GetFlutterPlatformNodeDelegateFromID(1).lock();
+  const ui::AXNodeData& data = child1_node->GetData();
+  EXPECT_EQ(data.relative_bounds.bounds, gfx::RectF(0, 20, 100, 50));
+  EXPECT_EQ(child1_node->GetName(), "child 1");
+}
+
+TEST(AccessibilityBridgeTest, CreatesNodeDelegatesOnlyWhenRequested) {
+  std::shared_ptr<TestAccessibilityBridge> bridge =
+      std::make_shared<TestAccessibilityBridge>();
+
+  std::vector<int32_t> children{1, 2};
+  FlutterSemanticsNode root = CreateSemanticsNode(0, "root", &children);
+  FlutterSemanticsNode child1 = CreateSemanticsNode(1, "child 1");
+  FlutterSemanticsNode child2 = CreateSemanticsNode(2, "child 2");
+  bridge->AddFlutterSemanticsNodeUpdate(&root);
+  bridge->AddFlutterSemanticsNodeUpdate(&child1);
+  bridge->AddFlutterSemanticsNodeUpdate(&child2);
+  bridge->CommitUpdates();
+  EXPECT_EQ(bridge->created_delegate_count, 0u);
+
+  auto child2_node = bridge->GetFlutterPlatformNodeDelegateFromID(2).lock();
+  ASSERT_TRUE(child2_node);
+  EXPECT_EQ(child2_node->GetName(), "child 2");
+  EXPECT_EQ(bridge->created_delegate_count, 1u);
+
+  // Requesting the same node again reuses its delegate.
+  EXPECT_EQ(bridge->GetFlutterPlatformNodeDelegateFromID(2).lock(),
+            child2_node);
+  EXPECT_EQ(bridge->created_delegate_count, 1u);
+
+  EXPECT_TRUE(bridge->GetFlutterPlatformNodeDelegateFromID(3).expired());
+  EXPECT_EQ(bridge->created_delegate_count, 1u);
+}
+
+TEST(AccessibilityBridgeTest, RecordsCommitStats) {
+  std::shared_ptr<TestAccessibilityBridge> bridge =
+      std::make_shared<TestAccessibilityBridge>();
+
+  std::vector<int32_t> children{1};
+  FlutterSemanticsNode root = CreateSemanticsNode(0, "root", &children);
+  FlutterSemanticsNode child1 = CreateSemanticsNode(1, "child 1");
+  bridge->AddFlutterSemanticsNodeUpdate(&root);
+  bridge->AddFlutterSemanticsNodeUpdate(&child1);
+  bridge->CommitUpdates();
+
+  const auto& stats = bridge->GetLastCommitStats();
+  EXPECT_EQ(stats.node_count, 2u);
+  EXPECT_EQ(stats.event_count, bridge->accessibility_events.size());
+  EXPECT_GE(stats.total_duration, stats.tree_update_duration);
+}
+
 }  // namespace testing
 }  // namespace flutter
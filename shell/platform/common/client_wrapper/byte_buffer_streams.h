@@ -44,6 +44,17 @@ class ByteBufferStreamReader : public ByteStreamReader {
     location_ += length;
   }
 
+  // |ByteStreamReader|
+  const uint8_t* ReadBytesInPlace(size_t length) override {
+    if (location_ + length > size_) {
+      std::cerr << "Invalid read in StandardCodecByteStreamReader" << std::endl;
+      return nullptr;
+    }
+    const uint8_t* bytes = &bytes_[location_];
+    location_ += length;
+    return bytes;
+  }
+
   // |ByteStreamReader|
   void ReadAlignment(uint8_t alignment) override {
     uint8_t mod = location_ % alignment;
@@ -86,9 +97,7 @@ class ByteBufferStreamWriter : public ByteStreamWriter {
   void WriteAlignment(uint8_t alignment) {
     uint8_t mod = bytes_->size() % alignment;
     if (mod) {
-      for (int i = 0; i < alignment - mod; ++i) {
-        WriteByte(0);
-      }
+      bytes_->resize(bytes_->size() + alignment - mod, 0);
     }
   }
 
@@ -26,6 +26,14 @@ class ByteStreamReader {
   // the start of the stream, unless it is already aligned.
   virtual void ReadAlignment(uint8_t alignment) = 0;
 
+  // Advances past the next |length| bytes of the stream and returns a pointer
+  // to them in the underlying buffer, without copying them.
+  //
+  // Returns nullptr without advancing if the stream is not backed by a
+  // contiguous buffer, or if fewer than |length| bytes remain. The returned
+  // pointer is only valid for as long as the underlying buffer is.
+  virtual const uint8_t* ReadBytesInPlace(size_t length) { return nullptr; }
+
   // Reads and returns the next 32-bit integer from the stream.
   int32_t ReadInt32() {
     int32_t value = 0;
@@ -5,11 +5,41 @@
 #ifndef FLUTTER_SHELL_PLATFORM_COMMON_CLIENT_WRAPPER_INCLUDE_FLUTTER_STANDARD_CODEC_SERIALIZER_H_
 #define FLUTTER_SHELL_PLATFORM_COMMON_CLIENT_WRAPPER_INCLUDE_FLUTTER_STANDARD_CODEC_SERIALIZER_H_
 
+#include <cstddef>
+#include <vector>
+
 #include "byte_streams.h"
 #include "encodable_value.h"
 
 namespace flutter {
 
+// A non-owning view of a typed list in an encoded message.
+//
+// TypedDataViewCodecSerializer decodes typed lists to CustomEncodableValues
+// holding a TypedDataView of the list's element type (uint8_t, int32_t,
+// int64_t, float, or double) instead of copying them into a std::vector.
+template <typename T>
+class TypedDataView {
+ public:
+  TypedDataView(const T* data, size_t size) : data_(data), size_(size) {}
+
+  const T* data() const { return data_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  const T* begin() const { return data_; }
+  const T* end() const { return data_ + size_; }
+
+  const T& operator[](size_t index) const { return data_[index]; }
+
+  // Returns a copy of the viewed elements that outlives the message.
+  std::vector<T> ToVector() const { return std::vector<T>(begin(), end()); }
+
+ private:
+  const T* data_;
+  size_t size_;
+};
+
 // Encapsulates the logic for encoding/decoding EncodableValues to/from the
 // standard codec binary representation.
 //
@@ -57,6 +87,14 @@ class StandardCodecSerializer {
   // Writes the variable-length size encoding to |stream|.
   void WriteSize(size_t size, ByteStreamWriter* stream) const;
 
+  // Writes the |count| elements of |data| to |stream| as a fixed-type list,
+  // not including the type discrimination byte. |T| must correspond to one
+  // of the supported list value types of EncodableValue.
+  template <typename T>
+  void WriteTypedData(const T* data,
+                      size_t count,
+                      ByteStreamWriter* stream) const;
+
  private:
   // Reads a fixed-type list whose values are of type T from the current
   // position in |stream|, and returns it as the corresponding EncodableValue.
@@ -68,7 +106,51 @@ class StandardCodecSerializer {
   // Writes |vector| to |stream| as a fixed-type list. |T| must correspond to
   // one of the supported list value types of EncodableValue.
   template <typename T>
-  void WriteVector(const std::vector<T> vector, ByteStreamWriter* stream) const;
+  void WriteVector(const std::vector<T>& vector,
+                   ByteStreamWriter* stream) const;
+};
+
+// A serializer that decodes typed lists as TypedDataViews into the message
+// being decoded, rather than copying them.
+//
+// This avoids a copy of large byte buffers and numeric arrays, but the views
+// reference the message buffer, so they are only valid for the duration of
+// the message or method call handler that receives them. Handlers that need
+// the data later must copy it with TypedDataView::ToVector.
+//
+// Lists whose elements are not suitably aligned in memory are copied as by
+// StandardCodecSerializer. TypedDataViews can also be encoded, as the
+// corresponding typed list.
+class TypedDataViewCodecSerializer : public StandardCodecSerializer {
+ public:
+  virtual ~TypedDataViewCodecSerializer();
+
+  // Returns the shared serializer instance.
+  static const TypedDataViewCodecSerializer& GetInstance();
+
+  // |StandardCodecSerializer|
+  void WriteValue(const EncodableValue& value,
+                  ByteStreamWriter* stream) const override;
+
+ protected:
+  TypedDataViewCodecSerializer();
+
+  // |StandardCodecSerializer|
+  EncodableValue ReadValueOfType(uint8_t type,
+                                 ByteStreamReader* stream) const override;
+
+ private:
+  // Reads a fixed-type list whose values are of type T from the current
+  // position in |stream|, and returns a view of it if possible.
+  template <typename T>
+  EncodableValue ReadVectorView(ByteStreamReader* stream) const;
+
+  // Writes |value| to |stream| with the type discrimination byte |type| if it
+  // holds a TypedDataView<T>. Returns false if it holds anything else.
+  template <typename T>
+  bool WriteVectorView(const CustomEncodableValue& value,
+                       uint8_t type,
+                       ByteStreamWriter* stream) const;
 };
 
 }  // namespace flutter
@@ -8,6 +8,7 @@
 // that any client that needs one of these files needs all three.
 
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 #include <iostream>
 #include <map>
@@ -188,7 +189,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
       std::string string_value;
       string_value.resize(size);
       stream->ReadBytes(reinterpret_cast<uint8_t*>(&string_value[0]), size);
-      return EncodableValue(string_value);
+      return EncodableValue(std::move(string_value));
     }
     case EncodedType::kUInt8List:
       return ReadVector<uint8_t>(stream);
@@ -205,7 +206,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
       for (size_t i = 0; i < length; ++i) {
         list_value.push_back(ReadValue(stream));
       }
-      return EncodableValue(list_value);
+      return EncodableValue(std::move(list_value));
     }
     case EncodedType::kMap: {
       size_t length = ReadSize(stream);
@@ -215,7 +216,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
         EncodableValue value = ReadValue(stream);
         map_value.emplace(std::move(key), std::move(value));
       }
-      return EncodableValue(map_value);
+      return EncodableValue(std::move(map_value));
     }
     case EncodedType::kFloat32List: {
       return ReadVector<float>(stream);
@@ -268,13 +269,19 @@ EncodableValue StandardCodecSerializer::ReadVector(
   }
   stream->ReadBytes(reinterpret_cast<uint8_t*>(vector.data()),
                     count * type_size);
-  return EncodableValue(vector);
+  return EncodableValue(std::move(vector));
 }
 
 template <typename T>
-void StandardCodecSerializer::WriteVector(const std::vector<T> vector,
+void StandardCodecSerializer::WriteVector(const std::vector<T>& vector,
                                           ByteStreamWriter* stream) const {
-  size_t count = vector.size();
+  WriteTypedData(vector.data(), vector.size(), stream);
+}
+
+template <typename T>
+void StandardCodecSerializer::WriteTypedData(const T* data,
+                                             size_t count,
+                                             ByteStreamWriter* stream) const {
   WriteSize(count, stream);
   if (count == 0) {
     return;
@@ -283,10 +290,106 @@ void StandardCodecSerializer::WriteVector(const std::vector<T> vector,
   if (type_size > 1) {
     stream->WriteAlignment(type_size);
   }
-  stream->WriteBytes(reinterpret_cast<const uint8_t*>(vector.data()),
+  stream->WriteBytes(reinterpret_cast<const uint8_t*>(data),
                      count * type_size);
 }
 
+TypedDataViewCodecSerializer::TypedDataViewCodecSerializer() = default;
+
+TypedDataViewCodecSerializer::~TypedDataViewCodecSerializer() = default;
+
+const TypedDataViewCodecSerializer&
+TypedDataViewCodecSerializer::GetInstance() {
+  static TypedDataViewCodecSerializer sInstance;
+  return sInstance;
+}
+
+void TypedDataViewCodecSerializer::WriteValue(const EncodableValue& value,
+                                              ByteStreamWriter* stream) const {
+  if (const auto* custom_value = std::get_if<CustomEncodableValue>(&value)) {
+    if (WriteVectorView<uint8_t>(
+            *custom_value, static_cast<uint8_t>(EncodedType::kUInt8List),
+            stream) ||
+        WriteVectorView<int32_t>(
+            *custom_value, static_cast<uint8_t>(EncodedType::kInt32List),
+            stream) ||
+        WriteVectorView<int64_t>(
+            *custom_value, static_cast<uint8_t>(EncodedType::kInt64List),
+            stream) ||
+        WriteVectorView<float>(*custom_value,
+                               static_cast<uint8_t>(EncodedType::kFloat32List),
+                               stream) ||
+        WriteVectorView<double>(
+            *custom_value, static_cast<uint8_t>(EncodedType::kFloat64List),
+            stream)) {
+      return;
+    }
+  }
+  StandardCodecSerializer::WriteValue(value, stream);
+}
+
+EncodableValue TypedDataViewCodecSerializer::ReadValueOfType(
+    uint8_t type,
+    ByteStreamReader* stream) const {
+  switch (static_cast<EncodedType>(type)) {
+    case EncodedType::kUInt8List:
+      return ReadVectorView<uint8_t>(stream);
+    case EncodedType::kInt32List:
+      return ReadVectorView<int32_t>(stream);
+    case EncodedType::kInt64List:
+      return ReadVectorView<int64_t>(stream);
+    case EncodedType::kFloat64List:
+      return ReadVectorView<double>(stream);
+    case EncodedType::kFloat32List:
+      return ReadVectorView<float>(stream);
+    default:
+      return StandardCodecSerializer::ReadValueOfType(type, stream);
+  }
+}
+
+template <typename T>
+EncodableValue TypedDataViewCodecSerializer::ReadVectorView(
+    ByteStreamReader* stream) const {
+  size_t count = ReadSize(stream);
+  uint8_t type_size = static_cast<uint8_t>(sizeof(T));
+  if (type_size > 1) {
+    stream->ReadAlignment(type_size);
+  }
+  size_t length = count * type_size;
+  const uint8_t* bytes = stream->ReadBytesInPlace(length);
+  std::vector<T> vector;
+  if (!bytes) {
+    // The stream has no buffer to reference.
+    vector.resize(count);
+    stream->ReadBytes(reinterpret_cast<uint8_t*>(vector.data()), length);
+    return EncodableValue(std::move(vector));
+  }
+  // The codec aligns lists relative to the start of the message, which is not
+  // necessarily aligned in memory.
+  if (reinterpret_cast<uintptr_t>(bytes) % alignof(T) != 0) {
+    vector.resize(count);
+    std::memcpy(vector.data(), bytes, length);
+    return EncodableValue(std::move(vector));
+  }
+  return CustomEncodableValue(
+      TypedDataView<T>(reinterpret_cast<const T*>(bytes), count));
+}
+
+template <typename T>
+bool TypedDataViewCodecSerializer::WriteVectorView(
+    const CustomEncodableValue& value,
+    uint8_t type,
+    ByteStreamWriter* stream) const {
+  const auto* view =
+      std::any_cast<TypedDataView<T>>(&static_cast<const std::any&>(value));
+  if (!view) {
+    return false;
+  }
+  stream->WriteByte(type);
+  WriteTypedData(view->data(), view->size(), stream);
+  return true;
+}
+
 // ===== standard_message_codec.h =====
 
 // static
@@ -259,4 +259,46 @@ TEST(StandardMessageCodec, CanEncodeAndDecodeVariableLengthCustomType) {
                     some_data_comparator);
 }
 
+TEST(StandardMessageCodec, TypedDataViewSerializerDecodesListsWithoutCopying) {
+  const StandardMessageCodec& codec =
+      StandardMessageCodec::GetInstance(
+          &TypedDataViewCodecSerializer::GetInstance());
+  // The buffer is 8-byte aligned, so every list in it is aligned in memory.
+  std::vector<uint8_t> bytes = {0x0c, 0x02, 0x08, 0x04, 0xba, 0x5e, 0xba,
+                                0x11, 0x09, 0x02, 0x00, 0x00, 0x78, 0x56,
+                                0x34, 0x12, 0xff, 0xff, 0xff, 0xff};
+  auto decoded = codec.DecodeMessage(bytes);
+  const auto& list = std::get<EncodableList>(*decoded);
+  ASSERT_EQ(list.size(), 2u);
+
+  const auto& byte_view = std::any_cast<TypedDataView<uint8_t>>(
+      std::get<CustomEncodableValue>(list[0]));
+  EXPECT_EQ(byte_view.data(), bytes.data() + 4);
+  EXPECT_EQ(byte_view.ToVector(),
+            (std::vector<uint8_t>{0xba, 0x5e, 0xba, 0x11}));
+
+  const auto& int_view = std::any_cast<TypedDataView<int32_t>>(
+      std::get<CustomEncodableValue>(list[1]));
+  EXPECT_EQ(reinterpret_cast<const uint8_t*>(int_view.data()),
+            bytes.data() + 12);
+  EXPECT_EQ(int_view.ToVector(), (std::vector<int32_t>{0x12345678, -1}));
+
+  // Views encode as the lists they reference.
+  auto encoded = codec.EncodeMessage(*decoded);
+  ASSERT_TRUE(encoded);
+  EXPECT_EQ(*encoded, bytes);
+}
+
+TEST(StandardMessageCodec, TypedDataViewSerializerCopiesUnalignedLists) {
+  const StandardMessageCodec& codec =
+      StandardMessageCodec::GetInstance(
+          &TypedDataViewCodecSerializer::GetInstance());
+  std::vector<uint8_t> bytes = {0x00, 0x0b, 0x01, 0x00, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                0x00, 0x00, 0x40, 0x8f, 0x40};
+  // Decodes from an odd address, so the doubles are misaligned in memory.
+  auto decoded = codec.DecodeMessage(bytes.data() + 1, bytes.size() - 1);
+  EXPECT_EQ(*decoded, EncodableValue(std::vector<double>{1000.0}));
+}
+
 }  // namespace flutter
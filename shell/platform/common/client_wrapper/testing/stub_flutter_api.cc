@@ -95,6 +95,19 @@ void FlutterDesktopMessengerSetCallback(FlutterDesktopMessengerRef messenger,
   }
 }
 
+void FlutterDesktopMessengerSetCallbackOnTaskQueue(
+    FlutterDesktopMessengerRef messenger,
+    const char* channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data,
+    FlutterDesktopMessengerTaskQueue task_queue,
+    void* task_queue_user_data) {
+  if (s_stub_implementation) {
+    s_stub_implementation->MessengerSetCallbackOnTaskQueue(
+        channel, callback, user_data, task_queue, task_queue_user_data);
+  }
+}
+
 FlutterDesktopMessengerRef FlutterDesktopMessengerAddRef(
     FlutterDesktopMessengerRef messenger) {
   assert(false);  // not implemented
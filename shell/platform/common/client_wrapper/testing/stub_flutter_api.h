@@ -65,6 +65,14 @@ class StubFlutterApi {
                                     FlutterDesktopMessageCallback callback,
                                     void* user_data) {}
 
+  // Called for FlutterDesktopMessengerSetCallbackOnTaskQueue.
+  virtual void MessengerSetCallbackOnTaskQueue(
+      const char* channel,
+      FlutterDesktopMessageCallback callback,
+      void* user_data,
+      FlutterDesktopMessengerTaskQueue task_queue,
+      void* task_queue_user_data) {}
+
   // Called for FlutterDesktopTextureRegistrarRegisterExternalTexture.
   virtual int64_t TextureRegistrarRegisterExternalTexture(
       const FlutterDesktopTextureInfo* info) {
@@ -4,13 +4,100 @@
 
 #include "flutter/shell/platform/common/incoming_message_dispatcher.h"
 
+#include <deque>
+#include <mutex>
+#include <vector>
+
 namespace flutter {
 
+struct IncomingMessageDispatcher::QueuedChannel {
+  // A copy of a message, which outlives the engine's message buffer.
+  struct Message {
+    std::string channel;
+    std::vector<uint8_t> data;
+    const FlutterDesktopMessageResponseHandle* response_handle = nullptr;
+  };
+
+  FlutterDesktopMessengerRef messenger;
+  FlutterDesktopMessageCallback callback;
+  void* user_data;
+  FlutterDesktopMessengerTaskQueue task_queue;
+  void* task_queue_user_data;
+
+  // Held while |callback| runs, so that removing the channel can wait for
+  // the current call to return.
+  std::mutex callback_mutex;
+
+  // Guards the state below.
+  std::mutex mutex;
+  std::deque<Message> messages;
+  // Whether a task for this channel is posted or running.
+  bool task_posted = false;
+  // Whether the channel has been removed from the dispatcher.
+  bool removed = false;
+
+  // Posts a task that delivers the next message.
+  void PostTask(std::shared_ptr<QueuedChannel> channel) {
+    task_queue(&RunTask, new std::shared_ptr<QueuedChannel>(std::move(channel)),
+               task_queue_user_data);
+  }
+
+  // Delivers the next message of the channel in |task_data|, and posts a task
+  // for the message after it, if any.
+  static void RunTask(void* task_data) {
+    std::shared_ptr<QueuedChannel> channel =
+        std::move(*static_cast<std::shared_ptr<QueuedChannel>*>(task_data));
+    delete static_cast<std::shared_ptr<QueuedChannel>*>(task_data);
+
+    {
+      std::scoped_lock callback_lock(channel->callback_mutex);
+      Message message;
+      {
+        std::scoped_lock lock(channel->mutex);
+        if (channel->removed || channel->messages.empty()) {
+          channel->task_posted = false;
+          return;
+        }
+        message = std::move(channel->messages.front());
+        channel->messages.pop_front();
+      }
+      FlutterDesktopMessage desktop_message = {};
+      desktop_message.struct_size = sizeof(FlutterDesktopMessage);
+      desktop_message.channel = message.channel.c_str();
+      desktop_message.message = message.data.data();
+      desktop_message.message_size = message.data.size();
+      desktop_message.response_handle = message.response_handle;
+      channel->callback(channel->messenger, &desktop_message,
+                        channel->user_data);
+    }
+
+    {
+      std::scoped_lock lock(channel->mutex);
+      if (channel->removed || channel->messages.empty()) {
+        channel->task_posted = false;
+        return;
+      }
+    }
+    channel->PostTask(channel);
+  }
+};
+
 IncomingMessageDispatcher::IncomingMessageDispatcher(
     FlutterDesktopMessengerRef messenger)
     : messenger_(messenger) {}
 
-IncomingMessageDispatcher::~IncomingMessageDispatcher() = default;
+IncomingMessageDispatcher::~IncomingMessageDispatcher() {
+  // The engine is going away, so messages that are still queued are dropped
+  // rather than answered.
+  for (auto& [channel_name, channel] : queued_channels_) {
+    {
+      std::scoped_lock lock(channel->mutex);
+      channel->removed = true;
+      channel->messages.clear();
+    }
+    std::scoped_lock callback_lock(channel->callback_mutex);
+  }
+}
 
 /// @note Procedure doesn't copy all closures.
 void IncomingMessageDispatcher::HandleMessage(
@@ -19,6 +106,27 @@ void IncomingMessageDispatcher::HandleMessage(
     const std::function<void(void)>& input_unblock_cb) {
   std::string channel(message.channel);
 
+  auto queued_iterator = queued_channels_.find(channel);
+  if (queued_iterator != queued_channels_.end()) {
+    const std::shared_ptr<QueuedChannel>& queued_channel =
+        queued_iterator->second;
+    QueuedChannel::Message queued_message;
+    queued_message.channel = std::move(channel);
+    queued_message.data.assign(message.message,
+                               message.message + message.message_size);
+    queued_message.response_handle = message.response_handle;
+    {
+      std::scoped_lock lock(queued_channel->mutex);
+      queued_channel->messages.push_back(std::move(queued_message));
+      if (queued_channel->task_posted) {
+        return;
+      }
+      queued_channel->task_posted = true;
+    }
+    queued_channel->PostTask(queued_channel);
+    return;
+  }
+
   auto callback_iterator = callbacks_.find(channel);
   // Find the handler for the channel; if there isn't one, report the failure.
   if (callback_iterator == callbacks_.end()) {
@@ -44,6 +152,7 @@ void IncomingMessageDispatcher::SetMessageCallback(
     const std::string& channel,
     FlutterDesktopMessageCallback callback,
     void* user_data) {
+  RemoveQueuedChannel(channel);
   if (!callback) {
     callbacks_.erase(channel);
     return;
@@ -51,9 +160,55 @@ void IncomingMessageDispatcher::SetMessageCallback(
   callbacks_[channel] = std::make_pair(callback, user_data);
 }
 
+void IncomingMessageDispatcher::SetMessageCallback(
+    const std::string& channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data,
+    FlutterDesktopMessengerTaskQueue task_queue,
+    void* task_queue_user_data) {
+  if (!callback || !task_queue) {
+    SetMessageCallback(channel, callback, user_data);
+    return;
+  }
+  RemoveQueuedChannel(channel);
+  callbacks_.erase(channel);
+  auto queued_channel = std::make_shared<QueuedChannel>();
+  queued_channel->messenger = messenger_;
+  queued_channel->callback = callback;
+  queued_channel->user_data = user_data;
+  queued_channel->task_queue = task_queue;
+  queued_channel->task_queue_user_data = task_queue_user_data;
+  queued_channels_[channel] = std::move(queued_channel);
+}
+
 void IncomingMessageDispatcher::EnableInputBlockingForChannel(
     const std::string& channel) {
   input_blocking_channels_.insert(channel);
 }
 
+void IncomingMessageDispatcher::RemoveQueuedChannel(
+    const std::string& channel) {
+  auto queued_iterator = queued_channels_.find(channel);
+  if (queued_iterator == queued_channels_.end()) {
+    return;
+  }
+  std::shared_ptr<QueuedChannel> queued_channel =
+      std::move(queued_iterator->second);
+  queued_channels_.erase(queued_iterator);
+
+  std::deque<QueuedChannel::Message> pending_messages;
+  {
+    std::scoped_lock lock(queued_channel->mutex);
+    queued_channel->removed = true;
+    pending_messages.swap(queued_channel->messages);
+  }
+  for (const auto& message : pending_messages) {
+    FlutterDesktopMessengerSendResponse(messenger_, message.response_handle,
+                                        nullptr, 0);
+  }
+  // Waits for a call that is in progress, so that the caller can release the
+  // callback's user data once this returns.
+  std::scoped_lock callback_lock(queued_channel->callback_mutex);
+}
+
 }  // namespace flutter
@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -35,6 +36,9 @@ class IncomingMessageDispatcher {
   // If input blocking has been enabled on that channel, wraps the call to the
   // handler with calls to the given callbacks to block and then unblock input.
   //
+  // If the handler for the channel runs on a task queue, copies |message| and
+  // queues it for the handler instead, without blocking input.
+  //
   // If no handler is registered for the message's channel, sends a
   // NotImplemented response to the engine.
   void HandleMessage(
@@ -52,6 +56,19 @@ class IncomingMessageDispatcher {
                           FlutterDesktopMessageCallback callback,
                           void* user_data);
 
+  // Registers a message callback for incoming messages from the Flutter side
+  // on the specified channel, which runs on tasks posted to |task_queue|.
+  //
+  // Messages on the channel are passed to |callback| one at a time, in the
+  // order they arrived. Replaces any existing callback, and waits for the
+  // existing callback to return if it is running. Pass a null callback to
+  // unregister the existing callback.
+  void SetMessageCallback(const std::string& channel,
+                          FlutterDesktopMessageCallback callback,
+                          void* user_data,
+                          FlutterDesktopMessengerTaskQueue task_queue,
+                          void* task_queue_user_data);
+
   // Enables input blocking on the given channel name.
   //
   // If set, then the parent window should disable input callbacks
@@ -59,6 +76,13 @@ class IncomingMessageDispatcher {
   void EnableInputBlockingForChannel(const std::string& channel);
 
  private:
+  // The messages for a channel whose handler runs on a task queue.
+  struct QueuedChannel;
+
+  // Stops delivering messages to the task queue handler of |channel|, if it
+  // has one, and sends empty responses to the messages that are still queued.
+  void RemoveQueuedChannel(const std::string& channel);
+
   // Handle for interacting with the C messaging API.
   FlutterDesktopMessengerRef messenger_;
 
@@ -68,6 +92,10 @@ class IncomingMessageDispatcher {
   std::map<std::string, std::pair<FlutterDesktopMessageCallback, void*>>
       callbacks_;
 
+  // A map from channel names to the state of the handlers that run on a task
+  // queue. A channel has an entry here or in |callbacks_|, but not both.
+  std::map<std::string, std::shared_ptr<QueuedChannel>> queued_channels_;
+
   // Channel names for which input blocking should be enabled during the call to
   // that channel's handler.
   std::set<std::string> input_blocking_channels_;
@@ -4,9 +4,54 @@
 
 #include "flutter/shell/platform/common/incoming_message_dispatcher.h"
 
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace flutter {
+
+namespace {
+
+// A task queue that holds posted tasks until they are run by the test.
+class TestTaskQueue {
+ public:
+  static void Post(FlutterDesktopMessengerTask task,
+                   void* task_data,
+                   void* queue_user_data) {
+    static_cast<TestTaskQueue*>(queue_user_data)
+        ->tasks_.push_back(std::make_pair(task, task_data));
+  }
+
+  size_t size() const { return tasks_.size(); }
+
+  // Runs the oldest posted task.
+  void RunNext() {
+    auto task = tasks_.front();
+    tasks_.erase(tasks_.begin());
+    task.first(task.second);
+  }
+
+ private:
+  std::vector<std::pair<FlutterDesktopMessengerTask, void*>> tasks_;
+};
+
+FlutterDesktopMessage MakeMessage(const char* channel,
+                                  const std::string& data) {
+  FlutterDesktopMessage message = {
+      .struct_size = sizeof(FlutterDesktopMessage),
+      .channel = channel,
+      .message = reinterpret_cast<const uint8_t*>(data.data()),
+      .message_size = data.size(),
+      .response_handle = nullptr,
+  };
+  return message;
+}
+
+}  // namespace
+
 TEST(IncomingMessageDispatcher, SetHandle) {
   FlutterDesktopMessengerRef messenger =
       reinterpret_cast<FlutterDesktopMessengerRef>(0xfeedface);
@@ -88,4 +133,69 @@ TEST(IncomingMessageDispatcher, BlockInputTrue) {
   EXPECT_EQ(did_call[2], 2);
 }
 
+TEST(IncomingMessageDispatcher, TaskQueueCallbacksRunInOrderOnTheQueue) {
+  auto dispatcher = std::make_unique<IncomingMessageDispatcher>(nullptr);
+  TestTaskQueue queue;
+  std::vector<std::string> received;
+  dispatcher->SetMessageCallback(
+      "hello",
+      [](FlutterDesktopMessengerRef messenger,
+         const FlutterDesktopMessage* message, void* user_data) {
+        static_cast<std::vector<std::string>*>(user_data)->push_back(
+            std::string(reinterpret_cast<const char*>(message->message),
+                        message->message_size));
+      },
+      &received, &TestTaskQueue::Post, &queue);
+
+  {
+    // The dispatcher must copy the messages, since the engine's buffers are
+    // only valid during HandleMessage.
+    std::string first = "first";
+    std::string second = "second";
+    dispatcher->HandleMessage(MakeMessage("hello", first));
+    dispatcher->HandleMessage(MakeMessage("hello", second));
+    first.assign(first.size(), 'x');
+    second.assign(second.size(), 'x');
+  }
+  EXPECT_TRUE(received.empty());
+  // Only one message of a channel is in flight at a time.
+  ASSERT_EQ(queue.size(), 1u);
+
+  queue.RunNext();
+  EXPECT_EQ(received, std::vector<std::string>({"first"}));
+  ASSERT_EQ(queue.size(), 1u);
+  queue.RunNext();
+  EXPECT_EQ(received, std::vector<std::string>({"first", "second"}));
+  EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(IncomingMessageDispatcher, TaskQueueCallbacksStopWhenReplaced) {
+  auto dispatcher = std::make_unique<IncomingMessageDispatcher>(nullptr);
+  TestTaskQueue queue;
+  int queued_calls = 0;
+  bool direct_call = false;
+  dispatcher->SetMessageCallback(
+      "hello",
+      [](FlutterDesktopMessengerRef messenger,
+         const FlutterDesktopMessage* message,
+         void* user_data) { ++*static_cast<int*>(user_data); },
+      &queued_calls, &TestTaskQueue::Post, &queue);
+  dispatcher->HandleMessage(MakeMessage("hello", "message"));
+  ASSERT_EQ(queue.size(), 1u);
+
+  dispatcher->SetMessageCallback(
+      "hello",
+      [](FlutterDesktopMessengerRef messenger,
+         const FlutterDesktopMessage* message,
+         void* user_data) { *static_cast<bool*>(user_data) = true; },
+      &direct_call);
+  // The task posted for the old callback does nothing.
+  queue.RunNext();
+  EXPECT_EQ(queued_calls, 0);
+
+  dispatcher->HandleMessage(MakeMessage("hello", "message"));
+  EXPECT_TRUE(direct_call);
+  EXPECT_EQ(queue.size(), 0u);
+}
+
 }  // namespace flutter
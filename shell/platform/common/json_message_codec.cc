@@ -8,28 +8,46 @@
 #include <string>
 
 #include "rapidjson/error/en.h"
-#include "rapidjson/stringbuffer.h"
-#include "rapidjson/writer.h"
 
 namespace flutter {
 
+namespace {
+
+// The reader used by ReadMessage on the current thread, and whether a read
+// is in progress with it.
+thread_local rapidjson::Reader tls_reader;
+thread_local bool tls_reader_in_use = false;
+
+}  // namespace
+
 // static
 const JsonMessageCodec& JsonMessageCodec::GetInstance() {
   static JsonMessageCodec sInstance;
   return sInstance;
 }
 
+std::unique_ptr<std::vector<uint8_t>> JsonMessageCodec::WriteMessage(
+    const std::function<bool(JsonMessageWriter&)>& write) const {
+  auto encoded = std::make_unique<std::vector<uint8_t>>();
+  JsonByteStream stream(encoded.get());
+  JsonMessageWriter writer(stream);
+  if (!write(writer) || !writer.IsComplete()) {
+    std::cerr << "Unable to write JSON message." << std::endl;
+    return nullptr;
+  }
+  return encoded;
+}
+
 std::unique_ptr<std::vector<uint8_t>> JsonMessageCodec::EncodeMessageInternal(
     const rapidjson::Document& message) const {
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  auto encoded = std::make_unique<std::vector<uint8_t>>();
+  JsonByteStream stream(encoded.get());
+  JsonMessageWriter writer(stream);
   // clang-tidy has trouble reasoning about some of the complicated array and
   // pointer-arithmetic code in rapidjson.
   // NOLINTNEXTLINE(clang-analyzer-core.*)
   message.Accept(writer);
-  const char* buffer_start = buffer.GetString();
-  return std::make_unique<std::vector<uint8_t>>(
-      buffer_start, buffer_start + buffer.GetSize());
+  return encoded;
 }
 
 std::unique_ptr<rapidjson::Document> JsonMessageCodec::DecodeMessageInternal(
@@ -40,11 +58,32 @@ std::unique_ptr<rapidjson::Document> JsonMessageCodec::DecodeMessageInternal(
   rapidjson::ParseResult result =
       json_message->Parse(raw_message, message_size);
   if (result.IsError()) {
-    std::cerr << "Unable to parse JSON message:" << std::endl
-              << rapidjson::GetParseError_En(result.Code()) << std::endl;
+    LogParseError(result);
     return nullptr;
   }
   return json_message;
 }
 
+JsonMessageCodec::ScopedReader::ScopedReader() {
+  if (tls_reader_in_use) {
+    owned_reader_ = std::make_unique<rapidjson::Reader>();
+    reader_ = owned_reader_.get();
+    return;
+  }
+  tls_reader_in_use = true;
+  reader_ = &tls_reader;
+}
+
+JsonMessageCodec::ScopedReader::~ScopedReader() {
+  if (!owned_reader_) {
+    tls_reader_in_use = false;
+  }
+}
+
+// static
+void JsonMessageCodec::LogParseError(const rapidjson::ParseResult& result) {
+  std::cerr << "Unable to parse JSON message:" << std::endl
+            << rapidjson::GetParseError_En(result.Code()) << std::endl;
+}
+
 }  // namespace flutter
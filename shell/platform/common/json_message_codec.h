@@ -6,11 +6,38 @@
 #define FLUTTER_SHELL_PLATFORM_COMMON_JSON_MESSAGE_CODEC_H_
 
 #include <rapidjson/document.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/writer.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
 
 #include "flutter/shell/platform/common/client_wrapper/include/flutter/message_codec.h"
 
 namespace flutter {
 
+// A rapidjson output stream that appends to a byte vector, so that encoded
+// messages don't have to be copied out of an intermediate buffer.
+class JsonByteStream {
+ public:
+  typedef char Ch;
+
+  // Creates a stream that appends to |bytes|, which must outlive it.
+  explicit JsonByteStream(std::vector<uint8_t>* bytes) : bytes_(bytes) {}
+
+  void Put(Ch c) { bytes_->push_back(static_cast<uint8_t>(c)); }
+
+  void Flush() {}
+
+ private:
+  std::vector<uint8_t>* bytes_;
+};
+
+// The SAX writer that JsonMessageCodec::WriteMessage emits messages to.
+using JsonMessageWriter = rapidjson::Writer<JsonByteStream>;
+
 // A message encoding/decoding mechanism for communications to/from the
 // Flutter engine via JSON channels.
 class JsonMessageCodec : public MessageCodec<rapidjson::Document> {
@@ -24,6 +51,36 @@ class JsonMessageCodec : public MessageCodec<rapidjson::Document> {
   JsonMessageCodec(JsonMessageCodec const&) = delete;
   JsonMessageCodec& operator=(JsonMessageCodec const&) = delete;
 
+  // Decodes the JSON message in |binary_message| by reporting its contents
+  // to |handler|, a rapidjson SAX handler, instead of building a document.
+  //
+  // The parse stack is kept between messages on each thread, so reading a
+  // message doesn't allocate unless it is nested more deeply, or has longer
+  // strings, than the previous ones. Returns false if the message isn't
+  // valid JSON or if |handler| stops the read.
+  template <typename Handler>
+  bool ReadMessage(const uint8_t* binary_message,
+                   const size_t message_size,
+                   Handler& handler) const {
+    rapidjson::MemoryStream stream(
+        reinterpret_cast<const char*>(binary_message), message_size);
+    ScopedReader reader;
+    rapidjson::ParseResult result = reader.get().Parse(stream, handler);
+    if (result.IsError()) {
+      LogParseError(result);
+      return false;
+    }
+    return true;
+  }
+
+  // Encodes a message by emitting it to a SAX writer through |write|,
+  // instead of serializing a document.
+  //
+  // Returns nullptr if |write| returns false or does not write exactly one
+  // complete JSON value.
+  std::unique_ptr<std::vector<uint8_t>> WriteMessage(
+      const std::function<bool(JsonMessageWriter&)>& write) const;
+
  protected:
   // Instances should be obtained via GetInstance.
   JsonMessageCodec() = default;
@@ -36,6 +93,27 @@ class JsonMessageCodec : public MessageCodec<rapidjson::Document> {
   // |flutter::MessageCodec|
   std::unique_ptr<std::vector<uint8_t>> EncodeMessageInternal(
       const rapidjson::Document& message) const override;
+
+ private:
+  // Borrows the reader of the calling thread, or provides a new one if that
+  // reader is in use by a read further up the stack.
+  class ScopedReader {
+   public:
+    ScopedReader();
+    ~ScopedReader();
+
+    ScopedReader(ScopedReader const&) = delete;
+    ScopedReader& operator=(ScopedReader const&) = delete;
+
+    rapidjson::Reader& get() { return *reader_; }
+
+   private:
+    std::unique_ptr<rapidjson::Reader> owned_reader_;
+    rapidjson::Reader* reader_;
+  };
+
+  // Logs the error of a failed parse.
+  static void LogParseError(const rapidjson::ParseResult& result);
 };
 
 }  // namespace flutter
@@ -6,6 +6,7 @@
 
 #include <limits>
 #include <map>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -23,6 +24,50 @@ static void CheckEncodeDecode(const rapidjson::Document& value) {
   EXPECT_EQ(value, *decoded);
 }
 
+// A SAX handler that records the events it receives as a string.
+struct RecordingHandler
+    : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>,
+                                          RecordingHandler> {
+  bool Default() {
+    events += "?";
+    return true;
+  }
+  bool Bool(bool value) {
+    events += value ? "true," : "false,";
+    return true;
+  }
+  bool Int(int value) {
+    events += std::to_string(value) + ",";
+    return true;
+  }
+  bool String(const char* value, rapidjson::SizeType length, bool copy) {
+    events += "\"" + std::string(value, length) + "\",";
+    return true;
+  }
+  bool StartObject() {
+    events += "{";
+    return true;
+  }
+  bool Key(const char* value, rapidjson::SizeType length, bool copy) {
+    events += std::string(value, length) + ":";
+    return true;
+  }
+  bool EndObject(rapidjson::SizeType member_count) {
+    events += "}";
+    return true;
+  }
+  bool StartArray() {
+    events += "[";
+    return true;
+  }
+  bool EndArray(rapidjson::SizeType element_count) {
+    events += "]";
+    return true;
+  }
+
+  std::string events;
+};
+
 }  // namespace
 
 // Tests that a JSON document with various data types round-trips correctly.
@@ -44,4 +89,54 @@ TEST(JsonMessageCodec, EncodeDecode) {
   CheckEncodeDecode(array);
 }
 
+TEST(JsonMessageCodec, ReadMessageReportsEventsToHandler) {
+  const JsonMessageCodec& codec = JsonMessageCodec::GetInstance();
+  const std::string message = R"([{"a":-7,"b":true},"text"])";
+  // Reads repeatedly to exercise the reuse of the reader.
+  for (int i = 0; i < 2; i++) {
+    RecordingHandler handler;
+    EXPECT_TRUE(codec.ReadMessage(
+        reinterpret_cast<const uint8_t*>(message.data()), message.size(),
+        handler));
+    EXPECT_EQ(handler.events, R"([{a:-7,b:true,}"text",])");
+  }
+}
+
+TEST(JsonMessageCodec, ReadMessageFailsForInvalidJson) {
+  const JsonMessageCodec& codec = JsonMessageCodec::GetInstance();
+  const std::string message = R"({"a":)";
+  RecordingHandler handler;
+  EXPECT_FALSE(codec.ReadMessage(
+      reinterpret_cast<const uint8_t*>(message.data()), message.size(),
+      handler));
+}
+
+TEST(JsonMessageCodec, WriteMessageMatchesEncodedDocument) {
+  const JsonMessageCodec& codec = JsonMessageCodec::GetInstance();
+  auto written = codec.WriteMessage([](JsonMessageWriter& writer) {
+    writer.StartObject();
+    writer.Key("a");
+    writer.Int(-7);
+    writer.Key("b");
+    writer.String("text");
+    writer.EndObject();
+    return true;
+  });
+  ASSERT_TRUE(written);
+
+  rapidjson::Document document(rapidjson::kObjectType);
+  document.AddMember("a", -7, document.GetAllocator());
+  document.AddMember("b", "text", document.GetAllocator());
+  EXPECT_EQ(*written, *codec.EncodeMessage(document));
+}
+
+TEST(JsonMessageCodec, WriteMessageFailsForIncompleteValues) {
+  const JsonMessageCodec& codec = JsonMessageCodec::GetInstance();
+  auto written = codec.WriteMessage([](JsonMessageWriter& writer) {
+    writer.StartArray();
+    return true;
+  });
+  EXPECT_FALSE(written);
+}
+
 }  // namespace flutter
@@ -51,6 +51,20 @@ typedef void (*FlutterDesktopMessageCallback)(
     const FlutterDesktopMessage* /* message*/,
     void* /* user data */);
 
+// Function pointer type for a task to run on a task queue.
+typedef void (*FlutterDesktopMessengerTask)(void* /* task data */);
+
+// Function pointer type for a queue that runs tasks on a thread other than
+// the platform thread.
+//
+// The queue must eventually call |task| exactly once with |task data|. The
+// queue user data will be whatever was passed to
+// FlutterDesktopMessengerSetCallbackOnTaskQueue.
+typedef void (*FlutterDesktopMessengerTaskQueue)(
+    FlutterDesktopMessengerTask /* task */,
+    void* /* task data */,
+    void* /* queue user data */);
+
 // Sends a binary message to the Flutter side on the specified channel.
 FLUTTER_EXPORT bool FlutterDesktopMessengerSend(
     FlutterDesktopMessengerRef messenger,
@@ -69,6 +83,10 @@ FLUTTER_EXPORT bool FlutterDesktopMessengerSendWithReply(
 // Sends a reply to a FlutterDesktopMessage for the given response handle.
 //
 // Once this has been called, |handle| is invalid and must not be used again.
+//
+// Operation is thread-safe. When called from a thread other than the platform
+// thread, it must be called inside a |FlutterDesktopMessengerLock|, after
+// checking |FlutterDesktopMessengerIsAvailable|.
 FLUTTER_EXPORT void FlutterDesktopMessengerSendResponse(
     FlutterDesktopMessengerRef messenger,
     const FlutterDesktopMessageResponseHandle* handle,
@@ -88,6 +106,31 @@ FLUTTER_EXPORT void FlutterDesktopMessengerSetCallback(
     FlutterDesktopMessageCallback callback,
     void* user_data);
 
+// Registers a callback function for incoming binary messages from the Flutter
+// side on the specified channel, which is called from tasks posted to
+// |task_queue| instead of on the platform thread.
+//
+// Messages on |channel| are delivered in the order they arrive, one at a
+// time: the task for a message is posted once the callback for the previous
+// message has returned. The FlutterDesktopMessage passed to |callback| is
+// only valid for the duration of the call, and any calls |callback| makes to
+// the messenger follow the rules for threads other than the platform thread.
+//
+// Replaces any existing callback. Messages that are still queued when the
+// callback is replaced or unregistered receive an empty response. Once this
+// returns, the previous callback is no longer being called.
+//
+// If |user_data| is provided, it will be passed in |callback| calls. If
+// |task_queue_user_data| is provided, it will be passed in |task_queue|
+// calls.
+FLUTTER_EXPORT void FlutterDesktopMessengerSetCallbackOnTaskQueue(
+    FlutterDesktopMessengerRef messenger,
+    const char* channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data,
+    FlutterDesktopMessengerTaskQueue task_queue,
+    void* task_queue_user_data);
+
 // Increments the reference count for the |messenger|.
 //
 // Operation is thread-safe.
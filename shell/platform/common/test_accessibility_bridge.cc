@@ -8,6 +8,7 @@ namespace flutter {
 
 std::shared_ptr<FlutterPlatformNodeDelegate>
 TestAccessibilityBridge::CreateFlutterPlatformNodeDelegate() {
+  created_delegate_count++;
   return std::make_unique<FlutterPlatformNodeDelegate>();
 };
 
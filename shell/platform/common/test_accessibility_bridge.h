@@ -21,6 +21,7 @@ class TestAccessibilityBridge : public AccessibilityBridge {
 
   std::vector<ui::AXEventGenerator::Event> accessibility_events;
   std::vector<FlutterSemanticsAction> performed_actions;
+  size_t created_delegate_count = 0;
 
  protected:
   void OnAccessibilityEvent(
@@ -0,0 +1,153 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/text_gap_buffer.h"
+
+#include <algorithm>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+namespace {
+
+// The smallest gap that is allocated when the gap has to grow.
+constexpr size_t kMinGapLength = 64;
+
+constexpr char32_t kReplacementCharacter = 0xFFFD;
+
+bool IsLeadingSurrogate(char32_t code_unit) {
+  return (code_unit & 0xFFFFFC00) == 0xD800;
+}
+
+bool IsTrailingSurrogate(char32_t code_unit) {
+  return (code_unit & 0xFFFFFC00) == 0xDC00;
+}
+
+// Calls |visitor| with each code point in the first |end| code units of
+// |text|.
+template <typename Visitor>
+void ForEachCodePoint(const TextGapBuffer& text, size_t end, Visitor visitor) {
+  for (size_t i = 0; i < end; i++) {
+    char32_t code_point = text.at(i);
+    if (IsLeadingSurrogate(code_point) && i + 1 < end &&
+        IsTrailingSurrogate(text.at(i + 1))) {
+      code_point =
+          0x10000 + ((code_point - 0xD800) << 10) + (text.at(i + 1) - 0xDC00);
+      i++;
+    } else if (IsLeadingSurrogate(code_point) ||
+               IsTrailingSurrogate(code_point)) {
+      code_point = kReplacementCharacter;
+    }
+    visitor(code_point);
+  }
+}
+
+size_t GetUtf8CodePointLength(char32_t code_point) {
+  if (code_point < 0x80) {
+    return 1;
+  }
+  if (code_point < 0x800) {
+    return 2;
+  }
+  if (code_point < 0x10000) {
+    return 3;
+  }
+  return 4;
+}
+
+}  // namespace
+
+TextGapBuffer::TextGapBuffer() = default;
+
+TextGapBuffer::TextGapBuffer(const std::u16string& text)
+    : buffer_(text.begin(), text.end()),
+      gap_start_(text.size()),
+      gap_end_(text.size()) {}
+
+TextGapBuffer::~TextGapBuffer() = default;
+
+char16_t TextGapBuffer::at(size_t position) const {
+  FML_DCHECK(position < length());
+  return position < gap_start_ ? buffer_[position]
+                               : buffer_[position + gap_length()];
+}
+
+void TextGapBuffer::Replace(size_t position,
+                            size_t length,
+                            const std::u16string& text) {
+  FML_DCHECK(position + length <= this->length());
+  MoveGap(position, text.size() > length ? text.size() - length : 0);
+  gap_end_ += length;
+  std::copy(text.begin(), text.end(), buffer_.begin() + gap_start_);
+  gap_start_ += text.size();
+}
+
+std::u16string TextGapBuffer::ToUtf16() const {
+  std::u16string text;
+  text.reserve(length());
+  text.append(buffer_.begin(), buffer_.begin() + gap_start_);
+  text.append(buffer_.begin() + gap_end_, buffer_.end());
+  return text;
+}
+
+std::string TextGapBuffer::ToUtf8() const {
+  std::string text;
+  text.reserve(length());
+  ForEachCodePoint(*this, length(), [&text](char32_t code_point) {
+    if (code_point < 0x80) {
+      text.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+      text.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+      text.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+      text.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+      text.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      text.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+      text.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+      text.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+      text.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      text.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+  });
+  return text;
+}
+
+size_t TextGapBuffer::GetUtf8Length(size_t end) const {
+  FML_DCHECK(end <= length());
+  size_t utf8_length = 0;
+  ForEachCodePoint(*this, end, [&utf8_length](char32_t code_point) {
+    utf8_length += GetUtf8CodePointLength(code_point);
+  });
+  return utf8_length;
+}
+
+void TextGapBuffer::MoveGap(size_t position, size_t length) {
+  FML_DCHECK(position <= this->length());
+  if (position < gap_start_) {
+    std::move_backward(buffer_.begin() + position,
+                       buffer_.begin() + gap_start_,
+                       buffer_.begin() + gap_end_);
+    gap_end_ -= gap_start_ - position;
+    gap_start_ = position;
+  } else if (position > gap_start_) {
+    const size_t count = position - gap_start_;
+    std::move(buffer_.begin() + gap_end_, buffer_.begin() + gap_end_ + count,
+              buffer_.begin() + gap_start_);
+    gap_start_ += count;
+    gap_end_ += count;
+  }
+
+  if (gap_length() < length) {
+    // Grow the buffer geometrically so that a run of insertions only
+    // reallocates it a logarithmic number of times.
+    const size_t growth =
+        std::max({length - gap_length(), this->length(), kMinGapLength});
+    buffer_.insert(buffer_.begin() + gap_end_, growth, u'\0');
+    gap_end_ += growth;
+  }
+}
+
+}  // namespace flutter
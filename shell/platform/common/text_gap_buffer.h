@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_COMMON_TEXT_GAP_BUFFER_H_
+#define FLUTTER_SHELL_PLATFORM_COMMON_TEXT_GAP_BUFFER_H_
+
+#include <string>
+#include <vector>
+
+namespace flutter {
+
+// UTF-16 text stored with a gap at the position of the last edit.
+//
+// Edits only move the text between their position and the position of the
+// previous edit. Typing or deleting at the cursor therefore takes time
+// proportional to the length of the edit rather than the length of the text.
+class TextGapBuffer {
+ public:
+  TextGapBuffer();
+  explicit TextGapBuffer(const std::u16string& text);
+  ~TextGapBuffer();
+
+  // The length of the text in UTF-16 code units.
+  size_t length() const { return buffer_.size() - gap_length(); }
+
+  // Returns the code unit at |position|, which must be less than |length|.
+  char16_t at(size_t position) const;
+
+  // Replaces |length| code units starting at |position| with |text|.
+  void Replace(size_t position, size_t length, const std::u16string& text);
+
+  // Inserts |text| before the code unit at |position|.
+  void Insert(size_t position, const std::u16string& text) {
+    Replace(position, 0, text);
+  }
+
+  // Deletes |length| code units starting at |position|.
+  void Erase(size_t position, size_t length) {
+    Replace(position, length, std::u16string());
+  }
+
+  // Returns the text as UTF-16.
+  std::u16string ToUtf16() const;
+
+  // Returns the text as UTF-8.
+  //
+  // Unpaired surrogates are encoded as U+FFFD.
+  std::string ToUtf8() const;
+
+  // Returns the length in bytes of the UTF-8 encoding of the first |end| code
+  // units of the text.
+  size_t GetUtf8Length(size_t end) const;
+
+ private:
+  size_t gap_length() const { return gap_end_ - gap_start_; }
+
+  // Moves the gap to |position| and grows it to at least |length| code units.
+  void MoveGap(size_t position, size_t length);
+
+  std::vector<char16_t> buffer_;
+  size_t gap_start_ = 0;
+  size_t gap_end_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_COMMON_TEXT_GAP_BUFFER_H_
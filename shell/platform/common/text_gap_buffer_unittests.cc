@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/text_gap_buffer.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+
+TEST(TextGapBuffer, Empty) {
+  TextGapBuffer text;
+  EXPECT_EQ(text.length(), 0u);
+  EXPECT_EQ(text.ToUtf16(), u"");
+  EXPECT_EQ(text.ToUtf8(), "");
+  EXPECT_EQ(text.GetUtf8Length(0), 0u);
+}
+
+TEST(TextGapBuffer, InsertAtCursor) {
+  TextGapBuffer text(u"AE");
+  text.Insert(1, u"B");
+  text.Insert(2, u"C");
+  text.Insert(3, u"D");
+  EXPECT_EQ(text.length(), 5u);
+  EXPECT_EQ(text.ToUtf16(), u"ABCDE");
+}
+
+TEST(TextGapBuffer, EditsAwayFromTheGap) {
+  TextGapBuffer text(u"ABCDE");
+  text.Insert(0, u"_");
+  text.Erase(4, 1);
+  text.Replace(2, 2, u"xyz");
+  EXPECT_EQ(text.ToUtf16(), u"_AxyzE");
+  EXPECT_EQ(text.at(0), u'_');
+  EXPECT_EQ(text.at(2), u'x');
+  EXPECT_EQ(text.at(5), u'E');
+}
+
+TEST(TextGapBuffer, GrowsForLongInsertions) {
+  TextGapBuffer text(u"AB");
+  std::u16string expected = u"AB";
+  for (int i = 0; i < 1000; i++) {
+    text.Insert(1, u"0123456789");
+    expected.insert(1, u"0123456789");
+  }
+  EXPECT_EQ(text.length(), expected.length());
+  EXPECT_EQ(text.ToUtf16(), expected);
+}
+
+TEST(TextGapBuffer, ToUtf8) {
+  TextGapBuffer text(u"aé中");
+  text.Insert(1, u"\U0001F604");
+  EXPECT_EQ(text.ToUtf8(), "a\U0001F604é中");
+}
+
+TEST(TextGapBuffer, ToUtf8ReplacesUnpairedSurrogates) {
+  TextGapBuffer text(u"\U0001F604");
+  text.Erase(1, 1);
+  EXPECT_EQ(text.ToUtf8(), "\xEF\xBF\xBD");
+}
+
+TEST(TextGapBuffer, GetUtf8Length) {
+  TextGapBuffer text(u"aé中\U0001F604");
+  text.Insert(2, u"b");
+  EXPECT_EQ(text.GetUtf8Length(0), 0u);
+  EXPECT_EQ(text.GetUtf8Length(1), 1u);
+  EXPECT_EQ(text.GetUtf8Length(2), 3u);
+  EXPECT_EQ(text.GetUtf8Length(3), 4u);
+  EXPECT_EQ(text.GetUtf8Length(4), 7u);
+  EXPECT_EQ(text.GetUtf8Length(6), 11u);
+}
+
+}  // namespace flutter
@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/text_input_model.h"
+
+#include <string>
+
+#include "flutter/benchmarking/benchmarking.h"
+
+namespace flutter {
+
+static std::string CreateDocument(size_t length) {
+  std::string document;
+  document.reserve(length);
+  while (document.size() < length) {
+    document += "The quick brown fox jumps over the lazy dog.\n";
+  }
+  document.resize(length);
+  return document;
+}
+
+static void BM_TextInputModelTyping(benchmark::State& state) {
+  TextInputModel model;
+  const size_t length = state.range(0);
+  model.SetText(CreateDocument(length), TextRange(length / 2));
+  while (state.KeepRunning()) {
+    model.AddCodePoint('a');
+    model.Backspace();
+  }
+}
+
+static void BM_TextInputModelTypingAndMovingCursor(benchmark::State& state) {
+  TextInputModel model;
+  const size_t length = state.range(0);
+  model.SetText(CreateDocument(length), TextRange(length / 2));
+  while (state.KeepRunning()) {
+    model.AddCodePoint('a');
+    model.MoveCursorBack();
+    model.Delete();
+    model.MoveCursorForward();
+  }
+}
+
+static void BM_TextInputModelGetCursorOffset(benchmark::State& state) {
+  TextInputModel model;
+  const size_t length = state.range(0);
+  model.SetText(CreateDocument(length), TextRange(length / 2));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(model.GetCursorOffset());
+  }
+}
+
+static void BM_TextInputModelGetText(benchmark::State& state) {
+  TextInputModel model;
+  const size_t length = state.range(0);
+  model.SetText(CreateDocument(length), TextRange(length / 2));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(model.GetText());
+  }
+}
+
+BENCHMARK(BM_TextInputModelTyping)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_TextInputModelTypingAndMovingCursor)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_TextInputModelGetCursorOffset)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_TextInputModelGetText)->Range(1 << 10, 1 << 20);
+
+}  // namespace flutter
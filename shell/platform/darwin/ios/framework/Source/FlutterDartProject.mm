@@ -167,6 +167,55 @@ flutter::Settings FLTDefaultSettingsForBundle(NSBundle* bundle) {
     settings.enable_impeller = enableImpeller.boolValue;
   }
 
+  // Whether the engines spawned from an engine render with its Impeller pipelines and glyph atlas.
+  NSNumber* spawnedEnginesShareRenderingResources =
+      [mainBundle objectForInfoDictionaryKey:@"FLTSpawnedEnginesShareRenderingResources"];
+  // Change the default only if the option is present.
+  if (spawnedEnginesShareRenderingResources != nil) {
+    settings.spawned_engines_share_rendering_resources =
+        spawnedEnginesShareRenderingResources.boolValue;
+  }
+
+  // Whether the Metal surfaces acquire their drawables once the frame has been recorded.
+  NSNumber* deferMetalDrawableAcquisition =
+      [mainBundle objectForInfoDictionaryKey:@"FLTDeferMetalDrawableAcquisition"];
+  // Change the default only if the option is present.
+  if (deferMetalDrawableAcquisition != nil) {
+    settings.defer_metal_drawable_acquisition = deferMetalDrawableAcquisition.boolValue;
+  }
+
+  // The maximum number of drawables of the CAMetalLayers.
+  NSNumber* metalMaximumDrawableCount =
+      [mainBundle objectForInfoDictionaryKey:@"FLTMetalMaximumDrawableCount"];
+  // Change the default only if the option is present.
+  if (metalMaximumDrawableCount != nil) {
+    settings.metal_maximum_drawable_count = metalMaximumDrawableCount.unsignedIntegerValue;
+  }
+
+  // Whether the raster cache keeps entries that are unused for a few frames.
+  NSNumber* rasterCacheLruEviction =
+      [mainBundle objectForInfoDictionaryKey:@"FLTRasterCacheLruEviction"];
+  // Change the default only if the option is present.
+  if (rasterCacheLruEviction != nil) {
+    settings.raster_cache_lru_eviction = rasterCacheLruEviction.boolValue;
+  }
+
+  // Whether the raster cache compresses the images of long-lived opaque entries.
+  NSNumber* rasterCacheCompression =
+      [mainBundle objectForInfoDictionaryKey:@"FLTRasterCacheCompression"];
+  // Change the default only if the option is present.
+  if (rasterCacheCompression != nil) {
+    settings.raster_cache_compression = rasterCacheCompression.boolValue;
+  }
+
+  // Whether the asset manager remembers which resolver has each asset.
+  NSNumber* enableAssetLookupIndex =
+      [mainBundle objectForInfoDictionaryKey:@"FLTEnableAssetLookupIndex"];
+  // Change the default only if the option is present.
+  if (enableAssetLookupIndex != nil) {
+    settings.enable_asset_lookup_index = enableAssetLookupIndex.boolValue;
+  }
+
   NSNumber* enableTraceSystrace = [mainBundle objectForInfoDictionaryKey:@"FLTTraceSystrace"];
   // Change the default only if the option is present.
   if (enableTraceSystrace != nil) {
@@ -11,6 +11,7 @@
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/platform/darwin/platform_version.h"
 #include "flutter/fml/trace_event.h"
+#import "flutter/impeller/renderer/backend/metal/context_mtl.h"
 #include "flutter/runtime/ptrace_check.h"
 #include "flutter/shell/common/engine.h"
 #include "flutter/shell/common/platform_view.h"
@@ -37,37 +38,6 @@
 #import "flutter/shell/platform/darwin/ios/rendering_api_selection.h"
 #include "flutter/shell/profiling/sampling_profiler.h"
 
-/// Inheriting ThreadConfigurer and use iOS platform thread API to configure the thread priorities
-/// Using iOS platform thread API to configure thread priority
-static void IOSPlatformThreadConfigSetter(const fml::Thread::ThreadConfig& config) {
-  // set thread name
-  fml::Thread::SetCurrentThreadName(config);
-
-  // set thread priority
-  switch (config.priority) {
-    case fml::Thread::ThreadPriority::BACKGROUND: {
-      [[NSThread currentThread] setThreadPriority:0];
-      break;
-    }
-    case fml::Thread::ThreadPriority::NORMAL: {
-      [[NSThread currentThread] setThreadPriority:0.5];
-      break;
-    }
-    case fml::Thread::ThreadPriority::RASTER:
-    case fml::Thread::ThreadPriority::DISPLAY: {
-      [[NSThread currentThread] setThreadPriority:1.0];
-      sched_param param;
-      int policy;
-      pthread_t thread = pthread_self();
-      if (!pthread_getschedparam(thread, &policy, &param)) {
-        param.sched_priority = 50;
-        pthread_setschedparam(thread, policy, &param);
-      }
-      break;
-    }
-  }
-}
-
 #pragma mark - Public exported constants
 
 NSString* const FlutterDefaultDartEntrypoint = nil;
@@ -711,8 +681,7 @@ static constexpr int kNumProfilerSamplesPerSec = 5;
     threadHostType = threadHostType | flutter::ThreadHost::Type::Profiler;
   }
 
-  flutter::ThreadHost::ThreadHostConfig host_config(threadLabel.UTF8String, threadHostType,
-                                                    IOSPlatformThreadConfigSetter);
+  flutter::ThreadHost::ThreadHostConfig host_config(threadLabel.UTF8String, threadHostType);
 
   host_config.ui_config =
       fml::Thread::ThreadConfig(flutter::ThreadHost::ThreadHostConfig::MakeThreadName(
@@ -870,6 +839,9 @@ static void SetEntryPoint(flutter::Settings* settings, NSString* entrypoint, NSS
   if (_shell) {
     _shell->NotifyLowMemoryWarning();
   }
+  if (_platformViewsController) {
+    _platformViewsController->ReleaseIdleLayers();
+  }
   [_systemChannel sendMessage:@{@"type" : @"memoryPressure"}];
 }
 
@@ -1203,6 +1175,19 @@ static void SetEntryPoint(flutter::Settings* settings, NSString* entrypoint, NSS
 - (void)applicationDidEnterBackground:(NSNotification*)notification {
   [self setIsGpuDisabled:YES];
   [self notifyLowMemory];
+  [self flushPipelineCache];
+}
+
+- (void)flushPipelineCache {
+  // The application may be killed without notice once backgrounded. Keep the
+  // pipelines compiled so far for the next launch.
+  if (!_shell || !self.iosPlatformView) {
+    return;
+  }
+  auto impeller_context = self.iosPlatformView->GetImpellerContext();
+  if (impeller_context) {
+    impeller::ContextMTL::Cast(*impeller_context).FlushPipelineCache();
+  }
 }
 
 - (void)onMemoryWarning:(NSNotification*)notification {
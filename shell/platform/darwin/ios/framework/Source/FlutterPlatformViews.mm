@@ -101,9 +101,29 @@ std::shared_ptr<FlutterPlatformViewLayer> FlutterPlatformViewLayerPool::GetLayer
 }
 
 void FlutterPlatformViewLayerPool::RecycleLayers() {
+  for (size_t i = 0; i < layers_.size(); i++) {
+    if (i < available_layer_index_) {
+      layers_[i]->idle_frame_count = 0;
+    } else {
+      layers_[i]->idle_frame_count++;
+    }
+  }
+  // The layers are handed out in order, so the idle layers are at the end.
+  while (!layers_.empty() && layers_.back()->idle_frame_count > kMaxIdleFrames) {
+    [layers_.back()->overlay_view_wrapper removeFromSuperview];
+    layers_.pop_back();
+  }
   available_layer_index_ = 0;
 }
 
+void FlutterPlatformViewLayerPool::ReleaseIdleLayers() {
+  FML_DCHECK(available_layer_index_ == 0);
+  while (!layers_.empty() && layers_.back()->idle_frame_count > 0) {
+    [layers_.back()->overlay_view_wrapper removeFromSuperview];
+    layers_.pop_back();
+  }
+}
+
 std::vector<std::shared_ptr<FlutterPlatformViewLayer>>
 FlutterPlatformViewLayerPool::GetUnusedLayers() {
   std::vector<std::shared_ptr<FlutterPlatformViewLayer>> results;
@@ -571,6 +591,11 @@ void FlutterPlatformViewsController::Reset() {
   visited_platform_views_.clear();
 }
 
+void FlutterPlatformViewsController::ReleaseIdleLayers() {
+  FML_DCHECK([[NSThread currentThread] isMainThread]);
+  layer_pool_->ReleaseIdleLayers();
+}
+
 SkRect FlutterPlatformViewsController::GetPlatformViewRect(int view_id) {
   UIView* platform_view = GetPlatformViewByID(view_id);
   UIScreen* screen = [UIScreen mainScreen];
@@ -611,6 +636,9 @@ bool FlutterPlatformViewsController::SubmitFrame(GrDirectContext* gr_context,
 
   auto did_submit = true;
   auto num_platform_views = composition_order_.size();
+  size_t num_overlay_layers = 0;
+  const SkScalar layer_cost =
+      frame_size_.width() * frame_size_.height() * kOverlayLayerCostFraction;
 
   for (size_t i = 0; i < num_platform_views; i++) {
     int64_t platform_view_id = composition_order_[i];
@@ -624,27 +652,21 @@ bool FlutterPlatformViewsController::SubmitFrame(GrDirectContext* gr_context,
       SkRect platform_view_rect = GetPlatformViewRect(current_platform_view_id);
       std::list<SkRect> intersection_rects =
           slice->searchNonOverlappingDrawnRects(platform_view_rect);
-      auto allocation_size = intersection_rects.size();
 
       // For testing purposes, the overlay id is used to find the overlay view.
       // This is the index of the layer for the current platform view.
       auto overlay_id = platform_view_layers[current_platform_view_id].size();
 
-      // If the max number of allocations per platform view is exceeded,
-      // then join all the rects into a single one.
+      // Limit the number of overlay layers per platform view, and merge the rects that are
+      // cheaper to draw on a single layer. Once the frame has many overlay layers, each
+      // platform view only gets one.
       //
       // TODO(egarciad): Consider making this configurable.
       // https://github.com/flutter/flutter/issues/52510
-      if (allocation_size > kMaxLayerAllocations) {
-        SkRect joined_rect;
-        for (const SkRect& rect : intersection_rects) {
-          joined_rect.join(rect);
-        }
-        // Replace the rects in the intersection rects list for a single rect that is
-        // the union of all the rects in the list.
-        intersection_rects.clear();
-        intersection_rects.push_back(joined_rect);
-      }
+      size_t max_layer_allocations =
+          num_overlay_layers + kMaxLayerAllocations > kMaxOverlayLayers ? 1 : kMaxLayerAllocations;
+      MergeOverlayRects(intersection_rects, max_layer_allocations, layer_cost);
+      num_overlay_layers += intersection_rects.size();
       for (SkRect& joined_rect : intersection_rects) {
         // Get the intersection rect between the current rect
         // and the platform view rect.
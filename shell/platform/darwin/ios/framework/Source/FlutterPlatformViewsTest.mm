@@ -2284,6 +2284,33 @@ fml::RefPtr<fml::TaskRunner> CreateNewThread(std::string name) {
   return pixel[3];
 }
 
+- (void)testMergeOverlayRectsMergesAdjacentRects {
+  std::list<SkRect> rects = {SkRect::MakeLTRB(0, 0, 10, 10), SkRect::MakeLTRB(10, 0, 20, 10)};
+  flutter::MergeOverlayRects(rects, 2, 1);
+  XCTAssertEqual(rects.size(), 1u);
+  XCTAssertTrue(rects.front() == SkRect::MakeLTRB(0, 0, 20, 10));
+}
+
+- (void)testMergeOverlayRectsKeepsDistantRects {
+  std::list<SkRect> rects = {SkRect::MakeLTRB(0, 0, 10, 10),
+                             SkRect::MakeLTRB(100, 100, 110, 110)};
+  flutter::MergeOverlayRects(rects, 2, 100);
+  XCTAssertEqual(rects.size(), 2u);
+
+  flutter::MergeOverlayRects(rects, 1, 100);
+  XCTAssertEqual(rects.size(), 1u);
+  XCTAssertTrue(rects.front() == SkRect::MakeLTRB(0, 0, 110, 110));
+}
+
+- (void)testMergeOverlayRectsMergesTheCheapestPairFirst {
+  std::list<SkRect> rects = {SkRect::MakeLTRB(0, 0, 10, 10), SkRect::MakeLTRB(0, 20, 10, 30),
+                             SkRect::MakeLTRB(100, 100, 110, 110)};
+  flutter::MergeOverlayRects(rects, 2, 0);
+  XCTAssertEqual(rects.size(), 2u);
+  XCTAssertTrue(rects.front() == SkRect::MakeLTRB(0, 0, 10, 30));
+  XCTAssertTrue(rects.back() == SkRect::MakeLTRB(100, 100, 110, 110));
+}
+
 - (void)testHasFirstResponderInViewHierarchySubtree_viewItselfBecomesFirstResponder {
   // For view to become the first responder, it must be a descendant of a UIWindow
   UIWindow* window = [[UIWindow alloc] init];
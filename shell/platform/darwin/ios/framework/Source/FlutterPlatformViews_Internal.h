@@ -108,6 +108,12 @@ void ResetAnchor(CALayer* layer);
 CGRect GetCGRectFromSkRect(const SkRect& clipSkRect);
 BOOL BlurRadiusEqualToBlurRadius(CGFloat radius1, CGFloat radius2);
 
+// Merges the rects of the overlays above a platform view, so that at most `max_rects` remain.
+//
+// Pairs of rects are also merged while the area their union adds is less than `layer_cost`, the
+// cost of an additional overlay layer in pixels.
+void MergeOverlayRects(std::list<SkRect>& rects, size_t max_rects, SkScalar layer_cost);
+
 class IOSContextGL;
 class IOSSurface;
 
@@ -127,6 +133,9 @@ struct FlutterPlatformViewLayer {
   // Whether a frame for this layer was submitted.
   bool did_submit_last_frame;
 
+  // The number of consecutive frames in which this layer wasn't used.
+  size_t idle_frame_count = 0;
+
   // The GrContext that is currently used by the overlay surfaces.
   // We track this to know when the GrContext for the Flutter app has changed
   // so we can update the overlay with the new context.
@@ -151,9 +160,25 @@ class FlutterPlatformViewLayerPool {
   std::vector<std::shared_ptr<FlutterPlatformViewLayer>> GetUnusedLayers();
 
   // Marks the layers in the pool as available for reuse.
+  //
+  // Layers that haven't been used for `kMaxIdleFrames` frames are released.
   void RecycleLayers();
 
+  // Releases the layers that weren't used in the last frame.
+  //
+  // Must be called between frames.
+  void ReleaseIdleLayers();
+
+  // The number of layers in the pool.
+  size_t size() const { return layers_.size(); }
+
  private:
+  // The number of frames a layer is kept in the pool without being used.
+  //
+  // This is enough to keep the layers of a platform view that is momentarily hidden, and
+  // prevents the pool from only growing when the number of overlays changes.
+  static const size_t kMaxIdleFrames = 60;
+
   // The index of the entry in the layers_ vector that determines the beginning of the unused
   // layers. For example, consider the following vector:
   //  _____
@@ -227,6 +252,10 @@ class FlutterPlatformViewsController {
   // Discards all platform views instances and auxiliary resources.
   void Reset();
 
+  // Releases the overlay layers that aren't used by the current frame, for example when the
+  // system is low on memory.
+  void ReleaseIdleLayers();
+
   bool SubmitFrame(GrDirectContext* gr_context,
                    const std::shared_ptr<IOSContext>& ios_context,
                    std::unique_ptr<SurfaceFrame> frame);
@@ -247,6 +276,15 @@ class FlutterPlatformViewsController {
  private:
   static const size_t kMaxLayerAllocations = 2;
 
+  // The number of overlay layers in a frame after which every platform view only gets a single
+  // overlay layer.
+  static const size_t kMaxOverlayLayers = 8;
+
+  // The cost of an overlay layer as a fraction of the frame area. Each overlay layer has a
+  // backing surface of the size of the frame and adds a CALayer to composite, so the rects of
+  // two overlays are merged when their union covers less additional area than this.
+  static constexpr SkScalar kOverlayLayerCostFraction = 0.1;
+
   using LayersMap = std::map<int64_t, std::vector<std::shared_ptr<FlutterPlatformViewLayer>>>;
 
   void OnCreate(FlutterMethodCall* call, FlutterResult& result);
@@ -4,12 +4,17 @@
 
 #import "flutter/shell/platform/darwin/ios/framework/Source/FlutterPlatformViews_Internal.h"
 
+#include <limits>
+
 #include "flutter/display_list/display_list_image_filter.h"
 #include "flutter/fml/platform/darwin/cf_utils.h"
 #import "flutter/shell/platform/darwin/ios/ios_surface.h"
 
 static int kMaxPointsInVerb = 4;
 
+// The number of rects above which MergeOverlayRects joins them all.
+static constexpr size_t kMaxOverlayMergeCandidates = 16;
+
 namespace flutter {
 
 FlutterPlatformViewLayer::FlutterPlatformViewLayer(
@@ -65,6 +70,47 @@ BOOL BlurRadiusEqualToBlurRadius(CGFloat radius1, CGFloat radius2) {
   return radius1 - radius2 < epsilon;
 }
 
+static SkScalar GetArea(const SkRect& rect) {
+  return rect.width() * rect.height();
+}
+
+void MergeOverlayRects(std::list<SkRect>& rects, size_t max_rects, SkScalar layer_cost) {
+  FML_DCHECK(max_rects > 0);
+  // Finding the best pair is quadratic, so lots of rects are joined into a single one.
+  if (rects.size() > kMaxOverlayMergeCandidates) {
+    SkRect joined_rect = SkRect::MakeEmpty();
+    for (const SkRect& rect : rects) {
+      joined_rect.join(rect);
+    }
+    rects.clear();
+    rects.push_back(joined_rect);
+    return;
+  }
+  while (rects.size() > 1) {
+    // Find the pair of rects whose union adds the least area.
+    auto best_first = rects.end();
+    auto best_second = rects.end();
+    SkScalar best_added_area = std::numeric_limits<SkScalar>::max();
+    for (auto first = rects.begin(); first != rects.end(); first++) {
+      for (auto second = std::next(first); second != rects.end(); second++) {
+        SkRect joined_rect = *first;
+        joined_rect.join(*second);
+        SkScalar added_area = GetArea(joined_rect) - GetArea(*first) - GetArea(*second);
+        if (added_area < best_added_area) {
+          best_added_area = added_area;
+          best_first = first;
+          best_second = second;
+        }
+      }
+    }
+    if (rects.size() <= max_rects && best_added_area >= layer_cost) {
+      return;
+    }
+    best_first->join(*best_second);
+    rects.erase(best_second);
+  }
+}
+
 }  // namespace flutter
 
 @interface PlatformViewFilter ()
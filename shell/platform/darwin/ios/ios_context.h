@@ -17,6 +17,7 @@
 #include "third_party/skia/include/gpu/GrDirectContext.h"
 
 namespace impeller {
+class AiksContext;
 class Context;
 }  // namespace impeller
 
@@ -51,12 +52,16 @@ class IOSContext {
   /// @param[in]  msaa_samples
   ///                       The number of MSAA samples to use. Only supplied to
   ///                       Skia, must be either 0, 1, 2, 4, or 8.
+  /// @param[in]  share_aiks_context
+  ///                       Whether all the Impeller surfaces that use this
+  ///                       context render with the same Aiks context.
   ///
   /// @return     A valid context on success. `nullptr` on failure.
   ///
   static std::unique_ptr<IOSContext> Create(IOSRenderingAPI api,
                                             IOSRenderingBackend backend,
-                                            MsaaSampleCount msaa_samples);
+                                            MsaaSampleCount msaa_samples,
+                                            bool share_aiks_context);
 
   //----------------------------------------------------------------------------
   /// @brief      Collects the context object. This must happen on the thread on
@@ -141,6 +146,19 @@ class IOSContext {
 
   virtual std::shared_ptr<impeller::Context> GetImpellerContext() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Accessor for the Aiks context that all the Impeller surfaces
+  ///             of this context render with, including the surfaces of the
+  ///             engines spawned from the engine that created it. Sharing it
+  ///             shares the pipelines and the glyph atlas of those surfaces.
+  /// @details    The Aiks context is created the first time it is accessed.
+  ///             It must only be used on the raster task runner, which the
+  ///             spawned engines share with the engine they are spawned from.
+  /// @returns    `nullptr` if the context doesn't use Impeller, or if the Aiks
+  ///             context isn't shared. The surfaces then create their own.
+  ///
+  virtual std::shared_ptr<impeller::AiksContext> GetSharedAiksContext();
+
   MsaaSampleCount GetMsaaSampleCount() const { return msaa_samples_; }
 
  protected:
@@ -20,7 +20,8 @@ IOSContext::~IOSContext() = default;
 
 std::unique_ptr<IOSContext> IOSContext::Create(IOSRenderingAPI api,
                                                IOSRenderingBackend backend,
-                                               MsaaSampleCount msaa_samples) {
+                                               MsaaSampleCount msaa_samples,
+                                               bool share_aiks_context) {
   switch (api) {
     case IOSRenderingAPI::kSoftware:
       return std::make_unique<IOSContextSoftware>();
@@ -30,7 +31,7 @@ std::unique_ptr<IOSContext> IOSContext::Create(IOSRenderingAPI api,
         case IOSRenderingBackend::kSkia:
           return std::make_unique<IOSContextMetalSkia>(msaa_samples);
         case IOSRenderingBackend::kImpeller:
-          return std::make_unique<IOSContextMetalImpeller>();
+          return std::make_unique<IOSContextMetalImpeller>(share_aiks_context);
       }
 #endif  // SHELL_ENABLE_METAL
     default:
@@ -48,4 +49,8 @@ std::shared_ptr<impeller::Context> IOSContext::GetImpellerContext() const {
   return nullptr;
 }
 
+std::shared_ptr<impeller::AiksContext> IOSContext::GetSharedAiksContext() {
+  return nullptr;
+}
+
 }  // namespace flutter
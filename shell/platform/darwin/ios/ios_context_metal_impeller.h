@@ -5,6 +5,8 @@
 #ifndef FLUTTER_SHELL_PLATFORM_DARWIN_IOS_IOS_CONTEXT_METAL_IMPELER_H_
 #define FLUTTER_SHELL_PLATFORM_DARWIN_IOS_IOS_CONTEXT_METAL_IMPELER_H_
 
+#include <mutex>
+
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/darwin/graphics/FlutterDarwinContextMetalImpeller.h"
 #include "flutter/shell/platform/darwin/graphics/FlutterDarwinContextMetalSkia.h"
@@ -20,7 +22,7 @@ namespace flutter {
 
 class IOSContextMetalImpeller final : public IOSContext {
  public:
-  IOSContextMetalImpeller();
+  explicit IOSContextMetalImpeller(bool share_aiks_context);
 
   ~IOSContextMetalImpeller();
 
@@ -33,8 +35,14 @@ class IOSContextMetalImpeller final : public IOSContext {
 
   sk_sp<GrDirectContext> GetResourceContext() const;
 
+  // |IOSContext|
+  std::shared_ptr<impeller::AiksContext> GetSharedAiksContext() override;
+
  private:
   fml::scoped_nsobject<FlutterDarwinContextMetalImpeller> darwin_context_metal_impeller_;
+  const bool share_aiks_context_;
+  std::mutex aiks_context_mutex_;
+  std::shared_ptr<impeller::AiksContext> aiks_context_;
 
   // |IOSContext|
   sk_sp<GrDirectContext> CreateResourceContext() override;
@@ -3,15 +3,18 @@
 // found in the LICENSE file.
 
 #import "flutter/shell/platform/darwin/ios/ios_context_metal_impeller.h"
+#include "flutter/fml/logging.h"
+#include "flutter/impeller/aiks/aiks_context.h"
 #include "flutter/impeller/entity/mtl/entity_shaders.h"
 #import "flutter/shell/platform/darwin/ios/ios_external_texture_metal.h"
 
 namespace flutter {
 
-IOSContextMetalImpeller::IOSContextMetalImpeller()
+IOSContextMetalImpeller::IOSContextMetalImpeller(bool share_aiks_context)
     : IOSContext(MsaaSampleCount::kFour),
       darwin_context_metal_impeller_(fml::scoped_nsobject<FlutterDarwinContextMetalImpeller>{
-          [[FlutterDarwinContextMetalImpeller alloc] init]}) {}
+          [[FlutterDarwinContextMetalImpeller alloc] init]}),
+      share_aiks_context_(share_aiks_context) {}
 
 IOSContextMetalImpeller::~IOSContextMetalImpeller() = default;
 
@@ -42,6 +45,27 @@ std::shared_ptr<impeller::Context> IOSContextMetalImpeller::GetImpellerContext()
   return darwin_context_metal_impeller_.get().context;
 }
 
+// |IOSContext|
+std::shared_ptr<impeller::AiksContext> IOSContextMetalImpeller::GetSharedAiksContext() {
+  if (!share_aiks_context_) {
+    return nullptr;
+  }
+  std::scoped_lock lock(aiks_context_mutex_);
+  if (!aiks_context_) {
+    auto impeller_context = GetImpellerContext();
+    if (!impeller_context) {
+      return nullptr;
+    }
+    auto aiks_context = std::make_shared<impeller::AiksContext>(std::move(impeller_context));
+    if (!aiks_context->IsValid()) {
+      FML_LOG(ERROR) << "Could not create the shared Aiks context.";
+      return nullptr;
+    }
+    aiks_context_ = std::move(aiks_context);
+  }
+  return aiks_context_;
+}
+
 // |IOSContext|
 std::unique_ptr<GLContextResult> IOSContextMetalImpeller::MakeCurrent() {
   // This only makes sense for contexts that need to be bound to a specific thread.
@@ -24,8 +24,13 @@ bool IsIosEmbeddedViewsPreviewEnabled();
 
 class IOSSurface {
  public:
+  // Creates a surface that renders into |layer|. The Metal surfaces defer the
+  // acquisition of their drawables if |defer_drawable_acquisition| is set.
+  //
+  // @see |GPUSurfaceMetalDelegate::DefersDrawableAcquisition|
   static std::unique_ptr<IOSSurface> Create(std::shared_ptr<IOSContext> context,
-                                            const fml::scoped_nsobject<CALayer>& layer);
+                                            const fml::scoped_nsobject<CALayer>& layer,
+                                            bool defer_drawable_acquisition = false);
 
   std::shared_ptr<IOSContext> GetContext() const;
 
@@ -16,7 +16,8 @@
 namespace flutter {
 
 std::unique_ptr<IOSSurface> IOSSurface::Create(std::shared_ptr<IOSContext> context,
-                                               const fml::scoped_nsobject<CALayer>& layer) {
+                                               const fml::scoped_nsobject<CALayer>& layer,
+                                               bool defer_drawable_acquisition) {
   FML_DCHECK(layer);
   FML_DCHECK(context);
 
@@ -28,14 +29,16 @@ std::unique_ptr<IOSSurface> IOSSurface::Create(std::shared_ptr<IOSContext> conte
           return std::make_unique<IOSSurfaceMetalSkia>(
               fml::scoped_nsobject<CAMetalLayer>(
                   reinterpret_cast<CAMetalLayer*>([layer.get() retain])),  // Metal layer
-              std::move(context)                                           // context
+              std::move(context),                                          // context
+              defer_drawable_acquisition  // defer drawable acquisition
           );
           break;
         case IOSRenderingBackend::kImpeller:
           return std::make_unique<IOSSurfaceMetalImpeller>(
               fml::scoped_nsobject<CAMetalLayer>(
                   reinterpret_cast<CAMetalLayer*>([layer.get() retain])),  // Metal layer
-              std::move(context)                                           // context
+              std::move(context),                                          // context
+              defer_drawable_acquisition  // defer drawable acquisition
           );
       }
     }
@@ -22,7 +22,8 @@ class SK_API_AVAILABLE_CA_METAL_LAYER IOSSurfaceMetalImpeller final
       public GPUSurfaceMetalDelegate {
  public:
   IOSSurfaceMetalImpeller(const fml::scoped_nsobject<CAMetalLayer>& layer,
-                          const std::shared_ptr<IOSContext>& context);
+                          const std::shared_ptr<IOSContext>& context,
+                          bool defer_drawable_acquisition);
 
   // |IOSSurface|
   ~IOSSurfaceMetalImpeller();
@@ -30,6 +31,7 @@ class SK_API_AVAILABLE_CA_METAL_LAYER IOSSurfaceMetalImpeller final
  private:
   fml::scoped_nsobject<CAMetalLayer> layer_;
   const std::shared_ptr<impeller::Context> impeller_context_;
+  const bool defer_drawable_acquisition_;
   bool is_valid_ = false;
 
   // |IOSSurface|
@@ -56,6 +58,9 @@ class SK_API_AVAILABLE_CA_METAL_LAYER IOSSurfaceMetalImpeller final
   // |GPUSurfaceMetalDelegate|
   bool AllowsDrawingWhenGpuDisabled() const override;
 
+  // |GPUSurfaceMetalDelegate|
+  bool DefersDrawableAcquisition() const override;
+
   FML_DISALLOW_COPY_AND_ASSIGN(IOSSurfaceMetalImpeller);
 };
 
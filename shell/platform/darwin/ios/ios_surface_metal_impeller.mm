@@ -9,11 +9,13 @@
 namespace flutter {
 
 IOSSurfaceMetalImpeller::IOSSurfaceMetalImpeller(const fml::scoped_nsobject<CAMetalLayer>& layer,
-                                                 const std::shared_ptr<IOSContext>& context)
+                                                 const std::shared_ptr<IOSContext>& context,
+                                                 bool defer_drawable_acquisition)
     : IOSSurface(context),
       GPUSurfaceMetalDelegate(MTLRenderTargetType::kCAMetalLayer),
       layer_(layer),
-      impeller_context_(context ? context->GetImpellerContext() : nullptr) {
+      impeller_context_(context ? context->GetImpellerContext() : nullptr),
+      defer_drawable_acquisition_(defer_drawable_acquisition) {
   if (!impeller_context_) {
     return;
   }
@@ -35,9 +37,9 @@ void IOSSurfaceMetalImpeller::UpdateStorageSizeIfNecessary() {
 
 // |IOSSurface|
 std::unique_ptr<Surface> IOSSurfaceMetalImpeller::CreateGPUSurface(GrDirectContext*) {
-  return std::make_unique<GPUSurfaceMetalImpeller>(this,              //
-                                                   impeller_context_  //
-
+  return std::make_unique<GPUSurfaceMetalImpeller>(this,                                 //
+                                                   impeller_context_,                    //
+                                                   GetContext()->GetSharedAiksContext()  //
   );
 }
 
@@ -77,4 +79,9 @@ bool IOSSurfaceMetalImpeller::AllowsDrawingWhenGpuDisabled() const {
   return false;
 }
 
+// |GPUSurfaceMetalDelegate|
+bool IOSSurfaceMetalImpeller::DefersDrawableAcquisition() const {
+  return defer_drawable_acquisition_;
+}
+
 }  // namespace flutter
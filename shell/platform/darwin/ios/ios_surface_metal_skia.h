@@ -18,7 +18,8 @@ class SK_API_AVAILABLE_CA_METAL_LAYER IOSSurfaceMetalSkia final : public IOSSurf
                                                                   public GPUSurfaceMetalDelegate {
  public:
   IOSSurfaceMetalSkia(const fml::scoped_nsobject<CAMetalLayer>& layer,
-                      std::shared_ptr<IOSContext> context);
+                      std::shared_ptr<IOSContext> context,
+                      bool defer_drawable_acquisition);
 
   // |IOSSurface|
   ~IOSSurfaceMetalSkia();
@@ -27,6 +28,7 @@ class SK_API_AVAILABLE_CA_METAL_LAYER IOSSurfaceMetalSkia final : public IOSSurf
   fml::scoped_nsobject<CAMetalLayer> layer_;
   id<MTLDevice> device_;
   id<MTLCommandQueue> command_queue_;
+  const bool defer_drawable_acquisition_;
   bool is_valid_ = false;
 
   // |IOSSurface|
@@ -53,6 +55,9 @@ class SK_API_AVAILABLE_CA_METAL_LAYER IOSSurfaceMetalSkia final : public IOSSurf
   // |GPUSurfaceMetalDelegate|
   bool AllowsDrawingWhenGpuDisabled() const override;
 
+  // |GPUSurfaceMetalDelegate|
+  bool DefersDrawableAcquisition() const override;
+
   FML_DISALLOW_COPY_AND_ASSIGN(IOSSurfaceMetalSkia);
 };
 
@@ -15,10 +15,12 @@ static IOSContextMetalSkia* CastToMetalContext(const std::shared_ptr<IOSContext>
 }
 
 IOSSurfaceMetalSkia::IOSSurfaceMetalSkia(const fml::scoped_nsobject<CAMetalLayer>& layer,
-                                         std::shared_ptr<IOSContext> context)
+                                         std::shared_ptr<IOSContext> context,
+                                         bool defer_drawable_acquisition)
     : IOSSurface(std::move(context)),
       GPUSurfaceMetalDelegate(MTLRenderTargetType::kCAMetalLayer),
-      layer_(layer) {
+      layer_(layer),
+      defer_drawable_acquisition_(defer_drawable_acquisition) {
   is_valid_ = layer_;
   auto metal_context = CastToMetalContext(GetContext());
   auto darwin_context = metal_context->GetDarwinContext().get();
@@ -80,6 +82,15 @@ bool IOSSurfaceMetalSkia::PresentDrawable(GrMTLHandle drawable) const {
 
   auto command_buffer =
       fml::scoped_nsprotocol<id<MTLCommandBuffer>>([[command_queue_ commandBuffer] retain]);
+  // Presenting from the command buffer schedules the presentation once the work of the frame has
+  // been scheduled, without blocking the raster thread until then. This isn't possible when the
+  // drawable is presented in a transaction, which requires that the work is already scheduled.
+  if (defer_drawable_acquisition_ && !layer_.get().presentsWithTransaction) {
+    [command_buffer.get() presentDrawable:reinterpret_cast<id<CAMetalDrawable>>(drawable)];
+    [command_buffer.get() commit];
+    return true;
+  }
+
   [command_buffer.get() commit];
   [command_buffer.get() waitUntilScheduled];
 
@@ -104,4 +115,9 @@ bool IOSSurfaceMetalSkia::AllowsDrawingWhenGpuDisabled() const {
   return false;
 }
 
+// |GPUSurfaceMetalDelegate|
+bool IOSSurfaceMetalSkia::DefersDrawableAcquisition() const {
+  return defer_drawable_acquisition_;
+}
+
 }  // namespace flutter
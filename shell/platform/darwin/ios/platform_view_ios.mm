@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #import "flutter/shell/platform/darwin/ios/platform_view_ios.h"
+#include <algorithm>
 #include <memory>
 
 #include <utility>
@@ -61,7 +62,8 @@ PlatformViewIOS::PlatformViewIOS(
               rendering_api,
               delegate.OnPlatformViewGetSettings().enable_impeller ? IOSRenderingBackend::kImpeller
                                                                    : IOSRenderingBackend::kSkia,
-              static_cast<MsaaSampleCount>(delegate.OnPlatformViewGetSettings().msaa_samples)),
+              static_cast<MsaaSampleCount>(delegate.OnPlatformViewGetSettings().msaa_samples),
+              delegate.OnPlatformViewGetSettings().spawned_engines_share_rendering_resources),
           platform_views_controller,
           task_runners) {}
 
@@ -115,7 +117,21 @@ void PlatformViewIOS::attachView() {
          "before attaching to PlatformViewIOS.";
   auto flutter_view = static_cast<FlutterView*>(owner_controller_.get().view);
   auto ca_layer = fml::scoped_nsobject<CALayer>{[[flutter_view layer] retain]};
-  ios_surface_ = IOSSurface::Create(ios_context_, ca_layer);
+  const Settings& settings = delegate_.OnPlatformViewGetSettings();
+#if SHELL_ENABLE_METAL
+  if (settings.metal_maximum_drawable_count != 0) {
+    if (@available(iOS 11.2, *)) {
+      if ([ca_layer.get() isKindOfClass:[CAMetalLayer class]]) {
+        // Fewer drawables reduce the latency and the memory of the layer, but make it more likely
+        // that the raster thread waits for a drawable.
+        reinterpret_cast<CAMetalLayer*>(ca_layer.get()).maximumDrawableCount =
+            std::clamp<size_t>(settings.metal_maximum_drawable_count, 2, 3);
+      }
+    }
+  }
+#endif  // SHELL_ENABLE_METAL
+  ios_surface_ = IOSSurface::Create(ios_context_, ca_layer,
+                                    settings.defer_metal_drawable_acquisition);
   FML_DCHECK(ios_surface_ != nullptr);
 
   if (accessibility_bridge_) {
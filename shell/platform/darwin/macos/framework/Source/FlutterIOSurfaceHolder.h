@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #import <Cocoa/Cocoa.h>
+#import <Metal/Metal.h>
 
 /**
  * FlutterIOSurfaceHolder maintains an IOSurface
@@ -10,6 +11,11 @@
  */
 @interface FlutterIOSurfaceHolder : NSObject
 
+/**
+ * The size of the current IOSurface, or CGSizeZero if there is none.
+ */
+@property(nonatomic, readonly) CGSize size;
+
 /**
  * Releases the current IOSurface if one exists
  * and creates a new IOSurface with the specified size.
@@ -21,4 +27,10 @@
  */
 - (const IOSurfaceRef&)ioSurface;
 
+/**
+ * Returns a BGRA texture of `device` that is backed by the IOSurface. The texture is created the
+ * first time it is requested and kept until the IOSurface is recreated.
+ */
+- (nonnull id<MTLTexture>)textureWithDevice:(nonnull id<MTLDevice>)device;
+
 @end
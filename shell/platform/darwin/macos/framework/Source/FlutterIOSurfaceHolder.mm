@@ -6,6 +6,7 @@
 
 @interface FlutterIOSurfaceHolder () {
   IOSurfaceRef _ioSurface;
+  id<MTLTexture> _texture;
 }
 @end
 
@@ -15,6 +16,8 @@
   if (_ioSurface) {
     CFRelease(_ioSurface);
   }
+  _texture = nil;
+  _size = size;
 
   unsigned pixelFormat = 'BGRA';
   unsigned bytesPerElement = 4;
@@ -38,6 +41,21 @@
   return _ioSurface;
 }
 
+- (id<MTLTexture>)textureWithDevice:(id<MTLDevice>)device {
+  if (_texture == nil || _texture.device != device) {
+    MTLTextureDescriptor* textureDescriptor =
+        [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
+                                                           width:_size.width
+                                                          height:_size.height
+                                                       mipmapped:NO];
+    textureDescriptor.usage =
+        MTLTextureUsageShaderRead | MTLTextureUsageRenderTarget | MTLTextureUsageShaderWrite;
+    // plane = 0 for BGRA.
+    _texture = [device newTextureWithDescriptor:textureDescriptor iosurface:_ioSurface plane:0];
+  }
+  return _texture;
+}
+
 - (void)dealloc {
   if (_ioSurface) {
     CFRelease(_ioSurface);
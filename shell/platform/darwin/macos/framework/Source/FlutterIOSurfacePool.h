@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import <Cocoa/Cocoa.h>
+
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterIOSurfaceHolder.h"
+
+/**
+ * Keeps the IOSurfaces that are no longer used so that surfaces of the same size can be reused
+ * instead of allocated, for example when a window is resized back and forth or when the layers of
+ * the platform views change between frames.
+ *
+ * The pooled surfaces are marked as volatile, which lets the system discard their contents under
+ * memory pressure. The surfaces handed out by the pool have undefined contents.
+ */
+@interface FlutterIOSurfacePool : NSObject
+
+/**
+ * The number of surfaces that were reused from the pool.
+ */
+@property(nonatomic, readonly) NSUInteger reuseCount;
+
+/**
+ * The number of surfaces that were allocated because the pool had none of the requested size.
+ */
+@property(nonatomic, readonly) NSUInteger allocationCount;
+
+/**
+ * The number of surfaces in the pool.
+ */
+@property(nonatomic, readonly) NSUInteger pooledSurfaceCount;
+
+/**
+ * Initializes a pool that keeps at most `capacity` surfaces. The least recently recycled surfaces
+ * are released when the pool is full.
+ */
+- (nullable instancetype)initWithCapacity:(NSUInteger)capacity;
+
+/**
+ * Returns a surface of `size`. It is taken from the pool if the pool has a surface of that size
+ * that the window server is not displaying, and allocated otherwise.
+ */
+- (nonnull FlutterIOSurfaceHolder*)surfaceWithSize:(CGSize)size;
+
+/**
+ * Returns `surface` to the pool. The caller must not render to it anymore.
+ */
+- (void)recycleSurface:(nullable FlutterIOSurfaceHolder*)surface;
+
+/**
+ * Releases all the surfaces in the pool.
+ */
+- (void)purge;
+
+@end
@@ -0,0 +1,83 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterIOSurfacePool.h"
+
+#include "flutter/fml/trace_event.h"
+
+@implementation FlutterIOSurfacePool {
+  NSUInteger _capacity;
+
+  // The pooled surfaces, from the least to the most recently recycled.
+  NSMutableArray<FlutterIOSurfaceHolder*>* _surfaces;
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+  self = [super init];
+  if (self) {
+    _capacity = capacity;
+    _surfaces = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (NSUInteger)pooledSurfaceCount {
+  @synchronized(self) {
+    return _surfaces.count;
+  }
+}
+
+- (FlutterIOSurfaceHolder*)surfaceWithSize:(CGSize)size {
+  @synchronized(self) {
+    // Prefer the most recently recycled surfaces, which are the least likely to have been purged.
+    for (NSInteger i = static_cast<NSInteger>(_surfaces.count) - 1; i >= 0; --i) {
+      FlutterIOSurfaceHolder* surface = _surfaces[i];
+      if (!CGSizeEqualToSize(surface.size, size) || IOSurfaceIsInUse([surface ioSurface])) {
+        continue;
+      }
+      [_surfaces removeObjectAtIndex:i];
+      // The contents of a purged surface are lost, but its memory is restored here.
+      IOSurfaceSetPurgeable([surface ioSurface], kIOSurfacePurgeableNonVolatile, nullptr);
+      _reuseCount++;
+      [self traceCounts];
+      return surface;
+    }
+
+    FlutterIOSurfaceHolder* surface = [[FlutterIOSurfaceHolder alloc] init];
+    [surface recreateIOSurfaceWithSize:size];
+    _allocationCount++;
+    [self traceCounts];
+    return surface;
+  }
+}
+
+- (void)recycleSurface:(FlutterIOSurfaceHolder*)surface {
+  if (surface == nil || [surface ioSurface] == nullptr) {
+    return;
+  }
+  @synchronized(self) {
+    if (_capacity == 0) {
+      return;
+    }
+    IOSurfaceSetPurgeable([surface ioSurface], kIOSurfacePurgeableVolatile, nullptr);
+    [_surfaces addObject:surface];
+    if (_surfaces.count > _capacity) {
+      [_surfaces removeObjectAtIndex:0];
+    }
+  }
+}
+
+- (void)purge {
+  @synchronized(self) {
+    [_surfaces removeAllObjects];
+  }
+}
+
+- (void)traceCounts {
+  FML_TRACE_COUNTER("flutter", "FlutterIOSurfacePool",
+                    reinterpret_cast<int64_t>((__bridge void*)self),  //
+                    "Reused", _reuseCount, "Allocated", _allocationCount);
+}
+
+@end
@@ -7,6 +7,7 @@
 
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/darwin/macos/framework/Source/FlutterCompositor.h"
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterIOSurfacePool.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterPlatformViewController.h"
 
 namespace flutter {
@@ -55,6 +56,10 @@ class FlutterMetalCompositor : public FlutterCompositor {
   const id<MTLDevice> mtl_device_;
   const FlutterPlatformViewController* platform_views_controller_;
 
+  // The IOSurfaces of the collected backing stores, which are reused for the
+  // backing stores of the same size.
+  FlutterIOSurfacePool* surface_pool_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(FlutterMetalCompositor);
 };
 
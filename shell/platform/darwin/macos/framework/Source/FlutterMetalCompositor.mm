@@ -10,13 +10,28 @@
 
 namespace flutter {
 
+namespace {
+
+// The maximum number of IOSurfaces that are kept for reuse after their
+// backing stores are collected.
+constexpr NSUInteger kMaxPooledSurfaces = 4;
+
+// The user data of the backing stores allocated by the compositor.
+struct PooledBackingStore {
+  FlutterIOSurfaceHolder* io_surface_holder;
+  __weak FlutterIOSurfacePool* pool;
+};
+
+}  // namespace
+
 FlutterMetalCompositor::FlutterMetalCompositor(
     id<FlutterViewProvider> view_provider,
     FlutterPlatformViewController* platform_views_controller,
     id<MTLDevice> mtl_device)
     : FlutterCompositor(view_provider),
       mtl_device_(mtl_device),
-      platform_views_controller_(platform_views_controller) {}
+      platform_views_controller_(platform_views_controller),
+      surface_pool_([[FlutterIOSurfacePool alloc] initWithCapacity:kMaxPooledSurfaces]) {}
 
 bool FlutterMetalCompositor::CreateBackingStore(const FlutterBackingStoreConfig* config,
                                                 FlutterBackingStore* backing_store_out) {
@@ -42,28 +57,22 @@ bool FlutterMetalCompositor::CreateBackingStore(const FlutterBackingStoreConfig*
     backing_store_out->metal.texture.texture =
         (__bridge FlutterMetalTextureHandle)backingStore.texture;
   } else {
-    FlutterIOSurfaceHolder* io_surface_holder = [[FlutterIOSurfaceHolder alloc] init];
-    [io_surface_holder recreateIOSurfaceWithSize:size];
-    auto texture_descriptor =
-        [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
-                                                           width:size.width
-                                                          height:size.height
-                                                       mipmapped:NO];
-    texture_descriptor.usage =
-        MTLTextureUsageShaderRead | MTLTextureUsageRenderTarget | MTLTextureUsageShaderWrite;
-
-    backing_store_out->metal.texture.texture = (__bridge_retained FlutterMetalTextureHandle)
-        [mtl_device_ newTextureWithDescriptor:texture_descriptor
-                                    iosurface:[io_surface_holder ioSurface]
-                                        plane:0];
-
-    backing_store_out->metal.texture.user_data = (__bridge_retained void*)io_surface_holder;
+    FlutterIOSurfaceHolder* io_surface_holder = [surface_pool_ surfaceWithSize:size];
+    id<MTLTexture> texture = [io_surface_holder textureWithDevice:mtl_device_];
+    backing_store_out->metal.texture.texture = (__bridge_retained FlutterMetalTextureHandle)texture;
+
+    backing_store_out->metal.texture.user_data = new PooledBackingStore{
+        .io_surface_holder = io_surface_holder,
+        .pool = surface_pool_,
+    };
   }
 
   backing_store_out->type = kFlutterBackingStoreTypeMetal;
   backing_store_out->metal.texture.destruction_callback = [](void* user_data) {
     if (user_data != nullptr) {
-      CFRelease(user_data);
+      auto* pooled_backing_store = reinterpret_cast<PooledBackingStore*>(user_data);
+      [pooled_backing_store->pool recycleSurface:pooled_backing_store->io_surface_holder];
+      delete pooled_backing_store;
     }
   };
 
@@ -99,9 +108,9 @@ bool FlutterMetalCompositor::Present(const FlutterLayer** layers, size_t layers_
     switch (layer->type) {
       case kFlutterLayerContentTypeBackingStore: {
         if (backing_store->metal.texture.user_data) {
-          FlutterIOSurfaceHolder* io_surface_holder =
-              (__bridge FlutterIOSurfaceHolder*)backing_store->metal.texture.user_data;
-          IOSurfaceRef io_surface = [io_surface_holder ioSurface];
+          auto* pooled_backing_store =
+              reinterpret_cast<PooledBackingStore*>(backing_store->metal.texture.user_data);
+          IOSurfaceRef io_surface = [pooled_backing_store->io_surface_holder ioSurface];
           InsertCALayerForIOSurface(view, io_surface);
         }
         has_flutter_content = true;
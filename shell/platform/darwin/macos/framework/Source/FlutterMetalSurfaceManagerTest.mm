@@ -5,6 +5,7 @@
 #import <Cocoa/Cocoa.h>
 #import <OCMock/OCMock.h>
 
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterIOSurfacePool.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterSurfaceManager.h"
 #include "flutter/testing/testing.h"
 #include "gtest/gtest.h"
@@ -61,4 +62,67 @@ TEST(FlutterMetalSurfaceManager, EnsureSizeUpdatesSizeForBackBuffer) {
   ASSERT_TRUE(CGSizeEqualToSize(size, textureSize));
 }
 
+TEST(FlutterMetalSurfaceManager, ReusesSurfacesWhenResizedBack) {
+  FlutterMetalSurfaceManager* surfaceManager = CreateSurfaceManager();
+  CGSize size = CGSizeMake(100, 50);
+  [surfaceManager ensureSurfaceSize:size];
+  NSMutableSet* ioSurfaces = [NSMutableSet set];
+  for (int i = 0; i < 2; ++i) {
+    id<MTLTexture> texture =
+        (reinterpret_cast<FlutterMetalRenderBackingStore*>([surfaceManager renderBuffer])).texture;
+    [ioSurfaces addObject:(__bridge id)texture.iosurface];
+    [surfaceManager swapBuffers];
+  }
+  ASSERT_EQ(ioSurfaces.count, 2u);
+
+  [surfaceManager ensureSurfaceSize:CGSizeMake(200, 100)];
+  [surfaceManager ensureSurfaceSize:size];
+  id<MTLTexture> texture =
+      (reinterpret_cast<FlutterMetalRenderBackingStore*>([surfaceManager renderBuffer])).texture;
+  EXPECT_TRUE([ioSurfaces containsObject:(__bridge id)texture.iosurface]);
+}
+
+TEST(FlutterIOSurfacePool, ReusesSurfacesOfTheSameSize) {
+  FlutterIOSurfacePool* pool = [[FlutterIOSurfacePool alloc] initWithCapacity:2];
+  FlutterIOSurfaceHolder* surface = [pool surfaceWithSize:CGSizeMake(100, 50)];
+  [pool recycleSurface:surface];
+  EXPECT_EQ(pool.pooledSurfaceCount, 1u);
+
+  EXPECT_EQ([pool surfaceWithSize:CGSizeMake(100, 50)], surface);
+  EXPECT_EQ(pool.pooledSurfaceCount, 0u);
+  EXPECT_EQ(pool.reuseCount, 1u);
+  EXPECT_EQ(pool.allocationCount, 1u);
+
+  [pool recycleSurface:surface];
+  EXPECT_NE([pool surfaceWithSize:CGSizeMake(200, 50)], surface);
+  EXPECT_EQ(pool.reuseCount, 1u);
+  EXPECT_EQ(pool.allocationCount, 2u);
+}
+
+TEST(FlutterIOSurfacePool, ReleasesTheLeastRecentlyRecycledSurfacesWhenFull) {
+  FlutterIOSurfacePool* pool = [[FlutterIOSurfacePool alloc] initWithCapacity:1];
+  FlutterIOSurfaceHolder* first = [pool surfaceWithSize:CGSizeMake(100, 50)];
+  FlutterIOSurfaceHolder* second = [pool surfaceWithSize:CGSizeMake(200, 50)];
+  [pool recycleSurface:first];
+  [pool recycleSurface:second];
+  EXPECT_EQ(pool.pooledSurfaceCount, 1u);
+
+  EXPECT_NE([pool surfaceWithSize:CGSizeMake(100, 50)], first);
+  EXPECT_EQ([pool surfaceWithSize:CGSizeMake(200, 50)], second);
+}
+
+TEST(FlutterIOSurfacePool, MarksPooledSurfacesAsVolatile) {
+  FlutterIOSurfacePool* pool = [[FlutterIOSurfacePool alloc] initWithCapacity:1];
+  FlutterIOSurfaceHolder* surface = [pool surfaceWithSize:CGSizeMake(100, 50)];
+  [pool recycleSurface:surface];
+
+  uint32_t state;
+  IOSurfaceSetPurgeable([surface ioSurface], kIOSurfacePurgeableKeepCurrent, &state);
+  EXPECT_EQ(state, static_cast<uint32_t>(kIOSurfacePurgeableVolatile));
+
+  [pool surfaceWithSize:CGSizeMake(100, 50)];
+  IOSurfaceSetPurgeable([surface ioSurface], kIOSurfacePurgeableKeepCurrent, &state);
+  EXPECT_EQ(state, static_cast<uint32_t>(kIOSurfacePurgeableNonVolatile));
+}
+
 }  // namespace flutter::testing
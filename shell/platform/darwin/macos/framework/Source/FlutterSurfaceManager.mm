@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterIOSurfaceHolder.h"
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterIOSurfacePool.h"
 
 enum {
   kFlutterSurfaceManagerFrontBuffer = 0,
@@ -26,6 +27,8 @@ static const double kIdleDelay = 1.0;
 
   CGSize _surfaceSize;
   FlutterIOSurfaceHolder* _ioSurfaces[kFlutterSurfaceManagerBufferCount];
+  // Keeps the surfaces of the previous sizes and the released back buffer around.
+  FlutterIOSurfacePool* _surfacePool;
   BOOL _frameInProgress;
 }
 
@@ -39,6 +42,8 @@ static const double kIdleDelay = 1.0;
 
     _ioSurfaces[0] = [[FlutterIOSurfaceHolder alloc] init];
     _ioSurfaces[1] = [[FlutterIOSurfaceHolder alloc] init];
+    _surfacePool =
+        [[FlutterIOSurfacePool alloc] initWithCapacity:kFlutterSurfaceManagerBufferCount];
   }
   return self;
 }
@@ -50,7 +55,8 @@ static const double kIdleDelay = 1.0;
   _surfaceSize = size;
   for (int i = 0; i < kFlutterSurfaceManagerBufferCount; ++i) {
     if (_ioSurfaces[i] != nil) {
-      [_ioSurfaces[i] recreateIOSurfaceWithSize:size];
+      [_surfacePool recycleSurface:_ioSurfaces[i]];
+      _ioSurfaces[i] = [_surfacePool surfaceWithSize:size];
       [_delegate onUpdateSurface:_ioSurfaces[i] bufferIndex:i size:size];
     }
   }
@@ -90,7 +96,8 @@ static const double kIdleDelay = 1.0;
   @synchronized(self) {
     if (!_frameInProgress) {
       // Release the back buffer and notify delegate. The buffer will be restored
-      // on demand in ensureBackBuffer
+      // on demand in ensureBackBuffer, from the pool unless the system purged it.
+      [_surfacePool recycleSurface:_ioSurfaces[kFlutterSurfaceManagerBackBuffer]];
       _ioSurfaces[kFlutterSurfaceManagerBackBuffer] = nil;
       [self.delegate onSurfaceReleased:kFlutterSurfaceManagerBackBuffer];
     }
@@ -102,8 +109,7 @@ static const double kIdleDelay = 1.0;
     _frameInProgress = YES;
     if (_ioSurfaces[kFlutterSurfaceManagerBackBuffer] == nil) {
       // Restore previously released backbuffer
-      _ioSurfaces[kFlutterSurfaceManagerBackBuffer] = [[FlutterIOSurfaceHolder alloc] init];
-      [_ioSurfaces[kFlutterSurfaceManagerBackBuffer] recreateIOSurfaceWithSize:_surfaceSize];
+      _ioSurfaces[kFlutterSurfaceManagerBackBuffer] = [_surfacePool surfaceWithSize:_surfaceSize];
       [_delegate onUpdateSurface:_ioSurfaces[kFlutterSurfaceManagerBackBuffer]
                      bufferIndex:kFlutterSurfaceManagerBackBuffer
                             size:_surfaceSize];
@@ -158,17 +164,7 @@ static const double kIdleDelay = 1.0;
 - (void)onUpdateSurface:(FlutterIOSurfaceHolder*)surface
             bufferIndex:(size_t)index
                    size:(CGSize)size {
-  MTLTextureDescriptor* textureDescriptor =
-      [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
-                                                         width:size.width
-                                                        height:size.height
-                                                     mipmapped:NO];
-  textureDescriptor.usage =
-      MTLTextureUsageShaderRead | MTLTextureUsageRenderTarget | MTLTextureUsageShaderWrite;
-  // plane = 0 for BGRA.
-  _textures[index] = [_device newTextureWithDescriptor:textureDescriptor
-                                             iosurface:[surface ioSurface]
-                                                 plane:0];
+  _textures[index] = [surface textureWithDevice:_device];
 }
 
 - (void)onSurfaceReleased:(size_t)index {
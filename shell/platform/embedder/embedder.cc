@@ -68,6 +68,10 @@ extern const intptr_t kPlatformStrongDillSize;
 #include "flutter/shell/platform/embedder/embedder_surface_metal.h"
 #endif
 
+#if defined(SHELL_ENABLE_VULKAN) && IMPELLER_ENABLE_VULKAN
+#include "flutter/shell/platform/embedder/embedder_surface_vulkan_impeller.h"
+#endif
+
 const int32_t kFlutterSemanticsNodeIdBatchEnd = -1;
 const int32_t kFlutterSemanticsCustomActionIdBatchEnd = -1;
 
@@ -233,6 +237,22 @@ static FlutterRect SkIRectToFlutterRect(const SkIRect sk_rect) {
   return flutter_rect;
 }
 
+// Auxiliary function used to translate a damage region, given as its bounds
+// and the rects that cover it, to FlutterRects.
+static std::vector<FlutterRect> ToFlutterRects(
+    const std::optional<SkIRect>& bounds,
+    const std::vector<SkIRect>& rects) {
+  std::vector<FlutterRect> flutter_rects;
+  if (!rects.empty()) {
+    for (const auto& rect : rects) {
+      flutter_rects.push_back(SkIRectToFlutterRect(rect));
+    }
+  } else if (bounds.has_value()) {
+    flutter_rects.push_back(SkIRectToFlutterRect(*bounds));
+  }
+  return flutter_rects;
+}
+
 // Auxiliary function used to translate rectangles of type FlutterRect to
 // SkIRect.
 static const SkIRect FlutterRectToSkIRect(FlutterRect flutter_rect) {
@@ -270,18 +290,13 @@ InferOpenGLPlatformViewCreationCallback(
     if (present) {
       return present(user_data);
     } else {
-      // Format the frame and buffer damages accordingly. Note that, since the
-      // current compute damage algorithm only returns one rectangle for damage
-      // we are assuming the number of rectangles provided in frame and buffer
-      // damage are always 1. Once the function that computes damage implements
-      // support for multiple damage rectangles, GLPresentInfo should also
-      // contain the number of damage rectangles.
-      const size_t num_rects = 1;
-
-      std::array<FlutterRect, num_rects> frame_damage_rect = {
-          SkIRectToFlutterRect(*(gl_present_info.frame_damage))};
-      std::array<FlutterRect, num_rects> buffer_damage_rect = {
-          SkIRectToFlutterRect(*(gl_present_info.buffer_damage))};
+      // Format the frame and buffer damages accordingly. The damage is
+      // passed as the rects that cover it when they are known, or as its
+      // bounds otherwise.
+      std::vector<FlutterRect> frame_damage_rect = ToFlutterRects(
+          gl_present_info.frame_damage, gl_present_info.frame_damage_rects);
+      std::vector<FlutterRect> buffer_damage_rect = ToFlutterRects(
+          gl_present_info.buffer_damage, gl_present_info.buffer_damage_rects);
 
       FlutterDamage frame_damage{
           .struct_size = sizeof(FlutterDamage),
@@ -300,6 +315,7 @@ InferOpenGLPlatformViewCreationCallback(
           .fbo_id = gl_present_info.fbo_id,
           .frame_damage = frame_damage,
           .buffer_damage = buffer_damage,
+          .frame_number = gl_present_info.frame_number,
       };
 
       return present_with_info(user_data, &present_info);
@@ -520,7 +536,8 @@ InferVulkanPlatformViewCreationCallback(
     const flutter::PlatformViewEmbedder::PlatformDispatchTable&
         platform_dispatch_table,
     std::unique_ptr<flutter::EmbedderExternalViewEmbedder>
-        external_view_embedder) {
+        external_view_embedder,
+    bool enable_impeller) {
   if (config->type != kVulkan) {
     return nullptr;
   }
@@ -570,18 +587,39 @@ InferVulkanPlatformViewCreationCallback(
   std::shared_ptr<flutter::EmbedderExternalViewEmbedder> view_embedder =
       std::move(external_view_embedder);
 
-  std::unique_ptr<flutter::EmbedderSurfaceVulkan> embedder_surface =
-      std::make_unique<flutter::EmbedderSurfaceVulkan>(
-          config->vulkan.version, vk_instance,
-          config->vulkan.enabled_instance_extension_count,
-          config->vulkan.enabled_instance_extensions,
-          config->vulkan.enabled_device_extension_count,
-          config->vulkan.enabled_device_extensions,
-          static_cast<VkPhysicalDevice>(config->vulkan.physical_device),
-          static_cast<VkDevice>(config->vulkan.device),
-          config->vulkan.queue_family_index,
-          static_cast<VkQueue>(config->vulkan.queue), vulkan_dispatch_table,
-          view_embedder);
+  std::unique_ptr<flutter::EmbedderSurface> embedder_surface;
+  if (enable_impeller) {
+#if IMPELLER_ENABLE_VULKAN
+    // Backing stores are still wrapped in Skia surfaces.
+    if (view_embedder) {
+      FML_LOG(ERROR) << "Impeller does not support rendering with Vulkan to "
+                        "the backing stores of a compositor yet.";
+      return nullptr;
+    }
+    embedder_surface =
+        std::make_unique<flutter::EmbedderSurfaceVulkanImpeller>(
+            config->vulkan.version, vk_instance,
+            static_cast<VkPhysicalDevice>(config->vulkan.physical_device),
+            static_cast<VkDevice>(config->vulkan.device),
+            config->vulkan.queue_family_index,
+            static_cast<VkQueue>(config->vulkan.queue), vulkan_dispatch_table);
+#else
+    FML_LOG(ERROR) << "This engine was built without Impeller Vulkan support.";
+    return nullptr;
+#endif  // IMPELLER_ENABLE_VULKAN
+  } else {
+    embedder_surface = std::make_unique<flutter::EmbedderSurfaceVulkan>(
+        config->vulkan.version, vk_instance,
+        config->vulkan.enabled_instance_extension_count,
+        config->vulkan.enabled_instance_extensions,
+        config->vulkan.enabled_device_extension_count,
+        config->vulkan.enabled_device_extensions,
+        static_cast<VkPhysicalDevice>(config->vulkan.physical_device),
+        static_cast<VkDevice>(config->vulkan.device),
+        config->vulkan.queue_family_index,
+        static_cast<VkQueue>(config->vulkan.queue), vulkan_dispatch_table,
+        view_embedder);
+  }
 
   return fml::MakeCopyable(
       [embedder_surface = std::move(embedder_surface), platform_dispatch_table,
@@ -644,7 +682,8 @@ InferPlatformViewCreationCallback(
     const flutter::PlatformViewEmbedder::PlatformDispatchTable&
         platform_dispatch_table,
     std::unique_ptr<flutter::EmbedderExternalViewEmbedder>
-        external_view_embedder) {
+        external_view_embedder,
+    bool enable_impeller) {
   if (config == nullptr) {
     return nullptr;
   }
@@ -665,7 +704,7 @@ InferPlatformViewCreationCallback(
     case kVulkan:
       return InferVulkanPlatformViewCreationCallback(
           config, user_data, platform_dispatch_table,
-          std::move(external_view_embedder));
+          std::move(external_view_embedder), enable_impeller);
     default:
       return nullptr;
   }
@@ -1041,6 +1080,10 @@ InferExternalViewEmbedderFromArgs(const FlutterCompositor* compositor) {
       SAFE_ACCESS(compositor, present_layers_callback, nullptr);
   bool avoid_backing_store_cache =
       SAFE_ACCESS(compositor, avoid_backing_store_cache, false);
+  bool pool_backing_stores =
+      SAFE_ACCESS(compositor, pool_backing_stores, false);
+  bool minimize_backing_stores =
+      SAFE_ACCESS(compositor, minimize_backing_stores, false);
 
   // Make sure the required callbacks are present
   if (!c_create_callback || !c_collect_callback || !c_present_callback) {
@@ -1067,7 +1110,8 @@ InferExternalViewEmbedderFromArgs(const FlutterCompositor* compositor) {
       };
 
   return {std::make_unique<flutter::EmbedderExternalViewEmbedder>(
-              avoid_backing_store_cache, create_render_target_callback,
+              avoid_backing_store_cache, pool_backing_stores,
+              minimize_backing_stores, create_render_target_callback,
               present_callback),
           false};
 }
@@ -1682,16 +1726,18 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
 
   flutter::PlatformViewEmbedder::PlatformDispatchTable platform_dispatch_table =
       {
-          update_semantics_callback,                  //
-          platform_message_response_callback,         //
-          vsync_callback,                             //
-          compute_platform_resolved_locale_callback,  //
-          on_pre_engine_restart_callback,             //
+          update_semantics_callback,                     //
+          platform_message_response_callback,            //
+          vsync_callback,                                //
+          compute_platform_resolved_locale_callback,     //
+          on_pre_engine_restart_callback,                //
+          SAFE_ACCESS(args, unthrottled_frames, false),  //
       };
 
   auto on_create_platform_view = InferPlatformViewCreationCallback(
       config, user_data, platform_dispatch_table,
-      std::move(external_view_embedder_result.first));
+      std::move(external_view_embedder_result.first),
+      settings.enable_impeller);
 
   if (!on_create_platform_view) {
     return LOG_EMBEDDER_ERROR(
@@ -1730,6 +1776,48 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
           std::make_unique<ExternalTextureResolver>(external_texture_callback);
     }
   }
+  flutter::EmbedderExternalTextureDmaBufGL::ExternalTextureCallback
+      external_texture_dma_buf_callback;
+  if (config->type == kOpenGL) {
+    const FlutterOpenGLRendererConfig* open_gl_config = &config->open_gl;
+    if (SAFE_ACCESS(open_gl_config, gl_external_dma_buf_texture_frame_callback,
+                    nullptr) != nullptr) {
+      if (external_texture_callback) {
+        return LOG_EMBEDDER_ERROR(
+            kInvalidArguments,
+            "Only one of gl_external_texture_frame_callback and "
+            "gl_external_dma_buf_texture_frame_callback may be specified.");
+      }
+      external_texture_dma_buf_callback =
+          [ptr = open_gl_config->gl_external_dma_buf_texture_frame_callback,
+           user_data](int64_t texture_identifier, size_t width, size_t height)
+          -> std::unique_ptr<FlutterOpenGLDmaBufTexture> {
+        std::unique_ptr<FlutterOpenGLDmaBufTexture> texture =
+            std::make_unique<FlutterOpenGLDmaBufTexture>();
+        texture->struct_size = sizeof(FlutterOpenGLDmaBufTexture);
+        if (!ptr(user_data, texture_identifier, width, height, texture.get())) {
+          return nullptr;
+        }
+        return texture;
+      };
+
+      std::function<void*(const char*)> gl_proc_resolver;
+      if (SAFE_ACCESS(open_gl_config, gl_proc_resolver, nullptr) != nullptr) {
+        gl_proc_resolver = [ptr = open_gl_config->gl_proc_resolver,
+                            user_data](const char* gl_proc_name) {
+          return ptr(user_data, gl_proc_name);
+        };
+      } else {
+#if FML_OS_LINUX || FML_OS_WIN
+        gl_proc_resolver = DefaultGLProcResolver;
+#endif
+      }
+      external_texture_resolver = std::make_unique<ExternalTextureResolver>(
+          external_texture_dma_buf_callback,
+          flutter::EmbedderExternalTextureDmaBufGL::Procs::Resolve(
+              gl_proc_resolver));
+    }
+  }
 #endif
 #ifdef SHELL_ENABLE_METAL
   flutter::EmbedderExternalTextureMetal::ExternalTextureCallback
@@ -1757,10 +1845,11 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
   auto custom_task_runners = SAFE_ACCESS(args, custom_task_runners, nullptr);
   auto thread_config_callback = [&custom_task_runners](
                                     const fml::Thread::ThreadConfig& config) {
-    fml::Thread::SetCurrentThreadName(config);
     if (!custom_task_runners || !custom_task_runners->thread_priority_setter) {
+      fml::Thread::SetCurrentThreadConfig(config);
       return;
     }
+    fml::Thread::SetCurrentThreadName(config);
     FlutterThreadPriority priority = FlutterThreadPriority::kNormal;
     switch (config.priority) {
       case fml::Thread::ThreadPriority::BACKGROUND:
@@ -1780,7 +1869,7 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
   };
   auto thread_host =
       flutter::EmbedderThreadHost::CreateEmbedderOrEngineManagedThreadHost(
-          custom_task_runners, thread_config_callback);
+          custom_task_runners, settings, thread_config_callback);
 
   if (!thread_host || !thread_host->IsValid()) {
     return LOG_EMBEDDER_ERROR(kInvalidArguments,
@@ -2922,6 +3011,72 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
   return kSuccess;
 }
 
+static FlutterFrameDurationPercentiles ToFlutterFrameDurationPercentiles(
+    const flutter::FrameDurationPercentiles& percentiles) {
+  return {
+      .p50 = static_cast<uint64_t>(percentiles.p50.ToMicroseconds()),
+      .p90 = static_cast<uint64_t>(percentiles.p90.ToMicroseconds()),
+      .p99 = static_cast<uint64_t>(percentiles.p99.ToMicroseconds()),
+      .max = static_cast<uint64_t>(percentiles.max.ToMicroseconds()),
+  };
+}
+
+FlutterEngineResult FlutterEngineGetFrameTimingStatistics(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    bool reset,
+    FlutterFrameTimingStatistics* statistics) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (statistics == nullptr || !STRUCT_HAS_MEMBER(statistics, raster_gpu)) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Invalid frame timing statistics specified.");
+  }
+
+  const flutter::FrameTimingStatistics engine_statistics =
+      reinterpret_cast<flutter::EmbedderEngine*>(engine)
+          ->GetShell()
+          .GetFrameTimingStatistics(reset);
+
+  statistics->frame_count = engine_statistics.frame_count;
+  statistics->vsync_overrun_count = engine_statistics.vsync_overrun_count;
+  statistics->build =
+      ToFlutterFrameDurationPercentiles(engine_statistics.build);
+  statistics->raster =
+      ToFlutterFrameDurationPercentiles(engine_statistics.raster);
+  statistics->raster_gpu =
+      ToFlutterFrameDurationPercentiles(engine_statistics.raster_gpu);
+  if (STRUCT_HAS_MEMBER(statistics, presentation_latency)) {
+    statistics->presented_frame_count = engine_statistics.presented_frame_count;
+    statistics->missed_presentation_count =
+        engine_statistics.missed_presentation_count;
+    statistics->presentation_latency = ToFlutterFrameDurationPercentiles(
+        engine_statistics.presentation_latency);
+  }
+  return kSuccess;
+}
+
+FlutterEngineResult FlutterEngineNotifyFramePresented(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterFramePresentedInfo* info) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (info == nullptr || !STRUCT_HAS_MEMBER(info, presentation_time_nanos)) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Invalid frame presented info specified.");
+  }
+
+  const auto presentation_time = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromNanoseconds(info->presentation_time_nanos));
+  reinterpret_cast<flutter::EmbedderEngine*>(engine)
+      ->GetShell()
+      .OnFramePresented(info->frame_number, presentation_time);
+  return kSuccess;
+}
+
 FlutterEngineResult FlutterEngineGetProcAddresses(
     FlutterEngineProcTable* table) {
   if (!table) {
@@ -2974,6 +3129,8 @@ FlutterEngineResult FlutterEngineGetProcAddresses(
   SET_PROC(NotifyDisplayUpdate, FlutterEngineNotifyDisplayUpdate);
   SET_PROC(ScheduleFrame, FlutterEngineScheduleFrame);
   SET_PROC(SetNextFrameCallback, FlutterEngineSetNextFrameCallback);
+  SET_PROC(GetFrameTimingStatistics, FlutterEngineGetFrameTimingStatistics);
+  SET_PROC(NotifyFramePresented, FlutterEngineNotifyFramePresented);
 #undef SET_PROC
 
   return kSuccess;
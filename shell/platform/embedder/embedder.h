@@ -363,8 +363,61 @@ typedef struct {
   size_t width;
   /// Height of the texture.
   size_t height;
+  /// Optional. Set to true if the texture is one of a fixed pool of textures
+  /// that the embedder cycles through for this external texture, for example
+  /// the output buffers of a video decoder. The engine then wraps every
+  /// texture of the pool only once and reuses it whenever the same texture is
+  /// handed out again, instead of wrapping each frame anew.
+  ///
+  /// The destruction callback of a pooled texture is invoked once the engine
+  /// has submitted all the commands that sample it and the next frame has
+  /// been resolved, at which point the embedder may write to it again. The
+  /// textures of the pool must stay alive until the external texture is
+  /// unregistered.
+  bool pooled;
 } FlutterOpenGLTexture;
 
+/// The maximum number of planes of a `FlutterOpenGLDmaBufTexture`.
+#define FLUTTER_DMA_BUF_MAX_PLANES 4
+
+/// A plane of a `FlutterOpenGLDmaBufTexture`.
+typedef struct {
+  /// The file descriptor of the dmabuf that holds the plane. The engine does
+  /// not take ownership of the file descriptor.
+  int32_t fd;
+  /// The offset of the plane in the dmabuf, in bytes.
+  uint32_t offset;
+  /// The stride of the plane, in bytes.
+  uint32_t stride;
+} FlutterDmaBufPlane;
+
+/// A Linux dmabuf that the engine samples from directly, for example a frame
+/// of a V4L2 or VA-API video decoder. It is imported as an EGL image through
+/// `EGL_EXT_image_dma_buf_import` without copying its contents.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterOpenGLDmaBufTexture).
+  size_t struct_size;
+  /// The width of the buffer, in pixels.
+  uint32_t width;
+  /// The height of the buffer, in pixels.
+  uint32_t height;
+  /// The DRM fourcc format of the buffer (example DRM_FORMAT_NV12).
+  uint32_t drm_format;
+  /// The DRM format modifier of the buffer. DRM_FORMAT_MOD_INVALID lets the
+  /// driver infer the layout of the buffer. Explicit modifiers require
+  /// `EGL_EXT_image_dma_buf_import_modifiers`.
+  uint64_t drm_format_modifier;
+  /// The number of planes of the buffer, at most FLUTTER_DMA_BUF_MAX_PLANES.
+  size_t plane_count;
+  /// The planes of the buffer. Only the first `plane_count` are read.
+  FlutterDmaBufPlane planes[FLUTTER_DMA_BUF_MAX_PLANES];
+  /// User data to be returned on the invocation of the destruction callback.
+  void* user_data;
+  /// Callback invoked (on an engine managed thread) once the engine no longer
+  /// samples from the buffer, at which point the embedder may reuse it.
+  VoidCallback destruction_callback;
+} FlutterOpenGLDmaBufTexture;
+
 typedef struct {
   /// The target of the color attachment of the frame-buffer. For example,
   /// GL_TEXTURE_2D or GL_RENDERBUFFER. In case of ambiguity when dealing with
@@ -395,6 +448,12 @@ typedef bool (*TextureFrameCallback)(void* /* user data */,
                                      size_t /* width */,
                                      size_t /* height */,
                                      FlutterOpenGLTexture* /* texture out */);
+typedef bool (*DmaBufTextureFrameCallback)(
+    void* /* user data */,
+    int64_t /* texture identifier */,
+    size_t /* width */,
+    size_t /* height */,
+    FlutterOpenGLDmaBufTexture* /* texture out */);
 typedef void (*VsyncCallback)(void* /* user data */, intptr_t /* baton */);
 typedef void (*OnPreEngineRestartCallback)(void* /* user data */);
 
@@ -480,6 +539,10 @@ typedef struct {
   FlutterDamage frame_damage;
   /// Damage used to set the buffer's damage region.
   FlutterDamage buffer_damage;
+  /// The number of the frame that is presented, or zero if it is not known.
+  /// Embedders that can tell when the frame is displayed pass this number
+  /// to `FlutterEngineNotifyFramePresented`.
+  uint64_t frame_number;
 } FlutterPresentInfo;
 
 /// Callback for when a surface is presented.
@@ -567,6 +630,17 @@ typedef struct {
   /// ID. Not specifying populate_existing_damage will result in full
   /// repaint (i.e. rendering all the pixels on the screen at every frame).
   FlutterFrameBufferWithDamageCallback populate_existing_damage;
+  /// An alternative to `gl_external_texture_frame_callback` for embedders on
+  /// Linux whose external textures are backed by dmabufs. The engine imports
+  /// the buffer as an EGL image and samples it as a GL_TEXTURE_EXTERNAL_OES
+  /// texture, so that YUV buffers are converted by the driver and no frame is
+  /// ever copied. Specifying both callbacks is an error and engine
+  /// initialization will be terminated.
+  ///
+  /// The `gl_proc_resolver` must resolve `eglGetCurrentDisplay`,
+  /// `eglCreateImageKHR`, `eglDestroyImageKHR` and
+  /// `glEGLImageTargetTexture2DOES` for the import to succeed.
+  DmaBufTextureFrameCallback gl_external_dma_buf_texture_frame_callback;
 } FlutterOpenGLRendererConfig;
 
 /// Alias for id<MTLDevice>.
@@ -762,12 +836,19 @@ typedef struct {
   FlutterVulkanInstanceProcAddressCallback get_instance_proc_address_callback;
   /// The callback invoked when the engine requests a VkImage from the embedder
   /// for rendering the next frame.
+  /// When the engine runs with Impeller (`--enable-impeller`), the image must
+  /// have the format VK_FORMAT_R8G8B8A8_UNORM. Impeller renders with the
+  /// instance, device and queue of this config and does not support a
+  /// FlutterCompositor yet.
   /// Not used if a FlutterCompositor is supplied in FlutterProjectArgs.
   FlutterVulkanImageCallback get_next_image_callback;
   /// The callback invoked when a VkImage has been written to and is ready for
   /// use by the embedder. Prior to calling this callback, the engine performs
   /// a host sync, and so the VkImage can be used in a pipeline by the embedder
   /// without any additional synchronization.
+  /// When the engine runs with `--max-pending-presents` greater than 0, this
+  /// callback is invoked on a dedicated present thread instead of the raster
+  /// thread, in the order in which the frames were rasterized.
   /// Not used if a FlutterCompositor is supplied in FlutterProjectArgs.
   FlutterVulkanPresentCallback present_image_callback;
 
@@ -1176,6 +1257,27 @@ typedef void (*FlutterTaskRunnerPostTaskCallback)(
     uint64_t /* target time nanos */,
     void* /* user data */);
 
+/// How important a task posted to an embedder task runner is. Embedders that
+/// run the engine inside a larger application loop may use this to keep the
+/// work that frames wait for from waiting behind their own backlog.
+typedef enum {
+  /// The engine has no hint about the importance of the task.
+  kFlutterTaskPriorityDefault,
+  /// The task is critical to user interaction. Frames or input events are
+  /// waiting for it, for example the task that draws a frame on the raster
+  /// thread or the task that begins a frame on the UI thread.
+  kFlutterTaskPriorityUserInteraction,
+  /// The task is not critical to user interaction and may wait behind other
+  /// work, for example the task that services Dart microtasks.
+  kFlutterTaskPriorityBackground,
+} FlutterTaskPriority;
+
+typedef void (*FlutterTaskRunnerPostTaskWithPriorityCallback)(
+    FlutterTask /* task */,
+    uint64_t /* target time nanos */,
+    FlutterTaskPriority /* priority */,
+    void* /* user data */);
+
 /// An interface used by the Flutter engine to execute tasks at the target time
 /// on a specified thread. There should be a 1-1 relationship between a thread
 /// and a task runner. It is undefined behavior to run a task on a thread that
@@ -1203,6 +1305,12 @@ typedef struct {
   /// A unique identifier for the task runner. If multiple task runners service
   /// tasks on the same thread, their identifiers must match.
   size_t identifier;
+  /// Optional. If specified, the engine posts tasks through this callback
+  /// instead of `post_task_callback`, with a hint of how important each task
+  /// is. `post_task_callback` must still be specified for engines that
+  /// predate this callback.
+  FlutterTaskRunnerPostTaskWithPriorityCallback
+      post_task_with_priority_callback;
 } FlutterTaskRunnerDescription;
 
 typedef struct {
@@ -1469,6 +1577,25 @@ typedef struct {
   FlutterLayersPresentCallback present_layers_callback;
   /// Avoid caching backing stores provided by this compositor.
   bool avoid_backing_store_cache;
+  /// Allow the engine to request backing stores that are larger than the
+  /// layers rendered into them. Backing store sizes are then rounded up to a
+  /// few size classes and backing stores are reused across layers and kept
+  /// for a few frames, so that resizing the window or adding and removing
+  /// platform views does not create and collect backing stores every frame.
+  /// The contents of a layer are rendered into the top left of its backing
+  /// store, and only the top left `FlutterLayer.size` of the backing store
+  /// must be composited. Ignored if `avoid_backing_store_cache` is set.
+  bool pool_backing_stores;
+  /// Render the Flutter contents above a platform view that do not overlap
+  /// any platform view below them into the backing store of the first layer,
+  /// and only request backing stores that cover the rest. The Flutter layers
+  /// above platform views may then be smaller than the frame, in which case
+  /// `FlutterLayer.offset` and `FlutterLayer.size` tell where they must be
+  /// composited, and they are omitted if none of their contents overlap a
+  /// platform view. This saves the compositor from compositing many full
+  /// screen layers when, for example, a list scrolls past a few small
+  /// platform views.
+  bool minimize_backing_stores;
 } FlutterCompositor;
 
 typedef struct {
@@ -1541,6 +1668,58 @@ typedef enum {
   kFlutterEngineDisplaysUpdateTypeCount,
 } FlutterEngineDisplaysUpdateType;
 
+/// The distribution of a frame duration over a number of frames, in
+/// microseconds.
+typedef struct {
+  uint64_t p50;
+  uint64_t p90;
+  uint64_t p99;
+  uint64_t max;
+} FlutterFrameDurationPercentiles;
+
+/// Aggregated timings of the frames that were rasterized since the statistics
+/// were last reset. See `FlutterEngineGetFrameTimingStatistics`.
+typedef struct {
+  /// This size of this struct. Must be sizeof(FlutterFrameTimingStatistics).
+  size_t struct_size;
+  /// The number of frames that were rasterized.
+  uint64_t frame_count;
+  /// The number of frames that took longer than the frame budget from the
+  /// start of their vsync to the end of their rasterization.
+  uint64_t vsync_overrun_count;
+  /// The time spent building the frames on the UI thread.
+  FlutterFrameDurationPercentiles build;
+  /// The time spent rasterizing the frames on the raster thread.
+  FlutterFrameDurationPercentiles raster;
+  /// The GPU time of the frames. This only includes the frames for which the
+  /// renderer was able to measure the GPU time.
+  FlutterFrameDurationPercentiles raster_gpu;
+  /// The number of frames whose presentation was reported with
+  /// `FlutterEngineNotifyFramePresented`.
+  uint64_t presented_frame_count;
+  /// The number of presented frames that were displayed later than the
+  /// refresh that follows the end of their vsync interval.
+  uint64_t missed_presentation_count;
+  /// The time from the start of the vsync of the presented frames to their
+  /// presentation.
+  FlutterFrameDurationPercentiles presentation_latency;
+} FlutterFrameTimingStatistics;
+
+/// Describes when a frame was displayed. See
+/// `FlutterEngineNotifyFramePresented`.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterFramePresentedInfo).
+  size_t struct_size;
+  /// The number of the frame, as passed to the embedder in
+  /// `FlutterPresentInfo`.
+  uint64_t frame_number;
+  /// The time at which the frame started to be displayed, in the timebase of
+  /// `FlutterEngineGetCurrentTime`. This is for example the actual present
+  /// time reported by `VK_GOOGLE_display_timing` or the output time of a
+  /// `CVDisplayLink`.
+  uint64_t presentation_time_nanos;
+} FlutterFramePresentedInfo;
+
 typedef int64_t FlutterEngineDartPort;
 
 typedef enum {
@@ -1932,6 +2111,17 @@ typedef struct {
   /// If this callback is provided, update_semantics_node_callback and
   /// update_semantics_custom_action_callback must not be provided.
   FlutterUpdateSemanticsCallback update_semantics_callback;
+
+  /// Whether the engine produces frames as fast as it can instead of at the
+  /// rate of a display. This is meant for headless embedders, for example to
+  /// render frames on a server or to measure the throughput of the engine.
+  ///
+  /// When set and no `vsync_callback` is specified, the engine begins each
+  /// frame as soon as the previous one has been built. Frames are still given
+  /// a 60Hz budget so that `FlutterEngineGetFrameTimingStatistics` counts the
+  /// frames that would have missed a vsync. This is ignored if a
+  /// `vsync_callback` is specified.
+  bool unthrottled_frames;
 } FlutterProjectArgs;
 
 #ifndef FLUTTER_ENGINE_NO_PROTOTYPES
@@ -2625,6 +2815,46 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
     VoidCallback callback,
     void* user_data);
 
+//------------------------------------------------------------------------------
+/// @brief      Gets the percentiles of the build, raster and GPU times and the
+///             number of vsync overruns of the frames rasterized since the
+///             statistics were last reset. This allows embedders to monitor
+///             jank without receiving the timings of every frame. This can be
+///             called from any thread.
+///
+/// @param[in]  engine      A running engine instance.
+/// @param[in]  reset       Whether the statistics should be reset once read.
+/// @param[out] statistics  The statistics. Its struct_size must be set.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineGetFrameTimingStatistics(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    bool reset,
+    FlutterFrameTimingStatistics* statistics);
+
+//------------------------------------------------------------------------------
+/// @brief      Reports when a frame was displayed. The engine measures the
+///             latency of the frame from the start of its vsync, counts it
+///             in `FlutterFrameTimingStatistics`, and realigns its prediction
+///             of the vsync phase to the presentation time. This can be
+///             called from any thread.
+///
+///             Only the most recently rasterized frames are matched to their
+///             presentation, embedders should report each presentation as
+///             soon as it is known.
+///
+/// @param[in]  engine  A running engine instance.
+/// @param[in]  info    The presentation of the frame.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineNotifyFramePresented(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterFramePresentedInfo* info);
+
 #endif  // !FLUTTER_ENGINE_NO_PROTOTYPES
 
 // Typedefs for the function pointers in FlutterEngineProcTable.
@@ -2747,6 +2977,13 @@ typedef FlutterEngineResult (*FlutterEngineSetNextFrameCallbackFnPtr)(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     VoidCallback callback,
     void* user_data);
+typedef FlutterEngineResult (*FlutterEngineGetFrameTimingStatisticsFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    bool reset,
+    FlutterFrameTimingStatistics* statistics);
+typedef FlutterEngineResult (*FlutterEngineNotifyFramePresentedFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterFramePresentedInfo* info);
 
 /// Function-pointer-based versions of the APIs above.
 typedef struct {
@@ -2793,6 +3030,8 @@ typedef struct {
   FlutterEngineNotifyDisplayUpdateFnPtr NotifyDisplayUpdate;
   FlutterEngineScheduleFrameFnPtr ScheduleFrame;
   FlutterEngineSetNextFrameCallbackFnPtr SetNextFrameCallback;
+  FlutterEngineGetFrameTimingStatisticsFnPtr GetFrameTimingStatistics;
+  FlutterEngineNotifyFramePresentedFnPtr NotifyFramePresented;
 } FlutterEngineProcTable;
 
 //------------------------------------------------------------------------------
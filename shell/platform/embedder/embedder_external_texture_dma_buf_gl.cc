@@ -0,0 +1,268 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/embedder_external_texture_dma_buf_gl.h"
+
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/logging.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "third_party/skia/include/core/SkPaint.h"
+#include "third_party/skia/include/gpu/GrBackendSurface.h"
+#include "third_party/skia/include/gpu/GrDirectContext.h"
+
+namespace flutter {
+
+// From EGL/egl.h and EGL/eglext.h, which are not available on every platform
+// the embedder builds for.
+static constexpr int32_t kEGLNone = 0x3038;
+static constexpr int32_t kEGLWidth = 0x3057;
+static constexpr int32_t kEGLHeight = 0x3056;
+static constexpr uint32_t kEGLLinuxDmaBuf = 0x3270;
+static constexpr int32_t kEGLLinuxDrmFourcc = 0x3271;
+
+// From GLES2/gl2.h and GLES2/gl2ext.h.
+static constexpr uint32_t kGLTextureExternal = 0x8D65;
+static constexpr uint32_t kGLTextureMinFilter = 0x2801;
+static constexpr uint32_t kGLTextureMagFilter = 0x2800;
+static constexpr int32_t kGLLinear = 0x2601;
+static constexpr uint32_t kGLRGBA8 = 0x8058;
+
+// From drm_fourcc.h.
+static constexpr uint64_t kDrmFormatModInvalid = 0x00ffffffffffffffull;
+
+struct DmaBufPlaneAttributes {
+  int32_t fd;
+  int32_t offset;
+  int32_t pitch;
+  int32_t modifier_lo;
+  int32_t modifier_hi;
+};
+
+static constexpr DmaBufPlaneAttributes
+    kPlaneAttributes[FLUTTER_DMA_BUF_MAX_PLANES] = {
+        {0x3272, 0x3273, 0x3274, 0x3443, 0x3444},
+        {0x3275, 0x3276, 0x3277, 0x3445, 0x3446},
+        {0x3278, 0x3279, 0x327A, 0x3447, 0x3448},
+        {0x3440, 0x3441, 0x3442, 0x3449, 0x344A},
+};
+
+// The resources of an imported buffer. They are collected when Skia releases
+// the image that wraps the texture.
+struct ImportedDmaBuf {
+  EmbedderExternalTextureDmaBufGL::Procs procs;
+  void* display = nullptr;
+  void* image = nullptr;
+  uint32_t texture = 0;
+  void* user_data = nullptr;
+  VoidCallback destruction_callback = nullptr;
+
+  ~ImportedDmaBuf() {
+    if (texture != 0) {
+      procs.delete_textures(1, &texture);
+    }
+    if (image != nullptr) {
+      procs.destroy_image(display, image);
+    }
+    if (destruction_callback) {
+      destruction_callback(user_data);
+    }
+  }
+};
+
+static void ReleaseImportedDmaBuf(void* context) {
+  delete reinterpret_cast<ImportedDmaBuf*>(context);
+}
+
+EmbedderExternalTextureDmaBufGL::Procs
+EmbedderExternalTextureDmaBufGL::Procs::Resolve(
+    const std::function<void*(const char*)>& resolver) {
+  Procs procs;
+  if (!resolver) {
+    return procs;
+  }
+  procs.get_current_display = reinterpret_cast<GetCurrentDisplayProc>(
+      resolver("eglGetCurrentDisplay"));
+  procs.create_image =
+      reinterpret_cast<CreateImageProc>(resolver("eglCreateImageKHR"));
+  procs.destroy_image =
+      reinterpret_cast<DestroyImageProc>(resolver("eglDestroyImageKHR"));
+  procs.image_target_texture_2d = reinterpret_cast<ImageTargetTexture2DProc>(
+      resolver("glEGLImageTargetTexture2DOES"));
+  procs.gen_textures =
+      reinterpret_cast<GenTexturesProc>(resolver("glGenTextures"));
+  procs.bind_texture =
+      reinterpret_cast<BindTextureProc>(resolver("glBindTexture"));
+  procs.tex_parameteri =
+      reinterpret_cast<TexParameteriProc>(resolver("glTexParameteri"));
+  procs.delete_textures =
+      reinterpret_cast<DeleteTexturesProc>(resolver("glDeleteTextures"));
+  return procs;
+}
+
+bool EmbedderExternalTextureDmaBufGL::Procs::IsValid() const {
+  return get_current_display && create_image && destroy_image &&
+         image_target_texture_2d && gen_textures && bind_texture &&
+         tex_parameteri && delete_textures;
+}
+
+EmbedderExternalTextureDmaBufGL::EmbedderExternalTextureDmaBufGL(
+    int64_t texture_identifier,
+    const ExternalTextureCallback& callback,
+    const Procs& procs)
+    : Texture(texture_identifier),
+      external_texture_callback_(callback),
+      procs_(procs) {
+  FML_DCHECK(external_texture_callback_);
+}
+
+EmbedderExternalTextureDmaBufGL::~EmbedderExternalTextureDmaBufGL() = default;
+
+// |flutter::Texture|
+void EmbedderExternalTextureDmaBufGL::Paint(PaintContext& context,
+                                            const SkRect& bounds,
+                                            bool freeze,
+                                            const SkSamplingOptions& sampling) {
+  if (last_image_ == nullptr) {
+    last_image_ =
+        ResolveTexture(Id(),                                           //
+                       context.gr_context,                             //
+                       SkISize::Make(bounds.width(), bounds.height())  //
+        );
+  }
+
+  SkCanvas& canvas = *context.canvas;
+  const SkPaint* paint = context.sk_paint;
+
+  if (last_image_) {
+    if (bounds != SkRect::Make(last_image_->bounds())) {
+      canvas.drawImageRect(last_image_, bounds, sampling, paint);
+    } else {
+      canvas.drawImage(last_image_, bounds.x(), bounds.y(), sampling, paint);
+    }
+  }
+}
+
+sk_sp<SkImage> EmbedderExternalTextureDmaBufGL::ResolveTexture(
+    int64_t texture_id,
+    GrDirectContext* context,
+    const SkISize& size) {
+  if (!procs_.IsValid()) {
+    FML_LOG(ERROR) << "The EGL and GL procs required to import dmabufs could "
+                      "not be resolved.";
+    return nullptr;
+  }
+
+  context->flushAndSubmit();
+  std::unique_ptr<FlutterOpenGLDmaBufTexture> buffer =
+      external_texture_callback_(texture_id, size.width(), size.height());
+  if (!buffer) {
+    return nullptr;
+  }
+
+  // Collects the buffer on every path below, including failed imports.
+  auto imported = std::make_unique<ImportedDmaBuf>();
+  imported->procs = procs_;
+  imported->user_data = buffer->user_data;
+  imported->destruction_callback = buffer->destruction_callback;
+
+  if (buffer->plane_count == 0 ||
+      buffer->plane_count > FLUTTER_DMA_BUF_MAX_PLANES) {
+    FML_LOG(ERROR) << "Invalid number of dmabuf planes: "
+                   << buffer->plane_count;
+    return nullptr;
+  }
+
+  std::vector<int32_t> attributes = {
+      kEGLWidth,          static_cast<int32_t>(buffer->width),
+      kEGLHeight,         static_cast<int32_t>(buffer->height),
+      kEGLLinuxDrmFourcc, static_cast<int32_t>(buffer->drm_format),
+  };
+  for (size_t i = 0; i < buffer->plane_count; i++) {
+    const FlutterDmaBufPlane& plane = buffer->planes[i];
+    const DmaBufPlaneAttributes& keys = kPlaneAttributes[i];
+    attributes.insert(attributes.end(),
+                      {
+                          keys.fd,
+                          plane.fd,
+                          keys.offset,
+                          static_cast<int32_t>(plane.offset),
+                          keys.pitch,
+                          static_cast<int32_t>(plane.stride),
+                      });
+    if (buffer->drm_format_modifier != kDrmFormatModInvalid) {
+      attributes.insert(
+          attributes.end(),
+          {
+              keys.modifier_lo,
+              static_cast<int32_t>(buffer->drm_format_modifier & 0xffffffff),
+              keys.modifier_hi,
+              static_cast<int32_t>(buffer->drm_format_modifier >> 32),
+          });
+    }
+  }
+  attributes.push_back(kEGLNone);
+
+  imported->display = procs_.get_current_display();
+  // Buffers from EGL_LINUX_DMA_BUF_EXT must be imported without a context.
+  imported->image = procs_.create_image(imported->display, nullptr,
+                                        kEGLLinuxDmaBuf, nullptr,
+                                        attributes.data());
+  if (imported->image == nullptr) {
+    FML_LOG(ERROR) << "Could not import the dmabuf as an EGL image.";
+    return nullptr;
+  }
+
+  procs_.gen_textures(1, &imported->texture);
+  procs_.bind_texture(kGLTextureExternal, imported->texture);
+  procs_.tex_parameteri(kGLTextureExternal, kGLTextureMinFilter, kGLLinear);
+  procs_.tex_parameteri(kGLTextureExternal, kGLTextureMagFilter, kGLLinear);
+  procs_.image_target_texture_2d(kGLTextureExternal, imported->image);
+  procs_.bind_texture(kGLTextureExternal, 0);
+  context->resetContext(kAll_GrBackendState);
+
+  GrGLTextureInfo gr_texture_info = {kGLTextureExternal, imported->texture,
+                                     kGLRGBA8};
+  GrBackendTexture gr_backend_texture(buffer->width, buffer->height,
+                                      GrMipMapped::kNo, gr_texture_info);
+  // Skia invokes the release proc if it rejects the texture as well.
+  ImportedDmaBuf* release_context = imported.release();
+  auto image =
+      SkImage::MakeFromTexture(context,                   // context
+                               gr_backend_texture,        // texture handle
+                               kTopLeft_GrSurfaceOrigin,  // origin
+                               kRGBA_8888_SkColorType,    // color type
+                               kPremul_SkAlphaType,       // alpha type
+                               nullptr,                   // colorspace
+                               ReleaseImportedDmaBuf,  // texture release proc
+                               release_context  // texture release context
+      );
+  if (!image) {
+    FML_LOG(ERROR) << "Could not create external texture from the dmabuf.";
+    return nullptr;
+  }
+
+  return image;
+}
+
+// |flutter::Texture|
+void EmbedderExternalTextureDmaBufGL::OnGrContextCreated() {}
+
+// |flutter::Texture|
+void EmbedderExternalTextureDmaBufGL::OnGrContextDestroyed() {
+  last_image_ = nullptr;
+}
+
+// |flutter::Texture|
+void EmbedderExternalTextureDmaBufGL::MarkNewFrameAvailable() {
+  last_image_ = nullptr;
+}
+
+// |flutter::Texture|
+void EmbedderExternalTextureDmaBufGL::OnTextureUnregistered() {
+  last_image_ = nullptr;
+}
+
+}  // namespace flutter
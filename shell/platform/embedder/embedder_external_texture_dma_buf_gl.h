@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_DMA_BUF_GL_H_
+#define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_DMA_BUF_GL_H_
+
+#include <functional>
+#include <memory>
+
+#include "flutter/common/graphics/texture.h"
+#include "flutter/fml/macros.h"
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/core/SkSize.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      An external texture whose frames are Linux dmabufs. Each frame
+///             is imported as an EGL image and bound to a
+///             GL_TEXTURE_EXTERNAL_OES texture, which Skia samples from
+///             directly.
+///
+class EmbedderExternalTextureDmaBufGL : public flutter::Texture {
+ public:
+  using ExternalTextureCallback =
+      std::function<std::unique_ptr<FlutterOpenGLDmaBufTexture>(int64_t,
+                                                                size_t,
+                                                                size_t)>;
+
+  // The EGL and GL entry points used to import the buffers. The EGL types are
+  // spelled out so that this header does not depend on the EGL headers.
+  struct Procs {
+    using GetCurrentDisplayProc = void* (*)();
+    using CreateImageProc = void* (*)(void* display,
+                                      void* context,
+                                      uint32_t target,
+                                      void* buffer,
+                                      const int32_t* attributes);
+    using DestroyImageProc = uint32_t (*)(void* display, void* image);
+    using ImageTargetTexture2DProc = void (*)(uint32_t target, void* image);
+    using GenTexturesProc = void (*)(int32_t count, uint32_t* textures);
+    using BindTextureProc = void (*)(uint32_t target, uint32_t texture);
+    using TexParameteriProc = void (*)(uint32_t target,
+                                       uint32_t name,
+                                       int32_t value);
+    using DeleteTexturesProc = void (*)(int32_t count,
+                                        const uint32_t* textures);
+
+    GetCurrentDisplayProc get_current_display = nullptr;
+    CreateImageProc create_image = nullptr;
+    DestroyImageProc destroy_image = nullptr;
+    ImageTargetTexture2DProc image_target_texture_2d = nullptr;
+    GenTexturesProc gen_textures = nullptr;
+    BindTextureProc bind_texture = nullptr;
+    TexParameteriProc tex_parameteri = nullptr;
+    DeleteTexturesProc delete_textures = nullptr;
+
+    static Procs Resolve(const std::function<void*(const char*)>& resolver);
+
+    bool IsValid() const;
+  };
+
+  EmbedderExternalTextureDmaBufGL(int64_t texture_identifier,
+                                  const ExternalTextureCallback& callback,
+                                  const Procs& procs);
+
+  ~EmbedderExternalTextureDmaBufGL();
+
+ private:
+  const ExternalTextureCallback& external_texture_callback_;
+  const Procs procs_;
+  sk_sp<SkImage> last_image_;
+
+  sk_sp<SkImage> ResolveTexture(int64_t texture_id,
+                                GrDirectContext* context,
+                                const SkISize& size);
+
+  // |flutter::Texture|
+  void Paint(PaintContext& context,
+             const SkRect& bounds,
+             bool freeze,
+             const SkSamplingOptions& sampling) override;
+
+  // |flutter::Texture|
+  void OnGrContextCreated() override;
+
+  // |flutter::Texture|
+  void OnGrContextDestroyed() override;
+
+  // |flutter::Texture|
+  void MarkNewFrameAvailable() override;
+
+  // |flutter::Texture|
+  void OnTextureUnregistered() override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(EmbedderExternalTextureDmaBufGL);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_DMA_BUF_GL_H_
@@ -4,6 +4,8 @@
 
 #include "flutter/shell/platform/embedder/embedder_external_texture_gl.h"
 
+#include <utility>
+
 #include "flutter/fml/logging.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkPaint.h"
@@ -17,6 +19,18 @@
 
 namespace flutter {
 
+// The number of wrapped textures that are kept for pooled external textures.
+// Decoders usually cycle through a handful of output buffers.
+static constexpr size_t kMaxPooledImages = 8;
+
+static SkISize GetTextureSize(const FlutterOpenGLTexture& texture,
+                              const SkISize& size) {
+  if (texture.width != 0 && texture.height != 0) {
+    return SkISize::Make(texture.width, texture.height);
+  }
+  return size;
+}
+
 EmbedderExternalTextureGL::EmbedderExternalTextureGL(
     int64_t texture_identifier,
     const ExternalTextureCallback& callback)
@@ -24,7 +38,9 @@ EmbedderExternalTextureGL::EmbedderExternalTextureGL(
   FML_DCHECK(external_texture_callback_);
 }
 
-EmbedderExternalTextureGL::~EmbedderExternalTextureGL() = default;
+EmbedderExternalTextureGL::~EmbedderExternalTextureGL() {
+  ReleasePooledTextureInUse();
+}
 
 // |flutter::Texture|
 void EmbedderExternalTextureGL::Paint(PaintContext& context,
@@ -57,6 +73,9 @@ sk_sp<SkImage> EmbedderExternalTextureGL::ResolveTexture(
     const SkISize& size) {
   context->flushAndSubmit();
   context->resetContext(kAll_GrBackendState);
+  // The commands that sampled the previous pooled texture have all been
+  // submitted now, so the embedder may write to it again.
+  ReleasePooledTextureInUse();
   std::unique_ptr<FlutterOpenGLTexture> texture =
       external_texture_callback_(texture_id, size.width(), size.height());
 
@@ -64,20 +83,28 @@ sk_sp<SkImage> EmbedderExternalTextureGL::ResolveTexture(
     return nullptr;
   }
 
-  GrGLTextureInfo gr_texture_info = {texture->target, texture->name,
-                                     texture->format};
+  if (texture->pooled) {
+    return ResolvePooledTexture(context, std::move(texture), size);
+  }
 
-  size_t width = size.width();
-  size_t height = size.height();
+  return WrapTexture(context, *texture, size, true);
+}
 
-  if (texture->width != 0 && texture->height != 0) {
-    width = texture->width;
-    height = texture->height;
-  }
+sk_sp<SkImage> EmbedderExternalTextureGL::WrapTexture(
+    GrDirectContext* context,
+    const FlutterOpenGLTexture& texture,
+    const SkISize& size,
+    bool release_with_image) {
+  GrGLTextureInfo gr_texture_info = {texture.target, texture.name,
+                                     texture.format};
 
-  GrBackendTexture gr_backend_texture(width, height, GrMipMapped::kNo,
+  const SkISize texture_size = GetTextureSize(texture, size);
+
+  GrBackendTexture gr_backend_texture(texture_size.width(),
+                                      texture_size.height(), GrMipMapped::kNo,
                                       gr_texture_info);
-  SkImage::TextureReleaseProc release_proc = texture->destruction_callback;
+  SkImage::TextureReleaseProc release_proc =
+      release_with_image ? texture.destruction_callback : nullptr;
   auto image =
       SkImage::MakeFromTexture(context,                   // context
                                gr_backend_texture,        // texture handle
@@ -85,15 +112,15 @@ sk_sp<SkImage> EmbedderExternalTextureGL::ResolveTexture(
                                kRGBA_8888_SkColorType,    // color type
                                kPremul_SkAlphaType,       // alpha type
                                nullptr,                   // colorspace
-                               release_proc,       // texture release proc
-                               texture->user_data  // texture release context
+                               release_proc,      // texture release proc
+                               texture.user_data  // texture release context
       );
 
   if (!image) {
     // In case Skia rejects the image, call the release proc so that
     // embedders can perform collection of intermediates.
     if (release_proc) {
-      release_proc(texture->user_data);
+      release_proc(texture.user_data);
     }
     FML_LOG(ERROR) << "Could not create external texture->";
     return nullptr;
@@ -102,11 +129,61 @@ sk_sp<SkImage> EmbedderExternalTextureGL::ResolveTexture(
   return image;
 }
 
+sk_sp<SkImage> EmbedderExternalTextureGL::ResolvePooledTexture(
+    GrDirectContext* context,
+    std::unique_ptr<FlutterOpenGLTexture> texture,
+    const SkISize& size) {
+  const SkISize texture_size = GetTextureSize(*texture, size);
+
+  sk_sp<SkImage> image;
+  for (const PooledImage& pooled : image_pool_) {
+    if (pooled.target == texture->target && pooled.name == texture->name &&
+        pooled.format == texture->format && pooled.size == texture_size) {
+      image = pooled.image;
+      break;
+    }
+  }
+
+  if (!image) {
+    // The pool owns the texture, so the image must not collect it.
+    image = WrapTexture(context, *texture, size, false);
+    if (image) {
+      if (image_pool_.size() == kMaxPooledImages) {
+        image_pool_.erase(image_pool_.begin());
+      }
+      image_pool_.push_back({
+          .target = texture->target,
+          .name = texture->name,
+          .format = texture->format,
+          .size = texture_size,
+          .image = image,
+      });
+    }
+  }
+
+  pooled_texture_in_use_ = std::move(texture);
+  return image;
+}
+
+void EmbedderExternalTextureGL::ReleasePooledTextureInUse() {
+  if (!pooled_texture_in_use_) {
+    return;
+  }
+  if (pooled_texture_in_use_->destruction_callback) {
+    pooled_texture_in_use_->destruction_callback(
+        pooled_texture_in_use_->user_data);
+  }
+  pooled_texture_in_use_.reset();
+}
+
 // |flutter::Texture|
 void EmbedderExternalTextureGL::OnGrContextCreated() {}
 
 // |flutter::Texture|
-void EmbedderExternalTextureGL::OnGrContextDestroyed() {}
+void EmbedderExternalTextureGL::OnGrContextDestroyed() {
+  // The pooled images belong to the context that is going away.
+  image_pool_.clear();
+}
 
 // |flutter::Texture|
 void EmbedderExternalTextureGL::MarkNewFrameAvailable() {
@@ -114,6 +191,9 @@ void EmbedderExternalTextureGL::MarkNewFrameAvailable() {
 }
 
 // |flutter::Texture|
-void EmbedderExternalTextureGL::OnTextureUnregistered() {}
+void EmbedderExternalTextureGL::OnTextureUnregistered() {
+  image_pool_.clear();
+  ReleasePooledTextureInUse();
+}
 
 }  // namespace flutter
@@ -5,6 +5,9 @@
 #ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_GL_H_
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_TEXTURE_GL_H_
 
+#include <memory>
+#include <vector>
+
 #include "flutter/common/graphics/texture.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/embedder/embedder.h"
@@ -24,13 +27,39 @@ class EmbedderExternalTextureGL : public flutter::Texture {
   ~EmbedderExternalTextureGL();
 
  private:
+  // A texture of the embedder's pool together with the image that wraps it.
+  struct PooledImage {
+    uint32_t target;
+    uint32_t name;
+    uint32_t format;
+    SkISize size;
+    sk_sp<SkImage> image;
+  };
+
   const ExternalTextureCallback& external_texture_callback_;
   sk_sp<SkImage> last_image_;
+  // The images that wrap the pooled textures handed out so far, oldest first.
+  std::vector<PooledImage> image_pool_;
+  // The last pooled texture that was handed out. The embedder is told that it
+  // is free again once the next frame has been resolved.
+  std::unique_ptr<FlutterOpenGLTexture> pooled_texture_in_use_;
 
   sk_sp<SkImage> ResolveTexture(int64_t texture_id,
                                 GrDirectContext* context,
                                 const SkISize& size);
 
+  sk_sp<SkImage> WrapTexture(GrDirectContext* context,
+                             const FlutterOpenGLTexture& texture,
+                             const SkISize& size,
+                             bool release_with_image);
+
+  sk_sp<SkImage> ResolvePooledTexture(
+      GrDirectContext* context,
+      std::unique_ptr<FlutterOpenGLTexture> texture,
+      const SkISize& size);
+
+  void ReleasePooledTextureInUse();
+
   // |flutter::Texture|
   void Paint(PaintContext& context,
              const SkRect& bounds,
@@ -13,6 +13,13 @@ namespace flutter {
 EmbedderExternalTextureResolver::EmbedderExternalTextureResolver(
     EmbedderExternalTextureGL::ExternalTextureCallback gl_callback)
     : gl_callback_(std::move(gl_callback)) {}
+
+EmbedderExternalTextureResolver::EmbedderExternalTextureResolver(
+    EmbedderExternalTextureDmaBufGL::ExternalTextureCallback
+        gl_dma_buf_callback,
+    const EmbedderExternalTextureDmaBufGL::Procs& gl_dma_buf_procs)
+    : gl_dma_buf_callback_(std::move(gl_dma_buf_callback)),
+      gl_dma_buf_procs_(gl_dma_buf_procs) {}
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -28,6 +35,11 @@ EmbedderExternalTextureResolver::ResolveExternalTexture(int64_t texture_id) {
     return std::make_unique<EmbedderExternalTextureGL>(texture_id,
                                                        gl_callback_);
   }
+
+  if (gl_dma_buf_callback_) {
+    return std::make_unique<EmbedderExternalTextureDmaBufGL>(
+        texture_id, gl_dma_buf_callback_, gl_dma_buf_procs_);
+  }
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -42,7 +54,7 @@ EmbedderExternalTextureResolver::ResolveExternalTexture(int64_t texture_id) {
 
 bool EmbedderExternalTextureResolver::SupportsExternalTextures() {
 #ifdef SHELL_ENABLE_GL
-  if (gl_callback_) {
+  if (gl_callback_ || gl_dma_buf_callback_) {
     return true;
   }
 #endif
@@ -10,6 +10,7 @@
 #include "flutter/common/graphics/texture.h"
 
 #ifdef SHELL_ENABLE_GL
+#include "flutter/shell/platform/embedder/embedder_external_texture_dma_buf_gl.h"
 #include "flutter/shell/platform/embedder/embedder_external_texture_gl.h"
 #endif
 
@@ -27,6 +28,11 @@ class EmbedderExternalTextureResolver {
 #ifdef SHELL_ENABLE_GL
   explicit EmbedderExternalTextureResolver(
       EmbedderExternalTextureGL::ExternalTextureCallback gl_callback);
+
+  EmbedderExternalTextureResolver(
+      EmbedderExternalTextureDmaBufGL::ExternalTextureCallback
+          gl_dma_buf_callback,
+      const EmbedderExternalTextureDmaBufGL::Procs& gl_dma_buf_procs);
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -41,6 +47,8 @@ class EmbedderExternalTextureResolver {
  private:
 #ifdef SHELL_ENABLE_GL
   EmbedderExternalTextureGL::ExternalTextureCallback gl_callback_;
+  EmbedderExternalTextureDmaBufGL::ExternalTextureCallback gl_dma_buf_callback_;
+  EmbedderExternalTextureDmaBufGL::Procs gl_dma_buf_procs_;
 #endif
 
 #ifdef SHELL_ENABLE_METAL
@@ -15,6 +15,11 @@ static SkISize TransformedSurfaceSize(const SkISize& size,
   return SkISize::Make(transformed_rect.width(), transformed_rect.height());
 }
 
+static SkIRect TransformedRegion(const SkIRect& region,
+                                 const SkMatrix& transformation) {
+  return transformation.mapRect(SkRect::Make(region)).roundOut();
+}
+
 EmbedderExternalView::EmbedderExternalView(
     const SkISize& frame_size,
     const SkMatrix& surface_transformation)
@@ -25,14 +30,18 @@ EmbedderExternalView::EmbedderExternalView(
     const SkMatrix& surface_transformation,
     ViewIdentifier view_identifier,
     std::unique_ptr<EmbeddedViewParams> params)
-    : render_surface_size_(
+    : surface_transformation_(surface_transformation),
+      render_surface_size_(
           TransformedSurfaceSize(frame_size, surface_transformation)),
-      surface_transformation_(surface_transformation),
       view_identifier_(view_identifier),
       embedded_view_params_(std::move(params)),
-      recorder_(std::make_unique<SkPictureRecorder>()),
-      canvas_spy_(std::make_unique<CanvasSpy>(
-          recorder_->beginRecording(frame_size.width(), frame_size.height()))) {
+      recorder_(std::make_unique<SkPictureRecorder>()) {
+  // The R-tree tells which parts of the frame the contents are drawn into, so
+  // that the render target of the view can be restricted to them.
+  RTreeFactory rtree_factory;
+  canvas_spy_ = std::make_unique<CanvasSpy>(
+      recorder_->beginRecording(SkRect::Make(frame_size), &rtree_factory));
+  rtree_ = rtree_factory.getInstance();
 }
 
 EmbedderExternalView::~EmbedderExternalView() = default;
@@ -59,6 +68,12 @@ bool EmbedderExternalView::HasPlatformView() const {
 }
 
 bool EmbedderExternalView::HasEngineRenderedContents() const {
+  if (!merged_contents_.empty()) {
+    return true;
+  }
+  if (render_region_.has_value() && render_region_->isEmpty()) {
+    return false;
+  }
   return canvas_spy_->DidDrawIntoCanvas();
 }
 
@@ -71,6 +86,36 @@ const EmbeddedViewParams* EmbedderExternalView::GetEmbeddedViewParams() const {
   return embedded_view_params_.get();
 }
 
+const sk_sp<SkPicture>& EmbedderExternalView::GetPicture() {
+  if (!picture_) {
+    picture_ = recorder_->finishRecordingAsPicture();
+  }
+  return picture_;
+}
+
+std::list<SkRect> EmbedderExternalView::GetDrawnRectsIntersecting(
+    const SkRect& query) {
+  // The R-tree is only populated once the recording is finished.
+  GetPicture();
+  return rtree_->searchNonOverlappingDrawnRects(query);
+}
+
+void EmbedderExternalView::SetRenderRegion(const SkIRect& region) {
+  render_region_ = region;
+  render_surface_size_ =
+      TransformedRegion(region, surface_transformation_).size();
+}
+
+const std::optional<SkIRect>& EmbedderExternalView::GetRenderRegion() const {
+  return render_region_;
+}
+
+void EmbedderExternalView::MergeContentsOutsideRenderRegion(
+    EmbedderExternalView& view) {
+  FML_DCHECK(view.render_region_.has_value());
+  merged_contents_.push_back({view.GetPicture(), *view.render_region_});
+}
+
 bool EmbedderExternalView::Render(const EmbedderRenderTarget& render_target) {
   TRACE_EVENT0("flutter", "EmbedderExternalView::Render");
 
@@ -78,7 +123,7 @@ bool EmbedderExternalView::Render(const EmbedderRenderTarget& render_target) {
       << "Unnecessarily asked to render into a render target when there was "
          "nothing to render.";
 
-  auto picture = recorder_->finishRecordingAsPicture();
+  const auto& picture = GetPicture();
   if (!picture) {
     return false;
   }
@@ -88,17 +133,35 @@ bool EmbedderExternalView::Render(const EmbedderRenderTarget& render_target) {
     return false;
   }
 
-  FML_DCHECK(SkISize::Make(surface->width(), surface->height()) ==
-             render_surface_size_);
+  // Pooled render targets may be larger than the surface. The surface is then
+  // rendered into their top left.
+  FML_DCHECK(surface->width() >= render_surface_size_.width() &&
+             surface->height() >= render_surface_size_.height());
 
   auto canvas = surface->getCanvas();
   if (!canvas) {
     return false;
   }
 
-  canvas->setMatrix(surface_transformation_);
+  // The canvas of a render target is reused across frames, so the clip must
+  // not outlive this frame.
+  SkAutoCanvasRestore auto_restore(canvas, true);
+  canvas->clipRect(SkRect::Make(render_surface_size_));
+  SkMatrix matrix = surface_transformation_;
+  if (render_region_.has_value()) {
+    // The render target only covers the render region of the frame.
+    const auto surface_region =
+        TransformedRegion(*render_region_, surface_transformation_);
+    matrix.postTranslate(-surface_region.x(), -surface_region.y());
+  }
+  canvas->setMatrix(matrix);
   canvas->clear(SK_ColorTRANSPARENT);
   canvas->drawPicture(picture);
+  for (const auto& merged : merged_contents_) {
+    SkAutoCanvasRestore merged_restore(canvas, true);
+    canvas->clipIRect(merged.excluded_region, SkClipOp::kDifference);
+    canvas->drawPicture(merged.picture);
+  }
   canvas->flush();
 
   return true;
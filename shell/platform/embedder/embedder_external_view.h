@@ -5,11 +5,14 @@
 #ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_VIEW_H_
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_EXTERNAL_VIEW_H_
 
+#include <list>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "flutter/flow/embedded_views.h"
+#include "flutter/flow/rtree.h"
 #include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/common/canvas_spy.h"
@@ -109,15 +112,57 @@ class EmbedderExternalView {
 
   SkISize GetRenderSurfaceSize() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Finds the bounds of the engine rendered contents that
+  ///             intersect `query`, in the coordinates of the frame. This
+  ///             finishes the recording of the contents, so the canvas of the
+  ///             view may no longer be drawn into.
+  ///
+  std::list<SkRect> GetDrawnRectsIntersecting(const SkRect& query);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Restricts the render target of this view to `region` of the
+  ///             frame. The contents outside the region are not rendered into
+  ///             it and must be merged into the root view instead. An empty
+  ///             region leaves the view without engine rendered contents.
+  ///
+  void SetRenderRegion(const SkIRect& region);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The region of the frame covered by the render target of this
+  ///             view, or `std::nullopt` if it covers the whole frame.
+  ///
+  const std::optional<SkIRect>& GetRenderRegion() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Renders the contents of `view` that are outside its render
+  ///             region into the render target of this view as well, on top
+  ///             of the contents of this view and the views merged before it.
+  ///
+  void MergeContentsOutsideRenderRegion(EmbedderExternalView& view);
+
   bool Render(const EmbedderRenderTarget& render_target);
 
  private:
-  const SkISize render_surface_size_;
+  // The contents of another view rendered into this one, except for the
+  // region that has a render target of its own.
+  struct MergedContents {
+    sk_sp<SkPicture> picture;
+    SkIRect excluded_region;
+  };
+
   const SkMatrix surface_transformation_;
+  SkISize render_surface_size_;
   ViewIdentifier view_identifier_;
   std::unique_ptr<EmbeddedViewParams> embedded_view_params_;
   std::unique_ptr<SkPictureRecorder> recorder_;
   std::unique_ptr<CanvasSpy> canvas_spy_;
+  sk_sp<RTree> rtree_;
+  sk_sp<SkPicture> picture_;
+  std::optional<SkIRect> render_region_;
+  std::vector<MergedContents> merged_contents_;
+
+  const sk_sp<SkPicture>& GetPicture();
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderExternalView);
 };
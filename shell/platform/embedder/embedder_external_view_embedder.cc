@@ -15,11 +15,15 @@ namespace flutter {
 
 EmbedderExternalViewEmbedder::EmbedderExternalViewEmbedder(
     bool avoid_backing_store_cache,
+    bool pool_backing_stores,
+    bool minimize_backing_stores,
     const CreateRenderTargetCallback& create_render_target_callback,
     const PresentCallback& present_callback)
     : avoid_backing_store_cache_(avoid_backing_store_cache),
+      minimize_backing_stores_(minimize_backing_stores),
       create_render_target_callback_(create_render_target_callback),
-      present_callback_(present_callback) {
+      present_callback_(present_callback),
+      render_target_cache_(pool_backing_stores && !avoid_backing_store_cache) {
   FML_DCHECK(create_render_target_callback_);
   FML_DCHECK(present_callback_);
 }
@@ -142,10 +146,64 @@ static FlutterBackingStoreConfig MakeBackingStoreConfig(
   return config;
 }
 
+// Restricts the render targets of the views above platform views to the parts
+// of the frame where their contents overlap a platform view or the render
+// target of an earlier view, as the iOS platform views controller does. All
+// other contents are rendered into the root view instead, which places them
+// below every platform view. That is indistinguishable from the composition
+// order because those contents do not overlap anything they would end up
+// below.
+void EmbedderExternalViewEmbedder::MinimizeRenderRegions() {
+  auto& root_view = pending_views_.at(EmbedderExternalView::ViewIdentifier{});
+  const auto frame_rect = SkRect::Make(pending_frame_size_);
+
+  // The rects the contents of the next view must not be moved below.
+  std::vector<SkRect> occupied_rects;
+  for (const auto& view_id : composition_order_) {
+    const auto& external_view = pending_views_.at(view_id);
+    if (!external_view->HasPlatformView()) {
+      continue;
+    }
+    occupied_rects.push_back(
+        external_view->GetEmbeddedViewParams()->finalBoundingRect());
+    if (!external_view->HasEngineRenderedContents()) {
+      continue;
+    }
+
+    SkRect region = SkRect::MakeEmpty();
+    for (const auto& occupied_rect : occupied_rects) {
+      for (auto rect :
+           external_view->GetDrawnRectsIntersecting(occupied_rect)) {
+        if (rect.intersect(occupied_rect)) {
+          region.join(rect);
+        }
+      }
+    }
+    const auto render_region = region.roundOut();
+    external_view->SetRenderRegion(render_region);
+    if (!render_region.isEmpty()) {
+      occupied_rects.push_back(SkRect::Make(render_region));
+    }
+
+    SkRect drawn_bounds = SkRect::MakeEmpty();
+    for (const auto& rect :
+         external_view->GetDrawnRectsIntersecting(frame_rect)) {
+      drawn_bounds.join(rect);
+    }
+    if (!SkRect::Make(render_region).contains(drawn_bounds)) {
+      root_view->MergeContentsOutsideRenderRegion(*external_view);
+    }
+  }
+}
+
 // |ExternalViewEmbedder|
 void EmbedderExternalViewEmbedder::SubmitFrame(
     GrDirectContext* context,
     std::unique_ptr<SurfaceFrame> frame) {
+  if (minimize_backing_stores_) {
+    MinimizeRenderRegions();
+  }
+
   auto [matched_render_targets, pending_keys] =
       render_target_cache_.GetExistingTargetsInCache(pending_views_);
 
@@ -162,7 +220,7 @@ void EmbedderExternalViewEmbedder::SubmitFrame(
   //
   // @warning: Embedder may trample on our OpenGL context here.
   auto deferred_cleanup_render_targets =
-      render_target_cache_.ClearAllRenderTargetsInCache();
+      render_target_cache_.CollectUnusedRenderTargets();
 
   for (const auto& pending_key : pending_keys) {
     const auto& external_view = pending_views_.at(pending_key);
@@ -180,11 +238,12 @@ void EmbedderExternalViewEmbedder::SubmitFrame(
     // post transformation. But, in case optimizations are applied that make
     // it so that embedder rendered into surfaces that aren't full screen,
     // this assumption will break. So it's just best to ask view for its size
-    // directly.
+    // directly. If render targets are pooled, the render target may be
+    // larger than the surface.
     const auto render_surface_size = external_view->GetRenderSurfaceSize();
 
-    const auto backing_store_config =
-        MakeBackingStoreConfig(render_surface_size);
+    const auto backing_store_config = MakeBackingStoreConfig(
+        render_target_cache_.GetRenderTargetSize(render_surface_size));
 
     // This is where the embedder will create render targets for us. Control
     // flow to the embedder makes the engine susceptible to having the embedder
@@ -256,7 +315,9 @@ void EmbedderExternalViewEmbedder::SubmitFrame(
       if (external_view->HasEngineRenderedContents()) {
         const auto& exteral_render_target = matched_render_targets.at(view_id);
         presented_layers.PushBackingStoreLayer(
-            exteral_render_target->GetBackingStore());
+            exteral_render_target->GetBackingStore(),
+            external_view->GetRenderRegion().value_or(
+                SkIRect::MakeSize(pending_frame_size_)));
       }
     }
 
@@ -271,8 +332,8 @@ void EmbedderExternalViewEmbedder::SubmitFrame(
   // @warning: Embedder may trample on our OpenGL context here.
   deferred_cleanup_render_targets.clear();
 
-  // Hold all rendered layers in the render target cache for one frame to
-  // see if they may be reused next frame.
+  // Hold all rendered layers in the render target cache to see if they may be
+  // reused in the next frames.
   for (auto& render_target : matched_render_targets) {
     if (!avoid_backing_store_cache_) {
       render_target_cache_.CacheRenderTarget(render_target.first,
@@ -44,6 +44,19 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
   ///                                      will beinvoked every frame for every
   ///                                      engine composited layer. The result
   ///                                      will not cached.
+  /// @param[in] pool_backing_stores       If set, render targets are created
+  ///                                      at the size class of their layers
+  ///                                      and pooled across views and frames.
+  ///                                      Layers are rendered into the top
+  ///                                      left of render targets that are
+  ///                                      larger than them. Ignored if
+  ///                                      `avoid_backing_store_cache` is set.
+  /// @param[in] minimize_backing_stores   If set, the contents of the layers
+  ///                                      above platform views that do not
+  ///                                      overlap a platform view below them
+  ///                                      are rendered into the root layer,
+  ///                                      and the render targets of those
+  ///                                      layers only cover the rest.
   ///
   /// @param[in]  create_render_target_callback
   ///                                     The render target callback used to
@@ -55,6 +68,8 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
   ///
   EmbedderExternalViewEmbedder(
       bool avoid_backing_store_cache,
+      bool pool_backing_stores,
+      bool minimize_backing_stores,
       const CreateRenderTargetCallback& create_render_target_callback,
       const PresentCallback& present_callback);
 
@@ -108,6 +123,7 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
 
  private:
   const bool avoid_backing_store_cache_;
+  const bool minimize_backing_stores_;
   const CreateRenderTargetCallback create_render_target_callback_;
   const PresentCallback present_callback_;
   SurfaceTransformationCallback surface_transformation_callback_;
@@ -122,6 +138,8 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
 
   SkMatrix GetSurfaceTransformation() const;
 
+  void MinimizeRenderRegions();
+
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderExternalViewEmbedder);
 };
 
@@ -0,0 +1,137 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/embedder_external_view_embedder.h"
+
+#include "flutter/testing/testing.h"
+#include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+namespace testing {
+namespace {
+
+constexpr SkColor kRootColor = SK_ColorRED;
+constexpr SkColor kOverlayColor = SK_ColorBLUE;
+
+// Records the layers that are presented and the surfaces of the render
+// targets they are backed by, in the order they were created.
+struct PresentedFrame {
+  std::vector<FlutterLayer> layers;
+  std::vector<sk_sp<SkSurface>> surfaces;
+};
+
+std::unique_ptr<EmbedderExternalViewEmbedder> CreateViewEmbedder(
+    bool minimize_backing_stores,
+    PresentedFrame& presented) {
+  return std::make_unique<EmbedderExternalViewEmbedder>(
+      /*avoid_backing_store_cache=*/true,
+      /*pool_backing_stores=*/false, minimize_backing_stores,
+      [&presented](GrDirectContext* context,
+                   const FlutterBackingStoreConfig& config) {
+        auto surface = SkSurface::MakeRasterN32Premul(config.size.width,
+                                                      config.size.height);
+        presented.surfaces.push_back(surface);
+        return std::make_unique<EmbedderRenderTarget>(FlutterBackingStore{},
+                                                      surface, nullptr);
+      },
+      [&presented](const std::vector<const FlutterLayer*>& layers) {
+        for (const auto* layer : layers) {
+          presented.layers.push_back(*layer);
+        }
+        return true;
+      });
+}
+
+// Renders a frame that fills the root view and draws `overlay_rect` above a
+// platform view at (100, 100) with a size of 100x100.
+void RenderFrame(ExternalViewEmbedder& view_embedder,
+                 const SkRect& overlay_rect) {
+  view_embedder.BeginFrame(SkISize::Make(800, 600), nullptr, 1.0, nullptr);
+  view_embedder.GetRootCanvas()->drawColor(kRootColor);
+  view_embedder.PrerollCompositeEmbeddedView(
+      1, std::make_unique<EmbeddedViewParams>(SkMatrix::Translate(100, 100),
+                                              SkSize::Make(100, 100),
+                                              MutatorsStack()));
+  SkPaint paint;
+  paint.setColor(kOverlayColor);
+  view_embedder.CompositeEmbeddedView(1).canvas->drawRect(overlay_rect, paint);
+  view_embedder.SubmitFrame(
+      nullptr, std::make_unique<SurfaceFrame>(
+                   nullptr, SurfaceFrame::FramebufferInfo{},
+                   [](const SurfaceFrame&, SkCanvas*) { return true; },
+                   SkISize::Make(800, 600)));
+}
+
+SkColor GetPixel(const sk_sp<SkSurface>& surface, int x, int y) {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(1, 1);
+  EXPECT_TRUE(surface->readPixels(bitmap, x, y));
+  return bitmap.getColor(0, 0);
+}
+
+}  // namespace
+
+TEST(EmbedderExternalViewEmbedderTest, LayersCoverTheFrameByDefault) {
+  PresentedFrame presented;
+  auto view_embedder = CreateViewEmbedder(false, presented);
+  RenderFrame(*view_embedder, SkRect::MakeXYWH(400, 400, 50, 50));
+
+  ASSERT_EQ(presented.layers.size(), 3u);
+  EXPECT_EQ(presented.layers[0].type, kFlutterLayerContentTypeBackingStore);
+  EXPECT_EQ(presented.layers[1].type, kFlutterLayerContentTypePlatformView);
+  EXPECT_EQ(presented.layers[2].type, kFlutterLayerContentTypeBackingStore);
+  EXPECT_EQ(presented.layers[2].offset.x, 0);
+  EXPECT_EQ(presented.layers[2].offset.y, 0);
+  EXPECT_EQ(presented.layers[2].size.width, 800);
+  EXPECT_EQ(presented.layers[2].size.height, 600);
+}
+
+TEST(EmbedderExternalViewEmbedderTest,
+     ContentsThatDoNotOverlapPlatformViewsAreMergedIntoTheRootLayer) {
+  PresentedFrame presented;
+  auto view_embedder = CreateViewEmbedder(true, presented);
+  RenderFrame(*view_embedder, SkRect::MakeXYWH(400, 400, 50, 50));
+
+  ASSERT_EQ(presented.layers.size(), 2u);
+  EXPECT_EQ(presented.layers[0].type, kFlutterLayerContentTypeBackingStore);
+  EXPECT_EQ(presented.layers[1].type, kFlutterLayerContentTypePlatformView);
+
+  ASSERT_EQ(presented.surfaces.size(), 1u);
+  EXPECT_EQ(GetPixel(presented.surfaces[0], 10, 10), kRootColor);
+  EXPECT_EQ(GetPixel(presented.surfaces[0], 420, 420), kOverlayColor);
+}
+
+TEST(EmbedderExternalViewEmbedderTest,
+     LayersAbovePlatformViewsOnlyCoverTheOverlappingContents) {
+  PresentedFrame presented;
+  auto view_embedder = CreateViewEmbedder(true, presented);
+  RenderFrame(*view_embedder, SkRect::MakeXYWH(150, 150, 300, 300));
+
+  ASSERT_EQ(presented.layers.size(), 3u);
+  EXPECT_EQ(presented.layers[0].type, kFlutterLayerContentTypeBackingStore);
+  EXPECT_EQ(presented.layers[1].type, kFlutterLayerContentTypePlatformView);
+  EXPECT_EQ(presented.layers[2].type, kFlutterLayerContentTypeBackingStore);
+  EXPECT_EQ(presented.layers[2].offset.x, 150);
+  EXPECT_EQ(presented.layers[2].offset.y, 150);
+  EXPECT_EQ(presented.layers[2].size.width, 50);
+  EXPECT_EQ(presented.layers[2].size.height, 50);
+
+  ASSERT_EQ(presented.surfaces.size(), 2u);
+  // The root layer has the contents outside the platform view, and the layer
+  // above the platform view has the rest.
+  const auto& root_surface =
+      presented.surfaces[0]->width() == 800 ? presented.surfaces[0]
+                                            : presented.surfaces[1];
+  const auto& overlay_surface =
+      presented.surfaces[0]->width() == 800 ? presented.surfaces[1]
+                                            : presented.surfaces[0];
+  EXPECT_EQ(GetPixel(root_surface, 175, 175), kRootColor);
+  EXPECT_EQ(GetPixel(root_surface, 300, 300), kOverlayColor);
+  EXPECT_EQ(GetPixel(overlay_surface, 25, 25), kOverlayColor);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -18,17 +18,19 @@ EmbedderLayers::EmbedderLayers(SkISize frame_size,
 EmbedderLayers::~EmbedderLayers() = default;
 
 void EmbedderLayers::PushBackingStoreLayer(const FlutterBackingStore* store) {
+  PushBackingStoreLayer(store, SkIRect::MakeSize(frame_size_));
+}
+
+void EmbedderLayers::PushBackingStoreLayer(const FlutterBackingStore* store,
+                                           const SkIRect& layer_bounds) {
   FlutterLayer layer = {};
 
   layer.struct_size = sizeof(FlutterLayer);
   layer.type = kFlutterLayerContentTypeBackingStore;
   layer.backing_store = store;
 
-  const auto layer_bounds =
-      SkRect::MakeWH(frame_size_.width(), frame_size_.height());
-
   const auto transformed_layer_bounds =
-      root_surface_transformation_.mapRect(layer_bounds);
+      root_surface_transformation_.mapRect(SkRect::Make(layer_bounds));
 
   layer.offset.x = transformed_layer_bounds.x();
   layer.offset.y = transformed_layer_bounds.y();
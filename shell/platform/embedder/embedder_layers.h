@@ -26,6 +26,10 @@ class EmbedderLayers {
 
   void PushBackingStoreLayer(const FlutterBackingStore* store);
 
+  // Pushes a backing store that only covers `layer_bounds` of the frame.
+  void PushBackingStoreLayer(const FlutterBackingStore* store,
+                             const SkIRect& layer_bounds);
+
   void PushPlatformViewLayer(FlutterPlatformViewIdentifier identifier,
                              const EmbeddedViewParams& params);
 
@@ -4,12 +4,44 @@
 
 #include "flutter/shell/platform/embedder/embedder_render_target_cache.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace flutter {
 
-EmbedderRenderTargetCache::EmbedderRenderTargetCache() = default;
+static constexpr int32_t kMinSizeClassGranularity = 64;
+
+static int32_t RoundUpToSizeClass(int32_t length) {
+  if (length <= 0) {
+    return length;
+  }
+  uint32_t next_power_of_two = 1;
+  while (next_power_of_two < static_cast<uint32_t>(length)) {
+    next_power_of_two <<= 1;
+  }
+  const int64_t granularity = std::max<int64_t>(kMinSizeClassGranularity,
+                                                next_power_of_two / 16);
+  const int64_t rounded =
+      (length + granularity - 1) / granularity * granularity;
+  return static_cast<int32_t>(
+      std::min<int64_t>(rounded, std::numeric_limits<int32_t>::max()));
+}
+
+EmbedderRenderTargetCache::EmbedderRenderTargetCache(bool pool_by_size_class)
+    : pool_by_size_class_(pool_by_size_class) {}
 
 EmbedderRenderTargetCache::~EmbedderRenderTargetCache() = default;
 
+SkISize EmbedderRenderTargetCache::GetSizeClass(const SkISize& surface_size) {
+  return SkISize::Make(RoundUpToSizeClass(surface_size.width()),
+                       RoundUpToSizeClass(surface_size.height()));
+}
+
+SkISize EmbedderRenderTargetCache::GetRenderTargetSize(
+    const SkISize& surface_size) const {
+  return pool_by_size_class_ ? GetSizeClass(surface_size) : surface_size;
+}
+
 std::pair<EmbedderRenderTargetCache::RenderTargets,
           EmbedderExternalView::ViewIdentifierSet>
 EmbedderRenderTargetCache::GetExistingTargetsInCache(
@@ -22,15 +54,21 @@ EmbedderRenderTargetCache::GetExistingTargetsInCache(
     if (!external_view->HasEngineRenderedContents()) {
       continue;
     }
-    auto& compatible_targets =
-        cached_render_targets_[external_view->CreateRenderTargetDescriptor()];
-    if (compatible_targets.empty()) {
+    // Pooled targets are shared by all views and only keyed by size class.
+    const auto descriptor =
+        pool_by_size_class_
+            ? EmbedderExternalView::RenderTargetDescriptor{
+                  EmbedderExternalView::ViewIdentifier{},
+                  GetSizeClass(external_view->GetRenderSurfaceSize())}
+            : external_view->CreateRenderTargetDescriptor();
+    auto found = cached_render_targets_.find(descriptor);
+    if (found == cached_render_targets_.end() || found->second.empty()) {
       unmatched_identifiers.insert(view.first);
     } else {
-      std::unique_ptr<EmbedderRenderTarget> target =
-          std::move(compatible_targets.top());
-      compatible_targets.pop();
-      resolved_render_targets[view.first] = std::move(target);
+      auto& compatible_targets = found->second;
+      resolved_render_targets[view.first] =
+          std::move(compatible_targets.back().target);
+      compatible_targets.pop_back();
     }
   }
   return {std::move(resolved_render_targets), std::move(unmatched_identifiers)};
@@ -40,16 +78,42 @@ std::set<std::unique_ptr<EmbedderRenderTarget>>
 EmbedderRenderTargetCache::ClearAllRenderTargetsInCache() {
   std::set<std::unique_ptr<EmbedderRenderTarget>> cleared_targets;
   for (auto& targets : cached_render_targets_) {
-    auto& targets_stack = targets.second;
-    while (!targets_stack.empty()) {
-      cleared_targets.emplace(std::move(targets_stack.top()));
-      targets_stack.pop();
+    for (auto& cached_target : targets.second) {
+      cleared_targets.emplace(std::move(cached_target.target));
     }
   }
   cached_render_targets_.clear();
   return cleared_targets;
 }
 
+std::set<std::unique_ptr<EmbedderRenderTarget>>
+EmbedderRenderTargetCache::CollectUnusedRenderTargets() {
+  if (!pool_by_size_class_) {
+    return ClearAllRenderTargetsInCache();
+  }
+
+  std::set<std::unique_ptr<EmbedderRenderTarget>> collected_targets;
+  for (auto it = cached_render_targets_.begin();
+       it != cached_render_targets_.end();) {
+    auto& targets = it->second;
+    auto expired = std::remove_if(
+        targets.begin(), targets.end(), [&](CachedRenderTarget& cached) {
+          if (++cached.unused_frame_count <= kMaxUnusedFrameCount) {
+            return false;
+          }
+          collected_targets.emplace(std::move(cached.target));
+          return true;
+        });
+    targets.erase(expired, targets.end());
+    if (targets.empty()) {
+      it = cached_render_targets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return collected_targets;
+}
+
 void EmbedderRenderTargetCache::CacheRenderTarget(
     EmbedderExternalView::ViewIdentifier view_identifier,
     std::unique_ptr<EmbedderRenderTarget> target) {
@@ -58,8 +122,10 @@ void EmbedderRenderTargetCache::CacheRenderTarget(
   }
   auto surface = target->GetRenderSurface();
   auto desc = EmbedderExternalView::RenderTargetDescriptor{
-      view_identifier, SkISize::Make(surface->width(), surface->height())};
-  cached_render_targets_[desc].push(std::move(target));
+      pool_by_size_class_ ? EmbedderExternalView::ViewIdentifier{}
+                          : view_identifier,
+      SkISize::Make(surface->width(), surface->height())};
+  cached_render_targets_[desc].push_back({std::move(target)});
 }
 
 size_t EmbedderRenderTargetCache::GetCachedTargetsCount() const {
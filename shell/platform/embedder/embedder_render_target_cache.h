@@ -6,9 +6,9 @@
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_RENDER_TARGET_CACHE_H_
 
 #include <set>
-#include <stack>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/embedder/embedder_external_view.h"
@@ -21,7 +21,25 @@ namespace flutter {
 ///
 class EmbedderRenderTargetCache {
  public:
-  EmbedderRenderTargetCache();
+  /// The number of frames a pooled render target may go unused before it is
+  /// collected.
+  static constexpr size_t kMaxUnusedFrameCount = 10;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a render target cache.
+  ///
+  /// @param[in]  pool_by_size_class  If set, render targets are allocated at
+  ///                                 the size class of the surfaces rendered
+  ///                                 into them and are shared by all views
+  ///                                 whose surfaces fall into the same size
+  ///                                 class. Unused render targets are kept
+  ///                                 for `kMaxUnusedFrameCount` frames instead
+  ///                                 of one. This avoids collecting and
+  ///                                 creating render targets every frame while
+  ///                                 the window is resized or platform views
+  ///                                 come and go.
+  ///
+  explicit EmbedderRenderTargetCache(bool pool_by_size_class = false);
 
   ~EmbedderRenderTargetCache();
 
@@ -31,6 +49,22 @@ class EmbedderRenderTargetCache {
                          EmbedderExternalView::ViewIdentifier::Hash,
                          EmbedderExternalView::ViewIdentifier::Equal>;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Rounds the size of a surface up to its size class. Each
+  ///             dimension is rounded up to a multiple of 64 pixels or of a
+  ///             sixteenth of its next power of two, whichever is larger. The
+  ///             size class is never more than an eighth larger than the
+  ///             surface in dimensions of 512 pixels or more.
+  ///
+  static SkISize GetSizeClass(const SkISize& surface_size);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The size of the render target that must be created for a
+  ///             surface of the given size. This is the size of the surface,
+  ///             or its size class if the cache pools render targets.
+  ///
+  SkISize GetRenderTargetSize(const SkISize& surface_size) const;
+
   std::pair<RenderTargets, EmbedderExternalView::ViewIdentifierSet>
   GetExistingTargetsInCache(
       const EmbedderExternalView::PendingViews& pending_views);
@@ -38,18 +72,33 @@ class EmbedderRenderTargetCache {
   std::set<std::unique_ptr<EmbedderRenderTarget>>
   ClearAllRenderTargetsInCache();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Ages the render targets left in the cache once the targets of
+  ///             a frame have been taken from it and returns the targets that
+  ///             have gone unused for too long. Without pooling, this returns
+  ///             all the targets left in the cache.
+  ///
+  std::set<std::unique_ptr<EmbedderRenderTarget>> CollectUnusedRenderTargets();
+
   void CacheRenderTarget(EmbedderExternalView::ViewIdentifier view_identifier,
                          std::unique_ptr<EmbedderRenderTarget> target);
 
   size_t GetCachedTargetsCount() const;
 
  private:
+  struct CachedRenderTarget {
+    std::unique_ptr<EmbedderRenderTarget> target;
+    size_t unused_frame_count = 0;
+  };
+
+  // The most recently cached targets are at the back and are reused first.
   using CachedRenderTargets =
       std::unordered_map<EmbedderExternalView::RenderTargetDescriptor,
-                         std::stack<std::unique_ptr<EmbedderRenderTarget>>,
+                         std::vector<CachedRenderTarget>,
                          EmbedderExternalView::RenderTargetDescriptor::Hash,
                          EmbedderExternalView::RenderTargetDescriptor::Equal>;
 
+  const bool pool_by_size_class_;
   CachedRenderTargets cached_render_targets_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderRenderTargetCache);
@@ -0,0 +1,98 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/embedder_render_target_cache.h"
+
+#include "flutter/testing/testing.h"
+#include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+namespace testing {
+namespace {
+
+std::unique_ptr<EmbedderRenderTarget> CreateRenderTarget(const SkISize& size) {
+  return std::make_unique<EmbedderRenderTarget>(
+      FlutterBackingStore{},
+      SkSurface::MakeRasterN32Premul(size.width(), size.height()), nullptr);
+}
+
+EmbedderExternalView::PendingViews CreatePendingViews(
+    const std::vector<std::pair<EmbedderExternalView::ViewIdentifier, SkISize>>&
+        views) {
+  EmbedderExternalView::PendingViews pending_views;
+  for (const auto& [identifier, size] : views) {
+    auto view = std::make_unique<EmbedderExternalView>(size, SkMatrix{},
+                                                       identifier, nullptr);
+    // Only views with engine rendered contents need render targets.
+    view->GetCanvas()->drawColor(SK_ColorRED);
+    pending_views[identifier] = std::move(view);
+  }
+  return pending_views;
+}
+
+}  // namespace
+
+TEST(EmbedderRenderTargetCacheTest, SizeClassesRoundUpSurfaceSizes) {
+  EXPECT_EQ(EmbedderRenderTargetCache::GetSizeClass(SkISize::Make(1, 64)),
+            SkISize::Make(64, 64));
+  EXPECT_EQ(EmbedderRenderTargetCache::GetSizeClass(SkISize::Make(65, 1000)),
+            SkISize::Make(128, 1024));
+  EXPECT_EQ(EmbedderRenderTargetCache::GetSizeClass(SkISize::Make(1025, 1080)),
+            SkISize::Make(1152, 1152));
+  EXPECT_EQ(EmbedderRenderTargetCache::GetSizeClass(SkISize::Make(1920, 0)),
+            SkISize::Make(1920, 0));
+}
+
+TEST(EmbedderRenderTargetCacheTest, RenderTargetsAreNotPooledByDefault) {
+  EmbedderRenderTargetCache cache;
+  EXPECT_EQ(cache.GetRenderTargetSize(SkISize::Make(100, 100)),
+            SkISize::Make(100, 100));
+
+  const EmbedderExternalView::ViewIdentifier root;
+  cache.CacheRenderTarget(root, CreateRenderTarget(SkISize::Make(100, 100)));
+
+  auto [targets, unmatched] = cache.GetExistingTargetsInCache(
+      CreatePendingViews({{root, SkISize::Make(101, 100)}}));
+  EXPECT_TRUE(targets.empty());
+  EXPECT_EQ(unmatched.size(), 1u);
+
+  EXPECT_EQ(cache.CollectUnusedRenderTargets().size(), 1u);
+  EXPECT_EQ(cache.GetCachedTargetsCount(), 0u);
+}
+
+TEST(EmbedderRenderTargetCacheTest, PooledRenderTargetsAreSharedBySizeClass) {
+  EmbedderRenderTargetCache cache(/*pool_by_size_class=*/true);
+  const auto target_size = cache.GetRenderTargetSize(SkISize::Make(100, 100));
+  EXPECT_EQ(target_size, SkISize::Make(128, 128));
+
+  const EmbedderExternalView::ViewIdentifier root;
+  cache.CacheRenderTarget(root, CreateRenderTarget(target_size));
+
+  // A platform view of a different size in the same size class reuses the
+  // render target of the root view.
+  const EmbedderExternalView::ViewIdentifier platform_view(42);
+  auto [targets, unmatched] = cache.GetExistingTargetsInCache(
+      CreatePendingViews({{platform_view, SkISize::Make(120, 90)}}));
+  EXPECT_EQ(targets.size(), 1u);
+  EXPECT_TRUE(unmatched.empty());
+  EXPECT_EQ(cache.GetCachedTargetsCount(), 0u);
+}
+
+TEST(EmbedderRenderTargetCacheTest, UnusedPooledRenderTargetsAreCollected) {
+  EmbedderRenderTargetCache cache(/*pool_by_size_class=*/true);
+  const EmbedderExternalView::ViewIdentifier root;
+  cache.CacheRenderTarget(root, CreateRenderTarget(SkISize::Make(128, 128)));
+
+  for (size_t i = 0; i < EmbedderRenderTargetCache::kMaxUnusedFrameCount;
+       i++) {
+    EXPECT_TRUE(cache.CollectUnusedRenderTargets().empty());
+    EXPECT_EQ(cache.GetCachedTargetsCount(), 1u);
+  }
+  EXPECT_EQ(cache.CollectUnusedRenderTargets().size(), 1u);
+  EXPECT_EQ(cache.GetCachedTargetsCount(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,130 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/embedder_surface_vulkan_impeller.h"
+
+#include <utility>
+
+#include "flutter/common/graphics/persistent_cache.h"
+#include "flutter/fml/logging.h"
+#include "flutter/shell/gpu/gpu_surface_vulkan_impeller.h"
+#include "impeller/entity/vk/entity_shaders_vk.h"
+#include "impeller/renderer/backend/vulkan/context_vk.h"
+
+namespace flutter {
+
+EmbedderSurfaceVulkanImpeller::EmbedderSurfaceVulkanImpeller(
+    uint32_t version,
+    VkInstance instance,
+    VkPhysicalDevice physical_device,
+    VkDevice device,
+    uint32_t queue_family_index,
+    VkQueue queue,
+    const EmbedderSurfaceVulkan::VulkanDispatchTable& vulkan_dispatch_table)
+    : workers_(fml::ConcurrentMessageLoop::Create()) {
+  // Make sure all required members of the dispatch table are checked.
+  if (!vulkan_dispatch_table.get_instance_proc_address ||
+      !vulkan_dispatch_table.get_next_image ||
+      !vulkan_dispatch_table.present_image) {
+    return;
+  }
+
+  std::vector<std::shared_ptr<fml::Mapping>> shader_mappings = {
+      std::make_shared<fml::NonOwnedMapping>(impeller_entity_shaders_vk_data,
+                                             impeller_entity_shaders_vk_length),
+  };
+
+  const impeller::ExternalHandlesVK handles = {
+      .instance = impeller::vk::Instance(instance),
+      .api_version = version,
+      .physical_device = impeller::vk::PhysicalDevice(physical_device),
+      .device = impeller::vk::Device(device),
+      .queue_family_index = queue_family_index,
+      .queue = impeller::vk::Queue(queue),
+  };
+
+  // The context reuses the Impeller pipeline cache of previous runs.
+  auto context = impeller::ContextVK::Create(
+      vulkan_dispatch_table.get_instance_proc_address,  //
+      handles,                                          //
+      shader_mappings,                                  //
+      PersistentCache::MakeImpellerCacheDirectory(),    //
+      workers_->GetTaskRunner(),                        //
+      "Embedder Impeller Vulkan Lib"                    //
+  );
+  if (!context) {
+    FML_LOG(ERROR) << "Could not create the Impeller Vulkan context.";
+    return;
+  }
+
+  impeller::ExternalImageCallbacksVK callbacks = {
+      .acquire_image =
+          [get_next_image = vulkan_dispatch_table.get_next_image](
+              const impeller::ISize& size) -> impeller::ExternalImageVK {
+        FlutterVulkanImage image =
+            get_next_image(SkISize::Make(size.width, size.height));
+        if (static_cast<VkFormat>(image.format) != kImageFormat) {
+          FML_LOG(ERROR) << "Embedder supplied Vulkan images must have the "
+                            "format VK_FORMAT_R8G8B8A8_UNORM with Impeller.";
+          return {};
+        }
+        const auto vk_image = reinterpret_cast<VkImage>(image.image);
+        return {
+            .image = impeller::vk::Image(vk_image),
+            .format = impeller::vk::Format(kImageFormat),
+        };
+      },
+      .present_image =
+          [present_image = vulkan_dispatch_table.present_image](
+              const impeller::ExternalImageVK& image) -> bool {
+        return present_image(static_cast<VkImage>(image.image),
+                             static_cast<VkFormat>(image.format));
+      },
+  };
+
+  // Let the raster thread record the next frame while the GPU is still
+  // working on the current one.
+  if (!context->SetupExternalImages(std::move(callbacks),
+                                    impeller::vk::Format(kImageFormat),
+                                    /*frames_in_flight=*/2u)) {
+    FML_LOG(ERROR) << "Could not set up rendering into embedder images.";
+    return;
+  }
+
+  context_ = std::move(context);
+}
+
+EmbedderSurfaceVulkanImpeller::~EmbedderSurfaceVulkanImpeller() {
+  if (context_) {
+    context_->FlushPipelineCache();
+  }
+}
+
+// |EmbedderSurface|
+bool EmbedderSurfaceVulkanImpeller::IsValid() const {
+  return context_ != nullptr;
+}
+
+// |EmbedderSurface|
+std::unique_ptr<Surface> EmbedderSurfaceVulkanImpeller::CreateGPUSurface() {
+  if (!IsValid()) {
+    return nullptr;
+  }
+
+  auto surface = std::make_unique<GPUSurfaceVulkanImpeller>(
+      context_, /*aiks_context=*/nullptr);
+  if (!surface->IsValid()) {
+    return nullptr;
+  }
+  return surface;
+}
+
+// |EmbedderSurface|
+sk_sp<GrDirectContext> EmbedderSurfaceVulkanImpeller::CreateResourceContext()
+    const {
+  // Impeller != Skia.
+  return nullptr;
+}
+
+}  // namespace flutter
@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_SURFACE_VULKAN_IMPELLER_H_
+#define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_SURFACE_VULKAN_IMPELLER_H_
+
+#include <memory>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/macros.h"
+#include "flutter/shell/platform/embedder/embedder_surface.h"
+#include "flutter/shell/platform/embedder/embedder_surface_vulkan.h"
+
+namespace impeller {
+class ContextVK;
+}  // namespace impeller
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      An embedder surface that renders with Impeller into the images
+///             of the Vulkan instance and device of the embedder.
+///
+///             Frames are rendered into the images returned by the
+///             `get_next_image` callback and handed back with the
+///             `present_image` callback once the GPU is done with them. The
+///             images must use `kImageFormat`.
+///
+class EmbedderSurfaceVulkanImpeller final : public EmbedderSurface {
+ public:
+  static constexpr VkFormat kImageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+
+  EmbedderSurfaceVulkanImpeller(
+      uint32_t version,
+      VkInstance instance,
+      VkPhysicalDevice physical_device,
+      VkDevice device,
+      uint32_t queue_family_index,
+      VkQueue queue,
+      const EmbedderSurfaceVulkan::VulkanDispatchTable& vulkan_dispatch_table);
+
+  ~EmbedderSurfaceVulkanImpeller() override;
+
+ private:
+  std::shared_ptr<fml::ConcurrentMessageLoop> workers_;
+  std::shared_ptr<impeller::ContextVK> context_;
+
+  // |EmbedderSurface|
+  bool IsValid() const override;
+
+  // |EmbedderSurface|
+  std::unique_ptr<Surface> CreateGPUSurface() override;
+
+  // |EmbedderSurface|
+  sk_sp<GrDirectContext> CreateResourceContext() const override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(EmbedderSurfaceVulkanImpeller);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_SURFACE_VULKAN_IMPELLER_H_
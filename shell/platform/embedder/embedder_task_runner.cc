@@ -32,6 +32,17 @@ void EmbedderTaskRunner::PostTask(const fml::closure& task) {
 
 void EmbedderTaskRunner::PostTaskForTime(const fml::closure& task,
                                          fml::TimePoint target_time) {
+  PostTask(task, target_time, fml::TaskSourceGrade::kUnspecified);
+}
+
+void EmbedderTaskRunner::PostTaskWithGrade(const fml::closure& task,
+                                           fml::TaskSourceGrade grade) {
+  PostTask(task, fml::TimePoint::Now(), grade);
+}
+
+void EmbedderTaskRunner::PostTask(const fml::closure& task,
+                                  fml::TimePoint target_time,
+                                  fml::TaskSourceGrade grade) {
   if (!task) {
     return;
   }
@@ -45,7 +56,7 @@ void EmbedderTaskRunner::PostTaskForTime(const fml::closure& task,
     pending_tasks_[baton] = task;
   }
 
-  dispatch_table_.post_task_callback(this, baton, target_time);
+  dispatch_table_.post_task_callback(this, baton, target_time, grade);
 }
 
 void EmbedderTaskRunner::PostDelayedTask(const fml::closure& task,
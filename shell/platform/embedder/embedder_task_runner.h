@@ -27,11 +27,13 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
     /// Delegates responsibility of deferred task execution to the embedder.
     /// Once the embedder gets the task, it must call
     /// `EmbedderTaskRunner::PostTask` with the supplied `task_baton` on the
-    /// correct thread after the tasks `target_time` point expires.
+    /// correct thread after the tasks `target_time` point expires. The
+    /// `task_source_grade` tells the embedder how important the task is.
     ///
     std::function<void(EmbedderTaskRunner* task_runner,
                        uint64_t task_baton,
-                       fml::TimePoint target_time)>
+                       fml::TimePoint target_time,
+                       fml::TaskSourceGrade task_source_grade)>
         post_task_callback;
     //--------------------------------------------------------------------------
     /// Asks the embedder if tasks posted to it on this task task runner via the
@@ -86,6 +88,10 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
   void PostTaskForTime(const fml::closure& task,
                        fml::TimePoint target_time) override;
 
+  // |fml::TaskRunner|
+  void PostTaskWithGrade(const fml::closure& task,
+                         fml::TaskSourceGrade grade) override;
+
   // |fml::TaskRunner|
   void PostDelayedTask(const fml::closure& task, fml::TimeDelta delay) override;
 
@@ -95,6 +101,10 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
   // |fml::TaskRunner|
   fml::TaskQueueId GetTaskQueueId() override;
 
+  void PostTask(const fml::closure& task,
+                fml::TimePoint target_time,
+                fml::TaskSourceGrade grade);
+
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderTaskRunner);
 };
 
@@ -26,6 +26,18 @@ namespace flutter {
 /// @return     A pair that returns if the embedder has specified a task runner
 ///             (null otherwise) and whether to terminate further engine launch.
 ///
+static FlutterTaskPriority ToFlutterTaskPriority(fml::TaskSourceGrade grade) {
+  switch (grade) {
+    case fml::TaskSourceGrade::kUserInteraction:
+      return kFlutterTaskPriorityUserInteraction;
+    case fml::TaskSourceGrade::kDartMicroTasks:
+      return kFlutterTaskPriorityBackground;
+    case fml::TaskSourceGrade::kUnspecified:
+      return kFlutterTaskPriorityDefault;
+  }
+  return kFlutterTaskPriorityDefault;
+}
+
 static std::pair<bool, fml::RefPtr<EmbedderTaskRunner>>
 CreateEmbedderTaskRunner(const FlutterTaskRunnerDescription* description) {
   if (description == nullptr) {
@@ -52,20 +64,29 @@ CreateEmbedderTaskRunner(const FlutterTaskRunnerDescription* description) {
 
   // ABI safety checks have been completed.
   auto post_task_callback_c = description->post_task_callback;
+  auto post_task_with_priority_callback_c =
+      SAFE_ACCESS(description, post_task_with_priority_callback, nullptr);
   auto runs_task_on_current_thread_callback_c =
       description->runs_task_on_current_thread_callback;
 
   EmbedderTaskRunner::DispatchTable task_runner_dispatch_table = {
       // .post_task_callback
-      [post_task_callback_c, user_data](EmbedderTaskRunner* task_runner,
-                                        uint64_t task_baton,
-                                        fml::TimePoint target_time) -> void {
+      [post_task_callback_c, post_task_with_priority_callback_c, user_data](
+          EmbedderTaskRunner* task_runner, uint64_t task_baton,
+          fml::TimePoint target_time,
+          fml::TaskSourceGrade task_source_grade) -> void {
         FlutterTask task = {
             // runner
             reinterpret_cast<FlutterTaskRunner>(task_runner),
             // task
             task_baton,
         };
+        if (post_task_with_priority_callback_c) {
+          post_task_with_priority_callback_c(
+              task, target_time.ToEpochDelta().ToNanoseconds(),
+              ToFlutterTaskPriority(task_source_grade), user_data);
+          return;
+        }
         post_task_callback_c(task, target_time.ToEpochDelta().ToNanoseconds(),
                              user_data);
       },
@@ -82,10 +103,11 @@ CreateEmbedderTaskRunner(const FlutterTaskRunnerDescription* description) {
 std::unique_ptr<EmbedderThreadHost>
 EmbedderThreadHost::CreateEmbedderOrEngineManagedThreadHost(
     const FlutterCustomTaskRunners* custom_task_runners,
+    const flutter::Settings& settings,
     const flutter::ThreadConfigSetter& config_setter) {
   {
-    auto host =
-        CreateEmbedderManagedThreadHost(custom_task_runners, config_setter);
+    auto host = CreateEmbedderManagedThreadHost(custom_task_runners, settings,
+                                                config_setter);
     if (host && host->IsValid()) {
       return host;
     }
@@ -96,7 +118,7 @@ EmbedderThreadHost::CreateEmbedderOrEngineManagedThreadHost(
   // configuration if the embedder attempted to specify a configuration but
   // messed up with an incorrect configuration.
   if (custom_task_runners == nullptr) {
-    auto host = CreateEngineManagedThreadHost(config_setter);
+    auto host = CreateEngineManagedThreadHost(settings, config_setter);
     if (host && host->IsValid()) {
       return host;
     }
@@ -125,12 +147,14 @@ fml::Thread::ThreadConfig MakeThreadConfig(
 std::unique_ptr<EmbedderThreadHost>
 EmbedderThreadHost::CreateEmbedderManagedThreadHost(
     const FlutterCustomTaskRunners* custom_task_runners,
+    const flutter::Settings& settings,
     const flutter::ThreadConfigSetter& config_setter) {
   if (custom_task_runners == nullptr) {
     return nullptr;
   }
 
   auto thread_host_config = ThreadHost::ThreadHostConfig(config_setter);
+  thread_host_config.SetCpuAffinities(settings);
 
   // The UI and IO threads are always created by the engine and the embedder has
   // no opportunity to specify task runners for the same.
@@ -223,9 +247,11 @@ EmbedderThreadHost::CreateEmbedderManagedThreadHost(
 // static
 std::unique_ptr<EmbedderThreadHost>
 EmbedderThreadHost::CreateEngineManagedThreadHost(
+    const flutter::Settings& settings,
     const flutter::ThreadConfigSetter& config_setter) {
   // Crate a thraed host config, and specified the thread name and priority.
   auto thread_host_config = ThreadHost::ThreadHostConfig(config_setter);
+  thread_host_config.SetCpuAffinities(settings);
   thread_host_config.SetUIConfig(MakeThreadConfig(
       flutter::ThreadHost::UI, fml::Thread::ThreadPriority::DISPLAY));
   thread_host_config.SetRasterConfig(MakeThreadConfig(
@@ -22,8 +22,9 @@ class EmbedderThreadHost {
   static std::unique_ptr<EmbedderThreadHost>
   CreateEmbedderOrEngineManagedThreadHost(
       const FlutterCustomTaskRunners* custom_task_runners,
+      const flutter::Settings& settings,
       const flutter::ThreadConfigSetter& config_setter =
-          fml::Thread::SetCurrentThreadName);
+          fml::Thread::SetCurrentThreadConfig);
 
   EmbedderThreadHost(
       ThreadHost host,
@@ -45,12 +46,14 @@ class EmbedderThreadHost {
 
   static std::unique_ptr<EmbedderThreadHost> CreateEmbedderManagedThreadHost(
       const FlutterCustomTaskRunners* custom_task_runners,
+      const flutter::Settings& settings,
       const flutter::ThreadConfigSetter& config_setter =
-          fml::Thread::SetCurrentThreadName);
+          fml::Thread::SetCurrentThreadConfig);
 
   static std::unique_ptr<EmbedderThreadHost> CreateEngineManagedThreadHost(
+      const flutter::Settings& settings,
       const flutter::ThreadConfigSetter& config_setter =
-          fml::Thread::SetCurrentThreadName);
+          fml::Thread::SetCurrentThreadConfig);
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderThreadHost);
 };
@@ -1093,3 +1093,16 @@ void draw_solid_green() {
 void draw_solid_blue() {
   drawSolidColor(const Color.fromARGB(255, 0, 0, 255));
 }
+
+@pragma('vm:entry-point')
+void render_frames_continuously() {
+  PlatformDispatcher.instance.onBeginFrame = (Duration duration) {
+    final FlutterView view = PlatformDispatcher.instance.views.first;
+    SceneBuilder builder = SceneBuilder();
+    builder.addPicture(Offset(0.0, 0.0), CreateGradientBox(view.physicalSize));
+    view.render(builder.build());
+    PlatformDispatcher.instance.scheduleFrame();
+    signalNativeTest();
+  };
+  PlatformDispatcher.instance.scheduleFrame();
+}
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "flutter/fml/make_copyable.h"
+#include "flutter/shell/platform/embedder/vsync_waiter_unthrottled.h"
 
 namespace flutter {
 
@@ -102,7 +103,7 @@ PlatformViewEmbedder::PlatformViewEmbedder(
 PlatformViewEmbedder::PlatformViewEmbedder(
     PlatformView::Delegate& delegate,
     const flutter::TaskRunners& task_runners,
-    std::unique_ptr<EmbedderSurfaceVulkan> embedder_surface,
+    std::unique_ptr<EmbedderSurface> embedder_surface,
     PlatformDispatchTable platform_dispatch_table,
     std::shared_ptr<EmbedderExternalViewEmbedder> external_view_embedder)
     : PlatformView(delegate, task_runners),
@@ -169,6 +170,9 @@ sk_sp<GrDirectContext> PlatformViewEmbedder::CreateResourceContext() const {
 // |PlatformView|
 std::unique_ptr<VsyncWaiter> PlatformViewEmbedder::CreateVSyncWaiter() {
   if (!platform_dispatch_table_.vsync_callback) {
+    if (platform_dispatch_table_.unthrottled_frames) {
+      return std::make_unique<VsyncWaiterUnthrottled>(task_runners_);
+    }
     // Superclass implementation creates a timer based fallback.
     return PlatformView::CreateVSyncWaiter();
   }
@@ -49,6 +49,8 @@ class PlatformViewEmbedder final : public PlatformView {
     ComputePlatformResolvedLocaleCallback
         compute_platform_resolved_locale_callback;
     OnPreEngineRestartCallback on_pre_engine_restart_callback;  // optional
+    // Only used when there is no vsync callback.
+    bool unthrottled_frames = false;  // optional
   };
 
   // Create a platform view that sets up a software rasterizer.
@@ -82,11 +84,12 @@ class PlatformViewEmbedder final : public PlatformView {
 #endif
 
 #ifdef SHELL_ENABLE_VULKAN
-  // Creates a platform view that sets up an Vulkan rasterizer.
+  // Creates a platform view that sets up an Vulkan rasterizer. The surface is
+  // either an |EmbedderSurfaceVulkan| or an |EmbedderSurfaceVulkanImpeller|.
   PlatformViewEmbedder(
       PlatformView::Delegate& delegate,
       const flutter::TaskRunners& task_runners,
-      std::unique_ptr<EmbedderSurfaceVulkan> embedder_surface,
+      std::unique_ptr<EmbedderSurface> embedder_surface,
       PlatformDispatchTable platform_dispatch_table,
       std::shared_ptr<EmbedderExternalViewEmbedder> external_view_embedder);
 #endif
@@ -0,0 +1,119 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/semaphore.h"
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/embedder/tests/embedder_config_builder.h"
+#include "flutter/shell/platform/embedder/tests/embedder_test_context_software.h"
+#include "flutter/testing/test_dart_native_resolver.h"
+#include "flutter/testing/testing.h"
+
+#ifdef SHELL_ENABLE_GL
+#include "flutter/shell/platform/embedder/tests/embedder_test_context_gl.h"
+#endif
+
+namespace flutter {
+namespace testing {
+
+static std::unique_ptr<EmbedderTestContext> CreateContext(
+    EmbedderTestContextType type) {
+  switch (type) {
+    case EmbedderTestContextType::kSoftwareContext:
+      return std::make_unique<EmbedderTestContextSoftware>(GetFixturesPath());
+#ifdef SHELL_ENABLE_GL
+    case EmbedderTestContextType::kOpenGLContext:
+      return std::make_unique<EmbedderTestContextGL>(GetFixturesPath());
+#endif
+    default:
+      FML_CHECK(false) << "Unsupported context type.";
+      return nullptr;
+  }
+}
+
+static void SetFrameCounters(benchmark::State& state,
+                             const char* name,
+                             const FlutterFrameDurationPercentiles& duration) {
+  const std::string prefix(name);
+  state.counters[prefix + "_p50_us"] = duration.p50;
+  state.counters[prefix + "_p90_us"] = duration.p90;
+  state.counters[prefix + "_p99_us"] = duration.p99;
+  state.counters[prefix + "_max_us"] = duration.max;
+}
+
+// Measures how fast the engine can produce frames of the given size when it
+// is not throttled by vsync. Each iteration is one frame.
+static void BM_EmbedderUnthrottledFrames(benchmark::State& state,
+                                         EmbedderTestContextType type) {
+  const SkISize surface_size =
+      SkISize::Make(state.range(0), state.range(0) * 3 / 4);
+  auto context = CreateContext(type);
+  EmbedderConfigBuilder builder(*context);
+  builder.SetRendererConfig(type, surface_size);
+  builder.SetDartEntrypoint("render_frames_continuously");
+  builder.GetProjectArgs().unthrottled_frames = true;
+
+  fml::Semaphore frames(0);
+  FML_CHECK(frames.IsValid());
+  context->AddNativeCallback(
+      "SignalNativeTest",
+      CREATE_NATIVE_ENTRY(
+          [&frames](Dart_NativeArguments args) { frames.Signal(); }));
+
+  auto engine = builder.LaunchEngine();
+  FML_CHECK(engine.is_valid());
+
+  FlutterWindowMetricsEvent event = {};
+  event.struct_size = sizeof(event);
+  event.width = surface_size.width();
+  event.height = surface_size.height();
+  event.pixel_ratio = 1.0;
+  FML_CHECK(FlutterEngineSendWindowMetricsEvent(engine.get(), &event) ==
+            kSuccess);
+
+  FlutterFrameTimingStatistics statistics = {};
+  statistics.struct_size = sizeof(statistics);
+  {
+    // Excludes the first frames, which include the startup of the isolate.
+    benchmarking::ScopedPauseTiming pause(state);
+    FML_CHECK(frames.Wait());
+    FML_CHECK(FlutterEngineGetFrameTimingStatistics(engine.get(), true,
+                                                    &statistics) == kSuccess);
+  }
+
+  for (auto _ : state) {
+    FML_CHECK(frames.Wait());
+  }
+
+  FML_CHECK(FlutterEngineGetFrameTimingStatistics(engine.get(), false,
+                                                  &statistics) == kSuccess);
+  state.SetItemsProcessed(state.iterations());
+  state.counters["frame_count"] = statistics.frame_count;
+  state.counters["vsync_overrun_count"] = statistics.vsync_overrun_count;
+  SetFrameCounters(state, "build", statistics.build);
+  SetFrameCounters(state, "raster", statistics.raster);
+}
+
+BENCHMARK_CAPTURE(BM_EmbedderUnthrottledFrames,
+                  Software,
+                  EmbedderTestContextType::kSoftwareContext)
+    ->RangeMultiplier(2)
+    ->Range(256, 2048)
+    ->Unit(benchmark::kMicrosecond);
+
+#ifdef SHELL_ENABLE_GL
+BENCHMARK_CAPTURE(BM_EmbedderUnthrottledFrames,
+                  OpenGL,
+                  EmbedderTestContextType::kOpenGLContext)
+    ->RangeMultiplier(2)
+    ->Range(256, 2048)
+    ->Unit(benchmark::kMicrosecond);
+#endif
+
+}  // namespace testing
+}  // namespace flutter
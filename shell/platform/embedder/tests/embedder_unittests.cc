@@ -4,6 +4,7 @@
 
 #define FML_USED_ON_EMBEDDER
 
+#include <limits>
 #include <string>
 #include <utility>
 #include <vector>
@@ -2169,6 +2170,96 @@ TEST_F(EmbedderTest, CanSetNextFrameCallback) {
   callback_latch.Wait();
 }
 
+TEST_F(EmbedderTest, CanGetFrameTimingStatistics) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+  builder.SetDartEntrypoint("draw_solid_red");
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  FlutterFrameTimingStatistics statistics = {};
+  ASSERT_EQ(FlutterEngineGetFrameTimingStatistics(engine.get(), false,
+                                                  &statistics),
+            kInvalidArguments);
+  ASSERT_EQ(FlutterEngineGetFrameTimingStatistics(engine.get(), false, nullptr),
+            kInvalidArguments);
+
+  statistics.struct_size = sizeof(statistics);
+  ASSERT_EQ(FlutterEngineGetFrameTimingStatistics(engine.get(), true,
+                                                  &statistics),
+            kSuccess);
+  ASSERT_GE(statistics.frame_count, statistics.vsync_overrun_count);
+  ASSERT_LE(statistics.raster.p50, statistics.raster.max);
+}
+
+TEST_F(EmbedderTest, CanProduceUnthrottledFrames) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig(SkISize::Make(64, 64));
+  builder.SetDartEntrypoint("render_frames_continuously");
+  builder.GetProjectArgs().unthrottled_frames = true;
+
+  constexpr size_t kFrameCount = 10;
+  fml::CountDownLatch frames(kFrameCount);
+  context.AddNativeCallback(
+      "SignalNativeTest",
+      CREATE_NATIVE_ENTRY([&frames](Dart_NativeArguments args) {
+        frames.CountDown();
+      }));
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  // Send a window metrics events so frames may be scheduled.
+  FlutterWindowMetricsEvent event = {};
+  event.struct_size = sizeof(event);
+  event.width = 64;
+  event.height = 64;
+  event.pixel_ratio = 1.0;
+  ASSERT_EQ(FlutterEngineSendWindowMetricsEvent(engine.get(), &event),
+            kSuccess);
+
+  frames.Wait();
+
+  FlutterFrameTimingStatistics statistics = {};
+  statistics.struct_size = sizeof(statistics);
+  ASSERT_EQ(FlutterEngineGetFrameTimingStatistics(engine.get(), false,
+                                                  &statistics),
+            kSuccess);
+  ASSERT_LE(statistics.raster.p50, statistics.raster.max);
+}
+
+TEST_F(EmbedderTest, CanNotifyFramePresented) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+  builder.SetDartEntrypoint("draw_solid_red");
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  FlutterFramePresentedInfo info = {};
+  ASSERT_EQ(FlutterEngineNotifyFramePresented(engine.get(), &info),
+            kInvalidArguments);
+  ASSERT_EQ(FlutterEngineNotifyFramePresented(engine.get(), nullptr),
+            kInvalidArguments);
+
+  // Frames that the engine did not rasterize are not counted.
+  info.struct_size = sizeof(info);
+  info.frame_number = std::numeric_limits<uint64_t>::max();
+  info.presentation_time_nanos = FlutterEngineGetCurrentTime();
+  ASSERT_EQ(FlutterEngineNotifyFramePresented(engine.get(), &info), kSuccess);
+
+  FlutterFrameTimingStatistics statistics = {};
+  statistics.struct_size = sizeof(statistics);
+  ASSERT_EQ(FlutterEngineGetFrameTimingStatistics(engine.get(), false,
+                                                  &statistics),
+            kSuccess);
+  ASSERT_EQ(statistics.presented_frame_count, 0u);
+}
+
 #if defined(FML_OS_MACOSX)
 
 static void MockThreadConfigSetter(const fml::Thread::ThreadConfig& config) {
@@ -2188,7 +2279,7 @@ static void MockThreadConfigSetter(const fml::Thread::ThreadConfig& config) {
 TEST_F(EmbedderTest, EmbedderThreadHostUseCustomThreadConfig) {
   auto thread_host =
       flutter::EmbedderThreadHost::CreateEmbedderOrEngineManagedThreadHost(
-          nullptr, MockThreadConfigSetter);
+          nullptr, flutter::Settings(), MockThreadConfigSetter);
 
   int ui_policy;
   struct sched_param ui_param;
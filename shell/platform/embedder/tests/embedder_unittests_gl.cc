@@ -76,6 +76,29 @@ TEST_F(EmbedderTest,
   ASSERT_FALSE(engine.is_valid());
 }
 
+//------------------------------------------------------------------------------
+/// An external texture can either be a GL texture or a dmabuf, so the engine
+/// must refuse to launch if both kinds of external texture callbacks are
+/// specified.
+///
+TEST_F(EmbedderTest,
+       MustPreventEngineLaunchWhenBothExternalTextureCallbacksAreSpecified) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kOpenGLContext);
+  EmbedderConfigBuilder builder(context);
+  builder.SetOpenGLRendererConfig(SkISize::Make(1, 1));
+  builder.GetRendererConfig().open_gl.gl_external_texture_frame_callback =
+      [](void*, int64_t, size_t, size_t, FlutterOpenGLTexture*) -> bool {
+    return false;
+  };
+  builder.GetRendererConfig()
+      .open_gl.gl_external_dma_buf_texture_frame_callback =
+      [](void*, int64_t, size_t, size_t, FlutterOpenGLDmaBufTexture*) -> bool {
+    return false;
+  };
+  auto engine = builder.LaunchEngine();
+  ASSERT_FALSE(engine.is_valid());
+}
+
 //------------------------------------------------------------------------------
 /// Must be able to render to a custom compositor whose render targets are fully
 /// complete OpenGL textures.
@@ -4069,6 +4092,65 @@ TEST_F(EmbedderTest, ExternalTextureGLRefreshedTooOften) {
   EXPECT_TRUE(resolve_called);
 }
 
+TEST_F(EmbedderTest, ExternalTextureGLPooledTexturesAreReleasedPerFrame) {
+  TestGLSurface surface(SkISize::Make(100, 100));
+  auto context = surface.GetGrContext();
+
+  typedef void (*glGenTexturesProc)(uint32_t n, uint32_t* textures);
+  glGenTexturesProc glGenTextures;
+
+  glGenTextures = reinterpret_cast<glGenTexturesProc>(
+      surface.GetProcAddress("glGenTextures"));
+
+  uint32_t names[2];
+  glGenTextures(2, names);
+
+  size_t frame = 0;
+  size_t released = 0;
+
+  EmbedderExternalTextureGL::ExternalTextureCallback callback(
+      [&](int64_t, size_t, size_t) {
+        auto res = std::make_unique<FlutterOpenGLTexture>();
+        res->target = GR_GL_TEXTURE_2D;
+        res->name = names[frame++ % 2];
+        res->format = GR_GL_RGBA8;
+        res->user_data = &released;
+        res->destruction_callback = [](void* user_data) {
+          (*reinterpret_cast<size_t*>(user_data))++;
+        };
+        res->width = res->height = 100;
+        res->pooled = true;
+        return res;
+      });
+  auto texture = std::make_unique<EmbedderExternalTextureGL>(1, callback);
+
+  auto skia_surface = surface.GetOnscreenSurface();
+  auto canvas = skia_surface->getCanvas();
+
+  Texture::PaintContext ctx{
+      .canvas = canvas,
+      .gr_context = context.get(),
+  };
+  auto paint_new_frame = [&]() {
+    Texture* texture_ = texture.get();
+    texture_->MarkNewFrameAvailable();
+    texture_->Paint(ctx, SkRect::MakeXYWH(0, 0, 100, 100), false,
+                    SkSamplingOptions(SkFilterMode::kLinear));
+  };
+
+  // Every pooled texture is released once the next frame has been resolved,
+  // including the ones that were wrapped in an earlier frame.
+  for (size_t i = 1; i <= 4; i++) {
+    paint_new_frame();
+    EXPECT_EQ(frame, i);
+    EXPECT_EQ(released, i - 1);
+  }
+
+  // The texture that is still in use is released with the external texture.
+  texture.reset();
+  EXPECT_EQ(released, 4u);
+}
+
 TEST_F(EmbedderTest,
        PresentInfoReceivesNoDamageWhenPopulateExistingDamageIsUndefined) {
   auto& context = GetEmbedderContext(EmbedderTestContextType::kOpenGLContext);
@@ -0,0 +1,38 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/vsync_waiter_unthrottled.h"
+
+#include <memory>
+
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+static constexpr fml::TimeDelta kSingleFrameInterval =
+    fml::TimeDelta::FromSecondsF(1.0 / 60.0);
+
+VsyncWaiterUnthrottled::VsyncWaiterUnthrottled(
+    const flutter::TaskRunners& task_runners)
+    : VsyncWaiter(task_runners) {}
+
+VsyncWaiterUnthrottled::~VsyncWaiterUnthrottled() = default;
+
+// |VsyncWaiter|
+void VsyncWaiterUnthrottled::AwaitVSync() {
+  TRACE_EVENT0("flutter", "VsyncWaiterUnthrottled::AwaitVSync");
+
+  std::weak_ptr<VsyncWaiterUnthrottled> weak_this =
+      std::static_pointer_cast<VsyncWaiterUnthrottled>(shared_from_this());
+
+  task_runners_.GetUITaskRunner()->PostTask([weak_this]() {
+    if (auto vsync_waiter = weak_this.lock()) {
+      auto frame_start_time = fml::TimePoint::Now();
+      vsync_waiter->FireCallback(frame_start_time,
+                                 frame_start_time + kSingleFrameInterval);
+    }
+  });
+}
+
+}  // namespace flutter
@@ -0,0 +1,37 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_VSYNC_WAITER_UNTHROTTLED_H_
+#define FLUTTER_SHELL_PLATFORM_EMBEDDER_VSYNC_WAITER_UNTHROTTLED_H_
+
+#include "flutter/fml/macros.h"
+#include "flutter/shell/common/vsync_waiter.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A vsync waiter that begins the next frame as soon as the
+///             animator asks for it. Used by headless embedders that render
+///             frames as fast as they can instead of at the rate of a display.
+///
+///             Frames are given a target time one 60Hz interval past their
+///             start so that the timing statistics still count the frames
+///             that could not have been produced at that rate.
+///
+class VsyncWaiterUnthrottled final : public VsyncWaiter {
+ public:
+  explicit VsyncWaiterUnthrottled(const flutter::TaskRunners& task_runners);
+
+  ~VsyncWaiterUnthrottled() override;
+
+ private:
+  // |VsyncWaiter|
+  void AwaitVSync() override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(VsyncWaiterUnthrottled);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_EMBEDDER_VSYNC_WAITER_UNTHROTTLED_H_
@@ -0,0 +1,226 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "app_snapshot_cache.h"
+
+#include <lib/syslog/global.h>
+#include <lib/trace/event.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+
+#include "logging.h"
+#include "runtime/dart/utils/files.h"
+
+namespace dart_runner {
+
+namespace {
+
+constexpr char kHashParameter[] = "hash=";
+
+// The hashes of packages are hex encoded SHA-256 merkle roots.
+constexpr size_t kPackageHashLength = 64;
+
+bool IsPackageHash(const std::string& hash) {
+  return hash.length() == kPackageHashLength &&
+         std::all_of(hash.begin(), hash.end(),
+                     [](unsigned char c) { return std::isxdigit(c); });
+}
+
+}  // namespace
+
+std::shared_ptr<const AppSnapshot> AppSnapshot::Load(
+    int dirfd,
+    const std::string& data_path) {
+  TRACE_DURATION("dart", "AppSnapshot::Load", "path", data_path);
+  auto snapshot = std::make_shared<AppSnapshot>();
+
+  // Load the ELF snapshot as available, and fall back to a blobs snapshot
+  // otherwise.
+  if (snapshot->elf_snapshot_.Load(dirfd, data_path + "/app_aot_snapshot.so")) {
+    snapshot->isolate_data_ = snapshot->elf_snapshot_.IsolateData();
+    snapshot->isolate_instructions_ = snapshot->elf_snapshot_.IsolateInstrs();
+  } else {
+    if (!dart_utils::MappedResource::LoadFromDir(
+            dirfd, data_path + "/isolate_snapshot_data.bin",
+            snapshot->isolate_snapshot_data_)) {
+      return nullptr;
+    }
+    if (!dart_utils::MappedResource::LoadFromDir(
+            dirfd, data_path + "/isolate_snapshot_instructions.bin",
+            snapshot->isolate_snapshot_instructions_, true /* executable */)) {
+      return nullptr;
+    }
+    snapshot->isolate_data_ = snapshot->isolate_snapshot_data_.address();
+    snapshot->isolate_instructions_ =
+        snapshot->isolate_snapshot_instructions_.address();
+  }
+
+  if (snapshot->isolate_data_ == nullptr ||
+      snapshot->isolate_instructions_ == nullptr) {
+    return nullptr;
+  }
+  return snapshot;
+}
+
+AppSnapshotCache::AppSnapshotCache() = default;
+
+AppSnapshotCache::~AppSnapshotCache() = default;
+
+AppSnapshotCache& AppSnapshotCache::GetInstance() {
+  // Leaked so that detached component threads never see it destroyed.
+  static AppSnapshotCache* cache = new AppSnapshotCache();
+  return *cache;
+}
+
+std::string AppSnapshotCache::GetPackageHashFromUrl(const std::string& url) {
+  // The query of the URL comes before its fragment.
+  const size_t fragment = url.find('#');
+  const size_t query = url.substr(0, fragment).find('?');
+  if (query == std::string::npos) {
+    return "";
+  }
+  const std::string parameters = url.substr(
+      query + 1,
+      fragment == std::string::npos ? std::string::npos : fragment - query - 1);
+
+  size_t start = 0;
+  while (start <= parameters.length()) {
+    size_t end = parameters.find('&', start);
+    if (end == std::string::npos) {
+      end = parameters.length();
+    }
+    if (parameters.compare(start, sizeof(kHashParameter) - 1,
+                           kHashParameter) == 0) {
+      const size_t value = start + sizeof(kHashParameter) - 1;
+      std::string hash = parameters.substr(value, end - value);
+      return IsPackageHash(hash) ? hash : "";
+    }
+    start = end + 1;
+  }
+  return "";
+}
+
+std::string AppSnapshotCache::GetPackageHash(const std::string& url,
+                                             fdio_ns_t* namespc) {
+  std::string hash = GetPackageHashFromUrl(url);
+  if (!hash.empty() || namespc == nullptr) {
+    return hash;
+  }
+
+  const int root_dir = fdio_ns_opendir(namespc);
+  if (root_dir < 0) {
+    return "";
+  }
+  // Reading the meta directory of a package as a file returns the hash of
+  // the package.
+  const bool read = dart_utils::ReadFileToStringAt(root_dir, "pkg/meta", &hash);
+  close(root_dir);
+  return read && IsPackageHash(hash) ? hash : "";
+}
+
+std::string AppSnapshotCache::GetKey(const std::string& package_hash,
+                                     const std::string& data_path) {
+  return package_hash + "/" + data_path;
+}
+
+std::shared_ptr<const AppSnapshot> AppSnapshotCache::Load(
+    const std::string& package_hash,
+    fdio_ns_t* namespc,
+    const std::string& data_path) {
+  TRACE_DURATION("dart", "AppSnapshotCache::Load");
+  const std::string key = GetKey(package_hash, data_path);
+  if (!package_hash.empty()) {
+    if (auto snapshot = Find(key)) {
+      return snapshot;
+    }
+  }
+
+  const int root_dir = fdio_ns_opendir(namespc);
+  if (root_dir < 0) {
+    FX_LOG(ERROR, LOG_TAG, "Failed to open namespace directory");
+    return nullptr;
+  }
+  // Two components of the same package that start at the same time may
+  // both load the snapshot. Only the snapshot inserted first is shared.
+  auto snapshot = AppSnapshot::Load(root_dir, data_path);
+  close(root_dir);
+  if (!snapshot || package_hash.empty()) {
+    return snapshot;
+  }
+  Insert(key, snapshot);
+  return Find(key);
+}
+
+bool AppSnapshotCache::Prewarm(const std::string& package_hash,
+                               int dirfd,
+                               const std::string& data_path) {
+  TRACE_DURATION("dart", "AppSnapshotCache::Prewarm");
+  if (package_hash.empty()) {
+    return false;
+  }
+  const std::string key = GetKey(package_hash, data_path);
+  if (Find(key)) {
+    return true;
+  }
+  auto snapshot = AppSnapshot::Load(dirfd, data_path);
+  if (!snapshot) {
+    return false;
+  }
+  Insert(key, snapshot);
+  return true;
+}
+
+std::shared_ptr<const AppSnapshot> AppSnapshotCache::Find(
+    const std::string& key) {
+  std::scoped_lock lock(mutex_);
+  auto found = snapshots_.find(key);
+  if (found == snapshots_.end()) {
+    return nullptr;
+  }
+  auto snapshot = found->second.lock();
+  if (!snapshot) {
+    snapshots_.erase(found);
+    return nullptr;
+  }
+  Retain(snapshot);
+  return snapshot;
+}
+
+void AppSnapshotCache::Insert(
+    const std::string& key,
+    const std::shared_ptr<const AppSnapshot>& snapshot) {
+  std::scoped_lock lock(mutex_);
+  auto& entry = snapshots_[key];
+  if (!entry.expired()) {
+    return;
+  }
+  entry = snapshot;
+  Retain(snapshot);
+
+  // Drop the entries of snapshots that have been unmapped.
+  for (auto it = snapshots_.begin(); it != snapshots_.end();) {
+    if (it->second.expired()) {
+      it = snapshots_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void AppSnapshotCache::Retain(
+    const std::shared_ptr<const AppSnapshot>& snapshot) {
+  auto found = std::find(retained_snapshots_.begin(),
+                         retained_snapshots_.end(), snapshot);
+  if (found != retained_snapshots_.end()) {
+    retained_snapshots_.erase(found);
+  }
+  retained_snapshots_.push_front(snapshot);
+  if (retained_snapshots_.size() > kMaxRetainedSnapshots) {
+    retained_snapshots_.pop_back();
+  }
+}
+
+}  // namespace dart_runner
@@ -0,0 +1,123 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_FUCHSIA_DART_RUNNER_APP_SNAPSHOT_CACHE_H_
+#define FLUTTER_SHELL_PLATFORM_FUCHSIA_DART_RUNNER_APP_SNAPSHOT_CACHE_H_
+
+#include <lib/fdio/namespace.h>
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "runtime/dart/utils/mapped_resource.h"
+
+namespace dart_runner {
+
+/// The AOT snapshot of a component, mapped into the runner process.
+class AppSnapshot {
+ public:
+  /// Loads the ELF snapshot at `data_path`/app_aot_snapshot.so, or the blobs
+  /// snapshot in `data_path` if there is no ELF snapshot. `data_path` is
+  /// relative to `dirfd`. Returns nullptr if neither could be loaded.
+  static std::shared_ptr<const AppSnapshot> Load(int dirfd,
+                                                 const std::string& data_path);
+
+  AppSnapshot() = default;
+
+  const uint8_t* isolate_data() const { return isolate_data_; }
+  const uint8_t* isolate_instructions() const { return isolate_instructions_; }
+
+ private:
+  dart_utils::ElfSnapshot elf_snapshot_;
+  dart_utils::MappedResource isolate_snapshot_data_;
+  dart_utils::MappedResource isolate_snapshot_instructions_;
+
+  const uint8_t* isolate_data_ = nullptr;
+  const uint8_t* isolate_instructions_ = nullptr;
+
+  // Disallow copy and assignment.
+  AppSnapshot(const AppSnapshot&) = delete;
+  AppSnapshot& operator=(const AppSnapshot&) = delete;
+};
+
+/// The AOT snapshots loaded by the components of this runner, shared by all
+/// the components of the same package.
+///
+/// Without the cache, every component instance maps and relocates its own
+/// copy of the snapshot, and so pays again for the page faults and the
+/// private memory of the relocated pages. A snapshot is unmapped once the
+/// last component using it is gone and it is no longer one of the
+/// `kMaxRetainedSnapshots` most recently used snapshots, which are kept so
+/// that short-lived components that are started one after the other share
+/// a snapshot too.
+///
+/// Snapshots are keyed on the hash of their package, which identifies the
+/// content of the package. Components whose package hash is unknown are
+/// not shared.
+///
+/// This class is thread safe.
+class AppSnapshotCache {
+ public:
+  static constexpr size_t kMaxRetainedSnapshots = 4;
+
+  static AppSnapshotCache& GetInstance();
+
+  /// Returns the hash of the package in a resolved component URL such as
+  /// `fuchsia-pkg://fuchsia.com/hello?hash=1234#meta/hello.cm`, or the empty
+  /// string if the URL has no hash.
+  static std::string GetPackageHashFromUrl(const std::string& url);
+
+  /// Returns the hash of the package of a component, from its resolved URL
+  /// or otherwise from its `pkg/meta` file, which holds the hash of the
+  /// package. Returns the empty string if neither has the hash.
+  static std::string GetPackageHash(const std::string& url,
+                                    fdio_ns_t* namespc);
+
+  /// Returns the snapshot in `data_path` of the namespace of a component,
+  /// loading it only if no component of the package with `package_hash` has
+  /// loaded it yet.
+  std::shared_ptr<const AppSnapshot> Load(const std::string& package_hash,
+                                          fdio_ns_t* namespc,
+                                          const std::string& data_path);
+
+  /// Loads the snapshot in `data_path` of the directory `dirfd` ahead of
+  /// the first component of the package with `package_hash`, so that the
+  /// component starts without mapping the snapshot. The snapshot is retained
+  /// like a recently used one.
+  bool Prewarm(const std::string& package_hash,
+               int dirfd,
+               const std::string& data_path);
+
+ private:
+  AppSnapshotCache();
+
+  ~AppSnapshotCache();
+
+  std::shared_ptr<const AppSnapshot> Find(const std::string& key);
+
+  void Insert(const std::string& key,
+              const std::shared_ptr<const AppSnapshot>& snapshot);
+
+  // Must be called with |mutex_| held.
+  void Retain(const std::shared_ptr<const AppSnapshot>& snapshot);
+
+  static std::string GetKey(const std::string& package_hash,
+                            const std::string& data_path);
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::weak_ptr<const AppSnapshot>> snapshots_;
+  // Most recently used snapshots are at the front.
+  std::deque<std::shared_ptr<const AppSnapshot>> retained_snapshots_;
+
+  // Disallow copy and assignment.
+  AppSnapshotCache(const AppSnapshotCache&) = delete;
+  AppSnapshotCache& operator=(const AppSnapshotCache&) = delete;
+};
+
+}  // namespace dart_runner
+
+#endif  // FLUTTER_SHELL_PLATFORM_FUCHSIA_DART_RUNNER_APP_SNAPSHOT_CACHE_H_
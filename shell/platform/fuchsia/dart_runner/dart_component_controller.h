@@ -17,6 +17,7 @@
 #include <lib/zx/timer.h>
 
 #include "lib/fidl/cpp/binding.h"
+#include "app_snapshot_cache.h"
 #include "runtime/dart/utils/mapped_resource.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 
@@ -87,7 +88,7 @@ class DartComponentController
   int stdout_fd_ = -1;
   int stderr_fd_ = -1;
 
-  dart_utils::ElfSnapshot elf_snapshot_;                      // AOT snapshot
+  std::shared_ptr<const AppSnapshot> app_snapshot_;           // AOT snapshot
   dart_utils::MappedResource isolate_snapshot_data_;          // JIT snapshot
   dart_utils::MappedResource isolate_snapshot_instructions_;  // JIT snapshot
   std::vector<dart_utils::MappedResource> kernel_peices_;
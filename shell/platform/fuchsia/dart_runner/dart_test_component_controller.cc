@@ -303,28 +303,16 @@ bool DartTestComponentController::SetUpFromAppSnapshot() {
 #if !defined(AOT_RUNTIME)
   return false;
 #else
-  // Load the ELF snapshot as available, and fall back to a blobs snapshot
-  // otherwise.
-  const uint8_t *isolate_data, *isolate_instructions;
-  if (elf_snapshot_.Load(namespace_, data_path_ + "/app_aot_snapshot.so")) {
-    isolate_data = elf_snapshot_.IsolateData();
-    isolate_instructions = elf_snapshot_.IsolateInstrs();
-    if (isolate_data == nullptr || isolate_instructions == nullptr) {
-      return false;
-    }
-  } else {
-    if (!dart_utils::MappedResource::LoadFromNamespace(
-            namespace_, data_path_ + "/isolate_snapshot_data.bin",
-            isolate_snapshot_data_)) {
-      return false;
-    }
-    if (!dart_utils::MappedResource::LoadFromNamespace(
-            namespace_, data_path_ + "/isolate_snapshot_instructions.bin",
-            isolate_snapshot_instructions_, true /* executable */)) {
-      return false;
-    }
+  // The snapshot is shared with the other components of the package that run
+  // in this runner.
+  auto& cache = AppSnapshotCache::GetInstance();
+  app_snapshot_ = cache.Load(AppSnapshotCache::GetPackageHash(url_, namespace_),
+                             namespace_, data_path_);
+  if (!app_snapshot_) {
+    return false;
   }
-  return CreateIsolate(isolate_data, isolate_instructions);
+  return CreateIsolate(app_snapshot_->isolate_data(),
+                       app_snapshot_->isolate_instructions());
 #endif  // defined(AOT_RUNTIME)
 }
 
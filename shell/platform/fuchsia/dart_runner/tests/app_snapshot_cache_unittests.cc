@@ -0,0 +1,45 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "dart_runner/app_snapshot_cache.h"
+
+#include "gtest/gtest.h"
+
+namespace dart_runner::testing {
+namespace {
+
+constexpr char kHash[] =
+    "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+
+}  // namespace
+
+TEST(AppSnapshotCacheTest, GetsThePackageHashFromResolvedUrls) {
+  EXPECT_EQ(AppSnapshotCache::GetPackageHashFromUrl(
+                std::string("fuchsia-pkg://fuchsia.com/hello?hash=") + kHash +
+                "#meta/hello.cm"),
+            kHash);
+  EXPECT_EQ(AppSnapshotCache::GetPackageHashFromUrl(
+                std::string("fuchsia-pkg://fuchsia.com/hello?foo=1&hash=") +
+                kHash),
+            kHash);
+}
+
+TEST(AppSnapshotCacheTest, UrlsWithoutAValidHashHaveNoPackageHash) {
+  EXPECT_EQ(AppSnapshotCache::GetPackageHashFromUrl(
+                "fuchsia-pkg://fuchsia.com/hello#meta/hello.cm"),
+            "");
+  EXPECT_EQ(AppSnapshotCache::GetPackageHashFromUrl(
+                "fuchsia-pkg://fuchsia.com/hello?hash=1234#meta/hello.cm"),
+            "");
+  EXPECT_EQ(AppSnapshotCache::GetPackageHashFromUrl(
+                std::string("fuchsia-pkg://fuchsia.com/hello#meta/hello.cm"
+                            "?hash=") +
+                kHash),
+            "");
+  EXPECT_EQ(AppSnapshotCache::GetPackageHash(
+                "fuchsia-pkg://fuchsia.com/hello#meta/hello.cm", nullptr),
+            "");
+}
+
+}  // namespace dart_runner::testing
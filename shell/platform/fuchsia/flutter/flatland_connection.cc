@@ -6,10 +6,61 @@
 
 #include <zircon/status.h>
 
+#include <algorithm>
+
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
 
 namespace flutter_runner {
 
+namespace {
+
+// The number of past frames whose durations are used to predict the duration
+// of the next frame.
+constexpr size_t kFrameDurationHistorySize = 10;
+
+// The number of started frames that are tracked until they are presented.
+// Frames beyond that were dropped without being presented.
+constexpr size_t kMaxFramesInPipeline = 2;
+
+// Assume a 60hz refresh rate until Flatland reports two presentations.
+constexpr fml::TimeDelta kFallbackPresentationInterval =
+    fml::TimeDelta::FromSecondsF(1.0 / 60.0);
+
+fml::TimePoint TimePointFromNanoseconds(int64_t nanoseconds) {
+  return fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromNanoseconds(nanoseconds));
+}
+
+}  // namespace
+
+FlatlandFrameTimes FlatlandConnection::GetTargetTimes(
+    fml::TimePoint now,
+    fml::TimeDelta predicted_frame_duration,
+    fml::TimePoint last_targeted_presentation,
+    const FuturePresentationInfos& future_presentation_infos) {
+  const fml::TimePoint predicted_frame_end = now + predicted_frame_duration;
+  for (const auto& [latch_point, presentation_time] :
+       future_presentation_infos) {
+    if (latch_point < predicted_frame_end ||
+        presentation_time <= last_targeted_presentation) {
+      continue;
+    }
+    const fml::TimePoint frame_start =
+        std::max(now, latch_point - predicted_frame_duration);
+    TRACE_EVENT2("flutter", "FlatlandConnection::GetTargetTimes",
+                 "latch_point(ms)",
+                 latch_point.ToEpochDelta().ToMilliseconds(),
+                 "frame_start(ms)",
+                 frame_start.ToEpochDelta().ToMilliseconds());
+    return {frame_start, presentation_time, latch_point};
+  }
+
+  // Flatland didn't report a presentation this frame can make. Start it now
+  // and present it as soon as possible.
+  return {now, now + kDefaultFlatlandPresentationInterval, fml::TimePoint()};
+}
+
 FlatlandConnection::FlatlandConnection(
     std::string debug_label,
     fuchsia::ui::composition::FlatlandHandle flatland,
@@ -41,21 +92,92 @@ void FlatlandConnection::Present() {
     std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
     threadsafe_state_.first_present_called_ = true;
   }
-  if (present_credits_ > 0) {
+  RecordFrameDuration(fml::TimePoint::Now());
+  if (present_credits_ > 0 && !ShouldHoldBackPresent(fml::TimePoint::Now())) {
     DoPresent();
   } else {
     present_pending_ = true;
   }
 }
 
+// This method is called from the raster thread.
+bool FlatlandConnection::ShouldHoldBackPresent(fml::TimePoint now) const {
+  if (last_present_latch_point_ <= now) {
+    return false;
+  }
+  TRACE_EVENT_INSTANT1(
+      "flutter", "FlatlandConnection::HoldBackPresent", "latch_point(ms)",
+      last_present_latch_point_.ToEpochDelta().ToMilliseconds());
+  return true;
+}
+
+// This method is called from the raster thread.
+void FlatlandConnection::RecordFrameDuration(fml::TimePoint now) {
+  std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
+  if (threadsafe_state_.frame_starts_.empty()) {
+    return;
+  }
+  const fml::TimePoint frame_start = threadsafe_state_.frame_starts_.front();
+  threadsafe_state_.frame_starts_.pop_front();
+  if (frame_start > now) {
+    return;
+  }
+
+  frame_durations_.push_back(now - frame_start);
+  if (frame_durations_.size() > kFrameDurationHistorySize) {
+    frame_durations_.pop_front();
+  }
+  // Predict the worst of the recent frames, so that a frame that takes a bit
+  // longer than the average still makes its latch point.
+  threadsafe_state_.predicted_frame_duration_ =
+      *std::max_element(frame_durations_.begin(), frame_durations_.end());
+}
+
+// Precondition: |threadsafe_state_.mutex_| is held.
+FlatlandFrameTimes FlatlandConnection::GetNextFrameTimesLocked() {
+  FlatlandFrameTimes times =
+      GetTargetTimes(fml::TimePoint::Now(),
+                     threadsafe_state_.predicted_frame_duration_,
+                     threadsafe_state_.last_targeted_presentation_,
+                     threadsafe_state_.future_presentation_infos_);
+  if (times.latch_point != fml::TimePoint()) {
+    threadsafe_state_.last_targeted_presentation_ = times.frame_target;
+  }
+  threadsafe_state_.frame_starts_.push_back(times.frame_start);
+  if (threadsafe_state_.frame_starts_.size() > kMaxFramesInPipeline) {
+    threadsafe_state_.frame_starts_.pop_front();
+  }
+  return times;
+}
+
 // This method is called from the raster thread.
 void FlatlandConnection::DoPresent() {
   FML_CHECK(present_credits_ > 0);
   --present_credits_;
 
+  // Target the first latch point that has not passed yet. Flatland presents
+  // the update as soon as possible if none is known.
+  const fml::TimePoint now = fml::TimePoint::Now();
+  fml::TimePoint latch_point;
+  fml::TimePoint presentation_time;
+  {
+    std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
+    for (const auto& info : threadsafe_state_.future_presentation_infos_) {
+      if (info.first > now && info.first > last_present_latch_point_) {
+        latch_point = info.first;
+        presentation_time = info.second;
+        break;
+      }
+    }
+  }
+  TRACE_EVENT1("flutter", "FlatlandConnection::DoPresent", "latch_point(ms)",
+               latch_point.ToEpochDelta().ToMilliseconds());
+  last_present_latch_point_ = latch_point;
+  presentation_targets_.push_back(presentation_time);
+
   fuchsia::ui::composition::PresentArgs present_args;
-  // TODO(fxbug.dev/94000): compute a better presentation time;
-  present_args.set_requested_presentation_time(0);
+  present_args.set_requested_presentation_time(
+      latch_point.ToEpochDelta().ToNanoseconds());
   present_args.set_acquire_fences(std::move(acquire_fences_));
   present_args.set_release_fences(std::move(previous_present_release_fences_));
   present_args.set_unsquashable(false);
@@ -85,10 +207,8 @@ void FlatlandConnection::AwaitVsync(FireCallbackCallback callback) {
   threadsafe_state_.fire_callback_ = callback;
 
   if (threadsafe_state_.fire_callback_pending_) {
-    fml::TimePoint now = fml::TimePoint::Now();
-    // TODO(fxbug.dev/94000): Calculate correct frame times.
-    threadsafe_state_.fire_callback_(
-        now, now + kDefaultFlatlandPresentationInterval);
+    FlatlandFrameTimes times = GetNextFrameTimesLocked();
+    threadsafe_state_.fire_callback_(times.frame_start, times.frame_target);
     threadsafe_state_.fire_callback_ = nullptr;
     threadsafe_state_.fire_callback_pending_ = false;
   }
@@ -112,6 +232,17 @@ void FlatlandConnection::OnNextFrameBegin(
     fuchsia::ui::composition::OnNextFrameBeginValues values) {
   present_credits_ += values.additional_present_credits();
 
+  if (values.has_future_presentation_infos() &&
+      !values.future_presentation_infos().empty()) {
+    std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
+    threadsafe_state_.future_presentation_infos_.clear();
+    for (const auto& info : values.future_presentation_infos()) {
+      threadsafe_state_.future_presentation_infos_.push_back(
+          {TimePointFromNanoseconds(info.latch_point()),
+           TimePointFromNanoseconds(info.presentation_time())});
+    }
+  }
+
   if (present_pending_ && present_credits_ > 0) {
     DoPresent();
     present_pending_ = false;
@@ -120,10 +251,8 @@ void FlatlandConnection::OnNextFrameBegin(
   if (present_credits_ > 0) {
     std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
     if (threadsafe_state_.fire_callback_) {
-      fml::TimePoint now = fml::TimePoint::Now();
-      // TODO(fxbug.dev/94000): Calculate correct frame times.
-      threadsafe_state_.fire_callback_(
-          now, now + kDefaultFlatlandPresentationInterval);
+      FlatlandFrameTimes times = GetNextFrameTimesLocked();
+      threadsafe_state_.fire_callback_(times.frame_start, times.frame_target);
       threadsafe_state_.fire_callback_ = nullptr;
     } else {
       threadsafe_state_.fire_callback_pending_ = true;
@@ -134,6 +263,33 @@ void FlatlandConnection::OnNextFrameBegin(
 // This method is called from the raster thread.
 void FlatlandConnection::OnFramePresented(
     fuchsia::scenic::scheduling::FramePresentedInfo info) {
+  const fml::TimePoint actual_presentation_time =
+      TimePointFromNanoseconds(info.actual_presentation_time);
+  fml::TimeDelta presentation_interval = kFallbackPresentationInterval;
+  {
+    std::scoped_lock<std::mutex> lock(threadsafe_state_.mutex_);
+    const auto& infos = threadsafe_state_.future_presentation_infos_;
+    if (infos.size() >= 2) {
+      presentation_interval = infos[1].second - infos[0].second;
+    }
+  }
+
+  // A present that is displayed later than the presentation it targeted
+  // missed the latch point of that presentation.
+  for (size_t i = 0;
+       i < info.presentation_infos.size() && !presentation_targets_.empty();
+       ++i) {
+    const fml::TimePoint target = presentation_targets_.front();
+    presentation_targets_.pop_front();
+    if (target != fml::TimePoint() &&
+        actual_presentation_time > target + presentation_interval / 2) {
+      TRACE_EVENT_INSTANT2(
+          "flutter", "FlatlandConnection::MissedLatch", "target(ms)",
+          target.ToEpochDelta().ToMilliseconds(), "actual(ms)",
+          actual_presentation_time.ToEpochDelta().ToMilliseconds());
+    }
+  }
+
   on_frame_presented_callback_(std::move(info));
 }
 
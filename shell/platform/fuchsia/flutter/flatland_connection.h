@@ -14,8 +14,10 @@
 #include "vsync_waiter.h"
 
 #include <cstdint>
+#include <deque>
 #include <mutex>
 #include <string>
+#include <utility>
 
 namespace flutter_runner {
 
@@ -26,10 +28,34 @@ using on_frame_presented_event =
 static constexpr fml::TimeDelta kDefaultFlatlandPresentationInterval =
     fml::TimeDelta::FromSecondsF(0);
 
+// Pairs of latch points and the presentation times they lead to, as reported
+// by Flatland in |OnNextFrameBegin|.
+using FuturePresentationInfos =
+    std::deque<std::pair<fml::TimePoint, fml::TimePoint>>;
+
+struct FlatlandFrameTimes {
+  fml::TimePoint frame_start;
+  fml::TimePoint frame_target;
+  // The latch point the frame has to be presented by to be displayed at
+  // |frame_target|, or fml::TimePoint() if it isn't known.
+  fml::TimePoint latch_point;
+};
+
 // The component residing on the raster thread that is responsible for
 // maintaining the Flatland instance connection and presenting updates.
 class FlatlandConnection final {
  public:
+  // Returns the times of a frame that is requested at |now| and is predicted
+  // to take |predicted_frame_duration| to build and rasterize. The frame
+  // targets the first presentation after |last_targeted_presentation| whose
+  // latch point it can make, and starts as late as it can while still making
+  // that latch point.
+  static FlatlandFrameTimes GetTargetTimes(
+      fml::TimePoint now,
+      fml::TimeDelta predicted_frame_duration,
+      fml::TimePoint last_targeted_presentation,
+      const FuturePresentationInfos& future_presentation_infos);
+
   FlatlandConnection(std::string debug_label,
                      fuchsia::ui::composition::FlatlandHandle flatland,
                      fml::closure error_callback,
@@ -68,6 +94,19 @@ class FlatlandConnection final {
   void OnFramePresented(fuchsia::scenic::scheduling::FramePresentedInfo info);
   void DoPresent();
 
+  // Whether a present that was already made for a latch point that has not
+  // passed yet should keep this one from being made until the next
+  // |OnNextFrameBegin|. Presenting it now would only queue it behind the
+  // previous one.
+  bool ShouldHoldBackPresent(fml::TimePoint now) const;
+
+  // Records how long the oldest frame that wasn't presented yet took from its
+  // start to its present.
+  void RecordFrameDuration(fml::TimePoint now);
+
+  // Precondition: |threadsafe_state_.mutex_| is held.
+  FlatlandFrameTimes GetNextFrameTimesLocked();
+
   fuchsia::ui::composition::FlatlandPtr flatland_;
 
   fml::closure error_callback_;
@@ -79,6 +118,16 @@ class FlatlandConnection final {
   uint32_t present_credits_ = 1;
   bool present_pending_ = false;
 
+  // The latch point targeted by the last present.
+  fml::TimePoint last_present_latch_point_;
+
+  // The presentation times targeted by the presents that were not presented
+  // yet, used to detect the presents that missed their latch point.
+  std::deque<fml::TimePoint> presentation_targets_;
+
+  // The durations of the last frames, from their start to their present.
+  std::deque<fml::TimeDelta> frame_durations_;
+
   // This struct contains state that is accessed from both from the UI thread
   // (in AwaitVsync) and the raster thread (in OnNextFrameBegin and Present).
   // You should always lock mutex_ before touching anything in this struct
@@ -87,6 +136,11 @@ class FlatlandConnection final {
     FireCallbackCallback fire_callback_;
     bool fire_callback_pending_ = false;
     bool first_present_called_ = false;
+    FuturePresentationInfos future_presentation_infos_;
+    fml::TimeDelta predicted_frame_duration_;
+    fml::TimePoint last_targeted_presentation_;
+    // The start times of the frames that were started but not presented yet.
+    std::deque<fml::TimePoint> frame_starts_;
   } threadsafe_state_;
 
   std::vector<zx::event> acquire_fences_;
@@ -69,6 +69,28 @@ class FlatlandConnectionTest : public ::testing::Test {
         std::move(on_next_frame_begin_values));
   }
 
+  // OnNextFrameBegin that also reports the latch points and presentation
+  // times of the next frames.
+  void OnNextFrameBegin(int num_present_credits,
+                        const FuturePresentationInfos& infos) {
+    fuchsia::ui::composition::OnNextFrameBeginValues on_next_frame_begin_values;
+    on_next_frame_begin_values.set_additional_present_credits(
+        num_present_credits);
+    std::vector<fuchsia::scenic::scheduling::PresentationInfo>
+        presentation_infos;
+    for (const auto& [latch_point, presentation_time] : infos) {
+      fuchsia::scenic::scheduling::PresentationInfo info;
+      info.set_latch_point(latch_point.ToEpochDelta().ToNanoseconds());
+      info.set_presentation_time(
+          presentation_time.ToEpochDelta().ToNanoseconds());
+      presentation_infos.push_back(std::move(info));
+    }
+    on_next_frame_begin_values.set_future_presentation_infos(
+        std::move(presentation_infos));
+    fake_flatland().FireOnNextFrameBeginEvent(
+        std::move(on_next_frame_begin_values));
+  }
+
  private:
   async::TestLoop loop_;
   std::unique_ptr<async::LoopInterface> session_subloop_;
@@ -456,4 +478,94 @@ TEST_F(FlatlandConnectionTest, PresentCreditExhaustion) {
   EXPECT_EQ(num_release_fences, num_onfb);
 }
 
+TEST(FlatlandConnectionGetTargetTimesTest, PresentsAsSoonAsPossibleByDefault) {
+  const fml::TimePoint now = fml::TimePoint::Now();
+  FlatlandFrameTimes times = FlatlandConnection::GetTargetTimes(
+      now, fml::TimeDelta::FromMilliseconds(8), fml::TimePoint(), {});
+  EXPECT_EQ(times.frame_start, now);
+  EXPECT_EQ(times.frame_target, now + kDefaultFlatlandPresentationInterval);
+  EXPECT_EQ(times.latch_point, fml::TimePoint());
+}
+
+TEST(FlatlandConnectionGetTargetTimesTest, TargetsTheFirstLatchPointItCanMake) {
+  const fml::TimePoint now = fml::TimePoint::Now();
+  const auto ms = [](int64_t value) {
+    return fml::TimeDelta::FromMilliseconds(value);
+  };
+  const FuturePresentationInfos infos = {
+      {now + ms(5), now + ms(10)},
+      {now + ms(21), now + ms(26)},
+      {now + ms(37), now + ms(42)},
+  };
+
+  // The first latch point is too close to make it, so the frame targets the
+  // second one and starts as late as it can.
+  FlatlandFrameTimes times =
+      FlatlandConnection::GetTargetTimes(now, ms(8), fml::TimePoint(), infos);
+  EXPECT_EQ(times.latch_point, now + ms(21));
+  EXPECT_EQ(times.frame_target, now + ms(26));
+  EXPECT_EQ(times.frame_start, now + ms(13));
+
+  // A frame that is predicted to take longer than the time until the latch
+  // point starts right away.
+  times =
+      FlatlandConnection::GetTargetTimes(now, ms(18), fml::TimePoint(), infos);
+  EXPECT_EQ(times.latch_point, now + ms(21));
+  EXPECT_EQ(times.frame_start, now + ms(3));
+
+  // Presentations that were already targeted are skipped.
+  times = FlatlandConnection::GetTargetTimes(now, ms(8), now + ms(26), infos);
+  EXPECT_EQ(times.latch_point, now + ms(37));
+  EXPECT_EQ(times.frame_target, now + ms(42));
+}
+
+TEST_F(FlatlandConnectionTest, PresentsTargetLatchPointsAndAreHeldBack) {
+  std::vector<int64_t> requested_presentation_times;
+  fake_flatland().SetPresentHandler(
+      [&requested_presentation_times](auto present_args) {
+        requested_presentation_times.push_back(
+            present_args.requested_presentation_time());
+      });
+
+  flutter_runner::FlatlandConnection flatland_connection(
+      GetCurrentTestName(), TakeFlatlandHandle(), []() { FAIL(); },
+      [](auto...) {}, 1, fml::TimeDelta::Zero());
+  loop().RunUntilIdle();
+
+  // Report latch points far enough in the future for the test to make them.
+  const fml::TimePoint now = fml::TimePoint::Now();
+  const fml::TimePoint first_latch_point =
+      now + fml::TimeDelta::FromSeconds(100);
+  const fml::TimePoint second_latch_point =
+      now + fml::TimeDelta::FromSeconds(200);
+  OnNextFrameBegin(1, {
+                          {first_latch_point, first_latch_point},
+                          {second_latch_point, second_latch_point},
+                      });
+  loop().RunUntilIdle();
+
+  flatland_connection.Present();
+  loop().RunUntilIdle();
+  ASSERT_EQ(requested_presentation_times.size(), 1u);
+  EXPECT_EQ(requested_presentation_times[0],
+            first_latch_point.ToEpochDelta().ToNanoseconds());
+
+  // The first present has not been latched yet, so the second one is held
+  // back even though there are present credits left.
+  flatland_connection.Present();
+  loop().RunUntilIdle();
+  EXPECT_EQ(requested_presentation_times.size(), 1u);
+
+  // The next OnNextFrameBegin lets the held back present target the next
+  // latch point.
+  OnNextFrameBegin(0, {
+                          {first_latch_point, first_latch_point},
+                          {second_latch_point, second_latch_point},
+                      });
+  loop().RunUntilIdle();
+  ASSERT_EQ(requested_presentation_times.size(), 2u);
+  EXPECT_EQ(requested_presentation_times[1],
+            second_latch_point.ToEpochDelta().ToNanoseconds());
+}
+
 }  // namespace flutter_runner::testing
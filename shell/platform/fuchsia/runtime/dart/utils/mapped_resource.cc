@@ -69,6 +69,18 @@ bool MappedResource::LoadFromNamespace(fdio_ns_t* namespc,
          LoadFromVmo(path, std::move(resource_vmo), resource, executable);
 }
 
+bool MappedResource::LoadFromDir(int dirfd,
+                                 const std::string& path,
+                                 MappedResource& resource,
+                                 bool executable) {
+  TRACE_DURATION("dart", "LoadFromDir", "path", path);
+
+  fuchsia::mem::Buffer resource_vmo;
+  return dart_utils::VmoFromFilenameAt(dirfd, path, executable,
+                                       &resource_vmo) &&
+         LoadFromVmo(path, std::move(resource_vmo), resource, executable);
+}
+
 bool MappedResource::LoadFromVmo(const std::string& path,
                                  fuchsia::mem::Buffer resource_vmo,
                                  MappedResource& resource,
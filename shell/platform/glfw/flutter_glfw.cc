@@ -1170,6 +1170,17 @@ void FlutterDesktopMessengerSetCallback(FlutterDesktopMessengerRef messenger,
       channel, callback, user_data);
 }
 
+void FlutterDesktopMessengerSetCallbackOnTaskQueue(
+    FlutterDesktopMessengerRef messenger,
+    const char* channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data,
+    FlutterDesktopMessengerTaskQueue task_queue,
+    void* task_queue_user_data) {
+  messenger->GetEngine()->message_dispatcher->SetMessageCallback(
+      channel, callback, user_data, task_queue, task_queue_user_data);
+}
+
 FlutterDesktopTextureRegistrarRef FlutterDesktopRegistrarGetTextureRegistrar(
     FlutterDesktopPluginRegistrarRef registrar) {
   std::cerr << "GLFW Texture support is not implemented yet." << std::endl;
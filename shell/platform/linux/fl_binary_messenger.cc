@@ -101,6 +101,62 @@ static void fl_binary_messenger_response_handle_impl_class_init(
 static void fl_binary_messenger_response_handle_impl_init(
     FlBinaryMessengerResponseHandleImpl* self) {}
 
+struct _FlBinaryMessengerTaskQueue {
+  GObject parent_instance;
+
+  // Single thread pool that runs the tasks in order.
+  GThreadPool* thread_pool;
+};
+
+G_DEFINE_TYPE(FlBinaryMessengerTaskQueue,
+              fl_binary_messenger_task_queue,
+              G_TYPE_OBJECT)
+
+typedef struct {
+  GFunc function;
+  gpointer data;
+} TaskQueueTask;
+
+static void task_queue_run_cb(gpointer data, gpointer user_data) {
+  TaskQueueTask* task = static_cast<TaskQueueTask*>(data);
+  task->function(task->data, nullptr);
+  g_free(task);
+}
+
+static void fl_binary_messenger_task_queue_dispose(GObject* object) {
+  FlBinaryMessengerTaskQueue* self = FL_BINARY_MESSENGER_TASK_QUEUE(object);
+
+  // Runs the remaining tasks before the thread is stopped.
+  if (self->thread_pool != nullptr) {
+    g_thread_pool_free(self->thread_pool, FALSE, TRUE);
+    self->thread_pool = nullptr;
+  }
+
+  G_OBJECT_CLASS(fl_binary_messenger_task_queue_parent_class)->dispose(object);
+}
+
+static void fl_binary_messenger_task_queue_class_init(
+    FlBinaryMessengerTaskQueueClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = fl_binary_messenger_task_queue_dispose;
+}
+
+static void fl_binary_messenger_task_queue_init(
+    FlBinaryMessengerTaskQueue* self) {
+  self->thread_pool =
+      g_thread_pool_new(task_queue_run_cb, nullptr, 1, FALSE, nullptr);
+}
+
+// Runs @function with @data on the thread of the task queue.
+static void task_queue_push(FlBinaryMessengerTaskQueue* self,
+                            GFunc function,
+                            gpointer data) {
+  TaskQueueTask* task =
+      static_cast<TaskQueueTask*>(g_malloc0(sizeof(TaskQueueTask)));
+  task->function = function;
+  task->data = data;
+  g_thread_pool_push(self->thread_pool, task, nullptr);
+}
+
 static FlBinaryMessengerResponseHandleImpl*
 fl_binary_messenger_response_handle_impl_new(
     FlBinaryMessengerImpl* messenger,
@@ -116,31 +172,90 @@ fl_binary_messenger_response_handle_impl_new(
 }
 
 typedef struct {
+  // Handlers are referenced by the messages queued on their task queue, so
+  // they outlive being replaced on the channel until those are handled.
+  gint ref_count;
+
   FlBinaryMessengerMessageHandler message_handler;
   gpointer message_handler_data;
   GDestroyNotify message_handler_destroy_notify;
+
+  // Queue to call the handler on, or nullptr for the main thread.
+  FlBinaryMessengerTaskQueue* task_queue;
 } PlatformMessageHandler;
 
 static PlatformMessageHandler* platform_message_handler_new(
     FlBinaryMessengerMessageHandler handler,
     gpointer user_data,
-    GDestroyNotify destroy_notify) {
+    GDestroyNotify destroy_notify,
+    FlBinaryMessengerTaskQueue* task_queue) {
   PlatformMessageHandler* self = static_cast<PlatformMessageHandler*>(
       g_malloc0(sizeof(PlatformMessageHandler)));
+  self->ref_count = 1;
   self->message_handler = handler;
   self->message_handler_data = user_data;
   self->message_handler_destroy_notify = destroy_notify;
+  if (task_queue != nullptr) {
+    self->task_queue =
+        FL_BINARY_MESSENGER_TASK_QUEUE(g_object_ref(task_queue));
+  }
+  return self;
+}
+
+static PlatformMessageHandler* platform_message_handler_ref(
+    PlatformMessageHandler* self) {
+  g_atomic_int_inc(&self->ref_count);
   return self;
 }
 
-static void platform_message_handler_free(gpointer data) {
+static void platform_message_handler_unref(gpointer data) {
   PlatformMessageHandler* self = static_cast<PlatformMessageHandler*>(data);
+  if (!g_atomic_int_dec_and_test(&self->ref_count)) {
+    return;
+  }
   if (self->message_handler_destroy_notify) {
     self->message_handler_destroy_notify(self->message_handler_data);
   }
+  g_clear_object(&self->task_queue);
   g_free(self);
 }
 
+// A message waiting to be handled on a task queue.
+typedef struct {
+  FlBinaryMessengerImpl* messenger;
+
+  // Keeps the engine alive so the handler can respond from the task queue.
+  FlEngine* engine;
+
+  PlatformMessageHandler* handler;
+  gchar* channel;
+  GBytes* message;
+  FlBinaryMessengerResponseHandleImpl* response_handle;
+} PlatformMessageTask;
+
+// Releases a PlatformMessageTask on the main thread, where the engine and the
+// user data of the handler are released.
+static gboolean platform_message_task_free_cb(gpointer user_data) {
+  PlatformMessageTask* task = static_cast<PlatformMessageTask*>(user_data);
+  g_clear_object(&task->response_handle);
+  g_clear_pointer(&task->handler, platform_message_handler_unref);
+  g_clear_object(&task->engine);
+  g_clear_object(&task->messenger);
+  g_clear_pointer(&task->channel, g_free);
+  g_clear_pointer(&task->message, g_bytes_unref);
+  g_free(task);
+  return G_SOURCE_REMOVE;
+}
+
+static void platform_message_task_run_cb(gpointer data, gpointer user_data) {
+  PlatformMessageTask* task = static_cast<PlatformMessageTask*>(data);
+  task->handler->message_handler(
+      FL_BINARY_MESSENGER(task->messenger), task->channel, task->message,
+      FL_BINARY_MESSENGER_RESPONSE_HANDLE(task->response_handle),
+      task->handler->message_handler_data);
+  g_idle_add(platform_message_task_free_cb, task);
+}
+
 static void engine_weak_notify_cb(gpointer user_data,
                                   GObject* where_the_object_was) {
   FlBinaryMessengerImpl* self = FL_BINARY_MESSENGER_IMPL(user_data);
@@ -150,7 +265,7 @@ static void engine_weak_notify_cb(gpointer user_data,
   // Take the reference in case a handler tries to modify this table.
   g_autoptr(GHashTable) handlers = self->platform_message_handlers;
   self->platform_message_handlers = g_hash_table_new_full(
-      g_str_hash, g_str_equal, g_free, platform_message_handler_free);
+      g_str_hash, g_str_equal, g_free, platform_message_handler_unref);
   g_hash_table_remove_all(handlers);
 }
 
@@ -170,6 +285,21 @@ static gboolean fl_binary_messenger_platform_message_cb(
 
   g_autoptr(FlBinaryMessengerResponseHandleImpl) handle =
       fl_binary_messenger_response_handle_impl_new(self, response_handle);
+
+  if (handler->task_queue != nullptr) {
+    PlatformMessageTask* task = static_cast<PlatformMessageTask*>(
+        g_malloc0(sizeof(PlatformMessageTask)));
+    task->messenger = FL_BINARY_MESSENGER_IMPL(g_object_ref(self));
+    task->engine = FL_ENGINE(g_object_ref(engine));
+    task->handler = platform_message_handler_ref(handler);
+    task->channel = g_strdup(channel);
+    task->message = g_bytes_ref(message);
+    task->response_handle =
+        FL_BINARY_MESSENGER_RESPONSE_HANDLE_IMPL(g_object_ref(handle));
+    task_queue_push(handler->task_queue, platform_message_task_run_cb, task);
+    return TRUE;
+  }
+
   handler->message_handler(FL_BINARY_MESSENGER(self), channel, message,
                            FL_BINARY_MESSENGER_RESPONSE_HANDLE(handle),
                            handler->message_handler_data);
@@ -190,12 +320,13 @@ static void fl_binary_messenger_impl_dispose(GObject* object) {
   G_OBJECT_CLASS(fl_binary_messenger_impl_parent_class)->dispose(object);
 }
 
-static void set_message_handler_on_channel(
+static void set_message_handler_on_channel_with_task_queue(
     FlBinaryMessenger* messenger,
     const gchar* channel,
     FlBinaryMessengerMessageHandler handler,
     gpointer user_data,
-    GDestroyNotify destroy_notify) {
+    GDestroyNotify destroy_notify,
+    FlBinaryMessengerTaskQueue* task_queue) {
   FlBinaryMessengerImpl* self = FL_BINARY_MESSENGER_IMPL(messenger);
 
   // Don't set handlers if engine already gone.
@@ -212,14 +343,24 @@ static void set_message_handler_on_channel(
   }
 
   if (handler != nullptr) {
-    g_hash_table_replace(
-        self->platform_message_handlers, g_strdup(channel),
-        platform_message_handler_new(handler, user_data, destroy_notify));
+    g_hash_table_replace(self->platform_message_handlers, g_strdup(channel),
+                         platform_message_handler_new(
+                             handler, user_data, destroy_notify, task_queue));
   } else {
     g_hash_table_remove(self->platform_message_handlers, channel);
   }
 }
 
+static void set_message_handler_on_channel(
+    FlBinaryMessenger* messenger,
+    const gchar* channel,
+    FlBinaryMessengerMessageHandler handler,
+    gpointer user_data,
+    GDestroyNotify destroy_notify) {
+  set_message_handler_on_channel_with_task_queue(
+      messenger, channel, handler, user_data, destroy_notify, nullptr);
+}
+
 static gboolean send_response(FlBinaryMessenger* messenger,
                               FlBinaryMessengerResponseHandle* response_handle_,
                               GBytes* response,
@@ -305,11 +446,13 @@ static void fl_binary_messenger_impl_iface_init(
   iface->send_response = send_response;
   iface->send_on_channel = send_on_channel;
   iface->send_on_channel_finish = send_on_channel_finish;
+  iface->set_message_handler_on_channel_with_task_queue =
+      set_message_handler_on_channel_with_task_queue;
 }
 
 static void fl_binary_messenger_impl_init(FlBinaryMessengerImpl* self) {
   self->platform_message_handlers = g_hash_table_new_full(
-      g_str_hash, g_str_equal, g_free, platform_message_handler_free);
+      g_str_hash, g_str_equal, g_free, platform_message_handler_unref);
 }
 
 FlBinaryMessenger* fl_binary_messenger_new(FlEngine* engine) {
@@ -343,6 +486,37 @@ G_MODULE_EXPORT void fl_binary_messenger_set_message_handler_on_channel(
       self, channel, handler, user_data, destroy_notify);
 }
 
+G_MODULE_EXPORT FlBinaryMessengerTaskQueue*
+fl_binary_messenger_task_queue_new() {
+  return FL_BINARY_MESSENGER_TASK_QUEUE(
+      g_object_new(fl_binary_messenger_task_queue_get_type(), nullptr));
+}
+
+G_MODULE_EXPORT void
+fl_binary_messenger_set_message_handler_on_channel_with_task_queue(
+    FlBinaryMessenger* self,
+    const gchar* channel,
+    FlBinaryMessengerMessageHandler handler,
+    gpointer user_data,
+    GDestroyNotify destroy_notify,
+    FlBinaryMessengerTaskQueue* task_queue) {
+  g_return_if_fail(FL_IS_BINARY_MESSENGER(self));
+  g_return_if_fail(channel != nullptr);
+  g_return_if_fail(task_queue == nullptr ||
+                   FL_IS_BINARY_MESSENGER_TASK_QUEUE(task_queue));
+
+  FlBinaryMessengerInterface* iface = FL_BINARY_MESSENGER_GET_IFACE(self);
+  if (task_queue == nullptr ||
+      iface->set_message_handler_on_channel_with_task_queue == nullptr) {
+    iface->set_message_handler_on_channel(self, channel, handler, user_data,
+                                          destroy_notify);
+    return;
+  }
+
+  iface->set_message_handler_on_channel_with_task_queue(
+      self, channel, handler, user_data, destroy_notify, task_queue);
+}
+
 G_MODULE_EXPORT gboolean fl_binary_messenger_send_response(
     FlBinaryMessenger* self,
     FlBinaryMessengerResponseHandle* response_handle,
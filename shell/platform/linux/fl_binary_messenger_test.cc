@@ -384,3 +384,43 @@ TEST(FlBinaryMessengerTest, ReceiveMessage) {
   // Blocks here until response_cb is called.
   g_main_loop_run(loop);
 }
+
+// Called when a message is received from the engine in the
+// ReceiveMessageOnTaskQueue test.
+static void task_queue_message_cb(
+    FlBinaryMessenger* messenger,
+    const gchar* channel,
+    GBytes* message,
+    FlBinaryMessengerResponseHandle* response_handle,
+    gpointer user_data) {
+  EXPECT_NE(g_thread_self(), static_cast<GThread*>(user_data));
+  message_cb(messenger, channel, message, response_handle, nullptr);
+}
+
+// Checks the shell can receive and respond to messages on a task queue.
+TEST(FlBinaryMessengerTest, ReceiveMessageOnTaskQueue) {
+  g_autoptr(GMainLoop) loop = g_main_loop_new(nullptr, 0);
+
+  g_autoptr(FlEngine) engine = make_mock_engine();
+  FlBinaryMessenger* messenger = fl_binary_messenger_new(engine);
+  g_autoptr(FlBinaryMessengerTaskQueue) task_queue =
+      fl_binary_messenger_task_queue_new();
+
+  // Listen for messages from the engine on the task queue.
+  fl_binary_messenger_set_message_handler_on_channel_with_task_queue(
+      messenger, "test/messages", task_queue_message_cb, g_thread_self(),
+      nullptr, task_queue);
+
+  // Listen for response from the engine.
+  fl_binary_messenger_set_message_handler_on_channel(
+      messenger, "test/responses", response_cb, loop, nullptr);
+
+  // Trigger the engine to send a message.
+  const char* text = "Marco!";
+  g_autoptr(GBytes) message = g_bytes_new(text, strlen(text));
+  fl_binary_messenger_send_on_channel(messenger, "test/send-message", message,
+                                      nullptr, nullptr, nullptr);
+
+  // Blocks here until response_cb is called.
+  g_main_loop_run(loop);
+}
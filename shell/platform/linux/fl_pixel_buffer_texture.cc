@@ -7,10 +7,28 @@
 #include <epoxy/gl.h>
 #include <gmodule.h>
 
+#include <cstring>
+
 #include "flutter/shell/platform/linux/fl_pixel_buffer_texture_private.h"
 
+// The number of pixel buffer objects that uploads rotate through. A frame is
+// written into one buffer while the GPU is still copying the previous frames
+// out of the others.
+static constexpr size_t kPixelBufferCount = 3;
+
 typedef struct {
   GLuint texture_id;
+
+  // Size the storage of the texture was allocated with.
+  uint32_t texture_width;
+  uint32_t texture_height;
+
+  // Pixel buffer objects used to upload the pixels asynchronously, their
+  // sizes and fences signalled when the GPU has finished reading them.
+  GLuint pixel_buffers[kPixelBufferCount];
+  size_t pixel_buffer_sizes[kPixelBufferCount];
+  GLsync pixel_buffer_fences[kPixelBufferCount];
+  size_t next_pixel_buffer;
 } FlPixelBufferTexturePrivate;
 
 // Added here to stop the compiler from optimising this function away.
@@ -36,6 +54,16 @@ static void fl_pixel_buffer_texture_dispose(GObject* object) {
     glDeleteTextures(1, &priv->texture_id);
     priv->texture_id = 0;
   }
+  for (size_t i = 0; i < kPixelBufferCount; i++) {
+    if (priv->pixel_buffer_fences[i] != nullptr) {
+      glDeleteSync(priv->pixel_buffer_fences[i]);
+      priv->pixel_buffer_fences[i] = nullptr;
+    }
+  }
+  if (priv->pixel_buffers[0] != 0) {
+    glDeleteBuffers(kPixelBufferCount, priv->pixel_buffers);
+    memset(priv->pixel_buffers, 0, sizeof(priv->pixel_buffers));
+  }
 
   G_OBJECT_CLASS(fl_pixel_buffer_texture_parent_class)->dispose(object);
 }
@@ -47,6 +75,69 @@ static void check_gl_error(int line) {
   }
 }
 
+// Returns TRUE if the context supports mapping pixel buffer objects and
+// fences, which are core in OpenGL 3.2 and OpenGL ES 3.0.
+static gboolean supports_pixel_buffer_objects() {
+  return epoxy_gl_version() >= (epoxy_is_desktop_gl() ? 32 : 30);
+}
+
+// Uploads the pixels to the bound texture through the next pixel buffer
+// object. The copy into the texture then happens asynchronously on the GPU
+// instead of blocking in glTexSubImage2D.
+static gboolean upload_with_pixel_buffer(FlPixelBufferTexturePrivate* priv,
+                                         const uint8_t* buffer,
+                                         uint32_t width,
+                                         uint32_t height) {
+  if (priv->pixel_buffers[0] == 0) {
+    glGenBuffers(kPixelBufferCount, priv->pixel_buffers);
+    check_gl_error(__LINE__);
+  }
+
+  size_t index = priv->next_pixel_buffer;
+  priv->next_pixel_buffer = (index + 1) % kPixelBufferCount;
+
+  // Wait for the upload that last used this buffer. It was submitted
+  // kPixelBufferCount - 1 frames ago, so this rarely blocks.
+  if (priv->pixel_buffer_fences[index] != nullptr) {
+    glClientWaitSync(priv->pixel_buffer_fences[index],
+                     GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    glDeleteSync(priv->pixel_buffer_fences[index]);
+    priv->pixel_buffer_fences[index] = nullptr;
+  }
+
+  size_t size = static_cast<size_t>(width) * height * 4;
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, priv->pixel_buffers[index]);
+  check_gl_error(__LINE__);
+  if (priv->pixel_buffer_sizes[index] != size) {
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    check_gl_error(__LINE__);
+    priv->pixel_buffer_sizes[index] = size;
+  }
+
+  // The fence above guarantees the GPU is no longer reading the buffer.
+  void* mapped = glMapBufferRange(
+      GL_PIXEL_UNPACK_BUFFER, 0, size,
+      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT |
+          GL_MAP_UNSYNCHRONIZED_BIT);
+  if (mapped == nullptr) {
+    check_gl_error(__LINE__);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return FALSE;
+  }
+  memcpy(mapped, buffer, size);
+  glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+  check_gl_error(__LINE__);
+
+  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA,
+                  GL_UNSIGNED_BYTE, nullptr);
+  check_gl_error(__LINE__);
+  priv->pixel_buffer_fences[index] =
+      glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  return TRUE;
+}
+
 gboolean fl_pixel_buffer_texture_populate(FlPixelBufferTexture* texture,
                                           uint32_t width,
                                           uint32_t height,
@@ -80,9 +171,22 @@ gboolean fl_pixel_buffer_texture_populate(FlPixelBufferTexture* texture,
     glBindTexture(GL_TEXTURE_2D, priv->texture_id);
     check_gl_error(__LINE__);
   }
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA,
-               GL_UNSIGNED_BYTE, buffer);
-  check_gl_error(__LINE__);
+
+  // Only reallocate the storage of the texture when the size changes.
+  if (width != priv->texture_width || height != priv->texture_height) {
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+    check_gl_error(__LINE__);
+    priv->texture_width = width;
+    priv->texture_height = height;
+  }
+
+  if (!supports_pixel_buffer_objects() ||
+      !upload_with_pixel_buffer(priv, buffer, width, height)) {
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA,
+                    GL_UNSIGNED_BYTE, buffer);
+    check_gl_error(__LINE__);
+  }
 
   opengl_texture->target = GL_TEXTURE_2D;
   opengl_texture->name = priv->texture_id;
@@ -4,6 +4,7 @@
 
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_standard_message_codec.h"
 #include "flutter/shell/platform/linux/fl_standard_message_codec_private.h"
+#include "flutter/shell/platform/linux/fl_value_private.h"
 
 #include <gmodule.h>
 
@@ -67,13 +68,102 @@ static void write_float64(GByteArray* buffer, double value) {
                       sizeof(double));
 }
 
+// Returns the number of padding bytes needed to align @offset to @align
+// multiple of bytes.
+static size_t get_padding(size_t offset, size_t align) {
+  return (align - offset % align) % align;
+}
+
 // Write padding bytes to align to @align multiple of bytes.
 static void write_align(GByteArray* buffer, guint align) {
-  while (buffer->len % align != 0) {
-    write_uint8(buffer, 0);
+  static constexpr uint8_t kPadding[8] = {};
+  g_assert(align <= sizeof(kPadding));
+  g_byte_array_append(buffer, kPadding, get_padding(buffer->len, align));
+}
+
+// Returns the number of bytes that a size field of @size is encoded in.
+static size_t get_size_size(uint32_t size) {
+  if (size < 254) {
+    return sizeof(uint8_t);
+  } else if (size <= 0xffff) {
+    return sizeof(uint8_t) + sizeof(uint16_t);
+  } else {
+    return sizeof(uint8_t) + sizeof(uint32_t);
   }
 }
 
+// Returns the offset after a typed list of @length elements of @element_size
+// bytes written at @offset.
+static size_t get_typed_list_end(size_t offset,
+                                 size_t length,
+                                 size_t element_size) {
+  offset += sizeof(uint8_t) + get_size_size(length);
+  offset += get_padding(offset, element_size);
+  return offset + element_size * length;
+}
+
+// Returns the offset after @value when encoded at @offset. This is used to
+// allocate the buffer for a message once, before it is written.
+static size_t get_encoded_end(FlValue* value, size_t offset) {
+  if (value == nullptr) {
+    return offset + sizeof(uint8_t);
+  }
+
+  switch (fl_value_get_type(value)) {
+    case FL_VALUE_TYPE_NULL:
+    case FL_VALUE_TYPE_BOOL:
+      return offset + sizeof(uint8_t);
+    case FL_VALUE_TYPE_INT: {
+      int64_t v = fl_value_get_int(value);
+      return offset + sizeof(uint8_t) +
+             (v >= INT32_MIN && v <= INT32_MAX ? sizeof(int32_t)
+                                               : sizeof(int64_t));
+    }
+    case FL_VALUE_TYPE_FLOAT:
+      offset += sizeof(uint8_t);
+      return offset + get_padding(offset, 8) + sizeof(double);
+    case FL_VALUE_TYPE_STRING: {
+      size_t length = strlen(fl_value_get_string(value));
+      return offset + sizeof(uint8_t) + get_size_size(length) + length;
+    }
+    case FL_VALUE_TYPE_UINT8_LIST:
+      return get_typed_list_end(offset, fl_value_get_length(value),
+                                sizeof(uint8_t));
+    case FL_VALUE_TYPE_INT32_LIST:
+      return get_typed_list_end(offset, fl_value_get_length(value),
+                                sizeof(int32_t));
+    case FL_VALUE_TYPE_INT64_LIST:
+      return get_typed_list_end(offset, fl_value_get_length(value),
+                                sizeof(int64_t));
+    case FL_VALUE_TYPE_FLOAT32_LIST:
+      return get_typed_list_end(offset, fl_value_get_length(value),
+                                sizeof(float));
+    case FL_VALUE_TYPE_FLOAT_LIST:
+      return get_typed_list_end(offset, fl_value_get_length(value),
+                                sizeof(double));
+    case FL_VALUE_TYPE_LIST: {
+      size_t length = fl_value_get_length(value);
+      offset += sizeof(uint8_t) + get_size_size(length);
+      for (size_t i = 0; i < length; i++) {
+        offset = get_encoded_end(fl_value_get_list_value(value, i), offset);
+      }
+      return offset;
+    }
+    case FL_VALUE_TYPE_MAP: {
+      size_t length = fl_value_get_length(value);
+      offset += sizeof(uint8_t) + get_size_size(length);
+      for (size_t i = 0; i < length; i++) {
+        offset = get_encoded_end(fl_value_get_map_key(value, i), offset);
+        offset = get_encoded_end(fl_value_get_map_value(value, i), offset);
+      }
+      return offset;
+    }
+  }
+
+  // Unsupported types fail to be written.
+  return offset;
+}
+
 // Checks there is enough data in @buffer to be read.
 static gboolean check_size(GBytes* buffer,
                            size_t offset,
@@ -243,7 +333,8 @@ static FlValue* read_uint8_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(uint8_t) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_uint8_list(get_data(buffer, offset), length);
+  FlValue* value = fl_value_new_typed_list_view(FL_VALUE_TYPE_UINT8_LIST,
+                                                buffer, *offset, length);
   *offset += length;
   return value;
 }
@@ -266,8 +357,13 @@ static FlValue* read_int32_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(int32_t) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_int32_list(
-      reinterpret_cast<const int32_t*>(get_data(buffer, offset)), length);
+  FlValue* value = fl_value_new_typed_list_view(FL_VALUE_TYPE_INT32_LIST,
+                                                buffer, *offset, length);
+  if (value == nullptr) {
+    // The message is not aligned in memory, copy the values instead.
+    value = fl_value_new_int32_list(
+        reinterpret_cast<const int32_t*>(get_data(buffer, offset)), length);
+  }
   *offset += sizeof(int32_t) * length;
   return value;
 }
@@ -290,8 +386,13 @@ static FlValue* read_int64_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(int64_t) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_int64_list(
-      reinterpret_cast<const int64_t*>(get_data(buffer, offset)), length);
+  FlValue* value = fl_value_new_typed_list_view(FL_VALUE_TYPE_INT64_LIST,
+                                                buffer, *offset, length);
+  if (value == nullptr) {
+    // The message is not aligned in memory, copy the values instead.
+    value = fl_value_new_int64_list(
+        reinterpret_cast<const int64_t*>(get_data(buffer, offset)), length);
+  }
   *offset += sizeof(int64_t) * length;
   return value;
 }
@@ -314,8 +415,13 @@ static FlValue* read_float32_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(float) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_float32_list(
-      reinterpret_cast<const float*>(get_data(buffer, offset)), length);
+  FlValue* value = fl_value_new_typed_list_view(FL_VALUE_TYPE_FLOAT32_LIST,
+                                                buffer, *offset, length);
+  if (value == nullptr) {
+    // The message is not aligned in memory, copy the values instead.
+    value = fl_value_new_float32_list(
+        reinterpret_cast<const float*>(get_data(buffer, offset)), length);
+  }
   *offset += sizeof(float) * length;
   return value;
 }
@@ -338,8 +444,13 @@ static FlValue* read_float64_list_value(FlStandardMessageCodec* self,
   if (!check_size(buffer, *offset, sizeof(double) * length, error)) {
     return nullptr;
   }
-  FlValue* value = fl_value_new_float_list(
-      reinterpret_cast<const double*>(get_data(buffer, offset)), length);
+  FlValue* value = fl_value_new_typed_list_view(FL_VALUE_TYPE_FLOAT_LIST,
+                                                buffer, *offset, length);
+  if (value == nullptr) {
+    // The message is not aligned in memory, copy the values instead.
+    value = fl_value_new_float_list(
+        reinterpret_cast<const double*>(get_data(buffer, offset)), length);
+  }
   *offset += sizeof(double) * length;
   return value;
 }
@@ -408,7 +519,8 @@ static GBytes* fl_standard_message_codec_encode_message(FlMessageCodec* codec,
   FlStandardMessageCodec* self =
       reinterpret_cast<FlStandardMessageCodec*>(codec);
 
-  g_autoptr(GByteArray) buffer = g_byte_array_new();
+  g_autoptr(GByteArray) buffer =
+      g_byte_array_sized_new(get_encoded_end(message, 0));
   if (!fl_standard_message_codec_write_value(self, buffer, message, error)) {
     return nullptr;
   }
@@ -1089,3 +1089,58 @@ TEST(FlStandardMessageCodecTest, EncodeDecode) {
 
   ASSERT_TRUE(fl_value_equal(input, output));
 }
+
+TEST(FlStandardMessageCodecTest, EncodeDecodeTypedLists) {
+  g_autoptr(FlStandardMessageCodec) codec = fl_standard_message_codec_new();
+
+  const uint8_t uint8_data[] = {0, 1, 2};
+  const int32_t int32_data[] = {-1, 0, 1};
+  const int64_t int64_data[] = {INT64_MIN, 0, INT64_MAX};
+  const float float32_data[] = {-1.5, 0.0, 1.5};
+  const double float64_data[] = {-M_PI, 0.0, M_PI};
+  g_autoptr(FlValue) input = fl_value_new_list();
+  fl_value_append_take(input, fl_value_new_uint8_list(uint8_data, 3));
+  fl_value_append_take(input, fl_value_new_int32_list(int32_data, 3));
+  fl_value_append_take(input, fl_value_new_int64_list(int64_data, 3));
+  fl_value_append_take(input, fl_value_new_float32_list(float32_data, 3));
+  fl_value_append_take(input, fl_value_new_float_list(float64_data, 3));
+  fl_value_append_take(input, fl_value_new_string("padding"));
+  fl_value_append_take(input, fl_value_new_float_list(float64_data, 3));
+
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(GBytes) message =
+      fl_message_codec_encode_message(FL_MESSAGE_CODEC(codec), input, &error);
+  EXPECT_NE(message, nullptr);
+  EXPECT_EQ(error, nullptr);
+
+  g_autoptr(FlValue) output =
+      fl_message_codec_decode_message(FL_MESSAGE_CODEC(codec), message, &error);
+  EXPECT_EQ(error, nullptr);
+  EXPECT_NE(output, nullptr);
+
+  ASSERT_TRUE(fl_value_equal(input, output));
+}
+
+TEST(FlStandardMessageCodecTest, DecodeFloat64ListWithoutCopy) {
+  g_autoptr(FlStandardMessageCodec) codec = fl_standard_message_codec_new();
+  g_autoptr(GBytes) data = hex_string_to_bytes(
+      "0b02000000000000"
+      "0000000000000000"
+      "000000000000f03f");
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(FlValue) value =
+      fl_message_codec_decode_message(FL_MESSAGE_CODEC(codec), data, &error);
+  EXPECT_EQ(error, nullptr);
+  ASSERT_NE(value, nullptr);
+  ASSERT_EQ(fl_value_get_type(value), FL_VALUE_TYPE_FLOAT_LIST);
+  ASSERT_EQ(fl_value_get_length(value), static_cast<size_t>(2));
+
+  // The values are read from the message, which the value keeps alive.
+  const uint8_t* message_data =
+      static_cast<const uint8_t*>(g_bytes_get_data(data, nullptr));
+  EXPECT_EQ(reinterpret_cast<const uint8_t*>(fl_value_get_float_list(value)),
+            message_data + 8);
+  g_clear_pointer(&data, g_bytes_unref);
+  EXPECT_EQ(fl_value_get_float_list(value)[0], 0.0);
+  EXPECT_EQ(fl_value_get_float_list(value)[1], 1.0);
+}
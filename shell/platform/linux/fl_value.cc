@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_value.h"
+#include "flutter/shell/platform/linux/fl_value_private.h"
 
 #include <gmodule.h>
 
@@ -37,30 +38,40 @@ typedef struct {
   FlValue parent;
   uint8_t* values;
   size_t values_length;
+  // Data @values points into, or nullptr if @values is owned.
+  GBytes* bytes;
 } FlValueUint8List;
 
 typedef struct {
   FlValue parent;
   int32_t* values;
   size_t values_length;
+  // Data @values points into, or nullptr if @values is owned.
+  GBytes* bytes;
 } FlValueInt32List;
 
 typedef struct {
   FlValue parent;
   int64_t* values;
   size_t values_length;
+  // Data @values points into, or nullptr if @values is owned.
+  GBytes* bytes;
 } FlValueInt64List;
 
 typedef struct {
   FlValue parent;
   float* values;
   size_t values_length;
+  // Data @values points into, or nullptr if @values is owned.
+  GBytes* bytes;
 } FlValueFloat32List;
 
 typedef struct {
   FlValue parent;
   double* values;
   size_t values_length;
+  // Data @values points into, or nullptr if @values is owned.
+  GBytes* bytes;
 } FlValueFloatList;
 
 typedef struct {
@@ -86,6 +97,34 @@ static void fl_value_destroy(gpointer value) {
   fl_value_unref(static_cast<FlValue*>(value));
 }
 
+// Frees the values of a typed list, or releases the data they point into.
+static void free_typed_list_values(gpointer values, GBytes* bytes) {
+  if (bytes != nullptr) {
+    g_bytes_unref(bytes);
+  } else {
+    g_free(values);
+  }
+}
+
+// Returns the size of an element of a typed list of @type, or 0 if @type is
+// not a typed list.
+static size_t get_typed_list_element_size(FlValueType type) {
+  switch (type) {
+    case FL_VALUE_TYPE_UINT8_LIST:
+      return sizeof(uint8_t);
+    case FL_VALUE_TYPE_INT32_LIST:
+      return sizeof(int32_t);
+    case FL_VALUE_TYPE_INT64_LIST:
+      return sizeof(int64_t);
+    case FL_VALUE_TYPE_FLOAT32_LIST:
+      return sizeof(float);
+    case FL_VALUE_TYPE_FLOAT_LIST:
+      return sizeof(double);
+    default:
+      return 0;
+  }
+}
+
 // Finds the index of a key in a FlValueMap.
 // FIXME(robert-ancell) This is highly inefficient, and should be optimized if
 // necessary.
@@ -289,10 +328,8 @@ G_MODULE_EXPORT FlValue* fl_value_new_uint8_list(const uint8_t* data,
 }
 
 G_MODULE_EXPORT FlValue* fl_value_new_uint8_list_from_bytes(GBytes* data) {
-  gsize length;
-  const uint8_t* d =
-      static_cast<const uint8_t*>(g_bytes_get_data(data, &length));
-  return fl_value_new_uint8_list(d, length);
+  return fl_value_new_typed_list_view(FL_VALUE_TYPE_UINT8_LIST, data, 0,
+                                      g_bytes_get_size(data));
 }
 
 G_MODULE_EXPORT FlValue* fl_value_new_int32_list(const int32_t* data,
@@ -335,6 +372,70 @@ G_MODULE_EXPORT FlValue* fl_value_new_float_list(const double* data,
   return reinterpret_cast<FlValue*>(self);
 }
 
+FlValue* fl_value_new_typed_list_view(FlValueType type,
+                                      GBytes* bytes,
+                                      size_t offset,
+                                      size_t length) {
+  size_t element_size = get_typed_list_element_size(type);
+  g_return_val_if_fail(element_size != 0, nullptr);
+
+  gsize size;
+  const uint8_t* data =
+      static_cast<const uint8_t*>(g_bytes_get_data(bytes, &size));
+  if (offset > size || length > (size - offset) / element_size) {
+    return nullptr;
+  }
+  gpointer values = const_cast<uint8_t*>(data + offset);
+  if (reinterpret_cast<uintptr_t>(values) % element_size != 0) {
+    return nullptr;
+  }
+
+  switch (type) {
+    case FL_VALUE_TYPE_UINT8_LIST: {
+      FlValueUint8List* self = reinterpret_cast<FlValueUint8List*>(
+          fl_value_new(type, sizeof(FlValueUint8List)));
+      self->values = static_cast<uint8_t*>(values);
+      self->values_length = length;
+      self->bytes = g_bytes_ref(bytes);
+      return reinterpret_cast<FlValue*>(self);
+    }
+    case FL_VALUE_TYPE_INT32_LIST: {
+      FlValueInt32List* self = reinterpret_cast<FlValueInt32List*>(
+          fl_value_new(type, sizeof(FlValueInt32List)));
+      self->values = static_cast<int32_t*>(values);
+      self->values_length = length;
+      self->bytes = g_bytes_ref(bytes);
+      return reinterpret_cast<FlValue*>(self);
+    }
+    case FL_VALUE_TYPE_INT64_LIST: {
+      FlValueInt64List* self = reinterpret_cast<FlValueInt64List*>(
+          fl_value_new(type, sizeof(FlValueInt64List)));
+      self->values = static_cast<int64_t*>(values);
+      self->values_length = length;
+      self->bytes = g_bytes_ref(bytes);
+      return reinterpret_cast<FlValue*>(self);
+    }
+    case FL_VALUE_TYPE_FLOAT32_LIST: {
+      FlValueFloat32List* self = reinterpret_cast<FlValueFloat32List*>(
+          fl_value_new(type, sizeof(FlValueFloat32List)));
+      self->values = static_cast<float*>(values);
+      self->values_length = length;
+      self->bytes = g_bytes_ref(bytes);
+      return reinterpret_cast<FlValue*>(self);
+    }
+    case FL_VALUE_TYPE_FLOAT_LIST: {
+      FlValueFloatList* self = reinterpret_cast<FlValueFloatList*>(
+          fl_value_new(type, sizeof(FlValueFloatList)));
+      self->values = static_cast<double*>(values);
+      self->values_length = length;
+      self->bytes = g_bytes_ref(bytes);
+      return reinterpret_cast<FlValue*>(self);
+    }
+    default:
+      return nullptr;
+  }
+}
+
 G_MODULE_EXPORT FlValue* fl_value_new_list() {
   FlValueList* self = reinterpret_cast<FlValueList*>(
       fl_value_new(FL_VALUE_TYPE_LIST, sizeof(FlValueList)));
@@ -382,27 +483,27 @@ G_MODULE_EXPORT void fl_value_unref(FlValue* self) {
     }
     case FL_VALUE_TYPE_UINT8_LIST: {
       FlValueUint8List* v = reinterpret_cast<FlValueUint8List*>(self);
-      g_free(v->values);
+      free_typed_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_INT32_LIST: {
       FlValueInt32List* v = reinterpret_cast<FlValueInt32List*>(self);
-      g_free(v->values);
+      free_typed_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_INT64_LIST: {
       FlValueInt64List* v = reinterpret_cast<FlValueInt64List*>(self);
-      g_free(v->values);
+      free_typed_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_FLOAT32_LIST: {
       FlValueFloat32List* v = reinterpret_cast<FlValueFloat32List*>(self);
-      g_free(v->values);
+      free_typed_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_FLOAT_LIST: {
       FlValueFloatList* v = reinterpret_cast<FlValueFloatList*>(self);
-      g_free(v->values);
+      free_typed_list_values(v->values, v->bytes);
       break;
     }
     case FL_VALUE_TYPE_LIST: {
@@ -0,0 +1,35 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
+
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_value.h"
+
+G_BEGIN_DECLS
+
+/**
+ * fl_value_new_typed_list_view:
+ * @type: the type of the list, one of #FL_VALUE_TYPE_UINT8_LIST,
+ * #FL_VALUE_TYPE_INT32_LIST, #FL_VALUE_TYPE_INT64_LIST,
+ * #FL_VALUE_TYPE_FLOAT32_LIST or #FL_VALUE_TYPE_FLOAT_LIST.
+ * @bytes: the data the values are stored in.
+ * @offset: the offset of the first value in @bytes. The value must be aligned
+ * to the size of an element in memory.
+ * @length: the number of values.
+ *
+ * Creates a typed list whose values are read from @bytes instead of being
+ * copied. @bytes is kept alive for as long as the value.
+ *
+ * Returns: a new #FlValue, or %NULL if the values are not aligned or do not fit
+ * in @bytes.
+ */
+FlValue* fl_value_new_typed_list_view(FlValueType type,
+                                      GBytes* bytes,
+                                      size_t offset,
+                                      size_t length);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
@@ -41,6 +41,12 @@ G_DECLARE_DERIVABLE_TYPE(FlBinaryMessengerResponseHandle,
                          BINARY_MESSENGER_RESPONSE_HANDLE,
                          GObject)
 
+G_DECLARE_FINAL_TYPE(FlBinaryMessengerTaskQueue,
+                     fl_binary_messenger_task_queue,
+                     FL,
+                     BINARY_MESSENGER_TASK_QUEUE,
+                     GObject)
+
 /**
  * FlBinaryMessengerMessageHandler:
  * @messenger: an #FlBinaryMessenger.
@@ -88,6 +94,14 @@ struct _FlBinaryMessengerInterface {
   GBytes* (*send_on_channel_finish)(FlBinaryMessenger* messenger,
                                     GAsyncResult* result,
                                     GError** error);
+
+  void (*set_message_handler_on_channel_with_task_queue)(
+      FlBinaryMessenger* messenger,
+      const gchar* channel,
+      FlBinaryMessengerMessageHandler handler,
+      gpointer user_data,
+      GDestroyNotify destroy_notify,
+      FlBinaryMessengerTaskQueue* task_queue);
 };
 
 struct _FlBinaryMessengerResponseHandleClass {
@@ -107,6 +121,24 @@ struct _FlBinaryMessengerResponseHandleClass {
  * #FlBinaryMessengerResponseHandle is an object used to send responses with.
  */
 
+/**
+ * FlBinaryMessengerTaskQueue:
+ *
+ * #FlBinaryMessengerTaskQueue is a queue of messages that are handled in order
+ * on a background thread instead of the GTK main thread. Use it for channels
+ * that receive many messages or whose handlers do blocking work. See
+ * fl_binary_messenger_set_message_handler_on_channel_with_task_queue().
+ */
+
+/**
+ * fl_binary_messenger_task_queue_new:
+ *
+ * Creates a new task queue with its own background thread.
+ *
+ * Returns: a new #FlBinaryMessengerTaskQueue.
+ */
+FlBinaryMessengerTaskQueue* fl_binary_messenger_task_queue_new();
+
 /**
  * fl_binary_messenger_set_platform_message_handler:
  * @binary_messenger: an #FlBinaryMessenger.
@@ -131,6 +163,35 @@ void fl_binary_messenger_set_message_handler_on_channel(
     gpointer user_data,
     GDestroyNotify destroy_notify);
 
+/**
+ * fl_binary_messenger_set_message_handler_on_channel_with_task_queue:
+ * @binary_messenger: an #FlBinaryMessenger.
+ * @channel: channel to listen on.
+ * @handler: (allow-none): function to call when a message is received on this
+ * channel or %NULL to disable a handler
+ * @user_data: (closure): user data to pass to @handler.
+ * @destroy_notify: (allow-none): a function which gets called to free
+ * @user_data, or %NULL.
+ * @task_queue: (allow-none): the #FlBinaryMessengerTaskQueue to call @handler
+ * on, or %NULL to call it on the GTK main thread.
+ *
+ * Sets the function called when a platform message is received on the given
+ * channel, like fl_binary_messenger_set_message_handler_on_channel(). @handler
+ * is called on the thread of @task_queue, one message at a time, and may
+ * respond with fl_binary_messenger_send_response() from that thread. A task
+ * queue may be shared by several channels.
+ *
+ * Messengers that do not support task queues call @handler on the GTK main
+ * thread.
+ */
+void fl_binary_messenger_set_message_handler_on_channel_with_task_queue(
+    FlBinaryMessenger* messenger,
+    const gchar* channel,
+    FlBinaryMessengerMessageHandler handler,
+    gpointer user_data,
+    GDestroyNotify destroy_notify,
+    FlBinaryMessengerTaskQueue* task_queue);
+
 /**
  * fl_binary_messenger_send_response:
  * @binary_messenger: an #FlBinaryMessenger.
@@ -334,20 +334,47 @@ EGLBoolean _eglSwapBuffers(EGLDisplay dpy, EGLSurface surface) {
   return bool_success();
 }
 
+static void _glBindBuffer(GLenum target, GLuint buffer) {}
+
 static void _glBindFramebuffer(GLenum target, GLuint framebuffer) {}
 
 static void _glBindTexture(GLenum target, GLuint texture) {}
 
+static void _glBufferData(GLenum target,
+                          GLsizeiptr size,
+                          const void* data,
+                          GLenum usage) {}
+
+static GLenum _glClientWaitSync(GLsync sync,
+                                GLbitfield flags,
+                                GLuint64 timeout) {
+  return GL_ALREADY_SIGNALED;
+}
+
+static void _glDeleteBuffers(GLsizei n, const GLuint* buffers) {}
+
 void _glDeleteFramebuffers(GLsizei n, const GLuint* framebuffers) {}
 
+static void _glDeleteSync(GLsync sync) {}
+
 void _glDeleteTextures(GLsizei n, const GLuint* textures) {}
 
+static GLsync _glFenceSync(GLenum condition, GLbitfield flags) {
+  return nullptr;
+}
+
 static void _glFramebufferTexture2D(GLenum target,
                                     GLenum attachment,
                                     GLenum textarget,
                                     GLuint texture,
                                     GLint level) {}
 
+static void _glGenBuffers(GLsizei n, GLuint* buffers) {
+  for (GLsizei i = 0; i < n; i++) {
+    buffers[i] = 0;
+  }
+}
+
 static void _glGenTextures(GLsizei n, GLuint* textures) {
   for (GLsizei i = 0; i < n; i++) {
     textures[i] = 0;
@@ -360,6 +387,13 @@ static void _glGenFramebuffers(GLsizei n, GLuint* framebuffers) {
   }
 }
 
+static void* _glMapBufferRange(GLenum target,
+                               GLintptr offset,
+                               GLsizeiptr length,
+                               GLbitfield access) {
+  return nullptr;
+}
+
 static void _glTexParameterf(GLenum target, GLenum pname, GLfloat param) {}
 
 static void _glTexParameteri(GLenum target, GLenum pname, GLint param) {}
@@ -374,6 +408,20 @@ static void _glTexImage2D(GLenum target,
                           GLenum type,
                           const void* pixels) {}
 
+static void _glTexSubImage2D(GLenum target,
+                             GLint level,
+                             GLint xoffset,
+                             GLint yoffset,
+                             GLsizei width,
+                             GLsizei height,
+                             GLenum format,
+                             GLenum type,
+                             const void* pixels) {}
+
+static GLboolean _glUnmapBuffer(GLenum target) {
+  return GL_TRUE;
+}
+
 static GLenum _glGetError() {
   return GL_NO_ERROR;
 }
@@ -440,17 +488,33 @@ EGLBoolean (*epoxy_eglMakeCurrent)(EGLDisplay dpy,
                                    EGLContext ctx);
 EGLBoolean (*epoxy_eglSwapBuffers)(EGLDisplay dpy, EGLSurface surface);
 
+void (*epoxy_glBindBuffer)(GLenum target, GLuint buffer);
 void (*epoxy_glBindFramebuffer)(GLenum target, GLuint framebuffer);
 void (*epoxy_glBindTexture)(GLenum target, GLuint texture);
+void (*epoxy_glBufferData)(GLenum target,
+                           GLsizeiptr size,
+                           const void* data,
+                           GLenum usage);
+GLenum (*epoxy_glClientWaitSync)(GLsync sync,
+                                 GLbitfield flags,
+                                 GLuint64 timeout);
+void (*epoxy_glDeleteBuffers)(GLsizei n, const GLuint* buffers);
 void (*epoxy_glDeleteFramebuffers)(GLsizei n, const GLuint* framebuffers);
+void (*epoxy_glDeleteSync)(GLsync sync);
 void (*epoxy_glDeleteTextures)(GLsizei n, const GLuint* textures);
+GLsync (*epoxy_glFenceSync)(GLenum condition, GLbitfield flags);
 void (*epoxy_glFramebufferTexture2D)(GLenum target,
                                      GLenum attachment,
                                      GLenum textarget,
                                      GLuint texture,
                                      GLint level);
+void (*epoxy_glGenBuffers)(GLsizei n, GLuint* buffers);
 void (*epoxy_glGenFramebuffers)(GLsizei n, GLuint* framebuffers);
 void (*epoxy_glGenTextures)(GLsizei n, GLuint* textures);
+void* (*epoxy_glMapBufferRange)(GLenum target,
+                                GLintptr offset,
+                                GLsizeiptr length,
+                                GLbitfield access);
 void (*epoxy_glTexParameterf)(GLenum target, GLenum pname, GLfloat param);
 void (*epoxy_glTexParameteri)(GLenum target, GLenum pname, GLint param);
 void (*epoxy_glTexImage2D)(GLenum target,
@@ -462,6 +526,16 @@ void (*epoxy_glTexImage2D)(GLenum target,
                            GLenum format,
                            GLenum type,
                            const void* pixels);
+void (*epoxy_glTexSubImage2D)(GLenum target,
+                              GLint level,
+                              GLint xoffset,
+                              GLint yoffset,
+                              GLsizei width,
+                              GLsizei height,
+                              GLenum format,
+                              GLenum type,
+                              const void* pixels);
+GLboolean (*epoxy_glUnmapBuffer)(GLenum target);
 GLenum (*epoxy_glGetError)();
 
 static void library_init() {
@@ -478,15 +552,25 @@ static void library_init() {
   epoxy_eglMakeCurrent = _eglMakeCurrent;
   epoxy_eglSwapBuffers = _eglSwapBuffers;
 
+  epoxy_glBindBuffer = _glBindBuffer;
   epoxy_glBindFramebuffer = _glBindFramebuffer;
   epoxy_glBindTexture = _glBindTexture;
+  epoxy_glBufferData = _glBufferData;
+  epoxy_glClientWaitSync = _glClientWaitSync;
+  epoxy_glDeleteBuffers = _glDeleteBuffers;
   epoxy_glDeleteFramebuffers = _glDeleteFramebuffers;
+  epoxy_glDeleteSync = _glDeleteSync;
   epoxy_glDeleteTextures = _glDeleteTextures;
+  epoxy_glFenceSync = _glFenceSync;
   epoxy_glFramebufferTexture2D = _glFramebufferTexture2D;
+  epoxy_glGenBuffers = _glGenBuffers;
   epoxy_glGenFramebuffers = _glGenFramebuffers;
   epoxy_glGenTextures = _glGenTextures;
+  epoxy_glMapBufferRange = _glMapBufferRange;
   epoxy_glTexParameterf = _glTexParameterf;
   epoxy_glTexParameteri = _glTexParameteri;
   epoxy_glTexImage2D = _glTexImage2D;
+  epoxy_glTexSubImage2D = _glTexSubImage2D;
+  epoxy_glUnmapBuffer = _glUnmapBuffer;
   epoxy_glGetError = _glGetError;
 }
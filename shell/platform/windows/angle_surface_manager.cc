@@ -176,6 +176,7 @@ void AngleSurfaceManager::CleanUp() {
   EGLBoolean result = EGL_FALSE;
 
   // Needs to be reset before destroying the EGLContext.
+  SetCompositionSurface(nullptr);
   resolved_device_.Reset();
 
   if (egl_display_ != EGL_NO_DISPLAY && egl_context_ != EGL_NO_CONTEXT) {
@@ -214,18 +215,20 @@ bool AngleSurfaceManager::CreateSurface(WindowsRenderTarget* render_target,
     return false;
   }
 
-  EGLSurface surface = EGL_NO_SURFACE;
+  HWND window = std::get<HWND>(*render_target);
+  EGLSurface surface = CreateCompositionSurface(window, width, height);
 
-  const EGLint surfaceAttributes[] = {
-      EGL_FIXED_SIZE_ANGLE, EGL_TRUE, EGL_WIDTH, width,
-      EGL_HEIGHT,           height,   EGL_NONE};
-
-  surface = eglCreateWindowSurface(
-      egl_display_, egl_config_,
-      static_cast<EGLNativeWindowType>(std::get<HWND>(*render_target)),
-      surfaceAttributes);
   if (surface == EGL_NO_SURFACE) {
-    LogEglError("Surface creation failed.");
+    const EGLint surfaceAttributes[] = {
+        EGL_FIXED_SIZE_ANGLE, EGL_TRUE, EGL_WIDTH, width,
+        EGL_HEIGHT,           height,   EGL_NONE};
+
+    surface = eglCreateWindowSurface(egl_display_, egl_config_,
+                                     static_cast<EGLNativeWindowType>(window),
+                                     surfaceAttributes);
+    if (surface == EGL_NO_SURFACE) {
+      LogEglError("Surface creation failed.");
+    }
   }
 
   surface_width_ = width;
@@ -244,6 +247,20 @@ void AngleSurfaceManager::ResizeSurface(WindowsRenderTarget* render_target,
     surface_height_ = height;
 
     ClearContext();
+    if (composition_surface_) {
+      // Resizing the buffers of the swap chain in place avoids the flicker of
+      // creating a new one.
+      if (render_surface_ != EGL_NO_SURFACE) {
+        eglDestroySurface(egl_display_, render_surface_);
+        render_surface_ = EGL_NO_SURFACE;
+      }
+      if (composition_surface_->Resize(width, height)) {
+        render_surface_ = CreateCompositionBufferSurface(width, height);
+        if (render_surface_ != EGL_NO_SURFACE) {
+          return;
+        }
+      }
+    }
     DestroySurface();
     if (!CreateSurface(render_target, width, height)) {
       FML_LOG(ERROR)
@@ -271,6 +288,7 @@ void AngleSurfaceManager::DestroySurface() {
     eglDestroySurface(egl_display_, render_surface_);
   }
   render_surface_ = EGL_NO_SURFACE;
+  SetCompositionSurface(nullptr);
 }
 
 bool AngleSurfaceManager::MakeCurrent() {
@@ -289,9 +307,94 @@ bool AngleSurfaceManager::MakeResourceCurrent() {
 }
 
 EGLBoolean AngleSurfaceManager::SwapBuffers() {
+  if (composition_surface_) {
+    // eglSwapBuffers does nothing for pbuffer surfaces, so the swap chain is
+    // presented once ANGLE has submitted the frame.
+    glFlush();
+    if (!composition_surface_->Present()) {
+      return EGL_FALSE;
+    }
+    std::lock_guard<std::mutex> lock(frame_latency_mutex_);
+    pending_frame_count_++;
+    return EGL_TRUE;
+  }
   return (eglSwapBuffers(egl_display_, render_surface_));
 }
 
+bool AngleSurfaceManager::HasFrameLatencyWaitableObject() {
+  std::lock_guard<std::mutex> lock(frame_latency_mutex_);
+  return composition_surface_ != nullptr;
+}
+
+bool AngleSurfaceManager::WaitForFrameLatency(
+    std::chrono::milliseconds timeout) {
+  HANDLE waitable_object = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(frame_latency_mutex_);
+    if (!composition_surface_ || pending_frame_count_ == 0) {
+      return false;
+    }
+    // The handle is duplicated so that the surface can be destroyed while
+    // this thread waits on it.
+    HANDLE process = ::GetCurrentProcess();
+    HANDLE source = composition_surface_->frame_latency_waitable_object();
+    if (!::DuplicateHandle(process, source, process, &waitable_object, 0, FALSE,
+                           DUPLICATE_SAME_ACCESS)) {
+      return false;
+    }
+    pending_frame_count_--;
+  }
+  DWORD result = ::WaitForSingleObject(waitable_object,
+                                       static_cast<DWORD>(timeout.count()));
+  ::CloseHandle(waitable_object);
+  return result == WAIT_OBJECT_0;
+}
+
+EGLSurface AngleSurfaceManager::CreateCompositionSurface(HWND window,
+                                                         EGLint width,
+                                                         EGLint height) {
+  Microsoft::WRL::ComPtr<ID3D11Device> device;
+  if (!GetDevice(device.GetAddressOf())) {
+    return EGL_NO_SURFACE;
+  }
+  std::unique_ptr<DirectCompositionSurface> composition_surface =
+      DirectCompositionSurface::Create(device.Get(), window, width, height);
+  if (!composition_surface) {
+    return EGL_NO_SURFACE;
+  }
+  SetCompositionSurface(std::move(composition_surface));
+
+  EGLSurface surface = CreateCompositionBufferSurface(width, height);
+  if (surface == EGL_NO_SURFACE) {
+    SetCompositionSurface(nullptr);
+  }
+  return surface;
+}
+
+EGLSurface AngleSurfaceManager::CreateCompositionBufferSurface(EGLint width,
+                                                               EGLint height) {
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> back_buffer;
+  if (!composition_surface_->GetBackBuffer(back_buffer.GetAddressOf())) {
+    return EGL_NO_SURFACE;
+  }
+  const EGLint attributes[] = {EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE};
+  EGLSurface surface = eglCreatePbufferFromClientBuffer(
+      egl_display_, EGL_D3D_TEXTURE_ANGLE,
+      static_cast<EGLClientBuffer>(back_buffer.Get()), egl_config_,
+      attributes);
+  if (surface == EGL_NO_SURFACE) {
+    LogEglError("Failed to wrap the swap chain in a surface.");
+  }
+  return surface;
+}
+
+void AngleSurfaceManager::SetCompositionSurface(
+    std::unique_ptr<DirectCompositionSurface> composition_surface) {
+  std::lock_guard<std::mutex> lock(frame_latency_mutex_);
+  composition_surface_ = std::move(composition_surface);
+  pending_frame_count_ = 0;
+}
+
 EGLSurface AngleSurfaceManager::CreateSurfaceFromHandle(
     EGLenum handle_type,
     EGLClientBuffer handle,
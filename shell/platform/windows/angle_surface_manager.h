@@ -16,8 +16,11 @@
 #include <d3d11.h>
 #include <windows.h>
 #include <wrl/client.h>
+#include <chrono>
 #include <memory>
+#include <mutex>
 
+#include "flutter/shell/platform/windows/direct_composition_surface.h"
 #include "window_binding_handler.h"
 
 namespace flutter {
@@ -37,6 +40,9 @@ class AngleSurfaceManager {
   // associated with window, in the appropriate format for display.
   // Target represents the visual entity to bind to.  Width and
   // height represent dimensions surface is created at.
+  //
+  // A flip model swap chain presented through DirectComposition is used when
+  // the system supports it, and a window surface created by ANGLE otherwise.
   bool CreateSurface(WindowsRenderTarget* render_target,
                      EGLint width,
                      EGLint height);
@@ -71,6 +77,16 @@ class AngleSurfaceManager {
   // not null.
   EGLBoolean SwapBuffers();
 
+  // Returns true if the current surface has a frame latency waitable object
+  // that |WaitForFrameLatency| can wait on. Can be called on any thread.
+  bool HasFrameLatencyWaitableObject();
+
+  // Waits up to |timeout| for the compositor to retire the last presented
+  // frame, so that a new frame can be queued without adding latency. Returns
+  // true if the frame was retired, or false if there is no frame to wait for
+  // or the wait timed out. Can be called on any thread.
+  bool WaitForFrameLatency(std::chrono::milliseconds timeout);
+
   // Creates a |EGLSurface| from the provided handle.
   EGLSurface CreateSurfaceFromHandle(EGLenum handle_type,
                                      EGLClientBuffer handle,
@@ -96,6 +112,19 @@ class AngleSurfaceManager {
       const EGLint* config,
       bool should_log);
 
+  // Creates a DirectComposition swap chain for |window| and returns a surface
+  // that renders into it, or EGL_NO_SURFACE if this is not supported.
+  EGLSurface CreateCompositionSurface(HWND window,
+                                      EGLint width,
+                                      EGLint height);
+
+  // Wraps the back buffer of composition_surface_ in a pbuffer surface.
+  EGLSurface CreateCompositionBufferSurface(EGLint width, EGLint height);
+
+  // Replaces composition_surface_, resetting the frame latency bookkeeping.
+  void SetCompositionSurface(
+      std::unique_ptr<DirectCompositionSurface> composition_surface);
+
   // EGL representation of native display.
   EGLDisplay egl_display_;
 
@@ -123,6 +152,20 @@ class AngleSurfaceManager {
   // The current D3D device.
   Microsoft::WRL::ComPtr<ID3D11Device> resolved_device_;
 
+  // The swap chain render_surface_ renders into, or nullptr if
+  // render_surface_ is a window surface.
+  std::unique_ptr<DirectCompositionSurface> composition_surface_;
+
+  // Guards composition_surface_ and pending_frame_count_ for the vsync
+  // thread.
+  std::mutex frame_latency_mutex_;
+
+  // The number of presented frames that |WaitForFrameLatency| has not waited
+  // for. The waitable object is signaled once for each of them, so keeping
+  // the waits matched with the presents keeps them from blocking
+  // indefinitely when no frame was produced.
+  int pending_frame_count_ = 0;
+
   // Number of active instances of AngleSurfaceManager
   static int instance_count_;
 };
@@ -0,0 +1,135 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/windows/direct_composition_surface.h"
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+namespace {
+
+// The number of frames the swap chain queues before the frame latency
+// waitable object blocks. One frame keeps the input-to-photon latency to a
+// minimum.
+constexpr UINT kMaximumFrameLatency = 1;
+
+constexpr UINT kSwapChainFlags =
+    DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
+}  // namespace
+
+std::unique_ptr<DirectCompositionSurface> DirectCompositionSurface::Create(
+    ID3D11Device* device,
+    HWND window,
+    UINT width,
+    UINT height) {
+  std::unique_ptr<DirectCompositionSurface> surface;
+  surface.reset(new DirectCompositionSurface());
+  if (!surface->Initialize(device, window, width, height)) {
+    return nullptr;
+  }
+  return surface;
+}
+
+DirectCompositionSurface::~DirectCompositionSurface() {
+  if (frame_latency_waitable_object_) {
+    ::CloseHandle(frame_latency_waitable_object_);
+  }
+}
+
+bool DirectCompositionSurface::Initialize(ID3D11Device* device,
+                                          HWND window,
+                                          UINT width,
+                                          UINT height) {
+  Microsoft::WRL::ComPtr<IDXGIDevice> dxgi_device;
+  Microsoft::WRL::ComPtr<IDXGIAdapter> dxgi_adapter;
+  Microsoft::WRL::ComPtr<IDXGIFactory2> dxgi_factory;
+  if (FAILED(device->QueryInterface(IID_PPV_ARGS(&dxgi_device))) ||
+      FAILED(dxgi_device->GetAdapter(&dxgi_adapter)) ||
+      FAILED(dxgi_adapter->GetParent(IID_PPV_ARGS(&dxgi_factory)))) {
+    return false;
+  }
+
+  if (FAILED(::DCompositionCreateDevice(dxgi_device.Get(),
+                                        IID_PPV_ARGS(&composition_device_)))) {
+    return false;
+  }
+
+  DXGI_SWAP_CHAIN_DESC1 desc = {};
+  desc.Width = width;
+  desc.Height = height;
+  // Matches the EGL config chosen by AngleSurfaceManager.
+  desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+  desc.SampleDesc.Count = 1;
+  desc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+  desc.BufferCount = 2;
+  desc.Scaling = DXGI_SCALING_STRETCH;
+  desc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+  desc.AlphaMode = DXGI_ALPHA_MODE_IGNORE;
+  desc.Flags = kSwapChainFlags;
+
+  Microsoft::WRL::ComPtr<IDXGISwapChain1> swap_chain;
+  if (FAILED(dxgi_factory->CreateSwapChainForComposition(device, &desc, nullptr,
+                                                         &swap_chain)) ||
+      FAILED(swap_chain.As(&swap_chain_))) {
+    return false;
+  }
+  if (FAILED(swap_chain_->SetMaximumFrameLatency(kMaximumFrameLatency))) {
+    return false;
+  }
+  frame_latency_waitable_object_ =
+      swap_chain_->GetFrameLatencyWaitableObject();
+
+  if (FAILED(composition_device_->CreateTargetForHwnd(window, TRUE,
+                                                      &composition_target_)) ||
+      FAILED(composition_device_->CreateVisual(&composition_visual_)) ||
+      FAILED(composition_visual_->SetContent(swap_chain_.Get())) ||
+      FAILED(composition_target_->SetRoot(composition_visual_.Get()))) {
+    FML_LOG(ERROR) << "Failed to set up the DirectComposition tree.";
+    return false;
+  }
+  return UpdateTransform(height);
+}
+
+bool DirectCompositionSurface::Resize(UINT width, UINT height) {
+  HRESULT result = swap_chain_->ResizeBuffers(
+      0, width, height, DXGI_FORMAT_UNKNOWN, kSwapChainFlags);
+  if (FAILED(result)) {
+    FML_LOG(ERROR) << "Failed to resize the swap chain: " << result;
+    return false;
+  }
+  return UpdateTransform(height);
+}
+
+bool DirectCompositionSurface::GetBackBuffer(ID3D11Texture2D** back_buffer) {
+  return SUCCEEDED(swap_chain_->GetBuffer(0, IID_PPV_ARGS(back_buffer)));
+}
+
+bool DirectCompositionSurface::Present() {
+  HRESULT result = swap_chain_->Present(1, 0);
+  if (FAILED(result)) {
+    FML_LOG(ERROR) << "Failed to present the swap chain: " << result;
+    return false;
+  }
+  return true;
+}
+
+bool DirectCompositionSurface::UpdateTransform(UINT height) {
+  // ANGLE renders into the swap chain buffers with a bottom-left origin, as
+  // for any other texture, so the visual flips them vertically. This is free
+  // when the compositor scans out the buffer.
+  D2D_MATRIX_3X2_F transform = {};
+  transform._11 = 1.0f;
+  transform._22 = -1.0f;
+  transform._32 = static_cast<FLOAT>(height);
+  if (FAILED(composition_visual_->SetTransform(transform)) ||
+      FAILED(composition_device_->Commit())) {
+    FML_LOG(ERROR) << "Failed to update the DirectComposition visual.";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace flutter
@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_WINDOWS_DIRECT_COMPOSITION_SURFACE_H_
+#define FLUTTER_SHELL_PLATFORM_WINDOWS_DIRECT_COMPOSITION_SURFACE_H_
+
+// Windows platform specific includes
+#include <d3d11.h>
+#include <dcomp.h>
+#include <dxgi1_3.h>
+#include <windows.h>
+#include <wrl/client.h>
+#include <memory>
+
+namespace flutter {
+
+// A flip model swap chain that is presented through DirectComposition.
+//
+// Unlike the bitblt model swap chains ANGLE creates for window surfaces, the
+// buffers of a flip model swap chain are handed to the compositor directly,
+// which saves a copy and a frame of latency. The swap chain also provides a
+// frame latency waitable object that is signaled when the compositor is ready
+// to accept another frame.
+class DirectCompositionSurface {
+ public:
+  // Creates a swap chain of |width| by |height| pixels that covers |window|.
+  //
+  // Returns nullptr if DirectComposition or flip model swap chains are not
+  // available, for example before Windows 10.
+  static std::unique_ptr<DirectCompositionSurface>
+  Create(ID3D11Device* device, HWND window, UINT width, UINT height);
+
+  ~DirectCompositionSurface();
+
+  // Disallow copy/move.
+  DirectCompositionSurface(const DirectCompositionSurface&) = delete;
+  DirectCompositionSurface& operator=(const DirectCompositionSurface&) = delete;
+
+  // Resizes the buffers of the swap chain. All references to the back buffer
+  // must have been released.
+  bool Resize(UINT width, UINT height);
+
+  // Gets the back buffer of the swap chain. With the flip model this always
+  // refers to the buffer that will be presented next, so it only needs to be
+  // fetched again after a resize.
+  bool GetBackBuffer(ID3D11Texture2D** back_buffer);
+
+  // Presents the back buffer at the next vblank.
+  bool Present();
+
+  // Gets the handle that is signaled when the swap chain can queue a new
+  // frame. The handle is owned by this object.
+  HANDLE frame_latency_waitable_object() const {
+    return frame_latency_waitable_object_;
+  }
+
+ private:
+  DirectCompositionSurface() = default;
+
+  // Sets up the composition tree that displays the swap chain on |window|.
+  bool Initialize(ID3D11Device* device, HWND window, UINT width, UINT height);
+
+  // Makes the visual display the swap chain upright for a surface that is
+  // |height| pixels tall.
+  bool UpdateTransform(UINT height);
+
+  Microsoft::WRL::ComPtr<IDCompositionDevice> composition_device_;
+
+  Microsoft::WRL::ComPtr<IDCompositionTarget> composition_target_;
+
+  Microsoft::WRL::ComPtr<IDCompositionVisual> composition_visual_;
+
+  Microsoft::WRL::ComPtr<IDXGISwapChain2> swap_chain_;
+
+  HANDLE frame_latency_waitable_object_ = nullptr;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_WINDOWS_DIRECT_COMPOSITION_SURFACE_H_
@@ -295,6 +295,20 @@ void FlutterDesktopMessengerSetCallback(FlutterDesktopMessengerRef messenger,
       ->SetMessageCallback(channel, callback, user_data);
 }
 
+void FlutterDesktopMessengerSetCallbackOnTaskQueue(
+    FlutterDesktopMessengerRef messenger,
+    const char* channel,
+    FlutterDesktopMessageCallback callback,
+    void* user_data,
+    FlutterDesktopMessengerTaskQueue task_queue,
+    void* task_queue_user_data) {
+  flutter::FlutterDesktopMessenger::FromRef(messenger)
+      ->GetEngine()
+      ->message_dispatcher()
+      ->SetMessageCallback(channel, callback, user_data, task_queue,
+                           task_queue_user_data);
+}
+
 FlutterDesktopMessengerRef FlutterDesktopMessengerAddRef(
     FlutterDesktopMessengerRef messenger) {
   return flutter::FlutterDesktopMessenger::FromRef(messenger)
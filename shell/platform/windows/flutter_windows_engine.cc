@@ -202,6 +202,9 @@ FlutterWindowsEngine::FlutterWindowsEngine(
   texture_registrar_ =
       std::make_unique<FlutterWindowsTextureRegistrar>(this, gl_procs_);
   surface_manager_ = AngleSurfaceManager::Create();
+  if (surface_manager_) {
+    vsync_thread_ = std::make_unique<fml::Thread>("io.flutter.vsync");
+  }
   window_proc_delegate_manager_ = std::make_unique<WindowProcDelegateManager>();
 
   // Set up internal channels.
@@ -384,6 +387,10 @@ bool FlutterWindowsEngine::Run(std::string_view entrypoint) {
 }
 
 bool FlutterWindowsEngine::Stop() {
+  if (vsync_thread_) {
+    // Vsync waits must not outlive the embedder engine.
+    vsync_thread_->Join();
+  }
   if (engine_) {
     for (const auto& [callback, registrar] :
          plugin_registrar_destruction_callbacks_) {
@@ -401,6 +408,30 @@ void FlutterWindowsEngine::SetView(FlutterWindowsView* view) {
 }
 
 void FlutterWindowsEngine::OnVsync(intptr_t baton) {
+  if (!vsync_thread_ || !surface_manager_ ||
+      !surface_manager_->HasFrameLatencyWaitableObject()) {
+    SendVsyncAtNextTick(baton);
+    return;
+  }
+  // Waiting for the swap chain blocks, so it happens off the UI thread.
+  vsync_thread_->GetTaskRunner()->PostTask([this, baton]() {
+    std::chrono::nanoseconds frame_interval = FrameInterval();
+    if (!surface_manager_->WaitForFrameLatency(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                frame_interval * 2))) {
+      SendVsyncAtNextTick(baton);
+      return;
+    }
+    // The compositor can take a new frame, so the frame starts right away
+    // rather than at the next vblank.
+    std::chrono::nanoseconds current_time =
+        std::chrono::nanoseconds(embedder_api_.GetCurrentTime());
+    embedder_api_.OnVsync(engine_, baton, current_time.count(),
+                          (current_time + frame_interval).count());
+  });
+}
+
+void FlutterWindowsEngine::SendVsyncAtNextTick(intptr_t baton) {
   std::chrono::nanoseconds current_time =
       std::chrono::nanoseconds(embedder_api_.GetCurrentTime());
   std::chrono::nanoseconds frame_interval = FrameInterval();
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "flutter/fml/closure.h"
+#include "flutter/fml/thread.h"
 #include "flutter/shell/platform/common/accessibility_bridge.h"
 #include "flutter/shell/platform/common/client_wrapper/binary_messenger_impl.h"
 #include "flutter/shell/platform/common/client_wrapper/include/flutter/basic_message_channel.h"
@@ -201,6 +202,10 @@ class FlutterWindowsEngine {
   bool PostRasterThreadTask(fml::closure callback);
 
   // Invoke on the embedder's vsync callback to schedule a frame.
+  //
+  // When the view presents through a swap chain with a frame latency
+  // waitable object, the frame is scheduled once the compositor is ready for
+  // it. Otherwise it is scheduled at the next vblank.
   void OnVsync(intptr_t baton);
 
   // Dispatches a semantics action to the specified semantics node.
@@ -318,6 +323,9 @@ class FlutterWindowsEngine {
   // The approximate time between vblank events.
   std::chrono::nanoseconds FrameInterval();
 
+  // Schedules the frame for |baton| at the next vblank.
+  void SendVsyncAtNextTick(intptr_t baton);
+
   // The start time used to align frames.
   std::chrono::nanoseconds start_time_ = std::chrono::nanoseconds::zero();
 
@@ -342,6 +350,12 @@ class FlutterWindowsEngine {
 
   // Wrapper providing Windows registry access.
   std::unique_ptr<WindowsRegistry> windows_registry_;
+
+  // The thread that waits on the swap chain's frame latency waitable object
+  // before scheduling frames. Declared last so that it is joined before the
+  // members its tasks use are destroyed. May be nullptr if ANGLE failed to
+  // initialize.
+  std::unique_ptr<fml::Thread> vsync_thread_;
 };
 
 }  // namespace flutter
@@ -7,6 +7,8 @@
 #include <atomic>
 #include <utility>
 
+#include "flutter/fml/trace_event.h"
+
 namespace flutter {
 
 TaskRunner::TaskRunner(CurrentTimeProc get_current_time,
@@ -49,6 +51,18 @@ std::chrono::nanoseconds TaskRunner::ProcessTasks() {
     }
   }
 
+#if !FLUTTER_RELEASE
+  if (!expired_tasks.empty()) {
+    // Tasks expire in order of their fire time, so the first one has waited
+    // the longest.
+    auto max_latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        now - expired_tasks.front().fire_time);
+    FML_TRACE_COUNTER("flutter", "TaskRunnerQueueLatency",
+                      reinterpret_cast<int64_t>(this), "MaxMicroseconds",
+                      max_latency.count(), "TaskCount", expired_tasks.size());
+  }
+#endif  // !FLUTTER_RELEASE
+
   // Fire expired tasks.
   {
     // Flushing tasks here without holing onto the task queue mutex.
@@ -36,6 +36,17 @@ class MockTaskRunner : public TaskRunner {
 uint64_t MockGetCurrentTime() {
   return 10000;
 }
+
+class CountingDelegate : public TaskRunnerWindow::Delegate {
+ public:
+  // |TaskRunnerWindow::Delegate|
+  std::chrono::nanoseconds ProcessTasks() override {
+    process_count++;
+    return std::chrono::nanoseconds::max();
+  }
+
+  int process_count = 0;
+};
 }  // namespace
 
 TEST(TaskRunnerTest, MaybeExecuteTaskWithExactOrder) {
@@ -84,5 +95,26 @@ TEST(TaskRunnerTest, MaybeExecuteTaskOnlyExpired) {
   EXPECT_EQ(executed_task, only_task_expired_before_now);
 }
 
+TEST(TaskRunnerWindowTest, CoalescesWakeUps) {
+  std::shared_ptr<TaskRunnerWindow> window =
+      TaskRunnerWindow::GetSharedInstance();
+  CountingDelegate delegate;
+  window->AddDelegate(&delegate);
+
+  for (int i = 0; i < 10; i++) {
+    window->WakeUp();
+  }
+  MSG message;
+  while (PeekMessage(&message, nullptr, 0, 0, PM_REMOVE)) {
+    DispatchMessage(&message);
+  }
+
+  // The timer started by AddDelegate may add a pass of its own.
+  EXPECT_GE(delegate.process_count, 1);
+  EXPECT_LE(delegate.process_count, 2);
+
+  window->RemoveDelegate(&delegate);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -8,6 +8,12 @@
 
 #include "flutter/fml/logging.h"
 
+// Available from Windows 10 version 1803. Older versions of Windows fail to
+// create timers with it.
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
 namespace flutter {
 
 TaskRunnerWindow::TaskRunnerWindow() {
@@ -30,9 +36,30 @@ TaskRunnerWindow::TaskRunnerWindow() {
     OutputDebugString(message);
     LocalFree(message);
   }
+
+  // Unlike WM_TIMER, high resolution timers are not limited to the ~15.6 ms
+  // resolution of the system timer.
+  timer_ = CreateWaitableTimerExW(nullptr, nullptr,
+                                  CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                  TIMER_ALL_ACCESS);
+  if (timer_ &&
+      !RegisterWaitForSingleObject(&timer_wait_, timer_, OnTimerSignaled, this,
+                                   INFINITE, WT_EXECUTEINWAITTHREAD)) {
+    CloseHandle(timer_);
+    timer_ = nullptr;
+  }
 }
 
 TaskRunnerWindow::~TaskRunnerWindow() {
+  if (timer_wait_) {
+    // Waits for a running |OnTimerSignaled| to return.
+    UnregisterWaitEx(timer_wait_, INVALID_HANDLE_VALUE);
+    timer_wait_ = nullptr;
+  }
+  if (timer_) {
+    CloseHandle(timer_);
+    timer_ = nullptr;
+  }
   if (window_handle_) {
     DestroyWindow(window_handle_);
     window_handle_ = nullptr;
@@ -52,7 +79,12 @@ std::shared_ptr<TaskRunnerWindow> TaskRunnerWindow::GetSharedInstance() {
 }
 
 void TaskRunnerWindow::WakeUp() {
+  // The pending message processes every task posted before it is handled.
+  if (wake_up_pending_.exchange(true)) {
+    return;
+  }
   if (!PostMessage(window_handle_, WM_NULL, 0, 0)) {
+    wake_up_pending_ = false;
     FML_LOG(ERROR) << "Failed to post message to main thread.";
   }
 }
@@ -70,6 +102,10 @@ void TaskRunnerWindow::RemoveDelegate(Delegate* delegate) {
 }
 
 void TaskRunnerWindow::ProcessTasks() {
+  // Cleared first so that tasks posted while the delegates run wake the
+  // window up again.
+  wake_up_pending_ = false;
+
   auto next = std::chrono::nanoseconds::max();
   auto delegates_copy(delegates_);
   for (auto delegate : delegates_copy) {
@@ -84,11 +120,26 @@ void TaskRunnerWindow::ProcessTasks() {
 
 void TaskRunnerWindow::SetTimer(std::chrono::nanoseconds when) {
   if (when == std::chrono::nanoseconds::max()) {
+    if (timer_) {
+      CancelWaitableTimer(timer_);
+    }
     KillTimer(window_handle_, 0);
-  } else {
-    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(when);
-    ::SetTimer(window_handle_, 0, millis.count() + 1, nullptr);
+    return;
+  }
+  if (timer_) {
+    // Negative due times are relative, in 100 nanosecond intervals.
+    LARGE_INTEGER due_time;
+    due_time.QuadPart = -std::max<int64_t>((when.count() + 99) / 100, 0);
+    if (SetWaitableTimer(timer_, &due_time, 0, nullptr, nullptr, FALSE)) {
+      return;
+    }
   }
+  auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(when);
+  ::SetTimer(window_handle_, 0, millis.count() + 1, nullptr);
+}
+
+void TaskRunnerWindow::OnTimerSignaled(PVOID context, BOOLEAN timed_out) {
+  static_cast<TaskRunnerWindow*>(context)->WakeUp();
 }
 
 WNDCLASS TaskRunnerWindow::RegisterWindowClass() {
@@ -7,6 +7,7 @@
 
 #include <windows.h>
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -28,7 +29,10 @@ class TaskRunnerWindow {
 
   static std::shared_ptr<TaskRunnerWindow> GetSharedInstance();
 
-  // Triggers processing delegate tasks on main thread
+  // Triggers processing delegate tasks on main thread. Wake ups requested
+  // before the delegates process their tasks are coalesced into one.
+  //
+  // Can be called on any thread.
   void WakeUp();
 
   void AddDelegate(Delegate* delegate);
@@ -41,8 +45,13 @@ class TaskRunnerWindow {
 
   void ProcessTasks();
 
+  // Schedules the next call to |ProcessTasks| in |when|, or cancels it if
+  // |when| is `std::chrono::nanoseconds::max()`.
   void SetTimer(std::chrono::nanoseconds when);
 
+  // Called on a thread pool thread when timer_ is signaled.
+  static void CALLBACK OnTimerSignaled(PVOID context, BOOLEAN timed_out);
+
   WNDCLASS RegisterWindowClass();
 
   LRESULT
@@ -58,6 +67,17 @@ class TaskRunnerWindow {
   HWND window_handle_;
   std::wstring window_class_name_;
   std::vector<Delegate*> delegates_;
+
+  // Whether a message to process tasks was posted and not yet handled.
+  std::atomic<bool> wake_up_pending_ = false;
+
+  // A high resolution waitable timer that wakes up the window for delayed
+  // tasks, or nullptr if the system does not support them. WM_TIMER is used
+  // instead in that case.
+  HANDLE timer_ = nullptr;
+
+  // The registration of |OnTimerSignaled| as the callback of timer_.
+  HANDLE timer_wait_ = nullptr;
 };
 }  // namespace flutter
 
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+#
+# Copyright 2013 The Flutter Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+"""Compares two runs of engine benchmarks and flags significant regressions.
+
+The runs are read from the files written by the benchmark executables with
+--benchmark_results_out, which share the schema described in
+flutter/benchmarking/results_reporter.h. Run the benchmarks with
+--benchmark_repetitions (at least 5, preferably more) so that there are enough
+samples to tell noise from a regression.
+
+A metric regressed if its median grew by more than the threshold, and a
+two-sided Mann-Whitney U test rejects that both runs come from the same
+distribution. The test makes no assumption about the shape of the
+distributions, which are rarely normal for timings.
+
+Usage:
+  compare_benchmark_results.py baseline.json candidate.json
+"""
+
+import argparse
+import json
+import math
+import sys
+
+SCHEMA_VERSION = 1
+
+# Below this number of samples per run the U test can never be significant at
+# the usual levels, so such metrics are reported as inconclusive.
+MIN_SAMPLES = 3
+
+
+def load_results(path):
+  """Returns a dict from benchmark names to their metrics."""
+  with open(path, 'r') as results_file:
+    results = json.load(results_file)
+  if results.get('schema_version') != SCHEMA_VERSION:
+    raise ValueError(
+        '%s has schema version %s, expected %d' %
+        (path, results.get('schema_version'), SCHEMA_VERSION)
+    )
+  return {
+      benchmark['name']: benchmark['metrics']
+      for benchmark in results['benchmarks']
+  }
+
+
+def _normal_cdf(value):
+  return 0.5 * (1 + math.erf(value / math.sqrt(2)))
+
+
+def mann_whitney_u_p_value(baseline, candidate):
+  """Returns the two-sided p-value of the Mann-Whitney U test.
+
+  Uses the normal approximation with a correction for ties, which is accurate
+  enough for the sample sizes of benchmark repetitions.
+  """
+  n1 = len(baseline)
+  n2 = len(candidate)
+  combined = sorted([(value, 0) for value in baseline] +
+                    [(value, 1) for value in candidate])
+
+  # Assigns the average rank to tied values.
+  ranks = [0.0] * len(combined)
+  tie_correction = 0.0
+  i = 0
+  while i < len(combined):
+    j = i
+    while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+      j += 1
+    for k in range(i, j + 1):
+      ranks[k] = (i + j) / 2.0 + 1
+    tied = j - i + 1
+    tie_correction += tied**3 - tied
+    i = j + 1
+
+  rank_sum = sum(rank for rank, (_, run) in zip(ranks, combined) if run == 0)
+  u = rank_sum - n1 * (n1 + 1) / 2.0
+  n = n1 + n2
+  variance = n1 * n2 / 12.0 * ((n + 1) - tie_correction / (n * (n - 1)))
+  if variance <= 0:
+    # All samples are equal.
+    return 1.0
+  z = (u - n1 * n2 / 2.0) / math.sqrt(variance)
+  return 2 * (1 - _normal_cdf(abs(z)))
+
+
+def compare_metric(baseline, candidate, threshold, alpha):
+  """Compares the samples of a metric in two runs.
+
+  Returns a tuple of the relative change of the median, the p-value or None if
+  there are too few samples, and the verdict, one of 'regression',
+  'improvement', 'inconclusive' or 'unchanged'.
+  """
+  baseline_median = baseline['median']
+  candidate_median = candidate['median']
+  if baseline_median == 0:
+    change = 0.0 if candidate_median == 0 else math.inf
+  else:
+    change = (candidate_median - baseline_median) / abs(baseline_median)
+
+  baseline_samples = baseline.get('samples', [])
+  candidate_samples = candidate.get('samples', [])
+  if len(baseline_samples) < MIN_SAMPLES or len(
+      candidate_samples) < MIN_SAMPLES:
+    verdict = 'inconclusive' if abs(change) > threshold else 'unchanged'
+    return change, None, verdict
+
+  p_value = mann_whitney_u_p_value(baseline_samples, candidate_samples)
+  if p_value >= alpha or abs(change) <= threshold:
+    return change, p_value, 'unchanged'
+  # Every metric of the schema is better when lower.
+  return change, p_value, 'regression' if change > 0 else 'improvement'
+
+
+def compare_results(baseline, candidate, threshold, alpha):
+  """Returns a list of (benchmark, metric, change, p_value, verdict) tuples for
+  the metrics that are present in both runs."""
+  comparisons = []
+  for name, baseline_metrics in baseline.items():
+    candidate_metrics = candidate.get(name)
+    if candidate_metrics is None:
+      continue
+    for metric, baseline_metric in baseline_metrics.items():
+      candidate_metric = candidate_metrics.get(metric)
+      if candidate_metric is None:
+        continue
+      change, p_value, verdict = compare_metric(
+          baseline_metric, candidate_metric, threshold, alpha
+      )
+      comparisons.append((name, metric, change, p_value, verdict))
+  return comparisons
+
+
+def main():
+  parser = argparse.ArgumentParser(
+      description='Flags statistically significant regressions between two '
+      'runs of engine benchmarks.'
+  )
+  parser.add_argument(
+      'baseline', help='The results written with --benchmark_results_out.'
+  )
+  parser.add_argument(
+      'candidate', help='The results to compare against the baseline.'
+  )
+  parser.add_argument(
+      '--threshold',
+      type=float,
+      default=0.05,
+      help='The relative change of the median below which a difference is '
+      'ignored, even if it is significant. Defaults to 0.05 (5%%).'
+  )
+  parser.add_argument(
+      '--alpha',
+      type=float,
+      default=0.05,
+      help='The significance level of the test. Defaults to 0.05.'
+  )
+  parser.add_argument(
+      '--metric',
+      action='append',
+      help='Only compare this metric, for example real_time. Can be repeated. '
+      'Defaults to all metrics.'
+  )
+  parser.add_argument(
+      '--verbose',
+      action='store_true',
+      help='Also list the metrics that did not change.'
+  )
+  args = parser.parse_args()
+
+  baseline = load_results(args.baseline)
+  candidate = load_results(args.candidate)
+  comparisons = compare_results(baseline, candidate, args.threshold, args.alpha)
+  if args.metric:
+    comparisons = [c for c in comparisons if c[1] in args.metric]
+
+  for name in sorted(set(baseline) ^ set(candidate)):
+    print('%s: only in %s' %
+          (name, 'baseline' if name in baseline else 'candidate'))
+
+  regressions = 0
+  for name, metric, change, p_value, verdict in comparisons:
+    if verdict == 'regression':
+      regressions += 1
+    if verdict == 'unchanged' and not args.verbose:
+      continue
+    p_text = 'n/a' if p_value is None else '%.4f' % p_value
+    print(
+        '%-12s %s %s: %+.1f%% (p=%s)' %
+        (verdict.upper(), name, metric, change * 100, p_text)
+    )
+
+  print(
+      '%d regressions in %d compared metrics.' % (regressions, len(comparisons))
+  )
+  return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
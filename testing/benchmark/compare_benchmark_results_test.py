@@ -0,0 +1,77 @@
+# Copyright 2013 The Flutter Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+import unittest
+
+import compare_benchmark_results as compare
+
+
+def _metric(samples):
+  ordered = sorted(samples)
+  return {'median': ordered[len(ordered) // 2], 'samples': samples}
+
+
+class CompareBenchmarkResultsTest(unittest.TestCase):
+
+  def test_p_value_of_separated_samples(self):
+    p_value = compare.mann_whitney_u_p_value([1, 2, 3, 4, 5], [6, 7, 8, 9, 10])
+    self.assertAlmostEqual(p_value, 0.0090, places=4)
+
+  def test_p_value_of_equal_samples(self):
+    self.assertEqual(compare.mann_whitney_u_p_value([1, 1, 1], [1, 1, 1]), 1.0)
+
+  def test_significant_slowdown_is_a_regression(self):
+    _, _, verdict = compare.compare_metric(
+        _metric([10, 11, 10, 12, 11, 10]), _metric([14, 15, 14, 16, 15, 14]),
+        threshold=0.05,
+        alpha=0.05
+    )
+    self.assertEqual(verdict, 'regression')
+
+  def test_significant_speedup_is_an_improvement(self):
+    _, _, verdict = compare.compare_metric(
+        _metric([14, 15, 14, 16, 15, 14]), _metric([10, 11, 10, 12, 11, 10]),
+        threshold=0.05,
+        alpha=0.05
+    )
+    self.assertEqual(verdict, 'improvement')
+
+  def test_noise_is_unchanged(self):
+    _, _, verdict = compare.compare_metric(
+        _metric([10, 14, 11, 13, 12]), _metric([11, 13, 10, 14, 12]),
+        threshold=0.05,
+        alpha=0.05
+    )
+    self.assertEqual(verdict, 'unchanged')
+
+  def test_small_significant_change_is_unchanged(self):
+    _, _, verdict = compare.compare_metric(
+        _metric([100, 100, 100, 100, 100]), _metric([101, 101, 101, 101, 101]),
+        threshold=0.05,
+        alpha=0.05
+    )
+    self.assertEqual(verdict, 'unchanged')
+
+  def test_single_samples_are_inconclusive(self):
+    change, p_value, verdict = compare.compare_metric(
+        _metric([10]), _metric([20]), threshold=0.05, alpha=0.05
+    )
+    self.assertAlmostEqual(change, 1.0)
+    self.assertIsNone(p_value)
+    self.assertEqual(verdict, 'inconclusive')
+
+  def test_only_common_metrics_are_compared(self):
+    baseline = {
+        'BM_A': {'real_time': _metric([1, 2, 3]), 'gpu_time': _metric([1])},
+        'BM_B': {'real_time': _metric([1, 2, 3])},
+    }
+    candidate = {'BM_A': {'real_time': _metric([1, 2, 3])}}
+    comparisons = compare.compare_results(
+        baseline, candidate, threshold=0.05, alpha=0.05
+    )
+    self.assertEqual([(c[0], c[1]) for c in comparisons],
+                     [('BM_A', 'real_time')])
+
+
+if __name__ == '__main__':
+  unittest.main()
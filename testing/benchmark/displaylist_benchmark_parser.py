@@ -113,6 +113,30 @@ class BenchmarkResult:
 
     return figures
 
+  def writeFit(self, writer):
+    # Fit each series to y = m * x + c with least squares. These are the
+    # trend lines that the weightings in the DisplayList complexity
+    # calculators are derived from.
+    for family in self.series:
+      x_values = [float(x) for x in self.series[family]['x']]
+      y_values = self.series[family]['y']
+      count = len(x_values)
+      if count < 2:
+        continue
+      mean_x = sum(x_values) / count
+      mean_y = sum(y_values) / count
+      sxx = sum((x - mean_x)**2 for x in x_values)
+      sxy = sum((x - mean_x) * (y - mean_y) for x, y in zip(x_values, y_values))
+      if sxx == 0:
+        continue
+      m = sxy / sxx
+      c = mean_y - m * mean_x
+      syy = sum((y - mean_y)**2 for y in y_values)
+      r_squared = 1.0 if syy == 0 else (sxy * sxy) / (sxx * syy)
+      writer.writerow([
+          self.name, self.backend, self.seriesLabels[family], m, c, r_squared
+      ])
+
   def writeCSV(self, writer):
     # For now assume that all our series have the same x values
     # this is true for now, but may differ in the future with benchmark changes
@@ -161,9 +185,20 @@ def main():
       help='Filename to output the CSV data to.'
   )
 
+  parser.add_argument(
+      '-f',
+      '--output-fit',
+      dest='outputFit',
+      action='store',
+      default=None,
+      help='Filename to output the linear fit (m, c) of every series to.'
+  )
+
   args = parser.parse_args()
   jsonData = parseJSON(args.filename)
-  return processBenchmarkData(jsonData, args.outputPDF, args.outputCSV)
+  return processBenchmarkData(
+      jsonData, args.outputPDF, args.outputCSV, args.outputFit
+  )
 
 
 def error(message):
@@ -190,7 +225,7 @@ def extractAttributesLabel(benchmarkResult):
   return label[:-2]
 
 
-def processBenchmarkData(benchmarkJSON, outputPDF, outputCSV):
+def processBenchmarkData(benchmarkJSON, outputPDF, outputCSV, outputFit=None):
   benchmarkResultsData = {}
 
   for benchmarkResult in benchmarkJSON:
@@ -267,6 +302,14 @@ def processBenchmarkData(benchmarkJSON, outputPDF, outputCSV):
     benchmarkResultsData[benchmark].writeCSV(csv_writer)
   pp.close()
 
+  if outputFit is not None:
+    fit_file = open(outputFit, 'w')
+    fit_writer = csv.writer(fit_file)
+    fit_writer.writerow(['benchmark', 'backend', 'series', 'm', 'c', 'r2'])
+    for benchmark in benchmarkResultsData:
+      benchmarkResultsData[benchmark].writeFit(fit_writer)
+    fit_file.close()
+
 
 def parseJSON(filename):
   try:
@@ -42,6 +42,8 @@ cd "$SCRIPT_DIR"
   --json ../../../out/host_release/fml_benchmarks.json "$@"
 "$DART" --disable-dart-dev bin/parse_and_send.dart \
   --json ../../../out/host_release/shell_benchmarks.json "$@"
+"$DART" --disable-dart-dev bin/parse_and_send.dart \
+  --json ../../../out/host_release/embedder_benchmarks.json "$@"
 "$DART" --disable-dart-dev bin/parse_and_send.dart \
   --json ../../../out/host_release/ui_benchmarks.json "$@"
 "$DART" --disable-dart-dev bin/parse_and_send.dart \
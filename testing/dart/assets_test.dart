@@ -57,6 +57,16 @@ void main() {
     buffer.dispose();
   });
 
+  test('asset buffers outlive their disposal while in use', () async {
+    final ImmutableBuffer buffer = await ImmutableBuffer.fromAsset('DashInNooglerHat.jpg');
+    final ImageDescriptor descriptor = await ImageDescriptor.encoded(buffer);
+    buffer.dispose();
+
+    expect(descriptor.width, 4032);
+    expect(descriptor.height, 3024);
+    descriptor.dispose();
+  });
+
   test('Tester can disable loading fonts from an asset bundle', () async {
     final List<int> ahemImage = await _createPictureFromFont('Ahem');
     // Font that is bundled in the asset directory of the test runner.
@@ -970,6 +970,62 @@ void main() {
     canvas.restoreToCount(canvas.getSaveCount() + 1);
     expect(canvas.getSaveCount(), equals(6));
   });
+
+  Future<List<int>> rgbaAt(Image image, List<Offset> offsets) async {
+    final ByteData data = (await image.toByteData())!;
+    return <int>[
+      for (final Offset offset in offsets)
+        data.getUint32((offset.dy.toInt() * image.width + offset.dx.toInt()) * 4),
+    ];
+  }
+
+  test('Batched draws keep their order relative to unbatched draws', () async {
+    final Image image = await toImage((Canvas canvas) {
+      canvas.drawRect(const Rect.fromLTRB(0, 0, 10, 10), Paint()..color = const Color(0xFFFF0000));
+      // A paint with a shader cannot be batched.
+      final Paint shaderPaint = Paint()
+        ..shader = Gradient.linear(Offset.zero, const Offset(10, 0), <Color>[const Color(0xFF00FF00), const Color(0xFF00FF00)]);
+      canvas.drawRect(const Rect.fromLTRB(0, 0, 10, 10), shaderPaint);
+      canvas.save();
+      canvas.translate(5, 0);
+      canvas.drawRect(const Rect.fromLTRB(0, 0, 5, 10), Paint()..color = const Color(0xFF0000FF));
+      canvas.restore();
+    }, 10, 10);
+
+    expect(await rgbaAt(image, const <Offset>[Offset(2, 5), Offset(7, 5)]), <int>[0x00FF00FF, 0x0000FFFF]);
+  });
+
+  test('Changing a paint does not affect batched draws that used it', () async {
+    final Image image = await toImage((Canvas canvas) {
+      final Paint paint = Paint()..color = const Color(0xFFFF0000);
+      canvas.drawRect(const Rect.fromLTRB(0, 0, 5, 10), paint);
+      paint.color = const Color(0xFF0000FF);
+      canvas.drawRect(const Rect.fromLTRB(5, 0, 10, 10), paint);
+    }, 10, 10);
+
+    expect(await rgbaAt(image, const <Offset>[Offset(2, 5), Offset(7, 5)]), <int>[0xFF0000FF, 0x0000FFFF]);
+  });
+
+  test('Batched draws that overflow the command buffer are all recorded', () async {
+    const int width = 50;
+    const int height = 40;
+    final Image image = await toImage((Canvas canvas) {
+      final Paint paint = Paint()..color = const Color(0xFF00FF00);
+      for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+          canvas.drawRect(Rect.fromLTWH(x.toDouble(), y.toDouble(), 1, 1), paint);
+        }
+      }
+      expect(canvas.getSaveCount(), equals(1));
+    }, width, height);
+
+    final List<int> pixels = await rgbaAt(image, <Offset>[
+      for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+          Offset(x.toDouble(), y.toDouble()),
+    ]);
+    expect(pixels.every((int pixel) => pixel == 0x00FF00FF), isTrue);
+  });
 }
 
 Matcher listEquals(ByteData expected) => (dynamic v) {
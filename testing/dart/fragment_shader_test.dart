@@ -204,6 +204,33 @@ void main() async {
     shader.dispose();
   });
 
+  test('Reused FragmentShader does not change recorded pictures', () async {
+    final FragmentProgram program = await FragmentProgram.fromAsset(
+      'functions.frag.iplr',
+    );
+    final FragmentShader shader = program.fragmentShader()
+      ..setFloat(0, 1.0);
+    final PictureRecorder recorder = PictureRecorder();
+    Canvas(recorder).drawPaint(Paint()..shader = shader);
+    final Picture picture = recorder.endRecording();
+
+    shader.setFloat(0, 0.0);
+    await _expectShaderRendersBlack(shader);
+
+    final Image image = await picture.toImage(
+      _shaderImageDimension,
+      _shaderImageDimension,
+    );
+    final ByteData renderedBytes = (await image.toByteData())!;
+    for (final int c in renderedBytes.buffer.asUint32List()) {
+      expect(toHexString(c), toHexString(_greenColor.value));
+    }
+
+    image.dispose();
+    picture.dispose();
+    shader.dispose();
+  });
+
   test('FragmentShader blue-green image renders green', () async {
     final FragmentProgram program = await FragmentProgram.fromAsset(
       'blue_green_sampler.frag.iplr',
@@ -37,6 +37,18 @@ void main() {
     expect(codec.frameCount, 1);
   });
 
+  test('image descriptor - encoded - with mipmaps', () async {
+    final Uint8List bytes = await readFile('square.png');
+    final ImmutableBuffer buffer = await ImmutableBuffer.fromUint8List(bytes);
+    final ImageDescriptor descriptor = await ImageDescriptor.encoded(buffer);
+
+    final Codec codec = await descriptor.instantiateCodec(generateMipmaps: true);
+    expect(codec.frameCount, 1);
+    final FrameInfo frame = await codec.getNextFrame();
+    expect(frame.image.width, 10);
+    expect(frame.image.height, 10);
+  });
+
   test('basic image descriptor - encoded - animated', () async {
     final Uint8List bytes = await _getSkiaResource('test640x479.gif').readAsBytes();
     final ImmutableBuffer buffer = await ImmutableBuffer.fromUint8List(bytes);
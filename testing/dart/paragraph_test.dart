@@ -34,6 +34,52 @@ void main() {
     }
   });
 
+  test('lays out a paragraph asynchronously like synchronously', () async {
+    const double fontSize = 10.0;
+    Paragraph build() {
+      final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
+        fontFamily: 'Ahem',
+        fontStyle: FontStyle.normal,
+        fontWeight: FontWeight.normal,
+        fontSize: fontSize,
+      ));
+      builder.addText('Test Ahem ' * 100);
+      return builder.build();
+    }
+
+    const ParagraphConstraints constraints = ParagraphConstraints(width: fontSize * 5.0);
+    final Paragraph expected = build()..layout(constraints);
+    final Paragraph paragraph = build();
+    await paragraph.layoutAsync(constraints);
+
+    expect(paragraph.height, closeTo(expected.height, 0.001));
+    expect(paragraph.width, closeTo(expected.width, 0.001));
+    expect(paragraph.longestLine, closeTo(expected.longestLine, 0.001));
+    expect(paragraph.computeLineMetrics().length, expected.computeLineMetrics().length);
+    expect(paragraph.computeLineMetrics().length, 200);
+
+    final PictureRecorder recorder = PictureRecorder();
+    Canvas(recorder).drawParagraph(paragraph, Offset.zero);
+    recorder.endRecording().dispose();
+    expected.dispose();
+    paragraph.dispose();
+  });
+
+  test('a paragraph can be disposed while it is laid out asynchronously', () async {
+    final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
+      fontFamily: 'Ahem',
+      fontSize: 10.0,
+    ));
+    builder.addText('Test Ahem');
+    final Paragraph paragraph = builder.build();
+    final Future<void> layout = paragraph.layoutAsync(const ParagraphConstraints(width: 100.0));
+    paragraph.dispose();
+    bool completed = false;
+    layout.then((void _) => completed = true);
+    await Future<void>.delayed(const Duration(milliseconds: 100));
+    expect(completed, false);
+  });
+
   test('predictably lays out a multi-line paragraph', () {
     for (final double fontSize in <double>[10.0, 20.0, 30.0, 40.0]) {
       final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
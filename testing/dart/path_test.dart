@@ -225,4 +225,26 @@ void main() {
     expect(newFirstMetric.getTangentForOffset(4.0)!.vector, const Offset(0.0, 1.0));
     expect(newFirstMetric.extractPath(4.0, 10.0).computeMetrics().first.length, 6.0);
   });
+
+  test('PathMetric.extractPathSegments extracts all segments into one path', () {
+    final Path path = Path()..lineTo(0, 10)..lineTo(10, 10);
+    final PathMetric metric = path.computeMetrics().first;
+    final Path dashes = metric.extractPathSegments(<double>[0.0, 2.0, 4.0, 6.0, 8.0, 12.0]);
+    final List<PathMetric> dashMetrics = dashes.computeMetrics().toList();
+    expect(dashMetrics.length, 3);
+    expect(dashMetrics[0].length, 2.0);
+    expect(dashMetrics[1].length, 2.0);
+    expect(dashMetrics[2].length, 4.0);
+    expect(dashes.getBounds(), const Rect.fromLTRB(0.0, 0.0, 2.0, 10.0));
+  });
+
+  test('PathMetrics of an unchanged path are measured again consistently', () {
+    final Path path = Path()..addRect(const Rect.fromLTRB(0, 0, 10, 10));
+    for (int i = 0; i < 3; i++) {
+      final List<PathMetric> metrics = path.computeMetrics().toList();
+      expect(metrics.length, 1);
+      expect(metrics[0].length, 40.0);
+      expect(metrics[0].isClosed, true);
+    }
+  });
 }
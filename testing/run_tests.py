@@ -477,6 +477,9 @@ def RunEngineBenchmarks(build_dir, filter):
   if IsLinux():
     RunEngineExecutable(build_dir, 'txt_benchmarks', filter, icu_flags)
 
+  if IsLinux() or IsMac():
+    RunEngineExecutable(build_dir, 'common_cpp_benchmarks', filter, icu_flags)
+
 
 def GatherDartTest(
     build_dir,
@@ -0,0 +1,99 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tonic/typed_data/dart_byte_data.h"
+
+#include "flutter/testing/dart_isolate_runner.h"
+#include "flutter/testing/fixture_test.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+void FreeFinalizer(void* isolate_callback_data, void* peer) {
+  free(peer);
+}
+
+void SetFlagFinalizer(void* isolate_callback_data, void* peer) {
+  *static_cast<bool*>(peer) = true;
+}
+}  // namespace
+
+class DartByteDataTest : public FixtureTest {
+ public:
+  DartByteDataTest()
+      : settings_(CreateSettingsForFixture()),
+        vm_(DartVMRef::Create(settings_)) {}
+
+  ~DartByteDataTest() = default;
+
+  [[nodiscard]] bool RunInIsolateScope(std::function<bool(void)> closure) {
+    auto thread = CreateNewThread();
+    TaskRunners single_threaded_task_runner(GetCurrentTestName(), thread,
+                                            thread, thread, thread);
+    auto isolate =
+        RunDartCodeInIsolate(vm_, settings_, single_threaded_task_runner,
+                             "main", {}, GetDefaultKernelFilePath());
+    if (!isolate || isolate->get()->GetPhase() != DartIsolate::Phase::Running) {
+      return false;
+    }
+    return isolate->RunInIsolateScope(closure);
+  }
+
+ private:
+  Settings settings_;
+  DartVMRef vm_;
+  FML_DISALLOW_COPY_AND_ASSIGN(DartByteDataTest);
+};
+
+TEST_F(DartByteDataTest, CreateExternalDoesNotCopy) {
+  ASSERT_TRUE(RunInIsolateScope([]() -> bool {
+    const size_t length = 4096;
+    void* buffer = ::malloc(length);
+    Dart_Handle handle = tonic::DartByteData::CreateExternal(
+        buffer, length, buffer, FreeFinalizer);
+    EXPECT_FALSE(Dart_IsError(handle));
+
+    tonic::DartByteData byte_data(handle);
+    EXPECT_EQ(byte_data.data(), buffer);
+    EXPECT_EQ(byte_data.length_in_bytes(), length);
+    return true;
+  }));
+}
+
+TEST_F(DartByteDataTest, CreateUnmodifiableExternalDoesNotCopy) {
+  ASSERT_TRUE(RunInIsolateScope([]() -> bool {
+    const size_t length = 4096;
+    void* buffer = ::malloc(length);
+    Dart_Handle handle = tonic::DartByteData::CreateUnmodifiableExternal(
+        buffer, length, buffer, FreeFinalizer);
+    EXPECT_FALSE(Dart_IsError(handle));
+    EXPECT_TRUE(Dart_IsByteData(handle));
+
+    Dart_TypedData_Type type;
+    void* data = nullptr;
+    intptr_t data_length = 0;
+    EXPECT_FALSE(Dart_IsError(
+        Dart_TypedDataAcquireData(handle, &type, &data, &data_length)));
+    EXPECT_EQ(data, buffer);
+    EXPECT_EQ(static_cast<size_t>(data_length), length);
+    Dart_TypedDataReleaseData(handle);
+    return true;
+  }));
+}
+
+TEST_F(DartByteDataTest, CreateExternalFinalizesDataOnFailure) {
+  ASSERT_TRUE(RunInIsolateScope([]() -> bool {
+    bool finalized = false;
+    // The length is out of range, so the ByteData cannot be created.
+    Dart_Handle handle = tonic::DartByteData::CreateExternal(
+        &finalized, static_cast<size_t>(-1), &finalized, SetFlagFinalizer);
+    EXPECT_TRUE(Dart_IsError(handle));
+    EXPECT_TRUE(finalized);
+    return true;
+  }));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -31,11 +31,35 @@ Dart_Handle DartByteData::Create(const void* data, size_t length) {
     void* buf = ::malloc(length);
     TONIC_DCHECK(buf);
     ::memcpy(buf, data, length);
-    return Dart_NewExternalTypedDataWithFinalizer(
-        Dart_TypedData_kByteData, buf, length, buf, length, FreeFinalizer);
+    return CreateExternal(buf, length, buf, FreeFinalizer);
   }
 }
 
+Dart_Handle DartByteData::CreateExternal(void* data,
+                                         size_t length,
+                                         void* peer,
+                                         Dart_HandleFinalizer finalizer) {
+  Dart_Handle handle = Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kByteData, data, length, peer, length, finalizer);
+  if (Dart_IsError(handle)) {
+    finalizer(nullptr, peer);
+  }
+  return handle;
+}
+
+Dart_Handle DartByteData::CreateUnmodifiableExternal(
+    const void* data,
+    size_t length,
+    void* peer,
+    Dart_HandleFinalizer finalizer) {
+  Dart_Handle handle = Dart_NewUnmodifiableExternalTypedDataWithFinalizer(
+      Dart_TypedData_kByteData, data, length, peer, length, finalizer);
+  if (Dart_IsError(handle)) {
+    finalizer(nullptr, peer);
+  }
+  return handle;
+}
+
 DartByteData::DartByteData()
     : data_(nullptr), length_in_bytes_(0), dart_handle_(nullptr) {}
 
@@ -17,6 +17,25 @@ class DartByteData {
   static const size_t kExternalSizeThreshold;
   static Dart_Handle Create(const void* data, size_t length);
 
+  // Wraps |data| in a ByteData without copying it. The |finalizer| is called
+  // with |peer| once the ByteData is collected and must free |data|. The
+  // length is reported to the Dart GC as an external allocation.
+  //
+  // Ownership of |data| always transfers: if the ByteData cannot be created,
+  // the |finalizer| is called before the error is returned.
+  static Dart_Handle CreateExternal(void* data,
+                                    size_t length,
+                                    void* peer,
+                                    Dart_HandleFinalizer finalizer);
+
+  // Like |CreateExternal|, but Dart code cannot write to the ByteData. Use
+  // this to expose buffers that are shared with the engine, such as a
+  // mapping of an asset.
+  static Dart_Handle CreateUnmodifiableExternal(const void* data,
+                                                size_t length,
+                                                void* peer,
+                                                Dart_HandleFinalizer finalizer);
+
   explicit DartByteData(Dart_Handle list);
   DartByteData(DartByteData&& other);
   DartByteData();
@@ -21,6 +21,10 @@
 #include <log/log.h>
 #include <utils/LruCache.h>
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 #include <hb-ot.h>
 #include <hb.h>
 
@@ -29,89 +33,179 @@
 
 namespace minikin {
 
-class HbFontCache : private android::OnEntryRemoved<int32_t, hb_font_t*> {
+class HbFontCache {
  public:
-  HbFontCache() : mCache(kMaxEntries) {
-    mCache.setOnEntryRemovedListener(this);
+  static const size_t kShardCount = 8;
+  static const size_t kDefaultMaxEntries = 256;
+
+  HbFontCache() { setMaxEntries(kDefaultMaxEntries); }
+
+  // Returns a new reference to the cached font, or nullptr if there is none.
+  hb_font_t* get(int32_t fontId) {
+    Shard& shard = getShard(fontId);
+    std::scoped_lock lock(shard.mutex);
+    hb_font_t* font = shard.cache.get(fontId);
+    return font != nullptr ? hb_font_reference(font) : nullptr;
   }
 
-  // callback for OnEntryRemoved
-  void operator()(int32_t& /* key */, hb_font_t*& value) {
-    hb_font_destroy(value);
+  // Caches the font unless another thread cached a font for the same ID
+  // first. Returns a new reference to the cached font either way.
+  hb_font_t* put(int32_t fontId, hb_font_t* font) {
+    Shard& shard = getShard(fontId);
+    std::scoped_lock lock(shard.mutex);
+    hb_font_t* cached = shard.cache.get(fontId);
+    if (cached != nullptr) {
+      hb_font_destroy(font);
+      return hb_font_reference(cached);
+    }
+    shard.cache.put(fontId, font);
+    while (shard.cache.size() > shard.maxEntries) {
+      shard.cache.removeOldest();
+    }
+    return hb_font_reference(font);
   }
 
-  hb_font_t* get(int32_t fontId) { return mCache.get(fontId); }
+  void remove(int32_t fontId) {
+    Shard& shard = getShard(fontId);
+    std::scoped_lock lock(shard.mutex);
+    shard.cache.remove(fontId);
+  }
 
-  void put(int32_t fontId, hb_font_t* font) { mCache.put(fontId, font); }
+  void clear() {
+    for (Shard& shard : mShards) {
+      std::scoped_lock lock(shard.mutex);
+      shard.cache.clear();
+    }
+  }
 
-  void clear() { mCache.clear(); }
+  void setMaxEntries(size_t maxEntries) {
+    // Every shard keeps at least one font.
+    const size_t shardEntries =
+        std::max<size_t>(1, (maxEntries + kShardCount - 1) / kShardCount);
+    for (Shard& shard : mShards) {
+      std::scoped_lock lock(shard.mutex);
+      shard.maxEntries = shardEntries;
+      while (shard.cache.size() > shard.maxEntries) {
+        shard.cache.removeOldest();
+      }
+    }
+  }
 
-  void remove(int32_t fontId) { mCache.remove(fontId); }
+  size_t size() {
+    size_t size = 0;
+    for (Shard& shard : mShards) {
+      std::scoped_lock lock(shard.mutex);
+      size += shard.cache.size();
+    }
+    return size;
+  }
 
  private:
-  static const size_t kMaxEntries = 100;
+  class Shard : private android::OnEntryRemoved<int32_t, hb_font_t*> {
+   public:
+    typedef android::LruCache<int32_t, hb_font_t*> Cache;
 
-  android::LruCache<int32_t, hb_font_t*> mCache;
-};
+    // The capacity is enforced by HbFontCache, so that it can be changed.
+    Shard() : cache(Cache::kUnlimitedCapacity) {
+      cache.setOnEntryRemovedListener(this);
+    }
 
-HbFontCache* getFontCacheLocked() {
-  assertMinikinLocked();
-  static HbFontCache* cache = nullptr;
-  if (cache == nullptr) {
-    cache = new HbFontCache();
+    // callback for OnEntryRemoved
+    void operator()(int32_t& /* key */, hb_font_t*& value) override {
+      hb_font_destroy(value);
+    }
+
+    std::mutex mutex;
+    Cache cache;
+    size_t maxEntries = 0;
+  };
+
+  Shard& getShard(int32_t fontId) {
+    return mShards[static_cast<uint32_t>(fontId) % kShardCount];
   }
+
+  Shard mShards[kShardCount];
+};
+
+static HbFontCache* getFontCache() {
+  static HbFontCache* cache = new HbFontCache();
   return cache;
 }
 
-void purgeHbFontCacheLocked() {
-  assertMinikinLocked();
-  getFontCacheLocked()->clear();
+static hb_font_t* createHbFont(const MinikinFont* minikinFont) {
+  hb_face_t* face = minikinFont->CreateHarfBuzzFace();
+
+  hb_font_t* parent_font = hb_font_create(face);
+  hb_ot_font_set_funcs(parent_font);
+
+  unsigned int upem = hb_face_get_upem(face);
+  hb_font_set_scale(parent_font, upem, upem);
+
+  hb_font_t* font = hb_font_create_sub_font(parent_font);
+  std::vector<hb_variation_t> variations;
+  for (const FontVariation& variation : minikinFont->GetAxes()) {
+    variations.push_back({variation.axisTag, variation.value});
+  }
+  hb_font_set_variations(font, variations.data(), variations.size());
+  hb_font_destroy(parent_font);
+  hb_face_destroy(face);
+  hb_font_make_immutable(font);
+  return font;
 }
 
-void purgeHbFontLocked(const MinikinFont* minikinFont) {
-  assertMinikinLocked();
-  const int32_t fontId = minikinFont->GetUniqueId();
-  getFontCacheLocked()->remove(fontId);
+void purgeHbFontCache() {
+  getFontCache()->clear();
 }
 
-// Returns a new reference to a hb_font_t object, caller is
-// responsible for calling hb_font_destroy() on it.
-hb_font_t* getHbFontLocked(const MinikinFont* minikinFont) {
-  assertMinikinLocked();
+void purgeHbFont(const MinikinFont* minikinFont) {
+  getFontCache()->remove(minikinFont->GetUniqueId());
+}
+
+hb_font_t* getHbFont(const MinikinFont* minikinFont) {
   // TODO: get rid of nullFaceFont
-  static hb_font_t* nullFaceFont = nullptr;
   if (minikinFont == nullptr) {
-    if (nullFaceFont == nullptr) {
-      nullFaceFont = hb_font_create(nullptr);
-    }
+    static hb_font_t* nullFaceFont = [] {
+      hb_font_t* font = hb_font_create(nullptr);
+      hb_font_make_immutable(font);
+      return font;
+    }();
     return hb_font_reference(nullFaceFont);
   }
 
-  HbFontCache* fontCache = getFontCacheLocked();
+  HbFontCache* fontCache = getFontCache();
   const int32_t fontId = minikinFont->GetUniqueId();
   hb_font_t* font = fontCache->get(fontId);
   if (font != nullptr) {
-    return hb_font_reference(font);
+    return font;
   }
+  // The font is created without holding the lock of its shard, so that other
+  // fonts of the shard can be looked up in the meantime.
+  return fontCache->put(fontId, createHbFont(minikinFont));
+}
 
-  hb_face_t* face = minikinFont->CreateHarfBuzzFace();
+void setHbFontCacheMaxEntries(size_t maxEntries) {
+  getFontCache()->setMaxEntries(maxEntries);
+}
 
-  hb_font_t* parent_font = hb_font_create(face);
-  hb_ot_font_set_funcs(parent_font);
+size_t getHbFontCacheEntryCount() {
+  return getFontCache()->size();
+}
 
-  unsigned int upem = hb_face_get_upem(face);
-  hb_font_set_scale(parent_font, upem, upem);
+void purgeHbFontCacheLocked() {
+  assertMinikinLocked();
+  purgeHbFontCache();
+}
 
-  font = hb_font_create_sub_font(parent_font);
-  std::vector<hb_variation_t> variations;
-  for (const FontVariation& variation : minikinFont->GetAxes()) {
-    variations.push_back({variation.axisTag, variation.value});
-  }
-  hb_font_set_variations(font, variations.data(), variations.size());
-  hb_font_destroy(parent_font);
-  hb_face_destroy(face);
-  fontCache->put(fontId, font);
-  return hb_font_reference(font);
+void purgeHbFontLocked(const MinikinFont* minikinFont) {
+  assertMinikinLocked();
+  purgeHbFont(minikinFont);
+}
+
+// Returns a new reference to a hb_font_t object, caller is
+// responsible for calling hb_font_destroy() on it.
+hb_font_t* getHbFontLocked(const MinikinFont* minikinFont) {
+  assertMinikinLocked();
+  return getHbFont(minikinFont);
 }
 
 }  // namespace minikin
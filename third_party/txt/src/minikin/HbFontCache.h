@@ -17,11 +17,30 @@
 #ifndef MINIKIN_HBFONT_CACHE_H
 #define MINIKIN_HBFONT_CACHE_H
 
+#include <cstddef>
+
 struct hb_font_t;
 
 namespace minikin {
 class MinikinFont;
 
+// libtxt extension: the cache is split into shards that are each guarded by a
+// lock of their own, so these functions may be called from any thread without
+// holding gMinikinLock.
+void purgeHbFontCache();
+void purgeHbFont(const MinikinFont* minikinFont);
+
+// Returns a new reference to the HarfBuzz font of the given MinikinFont, which
+// the caller must release with hb_font_destroy(). The returned font is shared
+// with other callers and must not be modified. Create a sub font to change it.
+hb_font_t* getHbFont(const MinikinFont* minikinFont);
+
+// Sets the number of fonts that are kept in the cache, divided evenly among
+// the shards. The least recently used fonts of each shard are evicted first.
+void setHbFontCacheMaxEntries(size_t maxEntries);
+size_t getHbFontCacheEntryCount();
+
+// The variants used by minikin while it holds gMinikinLock.
 void purgeHbFontCacheLocked();
 void purgeHbFontLocked(const MinikinFont* minikinFont);
 hb_font_t* getHbFontLocked(const MinikinFont* minikinFont);
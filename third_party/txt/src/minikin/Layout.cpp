@@ -83,6 +83,8 @@ class LayoutCacheKey {
         mLetterSpacing(paint.letterSpacing),
         mPaintFlags(paint.paintFlags),
         mHyphenEdit(paint.hyphenEdit),
+        mFeatures(paint.fontFeatureSettings.data()),
+        mNfeatures(paint.fontFeatureSettings.size()),
         mIsRtl(dir),
         mHash(computeHash()) {}
   bool operator==(const LayoutCacheKey& other) const;
@@ -93,10 +95,24 @@ class LayoutCacheKey {
     uint16_t* charsCopy = new uint16_t[mNchars];
     memcpy(charsCopy, mChars, mNchars * sizeof(uint16_t));
     mChars = charsCopy;
+    char* featuresCopy = new char[mNfeatures];
+    memcpy(featuresCopy, mFeatures, mNfeatures);
+    mFeatures = featuresCopy;
   }
   void freeText() {
     delete[] mChars;
     mChars = NULL;
+    delete[] mFeatures;
+    mFeatures = NULL;
+  }
+
+  // The memory retained by a cache entry for this key and its layout.
+  size_t getFootprint(const Layout& layout) const {
+    return sizeof(LayoutCacheKey) + sizeof(Layout) +
+           mNchars * sizeof(uint16_t) + mNfeatures +
+           layout.mGlyphs.capacity() * sizeof(LayoutGlyph) +
+           layout.mAdvances.capacity() * sizeof(float) +
+           layout.mFaces.capacity() * sizeof(FakedFont);
   }
 
   void doLayout(Layout* layout,
@@ -121,6 +137,8 @@ class LayoutCacheKey {
   float mLetterSpacing;
   int32_t mPaintFlags;
   HyphenEdit mHyphenEdit;
+  const char* mFeatures;
+  size_t mNfeatures;
   bool mIsRtl;
   // Note: any fields added to MinikinPaint must also be reflected here.
   // TODO: language matching (possibly integrate into style)
@@ -129,9 +147,18 @@ class LayoutCacheKey {
   android::hash_t computeHash() const;
 };
 
+// The layouts of words are shared by all paragraphs, so a word that is laid
+// out again, for example at a different width or in another paragraph with
+// the same style, is not shaped again. Must be used with gMinikinLock held.
 class LayoutCache : private android::OnEntryRemoved<LayoutCacheKey, Layout*> {
  public:
-  LayoutCache() : mCache(kMaxEntries) {
+  LayoutCache()
+      : mCache(android::LruCache<LayoutCacheKey,
+                                 Layout*>::kUnlimitedCapacity),
+        mMaxBytes(kDefaultMaxBytes),
+        mBytes(0),
+        mHits(0),
+        mMisses(0) {
     mCache.setOnEntryRemovedListener(this);
   }
 
@@ -141,30 +168,57 @@ class LayoutCache : private android::OnEntryRemoved<LayoutCacheKey, Layout*> {
               LayoutContext* ctx,
               const std::shared_ptr<FontCollection>& collection) {
     Layout* layout = mCache.get(key);
-    if (layout == NULL) {
-      key.copyText();
-      layout = new Layout();
-      key.doLayout(layout, ctx, collection);
-      mCache.put(key, layout);
+    if (layout != NULL) {
+      mHits++;
+      return layout;
+    }
+    mMisses++;
+    key.copyText();
+    layout = new Layout();
+    key.doLayout(layout, ctx, collection);
+    mBytes += key.getFootprint(*layout);
+    mCache.put(key, layout);
+    // The new entry is the youngest one, so it is only evicted if it alone
+    // exceeds the limit, and the caller still needs it.
+    while (mBytes > mMaxBytes && mCache.size() > 1) {
+      mCache.removeOldest();
     }
     return layout;
   }
 
+  void setMaxBytes(size_t maxBytes) {
+    mMaxBytes = maxBytes;
+    while (mBytes > mMaxBytes && mCache.size() > 0) {
+      mCache.removeOldest();
+    }
+  }
+
+  LayoutCacheStats getStats() const {
+    LayoutCacheStats stats;
+    stats.hitCount = mHits;
+    stats.missCount = mMisses;
+    stats.entryCount = mCache.size();
+    stats.byteSize = mBytes;
+    stats.maxBytes = mMaxBytes;
+    return stats;
+  }
+
  private:
   // callback for OnEntryRemoved
   void operator()(LayoutCacheKey& key, Layout*& value) {
+    mBytes -= key.getFootprint(*value);
     key.freeText();
     delete value;
   }
 
   android::LruCache<LayoutCacheKey, Layout*> mCache;
 
-  // static const size_t kMaxEntries = LruCache<LayoutCacheKey,
-  // Layout*>::kUnlimitedCapacity;
+  size_t mMaxBytes;
+  size_t mBytes;
+  size_t mHits;
+  size_t mMisses;
 
-  // TODO: eviction based on memory footprint; for now, we just use a constant
-  // number of strings
-  static const size_t kMaxEntries = 5000;
+  static const size_t kDefaultMaxBytes = 4 * 1024 * 1024;
 };
 
 class LayoutEngine {
@@ -192,7 +246,9 @@ bool LayoutCacheKey::operator==(const LayoutCacheKey& other) const {
          mLetterSpacing == other.mLetterSpacing &&
          mPaintFlags == other.mPaintFlags && mHyphenEdit == other.mHyphenEdit &&
          mIsRtl == other.mIsRtl && mNchars == other.mNchars &&
-         !memcmp(mChars, other.mChars, mNchars * sizeof(uint16_t));
+         mNfeatures == other.mNfeatures &&
+         !memcmp(mChars, other.mChars, mNchars * sizeof(uint16_t)) &&
+         !memcmp(mFeatures, other.mFeatures, mNfeatures);
 }
 
 android::hash_t LayoutCacheKey::computeHash() const {
@@ -208,6 +264,8 @@ android::hash_t LayoutCacheKey::computeHash() const {
   hash = android::JenkinsHashMix(hash, hash_type(mHyphenEdit.getHyphen()));
   hash = android::JenkinsHashMix(hash, hash_type(mIsRtl));
   hash = android::JenkinsHashMixShorts(hash, mChars, mNchars);
+  hash = android::JenkinsHashMixBytes(
+      hash, reinterpret_cast<const uint8_t*>(mFeatures), mNfeatures);
   return android::JenkinsHashWhiten(hash);
 }
 
@@ -316,7 +374,11 @@ int Layout::findFace(const FakedFont& face, LayoutContext* ctx) {
   // Note: ctx == NULL means we're copying from the cache, no need to create
   // corresponding hb_font object.
   if (ctx != NULL) {
-    hb_font_t* font = getHbFontLocked(face.font);
+    // The cached font is shared with other layouts, so the scale and the
+    // functions that measure with this context's paint are set on a sub font.
+    hb_font_t* cachedFont = getHbFontLocked(face.font);
+    hb_font_t* font = hb_font_create_sub_font(cachedFont);
+    hb_font_destroy(cachedFont);
     hb_font_set_funcs(font, getHbFontFuncs(isColorBitmapFont(font)),
                       &ctx->paint, 0);
     ctx->hbFonts.push_back(font);
@@ -708,27 +770,14 @@ float Layout::doLayoutWord(const uint16_t* buf,
   float wordSpacing =
       count == 1 && isWordSpace(buf[start]) ? ctx->paint.wordSpacing : 0;
 
-  float advance;
-  if (ctx->paint.skipCache()) {
-    Layout layoutForWord;
-    key.doLayout(&layoutForWord, ctx, collection);
-    if (layout) {
-      layout->appendLayout(&layoutForWord, bufStart, wordSpacing);
-    }
-    if (advances) {
-      layoutForWord.getAdvances(advances);
-    }
-    advance = layoutForWord.getAdvance();
-  } else {
-    Layout* layoutForWord = cache.get(key, ctx, collection);
-    if (layout) {
-      layout->appendLayout(layoutForWord, bufStart, wordSpacing);
-    }
-    if (advances) {
-      layoutForWord->getAdvances(advances);
-    }
-    advance = layoutForWord->getAdvance();
+  Layout* layoutForWord = cache.get(key, ctx, collection);
+  if (layout) {
+    layout->appendLayout(layoutForWord, bufStart, wordSpacing);
+  }
+  if (advances) {
+    layoutForWord->getAdvances(advances);
   }
+  float advance = layoutForWord->getAdvance();
 
   if (wordSpacing != 0) {
     advance += wordSpacing;
@@ -1199,4 +1248,14 @@ void Layout::purgeCaches() {
   purgeHbFontCacheLocked();
 }
 
+void Layout::setCacheMaxBytes(size_t maxBytes) {
+  std::scoped_lock _l(gMinikinLock);
+  LayoutEngine::getInstance().layoutCache.setMaxBytes(maxBytes);
+}
+
+LayoutCacheStats Layout::getCacheStats() {
+  std::scoped_lock _l(gMinikinLock);
+  return LayoutEngine::getInstance().layoutCache.getStats();
+}
+
 }  // namespace minikin
@@ -57,6 +57,16 @@ enum {
   kBidi_Mask = 0x7
 };
 
+// Statistics of the cache of word layouts that is shared by all layouts.
+struct LayoutCacheStats {
+  size_t hitCount;
+  size_t missCount;
+  size_t entryCount;
+  // The approximate memory retained by the entries of the cache.
+  size_t byteSize;
+  size_t maxBytes;
+};
+
 // Lifecycle and threading assumptions for Layout:
 // The object is assumed to be owned by a single thread; multiple threads
 // may not mutate it at the same time.
@@ -117,6 +127,12 @@ class Layout {
   // Purge all caches, useful in low memory conditions
   static void purgeCaches();
 
+  // Limit the memory retained by the cache of word layouts. The least
+  // recently used words are evicted when the limit is exceeded.
+  static void setCacheMaxBytes(size_t maxBytes);
+
+  static LayoutCacheStats getCacheStats();
+
  private:
   friend class LayoutCacheKey;
 
@@ -79,6 +79,13 @@ void LineBreaker::setText() {
 
   // handle initial break here because addStyleRun may never be called
   mWordBreaker.next();
+  mWordBreaks.clear();
+  mRuns.clear();
+  mSpaceCount = 0;
+  resetBreaks();
+}
+
+void LineBreaker::resetBreaks() {
   mCandidates.clear();
   Candidate cand = {0,   0, 0.0, 0.0, 0.0,
                     0.0, 0, 0,   0,   HyphenationType::DONT_BREAK};
@@ -94,7 +101,27 @@ void LineBreaker::setText() {
   mPreBreak = 0;
   mLastHyphenation = HyphenEdit::NO_EDIT;
   mFirstTabIndex = INT_MAX;
-  mSpaceCount = 0;
+}
+
+LineBreaker::MeasuredText LineBreaker::takeMeasuredText() {
+  MeasuredText measured;
+  measured.mTextBuf = std::move(mTextBuf);
+  measured.mCharWidths = std::move(mCharWidths);
+  measured.mWordBreaks = std::move(mWordBreaks);
+  measured.mRuns = std::move(mRuns);
+  mTextBuf.clear();
+  mCharWidths.clear();
+  mWordBreaks.clear();
+  mRuns.clear();
+  return measured;
+}
+
+void LineBreaker::setMeasuredText(MeasuredText&& measured) {
+  mTextBuf = std::move(measured.mTextBuf);
+  mCharWidths = std::move(measured.mCharWidths);
+  mWordBreaks = std::move(measured.mWordBreaks);
+  mRuns = std::move(measured.mRuns);
+  resetBreaks();
 }
 
 void LineBreaker::setLineWidths(float firstWidth,
@@ -120,7 +147,7 @@ bool isLineEndSpace(uint16_t c) {
 // Ordinarily, this method measures the text in the range given. However, when
 // paint is nullptr, it assumes the widths have already been calculated and
 // stored in the width buffer. This method finds the candidate word breaks
-// (using the ICU break iterator) and sends them to addCandidate.
+// (using the ICU break iterator) and records them for computeBreaks.
 float LineBreaker::addStyleRun(MinikinPaint* paint,
                                const std::shared_ptr<FontCollection>& typeface,
                                FontStyle style,
@@ -129,29 +156,13 @@ float LineBreaker::addStyleRun(MinikinPaint* paint,
                                bool isRtl) {
   float width = 0.0f;
 
-  float hyphenPenalty = 0.0;
+  const size_t runIndex = mRuns.size();
+  mRuns.push_back({paint != nullptr, paint != nullptr ? paint->size : 0.0f,
+                   paint != nullptr ? paint->scaleX : 0.0f});
   if (paint != nullptr) {
     width = Layout::measureText(mTextBuf.data(), start, end - start,
                                 mTextBuf.size(), isRtl, style, *paint, typeface,
                                 mCharWidths.data() + start);
-
-    // a heuristic that seems to perform well
-    hyphenPenalty =
-        0.5 * paint->size * paint->scaleX * mLineWidths.getLineWidth(0);
-    if (mHyphenationFrequency == kHyphenationFrequency_Normal) {
-      hyphenPenalty *=
-          4.0;  // TODO: Replace with a better value after some testing
-    }
-
-    if (mJustified) {
-      // Make hyphenation more aggressive for fully justified text (so that
-      // "normal" in justified mode is the same as "full" in ragged-right).
-      hyphenPenalty *= 0.25;
-    } else {
-      // Line penalty is zero for justified text.
-      mLinePenalty =
-          std::max(mLinePenalty, hyphenPenalty * LINE_PENALTY_MULTIPLIER);
-    }
   }
 
   size_t current = (size_t)mWordBreaker.current();
@@ -209,8 +220,9 @@ float LineBreaker::addStyleRun(MinikinPaint* paint,
                 style, *paint, typeface, nullptr);
             ParaWidth hyphPreBreak = postBreak - secondPartWidth;
 
-            addWordBreak(j, hyphPreBreak, hyphPostBreak, postSpaceCount,
-                         postSpaceCount, hyphenPenalty, hyph);
+            mWordBreaks.push_back({j, hyphPreBreak, hyphPostBreak,
+                                   postSpaceCount, postSpaceCount, runIndex,
+                                   1, hyph});
 
             paint->hyphenEdit = HyphenEdit::NO_EDIT;
           }
@@ -219,9 +231,10 @@ float LineBreaker::addStyleRun(MinikinPaint* paint,
 
       // Skip break for zero-width characters inside replacement span
       if (paint != nullptr || current == end || mCharWidths[current] > 0) {
-        float penalty = hyphenPenalty * mWordBreaker.breakBadness();
-        addWordBreak(current, mWidth, postBreak, mSpaceCount, postSpaceCount,
-                     penalty, HyphenationType::DONT_BREAK);
+        mWordBreaks.push_back({current, mWidth, postBreak, mSpaceCount,
+                               postSpaceCount, runIndex,
+                               mWordBreaker.breakBadness(),
+                               HyphenationType::DONT_BREAK});
       }
       lastBreak = current;
       lastBreakWidth = mWidth;
@@ -388,6 +401,26 @@ float LineBreaker::getSpaceWidth() const {
   return 0.0f;
 }
 
+// The hyphen penalty of the breaks in a run, which depends on the line width.
+float LineBreaker::getHyphenPenalty(const MeasuredText::Run& run) const {
+  if (!run.hasPaint) {
+    return 0.0f;
+  }
+  // a heuristic that seems to perform well
+  float hyphenPenalty =
+      0.5 * run.size * run.scaleX * mLineWidths.getLineWidth(0);
+  if (mHyphenationFrequency == kHyphenationFrequency_Normal) {
+    hyphenPenalty *=
+        4.0;  // TODO: Replace with a better value after some testing
+  }
+  if (mJustified) {
+    // Make hyphenation more aggressive for fully justified text (so that
+    // "normal" in justified mode is the same as "full" in ragged-right).
+    hyphenPenalty *= 0.25;
+  }
+  return hyphenPenalty;
+}
+
 float LineBreaker::currentLineWidth() const {
   return mLineWidths.getLineWidth(mBreaks.size());
 }
@@ -520,6 +553,26 @@ void LineBreaker::computeBreaksOptimal(bool isRectangle) {
 }
 
 size_t LineBreaker::computeBreaks() {
+  // libtxt: the word breaks recorded by addStyleRun are only turned into
+  // candidates here, so that the breaks can be computed again after the line
+  // widths change.
+  resetBreaks();
+  mLinePenalty = 0.0f;
+  if (!mJustified) {
+    // Line penalty is zero for justified text.
+    for (const MeasuredText::Run& run : mRuns) {
+      mLinePenalty = std::max(mLinePenalty,
+                              getHyphenPenalty(run) * LINE_PENALTY_MULTIPLIER);
+    }
+  }
+  for (const MeasuredText::WordBreak& wordBreak : mWordBreaks) {
+    float penalty =
+        getHyphenPenalty(mRuns[wordBreak.run]) * wordBreak.penaltyMultiplier;
+    addWordBreak(wordBreak.offset, wordBreak.preBreak, wordBreak.postBreak,
+                 wordBreak.preSpaceCount, wordBreak.postSpaceCount, penalty,
+                 wordBreak.hyphenType);
+  }
+
   if (mStrategy == kBreakStrategy_Greedy) {
     computeBreaksGreedy();
   } else {
@@ -536,6 +589,8 @@ void LineBreaker::finish() {
   mBreaks.clear();
   mWidths.clear();
   mFlags.clear();
+  mWordBreaks.clear();
+  mRuns.clear();
   if (mTextBuf.size() > MAX_TEXT_BUF_RETAIN) {
     mTextBuf.clear();
     mTextBuf.shrink_to_fit();
@@ -547,6 +602,8 @@ void LineBreaker::finish() {
     mBreaks.shrink_to_fit();
     mWidths.shrink_to_fit();
     mFlags.shrink_to_fit();
+    mWordBreaks.shrink_to_fit();
+    mRuns.shrink_to_fit();
   }
   mStrategy = kBreakStrategy_Greedy;
   mHyphenationFrequency = kHyphenationFrequency_Normal;
@@ -167,7 +167,6 @@ class LineBreaker {
 
   void finish();
 
- private:
   // ParaWidth is used to hold cumulative width from beginning of paragraph.
   // Note that for very large paragraphs, accuracy could degrade using only
   // 32-bit float. Note however that float is used extensively on the Java side
@@ -175,6 +174,53 @@ class LineBreaker {
   // performance/accuracy tradeoff.
   typedef double ParaWidth;
 
+  // libtxt extension: the part of the state built by setText() and
+  // addStyleRun() that doesn't depend on the line widths. Taking it before
+  // finish() and restoring it with setMeasuredText() allows computeBreaks() to
+  // be called for other line widths without measuring the text again.
+  class MeasuredText {
+   public:
+    bool empty() const { return mTextBuf.empty(); }
+
+   private:
+    friend class LineBreaker;
+
+    // A word break found by addStyleRun(), before it is turned into
+    // candidates for the current line widths.
+    struct WordBreak {
+      size_t offset;
+      ParaWidth preBreak;
+      ParaWidth postBreak;
+      size_t preSpaceCount;
+      size_t postSpaceCount;
+      size_t run;  // index to the run the break was found in
+      int penaltyMultiplier;
+      HyphenationType hyphenType;
+    };
+
+    // The paint of a style run, from which the hyphen penalty of its breaks
+    // is computed. Runs without a paint have no hyphen penalty.
+    struct Run {
+      bool hasPaint;
+      float size;
+      float scaleX;
+    };
+
+    std::vector<uint16_t> mTextBuf;
+    std::vector<float> mCharWidths;
+    std::vector<WordBreak> mWordBreaks;
+    std::vector<Run> mRuns;
+  };
+
+  // libtxt extension: move the measured text out of the breaker.
+  MeasuredText takeMeasuredText();
+
+  // libtxt extension: use the text and word breaks of a previous measurement
+  // instead of calling setText() and addStyleRun().
+  void setMeasuredText(MeasuredText&& measured);
+
+ private:
+
   // A single candidate break
   struct Candidate {
     size_t offset;        // offset to text buffer, in code units
@@ -209,6 +255,10 @@ class LineBreaker {
 
   float getSpaceWidth() const;
 
+  float getHyphenPenalty(const MeasuredText::Run& run) const;
+
+  void resetBreaks();
+
   void computeBreaksGreedy();
 
   void computeBreaksOptimal(bool isRectangular);
@@ -223,6 +273,11 @@ class LineBreaker {
   Hyphenator* mHyphenator;
   std::vector<HyphenationType> mHyphBuf;
 
+  // libtxt: the word breaks found so far, which are only turned into
+  // candidates by computeBreaks().
+  std::vector<MeasuredText::WordBreak> mWordBreaks;
+  std::vector<MeasuredText::Run> mRuns;
+
   // layout parameters
   BreakStrategy mStrategy = kBreakStrategy_Greedy;
   HyphenationFrequency mHyphenationFrequency = kHyphenationFrequency_Normal;
@@ -21,6 +21,8 @@
 #include <minikin/Emoji.h>
 #include <minikin/Hyphenator.h>
 #include <minikin/WordBreaker.h>
+#include <mutex>
+#include <vector>
 #include "MinikinInternal.h"
 
 #include <unicode/uchar.h>
@@ -37,14 +39,39 @@ const uint32_t CHAR_ZWJ = 0x200D;
 static std::once_flag gLibtxtBreakIteratorInitFlag;
 static icu::BreakIterator* gLibtxtDefaultBreakIterator = nullptr;
 
-void WordBreaker::setLocale() {
+// libtxt extension: the clones of finished WordBreakers, which are reused by
+// the next WordBreakers instead of cloning the default iterator again.
+const size_t MAX_POOLED_BREAK_ITERATORS = 16;
+static std::mutex gLibtxtBreakIteratorPoolMutex;
+static std::vector<std::unique_ptr<icu::BreakIterator>>*
+    gLibtxtBreakIteratorPool = nullptr;
+
+void WordBreaker::acquireBreakIterator() {
+  if (mBreakIterator) {
+    return;
+  }
   UErrorCode status = U_ZERO_ERROR;
   std::call_once(gLibtxtBreakIteratorInitFlag, [&status] {
     gLibtxtDefaultBreakIterator =
         icu::BreakIterator::createLineInstance(icu::Locale(), status);
+    gLibtxtBreakIteratorPool =
+        new std::vector<std::unique_ptr<icu::BreakIterator>>();
   });
+  {
+    std::lock_guard<std::mutex> lock(gLibtxtBreakIteratorPoolMutex);
+    if (!gLibtxtBreakIteratorPool->empty()) {
+      mBreakIterator = std::move(gLibtxtBreakIteratorPool->back());
+      gLibtxtBreakIteratorPool->pop_back();
+      return;
+    }
+  }
   mBreakIterator.reset(gLibtxtDefaultBreakIterator->clone());
+}
+
+void WordBreaker::setLocale() {
+  acquireBreakIterator();
   // TODO: handle failure status
+  UErrorCode status = U_ZERO_ERROR;
   if (mText != nullptr) {
     mBreakIterator->setText(&mUText, status);
   }
@@ -52,6 +79,7 @@ void WordBreaker::setLocale() {
 }
 
 void WordBreaker::setText(const uint16_t* data, size_t size) {
+  acquireBreakIterator();
   mText = data;
   mTextSize = size;
   mIteratorWasReset = false;
@@ -288,6 +316,13 @@ void WordBreaker::finish() {
   mText = nullptr;
   // Note: calling utext_close multiply is safe
   utext_close(&mUText);
+  if (mBreakIterator) {
+    std::lock_guard<std::mutex> lock(gLibtxtBreakIteratorPoolMutex);
+    if (gLibtxtBreakIteratorPool->size() < MAX_POOLED_BREAK_ITERATORS) {
+      gLibtxtBreakIteratorPool->push_back(std::move(mBreakIterator));
+    }
+    mBreakIterator.reset();
+  }
 }
 
 }  // namespace minikin
@@ -37,6 +37,10 @@ class WordBreaker {
   // of the ICU break iterator can be reused.
   void setLocale();
 
+  // libtxt extension: finish() returns the ICU break iterator to a pool shared
+  // by all WordBreakers, and setText() takes one from it. Clones of the default
+  // iterator are only made when the pool is empty.
+
   void setText(const uint16_t* data, size_t size);
 
   // Advance iterator to next word break. Return offset, or -1 if EOT
@@ -57,6 +61,7 @@ class WordBreaker {
   void finish();
 
  private:
+  void acquireBreakIterator();
   int32_t iteratorNext();
   void detectEmailOrUrl();
   ssize_t findNextBreakInEmailOrUrl();
@@ -17,6 +17,7 @@
 #include "font_collection.h"
 
 #include <algorithm>
+#include <fstream>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -99,11 +100,17 @@ size_t FontCollection::GetFontManagersCount() const {
 
 void FontCollection::SetupDefaultFontManager(
     uint32_t font_initialization_data) {
-  default_font_manager_ = GetDefaultFontManager(font_initialization_data);
+  sk_sp<SkFontMgr> font_manager =
+      GetDefaultFontManager(font_initialization_data);
+  std::scoped_lock lock(mutex_);
+  default_font_manager_ = std::move(font_manager);
 }
 
 void FontCollection::SetDefaultFontManager(sk_sp<SkFontMgr> font_manager) {
-  default_font_manager_ = font_manager;
+  {
+    std::scoped_lock lock(mutex_);
+    default_font_manager_ = font_manager;
+  }
 
 #if FLUTTER_ENABLE_SKSHAPER
   skt_collection_.reset();
@@ -111,7 +118,10 @@ void FontCollection::SetDefaultFontManager(sk_sp<SkFontMgr> font_manager) {
 }
 
 void FontCollection::SetAssetFontManager(sk_sp<SkFontMgr> font_manager) {
-  asset_font_manager_ = font_manager;
+  {
+    std::scoped_lock lock(mutex_);
+    asset_font_manager_ = font_manager;
+  }
 
 #if FLUTTER_ENABLE_SKSHAPER
   skt_collection_.reset();
@@ -119,7 +129,10 @@ void FontCollection::SetAssetFontManager(sk_sp<SkFontMgr> font_manager) {
 }
 
 void FontCollection::SetDynamicFontManager(sk_sp<SkFontMgr> font_manager) {
-  dynamic_font_manager_ = font_manager;
+  {
+    std::scoped_lock lock(mutex_);
+    dynamic_font_manager_ = font_manager;
+  }
 
 #if FLUTTER_ENABLE_SKSHAPER
   skt_collection_.reset();
@@ -127,7 +140,10 @@ void FontCollection::SetDynamicFontManager(sk_sp<SkFontMgr> font_manager) {
 }
 
 void FontCollection::SetTestFontManager(sk_sp<SkFontMgr> font_manager) {
-  test_font_manager_ = font_manager;
+  {
+    std::scoped_lock lock(mutex_);
+    test_font_manager_ = font_manager;
+  }
 
 #if FLUTTER_ENABLE_SKSHAPER
   skt_collection_.reset();
@@ -136,6 +152,12 @@ void FontCollection::SetTestFontManager(sk_sp<SkFontMgr> font_manager) {
 
 // Return the available font managers in the order they should be queried.
 std::vector<sk_sp<SkFontMgr>> FontCollection::GetFontManagerOrder() const {
+  std::scoped_lock lock(mutex_);
+  return GetFontManagerOrderLocked();
+}
+
+std::vector<sk_sp<SkFontMgr>> FontCollection::GetFontManagerOrderLocked()
+    const {
   std::vector<sk_sp<SkFontMgr>> order;
   if (dynamic_font_manager_)
     order.push_back(dynamic_font_manager_);
@@ -149,7 +171,10 @@ std::vector<sk_sp<SkFontMgr>> FontCollection::GetFontManagerOrder() const {
 }
 
 void FontCollection::DisableFontFallback() {
-  enable_font_fallback_ = false;
+  {
+    std::scoped_lock lock(mutex_);
+    enable_font_fallback_ = false;
+  }
 
 #if FLUTTER_ENABLE_SKSHAPER
   if (skt_collection_) {
@@ -164,11 +189,19 @@ FontCollection::GetMinikinFontCollectionForFamilies(
     const std::string& locale) {
   // Look inside the font collections cache first.
   FamilyKey family_key(font_families, locale);
-  auto cached = font_collections_cache_.find(family_key);
-  if (cached != font_collections_cache_.end()) {
-    return cached->second;
+  size_t generation;
+  {
+    std::scoped_lock lock(mutex_);
+    auto cached = font_collections_cache_.find(family_key);
+    if (cached != font_collections_cache_.end()) {
+      return cached->second;
+    }
+    generation = font_collections_generation_;
   }
 
+  // The cache mutex is not held from here on because creating the font
+  // families and the collection acquires the lock of minikin. See |mutex_|.
+
   std::vector<std::shared_ptr<minikin::FontFamily>> minikin_families;
 
   // Search for all user provided font families.
@@ -194,15 +227,19 @@ FontCollection::GetMinikinFontCollectionForFamilies(
   }
   // Default font family also not found. We fail to get a FontCollection.
   if (minikin_families.empty()) {
-    font_collections_cache_[family_key] = nullptr;
-    return nullptr;
+    return CacheFontCollection(family_key, generation, nullptr);
   }
-  if (enable_font_fallback_) {
-    for (const std::string& fallback_family :
-         fallback_fonts_for_locale_[locale]) {
-      auto it = fallback_fonts_.find(fallback_family);
-      if (it != fallback_fonts_.end()) {
-        minikin_families.push_back(it->second);
+  bool enable_font_fallback;
+  {
+    std::scoped_lock lock(mutex_);
+    enable_font_fallback = enable_font_fallback_;
+    if (enable_font_fallback) {
+      for (const std::string& fallback_family :
+           fallback_fonts_for_locale_[locale]) {
+        auto it = fallback_fonts_.find(fallback_family);
+        if (it != fallback_fonts_.end()) {
+          minikin_families.push_back(it->second);
+        }
       }
     }
   }
@@ -210,18 +247,32 @@ FontCollection::GetMinikinFontCollectionForFamilies(
   auto font_collection =
       minikin::FontCollection::Create(std::move(minikin_families));
   if (!font_collection) {
-    font_collections_cache_[family_key] = nullptr;
-    return nullptr;
+    return CacheFontCollection(family_key, generation, nullptr);
   }
-  if (enable_font_fallback_) {
+  if (enable_font_fallback) {
     font_collection->set_fallback_font_provider(
         std::make_unique<TxtFallbackFontProvider>(shared_from_this()));
   }
 
   // Cache the font collection for future queries.
-  font_collections_cache_[family_key] = font_collection;
+  return CacheFontCollection(family_key, generation,
+                             std::move(font_collection));
+}
 
-  return font_collection;
+std::shared_ptr<minikin::FontCollection> FontCollection::CacheFontCollection(
+    const FamilyKey& family_key,
+    size_t generation,
+    std::shared_ptr<minikin::FontCollection> font_collection) {
+  std::scoped_lock lock(mutex_);
+  if (generation != font_collections_generation_) {
+    // The cache was cleared while the collection was created, for example
+    // because a fallback font was added, so the collection may be stale.
+    return font_collection;
+  }
+  // Another thread may have created the collection in the meantime.
+  auto inserted =
+      font_collections_cache_.emplace(family_key, std::move(font_collection));
+  return inserted.first->second;
 }
 
 std::shared_ptr<minikin::FontFamily> FontCollection::FindFontFamilyInManagers(
@@ -321,20 +372,54 @@ const std::shared_ptr<minikin::FontFamily>& FontCollection::MatchFallbackFont(
   // Check if the ch's matched font has been cached. We cache the results of
   // this method as repeated matchFamilyStyleCharacter calls can become
   // extremely laggy when typing a large number of complex emojis.
-  auto lookup = fallback_match_cache_.find(ch);
-  if (lookup != fallback_match_cache_.end()) {
+  std::scoped_lock lock(mutex_);
+  auto& locale_cache = fallback_match_cache_[locale];
+  auto lookup = locale_cache.find(ch);
+  if (lookup != locale_cache.end()) {
     return *lookup->second;
   }
   const std::shared_ptr<minikin::FontFamily>* match =
       &DoMatchFallbackFont(ch, locale);
-  fallback_match_cache_.insert(std::make_pair(ch, match));
+  locale_cache.insert(std::make_pair(ch, match));
   return *match;
 }
 
 const std::shared_ptr<minikin::FontFamily>& FontCollection::DoMatchFallbackFont(
     uint32_t ch,
     std::string locale) {
-  for (const sk_sp<SkFontMgr>& manager : GetFontManagerOrder()) {
+  // A fallback font usually covers a whole range of code points, such as an
+  // emoji or CJK font, so the fonts that were already found for the locale
+  // are tried before querying the font managers again.
+  for (const std::string& family_name : fallback_fonts_for_locale_[locale]) {
+    auto it = fallback_fonts_.find(family_name);
+    if (it != fallback_fonts_.end() && it->second &&
+        it->second->hasGlyph(ch, 0)) {
+      return it->second;
+    }
+  }
+
+  // Then the fonts that the font managers returned for the locale in previous
+  // launches.
+  auto persisted = persisted_fallback_fonts_for_locale_.find(locale);
+  while (persisted != persisted_fallback_fonts_for_locale_.end() &&
+         !persisted->second.empty()) {
+    std::string family_name = std::move(persisted->second.front());
+    persisted->second.erase(persisted->second.begin());
+    for (const sk_sp<SkFontMgr>& manager : GetFontManagerOrderLocked()) {
+      const std::shared_ptr<minikin::FontFamily>& family =
+          GetFallbackFontFamily(manager, family_name);
+      if (!family) {
+        continue;
+      }
+      fallback_fonts_for_locale_[locale].push_back(family_name);
+      if (family->hasGlyph(ch, 0)) {
+        return family;
+      }
+      break;
+    }
+  }
+
+  for (const sk_sp<SkFontMgr>& manager : GetFontManagerOrderLocked()) {
     std::vector<const char*> bcp47;
     if (!locale.empty())
       bcp47.push_back(locale.c_str());
@@ -349,8 +434,10 @@ const std::shared_ptr<minikin::FontFamily>& FontCollection::DoMatchFallbackFont(
 
     if (std::find(fallback_fonts_for_locale_[locale].begin(),
                   fallback_fonts_for_locale_[locale].end(),
-                  family_name) == fallback_fonts_for_locale_[locale].end())
+                  family_name) == fallback_fonts_for_locale_[locale].end()) {
       fallback_fonts_for_locale_[locale].push_back(family_name);
+      PersistFallbackFont(locale, family_name);
+    }
 
     return GetFallbackFontFamily(manager, family_name);
   }
@@ -377,12 +464,59 @@ FontCollection::GetFallbackFontFamily(const sk_sp<SkFontMgr>& manager,
   // Clear the cache to force creation of new font collections that will
   // include this fallback font.
   font_collections_cache_.clear();
+  font_collections_generation_++;
 
   return insert_it.first->second;
 }
 
+// The fallback cache file holds one line per fallback font with the locale
+// and the family name separated by a tab.
+void FontCollection::SetFallbackCachePath(const std::string& path) {
+  std::scoped_lock lock(mutex_);
+  fallback_cache_path_ = path;
+  persisted_fallback_fonts_for_locale_.clear();
+
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    size_t separator = line.find('\t');
+    if (separator == std::string::npos || separator + 1 == line.size()) {
+      continue;
+    }
+    std::string locale = line.substr(0, separator);
+    std::string family_name = line.substr(separator + 1);
+    const auto& found = fallback_fonts_for_locale_[locale];
+    auto& persisted = persisted_fallback_fonts_for_locale_[locale];
+    if (std::find(found.begin(), found.end(), family_name) == found.end() &&
+        std::find(persisted.begin(), persisted.end(), family_name) ==
+            persisted.end()) {
+      persisted.push_back(std::move(family_name));
+    }
+  }
+}
+
+void FontCollection::PersistFallbackFont(const std::string& locale,
+                                         const std::string& family_name) {
+  if (fallback_cache_path_.empty() ||
+      locale.find_first_of("\t\n") != std::string::npos ||
+      family_name.find_first_of("\t\n") != std::string::npos) {
+    return;
+  }
+  // New fallback fonts are rare, so they are appended as they are found.
+  std::ofstream file(fallback_cache_path_, std::ios::app);
+  file << locale << '\t' << family_name << '\n';
+  if (!file) {
+    FML_LOG(ERROR) << "Could not write the font fallback cache to "
+                   << fallback_cache_path_;
+  }
+}
+
 void FontCollection::ClearFontFamilyCache() {
-  font_collections_cache_.clear();
+  {
+    std::scoped_lock lock(mutex_);
+    font_collections_cache_.clear();
+    font_collections_generation_++;
+  }
 
 #if FLUTTER_ENABLE_SKSHAPER
   if (skt_collection_) {
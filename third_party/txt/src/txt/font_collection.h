@@ -18,6 +18,7 @@
 #define LIB_TXT_SRC_FONT_COLLECTION_H_
 
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -37,6 +38,9 @@
 
 namespace txt {
 
+// The font lookups and their caches may be used by paragraphs that are laid
+// out on any thread. The font managers and the fallback settings are expected
+// to be set on the thread that owns the collection.
 class FontCollection : public std::enable_shared_from_this<FontCollection> {
  public:
   FontCollection();
@@ -57,10 +61,19 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
 
   // Provides a FontFamily that contains glyphs for ch. This caches previously
   // matched fonts. Also see FontCollection::DoMatchFallbackFont.
+  //
+  // This is called by minikin during layout and requires the minikin lock to
+  // be held.
   const std::shared_ptr<minikin::FontFamily>& MatchFallbackFont(
       uint32_t ch,
       std::string locale);
 
+  // Persists the fallback fonts found by the font managers to the file at
+  // path, and tries the fonts persisted there by previous launches before
+  // querying the font managers. Fonts that are no longer available are
+  // skipped.
+  void SetFallbackCachePath(const std::string& path);
+
   // Do not provide alternative fonts that can match characters which are
   // missing from the requested font family.
   void DisableFontFallback();
@@ -90,6 +103,10 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
     };
   };
 
+  // Guards the font managers and the caches below. When both locks are
+  // needed, the minikin lock must be acquired first, so minikin must not be
+  // called with this mutex held unless the minikin lock is already held.
+  mutable std::mutex mutex_;
   sk_sp<SkFontMgr> default_font_manager_;
   sk_sp<SkFontMgr> asset_font_manager_;
   sk_sp<SkFontMgr> dynamic_font_manager_;
@@ -98,14 +115,23 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
                      std::shared_ptr<minikin::FontCollection>,
                      FamilyKey::Hasher>
       font_collections_cache_;
-  // Cache that stores the results of MatchFallbackFont to ensure lag-free emoji
-  // font fallback matching.
-  std::unordered_map<uint32_t, const std::shared_ptr<minikin::FontFamily>*>
+  // Incremented whenever font_collections_cache_ is cleared, so that
+  // collections created concurrently with the clearing are not cached.
+  size_t font_collections_generation_ = 0;
+  // Cache that stores the results of MatchFallbackFont by locale and code
+  // point to ensure lag-free emoji font fallback matching.
+  std::unordered_map<
+      std::string,
+      std::unordered_map<uint32_t, const std::shared_ptr<minikin::FontFamily>*>>
       fallback_match_cache_;
   std::unordered_map<std::string, std::shared_ptr<minikin::FontFamily>>
       fallback_fonts_;
   std::unordered_map<std::string, std::vector<std::string>>
       fallback_fonts_for_locale_;
+  // The fallback fonts of previous launches that have not been loaded yet.
+  std::unordered_map<std::string, std::vector<std::string>>
+      persisted_fallback_fonts_for_locale_;
+  std::string fallback_cache_path_;
   bool enable_font_fallback_;
 
 #if FLUTTER_ENABLE_SKSHAPER
@@ -121,6 +147,20 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
 
   std::vector<sk_sp<SkFontMgr>> GetFontManagerOrder() const;
 
+  std::vector<sk_sp<SkFontMgr>> GetFontManagerOrderLocked() const;
+
+  // Appends a fallback font found by the font managers to the fallback cache
+  // file, if there is one.
+  void PersistFallbackFont(const std::string& locale,
+                           const std::string& family_name);
+
+  // Caches a collection created for family_key unless the cache was cleared
+  // since generation was read. Returns the cached collection.
+  std::shared_ptr<minikin::FontCollection> CacheFontCollection(
+      const FamilyKey& family_key,
+      size_t generation,
+      std::shared_ptr<minikin::FontCollection> font_collection);
+
   std::shared_ptr<minikin::FontFamily> FindFontFamilyInManagers(
       const std::string& family_name);
 
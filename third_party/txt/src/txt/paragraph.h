@@ -144,6 +144,10 @@ class Paragraph {
   // before Painting and getting any statistics from this class.
   virtual void Layout(double width) = 0;
 
+  // Whether Layout() may be called on a thread other than the one that built
+  // the paragraph. No other method may be called while it is laid out.
+  virtual bool CanLayoutOnAnyThread() { return false; }
+
   // Paints the laid out text onto the supplied SkCanvas at (x, y) offset from
   // the origin. Only valid after Layout() is called.
   virtual void Paint(SkCanvas* canvas, double x, double y) = 0;
@@ -266,6 +266,13 @@ bool ParagraphTxt::ComputeLineBreaks() {
   // Break at the end of the paragraph.
   newline_positions.push_back(text_.size());
 
+  const bool reuse_measured_blocks =
+      measured_blocks_.size() == newline_positions.size();
+  if (!reuse_measured_blocks) {
+    measured_blocks_.clear();
+    measured_blocks_.resize(newline_positions.size());
+  }
+
   // Calculate and add any breaks due to a line being too long.
   size_t run_index = 0;
   size_t inline_placeholder_index = 0;
@@ -289,71 +296,27 @@ bool ParagraphTxt::ComputeLineBreaks() {
     breaker_.setLineWidths(0.0f, 0, width_);
     breaker_.setJustified(paragraph_style_.text_align == TextAlign::justify);
     breaker_.setStrategy(paragraph_style_.break_strategy);
-    breaker_.resize(block_size);
-    memcpy(breaker_.buffer(), text_.data() + block_start,
-           block_size * sizeof(text_[0]));
-    breaker_.setText();
-
-    // Add the runs that include this line to the LineBreaker.
-    double block_total_width = 0;
-    while (run_index < runs_.size()) {
-      StyledRuns::Run run = runs_.GetRun(run_index);
-      if (run.start >= block_end)
-        break;
-      if (run.end < block_start) {
-        run_index++;
-        continue;
-      }
 
-      minikin::FontStyle font;
-      minikin::MinikinPaint paint;
-      GetFontAndMinikinPaint(run.style, &font, &paint);
-      std::shared_ptr<minikin::FontCollection> collection =
-          GetMinikinFontCollectionForStyle(run.style);
-      if (collection == nullptr) {
-        FML_LOG(INFO) << "Could not find font collection for families \""
-                      << (run.style.font_families.empty()
-                              ? ""
-                              : run.style.font_families[0])
-                      << "\".";
+    // The text only needs to be measured again if it changed since the last
+    // layout. Otherwise only the breaks are computed for the new width.
+    MeasuredBlock& measured_block = measured_blocks_[newline_index];
+    if (reuse_measured_blocks) {
+      breaker_.setMeasuredText(std::move(measured_block.text));
+    } else {
+      breaker_.resize(block_size);
+      memcpy(breaker_.buffer(), text_.data() + block_start,
+             block_size * sizeof(text_[0]));
+      breaker_.setText();
+      if (!MeasureBlock(block_start, block_end, &run_index,
+                        &inline_placeholder_index,
+                        &measured_block.total_width)) {
+        breaker_.finish();
+        measured_blocks_.clear();
         return false;
       }
-      size_t run_start = std::max(run.start, block_start) - block_start;
-      size_t run_end = std::min(run.end, block_end) - block_start;
-      bool isRtl = (paragraph_style_.text_direction == TextDirection::rtl);
-
-      // Check if the run is an object replacement character-only run. We should
-      // leave space for inline placeholder and break around it if appropriate.
-      if (run.end - run.start == 1 &&
-          obj_replacement_char_indexes_.count(run.start) != 0 &&
-          text_[run.start] == objReplacementChar &&
-          inline_placeholder_index < inline_placeholders_.size()) {
-        // Is a inline placeholder run.
-        PlaceholderRun placeholder_run =
-            inline_placeholders_[inline_placeholder_index];
-        block_total_width += placeholder_run.width;
-
-        // Inject custom width into minikin breaker. (Uses LibTxt-minikin
-        // patch).
-        breaker_.setCustomCharWidth(run_start, placeholder_run.width);
-
-        // Called with nullptr as paint in order to use the custom widths passed
-        // above.
-        breaker_.addStyleRun(nullptr, collection, font, run_start, run_end,
-                             isRtl);
-        inline_placeholder_index++;
-      } else {
-        // Is a regular text run.
-        double run_width = breaker_.addStyleRun(&paint, collection, font,
-                                                run_start, run_end, isRtl);
-        block_total_width += run_width;
-      }
-
-      if (run.end > block_end)
-        break;
-      run_index++;
     }
-    max_intrinsic_width_ = std::max(max_intrinsic_width_, block_total_width);
+    max_intrinsic_width_ =
+        std::max(max_intrinsic_width_, measured_block.total_width);
 
     size_t breaks_count = breaker_.computeBreaks();
     const int* breaks = breaker_.getBreaks();
@@ -376,12 +339,81 @@ bool ParagraphTxt::ComputeLineBreaks() {
       line_widths_.push_back(breaker_.getWidths()[i]);
     }
 
+    measured_block.text = breaker_.takeMeasuredText();
     breaker_.finish();
   }
 
   return true;
 }
 
+bool ParagraphTxt::MeasureBlock(size_t block_start,
+                                size_t block_end,
+                                size_t* run_index,
+                                size_t* inline_placeholder_index,
+                                double* block_total_width) {
+  // Add the runs that include this line to the LineBreaker.
+  *block_total_width = 0;
+  while (*run_index < runs_.size()) {
+    StyledRuns::Run run = runs_.GetRun(*run_index);
+    if (run.start >= block_end)
+      break;
+    if (run.end < block_start) {
+      (*run_index)++;
+      continue;
+    }
+
+    minikin::FontStyle font;
+    minikin::MinikinPaint paint;
+    GetFontAndMinikinPaint(run.style, &font, &paint);
+    std::shared_ptr<minikin::FontCollection> collection =
+        GetMinikinFontCollectionForStyle(run.style);
+    if (collection == nullptr) {
+      FML_LOG(INFO) << "Could not find font collection for families \""
+                    << (run.style.font_families.empty()
+                            ? ""
+                            : run.style.font_families[0])
+                    << "\".";
+      return false;
+    }
+    size_t run_start = std::max(run.start, block_start) - block_start;
+    size_t run_end = std::min(run.end, block_end) - block_start;
+    bool isRtl = (paragraph_style_.text_direction == TextDirection::rtl);
+
+    // Check if the run is an object replacement character-only run. We should
+    // leave space for inline placeholder and break around it if appropriate.
+    if (run.end - run.start == 1 &&
+        obj_replacement_char_indexes_.count(run.start) != 0 &&
+        text_[run.start] == objReplacementChar &&
+        *inline_placeholder_index < inline_placeholders_.size()) {
+      // Is a inline placeholder run.
+      PlaceholderRun placeholder_run =
+          inline_placeholders_[*inline_placeholder_index];
+      *block_total_width += placeholder_run.width;
+
+      // Inject custom width into minikin breaker. (Uses LibTxt-minikin
+      // patch).
+      breaker_.setCustomCharWidth(run_start, placeholder_run.width);
+
+      // Called with nullptr as paint in order to use the custom widths passed
+      // above.
+      breaker_.addStyleRun(nullptr, collection, font, run_start, run_end,
+                           isRtl);
+      (*inline_placeholder_index)++;
+    } else {
+      // Is a regular text run.
+      double run_width = breaker_.addStyleRun(&paint, collection, font,
+                                              run_start, run_end, isRtl);
+      *block_total_width += run_width;
+    }
+
+    if (run.end > block_end)
+      break;
+    (*run_index)++;
+  }
+
+  return true;
+}
+
 bool ParagraphTxt::ComputeBidiRuns(std::vector<BidiRun>* result) {
   if (text_.empty())
     return true;
@@ -673,9 +705,14 @@ void ParagraphTxt::Layout(double width) {
 
   width_ = rounded_width;
 
+  // The measured text can only be reused if nothing but the width changed.
+  if (needs_layout_) {
+    measured_blocks_.clear();
+  }
   needs_layout_ = false;
 
   records_.clear();
+  paint_batches_.clear();
   glyph_lines_.clear();
   code_unit_runs_.clear();
   inline_placeholder_code_unit_runs_.clear();
@@ -1407,25 +1444,94 @@ sk_sp<SkTypeface> ParagraphTxt::GetDefaultSkiaTypeface(const TextStyle& style) {
 
 // The x,y coordinates will be the very top left corner of the rendered
 // paragraph.
+namespace {
+
+SkPaint GetRecordPaint(const PaintRecord& record) {
+  if (record.style().has_foreground) {
+    return record.style().foreground;
+  }
+  SkPaint paint;
+  paint.setColor(record.style().color);
+  return paint;
+}
+
+// Whether the record only draws its text, which can then be merged with the
+// text of its neighbors without changing the order in which things are
+// painted.
+bool CanBatchRecord(const PaintRecord& record) {
+  return record.GetPlaceholderRun() == nullptr && record.text() &&
+         record.style().text_shadows.empty() &&
+         (record.style().decoration == TextDecoration::kNone ||
+          record.isGhost());
+}
+
+void AppendTextBlob(SkTextBlobBuilder& builder,
+                    const SkTextBlob& blob,
+                    SkPoint offset) {
+  SkTextBlob::Iter iter(blob);
+  SkTextBlob::Iter::ExperimentalRun run;
+  while (iter.experimentalNext(&run)) {
+    // The runs are always built with full positioning.
+    const SkTextBlobBuilder::RunBuffer& buffer =
+        builder.allocRunPos(run.font, run.count);
+    std::copy(run.glyphs, run.glyphs + run.count, buffer.glyphs);
+    SkPoint* points = buffer.points();
+    for (int i = 0; i < run.count; i++) {
+      points[i] = run.positions[i] + offset;
+    }
+  }
+}
+
+}  // namespace
+
+void ParagraphTxt::ComputePaintBatches() {
+  SkTextBlobBuilder builder;
+  for (size_t start = 0; start < records_.size();) {
+    const PaintRecord& record = records_[start];
+    PaintBatch batch;
+    batch.paint = GetRecordPaint(record);
+    batch.record_start = start;
+    batch.record_end = start + 1;
+    if (CanBatchRecord(record)) {
+      while (batch.record_end < records_.size() &&
+             CanBatchRecord(records_[batch.record_end]) &&
+             GetRecordPaint(records_[batch.record_end]) == batch.paint) {
+        batch.record_end++;
+      }
+    }
+    if (batch.record_end - batch.record_start > 1) {
+      for (size_t i = batch.record_start; i < batch.record_end; i++) {
+        AppendTextBlob(builder, *records_[i].text(), records_[i].offset());
+      }
+      batch.text = builder.make();
+    }
+    start = batch.record_end;
+    paint_batches_.push_back(std::move(batch));
+  }
+}
+
 void ParagraphTxt::Paint(SkCanvas* canvas, double x, double y) {
   SkPoint base_offset = SkPoint::Make(x, y);
-  SkPaint paint;
   // Paint the background first before painting any text to prevent
   // potential overlap.
   for (const PaintRecord& record : records_) {
     PaintBackground(canvas, record, base_offset);
   }
-  for (const PaintRecord& record : records_) {
-    if (record.style().has_foreground) {
-      paint = record.style().foreground;
-    } else {
-      paint.reset();
-      paint.setColor(record.style().color);
+  if (paint_batches_.empty()) {
+    ComputePaintBatches();
+  }
+  for (const PaintBatch& batch : paint_batches_) {
+    if (batch.text) {
+      canvas->drawTextBlob(batch.text, base_offset.x(), base_offset.y(),
+                           batch.paint);
+      continue;
     }
+    const PaintRecord& record = records_[batch.record_start];
     SkPoint offset = base_offset + record.offset();
     if (record.GetPlaceholderRun() == nullptr) {
       PaintShadow(canvas, record, offset);
-      canvas->drawTextBlob(record.text(), offset.x(), offset.y(), paint);
+      canvas->drawTextBlob(record.text(), offset.x(), offset.y(),
+                           batch.paint);
     }
     PaintDecorations(canvas, record, base_offset);
   }
@@ -34,6 +34,7 @@
 #include "styled_runs.h"
 #include "third_party/googletest/googletest/include/gtest/gtest_prod.h"  // nogncheck
 #include "third_party/skia/include/core/SkFontMetrics.h"
+#include "third_party/skia/include/core/SkPaint.h"
 #include "third_party/skia/include/core/SkRect.h"
 #include "utils/LinuxUtils.h"
 #include "utils/MacUtils.h"
@@ -73,6 +74,8 @@ class ParagraphTxt : public Paragraph {
   // (10k+ characters) to ensure speedy layout.
   virtual void Layout(double width) override;
 
+  virtual bool CanLayoutOnAnyThread() override { return true; }
+
   virtual void Paint(SkCanvas* canvas, double x, double y) override;
   virtual bool Paint(flutter::DisplayListBuilder* builder,
                      double x,
@@ -169,6 +172,7 @@ class ParagraphTxt : public Paragraph {
   FRIEND_TEST(ParagraphTest, GetGlyphPositionAtCoordinateSegfault);
   FRIEND_TEST(ParagraphTest, KhmerLineBreaker);
   FRIEND_TEST(ParagraphTest, TextHeightBehaviorRectsParagraph);
+  FRIEND_TEST(ParagraphTest, PaintBatchesMergeRecordsWithTheSamePaint);
 
   // Starting data to layout.
   std::vector<uint16_t> text_;
@@ -191,6 +195,15 @@ class ParagraphTxt : public Paragraph {
   minikin::LineBreaker breaker_;
   mutable std::unique_ptr<icu::BreakIterator> word_breaker_;
 
+  // The text between two hard breaks, as measured by the line breaker.
+  struct MeasuredBlock {
+    minikin::LineBreaker::MeasuredText text;
+    double total_width = 0;
+  };
+  // The measured blocks of the last layout, which are reused by layouts that
+  // only change the width.
+  std::vector<MeasuredBlock> measured_blocks_;
+
   std::vector<LineMetrics> line_metrics_;
   size_t final_line_count_ = 0;
   std::vector<double> line_widths_;
@@ -198,6 +211,18 @@ class ParagraphTxt : public Paragraph {
   // Stores the result of Layout().
   std::vector<PaintRecord> records_;
 
+  // A range of records that is painted with a single text blob.
+  struct PaintBatch {
+    SkPaint paint;
+    // The text of all the records of the range positioned relative to the
+    // paragraph, or null if the range holds a single record.
+    sk_sp<SkTextBlob> text;
+    size_t record_start;
+    size_t record_end;
+  };
+  // Computed by the first Paint() after Layout() and reused by later ones.
+  std::vector<PaintBatch> paint_batches_;
+
   bool did_exceed_max_lines_;
 
   // Strut metrics of zero will have no effect on the layout.
@@ -350,6 +375,13 @@ class ParagraphTxt : public Paragraph {
   // Break the text into lines.
   bool ComputeLineBreaks();
 
+  // Add the runs of the block between two hard breaks to the line breaker.
+  bool MeasureBlock(size_t block_start,
+                    size_t block_end,
+                    size_t* run_index,
+                    size_t* inline_placeholder_index,
+                    double* block_total_width);
+
   // Break the text into runs based on LTR/RTL text direction.
   bool ComputeBidiRuns(std::vector<BidiRun>* result);
 
@@ -399,6 +431,10 @@ class ParagraphTxt : public Paragraph {
   // Draws the shadows onto the canvas.
   void PaintShadow(SkCanvas* canvas, const PaintRecord& record, SkPoint offset);
 
+  // Groups consecutive records that only draw text with the same paint, so
+  // that styled text is painted with fewer text blobs.
+  void ComputePaintBatches();
+
   // Obtain a Minikin font collection matching this text style.
   std::shared_ptr<minikin::FontCollection> GetMinikinFontCollectionForStyle(
       const TextStyle& style);
@@ -21,6 +21,8 @@
 
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <hb.h>
 
@@ -90,4 +92,47 @@ TEST_F(HbFontCacheTest, purgeCacheTest) {
   EXPECT_EQ(nullptr, hb_font_get_user_data(font, &key));
 }
 
+TEST_F(HbFontCacheTest, maxEntriesTest) {
+  std::vector<std::shared_ptr<MinikinFontForTest>> fonts;
+  for (size_t i = 0; i < 32; i++) {
+    fonts.push_back(std::make_shared<MinikinFontForTest>(kTestFontDir
+                                                         "Regular.ttf"));
+  }
+
+  // Each of the 8 shards keeps a single font.
+  setHbFontCacheMaxEntries(8);
+  for (const auto& font : fonts) {
+    hb_font_destroy(getHbFont(font.get()));
+  }
+  EXPECT_LE(getHbFontCacheEntryCount(), 8u);
+  EXPECT_GT(getHbFontCacheEntryCount(), 0u);
+
+  setHbFontCacheMaxEntries(256);
+  for (const auto& font : fonts) {
+    hb_font_destroy(getHbFont(font.get()));
+  }
+  EXPECT_EQ(getHbFontCacheEntryCount(), fonts.size());
+}
+
+TEST_F(HbFontCacheTest, concurrentGetHbFontTest) {
+  std::shared_ptr<MinikinFontForTest> minikinFont(
+      new MinikinFontForTest(kTestFontDir "Regular.ttf"));
+
+  // Threads looking up the same font without gMinikinLock share one font.
+  std::vector<hb_font_t*> results(4, nullptr);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < results.size(); i++) {
+    threads.emplace_back([&results, &minikinFont, i]() {
+      results[i] = getHbFont(minikinFont.get());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (hb_font_t* font : results) {
+    EXPECT_EQ(results[0], font);
+    hb_font_destroy(font);
+  }
+}
+
 }  // namespace minikin
@@ -14,10 +14,17 @@
  * limitations under the License.
  */
 
+#include <mutex>
+
+#include "flutter/fml/file.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/paths.h"
 #include "gtest/gtest.h"
+#include "minikin/MinikinInternal.h"
 #include "third_party/skia/include/utils/SkCustomTypeface.h"
+#include "txt/asset_font_manager.h"
 #include "txt/font_collection.h"
+#include "txt/typeface_font_asset_provider.h"
 #include "txt_test_utils.h"
 
 namespace txt {
@@ -63,6 +70,34 @@ void PopulateUserTypefaceBoilerplate(SkCustomTypefaceBuilder* builder) {
     builder->setGlyph(index, width / upem, path.makeTransform(scale));
   }
 }
+
+// Resolves every fallback query to the CJK test font and counts the queries.
+class CountingFallbackFontManager : public AssetFontManager {
+ public:
+  CountingFallbackFontManager()
+      : AssetFontManager(CreateTestFontProvider()) {}
+
+  int fallback_queries() const { return fallback_queries_; }
+
+ private:
+  static std::unique_ptr<FontAssetProvider> CreateTestFontProvider() {
+    auto font_provider = std::make_unique<TypefaceFontAssetProvider>();
+    RegisterFontsFromPath(*font_provider, GetFontDir());
+    return font_provider;
+  }
+
+  // |SkFontMgr|
+  SkTypeface* onMatchFamilyStyleCharacter(const char familyName[],
+                                          const SkFontStyle& style,
+                                          const char* bcp47[],
+                                          int bcp47Count,
+                                          SkUnichar character) const override {
+    fallback_queries_++;
+    return matchFamilyStyle("Noto Sans CJK JP", style);
+  }
+
+  mutable int fallback_queries_ = 0;
+};
 }  // namespace
 
 TEST(FontCollectionTest, CheckSkTypefacesSorting) {
@@ -138,6 +173,48 @@ TEST(FontCollectionTest, CheckSkTypefacesSorting) {
             SkFontStyle::kExpanded_Width);
 }
 
+TEST(FontCollectionTest, FallbackFontsCoverRangesOfCodePoints) {
+  auto manager = sk_make_sp<CountingFallbackFontManager>();
+  auto collection = std::make_shared<FontCollection>();
+  collection->SetDefaultFontManager(manager);
+
+  std::scoped_lock lock(minikin::gMinikinLock);
+  const auto& family = collection->MatchFallbackFont(0x4E00, "ja");
+  ASSERT_TRUE(family);
+  EXPECT_EQ(manager->fallback_queries(), 1);
+
+  // Other characters of the fallback font reuse it without another query.
+  EXPECT_EQ(collection->MatchFallbackFont(0x65E5, "ja"), family);
+  EXPECT_EQ(collection->MatchFallbackFont(0x672C, "ja"), family);
+  EXPECT_EQ(manager->fallback_queries(), 1);
+
+  // The fallback fonts of one locale are not used for another.
+  EXPECT_TRUE(collection->MatchFallbackFont(0x4E00, "zh"));
+  EXPECT_EQ(manager->fallback_queries(), 2);
+}
+
+TEST(FontCollectionTest, FallbackFontsArePersisted) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  const std::string cache_path =
+      fml::paths::JoinPaths({temp_dir.path(), "fallback_fonts"});
+  std::scoped_lock lock(minikin::gMinikinLock);
+
+  auto first_manager = sk_make_sp<CountingFallbackFontManager>();
+  auto first_collection = std::make_shared<FontCollection>();
+  first_collection->SetDefaultFontManager(first_manager);
+  first_collection->SetFallbackCachePath(cache_path);
+  ASSERT_TRUE(first_collection->MatchFallbackFont(0x4E00, "ja"));
+  EXPECT_EQ(first_manager->fallback_queries(), 1);
+
+  // A collection reading the same cache finds the font without a query.
+  auto second_manager = sk_make_sp<CountingFallbackFontManager>();
+  auto second_collection = std::make_shared<FontCollection>();
+  second_collection->SetDefaultFontManager(second_manager);
+  second_collection->SetFallbackCachePath(cache_path);
+  EXPECT_TRUE(second_collection->MatchFallbackFont(0x65E5, "ja"));
+  EXPECT_EQ(second_manager->fallback_queries(), 0);
+}
+
 #if 0
 
 TEST(FontCollection, HasDefaultRegistrations) {
@@ -18,6 +18,7 @@
 #include <iostream>
 
 #include "flutter/fml/logging.h"
+#include "minikin/Layout.h"
 #include "render_test.h"
 #include "third_party/icu/source/common/unicode/unistr.h"
 #include "third_party/skia/include/core/SkColor.h"
@@ -7111,4 +7112,160 @@ TEST_F(ParagraphTest, MixedTextHeightBehaviorRectsParagraph) {
 
   ASSERT_TRUE(Snapshot());
 }
+
+TEST_F(ParagraphTest, PaintBatchesMergeRecordsWithTheSamePaint) {
+  txt::ParagraphStyle paragraph_style;
+  txt::ParagraphBuilderTxt builder(paragraph_style, GetTestFontCollection());
+
+  txt::TextStyle text_style;
+  text_style.font_families = std::vector<std::string>(1, "Roboto");
+  text_style.color = SK_ColorBLACK;
+  builder.PushStyle(text_style);
+  builder.AddText(u"Regular ");
+  text_style.font_weight = txt::FontWeight::w700;
+  builder.PushStyle(text_style);
+  builder.AddText(u"bold ");
+  text_style.color = SK_ColorRED;
+  builder.PushStyle(text_style);
+  builder.AddText(u"red ");
+  text_style.decoration = TextDecoration::kUnderline;
+  builder.PushStyle(text_style);
+  builder.AddText(u"underlined");
+  builder.Pop();
+  builder.Pop();
+  builder.Pop();
+  builder.Pop();
+
+  auto paragraph = BuildParagraph(builder);
+  paragraph->Layout(GetTestCanvasWidth());
+  ASSERT_EQ(paragraph->records_.size(), 4ull);
+
+  paragraph->Paint(GetCanvas(), 10.0, 15.0);
+
+  // The black records are painted as one blob. The red one has another paint
+  // and the underlined one paints its decoration after its text.
+  ASSERT_EQ(paragraph->paint_batches_.size(), 3ull);
+  const ParagraphTxt::PaintBatch& black = paragraph->paint_batches_[0];
+  EXPECT_EQ(black.record_start, 0ull);
+  EXPECT_EQ(black.record_end, 2ull);
+  ASSERT_NE(black.text, nullptr);
+  EXPECT_EQ(black.paint.getColor(), SK_ColorBLACK);
+  EXPECT_EQ(paragraph->paint_batches_[1].text, nullptr);
+  EXPECT_EQ(paragraph->paint_batches_[2].text, nullptr);
+
+  // Painting again reuses the merged blobs.
+  const SkTextBlob* text = black.text.get();
+  paragraph->Paint(GetCanvas(), 10.0, 15.0);
+  EXPECT_EQ(paragraph->paint_batches_[0].text.get(), text);
+
+  ASSERT_TRUE(Snapshot());
+
+  // Laying out again discards them.
+  paragraph->Layout(GetTestCanvasWidth() / 2);
+  EXPECT_TRUE(paragraph->paint_batches_.empty());
+}
+
+static std::unique_ptr<ParagraphTxt> BuildCacheTestParagraph(
+    const std::u16string& text) {
+  txt::ParagraphStyle paragraph_style;
+  txt::ParagraphBuilderTxt builder(paragraph_style, GetTestFontCollection());
+
+  txt::TextStyle text_style;
+  text_style.font_families = std::vector<std::string>(1, "Roboto");
+  text_style.color = SK_ColorBLACK;
+  builder.PushStyle(text_style);
+  builder.AddText(text);
+  builder.Pop();
+
+  return BuildParagraph(builder);
+}
+
+TEST_F(ParagraphTest, ShapedWordsAreSharedAcrossParagraphs) {
+  const char* text = "Quizzical zephyrs vex jumbo kites";
+  auto icu_text = icu::UnicodeString::fromUTF8(text);
+  std::u16string u16_text(icu_text.getBuffer(),
+                          icu_text.getBuffer() + icu_text.length());
+
+  auto paragraph = BuildCacheTestParagraph(u16_text);
+  const minikin::LayoutCacheStats before = minikin::Layout::getCacheStats();
+  paragraph->Layout(GetTestCanvasWidth());
+  const minikin::LayoutCacheStats first = minikin::Layout::getCacheStats();
+  EXPECT_GT(first.missCount, before.missCount);
+
+  // Laying out the same text at another width only breaks the lines again.
+  paragraph->Layout(100);
+  const minikin::LayoutCacheStats relayout = minikin::Layout::getCacheStats();
+  EXPECT_EQ(relayout.missCount, first.missCount);
+  EXPECT_GT(relayout.hitCount, first.hitCount);
+  EXPECT_GT(paragraph->GetLineCount(), 1ull);
+
+  // Another paragraph with the same text and style reuses the words.
+  auto other_paragraph = BuildCacheTestParagraph(u16_text);
+  other_paragraph->Layout(GetTestCanvasWidth());
+  const minikin::LayoutCacheStats other = minikin::Layout::getCacheStats();
+  EXPECT_EQ(other.missCount, relayout.missCount);
+  EXPECT_GT(other.hitCount, relayout.hitCount);
+  EXPECT_EQ(other_paragraph->GetLongestLine(),
+            paragraph->GetMaxIntrinsicWidth());
+}
+
+TEST_F(ParagraphTest, RelayoutAtNewWidthMatchesFreshLayout) {
+  const char* text =
+      "The quick brown fox jumps over the lazy dog.\nPack my box with five "
+      "dozen liquor jugs.\n\nHow vexingly quick daft zebras jump!";
+  auto icu_text = icu::UnicodeString::fromUTF8(text);
+  std::u16string u16_text(icu_text.getBuffer(),
+                          icu_text.getBuffer() + icu_text.length());
+
+  // The second layout only breaks the measured text into lines again.
+  auto paragraph = BuildCacheTestParagraph(u16_text);
+  paragraph->Layout(GetTestCanvasWidth());
+  paragraph->Layout(150);
+
+  auto fresh_paragraph = BuildCacheTestParagraph(u16_text);
+  fresh_paragraph->Layout(150);
+
+  EXPECT_EQ(paragraph->GetMaxIntrinsicWidth(),
+            fresh_paragraph->GetMaxIntrinsicWidth());
+  const auto& lines = paragraph->GetLineMetrics();
+  const auto& fresh_lines = fresh_paragraph->GetLineMetrics();
+  ASSERT_EQ(lines.size(), fresh_lines.size());
+  EXPECT_GT(lines.size(), 4ull);
+  for (size_t i = 0; i < lines.size(); i++) {
+    EXPECT_EQ(lines[i].start_index, fresh_lines[i].start_index);
+    EXPECT_EQ(lines[i].end_index, fresh_lines[i].end_index);
+    EXPECT_EQ(lines[i].width, fresh_lines[i].width);
+  }
+
+  // Laying out at the first width again gives the lines of the first layout.
+  paragraph->Layout(GetTestCanvasWidth());
+  fresh_paragraph->SetDirty();
+  fresh_paragraph->Layout(GetTestCanvasWidth());
+  ASSERT_EQ(paragraph->GetLineMetrics().size(),
+            fresh_paragraph->GetLineMetrics().size());
+  EXPECT_EQ(paragraph->GetLongestLine(), fresh_paragraph->GetLongestLine());
+}
+
+TEST_F(ParagraphTest, ShapedWordCacheRespectsMemoryLimit) {
+  const char* text = "Sphinx of black quartz, judge my vow";
+  auto icu_text = icu::UnicodeString::fromUTF8(text);
+  std::u16string u16_text(icu_text.getBuffer(),
+                          icu_text.getBuffer() + icu_text.length());
+
+  const size_t max_bytes = minikin::Layout::getCacheStats().maxBytes;
+  minikin::Layout::setCacheMaxBytes(1);
+  EXPECT_EQ(minikin::Layout::getCacheStats().entryCount, 0ull);
+  EXPECT_EQ(minikin::Layout::getCacheStats().byteSize, 0ull);
+
+  auto paragraph = BuildCacheTestParagraph(u16_text);
+  paragraph->Layout(GetTestCanvasWidth());
+
+  // Only the most recently shaped word is kept.
+  const minikin::LayoutCacheStats stats = minikin::Layout::getCacheStats();
+  EXPECT_EQ(stats.entryCount, 1ull);
+  EXPECT_GT(paragraph->GetLongestLine(), 0.0);
+  EXPECT_EQ(paragraph->GetLineCount(), 1ull);
+
+  minikin::Layout::setCacheMaxBytes(max_bytes);
+}
 }  // namespace txt
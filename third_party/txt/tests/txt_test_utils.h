@@ -20,6 +20,7 @@
 #include "txt/font_collection.h"
 #include "txt/paragraph_builder_txt.h"
 #include "txt/paragraph_txt.h"
+#include "txt/typeface_font_asset_provider.h"
 
 namespace txt {
 
@@ -31,6 +32,9 @@ const fml::CommandLine& GetCommandLineForProcess();
 
 void SetCommandLine(fml::CommandLine cmd);
 
+void RegisterFontsFromPath(TypefaceFontAssetProvider& font_provider,
+                           std::string directory_path);
+
 std::shared_ptr<FontCollection> GetTestFontCollection();
 
 std::unique_ptr<ParagraphTxt> BuildParagraph(ParagraphBuilderTxt& builder);
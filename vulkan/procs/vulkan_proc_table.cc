@@ -114,6 +114,7 @@ bool VulkanProcTable::SetupInstanceProcAddresses(
                       GetPhysicalDeviceMemoryProperties2KHR, handle);
 
 #if FML_OS_ANDROID
+  ACQUIRE_PROC(EnumerateDeviceExtensionProperties, handle);
   ACQUIRE_PROC(GetPhysicalDeviceSurfaceCapabilitiesKHR, handle);
   ACQUIRE_PROC(GetPhysicalDeviceSurfaceFormatsKHR, handle);
   ACQUIRE_PROC(GetPhysicalDeviceSurfacePresentModesKHR, handle);
@@ -187,6 +188,15 @@ bool VulkanProcTable::SetupDeviceProcAddresses(
   ACQUIRE_PROC(DestroySwapchainKHR, handle);
   ACQUIRE_PROC(GetSwapchainImagesKHR, handle);
   ACQUIRE_PROC(QueuePresentKHR, handle);
+
+  // The display timing functions are optional, see the debug report functions
+  // above. Users check for their presence with
+  // |VulkanDevice::IsDisplayTimingEnabled|.
+  [this, &handle]() -> bool {
+    ACQUIRE_PROC(GetPastPresentationTimingGOOGLE, handle);
+    ACQUIRE_PROC(GetRefreshCycleDurationGOOGLE, handle);
+    return true;
+  }();
 #endif  // FML_OS_ANDROID
 #if OS_FUCHSIA
   ACQUIRE_PROC(ImportSemaphoreZirconHandleFUCHSIA, handle);
@@ -133,10 +133,13 @@ class VulkanProcTable : public fml::RefCountedThreadSafe<VulkanProcTable> {
 
 #ifndef TEST_VULKAN_PROCS
 #if FML_OS_ANDROID
+  DEFINE_PROC(EnumerateDeviceExtensionProperties);
+  DEFINE_PROC(GetPastPresentationTimingGOOGLE);
   DEFINE_PROC(GetPhysicalDeviceSurfaceCapabilitiesKHR);
   DEFINE_PROC(GetPhysicalDeviceSurfaceFormatsKHR);
   DEFINE_PROC(GetPhysicalDeviceSurfacePresentModesKHR);
   DEFINE_PROC(GetPhysicalDeviceSurfaceSupportKHR);
+  DEFINE_PROC(GetRefreshCycleDurationGOOGLE);
   DEFINE_PROC(GetSwapchainImagesKHR);
   DEFINE_PROC(QueuePresentKHR);
   DEFINE_PROC(CreateAndroidSurfaceKHR);
@@ -108,6 +108,19 @@ bool VulkanBackbuffer::WaitFences() {
              std::numeric_limits<uint64_t>::max())) == VK_SUCCESS;
 }
 
+bool VulkanBackbuffer::AreFencesSignaled() {
+  VkFence fences[use_fences_.size()];
+
+  for (size_t i = 0; i < use_fences_.size(); i++) {
+    fences[i] = use_fences_[i];
+  }
+
+  // Waiting with a timeout of zero only queries the fences. VK_TIMEOUT is the
+  // expected result for fences that are pending, so it is not logged.
+  return vk.WaitForFences(device_, static_cast<uint32_t>(use_fences_.size()),
+                          fences, true, 0) == VK_SUCCESS;
+}
+
 bool VulkanBackbuffer::ResetFences() {
   VkFence fences[use_fences_.size()];
 
@@ -28,6 +28,10 @@ class VulkanBackbuffer {
 
   [[nodiscard]] bool WaitFences();
 
+  /// Whether the GPU is done with the backbuffer, so that |WaitFences| would
+  /// not block.
+  [[nodiscard]] bool AreFencesSignaled();
+
   [[nodiscard]] bool ResetFences();
 
   const VulkanHandle<VkFence>& GetUsageFence() const;
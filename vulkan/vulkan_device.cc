@@ -4,6 +4,8 @@
 
 #include "vulkan_device.h"
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #include <map>
 #include <vector>
@@ -35,6 +37,7 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
     : vk(p_vk),
       physical_device_(std::move(physical_device)),
       graphics_queue_index_(std::numeric_limits<uint32_t>::max()),
+      display_timing_enabled_(false),
       valid_(false) {
   if (!physical_device_ || !vk.AreInstanceProcsSetup()) {
     return;
@@ -58,7 +61,7 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
       .pQueuePriorities = priorities,
   };
 
-  const char* extensions[] = {
+  std::vector<const char*> extensions = {
 #if FML_OS_ANDROID
     VK_KHR_SWAPCHAIN_EXTENSION_NAME,
 #endif
@@ -72,6 +75,15 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
 #endif
   };
 
+#if FML_OS_ANDROID
+  // Display timing lets the swapchain schedule presents and measure when they
+  // reached the display, see |VulkanSwapchainOptions|.
+  if (HasDeviceExtension(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME)) {
+    extensions.push_back(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME);
+    display_timing_enabled_ = true;
+  }
+#endif
+
   auto enabled_layers =
       DeviceLayersToEnable(vk, physical_device_, enable_validation_layers);
 
@@ -89,8 +101,8 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
       .pQueueCreateInfos = &queue_create,
       .enabledLayerCount = static_cast<uint32_t>(enabled_layers.size()),
       .ppEnabledLayerNames = layers,
-      .enabledExtensionCount = sizeof(extensions) / sizeof(const char*),
-      .ppEnabledExtensionNames = extensions,
+      .enabledExtensionCount = static_cast<uint32_t>(extensions.size()),
+      .ppEnabledExtensionNames = extensions.data(),
       .pEnabledFeatures = nullptr,
   };
 
@@ -138,6 +150,7 @@ VulkanDevice::VulkanDevice(VulkanProcTable& p_vk,
       device_(std::move(device)),
       queue_(std::move(queue)),
       graphics_queue_index_(queue_family_index),
+      display_timing_enabled_(false),
       valid_(false) {
   if (!physical_device_ || !vk.AreInstanceProcsSetup()) {
     return;
@@ -347,6 +360,7 @@ int VulkanDevice::ChooseSurfaceFormat(
 }
 
 bool VulkanDevice::ChoosePresentMode(const VulkanSurface& surface,
+                                     VkPresentModeKHR preferred_mode,
                                      VkPresentModeKHR* present_mode) const {
   if (!surface.IsValid() || present_mode == nullptr) {
     return false;
@@ -359,13 +373,63 @@ bool VulkanDevice::ChoosePresentMode(const VulkanSurface& surface,
   // powered by Vsync pulses instead of depending the submit to block.
   // However, for platforms that don't have VSync providers set up, it is better
   // to fall back to FIFO. For platforms that do have VSync providers, there
-  // should be little difference. In case there is a need for a mode other than
-  // FIFO, availability checks must be performed here before returning the
-  // result. FIFO is always present.
+  // should be little difference. FIFO is always present, so it is the default
+  // and the fallback for the other modes.
   *present_mode = VK_PRESENT_MODE_FIFO_KHR;
+  if (preferred_mode == VK_PRESENT_MODE_FIFO_KHR) {
+    return true;
+  }
+
+#if FML_OS_ANDROID
+  uint32_t mode_count = 0;
+  if (VK_CALL_LOG_ERROR(vk.GetPhysicalDeviceSurfacePresentModesKHR(
+          physical_device_, surface.Handle(), &mode_count, nullptr)) !=
+      VK_SUCCESS) {
+    return true;
+  }
+
+  std::vector<VkPresentModeKHR> modes(mode_count);
+  if (VK_CALL_LOG_ERROR(vk.GetPhysicalDeviceSurfacePresentModesKHR(
+          physical_device_, surface.Handle(), &mode_count, modes.data())) !=
+      VK_SUCCESS) {
+    return true;
+  }
+
+  if (std::find(modes.begin(), modes.end(), preferred_mode) != modes.end()) {
+    *present_mode = preferred_mode;
+  }
+#endif
   return true;
 }
 
+bool VulkanDevice::IsDisplayTimingEnabled() const {
+  return display_timing_enabled_;
+}
+
+bool VulkanDevice::HasDeviceExtension(const char* name) const {
+#if FML_OS_ANDROID
+  uint32_t count = 0;
+  if (VK_CALL_LOG_ERROR(vk.EnumerateDeviceExtensionProperties(
+          physical_device_, nullptr, &count, nullptr)) != VK_SUCCESS) {
+    return false;
+  }
+
+  std::vector<VkExtensionProperties> properties(count);
+  if (VK_CALL_LOG_ERROR(vk.EnumerateDeviceExtensionProperties(
+          physical_device_, nullptr, &count, properties.data())) !=
+      VK_SUCCESS) {
+    return false;
+  }
+
+  for (const auto& extension : properties) {
+    if (strcmp(extension.extensionName, name) == 0) {
+      return true;
+    }
+  }
+#endif
+  return false;
+}
+
 bool VulkanDevice::QueueSubmit(
     std::vector<VkPipelineStageFlags> wait_dest_pipeline_stages,
     const std::vector<VkSemaphore>& wait_semaphores,
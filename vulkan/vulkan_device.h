@@ -63,9 +63,19 @@ class VulkanDevice {
       const std::vector<VkFormat>& desired_formats,
       VkSurfaceFormatKHR* format) const;
 
+  /// @brief  Chooses |preferred_mode| if the surface supports it, and
+  ///         VK_PRESENT_MODE_FIFO_KHR, which is always supported, otherwise.
+  ///
   [[nodiscard]] bool ChoosePresentMode(const VulkanSurface& surface,
+                                       VkPresentModeKHR preferred_mode,
                                        VkPresentModeKHR* present_mode) const;
 
+  /// @brief  Whether the VK_GOOGLE_display_timing extension was enabled on
+  ///         the device. It is enabled when it is supported and the device
+  ///         was created by this object.
+  ///
+  bool IsDisplayTimingEnabled() const;
+
   [[nodiscard]] bool QueueSubmit(
       std::vector<VkPipelineStageFlags> wait_dest_pipeline_stages,
       const std::vector<VkSemaphore>& wait_semaphores,
@@ -82,9 +92,11 @@ class VulkanDevice {
   VulkanHandle<VkQueue> queue_;
   VulkanHandle<VkCommandPool> command_pool_;
   uint32_t graphics_queue_index_;
+  bool display_timing_enabled_;
   bool valid_;
 
   bool InitializeCommandPool();
+  bool HasDeviceExtension(const char* name) const;
   std::vector<VkQueueFamilyProperties> GetQueueFamilyProperties() const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(VulkanDevice);
@@ -4,6 +4,8 @@
 
 #include "vulkan_swapchain.h"
 
+#include <algorithm>
+
 #include "flutter/vulkan/procs/vulkan_proc_table.h"
 
 #include "third_party/skia/include/core/SkColorSpace.h"
@@ -44,14 +46,19 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
                                  const VulkanSurface& surface,
                                  GrDirectContext* skia_context,
                                  std::unique_ptr<VulkanSwapchain> old_swapchain,
-                                 uint32_t queue_family_index)
+                                 uint32_t queue_family_index,
+                                 const VulkanSwapchainOptions& options)
     : vk(p_vk),
       device_(device),
+      options_(options),
       capabilities_(),
       surface_format_(),
       current_pipeline_stage_(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
       current_backbuffer_index_(0),
       current_image_index_(0),
+      display_timing_enabled_(false),
+      refresh_duration_(0),
+      last_present_id_(0),
       valid_(false) {
   if (!device_.IsValid() || !surface.IsValid() || skia_context == nullptr) {
     FML_DLOG(INFO) << "Device or surface is invalid.";
@@ -82,7 +89,8 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
   }
 
   VkPresentModeKHR present_mode = VK_PRESENT_MODE_FIFO_KHR;
-  if (!device_.ChoosePresentMode(surface, &present_mode)) {
+  if (!device_.ChoosePresentMode(surface, options_.present_mode,
+                                 &present_mode)) {
     FML_DLOG(INFO) << "Could not choose present mode.";
     return;
   }
@@ -116,6 +124,17 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
 
   VkSurfaceKHR surface_handle = surface.Handle();
 
+  // In mailbox mode, a new frame replaces the queued one instead of waiting
+  // for it to be displayed, which needs an image besides the displayed and
+  // the queued one.
+  uint32_t image_count = capabilities_.minImageCount;
+  if (present_mode == VK_PRESENT_MODE_MAILBOX_KHR) {
+    image_count = std::max(image_count, 3u);
+    if (capabilities_.maxImageCount > 0) {
+      image_count = std::min(image_count, capabilities_.maxImageCount);
+    }
+  }
+
   VkImageUsageFlags usage_flags = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
                                   VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
                                   VK_IMAGE_USAGE_TRANSFER_DST_BIT;
@@ -125,7 +144,7 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
       .pNext = nullptr,
       .flags = 0,
       .surface = surface_handle,
-      .minImageCount = capabilities_.minImageCount,
+      .minImageCount = image_count,
       .imageFormat = surface_format_.format,
       .imageColorSpace = surface_format_.colorSpace,
       .imageExtent = capabilities_.currentExtent,
@@ -163,6 +182,16 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
     return;
   }
 
+  if (options_.enable_display_timing && device_.IsDisplayTimingEnabled() &&
+      vk.GetRefreshCycleDurationGOOGLE && vk.GetPastPresentationTimingGOOGLE) {
+    VkRefreshCycleDurationGOOGLE refresh_cycle = {};
+    if (VK_CALL_LOG_ERROR(vk.GetRefreshCycleDurationGOOGLE(
+            device_.GetHandle(), swapchain_, &refresh_cycle)) == VK_SUCCESS) {
+      refresh_duration_ = refresh_cycle.refreshDuration;
+      display_timing_enabled_ = true;
+    }
+  }
+
   valid_ = true;
 }
 
@@ -268,16 +297,6 @@ bool VulkanSwapchain::CreateSwapchainImages(
   const SkISize surface_size = GetSize();
 
   for (const VkImage& image : images) {
-    // Populate the backbuffer.
-    auto backbuffer = std::make_unique<VulkanBackbuffer>(
-        vk, device_.GetHandle(), device_.GetCommandPool());
-
-    if (!backbuffer->IsValid()) {
-      return false;
-    }
-
-    backbuffers_.emplace_back(std::move(backbuffer));
-
     // Populate the image.
     VulkanHandle<VkImage> image_handle = VulkanHandle<VkImage>{
         image, [this](VkImage image) {
@@ -302,30 +321,87 @@ bool VulkanSwapchain::CreateSwapchainImages(
     surfaces_.emplace_back(std::move(surface));
   }
 
-  FML_DCHECK(backbuffers_.size() == images_.size());
   FML_DCHECK(images_.size() == surfaces_.size());
 
   return true;
 }
 
 VulkanBackbuffer* VulkanSwapchain::GetNextBackbuffer() {
-  auto available_backbuffers = backbuffers_.size();
+  // The oldest backbuffer is reused if the GPU is done with it. Otherwise a
+  // new one is inserted in front of it instead of waiting for its fences, so
+  // that the number of frames in flight grows to what the GPU and the present
+  // mode need, up to one per swapchain image.
+  if (!backbuffers_.empty()) {
+    auto next_backbuffer_index =
+        (current_backbuffer_index_ + 1) % backbuffers_.size();
 
-  if (available_backbuffers == 0) {
-    return nullptr;
-  }
+    auto& backbuffer = backbuffers_[next_backbuffer_index];
 
-  auto next_backbuffer_index =
-      (current_backbuffer_index_ + 1) % backbuffers_.size();
+    if (!backbuffer->IsValid()) {
+      return nullptr;
+    }
+
+    if (backbuffers_.size() >= images_.size() ||
+        backbuffer->AreFencesSignaled()) {
+      current_backbuffer_index_ = next_backbuffer_index;
+      return backbuffer.get();
+    }
+  }
 
-  auto& backbuffer = backbuffers_[next_backbuffer_index];
+  auto backbuffer = std::make_unique<VulkanBackbuffer>(
+      vk, device_.GetHandle(), device_.GetCommandPool());
 
   if (!backbuffer->IsValid()) {
     return nullptr;
   }
 
-  current_backbuffer_index_ = next_backbuffer_index;
-  return backbuffer.get();
+  size_t index = backbuffers_.empty() ? 0 : current_backbuffer_index_ + 1;
+  backbuffers_.insert(backbuffers_.begin() + index, std::move(backbuffer));
+  current_backbuffer_index_ = index;
+  return backbuffers_[index].get();
+}
+
+void VulkanSwapchain::UpdatePresentationTimings() {
+  uint32_t count = 0;
+  if (VK_CALL_LOG_ERROR(vk.GetPastPresentationTimingGOOGLE(
+          device_.GetHandle(), swapchain_, &count, nullptr)) != VK_SUCCESS ||
+      count == 0) {
+    return;
+  }
+
+  std::vector<VkPastPresentationTimingGOOGLE> timings(count);
+  // More timings may have become available since the count was queried, in
+  // which case the result is VK_INCOMPLETE and the rest is reported later.
+  VkResult result = vk.GetPastPresentationTimingGOOGLE(
+      device_.GetHandle(), swapchain_, &count, timings.data());
+  if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || count == 0) {
+    return;
+  }
+
+  // The timings are reported in the order the frames were presented.
+  last_presentation_timing_ = timings[count - 1];
+}
+
+uint64_t VulkanSwapchain::GetDesiredPresentTime(uint32_t present_id) const {
+  // Zero presents as early as the present mode allows.
+  if (options_.refresh_cycles_per_frame <= 1 || refresh_duration_ == 0 ||
+      !last_presentation_timing_.has_value()) {
+    return 0;
+  }
+
+  // Paces the frame relative to the last one that was displayed, and aims
+  // half a refresh early so that jitter doesn't push it to the next vsync.
+  const auto& last = last_presentation_timing_.value();
+  uint64_t frames_since_last = present_id - last.presentID;
+  return last.actualPresentTime +
+         frames_since_last * options_.refresh_cycles_per_frame *
+             refresh_duration_ -
+         refresh_duration_ / 2;
+}
+
+std::optional<VkPastPresentationTimingGOOGLE>
+VulkanSwapchain::GetLastPresentationTiming() const {
+  return last_presentation_timing_;
 }
 
 VulkanSwapchain::AcquireResult VulkanSwapchain::AcquireSurface() {
@@ -571,9 +647,24 @@ bool VulkanSwapchain::Submit() {
   // ---------------------------------------------------------------------------
   VkSwapchainKHR swapchain = swapchain_;
   uint32_t present_image_index = static_cast<uint32_t>(current_image_index_);
+
+  VkPresentTimeGOOGLE present_time = {};
+  const VkPresentTimesInfoGOOGLE present_times_info = {
+      .sType = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE,
+      .pNext = nullptr,
+      .swapchainCount = 1,
+      .pTimes = &present_time,
+  };
+  if (display_timing_enabled_) {
+    UpdatePresentationTimings();
+    present_time.presentID = ++last_present_id_;
+    present_time.desiredPresentTime =
+        GetDesiredPresentTime(present_time.presentID);
+  }
+
   const VkPresentInfoKHR present_info = {
       .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-      .pNext = nullptr,
+      .pNext = display_timing_enabled_ ? &present_times_info : nullptr,
       .waitSemaphoreCount =
           static_cast<uint32_t>(queue_signal_semaphores.size()),
       .pWaitSemaphores = queue_signal_semaphores.data(),
@@ -6,6 +6,7 @@
 #define FLUTTER_VULKAN_VULKAN_SWAPCHAIN_H_
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -23,6 +24,30 @@ class VulkanSurface;
 class VulkanBackbuffer;
 class VulkanImage;
 
+/// How a swapchain trades latency against power. The defaults present every
+/// frame in order at vsync.
+struct VulkanSwapchainOptions {
+  /// The preferred present mode. Falls back to VK_PRESENT_MODE_FIFO_KHR if the
+  /// surface doesn't support it.
+  ///
+  /// VK_PRESENT_MODE_MAILBOX_KHR replaces a queued frame with a newer one
+  /// instead of blocking, which reduces latency when frames are produced
+  /// faster than the display refreshes, at the cost of the power spent on the
+  /// frames that are dropped. VK_PRESENT_MODE_FIFO_RELAXED_KHR presents a
+  /// late frame immediately instead of waiting for the next vsync, which may
+  /// tear.
+  VkPresentModeKHR present_mode = VK_PRESENT_MODE_FIFO_KHR;
+
+  /// Whether to use VK_GOOGLE_display_timing when the device supports it, to
+  /// measure when frames reach the display and to pace presents.
+  bool enable_display_timing = false;
+
+  /// With display timing, presents every frame at the earliest this many
+  /// refresh cycles after the previous one, for example 2 to run at 30Hz on
+  /// a 60Hz display to save power.
+  uint32_t refresh_cycles_per_frame = 1;
+};
+
 class VulkanSwapchain {
  public:
   VulkanSwapchain(const VulkanProcTable& vk,
@@ -30,7 +55,8 @@ class VulkanSwapchain {
                   const VulkanSurface& surface,
                   GrDirectContext* skia_context,
                   std::unique_ptr<VulkanSwapchain> old_swapchain,
-                  uint32_t queue_family_index);
+                  uint32_t queue_family_index,
+                  const VulkanSwapchainOptions& options);
 
   ~VulkanSwapchain();
 
@@ -60,19 +86,32 @@ class VulkanSwapchain {
 
   SkISize GetSize() const;
 
+  /// The timing of the most recent present that is known to have reached the
+  /// display, if display timing is in use. Times are in nanoseconds of
+  /// CLOCK_MONOTONIC.
+  std::optional<VkPastPresentationTimingGOOGLE> GetLastPresentationTiming()
+      const;
+
 #if FML_OS_ANDROID
  private:
   const VulkanProcTable& vk;
   const VulkanDevice& device_;
+  const VulkanSwapchainOptions options_;
   VkSurfaceCapabilitiesKHR capabilities_;
   VkSurfaceFormatKHR surface_format_;
   VulkanHandle<VkSwapchainKHR> swapchain_;
+  // Created on demand, up to one per image, when the GPU has not released
+  // the existing ones yet. See |GetNextBackbuffer|.
   std::vector<std::unique_ptr<VulkanBackbuffer>> backbuffers_;
   std::vector<std::unique_ptr<VulkanImage>> images_;
   std::vector<sk_sp<SkSurface>> surfaces_;
   VkPipelineStageFlagBits current_pipeline_stage_;
   size_t current_backbuffer_index_;
   size_t current_image_index_;
+  bool display_timing_enabled_;
+  uint64_t refresh_duration_;
+  uint32_t last_present_id_;
+  std::optional<VkPastPresentationTimingGOOGLE> last_presentation_timing_;
   bool valid_;
 
   std::vector<VkImage> GetImages() const;
@@ -90,6 +129,10 @@ class VulkanSwapchain {
                                      sk_sp<SkColorSpace> color_space) const;
 
   VulkanBackbuffer* GetNextBackbuffer();
+
+  void UpdatePresentationTimings();
+
+  uint64_t GetDesiredPresentTime(uint32_t present_id) const;
 #endif  // FML_OS_ANDROID
 
   FML_DISALLOW_COPY_AND_ASSIGN(VulkanSwapchain);
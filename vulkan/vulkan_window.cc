@@ -21,15 +21,21 @@
 namespace vulkan {
 
 VulkanWindow::VulkanWindow(fml::RefPtr<VulkanProcTable> proc_table,
-                           std::unique_ptr<VulkanNativeSurface> native_surface)
+                           std::unique_ptr<VulkanNativeSurface> native_surface,
+                           const VulkanSwapchainOptions& swapchain_options)
     : VulkanWindow(/*context/*/ nullptr,
                    proc_table,
-                   std::move(native_surface)) {}
+                   std::move(native_surface),
+                   swapchain_options) {}
 
 VulkanWindow::VulkanWindow(const sk_sp<GrDirectContext>& context,
                            fml::RefPtr<VulkanProcTable> proc_table,
-                           std::unique_ptr<VulkanNativeSurface> native_surface)
-    : valid_(false), vk(std::move(proc_table)), skia_gr_context_(context) {
+                           std::unique_ptr<VulkanNativeSurface> native_surface,
+                           const VulkanSwapchainOptions& swapchain_options)
+    : valid_(false),
+      vk(std::move(proc_table)),
+      swapchain_options_(swapchain_options),
+      skia_gr_context_(context) {
   if (!vk || !vk->HasAcquiredMandatoryProcAddresses()) {
     FML_DLOG(INFO) << "Proc table has not acquired mandatory proc addresses.";
     return;
@@ -263,7 +269,8 @@ bool VulkanWindow::RecreateSwapchain() {
 
   auto swapchain = std::make_unique<VulkanSwapchain>(
       *vk, *logical_device_, *surface_, skia_gr_context_.get(),
-      std::move(old_swapchain), logical_device_->GetGraphicsQueueIndex());
+      std::move(old_swapchain), logical_device_->GetGraphicsQueueIndex(),
+      swapchain_options_);
 
   if (!swapchain->IsValid()) {
     return false;
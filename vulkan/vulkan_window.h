@@ -14,6 +14,7 @@
 #include "flutter/fml/compiler_specific.h"
 #include "flutter/fml/macros.h"
 #include "flutter/vulkan/procs/vulkan_proc_table.h"
+#include "flutter/vulkan/vulkan_swapchain.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
 #include "third_party/skia/include/core/SkSize.h"
 #include "third_party/skia/include/core/SkSurface.h"
@@ -37,7 +38,8 @@ class VulkanWindow {
   ///             GrDirectContext.
   ///
   VulkanWindow(fml::RefPtr<VulkanProcTable> proc_table,
-               std::unique_ptr<VulkanNativeSurface> native_surface);
+               std::unique_ptr<VulkanNativeSurface> native_surface,
+               const VulkanSwapchainOptions& swapchain_options = {});
 
   //------------------------------------------------------------------------------
   /// @brief      Construct a VulkanWindow. Let reuse an existing
@@ -45,7 +47,8 @@ class VulkanWindow {
   ///
   VulkanWindow(const sk_sp<GrDirectContext>& context,
                fml::RefPtr<VulkanProcTable> proc_table,
-               std::unique_ptr<VulkanNativeSurface> native_surface);
+               std::unique_ptr<VulkanNativeSurface> native_surface,
+               const VulkanSwapchainOptions& swapchain_options = {});
 
   ~VulkanWindow();
 
@@ -64,6 +67,7 @@ class VulkanWindow {
   std::unique_ptr<VulkanDevice> logical_device_;
   std::unique_ptr<VulkanSurface> surface_;
   std::unique_ptr<VulkanSwapchain> swapchain_;
+  const VulkanSwapchainOptions swapchain_options_;
   sk_sp<skgpu::VulkanMemoryAllocator> memory_allocator_;
   sk_sp<GrDirectContext> skia_gr_context_;
 